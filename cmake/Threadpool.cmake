@@ -1,5 +1,5 @@
 #===============================================================================
-# Copyright 2020-2021 Intel Corporation
+# Copyright 2020-2025 Intel Corporation
 #
 # Licensed under the Apache License, Version 2.0 (the "License");
 # you may not use this file except in compliance with the License.
@@ -44,5 +44,9 @@ if("${DNNL_CPU_THREADING_RUNTIME}" STREQUAL "THREADPOOL")
         message(STATUS "Threadpool testing: standalone")
     endif()
 
+    if("${_DNNL_TEST_THREADPOOL_IMPL}" STREQUAL "BUILTIN")
+        message(STATUS "Threadpool testing: built-in")
+    endif()
+
     add_definitions(-DDNNL_TEST_THREADPOOL_USE_${_DNNL_TEST_THREADPOOL_IMPL})
 endif()
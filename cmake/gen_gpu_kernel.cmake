@@ -24,6 +24,9 @@ file(READ ${CL_FILE} cl_file_lines)
 
 string(LENGTH "${cl_file_lines}" len)
 if(MINIFY OR len GREATER 65535)
+    # Remove C style comments, which include the license headers
+    string(REGEX REPLACE "/\\*[^*]*\\*+([^/*][^*]*\\*+)*/" " "
+        cl_file_lines "${cl_file_lines}")
     # Remove C++ style comments
     string(REGEX REPLACE "//[^\n]*\n" "\n" cl_file_lines "${cl_file_lines}")
     # Remove repeated whitespaces
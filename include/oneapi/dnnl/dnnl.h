@@ -202,6 +202,110 @@ dnnl_status_t DNNL_API dnnl_primitive_create_from_cache_blob(
 dnnl_status_t DNNL_API dnnl_primitive_execute(const_dnnl_primitive_t primitive,
         dnnl_stream_t stream, int nargs, const dnnl_exec_arg_t *args);
 
+/// Executes an ordered list of primitives.
+///
+/// The result is the same as calling dnnl_primitive_execute() for each
+/// primitive in order, but the arguments of all primitives are validated and
+/// converted before the first primitive is executed, and the stream
+/// execution hooks run once for the whole list. This reduces the per-call
+/// overhead for sequences of small primitives.
+///
+/// @param stream Stream to use. All primitives must belong to the engine of
+///     the stream.
+/// @param n Number of primitives.
+/// @param primitives Array of @p n primitives to execute.
+/// @param nargs Array of @p n numbers of arguments, one per primitive.
+/// @param args Array of @p n argument arrays, one per primitive. See
+///     dnnl_primitive_execute() for the description of an argument array.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise. If an argument array is invalid, no primitive is executed.
+///     If a primitive fails to execute, the primitives that follow it are
+///     not executed.
+dnnl_status_t DNNL_API dnnl_primitive_execute_batch(dnnl_stream_t stream,
+        int n, const const_dnnl_primitive_t *primitives, const int *nargs,
+        const dnnl_exec_arg_t *const *args);
+
+/// Computes the layout of a scratchpad buffer shared by primitives created
+/// with the #dnnl_scratchpad_mode_user scratchpad mode.
+///
+/// The primitives executed by the same stream run one after another, so
+/// their scratchpads alias the same region of the buffer, which has the size
+/// of the largest of them. The primitives of different streams may run
+/// concurrently and get disjoint regions. The scratchpad of a primitive is
+/// passed with index #DNNL_ARG_SCRATCHPAD as a memory object with the
+/// scratchpad memory descriptor of the primitive, whose buffer starts at its
+/// offset in the shared buffer.
+///
+/// In debug builds, the execution of a primitive checks that its scratchpad
+/// is large enough, and on CPU that it does not overlap with the scratchpad
+/// of a primitive running concurrently.
+///
+/// @param n Number of primitives.
+/// @param primitives Array of @p n primitives.
+/// @param stream_ids Array of @p n indices of the streams executing the
+///     primitives. The indices are arbitrary values identifying the streams.
+/// @param offsets Output array of @p n offsets of the scratchpads in the
+///     buffer in bytes.
+/// @param size Output size of the buffer in bytes.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_plan_scratchpad(int n,
+        const const_dnnl_primitive_t *primitives, const int *stream_ids,
+        size_t *offsets, size_t *size);
+
+/// Restricts primitive executions on a CPU stream to a set of logical CPUs.
+///
+/// The executions use one thread per CPU in the set. With the OpenMP
+/// threading runtime the threads, including the calling thread, are bound
+/// to the CPUs of the set on Linux; with the TBB runtime the executions run
+/// in a task arena of the set size. The threads stay bound after the
+/// executions, so a stream with a CPU set is meant to be used by a dedicated
+/// thread. Primitives that fix the number of threads at creation time should
+/// be created with the same maximum number of threads, for example after
+/// calling `omp_set_num_threads()` on the creating thread.
+///
+/// @param stream CPU stream.
+/// @param ncpus Number of CPUs in the set. Zero removes the restriction.
+/// @param cpus Array of @p ncpus logical CPU indices.
+/// @returns #dnnl_success on success, #dnnl_unimplemented if the threading
+///     runtime does not support the restriction, and a status describing the
+///     error otherwise.
+dnnl_status_t DNNL_API dnnl_stream_set_cpu_affinity(
+        dnnl_stream_t stream, int ncpus, const int *cpus);
+
+/// Starts capturing primitive executions submitted to a stream.
+///
+/// Until dnnl_stream_end_capture() is called, primitive executions
+/// submitted to the stream are recorded with their arguments instead of
+/// being executed. The recording replaces the previous one.
+///
+/// On SYCL streams on Intel GPUs, the queue is recorded into a SYCL command
+/// graph, which is submitted at once on replay. The kernel arguments are
+/// fixed at capture, so the data handles of the memory objects must not
+/// change between replays. Other GPU streams do not support the capture.
+///
+/// @param stream Stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_begin_capture(dnnl_stream_t stream);
+
+/// Stops capturing primitive executions submitted to a stream.
+///
+/// @param stream Stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_end_capture(dnnl_stream_t stream);
+
+/// Executes the primitive executions recorded on a stream in the order they
+/// were captured. The arguments are not validated again, so the memory
+/// objects used during the capture must remain alive; their contents and
+/// data handles may change between replays.
+///
+/// @param stream Stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_replay(dnnl_stream_t stream);
+
 /// Retrieves a constant reference to the primitive descriptor of a given
 /// primitive.
 ///
@@ -290,6 +394,203 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_dropout(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_dropout(
         dnnl_primitive_attr_t attr, const_dnnl_memory_desc_t dropout_desc);
 
+/// Returns the parameters of the softmax mask primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param kind Output kind of the implicit causal mask.
+/// @param lengths_desc Output memory descriptor of the per-row valid
+///     lengths. A zero memory descriptor is returned when the mask has no
+///     lengths.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_softmax_mask(
+        const_dnnl_primitive_attr_t attr, dnnl_softmax_mask_kind_t *kind,
+        const_dnnl_memory_desc_t *lengths_desc);
+
+/// Sets the softmax mask primitive attribute.
+///
+/// The mask is computed by the softmax primitive from the element indices
+/// and is never read from memory. Masked out elements are excluded from the
+/// reduction and produce zero for #dnnl_softmax_accurate and
+/// #dnnl_softmax_accurate_inf_as_zero, and negative infinity for
+/// #dnnl_softmax_log.
+///
+/// The causal mask treats the softmax axis as the columns and the dimension
+/// preceding the softmax axis as the rows. The per-row valid lengths are
+/// passed at execution time as an #dnnl_s32 tensor with index
+/// #DNNL_ARG_ATTR_SOFTMAX_LENGTHS. The tensor has the dimensions of the
+/// source with the softmax axis dimension equal to 1. Only the first `length`
+/// elements of a row are kept. When both masks are set, an element is kept
+/// only if both masks keep it.
+///
+/// @param attr Primitive attributes.
+/// @param kind Kind of the implicit causal mask.
+/// @param lengths_desc Memory descriptor of the per-row valid lengths. Can
+///     be NULL or a zero memory descriptor if no lengths are used.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_softmax_mask(
+        dnnl_primitive_attr_t attr, dnnl_softmax_mask_kind_t kind,
+        const_dnnl_memory_desc_t lengths_desc);
+
+/// Returns the top-k primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param k Output number of kept values. Zero means that the attribute is
+///     not set.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_top_k(
+        const_dnnl_primitive_attr_t attr, dnnl_dim_t *k);
+
+/// Sets the top-k primitive attribute value.
+///
+/// With the attribute, a matmul primitive does not write the destination.
+/// It keeps the `k` largest values of each destination row, after bias and
+/// post-ops, and writes them with their column indices, largest first.
+/// Equal values are ordered by their index. The values have the data type
+/// of the destination and are written with index #DNNL_ARG_ATTR_TOP_K_VALUES.
+/// The #dnnl_s32 indices are written with index #DNNL_ARG_ATTR_TOP_K_INDICES.
+/// Both tensors have the dimensions of the destination with the last
+/// dimension equal to `k`, and their memory descriptors are queried with
+/// #dnnl_query_exec_arg_md.
+///
+/// @param attr Primitive attributes.
+/// @param k Number of kept values. Zero resets the attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_top_k(
+        dnnl_primitive_attr_t attr, dnnl_dim_t k);
+
+/// Returns the number of parts of the destination split primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param nparts Output number of parts. Zero means that the attribute is not
+///     set.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_dst_split(
+        const_dnnl_primitive_attr_t attr, int *nparts);
+
+/// Sets the destination split primitive attribute.
+///
+/// With the attribute, a matmul primitive with a 2D destination [M, N] does
+/// not write the destination. Its columns are split into `nparts`
+/// consecutive parts, e.g. the query, key and value of a fused projection,
+/// and each part is written in its own layout with index
+/// `DNNL_ARG_MULTIPLE_DST + i`. The part `i` is a 4D tensor [B, H, S, D] of
+/// the data type of the destination with `B * S` equal to `M`. Row
+/// `b * S + s` and column `n0 + h * D + d` of the destination go to element
+/// (b, h, s, d) of the part, where `n0` is the sum of `H * D` of the previous
+/// parts, and these sums of all the parts are equal to `N`. The strides of a
+/// part are arbitrary, so that e.g. a head-major or a transposed layout is
+/// written directly.
+///
+/// @param attr Primitive attributes.
+/// @param nparts Number of parts. Zero resets the attribute.
+/// @param part_descs Array of `nparts` plain memory descriptors of the parts.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_dst_split(
+        dnnl_primitive_attr_t attr, int nparts,
+        const_dnnl_memory_desc_t const *part_descs);
+
+/// Returns the dynamic quantization primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param value Output dynamic quantization attribute value.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_dynamic_quantization(
+        const_dnnl_primitive_attr_t attr, int *value);
+
+/// Sets the dynamic quantization primitive attribute value.
+///
+/// With the attribute, a reorder primitive computes the destination scales
+/// from the source instead of reading them. The mask and the groups of the
+/// scales are set with dnnl_primitive_attr_set_scales_v2() for
+/// #DNNL_ARG_DST. A scale is the largest absolute source value of its group
+/// divided by the largest value of the destination data type, and the scales
+/// are written with index `DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST`. The
+/// compensation requested by the destination memory descriptor, if any, is
+/// computed from the quantized values. When zero points are set for
+/// #DNNL_ARG_DST with the same mask and groups, the quantization is
+/// asymmetric and the zero points are written with index
+/// `DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_DST`.
+///
+/// A forward layer normalization primitive with an s8 destination supports
+/// the attribute on CPU as well. The destination scales then have a value
+/// per row, i.e. a mask with a bit for every dimension but the last one, and
+/// every row is quantized right after it is normalized.
+///
+/// A matmul primitive with an f32 or bf16 source and s8 weights supports
+/// the attribute on CPU as well. It quantizes the source to s8 with a scale
+/// per row, which is set for #DNNL_ARG_SRC with a mask for every dimension
+/// but the last one, and writes the scales with index
+/// `DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC`.
+///
+/// @param attr Primitive attributes.
+/// @param value Boolean value to set dynamic quantization attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_dynamic_quantization(
+        dnnl_primitive_attr_t attr, int value);
+
+/// Returns the workspace data type primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Output workspace data type, #dnnl_data_type_undef if the
+///     attribute is not set.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_workspace_data_type(
+        const_dnnl_primitive_attr_t attr, dnnl_data_type_t *data_type);
+
+/// Sets the workspace data type primitive attribute value.
+///
+/// A forward training softmax primitive with the attribute keeps a copy of
+/// its destination in the given data type in a workspace, which is written
+/// with index #DNNL_ARG_WORKSPACE. The backward softmax primitive created
+/// with the forward primitive descriptor as a hint reads the workspace
+/// instead of #DNNL_ARG_DST, so that the destination does not need to be
+/// kept until the backward pass. The values are converted without scaling,
+/// which suits the [0, 1] range of softmax values for the f8 data types.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Data type of the workspace: #dnnl_bf16, #dnnl_f16,
+///     #dnnl_f8_e5m2, or #dnnl_f8_e4m3. #dnnl_data_type_undef resets the
+///     attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_workspace_data_type(
+        dnnl_primitive_attr_t attr, dnnl_data_type_t data_type);
+
+/// Returns the source upsampling primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param factor Output upsampling factor, 1 if the attribute is not set.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_src_upsampling(
+        const_dnnl_primitive_attr_t attr, int *factor);
+
+/// Sets the source upsampling primitive attribute value.
+///
+/// A forward convolution primitive with the attribute computes the
+/// convolution of its source upsampled with the nearest neighbor method by
+/// the given factor in every spatial dimension. The source memory
+/// descriptor describes the stored tensor, while the destination, the
+/// strides and the padding are those of the convolution of the upsampled
+/// source. The upsampled values are produced when the source is loaded, so
+/// that the upsampled tensor is never written to memory.
+///
+/// @param attr Primitive attributes.
+/// @param factor Upsampling factor. 1 resets the attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_src_upsampling(
+        dnnl_primitive_attr_t attr, int factor);
+
 /// Returns the floating-point math mode primitive attribute.
 ///
 /// @param attr Primitive attributes.
@@ -357,6 +658,33 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_deterministic(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_deterministic(
         dnnl_primitive_attr_t attr, int value);
 
+/// Returns the constant weights primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param value Output constant weights attribute value.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_constant_weights(
+        const_dnnl_primitive_attr_t attr, int *value);
+
+/// Sets the constant weights primitive attribute value.
+///
+/// The attribute is a hint that the weights passed to the primitive, as well
+/// as their scales and zero points, are the same on every execution. An
+/// implementation may then transform the weights into its internal layout
+/// once and reuse the result in the following executions, as long as the
+/// same weights memory object is passed and its data handle is not changed.
+/// The weights must not be modified while the memory object is used with the
+/// primitive. The attribute is ignored by implementations that do not use
+/// it.
+///
+/// @param attr Primitive attributes.
+/// @param value Boolean value to set constant weights attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_constant_weights(
+        dnnl_primitive_attr_t attr, int value);
+
 /// Returns the accumulation mode primitive attribute.
 ///
 /// @param attr Primitive attributes.
@@ -1055,6 +1383,96 @@ dnnl_status_t DNNL_API dnnl_memory_desc_create_with_coo_encoding(
         dnnl_data_type_t data_type, dnnl_dim_t nnz,
         dnnl_data_type_t indices_dt);
 
+/// Creates a memory descriptor for grouped encoding.
+///
+/// The created memory descriptor describes a 2D tensor of dimensions
+/// [M, K] made of @p ngroups groups of consecutive rows. The memory object
+/// contains 2 buffers with the following meaning and assigned numbers
+/// (index):
+///  - 0: values, a dense row-major [M, K] array
+///  - 1: offsets, an array of @p ngroups non-decreasing values where the
+///       i-th value is the index of the row that follows the last row of the
+///       i-th group. The values must not exceed M, the rows after the last
+///       group are not accessed.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions, must be 2.
+/// @param dims Array of dimensions.
+/// @param data_type Elements data type.
+/// @param ngroups Number of groups.
+/// @param offsets_dt Data type of offsets.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_grouped_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_dim_t ngroups,
+        dnnl_data_type_t offsets_dt);
+
+/// Creates a memory descriptor for paged encoding.
+///
+/// The created memory descriptor describes a 2D tensor split along the
+/// dimension @p paged_dim into pages of @p page_size indices. Each page is a
+/// dense row-major [page_size, D] array, where D is the other dimension of
+/// the tensor, so that the element (i0, i1) of the tensor is stored at the
+/// offset (i0 % page_size) * D + i1 of the page i0 / page_size when
+/// @p paged_dim is 0, and at the offset (i1 % page_size) * D + i0 of the page
+/// i1 / page_size when @p paged_dim is 1. The memory object contains 2
+/// buffers with the following meaning and assigned numbers (index):
+///  - 0: page pool, an array of @p npages pages stored contiguously
+///  - 1: page table, an array of div_up(dims[paged_dim], page_size) values
+///       where the i-th value is the index of the i-th page in the page pool
+///
+/// For example, a key-value cache stored in pages of tokens can be used as
+/// the weights of a matmul without gathering the pages: the values are
+/// described with @p paged_dim 0 and the transposed keys with @p paged_dim 1.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions, must be 2.
+/// @param dims Array of dimensions.
+/// @param data_type Elements data type.
+/// @param paged_dim Dimension split into pages, 0 or 1.
+/// @param page_size Number of indices of the paged dimension in a page.
+/// @param npages Number of pages in the page pool.
+/// @param page_table_dt Data type of page table.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_paged_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, int paged_dim, dnnl_dim_t page_size,
+        dnnl_dim_t npages, dnnl_data_type_t page_table_dt);
+
+/// Creates a memory descriptor for structured N:M sparse encoding.
+///
+/// The created memory descriptor describes a 2D [K, N] tensor where each
+/// group of @p m consecutive rows of a column keeps at most @p n elements,
+/// e.g. the weights of a matmul pruned with 2:4 sparsity. The memory object
+/// contains 2 buffers with the following meaning and assigned numbers
+/// (index):
+///  - 0: values, a row-major [K / m * n, N] array where the rows
+///       g * n, ..., g * n + n - 1 keep the elements of the group g of each
+///       column in the order of their rows
+///  - 1: metadata, a row-major [K / m, N] array of bitmasks where the bit i
+///       of the element (g, j) is set if the element (g * m + i, j) of the
+///       tensor is kept
+///
+/// A bitmask may have less than @p n bits set, the values of the remaining
+/// slots of the group are ignored.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions, must be 2.
+/// @param dims Array of dimensions, dims[0] must be a multiple of @p m.
+/// @param data_type Elements data type.
+/// @param n Maximum number of kept elements in a group.
+/// @param m Number of elements in a group, must not exceed 8.
+/// @param metadata_dt Data type of metadata, must be #dnnl_u8.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+/// @sa @ref dev_guide_sparsity
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_structured_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, int n, int m,
+        dnnl_data_type_t metadata_dt);
+
 /// Creates a memory descriptor for packed sparse encoding.
 ///
 /// The created memory descriptor cannot be used to create a memory
@@ -1390,6 +1808,54 @@ dnnl_status_t DNNL_API dnnl_memory_create_v2(dnnl_memory_t *memory,
         const_dnnl_memory_desc_t memory_desc, dnnl_engine_t engine,
         int nhandles, void **handles);
 
+/// Creates a memory object mapped from a file.
+///
+/// The buffer of the memory object is the range of the file that starts at
+/// @p offset and has the size of the memory descriptor. The range is mapped
+/// without copies and shares the pages of the page cache, so the weights
+/// prepacked in a file, e.g. by a reorder to a memory object created with
+/// #dnnl_memory_file_flags_writable, are used directly after a restart. The
+/// range must be within the file, and the file is unmapped when the memory
+/// object is destroyed. The file descriptor can be closed after the call.
+///
+/// @note Supported for CPU engines with the native runtimes on Linux only.
+///
+/// @param memory Output memory object.
+/// @param memory_desc Memory descriptor.
+/// @param engine Engine to use.
+/// @param fd File descriptor of a file opened for reading, and for writing
+///     with #dnnl_memory_file_flags_writable.
+/// @param offset Offset of the buffer in the file in bytes.
+/// @param flags Mapping flags, a combination of #dnnl_memory_file_flags_t
+///     values.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_create_from_file(dnnl_memory_t *memory,
+        const_dnnl_memory_desc_t memory_desc, dnnl_engine_t engine, int fd,
+        size_t offset, unsigned flags);
+
+/// Creates a memory object allocated on a stream.
+///
+/// The buffer is taken from a caching arena owned by the stream. When the
+/// memory object is destroyed, the buffer is returned to the arena in stream
+/// order: it is handed out to later allocations on the stream only after the
+/// primitives submitted to the stream before the destruction are completed,
+/// including with asynchronous threadpool execution. So a temporary tensor
+/// between primitives can be released right after its last use is submitted,
+/// without waiting for the stream. The memory object must not be used by
+/// other streams without synchronization, and may outlive the stream. The
+/// arena is trimmed to the recent peak usage on #dnnl_stream_wait().
+///
+/// @note Supported for CPU engines with the native runtimes only.
+///
+/// @param memory Output memory object.
+/// @param memory_desc Memory descriptor.
+/// @param stream Stream to allocate the memory on.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_create_on_stream(dnnl_memory_t *memory,
+        const_dnnl_memory_desc_t memory_desc, dnnl_stream_t stream);
+
 /// Creates a memory object for a scalar value located on the host.
 ///
 /// @note The scalar value is copied from the provided pointer into the newly
@@ -2172,12 +2638,17 @@ dnnl_status_t DNNL_API dnnl_softmax_backward_primitive_desc_create(
 /// is the same as in the tensor: depth (for 3D tensors),
 /// height (for 3D and 2D tensors), and width.
 ///
+/// The adaptive algorithms derive the pooling windows from the source and
+/// destination spatial sizes, so @p strides, @p kernel, @p dilation,
+/// @p padding_l and @p padding_r are ignored and can be NULL.
+///
 /// @param primitive_desc Output primitive descriptor.
 /// @param engine Engine to use.
 /// @param prop_kind Propagation kind. Possible values are
 ///     #dnnl_forward_training and #dnnl_forward_inference.
 /// @param alg_kind Pooling algorithm kind: either #dnnl_pooling_max,
-///     #dnnl_pooling_avg_include_padding, or #dnnl_pooling_avg_exclude_padding.
+///     #dnnl_pooling_avg_include_padding, #dnnl_pooling_avg_exclude_padding,
+///     #dnnl_pooling_adaptive_max, or #dnnl_pooling_adaptive_avg.
 /// @param src_desc Source memory descriptor.
 /// @param dst_desc Destination memory descriptor.
 /// @param strides Array of strides for spatial dimension.
@@ -3680,8 +4151,9 @@ dnnl_status_t DNNL_API dnnl_matmul_primitive_desc_create(
 /// @param engine Engine to use.
 /// @param prop_kind Propagation kind. Possible values are
 ///     #dnnl_forward_training and #dnnl_forward_inference.
-/// @param alg_kind resampling algorithm kind: either #dnnl_resampling_nearest,
-///     or #dnnl_resampling_linear.
+/// @param alg_kind resampling algorithm kind: #dnnl_resampling_nearest,
+///     #dnnl_resampling_linear, #dnnl_resampling_cubic, or
+///     #dnnl_resampling_linear_antialias.
 /// @param factors Array of scaling factors for spatial dimension.
 /// @param src_desc Source memory descriptor.
 /// @param dst_desc Destination memory descriptor.
@@ -3735,7 +4207,8 @@ dnnl_status_t DNNL_API dnnl_resampling_backward_primitive_desc_create(
 ///     #dnnl_reduction_max, #dnnl_reduction_min, #dnnl_reduction_sum,
 ///     #dnnl_reduction_mul, #dnnl_reduction_mean, #dnnl_reduction_norm_lp_max,
 ///     #dnnl_reduction_norm_lp_sum, #dnnl_reduction_norm_lp_power_p_max,
-///     #dnnl_reduction_norm_lp_power_p_sum.
+///     #dnnl_reduction_norm_lp_power_p_sum, #dnnl_reduction_arg_max,
+///     #dnnl_reduction_arg_min.
 /// @param p Algorithm specific parameter.
 /// @param eps Algorithm specific parameter.
 /// @param src_desc Source memory descriptor.
@@ -3751,6 +4224,38 @@ dnnl_status_t DNNL_API dnnl_reduction_primitive_desc_create(
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_embedding_bag Embedding Bag
+/// @{
+
+/// Creates a primitive descriptor for an embedding bag primitive.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Pooling of the rows of a bag. Possible values:
+///     #dnnl_reduction_sum, #dnnl_reduction_mean, and #dnnl_reduction_max.
+/// @param src_desc Source (embedding table) memory descriptor.
+/// @param indices_desc Indices memory descriptor.
+/// @param offsets_desc Offsets memory descriptor.
+/// @param weights_desc Per-sample weights memory descriptor. Passing NULL
+///     or a zero memory descriptor disables the weights.
+/// @param dst_desc Destination memory descriptor.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_embedding_bag_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t weights_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_embedding_bag
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_primitive_cache
@@ -3779,11 +4284,83 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Returns statistics of the primitive cache.
+///
+/// @param kind Primitive kind to return statistics for. Passing
+///     #dnnl_undefined_primitive returns statistics accumulated over all
+///     primitive kinds.
+/// @param stats Output statistics.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p stats value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_stats(
+        dnnl_primitive_kind_t kind, dnnl_cache_stats_t *stats);
+
+/// Returns statistics of the kernel cache. The kernel cache holds kernels
+/// shared between primitives and is sized together with the primitive cache.
+///
+/// @param stats Output statistics.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p stats value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_kernel_cache_stats(dnnl_cache_stats_t *stats);
+
+/// Resets the hit, miss, eviction and creation time counters of the
+/// primitive and kernel caches. Cached entries are not affected.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_reset_cache_stats(void);
+
+/// Creates primitives for the given primitive descriptors on background
+/// threads and stores them in the primitive cache. The function returns
+/// without waiting for the creation to complete, so that a subsequent
+/// creation of the same primitives is a primitive cache hit and does not
+/// block on code generation.
+///
+/// @note
+///     The primitive descriptors are copied and may be destroyed right after
+///     the call. Creation errors are not reported by this function; they are
+///     reported when the primitive is created with #dnnl_primitive_create().
+///
+/// @note
+///     The number of background threads is controlled by the
+///     ONEDNN_PRIMITIVE_PREWARM_THREADS environment variable (default 2).
+///
+/// @param n Number of primitive descriptors.
+/// @param primitive_descs Array of primitive descriptors.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_cache_prewarm(
+        int n, const_dnnl_primitive_desc_t const *primitive_descs);
+
+/// Waits until all the primitives requested with
+/// #dnnl_primitive_cache_prewarm() are created.
+///
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_cache_prewarm_wait(void);
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_service
 /// @{
 
+/// Writes the binary execution trace collected with
+/// `ONEDNN_VERBOSE=trace_exec` to a file. The trace holds the most recent
+/// executions of every thread. The file format is described in
+/// @ref dev_guide_verbose.
+///
+/// @note
+///     For a consistent snapshot, call the function when no primitives are
+///     being executed.
+///
+/// @param path Output file path.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p path value is invalid, #dnnl_runtime_error/#dnnl::status::runtime_error
+///     if the file could not be written, and #dnnl_success/#dnnl::status::success
+///     on success.
+dnnl_status_t DNNL_API dnnl_verbose_trace_dump(const char *path);
+
 /// Configures dumping of JIT-generated code.
 ///
 /// @note
@@ -3929,6 +4506,19 @@ dnnl_status_t DNNL_API dnnl_set_cpu_isa_hints(dnnl_cpu_isa_hints_t isa_hints);
 /// library can follow.
 dnnl_cpu_isa_hints_t DNNL_API dnnl_get_cpu_isa_hints(void);
 
+/// Returns the amount of library-owned CPU memory backed by huge pages.
+///
+/// Huge pages are used for large buffers allocated by the library (memory
+/// objects, scratchpads) when requested with the ONEDNN_CPU_HUGE_PAGES
+/// environment variable. With transparent huge pages, the value reflects the
+/// huge pages actually provided by the operating system.
+///
+/// @param size Output size in bytes.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p size value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_cpu_huge_pages_size(size_t *size);
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -4153,6 +4743,286 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
 
+/// Returns the size of the buffer for a packed copy of a matrix of a
+/// single-precision matrix multiplication, see dnnl_sgemm_pack().
+///
+/// The matrix multiplication with packed matrices runs in three steps: the
+/// size of the packed buffer is queried with this function, the matrix that
+/// is reused across calls, usually the weights, is packed once with
+/// dnnl_sgemm_pack(), and every multiplication is computed with
+/// dnnl_sgemm_compute() with the transposition flag of the packed matrix set
+/// to 'P'. The packed layout depends on the number of threads the library
+/// uses, which must be the same for all three steps.
+///
+/// @param identifier The matrix to pack: 'A' or 'a' for the matrix A, and
+///     'B' or 'b' for the matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise, #dnnl_unimplemented when packing is
+///     not supported on the CPU.
+dnnl_status_t DNNL_API dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size);
+
+/// Packs a matrix of a single-precision matrix multiplication, see
+/// dnnl_sgemm_pack_get_size().
+///
+/// @param identifier The matrix to pack: 'A' or 'a' for the matrix A, and
+///     'B' or 'b' for the matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the matrix to pack.
+/// @param dst A pointer to the packed buffer of the size returned by
+///     dnnl_sgemm_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, float *dst);
+
+/// Performs single-precision matrix-matrix multiply with packed matrices.
+///
+/// The operation is defined as:
+///
+/// `C := op( A )*op( B ) + beta*C`
+///
+/// and the arguments are the same as for dnnl_sgemm(), except that the
+/// transposition flag of a matrix packed with dnnl_sgemm_pack() is 'P' or
+/// 'p', in which case its leading dimension is ignored.
+///
+/// @param transa Transposition flag for matrix A: 'N', 'T', or 'P'.
+/// @param transb Transposition flag for matrix B: 'N', 'T', or 'P'.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or to its packed buffer.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data or to its packed buffer.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_compute(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const float *A,
+        dnnl_dim_t lda, const float *B, dnnl_dim_t ldb, float beta, float *C,
+        dnnl_dim_t ldc);
+
+/// Returns the size of the buffer for a packed copy of a matrix of a bf16
+/// matrix multiplication with an f32 result. The arguments are the same as
+/// for dnnl_sgemm_pack_get_size().
+///
+/// @note
+///     Packing of bf16 matrices requires Intel AVX-512 support.
+///
+/// @param identifier The matrix to pack: 'A' or 'B'.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs a matrix of a bf16 matrix multiplication with an f32 result. The
+/// bf16 values are passed as their 16-bit patterns.
+///
+/// @param identifier The matrix to pack: 'A' or 'B'.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the matrix to pack.
+/// @param dst A pointer to the packed buffer of the size returned by
+///     dnnl_gemm_bf16bf16f32_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_pack(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, const uint16_t *src, uint16_t *dst);
+
+/// Performs bf16 matrix-matrix multiply with an f32 result and packed
+/// matrices, see dnnl_sgemm_compute().
+///
+/// @param transa Transposition flag for matrix A: 'N', 'T', or 'P'.
+/// @param transb Transposition flag for matrix B: 'N', 'T', or 'P'.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or to its packed buffer.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data or to its packed buffer.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_compute(char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        const uint16_t *A, dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb,
+        float beta, float *C, dnnl_dim_t ldc);
+
+/// Returns the size of the buffer for a packed copy of a matrix of an integer
+/// matrix multiplication of an 8-bit unsigned matrix A and an 8-bit signed
+/// matrix B. The arguments are the same as for dnnl_sgemm_pack_get_size().
+///
+/// @param identifier The matrix to pack: 'A' or 'B'.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs a matrix of an integer matrix multiplication of an 8-bit unsigned
+/// matrix A and an 8-bit signed matrix B.
+///
+/// @param identifier The matrix to pack: 'A' or 'B'.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the matrix to pack.
+/// @param dst A pointer to the packed buffer of the size returned by
+///     dnnl_gemm_u8s8s32_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst);
+
+/// Performs integer matrix-matrix multiply on 8-bit unsigned matrix A, 8-bit
+/// signed matrix B, and 32-bit signed resulting matrix C with packed matrices.
+///
+/// The operation is defined as:
+///
+/// `C := op(A) * op(B) + beta * C + C_offset`
+///
+/// and the arguments are the same as for dnnl_gemm_u8s8s32(), except that the
+/// transposition flag of a packed matrix is 'P' or 'p'.
+///
+/// @param transa Transposition flag for matrix A: 'N', 'T', or 'P'.
+/// @param transb Transposition flag for matrix B: 'N', 'T', or 'P'.
+/// @param offsetc Flag specifying how offsets should be applied to matrix C:
+///     'F', 'C', or 'R'.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or to its packed buffer.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data or to its packed buffer.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @param co An array of offset values for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        const uint8_t *A, dnnl_dim_t lda, const int8_t *B, dnnl_dim_t ldb,
+        float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
+
+/// Returns the size of the buffer for a packed copy of a matrix of an integer
+/// matrix multiplication of 8-bit signed matrices. The arguments are the
+/// same as for dnnl_sgemm_pack_get_size().
+///
+/// @param identifier The matrix to pack: 'A' or 'B'.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs a matrix of an integer matrix multiplication of 8-bit signed
+/// matrices.
+///
+/// @param identifier The matrix to pack: 'A' or 'B'.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the matrix to pack.
+/// @param dst A pointer to the packed buffer of the size returned by
+///     dnnl_gemm_s8s8s32_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst);
+
+/// Performs integer matrix-matrix multiply on 8-bit signed matrices A and B,
+/// and 32-bit signed resulting matrix C with packed matrices, see
+/// dnnl_gemm_u8s8s32_compute().
+///
+/// @param transa Transposition flag for matrix A: 'N', 'T', or 'P'.
+/// @param transb Transposition flag for matrix B: 'N', 'T', or 'P'.
+/// @param offsetc Flag specifying how offsets should be applied to matrix C:
+///     'F', 'C', or 'R'.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or to its packed buffer.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data or to its packed buffer.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @param co An array of offset values for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_compute(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        const int8_t *A, dnnl_dim_t lda, const int8_t *B, dnnl_dim_t ldb,
+        float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
+
 /// @} dnnl_api_blas
 
 /// @} dnnl_api
@@ -151,6 +151,8 @@ struct primitive : public handle<dnnl_primitive_t> {
         layer_normalization = dnnl_layer_normalization,
         /// A group normalization primitive
         group_normalization = dnnl_group_normalization,
+        /// An embedding bag primitive.
+        embedding_bag = dnnl_embedding_bag,
     };
 
     using handle::handle;
@@ -215,8 +217,77 @@ struct primitive : public handle<dnnl_primitive_t> {
     /// @param args Arguments map.
     void execute(const stream &astream,
             const std::unordered_map<int, memory> &args) const;
+
+    /// Executes an ordered list of primitives in a specified stream.
+    ///
+    /// The result is the same as executing each primitive in order, but all
+    /// arguments are validated before the first primitive is executed and
+    /// the per-call overhead is paid once for the whole list.
+    ///
+    /// @param astream Stream object. The stream must belong to the same engine
+    ///     as the primitives.
+    /// @param ops Primitives with their arguments maps, in execution order.
+    static void execute_batch(const stream &astream,
+            const std::vector<std::pair<primitive,
+                    std::unordered_map<int, memory>>> &ops);
+
+    /// Computes the layout of a scratchpad buffer shared by primitives
+    /// created with the #dnnl::scratchpad_mode::user scratchpad mode.
+    ///
+    /// @sa dnnl_primitive_plan_scratchpad()
+    ///
+    /// @param primitives Primitives sharing the buffer.
+    /// @param stream_ids Indices of the streams executing the primitives.
+    ///     The primitives with the same index are executed one after another
+    ///     and share a region of the buffer.
+    /// @param offsets Output offsets of the scratchpads of the primitives in
+    ///     the buffer in bytes.
+    /// @returns The size of the buffer in bytes.
+    static size_t plan_scratchpad(const std::vector<primitive> &primitives,
+            const std::vector<int> &stream_ids, std::vector<size_t> &offsets);
 };
 
+/// Restricts primitive executions on a CPU stream to a set of logical CPUs.
+/// See dnnl_stream_set_cpu_affinity() for details.
+///
+/// @param astream CPU stream object.
+/// @param cpus Logical CPU indices. An empty set removes the restriction.
+inline void set_stream_cpu_affinity(
+        stream &astream, const std::vector<int> &cpus) {
+    error::wrap_c_api(dnnl_stream_set_cpu_affinity(astream.get(),
+                              (int)cpus.size(), cpus.data()),
+            "could not set a stream CPU affinity");
+}
+
+/// Starts capturing primitive executions submitted to a stream. The
+/// executions are recorded instead of being executed until
+/// #dnnl::end_stream_capture() is called. On SYCL streams on Intel GPUs the
+/// queue is recorded into a SYCL command graph instead, and the data handles
+/// of the memory objects must not change between replays.
+///
+/// @param astream Stream object.
+inline void begin_stream_capture(stream &astream) {
+    error::wrap_c_api(dnnl_stream_begin_capture(astream.get()),
+            "could not begin a stream capture");
+}
+
+/// Stops capturing primitive executions submitted to a stream.
+///
+/// @param astream Stream object.
+inline void end_stream_capture(stream &astream) {
+    error::wrap_c_api(dnnl_stream_end_capture(astream.get()),
+            "could not end a stream capture");
+}
+
+/// Executes the primitive executions recorded on a stream. The memory
+/// objects used during the capture must remain alive.
+///
+/// @param astream Stream object.
+inline void replay_stream_capture(stream &astream) {
+    error::wrap_c_api(dnnl_stream_replay(astream.get()),
+            "could not replay a stream capture");
+}
+
 /// Converts primitive kind enum value from C++ API to C API type.
 ///
 /// @param akind C++ API primitive kind enum value.
@@ -293,6 +364,12 @@ enum class scratchpad_mode {
     /// as the scratchpad buffers are not used concurrently by two primitive
     /// executions.
     user = dnnl_scratchpad_mode_user,
+    /// The scratchpad is carved from a buffer owned by the stream the
+    /// primitive is executed on. The buffer is shared by all the primitives
+    /// executed on the stream and grows to the largest scratchpad requested.
+    /// Primitives in this mode must not be executed concurrently on the same
+    /// stream and cannot be executed on out-of-order streams.
+    stream = dnnl_scratchpad_mode_stream,
 };
 
 /// Converts a scratchpad mode enum value from C++ API to C API type.
@@ -320,6 +397,24 @@ inline dnnl_rounding_mode_t convert_to_c(rounding_mode mode) {
     return static_cast<dnnl_rounding_mode_t>(mode);
 }
 
+/// Kinds of the implicit causal mask applied by the softmax primitive.
+enum class softmax_mask_kind {
+    /// No causal mask.
+    none = dnnl_softmax_mask_none,
+    /// Causal mask aligned to the top-left corner.
+    causal_top_left = dnnl_softmax_mask_causal_top_left,
+    /// Causal mask aligned to the bottom-right corner.
+    causal_bottom_right = dnnl_softmax_mask_causal_bottom_right,
+};
+
+/// Converts a softmax mask kind enum value from C++ API to C API type.
+///
+/// @param kind C++ API softmax mask kind enum value.
+/// @returns Corresponding C API softmax mask kind enum value.
+inline dnnl_softmax_mask_kind_t convert_to_c(softmax_mask_kind kind) {
+    return static_cast<dnnl_softmax_mask_kind_t>(kind);
+}
+
 /// Propagation kind.
 enum class prop_kind {
     /// Undefined propagation kind.
@@ -433,6 +528,10 @@ enum class algorithm {
     pooling_avg_include_padding = dnnl_pooling_avg_include_padding,
     /// Average pooling exclude padding
     pooling_avg_exclude_padding = dnnl_pooling_avg_exclude_padding,
+    /// Adaptive max pooling
+    pooling_adaptive_max = dnnl_pooling_adaptive_max,
+    /// Adaptive average pooling
+    pooling_adaptive_avg = dnnl_pooling_adaptive_avg,
     /// RNN cell
     vanilla_rnn = dnnl_vanilla_rnn,
     /// LSTM cell
@@ -479,6 +578,10 @@ enum class algorithm {
     resampling_nearest = dnnl_resampling_nearest,
     /// Linear (Bilinear, Trilinear) resampling method
     resampling_linear = dnnl_resampling_linear,
+    /// Cubic (Bicubic, Tricubic) resampling method
+    resampling_cubic = dnnl_resampling_cubic,
+    /// Linear resampling method with an antialiasing filter for downsampling
+    resampling_linear_antialias = dnnl_resampling_linear_antialias,
     /// Reduction using max operation
     reduction_max = dnnl_reduction_max,
     /// Reduction using min operation
@@ -497,6 +600,10 @@ enum class algorithm {
     reduction_norm_lp_power_p_max = dnnl_reduction_norm_lp_power_p_max,
     /// Reduction using norm_lp_power_p_sum operation
     reduction_norm_lp_power_p_sum = dnnl_reduction_norm_lp_power_p_sum,
+    /// Reduction to the indices of the largest values
+    reduction_arg_max = dnnl_reduction_arg_max,
+    /// Reduction to the indices of the smallest values
+    reduction_arg_min = dnnl_reduction_arg_min,
     /// Softmax, numerically stable
     softmax_accurate = dnnl_softmax_accurate,
     /// LogSoftmax, numerically stable
@@ -579,6 +686,20 @@ enum class normalization_flags : unsigned {
     ///     When used with #dnnl::normalization_flags::use_global_stats,
     ///     only RMS norm is required to be provided as input.
     rms_norm = dnnl_rms_norm,
+
+    /// Fuse an elementwise binary Add operation preceding normalization.
+    /// On forward propagation, the source tensor is summed with an additional
+    /// input tensor (#DNNL_ARG_SRC_1) and the result is normalized. When an
+    /// additional output tensor (#DNNL_ARG_DST_1) is passed, the sum is saved
+    /// to it. Both tensors use the source memory descriptor. On backward
+    /// propagation, the source tensor is the sum, and the gradient of the
+    /// residual branch (#DNNL_ARG_DIFF_DST_1), described by the diff
+    /// destination memory descriptor, is added to the diff source, which is
+    /// the gradient of both addends.
+    ///
+    /// @note
+    ///     Only layer normalization supports this flag.
+    fuse_add_norm = dnnl_fuse_add_norm,
 };
 
 /// Converts normalization flags enum value from C++ API to C API type.
@@ -599,6 +720,9 @@ enum class rnn_flags : unsigned {
     undef = dnnl_rnn_flags_undef,
     /// Do not add weights gradient to existing diff_weights memory
     diff_weights_overwrite = dnnl_rnn_flags_diff_weights_overwrite,
+    /// The sequences of a batch have their own lengths, passed at execution
+    /// time with index #DNNL_ARG_SEQ_LENGTHS
+    seq_lengths = dnnl_rnn_flags_seq_lengths,
 };
 
 /// Converts RNN cell flags enum value from C++ API to C API type.
@@ -954,6 +1078,15 @@ struct memory : public handle<dnnl_memory_t> {
         packed = dnnl_packed,
         /// Coordinate Sparse (COO) encoding.
         coo = dnnl_coo,
+        /// Grouped encoding for tensors made of groups of rows with
+        /// different number of rows.
+        grouped = dnnl_grouped,
+        /// Paged encoding for tensors stored in pages located with a page
+        /// table.
+        paged = dnnl_paged,
+        /// Structured N:M encoding for tensors that keep at most N elements
+        /// in each group of M consecutive rows.
+        structured = dnnl_structured,
     };
 
     /// Memory format tag specification.
@@ -2928,6 +3061,118 @@ struct memory : public handle<dnnl_memory_t> {
             return desc {md};
         }
 
+        /// Function for creating a memory descriptor for grouped encoding.
+        ///
+        /// The created memory descriptor will describe a memory object that
+        /// contains 2 buffers for a 2D tensor made of groups of rows.
+        /// The buffers have the following meaning and assigned numbers (index):
+        ///  - 0: values, a dense row-major array
+        ///  - 1: offsets, the index of the row that follows the last row
+        ///       of each group
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param ngroups Number of groups.
+        /// @param offsets_dt Data type of offsets.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @sa @ref dev_guide_sparsity
+        static desc grouped(const dims &adims, data_type adata_type,
+                dim ngroups, data_type offsets_dt, bool allow_empty = false) {
+            validate_dims(adims);
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status
+                    = dnnl_memory_desc_create_with_grouped_encoding(&md,
+                            (int)adims.size(), adims.data(),
+                            convert_to_c(adata_type), ngroups,
+                            convert_to_c(offsets_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for grouped "
+                        "encoding");
+            return desc {md};
+        }
+
+        /// Function for creating a memory descriptor for paged encoding.
+        ///
+        /// The created memory descriptor will describe a memory object that
+        /// contains 2 buffers for a 2D tensor split along @p paged_dim into
+        /// pages of @p page_size indices. Each page is a dense row-major
+        /// [page_size, D] array, where D is the other dimension.
+        /// The buffers have the following meaning and assigned numbers (index):
+        ///  - 0: page pool, an array of @p npages pages
+        ///  - 1: page table, the index in the page pool of each page of
+        ///       the tensor
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param paged_dim Dimension split into pages, 0 or 1.
+        /// @param page_size Number of indices of the paged dimension in a
+        ///     page.
+        /// @param npages Number of pages in the page pool.
+        /// @param page_table_dt Data type of page table.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @sa @ref dev_guide_sparsity
+        static desc paged(const dims &adims, data_type adata_type,
+                int paged_dim, dim page_size, dim npages,
+                data_type page_table_dt, bool allow_empty = false) {
+            validate_dims(adims);
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status = dnnl_memory_desc_create_with_paged_encoding(
+                    &md, (int)adims.size(), adims.data(),
+                    convert_to_c(adata_type), paged_dim, page_size, npages,
+                    convert_to_c(page_table_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for paged "
+                        "encoding");
+            return desc {md};
+        }
+
+        /// Function for creating a memory descriptor for structured N:M
+        /// sparse encoding.
+        ///
+        /// The created memory descriptor will describe a memory object that
+        /// contains 2 buffers for a 2D [K, N] tensor that keeps at most @p n
+        /// elements in each group of @p m consecutive rows of a column.
+        /// The buffers have the following meaning and assigned numbers (index):
+        ///  - 0: values, a row-major [K / m * n, N] array of the kept
+        ///       elements of each group
+        ///  - 1: metadata, a row-major [K / m, N] array of bitmasks of the
+        ///       positions of the kept elements in each group
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param n Maximum number of kept elements in a group.
+        /// @param m Number of elements in a group.
+        /// @param metadata_dt Data type of metadata.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @sa @ref dev_guide_sparsity
+        static desc structured(const dims &adims, data_type adata_type, int n,
+                int m, data_type metadata_dt = data_type::u8,
+                bool allow_empty = false) {
+            validate_dims(adims);
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status
+                    = dnnl_memory_desc_create_with_structured_encoding(&md,
+                            (int)adims.size(), adims.data(),
+                            convert_to_c(adata_type), n, m,
+                            convert_to_c(metadata_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for structured "
+                        "encoding");
+            return desc {md};
+        }
+
         /// Function for creating a memory descriptor for packed sparse
         /// encoding.
         ///
@@ -3333,6 +3578,21 @@ struct memory : public handle<dnnl_memory_t> {
         }
     };
 
+    /// Flags for memory objects mapped from files.
+    enum class file_flags : unsigned {
+        /// Map the file read-only. The memory object can only be used as an
+        /// input.
+        none = dnnl_memory_file_flags_none,
+        /// Map the file for writing. The data written to the memory object,
+        /// e.g. the destination of a reorder, is stored to the file.
+        writable = dnnl_memory_file_flags_writable,
+        /// Read the file into the page cache when the memory object is
+        /// created instead of on the first access.
+        populate = dnnl_memory_file_flags_populate,
+        /// Ask the operating system to back the mapping with huge pages.
+        huge_pages = dnnl_memory_file_flags_huge_pages,
+    };
+
     /// Default constructor.
     ///
     /// Constructs an empty memory object, which can be used to indicate
@@ -3389,6 +3649,45 @@ struct memory : public handle<dnnl_memory_t> {
         reset(result);
     }
 
+    /// Constructs a memory object mapped from a file.
+    ///
+    /// The buffer is the range of the file that starts at @p offset and has
+    /// the size of the memory descriptor. It is mapped without copies and is
+    /// unmapped when the memory object is destroyed.
+    ///
+    /// @sa dnnl_memory_create_from_file()
+    ///
+    /// @param md Memory descriptor.
+    /// @param aengine CPU engine to store the data on.
+    /// @param fd File descriptor of an open file.
+    /// @param offset Offset of the buffer in the file in bytes.
+    /// @param flags Mapping flags.
+    memory(const desc &md, const engine &aengine, int fd, size_t offset,
+            file_flags flags) {
+        dnnl_memory_t result;
+        dnnl_status_t status = dnnl_memory_create_from_file(&result, md.get(),
+                aengine.get(), fd, offset, static_cast<unsigned>(flags));
+        error::wrap_c_api(status, "could not create a memory object");
+        reset(result);
+    }
+
+    /// Constructs a memory object allocated on a stream.
+    ///
+    /// The buffer is taken from a caching arena of the stream, to which it
+    /// is returned in stream order when the memory object is destroyed.
+    ///
+    /// @sa dnnl_memory_create_on_stream()
+    ///
+    /// @param md Memory descriptor.
+    /// @param astream CPU stream to allocate the memory on.
+    memory(const desc &md, const stream &astream) {
+        dnnl_memory_t result;
+        dnnl_status_t status = dnnl_memory_create_on_stream(
+                &result, md.get(), astream.get());
+        error::wrap_c_api(status, "could not create a memory object");
+        reset(result);
+    }
+
     /// Constructs a memory object.
     ///
     /// The underlying buffer(s) for the memory will be allocated by the
@@ -3576,6 +3875,8 @@ struct memory : public handle<dnnl_memory_t> {
     }
 };
 
+DNNL_DEFINE_BITMASK_OPS(memory::file_flags)
+
 inline bool operator==(dnnl_data_type_t a, memory::data_type b) {
     return a == memory::convert_to_c(b);
 }
@@ -4048,6 +4349,169 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set dropout primitive attribute");
     }
 
+    /// Returns the parameters of a softmax mask attribute.
+    ///
+    /// @param kind Output kind of the implicit causal mask.
+    /// @param lengths_desc Output memory descriptor of the per-row valid
+    ///     lengths.
+    void get_softmax_mask(
+            softmax_mask_kind &kind, memory::desc &lengths_desc) const {
+        dnnl_softmax_mask_kind_t c_kind;
+        const_dnnl_memory_desc_t cdesc;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_softmax_mask(get(), &c_kind, &cdesc),
+                "could not get parameters of a softmax mask attribute");
+        dnnl_memory_desc_t cloned_md = nullptr;
+        error::wrap_c_api(dnnl_memory_desc_clone(&cloned_md, cdesc),
+                "could not clone a memory descriptor");
+        kind = static_cast<softmax_mask_kind>(c_kind);
+        lengths_desc = memory::desc(cloned_md);
+    }
+
+    /// Sets a softmax mask attribute.
+    ///
+    /// The mask is computed by the softmax primitive from the element
+    /// indices. The per-row valid lengths, if any, are passed at execution
+    /// time with index #DNNL_ARG_ATTR_SOFTMAX_LENGTHS.
+    ///
+    /// @param kind Kind of the implicit causal mask.
+    /// @param lengths_desc Memory descriptor of the per-row valid lengths.
+    ///     A zero memory descriptor means that no lengths are used.
+    void set_softmax_mask(softmax_mask_kind kind,
+            const memory::desc &lengths_desc = memory::desc()) {
+        error::wrap_c_api(dnnl_primitive_attr_set_softmax_mask(get(),
+                                  convert_to_c(kind), lengths_desc.get()),
+                "could not set softmax mask primitive attribute");
+    }
+
+    /// Returns the top-k attribute value.
+    ///
+    /// @returns The number of kept values, or zero if the attribute is not
+    ///     set.
+    memory::dim get_top_k() const {
+        dnnl_dim_t result;
+        error::wrap_c_api(dnnl_primitive_attr_get_top_k(get(), &result),
+                "could not get top-k primitive attribute");
+        return result;
+    }
+
+    /// Sets the top-k attribute value.
+    ///
+    /// The primitive keeps only the `k` largest values of each destination
+    /// row with their indices, and passes them with indices
+    /// #DNNL_ARG_ATTR_TOP_K_VALUES and #DNNL_ARG_ATTR_TOP_K_INDICES instead of
+    /// writing the destination.
+    ///
+    /// @param k Number of kept values. Zero resets the attribute.
+    void set_top_k(memory::dim k) {
+        error::wrap_c_api(dnnl_primitive_attr_set_top_k(get(), k),
+                "could not set top-k primitive attribute");
+    }
+
+    /// Returns the number of parts of the destination split attribute.
+    ///
+    /// @returns The number of parts, or zero if the attribute is not set.
+    int get_dst_split() const {
+        int result;
+        error::wrap_c_api(dnnl_primitive_attr_get_dst_split(get(), &result),
+                "could not get destination split primitive attribute");
+        return result;
+    }
+
+    /// Sets the destination split attribute.
+    ///
+    /// The primitive writes consecutive ranges of the destination columns to
+    /// the 4D parts [B, H, S, D] passed with indices
+    /// `DNNL_ARG_MULTIPLE_DST + i` instead of writing the destination. See
+    /// dnnl_primitive_attr_set_dst_split() for the mapping of the elements.
+    ///
+    /// @param part_descs Memory descriptors of the parts. An empty vector
+    ///     resets the attribute.
+    void set_dst_split(const std::vector<memory::desc> &part_descs) {
+        std::vector<const_dnnl_memory_desc_t> c_part_descs;
+        c_part_descs.reserve(part_descs.size());
+        for (const auto &md : part_descs)
+            c_part_descs.push_back(md.get());
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_dst_split(get(),
+                        static_cast<int>(c_part_descs.size()),
+                        c_part_descs.data()),
+                "could not set destination split primitive attribute");
+    }
+
+    /// Returns the dynamic quantization attribute value.
+    bool get_dynamic_quantization() const {
+        int result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_dynamic_quantization(get(), &result),
+                "could not get dynamic quantization primitive attribute");
+        return result;
+    }
+
+    /// Sets the dynamic quantization attribute value.
+    ///
+    /// The reorder primitive computes the destination scales from the source
+    /// and writes them with index `DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST`, and
+    /// the destination zero points, when they are set, with index
+    /// `DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_DST`. The forward layer
+    /// normalization primitive computes a destination scale per row, and the
+    /// matmul primitive computes a source scale per row and writes it with
+    /// index `DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC`.
+    ///
+    /// @param value Specified dynamic quantization mode.
+    void set_dynamic_quantization(bool value) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_dynamic_quantization(get(), value),
+                "could not set dynamic quantization primitive attribute");
+    }
+
+    /// Returns the workspace data type attribute value.
+    memory::data_type get_workspace_data_type() const {
+        dnnl_data_type_t result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_workspace_data_type(get(), &result),
+                "could not get workspace data type primitive attribute");
+        return static_cast<memory::data_type>(result);
+    }
+
+    /// Sets the workspace data type attribute value.
+    ///
+    /// The forward training softmax primitive keeps a copy of its
+    /// destination in the given data type in a workspace, and the backward
+    /// softmax primitive created with the forward primitive descriptor as a
+    /// hint reads the workspace instead of the destination.
+    ///
+    /// @param data_type Data type of the workspace: bf16, f16, f8_e5m2, or
+    ///     f8_e4m3. #dnnl::memory::data_type::undef resets the attribute.
+    void set_workspace_data_type(memory::data_type data_type) {
+        error::wrap_c_api(dnnl_primitive_attr_set_workspace_data_type(get(),
+                                  memory::convert_to_c(data_type)),
+                "could not set workspace data type primitive attribute");
+    }
+
+    /// Returns the source upsampling attribute value.
+    int get_src_upsampling() const {
+        int result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_src_upsampling(get(), &result),
+                "could not get source upsampling primitive attribute");
+        return result;
+    }
+
+    /// Sets the source upsampling attribute value.
+    ///
+    /// The forward convolution primitive computes the convolution of its
+    /// source upsampled with the nearest neighbor method by the factor in
+    /// every spatial dimension, without writing the upsampled source to
+    /// memory. The destination, the strides and the padding are those of
+    /// the convolution of the upsampled source.
+    ///
+    /// @param factor Upsampling factor. 1 resets the attribute.
+    void set_src_upsampling(int factor) {
+        error::wrap_c_api(dnnl_primitive_attr_set_src_upsampling(get(), factor),
+                "could not set source upsampling primitive attribute");
+    }
+
     /// Returns the fpmath mode
     fpmath_mode get_fpmath_mode() const {
         dnnl_fpmath_mode_t result;
@@ -4115,6 +4579,28 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set deterministic primitive attribute");
     }
 
+    /// Returns the constant weights attribute value
+    bool get_constant_weights() const {
+        int result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_constant_weights(get(), &result),
+                "could not get constant weights primitive attribute");
+        return static_cast<bool>(result);
+    }
+
+    /// Sets constant weights attribute value
+    ///
+    /// The attribute is a hint that the weights, as well as their scales and
+    /// zero points, do not change between executions, so that an
+    /// implementation may transform them once and reuse the result.
+    ///
+    /// @param value Specified constant weights mode.
+    void set_constant_weights(bool value) {
+        error::wrap_c_api(dnnl_primitive_attr_set_constant_weights(
+                                  get(), static_cast<int>(value)),
+                "could not set constant weights primitive attribute");
+    }
+
     /// Returns the rounding mode attribute value
     ///
     /// @param arg Argument for which rounding mode query applies.
@@ -9449,6 +9935,14 @@ struct rnn_primitive_desc_base : public primitive_desc {
         return base::query_md(query::exec_arg_md, DNNL_ARG_AUGRU_ATTENTION);
     }
 
+    /// Returns sequence lengths memory descriptor.
+    /// @returns Sequence lengths memory descriptor.
+    /// @returns A zero memory descriptor if the primitive does not have
+    ///          the #dnnl::rnn_flags::seq_lengths flag.
+    memory::desc seq_lengths_desc() const {
+        return base::query_md(query::exec_arg_md, DNNL_ARG_SEQ_LENGTHS);
+    }
+
     /// Returns source iteration memory descriptor.
     /// @returns Source iteration memory descriptor.
     /// @returns A zero memory descriptor if the primitive does not have a
@@ -13071,9 +13565,11 @@ struct resampling_forward : public primitive {
         /// @param aprop_kind Propagation kind. Possible values are
         ///     #dnnl::prop_kind::forward_training, and
         ///     #dnnl::prop_kind::forward_inference.
-        /// @param aalgorithm resampling algorithm kind: either
-        ///     #dnnl::algorithm::resampling_nearest, or
-        ///     #dnnl::algorithm::resampling_linear
+        /// @param aalgorithm resampling algorithm kind:
+        ///     #dnnl::algorithm::resampling_nearest,
+        ///     #dnnl::algorithm::resampling_linear,
+        ///     #dnnl::algorithm::resampling_cubic, or
+        ///     #dnnl::algorithm::resampling_linear_antialias
         /// @param src_desc Source memory descriptor.
         /// @param dst_desc Destination memory descriptor.
         /// @param attr Primitive attributes to use. Attributes are optional
@@ -13098,9 +13594,11 @@ struct resampling_forward : public primitive {
         /// @param aprop_kind Propagation kind. Possible values are
         ///     #dnnl::prop_kind::forward_training, and
         ///     #dnnl::prop_kind::forward_inference.
-        /// @param aalgorithm resampling algorithm kind: either
-        ///     #dnnl::algorithm::resampling_nearest, or
-        ///     #dnnl::algorithm::resampling_linear
+        /// @param aalgorithm resampling algorithm kind:
+        ///     #dnnl::algorithm::resampling_nearest,
+        ///     #dnnl::algorithm::resampling_linear,
+        ///     #dnnl::algorithm::resampling_cubic, or
+        ///     #dnnl::algorithm::resampling_linear_antialias
         /// @param factors Vector of scaling factors for spatial dimension.
         /// @param src_desc Source memory descriptor.
         /// @param attr Primitive attributes to use. Attributes are optional
@@ -13128,9 +13626,11 @@ struct resampling_forward : public primitive {
         /// @param aprop_kind Propagation kind. Possible values are
         ///     #dnnl::prop_kind::forward_training, and
         ///     #dnnl::prop_kind::forward_inference.
-        /// @param aalgorithm resampling algorithm kind: either
-        ///     #dnnl::algorithm::resampling_nearest, or
-        ///     #dnnl::algorithm::resampling_linear
+        /// @param aalgorithm resampling algorithm kind:
+        ///     #dnnl::algorithm::resampling_nearest,
+        ///     #dnnl::algorithm::resampling_linear,
+        ///     #dnnl::algorithm::resampling_cubic, or
+        ///     #dnnl::algorithm::resampling_linear_antialias
         /// @param factors Vector of scaling factors for spatial dimension.
         /// @param src_desc Source memory descriptor.
         /// @param dst_desc Destination memory descriptor.
@@ -13412,6 +13912,45 @@ struct pooling_forward : public primitive {
             reset(pd);
         }
 
+        /// Constructs a primitive descriptor for an adaptive pooling forward
+        ///     propagation primitive.
+        ///
+        /// The pooling windows are derived from the source and destination
+        /// spatial sizes.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param aalgorithm Pooling algorithm kind: either
+        ///     #dnnl::algorithm::pooling_adaptive_max,
+        ///     or #dnnl::algorithm::pooling_adaptive_avg.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                algorithm aalgorithm, const memory::desc &src_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_pooling_forward_primitive_desc_create(
+                    &pd, aengine.get(), dnnl::convert_to_c(aprop_kind),
+                    convert_to_c(aalgorithm), src_desc.get(), dst_desc.get(),
+                    nullptr, nullptr, nullptr, nullptr, nullptr, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a descriptor for an adaptive "
+                        "pooling forward propagation primitive");
+            reset(pd);
+        }
+
         /// Constructs a primitive descriptor for a pooling forward propagation
         /// primitive from a C API primitive descriptor that must have a
         /// matching kind.
@@ -13814,7 +14353,8 @@ struct reduction : public primitive {
         ///     #dnnl_reduction_mul, #dnnl_reduction_mean,
         ///     #dnnl_reduction_norm_lp_max, #dnnl_reduction_norm_lp_sum,
         ///     #dnnl_reduction_norm_lp_power_p_max,
-        ///     #dnnl_reduction_norm_lp_power_p_sum.
+        ///     #dnnl_reduction_norm_lp_power_p_sum, #dnnl_reduction_arg_max,
+        ///     #dnnl_reduction_arg_min.
         /// @param p algorithm specific parameter.
         /// @param eps algorithm specific parameter.
         /// @param src_desc Source memory descriptor.
@@ -13883,6 +14423,150 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_embedding_bag Embedding Bag
+///
+/// A primitive to pool bags of rows gathered from an embedding table using
+/// sum, mean or max operations.
+///
+/// @sa @ref dev_guide_embedding_bag in developer guide
+///
+/// @{
+
+/// Embedding bag.
+struct embedding_bag : public primitive {
+    /// Primitive descriptor for an embedding bag primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for an embedding bag primitive
+        ///     with per-sample weights.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Pooling of the rows of a bag. Possible values:
+        ///     #dnnl_reduction_sum, #dnnl_reduction_mean, and
+        ///     #dnnl_reduction_max.
+        /// @param src_desc Source (embedding table) memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Offsets memory descriptor.
+        /// @param weights_desc Per-sample weights memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc &weights_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, indices_desc,
+                    offsets_desc, &weights_desc, dst_desc, attr, allow_empty) {
+        }
+
+        /// Constructs a primitive descriptor for an embedding bag primitive.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Pooling of the rows of a bag. Possible values:
+        ///     #dnnl_reduction_sum, #dnnl_reduction_mean, and
+        ///     #dnnl_reduction_max.
+        /// @param src_desc Source (embedding table) memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Offsets memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &offsets_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, indices_desc,
+                    offsets_desc, nullptr, dst_desc, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for an embedding bag primitive
+        /// from a C API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for an embedding bag
+        ///     primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::embedding_bag) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns an indices memory descriptor.
+        /// @returns Indices memory descriptor.
+        memory::desc indices_desc() const { return base::src_desc(1); }
+
+        /// Returns an offsets memory descriptor.
+        /// @returns Offsets memory descriptor.
+        memory::desc offsets_desc() const { return base::src_desc(2); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+    private:
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc *weights_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr, bool allow_empty) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_embedding_bag_primitive_desc_create(
+                    &pd, aengine.get(), convert_to_c(aalgorithm),
+                    src_desc.get(), indices_desc.get(), offsets_desc.get(),
+                    optional_arg(weights_desc), dst_desc.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the embedding bag primitive. Run workload with "
+                        "environment variable ONEDNN_VERBOSE=all to get "
+                        "additional diagnostic information.");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    embedding_bag() = default;
+
+    /// Constructs an embedding bag primitive.
+    /// @param pd Primitive descriptor for an embedding bag primitive.
+    embedding_bag(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs an embedding bag primitive from a cache blob.
+    /// @param pd Primitive descriptor for an embedding bag primitive.
+    /// @param cache_blob Cache blob.
+    embedding_bag(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_embedding_bag
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -13939,6 +14623,12 @@ inline status set_default_fpmath_mode(fpmath_mode mode) {
             dnnl_set_default_fpmath_mode(convert_to_c(mode)));
 }
 
+/// @copydoc dnnl_verbose_trace_dump()
+inline void verbose_trace_dump(const std::string &path) {
+    error::wrap_c_api(dnnl_verbose_trace_dump(path.c_str()),
+            "could not dump execution trace");
+}
+
 /// @copydoc dnnl_set_jit_dump()
 inline status set_jit_dump(int enable) {
     return static_cast<status>(dnnl_set_jit_dump(enable));
@@ -14022,6 +14712,14 @@ inline cpu_isa_hints get_cpu_isa_hints() {
     return static_cast<cpu_isa_hints>(dnnl_get_cpu_isa_hints());
 }
 
+/// @copydoc dnnl_get_cpu_huge_pages_size(size_t *)
+inline size_t get_cpu_huge_pages_size() {
+    size_t result = 0;
+    error::wrap_c_api(dnnl_get_cpu_huge_pages_size(&result),
+            "could not get huge pages size");
+    return result;
+}
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -14034,6 +14732,21 @@ enum class profiling_data_kind {
     undef = dnnl_profiling_data_kind_undef,
     /// Data kind to query an execution time in nanoseconds.
     time = dnnl_profiling_data_kind_time,
+    /// Data kind to query the total time in nanoseconds that threads spent
+    /// executing a primitive. CPU only.
+    thread_time = dnnl_profiling_data_kind_thread_time,
+    /// Data kind to query the largest number of threads used by a primitive
+    /// execution. CPU only.
+    nthr = dnnl_profiling_data_kind_nthr,
+    /// Data kind to query the time in nanoseconds that the execution units
+    /// were active during a primitive execution. Intel GPUs only.
+    eu_active_time = dnnl_profiling_data_kind_eu_active_time,
+    /// Data kind to query the time in nanoseconds that the execution units
+    /// were stalled during a primitive execution. Intel GPUs only.
+    eu_stall_time = dnnl_profiling_data_kind_eu_stall_time,
+    /// Data kind to query the number of bytes that a primitive execution
+    /// transferred to and from GPU memory. Intel GPUs only.
+    memory_bytes = dnnl_profiling_data_kind_memory_bytes,
 };
 
 /// Resets a profiler's state.
@@ -14103,6 +14816,51 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// Cache statistics.
+using cache_stats = dnnl_cache_stats_t;
+
+/// @copydoc dnnl_get_primitive_cache_stats(dnnl_primitive_kind_t, dnnl_cache_stats_t *)
+inline cache_stats get_primitive_cache_stats(
+        primitive::kind kind = primitive::kind::undef) {
+    cache_stats result {};
+    error::wrap_c_api(dnnl_get_primitive_cache_stats(
+                              static_cast<dnnl_primitive_kind_t>(kind), &result),
+            "could not get primitive cache statistics");
+    return result;
+}
+
+/// @copydoc dnnl_get_kernel_cache_stats(dnnl_cache_stats_t *)
+inline cache_stats get_kernel_cache_stats() {
+    cache_stats result {};
+    error::wrap_c_api(dnnl_get_kernel_cache_stats(&result),
+            "could not get kernel cache statistics");
+    return result;
+}
+
+/// @copydoc dnnl_reset_cache_stats()
+inline void reset_cache_stats() {
+    error::wrap_c_api(
+            dnnl_reset_cache_stats(), "could not reset cache statistics");
+}
+
+/// @copydoc dnnl_primitive_cache_prewarm(int, const_dnnl_primitive_desc_t const *)
+inline void prewarm_primitive_cache(
+        const std::vector<primitive_desc_base> &primitive_descs) {
+    std::vector<const_dnnl_primitive_desc_t> c_pds;
+    c_pds.reserve(primitive_descs.size());
+    for (const auto &pd : primitive_descs)
+        c_pds.push_back(pd.get());
+    error::wrap_c_api(
+            dnnl_primitive_cache_prewarm((int)c_pds.size(), c_pds.data()),
+            "could not prewarm primitive cache");
+}
+
+/// @copydoc dnnl_primitive_cache_prewarm_wait()
+inline void wait_primitive_cache_prewarm() {
+    error::wrap_c_api(dnnl_primitive_cache_prewarm_wait(),
+            "could not wait for primitive cache prewarm");
+}
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_blas BLAS functions
@@ -14138,6 +14896,105 @@ inline status gemm_s8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
             K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
 }
 
+/// @copydoc dnnl_sgemm_pack_get_size()
+inline status sgemm_pack_get_size(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_sgemm_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_sgemm_pack()
+inline status sgemm_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, float *dst) {
+    return static_cast<status>(dnnl_sgemm_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_sgemm_compute()
+inline status sgemm_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const float *A, dnnl_dim_t lda,
+        const float *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_sgemm_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_pack_get_size()
+inline status gemm_bf16bf16f32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_pack()
+inline status gemm_bf16bf16f32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const uint16_t *src, uint16_t *dst) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_compute()
+inline status gemm_bf16bf16f32_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const uint16_t *A, dnnl_dim_t lda,
+        const uint16_t *B, dnnl_dim_t ldb, float beta, float *C,
+        dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack_get_size()
+inline status gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack()
+inline status gemm_u8s8s32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_compute()
+inline status gemm_u8s8s32_compute(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const uint8_t *A,
+        dnnl_dim_t lda, const int8_t *B, dnnl_dim_t ldb, float beta,
+        int32_t *C, dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_compute(transa, transb,
+            offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_pack_get_size()
+inline status gemm_s8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_pack()
+inline status gemm_s8s8s32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_compute()
+inline status gemm_s8s8s32_compute(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const int8_t *A,
+        dnnl_dim_t lda, const int8_t *B, dnnl_dim_t ldb, float beta,
+        int32_t *C, dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_compute(transa, transb,
+            offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co));
+}
+
 /// @} dnnl_api_blas
 
 // implementation section
@@ -14178,6 +15035,52 @@ inline void primitive::execute(const stream &astream,
             "could not execute a primitive");
 }
 
+inline void primitive::execute_batch(const stream &astream,
+        const std::vector<std::pair<primitive, std::unordered_map<int, memory>>>
+                &ops) {
+    std::vector<std::vector<dnnl_exec_arg_t>> c_args(ops.size());
+    std::vector<const_dnnl_primitive_t> c_primitives;
+    std::vector<int> c_nargs;
+    std::vector<const dnnl_exec_arg_t *> c_args_ptrs;
+    c_primitives.reserve(ops.size());
+    c_nargs.reserve(ops.size());
+    c_args_ptrs.reserve(ops.size());
+    for (size_t i = 0; i < ops.size(); i++) {
+        c_args[i].reserve(ops[i].second.size());
+        for (const auto &a : ops[i].second)
+            c_args[i].push_back({a.first, a.second.get(true)});
+        c_primitives.push_back(ops[i].first.get());
+        c_nargs.push_back((int)c_args[i].size());
+        c_args_ptrs.push_back(c_args[i].data());
+    }
+
+    error::wrap_c_api(
+            dnnl_primitive_execute_batch(astream.get(), (int)ops.size(),
+                    c_primitives.data(), c_nargs.data(), c_args_ptrs.data()),
+            "could not execute primitives");
+}
+
+inline size_t primitive::plan_scratchpad(
+        const std::vector<primitive> &primitives,
+        const std::vector<int> &stream_ids, std::vector<size_t> &offsets) {
+    if (primitives.size() != stream_ids.size())
+        DNNL_THROW_ERROR(dnnl_invalid_arguments,
+                "inconsistent number of primitives and stream indices");
+    std::vector<const_dnnl_primitive_t> c_primitives;
+    c_primitives.reserve(primitives.size());
+    for (const auto &p : primitives)
+        c_primitives.push_back(p.get());
+    offsets.resize(primitives.size());
+
+    size_t size = 0;
+    error::wrap_c_api(
+            dnnl_primitive_plan_scratchpad((int)primitives.size(),
+                    c_primitives.data(), stream_ids.data(), offsets.data(),
+                    &size),
+            "could not plan a shared scratchpad");
+    return size;
+}
+
 /// @endcond
 
 #undef DNNL_DEFINE_BITMASK_OPS
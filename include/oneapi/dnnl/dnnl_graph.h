@@ -58,6 +58,32 @@ dnnl_status_t DNNL_API dnnl_graph_allocator_create(
 dnnl_status_t DNNL_API dnnl_graph_allocator_destroy(
         dnnl_graph_allocator_t allocator);
 
+/// Binds a buffer to an allocator, from which the temporary memory of the
+/// executions of compiled partitions on the engines created with the
+/// allocator is taken instead of being allocated and freed on every
+/// execution. An execution allocates its temporary memory as usual if the
+/// arena is smaller than needed or is used by another execution at the
+/// moment. The size of the arena for a sequence of compiled partitions can
+/// be queried with #dnnl_graph_get_temporary_arena_size.
+///
+/// @note
+///     The arena is only used by the executions on CPU engines with a
+///     synchronous runtime. The executions on GPU engines, with the SYCL
+///     runtime, and on the streams with an asynchronous threadpool allocate
+///     their temporary memory as usual.
+///
+/// @note
+///     The buffer should be allocated as the allocator allocates memory for
+///     the engines and should outlive the executions using it.
+///
+/// @param allocator The allocator.
+/// @param arena The buffer used as the arena. Passing NULL unbinds the arena.
+/// @param size The size of the buffer in bytes.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_allocator_set_temporary_arena(
+        dnnl_graph_allocator_t allocator, void *arena, size_t size);
+
 /// @} dnnl_graph_api_allocator
 
 /// @addtogroup dnnl_graph_api_engine
@@ -429,6 +455,53 @@ dnnl_status_t DNNL_API dnnl_graph_partition_compile(
         const dnnl_graph_logical_tensor_t **inputs, size_t out_num,
         const dnnl_graph_logical_tensor_t **outputs, dnnl_engine_t engine);
 
+/// Compiles a partition with given input and output logical tensors reusing
+/// the kernels of a previous compilation, e.g. in another process. The cache
+/// blob is obtained with #dnnl_graph_compiled_partition_get_cache_blob from a
+/// compiled partition of the same partition with the same logical tensors
+/// and the same kind of device. The kernels missing in the cache blob are
+/// generated as usual.
+///
+/// @param partition The target partition.
+/// @param compiled_partition Output compiled partition.
+/// @param in_num The number of input logical tensors.
+/// @param inputs A list of input logical tensors.
+/// @param out_num The number of output logical tensors.
+/// @param outputs A list of output logical tensors.
+/// @param engine The target engine of the compilation.
+/// @param size Size of the cache blob in bytes.
+/// @param cache_blob Cache blob of size @p size.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_partition_compile_from_cache_blob(
+        dnnl_graph_partition_t partition,
+        dnnl_graph_compiled_partition_t compiled_partition, size_t in_num,
+        const dnnl_graph_logical_tensor_t **inputs, size_t out_num,
+        const dnnl_graph_logical_tensor_t **outputs, dnnl_engine_t engine,
+        size_t size, const uint8_t *cache_blob);
+
+/// Compiles a list of partitions concurrently, e.g. the partitions of a
+/// model, which is equivalent to calling #dnnl_graph_partition_compile for
+/// every partition. The partitions are compiled by the threads of the CPU
+/// runtime of the library.
+///
+/// @param num_partitions The number of partitions.
+/// @param partitions The target partitions.
+/// @param compiled_partitions Output compiled partitions, one per partition.
+/// @param in_nums The numbers of input logical tensors of the partitions.
+/// @param inputs The lists of input logical tensors of the partitions.
+/// @param out_nums The numbers of output logical tensors of the partitions.
+/// @param outputs The lists of output logical tensors of the partitions.
+/// @param engine The target engine of the compilation.
+/// @returns #dnnl_success on success or the status of the first partition
+///     that failed to compile otherwise.
+dnnl_status_t DNNL_API dnnl_graph_partitions_compile(size_t num_partitions,
+        dnnl_graph_partition_t *partitions,
+        dnnl_graph_compiled_partition_t *compiled_partitions,
+        const size_t *in_nums, const dnnl_graph_logical_tensor_t ***inputs,
+        const size_t *out_nums, const dnnl_graph_logical_tensor_t ***outputs,
+        dnnl_engine_t engine);
+
 /// Returns the number of input logical tensors of a partition.
 ///
 /// @param partition The target partition.
@@ -524,6 +597,32 @@ dnnl_status_t DNNL_API dnnl_graph_compiled_partition_execute(
         const_dnnl_graph_tensor_t *inputs, size_t num_outputs,
         const_dnnl_graph_tensor_t *outputs);
 
+/// Executes a list of compiled partitions in their order, e.g. the
+/// partitions of a model in a topological order, which is equivalent to
+/// calling #dnnl_graph_compiled_partition_execute for every partition. A
+/// partition depends on an earlier one if the memory of one of its tensors
+/// overlaps the memory of a tensor written by the other. On a CPU engine with
+/// OpenMP or TBB runtime, the small partitions that do not depend on each
+/// other, e.g. the ones of independent branches of a graph, are executed
+/// concurrently by the threads of the runtime. Otherwise, the partitions are
+/// executed one after another.
+///
+/// @param num_partitions The number of compiled partitions.
+/// @param compiled_partitions The compiled partitions.
+/// @param stream The stream used for execution.
+/// @param in_nums The numbers of input tensors of the compiled partitions.
+/// @param inputs The lists of input tensors of the compiled partitions.
+/// @param out_nums The numbers of output tensors of the compiled partitions.
+/// @param outputs The lists of output tensors of the compiled partitions.
+/// @returns #dnnl_success on success or the status of the first partition
+///     that failed to execute otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partitions_execute(
+        size_t num_partitions,
+        const_dnnl_graph_compiled_partition_t *compiled_partitions,
+        dnnl_stream_t stream, const size_t *in_nums,
+        const_dnnl_graph_tensor_t **inputs, const size_t *out_nums,
+        const_dnnl_graph_tensor_t **outputs);
+
 /// Destroys a compiled partition.
 ///
 /// @param compiled_partition The compiled partition to be destroyed.
@@ -565,6 +664,50 @@ dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_inplace_ports(
         size_t *num_inplace_pairs,
         const dnnl_graph_inplace_pair_t **inplace_pairs);
 
+/// Returns the size of the temporary memory a compiled partition allocates
+/// on every execution for its intermediate results and the scratchpads of
+/// its primitives. For a partition compiled with unknown input dimensions,
+/// the size covers the shapes executed so far.
+///
+/// @param compiled_partition The handle of target compiled_partition.
+/// @param size The size of the temporary memory in bytes.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_temporary_size(
+        const_dnnl_graph_compiled_partition_t compiled_partition,
+        size_t *size);
+
+/// Retrieves a cache blob associated with a compiled partition. The cache blob
+/// holds the cache blobs of the primitives the compiled partition has created
+/// and can be passed to #dnnl_graph_partition_compile_from_cache_blob to
+/// skip their kernel generation. Only the primitives that support cache blobs
+/// (see #dnnl_primitive_get_cache_blob) have their kernels in it.
+///
+/// @param compiled_partition The handle of target compiled_partition.
+/// @param size Size of the cache blob in bytes.
+/// @param cache_blob Cache blob of size @p size. If the @p cache_blob is
+///     nullptr then the size of the cache blob is returned in @p size.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_cache_blob(
+        const_dnnl_graph_compiled_partition_t compiled_partition,
+        size_t *size, uint8_t *cache_blob);
+
+/// Returns the size of an arena that can hold the temporary memory of the
+/// compiled partitions when they are executed one after another, e.g. the
+/// partitions of a model in their execution order. The arena can be bound to
+/// an allocator with #dnnl_graph_allocator_set_temporary_arena.
+///
+/// @param size The size of the arena in bytes.
+/// @param num_compiled_partitions The number of compiled partitions.
+/// @param compiled_partitions The compiled partitions in their execution
+///     order.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_get_temporary_arena_size(size_t *size,
+        size_t num_compiled_partitions,
+        const const_dnnl_graph_compiled_partition_t *compiled_partitions);
+
 /// @} dnnl_graph_api_compiled_partition
 
 /// @addtogroup dnnl_graph_api_graph
@@ -771,6 +914,84 @@ dnnl_status_t DNNL_API dnnl_graph_set_constant_tensor_cache_capacity(
 dnnl_status_t DNNL_API dnnl_graph_get_constant_tensor_cache_capacity(
         dnnl_engine_kind_t eng_kind, size_t *size);
 
+/// Sets the priority of the constant tensors of a compiled partition in the
+/// constant tensor cache. Once the capacity limit is reached, the constant
+/// tensors of a compiled partition evict the constant tensors of compiled
+/// partitions with a lower priority, starting with the least frequently used
+/// ones, and are not cached if those do not free enough memory. The constant
+/// tensors of compiled partitions with the same priority never evict each
+/// other. The priority is 0 by default, and constant tensors with the
+/// #DNNL_GRAPH_CONSTANT_CACHE_PRIORITY_PINNED priority are never evicted.
+///
+/// @note
+///     Compiled partitions of the same partition compiled with the same
+///     inputs, outputs, and engine share the priority.
+///
+/// @param compiled_partition The handle of target compiled partition.
+/// @param priority The priority of the constant tensors.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API
+dnnl_graph_compiled_partition_set_constant_cache_priority(
+        dnnl_graph_compiled_partition_t compiled_partition, int32_t priority);
+
+/// Starts computing the constant tensors of a compiled partition from the
+/// given inputs into the constant tensor cache, e.g. the reordered weights,
+/// and returns without waiting for the computation, so that the first
+/// execution with the same constant inputs does not compute them. An
+/// execution started before the computation completes waits for it.
+///
+/// @note
+///     Only the constant inputs need to hold data. The constant inputs must
+///     stay valid until #dnnl_graph_compiled_partition_constants_ready
+///     reports the constant tensors ready, and the destruction of the
+///     compiled partition waits for the computation. The computation runs on
+///     a stream of its own on the engine of @p stream, so the application
+///     can keep using @p stream. A failure of the computation is returned by
+///     the next call to this function or to an execution of the compiled
+///     partition. The executions waiting for the failed constant tensors
+///     fail too.
+///
+/// @param compiled_partition The handle of target compiled partition.
+/// @param stream A stream on the engine of the compiled partition.
+/// @param num_inputs The number of input tensors.
+/// @param inputs A list of input tensors, the same as the ones of the
+///     executions.
+/// @returns #dnnl_invalid_arguments if the constant tensor cache is
+///     disabled, #dnnl_unimplemented if the constant tensors of the compiled
+///     partition are only computed on execution, and #dnnl_success on
+///     success.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_prepare_constants(
+        const_dnnl_graph_compiled_partition_t compiled_partition,
+        dnnl_stream_t stream, size_t num_inputs,
+        const_dnnl_graph_tensor_t *inputs);
+
+/// Queries whether the constant tensors of a compiled partition computed
+/// from the given inputs are in the constant tensor cache, either by
+/// #dnnl_graph_compiled_partition_prepare_constants or by an execution.
+///
+/// @param compiled_partition The handle of target compiled partition.
+/// @param num_inputs The number of input tensors.
+/// @param inputs A list of input tensors.
+/// @param ready Output value: 1 if the constant tensors are ready, or if the
+///     compiled partition has no constant tensors, and 0 otherwise.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_constants_ready(
+        const_dnnl_graph_compiled_partition_t compiled_partition,
+        size_t num_inputs, const_dnnl_graph_tensor_t *inputs, int *ready);
+
+/// Returns the statistics of the constant tensor caches of an engine kind,
+/// summed over the devices of the engine kind.
+///
+/// @param eng_kind The engine kind that the constant tensor cache used for.
+/// @param stats The statistics of the constant tensor caches.
+/// @returns #dnnl_invalid_arguments if the @p stats is nullptr, and
+/// #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_get_constant_tensor_cache_stats(
+        dnnl_engine_kind_t eng_kind,
+        dnnl_graph_constant_tensor_cache_stats_t *stats);
+
 /// @} dnnl_graph_api_constant_tensor_cache
 
 /// @} dnnl_graph_api
@@ -191,6 +191,30 @@ public:
                 "could not create allocator");
         reset(a);
     }
+
+    /// Binds a buffer, from which the temporary memory of the executions of
+    /// compiled partitions on the engines created with the allocator is taken
+    /// instead of being allocated on every execution. An execution allocates
+    /// its temporary memory as usual if the arena is too small or is used by
+    /// another execution at the moment.
+    ///
+    /// @note
+    ///     The arena is only used by the executions on CPU engines with a
+    ///     synchronous runtime. The executions on GPU engines, with the SYCL
+    ///     runtime, and on the streams with an asynchronous threadpool
+    ///     allocate their temporary memory as usual.
+    ///
+    /// @note
+    ///     The buffer should be allocated as the allocator allocates memory
+    ///     for the engines and should outlive the executions using it.
+    ///
+    /// @param arena The buffer used as the arena, or nullptr to unbind it.
+    /// @param size The size of the buffer in bytes.
+    void set_temporary_arena(void *arena, size_t size) {
+        error::wrap_c_api(
+                dnnl_graph_allocator_set_temporary_arena(get(), arena, size),
+                "could not set the temporary arena of an allocator");
+    }
 };
 
 /// @} dnnl_graph_api_allocator
@@ -232,12 +256,20 @@ inline engine make_engine_with_allocator(
 ///
 /// @{
 
+class partition;
+class compiled_partition;
+
 /// Logical tensor object
 class logical_tensor {
     friend class op;
     friend class tensor;
     friend class partition;
     friend class compiled_partition;
+    friend std::vector<compiled_partition> compile_partitions(
+            const std::vector<partition> &partitions,
+            const std::vector<std::vector<logical_tensor>> &inputs,
+            const std::vector<std::vector<logical_tensor>> &outputs,
+            const engine &e);
 
     dnnl_graph_logical_tensor_t data;
 
@@ -732,6 +764,99 @@ public:
         return inplace_options;
     }
 
+    /// Sets the priority of the constant tensors of the compiled partition in
+    /// the constant tensor cache. Once the capacity limit is reached, the
+    /// constant tensors evict the ones of compiled partitions with a lower
+    /// priority, and the constant tensors of compiled partitions with the
+    /// same priority never evict each other. The priority is 0 by default,
+    /// and constant tensors with the
+    /// #DNNL_GRAPH_CONSTANT_CACHE_PRIORITY_PINNED priority are never evicted.
+    ///
+    /// @param priority The priority of the constant tensors.
+    void set_constant_cache_priority(int32_t priority) {
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_set_constant_cache_priority(
+                        get(), priority),
+                "could not set the constant cache priority of a compiled "
+                "partition");
+    }
+
+    /// Starts computing the constant tensors of the compiled partition from
+    /// the given inputs into the constant tensor cache, without waiting for
+    /// the computation, so that the first execution with the same constant
+    /// inputs does not compute them. Only the constant inputs need to hold
+    /// data, and they must stay valid until constants_ready() returns true.
+    /// The computation runs on a stream of its own, so the application can
+    /// keep using @p astream. A failure of the computation is reported by
+    /// the next call to this function or to execute().
+    ///
+    /// @param astream A stream on the engine of the compiled partition.
+    /// @param inputs A list of input tensors.
+    void prepare_constants(
+            stream &astream, const std::vector<tensor> &inputs) const {
+        std::vector<const_dnnl_graph_tensor_t> c_inputs;
+        c_inputs.reserve(inputs.size());
+        for (auto &in : inputs) {
+            c_inputs.push_back(in.get());
+        }
+
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_prepare_constants(get(),
+                        astream.get(), c_inputs.size(), c_inputs.data()),
+                "could not prepare the constants of a compiled partition");
+    }
+
+    /// Returns whether the constant tensors computed from the given inputs
+    /// are in the constant tensor cache.
+    ///
+    /// @param inputs A list of input tensors.
+    /// @returns True if the constant tensors are ready.
+    bool constants_ready(const std::vector<tensor> &inputs) const {
+        std::vector<const_dnnl_graph_tensor_t> c_inputs;
+        c_inputs.reserve(inputs.size());
+        for (auto &in : inputs) {
+            c_inputs.push_back(in.get());
+        }
+
+        int ready = 0;
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_constants_ready(
+                        get(), c_inputs.size(), c_inputs.data(), &ready),
+                "could not query the constants of a compiled partition");
+        return ready != 0;
+    }
+
+    /// Returns the size of the temporary memory the compiled partition
+    /// allocates on every execution for its intermediate results and the
+    /// scratchpads of its primitives.
+    ///
+    /// @returns The size of the temporary memory in bytes.
+    size_t get_temporary_size() const {
+        size_t size = 0;
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_get_temporary_size(get(), &size),
+                "could not get the temporary size of a compiled partition");
+        return size;
+    }
+
+    /// Returns a cache blob for the compiled partition, which holds the cache
+    /// blobs of its primitives and can be passed to partition::compile() to
+    /// skip their kernel generation.
+    ///
+    /// @returns Vector containing the cache blob.
+    std::vector<uint8_t> get_cache_blob() const {
+        size_t size = 0;
+        error::wrap_c_api(dnnl_graph_compiled_partition_get_cache_blob(
+                                  get(), &size, nullptr),
+                "could not get the cache blob size of a compiled partition");
+
+        std::vector<uint8_t> cache_blob(size);
+        error::wrap_c_api(dnnl_graph_compiled_partition_get_cache_blob(
+                                  get(), &size, cache_blob.data()),
+                "could not get the cache blob of a compiled partition");
+        return cache_blob;
+    }
+
     /// Execute a compiled partition.
     ///
     /// @param astream Stream object to run over.
@@ -758,6 +883,73 @@ public:
     }
 };
 
+/// Executes a list of compiled partitions in their order, e.g. the
+/// partitions of a model in a topological order. This is equivalent to
+/// calling compiled_partition::execute() for every partition, and the small
+/// partitions whose tensors do not overlap the memory written by one of
+/// them, e.g. the ones of independent branches of a graph, are executed
+/// concurrently on a CPU engine with OpenMP or TBB runtime.
+///
+/// @param astream Stream object to run over.
+/// @param compiled_partitions The compiled partitions to execute.
+/// @param inputs The input tensors of every compiled partition.
+/// @param outputs The output tensors of every compiled partition.
+inline void execute_partitions(stream &astream,
+        const std::vector<compiled_partition> &compiled_partitions,
+        const std::vector<std::vector<tensor>> &inputs,
+        const std::vector<std::vector<tensor>> &outputs) {
+    const size_t num = compiled_partitions.size();
+    if (inputs.size() != num || outputs.size() != num) {
+        error::wrap_c_api(dnnl_invalid_arguments,
+                "the numbers of compiled partitions and tensor lists differ");
+    }
+    if (num == 0) return;
+
+    std::vector<const_dnnl_graph_compiled_partition_t> c_cps;
+    std::vector<std::vector<const_dnnl_graph_tensor_t>> c_ins(num),
+            c_outs(num);
+    std::vector<const_dnnl_graph_tensor_t *> c_ins_ptrs, c_outs_ptrs;
+    std::vector<size_t> in_nums, out_nums;
+    for (size_t i = 0; i < num; ++i) {
+        c_cps.push_back(compiled_partitions[i].get());
+        for (const auto &in : inputs[i])
+            c_ins[i].push_back(in.get());
+        for (const auto &out : outputs[i])
+            c_outs[i].push_back(out.get());
+        c_ins_ptrs.push_back(c_ins[i].data());
+        c_outs_ptrs.push_back(c_outs[i].data());
+        in_nums.push_back(c_ins[i].size());
+        out_nums.push_back(c_outs[i].size());
+    }
+
+    error::wrap_c_api(
+            dnnl_graph_compiled_partitions_execute(num, c_cps.data(),
+                    astream.get(), in_nums.data(), c_ins_ptrs.data(),
+                    out_nums.data(), c_outs_ptrs.data()),
+            "could not execute the compiled partitions");
+}
+
+/// Returns the size of an arena that can hold the temporary memory of the
+/// compiled partitions when they are executed one after another. The arena
+/// can be bound to an allocator with allocator::set_temporary_arena().
+///
+/// @param compiled_partitions The compiled partitions in their execution
+///     order.
+/// @returns The size of the arena in bytes.
+inline size_t get_temporary_arena_size(
+        const std::vector<compiled_partition> &compiled_partitions) {
+    std::vector<const_dnnl_graph_compiled_partition_t> c_cps;
+    c_cps.reserve(compiled_partitions.size());
+    for (const auto &cp : compiled_partitions)
+        c_cps.push_back(cp.get());
+
+    size_t size = 0;
+    error::wrap_c_api(dnnl_graph_get_temporary_arena_size(
+                              &size, c_cps.size(), c_cps.data()),
+            "could not get the temporary arena size of compiled partitions");
+    return size;
+}
+
 /// @} dnnl_graph_api_compiled_partition
 
 /// @addtogroup dnnl_graph_api_op Op
@@ -1280,6 +1472,28 @@ public:
         return compile_(inputs, outputs, e);
     }
 
+    /// Compiles a partition with given input and output logical tensors
+    /// reusing the kernels of a previous compilation. The cache blob is
+    /// returned by compiled_partition::get_cache_blob() of a compiled
+    /// partition of the same partition with the same logical tensors, e.g.
+    /// in another process.
+    ///
+    /// @param inputs A list of input logical tensors.
+    /// @param outputs A list of output logical tensors.
+    /// @param e The engine used to compile the partition.
+    /// @param cache_blob The cache blob of a compiled partition.
+    /// @returns A compiled partition.
+    compiled_partition compile(const std::vector<logical_tensor> &inputs,
+            const std::vector<logical_tensor> &outputs, const engine &e,
+            const std::vector<uint8_t> &cache_blob) const {
+        if (!is_supported()) {
+            error::wrap_c_api(dnnl_invalid_arguments,
+                    "could not compile an unsupported partition");
+        }
+
+        return compile_(inputs, outputs, e, &cache_blob);
+    }
+
     /// Returns the supporting status of a partition. Some operations may not be
     /// supported by the library under certain circumstances. During
     /// partitioning stage, unsupported partitions will be returned to users
@@ -1352,7 +1566,8 @@ public:
 
 private:
     compiled_partition compile_(const std::vector<logical_tensor> &inputs,
-            const std::vector<logical_tensor> &outputs, const engine &e) const {
+            const std::vector<logical_tensor> &outputs, const engine &e,
+            const std::vector<uint8_t> *cache_blob = nullptr) const {
         std::vector<const dnnl_graph_logical_tensor_t *> c_inputs;
         std::vector<const dnnl_graph_logical_tensor_t *> c_outputs;
 
@@ -1370,15 +1585,84 @@ private:
         error::wrap_c_api(
                 dnnl_graph_compiled_partition_create(&cpartitions, get()),
                 "could not create compiled_partition");
-        error::wrap_c_api(dnnl_graph_partition_compile(get(), cpartitions,
-                                  c_inputs.size(), c_inputs.data(),
-                                  c_outputs.size(), c_outputs.data(), e.get()),
-                "partition compile failed");
+        if (cache_blob) {
+            error::wrap_c_api(
+                    dnnl_graph_partition_compile_from_cache_blob(get(),
+                            cpartitions, c_inputs.size(), c_inputs.data(),
+                            c_outputs.size(), c_outputs.data(), e.get(),
+                            cache_blob->size(), cache_blob->data()),
+                    "partition compile failed");
+        } else {
+            error::wrap_c_api(
+                    dnnl_graph_partition_compile(get(), cpartitions,
+                            c_inputs.size(), c_inputs.data(), c_outputs.size(),
+                            c_outputs.data(), e.get()),
+                    "partition compile failed");
+        }
 
         return compiled_partition(cpartitions);
     }
 };
 
+/// Compiles a list of partitions concurrently, e.g. the partitions of a
+/// model. This is equivalent to calling partition::compile() for every
+/// partition, and the partitions are compiled by the threads of the CPU
+/// runtime of the library.
+///
+/// @param partitions The partitions to compile.
+/// @param inputs The input logical tensors of every partition.
+/// @param outputs The output logical tensors of every partition.
+/// @param e The engine used to compile the partitions.
+/// @returns The compiled partitions, one per partition.
+inline std::vector<compiled_partition> compile_partitions(
+        const std::vector<partition> &partitions,
+        const std::vector<std::vector<logical_tensor>> &inputs,
+        const std::vector<std::vector<logical_tensor>> &outputs,
+        const engine &e) {
+    const size_t num = partitions.size();
+    if (inputs.size() != num || outputs.size() != num) {
+        error::wrap_c_api(dnnl_invalid_arguments,
+                "the numbers of partitions and logical tensor lists differ");
+    }
+
+    std::vector<compiled_partition> cps;
+    std::vector<dnnl_graph_partition_t> c_parts;
+    std::vector<dnnl_graph_compiled_partition_t> c_cps;
+    std::vector<std::vector<const dnnl_graph_logical_tensor_t *>> c_ins(num),
+            c_outs(num);
+    std::vector<const dnnl_graph_logical_tensor_t **> c_ins_ptrs, c_outs_ptrs;
+    std::vector<size_t> in_nums, out_nums;
+    for (size_t i = 0; i < num; ++i) {
+        if (!partitions[i].is_supported()) {
+            error::wrap_c_api(dnnl_invalid_arguments,
+                    "could not compile an unsupported partition");
+        }
+        dnnl_graph_compiled_partition_t c_cp = nullptr;
+        error::wrap_c_api(dnnl_graph_compiled_partition_create(
+                                  &c_cp, partitions[i].get()),
+                "could not create compiled_partition");
+        cps.emplace_back(c_cp);
+        c_parts.push_back(partitions[i].get());
+        c_cps.push_back(c_cp);
+
+        for (const auto &in : inputs[i])
+            c_ins[i].push_back(&(in.data));
+        for (const auto &out : outputs[i])
+            c_outs[i].push_back(&(out.data));
+        c_ins_ptrs.push_back(c_ins[i].data());
+        c_outs_ptrs.push_back(c_outs[i].data());
+        in_nums.push_back(c_ins[i].size());
+        out_nums.push_back(c_outs[i].size());
+    }
+
+    if (num == 0) return cps;
+    error::wrap_c_api(dnnl_graph_partitions_compile(num, c_parts.data(),
+                              c_cps.data(), in_nums.data(), c_ins_ptrs.data(),
+                              out_nums.data(), c_outs_ptrs.data(), e.get()),
+            "partitions compile failed");
+    return cps;
+}
+
 /// @} dnnl_graph_api_partition
 
 /// @addtogroup dnnl_graph_api_graph Graph
@@ -1632,6 +1916,22 @@ inline size_t get_constant_tensor_cache_capacity(engine::kind kind) {
     return size;
 }
 
+/// Statistics of the constant tensor caches of an engine kind.
+using constant_tensor_cache_stats = dnnl_graph_constant_tensor_cache_stats_t;
+
+/// Returns the statistics of the constant tensor caches of an engine kind,
+/// summed over the devices of the engine kind.
+///
+/// @param kind The engine kind that the constant tensor cache used for.
+inline constant_tensor_cache_stats get_constant_tensor_cache_stats(
+        engine::kind kind) {
+    constant_tensor_cache_stats stats {};
+    error::wrap_c_api(dnnl_graph_get_constant_tensor_cache_stats(
+                              static_cast<dnnl_engine_kind_t>(kind), &stats),
+            "fail to get constant tensor cache statistics");
+    return stats;
+}
+
 /// @} dnnl_graph_api_constant_tensor_cache
 
 } // namespace graph
@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef ONEAPI_DNNL_DNNL_GRAPH_THREADPOOL_H
+#define ONEAPI_DNNL_DNNL_GRAPH_THREADPOOL_H
+
+#include "oneapi/dnnl/dnnl_graph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @addtogroup dnnl_api
+/// @{
+
+/// @addtogroup dnnl_graph_api
+/// @{
+
+/// @addtogroup dnnl_graph_api_interop
+/// @{
+
+/// @addtogroup dnnl_graph_api_threadpool_interop
+/// @{
+
+/// @struct dnnl_graph_threadpool_event
+/// An opaque structure to describe the completion of a compiled partition
+/// execution enqueued to a threadpool stream.
+struct dnnl_graph_threadpool_event;
+
+/// A threadpool event handle.
+typedef struct dnnl_graph_threadpool_event *dnnl_graph_threadpool_event_t;
+
+/// A constant threadpool event handle.
+typedef const struct dnnl_graph_threadpool_event
+        *const_dnnl_graph_threadpool_event_t;
+
+/// Executes a compiled partition asynchronously on a threadpool stream.
+///
+/// If the threadpool of the stream reports the `NON_BLOCKING_EXECUTE` flag,
+/// the execution is enqueued to the stream and the call returns immediately.
+/// The execution starts after the dependency events are completed and runs in
+/// order with the other executions submitted to the stream. Otherwise, the
+/// execution is completed before the call returns. The compiled partition and
+/// the buffers of the tensors must stay alive until the output event is
+/// completed.
+///
+/// @sa @ref dev_guide_threadpool
+///
+/// @param compiled_partition The handle of target compiled partition.
+/// @param stream The threadpool stream used for execution.
+/// @param num_inputs The number of input tensors.
+/// @param inputs A list of input tensors.
+/// @param num_outputs The number of output tensors.
+/// @param outputs A non-empty list of output tensors.
+/// @param num_deps The number of dependency events.
+/// @param deps A list of dependency events. The events may be destroyed after
+///     the call returns.
+/// @param event Output event that is completed with the execution. It must be
+///     destroyed with #dnnl_graph_threadpool_interop_event_destroy().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise. #dnnl_unimplemented is returned if the library is not built
+///     with the THREADPOOL CPU runtime.
+dnnl_status_t DNNL_API
+dnnl_graph_threadpool_interop_compiled_partition_execute(
+        const_dnnl_graph_compiled_partition_t compiled_partition,
+        dnnl_stream_t stream, size_t num_inputs,
+        const_dnnl_graph_tensor_t *inputs, size_t num_outputs,
+        const_dnnl_graph_tensor_t *outputs, size_t num_deps,
+        const_dnnl_graph_threadpool_event_t *deps,
+        dnnl_graph_threadpool_event_t *event);
+
+/// Blocks until a threadpool event is completed.
+///
+/// @param event Threadpool event.
+/// @returns The status of the execution the event is completed with, which is
+///     the status of the first failed dependency if any.
+dnnl_status_t DNNL_API dnnl_graph_threadpool_interop_event_wait(
+        const_dnnl_graph_threadpool_event_t event);
+
+/// Checks whether a threadpool event is completed without blocking.
+///
+/// @param event Threadpool event.
+/// @param is_completed Output value, set to 1 if the event is completed and
+///     to 0 otherwise.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_threadpool_interop_event_query_completed(
+        const_dnnl_graph_threadpool_event_t event, uint8_t *is_completed);
+
+/// Destroys a threadpool event. The execution it describes is not affected.
+///
+/// @param event Threadpool event to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_threadpool_interop_event_destroy(
+        dnnl_graph_threadpool_event_t event);
+
+/// @} dnnl_graph_api_threadpool_interop
+
+/// @} dnnl_graph_api_interop
+
+/// @} dnnl_graph_api
+
+/// @} dnnl_api
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @file
+/// Graph threadpool interop API
+
+#ifndef ONEAPI_DNNL_DNNL_GRAPH_THREADPOOL_HPP
+#define ONEAPI_DNNL_DNNL_GRAPH_THREADPOOL_HPP
+
+/// @cond DO_NOT_DOCUMENT_THIS
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_graph.hpp"
+#include "oneapi/dnnl/dnnl_graph_threadpool.h"
+/// @endcond
+
+/// @addtogroup dnnl_api
+/// @{
+
+namespace dnnl {
+
+/// @addtogroup dnnl_graph_api
+/// @{
+
+namespace graph {
+
+/// @cond DO_NOT_DOCUMENT_THIS
+template <>
+struct graph_handle_traits<dnnl_graph_threadpool_event_t> {
+    static dnnl_status_t destructor(dnnl_graph_threadpool_event_t p) {
+        return dnnl_graph_threadpool_interop_event_destroy(p);
+    }
+};
+/// @endcond
+
+/// @addtogroup dnnl_graph_api_interop Runtime interoperability API
+/// API extensions to interact with the underlying run-time.
+/// @{
+
+/// @addtogroup dnnl_graph_api_threadpool_interop Threadpool interoperability
+/// API
+/// API extensions to interact with the underlying Threadpool run-time.
+/// @{
+
+/// Threadpool interoperability namespace
+namespace threadpool_interop {
+
+/// An event that is completed with a compiled partition execution enqueued
+/// to a threadpool stream.
+class event : public dnnl::handle<dnnl_graph_threadpool_event_t,
+                      graph_handle_traits<dnnl_graph_threadpool_event_t>> {
+public:
+    /// Default constructor. Constructs an empty object.
+    event() = default;
+
+    /// Constructs an event object from a C API handle.
+    ///
+    /// @param aevent The C API handle of the event.
+    event(dnnl_graph_threadpool_event_t aevent) { reset(aevent, false); }
+
+    /// Blocks until the event is completed. Throws an exception if the
+    /// execution or one of its dependencies failed.
+    void wait() const {
+        error::wrap_c_api(dnnl_graph_threadpool_interop_event_wait(get()),
+                "the compiled_partition execution failed");
+    }
+
+    /// Checks whether the event is completed without blocking.
+    ///
+    /// @returns @c true if the event is completed.
+    bool is_completed() const {
+        uint8_t res = 0;
+        error::wrap_c_api(
+                dnnl_graph_threadpool_interop_event_query_completed(
+                        get(), &res),
+                "could not query the event");
+        return res != 0;
+    }
+};
+
+/// Executes a compiled partition asynchronously on a threadpool stream and
+/// returns an event that is completed with the execution.
+///
+/// @sa dnnl_graph_threadpool_interop_compiled_partition_execute()
+///
+/// @param c_partition Compiled partition to execute.
+/// @param astream Threadpool stream object to run over.
+/// @param inputs Arguments map.
+/// @param outputs Arguments map.
+/// @param deps Optional vector with the events the execution depends on.
+/// @returns Output event.
+inline event execute(const compiled_partition &c_partition, stream &astream,
+        const std::vector<tensor> &inputs, const std::vector<tensor> &outputs,
+        const std::vector<event> &deps = {}) {
+    std::vector<const_dnnl_graph_tensor_t> c_inputs;
+    c_inputs.reserve(inputs.size());
+    for (auto &in : inputs) {
+        c_inputs.push_back(in.get());
+    }
+    std::vector<const_dnnl_graph_tensor_t> c_outputs;
+    c_outputs.reserve(outputs.size());
+    for (auto &out : outputs) {
+        c_outputs.push_back(out.get());
+    }
+    std::vector<const_dnnl_graph_threadpool_event_t> c_deps;
+    c_deps.reserve(deps.size());
+    for (auto &dep : deps) {
+        c_deps.push_back(dep.get());
+    }
+
+    dnnl_graph_threadpool_event_t c_event = nullptr;
+    error::wrap_c_api(
+            dnnl_graph_threadpool_interop_compiled_partition_execute(
+                    c_partition.get(), astream.get(), c_inputs.size(),
+                    c_inputs.data(), c_outputs.size(), c_outputs.data(),
+                    c_deps.size(), c_deps.data(), &c_event),
+            "could not execute the compiled_partition on a specified "
+            "threadpool stream");
+    return event(c_event);
+}
+
+} // namespace threadpool_interop
+
+/// @} dnnl_graph_api_threadpool_interop
+
+/// @} dnnl_graph_api_interop
+
+} // namespace graph
+
+/// @} dnnl_graph_api
+
+} // namespace dnnl
+
+/// @} dnnl_api
+
+#endif
@@ -469,6 +469,28 @@ typedef const struct dnnl_graph_tensor *const_dnnl_graph_tensor_t;
 
 /// @} dnnl_graph_api_tensor
 
+/// @addtogroup dnnl_graph_api_constant_tensor_cache
+/// @{
+
+/// A constant tensor cache priority of compiled partitions whose constant
+/// tensors are never evicted for the constant tensors of other compiled
+/// partitions.
+#define DNNL_GRAPH_CONSTANT_CACHE_PRIORITY_PINNED INT32_MAX
+
+/// Statistics of the constant tensor caches of an engine kind.
+typedef struct {
+    /// Size of the cached constant tensors in bytes.
+    size_t size;
+    /// Size of the constant tensors evicted for the constant tensors of
+    /// compiled partitions with a higher priority in bytes.
+    size_t evicted_bytes;
+    /// Size of the constant tensors computed again because they were
+    /// evicted or did not fit into the cache in bytes.
+    size_t recomputed_bytes;
+} dnnl_graph_constant_tensor_cache_stats_t;
+
+/// @} dnnl_graph_api_constant_tensor_cache
+
 /// @} dnnl_graph_api
 
 /// @} dnnl_api
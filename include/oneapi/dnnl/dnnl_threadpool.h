@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2022 Intel Corporation
+* Copyright 2020-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -79,6 +79,34 @@ dnnl_status_t DNNL_API dnnl_threadpool_interop_set_max_concurrency(
 dnnl_status_t DNNL_API dnnl_threadpool_interop_get_max_concurrency(
         int *max_concurrency);
 
+/// Creates a threadpool implemented by the library.
+///
+/// The threadpool executes a parallel call on the calling thread and on the
+/// worker threads it owns. Idle workers spin for a short while before
+/// sleeping, which keeps the latency of back-to-back parallel calls low.
+///
+/// @sa @ref dev_guide_threadpool
+///
+/// @param threadpool Output pointer to an instance of a C++ class that
+///     implements dnnl::threadpool_iface interface.
+/// @param num_threads The number of threads including the calling one. A
+///     non-positive value stands for the number of hardware threads.
+/// @param pin_threads If non-zero, the worker threads are bound to the
+///     logical cores available to the process (Linux only).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_threadpool_interop_threadpool_create(
+        void **threadpool, int num_threads, int pin_threads);
+
+/// Destroys a threadpool created with
+/// #dnnl_threadpool_interop_threadpool_create().
+///
+/// @param threadpool Threadpool to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_threadpool_interop_threadpool_destroy(
+        void *threadpool);
+
 /// @copydoc dnnl_sgemm()
 /// @param threadpool A pointer to a threadpool interface (only when built with
 ///     the THREADPOOL CPU runtime).
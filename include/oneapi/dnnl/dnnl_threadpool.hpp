@@ -70,6 +70,38 @@ inline threadpool_iface *get_threadpool(const dnnl::stream &astream) {
     return static_cast<threadpool_iface *>(tp);
 }
 
+/// A threadpool implemented by the library.
+///
+/// @sa @ref dev_guide_threadpool
+class builtin_threadpool {
+public:
+    /// Constructs a threadpool.
+    ///
+    /// @param num_threads The number of threads including the calling one.
+    ///     A non-positive value stands for the number of hardware threads.
+    /// @param pin_threads If true, the worker threads are bound to the
+    ///     logical cores available to the process (Linux only).
+    builtin_threadpool(int num_threads = 0, bool pin_threads = false) {
+        dnnl::error::wrap_c_api(dnnl_threadpool_interop_threadpool_create(
+                                        &tp_, num_threads, pin_threads),
+                "could not create a threadpool");
+    }
+
+    builtin_threadpool(const builtin_threadpool &) = delete;
+    builtin_threadpool &operator=(const builtin_threadpool &) = delete;
+
+    /// Destructs the threadpool.
+    ~builtin_threadpool() { dnnl_threadpool_interop_threadpool_destroy(tp_); }
+
+    /// Returns the threadpool interface to pass to oneDNN.
+    threadpool_iface *get() const {
+        return static_cast<threadpool_iface *>(tp_);
+    }
+
+private:
+    void *tp_ = nullptr;
+};
+
 /// @copydoc dnnl_threadpool_interop_sgemm()
 inline status sgemm(char transa, char transb, dnnl_dim_t M, dnnl_dim_t N,
         dnnl_dim_t K, float alpha, const float *A, dnnl_dim_t lda,
@@ -61,6 +61,14 @@ struct threadpool_iface {
     /// waiting for the submitted closures to finish execution on its own.
     static constexpr uint64_t ASYNCHRONOUS = 1;
 
+    /// If set, primitive executions submitted to a stream created with this
+    /// threadpool are enqueued and the execute call returns immediately. The
+    /// executions run in the submission order on a thread owned by the
+    /// stream, which uses the threadpool for their parallel work. Call
+    /// dnnl::stream::wait() before accessing the outputs; the memory objects
+    /// passed to the executions must stay alive until then.
+    static constexpr uint64_t NON_BLOCKING_EXECUTE = 2;
+
     virtual ~threadpool_iface() = default;
 };
 
@@ -77,6 +77,18 @@ typedef enum {
     dnnl_packed,
     /// Coordinate Sparse Encoding (COO).
     dnnl_coo,
+    /// Grouped encoding. A 2D tensor is made of groups of consecutive rows
+    /// with a number of rows that differs between the groups, e.g. the tokens
+    /// routed to each expert of a Mixture-of-Experts layer.
+    dnnl_grouped,
+    /// Paged encoding. A 2D tensor is split along one dimension into pages
+    /// of fixed size that are stored in a pool in an arbitrary order and are
+    /// located with a page table, e.g. a paged key-value cache.
+    dnnl_paged,
+    /// Structured N:M encoding. Each group of M consecutive elements along
+    /// the first dimension of a 2D tensor keeps at most N non-zero values
+    /// that are stored together with a bitmask of their positions.
+    dnnl_structured,
 } dnnl_sparse_encoding_t;
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -86,6 +98,27 @@ typedef enum {
     dnnl_profiling_data_kind_undef = 0,
     /// Data kind to query an execution time in nanoseconds.
     dnnl_profiling_data_kind_time,
+    /// Data kind to query the total time in nanoseconds that threads spent
+    /// executing a primitive. Divided by the execution time and the number of
+    /// threads, it gives the thread utilization. CPU only.
+    dnnl_profiling_data_kind_thread_time,
+    /// Data kind to query the largest number of threads used by a primitive
+    /// execution. CPU only.
+    dnnl_profiling_data_kind_nthr,
+    /// Data kind to query the time in nanoseconds that the execution units
+    /// were active during a primitive execution, averaged over the units.
+    /// Divided by the execution time, it gives the EU utilization. Intel GPUs
+    /// with OpenCL runtime and Metrics Discovery only.
+    dnnl_profiling_data_kind_eu_active_time,
+    /// Data kind to query the time in nanoseconds that the execution units
+    /// were stalled during a primitive execution, averaged over the units.
+    /// Intel GPUs with OpenCL runtime and Metrics Discovery only.
+    dnnl_profiling_data_kind_eu_stall_time,
+    /// Data kind to query the number of bytes that a primitive execution read
+    /// from and wrote to GPU memory. Divided by the execution time, it gives
+    /// the memory bandwidth. Intel GPUs with OpenCL runtime and Metrics
+    /// Discovery only.
+    dnnl_profiling_data_kind_memory_bytes,
 
     // Max value to prevent UB for internal-use-only values.
     dnnl_profiling_data_max = 0x7fff,
@@ -2053,6 +2086,8 @@ typedef enum {
     dnnl_layer_normalization,
     /// A group normalization primitive.
     dnnl_group_normalization,
+    /// An embedding bag primitive.
+    dnnl_embedding_bag,
 
     // Max value to prevent UB for internal-use-only values.
     dnnl_primitive_kind_max = 0x7fff,
@@ -2136,6 +2171,10 @@ typedef enum {
     dnnl_pooling_avg_include_padding = 0x2ff,
     /// Average pooling exclude padding
     dnnl_pooling_avg_exclude_padding = 0x3ff,
+    /// Adaptive max pooling
+    dnnl_pooling_adaptive_max = 0x4ff,
+    /// Adaptive average pooling
+    dnnl_pooling_adaptive_avg = 0x5ff,
     /// Local response normalization (LRN) across multiple channels
     dnnl_lrn_across_channels = 0xaff,
     /// LRN within a single channel
@@ -2188,8 +2227,12 @@ typedef enum {
     dnnl_resampling_nearest = 0x2fff0,
     /// Linear Resampling Method
     dnnl_resampling_linear = 0x2fff1,
+    /// Bicubic Resampling Method
+    dnnl_resampling_cubic = 0x2fffd,
+    /// Antialiased Linear Resampling Method
+    dnnl_resampling_linear_antialias = 0x2fffe,
     /// Reduction using max
-    dnnl_reduction_max,
+    dnnl_reduction_max = 0x2fff2,
     /// Reduction using min
     dnnl_reduction_min,
     /// Reduction using sum
@@ -2206,6 +2249,10 @@ typedef enum {
     dnnl_reduction_norm_lp_power_p_max,
     /// Reduction using lp norm without final pth-root
     dnnl_reduction_norm_lp_power_p_sum,
+    /// Reduction to the indices of the largest values
+    dnnl_reduction_arg_max,
+    /// Reduction to the indices of the smallest values
+    dnnl_reduction_arg_min,
     /// Softmax
     dnnl_softmax_accurate = 0x30000,
     /// Logsoftmax
@@ -2276,6 +2323,20 @@ typedef enum {
     ///     When used with #dnnl_use_global_stats,
     ///     only RMS norm is required to be provided as input.
     dnnl_rms_norm = 0x20U,
+
+    /// Fuse an elementwise binary Add operation preceding normalization.
+    /// On forward propagation, the source tensor is summed with an additional
+    /// input tensor (#DNNL_ARG_SRC_1) and the result is normalized. When an
+    /// additional output tensor (#DNNL_ARG_DST_1) is passed, the sum is saved
+    /// to it. Both tensors use the source memory descriptor. On backward
+    /// propagation, the source tensor is the sum, and the gradient of the
+    /// residual branch (#DNNL_ARG_DIFF_DST_1), described by the diff
+    /// destination memory descriptor, is added to the diff source, which is
+    /// the gradient of both addends.
+    ///
+    /// @note
+    ///     Only layer normalization supports this flag.
+    dnnl_fuse_add_norm = 0x40U,
 } dnnl_normalization_flags_t;
 
 /// @} dnnl_api_primitives_common
@@ -2333,6 +2394,21 @@ typedef struct dnnl_memory *dnnl_memory_t;
 /// A constant memory handle.
 typedef const struct dnnl_memory *const_dnnl_memory_t;
 
+/// Flags for memory objects mapped from files.
+typedef enum {
+    /// Map the file read-only. The memory object can only be used as an input.
+    dnnl_memory_file_flags_none = 0x0U,
+    /// Map the file for writing. The data written to the memory object, e.g.
+    /// the destination of a reorder, is stored to the file.
+    dnnl_memory_file_flags_writable = 0x1U,
+    /// Read the file into the page cache when the memory object is created
+    /// instead of on the first access.
+    dnnl_memory_file_flags_populate = 0x2U,
+    /// Ask the operating system to back the mapping with huge pages. The flag
+    /// has no effect if the file system does not support it.
+    dnnl_memory_file_flags_huge_pages = 0x4U,
+} dnnl_memory_file_flags_t;
+
 /// @} dnnl_api_memory
 
 /// @addtogroup dnnl_api_primitives
@@ -2347,6 +2423,11 @@ typedef enum {
     dnnl_rnn_flags_undef = 0x0,
     /// Do not add weights gradient to existing diff_weights memory
     dnnl_rnn_flags_diff_weights_overwrite = 0x1,
+    /// The sequences of a batch have their own lengths, passed at execution
+    /// time as a #dnnl_s32 tensor of dimensions {batch} with index
+    /// #DNNL_ARG_SEQ_LENGTHS. Supported for forward propagation with the
+    /// #dnnl_unidirectional_left2right direction only.
+    dnnl_rnn_flags_seq_lengths = 0x2,
 } dnnl_rnn_flags_t;
 
 /// A direction of RNN primitive execution.
@@ -2413,6 +2494,12 @@ typedef enum {
     /// as the scratchpad buffers are not used concurrently by two primitive
     /// executions.
     dnnl_scratchpad_mode_user,
+    /// The scratchpad is carved from a buffer owned by the stream the
+    /// primitive is executed on. The buffer is shared by all the primitives
+    /// executed on the stream and grows to the largest scratchpad requested.
+    /// Primitives in this mode must not be executed concurrently on the same
+    /// stream and cannot be executed on out-of-order streams.
+    dnnl_scratchpad_mode_stream,
 } dnnl_scratchpad_mode_t;
 
 /// Rounding mode
@@ -2424,6 +2511,18 @@ typedef enum {
     dnnl_rounding_mode_stochastic,
 } dnnl_rounding_mode_t;
 
+/// Kinds of the implicit causal mask applied by the softmax primitive.
+typedef enum {
+    /// No causal mask.
+    dnnl_softmax_mask_none,
+    /// Causal mask aligned to the top-left corner: an element of row `i` and
+    /// column `j` is masked out when `j > i`.
+    dnnl_softmax_mask_causal_top_left,
+    /// Causal mask aligned to the bottom-right corner: an element of row `i`
+    /// and column `j` is masked out when `j > i + ncols - nrows`.
+    dnnl_softmax_mask_causal_bottom_right,
+} dnnl_softmax_mask_kind_t;
+
 /// @struct dnnl_primitive_attr
 /// @brief An opaque structure for primitive descriptor attributes.
 ///
@@ -2509,6 +2608,12 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// #DNNL_ARG_SRC_3.
 #define DNNL_ARG_AUGRU_ATTENTION DNNL_ARG_SRC_3
 
+/// Source argument #4.
+#define DNNL_ARG_SRC_4 5
+/// A special mnemonic for RNN per-sequence lengths. An alias for
+/// #DNNL_ARG_SRC_4.
+#define DNNL_ARG_SEQ_LENGTHS DNNL_ARG_SRC_4
+
 /// Destination argument #0.
 #define DNNL_ARG_DST_0 17
 /// A special mnemonic for destination argument for primitives that have a
@@ -2667,6 +2772,15 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for shift argument of normalization primitives.
 #define DNNL_ARG_DIFF_SHIFT 256
 
+/// Values kept by the top-k attribute.
+#define DNNL_ARG_ATTR_TOP_K_VALUES 505
+
+/// Indices of the values kept by the top-k attribute.
+#define DNNL_ARG_ATTR_TOP_K_INDICES 506
+
+/// Per-row valid lengths of the softmax mask.
+#define DNNL_ARG_ATTR_SOFTMAX_LENGTHS 507
+
 /// Rounding mode seed for stochastic rounding
 /// Single seed needed independently of how many arguments need stochastic rounding
 #define DNNL_ARG_ATTR_ROUNDING_SEED 508
@@ -2858,6 +2972,25 @@ typedef enum {
 
 /// @} dnnl_api_primitives
 
+/// @addtogroup dnnl_api_primitive_cache
+/// @{
+
+/// Primitive or kernel cache statistics.
+typedef struct {
+    /// Number of lookups that found the requested object in the cache.
+    uint64_t hits;
+    /// Number of lookups that required creation of the object.
+    uint64_t misses;
+    /// Number of entries evicted from the cache.
+    uint64_t evictions;
+    /// Number of entries currently held in the cache.
+    int size;
+    /// Cumulative time in milliseconds spent creating objects on misses.
+    double creation_time_ms;
+} dnnl_cache_stats_t;
+
+/// @} dnnl_api_primitive_cache
+
 /// @addtogroup dnnl_api_service
 /// @{
 
@@ -55,6 +55,9 @@ dnnl_status_t DNNL_API dnnl_ukernel_attr_params_set_post_ops_args(
 
 /// Sets tensor A scales argument to a storage.
 ///
+/// If `dnnl_brgemm_set_A_scales` used mask of 1, then at least M values of
+/// f32 data type are expected.
+///
 /// @param attr_params Memory pointers storage object.
 /// @param a_scales Pointer to the scales storage.
 /// @returns #dnnl_success on success and a status describing the error
@@ -150,7 +153,7 @@ dnnl_status_t DNNL_API dnnl_brgemm_set_post_ops(dnnl_brgemm_t brgemm,
 /// is ready.
 ///
 /// @param brgemm BRGeMM ukernel object.
-/// @param a_scale_mask Tensor A scale mask. Can be `0` only.
+/// @param a_scale_mask Tensor A scale mask. Can be `0` and `1` only.
 dnnl_status_t DNNL_API dnnl_brgemm_set_A_scales(
         dnnl_brgemm_t brgemm, int a_scale_mask);
 
@@ -174,6 +177,21 @@ dnnl_status_t DNNL_API dnnl_brgemm_set_B_scales(
 dnnl_status_t DNNL_API dnnl_brgemm_set_D_scales(
         dnnl_brgemm_t brgemm, int d_scale_mask);
 
+/// Sets the strides between the matrices of consecutive batches to a BRGeMM
+/// ukernel object. The matrices of batch `i` are then at `A_ptr + i * stride_A`
+/// and `B_ptr + i * stride_B`, and the kernel walks the batch without reading
+/// the offsets.
+///
+/// @param brgemm BRGeMM ukernel object.
+/// @param stride_A Stride in bytes between the tensors A of consecutive
+///     batches.
+/// @param stride_B Stride in bytes between the tensors B of consecutive
+///     batches.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brgemm_set_batch_strides(
+        dnnl_brgemm_t brgemm, dnnl_dim_t stride_A, dnnl_dim_t stride_B);
+
 /// Finalizes initialization of a BRGeMM ukernel object.
 ///
 /// This step is mandatory to query information from the object.
@@ -246,7 +264,7 @@ dnnl_status_t DNNL_API dnnl_brgemm_generate(dnnl_brgemm_t brgemm);
 ///     each batch; the set must be contiguous in memory. Single batch should
 ///     supply offsets for both tensors A and B simultaneously. The number of
 ///     batches must coincide with the `batch_size` value passed at the creation
-///     stage.
+///     stage. Ignored and can be NULL if the batch strides were set.
 /// @param C_ptr Pointer to a tensor C (accumulation buffer).
 /// @param scratchpad_ptr Pointer to a scratchpad buffer.
 /// @returns #dnnl_success on success and a status describing the error
@@ -264,7 +282,7 @@ dnnl_status_t DNNL_API dnnl_brgemm_execute(const_dnnl_brgemm_t brgemm,
 ///     each batch. A set must be contiguous in memory. A single batch should
 ///     supply offsets for both tensors A and B simultaneously. The number of
 ///     batches must coincide with the `batch_size` value passed at the creation
-///     stage.
+///     stage. Ignored and can be NULL if the batch strides were set.
 /// @param C_ptr Pointer to a tensor C (accumulation buffer).
 /// @param D_ptr Pointer to a tensor D (output buffer).
 /// @param scratchpad_ptr Pointer to a scratchpad buffer.
@@ -285,6 +303,127 @@ dnnl_status_t DNNL_API dnnl_brgemm_destroy(dnnl_brgemm_t brgemm);
 
 /// @} dnnl_api_ukernel_brgemm
 
+/// @addtogroup dnnl_api_ukernel_brdgmm
+/// @{
+
+/// Creates a BRDGMM ukernel object. Operates by the following formula:
+/// `C[m][n] = sum_i A_i[m][n] * B_i[n]`, i.e. each batch multiplies the rows
+/// of tensor A by a vector B elementwise, as a depthwise convolution does
+/// for each kernel point.
+///
+/// @param brdgmm Output BRDGMM ukernel object.
+/// @param M Dimension M of tensor A.
+/// @param N Dimension N of tensors A and B.
+/// @param batch_size Number of batches to process.
+/// @param lda Leading dimension of tensor A.
+/// @param ldc Leading dimension of tensor C.
+/// @param a_dt Data type of tensor A.
+/// @param b_dt Data type of tensor B.
+/// @param c_dt Data type of tensor C. Must be dnnl_f32, or dnnl_s32 for
+///     integer tensors A and B.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brdgmm_create(dnnl_brdgmm_t *brdgmm,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t batch_size, dnnl_dim_t lda,
+        dnnl_dim_t ldc, dnnl_data_type_t a_dt, dnnl_data_type_t b_dt,
+        dnnl_data_type_t c_dt);
+
+/// Sets post-operations to a BRDGMM ukernel object: `D = post-operations(C)`.
+/// The result is written to tensor D, and tensor C is not materialized.
+///
+/// @param brdgmm BRDGMM ukernel object.
+/// @param ldd Leading dimension of tensor D.
+/// @param d_dt Data type of tensor D.
+/// @param post_ops Primitive post operations attribute to extend the kernel
+///     operations.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brdgmm_set_post_ops(dnnl_brdgmm_t brdgmm,
+        dnnl_dim_t ldd, dnnl_data_type_t d_dt, const_dnnl_post_ops_t post_ops);
+
+/// Sets tensor A scales mask to a BRDGMM ukernel object.
+///
+/// @param brdgmm BRDGMM ukernel object.
+/// @param a_scale_mask Tensor A scale mask. Can be `0` only.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brdgmm_set_A_scales(
+        dnnl_brdgmm_t brdgmm, int a_scale_mask);
+
+/// Sets tensor B scales mask to a BRDGMM ukernel object.
+///
+/// @param brdgmm BRDGMM ukernel object.
+/// @param b_scale_mask Tensor B scale mask. Can be `0` and `2` only.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brdgmm_set_B_scales(
+        dnnl_brdgmm_t brdgmm, int b_scale_mask);
+
+/// Sets tensor D scales mask to a BRDGMM ukernel object.
+///
+/// @param brdgmm BRDGMM ukernel object.
+/// @param d_scale_mask Tensor D scale mask. Can be `0` only.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brdgmm_set_D_scales(
+        dnnl_brdgmm_t brdgmm, int d_scale_mask);
+
+/// Sets the strides between the tensors of consecutive batches to a BRDGMM
+/// ukernel object. The tensors of batch `i` are then at `A_ptr + i * stride_A`
+/// and `B_ptr + i * stride_B`, and the kernel walks the batch without reading
+/// the offsets.
+///
+/// @param brdgmm BRDGMM ukernel object.
+/// @param stride_A Stride in bytes between the tensors A of consecutive
+///     batches.
+/// @param stride_B Stride in bytes between the tensors B of consecutive
+///     batches.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brdgmm_set_batch_strides(
+        dnnl_brdgmm_t brdgmm, dnnl_dim_t stride_A, dnnl_dim_t stride_B);
+
+/// Finalizes initialization of a BRDGMM ukernel object.
+///
+/// @param brdgmm BRDGMM ukernel object.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brdgmm_finalize(dnnl_brdgmm_t brdgmm);
+
+/// Generates an executable part of BRDGMM ukernel object.
+///
+/// @param brdgmm BRDGMM ukernel object.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brdgmm_generate(dnnl_brdgmm_t brdgmm);
+
+/// Executes a BRDGMM ukernel object.
+///
+/// @param brdgmm BRDGMM ukernel object.
+/// @param A_ptr Base pointer to a tensor A.
+/// @param B_ptr Base pointer to a tensor B.
+/// @param A_B_offsets Pointer to the set of tensor A and tensor B offsets in
+///     bytes for each batch; the set must be contiguous in memory. Ignored and
+///     can be NULL if the batch strides were set.
+/// @param D_ptr Pointer to the output tensor. It is tensor C if no
+///     post-operations apply, and tensor D otherwise.
+/// @param attr_params Ukernel attributes memory storage. Can be NULL if no
+///     binary post-operations or scales were set.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brdgmm_execute(const_dnnl_brdgmm_t brdgmm,
+        const void *A_ptr, const void *B_ptr, const dnnl_dim_t *A_B_offsets,
+        void *D_ptr, const_dnnl_ukernel_attr_params_t attr_params);
+
+/// Destroys a BRDGMM ukernel object.
+///
+/// @param brdgmm BRDGMM ukernel object to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brdgmm_destroy(dnnl_brdgmm_t brdgmm);
+
+/// @} dnnl_api_ukernel_brdgmm
+
 /// @addtogroup dnnl_api_ukernel_transform
 /// @{
 
@@ -307,6 +446,33 @@ dnnl_status_t DNNL_API dnnl_transform_create(dnnl_transform_t *transform,
         dnnl_dim_t in_ld, dnnl_dim_t out_ld, dnnl_data_type_t in_dt,
         dnnl_data_type_t out_dt);
 
+/// Sets scales applied to the weights during decompression. The transform
+/// must be created with an integer input data type and a floating-point output
+/// data type, and must not be generated yet.
+///
+/// @param transform Transform object.
+/// @param k_group_size Number of consecutive elements along K dimension that
+///     share a scale. Must divide K. Scales are dense with
+///     `K / k_group_size` rows of N elements each.
+/// @param scales_dt Scales data type. Must be one of `dnnl_f32`, `dnnl_bf16`,
+///     or `dnnl_f16`.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_transform_set_scales(dnnl_transform_t transform,
+        dnnl_dim_t k_group_size, dnnl_data_type_t scales_dt);
+
+/// Sets zero points subtracted from the weights during decompression. The
+/// transform must be created with an integer input data type and a
+/// floating-point output data type, and must not be generated yet.
+///
+/// @param transform Transform object.
+/// @param mask Zero points mask. Only a common zero point of `dnnl_s32` data
+///     type is supported, `mask` must be `0`.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_transform_set_zero_points(
+        dnnl_transform_t transform, int mask);
+
 /// Generates an executable part of transform object.
 /// @param transform Transform object.
 /// @returns #dnnl_success on success and a status describing the error
@@ -323,6 +489,20 @@ dnnl_status_t DNNL_API dnnl_transform_generate(dnnl_transform_t transform);
 dnnl_status_t DNNL_API dnnl_transform_execute(
         const_dnnl_transform_t transform, const void *in_ptr, void *out_ptr);
 
+/// Executes a transform object that decompresses weights.
+///
+/// @param transform Transform object.
+/// @param in_ptr Pointer to an input buffer.
+/// @param out_ptr Pointer to an output buffer.
+/// @param scales_ptr Pointer to a scales buffer. Required if scales were set.
+/// @param zero_points_ptr Pointer to a zero points buffer. Required if zero
+///     points were set.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_transform_execute_decompress(
+        const_dnnl_transform_t transform, const void *in_ptr, void *out_ptr,
+        const void *scales_ptr, const void *zero_points_ptr);
+
 /// Destroys a transform object.
 ///
 /// @param transform Transform object.
@@ -332,6 +512,184 @@ dnnl_status_t DNNL_API dnnl_transform_destroy(dnnl_transform_t transform);
 
 /// @} dnnl_api_ukernel_transform
 
+/// @addtogroup dnnl_api_ukernel_softmax
+/// @{
+
+/// Creates a softmax ukernel object. Computes a softmax of each row of an
+/// M x N tensor of dnnl_f32 data type:
+/// `dst[m][n] = exp(src[m][n] - max_m) / sum_n exp(src[m][n] - max_m)`.
+///
+/// @param softmax Output softmax ukernel object.
+/// @param M Number of rows.
+/// @param N Number of elements in a row.
+/// @param ld_src Leading dimension of the source tensor.
+/// @param ld_dst Leading dimension of the destination tensor.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_softmax_create(
+        dnnl_ukernel_softmax_t *softmax, dnnl_dim_t M, dnnl_dim_t N,
+        dnnl_dim_t ld_src, dnnl_dim_t ld_dst);
+
+/// Sets the online flavor to a softmax ukernel object.
+///
+/// The online flavor processes a row split into several chunks, one chunk
+/// per call, and keeps the running maximum and sum of each row in the
+/// buffers passed by the user. For each row of a chunk it computes:
+/// - `new_max = max(running_max, max_n src[n])`,
+/// - `correction = exp(running_max - new_max)`,
+/// - `dst[n] = exp(src[n] - new_max)`,
+/// - `running_sum = running_sum * correction + sum_n dst[n]`,
+/// - `running_max = new_max`.
+///
+/// The destination is not normalized, and `correction` is the factor to
+/// rescale the values accumulated with the previous chunks.
+///
+/// @param softmax Softmax ukernel object.
+/// @param online Value to indicate the online flavor. `0` for the regular
+///     softmax, and `1` for the online one.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_softmax_set_online(
+        dnnl_ukernel_softmax_t softmax, int online);
+
+/// Generates an executable part of softmax ukernel object.
+///
+/// @param softmax Softmax ukernel object.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_softmax_generate(
+        dnnl_ukernel_softmax_t softmax);
+
+/// Executes a softmax ukernel object.
+///
+/// @param softmax Softmax ukernel object.
+/// @param src_ptr Pointer to the source tensor.
+/// @param dst_ptr Pointer to the destination tensor. Can be the same as
+///     `src_ptr` when the leading dimensions coincide.
+/// @param running_max Pointer to the M running maximum values. Must be
+///     initialized with `-FLT_MAX` before the first chunk. Ignored and can be
+///     NULL for the regular softmax.
+/// @param running_sum Pointer to the M running sum values. Must be
+///     initialized with `0` before the first chunk. Ignored and can be NULL
+///     for the regular softmax.
+/// @param correction Pointer to the M output correction factors. Ignored and
+///     can be NULL for the regular softmax.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_softmax_execute(
+        const_dnnl_ukernel_softmax_t softmax, const void *src_ptr,
+        void *dst_ptr, float *running_max, float *running_sum,
+        float *correction);
+
+/// Destroys a softmax ukernel object.
+///
+/// @param softmax Softmax ukernel object to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_softmax_destroy(
+        dnnl_ukernel_softmax_t softmax);
+
+/// @} dnnl_api_ukernel_softmax
+
+/// @addtogroup dnnl_api_ukernel_postops
+/// @{
+
+/// Creates a post-operations ukernel object. Applies post-operations and
+/// down-conversion to an M x N accumulation tensor C:
+/// `D = convert(post-operations(C))`.
+///
+/// @param postops Output post-operations ukernel object.
+/// @param M Dimension M of tensor C.
+/// @param N Dimension N of tensor C.
+/// @param ldc Leading dimension of tensor C.
+/// @param c_dt Data type of tensor C. Must be dnnl_f32 or dnnl_s32.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_postops_create(
+        dnnl_ukernel_postops_t *postops, dnnl_dim_t M, dnnl_dim_t N,
+        dnnl_dim_t ldc, dnnl_data_type_t c_dt);
+
+/// Sets post-operations to a post-operations ukernel object.
+///
+/// @param postops Post-operations ukernel object.
+/// @param ldd Leading dimension of tensor D.
+/// @param d_dt Data type of tensor D.
+/// @param post_ops Primitive post operations attribute to apply.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_postops_set_post_ops(
+        dnnl_ukernel_postops_t postops, dnnl_dim_t ldd, dnnl_data_type_t d_dt,
+        const_dnnl_post_ops_t post_ops);
+
+/// Sets tensor A scales mask to a post-operations ukernel object. The scales
+/// apply to tensor C before post-operations.
+///
+/// @param postops Post-operations ukernel object.
+/// @param a_scale_mask Tensor A scale mask. Can be `0` only.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_postops_set_A_scales(
+        dnnl_ukernel_postops_t postops, int a_scale_mask);
+
+/// Sets tensor B scales mask to a post-operations ukernel object. The scales
+/// apply to tensor C before post-operations.
+///
+/// @param postops Post-operations ukernel object.
+/// @param b_scale_mask Tensor B scale mask. Can be `0` and `2` only.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_postops_set_B_scales(
+        dnnl_ukernel_postops_t postops, int b_scale_mask);
+
+/// Sets tensor D scales mask to a post-operations ukernel object.
+///
+/// @param postops Post-operations ukernel object.
+/// @param d_scale_mask Tensor D scale mask. Can be `0` only.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_postops_set_D_scales(
+        dnnl_ukernel_postops_t postops, int d_scale_mask);
+
+/// Finalizes initialization of a post-operations ukernel object.
+///
+/// @param postops Post-operations ukernel object.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_postops_finalize(
+        dnnl_ukernel_postops_t postops);
+
+/// Generates an executable part of post-operations ukernel object.
+///
+/// @param postops Post-operations ukernel object.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_postops_generate(
+        dnnl_ukernel_postops_t postops);
+
+/// Executes a post-operations ukernel object.
+///
+/// @param postops Post-operations ukernel object.
+/// @param C_ptr Pointer to a tensor C.
+/// @param D_ptr Pointer to a tensor D. Can be the same as `C_ptr` when data
+///     types and leading dimensions of both tensors coincide.
+/// @param attr_params Ukernel attributes memory storage. Can be NULL if no
+///     binary post-operations or scales were set.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_postops_execute(
+        const_dnnl_ukernel_postops_t postops, const void *C_ptr, void *D_ptr,
+        const_dnnl_ukernel_attr_params_t attr_params);
+
+/// Destroys a post-operations ukernel object.
+///
+/// @param postops Post-operations ukernel object to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_postops_destroy(
+        dnnl_ukernel_postops_t postops);
+
+/// @} dnnl_api_ukernel_postops
+
 #endif
 
 /// @} dnnl_api_ukernel
@@ -44,6 +44,13 @@ struct handle_traits<dnnl_brgemm_t> {
     }
 };
 
+template <>
+struct handle_traits<dnnl_brdgmm_t> {
+    static dnnl_status_t destructor(dnnl_brdgmm_t p) {
+        return dnnl_brdgmm_destroy(p);
+    }
+};
+
 template <>
 struct handle_traits<dnnl_transform_t> {
     static dnnl_status_t destructor(dnnl_transform_t p) {
@@ -51,6 +58,20 @@ struct handle_traits<dnnl_transform_t> {
     }
 };
 
+template <>
+struct handle_traits<dnnl_ukernel_softmax_t> {
+    static dnnl_status_t destructor(dnnl_ukernel_softmax_t p) {
+        return dnnl_ukernel_softmax_destroy(p);
+    }
+};
+
+template <>
+struct handle_traits<dnnl_ukernel_postops_t> {
+    static dnnl_status_t destructor(dnnl_ukernel_postops_t p) {
+        return dnnl_ukernel_postops_destroy(p);
+    }
+};
+
 template <>
 struct handle_traits<dnnl_ukernel_attr_params_t> {
     static dnnl_status_t destructor(dnnl_ukernel_attr_params_t p) {
@@ -115,6 +136,9 @@ struct attr_params : public handle<dnnl_ukernel_attr_params_t> {
 
     /// Sets tensor A scales arguments to a storage.
     ///
+    /// If @ref brgemm::set_A_scales used mask of 1, then at least M values of
+    /// f32 data type are expected.
+    ///
     /// @param a_scales Pointer to scales storage.
     void set_A_scales(const void *a_scales) {
         dnnl_status_t status
@@ -227,7 +251,7 @@ struct brgemm : public handle<dnnl_brgemm_t> {
     /// For quantization flavor tensor A scales apply to accumulation buffer
     /// once C is ready.
     ///
-    /// @param a_scale_mask Tensor A scale mask. Can be `0` only.
+    /// @param a_scale_mask Tensor A scale mask. Can be `0` and `1` only.
     void set_A_scales(int a_scale_mask) {
         dnnl_status_t status = dnnl_brgemm_set_A_scales(get(), a_scale_mask);
         if (status != dnnl_success)
@@ -258,6 +282,22 @@ struct brgemm : public handle<dnnl_brgemm_t> {
             error::wrap_c_api(status, "could not set D scales");
     }
 
+    /// Sets the strides between the matrices of consecutive batches to a
+    /// BRGeMM ukernel object. The matrices of batch `i` are then at
+    /// `A + i * stride_A` and `B + i * stride_B`, and the object is executed
+    /// without the offsets.
+    ///
+    /// @param stride_A Stride in bytes between the tensors A of consecutive
+    ///     batches.
+    /// @param stride_B Stride in bytes between the tensors B of consecutive
+    ///     batches.
+    void set_batch_strides(memory::dim stride_A, memory::dim stride_B) {
+        dnnl_status_t status
+                = dnnl_brgemm_set_batch_strides(get(), stride_A, stride_B);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set batch strides");
+    }
+
     /// Finalizes initialization of a BRGeMM ukernel object.
     ///
     /// This step must be performed prior to querying information from the
@@ -382,6 +422,41 @@ struct brgemm : public handle<dnnl_brgemm_t> {
                     status, "could not execute a BRGeMM ukernel object");
     }
 
+    /// Executes a BRGeMM ukernel object with the batch strides.
+    ///
+    /// @param A Base pointer to a tensor A.
+    /// @param B Base pointer to a tensor B.
+    /// @param C Pointer to a tensor C (accumulation buffer).
+    /// @param scratchpad Pointer to a scratchpad buffer.
+    void execute(
+            const void *A, const void *B, void *C, void *scratchpad) const {
+        dnnl_status_t status
+                = dnnl_brgemm_execute(get(), A, B, nullptr, C, scratchpad);
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not execute a BRGeMM ukernel object");
+    }
+
+    /// Executes a BRGeMM ukernel object with the batch strides and post
+    /// operations.
+    ///
+    /// @param A Base pointer to a tensor A.
+    /// @param B Base pointer to a tensor B.
+    /// @param C Pointer to a tensor C (accumulation buffer).
+    /// @param D Pointer to a tensor D (output buffer).
+    /// @param scratchpad Pointer to a scratchpad buffer.
+    /// @param params Post-op memory arguments. Must be passed If binary
+    ///     post-op or scales were set.
+    void execute(const void *A, const void *B, const void *C, void *D,
+            void *scratchpad,
+            const attr_params &params = default_attr_params()) const {
+        dnnl_status_t status = dnnl_brgemm_execute_postops(
+                get(), A, B, nullptr, C, D, scratchpad, params.get());
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not execute a BRGeMM ukernel object");
+    }
+
     /// Returns a constant reference to a static instance of default constructed
     /// primitive post-operations attribute.
     static const post_ops &default_post_ops() {
@@ -398,6 +473,159 @@ struct brgemm : public handle<dnnl_brgemm_t> {
 };
 /// @} dnnl_api_ukernel_brgemm
 
+/// @addtogroup dnnl_api_ukernel_brdgmm BRDGMM ukernel
+/// BRDGMM ukernel routines
+/// @{
+
+/// BRDGMM ukernel
+struct brdgmm : public handle<dnnl_brdgmm_t> {
+    /// Default constructor. Produces an empty object.
+    brdgmm() = default;
+
+    /// Constructs a BRDGMM ukernel object. Operates by the following formula:
+    /// `C[m][n] = sum_i A_i[m][n] * B_i[n]`.
+    ///
+    /// @param M Dimension M of tensor A.
+    /// @param N Dimension N of tensors A and B.
+    /// @param batch_size Number of batches to process.
+    /// @param lda Leading dimension of tensor A.
+    /// @param ldc Leading dimension of tensor C.
+    /// @param a_dt Data type of tensor A.
+    /// @param b_dt Data type of tensor B.
+    /// @param c_dt Data type of tensor C.
+    /// @param allow_empty A flag signifying whether construction is
+    ///     allowed to fail without throwing an exception. In this case an
+    ///     empty object will be produced. This flag is optional and
+    ///     defaults to false.
+    brdgmm(memory::dim M, memory::dim N, memory::dim batch_size,
+            memory::dim lda, memory::dim ldc, memory::data_type a_dt,
+            memory::data_type b_dt, memory::data_type c_dt,
+            bool allow_empty = false) {
+
+        dnnl_brdgmm_t brdgmm = nullptr;
+        dnnl_status_t status = dnnl_brdgmm_create(&brdgmm, M, N, batch_size,
+                lda, ldc, memory::convert_to_c(a_dt),
+                memory::convert_to_c(b_dt), memory::convert_to_c(c_dt));
+
+        if (!allow_empty)
+            error::wrap_c_api(
+                    status, "could not create a BRDGMM ukernel object");
+        reset(brdgmm);
+    }
+
+    /// Sets post-operations to a BRDGMM ukernel object:
+    /// `D = post-operations(C)`.
+    ///
+    /// @param ldd Leading dimension of tensor D.
+    /// @param d_dt Data type of tensor D.
+    /// @param po Primitive post-operation attributes to extend the kernel
+    ///     operations.
+    void set_post_ops(memory::dim ldd, memory::data_type d_dt,
+            const post_ops &po = brgemm::default_post_ops()) {
+        dnnl_status_t status = dnnl_brdgmm_set_post_ops(
+                get(), ldd, memory::convert_to_c(d_dt), po.get());
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set post operations");
+    }
+
+    /// Sets tensor A scales mask to a BRDGMM ukernel object.
+    ///
+    /// @param a_scale_mask Tensor A scale mask. Can be `0` only.
+    void set_A_scales(int a_scale_mask) {
+        dnnl_status_t status = dnnl_brdgmm_set_A_scales(get(), a_scale_mask);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set A scales");
+    }
+
+    /// Sets tensor B scales mask to a BRDGMM ukernel object.
+    ///
+    /// @param b_scale_mask Tensor B scale mask. Can be `0` and `2` only.
+    void set_B_scales(int b_scale_mask) {
+        dnnl_status_t status = dnnl_brdgmm_set_B_scales(get(), b_scale_mask);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set B scales");
+    }
+
+    /// Sets tensor D scales mask to a BRDGMM ukernel object.
+    ///
+    /// @param d_scale_mask Tensor D scale mask. Can be `0` only.
+    void set_D_scales(int d_scale_mask) {
+        dnnl_status_t status = dnnl_brdgmm_set_D_scales(get(), d_scale_mask);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set D scales");
+    }
+
+    /// Sets the strides between the tensors of consecutive batches to a
+    /// BRDGMM ukernel object, and the object is executed without the offsets.
+    ///
+    /// @param stride_A Stride in bytes between the tensors A of consecutive
+    ///     batches.
+    /// @param stride_B Stride in bytes between the tensors B of consecutive
+    ///     batches.
+    void set_batch_strides(memory::dim stride_A, memory::dim stride_B) {
+        dnnl_status_t status
+                = dnnl_brdgmm_set_batch_strides(get(), stride_A, stride_B);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set batch strides");
+    }
+
+    /// Finalizes initialization of a BRDGMM ukernel object.
+    ///
+    /// Returns `true` if the call successfully completed, and `false`,
+    /// otherwise.
+    bool finalize() {
+        dnnl_status_t status = dnnl_brdgmm_finalize(get());
+        return status == dnnl_success;
+    }
+
+    /// Generates an executable part of BRDGMM ukernel object.
+    void generate() {
+        dnnl_status_t status = dnnl_brdgmm_generate(get());
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not generate a kernel");
+    }
+
+    /// Executes a BRDGMM ukernel object.
+    ///
+    /// @param A Base pointer to a tensor A.
+    /// @param B Base pointer to a tensor B.
+    /// @param A_B_offsets Vector of pairs of tensors A and B offsets for
+    ///     each batch. The number of batches must coincide with the
+    ///     `batch_size` value passed at object construction stage.
+    /// @param D Pointer to the output tensor: C without post operations, and
+    ///     D otherwise.
+    /// @param params Post-op memory arguments. Must be passed If binary
+    ///     post-op or scales were set.
+    void execute(const void *A, const void *B,
+            const std::vector<std::pair<memory::dim, memory::dim>> &A_B_offsets,
+            void *D,
+            const attr_params &params = brgemm::default_attr_params()) const {
+        dnnl_status_t status = dnnl_brdgmm_execute(get(), A, B,
+                (const dnnl_dim_t *)A_B_offsets.data(), D, params.get());
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not execute a BRDGMM ukernel object");
+    }
+
+    /// Executes a BRDGMM ukernel object with the batch strides.
+    ///
+    /// @param A Base pointer to a tensor A.
+    /// @param B Base pointer to a tensor B.
+    /// @param D Pointer to the output tensor: C without post operations, and
+    ///     D otherwise.
+    /// @param params Post-op memory arguments. Must be passed If binary
+    ///     post-op or scales were set.
+    void execute(const void *A, const void *B, void *D,
+            const attr_params &params = brgemm::default_attr_params()) const {
+        dnnl_status_t status
+                = dnnl_brdgmm_execute(get(), A, B, nullptr, D, params.get());
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not execute a BRDGMM ukernel object");
+    }
+};
+/// @} dnnl_api_ukernel_brdgmm
+
 /// @addtogroup dnnl_api_ukernel_transform Transform ukernel
 /// Transform routines
 /// @{
@@ -437,6 +665,29 @@ struct transform : public handle<dnnl_transform_t> {
         reset(transform);
     }
 
+    /// Sets scales applied to the weights during decompression. Must be
+    /// called before generate().
+    ///
+    /// @param k_group_size Number of consecutive elements along K dimension
+    ///     that share a scale. Must divide K.
+    /// @param scales_dt Scales data type.
+    void set_scales(memory::dim k_group_size, memory::data_type scales_dt) {
+        dnnl_status_t status = dnnl_transform_set_scales(
+                get(), k_group_size, memory::convert_to_c(scales_dt));
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set scales");
+    }
+
+    /// Sets zero points subtracted from the weights during decompression.
+    /// Must be called before generate().
+    ///
+    /// @param mask Zero points mask. Only `0` is supported.
+    void set_zero_points(int mask) {
+        dnnl_status_t status = dnnl_transform_set_zero_points(get(), mask);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set zero points");
+    }
+
     /// Generates an executable part of transform object.
     void generate() {
         dnnl_status_t status = dnnl_transform_generate(get());
@@ -455,10 +706,217 @@ struct transform : public handle<dnnl_transform_t> {
             error::wrap_c_api(status,
                     "could not execute a BRGeMM ukernel packing B object");
     }
+
+    /// Executes a transform object that decompresses weights.
+    ///
+    /// @param in Pointer to an input buffer.
+    /// @param out Pointer to an output buffer.
+    /// @param scales Pointer to a scales buffer.
+    /// @param zero_points Pointer to a zero points buffer.
+    void execute(const void *in, void *out, const void *scales,
+            const void *zero_points) const {
+        dnnl_status_t status = dnnl_transform_execute_decompress(
+                get(), in, out, scales, zero_points);
+        if (status != dnnl_success)
+            error::wrap_c_api(status,
+                    "could not execute a BRGeMM ukernel packing B object");
+    }
 };
 
 /// @} dnnl_api_ukernel_transform
 
+/// @addtogroup dnnl_api_ukernel_softmax Softmax ukernel
+/// Softmax ukernel routines
+/// @{
+
+/// Softmax ukernel
+struct softmax : public handle<dnnl_ukernel_softmax_t> {
+    /// Default constructor. Produces an empty object.
+    softmax() = default;
+
+    /// Constructs a softmax ukernel object. Computes a softmax of each row of
+    /// an M x N tensor of f32 data type.
+    ///
+    /// @param M Number of rows.
+    /// @param N Number of elements in a row.
+    /// @param ld_src Leading dimension of the source tensor.
+    /// @param ld_dst Leading dimension of the destination tensor.
+    /// @param allow_empty A flag signifying whether construction is
+    ///     allowed to fail without throwing an exception. In this case an
+    ///     empty object will be produced. This flag is optional and
+    ///     defaults to false.
+    softmax(memory::dim M, memory::dim N, memory::dim ld_src,
+            memory::dim ld_dst, bool allow_empty = false) {
+        dnnl_ukernel_softmax_t softmax = nullptr;
+        dnnl_status_t status
+                = dnnl_ukernel_softmax_create(&softmax, M, N, ld_src, ld_dst);
+
+        if (!allow_empty)
+            error::wrap_c_api(
+                    status, "could not create a softmax ukernel object");
+        reset(softmax);
+    }
+
+    /// Sets the online flavor to a softmax ukernel object. The online flavor
+    /// processes a row chunk by chunk, and updates the running maximum and
+    /// sum of each row. The destination is not normalized.
+    ///
+    /// @param online Value to indicate the online flavor.
+    void set_online(bool online) {
+        dnnl_status_t status = dnnl_ukernel_softmax_set_online(
+                get(), static_cast<int>(online));
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set online flavor");
+    }
+
+    /// Generates an executable part of softmax ukernel object.
+    void generate() {
+        dnnl_status_t status = dnnl_ukernel_softmax_generate(get());
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not generate a kernel");
+    }
+
+    /// Executes a regular softmax ukernel object.
+    ///
+    /// @param src Pointer to the source tensor.
+    /// @param dst Pointer to the destination tensor.
+    void execute(const void *src, void *dst) const {
+        dnnl_status_t status = dnnl_ukernel_softmax_execute(
+                get(), src, dst, nullptr, nullptr, nullptr);
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not execute a softmax ukernel object");
+    }
+
+    /// Executes an online softmax ukernel object.
+    ///
+    /// @param src Pointer to the source tensor chunk.
+    /// @param dst Pointer to the destination tensor chunk.
+    /// @param running_max Pointer to the M running maximum values.
+    /// @param running_sum Pointer to the M running sum values.
+    /// @param correction Pointer to the M output factors to rescale the
+    ///     values accumulated with the previous chunks.
+    void execute(const void *src, void *dst, float *running_max,
+            float *running_sum, float *correction) const {
+        dnnl_status_t status = dnnl_ukernel_softmax_execute(
+                get(), src, dst, running_max, running_sum, correction);
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not execute a softmax ukernel object");
+    }
+};
+
+/// @} dnnl_api_ukernel_softmax
+
+/// @addtogroup dnnl_api_ukernel_postops Post-operations ukernel
+/// Post-operations ukernel routines
+/// @{
+
+/// Post-operations ukernel
+struct postops : public handle<dnnl_ukernel_postops_t> {
+    /// Default constructor. Produces an empty object.
+    postops() = default;
+
+    /// Constructs a post-operations ukernel object. Operates by the following
+    /// formula: `D = convert(post-operations(C))`.
+    ///
+    /// @param M Dimension M of tensor C.
+    /// @param N Dimension N of tensor C.
+    /// @param ldc Leading dimension of tensor C.
+    /// @param c_dt Data type of tensor C.
+    /// @param allow_empty A flag signifying whether construction is
+    ///     allowed to fail without throwing an exception. In this case an
+    ///     empty object will be produced. This flag is optional and
+    ///     defaults to false.
+    postops(memory::dim M, memory::dim N, memory::dim ldc,
+            memory::data_type c_dt, bool allow_empty = false) {
+        dnnl_ukernel_postops_t postops = nullptr;
+        dnnl_status_t status = dnnl_ukernel_postops_create(
+                &postops, M, N, ldc, memory::convert_to_c(c_dt));
+
+        if (!allow_empty)
+            error::wrap_c_api(status,
+                    "could not create a post-operations ukernel object");
+        reset(postops);
+    }
+
+    /// Sets post-operations to a post-operations ukernel object.
+    ///
+    /// @param ldd Leading dimension of tensor D.
+    /// @param d_dt Data type of tensor D.
+    /// @param po Primitive post-operation attributes to apply.
+    void set_post_ops(memory::dim ldd, memory::data_type d_dt,
+            const post_ops &po = brgemm::default_post_ops()) {
+        dnnl_status_t status = dnnl_ukernel_postops_set_post_ops(
+                get(), ldd, memory::convert_to_c(d_dt), po.get());
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set post operations");
+    }
+
+    /// Sets tensor A scales mask to a post-operations ukernel object.
+    ///
+    /// @param a_scale_mask Tensor A scale mask. Can be `0` only.
+    void set_A_scales(int a_scale_mask) {
+        dnnl_status_t status
+                = dnnl_ukernel_postops_set_A_scales(get(), a_scale_mask);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set A scales");
+    }
+
+    /// Sets tensor B scales mask to a post-operations ukernel object.
+    ///
+    /// @param b_scale_mask Tensor B scale mask. Can be `0` and `2` only.
+    void set_B_scales(int b_scale_mask) {
+        dnnl_status_t status
+                = dnnl_ukernel_postops_set_B_scales(get(), b_scale_mask);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set B scales");
+    }
+
+    /// Sets tensor D scales mask to a post-operations ukernel object.
+    ///
+    /// @param d_scale_mask Tensor D scale mask. Can be `0` only.
+    void set_D_scales(int d_scale_mask) {
+        dnnl_status_t status
+                = dnnl_ukernel_postops_set_D_scales(get(), d_scale_mask);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set D scales");
+    }
+
+    /// Finalizes initialization of a post-operations ukernel object.
+    ///
+    /// Returns `true` if the call successfully completed, and `false`,
+    /// otherwise.
+    bool finalize() {
+        dnnl_status_t status = dnnl_ukernel_postops_finalize(get());
+        return status == dnnl_success;
+    }
+
+    /// Generates an executable part of post-operations ukernel object.
+    void generate() {
+        dnnl_status_t status = dnnl_ukernel_postops_generate(get());
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not generate a kernel");
+    }
+
+    /// Executes a post-operations ukernel object.
+    ///
+    /// @param C Pointer to a tensor C.
+    /// @param D Pointer to a tensor D.
+    /// @param params Post-op memory arguments. Must be passed If binary
+    ///     post-op or scales were set.
+    void execute(const void *C, void *D,
+            const attr_params &params = brgemm::default_attr_params()) const {
+        dnnl_status_t status
+                = dnnl_ukernel_postops_execute(get(), C, D, params.get());
+        if (status != dnnl_success)
+            error::wrap_c_api(status,
+                    "could not execute a post-operations ukernel object");
+    }
+};
+
+/// @} dnnl_api_ukernel_postops
+
 #endif
 
 } // namespace ukernel
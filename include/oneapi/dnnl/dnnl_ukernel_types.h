@@ -71,6 +71,21 @@ typedef const struct dnnl_brgemm *const_dnnl_brgemm_t;
 
 /// @} dnnl_api_ukernel_brgemm
 
+/// @addtogroup dnnl_api_ukernel_brdgmm
+/// @{
+
+/// @struct dnnl_brdgmm
+/// An opaque structure to describe a brdgmm ukernel.
+struct dnnl_brdgmm;
+
+/// A brdgmm ukernel handle.
+typedef struct dnnl_brdgmm *dnnl_brdgmm_t;
+
+/// A constant brdgmm ukernel handle.
+typedef const struct dnnl_brdgmm *const_dnnl_brdgmm_t;
+
+/// @} dnnl_api_ukernel_brdgmm
+
 /// @addtogroup dnnl_api_ukernel_transform
 /// @{
 
@@ -85,6 +100,36 @@ typedef struct dnnl_transform *dnnl_transform_t;
 typedef const struct dnnl_transform *const_dnnl_transform_t;
 
 /// @} dnnl_api_ukernel_transform
+
+/// @addtogroup dnnl_api_ukernel_softmax
+/// @{
+
+/// @struct dnnl_ukernel_softmax
+/// An opaque structure to describe a softmax ukernel.
+struct dnnl_ukernel_softmax;
+
+/// A softmax ukernel handle.
+typedef struct dnnl_ukernel_softmax *dnnl_ukernel_softmax_t;
+
+/// A constant softmax ukernel handle.
+typedef const struct dnnl_ukernel_softmax *const_dnnl_ukernel_softmax_t;
+
+/// @} dnnl_api_ukernel_softmax
+
+/// @addtogroup dnnl_api_ukernel_postops
+/// @{
+
+/// @struct dnnl_ukernel_postops
+/// An opaque structure to describe a post-operations ukernel.
+struct dnnl_ukernel_postops;
+
+/// A post-operations ukernel handle.
+typedef struct dnnl_ukernel_postops *dnnl_ukernel_postops_t;
+
+/// A constant post-operations ukernel handle.
+typedef const struct dnnl_ukernel_postops *const_dnnl_ukernel_postops_t;
+
+/// @} dnnl_api_ukernel_postops
 #endif
 
 /// @} dnnl_api_ukernel
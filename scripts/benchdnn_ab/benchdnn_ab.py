@@ -0,0 +1,225 @@
+#! /bin/python3
+################################################################################
+# Copyright 2025 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import math
+import re
+import shlex
+import subprocess
+import sys
+
+# Two-sided 95% critical values of Student's t-distribution by the degrees of
+# freedom, the normal one is used past the table.
+T_CRITICAL_95 = {
+    1: 12.706,
+    2: 4.303,
+    3: 3.182,
+    4: 2.776,
+    5: 2.571,
+    6: 2.447,
+    7: 2.365,
+    8: 2.306,
+    9: 2.262,
+    10: 2.228,
+    12: 2.179,
+    15: 2.131,
+    20: 2.086,
+    30: 2.042,
+}
+
+METRIC_TEMPLATES = {
+    "min": "%-time%",
+    "avg": "%0time%",
+    "p50": "%p50time%",
+}
+
+PERF_PREFIX = "benchdnn_ab"
+
+
+def log(output):
+    print("benchdnn_ab: " + output, file=sys.stderr)
+
+
+def error(output):
+    print("benchdnn_ab: error: " + output, file=sys.stderr)
+    exit(1)
+
+
+def t_critical(dof):
+    if dof in T_CRITICAL_95:
+        return T_CRITICAL_95[dof]
+    smaller = [d for d in T_CRITICAL_95 if d < dof]
+    if dof > max(T_CRITICAL_95):
+        return 1.96
+    # The value of the closest smaller entry is conservative.
+    return T_CRITICAL_95[max(smaller)]
+
+
+def list_problems(benchdnn, benchdnn_args):
+    """Returns the reproducers of the problems benchdnn runs for the args."""
+    cmd = [benchdnn, "--mode=L"] + benchdnn_args
+    log(f"listing problems: {' '.join(cmd)}")
+    out = subprocess.run(cmd, capture_output=True, text=True)
+    if out.returncode != 0:
+        error(f"listing failed with return code {out.returncode}")
+    problems = []
+    for line in out.stdout.splitlines():
+        if ":LISTED" not in line or "__REPRO: " not in line:
+            continue
+        problems.append(line.split("__REPRO: ", 1)[1].strip())
+    return problems
+
+
+def make_perf_cmd(benchdnn, repro, metric, extra_args):
+    args = [a for a in shlex.split(repro) if not a.startswith("--mode=")]
+    # The template is a driver option and goes right before the problem.
+    template = f"--perf-template={PERF_PREFIX},{METRIC_TEMPLATES[metric]}"
+    return (
+        [benchdnn, "--mode=P"] + extra_args + args[:-1] + [template, args[-1]]
+    )
+
+
+def run_perf(cmd):
+    """Returns the time of a performance run in milliseconds, or None."""
+    out = subprocess.run(cmd, capture_output=True, text=True)
+    if out.returncode != 0:
+        return None
+    for line in out.stdout.splitlines():
+        m = re.match(rf"^{PERF_PREFIX},([0-9.eE+-]+)$", line.strip())
+        if m:
+            return float(m.group(1))
+    return None
+
+
+def compare(a_times, b_times):
+    """Returns the speedup of B over A, the geometric mean of the ratios of the
+    paired runs, and its 95% confidence interval."""
+    logs = [math.log(a / b) for a, b in zip(a_times, b_times) if a * b > 0]
+    n = len(logs)
+    if n == 0:
+        return None
+    mean = sum(logs) / n
+    if n == 1:
+        return math.exp(mean), float("nan"), float("nan")
+    var = sum((x - mean) ** 2 for x in logs) / (n - 1)
+    half = t_critical(n - 1) * math.sqrt(var / n)
+    return math.exp(mean), math.exp(mean - half), math.exp(mean + half)
+
+
+def verdict(speedup, ci_low, ci_high, threshold):
+    if math.isnan(ci_low):
+        return "unknown"
+    if ci_low > 1 + threshold:
+        return "faster"
+    if ci_high < 1 - threshold:
+        return "slower"
+    return "same"
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compares the performance of two benchdnn builds on the "
+        "same problems, interleaving their runs to cancel machine drift.",
+        epilog="Arguments after `--` are passed to benchdnn to select the "
+        "problems, e.g. `-- --matmul --batch=shapes_transformer`.",
+    )
+    parser.add_argument("benchdnn_a", help="path to the baseline benchdnn")
+    parser.add_argument("benchdnn_b", help="path to the benchdnn to compare")
+    parser.add_argument(
+        "-r",
+        "--rounds",
+        type=int,
+        default=5,
+        help="number of runs of each build per problem (default: 5)",
+    )
+    parser.add_argument(
+        "-m",
+        "--metric",
+        default="min",
+        choices=sorted(METRIC_TEMPLATES),
+        help="time of a run to compare (default: min)",
+    )
+    parser.add_argument(
+        "--max-ms-per-prb",
+        type=int,
+        default=1000,
+        help="benchdnn time limit of a run (default: 1000)",
+    )
+    parser.add_argument(
+        "-t",
+        "--threshold",
+        type=float,
+        default=0.01,
+        help="relative change below which the builds are reported as the "
+        "same even if significant (default: 0.01)",
+    )
+    parser.add_argument(
+        "-o", "--output", default=None, help="CSV file to write results to"
+    )
+    parser.add_argument("benchdnn_args", nargs=argparse.REMAINDER)
+    args = parser.parse_args()
+
+    benchdnn_args = args.benchdnn_args
+    if benchdnn_args and benchdnn_args[0] == "--":
+        benchdnn_args = benchdnn_args[1:]
+    if not benchdnn_args:
+        error("no benchdnn arguments to select the problems")
+    if args.rounds < 2:
+        error("at least 2 rounds are required for a confidence interval")
+
+    problems = list_problems(args.benchdnn_a, benchdnn_args)
+    if not problems:
+        error("no problems to compare")
+    log(f"comparing {len(problems)} problems in {args.rounds} rounds")
+
+    output = open(args.output, "w+t") if args.output else sys.stdout
+    output.write("prb,a_ms,b_ms,speedup,ci_low,ci_high,verdict\n")
+    extra_args = [f"--max-ms-per-prb={args.max_ms_per_prb}"]
+    for idx, repro in enumerate(problems):
+        cmds = {
+            b: make_perf_cmd(path, repro, args.metric, extra_args)
+            for b, path in (("a", args.benchdnn_a), ("b", args.benchdnn_b))
+        }
+        times = {"a": [], "b": []}
+        for r in range(args.rounds):
+            # The ABBA order cancels a linear drift within a pair of rounds.
+            order = ("a", "b") if r % 2 == 0 else ("b", "a")
+            pair = {b: run_perf(cmds[b]) for b in order}
+            if pair["a"] is None or pair["b"] is None:
+                continue
+            for b in order:
+                times[b].append(pair[b])
+
+        prb = repro.rsplit(" ", 1)[-1].replace('"', '""')
+        result = compare(times["a"], times["b"])
+        if result is None:
+            log(f"problem {idx}: no successful runs: {repro}")
+            output.write(f'"{prb}",,,,,,failed\n')
+            continue
+        speedup, ci_low, ci_high = result
+        a_ms = sorted(times["a"])[len(times["a"]) // 2]
+        b_ms = sorted(times["b"])[len(times["b"]) // 2]
+        v = verdict(speedup, ci_low, ci_high, args.threshold)
+        output.write(
+            f'"{prb}",{a_ms:g},{b_ms:g},{speedup:.4f},{ci_low:.4f},'
+            f"{ci_high:.4f},{v}\n"
+        )
+        output.flush()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,192 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if DNNL_X64
+#include <immintrin.h>
+#endif
+
+#include "common/builtin_threadpool.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+// The number of checks of the epoch by an idle worker before it parks, a
+// fraction of a millisecond.
+constexpr int spin_count = 1 << 14;
+
+// The pool running a region on the current thread, if any.
+thread_local const builtin_threadpool_t *current_pool = nullptr;
+
+inline void cpu_relax() {
+#if DNNL_X64
+    _mm_pause();
+#endif
+}
+
+void pin_thread(std::thread &thread, int ithr) {
+#if defined(__linux__)
+    // The threads are bound to the allowed CPUs in order, so that the pool
+    // respects the affinity mask of the process.
+    cpu_set_t allowed;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return;
+    const int ncpus = CPU_COUNT(&allowed);
+    if (ncpus == 0) return;
+    int target = ithr % ncpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (!CPU_ISSET(cpu, &allowed) || target-- > 0) continue;
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        CPU_SET(cpu, &mask);
+        pthread_setaffinity_np(thread.native_handle(), sizeof(mask), &mask);
+        return;
+    }
+#else
+    UNUSED(thread);
+    UNUSED(ithr);
+#endif
+}
+
+} // namespace
+
+builtin_threadpool_t::builtin_threadpool_t(int num_threads, bool pin_threads)
+    : num_threads_(num_threads), pin_threads_(pin_threads) {
+    if (num_threads_ <= 0)
+        num_threads_ = nstl::max(1, (int)std::thread::hardware_concurrency());
+    workers_.reserve(num_threads_ - 1);
+    for (int ithr = 1; ithr < num_threads_; ithr++) {
+        workers_.emplace_back(&builtin_threadpool_t::worker_loop, this);
+        if (pin_threads_) pin_thread(workers_.back(), ithr);
+    }
+}
+
+builtin_threadpool_t::~builtin_threadpool_t() {
+    {
+        std::lock_guard<std::mutex> l(submit_mutex_);
+        stop_.store(true);
+        work_.store(make_work(epoch_of(work_.load()) + 1));
+    }
+    {
+        std::lock_guard<std::mutex> l(park_mutex_);
+        park_cv_.notify_all();
+    }
+    for (auto &w : workers_)
+        w.join();
+}
+
+bool builtin_threadpool_t::get_in_parallel() const {
+    return current_pool == this;
+}
+
+void builtin_threadpool_t::parallel_for(
+        int n, const std::function<void(int, int)> &fn) {
+    if (n <= 0) return;
+    if (n == 1 || num_threads_ == 1 || get_in_parallel()) {
+        const auto *prev = current_pool;
+        current_pool = this;
+        for (int i = 0; i < n; i++)
+            fn(i, n);
+        current_pool = prev;
+        return;
+    }
+
+    std::lock_guard<std::mutex> l(submit_mutex_);
+    const uint64_t epoch = epoch_of(work_.load(std::memory_order_relaxed)) + 1;
+    fn_.store(&fn, std::memory_order_relaxed);
+    n_.store(n, std::memory_order_relaxed);
+    done_.store(0, std::memory_order_relaxed);
+    // The sequentially consistent store and load pair with the ones of a
+    // parking worker: either the worker sees the new epoch, or the region
+    // sees the worker parked and wakes it up.
+    work_.store(make_work(epoch));
+    if (nparked_.load() > 0) {
+        std::lock_guard<std::mutex> pl(park_mutex_);
+        park_cv_.notify_all();
+    }
+
+    const auto *prev = current_pool;
+    current_pool = this;
+    run_region(epoch);
+    current_pool = prev;
+
+    // The iterations claimed by the workers may still be running.
+    for (int i = 0; done_.load(std::memory_order_acquire) < n; i++) {
+        if (i < spin_count)
+            cpu_relax();
+        else
+            std::this_thread::yield();
+    }
+}
+
+void builtin_threadpool_t::run_region(uint64_t epoch) {
+    uint64_t work = work_.load(std::memory_order_acquire);
+    while (epoch_of(work) == epoch) {
+        const int n = n_.load(std::memory_order_relaxed);
+        const int i = (int)(work & 0xffffffffu);
+        if (i >= n) break;
+        // A failed exchange reloads the counter, which may belong to the
+        // next region by then.
+        if (!work_.compare_exchange_weak(work, work + 1,
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+            continue;
+        (*fn_.load(std::memory_order_relaxed))(i, n);
+        done_.fetch_add(1, std::memory_order_release);
+        work = work_.load(std::memory_order_acquire);
+    }
+}
+
+uint64_t builtin_threadpool_t::wait_region(uint64_t last_epoch) {
+    for (int i = 0; i < spin_count; i++) {
+        const uint64_t epoch = epoch_of(work_.load(std::memory_order_acquire));
+        if (epoch != last_epoch) return epoch;
+        cpu_relax();
+    }
+
+    std::unique_lock<std::mutex> l(park_mutex_);
+    nparked_.fetch_add(1);
+    uint64_t epoch = last_epoch;
+    park_cv_.wait(l, [&] {
+        epoch = epoch_of(work_.load());
+        return epoch != last_epoch;
+    });
+    nparked_.fetch_sub(1);
+    return epoch;
+}
+
+void builtin_threadpool_t::worker_loop() {
+    current_pool = this;
+    uint64_t epoch = 0;
+    for (;;) {
+        epoch = wait_region(epoch);
+        if (stop_.load()) break;
+        run_region(epoch);
+    }
+}
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
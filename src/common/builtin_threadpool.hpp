@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_BUILTIN_THREADPOOL_HPP
+#define COMMON_BUILTIN_THREADPOOL_HPP
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
+
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Synchronous threadpool shipped with the library for the applications that
+// do not have one of their own.
+//
+// The thread calling parallel_for() takes part in the region along with
+// num_threads - 1 workers. The iterations are claimed one by one from a
+// counter shared by the participants, so that the threads that start or
+// finish early take over the work of the late ones. Idle workers spin for a
+// while before parking on a condition variable, so that back-to-back
+// regions do not pay for a wake-up. A parallel_for() called from a worker
+// runs sequentially, and the regions submitted by different threads are
+// executed one at a time.
+class builtin_threadpool_t : public threadpool_interop::threadpool_iface {
+public:
+    // A non-positive num_threads stands for the number of hardware threads.
+    // With pin_threads, the calling thread and the workers are bound to the
+    // logical cores in order (Linux only).
+    builtin_threadpool_t(int num_threads, bool pin_threads);
+    ~builtin_threadpool_t() override;
+
+    int get_num_threads() const override { return num_threads_; }
+    bool get_in_parallel() const override;
+    uint64_t get_flags() const override { return 0; }
+    void parallel_for(int n, const std::function<void(int, int)> &fn) override;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(builtin_threadpool_t);
+
+private:
+    // The epoch of the region in the high half and the index of the next
+    // iteration in the low half, so that a worker late for a region can
+    // never claim an iteration of the next one.
+    static uint64_t epoch_of(uint64_t work) { return work >> 32; }
+    static uint64_t make_work(uint64_t epoch) { return epoch << 32; }
+
+    void worker_loop();
+    // Runs the iterations of the region of the epoch while there are any.
+    void run_region(uint64_t epoch);
+    // Returns the epoch of the next region, or of the shutdown.
+    uint64_t wait_region(uint64_t last_epoch);
+
+    int num_threads_;
+    bool pin_threads_;
+    std::vector<std::thread> workers_;
+
+    alignas(64) std::atomic<uint64_t> work_ {0};
+    std::atomic<const std::function<void(int, int)> *> fn_ {nullptr};
+    std::atomic<int> n_ {0};
+    alignas(64) std::atomic<int> done_ {0};
+    alignas(64) std::atomic<int> nparked_ {0};
+    std::atomic<bool> stop_ {false};
+
+    std::mutex submit_mutex_;
+    std::mutex park_mutex_;
+    std::condition_variable park_cv_;
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
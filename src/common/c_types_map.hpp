@@ -108,6 +108,8 @@ const alg_kind_t eltwise_round = dnnl_eltwise_round;
 const alg_kind_t pooling_max = dnnl_pooling_max;
 const alg_kind_t pooling_avg_include_padding = dnnl_pooling_avg_include_padding;
 const alg_kind_t pooling_avg_exclude_padding = dnnl_pooling_avg_exclude_padding;
+const alg_kind_t pooling_adaptive_max = dnnl_pooling_adaptive_max;
+const alg_kind_t pooling_adaptive_avg = dnnl_pooling_adaptive_avg;
 const alg_kind_t lrn_across_channels = dnnl_lrn_across_channels;
 const alg_kind_t lrn_within_channel = dnnl_lrn_within_channel;
 const alg_kind_t vanilla_rnn = dnnl_vanilla_rnn;
@@ -131,6 +133,8 @@ const alg_kind_t binary_ne = dnnl_binary_ne;
 const alg_kind_t binary_select = dnnl_binary_select;
 const alg_kind_t resampling_nearest = dnnl_resampling_nearest;
 const alg_kind_t resampling_linear = dnnl_resampling_linear;
+const alg_kind_t resampling_cubic = dnnl_resampling_cubic;
+const alg_kind_t resampling_linear_antialias = dnnl_resampling_linear_antialias;
 const alg_kind_t reduction_max = dnnl_reduction_max;
 const alg_kind_t reduction_min = dnnl_reduction_min;
 const alg_kind_t reduction_sum = dnnl_reduction_sum;
@@ -142,6 +146,8 @@ const alg_kind_t reduction_norm_lp_power_p_max
         = dnnl_reduction_norm_lp_power_p_max;
 const alg_kind_t reduction_norm_lp_power_p_sum
         = dnnl_reduction_norm_lp_power_p_sum;
+const alg_kind_t reduction_arg_max = dnnl_reduction_arg_max;
+const alg_kind_t reduction_arg_min = dnnl_reduction_arg_min;
 const alg_kind_t softmax_accurate = dnnl_softmax_accurate;
 const alg_kind_t softmax_log = dnnl_softmax_log;
 // Internal only alg kinds.
@@ -203,6 +209,7 @@ using scratchpad_mode_t = dnnl_scratchpad_mode_t;
 namespace scratchpad_mode {
 const scratchpad_mode_t library = dnnl_scratchpad_mode_library;
 const scratchpad_mode_t user = dnnl_scratchpad_mode_user;
+const scratchpad_mode_t stream = dnnl_scratchpad_mode_stream;
 } // namespace scratchpad_mode
 
 using rounding_mode_t = dnnl_rounding_mode_t;
@@ -211,11 +218,22 @@ const rounding_mode_t environment = dnnl_rounding_mode_environment;
 const rounding_mode_t stochastic = dnnl_rounding_mode_stochastic;
 } // namespace rounding_mode
 
+using softmax_mask_kind_t = dnnl_softmax_mask_kind_t;
+namespace softmax_mask_kind {
+const softmax_mask_kind_t none = dnnl_softmax_mask_none;
+const softmax_mask_kind_t causal_top_left = dnnl_softmax_mask_causal_top_left;
+const softmax_mask_kind_t causal_bottom_right
+        = dnnl_softmax_mask_causal_bottom_right;
+} // namespace softmax_mask_kind
+
 using sparse_encoding_t = dnnl_sparse_encoding_t;
 namespace sparse_encoding {
 const sparse_encoding_t undef = dnnl_sparse_encoding_undef;
 const sparse_encoding_t csr = dnnl_csr;
 const sparse_encoding_t coo = dnnl_coo;
+const sparse_encoding_t grouped = dnnl_grouped;
+const sparse_encoding_t paged = dnnl_paged;
+const sparse_encoding_t structured = dnnl_structured;
 const sparse_encoding_t packed = dnnl_packed;
 } // namespace sparse_encoding
 
@@ -240,11 +258,24 @@ using profiling_data_kind_t = dnnl_profiling_data_kind_t;
 namespace profiling_data_kind {
 const profiling_data_kind_t undef = dnnl_profiling_data_kind_undef;
 const profiling_data_kind_t time = dnnl_profiling_data_kind_time;
+const profiling_data_kind_t thread_time = dnnl_profiling_data_kind_thread_time;
+const profiling_data_kind_t nthr = dnnl_profiling_data_kind_nthr;
+const profiling_data_kind_t eu_active_time
+        = dnnl_profiling_data_kind_eu_active_time;
+const profiling_data_kind_t eu_stall_time
+        = dnnl_profiling_data_kind_eu_stall_time;
+const profiling_data_kind_t memory_bytes
+        = dnnl_profiling_data_kind_memory_bytes;
 #else
 using profiling_data_kind_t = int;
 namespace profiling_data_kind {
 const profiling_data_kind_t undef = 0;
 const profiling_data_kind_t time = 1;
+const profiling_data_kind_t thread_time = 2;
+const profiling_data_kind_t nthr = 3;
+const profiling_data_kind_t eu_active_time = 4;
+const profiling_data_kind_t eu_stall_time = 5;
+const profiling_data_kind_t memory_bytes = 6;
 #endif
 // Internal only data kinds.
 const profiling_data_kind_t internal_only_start
@@ -1922,6 +1953,7 @@ const normalization_flags_t use_shift = dnnl_use_shift;
 const normalization_flags_t fuse_norm_relu = dnnl_fuse_norm_relu;
 const normalization_flags_t fuse_norm_add_relu = dnnl_fuse_norm_add_relu;
 const normalization_flags_t rms_norm = dnnl_rms_norm;
+const normalization_flags_t fuse_add_norm = dnnl_fuse_add_norm;
 } // namespace normalization_flags
 
 using rnn_flags_t = dnnl_rnn_flags_t;
@@ -1929,6 +1961,7 @@ namespace rnn_flags {
 const rnn_flags_t undef = dnnl_rnn_flags_undef;
 const rnn_flags_t diff_weights_overwrite
         = dnnl_rnn_flags_diff_weights_overwrite;
+const rnn_flags_t seq_lengths = dnnl_rnn_flags_seq_lengths;
 } // namespace rnn_flags
 
 using engine_kind_t = dnnl_engine_kind_t;
@@ -1982,6 +2015,7 @@ const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax = dnnl_softmax;
 const primitive_kind_t layer_normalization = dnnl_layer_normalization;
 const primitive_kind_t group_normalization = dnnl_group_normalization;
+const primitive_kind_t embedding_bag = dnnl_embedding_bag;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -2073,6 +2107,7 @@ using matmul_reduce_kind_t = int;
 namespace matmul_reduce_kind {
 const matmul_reduce_kind_t undef = 0;
 const matmul_reduce_kind_t src = 1;
+const matmul_reduce_kind_t weights = 2;
 } // namespace matmul_reduce_kind
 
 using rnn_direction_t = dnnl_rnn_direction_t;
@@ -2083,6 +2118,8 @@ using post_ops_t = dnnl_post_ops;
 using memory_desc_t = dnnl_memory_desc;
 using memory_t = dnnl_memory;
 
+using cache_stats_t = dnnl_cache_stats_t;
+
 using stream_flags_t = dnnl_stream_flags_t;
 namespace stream_flags {
 const stream_flags_t in_order = dnnl_stream_in_order;
@@ -2097,6 +2134,8 @@ const stream_flags_t profiling = static_cast<stream_flags_t>(1 << 2);
 using stream_t = dnnl_stream;
 
 struct memory_storage_t;
+struct host_staging_pool_t;
+struct device_memory_pool_t;
 
 /* forward declaration of the internal primitive_desc types */
 struct batch_normalization_bwd_pd_t;
@@ -2115,6 +2154,7 @@ struct deconvolution_pd_t;
 struct eltwise_bwd_pd_t;
 struct eltwise_fwd_pd_t;
 struct eltwise_pd_t;
+struct embedding_bag_pd_t;
 struct gemm_pd_t;
 struct group_normalization_bwd_pd_t;
 struct group_normalization_fwd_pd_t;
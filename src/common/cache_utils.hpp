@@ -18,6 +18,9 @@
 #define COMMON_CACHE_UTILS_HPP
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <future>
 #include <memory>
 #include <thread>
@@ -27,8 +30,6 @@
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/platform.hpp"
-#else
-#include <chrono>
 #endif
 
 #ifdef _WIN32
@@ -47,6 +48,24 @@ namespace utils {
 template <typename K, typename O>
 using key_merge_t = void (*)(const K &, const O &);
 
+// Cache efficiency counters. The counters are updated without taking the cache
+// locks and may be slightly inconsistent with each other when read while the
+// cache is in use.
+struct cache_counters_t {
+    std::atomic<uint64_t> hits {0};
+    std::atomic<uint64_t> misses {0};
+    std::atomic<uint64_t> evictions {0};
+    // Cumulative time spent creating objects on cache misses.
+    std::atomic<uint64_t> creation_time_ns {0};
+
+    void reset() {
+        hits.store(0);
+        misses.store(0);
+        evictions.store(0);
+        creation_time_ns.store(0);
+    }
+};
+
 template <typename K, typename O, typename C,
         key_merge_t<K, O> key_merge = nullptr>
 struct cache_t {
@@ -70,9 +89,11 @@ struct cache_t {
     // the create(create_context) function, or an empty object in case of
     // errors. The function create() is called upon a cache miss, or if the user
     // forced creation through a `force_create` boolean flag. The returned
-    // object is added to the cache on a cache miss.
+    // object is added to the cache on a cache miss. When `counters` is not
+    // null, the lookup outcome and the creation time are recorded in it.
     cache_object_t get_or_create(const key_t &key, create_func_t create,
-            void *create_context, bool force_create) {
+            void *create_context, bool force_create,
+            cache_counters_t *counters = nullptr) {
         std::promise<cache_object_t> p_promise;
         // Try to get the shared future from the cache, if it's missing then a
         // shared future with no shared state is returned and the passed shared
@@ -83,12 +104,22 @@ struct cache_t {
         if (!force_create && p_future.valid()) {
             // The requested object is present in the cache or is being created
             // by another thread.
+            if (counters) counters->hits++;
             return p_future.get();
         } else {
             // The requested object is NOT present in the cache therefore we
             // have to create it and notify the waiting threads once the
             // creation is done.
+            if (counters) counters->misses++;
+            const auto start = std::chrono::steady_clock::now();
             cache_object_t cv = create(create_context);
+            if (counters) {
+                const auto duration = std::chrono::steady_clock::now() - start;
+                counters->creation_time_ns += static_cast<uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                duration)
+                                .count());
+            }
             if (cv.status != status::success) {
                 // Communicate an error.
                 p_promise.set_value({nullptr, cv.status});
@@ -121,7 +152,12 @@ protected:
     }
 };
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy. Entries are partitioned into shards
+// by key hash and each shard is protected by its own read-write lock, so that
+// lookups of different keys (the common case of a cache hit) do not contend on
+// a single lock. The capacity and the LRU order are global: operations that
+// change the set of entries beyond a single shard (eviction, capacity
+// updates) lock all the shards.
 template <typename K, typename O, typename C,
         key_merge_t<K, O> key_merge = nullptr>
 struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
@@ -130,20 +166,26 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     using object_t = typename lru_base_t::object_t;
     using cache_object_t = typename lru_base_t::cache_object_t;
     using value_t = typename lru_base_t::value_t;
-    lru_cache_t(int capacity) : capacity_(capacity) {}
+    // Called for every evicted entry with all the shards locked. The hook must
+    // not access the cache.
+    using evict_hook_t = std::function<void(const key_t &, const value_t &)>;
+
+    lru_cache_t(int capacity, evict_hook_t evict_hook = nullptr)
+        : capacity_(capacity), size_(0), evict_hook_(std::move(evict_hook)) {}
 
     ~lru_cache_t() override {
-        if (cache_mapper().empty()) return;
+        if (size_.load() == 0) return;
 
         if (!is_destroying_cache_safe()) {
             // It is safe to remove those entries that are not affected by the
             // unloading order issue e.g. native CPU.
-            for (auto it = cache_mapper().begin();
-                    it != cache_mapper().end();) {
-                if (!it->first.has_runtime_dependencies()) {
-                    it = cache_mapper().erase(it);
-                } else {
-                    ++it;
+            for (auto &s : shards_) {
+                for (auto it = s.mapper_.begin(); it != s.mapper_.end();) {
+                    if (!it->first.has_runtime_dependencies()) {
+                        it = s.mapper_.erase(it);
+                    } else {
+                        ++it;
+                    }
                 }
             }
             release_cache();
@@ -154,90 +196,119 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     cache_object_t get(const key_t &key) override {
         value_t e;
         {
-            utils::lock_read_t lock_r(this->rw_mutex());
-            if (capacity_ == 0) { return cache_object_t(); }
-            e = get_future(key);
+            auto &s = get_shard(key);
+            utils::lock_read_t lock_r(s.mutex_);
+            if (capacity_.load() == 0) { return cache_object_t(); }
+            e = get_future(s, key);
         }
 
         if (e.valid()) return e.get();
         return cache_object_t();
     }
 
-    int get_capacity() const override {
-        utils::lock_read_t lock_r(this->rw_mutex());
-        return capacity_;
-    };
+    int get_capacity() const override { return capacity_.load(); };
 
     status_t set_capacity(int capacity) override {
-        utils::lock_write_t lock_w(this->rw_mutex());
-        capacity_ = capacity;
+        lock_all_write();
+        capacity_.store(capacity);
         // Check if number of entries exceeds the new capacity
-        if (get_size_no_lock() > capacity_) {
+        if (size_.load() > capacity) {
             // Evict excess entries
-            int n_excess_entries = get_size_no_lock() - capacity_;
+            int n_excess_entries = size_.load() - capacity;
             evict(n_excess_entries);
         }
+        unlock_all_write();
         return status::success;
     }
     void set_capacity_without_clearing(int capacity) {
-        utils::lock_write_t lock_w(this->rw_mutex());
-        capacity_ = capacity;
+        lock_all_write();
+        capacity_.store(capacity);
+        unlock_all_write();
     }
 
-    int get_size() const override {
-        utils::lock_read_t lock_r(this->rw_mutex());
-        return get_size_no_lock();
+    int get_size() const override { return size_.load(); }
+
+    // Returns the number of entries whose key satisfies the predicate.
+    template <typename pred_t>
+    int get_size_if(pred_t pred) {
+        int n = 0;
+        for (auto &s : shards_) {
+            utils::lock_read_t lock_r(s.mutex_);
+            n += (int)std::count_if(s.mapper_.begin(), s.mapper_.end(),
+                    [&](const typename mapper_t::value_type &v) {
+                        return pred(v.first);
+                    });
+        }
+        return n;
     }
 
 protected:
-    int get_size_no_lock() const { return (int)cache_mapper().size(); }
-
     value_t get_or_add(const key_t &key, const value_t &value) override {
+        auto &s = get_shard(key);
         {
-            // 1. Section with shared access (read lock)
-            utils::lock_read_t lock_r(this->rw_mutex());
+            // 1. Section with shared access to the shard (read lock)
+            utils::lock_read_t lock_r(s.mutex_);
             // Check if the cache is enabled.
-            if (capacity_ == 0) { return value_t(); }
+            if (capacity_.load() == 0) { return value_t(); }
             // Check if the requested entry is present in the cache (likely
             // cache_hit)
-            auto e = get_future(key);
+            auto e = get_future(s, key);
             if (e.valid()) { return e; }
         }
 
-        utils::lock_write_t lock_w(this->rw_mutex());
-        // 2. Section with exclusive access (write lock).
-        // In a multithreaded scenario, in the context of one thread the cache
-        // may have changed by another thread between releasing the read lock
-        // and acquiring the write lock (a.k.a. ABA problem), therefore
-        // additional checks have to be performed for correctness. Double check
-        // the capacity due to possible race condition
-        if (capacity_ == 0) { return value_t(); }
-
-        // Double check if the requested entry is present in the cache (unlikely
-        // cache_hit).
-        auto e = get_future(key);
-        if (!e.valid()) {
-            // If the entry is missing in the cache then add it (cache_miss)
-            add(key, value);
+        value_t e;
+        bool exceeds_capacity = false;
+        {
+            utils::lock_write_t lock_w(s.mutex_);
+            // 2. Section with exclusive access to the shard (write lock).
+            // In a multithreaded scenario, in the context of one thread the
+            // cache may have changed by another thread between releasing the
+            // read lock and acquiring the write lock (a.k.a. ABA problem),
+            // therefore additional checks have to be performed for
+            // correctness. Double check the capacity due to possible race
+            // condition
+            if (capacity_.load() == 0) { return value_t(); }
+
+            // Double check if the requested entry is present in the cache
+            // (unlikely cache_hit).
+            e = get_future(s, key);
+            if (!e.valid()) {
+                // If the entry is missing in the cache then add it
+                // (cache_miss)
+                add(s, key, value);
+                exceeds_capacity = size_.load() > capacity_.load();
+            }
+        }
+
+        // 3. Eviction requires the global LRU order, hence all the shards are
+        // locked. A shard lock must not be held at this point to preserve the
+        // locking order.
+        if (exceeds_capacity) {
+            lock_all_write();
+            int n_excess_entries = size_.load() - capacity_.load();
+            if (n_excess_entries > 0) evict(n_excess_entries);
+            unlock_all_write();
         }
         return e;
     }
 
     void remove_if_invalidated(const key_t &key) override {
-        utils::lock_write_t lock_w(this->rw_mutex());
+        auto &s = get_shard(key);
+        utils::lock_write_t lock_w(s.mutex_);
 
-        if (capacity_ == 0) { return; }
+        if (capacity_.load() == 0) { return; }
 
-        auto it = cache_mapper().find(key);
+        auto it = s.mapper_.find(key);
         // The entry has been already evicted at this point
-        if (it == cache_mapper().end()) { return; }
+        if (it == s.mapper_.end()) { return; }
 
         const auto &value = it->second.value_;
         // If the entry is not invalidated
         if (!value.get().is_empty()) { return; }
 
         // Remove the invalidated entry
-        cache_mapper().erase(it);
+        s.mapper_.erase(it);
+        size_--;
     }
 
 private:
@@ -255,17 +326,18 @@ private:
         // intended behavior
         if ((void *)key_merge == nullptr) return;
 
-        utils::lock_write_t lock_w(this->rw_mutex());
+        auto &s = get_shard(key);
+        utils::lock_write_t lock_w(s.mutex_);
 
-        if (capacity_ == 0) { return; }
+        if (capacity_.load() == 0) { return; }
 
         // There is nothing to do in two cases:
         // 1. The requested entry is not in the cache because it has been evicted
         //    by another thread
         // 2. After the requested entry had been evicted it was inserted again
         //    by another thread
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()
+        auto it = s.mapper_.find(key);
+        if (it == s.mapper_.end()
                 || it->first.thread_id() != key.thread_id()) {
             return;
         }
@@ -273,95 +345,141 @@ private:
         key_merge(it->first, p);
     }
 
+    struct timed_entry_t {
+        value_t value_;
+        std::atomic<size_t> timestamp_;
+        timed_entry_t(const value_t &value, size_t timestamp)
+            : value_(value), timestamp_(timestamp) {}
+    };
+
+    // Each entry in the cache has a corresponding key and timestamp. NOTE:
+    // pairs that contain atomics cannot be stored in an unordered_map *as an
+    // element*, since it invokes the copy constructor of std::atomic, which is
+    // deleted.
+    using mapper_t = std::unordered_map<key_t, timed_entry_t>;
+
+    struct shard_t {
+        utils::rw_mutex_t mutex_;
+        mapper_t mapper_;
+    };
+
+    // Power of two to keep the shard selection cheap.
+    static constexpr int n_shards = 16;
+
+    shard_t &get_shard(const key_t &key) {
+        size_t h = std::hash<key_t>()(key);
+        // Mix in the higher bits as the low bits of hash values composed with
+        // hash_combine() alone may be poorly distributed.
+        h ^= h >> 16;
+        h ^= h >> 8;
+        return shards_[h & (n_shards - 1)];
+    }
+
+    // Shards are always locked in the same order to avoid deadlocks.
+    void lock_all_write() {
+        for (auto &s : shards_)
+            s.mutex_.lock_write();
+    }
+    void unlock_all_write() {
+        for (int i = n_shards - 1; i >= 0; i--)
+            shards_[i].mutex_.unlock_write();
+    }
+
+    // Must be called with all shards locked.
     void evict(int n) {
-        using v_t =
-                typename std::unordered_map<key_t, timed_entry_t>::value_type;
+        using v_t = typename mapper_t::value_type;
 
-        if (n == capacity_) {
-            cache_mapper().clear();
+        if (n >= size_.load()) {
+            for (auto &s : shards_) {
+                if (evict_hook_) {
+                    for (const auto &v : s.mapper_)
+                        evict_hook_(v.first, v.second.value_);
+                }
+                s.mapper_.clear();
+            }
+            size_.store(0);
             return;
         }
 
         for (int e = 0; e < n; e++) {
-            // Find the smallest timestamp
+            // Find the smallest timestamp across all shards.
             // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
             // maybe evict multiple entries at once.
-            auto it = std::min_element(cache_mapper().begin(),
-                    cache_mapper().end(),
-                    [&](const v_t &left, const v_t &right) {
-                        // By default, load() and operator T use sequentially
-                        // consistent memory ordering, which enforces writing
-                        // the timestamps into registers in the same exact order
-                        // they are read from the CPU cache line. Since eviction
-                        // is performed under a write lock, this order is not
-                        // important, therefore we can safely use the weakest
-                        // memory ordering (relaxed). This brings about a few
-                        // microseconds performance improvement for default
-                        // cache capacity.
-                        return left.second.timestamp_.load(
-                                       std::memory_order_relaxed)
-                                < right.second.timestamp_.load(
-                                        std::memory_order_relaxed);
-                    });
-            auto res = cache_mapper().erase(it->first);
-            MAYBE_UNUSED(res);
-            assert(res);
+            shard_t *lru_shard = nullptr;
+            typename mapper_t::iterator lru_it;
+            size_t lru_timestamp = 0;
+            for (auto &s : shards_) {
+                if (s.mapper_.empty()) continue;
+                auto it = std::min_element(s.mapper_.begin(), s.mapper_.end(),
+                        [&](const v_t &left, const v_t &right) {
+                            // By default, load() and operator T use
+                            // sequentially consistent memory ordering, which
+                            // enforces writing the timestamps into registers
+                            // in the same exact order they are read from the
+                            // CPU cache line. Since eviction is performed
+                            // under a write lock, this order is not
+                            // important, therefore we can safely use the
+                            // weakest memory ordering (relaxed). This brings
+                            // about a few microseconds performance improvement
+                            // for default cache capacity.
+                            return left.second.timestamp_.load(
+                                           std::memory_order_relaxed)
+                                    < right.second.timestamp_.load(
+                                            std::memory_order_relaxed);
+                        });
+                size_t ts = it->second.timestamp_.load(
+                        std::memory_order_relaxed);
+                if (!lru_shard || ts < lru_timestamp) {
+                    lru_shard = &s;
+                    lru_it = it;
+                    lru_timestamp = ts;
+                }
+            }
+            assert(lru_shard);
+            if (!lru_shard) return;
+            if (evict_hook_) evict_hook_(lru_it->first, lru_it->second.value_);
+            lru_shard->mapper_.erase(lru_it);
+            size_--;
         }
     }
-    void add(const key_t &key, const value_t &value) {
-        // std::list::size() method has linear complexity. Check the cache size
-        // using std::unordered_map::size();
-        if (get_size_no_lock() == capacity_) {
-            // Evict the least recently used entry
-            evict(1);
-        }
 
+    // Must be called with the shard locked for writing. The caller is
+    // responsible for evicting entries if the capacity is exceeded.
+    void add(shard_t &s, const key_t &key, const value_t &value) {
         size_t timestamp = get_timestamp();
 
-        auto res = cache_mapper().emplace(std::piecewise_construct,
+        auto res = s.mapper_.emplace(std::piecewise_construct,
                 std::forward_as_tuple(key),
                 std::forward_as_tuple(value, timestamp));
         MAYBE_UNUSED(res);
         assert(res.second);
+        size_++;
     }
-    value_t get_future(const key_t &key) {
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()) return value_t();
+    value_t get_future(shard_t &s, const key_t &key) {
+        auto it = s.mapper_.find(key);
+        if (it == s.mapper_.end()) return value_t();
 
         size_t timestamp = get_timestamp();
-        it->second.timestamp_.store(timestamp);
+        it->second.timestamp_.store(timestamp, std::memory_order_relaxed);
         // Return the entry
         return it->second.value_;
     }
 
-    int capacity_;
-    struct timed_entry_t {
-        value_t value_;
-        std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
-    };
-
-    std::unordered_map<key_t, timed_entry_t> &cache_mapper() {
-        return cache_mapper_;
-    }
-
-    const std::unordered_map<key_t, timed_entry_t> &cache_mapper() const {
-        return cache_mapper_;
-    }
-
     // Leaks cached resources. Used to avoid issues with calling destructors
     // allocated by an already unloaded dynamic library.
     void release_cache() {
-        auto t = utils::make_unique<std::unordered_map<key_t, timed_entry_t>>();
-        std::swap(*t, cache_mapper_);
-        t.release();
+        for (auto &s : shards_) {
+            auto t = utils::make_unique<mapper_t>();
+            std::swap(*t, s.mapper_);
+            t.release();
+        }
     }
-    // Each entry in the cache has a corresponding key and timestamp. NOTE:
-    // pairs that contain atomics cannot be stored in an unordered_map *as an
-    // element*, since it invokes the copy constructor of std::atomic, which is
-    // deleted.
-    std::unordered_map<key_t, timed_entry_t> cache_mapper_;
+
+    std::atomic<int> capacity_;
+    // The total number of entries in all the shards.
+    std::atomic<int> size_;
+    evict_hook_t evict_hook_;
+    shard_t shards_[n_shards];
 };
 
 } // namespace utils
@@ -51,14 +51,19 @@ status_t concat_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
         attr = &default_attr();
     else {
         using smask_t = primitive_attr_t::skip_mask_t;
-        VCHECK_CONCAT_UNIMPL(attr->has_default_values(smask_t::scales),
+        VCHECK_CONCAT_UNIMPL(attr->has_default_values(smask_t::scales
+                                     | smask_t::zero_points),
                 VERBOSE_UNSUPPORTED_ATTR);
+        // A scale and a zero point per source and for the destination
+        // requantize the sources into the destination.
+        std::vector<int> supported_args(n + 1);
+        for (int i = 0; i < n; i++) {
+            supported_args[i] = DNNL_ARG_MULTIPLE_SRC + i;
+        }
+        supported_args[n] = DNNL_ARG_DST;
+
         const auto &scales = attr->scales_;
         if (!scales.has_default_values()) {
-            std::vector<int> supported_args(n);
-            for (int i = 0; i < n; i++) {
-                supported_args[i] = DNNL_ARG_MULTIPLE_SRC + i;
-            }
             VCHECK_CONCAT_UNIMPL(
                     attr->scales_.has_default_values(supported_args),
                     VERBOSE_UNSUPPORTED_SCALES_CFG);
@@ -70,6 +75,19 @@ status_t concat_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
                 VCHECK_CONCAT_UNIMPL(mask == 0, VERBOSE_UNSUPPORTED_SCALES_CFG);
             }
         }
+
+        const auto &zero_points = attr->zero_points_;
+        if (!zero_points.has_default_values()) {
+            VCHECK_CONCAT_UNIMPL(zero_points.has_default_values(supported_args),
+                    VERBOSE_UNSUPPORTED_ZP_CFG);
+
+            for (int arg : supported_args) {
+                if (zero_points.has_default_values(arg)) continue;
+
+                int mask = zero_points.get_mask(arg);
+                VCHECK_CONCAT_UNIMPL(mask == 0, VERBOSE_UNSUPPORTED_ZP_CFG);
+            }
+        }
     }
 
     const int ndims = src_mds[0]->ndims;
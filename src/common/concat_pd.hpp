@@ -21,6 +21,7 @@
 
 #include "c_types_map.hpp"
 #include "primitive_desc.hpp"
+#include "primitive_exec_types.hpp"
 #include "type_helpers.hpp"
 
 #include "utils.hpp"
@@ -85,6 +86,46 @@ struct concat_pd_t : public primitive_desc_t {
         return index < n_inputs() ? &src_image_mds_[index] : &glob_zero_md;
     }
 
+    /* Returns true when the source `index` is a view of its image in the
+     * destination memory, i.e. its producer has already written it in place
+     * and there is nothing to copy. A source is a view when it is described
+     * by its image memory descriptor, e.g. created with
+     * dnnl_memory_desc_create_submemory() from the destination one, and
+     * shares the data handle of the destination. */
+    bool src_is_dst_view(const exec_ctx_t &ctx, int index) const {
+        if (!images_in_dst_ || index >= (int)src_image_mds_.size())
+            return false;
+        // A source is converted with the quantization parameters, if any.
+        const int src_arg = DNNL_ARG_MULTIPLE_SRC + index;
+        if (!attr()->scales_.has_default_values(src_arg)
+                || !attr()->zero_points_.has_default_values(src_arg)
+                || !attr()->scales_.has_default_values(DNNL_ARG_DST)
+                || !attr()->zero_points_.has_default_values(DNNL_ARG_DST))
+            return false;
+        if (memory_desc_wrapper(src_mds_[index])
+                != memory_desc_wrapper(src_image_mds_[index]))
+            return false;
+
+        const memory_t *src = ctx.input(DNNL_ARG_MULTIPLE_SRC + index);
+        const memory_t *dst = ctx.output(DNNL_ARG_DST);
+        if (src == nullptr || dst == nullptr) return false;
+        const memory_storage_t *src_storage = src->memory_storage();
+        const memory_storage_t *dst_storage = dst->memory_storage();
+        void *src_handle = nullptr, *dst_handle = nullptr;
+        if (src_storage->get_data_handle(&src_handle) != status::success
+                || dst_storage->get_data_handle(&dst_handle)
+                        != status::success)
+            return false;
+        return src_handle != nullptr && src_handle == dst_handle
+                && src_storage->offset() == dst_storage->offset();
+    }
+
+    bool srcs_are_dst_views(const exec_ctx_t &ctx) const {
+        for (int i = 0; i < n_inputs(); ++i)
+            if (!src_is_dst_view(ctx, i)) return false;
+        return true;
+    }
+
 protected:
     int n_, concat_dim_;
     memory_desc_t dst_md_;
@@ -95,6 +136,9 @@ protected:
      * Lives here to simplify some implementations. An implementation might
      * use this auxiliary array iff init() returned success */
     std::vector<memory_desc_t> src_image_mds_;
+    /* true when src_image_mds_ are sub-memories of dst_md_ rather than of a
+     * memory forced by the implementation */
+    bool images_in_dst_ = false;
 
     concat_desc_t desc_;
 
@@ -119,7 +163,8 @@ protected:
         , dst_md_(other.dst_md_)
         , original_dst_(other.original_dst_)
         , src_mds_(other.src_mds_)
-        , src_image_mds_(other.src_image_mds_) {
+        , src_image_mds_(other.src_image_mds_)
+        , images_in_dst_(other.images_in_dst_) {
         init_desc();
     }
 
@@ -131,6 +176,7 @@ protected:
         original_dst_ = other.original_dst_;
         src_mds_ = other.src_mds_;
         src_image_mds_ = other.src_image_mds_;
+        images_in_dst_ = other.images_in_dst_;
 
         init_desc();
         return *this;
@@ -144,6 +190,7 @@ protected:
      *
      * @warning The call may fail. */
     status_t init(const memory_desc_t *force_dst_md = nullptr) {
+        images_in_dst_ = false;
         bool ok = true;
         if (force_dst_md == nullptr)
             ok = ok && set_default_params() == status::success;
@@ -177,6 +224,7 @@ protected:
             src_image_mds_.push_back(src_img_d);
             current_concat_dim_offset += dim;
         }
+        images_in_dst_ = force_dst_md == &dst_md_;
 
         return status::success;
     }
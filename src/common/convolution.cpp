@@ -20,6 +20,7 @@
 #include "primitive_desc_iface.hpp"
 
 #include "c_types_map.hpp"
+#include "convolution_pd.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -44,7 +45,8 @@ status_t conv_desc_init(convolution_desc_t *conv_desc, prop_kind_t prop_kind,
         alg_kind_t alg_kind, const memory_desc_t *src_desc,
         const memory_desc_t *weights_desc, const memory_desc_t *bias_desc,
         const memory_desc_t *dst_desc, const dims_t strides,
-        const dims_t dilates, const dims_t padding_l, const dims_t padding_r) {
+        const dims_t dilates, const dims_t padding_l, const dims_t padding_r,
+        int src_upsampling) {
     VCHECK_CONV(!any_null(conv_desc, src_desc, weights_desc, dst_desc, strides,
                         padding_l),
             VERBOSE_NULL_ARG);
@@ -142,7 +144,8 @@ status_t conv_desc_init(convolution_desc_t *conv_desc, prop_kind_t prop_kind,
         utils::array_set(cd.dilates, 0, sp_dims);
 
     for (int i = 2; i < src_desc->ndims; ++i) {
-        dim_t src = src_desc->dims[i];
+        // The destination is computed from the upsampled source.
+        dim_t src = src_desc->dims[i] * src_upsampling;
         dim_t ker = weights_desc->dims[with_groups + i];
         dim_t dil = cd.dilates[i - 2];
         dim_t pad_l = padding_l[i - 2];
@@ -175,7 +178,8 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
         const data_type_t dst_dt = desc.dst_desc.data_type;
 
         auto fwd_attr_mask = smask_t::post_ops | smask_t::sum_dt
-                | smask_t::fpmath_mode | smask_t::rounding_mode;
+                | smask_t::fpmath_mode | smask_t::rounding_mode
+                | smask_t::src_upsampling;
         const bool is_gpu = engine->kind() == engine_kind::gpu;
 
         const bool is_int8 = utils::one_of(src_dt, data_type::s8, data_type::u8)
@@ -249,8 +253,17 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
         }
     } else {
         auto bwd_attr_mask = smask_t::fpmath_mode | smask_t::accumulation_mode;
+        // A sum post-op of backward by weights accumulates the diff weights
+        // and the diff bias to the values of the memory, which is only
+        // supported on CPU.
+        const bool is_bwd_w = desc.prop_kind == prop_kind::backward_weights;
+        if (is_bwd_w && engine->kind() == engine_kind::cpu)
+            bwd_attr_mask |= smask_t::post_ops;
         VCHECK_CONV_UNIMPL(attr->has_default_values(bwd_attr_mask),
                 VERBOSE_UNSUPPORTED_ATTR);
+        VCHECK_CONV_UNIMPL(IMPLICATION(!attr->post_ops_.has_default_values(),
+                                   attr->post_ops_.is_plain_sum()),
+                VERBOSE_UNSUPPORTED_POSTOP);
     }
 
     return status::success;
@@ -272,7 +285,7 @@ status_t dnnl_convolution_forward_primitive_desc_create(
     auto conv_desc = convolution_desc_t();
     CHECK(dnnl::impl::conv_desc_init(&conv_desc, prop_kind, alg_kind, src_desc,
             weights_desc, bias_desc, dst_desc, strides, dilates, padding_l,
-            padding_r));
+            padding_r, attr ? attr->src_upsampling_ : 1));
     CHECK(dnnl::impl::conv_attr_check(conv_desc, engine, attr));
     return primitive_desc_create(primitive_desc_iface, engine,
             (const op_desc_t *)&conv_desc, nullptr, attr);
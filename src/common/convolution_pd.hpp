@@ -43,7 +43,8 @@ status_t conv_desc_init(convolution_desc_t *conv_desc, prop_kind_t prop_kind,
         alg_kind_t alg_kind, const memory_desc_t *src_desc,
         const memory_desc_t *weights_desc, const memory_desc_t *bias_desc,
         const memory_desc_t *dst_desc, const dims_t strides,
-        const dims_t dilates, const dims_t padding_l, const dims_t padding_r);
+        const dims_t dilates, const dims_t padding_l, const dims_t padding_r,
+        int src_upsampling = 1);
 
 memory_desc_t *conv_prop_invariant_src_d(convolution_desc_t *desc);
 memory_desc_t *conv_prop_invariant_wei_d(convolution_desc_t *desc);
@@ -150,6 +151,10 @@ struct convolution_pd_t : public primitive_desc_t {
     dim_t padL() const { return desc_.padding[0][ndims() - 3]; }
     dim_t padR() const { return desc_.padding[1][ndims() - 3]; }
 
+    // The factor of the nearest neighbor upsampling of the source applied on
+    // load. ID(), IH() and IW() are the dimensions of the stored source.
+    dim_t src_upsampling() const { return attr()->src_upsampling_; }
+
     int ndims() const { return invariant_src_md()->ndims; }
 
     bool with_bias() const {
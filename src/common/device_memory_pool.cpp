@@ -0,0 +1,136 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/device_memory_pool.hpp"
+
+namespace dnnl {
+namespace impl {
+
+constexpr size_t device_memory_pool_t::max_cached_size;
+constexpr size_t device_memory_pool_t::min_class_size;
+
+size_t device_memory_pool_t::get_class_size(size_t size) {
+    size_t class_size = min_class_size;
+    while (class_size < size)
+        class_size *= 2;
+    return class_size;
+}
+
+void *device_memory_pool_t::acquire(
+        size_t size, const alloc_func_t &alloc, const free_func_t &free) {
+    if (size == 0) return nullptr;
+
+    const size_t class_size = get_class_size(size);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = cached_.find(class_size);
+        if (it != cached_.end() && !it->second.empty()) {
+            buffer_t buf = std::move(it->second.back());
+            it->second.pop_back();
+            cached_size_ -= buf.size;
+            in_use_size_ += buf.size;
+            peak_ = nstl::max(peak_, in_use_size_);
+            void *ptr = buf.ptr;
+            in_use_.emplace(ptr, std::move(buf));
+            return ptr;
+        }
+    }
+
+    // The runtime calls may synchronize, so they are done without the lock.
+    void *ptr = alloc(class_size);
+    if (!ptr) {
+        // The device may be out of memory because of the cached buffers.
+        clear();
+        ptr = alloc(class_size);
+        if (!ptr) return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    in_use_size_ += class_size;
+    peak_ = nstl::max(peak_, in_use_size_);
+    in_use_.emplace(ptr, buffer_t {ptr, class_size, free});
+    return ptr;
+}
+
+void device_memory_pool_t::release(void *ptr) {
+    if (!ptr) return;
+
+    buffer_t buf {};
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = in_use_.find(ptr);
+        assert(it != in_use_.end());
+        if (it == in_use_.end()) return;
+        buf = std::move(it->second);
+        in_use_.erase(it);
+        in_use_size_ -= buf.size;
+
+        if (cached_size_ + buf.size <= max_cached_size) {
+            cached_size_ += buf.size;
+            cached_[buf.size].push_back(std::move(buf));
+            return;
+        }
+    }
+    buf.free(buf.ptr);
+}
+
+void device_memory_pool_t::trim() {
+    std::vector<buffer_t> to_free;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // The buffers in use together with the cached ones should not
+        // exceed the recent peak. The largest buffers go first, as they are
+        // the least likely to be requested again.
+        const size_t capacity = peak_ - nstl::min(peak_, in_use_size_);
+        for (auto it = cached_.rbegin();
+                it != cached_.rend() && cached_size_ > capacity; ++it) {
+            auto &bufs = it->second;
+            while (!bufs.empty() && cached_size_ > capacity) {
+                cached_size_ -= bufs.back().size;
+                to_free.push_back(std::move(bufs.back()));
+                bufs.pop_back();
+            }
+        }
+        peak_ = in_use_size_;
+    }
+    for (auto &buf : to_free)
+        buf.free(buf.ptr);
+}
+
+void device_memory_pool_t::clear() {
+    std::vector<buffer_t> to_free;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &c : cached_)
+            for (auto &buf : c.second)
+                to_free.push_back(std::move(buf));
+        cached_.clear();
+        cached_size_ = 0;
+        peak_ = in_use_size_;
+    }
+    for (auto &buf : to_free)
+        buf.free(buf.ptr);
+}
+
+size_t device_memory_pool_t::cached_size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cached_size_;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
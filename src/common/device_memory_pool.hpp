@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_DEVICE_MEMORY_POOL_HPP
+#define COMMON_DEVICE_MEMORY_POOL_HPP
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// A caching allocator of device memory used for the buffers the library
+// allocates on its own, e.g. scratchpads. Primitives are often created and
+// destroyed at a high rate, and allocating device memory calls into the
+// driver every time, so released buffers are kept in size classes of powers
+// of two and handed out again to later requests of the same class.
+//
+// A buffer is returned to the pool when its owner is destroyed, which is
+// not allowed before the work using it is completed, so it can be reused
+// right away. On a stream wait the pool is trimmed to the peak usage seen
+// since the previous wait, so that the memory cached for a burst of large
+// requests is given back to the device.
+//
+// Like host_staging_pool_t, the pool does not know how to allocate memory:
+// the runtime specific functions are passed on each request, and the owner
+// must call clear() while the buffers can still be freed.
+struct device_memory_pool_t {
+    using alloc_func_t = std::function<void *(size_t)>;
+    using free_func_t = std::function<void(void *)>;
+
+    device_memory_pool_t() = default;
+    ~device_memory_pool_t() { clear(); }
+
+    // Returns a buffer of at least `size` bytes, allocated with `alloc` when
+    // no cached buffer of the size class is available.
+    void *acquire(size_t size, const alloc_func_t &alloc,
+            const free_func_t &free);
+
+    // Returns the buffer obtained from acquire() to the pool. The buffer is
+    // freed when the pool is full.
+    void release(void *ptr);
+
+    // Frees the cached buffers not needed to serve the peak usage since the
+    // previous call.
+    void trim();
+
+    // Frees all the cached buffers. Buffers that are still in use are freed
+    // on release.
+    void clear();
+
+    size_t cached_size() const;
+
+    // The size class, i.e. the size of the buffer allocated for a request.
+    static size_t get_class_size(size_t size);
+
+private:
+    struct buffer_t {
+        void *ptr;
+        size_t size;
+        free_func_t free;
+    };
+
+    // The upper bound on the memory kept in the pool.
+    static constexpr size_t max_cached_size = size_t(1) << 30;
+    // The smallest size class; smaller requests share it.
+    static constexpr size_t min_class_size = size_t(64) << 10;
+
+    mutable std::mutex mutex_;
+    // Cached buffers by the size class.
+    std::map<size_t, std::vector<buffer_t>> cached_;
+    std::unordered_map<void *, buffer_t> in_use_;
+    size_t cached_size_ = 0;
+    size_t in_use_size_ = 0;
+    // Peak of the memory in use since the previous trim.
+    size_t peak_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(device_memory_pool_t);
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -100,6 +100,9 @@ const char *dnnl_sparse_encoding2str(dnnl_sparse_encoding_t v) {
     if (v == dnnl_csr) return "csr";
     if (v == dnnl_packed) return "packed";
     if (v == dnnl_coo) return "coo";
+    if (v == dnnl_grouped) return "grouped";
+    if (v == dnnl_paged) return "paged";
+    if (v == dnnl_structured) return "structured";
     assert(!"unknown sparse_encoding");
     return "unknown sparse_encoding";
 }
@@ -1785,6 +1788,7 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_softmax) return "softmax";
     if (v == dnnl_layer_normalization) return "layer_normalization";
     if (v == dnnl_group_normalization) return "group_normalization";
+    if (v == dnnl_embedding_bag) return "embedding_bag";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     if (v == dnnl::impl::primitive_kind::sdpa) return "sdpa";
     assert(!"unknown prim_kind");
@@ -1829,6 +1833,8 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_pooling_max) return "pooling_max";
     if (v == dnnl_pooling_avg_include_padding) return "pooling_avg_include_padding";
     if (v == dnnl_pooling_avg_exclude_padding) return "pooling_avg_exclude_padding";
+    if (v == dnnl_pooling_adaptive_max) return "pooling_adaptive_max";
+    if (v == dnnl_pooling_adaptive_avg) return "pooling_adaptive_avg";
     if (v == dnnl_lrn_across_channels) return "lrn_across_channels";
     if (v == dnnl_lrn_within_channel) return "lrn_within_channel";
     if (v == dnnl_vanilla_rnn) return "vanilla_rnn";
@@ -1852,6 +1858,8 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_binary_select) return "binary_select";
     if (v == dnnl_resampling_nearest) return "resampling_nearest";
     if (v == dnnl_resampling_linear) return "resampling_linear";
+    if (v == dnnl_resampling_cubic) return "resampling_cubic";
+    if (v == dnnl_resampling_linear_antialias) return "resampling_linear_antialias";
     if (v == dnnl_reduction_max) return "reduction_max";
     if (v == dnnl_reduction_min) return "reduction_min";
     if (v == dnnl_reduction_sum) return "reduction_sum";
@@ -1861,6 +1869,8 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_reduction_norm_lp_sum) return "reduction_norm_lp_sum";
     if (v == dnnl_reduction_norm_lp_power_p_max) return "reduction_norm_lp_power_p_max";
     if (v == dnnl_reduction_norm_lp_power_p_sum) return "reduction_norm_lp_power_p_sum";
+    if (v == dnnl_reduction_arg_max) return "reduction_arg_max";
+    if (v == dnnl_reduction_arg_min) return "reduction_arg_min";
     if (v == dnnl_softmax_accurate) return "softmax_accurate";
     if (v == dnnl_softmax_log) return "softmax_log";
     if (v == dnnl::impl::alg_kind::softmax_accurate_inf_as_zero) return "softmax_accurate_inf_as_zero";
@@ -1871,6 +1881,7 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
 const char *dnnl_rnn_flags2str(dnnl_rnn_flags_t v) {
     if (v == dnnl_rnn_flags_undef) return "undef";
     if (v == dnnl_rnn_flags_diff_weights_overwrite) return "rnn_flags_diff_weights_overwrite";
+    if (v == dnnl_rnn_flags_seq_lengths) return "rnn_flags_seq_lengths";
     assert(!"unknown rnn_flags");
     return "unknown rnn_flags";
 }
@@ -1888,6 +1899,7 @@ const char *dnnl_rnn_direction2str(dnnl_rnn_direction_t v) {
 const char *dnnl_scratchpad_mode2str(dnnl_scratchpad_mode_t v) {
     if (v == dnnl_scratchpad_mode_library) return "library";
     if (v == dnnl_scratchpad_mode_user) return "user";
+    if (v == dnnl_scratchpad_mode_stream) return "stream";
     assert(!"unknown scratchpad_mode");
     return "unknown scratchpad_mode";
 }
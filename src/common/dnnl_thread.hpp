@@ -18,9 +18,11 @@
 #define COMMON_DNNL_THREAD_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <mutex>
 
+#include "parallel_profiler.hpp"
 #include "utils.hpp"
 #include "z_magic.hpp"
 
@@ -259,6 +261,8 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
  *                                         calls for_nd
  *  - parallel_nd_ext(nthr, dims..., f)  - creates a parallel section and then
  *                                         calls for_nd_ext
+ *  - parallel_nd_dynamic(dims..., f)    - same as parallel_nd, but threads
+ *                                         take chunks of work dynamically
  */
 
 /* general parallelization */
@@ -271,8 +275,62 @@ inline int adjust_num_threads(int nthr, dim_t work_amount) {
 #endif
 }
 
+// Whether the thread count of small problems follows their amount of work.
+// The CPU engine disables it with ONEDNN_CPU_WORK_BASED_NTHR=0, so that all
+// threads are used as before.
+inline std::atomic<bool> &nthr_by_work_is_enabled() {
+    static std::atomic<bool> is_enabled {true};
+    return is_enabled;
+}
+
+// The amount of memory, in bytes, a thread of a memory bound pass, e.g. an
+// element-wise operation or a reorder, is worth starting for. A smaller
+// share costs more in the fork and join of the threads and in the sharing of
+// cache lines than in the pass itself.
+constexpr dim_t min_bytes_per_thr = 32 * 1024;
+
+// Returns the number of threads, at most `nthr` or all threads if it is 0,
+// that get at least `min_work_per_thr` of `work_amount` each. The capped
+// counts are reported by verbose with the execution profile.
+inline int nthr_by_work(int nthr, dim_t work_amount, dim_t min_work_per_thr) {
+    if (nthr == 0) nthr = dnnl_get_current_num_threads();
+    if (!nthr_by_work_is_enabled() || min_work_per_thr <= 0) return nthr;
+    const dim_t nthr_work
+            = nstl::max((dim_t)1, work_amount / min_work_per_thr);
+    if (nthr_work >= nthr) return nthr;
+
+    int &capped_nthr = parallel_profiler::capped_nthr();
+    capped_nthr = capped_nthr ? nstl::min(capped_nthr, (int)nthr_work)
+                              : (int)nthr_work;
+    return (int)nthr_work;
+}
+
 static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
     nthr = adjust_num_threads(nthr, INT64_MAX);
+    if (auto *region = parallel_profiler::active_region()) {
+        // Account the time every thread spends in `f`, and the time of the
+        // slowest one, which the others wait for at the end of the region.
+        // The region is deactivated for the duration of the call so that
+        // nested parallel regions are not accounted twice.
+        using namespace parallel_profiler;
+        active_region() = nullptr;
+        const uint64_t start_ns = get_time_ns();
+        std::atomic<uint64_t> max_thr_ns {0};
+        parallel(nthr, [&](int ithr, int nthr_) {
+            const uint64_t thr_start_ns = get_time_ns();
+            f(ithr, nthr_);
+            const uint64_t thr_ns = get_time_ns() - thr_start_ns;
+            region->thread_time_ns += thr_ns;
+            uint64_t cur_ns = max_thr_ns;
+            while (cur_ns < thr_ns
+                    && !max_thr_ns.compare_exchange_weak(cur_ns, thr_ns)) {}
+        });
+        region->parallel_time_ns += get_time_ns() - start_ns;
+        region->span_thread_time_ns += nthr * max_thr_ns;
+        region->max_nthr = nstl::max(region->max_nthr, nthr);
+        active_region() = region;
+        return;
+    }
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
     for (int i = 0; i < nthr; ++i) {
         f(i, nthr);
@@ -589,14 +647,140 @@ static inline void parallel_nd_ext(int nthr, dim_t D0, dim_t D1, dim_t D2,
         });
 }
 
+// Whether parallel_nd() takes the work dynamically, as parallel_nd_dynamic()
+// does. The CPU engine enables it on hybrid CPUs, where the performance and
+// the efficient cores run at different speeds and the static split with
+// balance211() makes the performance cores wait for the efficient ones. The
+// functors of parallel_nd() do not depend on the thread, so that the split
+// does not change their results.
+inline std::atomic<bool> &parallel_nd_is_dynamic() {
+    static std::atomic<bool> is_dynamic {false};
+    return is_dynamic;
+}
+
+/* dynamic scheduling section */
+// Unlike parallel_nd_ext(), which splits the work statically with
+// balance211(), threads take chunks of `chunk` consecutive work items from a
+// shared counter until the work is exhausted, so that threads that get cheap
+// items take over the remaining work. Prefer it for loops with a widely
+// varying cost of an item, e.g. sparse rows or padded borders; static
+// splitting keeps better data locality otherwise. If `chunk` is 0, it is
+// chosen to give every thread several chunks. `f(ithr, nthr, start, end)`
+// is called for every chunk.
+static inline void parallel_dynamic(int nthr, dim_t work_amount, dim_t chunk,
+        const std::function<void(int, int, dim_t, dim_t)> &f) {
+    if (work_amount <= 0) return;
+    nthr = adjust_num_threads(nthr, work_amount);
+    if (nthr <= 1) {
+        f(0, 1, 0, work_amount);
+        return;
+    }
+
+    constexpr dim_t chunks_per_thread = 4;
+    if (chunk <= 0)
+        chunk = nstl::max(
+                (dim_t)1, work_amount / (chunks_per_thread * (dim_t)nthr));
+    nthr = (int)nstl::min((dim_t)nthr, utils::div_up(work_amount, chunk));
+
+    parallel_profiler::dynamic_schedule_count()++;
+    std::atomic<dim_t> next_start {0};
+    parallel(nthr, [&](int ithr, int nthr) {
+        while (true) {
+            const dim_t start
+                    = next_start.fetch_add(chunk, std::memory_order_relaxed);
+            if (start >= work_amount) break;
+            f(ithr, nthr, start, nstl::min(start + chunk, work_amount));
+        }
+    });
+}
+
+static inline void parallel_nd_dynamic(
+        dim_t D0, const std::function<void(dim_t)> &f) {
+    parallel_dynamic(dnnl_get_current_num_threads(), D0, 0,
+            [&](int, int, dim_t start, dim_t end) {
+                for (dim_t d0 = start; d0 < end; ++d0)
+                    f(d0);
+            });
+}
+static inline void parallel_nd_dynamic(
+        dim_t D0, dim_t D1, const std::function<void(dim_t, dim_t)> &f) {
+    parallel_dynamic(dnnl_get_current_num_threads(), D0 * D1, 0,
+            [&](int, int, dim_t start, dim_t end) {
+                dim_t d0 {0}, d1 {0};
+                utils::nd_iterator_init(start, d0, D0, d1, D1);
+                for (dim_t iwork = start; iwork < end; ++iwork) {
+                    f(d0, d1);
+                    utils::nd_iterator_step(d0, D0, d1, D1);
+                }
+            });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2,
+        const std::function<void(dim_t, dim_t, dim_t)> &f) {
+    parallel_dynamic(dnnl_get_current_num_threads(), D0 * D1 * D2, 0,
+            [&](int, int, dim_t start, dim_t end) {
+                dim_t d0 {0}, d1 {0}, d2 {0};
+                utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2);
+                for (dim_t iwork = start; iwork < end; ++iwork) {
+                    f(d0, d1, d2);
+                    utils::nd_iterator_step(d0, D0, d1, D1, d2, D2);
+                }
+            });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2, dim_t D3,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t)> &f) {
+    parallel_dynamic(dnnl_get_current_num_threads(), D0 * D1 * D2 * D3, 0,
+            [&](int, int, dim_t start, dim_t end) {
+                dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0};
+                utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2, d3, D3);
+                for (dim_t iwork = start; iwork < end; ++iwork) {
+                    f(d0, d1, d2, d3);
+                    utils::nd_iterator_step(d0, D0, d1, D1, d2, D2, d3, D3);
+                }
+            });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2, dim_t D3,
+        dim_t D4,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t)> &f) {
+    parallel_dynamic(dnnl_get_current_num_threads(), D0 * D1 * D2 * D3 * D4, 0,
+            [&](int, int, dim_t start, dim_t end) {
+                dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0}, d4 {0};
+                utils::nd_iterator_init(
+                        start, d0, D0, d1, D1, d2, D2, d3, D3, d4, D4);
+                for (dim_t iwork = start; iwork < end; ++iwork) {
+                    f(d0, d1, d2, d3, d4);
+                    utils::nd_iterator_step(
+                            d0, D0, d1, D1, d2, D2, d3, D3, d4, D4);
+                }
+            });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2, dim_t D3,
+        dim_t D4, dim_t D5,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t, dim_t)>
+                &f) {
+    parallel_dynamic(dnnl_get_current_num_threads(),
+            D0 * D1 * D2 * D3 * D4 * D5, 0,
+            [&](int, int, dim_t start, dim_t end) {
+                dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0}, d4 {0}, d5 {0};
+                utils::nd_iterator_init(
+                        start, d0, D0, d1, D1, d2, D2, d3, D3, d4, D4, d5, D5);
+                for (dim_t iwork = start; iwork < end; ++iwork) {
+                    f(d0, d1, d2, d3, d4, d5);
+                    utils::nd_iterator_step(
+                            d0, D0, d1, D1, d2, D2, d3, D3, d4, D4, d5, D5);
+                }
+            });
+}
+
 /* parallel_nd section */
 static inline void parallel_nd(dim_t D0, const std::function<void(dim_t)> &f) {
+    if (parallel_nd_is_dynamic()) return parallel_nd_dynamic(D0, f);
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), D0);
     if (nthr)
         parallel(nthr, [&](int ithr, int nthr) { for_nd(ithr, nthr, D0, f); });
 }
 static inline void parallel_nd(
         dim_t D0, dim_t D1, const std::function<void(dim_t, dim_t)> &f) {
+    if (parallel_nd_is_dynamic()) return parallel_nd_dynamic(D0, D1, f);
     const dim_t work_amount = D0 * D1;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
     if (nthr)
@@ -605,6 +789,7 @@ static inline void parallel_nd(
 }
 static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2,
         const std::function<void(dim_t, dim_t, dim_t)> &f) {
+    if (parallel_nd_is_dynamic()) return parallel_nd_dynamic(D0, D1, D2, f);
     const dim_t work_amount = D0 * D1 * D2;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
     if (nthr)
@@ -613,6 +798,7 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2,
 }
 static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3,
         const std::function<void(dim_t, dim_t, dim_t, dim_t)> &f) {
+    if (parallel_nd_is_dynamic()) return parallel_nd_dynamic(D0, D1, D2, D3, f);
     const dim_t work_amount = D0 * D1 * D2 * D3;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
     if (nthr)
@@ -622,6 +808,8 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3,
 }
 static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3, dim_t D4,
         const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t)> &f) {
+    if (parallel_nd_is_dynamic())
+        return parallel_nd_dynamic(D0, D1, D2, D3, D4, f);
     const dim_t work_amount = D0 * D1 * D2 * D3 * D4;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
     if (nthr)
@@ -633,6 +821,8 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3, dim_t D4,
         dim_t D5,
         const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t, dim_t)>
                 &f) {
+    if (parallel_nd_is_dynamic())
+        return parallel_nd_dynamic(D0, D1, D2, D3, D4, D5, f);
     const dim_t work_amount = D0 * D1 * D2 * D3 * D4 * D5;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
     if (nthr)
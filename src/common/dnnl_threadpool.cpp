@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2022 Intel Corporation
+* Copyright 2022-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -18,8 +18,11 @@
 
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 
+#include <new>
+
 #include "oneapi/dnnl/dnnl_threadpool.h"
 
+#include "builtin_threadpool.hpp"
 #include "c_types_map.hpp"
 #include "dnnl_thread.hpp"
 #include "utils.hpp"
@@ -39,4 +42,25 @@ dnnl_status_t dnnl_threadpool_interop_get_max_concurrency(
     return status::success;
 }
 
+dnnl_status_t dnnl_threadpool_interop_threadpool_create(
+        void **threadpool, int num_threads, int pin_threads) {
+    using namespace dnnl::impl;
+    using dnnl::threadpool_interop::threadpool_iface;
+    if (threadpool == nullptr) return status::invalid_arguments;
+
+    auto *tp = new (std::nothrow)
+            builtin_threadpool_t(num_threads, pin_threads != 0);
+    if (tp == nullptr) return status::out_of_memory;
+    *threadpool = static_cast<threadpool_iface *>(tp);
+    return status::success;
+}
+
+dnnl_status_t dnnl_threadpool_interop_threadpool_destroy(void *threadpool) {
+    using namespace dnnl::impl;
+    using dnnl::threadpool_interop::threadpool_iface;
+    delete static_cast<builtin_threadpool_t *>(
+            static_cast<threadpool_iface *>(threadpool));
+    return status::success;
+}
+
 #endif
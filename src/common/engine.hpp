@@ -107,6 +107,18 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
         return dnnl::impl::status::success;
     }
 
+    /** return the pool of pinned host buffers used to stage transfers
+     * between host and device memory, nullptr if the engine has none */
+    virtual dnnl::impl::host_staging_pool_t *get_host_staging_pool() {
+        return nullptr;
+    }
+
+    /** return the pool of device memory used for the buffers allocated by
+     * the library, nullptr if the engine has none */
+    virtual dnnl::impl::device_memory_pool_t *get_device_memory_pool() {
+        return nullptr;
+    }
+
     /* implementation section */
 
     /** return the list of reorder implementations. engine guarantees to return
@@ -149,6 +161,10 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
     }
 
     virtual bool mayiuse_system_memory_allocators() const { return false; }
+    // Returns true when memory objects allocated on the engine are placed in
+    // memory shared with the host, so that CPU engines can use them without
+    // copies. Enabled on integrated GPUs with ONEDNN_GPU_ZERO_COPY=1.
+    virtual bool use_zero_copy_memory() const { return false; }
     virtual bool mayiuse_f16_accumulator_with_f16() const { return false; }
 
     const dnnl::impl::engine_impl_t *impl() const { return impl_.get(); }
@@ -0,0 +1,191 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "exec_trace.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace exec_trace {
+
+namespace {
+
+// A single-producer ring buffer. Only the owning thread writes records; the
+// head is published with release semantics so that a dump observes complete
+// records for all slots that are not being overwritten at the same time.
+struct ring_t {
+    ring_t(size_t capacity, uint32_t thread_id)
+        : records(capacity), mask(capacity - 1), thread_id(thread_id) {}
+
+    void push(const record_t &r) {
+        const uint64_t h = head.load(std::memory_order_relaxed);
+        records[h & mask] = r;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    std::vector<record_t> records;
+    const uint64_t mask;
+    const uint32_t thread_id;
+    std::atomic<uint64_t> head {0};
+};
+
+const std::string &get_file_name() {
+    static const std::string name = getenv_path_user("VERBOSE_TRACE_FILE");
+    return name;
+}
+
+struct primitive_entry_t {
+    primitive_kind_t kind;
+    std::string info;
+};
+
+struct registry_t {
+    static registry_t &get() {
+        // Intentionally leaked: threads may execute primitives while static
+        // objects are destroyed, and the atexit dump needs the buffers.
+        static registry_t *registry = new registry_t();
+        return *registry;
+    }
+
+    ring_t *create_ring() {
+        std::lock_guard<std::mutex> lock(mutex);
+        rings.emplace_back(
+                new ring_t(capacity, static_cast<uint32_t>(rings.size())));
+        return rings.back().get();
+    }
+
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ring_t>> rings;
+    std::vector<primitive_entry_t> primitives;
+    size_t capacity;
+
+private:
+    registry_t() {
+        // The number of records kept per thread, rounded up to a power of two.
+        const int n = getenv_int_user("VERBOSE_TRACE_SIZE", default_capacity);
+        capacity = 1;
+        while (capacity < static_cast<size_t>(nstl::max(n, 1)))
+            capacity <<= 1;
+
+        if (!get_file_name().empty()) std::atexit(dump_at_exit);
+    }
+
+    static void dump_at_exit() { dump(get_file_name().c_str()); }
+
+    static constexpr int default_capacity = 1 << 14;
+};
+
+ring_t *get_thread_ring() {
+    thread_local ring_t *ring = nullptr;
+    if (!ring) ring = registry_t::get().create_ring();
+    return ring;
+}
+
+bool write_all(FILE *f, const void *data, size_t size) {
+    return size == 0 || std::fwrite(data, 1, size, f) == size;
+}
+
+} // namespace
+
+bool is_enabled(primitive_kind_t kind) {
+    return get_verbose(verbose_t::exec_trace, prim_kind2_comp_kind(kind));
+}
+
+uint64_t get_time_ns() {
+    using namespace std::chrono;
+    return static_cast<uint64_t>(
+            duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
+                    .count());
+}
+
+uint32_t register_primitive(primitive_kind_t kind, const char *info) {
+    auto &registry = registry_t::get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.primitives.push_back({kind, info ? info : ""});
+    // Id 0 is reserved for primitives that are not registered yet.
+    return static_cast<uint32_t>(registry.primitives.size());
+}
+
+void record(uint32_t primitive_id, uint64_t start_ns, uint64_t end_ns,
+        status_t status) {
+    ring_t *ring = get_thread_ring();
+    ring->push({start_ns, end_ns, primitive_id, ring->thread_id,
+            static_cast<int32_t>(status), 0});
+}
+
+status_t dump(const char *path) {
+    if (path == nullptr) return status::invalid_arguments;
+
+    auto &registry = registry_t::get();
+    std::vector<primitive_entry_t> primitives;
+    std::vector<record_t> records;
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        primitives = registry.primitives;
+        for (const auto &ring : registry.rings) {
+            const uint64_t head = ring->head.load(std::memory_order_acquire);
+            const uint64_t n = nstl::min<uint64_t>(head, ring->mask + 1);
+            for (uint64_t i = head - n; i < head; i++)
+                records.push_back(ring->records[i & ring->mask]);
+        }
+    }
+
+    FILE *f = fopen(path, "wb");
+    if (!f) return status::runtime_error;
+
+    header_t header {};
+    std::memcpy(header.magic, "DNNLTRC", sizeof("DNNLTRC"));
+    header.version = 1;
+    header.record_size = sizeof(record_t);
+    header.n_primitives = primitives.size();
+    header.n_records = records.size();
+
+    bool ok = write_all(f, &header, sizeof(header));
+    for (size_t i = 0; ok && i < primitives.size(); i++) {
+        const auto &p = primitives[i];
+        primitive_info_t info {static_cast<uint32_t>(i + 1),
+                static_cast<int32_t>(p.kind),
+                static_cast<uint32_t>(p.info.size()), 0};
+        ok = write_all(f, &info, sizeof(info))
+                && write_all(f, p.info.data(), p.info.size());
+    }
+    ok = ok && write_all(f, records.data(), records.size() * sizeof(record_t));
+    ok = std::fclose(f) == 0 && ok;
+    return ok ? status::success : status::runtime_error;
+}
+
+} // namespace exec_trace
+} // namespace impl
+} // namespace dnnl
+
+dnnl::impl::status_t dnnl_verbose_trace_dump(const char *path) {
+    return dnnl::impl::exec_trace::dump(path);
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EXEC_TRACE_HPP
+#define COMMON_EXEC_TRACE_HPP
+
+#include <cstdint>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace exec_trace {
+
+// Binary execution trace enabled with `ONEDNN_VERBOSE=trace_exec`. Instead of
+// formatting a message on every execution, the library stores a fixed-size
+// record per execution in a ring buffer owned by the executing thread. A
+// thread only writes to its own buffer, so recording takes no locks. The
+// buffers are written out in the format below by dnnl_verbose_trace_dump()
+// or at exit when `ONEDNN_VERBOSE_TRACE_FILE` is set.
+//
+// File layout, all values are little-endian on the common platforms:
+//   header_t
+//   header_t::n_primitives x { primitive_info_t, char info[info_len] }
+//   header_t::n_records x record_t, ordered by thread and then by time
+
+struct header_t {
+    char magic[8]; // "DNNLTRC"
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t n_primitives;
+    uint64_t n_records;
+};
+
+struct primitive_info_t {
+    uint32_t id;
+    int32_t kind; // dnnl_primitive_kind_t
+    uint32_t info_len; // length of the verbose string that follows
+    uint32_t reserved;
+};
+
+struct record_t {
+    uint64_t start_ns; // steady clock time when execution began
+    uint64_t end_ns; // steady clock time when execution was submitted
+    uint32_t primitive_id; // refers to primitive_info_t::id
+    uint32_t thread_id; // sequential id of the executing thread
+    int32_t status; // dnnl_status_t returned by the execution
+    uint32_t reserved;
+};
+
+static_assert(sizeof(record_t) == 32, "unexpected trace record size");
+
+bool is_enabled(primitive_kind_t kind);
+
+uint64_t get_time_ns();
+
+// Assigns an id to a primitive. The verbose string is stored once per
+// primitive so that the records can stay small.
+uint32_t register_primitive(primitive_kind_t kind, const char *info);
+
+void record(uint32_t primitive_id, uint64_t start_ns, uint64_t end_ns,
+        status_t status);
+
+status_t dump(const char *path);
+
+} // namespace exec_trace
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -25,6 +25,7 @@
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/gemm/gemm.hpp"
+#include "cpu/gemm/gemm_pack.hpp"
 #endif
 
 #include "common/bfloat16.hpp"
@@ -46,6 +47,16 @@ const char *c2f_offsetC(const char *offC) {
     return offC;
 }
 
+char c2f_identifier(char identifier) {
+    switch (identifier) {
+        case 'A':
+        case 'a': return 'B';
+        case 'B':
+        case 'b': return 'A';
+        default: return identifier;
+    }
+}
+
 std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
     std::string s_ = std::to_string(M);
     s_ += "x";
@@ -157,6 +168,122 @@ extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa,
 #endif
 }
 
+// The packed GEMM functions take the matrices in column-major order. A
+// row-major multiplication is computed as the column-major one of the
+// transposed matrices, C**T = op(B)**T * op(A)**T, so A and B swap their
+// roles, including the identifier of the packed matrix.
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#define PACK_GET_SIZE(func) \
+    const char id_f = c2f_identifier(identifier); \
+    return cpu::func(&id_f, &transb, &transa, &N, &M, &K, &ldb, &lda, size);
+#define PACK(func, src, dst) \
+    const char id_f = c2f_identifier(identifier); \
+    return cpu::func( \
+            &id_f, &transb, &transa, &N, &M, &K, &ldb, &lda, src, dst);
+#else
+#define PACK_GET_SIZE(func) return dnnl::impl::status::unimplemented;
+#define PACK(func, src, dst) return dnnl::impl::status::unimplemented;
+#endif
+
+dnnl_status_t dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+    PACK_GET_SIZE(sgemm_pack_get_size);
+}
+
+dnnl_status_t dnnl_sgemm_pack(char identifier, char transa, char transb,
+        dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, const float *src,
+        float *dst) {
+    PACK(sgemm_pack, src, dst);
+}
+
+dnnl_status_t dnnl_sgemm_compute(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, const float *A, dim_t lda, const float *B, dim_t ldb,
+        float beta, float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::sgemm_compute(
+            &transb, &transa, &N, &M, &K, B, &ldb, A, &lda, &beta, C, &ldc);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_pack_get_size(char identifier,
+        char transa, char transb, dim_t M, dim_t N, dim_t K, dim_t lda,
+        dim_t ldb, size_t *size) {
+    PACK_GET_SIZE(gemm_bf16bf16f32_pack_get_size);
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const uint16_t *src, uint16_t *dst) {
+    PACK(gemm_bf16bf16f32_pack, reinterpret_cast<const bfloat16_t *>(src),
+            reinterpret_cast<bfloat16_t *>(dst));
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_compute(char transa, char transb,
+        dim_t M, dim_t N, dim_t K, const uint16_t *A, dim_t lda,
+        const uint16_t *B, dim_t ldb, float beta, float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_bf16bf16f32_compute(&transb, &transa, &N, &M, &K,
+            reinterpret_cast<const bfloat16_t *>(B), &ldb,
+            reinterpret_cast<const bfloat16_t *>(A), &lda, &beta, C, &ldc);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+    PACK_GET_SIZE(gemm_s8u8s32_pack_get_size);
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const void *src, void *dst) {
+    PACK(gemm_s8u8s32_pack, src, dst);
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, const uint8_t *A, dim_t lda,
+        const int8_t *B, dim_t ldb, float beta, int32_t *C, dim_t ldc,
+        const int32_t *co) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_s8u8s32_compute(&transb, &transa, c2f_offsetC(&offsetc),
+            &N, &M, &K, B, &ldb, A, &lda, &beta, C, &ldc, co);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+    PACK_GET_SIZE(gemm_s8s8s32_pack_get_size);
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const void *src, void *dst) {
+    PACK(gemm_s8s8s32_pack, src, dst);
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_compute(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, const int8_t *A, dim_t lda,
+        const int8_t *B, dim_t ldb, float beta, int32_t *C, dim_t ldc,
+        const int32_t *co) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_s8s8s32_compute(&transb, &transa, c2f_offsetC(&offsetc),
+            &N, &M, &K, B, &ldb, A, &lda, &beta, C, &ldc, co);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+#undef PACK_GET_SIZE
+#undef PACK
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
 dnnl_status_t dnnl_threadpool_interop_sgemm(char transa, char transb, dim_t M,
         dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/host_staging_pool.hpp"
+
+namespace dnnl {
+namespace impl {
+
+constexpr int host_staging_pool_t::window_size;
+constexpr size_t host_staging_pool_t::max_cached_size;
+constexpr size_t host_staging_pool_t::granularity;
+
+void *host_staging_pool_t::acquire(
+        size_t size, const alloc_func_t &alloc, const free_func_t &free) {
+    if (size == 0) return nullptr;
+
+    std::vector<buffer_t> to_free;
+    void *ptr = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (++window_requests_ == window_size) {
+            prev_window_peak_ = window_peak_;
+            window_peak_ = in_use_size_;
+            window_requests_ = 0;
+        }
+
+        // Best fit: the smallest cached buffer that is not more than twice
+        // as large as requested, to not hold large buffers for small maps.
+        size_t best = cached_.size();
+        for (size_t i = 0; i < cached_.size(); i++) {
+            const size_t s = cached_[i].size;
+            if (s < size || s / 2 > size) continue;
+            if (best == cached_.size() || s < cached_[best].size) best = i;
+        }
+
+        if (best != cached_.size()) {
+            buffer_t buf = std::move(cached_[best]);
+            cached_.erase(cached_.begin() + best);
+            cached_size_ -= buf.size;
+            ptr = buf.ptr;
+            in_use_size_ += buf.size;
+            in_use_.emplace(ptr, std::move(buf));
+        } else {
+            const size_t alloc_size = utils::rnd_up(size, granularity);
+            ptr = alloc(alloc_size);
+            if (!ptr) return nullptr;
+            in_use_size_ += alloc_size;
+            in_use_.emplace(ptr, buffer_t {ptr, alloc_size, free});
+        }
+        window_peak_ = nstl::max(window_peak_, in_use_size_);
+
+        // Drop the oldest buffers that the recent usage does not justify.
+        const size_t capacity = get_capacity();
+        while (!cached_.empty() && cached_size_ > capacity) {
+            cached_size_ -= cached_.front().size;
+            to_free.push_back(std::move(cached_.front()));
+            cached_.erase(cached_.begin());
+        }
+    }
+
+    // The runtime calls may synchronize, so they are done without the lock.
+    for (auto &buf : to_free)
+        buf.free(buf.ptr);
+    return ptr;
+}
+
+void host_staging_pool_t::release(void *ptr) {
+    if (!ptr) return;
+
+    buffer_t buf {};
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = in_use_.find(ptr);
+        assert(it != in_use_.end());
+        if (it == in_use_.end()) return;
+        buf = std::move(it->second);
+        in_use_.erase(it);
+        in_use_size_ -= buf.size;
+
+        if (cached_size_ + buf.size <= get_capacity()) {
+            cached_size_ += buf.size;
+            cached_.push_back(std::move(buf));
+            return;
+        }
+    }
+    buf.free(buf.ptr);
+}
+
+void host_staging_pool_t::clear() {
+    std::vector<buffer_t> to_free;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        to_free.swap(cached_);
+        cached_size_ = 0;
+        prev_window_peak_ = 0;
+        window_peak_ = in_use_size_;
+        window_requests_ = 0;
+    }
+    for (auto &buf : to_free)
+        buf.free(buf.ptr);
+}
+
+size_t host_staging_pool_t::cached_size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cached_size_;
+}
+
+size_t host_staging_pool_t::get_capacity() const {
+    // Keep enough memory to serve the peak usage seen in the recent
+    // requests; the buffers in use are accounted in the peak as well.
+    const size_t peak = nstl::max(window_peak_, prev_window_peak_);
+    return nstl::min(peak, max_cached_size);
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
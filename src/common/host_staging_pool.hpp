@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_HOST_STAGING_POOL_HPP
+#define COMMON_HOST_STAGING_POOL_HPP
+
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// A cache of pinned host buffers used to stage host <-> device transfers,
+// e.g. when device memory is mapped. Allocating and pinning host memory is
+// expensive, so released buffers are kept for later transfers of a similar
+// size. The amount of cached memory follows the peak usage over the recent
+// requests, so the pool shrinks back when large transfers stop.
+//
+// The pool does not know how to allocate memory: the runtime specific
+// allocation and deallocation functions are passed on each request. The
+// owner must call clear() while the buffers can still be freed, i.e. before
+// the context they were allocated in is destroyed.
+struct host_staging_pool_t {
+    using alloc_func_t = std::function<void *(size_t)>;
+    using free_func_t = std::function<void(void *)>;
+
+    host_staging_pool_t() = default;
+    ~host_staging_pool_t() { clear(); }
+
+    // Returns a buffer of at least `size` bytes, allocated with `alloc` when
+    // none of the cached buffers fits.
+    void *acquire(size_t size, const alloc_func_t &alloc,
+            const free_func_t &free);
+
+    // Returns the buffer obtained from acquire() to the pool. The buffer is
+    // freed if the pool holds more memory than the recent usage needs.
+    void release(void *ptr);
+
+    // Frees all the cached buffers. Buffers that are still in use are freed
+    // on release.
+    void clear();
+
+    size_t cached_size() const;
+
+private:
+    struct buffer_t {
+        void *ptr;
+        size_t size;
+        free_func_t free;
+    };
+
+    // The number of requests after which the usage peak is re-evaluated.
+    static constexpr int window_size = 64;
+    // The upper bound on the memory kept in the pool.
+    static constexpr size_t max_cached_size = size_t(256) << 20;
+    // Allocations are rounded up to improve reuse between similar sizes.
+    static constexpr size_t granularity = size_t(64) << 10;
+
+    size_t get_capacity() const;
+
+    mutable std::mutex mutex_;
+    std::vector<buffer_t> cached_;
+    std::unordered_map<void *, buffer_t> in_use_;
+    size_t cached_size_ = 0;
+    size_t in_use_size_ = 0;
+    // Peak of the memory in use during the current and the previous windows.
+    size_t window_peak_ = 0;
+    size_t prev_window_peak_ = 0;
+    int window_requests_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(host_staging_pool_t);
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -171,8 +171,16 @@ status_t ip_attr_check(const inner_product_desc_t &desc, const engine_t *engine,
         }
     } else {
         auto bwd_attr_mask = smask_t::fpmath_mode | smask_t::accumulation_mode;
+        // A sum post-op of backward by weights accumulates the diff weights
+        // and the diff bias, as for convolution.
+        const bool is_bwd_w = desc.prop_kind == prop_kind::backward_weights;
+        if (is_bwd_w && engine->kind() == engine_kind::cpu)
+            bwd_attr_mask |= smask_t::post_ops;
         VCHECK_IP_UNIMPL(attr->has_default_values(bwd_attr_mask),
                 VERBOSE_UNSUPPORTED_ATTR);
+        VCHECK_IP_UNIMPL(IMPLICATION(!attr->post_ops_.has_default_values(),
+                                 attr->post_ops_.is_plain_sum()),
+                VERBOSE_UNSUPPORTED_POSTOP);
     }
 
     return status::success;
@@ -79,6 +79,7 @@ void primitive_task_start(primitive_kind_t kind) {
             CASE(softmax),
             CASE(layer_normalization),
             CASE(group_normalization),
+            CASE(embedding_bag),
             CASE(sdpa),
     };
 #undef CASE
@@ -97,6 +98,13 @@ primitive_kind_t primitive_task_get_current_kind() {
     return thread_primitive_kind;
 }
 
+void primitive_task_add_imbalance(double imbalance) {
+    if (thread_primitive_kind == primitive_kind::undefined) return;
+    static __itt_string_handle *key = __itt_string_handle_create("imbalance");
+    __itt_metadata_add(itt_domain(), __itt_null, key, __itt_metadata_double, 1,
+            &imbalance);
+}
+
 void primitive_task_end() {
     if (thread_primitive_kind != primitive_kind::undefined) {
         __itt_task_end(itt_domain());
@@ -110,6 +118,9 @@ void primitive_task_start(primitive_kind_t kind) {
 primitive_kind_t primitive_task_get_current_kind() {
     return primitive_kind::undefined;
 }
+void primitive_task_add_imbalance(double imbalance) {
+    UNUSED(imbalance);
+}
 void primitive_task_end() {}
 #endif
 
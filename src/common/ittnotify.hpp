@@ -29,7 +29,9 @@ namespace itt {
 typedef enum { // NOLINT(modernize-use-using)
     __itt_task_level_none = 0,
     __itt_task_level_low,
-    __itt_task_level_high
+    __itt_task_level_high,
+    // Primitive tasks carry the imbalance of their parallel regions.
+    __itt_task_level_metrics
 } __itt_task_level;
 
 struct itt_task_level_t {
@@ -40,6 +42,9 @@ struct itt_task_level_t {
 bool get_itt(__itt_task_level level);
 void primitive_task_start(primitive_kind_t kind);
 primitive_kind_t primitive_task_get_current_kind();
+// Attaches the imbalance of the parallel regions to the current primitive
+// task, see parallel_profiler::region_t::imbalance().
+void primitive_task_add_imbalance(double imbalance);
 void primitive_task_end();
 } // namespace itt
 } // namespace impl
@@ -38,7 +38,11 @@ struct iface_t::cache_t {
     using result_t = iface_t::result_t;
     using create_func_t = iface_t::create_func_t;
 
-    cache_t(int capacity) : cache_(capacity) {};
+    cache_t(int capacity)
+        : cache_(capacity,
+                [this](const key_t &, const std::shared_future<result_t> &) {
+                    counters_.evictions++;
+                }) {};
 
     ~cache_t() = default;
 
@@ -53,10 +57,23 @@ struct iface_t::cache_t {
         // Always try to fetch the kernel from the cache. There's no scenario
         // when forcing creation for a kernel is required.
         constexpr bool force_create = false;
-        return cache_.get_or_create(key, create, create_context, force_create);
+        return cache_.get_or_create(
+                key, create, create_context, force_create, &counters_);
     }
 
+    void get_stats(cache_stats_t &stats) const {
+        stats = cache_stats_t();
+        stats.hits = counters_.hits.load();
+        stats.misses = counters_.misses.load();
+        stats.evictions = counters_.evictions.load();
+        stats.creation_time_ms = counters_.creation_time_ns.load() * 1e-6;
+        stats.size = cache_.get_size();
+    }
+
+    void reset_stats() { counters_.reset(); }
+
 private:
+    utils::cache_counters_t counters_;
     utils::lru_cache_t<key_t, value_t, result_t> cache_;
 };
 
@@ -83,6 +100,14 @@ int iface_t::get_size() const {
     return cache_.get_size();
 }
 
+void iface_t::get_stats(cache_stats_t &stats) const {
+    cache_.get_stats(stats);
+}
+
+void iface_t::reset_stats() {
+    cache_.reset_stats();
+}
+
 iface_t::result_t iface_t::get_or_create(
         const key_t &key, create_func_t create, void *create_context) {
     auto r = cache_.get_or_create(key, create, create_context);
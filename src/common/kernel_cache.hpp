@@ -126,6 +126,9 @@ struct iface_t {
     int get_capacity() const;
     int get_size() const;
 
+    void get_stats(cache_stats_t &stats) const;
+    void reset_stats();
+
     result_t get_or_create(
             const key_t &key, create_func_t create, void *create_context);
 
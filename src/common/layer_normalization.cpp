@@ -52,7 +52,8 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
                          & ~(normalization_flags::use_global_stats
                                  | normalization_flags::use_scale
                                  | normalization_flags::use_shift
-                                 | normalization_flags::rms_norm))
+                                 | normalization_flags::rms_norm
+                                 | normalization_flags::fuse_add_norm))
                     == 0,
             VERBOSE_BAD_FLAGS);
 
@@ -163,9 +164,26 @@ status_t layer_normalization_attr_check(const layer_normalization_desc_t &desc,
                 || utils::one_of(dst_dt, data_type::s8, data_type::u8);
         if (is_int8) fwd_attr_mask |= smask_t::scales;
 
+        const bool dynamic_quantization = attr->dynamic_quantization_;
+        if (dynamic_quantization)
+            fwd_attr_mask |= smask_t::dynamic_quantization;
+
         VCHECK_LNORM_UNIMPL(attr->has_default_values(fwd_attr_mask, dst_dt),
                 VERBOSE_UNSUPPORTED_ATTR);
 
+        // Check dynamic quantization
+        if (dynamic_quantization) {
+            VCHECK_LNORM_UNIMPL(engine->kind() == engine_kind::cpu,
+                    VERBOSE_BAD_ENGINE_KIND);
+            VCHECK_LNORM(!attr->scales_.has_default_values(DNNL_ARG_DST),
+                    VERBOSE_BAD_PARAM,
+                    "dynamic quantization without dst scales");
+            VCHECK_LNORM(dst_dt == data_type::s8, VERBOSE_INVALID_DATATYPE,
+                    "dst");
+            VCHECK_LNORM_UNIMPL(attr->scales_.has_default_values(DNNL_ARG_SRC),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+        }
+
         // Check scales
         if (!attr->scales_.has_default_values()) {
             static const std::vector<int> supported_args {
@@ -177,8 +195,14 @@ status_t layer_normalization_attr_check(const layer_normalization_desc_t &desc,
             for (int arg : supported_args) {
                 if (attr->scales_.has_default_values(arg)) continue;
 
+                // Computed destination scales have a value per row, i.e.
+                // for every point of the dimensions that are not normalized.
                 const int mask = attr->scales_.get_mask(arg);
-                VCHECK_LNORM_UNIMPL(mask == 0, VERBOSE_UNSUPPORTED_SCALES_CFG);
+                const int row_mask = (1 << (desc.src_desc.ndims - 1)) - 1;
+                VCHECK_LNORM_UNIMPL(dynamic_quantization && arg == DNNL_ARG_DST
+                                ? mask == row_mask
+                                : mask == 0,
+                        VERBOSE_UNSUPPORTED_SCALES_CFG);
             }
 
             // By default, host scalar scales are not supported for GPU
@@ -87,6 +87,9 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     bool skip_mean() const {
         return desc_.flags & normalization_flags::rms_norm;
     }
+    bool fuse_add_norm() const {
+        return desc_.flags & normalization_flags::fuse_add_norm;
+    }
 
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
@@ -180,6 +183,17 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         if (arg == DNNL_ARG_SHIFT)
             return use_shift() ? arg_usage_t::input : arg_usage_t::unused;
 
+        if (arg == DNNL_ARG_SRC_1)
+            return fuse_add_norm() ? arg_usage_t::input : arg_usage_t::unused;
+        if (arg == DNNL_ARG_DST_1)
+            return fuse_add_norm() ? arg_usage_t::output : arg_usage_t::unused;
+
+        // The destination scales are written when they are computed by the
+        // primitive.
+        if (arg == (DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST)
+                && attr()->dynamic_quantization_)
+            return arg_usage_t::output;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -187,7 +201,9 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
             int arg, bool user_input = false) const override {
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_SRC_1: return src_md(3);
             case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_DST_1: return dst_md(3);
             case DNNL_ARG_MEAN: return stats_are_src() ? src_md(1) : dst_md(1);
             case DNNL_ARG_VARIANCE:
                 return stats_are_src() ? src_md(2) : dst_md(2);
@@ -201,6 +217,7 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
             int index = 0, bool user_input = false) const override {
         if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
         if (stats_are_src() && (index == 1 || index == 2)) return &stat_md_;
+        if (fuse_add_norm() && index == 3) return &src_md_;
         return &glob_zero_md;
     }
 
@@ -209,6 +226,7 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
         if (!stats_are_src() && is_training() && (index == 1 || index == 2))
             return &stat_md_;
+        if (fuse_add_norm() && index == 3) return &src_md_;
         return &glob_zero_md;
     }
 
@@ -219,13 +237,16 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
 
     int n_inputs() const override {
         return 1 + (2 - skip_mean()) * stats_are_src() + use_scale()
-                + use_shift() + n_binary_po_inputs();
+                + use_shift() + fuse_add_norm() + n_binary_po_inputs();
     }
     int n_outputs() const override {
         // Originally as '1 + 2 * (!stats_are_src()) * is_training()',
         // had to be worked around MSVC bug not copying inlined bodies
         // of stats_are_src() and is_training().
-        return (!stats_are_src() && is_training()) ? 3 - skip_mean() : 1;
+        // The sum output of the fused residual addition is optional and is
+        // accounted as an extra output at execution.
+        return ((!stats_are_src() && is_training()) ? 3 - skip_mean() : 1)
+                + attr()->dynamic_quantization_;
     }
 
 protected:
@@ -266,7 +287,12 @@ protected:
                 // TODO: disallow non-int8 scales?
                 // const data_type_t dt = arg_md(arg)->data_type;
                 // ok = ok && utils::one_of(dt, s8, u8);
-                ok = ok && scales.get_mask(arg) == 0;
+                // Computed destination scales have a value per row.
+                const bool per_row = arg == DNNL_ARG_DST
+                        && attr()->dynamic_quantization_;
+                ok = ok
+                        && scales.get_mask(arg)
+                                == (per_row ? (1 << (ndims() - 1)) - 1 : 0);
             }
         }
         return ok;
@@ -290,6 +316,9 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
         if (arg == DNNL_ARG_SCALE)
             return use_scale() ? arg_usage_t::input : arg_usage_t::unused;
 
+        if (arg == DNNL_ARG_DIFF_DST_1)
+            return fuse_add_norm() ? arg_usage_t::input : arg_usage_t::unused;
+
         if (arg == DNNL_ARG_DIFF_SRC) return arg_usage_t::output;
 
         if (arg == DNNL_ARG_DIFF_SCALE)
@@ -310,6 +339,7 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
             case DNNL_ARG_SHIFT: return weights_md(0);
             case DNNL_ARG_DIFF_SRC: return diff_src_md(0);
             case DNNL_ARG_DIFF_DST: return diff_dst_md(0, user_input);
+            case DNNL_ARG_DIFF_DST_1: return diff_dst_md(1);
             case DNNL_ARG_DIFF_SCALE:
             case DNNL_ARG_DIFF_SHIFT: return diff_weights_md(0);
             default: return layer_normalization_pd_t::arg_md(arg);
@@ -326,6 +356,7 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
             int index = 0, bool user_input = false) const override {
         if (index == 0)
             return user_input ? &desc()->diff_dst_desc : &diff_dst_md_;
+        if (fuse_add_norm() && index == 1) return &diff_dst_md_;
         return &glob_zero_md;
     }
     const memory_desc_t *diff_src_md(
@@ -344,7 +375,9 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
         return index == 0 ? &diff_scaleshift_md_ : &glob_zero_md;
     }
 
-    int n_inputs() const override { return 4 - skip_mean() + use_scale(); }
+    int n_inputs() const override {
+        return 4 - skip_mean() + use_scale() + fuse_add_norm();
+    }
     int n_outputs() const override {
         return 1
                 + (desc_.prop_kind == prop_kind::backward)
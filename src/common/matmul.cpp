@@ -75,10 +75,66 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
 
     // Matmul supports fpmath mode and accumulation mode
     attr_mask |= smask_t::fpmath_mode | smask_t::accumulation_mode;
+    attr_mask |= smask_t::top_k | smask_t::dst_split;
+
+    const bool dynamic_quantization = attr->dynamic_quantization_;
+    if (dynamic_quantization) attr_mask |= smask_t::dynamic_quantization;
 
     VCHECK_MATMUL_UNIMPL(attr->has_default_values(attr_mask, dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
 
+    // Check dynamic quantization
+    if (dynamic_quantization) {
+        VCHECK_MATMUL_UNIMPL(engine->kind() == engine_kind::cpu,
+                VERBOSE_BAD_ENGINE_KIND);
+        VCHECK_MATMUL(!attr->scales_.has_default_values(DNNL_ARG_SRC),
+                VERBOSE_BAD_PARAM, "dynamic quantization without src scales");
+        VCHECK_MATMUL(utils::one_of(src_dt, data_type::f32, data_type::bf16),
+                VERBOSE_INVALID_DATATYPE, "src");
+        VCHECK_MATMUL_UNIMPL(wei_dt == data_type::s8, VERBOSE_UNSUPPORTED_DT);
+    }
+
+    // Check top-k
+    if (attr->top_k_ != 0) {
+        const auto &dst_desc = desc.dst_desc;
+        const dim_t N = dst_desc.dims[dst_desc.ndims - 1];
+        VCHECK_MATMUL_UNIMPL(engine->kind() == engine_kind::cpu,
+                VERBOSE_BAD_ENGINE_KIND);
+        VCHECK_MATMUL_UNIMPL(!memory_desc_wrapper(dst_desc).has_runtime_dims(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCHECK_MATMUL(attr->top_k_ <= N, VERBOSE_BAD_PARAM, "top-k");
+        VCHECK_MATMUL(N <= INT32_MAX, VERBOSE_BAD_PARAM, "top-k");
+        VCHECK_MATMUL_UNIMPL(
+                attr->dropout_.has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    }
+
+    // Check dst split
+    if (!attr->dst_split_.has_default_values()) {
+        const auto &dst_desc = desc.dst_desc;
+        VCHECK_MATMUL_UNIMPL(engine->kind() == engine_kind::cpu,
+                VERBOSE_BAD_ENGINE_KIND);
+        VCHECK_MATMUL(
+                dst_desc.ndims == 2, VERBOSE_BAD_NDIMS, "dst", dst_desc.ndims);
+        VCHECK_MATMUL_UNIMPL(!memory_desc_wrapper(dst_desc).has_runtime_dims(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCHECK_MATMUL_UNIMPL(attr->top_k_ == 0
+                        && attr->dropout_.has_default_values(),
+                VERBOSE_UNSUPPORTED_ATTR);
+        dim_t n = 0;
+        for (const auto &md : attr->dst_split_.mds_) {
+            const memory_desc_wrapper part_d(md);
+            VCHECK_MATMUL(part_d.data_type() == dst_desc.data_type,
+                    VERBOSE_INCONSISTENT_DT, "dst split", "dst");
+            VCHECK_MATMUL(!part_d.has_runtime_dims_or_strides(),
+                    VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+            VCHECK_MATMUL(md.dims[0] * md.dims[2] == dst_desc.dims[0],
+                    VERBOSE_INCONSISTENT_DIM, "dst split", 0, "dst", 0);
+            n += md.dims[1] * md.dims[3];
+        }
+        VCHECK_MATMUL(n == dst_desc.dims[1], VERBOSE_INCONSISTENT_DIM,
+                "dst split", 1, "dst", 1);
+    }
+
     const int ndims_src = desc.src_desc.ndims;
     const int ndims_wei = desc.weights_desc.ndims;
     const int m_idx = ndims_src - 2;
@@ -112,10 +168,21 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
         if (!sc.has_default_values(DNNL_ARG_SRC)) {
             const int mask_src = sc.get_mask(DNNL_ARG_SRC);
 
-            VCHECK_MATMUL_UNIMPL(
-                    utils::one_of(mask_src, 0, src_qmask_K,
-                            src_qmask_M + src_qmask_K, full_tensor_mask),
-                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            // Computed source scales have a value per row, i.e. for every
+            // point of the dimensions but K.
+            const int src_qmask_rows = full_tensor_mask - src_qmask_K;
+            if (dynamic_quantization) {
+                VCHECK_MATMUL_UNIMPL(mask_src == src_qmask_rows
+                                && sc.get(DNNL_ARG_SRC).has_default_groups()
+                                && sc.get_data_type(DNNL_ARG_SRC)
+                                        == data_type::f32,
+                        VERBOSE_UNSUPPORTED_SCALES_CFG);
+            } else {
+                VCHECK_MATMUL_UNIMPL(
+                        utils::one_of(mask_src, 0, src_qmask_K,
+                                src_qmask_M + src_qmask_K, full_tensor_mask),
+                        VERBOSE_UNSUPPORTED_SCALES_CFG);
+            }
 
             if (!sc.get(DNNL_ARG_SRC).has_default_groups()) {
                 if (mask_src & src_qmask_K)
@@ -378,6 +445,45 @@ status_t matmul_desc_init(matmul_desc_t *matmul_desc,
                 VERBOSE_BAD_PARAM, "reduce_kind");
     }
 
+    // Grouped matmul: src [M, K] and dst [M, N] are made of the same groups
+    // of rows, and each group is multiplied by its own [K, N] matrix of the
+    // weights [G, K, N].
+    const auto is_grouped = [](const memory_desc_t *md) {
+        return md->format_kind == format_kind::sparse
+                && md->format_desc.sparse_desc.encoding
+                == sparse_encoding::grouped;
+    };
+    if (is_grouped(src_desc) || is_grouped(dst_desc)) {
+        VCHECK_MATMUL(is_grouped(src_desc) && is_grouped(dst_desc),
+                VERBOSE_UNSUPPORTED_SPARSE_CFG);
+        VCHECK_MATMUL(!is_grouped(weights_desc), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+        VCHECK_MATMUL_UNIMPL(!bias_desc && !reduce_desc,
+                VERBOSE_UNSUPPORTED_BIAS_CFG);
+        const dim_t ngroups = src_desc->format_desc.sparse_desc.nnz;
+        VCHECK_MATMUL(dst_desc->format_desc.sparse_desc.nnz == ngroups,
+                VERBOSE_UNSUPPORTED_SPARSE_CFG);
+        VCHECK_MATMUL(everyone_is(2, src_desc->ndims, dst_desc->ndims),
+                VERBOSE_INCONSISTENT_NDIMS, "src", "dst");
+        VCHECK_MATMUL(weights_desc->ndims == 3, VERBOSE_BAD_NDIMS, "weights",
+                weights_desc->ndims);
+        VCHECK_MATMUL(weights_desc->dims[0] == ngroups, VERBOSE_BAD_DIM,
+                "weights", 0);
+        VCHECK_MATMUL(dst_desc->dims[0] == src_desc->dims[0],
+                VERBOSE_INCONSISTENT_DIM, "dst", 0, "src", 0);
+        VCHECK_MATMUL(dst_desc->dims[1] == weights_desc->dims[2],
+                VERBOSE_INCONSISTENT_DIM, "dst", 1, "weights", 2);
+        VCHECK_MATMUL(src_desc->dims[1] == weights_desc->dims[1],
+                VERBOSE_INCONSISTENT_DIM, "src", 1, "weights", 1);
+
+        op_d.accum_data_type = types::default_accum_data_type(
+                src_desc->data_type, weights_desc->data_type,
+                dst_desc->data_type, prop_kind::forward);
+        VCHECK_MATMUL(op_d.accum_data_type != data_type::undef,
+                VERBOSE_INVALID_DATATYPE, "accumulation");
+        *matmul_desc = op_d;
+        return status::success;
+    }
+
     const bool with_bias = op_d.bias_desc.ndims != 0;
     const bool with_reduce = op_d.reduce_desc.ndims != 0;
     const int ndims = dst_desc->ndims;
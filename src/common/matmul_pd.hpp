@@ -23,6 +23,7 @@
 
 #include "c_types_map.hpp"
 #include "primitive_desc.hpp"
+#include "tag_traits.hpp"
 #include "utils.hpp"
 
 #define VDISPATCH_MATMUL(cond, msg, ...) \
@@ -66,7 +67,22 @@ struct matmul_pd_t : public primitive_desc_t {
 
         if (arg == DNNL_ARG_REDUCE)
             return with_reduce() ? arg_usage_t::output : arg_usage_t::unused;
-        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+        // The destination is not written when only the top-k values are
+        // kept or when its columns are split into parts.
+        if (arg == DNNL_ARG_DST)
+            return with_top_k() || with_dst_split() ? arg_usage_t::unused
+                                                    : arg_usage_t::output;
+        if (arg >= DNNL_ARG_MULTIPLE_DST
+                && arg < DNNL_ARG_MULTIPLE_DST + attr()->dst_split_.nparts())
+            return arg_usage_t::output;
+        if (utils::one_of(arg, DNNL_ARG_ATTR_TOP_K_VALUES,
+                    DNNL_ARG_ATTR_TOP_K_INDICES))
+            return with_top_k() ? arg_usage_t::output : arg_usage_t::unused;
+        // The source scales are written when they are computed by the
+        // primitive.
+        if (arg == (DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC)
+                && attr()->dynamic_quantization_)
+            return arg_usage_t::output;
 
         return primitive_desc_t::arg_usage(arg);
     }
@@ -79,8 +95,15 @@ struct matmul_pd_t : public primitive_desc_t {
             case DNNL_ARG_BIAS: return weights_md(1);
             case DNNL_ARG_DST: return dst_md(0, user_input);
             case DNNL_ARG_REDUCE: return reduce_md(0);
-            default: return primitive_desc_t::arg_md(arg);
+            case DNNL_ARG_ATTR_TOP_K_VALUES: return &top_k_values_md_;
+            case DNNL_ARG_ATTR_TOP_K_INDICES: return &top_k_indices_md_;
+            default: break;
         }
+        const auto &parts = attr()->dst_split_.mds_;
+        if (arg >= DNNL_ARG_MULTIPLE_DST
+                && arg < DNNL_ARG_MULTIPLE_DST + (int)parts.size())
+            return &parts[arg - DNNL_ARG_MULTIPLE_DST];
+        return primitive_desc_t::arg_md(arg);
     }
 
     const memory_desc_t *src_md(
@@ -112,7 +135,12 @@ struct matmul_pd_t : public primitive_desc_t {
     int n_inputs() const override {
         return 2 + with_bias() + n_binary_po_inputs() + n_prelu_po_inputs();
     }
-    int n_outputs() const override { return 1 + with_reduce(); }
+    int n_outputs() const override {
+        const int n_dst = with_dst_split() ? attr()->dst_split_.nparts()
+                : with_top_k()                  ? 2
+                                                : 1 + with_reduce();
+        return n_dst + attr()->dynamic_quantization_;
+    }
 
     bool has_zero_dim_memory() const {
         return memory_desc_wrapper(src_md(0)).has_zero_dim()
@@ -130,6 +158,10 @@ struct matmul_pd_t : public primitive_desc_t {
 
     bool with_bias() const { return bias_md_.ndims != 0; }
     bool with_reduce() const { return reduce_md_.ndims != 0; }
+    bool with_top_k() const { return attr()->top_k_ != 0; }
+    bool with_dst_split() const {
+        return !attr()->dst_split_.has_default_values();
+    }
 
     matmul_reduce_kind_t reduce_kind() const { return desc_.reduce_kind; }
 
@@ -185,6 +217,10 @@ struct matmul_pd_t : public primitive_desc_t {
 
     int dst_qmask_M() const { return src_qmask_M(); }
 
+    // Whether the implementation supports source scales with a value per row,
+    // i.e. with a mask over all the dimensions but K, e.g. per token.
+    virtual bool src_scales_per_row_ok() const { return false; }
+
     virtual bool attr_scales_ok(const std::vector<int> &supported_args
             = {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST}) const {
         const auto &scales = attr()->scales_;
@@ -213,6 +249,13 @@ struct matmul_pd_t : public primitive_desc_t {
                 ok = ok
                         && IMPLICATION((mask & wei_qmask_K()),
                                 is_decompression_or_dynquant);
+            } else if (arg == DNNL_ARG_SRC
+                    && (attr()->dynamic_quantization_
+                            || (mask == full_tensor_mask() - src_qmask_K()
+                                    && src_scales_per_row_ok()))) {
+                // Computed source scales have a value per row.
+                ok = ok && mask == full_tensor_mask() - src_qmask_K()
+                        && scales.get(arg).has_default_groups();
             } else if (arg == DNNL_ARG_SRC) {
                 ok = ok
                         && utils::one_of(mask, 0, src_qmask_K(),
@@ -249,6 +292,9 @@ protected:
     memory_desc_t bias_md_;
     memory_desc_t dst_md_;
     memory_desc_t reduce_md_;
+    // Plain tensors of the destination shape with `k` columns.
+    memory_desc_t top_k_values_md_;
+    memory_desc_t top_k_indices_md_;
 
     matmul_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
             const matmul_pd_t *hint_fwd_pd)
@@ -258,7 +304,21 @@ protected:
         , weights_md_(desc_.weights_desc)
         , bias_md_(desc_.bias_desc)
         , dst_md_(desc_.dst_desc)
-        , reduce_md_(desc_.reduce_desc) {}
+        , reduce_md_(desc_.reduce_desc)
+        , top_k_values_md_(types::zero_md())
+        , top_k_indices_md_(types::zero_md()) {
+        if (!with_top_k()) return;
+        // The top-k attribute is validated on the descriptor creation.
+        dims_t dims;
+        const int nd = desc_.dst_desc.ndims;
+        utils::array_copy(dims, desc_.dst_desc.dims, nd);
+        dims[nd - 1] = attr->top_k_;
+        const auto tag = get_abx_tag(nd);
+        memory_desc_init_by_tag(top_k_values_md_, nd, dims,
+                desc_.dst_desc.data_type, tag);
+        memory_desc_init_by_tag(
+                top_k_indices_md_, nd, dims, data_type::s32, tag);
+    }
 
     // temporary solution to deal with format `any`
     bool set_default_formats() {
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <assert.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -24,6 +25,10 @@
 #include "oneapi/dnnl/dnnl_sycl.h"
 #endif
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/cpu_memory_storage.hpp"
+#endif
+
 #include "c_types_map.hpp"
 #include "engine.hpp"
 #include "host_scalar_memory_storage.hpp"
@@ -83,6 +88,8 @@ dnnl_memory::dnnl_memory(dnnl::impl::engine_t *engine,
     }
 
     memory_storages_ = std::move(mem_storages);
+    is_padding_tracked_ = std::all_of(flags.begin(), flags.end(),
+            [](unsigned f) { return f == memory_flags_t::alloc; });
 }
 
 dnnl_memory::dnnl_memory(dnnl::impl::engine_t *engine,
@@ -101,6 +108,11 @@ dnnl_memory::dnnl_memory(dnnl::impl::engine_t *engine,
     , memory_storages_(std::move(memory_storages))
     , counter_(1) {}
 
+uint64_t dnnl_memory::next_data_id() {
+    static std::atomic<uint64_t> id {0};
+    return ++id;
+}
+
 status_t dnnl_memory::set_data_handle(void *handle, int index) const {
     using namespace dnnl::impl;
     void *old_handle;
@@ -109,6 +121,8 @@ status_t dnnl_memory::set_data_handle(void *handle, int index) const {
     CHECK(ms->get_data_handle(&old_handle));
     if (handle != old_handle) {
         CHECK(memory_storage(index)->set_data_handle(handle));
+        untrack_padding();
+        data_id_ = next_data_id();
     }
     return status::success;
 }
@@ -131,6 +145,9 @@ status_t dnnl_memory::reset_memory_storage(
         else
             memory_storages_[0].reset(memory_storage_ptr);
     }
+    // The padded area of the new storage is not known.
+    untrack_padding();
+    data_id_ = next_data_id();
 
     return status::success;
 }
@@ -171,6 +188,67 @@ status_t dnnl_memory_create(memory_t **memory, const memory_desc_t *md,
     return success;
 }
 
+status_t dnnl_memory_create_from_file(memory_t **memory,
+        const memory_desc_t *md, engine_t *engine, int fd, size_t offset,
+        unsigned flags) {
+    if (any_null(memory, md, engine)) return invalid_arguments;
+    VCHECK_MEMORY(engine->kind() == engine_kind::cpu
+                    && is_native_runtime(engine->runtime_kind()),
+            invalid_arguments, VERBOSE_BAD_ENGINE_KIND);
+
+    const auto mdw = memory_desc_wrapper(md);
+    VCHECK_MEMORY(
+            !mdw.format_any(), invalid_arguments, VERBOSE_UNSUPPORTED_TAG);
+    VCHECK_MEMORY(!mdw.has_runtime_dims_or_strides(), invalid_arguments,
+            VERBOSE_UNSUPPORTED_MEM_STRIDE);
+    VCHECK_MEMORY(mdw.is_blocking_desc() && mdw.size() > 0, invalid_arguments,
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    auto storage = utils::make_unique<cpu::cpu_memory_storage_t>(engine);
+    if (!storage) return out_of_memory;
+    CHECK(storage->init_file_mapping(fd, offset, mdw.size(), flags));
+    auto _memory = new memory_t(engine, md, std::move(storage));
+    if (_memory == nullptr) return out_of_memory;
+    *memory = _memory;
+    return success;
+#else
+    MAYBE_UNUSED(fd);
+    MAYBE_UNUSED(offset);
+    MAYBE_UNUSED(flags);
+    return unimplemented;
+#endif
+}
+
+status_t dnnl_memory_create_on_stream(
+        memory_t **memory, const memory_desc_t *md, stream_t *stream) {
+    if (any_null(memory, md, stream)) return invalid_arguments;
+    engine_t *engine = stream->engine();
+    VCHECK_MEMORY(engine->kind() == engine_kind::cpu
+                    && is_native_runtime(engine->runtime_kind()),
+            invalid_arguments, VERBOSE_BAD_ENGINE_KIND);
+
+    const auto mdw = memory_desc_wrapper(md);
+    VCHECK_MEMORY(
+            !mdw.format_any(), invalid_arguments, VERBOSE_UNSUPPORTED_TAG);
+    VCHECK_MEMORY(!mdw.has_runtime_dims_or_strides(), invalid_arguments,
+            VERBOSE_UNSUPPORTED_MEM_STRIDE);
+    VCHECK_MEMORY(mdw.is_blocking_desc(), invalid_arguments,
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    auto storage = utils::make_unique<cpu::cpu_memory_storage_t>(engine);
+    if (!storage) return out_of_memory;
+    CHECK(storage->init_from_stream_pool(stream->memory_pool(), mdw.size()));
+    auto _memory = new memory_t(engine, md, std::move(storage));
+    if (_memory == nullptr) return out_of_memory;
+    *memory = _memory;
+    return success;
+#else
+    return unimplemented;
+#endif
+}
+
 status_t dnnl_memory_create_v2(memory_t **memory, const memory_desc_t *md,
         engine_t *engine, int nhandles, void **handles) {
     const bool args_ok = !any_null(memory, engine, handles) && nhandles > 0;
@@ -264,6 +342,7 @@ status_t dnnl_memory_get_data_handle(const memory_t *memory, void **handle) {
     const auto mdw = memory_desc_wrapper(memory->md());
     if (mdw.is_host_scalar_desc()) return invalid_arguments;
 
+    memory->untrack_padding();
     return memory->get_data_handle(handle);
 }
 
@@ -287,6 +366,7 @@ status_t dnnl_memory_get_data_handle_v2(
     const auto mdw = memory_desc_wrapper(memory->md());
     if (mdw.is_host_scalar_desc()) return invalid_arguments;
 
+    memory->untrack_padding();
     return memory->get_data_handle(handle, index);
 }
 
@@ -354,6 +434,7 @@ status_t dnnl_memory_map_data_v2(
         return invalid_arguments;
     }
 
+    memory->untrack_padding();
     return memory->memory_storage(index)->map_data(
             mapped_ptr, nullptr, map_size);
 }
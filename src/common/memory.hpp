@@ -18,6 +18,7 @@
 #define COMMON_MEMORY_HPP
 
 #include <assert.h>
+#include <atomic>
 #include <memory>
 
 #include "oneapi/dnnl/dnnl.h"
@@ -36,7 +37,9 @@ struct exec_ctx_t;
 enum memory_flags_t {
     alloc = 0x1,
     use_runtime_ptr = 0x2,
-    prefer_device_usm = 0x4
+    prefer_device_usm = 0x4,
+    // Take USM device memory from the engine device memory pool.
+    use_pool = 0x8
 };
 } // namespace impl
 } // namespace dnnl
@@ -88,12 +91,32 @@ struct dnnl_memory : public dnnl::impl::c_compatible {
     /** sets data handle */
     dnnl::impl::status_t set_data_handle(void *handle, int index = 0) const;
 
-    /** zeros padding */
+    /** zeros padding, skipped if the padded area is known to be zeroed */
     dnnl::impl::status_t zero_pad(const dnnl::impl::exec_ctx_t &ctx) const;
 
+    /** returns true if the padded area is known to contain zeros */
+    bool is_padding_clean() const { return padding_clean_; }
+
+    /** records the state of the padded area, a clean state is kept only if
+     * the state is tracked for the memory */
+    void set_padding_clean(bool clean) const {
+        padding_clean_ = clean && is_padding_tracked_;
+    }
+
+    /** stops tracking the state of the padded area as the buffer is exposed
+     * to the user, who may write to the padded area at any point */
+    void untrack_padding() const {
+        is_padding_tracked_ = false;
+        padding_clean_ = false;
+    }
+
     dnnl::impl::status_t reset_memory_storage(
             std::unique_ptr<dnnl::impl::memory_storage_t> &&memory_storage);
 
+    /** returns an id of the buffer of the memory, which is unique in the
+     * process and changes whenever the memory gets another buffer */
+    uint64_t data_id() const { return data_id_; }
+
     size_t get_num_handles() const { return memory_storages_.size(); }
 
     void retain() { counter_++; }
@@ -115,6 +138,19 @@ private:
     // Number of storages is larger than 1 only for sparse memory.
     std::vector<std::unique_ptr<dnnl::impl::memory_storage_t>> memory_storages_;
     std::atomic<int> counter_;
+
+    // The state of the padded area of blocked layouts. The state is tracked
+    // only for buffers allocated by the library that were not exposed to the
+    // user: the padded area of such buffers is written only by primitives,
+    // which leave it zeroed, and by zero_pad().
+    mutable std::atomic<bool> is_padding_tracked_ {false};
+    mutable std::atomic<bool> padding_clean_ {false};
+
+    // Unlike the address of the buffer, the id is not reused by another
+    // buffer, so the data derived from the buffer, e.g. packed weights, can
+    // be cached by the id.
+    static uint64_t next_data_id();
+    mutable std::atomic<uint64_t> data_id_ {next_data_id()};
 };
 
 namespace dnnl {
@@ -184,6 +184,117 @@ status_t memory_desc_init_by_coo_encoding(memory_desc_t &memory_desc, int ndims,
     return success;
 }
 
+status_t memory_desc_init_by_grouped_encoding(memory_desc_t &memory_desc,
+        int ndims, const dims_t dims, data_type_t data_type, dim_t ngroups,
+        data_type_t offsets_dt) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    // Groups are made of rows of a 2D tensor.
+    VCHECK_MEMORY(ndims == 2, unimplemented, VERBOSE_BAD_NDIMS, "", ndims);
+    VCHECK_MEMORY(ngroups > 0, invalid_arguments, VERBOSE_BAD_PARAM, "ngroups");
+    VCHECK_MEMORY(utils::one_of(offsets_dt, data_type::s32), unimplemented,
+            VERBOSE_INVALID_DATATYPE, "offsets");
+
+    bool args_ok = memory_desc_sanity_check(
+            ndims, dims, data_type, format_kind::undef);
+    VCHECK_MEMORY(args_ok, invalid_arguments, VERBOSE_MEM_DESC_CHECK_FAIL);
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::grouped;
+    md.format_desc.sparse_desc.nnz = ngroups;
+    md.format_desc.sparse_desc.metadata_types[0] = offsets_dt;
+
+    memory_desc = md;
+
+    return success;
+}
+
+status_t memory_desc_init_by_paged_encoding(memory_desc_t &memory_desc,
+        int ndims, const dims_t dims, data_type_t data_type, int paged_dim,
+        dim_t page_size, dim_t npages, data_type_t page_table_dt) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    VCHECK_MEMORY(ndims == 2, unimplemented, VERBOSE_BAD_NDIMS, "", ndims);
+    VCHECK_MEMORY(utils::one_of(paged_dim, 0, 1), invalid_arguments,
+            VERBOSE_BAD_PARAM, "paged_dim");
+    VCHECK_MEMORY(page_size > 0, invalid_arguments, VERBOSE_BAD_PARAM,
+            "page_size");
+    VCHECK_MEMORY(npages > 0, invalid_arguments, VERBOSE_BAD_PARAM, "npages");
+    VCHECK_MEMORY(utils::one_of(page_table_dt, data_type::s32), unimplemented,
+            VERBOSE_INVALID_DATATYPE, "page table");
+
+    bool args_ok = memory_desc_sanity_check(
+            ndims, dims, data_type, format_kind::undef);
+    VCHECK_MEMORY(args_ok, invalid_arguments, VERBOSE_MEM_DESC_CHECK_FAIL);
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::paged;
+    md.format_desc.sparse_desc.nnz = npages;
+    md.format_desc.sparse_desc.metadata_types[0] = page_table_dt;
+    md.format_desc.sparse_desc.paged_dim = paged_dim;
+    md.format_desc.sparse_desc.page_size = page_size;
+
+    memory_desc = md;
+
+    return success;
+}
+
+status_t memory_desc_init_by_structured_encoding(memory_desc_t &memory_desc,
+        int ndims, const dims_t dims, data_type_t data_type, int n, int m,
+        data_type_t metadata_dt) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    VCHECK_MEMORY(ndims == 2, unimplemented, VERBOSE_BAD_NDIMS, "", ndims);
+    // The positions of the kept elements of a group are stored in an 8-bit
+    // bitmask.
+    VCHECK_MEMORY(m >= 2 && m <= 8, unimplemented, VERBOSE_BAD_PARAM, "m");
+    VCHECK_MEMORY(
+            n >= 1 && n < m, invalid_arguments, VERBOSE_BAD_PARAM, "n");
+    VCHECK_MEMORY(utils::one_of(metadata_dt, data_type::u8), unimplemented,
+            VERBOSE_INVALID_DATATYPE, "metadata");
+
+    bool args_ok = memory_desc_sanity_check(
+            ndims, dims, data_type, format_kind::undef);
+    VCHECK_MEMORY(args_ok, invalid_arguments, VERBOSE_MEM_DESC_CHECK_FAIL);
+    VCHECK_MEMORY(dims[0] % m == 0, invalid_arguments, VERBOSE_BAD_DIM, "",
+            0);
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::structured;
+    md.format_desc.sparse_desc.nnz = dims[0] / m * n * dims[1];
+    md.format_desc.sparse_desc.metadata_types[0] = metadata_dt;
+    md.format_desc.sparse_desc.structured_n = n;
+    md.format_desc.sparse_desc.structured_m = m;
+
+    memory_desc = md;
+
+    return success;
+}
+
 status_t memory_desc_init_by_packed_encoding(memory_desc_t &memory_desc,
         int ndims, const dims_t dims, data_type_t data_type, dim_t nnz) {
     if (ndims == 0) {
@@ -654,6 +765,46 @@ status_t dnnl_memory_desc_create_with_coo_encoding(memory_desc_t **memory_desc,
     return success;
 }
 
+status_t dnnl_memory_desc_create_with_grouped_encoding(
+        memory_desc_t **memory_desc, int ndims, const dims_t dims,
+        data_type_t data_type, dim_t ngroups, data_type_t offsets_dt) {
+    if (any_null(memory_desc)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_grouped_encoding(
+            *md, ndims, dims, data_type, ngroups, offsets_dt));
+    (*memory_desc) = md.release();
+    return success;
+}
+
+status_t dnnl_memory_desc_create_with_paged_encoding(
+        memory_desc_t **memory_desc, int ndims, const dims_t dims,
+        data_type_t data_type, int paged_dim, dim_t page_size, dim_t npages,
+        data_type_t page_table_dt) {
+    if (any_null(memory_desc)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_paged_encoding(*md, ndims, dims, data_type,
+            paged_dim, page_size, npages, page_table_dt));
+    (*memory_desc) = md.release();
+    return success;
+}
+
+status_t dnnl_memory_desc_create_with_structured_encoding(
+        memory_desc_t **memory_desc, int ndims, const dims_t dims,
+        data_type_t data_type, int n, int m, data_type_t metadata_dt) {
+    if (any_null(memory_desc)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_structured_encoding(
+            *md, ndims, dims, data_type, n, m, metadata_dt));
+    (*memory_desc) = md.release();
+    return success;
+}
+
 status_t dnnl_memory_desc_create_with_packed_encoding(
         memory_desc_t **memory_desc, int ndims, const dims_t dims,
         data_type_t data_type, dim_t nnz) {
@@ -816,6 +967,11 @@ status_t dnnl_memory_desc_query_v2(
                         *(int *)result = md->ndims + 1;
                         break;
                     case sparse_encoding::packed: *(int *)result = 3; break;
+                    case sparse_encoding::grouped:
+                    case sparse_encoding::paged:
+                    case sparse_encoding::structured:
+                        *(int *)result = 2;
+                        break;
                     default: assert(!"unknown encoding"); *(int *)result = 0;
                 }
             } else
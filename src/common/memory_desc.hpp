@@ -180,17 +180,44 @@ struct sparse_desc_t {
     //  - 0: values
     //  - 1: offsets
     //  - 2: bitmask
+    //
+    // grouped: Number of handles is 2:
+    //  - 0: values
+    //  - 1: offsets, the end row of each group
+    //
+    // paged: Number of handles is 2:
+    //  - 0: page pool
+    //  - 1: page table, the index in the pool of each page
+    //
+    // structured: Number of handles is 2:
+    //  - 0: values, the kept elements of each group
+    //  - 1: metadata, the bitmask of the kept elements of each group
     sparse_encoding_t encoding;
 
-    // Number of non-zero entries.
+    // Number of non-zero entries. For the grouped encoding, the number of
+    // groups. For the paged encoding, the number of pages in the pool.
     dnnl_dim_t nnz;
 
     // Metadata types. Each encoding defines how to interpret these.
     // - CSR: 0th - index data type
     //        1st - pointer data type
+    // - grouped: 0th - offset data type
+    // - paged: 0th - page table data type
+    // - structured: 0th - bitmask data type
     // - packed: N/A
     dnnl_data_type_t metadata_types[max_metadata_types];
 
+    // The paged encoding only: the dimension split into pages and the number
+    // of its indices in a page. A page is a dense row-major array of
+    // [page_size, D] elements, where D is the other dimension.
+    int paged_dim;
+    dnnl_dim_t page_size;
+
+    // The structured encoding only: at most `structured_n` elements are kept
+    // in each group of `structured_m` consecutive rows of a column.
+    int structured_n;
+    int structured_m;
+
     // The packed sparse encoding is described with `blocking_desc_t` and
     // can only be initialized by the implementation. The special encoding
     // `packed` will instruct the implementation to do that.
@@ -115,6 +115,28 @@ struct memory_desc_wrapper : public c_compatible {
         return sparse_desc().nnz;
     }
 
+    // The paged encoding only: the number of elements in a page and the
+    // number of pages of the tensor, i.e. the number of page table entries.
+    dim_t page_nelems() const {
+        assert(is_sparse_desc() && encoding() == sparse_encoding::paged);
+        const int paged_dim = sparse_desc().paged_dim;
+        return sparse_desc().page_size * dims()[1 - paged_dim];
+    }
+
+    dim_t npages_in_table() const {
+        assert(is_sparse_desc() && encoding() == sparse_encoding::paged);
+        const int paged_dim = sparse_desc().paged_dim;
+        return utils::div_up(dims()[paged_dim], sparse_desc().page_size);
+    }
+
+    // The structured encoding only: the number of groups of rows. The values
+    // buffer keeps `structured_n` rows per group and the metadata buffer one
+    // row of bitmasks per group.
+    dim_t structured_ngroups() const {
+        assert(is_sparse_desc() && encoding() == sparse_encoding::structured);
+        return dims()[0] / sparse_desc().structured_m;
+    }
+
     const dims_t &strides() const { return blocking_desc().strides; }
 
     const memory_extra_desc_t &extra() const { return md_->extra; }
@@ -312,6 +334,43 @@ struct memory_desc_wrapper : public c_compatible {
                     assert(!"unknown index");
                     return 0;
                 }
+            } else if (sparse_desc().encoding == sparse_encoding::grouped) {
+                switch (index) {
+                    // Return size for values.
+                    case 0: return nelems() * data_type_size();
+                    // Return size for offsets.
+                    case 1: {
+                        const auto off_dt = metadata_type(0);
+                        return nnz() * types::data_type_size(off_dt);
+                    }
+                    default: assert(!"unknown index"); return 0;
+                }
+            } else if (sparse_desc().encoding == sparse_encoding::paged) {
+                switch (index) {
+                    // Return size for page pool.
+                    case 0: return nnz() * page_nelems() * data_type_size();
+                    // Return size for page table.
+                    case 1: {
+                        const auto tbl_dt = metadata_type(0);
+                        return npages_in_table()
+                                * types::data_type_size(tbl_dt);
+                    }
+                    default: assert(!"unknown index"); return 0;
+                }
+            } else if (sparse_desc().encoding == sparse_encoding::structured) {
+                const dim_t ngroups_nelems = structured_ngroups() * dims()[1];
+                switch (index) {
+                    // Return size for values.
+                    case 0:
+                        return ngroups_nelems * sparse_desc().structured_n
+                                * data_type_size();
+                    // Return size for metadata.
+                    case 1: {
+                        const auto mask_dt = metadata_type(0);
+                        return ngroups_nelems * types::data_type_size(mask_dt);
+                    }
+                    default: assert(!"unknown index"); return 0;
+                }
             } else if (sparse_desc().encoding == sparse_encoding::packed) {
                 // If the size if queried from a user-created memory descriptor.
                 if (blocking_desc().strides[0] == 0) return 0;
@@ -203,6 +203,8 @@ enum {
     key_conv_gemm_row,
     key_conv_gemm_imtr,
     key_conv_gemm_zp_src_comp,
+    key_conv_group_packed_wei,
+    key_conv_group_packed_wei_reordered,
     key_conv_int_dat_in_acc_dt,
     key_conv_ncsp_dst,
     key_conv_ncsp_src,
@@ -228,6 +230,9 @@ enum {
     key_conv_miopen_algo,
     key_conv_miopen_filter,
     key_deconv_bias,
+    key_deconv_subpixel_dst,
+    key_deconv_subpixel_wei,
+    key_deconv_subpixel_wei_reordered,
     key_deconv_sum,
     key_deconv_zp,
     key_eltwise_diff_dst,
@@ -265,7 +270,9 @@ enum {
     key_lnorm_tmp_mean,
     key_lnorm_tmp_var,
     key_lnorm_tmp_diff_ss,
+    key_lnorm_tmp_dst,
     key_lnorm_reduction,
+    key_lnorm_residual_sum,
     key_matmul_pack_space,
     key_matmul_dst_in_acc_dt,
     key_matmul_lt_algo_scratch,
@@ -276,6 +283,7 @@ enum {
     key_matmul_dst_cast_acc,
     key_matmul_dst_scales,
     key_matmul_sparse_tmp_ptr,
+    key_matmul_src_quant,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
     key_pool_ind_plain2blocked_cvt,
@@ -305,6 +313,7 @@ enum {
     key_reorder_cublaslt_src_float,
     key_reorder_cublaslt_dst_float,
     key_reorder_cublaslt_generic,
+    key_resampling_space,
     key_rnn_space,
     key_rnn_bf32_attention_trans,
     key_rnn_bf32_wei_layer_trans,
@@ -316,16 +325,25 @@ enum {
     key_rnn_diff_gates,
     key_rnn_src_layer_trans,
     key_rnn_src_iter_trans,
+    key_rnn_src_iter_in_place,
+    key_rnn_wei_layer_decomp,
+    key_rnn_wei_iter_decomp,
+    key_rnn_wei_projection_decomp,
     key_rnn_diff_ht,
     key_rnn_ptrs_bia,
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_sdpa_acc,
+    key_sdpa_key_pack,
+    key_sdpa_scores,
+    key_sdpa_stats,
     key_softmax_dst_scales,
     key_softmax_reduction,
     key_softmax_interim_store,
     key_sum_reduction,
     key_sum_srcs_cvt,
+    key_sum_tree_acc,
     key_wino_U,
     key_wino_V,
     key_wino_M,
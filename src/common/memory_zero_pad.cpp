@@ -304,7 +304,7 @@ status_t stream_t::zero_pad(const memory_t *memory, const exec_ctx_t &ctx) {
 status_t memory_t::zero_pad(const exec_ctx_t &ctx) const {
     memory_desc_wrapper mdw(md());
     const bool skip_zeroing = false || memory_storage()->is_null()
-            || mdw.is_zero() || !mdw.is_blocking_desc();
+            || mdw.is_zero() || !mdw.is_blocking_desc() || is_padding_clean();
     if (skip_zeroing) return success;
 
     stream_t *stream = ctx.stream();
@@ -320,6 +320,7 @@ status_t memory_t::zero_pad(const exec_ctx_t &ctx) const {
     else
         status = ::zero_pad(this, ctx);
 
+    if (status == success) set_padding_clean(true);
     return status;
 }
 
@@ -239,7 +239,8 @@ struct resampling_desc_t : public op_desc_t {
     // #dnnl_forward_inference, #dnnl_backward_data,
     prop_kind_t prop_kind {};
     // The kind of the resampling algorithm. Possible values:
-    // #dnnl_resampling_nearest, #dnnl_resampling_linear.
+    // #dnnl_resampling_nearest, #dnnl_resampling_linear,
+    // #dnnl_resampling_cubic, #dnnl_resampling_linear_antialias.
     alg_kind_t alg_kind {};
     // Source memory descriptor.
     memory_desc_t src_desc;
@@ -480,7 +481,8 @@ struct reduction_desc_t : public op_desc_t {
     // #dnnl_reduction_max, #dnnl_reduction_min, #dnnl_reduction_sum,
     // #dnnl_reduction_mul, #dnnl_reduction_mean, #dnnl_reduction_norm_lp_max,
     // #dnnl_reduction_norm_lp_sum, #dnnl_reduction_norm_lp_power_p_max,
-    // #dnnl_reduction_norm_lp_power_p_sum.
+    // #dnnl_reduction_norm_lp_power_p_sum, #dnnl_reduction_arg_max,
+    // #dnnl_reduction_arg_min.
     alg_kind_t alg_kind {};
     // Source memory descriptor.
     memory_desc_t src_desc;
@@ -497,10 +499,33 @@ struct reduction_desc_t : public op_desc_t {
     // #dnnl_reduction_sum: @p p and @p eps are ignored
     // #dnnl_reduction_mul: @p p and @p eps are ignored
     // #dnnl_reduction_mean: @p p and @p eps are ignored
+    // #dnnl_reduction_arg_max: @p p and @p eps are ignored
+    // #dnnl_reduction_arg_min: @p p and @p eps are ignored
     float p {};
     float eps {};
 };
 
+// A descriptor of an embedding bag operation.
+struct embedding_bag_desc_t : public op_desc_t {
+    embedding_bag_desc_t() : op_desc_t(primitive_kind::embedding_bag) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(embedding_bag_desc_t);
+
+    // The pooling of the rows of a bag. Possible values: #dnnl_reduction_sum,
+    // #dnnl_reduction_mean, and #dnnl_reduction_max.
+    alg_kind_t alg_kind {};
+    // Source (embedding table) memory descriptor.
+    memory_desc_t src_desc;
+    // Indices memory descriptor.
+    memory_desc_t indices_desc;
+    // Offsets memory descriptor.
+    memory_desc_t offsets_desc;
+    // Per-sample weights memory descriptor. Zero if there are no weights.
+    memory_desc_t weights_desc;
+    // Destination memory descriptor.
+    memory_desc_t dst_desc;
+};
+
 /// A descriptor of a Softmax operation.
 struct softmax_desc_t : public op_desc_t {
     softmax_desc_t() : op_desc_t(primitive_kind::softmax) {}
@@ -578,8 +603,8 @@ struct pooling_desc_t : public op_desc_t {
     prop_kind_t prop_kind {};
     // The kind of pooling algorithm.
     // Possible values: #dnnl_pooling_max,
-    // #dnnl_pooling_avg_include_padding, and
-    // #dnnl_pooling_avg_exclude_padding.
+    // #dnnl_pooling_avg_include_padding, #dnnl_pooling_avg_exclude_padding,
+    // #dnnl_pooling_adaptive_max, and #dnnl_pooling_adaptive_avg.
     alg_kind_t alg_kind {};
     // Source memory descriptor.
     memory_desc_t src_desc;
@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PARALLEL_PROFILER_HPP
+#define COMMON_PARALLEL_PROFILER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace dnnl {
+namespace impl {
+namespace parallel_profiler {
+
+inline uint64_t get_time_ns() {
+    using namespace std::chrono;
+    return static_cast<uint64_t>(
+            duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
+                    .count());
+}
+
+// Accumulates the time threads spend executing the work of parallel regions
+// started by a thread that activated the region. Used by CPU stream profiling
+// to report thread utilization of a primitive execution, and by verbose and
+// ITT to report the imbalance of the work between the threads.
+struct region_t {
+    void reset() {
+        thread_time_ns = 0;
+        parallel_time_ns = 0;
+        span_thread_time_ns = 0;
+        max_nthr = 1;
+    }
+
+    // Accounts the regions of an execution nested into the profiled one.
+    void add(const region_t &other) {
+        thread_time_ns += other.thread_time_ns;
+        parallel_time_ns += other.parallel_time_ns;
+        span_thread_time_ns += other.span_thread_time_ns;
+        max_nthr = max_nthr > other.max_nthr ? max_nthr : other.max_nthr;
+    }
+
+    // The ratio of the time the threads are held by the parallel regions,
+    // until the slowest one is done, to the time they spend in the work. It
+    // is 1 for a balanced work and up to the thread count otherwise. Returns
+    // 0 when no work ran in parallel.
+    double imbalance() const {
+        if (max_nthr == 1 || thread_time_ns == 0) return 0;
+        return (double)span_thread_time_ns / thread_time_ns;
+    }
+
+    // Total time of all threads spent in parallel work.
+    std::atomic<uint64_t> thread_time_ns {0};
+    // Wall time spent in parallel regions by the activating thread.
+    uint64_t parallel_time_ns = 0;
+    // Sum over the parallel regions of the thread count times the work time
+    // of the slowest thread.
+    uint64_t span_thread_time_ns = 0;
+    // The largest number of threads in a parallel region.
+    int max_nthr = 1;
+};
+
+// The region is thread local so that only parallel regions started by the
+// profiled thread are accounted, nested regions included into the outer one.
+inline region_t *&active_region() {
+    static thread_local region_t *region = nullptr;
+    return region;
+}
+
+// The number of parallel regions with dynamic scheduling started by the
+// thread. Used by verbose to report which scheduler a primitive execution
+// used.
+inline int &dynamic_schedule_count() {
+    static thread_local int count = 0;
+    return count;
+}
+
+// The smallest thread count chosen for the work of a parallel region started
+// by the thread, or 0 if all threads were used. Reset by verbose before a
+// primitive execution to report it.
+inline int &capped_nthr() {
+    static thread_local int nthr = 0;
+    return nthr;
+}
+
+} // namespace parallel_profiler
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,252 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include "persistent_cache.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace persistent_cache {
+
+namespace {
+
+constexpr char file_magic[8] = {'D', 'N', 'N', 'L', 'P', 'C', '0', '1'};
+constexpr char bundle_magic[8] = {'D', 'N', 'N', 'L', 'P', 'C', 'B', '1'};
+
+thread_local bundle_t *thread_bundle = nullptr;
+
+// FNV-1a, chosen over std::hash for a file name that is stable across
+// processes and standard library implementations.
+uint64_t hash_id(const std::vector<uint8_t> &id) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (uint8_t b : id) {
+        h ^= b;
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+std::string get_file_name(const std::vector<uint8_t> &id) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.blob",
+            static_cast<unsigned long long>(hash_id(id)));
+    return get_dir() + "/" + name;
+}
+
+bool write_all(FILE *f, const void *data, size_t size) {
+    return size == 0 || std::fwrite(data, 1, size, f) == size;
+}
+
+bool read_all(FILE *f, void *data, size_t size) {
+    return size == 0 || std::fread(data, 1, size, f) == size;
+}
+
+} // namespace
+
+const std::vector<uint8_t> *bundle_t::find(
+        const std::vector<uint8_t> &id) const {
+    for (const bundle_t *b = this; b; b = b->parent_) {
+        const auto it = b->blobs_.find(id);
+        if (it != b->blobs_.end()) return &it->second;
+    }
+    return nullptr;
+}
+
+void bundle_t::add(
+        const std::vector<uint8_t> &id, const std::vector<uint8_t> &blob) {
+    blobs_[id] = blob;
+}
+
+size_t bundle_t::get_serialized_size() const {
+    size_t size = sizeof(bundle_magic) + sizeof(uint64_t);
+    for (const auto &e : blobs_)
+        size += 2 * sizeof(uint64_t) + e.first.size() + e.second.size();
+    return size;
+}
+
+status_t bundle_t::serialize(uint8_t *data, size_t size) const {
+    if (!data || size < get_serialized_size())
+        return status::invalid_arguments;
+
+    const auto put = [&](const void *src, size_t n) {
+        std::memcpy(data, src, n);
+        data += n;
+    };
+    const auto put_vec = [&](const std::vector<uint8_t> &v) {
+        const uint64_t n = v.size();
+        put(&n, sizeof(n));
+        put(v.data(), v.size());
+    };
+    const uint64_t count = blobs_.size();
+    put(bundle_magic, sizeof(bundle_magic));
+    put(&count, sizeof(count));
+    for (const auto &e : blobs_) {
+        put_vec(e.first);
+        put_vec(e.second);
+    }
+    return status::success;
+}
+
+status_t bundle_t::deserialize(const uint8_t *data, size_t size) {
+    if (!data) return status::invalid_arguments;
+
+    const uint8_t *end = data + size;
+    const auto get = [&](void *dst, size_t n) {
+        if (static_cast<size_t>(end - data) < n) return false;
+        std::memcpy(dst, data, n);
+        data += n;
+        return true;
+    };
+    const auto get_vec = [&](std::vector<uint8_t> &v) {
+        uint64_t n = 0;
+        if (!get(&n, sizeof(n)) || static_cast<uint64_t>(end - data) < n)
+            return false;
+        v.assign(data, data + n);
+        data += n;
+        return true;
+    };
+
+    char magic[sizeof(bundle_magic)] = {};
+    uint64_t count = 0;
+    if (!get(magic, sizeof(magic))
+            || std::memcmp(magic, bundle_magic, sizeof(magic)) != 0
+            || !get(&count, sizeof(count)))
+        return status::invalid_arguments;
+
+    std::map<std::vector<uint8_t>, std::vector<uint8_t>> blobs;
+    for (uint64_t i = 0; i < count; i++) {
+        std::vector<uint8_t> id, blob;
+        if (!get_vec(id) || !get_vec(blob) || id.empty() || blob.empty())
+            return status::invalid_arguments;
+        blobs.emplace(std::move(id), std::move(blob));
+    }
+    blobs_ = std::move(blobs);
+    return status::success;
+}
+
+bundle_scope_t::bundle_scope_t(bundle_t &bundle) : prev_(thread_bundle) {
+    bundle.parent_ = prev_;
+    thread_bundle = &bundle;
+}
+
+bundle_scope_t::~bundle_scope_t() {
+    thread_bundle->parent_ = nullptr;
+    thread_bundle = prev_;
+}
+
+bundle_t *get_thread_bundle() {
+    return thread_bundle;
+}
+
+const std::string &get_dir() {
+    static const std::string dir = []() {
+        std::string value = getenv_path_user("PRIMITIVE_CACHE_DIR");
+        // Strip trailing separators to keep file names canonical.
+        while (value.size() > 1
+                && (value.back() == '/' || value.back() == '\\'))
+            value.pop_back();
+        return value;
+    }();
+    return dir;
+}
+
+status_t load(const std::vector<uint8_t> &id, std::vector<uint8_t> &blob) {
+    if (!is_enabled() || id.empty()) return status::invalid_arguments;
+
+    if (thread_bundle) {
+        if (const auto *b = thread_bundle->find(id)) {
+            blob = *b;
+            return status::success;
+        }
+    }
+    if (get_dir().empty()) return status::runtime_error;
+
+    FILE *f = std::fopen(get_file_name(id).c_str(), "rb");
+    if (!f) return status::runtime_error;
+
+    bool ok = true;
+    char magic[sizeof(file_magic)] = {};
+    uint64_t id_size = 0, blob_size = 0;
+    ok = ok && read_all(f, magic, sizeof(magic))
+            && std::memcmp(magic, file_magic, sizeof(magic)) == 0;
+    ok = ok && read_all(f, &id_size, sizeof(id_size)) && id_size == id.size();
+    if (ok) {
+        std::vector<uint8_t> stored_id(id_size);
+        ok = read_all(f, stored_id.data(), id_size) && stored_id == id;
+    }
+    ok = ok && read_all(f, &blob_size, sizeof(blob_size)) && blob_size > 0;
+    if (ok) {
+        blob.resize(blob_size);
+        ok = read_all(f, blob.data(), blob_size);
+    }
+    std::fclose(f);
+
+    if (!ok) {
+        blob.clear();
+        return status::runtime_error;
+    }
+    return status::success;
+}
+
+status_t store(
+        const std::vector<uint8_t> &id, const std::vector<uint8_t> &blob) {
+    if (!is_enabled() || id.empty() || blob.empty())
+        return status::invalid_arguments;
+
+    if (thread_bundle) thread_bundle->add(id, blob);
+    if (get_dir().empty()) return status::success;
+
+    static std::atomic<unsigned> counter {0};
+    const std::string file_name = get_file_name(id);
+    // The temporary name has to be unique across threads and processes
+    // sharing the directory.
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    const std::string tmp_name = file_name + ".tmp."
+            + std::to_string(std::hash<std::thread::id>()(
+                    std::this_thread::get_id()))
+            + "." + std::to_string(now.count()) + "."
+            + std::to_string(counter++);
+
+    FILE *f = std::fopen(tmp_name.c_str(), "wb");
+    if (!f) return status::runtime_error;
+
+    const uint64_t id_size = id.size();
+    const uint64_t blob_size = blob.size();
+    bool ok = write_all(f, file_magic, sizeof(file_magic))
+            && write_all(f, &id_size, sizeof(id_size))
+            && write_all(f, id.data(), id.size())
+            && write_all(f, &blob_size, sizeof(blob_size))
+            && write_all(f, blob.data(), blob.size());
+    ok = (std::fclose(f) == 0) && ok;
+
+    // Renaming onto an existing entry fails on some platforms; an entry
+    // written by a concurrent creator is as good as ours.
+    if (!ok || std::rename(tmp_name.c_str(), file_name.c_str()) != 0) {
+        std::remove(tmp_name.c_str());
+        return ok ? status::success : status::runtime_error;
+    }
+    return status::success;
+}
+
+} // namespace persistent_cache
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PERSISTENT_CACHE_HPP
+#define COMMON_PERSISTENT_CACHE_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace persistent_cache {
+
+// Directory-backed storage for primitive cache blobs. The storage is enabled
+// by setting the `ONEDNN_PRIMITIVE_CACHE_DIR` environment variable to an
+// existing writable directory. Every blob is stored in a separate file named
+// after a hash of its cache blob ID; the full ID is kept inside the file and
+// is compared on load to rule out hash collisions.
+
+// In-memory storage for the cache blobs of a group of primitives, e.g. of all
+// the primitives of a Graph API compiled partition, that can be saved to and
+// restored from a single buffer. While a bundle is attached to the calling
+// thread with bundle_scope_t, the blobs are loaded from the bundle, or from
+// the bundles attached before it, ahead of the directory, and the blobs of
+// all the primitives created by the thread are recorded in it.
+struct bundle_t {
+    const std::vector<uint8_t> *find(const std::vector<uint8_t> &id) const;
+    void add(const std::vector<uint8_t> &id, const std::vector<uint8_t> &blob);
+    bool empty() const { return blobs_.empty(); }
+
+    size_t get_serialized_size() const;
+    status_t serialize(uint8_t *data, size_t size) const;
+    status_t deserialize(const uint8_t *data, size_t size);
+
+private:
+    friend struct bundle_scope_t;
+    std::map<std::vector<uint8_t>, std::vector<uint8_t>> blobs_;
+    const bundle_t *parent_ = nullptr;
+};
+
+struct bundle_scope_t {
+    bundle_scope_t(bundle_t &bundle);
+    ~bundle_scope_t();
+
+    bundle_scope_t(const bundle_scope_t &) = delete;
+    bundle_scope_t &operator=(const bundle_scope_t &) = delete;
+
+private:
+    bundle_t *prev_;
+};
+
+// Returns the bundle attached to the calling thread, if any.
+bundle_t DNNL_API *get_thread_bundle();
+
+// Returns the configured directory or an empty string when the storage is
+// disabled.
+const std::string DNNL_API &get_dir();
+inline bool is_enabled() {
+    return !get_dir().empty() || get_thread_bundle() != nullptr;
+}
+
+// Reads the blob associated with `id`. Returns status::success only if a
+// valid entry was found.
+status_t load(const std::vector<uint8_t> &id, std::vector<uint8_t> &blob);
+
+// Writes the blob associated with `id`. The file is first written under a
+// temporary name and then renamed so that concurrent readers, including
+// other processes, never observe a partially written entry.
+status_t store(
+        const std::vector<uint8_t> &id, const std::vector<uint8_t> &blob);
+
+} // namespace persistent_cache
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -19,6 +19,7 @@
 
 #include "c_types_map.hpp"
 #include "opdesc.hpp"
+#include "pooling_pd.hpp"
 #include "primitive_desc_iface.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
@@ -44,12 +45,21 @@ status_t pooling_desc_init(pooling_desc_t *pool_desc, prop_kind_t prop_kind,
         const memory_desc_t *dst_desc, const dims_t strides,
         const dims_t kernel, const dims_t dilation, const dims_t padding_l,
         const dims_t padding_r) {
-    VCHECK_POOLING(!any_null(pool_desc, src_desc, dst_desc, strides, kernel,
-                           padding_l),
+    // The adaptive algorithms derive the windows from the spatial sizes.
+    const bool is_adaptive
+            = one_of(alg_kind, pooling_adaptive_max, pooling_adaptive_avg);
+    VCHECK_POOLING(!any_null(pool_desc, src_desc, dst_desc), VERBOSE_NULL_ARG);
+    VCHECK_POOLING(
+            IMPLICATION(!is_adaptive, !any_null(strides, kernel, padding_l)),
             VERBOSE_NULL_ARG);
     VCHECK_POOLING(one_of(alg_kind, pooling_max, pooling_avg_include_padding,
-                           pooling_avg_exclude_padding),
+                           pooling_avg_exclude_padding, pooling_adaptive_max,
+                           pooling_adaptive_avg),
             VERBOSE_BAD_ALGORITHM);
+    VCHECK_POOLING_IMPL(
+            IMPLICATION(is_adaptive,
+                    one_of(prop_kind, forward_training, forward_inference)),
+            VERBOSE_BAD_PROPKIND);
     VCHECK_POOLING(
             IMPLICATION(one_of(prop_kind, forward_training, forward_inference),
                     !memory_desc_wrapper(src_desc).format_any()),
@@ -80,14 +90,17 @@ status_t pooling_desc_init(pooling_desc_t *pool_desc, prop_kind_t prop_kind,
     (is_fwd ? pd.dst_desc : pd.diff_dst_desc) = *dst_desc;
 
     int sp_dims = src_desc->ndims - 2;
-    utils::array_copy(pd.strides, strides, sp_dims);
-    utils::array_copy(pd.kernel, kernel, sp_dims);
-    utils::array_copy(pd.padding[0], padding_l, sp_dims);
-    utils::array_copy(pd.padding[1], padding_r, sp_dims);
-    utils::array_copy(pd.dilation, dilation, sp_dims);
+    if (!is_adaptive) {
+        utils::array_copy(pd.strides, strides, sp_dims);
+        utils::array_copy(pd.kernel, kernel, sp_dims);
+        utils::array_copy(pd.padding[0], padding_l, sp_dims);
+        utils::array_copy(pd.padding[1], padding_r, sp_dims);
+        utils::array_copy(pd.dilation, dilation, sp_dims);
+    }
 
     if (one_of(alg_kind, pooling_max, pooling_avg_include_padding,
-                pooling_avg_exclude_padding)) {
+                pooling_avg_exclude_padding, pooling_adaptive_max,
+                pooling_adaptive_avg)) {
         pd.accum_data_type = types::default_accum_data_type(
                 src_desc->data_type, dst_desc->data_type, false);
     } else {
@@ -103,10 +116,28 @@ status_t pooling_desc_init(pooling_desc_t *pool_desc, prop_kind_t prop_kind,
     for (int i : {0, 1})
         VCHECK_POOLING(src_desc->dims[i] == dst_desc->dims[i],
                 VERBOSE_INCONSISTENT_DIM, "src", i, "dst", i);
+    VCHECK_POOLING(IMPLICATION(is_adaptive, src_desc->ndims == dst_desc->ndims),
+            VERBOSE_INCONSISTENT_NDIMS, "src", "dst");
 
     for (int i = 2; i < src_desc->ndims; ++i) {
         const dim_t src = src_desc->dims[i];
         const dim_t dst = dst_desc->dims[i];
+
+        if (is_adaptive) {
+            // The kernel is set to the largest window, the strides to one,
+            // and the dilations and padding stay zero.
+            VCHECK_POOLING(IMPLICATION(dst > 0, src > 0),
+                    VERBOSE_INCONSISTENT_PRB);
+            dim_t ker = 0;
+            for (dim_t o = 0; o < dst; ++o)
+                ker = nstl::max(ker,
+                        adaptive_pooling_end(o, dst, src)
+                                - adaptive_pooling_start(o, dst, src));
+            pd.kernel[i - 2] = ker;
+            pd.strides[i - 2] = 1;
+            continue;
+        }
+
         const dim_t ker = kernel[i - 2];
         const dim_t dil = dilation ? dilation[i - 2] : 0;
         const dim_t pad_l = padding_l[i - 2];
@@ -182,6 +213,11 @@ dnnl_status_t dnnl_pooling_forward_primitive_desc_create(
     auto pool_desc = pooling_desc_t();
     CHECK(pooling_desc_init(&pool_desc, prop_kind, alg_kind, src_desc, dst_desc,
             strides, kernel, dilation, padding_l, padding_r));
+    VCHECK_POOLING_IMPL(
+            IMPLICATION(one_of(alg_kind, pooling_adaptive_max,
+                                pooling_adaptive_avg),
+                    engine->kind() == engine_kind::cpu),
+            VERBOSE_BAD_ENGINE_KIND);
     CHECK(pooling_attr_check(pool_desc, engine, attr));
     return primitive_desc_create(primitive_desc_iface, engine,
             (const op_desc_t *)&pool_desc, nullptr, attr);
@@ -40,6 +40,15 @@
 namespace dnnl {
 namespace impl {
 
+// Adaptive pooling: the destination point `o` out of `O` takes the source
+// points [floor(o * I / O), ceil((o + 1) * I / O)) out of `I`.
+inline dim_t adaptive_pooling_start(dim_t o, dim_t O, dim_t I) {
+    return o * I / O;
+}
+inline dim_t adaptive_pooling_end(dim_t o, dim_t O, dim_t I) {
+    return utils::div_up((o + 1) * I, O);
+}
+
 struct pooling_fwd_pd_t;
 
 struct pooling_pd_t : public primitive_desc_t {
@@ -131,6 +140,21 @@ struct pooling_pd_t : public primitive_desc_t {
 
     bool is_dilated() const { return KDD() != 0 || KDH() != 0 || KDW() != 0; }
 
+    bool is_adaptive() const {
+        return utils::one_of(desc_.alg_kind, alg_kind::pooling_adaptive_max,
+                alg_kind::pooling_adaptive_avg);
+    }
+
+    // Every destination point takes the whole source spatial domain, e.g.
+    // the global average pooling at the end of a vision backbone.
+    bool is_global() const {
+        if (OD() != 1 || OH() != 1 || OW() != 1) return false;
+        if (is_adaptive()) return true;
+        return KD() == ID() && KH() == IH() && KW() == IW() && !is_dilated()
+                && padFront() == 0 && padBack() == 0 && padT() == 0
+                && padB() == 0 && padL() == 0 && padR() == 0;
+    }
+
     bool has_zero_dim_memory() const {
         return memory_desc_wrapper(src_desc()).has_zero_dim();
     }
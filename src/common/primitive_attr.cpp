@@ -121,6 +121,17 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
                     dnnl::impl::accumulation_mode::any)));
     CHECK_ARG(IMPLICATION(
             (bool)(~mask & smask_t::dropout), dropout_.has_default_values()));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::softmax_mask),
+            softmax_mask_.has_default_values()));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::top_k), top_k_ == 0));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::dynamic_quantization),
+            !dynamic_quantization_));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::dst_split),
+            dst_split_.has_default_values()));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::workspace_data_type),
+            workspace_dt_ == data_type::undef));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::src_upsampling),
+            src_upsampling_ == 1));
     CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::rounding_mode),
             rounding_mode_.has_default_values()));
     CHECK_ARG(this->defined(smask_t::none));
@@ -411,6 +422,43 @@ status_t primitive_attr_t::set_dropout(const memory_desc_t *user_dropout_desc) {
     return success;
 }
 
+status_t primitive_attr_t::set_softmax_mask(
+        softmax_mask_kind_t kind, const memory_desc_t *lengths_desc) {
+    VCHECK_ATTR(one_of(kind, softmax_mask_kind::none,
+                        softmax_mask_kind::causal_top_left,
+                        softmax_mask_kind::causal_bottom_right),
+            VERBOSE_BAD_PARAM, "softmax mask kind");
+    const bool with_lengths = !types::is_zero_md(lengths_desc);
+    if (with_lengths) {
+        const memory_desc_wrapper lengths_d(lengths_desc);
+        VCHECK_ATTR(lengths_d.data_type() == data_type::s32,
+                VERBOSE_INVALID_DATATYPE, "softmax mask lengths");
+        VCHECK_ATTR(!lengths_d.format_any(), VERBOSE_UNSUPPORTED_TAG_S,
+                "softmax mask lengths");
+    }
+    softmax_mask_.kind_ = kind;
+    softmax_mask_.lengths_desc_
+            = with_lengths ? *lengths_desc : types::zero_md();
+    return success;
+}
+
+status_t primitive_attr_t::set_dst_split(
+        int nparts, const memory_desc_t *const *mds) {
+    VCHECK_ATTR(nparts >= 0, VERBOSE_BAD_PARAM, "dst split");
+    VCHECK_ATTR(IMPLICATION(nparts > 0, mds != nullptr), VERBOSE_NULL_ARG);
+    std::vector<memory_desc_t> parts;
+    for (int i = 0; i < nparts; i++) {
+        VCHECK_ATTR(mds[i] != nullptr, VERBOSE_NULL_ARG);
+        const memory_desc_wrapper part_d(mds[i]);
+        VCHECK_ATTR(part_d.ndims() == 4, VERBOSE_BAD_NDIMS, "dst split",
+                part_d.ndims());
+        VCHECK_ATTR(part_d.is_plain(), VERBOSE_UNSUPPORTED_TAG_S, "dst split");
+        parts.push_back(*mds[i]);
+    }
+    dst_split_.mds_ = std::move(parts);
+    return success;
+}
+
 status_t primitive_attr_t::set_fpmath_mode(
         fpmath_mode_t fpmath_mode, bool apply_to_int) {
     auto st = check_fpmath_mode(fpmath_mode);
@@ -435,8 +483,8 @@ status_t primitive_attr_t::set_accumulation_mode(accumulation_mode_t am) {
 
 status_t primitive_attr_t::set_scratchpad_mode(
         scratchpad_mode_t scratchpad_mode) {
-    const bool ok = one_of(
-            scratchpad_mode, scratchpad_mode::library, scratchpad_mode::user);
+    const bool ok = one_of(scratchpad_mode, scratchpad_mode::library,
+            scratchpad_mode::user, scratchpad_mode::stream);
     if (!ok) return invalid_arguments;
 
     scratchpad_mode_ = scratchpad_mode;
@@ -550,6 +598,106 @@ status_t dnnl_primitive_attr_set_deterministic(primitive_attr_t *attr, int d) {
     return success;
 }
 
+status_t dnnl_primitive_attr_get_softmax_mask(const primitive_attr_t *attr,
+        softmax_mask_kind_t *kind, const memory_desc_t **lengths_desc) {
+    if (any_null(attr)) return invalid_arguments;
+    if (kind) *kind = attr->softmax_mask_.kind_;
+    if (lengths_desc) *lengths_desc = &attr->softmax_mask_.lengths_desc_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_softmax_mask(primitive_attr_t *attr,
+        softmax_mask_kind_t kind, const memory_desc_t *lengths_desc) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_softmax_mask(kind, lengths_desc);
+}
+
+status_t dnnl_primitive_attr_get_top_k(const primitive_attr_t *attr, dim_t *k) {
+    if (any_null(attr, k)) return invalid_arguments;
+    *k = attr->top_k_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_top_k(primitive_attr_t *attr, dim_t k) {
+    if (any_null(attr)) return invalid_arguments;
+    VCHECK_ATTR(k >= 0, VERBOSE_BAD_PARAM, "top-k");
+    attr->top_k_ = k;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_dst_split(
+        const primitive_attr_t *attr, int *nparts) {
+    if (any_null(attr, nparts)) return invalid_arguments;
+    *nparts = attr->dst_split_.nparts();
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_dst_split(primitive_attr_t *attr, int nparts,
+        const memory_desc_t *const *part_descs) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_dst_split(nparts, part_descs);
+}
+
+status_t dnnl_primitive_attr_get_dynamic_quantization(
+        const primitive_attr_t *attr, int *dq) {
+    if (any_null(attr, dq)) return invalid_arguments;
+    *dq = attr->dynamic_quantization_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_dynamic_quantization(
+        primitive_attr_t *attr, int dq) {
+    if (any_null(attr)) return invalid_arguments;
+    attr->dynamic_quantization_ = dq;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_workspace_data_type(
+        const primitive_attr_t *attr, data_type_t *dt) {
+    if (any_null(attr, dt)) return invalid_arguments;
+    *dt = attr->workspace_dt_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_workspace_data_type(
+        primitive_attr_t *attr, data_type_t dt) {
+    using namespace data_type;
+    if (any_null(attr)) return invalid_arguments;
+    VCHECK_ATTR(one_of(dt, undef, bf16, f16, f8_e5m2, f8_e4m3),
+            VERBOSE_INVALID_DATATYPE, "workspace");
+    attr->workspace_dt_ = dt;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_src_upsampling(
+        const primitive_attr_t *attr, int *factor) {
+    if (any_null(attr, factor)) return invalid_arguments;
+    *factor = attr->src_upsampling_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_src_upsampling(
+        primitive_attr_t *attr, int factor) {
+    if (any_null(attr)) return invalid_arguments;
+    VCHECK_ATTR(factor >= 1, VERBOSE_BAD_PARAM, "src_upsampling");
+    attr->src_upsampling_ = factor;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_constant_weights(
+        const primitive_attr_t *attr, int *cw) {
+    if (any_null(attr, cw)) return invalid_arguments;
+    *cw = attr->constant_weights_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_constant_weights(
+        primitive_attr_t *attr, int cw) {
+    if (any_null(attr)) return invalid_arguments;
+    attr->constant_weights_ = cw;
+    return success;
+}
+
 status_t dnnl_primitive_attr_get_scratchpad_mode(
         const primitive_attr_t *attr, scratchpad_mode_t *scratchpad_mode) {
     if (any_null(attr, scratchpad_mode)) return invalid_arguments;
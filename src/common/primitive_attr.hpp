@@ -19,6 +19,7 @@
 
 #include <map>
 #include <initializer_list>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -198,6 +199,42 @@ struct dropout_t : public c_compatible {
     dnnl::impl::memory_desc_t user_dropout_desc_;
 };
 
+// Softmax mask computed from the element indices: an implicit causal mask and
+// optional per-row valid lengths passed at execution time.
+struct softmax_mask_t : public c_compatible {
+    softmax_mask_t() = default;
+
+    bool has_default_values() const {
+        return kind_ == softmax_mask_kind::none && !with_lengths();
+    }
+    bool with_causal() const { return kind_ != softmax_mask_kind::none; }
+    bool with_lengths() const { return !types::is_zero_md(&lengths_desc_); }
+    bool operator==(const softmax_mask_t &rhs) const {
+        return kind_ == rhs.kind_ && lengths_desc_ == rhs.lengths_desc_;
+    }
+    softmax_mask_kind_t kind_ = softmax_mask_kind::none;
+    dnnl::impl::memory_desc_t lengths_desc_;
+};
+
+// Splits the columns of a 2D destination into parts with their own layouts.
+// A part is a 4D tensor [B, H, S, D]: row `b * S + s` and column
+// `n0 + h * D + d` of the destination go to element (b, h, s, d) of the part,
+// where `n0` is the number of columns of the previous parts.
+struct dst_split_t : public c_compatible {
+    dst_split_t() = default;
+
+    bool has_default_values() const { return mds_.empty(); }
+    int nparts() const { return static_cast<int>(mds_.size()); }
+    bool operator==(const dst_split_t &rhs) const {
+        if (mds_.size() != rhs.mds_.size()) return false;
+        for (size_t i = 0; i < mds_.size(); i++)
+            if (mds_[i] != rhs.mds_[i]) return false;
+        return true;
+    }
+
+    std::vector<dnnl::impl::memory_desc_t> mds_;
+};
+
 struct rnd_mode_t : public c_compatible {
     rnd_mode_t() = default;
 
@@ -496,6 +533,13 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                 || entry_[sum_ind].sum.dt == dst_dt;
     }
 
+    // Returns true if the post-ops are a single sum with the default scale,
+    // zero point and data type, which adds the result to the destination.
+    bool is_plain_sum() const {
+        return len() == 1 && entry_[0].is_sum()
+                && entry_[0].sum.dt == dnnl_data_type_undef;
+    }
+
     dnnl::impl::status_t validate_binary(dnnl::impl::engine_kind_t engine_kind,
             const dnnl::impl::memory_desc_t *dst_desc) const;
 
@@ -535,7 +579,12 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
         , fpmath_(dnnl::impl::get_fpmath_mode(), false)
         , acc_mode_(dnnl::impl::accumulation_mode::strict)
-        , deterministic_(false) {}
+        , deterministic_(false)
+        , constant_weights_(false)
+        , top_k_(0)
+        , dynamic_quantization_(false)
+        , workspace_dt_(dnnl::impl::data_type::undef)
+        , src_upsampling_(1) {}
 
     ~dnnl_primitive_attr() = default;
 
@@ -560,6 +609,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         fpmath_ = other.fpmath_;
         acc_mode_ = other.acc_mode_;
         deterministic_ = other.deterministic_;
+        constant_weights_ = other.constant_weights_;
         post_ops_ = other.post_ops_;
         rnn_data_qparams_ = other.rnn_data_qparams_;
         CHECK(rnn_weights_qparams_.copy_from(other.rnn_weights_qparams_));
@@ -568,6 +618,12 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         CHECK(rnn_tparams_.copy_from(other.rnn_tparams_));
         if (other.gpu_attr_) gpu_attr_ = other.gpu_attr_->clone();
         dropout_ = other.dropout_;
+        softmax_mask_ = other.softmax_mask_;
+        top_k_ = other.top_k_;
+        dynamic_quantization_ = other.dynamic_quantization_;
+        dst_split_ = other.dst_split_;
+        workspace_dt_ = other.workspace_dt_;
+        src_upsampling_ = other.src_upsampling_;
 
         return status::success;
     }
@@ -594,6 +650,12 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         dropout = 1u << 16,
         rounding_mode = 1u << 17,
         precomputed_reductions = 1u << 18,
+        softmax_mask = 1u << 19,
+        top_k = 1u << 20,
+        dynamic_quantization = 1u << 21,
+        dst_split = 1u << 22,
+        workspace_data_type = 1u << 23,
+        src_upsampling = 1u << 24,
     };
 
     /** Returns true if the attributes have default values.
@@ -609,6 +671,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
                 && fpmath_ == rhs.fpmath_ && acc_mode_ == rhs.acc_mode_
                 && deterministic_ == rhs.deterministic_
+                && constant_weights_ == rhs.constant_weights_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
                 && precomputed_reductions_ == rhs.precomputed_reductions_
                 && post_ops_ == rhs.post_ops_
@@ -621,6 +684,12 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
                             && gpu_attr_->is_equal(*rhs.gpu_attr_))
                         || (!gpu_attr_ && !rhs.gpu_attr_))
                 && dropout_ == rhs.dropout_
+                && softmax_mask_ == rhs.softmax_mask_
+                && top_k_ == rhs.top_k_
+                && dynamic_quantization_ == rhs.dynamic_quantization_
+                && dst_split_ == rhs.dst_split_
+                && workspace_dt_ == rhs.workspace_dt_
+                && src_upsampling_ == rhs.src_upsampling_
                 && rounding_mode_ == rhs.rounding_mode_;
         return ret;
     }
@@ -631,6 +700,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
             dnnl::impl::accumulation_mode_t am);
     dnnl::impl::status_t set_dropout(
             const dnnl::impl::memory_desc_t *dropout_desc);
+    dnnl::impl::status_t set_softmax_mask(dnnl::impl::softmax_mask_kind_t kind,
+            const dnnl::impl::memory_desc_t *lengths_desc);
+    dnnl::impl::status_t set_dst_split(
+            int nparts, const dnnl::impl::memory_desc_t *const *mds);
     dnnl::impl::status_t set_scratchpad_mode(
             dnnl::impl::scratchpad_mode_t scratchpad_mode);
     dnnl::impl::status_t set_post_ops(const dnnl::impl::post_ops_t &post_ops);
@@ -691,12 +764,26 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::fpmath_t fpmath_;
     dnnl::impl::accumulation_mode_t acc_mode_;
     bool deterministic_;
+    // A hint that the weights are the same on every execution.
+    bool constant_weights_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
     dnnl::impl::rnn_create_time_scales_t rnn_weights_qparams_;
     dnnl::impl::rnn_create_time_scales_t rnn_weights_projection_qparams_;
     dnnl::impl::rnn_tparams_t rnn_tparams_;
     dnnl::impl::dropout_t dropout_;
+    dnnl::impl::softmax_mask_t softmax_mask_;
+    // The number of values kept per destination row, zero if not set.
+    dnnl::impl::dim_t top_k_;
+    // The destination scales are computed by the primitive.
+    bool dynamic_quantization_;
+    dnnl::impl::dst_split_t dst_split_;
+    // The data type of the copy of an activation kept for the backward
+    // pass, undef if not set.
+    dnnl::impl::data_type_t workspace_dt_;
+    // The factor of the nearest neighbor upsampling of the source applied
+    // on load, 1 if not set.
+    int src_upsampling_;
     dnnl::impl::rnd_mode_t rounding_mode_;
 
     std::unique_ptr<dnnl::impl::primitive_attr_item_t> gpu_attr_;
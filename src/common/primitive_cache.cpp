@@ -14,6 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <inttypes.h>
+
+#include "oneapi/dnnl/dnnl_debug.h"
+
 #include "primitive_cache.hpp"
 #include "c_types_map.hpp"
 #include "cache_utils.hpp"
@@ -21,6 +25,7 @@
 #include "primitive.hpp"
 #include "primitive_desc_iface.hpp"
 #include "primitive_iface.hpp"
+#include "verbose.hpp"
 #include "z_magic.hpp"
 
 namespace dnnl {
@@ -32,7 +37,10 @@ struct primitive_cache_t {
     using result_t = primitive_cache_iface_t::result_t;
     using create_func_t = result_t (&)(void *);
 
-    primitive_cache_t(int capacity) : cache_(capacity) {};
+    primitive_cache_t(int capacity)
+        : cache_(capacity, [this](const key_t &key, const value_t &value) {
+            on_evict(key, value);
+        }) {};
 
     ~primitive_cache_t() = default;
 
@@ -49,10 +57,76 @@ struct primitive_cache_t {
 
     result_t get_or_create(const key_t &key, create_func_t create,
             void *create_context, bool force_create) {
-        return cache_.get_or_create(key, create, create_context, force_create);
+        return cache_.get_or_create(key, create, create_context, force_create,
+                &counters_[get_counters_idx(key.primitive_kind_)]);
+    }
+
+    // Passing primitive_kind::undefined accumulates the statistics over all
+    // primitive kinds.
+    void get_stats(primitive_kind_t kind, cache_stats_t &stats) {
+        stats = cache_stats_t();
+        const bool all = kind == primitive_kind::undefined;
+        const int idx = get_counters_idx(kind);
+        for (int i = 0; i < n_counters; i++) {
+            if (!all && i != idx) continue;
+            stats.hits += counters_[i].hits.load();
+            stats.misses += counters_[i].misses.load();
+            stats.evictions += counters_[i].evictions.load();
+            stats.creation_time_ms
+                    += counters_[i].creation_time_ns.load() * 1e-6;
+        }
+        stats.size = all ? cache_.get_size()
+                         : cache_.get_size_if([&](const key_t &key) {
+                               return get_counters_idx(key.primitive_kind_)
+                                       == idx;
+                           });
+    }
+
+    void reset_stats() {
+        for (auto &c : counters_)
+            c.reset();
     }
 
 private:
+    using value_t = std::shared_future<result_t>;
+
+    // Counters are kept for every public primitive kind and for the internal
+    // ones. The first entry accumulates the kinds unknown to the cache.
+    static constexpr int n_public_kinds = primitive_kind::embedding_bag;
+    static constexpr int n_internal_kinds
+            = primitive_kind::sdpa - primitive_kind::internal_only_start + 1;
+    static constexpr int n_counters = 1 + n_public_kinds + n_internal_kinds;
+
+    static int get_counters_idx(primitive_kind_t kind) {
+        if (kind > primitive_kind::undefined && kind <= n_public_kinds)
+            return kind;
+        const int internal_idx = kind - primitive_kind::internal_only_start;
+        if (internal_idx >= 0 && internal_idx < n_internal_kinds)
+            return 1 + n_public_kinds + internal_idx;
+        return 0;
+    }
+
+    void on_evict(const key_t &key, const value_t &value) {
+        auto &c = counters_[get_counters_idx(key.primitive_kind_)];
+        c.evictions++;
+        if (!get_verbose(verbose_t::cache_profile)) return;
+
+        // Entries that are still being created have no implementation name
+        // yet.
+        const bool is_ready = value.valid()
+                && value.wait_for(std::chrono::seconds(0))
+                        == std::future_status::ready;
+        const char *impl_name = is_ready && !value.get().is_empty()
+                ? value.get().value->pd()->name()
+                : "";
+        VFORMAT(get_msec(), verbose_t::cache_profile, primitive, cache,
+                VERBOSE_profile,
+                "evict,%s,%s,hits:%" PRIu64 ",misses:%" PRIu64
+                ",evictions:%" PRIu64,
+                dnnl_prim_kind2str(key.primitive_kind_), impl_name,
+                c.hits.load(), c.misses.load(), c.evictions.load());
+    }
+
     static void update_key(const key_t &key, const primitive_t &p) {
         const primitive_desc_t *pd = p.pd().get();
         key.op_desc_ = pd->op_desc();
@@ -65,6 +139,7 @@ private:
         cache_.set_capacity_without_clearing(capacity);
     }
 
+    utils::cache_counters_t counters_[n_counters];
     utils::lru_cache_t<key_t, primitive_t, result_t, update_key> cache_;
 };
 
@@ -136,6 +211,15 @@ primitive_cache_iface_t::result_t primitive_cache_iface_t::get_or_create(
     return {std::move(r.value), r.status};
 }
 
+void primitive_cache_iface_t::get_stats(
+        primitive_kind_t kind, cache_stats_t &stats) const {
+    cache_.get_stats(kind, stats);
+}
+
+void primitive_cache_iface_t::reset_stats() {
+    cache_.reset_stats();
+}
+
 status_t set_primitive_cache_capacity(
         int primitive_capacity, int kernel_capacity) {
     if (primitive_capacity < 0 || kernel_capacity < 0)
@@ -165,3 +249,30 @@ dnnl::impl::status_t dnnl_get_primitive_cache_capacity(int *capacity) {
 dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
     return dnnl::impl::set_primitive_cache_capacity(capacity, capacity);
 }
+
+dnnl::impl::status_t dnnl_get_primitive_cache_stats(
+        dnnl::impl::primitive_kind_t kind, dnnl_cache_stats_t *stats) {
+    if (stats == nullptr) return dnnl::impl::status::invalid_arguments;
+    *stats = dnnl::impl::cache_stats_t();
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    dnnl::impl::primitive_cache().get_stats(kind, *stats);
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_get_kernel_cache_stats(dnnl_cache_stats_t *stats) {
+    if (stats == nullptr) return dnnl::impl::status::invalid_arguments;
+    *stats = dnnl::impl::cache_stats_t();
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    dnnl::impl::kernel_cache::get().get_stats(*stats);
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_reset_cache_stats() {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    dnnl::impl::primitive_cache().reset_stats();
+    dnnl::impl::kernel_cache::get().reset_stats();
+#endif
+    return dnnl::impl::status::success;
+}
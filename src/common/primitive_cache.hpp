@@ -50,6 +50,9 @@ struct primitive_cache_iface_t {
     int get_capacity() const;
     int get_size() const;
 
+    void get_stats(primitive_kind_t kind, cache_stats_t &stats) const;
+    void reset_stats();
+
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key);
     result_t get_or_create(const key_t &key, create_func_t create,
             void *create_context, bool force_create);
@@ -71,7 +71,11 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
                 args[arg] = {mem, false};
                 n_outputs++;
                 extra_outputs += (arg == DNNL_ARG_SCRATCHPAD)
-                        || (arg == DNNL_ARG_ATTR_DROPOUT_MASK);
+                        || (arg == DNNL_ARG_ATTR_DROPOUT_MASK)
+                        // optional sum of lnorm with fused residual addition
+                        || (arg == DNNL_ARG_DST_1
+                                && pd->kind()
+                                        == primitive_kind::layer_normalization);
                 break;
             case primitive_desc_t::arg_usage_t::unused:
                 VINFO(primitive, exec, check, primitive,
@@ -93,23 +97,26 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
 }
 
 memory_t *exec_ctx_t::input(int arg) const {
-    if (args_.count(arg) != 1) return nullptr;
-    const auto ma = args_.at(arg);
-    assert(ma.is_const);
-    return ma.mem;
+    const auto it = args_.find(arg);
+    if (it == args_.end()) return nullptr;
+    assert(it->second.is_const);
+    return it->second.mem;
 }
 
 memory_t *exec_ctx_t::output(int arg) const {
-    if (args_.count(arg) != 1) return nullptr;
-    const auto ma = args_.at(arg);
-    assert(!ma.is_const);
-    return ma.mem;
+    const auto it = args_.find(arg);
+    if (it == args_.end()) return nullptr;
+    assert(!it->second.is_const);
+    return it->second.mem;
 }
 
 status_t exec_ctx_t::zero_pad_output(int arg) const {
     memory_t *mem = this->output(arg);
     if (mem == nullptr) return status::success;
 
+    // The primitive wrote to the padded area, hence it is zeroed regardless
+    // of the state before the execution.
+    mem->set_padding_clean(false);
     return mem->zero_pad(*this);
 }
 
@@ -121,8 +128,14 @@ memory_t *exec_ctx_t::memory(int arg) const {
 }
 
 void exec_ctx_t::register_memory_mapping(void *handle, void *host_ptr) {
-    assert(memory_mapping_.count(handle) == 0);
-    memory_mapping_.insert({handle, host_ptr});
+    assert(!find_mapped_ptr(handle));
+    memory_mapping_.emplace_back(handle, host_ptr);
+}
+
+void *exec_ctx_t::find_mapped_ptr(void *handle) const {
+    for (const auto &m : memory_mapping_)
+        if (m.first == handle) return m.second;
+    return nullptr;
 }
 
 void *exec_ctx_t::host_ptr(
@@ -130,9 +143,10 @@ void *exec_ctx_t::host_ptr(
     status_t status = status::success;
     if (status_) *status_ = status;
 
-    if (args_.count(arg) != 1) return nullptr;
+    const auto it = args_.find(arg);
+    if (it == args_.end()) return nullptr;
 
-    auto *mem = args_.at(arg).mem;
+    auto *mem = it->second.mem;
     if (do_zeropad) status = mem->zero_pad(*this);
     if (status_) *status_ = status;
 
@@ -144,9 +158,8 @@ void *exec_ctx_t::host_ptr(const memory_storage_t *mem_storage) const {
     if (!mem_storage || mem_storage->is_null()) return nullptr;
 
     void *handle = mem_storage->root_storage()->data_handle();
-    void *base_ptr = nullptr;
-    if (memory_mapping_.count(handle) > 0) {
-        base_ptr = memory_mapping_.at(handle);
+    void *base_ptr = find_mapped_ptr(handle);
+    if (base_ptr) {
         base_ptr = reinterpret_cast<char *>(base_ptr)
                 + mem_storage->base_offset();
     } else {
@@ -160,9 +173,7 @@ void *exec_ctx_t::map_memory_storage(
         const memory_storage_t *storage, stream_t *stream, size_t size) const {
     if (!storage || storage->is_null()) return nullptr;
 
-    if (memory_mapping_.count(storage->data_handle()) > 0) {
-        return host_ptr(storage);
-    }
+    if (find_mapped_ptr(storage->data_handle())) return host_ptr(storage);
 
     void *mapped_ptr;
     status_t status = storage->map_data(&mapped_ptr, stream, size);
@@ -174,7 +185,7 @@ void *exec_ctx_t::map_memory_storage(
 void exec_ctx_t::unmap_memory_storage(const memory_storage_t *storage,
         void *mapped_ptr, stream_t *stream) const {
     if (!storage || storage->is_null()
-            || memory_mapping_.count(storage->data_handle()) > 0)
+            || find_mapped_ptr(storage->data_handle()))
         return;
 
     status_t status = storage->unmap_data(mapped_ptr, stream);
@@ -189,8 +200,9 @@ memory_desc_wrapper exec_ctx_t::memory_mdw(
         if (!mdw_from_primitive_desc.has_runtime_dims_or_strides())
             return mdw_from_primitive_desc;
     }
-    if (args_.count(arg) != 1) return memory_desc_wrapper(&glob_zero_md);
-    return memory_desc_wrapper(args_.at(arg).mem->md());
+    const auto it = args_.find(arg);
+    if (it == args_.end()) return memory_desc_wrapper(&glob_zero_md);
+    return memory_desc_wrapper(it->second.mem->md());
 }
 
 const resource_mapper_t *exec_ctx_t::get_resource_mapper() const {
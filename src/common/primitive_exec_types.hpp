@@ -17,7 +17,12 @@
 #ifndef COMMON_PRIMITIVE_EXEC_TYPES_HPP
 #define COMMON_PRIMITIVE_EXEC_TYPES_HPP
 
+#include <algorithm>
+#include <initializer_list>
+#include <stdexcept>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl_types.h"
 
@@ -68,7 +73,130 @@ struct memory_arg_t {
 
 struct primitive_desc_t;
 
-using exec_args_t = std::unordered_map<int, memory_arg_t>;
+// The arguments of a primitive execution, sorted by the argument kind.
+//
+// A primitive takes a handful of arguments, so they are kept in a flat array
+// that is searched linearly and lives in the object itself for up to
+// `inline_capacity` arguments. The execution path does not allocate memory
+// unless a primitive takes more arguments, e.g. a concat of many sources.
+// The interface follows the one of std::map, except that an insertion or an
+// erasure invalidates the iterators and the references to the elements.
+struct exec_args_t {
+    using key_type = int;
+    using mapped_type = memory_arg_t;
+    using value_type = std::pair<int, memory_arg_t>;
+    using iterator = value_type *;
+    using const_iterator = const value_type *;
+
+    exec_args_t() = default;
+    exec_args_t(std::initializer_list<value_type> args) {
+        for (const auto &a : args)
+            insert(a);
+    }
+
+    iterator begin() { return data(); }
+    iterator end() { return data() + size_; }
+    const_iterator begin() const { return data(); }
+    const_iterator end() const { return data() + size_; }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t count(int arg) const { return find(arg) != end(); }
+
+    iterator find(int arg) {
+        auto it = lower_bound(arg);
+        return it != end() && it->first == arg ? it : end();
+    }
+    const_iterator find(int arg) const {
+        return const_cast<exec_args_t *>(this)->find(arg);
+    }
+
+    memory_arg_t &at(int arg) {
+        auto it = find(arg);
+        if (it == end()) throw std::out_of_range("exec_args_t::at");
+        return it->second;
+    }
+    const memory_arg_t &at(int arg) const {
+        return const_cast<exec_args_t *>(this)->at(arg);
+    }
+
+    memory_arg_t &operator[](int arg) {
+        return insert({arg, {nullptr, false}}).first->second;
+    }
+
+    std::pair<iterator, bool> insert(const value_type &value) {
+        auto it = lower_bound(value.first);
+        if (it != end() && it->first == value.first) return {it, false};
+
+        const size_t pos = it - begin();
+        if (!on_heap_ && size_ == inline_capacity) {
+            heap_.assign(inline_, inline_ + size_);
+            on_heap_ = true;
+        }
+        if (on_heap_) {
+            heap_.insert(heap_.begin() + pos, value);
+        } else {
+            std::move_backward(inline_ + pos, inline_ + size_,
+                    inline_ + size_ + 1);
+            inline_[pos] = value;
+        }
+        size_++;
+        return {begin() + pos, true};
+    }
+
+    template <typename it_t>
+    void insert(it_t first, it_t last) {
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    std::pair<iterator, bool> emplace(int arg, const memory_arg_t &ma) {
+        return insert({arg, ma});
+    }
+
+    iterator erase(const_iterator pos) {
+        const size_t idx = pos - begin();
+        if (on_heap_)
+            heap_.erase(heap_.begin() + idx);
+        else
+            std::move(inline_ + idx + 1, inline_ + size_, inline_ + idx);
+        size_--;
+        return begin() + idx;
+    }
+    size_t erase(int arg) {
+        auto it = find(arg);
+        if (it == end()) return 0;
+        erase(it);
+        return 1;
+    }
+
+    void clear() {
+        heap_.clear();
+        on_heap_ = false;
+        size_ = 0;
+    }
+
+private:
+    static constexpr size_t inline_capacity = 12;
+
+    value_type *data() { return on_heap_ ? heap_.data() : inline_; }
+    const value_type *data() const {
+        return on_heap_ ? heap_.data() : inline_;
+    }
+
+    iterator lower_bound(int arg) {
+        // Linear search beats the binary one on a few elements.
+        auto it = begin();
+        while (it != end() && it->first < arg)
+            ++it;
+        return it;
+    }
+
+    value_type inline_[inline_capacity];
+    std::vector<value_type> heap_;
+    size_t size_ = 0;
+    bool on_heap_ = false;
+};
 
 status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
         const dnnl_exec_arg_t *c_args, exec_args_t &args);
@@ -140,10 +268,15 @@ struct exec_ctx_t {
     void set_resource_mapper(const resource_mapper_t *resource_mapper);
 
 private:
+    // Returns the host pointer registered for a handle, or nullptr.
+    void *find_mapped_ptr(void *handle) const;
+
     stream_t *stream_;
     exec_args_t args_;
 
-    std::unordered_map<void *, void *> memory_mapping_;
+    // Host pointers of the memory storages mapped for the execution, by the
+    // storage handle. Only a few storages are mapped, if any.
+    std::vector<std::pair<void *, void *>> memory_mapping_;
     const resource_mapper_t *resource_mapper_ = nullptr;
     const memory_tracking::grantor_t *scratchpad_grantor_ = nullptr;
 };
@@ -39,14 +39,92 @@ key_t::key_t(const engine_t *engine, const op_desc_t *op_desc,
     , skip_idx_(skip_idx)
     , hint_mds_(hint_mds)
     , engine_id_(engine->engine_id())
-    , thread_id_(std::this_thread::get_id()) {}
+    , thread_id_(std::this_thread::get_id()) {
+    // The key is immutable once created, so the hash is computed only once
+    // rather than on every cache lookup.
+    hash_ = compute_hash();
+}
 
 key_t::key_t(const primitive_desc_t *pd, const engine_t *engine)
     : key_t(engine, pd->op_desc(), pd->attr(), pd->pd_iterator_offset(),
             pd->hint_mds(false /* is_hint */), pd->skip_idx()) {}
 
+size_t key_t::compute_hash() const {
+    size_t seed = 0;
+    // Compute hash for primitive_kind_, attr_, impl_id_ and impl_nthr_
+    seed = hash_combine(
+            seed, hash_combine(0, static_cast<size_t>(primitive_kind_)));
+    seed = hash_combine(seed, get_attr_hash(*attr_));
+    seed = hash_combine(seed, hash_combine(0, pd_iterator_offset_));
+    seed = hash_combine(seed, hash_combine(0, impl_nthr_));
+    seed = hash_combine(seed, hash_combine(0, skip_idx_));
+
+    seed = hash_combine(seed, engine_id_.hash());
+
+    seed = get_array_hash(seed, hint_mds_.data(), (int)hint_mds_.size());
+
+    const size_t verb_seed_before_desc = seed;
+    UNUSED(verb_seed_before_desc);
+
+    // Combine hash for op_desc with the computed hash
+#define CASE(pkind) \
+    case primitive_kind::pkind: \
+        seed = hash_combine(seed, \
+                get_desc_hash(*op_desc_t::to_desc<pkind##_desc_t>(op_desc_))); \
+        break;
+
+    // clang-format off
+    switch ((int)primitive_kind_) {
+        CASE(batch_normalization)
+        CASE(binary)
+        CASE(concat)
+        CASE(convolution)
+        CASE(deconvolution)
+        CASE(eltwise)
+        CASE(embedding_bag)
+        CASE(gemm)
+        CASE(group_normalization)
+        CASE(inner_product)
+        CASE(layer_normalization)
+        CASE(lrn)
+        CASE(matmul)
+        CASE(pooling)
+        CASE(prelu)
+        CASE(reduction)
+        CASE(reorder)
+        CASE(resampling)
+        CASE(rnn)
+        CASE(sdpa)
+        CASE(shuffle)
+        CASE(softmax)
+        CASE(sum)
+        CASE(zero_pad)
+        default: assert(!"unknown primitive_kind");
+    }
+    // clang-format on
+#undef CASE
+
+    // Note: `16` is just a random number, as debuginfo hasn't received a
+    // single command center for levels across layers of the library.
+    // ANCHOR: HASHING_DEBUGINFO_16.
+    VDEBUGINFO(16, primitive, hashing,
+            "compute_hash(),seed_before_desc=%zu seed_after_desc=%zu",
+            verb_seed_before_desc, seed);
+
+    return seed;
+}
+
 bool key_t::operator==(const key_t &rhs) const {
     DNNL_SHORT_CIRCUIT_SELF_COMPARISON(rhs);
+    // Keys with different hashes can't be equal. This rejects most of the
+    // mismatches without comparing the descriptors.
+    if (hash_ != rhs.hash_) return false;
+
+    // The descriptors are shared when a key is compared with a copy of
+    // itself, e.g. the one stored in the primitive cache for the same
+    // primitive descriptor.
+    const bool same_descs = op_desc_ == rhs.op_desc_ && attr_ == rhs.attr_;
+
     // clang-format off
     bool ret = true
         // Less expensive comparisons come first
@@ -56,11 +134,11 @@ bool key_t::operator==(const key_t &rhs) const {
         && pd_iterator_offset_ == rhs.pd_iterator_offset_
         && impl_nthr_ == rhs.impl_nthr_
         && skip_idx_ == rhs.skip_idx_
-        && (*attr_) == (*rhs.attr_)
+        && (same_descs || (*attr_) == (*rhs.attr_))
         && std::equal(
             hint_mds_.begin(), hint_mds_.end(), rhs.hint_mds_.begin());
 
-    if (!ret) {
+    if (!ret || same_descs) {
         // ANCHOR: HASHING_DEBUGINFO_16.
         VDEBUGINFO(16, primitive, hashing, "operator==,ret=%d", ret);
         return ret;
@@ -83,6 +161,7 @@ bool key_t::operator==(const key_t &rhs) const {
             break;
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gemm)
             CASE(group_normalization)
             CASE(inner_product)
@@ -182,6 +261,19 @@ size_t get_md_hash(const memory_desc_t &md) {
             seed = get_array_hash(seed,
                     md.format_desc.sparse_desc.metadata_types,
                     sparse_desc_t::max_metadata_types);
+            if (md.format_desc.sparse_desc.encoding == sparse_encoding::paged) {
+                seed = hash_combine(
+                        seed, md.format_desc.sparse_desc.paged_dim);
+                seed = hash_combine(
+                        seed, md.format_desc.sparse_desc.page_size);
+            }
+            if (md.format_desc.sparse_desc.encoding
+                    == sparse_encoding::structured) {
+                seed = hash_combine(
+                        seed, md.format_desc.sparse_desc.structured_n);
+                seed = hash_combine(
+                        seed, md.format_desc.sparse_desc.structured_m);
+            }
             // User cannot initialize `packed_desc` therefore `packed_desc`
             // is always zero initialized.
             break;
@@ -228,6 +320,11 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_.apply_to_int_));
     // deterministic
     seed = hash_combine(seed, static_cast<size_t>(attr.deterministic_));
+    // constant weights
+    seed = hash_combine(seed, static_cast<size_t>(attr.constant_weights_));
+    // dynamic quantization
+    seed = hash_combine(
+            seed, static_cast<size_t>(attr.dynamic_quantization_));
     // acc_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.acc_mode_));
     // rounding_mode
@@ -312,6 +409,19 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
         seed = hash_combine(
                 seed, get_md_hash(attr.dropout_.user_dropout_desc_));
     }
+    if (!attr.softmax_mask_.has_default_values()) {
+        seed = hash_combine(
+                seed, static_cast<size_t>(attr.softmax_mask_.kind_));
+        seed = hash_combine(
+                seed, get_md_hash(attr.softmax_mask_.lengths_desc_));
+    }
+    if (attr.top_k_ != 0) {
+        seed = hash_combine(seed, static_cast<size_t>(attr.top_k_));
+    }
+    for (const auto &md : attr.dst_split_.mds_)
+        seed = hash_combine(seed, get_md_hash(md));
+    seed = hash_combine(seed, static_cast<size_t>(attr.workspace_dt_));
+    seed = hash_combine(seed, attr.src_upsampling_);
     // Combined hash for attributes
     return seed;
 }
@@ -428,6 +538,21 @@ size_t get_desc_hash(const eltwise_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const embedding_bag_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for embedding bag desc
+    return seed;
+}
+
 size_t get_desc_hash(const gemm_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -745,6 +870,8 @@ size_t get_desc_hash(const sdpa_desc_t &desc) {
     seed = hash_combine(seed, desc.vs_zero_points.get_hash());
     seed = hash_combine(seed, get_md_hash(desc.dst_desc));
     seed = hash_combine(seed, get_md_hash(desc.attn_mask_desc));
+    seed = hash_combine(seed, get_md_hash(desc.block_table_desc));
+    seed = hash_combine(seed, get_md_hash(desc.context_lens_desc));
     // Scale type
     seed = hash_combine(seed, static_cast<size_t>(desc.scale_dt));
     seed = hash_combine(seed, static_cast<size_t>(desc.kq_acc_dt));
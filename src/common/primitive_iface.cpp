@@ -14,16 +14,29 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <iomanip>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "exec_trace.hpp"
+#include "parallel_profiler.hpp"
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
 #include "ittnotify.hpp"
 #endif
 
 #include "cache_hit_types.hpp"
+#include "convolution_pd.hpp"
+#include "deconvolution_pd.hpp"
+#include "inner_product_pd.hpp"
+#include "matmul_pd.hpp"
+#include "persistent_cache.hpp"
+#include "primitive_cache.hpp"
 #include "primitive.hpp"
 #include "primitive_desc_iface.hpp"
 #include "primitive_exec_types.hpp"
@@ -54,17 +67,83 @@ void unpoison_outputs(const exec_args_t &args) {
         msan_unpoison(p, s);
     }
 }
+
+// Primitives leave the padded area of their outputs zeroed, which spares the
+// zero padding of the outputs when they are used as destinations again. The
+// workspace layout is implementation defined and is not accounted.
+void mark_outputs_padding_clean(const exec_args_t &args) {
+    for (const auto &arg : args) {
+        if (arg.second.is_const || arg.first == DNNL_ARG_WORKSPACE) continue;
+        if (arg.second.mem) arg.second.mem->set_padding_clean(true);
+    }
+}
+
+#ifndef NDEBUG
+// Marks the user scratchpad of a CPU primitive as used for the duration of
+// its execution, to catch the scratchpads aliased by primitives that run
+// concurrently.
+class scratchpad_use_t {
+public:
+    scratchpad_use_t() = default;
+    ~scratchpad_use_t() {
+        if (!ptr_) return;
+        std::lock_guard<std::mutex> lock(mutex());
+        auto &uses = active_uses();
+        for (auto it = uses.begin(); it != uses.end(); ++it) {
+            if (it->ptr == ptr_) {
+                uses.erase(it);
+                break;
+            }
+        }
+    }
+
+    bool acquire(const memory_storage_t *mem_storage, size_t size) {
+        if (!mem_storage || size == 0
+                || mem_storage->engine()->kind() != engine_kind::cpu)
+            return true;
+        const char *ptr = static_cast<const char *>(mem_storage->data_handle());
+        const auto tid = std::this_thread::get_id();
+        std::lock_guard<std::mutex> lock(mutex());
+        auto &uses = active_uses();
+        for (const auto &u : uses)
+            if (u.tid != tid && ptr < u.ptr + u.size && u.ptr < ptr + size)
+                return false;
+        uses.push_back({ptr, size, tid});
+        ptr_ = ptr;
+        return true;
+    }
+
+private:
+    struct use_t {
+        const char *ptr;
+        size_t size;
+        std::thread::id tid;
+    };
+
+    const char *ptr_ = nullptr;
+
+    static std::mutex &mutex() {
+        static std::mutex m;
+        return m;
+    }
+    static std::vector<use_t> &active_uses() {
+        static auto *uses = new std::vector<use_t>();
+        return *uses;
+    }
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scratchpad_use_t);
+};
+#endif
 } // namespace
 
 namespace dnnl {
 namespace impl {
 
-status_t primitive_create(primitive_iface_t **primitive_iface,
+namespace {
+status_t primitive_create_impl(
+        std::pair<primitive_iface_t *, cache_state_t> &p_iface,
         const primitive_desc_iface_t *primitive_desc_iface,
-        const cache_blob_t &cache_blob = cache_blob_t()) {
-
-    std::pair<primitive_iface_t *, cache_state_t> p_iface;
-
+        const cache_blob_t &cache_blob) {
     if (get_verbose(verbose_t::create_profile,
                 prim_kind2_comp_kind(primitive_desc_iface->impl()->kind()))) {
         double start_ms = get_msec();
@@ -84,9 +163,114 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
         CHECK(primitive_desc_iface->create_primitive_iface(
                 p_iface, cache_blob));
     }
+    return status::success;
+}
+
+// Saves the cache blob of a freshly created primitive into the persistent
+// cache directory, or only into the bundle of the calling thread when the
+// primitive was fetched from the primitive cache. Failures are not reported
+// as the primitive itself is valid.
+void persistent_cache_store(const primitive_iface_t *p_iface,
+        const std::vector<uint8_t> &id, bool bundle_only) {
+    size_t size = 0;
+    if (p_iface->get_cache_blob_size(&size) != status::success || size == 0)
+        return;
+    std::vector<uint8_t> blob(size);
+    cache_blob_t cb(blob.data(), size);
+    if (p_iface->get_cache_blob(cb) != status::success) return;
+    if (!bundle_only)
+        persistent_cache::store(id, blob);
+    else if (auto *bundle = persistent_cache::get_thread_bundle())
+        bundle->add(id, blob);
+}
+} // namespace
+
+status_t primitive_create(primitive_iface_t **primitive_iface,
+        const primitive_desc_iface_t *primitive_desc_iface,
+        const cache_blob_t &cache_blob = cache_blob_t()) {
+
+    std::pair<primitive_iface_t *, cache_state_t> p_iface;
+
+    // The persistent cache directory is consulted only when the user didn't
+    // pass a cache blob explicitly and the primitive is missing in the
+    // in-memory primitive cache. A bundle attached to the thread records the
+    // blobs of the primitives from the in-memory cache as well.
+    auto *bundle = persistent_cache::get_thread_bundle();
+    const bool use_persistent_cache = !cache_blob
+            && persistent_cache::is_enabled()
+            && (bundle || !is_pd_in_cache(primitive_desc_iface));
+    if (use_persistent_cache) {
+        const auto &id = primitive_desc_iface->impl()->get_cache_blob_id(
+                primitive_desc_iface->engine());
+        if (!id.empty()) {
+            std::vector<uint8_t> blob;
+            if (persistent_cache::load(id, blob) == status::success) {
+                cache_blob_t cb(blob.data(), blob.size());
+                if (primitive_create_impl(p_iface, primitive_desc_iface, cb)
+                        == status::success) {
+                    if (bundle) bundle->add(id, blob);
+                    return safe_ptr_assign((*primitive_iface), p_iface.first);
+                }
+                // A stale or corrupted entry; fall back to regular creation
+                // and overwrite it below.
+            }
+            CHECK(primitive_create_impl(
+                    p_iface, primitive_desc_iface, cache_blob));
+            const bool hit = p_iface.second == cache_state_t::primitive_hit;
+            if (!hit || bundle) persistent_cache_store(p_iface.first, id, hit);
+            return safe_ptr_assign((*primitive_iface), p_iface.first);
+        }
+    }
+
+    CHECK(primitive_create_impl(p_iface, primitive_desc_iface, cache_blob));
     return safe_ptr_assign((*primitive_iface), p_iface.first);
 }
 
+// Returns the number of floating-point operations of the compute-bound
+// primitives, or 0 for the others.
+static double get_flops(const primitive_desc_t *pd) {
+    if (pd->has_runtime_dims_or_strides()) return 0;
+    switch ((int)pd->kind()) {
+        case primitive_kind::convolution: {
+            auto *c = utils::downcast<const convolution_pd_t *>(pd);
+            return 2.0 * c->MB() * c->OC() * c->OD() * c->OH() * c->OW()
+                    * (c->IC() / c->G()) * c->KD() * c->KH() * c->KW();
+        }
+        case primitive_kind::deconvolution: {
+            auto *d = utils::downcast<const deconvolution_pd_t *>(pd);
+            return 2.0 * d->MB() * d->IC() * d->ID() * d->IH() * d->IW()
+                    * (d->OC() / d->G()) * d->KD() * d->KH() * d->KW();
+        }
+        case primitive_kind::inner_product: {
+            auto *ip = utils::downcast<const inner_product_pd_t *>(pd);
+            return 2.0 * ip->MB() * ip->OC() * ip->IC_total();
+        }
+        case primitive_kind::matmul: {
+            auto *m = utils::downcast<const matmul_pd_t *>(pd);
+            return 2.0 * m->batch() * m->M() * m->N() * m->K();
+        }
+        default: return 0;
+    }
+}
+
+// Returns the hardware counters of the latest execution for the profile_exec
+// verbose output, or an empty string when the stream does not collect them.
+static std::string exec_counters_str(
+        const primitive_desc_t *pd, const stream_t *stream) {
+    exec_counters_t c;
+    if (stream->get_last_exec_counters(c) != status::success || c.nsec == 0)
+        return std::string();
+    const double nsec = static_cast<double>(c.nsec);
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(1);
+    ss << ",eu_active:" << 100 * c.eu_active_nsec / nsec << "%";
+    ss << ",eu_stall:" << 100 * c.eu_stall_nsec / nsec << "%";
+    ss << ",bw:" << c.mem_bytes / nsec << "GB/s";
+    const double flops = get_flops(pd);
+    if (flops > 0) ss << ",gflops:" << flops / nsec;
+    return ss.str();
+}
+
 status_t primitive_execute(
         const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
     auto stream = ctx.stream();
@@ -98,13 +282,53 @@ status_t primitive_execute(
         itt::primitive_task_start(primitive_iface->pd()->impl()->kind());
 #endif
 
-    if (get_verbose(verbose_t::exec_profile,
-                prim_kind2_comp_kind(primitive_iface->pd()->impl()->kind()))) {
+    // Tracing only brackets the submission and never waits for the stream to
+    // keep the overhead low enough for production use.
+    const bool trace
+            = exec_trace::is_enabled(primitive_iface->pd()->impl()->kind());
+    const uint64_t trace_start_ns = trace ? exec_trace::get_time_ns() : 0;
+
+    const bool profile = get_verbose(verbose_t::exec_profile,
+            prim_kind2_comp_kind(primitive_iface->pd()->impl()->kind()));
+
+    // The parallel regions of the execution are timed per thread to report
+    // their imbalance. Only the regions started by this thread are seen, so
+    // a CPU stream executing asynchronously reports nothing.
+    bool profile_threads
+            = profile && stream->engine()->kind() == engine_kind::cpu;
+#if defined(DNNL_ENABLE_ITT_TASKS)
+    const bool itt_imbalance
+            = enable_itt && itt::get_itt(itt::__itt_task_level_metrics);
+    profile_threads = profile_threads || itt_imbalance;
+#endif
+    parallel_profiler::region_t thread_region;
+    parallel_profiler::region_t *saved_region
+            = parallel_profiler::active_region();
+    if (profile_threads) parallel_profiler::active_region() = &thread_region;
+
+    if (profile) {
         stream->wait();
+        const int n_dynamic_schedules
+                = parallel_profiler::dynamic_schedule_count();
+        parallel_profiler::capped_nthr() = 0;
         double start_ms = get_msec();
         status = stream->enqueue_primitive(primitive_iface, ctx);
         stream->wait();
         double duration_ms = get_msec() - start_ms;
+        if (parallel_profiler::dynamic_schedule_count()
+                != n_dynamic_schedules)
+            VFORMAT(start_ms, verbose_t::exec_profile, primitive, exec,
+                    VERBOSE_profile, "scheduler,dynamic,%s",
+                    primitive_iface->pd()->info());
+        if (const int capped_nthr = parallel_profiler::capped_nthr())
+            VFORMAT(start_ms, verbose_t::exec_profile, primitive, exec,
+                    VERBOSE_profile, "scheduler,nthr:%d,%s", capped_nthr,
+                    primitive_iface->pd()->info());
+        if (const double imbalance = thread_region.imbalance())
+            VFORMAT(start_ms, verbose_t::exec_profile, primitive, exec,
+                    VERBOSE_profile, "scheduler,imbalance:%.2f,%s", imbalance,
+                    primitive_iface->pd()->info());
+        std::string info;
         if (primitive_iface->pd()->impl()->has_runtime_dims_or_strides()) {
             // Take out mds from `ctx` here to avoid primitive_desc dependency
             // on `exec_ctx_t` type.
@@ -122,23 +346,37 @@ status_t primitive_execute(
                     = primitive_iface->pd()->impl()->invariant_dst_md();
             const auto dst_md = ctx.memory_mdw(DNNL_ARG_DST, pd_dst_md).md_;
 
-            std::string info = primitive_iface->pd()->info_with_runtime_dims(
+            info = primitive_iface->pd()->info_with_runtime_dims(
                     src_md, wei_md, bia_md, dst_md);
-            VPROF(start_ms, primitive, exec, VERBOSE_profile, info.c_str(),
-                    duration_ms);
         } else {
-            VPROF(start_ms, primitive, exec, VERBOSE_profile,
-                    primitive_iface->pd()->info(), duration_ms);
+            info = primitive_iface->pd()->info();
         }
+        const auto *pd = primitive_iface->pd()->impl().get();
+        const std::string counters = exec_counters_str(pd, stream);
+        VFORMAT(start_ms, verbose_t::exec_profile, primitive, exec,
+                VERBOSE_profile, "%s,%g%s", info.c_str(), duration_ms,
+                counters.c_str());
     } else {
         status = stream->enqueue_primitive(primitive_iface, ctx);
     }
 
+    if (trace)
+        exec_trace::record(primitive_iface->exec_trace_id(), trace_start_ns,
+                exec_trace::get_time_ns(), status);
+
+    if (profile_threads) {
+        parallel_profiler::active_region() = saved_region;
+        if (saved_region) saved_region->add(thread_region);
+    }
+
 #if defined(DNNL_ENABLE_ITT_TASKS)
+    if (itt_imbalance && thread_region.imbalance() > 0)
+        itt::primitive_task_add_imbalance(thread_region.imbalance());
     if (enable_itt) itt::primitive_task_end();
 #endif
 
     if (msan_enabled) unpoison_outputs(ctx.args());
+    if (status == success) mark_outputs_padding_clean(ctx.args());
 
     return status;
 }
@@ -187,6 +425,22 @@ status_t dnnl_primitive_create_from_cache_blob(
             primitive_iface, primitive_desc_iface, cb);
 }
 
+// Executes the primitive under the stack checker when it is enabled.
+static status_t checked_primitive_execute(const char *api_name,
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+#ifdef DNNL_ENABLE_STACK_CHECKER
+    stack_checker::stack_checker_t sc(api_name);
+    const auto *pd_iface = primitive_iface->pd();
+    bool is_wino
+            = std::string(pd_iface->info()).find("wino") != std::string::npos;
+    if (!is_wino) {
+        return sc.check(
+                dnnl::impl::primitive_execute, primitive_iface, std::ref(ctx));
+    }
+#endif
+    return dnnl::impl::primitive_execute(primitive_iface, ctx);
+}
+
 status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
         stream_t *stream, int nargs, const dnnl_exec_arg_t *c_args) {
     bool ok = true && !utils::any_null(primitive_iface, stream)
@@ -199,26 +453,111 @@ status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
             primitive_iface->pd()->impl().get(), nargs, c_args, args);
     if (status != status::success) return status;
 
+    if (stream->is_capturing()) {
+        stream->capture(primitive_iface, std::move(args));
+        return success;
+    }
+
     stream->before_exec_hook();
 
     exec_ctx_t ctx(stream, std::move(args));
-#ifdef DNNL_ENABLE_STACK_CHECKER
-    stack_checker::stack_checker_t sc("dnnl_primitive_execute");
-    const auto *pd_iface = primitive_iface->pd();
-    bool is_wino
-            = std::string(pd_iface->info()).find("wino") != std::string::npos;
-    if (!is_wino) {
-        status = sc.check(
-                dnnl::impl::primitive_execute, primitive_iface, std::ref(ctx));
+    status = checked_primitive_execute(
+            "dnnl_primitive_execute", primitive_iface, ctx);
+    stream->after_exec_hook();
+    if (status == success && stream->is_native_capturing())
+        stream->keep_captured(primitive_iface);
+
+    return status;
+}
+
+status_t dnnl_primitive_execute_batch(stream_t *stream, int n,
+        const primitive_iface_t *const *primitives, const int *nargs,
+        const dnnl_exec_arg_t *const *c_args) {
+    bool ok = stream != nullptr && n >= 0
+            && IMPLICATION(n > 0, !utils::any_null(primitives, nargs, c_args));
+    if (!ok) return invalid_arguments;
+
+    // Arguments of all primitives are converted up front so that an invalid
+    // argument does not leave the sequence partially executed.
+    std::vector<exec_ctx_t> ctxs;
+    ctxs.reserve(n);
+    for (int i = 0; i < n; i++) {
+        const auto *primitive_iface = primitives[i];
+        ok = primitive_iface != nullptr
+                && primitive_iface->engine() == stream->engine()
+                && IMPLICATION(nargs[i] > 0, c_args[i] != nullptr);
+        if (!ok) return invalid_arguments;
+
+        exec_args_t args;
+        CHECK(cvt_primitive_args(primitive_iface->pd()->impl().get(),
+                nargs[i], c_args[i], args));
+        ctxs.emplace_back(stream, std::move(args));
     }
-#else
-    status = dnnl::impl::primitive_execute(primitive_iface, ctx);
-#endif
+
+    if (stream->is_capturing()) {
+        for (int i = 0; i < n; i++)
+            stream->capture(primitives[i], exec_args_t(ctxs[i].args()));
+        return success;
+    }
+
+    stream->before_exec_hook();
+
+    status_t status = success;
+    for (int i = 0; i < n && status == success; i++) {
+        status = checked_primitive_execute(
+                "dnnl_primitive_execute_batch", primitives[i], ctxs[i]);
+        if (status == success && stream->is_native_capturing())
+            stream->keep_captured(primitives[i]);
+    }
+
     stream->after_exec_hook();
 
     return status;
 }
 
+status_t dnnl_primitive_plan_scratchpad(int n,
+        const primitive_iface_t *const *primitives, const int *stream_ids,
+        size_t *offsets, size_t *size) {
+    bool ok = size != nullptr && n >= 0
+            && IMPLICATION(
+                    n > 0, !utils::any_null(primitives, stream_ids, offsets));
+    if (!ok) return invalid_arguments;
+
+    // A stream has a region of the size of its largest scratchpad. The
+    // regions follow the order of the first primitives of the streams.
+    std::vector<int> ids;
+    std::vector<size_t> region_sizes;
+    std::vector<size_t> regions(n);
+    for (int i = 0; i < n; i++) {
+        if (primitives[i] == nullptr) return invalid_arguments;
+        const size_t scratchpad_size
+                = primitives[i]->pd()->impl()->scratchpad_size(
+                        scratchpad_mode::user);
+        size_t r = 0;
+        while (r < ids.size() && ids[r] != stream_ids[i])
+            r++;
+        if (r == ids.size()) {
+            ids.push_back(stream_ids[i]);
+            region_sizes.push_back(0);
+        }
+        region_sizes[r] = nstl::max(region_sizes[r], scratchpad_size);
+        regions[i] = r;
+    }
+
+    const size_t alignment = memory_tracking::get_alignment(
+            memory_tracking::default_alignment);
+    std::vector<size_t> region_offsets(ids.size());
+    size_t total = 0;
+    for (size_t r = 0; r < ids.size(); r++) {
+        region_offsets[r] = total;
+        total += utils::rnd_up(region_sizes[r], alignment);
+    }
+    for (int i = 0; i < n; i++)
+        offsets[i] = region_offsets[regions[i]];
+    *size = total;
+    return success;
+}
+
 status_t dnnl_primitive_get_primitive_desc(
         const primitive_iface_t *primitive_iface,
         const primitive_desc_iface_t **primitive_desc_iface) {
@@ -319,12 +658,62 @@ const primitive_desc_iface_t *dnnl_primitive::pd() const {
     return pd_.get();
 }
 
+uint32_t dnnl_primitive::exec_trace_id() const {
+    uint32_t id = exec_trace_id_.load(std::memory_order_relaxed);
+    if (id != 0) return id;
+
+    id = exec_trace::register_primitive(pd_->impl()->kind(), pd_->info());
+    // Another thread may have registered the primitive concurrently; the
+    // first id wins and the other one is left unused.
+    uint32_t expected = 0;
+    if (!exec_trace_id_.compare_exchange_strong(expected, id)) id = expected;
+    return id;
+}
+
 status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
     const memory_storage_t *mem_storage = nullptr;
-    if (primitive_->pd()->attr()->scratchpad_mode_ == scratchpad_mode::user) {
+    const auto scratchpad_mode = primitive_->pd()->attr()->scratchpad_mode_;
+#ifndef NDEBUG
+    scratchpad_use_t scratchpad_use;
+#endif
+    if (scratchpad_mode == scratchpad_mode::user) {
         memory_t *scratchpad_memory = ctx.output(DNNL_ARG_SCRATCHPAD);
         mem_storage = scratchpad_memory ? scratchpad_memory->memory_storage()
                                         : nullptr;
+#ifndef NDEBUG
+        // The bindings of a shared scratchpad buffer are validated in debug
+        // builds only, as the checks serialize the executions.
+        const size_t scratchpad_size
+                = primitive_->pd()->scratchpad_size(scratchpad_mode::user);
+        VCONDCHECK(primitive, exec, check, primitive,
+                scratchpad_size == 0
+                        || (scratchpad_memory
+                                && memory_desc_wrapper(scratchpad_memory->md())
+                                                .size()
+                                        >= scratchpad_size),
+                status::invalid_arguments,
+                "scratchpad is smaller than required (%zu bytes)",
+                scratchpad_size);
+        VCONDCHECK(primitive, exec, check, primitive,
+                scratchpad_use.acquire(mem_storage, scratchpad_size),
+                status::invalid_arguments,
+                "scratchpad is used by a concurrent execution");
+#endif
+    } else if (scratchpad_mode == scratchpad_mode::stream) {
+        const size_t scratchpad_size
+                = primitive_->pd()->scratchpad_size(scratchpad_mode::stream);
+        if (scratchpad_size) {
+            // The arena is shared between primitives, which is only valid
+            // when they are executed in order.
+            VCONDCHECK(primitive, exec, check, primitive,
+                    !(ctx.stream()->flags() & stream_flags::out_of_order),
+                    status::invalid_arguments,
+                    "stream scratchpad mode is not supported for out-of-order "
+                    "streams");
+            mem_storage
+                    = ctx.stream()->scratchpad_arena().get(scratchpad_size);
+            if (mem_storage == nullptr) return status::out_of_memory;
+        }
     } else if (scratchpad_) {
         mem_storage = scratchpad_->get_memory_storage();
     }
@@ -66,6 +66,10 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
             dnnl::impl::cache_blob_t cache_blob) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
 
+    // Returns the id of the primitive in the binary execution trace. The id
+    // is assigned on the first traced execution.
+    uint32_t exec_trace_id() const;
+
     void retain() { counter_++; }
 
     void release() {
@@ -81,6 +85,7 @@ private:
     std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
     std::unique_ptr<primitive_desc_iface_t> pd_;
     dnnl::impl::resource_mapper_t resource_mapper_;
+    mutable std::atomic<uint32_t> exec_trace_id_ {0};
 
     dnnl_primitive() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive);
@@ -0,0 +1,182 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "engine.hpp"
+#include "primitive_cache.hpp"
+#include "primitive_desc_iface.hpp"
+#include "primitive_iface.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+// Creates primitives on background threads. A created primitive is released
+// right away: the only purpose of the creation is to fill the primitive
+// cache, so that the subsequent creation of the same primitive by the user is
+// a cache hit.
+struct prewarm_queue_t {
+    static prewarm_queue_t &get() {
+        static prewarm_queue_t queue;
+        return queue;
+    }
+
+    // Takes ownership of the primitive descriptors.
+    void push(const std::vector<primitive_desc_iface_t *> &pd_ifaces) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto *pd_iface : pd_ifaces) {
+            // The engine must stay alive until the primitive is created.
+            pd_iface->engine()->retain();
+            queue_.push_back(pd_iface);
+        }
+        const size_t nthr = std::min(queue_.size() + n_active_, max_nthr_);
+        while (workers_.size() < nthr)
+            workers_.emplace_back(&prewarm_queue_t::worker, this);
+        cv_.notify_all();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [&] { return queue_.empty() && n_active_ == 0; });
+    }
+
+private:
+    prewarm_queue_t()
+        : max_nthr_(std::max(1, getenv_int_user("PRIMITIVE_PREWARM_THREADS",
+                                        default_max_nthr))) {
+        // Guarantees that the primitive cache outlives the workers.
+        MAYBE_UNUSED(primitive_cache().get_capacity());
+    }
+
+    ~prewarm_queue_t() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto &w : workers_) {
+#ifdef _WIN32
+            // Other threads are already terminated when static objects are
+            // destroyed during the process termination.
+            w.detach();
+#else
+            w.join();
+#endif
+        }
+        for (auto *pd_iface : queue_)
+            destroy(pd_iface);
+    }
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(prewarm_queue_t);
+
+    static void destroy(primitive_desc_iface_t *pd_iface) {
+        engine_t *engine = pd_iface->engine();
+        delete pd_iface;
+        engine->release();
+    }
+
+    void worker() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [&] { return stop_ || !queue_.empty(); });
+            if (stop_) return;
+
+            auto *pd_iface = queue_.front();
+            queue_.pop_front();
+            n_active_++;
+            lock.unlock();
+
+            // Errors are not reported: the user gets them on the regular
+            // creation of the primitive.
+            primitive_iface_t *p_iface = nullptr;
+            if (dnnl_primitive_create(&p_iface, pd_iface) == success)
+                dnnl_primitive_destroy(p_iface);
+            destroy(pd_iface);
+
+            lock.lock();
+            n_active_--;
+            if (queue_.empty() && n_active_ == 0) done_cv_.notify_all();
+        }
+    }
+
+    static constexpr int default_max_nthr = 2;
+
+    const size_t max_nthr_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable done_cv_;
+    std::deque<primitive_desc_iface_t *> queue_;
+    std::vector<std::thread> workers_;
+    size_t n_active_ = 0;
+    bool stop_ = false;
+};
+
+} // namespace
+
+} // namespace impl
+} // namespace dnnl
+
+status_t dnnl_primitive_cache_prewarm(
+        int n, const primitive_desc_iface_t *const *primitive_desc_ifaces) {
+    if (n < 0 || (n > 0 && primitive_desc_ifaces == nullptr))
+        return invalid_arguments;
+    for (int i = 0; i < n; i++)
+        if (primitive_desc_ifaces[i] == nullptr) return invalid_arguments;
+
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    if (n == 0 || primitive_cache().get_capacity() == 0) return success;
+
+    // The queue owns copies of the primitive descriptors so that the user is
+    // free to destroy the passed ones.
+    std::vector<primitive_desc_iface_t *> clones;
+    clones.reserve(n);
+    for (int i = 0; i < n; i++) {
+        primitive_desc_iface_t *clone = nullptr;
+        status_t status = dnnl_primitive_desc_clone(
+                &clone, primitive_desc_ifaces[i]);
+        if (status != success) {
+            for (auto *c : clones)
+                delete c;
+            return status;
+        }
+        clones.push_back(clone);
+    }
+    prewarm_queue_t::get().push(clones);
+#endif
+    return success;
+}
+
+status_t dnnl_primitive_cache_prewarm_wait() {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    prewarm_queue_t::get().wait();
+#endif
+    return success;
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
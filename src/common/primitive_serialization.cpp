@@ -35,6 +35,7 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(embedding_bag)
         CASE(gemm)
         CASE(group_normalization)
         CASE(inner_product)
@@ -184,6 +185,10 @@ void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr) {
     sstream.append(attr.fpmath_.apply_to_int_);
     // deterministic
     sstream.append(attr.deterministic_);
+    // constant weights
+    sstream.append(attr.constant_weights_);
+    // dynamic quantization
+    sstream.append(attr.dynamic_quantization_);
     // acc_mode
     sstream.append(attr.acc_mode_);
 
@@ -216,6 +221,34 @@ void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr) {
         serialize(sstream, attr.dropout_.user_dropout_desc_);
     }
 
+    if (!attr.softmax_mask_.has_default_values()) {
+        sstream.append('m');
+        sstream.append(attr.softmax_mask_.kind_);
+        serialize(sstream, attr.softmax_mask_.lengths_desc_);
+    }
+
+    if (attr.top_k_ != 0) {
+        sstream.append('k');
+        sstream.append(attr.top_k_);
+    }
+
+    if (!attr.dst_split_.has_default_values()) {
+        sstream.append('q');
+        sstream.append(attr.dst_split_.nparts());
+        for (const auto &md : attr.dst_split_.mds_)
+            serialize(sstream, md);
+    }
+
+    if (attr.workspace_dt_ != data_type::undef) {
+        sstream.append('w');
+        sstream.append(attr.workspace_dt_);
+    }
+
+    if (attr.src_upsampling_ != 1) {
+        sstream.append('u');
+        sstream.append(attr.src_upsampling_);
+    }
+
     serialize(sstream, attr.post_ops_);
 
     // rnn_data_qparams: scale, shift
@@ -325,6 +358,19 @@ void serialize(serialization_stream_t &sstream, const eltwise_desc_t &desc) {
     sstream.append(desc.beta);
 }
 
+void serialize(
+        serialization_stream_t &sstream, const embedding_bag_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.indices_desc);
+    serialize(sstream, desc.offsets_desc);
+    serialize(sstream, desc.weights_desc);
+    serialize(sstream, desc.dst_desc);
+}
+
 void serialize(serialization_stream_t &sstream, const gemm_desc_t &desc) {
     // Kind
     sstream.append(desc.primitive_kind);
@@ -589,6 +635,8 @@ void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
     desc.vs_zero_points.serialize(sstream);
     serialize(sstream, desc.dst_desc);
     serialize(sstream, desc.attn_mask_desc);
+    serialize(sstream, desc.block_table_desc);
+    serialize(sstream, desc.context_lens_desc);
     sstream.append(desc.scale_dt);
     sstream.append(desc.kq_acc_dt);
     sstream.append(desc.vs_acc_dt);
@@ -46,7 +46,8 @@ status_t reduction_desc_init(reduction_desc_t *reduction_desc,
     VCHECK_RED(one_of(alg_kind, reduction_max, reduction_min, reduction_sum,
                        reduction_mul, reduction_mean, reduction_norm_lp_max,
                        reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
-                       reduction_norm_lp_power_p_sum),
+                       reduction_norm_lp_power_p_sum, reduction_arg_max,
+                       reduction_arg_min),
             VERBOSE_BAD_ALGORITHM);
     VCHECK_RED(IMPLICATION(one_of(alg_kind, reduction_norm_lp_max,
                                    reduction_norm_lp_sum,
@@ -67,11 +68,31 @@ status_t reduction_desc_init(reduction_desc_t *reduction_desc,
     VCHECK_RED(src_desc->ndims == dst_desc->ndims, VERBOSE_INCONSISTENT_NDIMS,
             "src", "dst");
 
+    // Arg reductions produce the indices of the values, and a single reduced
+    // dimension may keep the `k` best of them (top-k).
+    const bool is_arg = one_of(alg_kind, reduction_arg_max, reduction_arg_min);
+    VCHECK_RED(IMPLICATION(is_arg, dst_desc->data_type == data_type::s32),
+            VERBOSE_INVALID_DATATYPE, "dst");
+
+    int n_reduced_dims = 0, n_top_k_dims = 0;
+    dim_t reduce_size = 1;
     for (auto d = 0; d < src_desc->ndims; ++d) {
+        const auto src_dim_d = src_desc->dims[d];
         const auto dst_dim_d = dst_desc->dims[d];
-        VCHECK_RED(one_of(dst_dim_d, 1, src_desc->dims[d]),
+        const bool is_top_k_dim
+                = is_arg && 1 < dst_dim_d && dst_dim_d < src_dim_d;
+        VCHECK_RED(one_of(dst_dim_d, 1, src_dim_d) || is_top_k_dim,
                 VERBOSE_INCONSISTENT_DIM, "src", d, "dst", d);
+        if (src_dim_d != dst_dim_d) {
+            n_reduced_dims++;
+            reduce_size *= src_dim_d;
+        }
+        n_top_k_dims += is_top_k_dim;
     }
+    VCHECK_RED(IMPLICATION(n_top_k_dims > 0, n_reduced_dims == 1),
+            VERBOSE_BAD_PARAM, "top-k is supported along one dimension only");
+    VCHECK_RED(IMPLICATION(is_arg, reduce_size <= INT32_MAX),
+            VERBOSE_BAD_PARAM, "indices do not fit s32");
 
     // reduction primitive doesn't support identity operation
     VCHECK_RED(!array_cmp(src_desc->dims, dst_desc->dims, src_desc->ndims),
@@ -112,6 +133,10 @@ status_t reduction_attr_check(const reduction_desc_t &desc,
     const data_type_t dst_dt = desc.dst_desc.data_type;
 
     auto attr_mask = smask_t::post_ops;
+    // Post-ops are not applicable to indices.
+    if (utils::one_of(desc.alg_kind, alg_kind::reduction_arg_max,
+                alg_kind::reduction_arg_min))
+        attr_mask = smask_t::none;
 
     VCHECK_RED_UNIMPL(attr->has_default_values(attr_mask, dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
@@ -147,6 +172,10 @@ dnnl_status_t dnnl_reduction_primitive_desc_create(
     CHECK(reduction_desc_init(
             &reduction_desc, alg_kind, src_desc, dst_desc, p, eps));
     CHECK(reduction_attr_check(reduction_desc, engine, attr));
+    VCHECK_RED_UNIMPL(IMPLICATION(one_of(alg_kind, reduction_arg_max,
+                                          reduction_arg_min),
+                              engine->kind() == engine_kind::cpu),
+            VERBOSE_BAD_ENGINE_KIND);
     return primitive_desc_create(primitive_desc_iface, engine,
             (const op_desc_t *)&reduction_desc, nullptr, attr);
 }
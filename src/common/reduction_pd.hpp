@@ -19,6 +19,7 @@
 
 #include "c_types_map.hpp"
 #include "primitive_desc.hpp"
+#include "tag_traits.hpp"
 #include "utils.hpp"
 
 #define VDISPATCH_REDUCTION(cond, msg, ...) \
@@ -60,6 +61,11 @@ struct reduction_pd_t : public primitive_desc_t {
         return status::success;
     }
 
+    bool is_arg_reduction() const {
+        return utils::one_of(desc()->alg_kind, alg_kind::reduction_arg_max,
+                alg_kind::reduction_arg_min);
+    }
+
     arg_usage_t arg_usage(int arg) const override {
         switch (arg) {
             case DNNL_ARG_SRC: return arg_usage_t::input;
@@ -156,6 +162,13 @@ protected:
     }
 
     status_t set_dst_format() {
+        // The top-k destination keeps `k` elements along the reduced
+        // dimension and takes a plain layout.
+        for (int d = 0; d < src_md_.ndims; d++)
+            if (!utils::one_of(dst_md_.dims[d], 1, src_md_.dims[d]))
+                return memory_desc_init_by_tag(
+                        dst_md_, get_abx_tag(dst_md_.ndims));
+
         memory_desc_t new_dst_md = src_md_;
         new_dst_md.data_type = dst_md_.data_type;
         for (int d = 0; d < src_md_.ndims; d++)
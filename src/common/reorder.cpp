@@ -110,7 +110,6 @@ status_t reorder_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
                 VERBOSE_UNSUPPORTED_SCALES_CFG);
 
         const auto &sc = attr->scales_;
-        const auto &sc_src = sc.get(DNNL_ARG_SRC);
         const int mask_src = sc.get_mask(DNNL_ARG_SRC);
 
         VCHECK_REORDER(IMPLICATION(utils::one_of(src_md->data_type,
@@ -118,15 +117,24 @@ status_t reorder_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
                                mask_src > 0),
                 VERBOSE_INVALID_DATATYPE, "mask for int4 source");
 
-        if (!sc_src.has_default_groups()) {
-            const int src_ndims = s_mdw.ndims();
+        for (int arg : {DNNL_ARG_SRC, DNNL_ARG_DST}) {
+            const auto &e = sc.get(arg);
+            if (e.has_default_groups()) continue;
+
+            // Destination scales have groups only when they are computed by
+            // the primitive.
+            VCHECK_REORDER(
+                    IMPLICATION(arg == DNNL_ARG_DST,
+                            attr->dynamic_quantization_),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+            const int mask = sc.get_mask(arg);
+            const int ndims = s_mdw.ndims();
             const bool group_dims_are_consistent
-                    = IMPLICATION(sc_src.get_group(0) > 1,
-                              src_md->dims[src_ndims - 2] % sc_src.get_group(0)
-                                      == 0)
-                    && IMPLICATION(sc_src.get_group(1) > 1,
-                            src_md->dims[src_ndims - 1] % sc_src.get_group(1)
-                                    == 0);
+                    = IMPLICATION(e.get_group(0) > 1,
+                              src_md->dims[ndims - 2] % e.get_group(0) == 0)
+                    && IMPLICATION(e.get_group(1) > 1,
+                            src_md->dims[ndims - 1] % e.get_group(1) == 0);
             VCHECK_REORDER(group_dims_are_consistent,
                     "groups dimensions are not consistent with reorder "
                     "dimensions");
@@ -134,14 +142,27 @@ status_t reorder_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
             // Groups are always applied to last two dimensions. Check that
             // input scale mask is consistent with this limitation.
             const bool mask_applies_to_last_two_dims
-                    = (mask_src & (1 << (src_ndims - 1)))
-                    && (mask_src & (1 << (src_ndims - 2)));
+                    = (mask & (1 << (ndims - 1)))
+                    && (mask & (1 << (ndims - 2)));
             VCHECK_REORDER(mask_applies_to_last_two_dims,
                     "mask is not consistent with groups");
         }
+    }
 
-        VCHECK_REORDER(sc.get(DNNL_ARG_DST).has_default_groups(),
+    // Check dynamic quantization
+    if (attr->dynamic_quantization_) {
+        VCHECK_REORDER_UNIMPL(s_ek == d_ek, VERBOSE_BAD_ENGINE_KIND);
+        VCHECK_REORDER(!attr->scales_.has_default_values(DNNL_ARG_DST),
+                VERBOSE_BAD_PARAM, "dynamic quantization without dst scales");
+        VCHECK_REORDER(types::is_integral_dt(dst_md->data_type)
+                        || utils::one_of(dst_md->data_type, data_type::f4_e2m1,
+                                data_type::f8_e5m2, data_type::f8_e4m3),
+                VERBOSE_INVALID_DATATYPE, "dst");
+        VCHECK_REORDER_UNIMPL(attr->scales_.has_default_values(DNNL_ARG_SRC),
                 VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_REORDER_UNIMPL(
+                attr->zero_points_.has_default_values(DNNL_ARG_SRC),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
     }
 
     bool is_cross_engine = src_engine != dst_engine
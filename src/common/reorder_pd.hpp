@@ -118,6 +118,13 @@ struct reorder_pd_t : public primitive_desc_t {
 
         if (arg == DNNL_ARG_TO) return arg_usage_t::output;
 
+        // The destination scales and zero points are written when they are
+        // computed by the primitive.
+        if (utils::one_of(arg, DNNL_ARG_ATTR_SCALES | DNNL_ARG_TO,
+                    DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_TO)
+                && attr()->dynamic_quantization_)
+            return arg_usage_t::output;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -142,7 +149,10 @@ struct reorder_pd_t : public primitive_desc_t {
     }
 
     int n_inputs() const override { return 1; }
-    int n_outputs() const override { return 1; }
+    int n_outputs() const override {
+        if (!attr()->dynamic_quantization_) return 1;
+        return 2 + !attr()->zero_points_.has_default_values(DNNL_ARG_DST);
+    }
 
     float beta() const {
         const int sum_idx = attr()->post_ops_.find(primitive_kind::sum);
@@ -42,8 +42,14 @@ namespace {
 status_t resampling_desc_init(resampling_desc_t *resampling_desc,
         prop_kind_t prop_kind, alg_kind_t alg_kind, const float *factors,
         const memory_desc_t *src_desc, const memory_desc_t *dst_desc) {
-    VCHECK_RS(one_of(alg_kind, resampling_nearest, resampling_linear),
+    VCHECK_RS(one_of(alg_kind, resampling_nearest, resampling_linear,
+                      resampling_cubic, resampling_linear_antialias),
             VERBOSE_BAD_ALGORITHM);
+    VCHECK_RS_UNIMPL(IMPLICATION(one_of(alg_kind, resampling_cubic,
+                                         resampling_linear_antialias),
+                             one_of(prop_kind, forward_training,
+                                     forward_inference)),
+            VERBOSE_BAD_PROPKIND);
     VCHECK_RS(src_desc, VERBOSE_NULL_ARG);
     VCHECK_RS(IMPLICATION(dst_desc == nullptr, factors), VERBOSE_NULL_ARG);
     VCHECK_RS(utils::one_of(src_desc->ndims, 3, 4, 5), VERBOSE_BAD_NDIMS, "src",
@@ -158,6 +164,10 @@ status_t dnnl_resampling_forward_primitive_desc_create(
     CHECK(resampling_desc_init(&resampling_desc, prop_kind, alg_kind, factors,
             src_desc, dst_desc));
     CHECK(resampling_attr_check(resampling_desc, engine, attr));
+    VCHECK_RS_UNIMPL(IMPLICATION(one_of(alg_kind, resampling_cubic,
+                                         resampling_linear_antialias),
+                             engine->kind() == engine_kind::cpu),
+            VERBOSE_BAD_ENGINE_KIND);
     return primitive_desc_create(primitive_desc_iface, engine,
             (const op_desc_t *)&resampling_desc, nullptr, attr);
 }
@@ -138,6 +138,22 @@ status_t check_data_type_consistency_fwd(const rnn_desc_t &r) {
     const bool is_bf16 = is_xf16_helper(bf16);
     const bool is_f16 = is_xf16_helper(f16);
 
+    // Weights-only quantization: int8 or int4 weights are decompressed to
+    // bf16, and the cell computes with bf16 activations.
+    const bool is_bf16_wei_int = is_inference
+            && everyone_is(bf16, src_layer_dt, dst_layer_dt)
+            && one_of(weights_layer_dt, s8, s4)
+            && weights_iter_dt == weights_layer_dt
+            && one_of(weights_projection_dt, weights_layer_dt, data_type::undef)
+            && expect_dt(r.src_iter_desc, bf16)
+            && IMPLICATION(r.cell_kind == dnnl_vanilla_lstm,
+                    expect_dt(r.weights_peephole_desc, f32))
+            && IMPLICATION(
+                    one_of(r.cell_kind, dnnl_vanilla_augru, dnnl_lbr_augru),
+                    expect_dt(r.weights_peephole_desc, bf16))
+            && expect_dt(r.dst_iter_desc, bf16)
+            && one_of(r.bias_desc.data_type, bf16, f32);
+
     const bool is_u8u8u8 = is_inference && is_int8_ok && src_layer_dt == u8
             && one_of(dst_layer_dt, u8, f32)
             && everyone_is(s8, weights_iter_dt, weights_layer_dt)
@@ -173,8 +189,9 @@ status_t check_data_type_consistency_fwd(const rnn_desc_t &r) {
             && expect_dt(r.dst_iter_desc, f32) && expect_dt(r.bias_desc, f32);
 
     return cell_state_check
-                    && (is_f32 || is_bf16 || is_f16 || is_u8u8u8 || is_f32u8f32
-                            || is_s8s8s8 || is_f32s8f32)
+                    && (is_f32 || is_bf16 || is_f16 || is_bf16_wei_int
+                            || is_u8u8u8 || is_f32u8f32 || is_s8s8s8
+                            || is_f32s8f32)
             ? success
             : unimplemented;
 }
@@ -337,6 +354,12 @@ status_t rnn_common_fwd_desc_init(rnn_desc_t *rnn_desc, prop_kind_t prop_kind,
                 "num_layers != 1");
     }
 
+    // the lengths mark the end of every sequence, which only a
+    // left-to-right pass can stop at
+    if (flags & rnn_flags::seq_lengths)
+        VCONDCHECK_RNN(direction == dnnl_unidirectional_left2right,
+                VERBOSE_BAD_PARAM, "direction != unidirectional_left2right");
+
     VCHECK_RNN(
             check_runtime_dims_or_strides({src_layer_desc, src_iter_desc,
                     src_iter_c_desc, weights_layer_desc, weights_iter_desc,
@@ -454,6 +477,9 @@ status_t rnn_common_bwd_desc_init(rnn_desc_t *rnn_desc, prop_kind_t prop_kind,
                 VERBOSE_NULL_ARG);
     }
 
+    // sequence lengths are supported for forward propagation only
+    VCONDCHECK_RNN(!(flags & rnn_flags::seq_lengths), VERBOSE_BAD_FLAGS);
+
     // check if optional md is provided then diff_md is provided too
     VCONDCHECK_RNN(xnor_md(bias_desc, diff_bias_desc), VERBOSE_NULL_ARG);
     VCONDCHECK_RNN(xnor_md(weights_peephole_desc, diff_weights_peephole_desc),
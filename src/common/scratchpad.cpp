@@ -53,6 +53,17 @@ memory_storage_t *create_scratchpad_memory_storage(
 #endif
 
     memory_storage_t *mem_storage = nullptr;
+    // Device scratchpads are taken from the engine memory pool when it has
+    // one, as primitives are often created and destroyed at a high rate. The
+    // runtime buffers are the fallback, e.g. for devices without USM.
+    if (mem_engine->get_device_memory_pool()) {
+        const unsigned flags = memory_flags_t::alloc
+                | memory_flags_t::prefer_device_usm | memory_flags_t::use_pool;
+        auto status = mem_engine->create_memory_storage(
+                &mem_storage, flags, size, nullptr);
+        if (status == status::success && mem_storage) return mem_storage;
+        mem_storage = nullptr;
+    }
     auto status = mem_engine->create_memory_storage(&mem_storage, size);
     MAYBE_UNUSED(status);
     return mem_storage;
@@ -159,5 +170,23 @@ scratchpad_t *create_scratchpad(
 #endif
 }
 
+const memory_storage_t *scratchpad_arena_t::get(size_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (size <= size_) return mem_storage_.get();
+
+    auto *mem_storage = create_scratchpad_memory_storage(engine_, size);
+    if (mem_storage == nullptr) return nullptr;
+
+    if (mem_storage_) retired_.push_back(std::move(mem_storage_));
+    mem_storage_.reset(mem_storage);
+    size_ = size;
+    return mem_storage_.get();
+}
+
+void scratchpad_arena_t::release_retired() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    retired_.clear();
+}
+
 } // namespace impl
 } // namespace dnnl
@@ -17,6 +17,10 @@
 #ifndef COMMON_SCRATCHPAD_HPP
 #define COMMON_SCRATCHPAD_HPP
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "c_types_map.hpp"
 #include "memory_storage.hpp"
 #include "utils.hpp"
@@ -33,6 +37,34 @@ struct scratchpad_t {
 scratchpad_t *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad);
 
+// Scratchpad memory owned by a stream and shared by all primitives executed on
+// it with scratchpad_mode::stream. The arena grows to the largest requested
+// size and never shrinks. When the arena grows, the previous buffer may still
+// be in use by asynchronously executed primitives, so it is kept alive until
+// the stream is synchronized.
+struct scratchpad_arena_t {
+    scratchpad_arena_t(engine_t *engine) : engine_(engine) {}
+
+    // Returns a memory storage of at least `size` bytes, or nullptr in case of
+    // an allocation failure.
+    const memory_storage_t *get(size_t size);
+
+    // Releases the buffers replaced by the arena growth. Must only be called
+    // when no primitive executed on the stream is running.
+    void release_retired();
+
+    size_t size() const { return size_; }
+
+private:
+    engine_t *engine_;
+    std::mutex mutex_;
+    std::unique_ptr<memory_storage_t> mem_storage_;
+    size_t size_ = 0;
+    std::vector<std::unique_ptr<memory_storage_t>> retired_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scratchpad_arena_t);
+};
+
 } // namespace impl
 } // namespace dnnl
 #endif
@@ -60,6 +60,11 @@ struct sdpa_pd_t : public primitive_desc_t {
                     DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES))
             return arg_usage_t::input;
 
+        if (is_paged()
+                && utils::one_of(
+                        arg, DNNL_ARG_BLOCK_TABLE, DNNL_ARG_CONTEXT_LENS))
+            return arg_usage_t::input;
+
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
         return primitive_desc_t::arg_usage(arg);
@@ -72,6 +77,8 @@ struct sdpa_pd_t : public primitive_desc_t {
             case DNNL_ARG_KEYS: return src_md(1);
             case DNNL_ARG_VALUES: return src_md(2);
             case DNNL_ARG_ATTN_MASK: return src_md(3);
+            case DNNL_ARG_BLOCK_TABLE: return src_md(4);
+            case DNNL_ARG_CONTEXT_LENS: return src_md(5);
             case DNNL_ARG_DST: return dst_md(0, user_input);
             default: return primitive_desc_t::arg_md(arg);
         }
@@ -84,6 +91,8 @@ struct sdpa_pd_t : public primitive_desc_t {
             case 1: return &desc_.k_desc;
             case 2: return &desc_.v_desc;
             case 3: return &desc_.attn_mask_desc;
+            case 4: return &desc_.block_table_desc;
+            case 5: return &desc_.context_lens_desc;
             default: return &glob_zero_md;
         }
     }
@@ -96,9 +105,16 @@ struct sdpa_pd_t : public primitive_desc_t {
     const memory_desc_t *key_md() const { return &desc_.k_desc; }
     const memory_desc_t *val_md() const { return &desc_.v_desc; }
     const memory_desc_t *attn_mask_md() const { return &desc_.attn_mask_desc; }
+    const memory_desc_t *block_table_md() const {
+        return &desc_.block_table_desc;
+    }
+    const memory_desc_t *context_lens_md() const {
+        return &desc_.context_lens_desc;
+    }
 
     int n_inputs() const override {
-        return 3 + int(with_attn_mask()) + int(with_attn_scale());
+        return 3 + int(with_attn_mask()) + int(with_attn_scale())
+                + 2 * int(is_paged());
     }
     int n_outputs() const override { return 1; }
 
@@ -110,6 +126,9 @@ struct sdpa_pd_t : public primitive_desc_t {
         return (attn_mask_md()->data_type != data_type::undef);
     }
 
+    /// If true, the K and V tensors are read through a block table
+    bool is_paged() const { return desc_.is_paged(); }
+
     /// Returns the accumulation data type of the KQ matmul
     data_type_t kq_acc_dt() const { return desc()->kq_acc_dt; }
 
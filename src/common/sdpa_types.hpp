@@ -32,6 +32,8 @@ namespace impl {
 #define DNNL_ARG_KEYS DNNL_ARG_SRC_1
 #define DNNL_ARG_VALUES DNNL_ARG_SRC_2
 #define DNNL_ARG_ATTN_MASK DNNL_ARG_SHIFT
+#define DNNL_ARG_BLOCK_TABLE DNNL_ARG_SRC_3
+#define DNNL_ARG_CONTEXT_LENS DNNL_ARG_SRC_4
 
 // NOLINTBEGIN(modernize-use-using)
 /// Types of attention mask
@@ -79,6 +81,13 @@ struct sdpa_desc_t : public op_desc_t {
 
     memory_desc_t dst_desc;
     memory_desc_t attn_mask_desc;
+    // Paged keys and values. With a block table, K and V are pools of pages
+    // of [pages, kv_heads, head_size, page_size] and [pages, kv_heads,
+    // page_size, head_size]. The block table ([batch, max_pages], s32) holds
+    // the pages of every sequence and the context lengths ([batch], s32)
+    // hold their numbers of keys.
+    memory_desc_t block_table_desc;
+    memory_desc_t context_lens_desc;
     data_type_t scale_dt {};
     data_type_t kq_acc_dt {};
     data_type_t vs_acc_dt {};
@@ -94,8 +103,17 @@ struct sdpa_desc_t : public op_desc_t {
     dnnl_dim_t queries() const { return q_desc.dims[q_desc.ndims - 2]; }
     // Head size.
     dnnl_dim_t head_size() const { return q_desc.dims[q_desc.ndims - 1]; }
-    // Number of keys.
-    dnnl_dim_t keys() const { return k_desc.dims[k_desc.ndims - 1]; }
+    // If true, the keys and values are read through the block table.
+    bool is_paged() const {
+        return block_table_desc.data_type != data_type::undef;
+    }
+    // Number of keys of a page.
+    dnnl_dim_t page_size() const { return k_desc.dims[k_desc.ndims - 1]; }
+    // Number of keys, the largest number of a sequence for paged keys.
+    dnnl_dim_t keys() const {
+        if (is_paged()) return block_table_desc.dims[1] * page_size();
+        return k_desc.dims[k_desc.ndims - 1];
+    }
     // Number of values.
     dnnl_dim_t values() const { return v_desc.dims[v_desc.ndims - 1]; }
     // Total batch size.
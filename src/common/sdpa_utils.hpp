@@ -81,6 +81,45 @@ static inline status_t sdpa_desc_check(const memory_desc_t *q_desc,
     return status::success;
 }
 
+static inline status_t sdpa_paged_desc_check(const memory_desc_t *q_desc,
+        const memory_desc_t *k_desc, const memory_desc_t *v_desc,
+        const memory_desc_t *block_table_desc,
+        const memory_desc_t *context_lens_desc) {
+    if (!block_table_desc && !context_lens_desc) return status::success;
+    VCHECK_SDPA_COND(block_table_desc && context_lens_desc,
+            "block table and context lengths must be passed together");
+
+    int ndims = q_desc->ndims;
+    VCHECK_SDPA_COND(block_table_desc->ndims == 2,
+            "block table must have 2 dimensions. got: %d",
+            block_table_desc->ndims);
+    VCHECK_SDPA_COND(context_lens_desc->ndims == 1,
+            "context lengths must have 1 dimension. got: %d",
+            context_lens_desc->ndims);
+    VCHECK_SDPA_COND(utils::everyone_is(data_type::s32,
+                             block_table_desc->data_type,
+                             context_lens_desc->data_type),
+            VERBOSE_INVALID_DATATYPE, "block table or context lengths");
+    VCHECK_SDPA_COND(block_table_desc->dims[0] == q_desc->dims[0]
+                    && context_lens_desc->dims[0] == q_desc->dims[0],
+            "block table(%s) and context lengths(%s) must match the batch of "
+            "q_desc(%s)",
+            md2dim_str(block_table_desc).c_str(),
+            md2dim_str(context_lens_desc).c_str(), md2dim_str(q_desc).c_str());
+    VCHECK_SDPA_COND(k_desc->dims[0] == v_desc->dims[0],
+            "k_desc->dims[0](%s) must match v_desc->dims[0](%s)",
+            md2dim_str(k_desc).c_str(), md2dim_str(v_desc).c_str());
+    VCHECK_SDPA_COND(k_desc->dims[ndims - 1] > 0,
+            "page size of k_desc(%s) must be positive",
+            md2dim_str(k_desc).c_str());
+
+    VCHECK_SDPA_COND(!any_memory_desc_host_scalar(
+                             block_table_desc, context_lens_desc),
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+
+    return status::success;
+}
+
 static inline status_t sdpa_attr_check(const memory_desc_t *q_desc,
         const memory_desc_t *k_desc, const memory_desc_t *v_desc,
         const engine_t *engine, const primitive_attr_t *attr,
@@ -153,7 +192,9 @@ static inline sdpa_desc_t create_sdpa_desc(const memory_desc_t *q_md,
         const memory_desc_t *dst_md, const memory_desc_t *attn_mask_md,
         data_type_t scale_dt, bool invert_scale, dim_t kv_head_number,
         attn_mask_type_t attn_mask_type, alg_kind_t softmax_alg,
-        const primitive_attr_t *kq_attr, const primitive_attr_t *vs_attr) {
+        const primitive_attr_t *kq_attr, const primitive_attr_t *vs_attr,
+        const memory_desc_t *block_table_md = nullptr,
+        const memory_desc_t *context_lens_md = nullptr) {
     auto sdpa_desc = sdpa_desc_t();
     sdpa_desc.primitive_kind = primitive_kind::sdpa;
     sdpa_desc.q_desc = *q_md;
@@ -177,6 +218,8 @@ static inline sdpa_desc_t create_sdpa_desc(const memory_desc_t *q_md,
     sdpa_desc.v_desc = *v_md;
     sdpa_desc.dst_desc = *dst_md;
     if (attn_mask_md) sdpa_desc.attn_mask_desc = *attn_mask_md;
+    if (block_table_md) sdpa_desc.block_table_desc = *block_table_md;
+    if (context_lens_md) sdpa_desc.context_lens_desc = *context_lens_md;
     sdpa_desc.scale_dt = scale_dt;
     sdpa_desc.invert_scale = invert_scale;
     sdpa_desc.kv_head_number = kv_head_number;
@@ -193,14 +236,18 @@ static inline status_t create_sdpa_pd(
         bool invert_scale, dim_t kv_head_number,
         attn_mask_type_t attn_mask_type, alg_kind_t softmax_alg,
         const primitive_attr_t *attr, const primitive_attr_t *kq_attr = nullptr,
-        const primitive_attr_t *vs_attr = nullptr) {
+        const primitive_attr_t *vs_attr = nullptr,
+        const memory_desc_t *block_table_md = nullptr,
+        const memory_desc_t *context_lens_md = nullptr) {
     CHECK(sdpa_attr_check(q_md, k_md, v_md, engine, attr, kq_attr, vs_attr));
     CHECK(sdpa_desc_check(q_md, k_md, v_md, dst_md, attn_mask_md, engine, attr,
             kq_attr, vs_attr));
+    CHECK(sdpa_paged_desc_check(
+            q_md, k_md, v_md, block_table_md, context_lens_md));
 
     auto sdpa_desc = create_sdpa_desc(q_md, k_md, v_md, dst_md, attn_mask_md,
             scale_dt, invert_scale, kv_head_number, attn_mask_type, softmax_alg,
-            kq_attr, vs_attr);
+            kq_attr, vs_attr, block_table_md, context_lens_md);
 
     primitive_attr_t sdpa_attr = attr ? *attr : default_attr();
 
@@ -108,7 +108,11 @@ status_t softmax_attr_check(const softmax_desc_t &desc, const engine_t *engine,
         const data_type_t src_dt = desc.src_desc.data_type;
         const data_type_t dst_dt = desc.dst_desc.data_type;
 
-        auto fwd_attr_mask = smask_t::post_ops;
+        auto fwd_attr_mask = smask_t::post_ops | smask_t::softmax_mask;
+        // The dropout mask and the workspace are only needed to compute
+        // gradients.
+        if (desc.prop_kind == prop_kind::forward_training)
+            fwd_attr_mask |= smask_t::dropout | smask_t::workspace_data_type;
 
         const bool is_int8 = utils::one_of(src_dt, s8, u8)
                 || utils::one_of(dst_dt, s8, u8);
@@ -152,6 +156,38 @@ status_t softmax_attr_check(const softmax_desc_t &desc, const engine_t *engine,
             // Note: verbose support is inside the call.
             CHECK(po.validate_binary(engine->kind(), &desc.dst_desc));
         }
+
+        // Check softmax mask
+        const auto &sm = attr->softmax_mask_;
+        // Rows of the causal mask are indexed by the dimension preceding the
+        // softmax axis.
+        VCHECK_SOFTMAX(IMPLICATION(sm.with_causal(), desc.softmax_axis > 0),
+                VERBOSE_BAD_AXIS);
+        if (sm.with_lengths()) {
+            const memory_desc_t &lengths_md = sm.lengths_desc_;
+            const int ndims = desc.src_desc.ndims;
+            VCHECK_SOFTMAX(lengths_md.ndims == ndims,
+                    VERBOSE_INCONSISTENT_NDIMS, "src", "lengths");
+            for (int d = 0; d < ndims; d++) {
+                const dim_t dim = d == desc.softmax_axis
+                        ? 1
+                        : desc.src_desc.dims[d];
+                VCHECK_SOFTMAX(lengths_md.dims[d] == dim,
+                        VERBOSE_INCONSISTENT_DIM, "src", d, "lengths", d);
+            }
+        }
+
+        // Check dropout
+        if (!attr->dropout_.has_default_values()) {
+            const memory_desc_t &dropout_md = attr->dropout_.dropout_desc_;
+            const int ndims = desc.dst_desc.ndims;
+            VCHECK_SOFTMAX(dropout_md.ndims == ndims,
+                    VERBOSE_INCONSISTENT_NDIMS, "dst", "dropout");
+            for (int d = 0; d < ndims; d++) {
+                VCHECK_SOFTMAX(dropout_md.dims[d] == desc.dst_desc.dims[d],
+                        VERBOSE_INCONSISTENT_DIM, "dst", d, "dropout", d);
+            }
+        }
     } else {
         VCHECK_SOFTMAX_UNIMPL(false, VERBOSE_UNSUPPORTED_ATTR);
     }
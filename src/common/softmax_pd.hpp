@@ -105,11 +105,19 @@ struct softmax_pd_t : public primitive_desc_t {
     }
     bool is_logsoftmax() const { return alg_kind() == alg_kind::softmax_log; }
 
+    const memory_desc_t *workspace_md(int index = 0) const override {
+        return index == 0 && !types::is_zero_md(&ws_md_) ? &ws_md_
+                                                         : &glob_zero_md;
+    }
+
 protected:
     softmax_desc_t desc_;
     const softmax_fwd_pd_t *hint_fwd_pd_;
 
     memory_desc_t dst_md_;
+    // A copy of the destination in the data type of the workspace attribute,
+    // which the backward pass reads instead of the destination.
+    memory_desc_t ws_md_;
 
     softmax_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
             const softmax_fwd_pd_t *hint_fwd_pd)
@@ -136,6 +144,10 @@ struct softmax_fwd_pd_t : public softmax_pd_t {
             return !types::is_zero_md(workspace_md()) ? arg_usage_t::output
                                                       : arg_usage_t::unused;
 
+        if (arg == DNNL_ARG_ATTR_SOFTMAX_LENGTHS)
+            return with_mask_lengths() ? arg_usage_t::input
+                                       : arg_usage_t::unused;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -144,6 +156,8 @@ struct softmax_fwd_pd_t : public softmax_pd_t {
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
             case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_ATTR_SOFTMAX_LENGTHS:
+                return &attr()->softmax_mask_.lengths_desc_;
             default: return softmax_pd_t::arg_md(arg);
         }
     }
@@ -159,11 +173,22 @@ struct softmax_fwd_pd_t : public softmax_pd_t {
         return &glob_zero_md;
     }
 
-    int n_inputs() const override { return 1 + n_binary_po_inputs(); }
+    int n_inputs() const override {
+        return 1 + with_mask_lengths() + 2 * with_dropout()
+                + n_binary_po_inputs();
+    }
     int n_outputs() const override {
-        return 1 + (!types::is_zero_md(workspace_md()));
+        return 1 + (!types::is_zero_md(workspace_md())) + with_dropout();
     }
 
+    bool with_mask() const {
+        return !attr()->softmax_mask_.has_default_values();
+    }
+    bool with_mask_lengths() const {
+        return attr()->softmax_mask_.with_lengths();
+    }
+    bool with_dropout() const { return !attr()->dropout_.has_default_values(); }
+
 protected:
     memory_desc_t src_md_;
 
@@ -181,6 +206,13 @@ protected:
                 dst_md_, src_md_.format_desc.blocking);
     }
 
+    // Is called after the destination format is set.
+    status_t init_default_ws() {
+        const data_type_t ws_dt = attr()->workspace_dt_;
+        if (ws_dt == data_type::undef) return status::success;
+        return memory_desc_init_by_md_and_dt(ws_md_, dst_md_, ws_dt);
+    }
+
     bool attr_scales_ok(const std::vector<int> &supported_args
             = {DNNL_ARG_SRC, DNNL_ARG_DST}) const {
         const auto &scales = attr()->scales_;
@@ -196,6 +228,15 @@ protected:
         }
         return ok;
     }
+
+    // The dropout mask is written at the offsets of the destination.
+    bool attr_dropout_ok() const {
+        if (!with_dropout()) return true;
+        const memory_desc_wrapper dropout_d(attr()->dropout_.dropout_desc_);
+        return utils::one_of(
+                       dropout_d.data_type(), data_type::u8, data_type::s8)
+                && dropout_d.similar_to(dst_md(), true, false);
+    }
 };
 // NOLINTEND(google-default-arguments)
 
@@ -205,8 +246,11 @@ struct softmax_bwd_pd_t : public softmax_pd_t {
     using hint_class = softmax_fwd_pd_t;
 
     arg_usage_t arg_usage(int arg) const override {
-        if (utils::one_of(arg, DNNL_ARG_DST, DNNL_ARG_DIFF_DST))
-            return arg_usage_t::input;
+        if (arg == DNNL_ARG_DST)
+            return types::is_zero_md(workspace_md()) ? arg_usage_t::input
+                                                     : arg_usage_t::unused;
+
+        if (arg == DNNL_ARG_DIFF_DST) return arg_usage_t::input;
 
         if (arg == DNNL_ARG_DIFF_SRC) return arg_usage_t::output;
 
@@ -245,9 +289,8 @@ struct softmax_bwd_pd_t : public softmax_pd_t {
         return &glob_zero_md;
     }
 
-    int n_inputs() const override {
-        return 2 + (!types::is_zero_md(workspace_md()));
-    }
+    // The workspace, if any, replaces the destination.
+    int n_inputs() const override { return 2; }
     int n_outputs() const override { return 1; }
 
 protected:
@@ -274,6 +317,19 @@ protected:
         }
         return status::success;
     }
+
+    // The implementations that do not read the workspace reject the hints
+    // with one, so that the destination is not needed when the forward pass
+    // keeps a workspace.
+    bool hint_with_ws() const {
+        return hint_fwd_pd_
+                && !types::is_zero_md(hint_fwd_pd_->workspace_md());
+    }
+
+    // Takes the workspace of the forward primitive descriptor, if any.
+    void init_default_ws() {
+        if (hint_fwd_pd_) ws_md_ = *hint_fwd_pd_->workspace_md();
+    }
 };
 // NOLINTEND(google-default-arguments)
 
@@ -26,6 +26,7 @@
 #include "stream.hpp"
 #include "utils.hpp"
 
+#include "common/device_memory_pool.hpp"
 #include "common/stream_impl.hpp"
 
 using namespace dnnl::impl;
@@ -37,6 +38,77 @@ status_t stream_t::enqueue_primitive(
     return primitive_iface->execute(ctx);
 }
 
+stream_t::~dnnl_stream() {
+    clear_capture();
+    // The memory objects allocated on the stream may outlive it.
+    memory_pool_->detach_stream();
+}
+
+status_t stream_t::begin_capture() {
+    if (is_capturing_ || is_native_capturing_) return invalid_arguments;
+    // Only CPU execution is synchronous with respect to the submission, so
+    // other engines record the submitted work with their native graph
+    // mechanisms.
+    if (engine_->kind() != engine_kind::cpu) {
+        CHECK(begin_native_capture());
+        clear_capture();
+        is_native_capturing_ = true;
+        return success;
+    }
+    clear_capture();
+    is_capturing_ = true;
+    return success;
+}
+
+status_t stream_t::end_capture() {
+    if (is_native_capturing_) {
+        is_native_capturing_ = false;
+        return end_native_capture();
+    }
+    if (!is_capturing_) return invalid_arguments;
+    is_capturing_ = false;
+    return success;
+}
+
+status_t stream_t::replay() {
+    if (is_capturing_ || is_native_capturing_) return invalid_arguments;
+    if (engine_->kind() != engine_kind::cpu) return replay_native_capture();
+
+    before_exec_hook();
+    status_t status = success;
+    for (auto &e : captured_) {
+        status = enqueue_primitive(e.primitive_iface, e.ctx);
+        if (status != success) break;
+    }
+    after_exec_hook();
+    return status;
+}
+
+void stream_t::capture(
+        const primitive_iface_t *primitive_iface, exec_args_t &&args) {
+    assert(is_capturing_);
+    // The recording keeps the primitive alive to let users release their
+    // handles after the capture.
+    auto *p = const_cast<primitive_iface_t *>(primitive_iface);
+    p->retain();
+    captured_.push_back({p, exec_ctx_t(this, std::move(args))});
+}
+
+void stream_t::keep_captured(const primitive_iface_t *primitive_iface) {
+    assert(is_native_capturing_);
+    // The native graph refers to the scratchpad and the resources of the
+    // primitive.
+    auto *p = const_cast<primitive_iface_t *>(primitive_iface);
+    p->retain();
+    captured_.push_back({p, exec_ctx_t(this)});
+}
+
+void stream_t::clear_capture() {
+    for (auto &e : captured_)
+        e.primitive_iface->release();
+    captured_.clear();
+}
+
 /* API */
 
 status_t dnnl_stream_create(
@@ -44,11 +116,6 @@ status_t dnnl_stream_create(
     bool args_ok = !utils::any_null(stream, engine);
     if (!args_ok) return invalid_arguments;
 
-    if (engine->kind() != engine_kind::gpu
-            && (flags & stream_flags::profiling)) {
-        return status::unimplemented;
-    }
-
     return engine->create_stream(stream, flags);
 }
 
@@ -62,7 +129,37 @@ status_t dnnl_stream_wait(stream_t *stream) {
     bool args_ok = !any_null(stream);
     if (!args_ok) return invalid_arguments;
 
-    return stream->wait();
+    CHECK(stream->wait());
+    // All the submitted primitives are completed, hence the scratchpad
+    // buffers replaced by the arena growth are no longer in use.
+    stream->scratchpad_arena().release_retired();
+    if (auto *pool = stream->engine()->get_device_memory_pool()) pool->trim();
+    stream->memory_pool()->trim();
+    return success;
+}
+
+status_t dnnl_stream_set_cpu_affinity(
+        stream_t *stream, int ncpus, const int *cpus) {
+    bool args_ok = !any_null(stream) && ncpus >= 0
+            && IMPLICATION(ncpus > 0, cpus != nullptr);
+    if (!args_ok) return invalid_arguments;
+    if (stream->engine()->kind() != engine_kind::cpu) return invalid_arguments;
+    return stream->set_cpu_affinity(ncpus, cpus);
+}
+
+status_t dnnl_stream_begin_capture(stream_t *stream) {
+    if (any_null(stream)) return invalid_arguments;
+    return stream->begin_capture();
+}
+
+status_t dnnl_stream_end_capture(stream_t *stream) {
+    if (any_null(stream)) return invalid_arguments;
+    return stream->end_capture();
+}
+
+status_t dnnl_stream_replay(stream_t *stream) {
+    if (any_null(stream)) return invalid_arguments;
+    return stream->replay();
 }
 
 status_t dnnl_stream_destroy(stream_t *stream) {
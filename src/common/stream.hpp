@@ -18,18 +18,45 @@
 #define COMMON_STREAM_HPP
 
 #include <assert.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include "oneapi/dnnl/dnnl.h"
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 
 #include "common/c_types_map.hpp"
 #include "common/engine.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/scratchpad.hpp"
 #include "common/stream_impl.hpp"
+#include "common/stream_memory_pool.hpp"
 #include "common/utils.hpp"
 
+namespace dnnl {
+namespace impl {
+
+// Hardware counters of a primitive execution: the execution time, the time
+// the execution units were active and stalled, and the bytes transferred to
+// and from device memory.
+struct exec_counters_t {
+    uint64_t nsec = 0;
+    double eu_active_nsec = 0;
+    double eu_stall_nsec = 0;
+    double mem_bytes = 0;
+};
+
+} // namespace impl
+} // namespace dnnl
+
 struct dnnl_stream : public dnnl::impl::c_compatible {
     dnnl_stream(dnnl::impl::engine_t *engine, dnnl::impl::stream_impl_t *impl)
-        : engine_(engine), impl_(impl) {}
-    virtual ~dnnl_stream() = default;
+        : engine_(engine)
+        , impl_(impl)
+        , scratchpad_arena_(engine)
+        , memory_pool_(std::make_shared<dnnl::impl::stream_memory_pool_t>(
+                  this)) {}
+    virtual ~dnnl_stream();
 
     /** returns stream's engine */
     dnnl::impl::engine_t *engine() const { return engine_; }
@@ -48,6 +75,14 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
     /** blocks until all submitted primitives to the stream are completed */
     virtual dnnl::impl::status_t wait() = 0;
 
+    // Enqueues a task that runs on the host in order with the primitive
+    // executions submitted to the stream. The task runs on the calling thread
+    // unless the stream executes asynchronously.
+    virtual dnnl::impl::status_t enqueue_host_task(
+            std::function<dnnl::impl::status_t()> &&task) {
+        return task();
+    }
+
     virtual void before_exec_hook() {}
     virtual void after_exec_hook() {}
 
@@ -73,11 +108,55 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 
     bool is_profiling_enabled() const { return impl_->is_profiling_enabled(); }
 
+    // Returns the hardware counters of the latest primitive execution on a
+    // profiling stream, for the profile_exec verbose output.
+    virtual dnnl::impl::status_t get_last_exec_counters(
+            dnnl::impl::exec_counters_t &counters) const {
+        return dnnl::impl::status::unimplemented;
+    }
+
     virtual dnnl::impl::status_t zero_pad(const dnnl::impl::memory_t *memory,
             const dnnl::impl::exec_ctx_t &ctx);
 
     dnnl::impl::stream_impl_t *impl() { return impl_.get(); }
 
+    // Scratchpad shared by primitives with scratchpad_mode::stream.
+    dnnl::impl::scratchpad_arena_t &scratchpad_arena() {
+        return scratchpad_arena_;
+    }
+
+    // Arena of the memory objects allocated on the stream.
+    const std::shared_ptr<dnnl::impl::stream_memory_pool_t> &
+    memory_pool() const {
+        return memory_pool_;
+    }
+
+    virtual dnnl::impl::status_t set_cpu_affinity(int ncpus, const int *cpus) {
+        return dnnl::impl::status::unimplemented;
+    }
+
+    // Execution capture. Between begin_capture() and end_capture() primitive
+    // executions submitted to the stream are recorded together with their
+    // converted arguments instead of being executed. replay() executes the
+    // recorded sequence bypassing the argument conversion and the per-call
+    // verbose checks. The memory objects of the recorded executions must stay
+    // alive until the capture is replaced or the stream is destroyed.
+    dnnl::impl::status_t begin_capture();
+    dnnl::impl::status_t end_capture();
+    dnnl::impl::status_t replay();
+    bool is_capturing() const { return is_capturing_; }
+    void capture(const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_args_t &&args);
+
+    // Native capture. On engines other than CPU the executions submitted
+    // between begin_capture() and end_capture() are executed as usual and
+    // recorded by the runtime, e.g. into a SYCL command graph, and replay()
+    // submits the recorded work at once. The kernel arguments are fixed at
+    // capture, so the data handles of the memory objects must not change
+    // between replays.
+    bool is_native_capturing() const { return is_native_capturing_; }
+    void keep_captured(const primitive_iface_t *primitive_iface);
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl::impl::status_t get_threadpool(
             dnnl::threadpool_interop::threadpool_iface **threadpool) const {
@@ -89,8 +168,32 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 #endif
 
 protected:
+    virtual dnnl::impl::status_t begin_native_capture() {
+        return dnnl::impl::status::unimplemented;
+    }
+    virtual dnnl::impl::status_t end_native_capture() {
+        return dnnl::impl::status::unimplemented;
+    }
+    virtual dnnl::impl::status_t replay_native_capture() {
+        return dnnl::impl::status::unimplemented;
+    }
+
     dnnl::impl::engine_t *engine_;
     std::unique_ptr<dnnl::impl::stream_impl_t> impl_;
+    dnnl::impl::scratchpad_arena_t scratchpad_arena_;
+    std::shared_ptr<dnnl::impl::stream_memory_pool_t> memory_pool_;
+
+private:
+    struct captured_exec_t {
+        primitive_iface_t *primitive_iface;
+        dnnl::impl::exec_ctx_t ctx;
+    };
+
+    void clear_capture();
+
+    bool is_capturing_ = false;
+    bool is_native_capturing_ = false;
+    std::vector<captured_exec_t> captured_;
 };
 
 #endif
@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/stream_memory_pool.hpp"
+#include "common/stream.hpp"
+
+namespace dnnl {
+namespace impl {
+
+void stream_memory_pool_t::release(void *ptr) {
+    if (!ptr) return;
+
+    // The lock keeps the stream alive while the task is enqueued. The task
+    // does not take it, as it may run right away on this thread.
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stream_) {
+        auto self = shared_from_this();
+        const status_t status = stream_->enqueue_host_task([self, ptr]() {
+            self->pool_.release(ptr);
+            return status::success;
+        });
+        if (status == status::success) return;
+    }
+    pool_.release(ptr);
+}
+
+void stream_memory_pool_t::detach_stream() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stream_ = nullptr;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
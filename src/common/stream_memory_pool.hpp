@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_STREAM_MEMORY_POOL_HPP
+#define COMMON_STREAM_MEMORY_POOL_HPP
+
+#include <memory>
+#include <mutex>
+
+#include "common/c_types_map.hpp"
+#include "common/device_memory_pool.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// The caching arena of the memory objects allocated on a stream. A buffer is
+// released in stream order: the release is enqueued as a host task, so with
+// asynchronous execution the buffer is handed out again only after the
+// executions submitted before the memory object was destroyed. Allocations
+// are not ordered, as no execution can use a buffer before it is allocated.
+//
+// The arena is shared with the memory objects allocated from it and outlives
+// the stream, after whose destruction the buffers are returned right away.
+struct stream_memory_pool_t
+    : public std::enable_shared_from_this<stream_memory_pool_t> {
+    using alloc_func_t = device_memory_pool_t::alloc_func_t;
+    using free_func_t = device_memory_pool_t::free_func_t;
+
+    stream_memory_pool_t(stream_t *stream) : stream_(stream) {}
+
+    // Returns a buffer of at least `size` bytes.
+    void *acquire(size_t size, const alloc_func_t &alloc,
+            const free_func_t &free) {
+        return pool_.acquire(size, alloc, free);
+    }
+
+    // Returns the buffer obtained from acquire() to the arena once the work
+    // submitted to the stream so far is completed.
+    void release(void *ptr);
+
+    // Frees the cached buffers, see device_memory_pool_t::trim().
+    void trim() { pool_.trim(); }
+
+    // Called on the stream destruction.
+    void detach_stream();
+
+    size_t cached_size() const { return pool_.cached_size(); }
+
+private:
+    std::mutex mutex_;
+    stream_t *stream_;
+    device_memory_pool_t pool_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(stream_memory_pool_t);
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
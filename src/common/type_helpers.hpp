@@ -406,6 +406,14 @@ inline bool sparse_desc_is_equal(
     for (int i = 0; i < sparse_desc_t::max_metadata_types; i++)
         ok = ok && lhs.metadata_types[i] == rhs.metadata_types[i];
 
+    if (lhs.encoding == sparse_encoding::paged)
+        ok = ok && lhs.paged_dim == rhs.paged_dim
+                && lhs.page_size == rhs.page_size;
+
+    if (lhs.encoding == sparse_encoding::structured)
+        ok = ok && lhs.structured_n == rhs.structured_n
+                && lhs.structured_m == rhs.structured_m;
+
     return ok;
 }
 
@@ -741,6 +749,18 @@ inline bool operator==(const eltwise_desc_t &lhs, const eltwise_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(
+        const embedding_bag_desc_t &lhs, const embedding_bag_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(offsets_desc)
+            && COMPARE_DESC_MEMBERS(weights_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc);
+    return ret;
+}
+
 inline bool operator==(const gemm_desc_t &lhs, const gemm_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(a_desc)
@@ -985,6 +1005,8 @@ inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(vs_zero_points)
             && COMPARE_DESC_MEMBERS(dst_desc)
             && COMPARE_DESC_MEMBERS(attn_mask_desc)
+            && COMPARE_DESC_MEMBERS(block_table_desc)
+            && COMPARE_DESC_MEMBERS(context_lens_desc)
             && COMPARE_DESC_MEMBERS(scale_dt)
             && COMPARE_DESC_MEMBERS(kq_acc_dt)
             && COMPARE_DESC_MEMBERS(vs_acc_dt)
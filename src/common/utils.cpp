@@ -36,6 +36,7 @@
 #include <cstring>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -44,6 +45,7 @@
 #include "verbose.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/huge_pages.hpp"
 #include "cpu/platform.hpp"
 #endif
 
@@ -125,6 +127,22 @@ std::string getenv_string_user(const char *name) {
     return value;
 }
 
+std::string getenv_path_user(const char *name) {
+    std::string value;
+    for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+        std::string name_str = std::string(prefix) + std::string(name);
+        // The query with an empty buffer returns the negated length.
+        const int ret = getenv(name_str.c_str(), nullptr, 0);
+        if (ret >= 0 || ret == INT_MIN) continue;
+        const int len = -ret;
+        std::vector<char> value_str(len + 1);
+        if (getenv(name_str.c_str(), value_str.data(), len + 1) <= 0) continue;
+        value = value_str.data();
+        break;
+    }
+    return value;
+}
+
 status_t check_for_symlinks(const char *filename, bool *res) {
 #ifdef _WIN32
     DWORD attr = GetFileAttributesA(filename);
@@ -409,6 +427,15 @@ dnnl_cpu_isa_hints_t dnnl_get_cpu_isa_hints() {
     return isa_hint;
 }
 
+dnnl_status_t dnnl_get_cpu_huge_pages_size(size_t *size) {
+    if (size == nullptr) return dnnl::impl::status::invalid_arguments;
+    *size = 0;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    *size = dnnl::impl::cpu::huge_pages::get_allocated_size();
+#endif
+    return dnnl::impl::status::success;
+}
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 namespace dnnl {
@@ -697,6 +697,9 @@ int getenv_int_user(const char *name, int default_value = 0);
 // prefix and checks both supported variants - with "ONEDNN_" (primary) and
 // "DNNL_" (secondary) prefixes.
 std::string getenv_string_user(const char *name);
+// Reads a path from user environment. Same as getenv_string_user(), but the
+// value is neither truncated nor converted to lower case.
+std::string DNNL_API getenv_path_user(const char *name);
 
 // These are locale-invariant wrappers to define streaming objects for
 // string manipulation. Use these instead of the std library variants, namely,
@@ -761,7 +764,7 @@ std::string get_jit_profiling_jitdumpdir();
 // the application only processes secure files.
 status_t check_for_symlinks(const char *filename, bool *res);
 FILE *fopen(const char *filename, const char *mode);
-int getpagesize();
+int DNNL_API getpagesize();
 
 // return current library fpmath_mode
 fpmath_mode_t get_fpmath_mode();
@@ -41,6 +41,7 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "embedding_bag_pd.hpp"
 #include "gemm_pd.hpp"
 #include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
@@ -194,6 +195,8 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
             // Enable profiling to external libraries
             if (s == "profile_externals") k |= verbose_t::profile_externals;
             if (s == "warn") k |= verbose_t::warn;
+            if (s == "profile_cache") k |= verbose_t::cache_profile;
+            if (s == "trace_exec") k |= verbose_t::exec_trace;
             // we extract debug info debuginfo=XX. ignore if debuginfo is invalid.
             if (s.rfind("debuginfo=", 0) == 0)
                 k |= verbose_t::make_debuginfo(
@@ -231,6 +234,7 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
                 REGEX_SEARCH(k, softmax, regexp);
                 REGEX_SEARCH(k, layer_normalization, regexp);
                 REGEX_SEARCH(k, group_normalization, regexp);
+                REGEX_SEARCH(k, embedding_bag, regexp);
                 REGEX_SEARCH(k, graph, regexp);
                 REGEX_SEARCH(k, gemm_api, regexp);
                 REGEX_SEARCH(k, ukernel, regexp);
@@ -360,12 +364,14 @@ std::string normalization_flags2str(unsigned flags) {
     if (flags & normalization_flags::fuse_norm_relu) s += "R";
     if (flags & normalization_flags::fuse_norm_add_relu) s += "A";
     if (flags & normalization_flags::rms_norm) s += "M";
+    if (flags & normalization_flags::fuse_add_norm) s += "S";
     return s;
 }
 
 std::string rnn_flags2str(unsigned flags) {
     std::string s;
     if (flags & rnn_flags::diff_weights_overwrite) s += "O";
+    if (flags & rnn_flags::seq_lengths) s += "L";
     return s;
 }
 
@@ -727,6 +733,12 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
         ss << field_delim() << "attr-deterministic:" << deterministic;
     }
 
+    if (attr->constant_weights_)
+        ss << field_delim() << "attr-constant-weights:1";
+
+    if (attr->dynamic_quantization_)
+        ss << field_delim() << "attr-dynamic-quantization:1";
+
     // Fast exit if rest attributes were not specified.
     if (attr->has_default_values()) return ss;
 
@@ -825,6 +837,33 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
             default: assert(!"unsupported format_kind");
         }
     }
+
+    const softmax_mask_t &sm = attr->softmax_mask_;
+    if (!sm.has_default_values()) {
+        ss << field_delim() << "attr-softmax-mask:";
+        switch (sm.kind_) {
+            case softmax_mask_kind::none: ss << "none"; break;
+            case softmax_mask_kind::causal_top_left: ss << "causal_tl"; break;
+            case softmax_mask_kind::causal_bottom_right:
+                ss << "causal_br";
+                break;
+            default: assert(!"unknown softmax mask kind");
+        }
+        if (sm.with_lengths()) ss << ":lengths";
+    }
+
+    if (attr->top_k_ != 0)
+        ss << field_delim() << "attr-top-k:" << attr->top_k_;
+
+    if (!attr->dst_split_.has_default_values())
+        ss << field_delim() << "attr-dst-split:" << attr->dst_split_.nparts();
+
+    if (attr->workspace_dt_ != data_type::undef)
+        ss << field_delim()
+           << "attr-workspace-dt:" << dnnl_dt2str(attr->workspace_dt_);
+
+    if (attr->src_upsampling_ != 1)
+        ss << field_delim() << "attr-src-upsampling:" << attr->src_upsampling_;
     return ss;
 }
 
@@ -1025,6 +1064,33 @@ std::string init_info_eltwise(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_embedding_bag(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->src_md(0);
+    auto indices_md = pd->src_md(1);
+    auto offsets_md = pd->src_md(2);
+    auto wei_md = pd->weights_md(0);
+    auto dst_md = pd->dst_md(0);
+
+    ss << md2fmt_str("src", src_md, pd->src_md(0, true)->format_kind) << " ";
+    ss << md2fmt_str("indices", indices_md, indices_md->format_kind) << " ";
+    ss << md2fmt_str("offsets", offsets_md, offsets_md->format_kind) << " ";
+    if (pd->with_weights())
+        ss << md2fmt_str("wei", wei_md, wei_md->format_kind) << " ";
+    ss << md2fmt_str("dst", dst_md, pd->dst_md(0, true)->format_kind);
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << ",";
+    ss << md2dim_str(src_md) << ":" << md2dim_str(indices_md) << ":"
+       << md2dim_str(offsets_md);
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_gemm(const engine_t *e, const pd_t *pd) {
     stringstream_t ss;
@@ -1582,6 +1648,13 @@ std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
         ss << md2fmt_str("msk", pd->attn_mask_md(),
                 pd->invariant_src_user_format_kind(3))
            << " ";
+    if (pd->is_paged())
+        ss << md2fmt_str("blk", pd->block_table_md(),
+                pd->invariant_src_user_format_kind(4))
+           << " "
+           << md2fmt_str("ctx", pd->context_lens_md(),
+                      pd->invariant_src_user_format_kind(5))
+           << " ";
     ss << md2fmt_str("dst", pd->dst_md(), pd->invariant_dst_user_format_kind())
        << ",";
 
@@ -1635,6 +1708,9 @@ std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
         ss << dnnl_dt2str(desc->scale_dt);
     }
 
+    if (pd->is_paged())
+        ss << delimiter << "page:" << pd->desc()->page_size();
+
     ss << "," << md2dim_str(pd->qry_md()) << ":" << md2dim_str(pd->key_md())
        << ":" << md2dim_str(pd->val_md());
 
@@ -1670,6 +1746,7 @@ std::string rt_mds2str(primitive_kind_t prim_kind, const memory_desc_t *src_md,
         case primitive_kind::convolution:
         case primitive_kind::deconvolution:
         case primitive_kind::eltwise:
+        case primitive_kind::embedding_bag:
         case primitive_kind::inner_product:
         case primitive_kind::layer_normalization:
         case primitive_kind::lrn:
@@ -1739,6 +1816,7 @@ std::string rt_dims2fmt_str(primitive_kind_t prim_kind,
         case primitive_kind::convolution:
         case primitive_kind::deconvolution:
         case primitive_kind::eltwise:
+        case primitive_kind::embedding_bag:
         case primitive_kind::inner_product:
         case primitive_kind::layer_normalization:
         case primitive_kind::lrn:
@@ -1773,6 +1851,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
             CASE(gemm);
             CASE(group_normalization);
             CASE(inner_product);
@@ -196,6 +196,8 @@ struct verbose_t {
         exec_profile = 1 << 7,
         profile_externals = 1 << 8,
         warn = 1 << 9,
+        cache_profile = 1 << 10,
+        exec_trace = 1 << 11,
         // the upper 8 bits are reserved for devinfo levels
         debuginfo = 1 << 24,
         //
@@ -235,9 +237,10 @@ struct component_t {
         softmax = 1 << 19,
         layer_normalization = 1 << 20,
         group_normalization = 1 << 21,
-        graph = 1 << 22,
-        gemm_api = 1 << 23,
-        ukernel = 1 << 24,
+        embedding_bag = 1 << 22,
+        graph = 1 << 23,
+        gemm_api = 1 << 24,
+        ukernel = 1 << 25,
         all = (uint32_t)-1,
     };
 };
@@ -293,6 +296,7 @@ get_verbose_to_log_level_map() {
                     {verbose_t::exec_check, log_manager_t::error},
                     {verbose_t::error, log_manager_t::critical},
                     {verbose_t::warn, log_manager_t::warn},
+                    {verbose_t::cache_profile, log_manager_t::info},
                     {verbose_t::none, log_manager_t::off},
             };
     return verbose_to_log_map;
@@ -31,6 +31,7 @@
 #define VERBOSE_create_nested "create_nested"
 #define VERBOSE_exec "exec"
 #define VERBOSE_compile "compile"
+#define VERBOSE_cache "cache"
 #define VERBOSE_debuginfo "debuginfo"
 
 // log subtypes strings
@@ -47,6 +47,8 @@ status_t acl_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
 
     // skip_mean is set for root-mean-square normalization mode.
     ACL_CHECK_SUPPORT(skip_mean(), "rms normalization is not supported");
+    ACL_CHECK_SUPPORT(
+            fuse_add_norm(), "fused residual addition is not supported");
 
     // msdNorm only supports lnorm for src in a channels last format.
     // So if channels aren't last (ie. if they aren't dense),
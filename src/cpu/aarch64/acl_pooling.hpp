@@ -89,7 +89,8 @@ struct acl_pooling_fwd_t : public primitive_t {
                             src_md()->data_type, data_type::f32, data_type::f16)
                     && attr()->has_default_values()
                     && attr_.set_default_formats(dst_md(0)) == status::success
-                    && !is_dilated() && !has_zero_dim_memory();
+                    && !is_dilated() && !is_adaptive()
+                    && !has_zero_dim_memory();
             if (!ok) return status::unimplemented;
 
             const pooling_desc_t *pod = desc();
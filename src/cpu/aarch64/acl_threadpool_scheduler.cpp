@@ -20,15 +20,19 @@
 
 #include "common/counting_barrier.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/verbose.hpp"
 #include "cpu/aarch64/acl_thread.hpp"
 
 #include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/IScheduler.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <mutex>
+#include <vector>
 
 namespace dnnl {
 namespace impl {
@@ -37,32 +41,98 @@ namespace aarch64 {
 
 using namespace arm_compute;
 
-class ThreadFeeder {
+namespace {
+// The number of windows a dimension is split into per thread, so that the
+// threads that finish early take over the windows of the slower ones.
+constexpr int windows_per_thread = 4;
+
+/// Splits the workloads between the threads in contiguous ranges, so that a
+/// thread processes neighboring windows first. A thread that runs out of
+/// workloads steals them from the ranges of the other threads.
+class WorkStealingFeeder {
 public:
-    explicit ThreadFeeder(unsigned int start = 0, unsigned int end = 0)
-        : _atomic_counter(start), _end(end) {}
-
-    /// Function to check the next element in the range if there is one.
-    bool get_next(unsigned int &next) {
-        next = std::atomic_fetch_add_explicit(
-                &_atomic_counter, 1u, std::memory_order_relaxed);
-        return next < _end;
+    WorkStealingFeeder(unsigned int num_workloads, unsigned int num_threads)
+        : _ranges(num_threads) {
+        const unsigned int chunk = num_workloads / num_threads;
+        const unsigned int tail = num_workloads % num_threads;
+        unsigned int start = 0;
+        for (unsigned int t = 0; t < num_threads; ++t) {
+            const unsigned int size = chunk + (t < tail ? 1 : 0);
+            _ranges[t].next.store(start, std::memory_order_relaxed);
+            _ranges[t].end = start + size;
+            start += size;
+        }
+    }
+
+    /// Returns the next workload of a thread, taken from the range of
+    /// another thread if `is_stolen` is set, if there is one.
+    bool get_next(unsigned int ithr, unsigned int &next, bool &is_stolen) {
+        const unsigned int num_threads = _ranges.size();
+        for (unsigned int i = 0; i < num_threads; ++i) {
+            Range &range = _ranges[(ithr + i) % num_threads];
+            if (range.next.load(std::memory_order_relaxed) >= range.end)
+                continue;
+            next = range.next.fetch_add(1u, std::memory_order_relaxed);
+            if (next < range.end) {
+                is_stolen = i != 0;
+                return true;
+            }
+        }
+        return false;
     }
 
 private:
-    std::atomic_uint _atomic_counter;
-    const unsigned int _end;
+    struct Range {
+        std::atomic_uint next {0};
+        unsigned int end = 0;
+        // Keeps the counters of the threads in separate cache lines.
+        char pad[64];
+    };
+    std::vector<Range> _ranges;
+};
+
+struct ThreadStats {
+    double busy_ms = 0;
+    unsigned int num_stolen = 0;
 };
 
 void process_workloads(std::vector<IScheduler::Workload> &workloads,
-        ThreadFeeder &feeder, const ThreadInfo &info) {
-    unsigned int workload_index = info.thread_id;
-    do {
+        WorkStealingFeeder &feeder, const ThreadInfo &info,
+        ThreadStats &stats) {
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    unsigned int workload_index = 0;
+    bool is_stolen = false;
+    while (feeder.get_next(info.thread_id, workload_index, is_stolen)) {
         ARM_COMPUTE_ERROR_ON(workload_index >= workloads.size());
         workloads[workload_index](info);
-    } while (feeder.get_next(workload_index));
+        stats.num_stolen += is_stolen;
+    }
+    const std::chrono::duration<double, std::milli> busy
+            = clock::now() - start;
+    stats.busy_ms = busy.count();
 }
 
+// Reports how much longer the busiest thread worked than the average one.
+void report_imbalance(
+        size_t num_workloads, const std::vector<ThreadStats> &stats) {
+    if (!get_verbose(verbose_t::profile_externals)) return;
+    double max_ms = 0, sum_ms = 0;
+    unsigned int num_stolen = 0;
+    for (const auto &s : stats) {
+        max_ms = std::max(max_ms, s.busy_ms);
+        sum_ms += s.busy_ms;
+        num_stolen += s.num_stolen;
+    }
+    const double mean_ms = sum_ms / stats.size();
+    verbose_printf(verbose_t::profile_externals,
+            "cpu,acl,scheduler,workloads:%zu threads:%zu stolen:%u "
+            "imbalance:%g,%g\n",
+            num_workloads, stats.size(), num_stolen,
+            mean_ms > 0 ? max_ms / mean_ms : 1.0, max_ms);
+}
+} // namespace
+
 ThreadpoolScheduler::ThreadpoolScheduler()
     : _num_threads(dnnl_get_max_threads()) {}
 
@@ -81,14 +151,26 @@ void ThreadpoolScheduler::schedule(ICPPKernel *kernel, const Hints &hints) {
     ITensorPack tensors;
     // Retrieve threadpool size during primitive execution and set ThreadpoolScheduler num_threads
     acl_thread_utils::acl_set_threadpool_num_threads();
-    schedule_common(kernel, hints, kernel->window(), tensors);
+    schedule_common(kernel, dynamic_hints(hints), kernel->window(), tensors);
 }
 
 void ThreadpoolScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints,
         const Window &window, ITensorPack &tensors) {
     // Retrieve threadpool size during primitive execution and set ThreadpoolScheduler num_threads
     acl_thread_utils::acl_set_threadpool_num_threads();
-    schedule_common(kernel, hints, window, tensors);
+    schedule_common(kernel, dynamic_hints(hints), window, tensors);
+}
+
+IScheduler::Hints ThreadpoolScheduler::dynamic_hints(
+        const Hints &hints) const {
+    // A kernel split in all dimensions, or dynamically with its own number of
+    // windows, is scheduled as requested.
+    if (hints.split_dimension() == IScheduler::split_dimensions_all
+            || (hints.strategy() == StrategyHint::DYNAMIC
+                    && hints.threshold() > 0))
+        return hints;
+    return Hints(hints.split_dimension(), StrategyHint::DYNAMIC,
+            static_cast<int>(num_threads()) * windows_per_thread);
 }
 
 void ThreadpoolScheduler::run_workloads(
@@ -100,7 +182,8 @@ void ThreadpoolScheduler::run_workloads(
             = std::min(static_cast<unsigned int>(_num_threads),
                     static_cast<unsigned int>(workloads.size()));
     if (num_threads < 1) { return; }
-    ThreadFeeder feeder(num_threads, workloads.size());
+    WorkStealingFeeder feeder(workloads.size(), num_threads);
+    std::vector<ThreadStats> stats(num_threads);
     using namespace dnnl::impl::threadpool_utils;
     dnnl::threadpool_interop::threadpool_iface *tp = get_active_threadpool();
     // Non-initialized threadpool can cause a segmentation fault.
@@ -112,7 +195,7 @@ void ThreadpoolScheduler::run_workloads(
         info.cpu_info = &cpu_info();
         info.num_threads = 1;
         info.thread_id = 0;
-        process_workloads(workloads, feeder, info);
+        process_workloads(workloads, feeder, info, stats[0]);
         threadpool_utils::activate_threadpool(tp);
         return;
     }
@@ -128,11 +211,12 @@ void ThreadpoolScheduler::run_workloads(
         info.cpu_info = &cpu_info();
         info.num_threads = nthr;
         info.thread_id = ithr;
-        process_workloads(workloads, feeder, info);
+        process_workloads(workloads, feeder, info, stats[ithr]);
         if (!is_main) deactivate_threadpool();
         if (is_async) b.notify();
     });
     if (is_async) b.wait();
+    report_imbalance(workloads.size(), stats);
 }
 
 } // namespace aarch64
@@ -55,6 +55,10 @@ protected:
     void run_workloads(std::vector<Workload> &workloads) override;
 
 private:
+    /// Returns the hints of a kernel with a dimension split into more
+    /// windows than threads, which are balanced between the threads.
+    Hints dynamic_hints(const Hints &hints) const;
+
     unsigned int _num_threads {};
     std::mutex _mtx;
 };
@@ -343,6 +343,12 @@ void reorder_to_weight_format(arm_compute::TensorInfo &info, memory_desc_t &md,
             memory_desc_wrapper(md).size());
 }
 
+int constant_weights_capacity() {
+    static const int capacity
+            = nstl::max(0, getenv_int_user("ACL_CONSTANT_WEIGHTS", 0));
+    return capacity;
+}
+
 } // namespace acl_utils
 
 } // namespace aarch64
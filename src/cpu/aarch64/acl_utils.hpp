@@ -103,6 +103,13 @@ void reorder_to_weight_format(arm_compute::TensorInfo &info, memory_desc_t &md,
             verbose_printf("cpu,acl,unsupported: %s\n", (msg)); \
     } while (0)
 
+// Returns the number of weights tensors for which a primitive may keep the
+// weights reshaped by ACL across executions, set with the
+// ONEDNN_ACL_CONSTANT_WEIGHTS environment variable. The weights kept are
+// assumed not to change while they are passed in the same buffer. Returns 0,
+// the default, if the weights are reshaped on every execution.
+int constant_weights_capacity();
+
 // Returns unimplemented if error code x is NOT OK
 #define ACL_CHECK_VALID(x) \
     do { \
@@ -18,6 +18,7 @@
 
 #include "cpu/aarch64/brgemm/brgemm.hpp"
 #include "cpu/aarch64/brgemm/brgemm_utils.hpp"
+#include "cpu/aarch64/brgemm/jit_brgemm_sme_kernel.hpp"
 
 #include "common/c_types_map.hpp"
 #include "common/nstl.hpp"
@@ -183,6 +184,10 @@ status_t brgemm_desc_init(brgemm_t *brg, cpu_isa_t isa,
                 false, brg->is_int8, brg->is_bf16, brg->is_f32, brg->is_f16))
         return status::unimplemented;
 
+    // Mixed-sign int8 products use USDOT, which comes with I8MM.
+    if (brg->is_int8 && brg->dt_a != brg->dt_b && !mayiuse_i8mm())
+        return status::unimplemented;
+
     CHECK(brgemm_blocking(brg));
 
     return status::success;
@@ -442,6 +447,9 @@ status_t brgemm_kernel_create(
     if (brg.is_dgmm) {
         CHECK(safe_ptr_assign<brgemm_kernel_t>(
                 *brg_kernel, new brdgmm_kernel_t(brg)));
+    } else if (jit_brgemm_sme_kernel_t::is_applicable(brg)) {
+        CHECK(safe_ptr_assign<brgemm_kernel_t>(
+                *brg_kernel, new brgemm_sme_kernel_t(brg)));
     } else {
         CHECK(safe_ptr_assign<brgemm_kernel_t>(
                 *brg_kernel, new brgemm_kernel_common_t(brg)));
@@ -337,6 +337,7 @@ struct brgemm_kernel_params_t {
 
 struct jit_brgemm_kernel_t;
 struct jit_brdgmm_kernel_base_t;
+struct jit_brgemm_sme_kernel_t;
 class jit_generator;
 
 struct brgemm_kernel_t {
@@ -375,6 +376,20 @@ private:
     DNNL_DISALLOW_COPY_AND_ASSIGN(brdgmm_kernel_t);
 };
 
+struct brgemm_sme_kernel_t : public brgemm_kernel_t {
+    brgemm_sme_kernel_t(const brgemm_t abrd);
+    ~brgemm_sme_kernel_t();
+
+    status_t create_kernel();
+    void operator()(brgemm_kernel_params_t *) const;
+    virtual const jit_generator *get_jit_generator() const;
+
+private:
+    jit_brgemm_sme_kernel_t *brgemm_kernel_ = nullptr;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(brgemm_sme_kernel_t);
+};
+
 /// @param bias Vector of bias (vector length is N)
 /// @param scales - Vector of scale factor values which represents combination
 ///     scale factors for matrixes A and B. If brgemm_t::is_oc_scale = true
@@ -218,8 +218,18 @@ void jit_brdgmm_kernel_base_t::cvt2ps(data_type_t type_in, const ZReg vmm_in,
                 ld1w(vmm_in.s, P_ALL_ONE / T_z, op);
             break;
         case data_type::f16: assert(!"unsupported data type\n"); break;
-        case data_type::s8: assert(!"unsupported data type\n"); break;
-        case data_type::u8: assert(!"unsupported data type\n"); break;
+        case data_type::s8:
+        case data_type::u8: {
+            const PReg p_load = mask_flag ? k_mask : P_ALL_ONE;
+            const ZReg vmm_load = mask_flag && store ? vmm_tmp(0) : vmm_in;
+            if (type_in == data_type::s8)
+                ld1sb(vmm_load.s, p_load / T_z, op);
+            else
+                ld1b(vmm_load.s, p_load / T_z, op);
+            if (vmm_load.getIdx() != vmm_in.getIdx())
+                mov(vmm_in.s, k_mask / T_m, vmm_load.s);
+            break;
+        }
         default: assert(!"unsupported data type");
     }
     if (types::is_integral_dt(type_in)) {
@@ -392,7 +402,9 @@ void jit_brdgmm_kernel_base_t::store_accumulators_apply_post_ops(
         }
         for (int m = 0; m < m_blocks; m++) {
             auto vmm = accm(m_blocks, n_blocks, m, n, v_i);
-            if (dq2ps_required) scvtf(vmm.s, P_ALL_ONE / T_m, vmm.s);
+            // The accumulators are already converted with the scales.
+            if (dq2ps_required && !brg.with_scales)
+                scvtf(vmm.s, P_ALL_ONE / T_m, vmm.s);
             if (brg.with_bias) { fadd(vmm.s, vmm.s, vmm_bias.s); }
         }
     }
@@ -436,7 +448,16 @@ void jit_brdgmm_kernel_base_t::store_accumulators_apply_post_ops(
     }
 
     for (int m = 0; m < m_blocks; m++) {
-        if (dt_requires_saturation) { assert(!"unsupported\n"); }
+        if (dt_requires_saturation) {
+            for_(int n = 0; n < n_blocks; n++)
+            for (int v_i = 0; v_i < v_substep; ++v_i) {
+                if (get_substep_simd(n, v_i, has_n_tail) <= 0) continue;
+                auto vmm = accm(m_blocks, n_blocks, m, n, v_i);
+                saturate_f32(vmm, vmm_lbound, vmm_ubound, brg.dt_d, P_ALL_ONE);
+                frinti(vmm.s, P_ALL_ONE / T_m, vmm.s);
+                fcvtzs(vmm.s, P_ALL_ONE / T_m, vmm.s);
+            }
+        }
 
         for_(int n = 0; n < n_blocks; n++)
         for (int v_i = 0; v_i < v_substep; ++v_i) {
@@ -447,17 +468,20 @@ void jit_brdgmm_kernel_base_t::store_accumulators_apply_post_ops(
             auto addr = ptr(X_DEFAULT_ADDR);
             auto vmm = accm(m_blocks, n_blocks, m, n, v_i);
             const bool mask_flag = n + 1 == n_blocks && has_n_tail;
+            const PReg p_store = mask_flag ? k_mask : P_ALL_ONE;
             switch (brg.dt_d) {
                 case data_type::f32:
-                case data_type::s32:
-                    if (mask_flag)
-                        st1w(vmm.s, k_mask / T_m, addr);
-                    else
-                        st1w(vmm.s, P_ALL_ONE / T_m, addr);
-                    break;
+                case data_type::s32: st1w(vmm.s, p_store / T_m, addr); break;
                 case data_type::bf16: assert(!"unsupported data type\n"); break;
-                case data_type::s8: assert(!"unsupported data type\n"); break;
-                case data_type::u8: assert(!"unsupported data type\n"); break;
+                case data_type::s8:
+                    smin(vmm.s, std::numeric_limits<int8_t>::max());
+                    smax(vmm.s, std::numeric_limits<int8_t>::min());
+                    st1b(vmm.s, p_store, addr);
+                    break;
+                case data_type::u8:
+                    umin(vmm.s, std::numeric_limits<uint8_t>::max());
+                    st1b(vmm.s, p_store, addr);
+                    break;
                 default: assert(!"unknown dst_dt");
             }
         }
@@ -538,7 +562,11 @@ void jit_brdgmm_kernel_base_t::load_a(
     } else if (brg.is_bf16) {
         assert(!"unsupported\n");
     } else if (brg.is_int8) {
-        assert(!"unsupported\n");
+        const PReg p_load = mask_flag ? k_mask : P_ALL_ONE;
+        if (brg.dt_a == data_type::s8)
+            ld1sb(vmma.s, p_load / T_z, addr);
+        else
+            ld1b(vmma.s, p_load / T_z, addr);
     }
 }
 
@@ -556,7 +584,10 @@ void jit_brdgmm_kernel_base_t::load_b(
     if (brg.is_f32) {
         ld1w(vmmb.s, P_ALL_ONE / T_z, addr);
     } else if (brg.is_int8) {
-        assert(!"unsupported\n");
+        if (brg.dt_b == data_type::s8)
+            ld1sb(vmmb.s, P_ALL_ONE / T_z, addr);
+        else
+            ld1b(vmmb.s, P_ALL_ONE / T_z, addr);
     } else if (brg.is_bf16) {
         assert(!"unsupported\n");
     }
@@ -592,7 +623,9 @@ void jit_brdgmm_kernel_base_t::brdgmm_microkernel(int m_blocks, int n_blocks,
         } else if (brg.is_bf16) {
             assert(!"unsupported\n");
         } else if (brg.is_int8) {
-            assert(!"unsupported\n");
+            // The widened values are multiplied in 32-bit lanes, which keeps
+            // the kernel exact for both signed and unsigned sources.
+            mla(vmm_acc.s, P_ALL_ONE / T_m, vmma.s, vmmb.s);
         }
     };
 
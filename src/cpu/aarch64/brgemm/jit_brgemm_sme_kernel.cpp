@@ -0,0 +1,296 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/brgemm/jit_brgemm_sme_kernel.hpp"
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+
+#define GET_OFF(field) (uint32_t) offsetof(brgemm_kernel_params_t, field)
+#define GET_OFF_BATCH_ELEMENT(field) \
+    (uint32_t) offsetof(brgemm_batch_element_t, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::utils;
+using namespace Xbyak_aarch64;
+
+namespace {
+// The bytes of a granule of K, the element of the tiles.
+constexpr int granule_size = 4;
+} // namespace
+
+jit_brgemm_sme_kernel_t::jit_brgemm_sme_kernel_t(const brgemm_t &abrg)
+    : jit_generator(nullptr, MAX_CODE_SIZE, true, sve_512)
+    , brg(abrg)
+    , svl_(static_cast<int>(get_sme_length()) / granule_size) {}
+
+bool jit_brgemm_sme_kernel_t::is_applicable(const brgemm_t &brg) {
+    if (!mayiuse_sme()) return false;
+    // The predicates are set for at most 64 elements.
+    if (get_sme_length() / granule_size > 64) return false;
+
+    // The names of the data types are hidden by the registers of the
+    // generator.
+    namespace dt = data_type;
+    const bool is_f32 = everyone_is(dt::f32, brg.dt_a, brg.dt_b, brg.dt_c)
+            && !brg.is_bf32;
+    const bool is_bf16 = everyone_is(dt::bf16, brg.dt_a, brg.dt_b)
+            && brg.dt_c == dt::f32;
+    const bool is_int8 = one_of(brg.dt_a, dt::u8, dt::s8)
+            && brg.dt_b == dt::s8 && brg.dt_c == dt::s32;
+    if (!one_of(true, is_f32, is_bf16, is_int8)) return false;
+
+    const bool has_zero_points = !everyone_is(brgemm_broadcast_t::none,
+            brg.zp_type_a, brg.zp_type_b, brg.zp_type_c);
+    const bool has_post_ops = one_of(true, brg.with_bias, brg.with_scales,
+            brg.with_eltwise, brg.with_binary, brg.with_sum,
+            brg.with_dst_scales, has_zero_points, brg.req_s8s8_compensation,
+            brg.req_cal_comp_pads, brg.dt_d != brg.dt_c);
+    const auto &attr = brg.brgattr;
+
+    return !has_post_ops && brg.is_row_major() && !brg.is_blocked
+            && !brg.is_dgmm && brg.alpha == 1.f && one_of(brg.beta, 0.f, 1.f)
+            && one_of(brg.type, brgemm_addr, brgemm_offs, brgemm_strd)
+            && attr.bd_mask_level == 0 && attr.max_top_vpad == 0
+            && attr.max_bottom_vpad == 0 && !attr.generate_skip_accumulation
+            && !attr.postops_only && brg.rd_step == brg.ld_step
+            && brg.rd_step * brg.typesize_A == granule_size
+            && brg.reduce_dim % brg.rd_step == 0;
+}
+
+void jit_brgemm_sme_kernel_t::ld1w_za_h(
+        int tile, int w_idx, int off, const PReg &pg, const XReg &base) {
+    // LD1W { ZA<tile>H.S[W<12 + w_idx>, off] }, Pg/Z, [Xn, XZR, LSL #2]
+    dd(0xe0800000 | (31 << 16) | (w_idx << 13) | (pg.getIdx() << 10)
+            | (base.getIdx() << 5) | (tile << 2) | off);
+}
+
+void jit_brgemm_sme_kernel_t::mova_z(const ZReg &zd, const PReg &pg, int tile,
+        bool vertical, int w_idx, int off) {
+    // MOVA Zd.S, Pg/M, ZA<tile><H|V>.S[W<12 + w_idx>, off]
+    dd(0xc0820000 | (static_cast<uint32_t>(vertical) << 15) | (w_idx << 13)
+            | (pg.getIdx() << 10) | (tile << 7) | (off << 5) | zd.getIdx());
+}
+
+void jit_brgemm_sme_kernel_t::mopa(int tile, const PReg &pn, const PReg &pm,
+        const ZReg &zn, const ZReg &zm) {
+    // FMOPA, BFMOPA, SMOPA and USMOPA ZA<tile>.S, Pn/M, Pm/M, Zn, Zm
+    uint32_t opc = 0x80800000;
+    if (brg.dt_a == data_type::bf16)
+        opc = 0x81800000;
+    else if (brg.dt_a == data_type::s8)
+        opc = 0xa0800000;
+    else if (brg.dt_a == data_type::u8)
+        opc = 0xa1800000;
+    dd(opc | (zm.getIdx() << 16) | (pm.getIdx() << 13) | (pn.getIdx() << 10)
+            | (zn.getIdx() << 5) | tile);
+}
+
+void jit_brgemm_sme_kernel_t::compute_chunk(
+        int m_rows, bool has_second_tile, int granules) {
+    const WReg w_load(12 + w_load_idx);
+    const WReg w_read(12 + w_read_idx);
+    const int A_row_size = brg.LDA * brg.typesize_A;
+    const int B_row_size = brg.ld_step * brg.LDB * brg.typesize_B;
+
+    // The rows of the block of A become the rows of za2, with the granules
+    // past the chunk set to zero.
+    set_preg(p_granules.s, granules, X_TMP_0, X_TMP_1);
+    mov(reg_A_row, reg_A_chunk);
+    mov_imm(w_load, 0);
+    for (int r = 0; r < m_rows; r++) {
+        const bool is_last = r + 1 == m_rows;
+        ld1w_za_h(2, w_load_idx, r % 4, p_granules, reg_A_row);
+        if (!is_last) add_imm(reg_A_row, reg_A_row, A_row_size, reg_tmp);
+        if (r % 4 == 3 && !is_last) add(w_load, w_load, 4);
+    }
+
+    // A column of za2 holds a granule of the block rows, and is multiplied
+    // by the same granule of the block columns of B. The registers are
+    // alternated between the granules so that the loads are not serialized.
+    mov_imm(w_read, 0);
+    for (int g = 0; g < granules; g++) {
+        const bool is_last = g + 1 == granules;
+        const ZReg z_a(3 * (g % 2));
+        const ZReg z_b0(3 * (g % 2) + 1);
+        const ZReg z_b1(3 * (g % 2) + 2);
+        mova_z(z_a, p_all, 2, true, w_read_idx, g % 4);
+        ld1w(z_b0.s, p_cols0 / T_z, ptr(reg_B_row));
+        if (has_second_tile)
+            ld1w(z_b1.s, p_cols1 / T_z, ptr(reg_B_row, 1, MUL_VL));
+        mopa(0, p_rows, p_cols0, z_a, z_b0);
+        if (has_second_tile) mopa(1, p_rows, p_cols1, z_a, z_b1);
+        add_imm(reg_B_row, reg_B_row, B_row_size, reg_tmp);
+        if (g % 4 == 3 && !is_last) add(w_read, w_read, 4);
+    }
+    add_imm(reg_A_chunk, reg_A_chunk, granules * granule_size, reg_tmp);
+}
+
+void jit_brgemm_sme_kernel_t::store_block(
+        int m0, int n0, int m_rows, bool has_second_tile) {
+    const WReg w_store(12 + w_store_idx);
+    const int C_row_size = brg.LDC * brg.typesize_C;
+    const bool with_beta = brg.beta != 0.f;
+
+    add_imm(reg_C_row, reg_C, (m0 * brg.LDC + n0) * brg.typesize_C, reg_tmp);
+    mov_imm(w_store, 0);
+    for (int r = 0; r < m_rows; r++) {
+        const bool is_last = r + 1 == m_rows;
+        for (int t = 0; t < 1 + has_second_tile; t++) {
+            const ZReg z_acc(2 * t);
+            const ZReg z_c(2 * t + 1);
+            const PReg &p_cols = t == 0 ? p_cols0 : p_cols1;
+            const auto addr = ptr(reg_C_row, t, MUL_VL);
+            mova_z(z_acc, p_all, t, false, w_store_idx, r % 4);
+            if (with_beta) {
+                ld1w(z_c.s, p_cols / T_z, addr);
+                if (brg.dt_c == data_type::s32)
+                    add(z_acc.s, z_acc.s, z_c.s);
+                else
+                    fadd(z_acc.s, z_acc.s, z_c.s);
+            }
+            st1w(z_acc.s, p_cols, addr);
+        }
+        if (!is_last) add_imm(reg_C_row, reg_C_row, C_row_size, reg_tmp);
+        if (r % 4 == 3 && !is_last) add(w_store, w_store, 4);
+    }
+}
+
+void jit_brgemm_sme_kernel_t::compute_block(
+        int m0, int n0, int m_rows, int n_cols) {
+    const int n_cols0 = nstl::min(svl_, n_cols);
+    const int n_cols1 = n_cols - n_cols0;
+    const bool has_second_tile = n_cols1 > 0;
+
+    set_preg(p_rows.s, m_rows, X_TMP_0, X_TMP_1);
+    set_preg(p_cols0.s, n_cols0, X_TMP_0, X_TMP_1);
+    if (has_second_tile) set_preg(p_cols1.s, n_cols1, X_TMP_0, X_TMP_1);
+    // za0.s and za1.s
+    zero_za(has_second_tile ? 0x33 : 0x11);
+
+    Label label_bs_loop, label_bs_done;
+    mov(reg_BS_loop, reg_BS);
+    cbz(reg_BS_loop, label_bs_done);
+    if (brg.type == brgemm_strd) {
+        mov(reg_aux_A, reg_A);
+        mov(reg_aux_B, reg_B);
+    } else {
+        mov(reg_aux_batch, reg_batch);
+    }
+
+    L_aligned(label_bs_loop);
+    {
+        if (brg.type == brgemm_addr) {
+            ldr(reg_aux_A, ptr(reg_aux_batch, GET_OFF_BATCH_ELEMENT(ptr.A)));
+            ldr(reg_aux_B, ptr(reg_aux_batch, GET_OFF_BATCH_ELEMENT(ptr.B)));
+        } else if (brg.type == brgemm_offs) {
+            ldr(reg_tmp, ptr(reg_aux_batch, GET_OFF_BATCH_ELEMENT(offset.A)));
+            add(reg_aux_A, reg_A, reg_tmp);
+            ldr(reg_tmp, ptr(reg_aux_batch, GET_OFF_BATCH_ELEMENT(offset.B)));
+            add(reg_aux_B, reg_B, reg_tmp);
+        }
+        if (brg.type != brgemm_strd)
+            add_imm(reg_aux_batch, reg_aux_batch,
+                    sizeof(brgemm_batch_element_t), reg_tmp);
+
+        add_imm(reg_A_chunk, reg_aux_A, m0 * brg.LDA * brg.typesize_A,
+                reg_tmp);
+        add_imm(reg_B_row, reg_aux_B, n0 * brg.ld_step * brg.typesize_B,
+                reg_tmp);
+
+        const int nb_full_chunks = K_granules() / svl_;
+        const int chunk_tail = K_granules() % svl_;
+        if (nb_full_chunks > 1) {
+            Label label_rdb_loop;
+            mov_imm(reg_rdb_loop, nb_full_chunks);
+            L_aligned(label_rdb_loop);
+            compute_chunk(m_rows, has_second_tile, svl_);
+            subs(reg_rdb_loop, reg_rdb_loop, 1);
+            b(NE, label_rdb_loop);
+        } else if (nb_full_chunks == 1) {
+            compute_chunk(m_rows, has_second_tile, svl_);
+        }
+        if (chunk_tail > 0) compute_chunk(m_rows, has_second_tile, chunk_tail);
+
+        if (brg.type == brgemm_strd) {
+            add_imm(reg_aux_A, reg_aux_A, brg.stride_a, reg_tmp);
+            add_imm(reg_aux_B, reg_aux_B, brg.stride_b, reg_tmp);
+        }
+        subs(reg_BS_loop, reg_BS_loop, 1);
+        b(NE, label_bs_loop);
+    }
+    L_aligned(label_bs_done);
+
+    store_block(m0, n0, m_rows, has_second_tile);
+}
+
+void jit_brgemm_sme_kernel_t::generate() {
+    preamble();
+
+    ldr(reg_BS, ptr(param1, GET_OFF(BS)));
+    ldr(reg_C, ptr(param1, GET_OFF(ptr_C)));
+    if (brg.type != brgemm_addr) {
+        ldr(reg_A, ptr(param1, GET_OFF(ptr_A)));
+        ldr(reg_B, ptr(param1, GET_OFF(ptr_B)));
+    }
+    if (brg.type != brgemm_strd) ldr(reg_batch, ptr(param1, GET_OFF(batch)));
+
+    // Entering the streaming mode zeroes the vector and predicate registers,
+    // so the predicates are set afterwards. The low halves of z8-z15 are
+    // restored by the postamble after the streaming mode is left.
+    smstart();
+    ptrue(p_all.s);
+
+    for (int m0 = 0; m0 < M(); m0 += svl_) {
+        const int m_rows = nstl::min(svl_, M() - m0);
+        for (int n0 = 0; n0 < N(); n0 += 2 * svl_)
+            compute_block(m0, n0, m_rows, nstl::min(2 * svl_, N() - n0));
+    }
+
+    smstop();
+    postamble();
+}
+
+brgemm_sme_kernel_t::brgemm_sme_kernel_t(const brgemm_t abrd) {
+    brgemm_kernel_ = new jit_brgemm_sme_kernel_t(abrd);
+}
+
+status_t brgemm_sme_kernel_t::create_kernel() {
+    return brgemm_kernel_->create_kernel();
+}
+
+void brgemm_sme_kernel_t::operator()(brgemm_kernel_params_t *params) const {
+    (*brgemm_kernel_)(params);
+}
+
+const jit_generator *brgemm_sme_kernel_t::get_jit_generator() const {
+    return brgemm_kernel_;
+}
+
+brgemm_sme_kernel_t::~brgemm_sme_kernel_t() {
+    delete brgemm_kernel_;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_AARCH64_BRGEMM_JIT_BRGEMM_SME_KERNEL_HPP
+#define CPU_AARCH64_BRGEMM_JIT_BRGEMM_SME_KERNEL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/brgemm/brgemm_types.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Brgemm kernel accumulating in the ZA tiles of SME with outer products.
+//
+// The kernel enters the streaming mode with ZA enabled on every call and
+// leaves it before returning, so that no ZA state lives across calls. C is
+// computed in blocks of SVL rows by 2 * SVL columns, where SVL is the number
+// of 32-bit elements of a streaming vector. The accumulators of a block are
+// the tiles za0 and za1, and the rows of A are loaded into the tile za2 to
+// read its columns, the 32-bit granules of K, as vectors of the block rows.
+// A granule holds 1 f32, 2 bf16 or 4 int8 values of K, which matches the
+// packing of B for the widening outer products.
+//
+// Only the plain accumulation is supported: the descriptors with post-ops,
+// scales, zero points or masks are left to the SVE kernel.
+struct jit_brgemm_sme_kernel_t : public jit_generator {
+    jit_brgemm_sme_kernel_t(const brgemm_t &abrg);
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_sme_kernel_t)
+
+    static bool is_applicable(const brgemm_t &brg);
+
+    brgemm_t brg;
+
+private:
+    // The number of 32-bit elements of a streaming vector.
+    const int svl_;
+
+    const Xbyak_aarch64::XReg param1 = x0;
+    const Xbyak_aarch64::XReg reg_BS = x1;
+    const Xbyak_aarch64::XReg reg_batch = x2;
+    const Xbyak_aarch64::XReg reg_A = x3;
+    const Xbyak_aarch64::XReg reg_B = x4;
+    const Xbyak_aarch64::XReg reg_C = x5;
+    const Xbyak_aarch64::XReg reg_BS_loop = x6;
+    const Xbyak_aarch64::XReg reg_aux_A = x7;
+    const Xbyak_aarch64::XReg reg_aux_B = x8;
+    const Xbyak_aarch64::XReg reg_A_row = x9;
+    const Xbyak_aarch64::XReg reg_B_row = x10;
+    const Xbyak_aarch64::XReg reg_rdb_loop = x11;
+    const Xbyak_aarch64::XReg reg_C_row = x15;
+    const Xbyak_aarch64::XReg reg_A_chunk = x16;
+    const Xbyak_aarch64::XReg reg_tmp = x17;
+    const Xbyak_aarch64::XReg reg_aux_batch = x19;
+
+    // The slices of the tiles are indexed by w12-w15 only.
+    static constexpr int w_load_idx = 0; // w12
+    static constexpr int w_read_idx = 1; // w13
+    static constexpr int w_store_idx = 2; // w14
+
+    const Xbyak_aarch64::PReg p_all = p0;
+    const Xbyak_aarch64::PReg p_rows = p1;
+    const Xbyak_aarch64::PReg p_cols0 = p2;
+    const Xbyak_aarch64::PReg p_cols1 = p3;
+    const Xbyak_aarch64::PReg p_granules = p4;
+
+    int M() const { return brg.bcast_dim; }
+    int N() const { return brg.load_dim; }
+    // The number of 32-bit granules of K.
+    int K_granules() const { return brg.reduce_dim / brg.rd_step; }
+
+    // SME instructions, which the assembler does not provide.
+    void smstart() { dd(0xd503477f); }
+    void smstop() { dd(0xd503467f); }
+    void zero_za(uint32_t mask) { dd(0xc0080000 | mask); }
+    // Loads a horizontal 32-bit slice of a tile.
+    void ld1w_za_h(int tile, int w_idx, int off, const Xbyak_aarch64::PReg &pg,
+            const Xbyak_aarch64::XReg &base);
+    // Moves a 32-bit slice of a tile to a vector.
+    void mova_z(const Xbyak_aarch64::ZReg &zd, const Xbyak_aarch64::PReg &pg,
+            int tile, bool vertical, int w_idx, int off);
+    // Accumulates the outer product of two vectors to a tile.
+    void mopa(int tile, const Xbyak_aarch64::PReg &pn,
+            const Xbyak_aarch64::PReg &pm, const Xbyak_aarch64::ZReg &zn,
+            const Xbyak_aarch64::ZReg &zm);
+
+    void compute_chunk(int m_rows, bool has_second_tile, int granules);
+    void store_block(int m0, int n0, int m_rows, bool has_second_tile);
+    void compute_block(int m0, int n0, int m_rows, int n_cols);
+
+    void generate() override;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -19,6 +19,11 @@
 #include <mutex>
 #include <string>
 
+#if defined(__linux__)
+#include <sys/auxv.h>
+#include <sys/prctl.h>
+#endif
+
 #include "common/utils.hpp"
 
 #include "cpu/aarch64/cpu_isa_traits.hpp"
@@ -115,6 +120,36 @@ cpu_isa_t get_max_cpu_isa() {
     return get_isa_info_t().isa;
 }
 
+uint64_t get_sme_length() {
+    static const uint64_t sme_length = []() -> uint64_t {
+#if defined(__linux__) && defined(AT_HWCAP2)
+        // Older kernel headers do not define the SME capability and controls.
+        constexpr unsigned long hwcap2_sme = 1UL << 23;
+        constexpr int pr_sme_get_vl = 64;
+        constexpr int pr_sme_vl_len_mask = 0xffff;
+        if (!(getauxval(AT_HWCAP2) & hwcap2_sme)) return 0;
+        const int vl = prctl(pr_sme_get_vl, 0, 0, 0, 0);
+        return vl < 0 ? 0 : static_cast<uint64_t>(vl & pr_sme_vl_len_mask);
+#else
+        return 0;
+#endif
+    }();
+    return sme_length;
+}
+
+bool has_sve_i8mm() {
+    static const bool sve_i8mm = []() {
+#if defined(__linux__) && defined(AT_HWCAP2)
+        // Older kernel headers do not define the SVE I8MM capability.
+        constexpr unsigned long hwcap2_svei8mm = 1UL << 9;
+        return (getauxval(AT_HWCAP2) & hwcap2_svei8mm) != 0;
+#else
+        return false;
+#endif
+    }();
+    return sve_i8mm;
+}
+
 cpu_isa_t get_max_cpu_isa_mask(bool soft) {
     MAYBE_UNUSED(soft);
 #ifdef DNNL_ENABLE_MAX_CPU_ISA
@@ -102,6 +102,13 @@ cpu_isa_t DNNL_API get_max_cpu_isa_mask(bool soft = false);
 status_t set_max_cpu_isa(dnnl_cpu_isa_t isa);
 dnnl_cpu_isa_t get_effective_cpu_isa();
 
+// Streaming SVE length of SME in bytes, or 0 if SME is not available
+uint64_t get_sme_length();
+
+// Whether the SVE int8 matrix multiplication instructions, such as USDOT, are
+// available
+bool has_sve_i8mm();
+
 // If isa is a superset of sve_128, return sve_128, else return isa
 constexpr cpu_isa_t to_vla_sve(const cpu_isa_t isa) {
     return (cpu_isa_t)(isa & sve_128);
@@ -237,6 +244,14 @@ static inline bool mayiuse_bf16() {
     return cpu().isBf16Supported();
 }
 
+static inline bool mayiuse_sme() {
+    return get_sme_length() != 0;
+}
+
+static inline bool mayiuse_i8mm() {
+    return mayiuse(sve_128) && has_sve_i8mm();
+}
+
 static inline int isa_num_vregs(cpu_isa_t isa) {
     if (isa == sve_512)
         return cpu_isa_traits<sve_512>::n_vregs;
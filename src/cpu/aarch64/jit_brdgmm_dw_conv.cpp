@@ -101,9 +101,10 @@ status_t brdgmm_dw_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     const auto bia_type = cd.bias_desc.data_type;
     const auto dst_type = cd.dst_desc.data_type;
 
-    // TODO: support s8s8 conv
     const bool is_f32 = everyone_is(f32, src_type, wei_type, dst_type);
-    const bool is_int8 = one_of(src_type, u8) && wei_type == s8
+    // The int8 values are widened to 32 bits in the kernel, so a signed
+    // source needs no compensation.
+    const bool is_int8 = one_of(src_type, u8, s8) && wei_type == s8
             && one_of(dst_type, s32, f32, u8, s8);
 
     //     const auto isa = sve_512;
@@ -1265,7 +1265,7 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
         }
     });
 
-    if (_pd->wants_zero_pad_dst()) ctx.memory(DNNL_ARG_DST)->zero_pad(ctx);
+    if (_pd->wants_zero_pad_dst()) ctx.zero_pad_output(DNNL_ARG_DST);
 
     return status::success;
 }
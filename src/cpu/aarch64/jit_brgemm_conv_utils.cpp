@@ -1735,10 +1735,12 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
 
     const bool is_signed_input = jcp.src_dt == s8;
     jcp.s8s8_compensation_required = is_signed_input && !isa_has_s8s8(jcp.isa);
-    jcp.has_int8_vnni
-            = is_superset(jcp.isa, sve_512) || is_superset(jcp.isa, sve_256);
-    if (!IMPLICATION(
-                jcp.wei_dt == s8, mayiuse(sve_512) || one_of(jcp.isa, sve_256)))
+    // The SVE dot products are vector length agnostic, so int8 is supported
+    // at any vector length. A u8 source with s8 weights requires I8MM.
+    jcp.has_int8_vnni = is_superset(jcp.isa, sve_128);
+    if (!IMPLICATION(jcp.wei_dt == s8, is_superset(jcp.isa, sve_128)))
+        return status::unimplemented;
+    if (!IMPLICATION(jcp.src_dt == u8 && jcp.wei_dt == s8, mayiuse_i8mm()))
         return status::unimplemented;
     if (!IMPLICATION(jcp.wei_dt == bf16, mayiuse(sve_256)))
         return status::unimplemented;
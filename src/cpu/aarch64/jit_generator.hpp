@@ -18,6 +18,7 @@
 #ifndef CPU_AARCH64_JIT_GENERATOR_HPP
 #define CPU_AARCH64_JIT_GENERATOR_HPP
 
+#include <cstring>
 #include <limits.h>
 
 #include "common/bit_cast.hpp"
@@ -26,6 +27,7 @@
 
 #include "cpu/aarch64/cpu_isa_traits.hpp"
 
+#include "cpu/jit_utils/code_arena.hpp"
 #include "cpu/jit_utils/jit_utils.hpp"
 
 #if defined(_WIN32) && !defined(__GNUC__)
@@ -676,7 +678,14 @@ public:
                 (code_ptr == nullptr && use_autogrow) ? Xbyak_aarch64::AutoGrow
                                                       : code_ptr)
         , max_cpu_isa_(max_cpu_isa) {}
-    virtual ~jit_generator() {}
+    virtual ~jit_generator() {
+        // The code generator frees and protects its own buffer only.
+        if (gen_top_) {
+            jit_utils::code_arena::free(top_);
+            top_ = gen_top_;
+            maxSize_ = gen_max_size_;
+        }
+    }
 
     virtual const char *name() const = 0;
     virtual const char *source_file() const = 0;
@@ -703,7 +712,14 @@ public:
 private:
     const cpu_isa_t max_cpu_isa_;
     const uint8_t *getCode() {
-        this->ready();
+        if (move_to_code_arena()) {
+            // The regions of the arena stay executable, only the branches
+            // are patched for the new location.
+            calcJmpAddress();
+            clearCache(top_, top_ + size_);
+        } else {
+            this->ready();
+        }
         if (!is_initialized()) return nullptr;
         const uint8_t *code
                 = reinterpret_cast<const uint8_t *>(CodeGenerator::getCode());
@@ -711,6 +727,24 @@ private:
         return code;
     }
 
+    // Copies the generated code to the code arena. The branches are not
+    // patched yet, so the code is relocatable the same way it is when the
+    // buffer grows. The buffer of the code generator is only released with
+    // the generator since its allocator is not accessible.
+    bool move_to_code_arena() {
+        if (!isAutoGrow() || hasUndefinedLabel()) return false;
+        const size_t size = getSize();
+        auto *code = static_cast<uint32_t *>(
+                jit_utils::code_arena::alloc(size));
+        if (!code) return false;
+        std::memcpy(code, top_, size);
+        gen_top_ = top_;
+        gen_max_size_ = maxSize_;
+        top_ = code;
+        maxSize_ = size_;
+        return true;
+    }
+
     inline bool is_valid_isa(cpu_isa_t isa) {
         return is_subset(isa, max_cpu_isa_) && mayiuse(isa);
     }
@@ -721,6 +755,10 @@ private:
         return true;
     }
 
+    // The buffer of the code generator while the code is in the arena.
+    uint32_t *gen_top_ = nullptr;
+    size_t gen_max_size_ = 0;
+
 protected:
     virtual void generate() = 0;
     const uint8_t *jit_ker_ = nullptr;
@@ -1559,7 +1559,7 @@ void jit_sve_convolution_bwd_weights_t<src_type, diff_dst_type,
             * jcp.kh * jcp.kw;
     /* diff_weights[:] += sum(wei_reduction_[thr_mb][:]) */
     if (dnnl_thr_syncable())
-        simple_barrier::barrier(ti->wei_bia_reduction_bctx, nthr_);
+        simple_barrier::barrier(ti->wei_bia_reduction_bctx, nthr_, ti->ithr);
 
     const int ic_b_kh_work = ti->ic_b_work * jcp.kh;
     const int work = ti->g_work * ti->oc_b_work * ic_b_kh_work;
@@ -1611,7 +1611,7 @@ void jit_sve_convolution_bwd_weights_t<src_type, diff_dst_type,
 
     /* diff_weights[:] += sum(wei_reduction_[thr_mb][:]) */
     if (dnnl_thr_syncable())
-        simple_barrier::barrier(ti->wei_bia_reduction_bctx, nthr_);
+        simple_barrier::barrier(ti->wei_bia_reduction_bctx, nthr_, ti->ithr);
 
     const int ic_b_kh_work = ti->ic_b_work * jcp.kd;
     const int work = ti->g_work * ti->oc_b_work * ic_b_kh_work;
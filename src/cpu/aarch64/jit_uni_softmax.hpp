@@ -167,7 +167,7 @@ struct jit_uni_softmax_bwd_t : public primitive_t {
                                            diff_src_md()->data_type),
                             mayiuse_bf16())
                     && (mayiuse(sve_512) || mayiuse(sve_256))
-                    && attr()->has_default_values()
+                    && attr()->has_default_values() && !hint_with_ws()
                     && set_default_formats() == status::success;
 
             if (!ok) return status::unimplemented;
@@ -28,38 +28,86 @@ using namespace data_type;
 
 namespace {
 using data_t = prec_traits_t<data_type::f32>::type;
-} // namespace
 
-status_t acl_matmul_t::init(engine_t *engine) {
-    auto amp_ = pd()->amp_;
+void configure_acl_obj(
+        acl_matmul_obj_t &acl_obj, const acl_matmul_conf_t &amp) {
     // Configure transpose kernel for src and wei
-    if (amp_.is_transA && !amp_.do_transC) {
-        acl_obj_->transA.configure(&amp_.src_acc_info, &amp_.src_tensor_info);
+    if (amp.is_transA && !amp.do_transC) {
+        acl_obj.transA.configure(&amp.src_acc_info, &amp.src_tensor_info);
     }
-    if (amp_.is_transB && !amp_.do_transC) {
-        acl_obj_->transB.configure(&amp_.wei_acc_info, &amp_.wei_tensor_info);
+    if (amp.is_transB && !amp.do_transC) {
+        acl_obj.transB.configure(&amp.wei_acc_info, &amp.wei_tensor_info);
     }
-    if (amp_.do_transC) {
-        acl_obj_->transC.configure(&amp_.dst_acc_info, &amp_.dst_tensor_info);
+    if (amp.do_transC) {
+        acl_obj.transC.configure(&amp.dst_acc_info, &amp.dst_tensor_info);
     }
     // Configure GEMM
-    if (amp_.do_transC) {
-        acl_obj_->asm_gemm.configure(&amp_.wei_tensor_info,
-                &amp_.src_tensor_info, nullptr, &amp_.dst_acc_info,
-                amp_.gemm_info);
+    if (amp.do_transC) {
+        acl_obj.asm_gemm.configure(&amp.wei_tensor_info, &amp.src_tensor_info,
+                nullptr, &amp.dst_acc_info, amp.gemm_info);
     } else {
-        acl_obj_->asm_gemm.configure(&amp_.src_tensor_info,
-                &amp_.wei_tensor_info, nullptr, &amp_.dst_tensor_info,
-                amp_.gemm_info);
+        acl_obj.asm_gemm.configure(&amp.src_tensor_info, &amp.wei_tensor_info,
+                nullptr, &amp.dst_tensor_info, amp.gemm_info);
     }
-    acl_obj_->aux_mem_req = acl_obj_->asm_gemm.workspace();
-    if (amp_.do_act) {
+    acl_obj.aux_mem_req = acl_obj.asm_gemm.workspace();
+    if (amp.do_act) {
         auto dst_info_to_use
-                = amp_.do_transC ? &amp_.dst_acc_info : &amp_.dst_tensor_info;
-        acl_obj_->act.configure(dst_info_to_use, dst_info_to_use,
-                amp_.gemm_info.activation_info());
+                = amp.do_transC ? &amp.dst_acc_info : &amp.dst_tensor_info;
+        acl_obj.act.configure(dst_info_to_use, dst_info_to_use,
+                amp.gemm_info.activation_info());
     }
+}
+} // namespace
 
+status_t acl_matmul_t::init(engine_t *engine) {
+    configure_acl_obj(*acl_obj_, pd()->amp_);
+    return status::success;
+}
+
+status_t acl_matmul_t::get_cached_weights(
+        const void *wei, acl_matmul_weights_t *&cached, bool &is_new) const {
+    using arm_compute::experimental::MemoryLifetime;
+
+    for (auto it = cached_weights_.begin(); it != cached_weights_.end();
+            ++it) {
+        if (it->wei != wei) continue;
+        cached_weights_.splice(cached_weights_.begin(), cached_weights_, it);
+        cached = &cached_weights_.front();
+        is_new = false;
+        return status::success;
+    }
+
+    if ((int)cached_weights_.size() >= acl_utils::constant_weights_capacity())
+        cached_weights_.pop_back();
+
+    // A new ACL GEMM is configured, since ACL prepares constant weights once
+    // per object.
+    acl_matmul_weights_t entry;
+    entry.wei = wei;
+    entry.obj = utils::make_unique<acl_matmul_obj_t>();
+    if (!entry.obj) return status::out_of_memory;
+    configure_acl_obj(*entry.obj, pd()->amp_);
+
+    constexpr size_t min_alignment = 64;
+    for (const auto &mem : entry.obj->aux_mem_req) {
+        const bool is_kept
+                = mem.lifetime == MemoryLifetime::Persistent && mem.size > 0;
+        const size_t alignment = nstl::max(min_alignment, mem.alignment);
+        entry.workspace.emplace_back(
+                is_kept ? impl::malloc(mem.size, (int)alignment) : nullptr,
+                impl::free);
+        if (is_kept && !entry.workspace.back()) return status::out_of_memory;
+    }
+    if (pd()->amp_.is_transB) {
+        const memory_desc_wrapper wei_d(pd()->weights_md());
+        entry.wei_trans.reset(impl::malloc(
+                wei_d.nelems() * wei_d.data_type_size(), (int)min_alignment));
+        if (!entry.wei_trans) return status::out_of_memory;
+    }
+
+    cached_weights_.push_front(std::move(entry));
+    cached = &cached_weights_.front();
+    is_new = true;
     return status::success;
 }
 
@@ -218,6 +266,22 @@ status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
 
     const auto scratchpad = ctx.get_scratchpad_grantor();
 
+    // The cached weights are only used by non-fixed-format kernels, which run
+    // under the lock.
+    acl_matmul_obj_t *acl_obj = acl_obj_.get();
+    acl_matmul_weights_t *cached = nullptr;
+    bool is_new_wei = true;
+    if (amp.cache_weights) {
+        CHECK(get_cached_weights(wei_base, cached, is_new_wei));
+        acl_obj = cached->obj.get();
+    }
+    void *transB_buf = nullptr;
+    if (is_transB && !do_transC) {
+        transB_buf = cached ? cached->wei_trans.get()
+                            : scratchpad.get<void>(memory_tracking::names::
+                                              key_matmul_wei_trans);
+    }
+
     arm_compute::Tensor src_tensor;
     arm_compute::Tensor wei_tensor;
     arm_compute::Tensor bia_tensor = nullptr;
@@ -248,7 +312,7 @@ status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
                 arm_compute::TensorType::ACL_SRC, &src_acc_tensor);
         transpose_pack.add_tensor(
                 arm_compute::TensorType::ACL_DST, &src_tensor);
-        acl_obj_->transA.run(transpose_pack);
+        acl_obj->transA.run(transpose_pack);
         wei_tensor.allocator()->import_memory(const_cast<data_t *>(wei_base));
         src_acc_tensor.allocator()->free();
     } else if (is_transB && !is_transA) {
@@ -256,15 +320,13 @@ status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
         wei_acc_tensor.allocator()->init(amp.wei_acc_info);
         wei_acc_tensor.allocator()->import_memory(
                 const_cast<data_t *>(wei_base));
-        auto transB_scratch = scratchpad.get<void>(
-                memory_tracking::names::key_matmul_wei_trans);
-        wei_tensor.allocator()->import_memory(transB_scratch);
+        wei_tensor.allocator()->import_memory(transB_buf);
         arm_compute::ITensorPack transpose_pack;
         transpose_pack.add_tensor(
                 arm_compute::TensorType::ACL_SRC, &wei_acc_tensor);
         transpose_pack.add_tensor(
                 arm_compute::TensorType::ACL_DST, &wei_tensor);
-        acl_obj_->transB.run(transpose_pack);
+        if (is_new_wei) acl_obj->transB.run(transpose_pack);
         src_tensor.allocator()->import_memory(const_cast<data_t *>(src_base));
         wei_acc_tensor.allocator()->free();
     } else if (is_transA && is_transB && !do_transC) {
@@ -278,10 +340,8 @@ status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
                 const_cast<data_t *>(wei_base));
         auto transA_scratch = scratchpad.get<void>(
                 memory_tracking::names::key_matmul_src_trans);
-        auto transB_scratch = scratchpad.get<void>(
-                memory_tracking::names::key_matmul_wei_trans);
         src_tensor.allocator()->import_memory(transA_scratch);
-        wei_tensor.allocator()->import_memory(transB_scratch);
+        wei_tensor.allocator()->import_memory(transB_buf);
         arm_compute::ITensorPack transpose_packA;
         transpose_packA.add_tensor(
                 arm_compute::TensorType::ACL_SRC, &src_acc_tensor);
@@ -292,8 +352,8 @@ status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
                 arm_compute::TensorType::ACL_SRC, &wei_acc_tensor);
         transpose_packB.add_tensor(
                 arm_compute::TensorType::ACL_DST, &wei_tensor);
-        acl_obj_->transA.run(transpose_packA);
-        acl_obj_->transB.run(transpose_packB);
+        acl_obj->transA.run(transpose_packA);
+        if (is_new_wei) acl_obj->transB.run(transpose_packB);
         src_acc_tensor.allocator()->free();
         wei_acc_tensor.allocator()->free();
     } else {
@@ -326,34 +386,36 @@ status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
     }
 
     // Get pointer to scratchpad memory and create a workspace tensor for
-    // CpuGemmAssemblyDispatch.
-    std::vector<arm_compute::Tensor> tmp_tensors(acl_obj_->aux_mem_req.size());
+    // CpuGemmAssemblyDispatch. The persistent workspace of cached weights
+    // holds the weights pretransposed by the first run of the GEMM.
+    const auto &aux_mem_req = acl_obj->aux_mem_req;
+    std::vector<arm_compute::Tensor> tmp_tensors(aux_mem_req.size());
     for (const auto &key : matmul_keys) {
         const auto id = key.first;
-        if (acl_obj_->aux_mem_req[id].size > 0) {
+        if (aux_mem_req[id].size > 0) {
             auto info = arm_compute::TensorInfo(
-                    arm_compute::TensorShape(acl_obj_->aux_mem_req[id].size), 1,
+                    arm_compute::TensorShape(aux_mem_req[id].size), 1,
                     arm_compute::DataType::U8);
 
-            auto *buffer = scratchpad.get<void>(key.second);
+            auto *buffer = cached && cached->workspace[id]
+                    ? cached->workspace[id].get()
+                    : scratchpad.get<void>(key.second);
 
-            tmp_tensors[id].allocator()->init(
-                    info, acl_obj_->aux_mem_req[id].alignment);
+            tmp_tensors[id].allocator()->init(info, aux_mem_req[id].alignment);
             tmp_tensors[id].allocator()->import_memory(buffer);
 
-            matmul_pack.add_tensor(
-                    acl_obj_->aux_mem_req[id].slot, &tmp_tensors[id]);
+            matmul_pack.add_tensor(aux_mem_req[id].slot, &tmp_tensors[id]);
         }
     }
 
-    acl_obj_->asm_gemm.run(matmul_pack);
+    acl_obj->asm_gemm.run(matmul_pack);
 
     if (do_act) {
         auto dst_to_use = do_transC ? &dst_acc_tensor : &dst_tensor;
         arm_compute::ITensorPack act_pack;
         act_pack.add_tensor(arm_compute::TensorType::ACL_SRC, dst_to_use);
         act_pack.add_tensor(arm_compute::TensorType::ACL_DST, dst_to_use);
-        acl_obj_->act.run(act_pack);
+        acl_obj->act.run(act_pack);
     }
 
     if (do_transC) {
@@ -362,7 +424,7 @@ status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
                 arm_compute::TensorType::ACL_SRC, &dst_acc_tensor);
         transpose_packC.add_tensor(
                 arm_compute::TensorType::ACL_DST, &dst_tensor);
-        acl_obj_->transC.run(transpose_packC);
+        acl_obj->transC.run(transpose_packC);
     }
 
     void *dst = dst_tensor.buffer();
@@ -21,6 +21,7 @@
 #include "cpu/aarch64/matmul/acl_matmul_utils.hpp"
 #include "cpu/matmul/cpu_matmul_pd.hpp"
 
+#include <list>
 #include <mutex>
 
 namespace dnnl {
@@ -59,10 +60,18 @@ private:
     template <bool IsFixedFormat>
     status_t execute_forward(const exec_ctx_t &ctx) const;
 
+    // Returns the ACL objects and buffers of the weights, which are created,
+    // with the least recently used weights evicted, if the weights are not
+    // cached. Then is_new is set and the weights have to be transformed.
+    status_t get_cached_weights(const void *wei,
+            acl_matmul_weights_t *&cached, bool &is_new) const;
+
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<acl_matmul_obj_t> acl_obj_;
     mutable std::mutex mtx_;
+    // The most recently used weights come first. Guarded by mtx_.
+    mutable std::list<acl_matmul_weights_t> cached_weights_;
 }; // acl_matmul_t
 
 } // namespace matmul
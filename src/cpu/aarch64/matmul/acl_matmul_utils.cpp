@@ -124,13 +124,19 @@ status_t init_conf_matmul(acl_matmul_conf_t &amp, memory_desc_t &src_md,
         amp.wei_tensor_info = arm_compute::TensorInfo(
                 arm_compute::TensorShape(K, N, 1, wei_batch), 1,
                 acl_wei_data_t);
+        amp.cache_weights = false;
     } else {
         amp.src_tensor_info = arm_compute::TensorInfo(
                 arm_compute::TensorShape(K, M, 1, src_batch), 1,
                 acl_src_data_t);
         amp.wei_tensor_info = arm_compute::TensorInfo(
                 arm_compute::TensorShape(N, K, wei_batch), 1, acl_wei_data_t);
-        amp.wei_tensor_info.set_are_values_constant(false);
+        // ACL pretransposes constant weights only once, so they are declared
+        // constant only if the primitive keeps them with the ACL objects that
+        // prepared them. Fixed format weights are not transformed by ACL.
+        amp.cache_weights = !IsFixedFormat
+                && acl_utils::constant_weights_capacity() > 0;
+        amp.wei_tensor_info.set_are_values_constant(amp.cache_weights);
     }
 
     amp.dst_tensor_info = arm_compute::TensorInfo(
@@ -204,6 +210,13 @@ status_t init_scratchpad(memory_tracking::registrar_t &scratchpad,
     if (aux_mem_req.size() != 0) {
         for (const auto &key : matmul_keys) {
             const auto id = key.first;
+            // The persistent workspace of cached weights is kept by the
+            // primitive.
+            if (amp.cache_weights
+                    && aux_mem_req[id].lifetime
+                            == arm_compute::experimental::MemoryLifetime::
+                                    Persistent)
+                continue;
             if (aux_mem_req[id].size > 0) {
                 scratchpad.book(key.second, aux_mem_req[id].size, 1,
                         aux_mem_req[id].alignment, aux_mem_req[id].alignment);
@@ -215,7 +228,7 @@ status_t init_scratchpad(memory_tracking::registrar_t &scratchpad,
         scratchpad.book(memory_tracking::names::key_matmul_src_trans,
                 src_d.nelems(), src_d.data_type_size());
     }
-    if (amp.is_transB) {
+    if (amp.is_transB && !amp.cache_weights) {
         const memory_desc_wrapper wei_d(&weights_md);
         scratchpad.book(memory_tracking::names::key_matmul_wei_trans,
                 wei_d.nelems(), wei_d.data_type_size());
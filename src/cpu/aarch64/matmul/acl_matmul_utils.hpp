@@ -17,11 +17,14 @@
 #ifndef CPU_AARCH64_MATMUL_ACL_MATMUL_UTILS_HPP
 #define CPU_AARCH64_MATMUL_ACL_MATMUL_UTILS_HPP
 
+#include <vector>
+
 #include "arm_compute/runtime/experimental/low_level/CpuGemmAssemblyDispatch.h"
 #include "arm_compute/runtime/experimental/operators/CpuActivation.h"
 #include "arm_compute/runtime/experimental/operators/CpuTranspose.h"
 
 #include "common/memory_tracking.hpp"
+#include "common/utils.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -49,6 +52,20 @@ struct acl_matmul_obj_t {
     arm_compute::experimental::MemoryRequirements aux_mem_req;
 };
 
+using acl_buffer_t = std::unique_ptr<void, void (*)(void *)>;
+
+// ACL objects prepared for a weights buffer, with the buffers holding the
+// weights transformed for them across executions.
+struct acl_matmul_weights_t {
+    const void *wei = nullptr;
+    std::unique_ptr<acl_matmul_obj_t> obj;
+    // The transposed weights, if the weights are transposed.
+    acl_buffer_t wei_trans {nullptr, impl::free};
+    // The persistent workspace of the GEMM, which holds the pretransposed
+    // weights, indexed by the workspace id. The other ids are null.
+    std::vector<acl_buffer_t> workspace;
+};
+
 struct acl_matmul_conf_t {
     bool is_transA;
     bool is_transB;
@@ -57,6 +74,9 @@ struct acl_matmul_conf_t {
     // If this is true, the result of the matmul goes into a temporarily
     // allocated ACL tensor to be accumulated into the oneDNN dst during postops
     bool use_dst_acc_for_sum;
+    // If this is true, the weights are declared constant to ACL and the
+    // weights transformed for a weights buffer are kept by the primitive
+    bool cache_weights;
     arm_compute::TensorInfo src_tensor_info;
     arm_compute::TensorInfo wei_tensor_info;
     arm_compute::TensorInfo dst_tensor_info;
@@ -0,0 +1,172 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_ARG_REDUCTION_UTILS_HPP
+#define CPU_ARG_REDUCTION_UTILS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/nstl.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace arg_reduction_utils {
+
+// The number of values converted to f32 and pushed at once.
+constexpr dim_t block_size = 64;
+
+// Converts `len` values of type `dt` starting at `off` to f32, negated when
+// the smallest values are selected.
+inline void load_values(float *vals, const void *src, data_type_t dt,
+        dim_t off, dim_t len, bool negate) {
+    using namespace data_type;
+    switch (dt) {
+        case f32: {
+            const float *s = static_cast<const float *>(src) + off;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; i++)
+                vals[i] = s[i];
+        } break;
+        case bf16:
+            cvt_bfloat16_to_float(
+                    vals, static_cast<const bfloat16_t *>(src) + off, len);
+            break;
+        case f16:
+            cvt_float16_to_float(
+                    vals, static_cast<const float16_t *>(src) + off, len);
+            break;
+        case s32: {
+            const int32_t *s = static_cast<const int32_t *>(src) + off;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; i++)
+                vals[i] = static_cast<float>(s[i]);
+        } break;
+        case s8: {
+            const int8_t *s = static_cast<const int8_t *>(src) + off;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; i++)
+                vals[i] = static_cast<float>(s[i]);
+        } break;
+        case u8: {
+            const uint8_t *s = static_cast<const uint8_t *>(src) + off;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; i++)
+                vals[i] = static_cast<float>(s[i]);
+        } break;
+        default: assert(!"unsupported data type");
+    }
+    if (negate) {
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < len; i++)
+            vals[i] = -vals[i];
+    }
+}
+
+// Keeps the `k` best values seen so far with their indices. A value is better
+// than another one when it is larger, or equal and has a smaller index, so the
+// result does not depend on the order values are pushed in. The smallest
+// values are selected by pushing negated values. NaN values are selected last.
+struct top_k_t {
+    top_k_t(dim_t k) : k_(k) { heap_.reserve(k); }
+
+    bool full() const { return size() == k_; }
+    dim_t size() const { return static_cast<dim_t>(heap_.size()); }
+
+    // The worst kept value. Once `k` values are kept, a value that is not
+    // larger than the threshold and comes after the kept ones is not better.
+    float threshold() const { return heap_.front().val; }
+
+    void push(float val, dim_t idx) {
+        const entry_t e {std::isnan(val) ? -INFINITY : val, idx};
+        if (!full()) {
+            heap_.push_back(e);
+            std::push_heap(heap_.begin(), heap_.end(), better);
+            return;
+        }
+        if (!better(e, heap_.front())) return;
+        std::pop_heap(heap_.begin(), heap_.end(), better);
+        heap_.back() = e;
+        std::push_heap(heap_.begin(), heap_.end(), better);
+    }
+
+    // Pushes `len` values with consecutive indices starting at `idx`. Once
+    // `k` values are kept, a block with no value above the threshold is
+    // skipped, which requires the indices to grow from one call to another.
+    void push_block(const float *vals, dim_t len, dim_t idx) {
+        if (full()) {
+            float vmax = -INFINITY;
+            PRAGMA_OMP_SIMD(reduction(max : vmax))
+            for (dim_t i = 0; i < len; i++)
+                vmax = nstl::max(vmax, vals[i]);
+            if (!(vmax > threshold())) return;
+        }
+        for (dim_t i = 0; i < len; i++)
+            push(vals[i], idx + i);
+    }
+
+    void merge(const top_k_t &other) {
+        for (const auto &e : other.heap_)
+            push(e.val, e.idx);
+    }
+
+    // Orders the kept values from the best to the worst. No value may be
+    // pushed after that.
+    void sort() { std::sort(heap_.begin(), heap_.end(), better); }
+
+    // Writes the indices from the best to the worst value.
+    void get_indices(int32_t *indices, dim_t stride = 1) {
+        sort();
+        for (size_t i = 0; i < heap_.size(); i++)
+            indices[i * stride] = static_cast<int32_t>(heap_[i].idx);
+    }
+
+    // Writes the kept values and their indices in the heap order, or from
+    // the best to the worst value after sort().
+    void get(float *vals, int32_t *indices) const {
+        for (size_t i = 0; i < heap_.size(); i++) {
+            vals[i] = heap_[i].val;
+            indices[i] = static_cast<int32_t>(heap_[i].idx);
+        }
+    }
+
+private:
+    struct entry_t {
+        float val;
+        dim_t idx;
+    };
+
+    // The heap keeps the worst value at the front.
+    static bool better(const entry_t &a, const entry_t &b) {
+        return a.val > b.val || (a.val == b.val && a.idx < b.idx);
+    }
+
+    dim_t k_;
+    std::vector<entry_t> heap_;
+};
+
+} // namespace arg_reduction_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
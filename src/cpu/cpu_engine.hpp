@@ -23,9 +23,12 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/engine.hpp"
 #include "common/engine_id.hpp"
 #include "common/impl_list_item.hpp"
+#include "common/sdpa_types.hpp"
+#include "common/utils.hpp"
 
 #include "cpu/platform.hpp"
 
@@ -46,6 +49,8 @@
     DNNL_AARCH64_ACL_ONLY(CPU_INSTANCE(__VA_ARGS__))
 #define CPU_INSTANCE_RV64GCV(...) DNNL_RV64GCV_ONLY(CPU_INSTANCE(__VA_ARGS__))
 #define CPU_INSTANCE_PPC64(...) DNNL_PPC64_ONLY(CPU_INSTANCE(__VA_ARGS__))
+#define CPU_INSTANCE_S390X_VXE(...) \
+    DNNL_S390X_VXE_ONLY(CPU_INSTANCE(__VA_ARGS__))
 
 namespace dnnl {
 namespace impl {
@@ -59,6 +64,7 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(embedding_bag);
 DECLARE_IMPL_LIST(group_normalization);
 DECLARE_IMPL_LIST(inner_product);
 DECLARE_IMPL_LIST(layer_normalization);
@@ -69,6 +75,7 @@ DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
 DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
+DECLARE_IMPL_LIST(sdpa);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax);
 
@@ -95,6 +102,7 @@ public:
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
             CASE(group_normalization);
             CASE(inner_product);
             CASE(layer_normalization);
@@ -105,9 +113,9 @@ public:
             CASE(reduction);
             CASE(resampling);
             CASE(rnn);
+            CASE(sdpa);
             CASE(shuffle);
             CASE(softmax);
-            case primitive_kind::sdpa: return empty_list;
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
@@ -157,6 +165,15 @@ public:
         *engine = new cpu_engine_t(new impl::engine_impl_t(
                 engine_kind::cpu, get_cpu_native_runtime(), 0));
 
+        // The cores of hybrid CPUs run at different speeds, so that the work
+        // of parallel_nd() is split dynamically.
+        if (platform::is_hybrid()) parallel_nd_is_dynamic() = true;
+
+        // Small memory bound primitives use the threads their work is worth.
+        static const bool nthr_by_work
+                = getenv_int_user("CPU_WORK_BASED_NTHR", 1) != 0;
+        nthr_by_work_is_enabled() = nthr_by_work;
+
 #if DNNL_AARCH64 && defined(DNNL_AARCH64_USE_ACL)
         dnnl::impl::cpu::aarch64::acl_thread_utils::set_acl_threading();
 #endif
@@ -23,8 +23,12 @@
 #include "common/memory.hpp"
 #include "common/memory_storage.hpp"
 #include "common/stream.hpp"
+#include "common/stream_memory_pool.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/file_mapping.hpp"
+#include "cpu/huge_pages.hpp"
+#include "cpu/numa.hpp"
 #include "cpu/platform.hpp"
 
 namespace dnnl {
@@ -35,7 +39,9 @@ class cpu_memory_storage_t : public memory_storage_t {
 public:
     cpu_memory_storage_t(engine_t *engine)
         : memory_storage_t(engine), data_(nullptr, release) {}
-    ~cpu_memory_storage_t() override = default;
+    ~cpu_memory_storage_t() override {
+        if (stream_pool_) stream_pool_->release(stream_pool_ptr_);
+    }
 
     status_t get_data_handle(void **handle) const override {
         *handle = data_.get();
@@ -70,6 +76,31 @@ public:
 
     bool is_host_accessible() const override { return true; }
 
+    // Uses a range of a file as the buffer, which is unmapped with the
+    // storage.
+    status_t init_file_mapping(
+            int fd, size_t offset, size_t size, unsigned flags) {
+        void *ptr = nullptr;
+        CHECK(file_mapping::map(&ptr, fd, offset, size, flags));
+        data_ = decltype(data_)(ptr, destroy_file_mapping);
+        return status::success;
+    }
+
+    // Takes the buffer from the arena of a stream, to which it is returned in
+    // stream order with the storage.
+    status_t init_from_stream_pool(
+            const std::shared_ptr<stream_memory_pool_t> &pool, size_t size) {
+        const int alignment = platform::get_cache_line_size();
+        void *ptr = pool->acquire(
+                size, [=](size_t s) { return malloc(s, alignment); },
+                [](void *p) { free(p); });
+        if (!ptr && size > 0) return status::out_of_memory;
+        data_ = decltype(data_)(ptr, release);
+        stream_pool_ = pool;
+        stream_pool_ptr_ = ptr;
+        return status::success;
+    }
+
     std::unique_ptr<memory_storage_t> get_sub_storage(
             size_t offset, size_t size) const override {
         void *sub_ptr = reinterpret_cast<uint8_t *>(data_.get()) + offset;
@@ -87,19 +118,33 @@ public:
 
 protected:
     status_t init_allocate(size_t size) override {
-        void *ptr = malloc(size, platform::get_cache_line_size());
-        if (!ptr) return status::out_of_memory;
-        data_ = decltype(data_)(ptr, destroy);
+        // Large buffers go to huge pages when requested by the user; regular
+        // allocation is the fallback.
+        void *ptr = huge_pages::malloc(size);
+        if (ptr) {
+            data_ = decltype(data_)(ptr, destroy_huge_pages);
+        } else {
+            ptr = malloc(size, platform::get_cache_line_size());
+            if (!ptr) return status::out_of_memory;
+            data_ = decltype(data_)(ptr, destroy);
+        }
+        // The placement must be set before the pages are touched for the
+        // first time.
+        numa::apply_policy(ptr, size);
         return status::success;
     }
 
 private:
     std::unique_ptr<void, void (*)(void *)> data_;
+    std::shared_ptr<stream_memory_pool_t> stream_pool_;
+    void *stream_pool_ptr_ = nullptr;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_memory_storage_t);
 
     static void release(void *ptr) {}
     static void destroy(void *ptr) { free(ptr); }
+    static void destroy_huge_pages(void *ptr) { huge_pages::free(ptr); }
+    static void destroy_file_mapping(void *ptr) { file_mapping::unmap(ptr); }
 };
 
 } // namespace cpu
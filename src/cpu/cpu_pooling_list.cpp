@@ -19,6 +19,7 @@
 #include "cpu/cpu_engine.hpp"
 
 #include "cpu/nchw_pooling.hpp"
+#include "cpu/nhwc_adaptive_pooling.hpp"
 #include "cpu/nhwc_pooling.hpp"
 #include "cpu/ref_pooling.hpp"
 
@@ -52,6 +53,12 @@ using namespace dnnl::impl::prop_kind;
 const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
     static const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> the_map = REG_POOLING_P({
         {{forward}, {
+            /* adaptive and global */
+            CPU_INSTANCE(nhwc_adaptive_pooling_fwd_t<f32>)
+            CPU_INSTANCE(nhwc_adaptive_pooling_fwd_t<bf16>)
+            CPU_INSTANCE(nhwc_adaptive_pooling_fwd_t<f16>)
+            CPU_INSTANCE(nhwc_adaptive_pooling_fwd_t<s8>)
+            CPU_INSTANCE(nhwc_adaptive_pooling_fwd_t<u8>)
             /* fp */
             CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx512_core_fp16, f16>)
             CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx512_core_fp16, f8_e5m2>)
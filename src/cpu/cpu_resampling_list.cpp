@@ -16,6 +16,7 @@
 
 #include "cpu/cpu_engine.hpp"
 
+#include "cpu/nspc_separable_resampling.hpp"
 #include "cpu/ref_resampling.hpp"
 #include "cpu/simple_resampling.hpp"
 
@@ -38,6 +39,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
     static std::map<pk_impl_key_t, std::vector<impl_list_item_t>> the_map = REG_RESAMPLING_P({
         {{forward}, {
             CPU_INSTANCE_X64(jit_uni_resampling_fwd_t)
+            CPU_INSTANCE(nspc_separable_resampling_fwd_t)
             CPU_INSTANCE(simple_resampling_fwd_t)
             CPU_INSTANCE(ref_resampling_fwd_t)
             nullptr,
@@ -29,6 +29,14 @@ using namespace dnnl::impl::cpu::x64;
 #include "cpu/aarch64/acl_softmax.hpp"
 #endif
 using namespace dnnl::impl::cpu::aarch64;
+#elif DNNL_RV64
+#if DNNL_RISCV_USE_RVV_INTRINSICS
+#include "cpu/rv64/rvv_softmax.hpp"
+using namespace dnnl::impl::cpu::rv64;
+#endif // DNNL_RISCV_USE_RVV_INTRINSICS
+#elif DNNL_S390X
+#include "cpu/s390x/vx_softmax.hpp"
+using namespace dnnl::impl::cpu::s390x;
 #endif
 
 namespace dnnl {
@@ -48,6 +56,8 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_AARCH64(jit_uni_softmax_fwd_t<sve_256>)
             CPU_INSTANCE_AARCH64(jit_uni_softmax_fwd_t<sve_128>)
             CPU_INSTANCE_AARCH64_ACL(acl_softmax_fwd_t)
+            CPU_INSTANCE_RV64GCV(rvv_softmax_fwd_t)
+            CPU_INSTANCE_S390X_VXE(vx_softmax_fwd_t)
             CPU_INSTANCE(ref_softmax_fwd_t)
             nullptr,
         }},
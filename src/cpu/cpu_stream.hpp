@@ -25,7 +25,13 @@
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/primitive_iface.hpp"
 #include "common/stream.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_stream_affinity.hpp"
+#include "cpu/cpu_stream_executor.hpp"
+#include "cpu/cpu_stream_profiler.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -33,18 +39,88 @@ namespace cpu {
 
 struct cpu_stream_t : public stream_t {
     cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl)
-        : stream_t(engine, stream_impl) {}
+        : stream_t(engine, stream_impl) {
+        if (is_profiling_enabled())
+            profiler_ = utils::make_unique<cpu_stream_profiler_t>();
+    }
     ~cpu_stream_t() override = default;
 
     dnnl::impl::status_t wait() override {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        // The executions submitted from a task run on the executor thread
+        // right away, so they are completed already.
+        if (executor_ && !executor_->is_executor_thread())
+            return executor_->wait();
+#endif
         // CPU execution is synchronous so return immediately
         return dnnl::impl::status::success;
     }
 
+    status_t enqueue_primitive(const primitive_iface_t *primitive_iface,
+            exec_ctx_t &ctx) override {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        if (executor_ && !executor_->is_executor_thread()) {
+            // The context of the caller goes out of scope on return, and the
+            // primitive may be destroyed by the user before the execution.
+            auto *p = const_cast<primitive_iface_t *>(primitive_iface);
+            p->retain();
+            executor_->submit([this, p, ctx]() mutable {
+                status_t status = execute(p, ctx);
+                p->release();
+                return status;
+            });
+            return status::success;
+        }
+#endif
+        return execute(primitive_iface, ctx);
+    }
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    status_t enqueue_host_task(std::function<status_t()> &&task) override {
+        if (executor_ && !executor_->is_executor_thread()) {
+            executor_->submit(std::move(task));
+            return status::success;
+        }
+        return task();
+    }
+#endif
+
+    status_t set_cpu_affinity(int ncpus, const int *cpus) override {
+        return affinity_.init(ncpus, cpus);
+    }
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    status_t zero_pad(
+            const memory_t *memory, const exec_ctx_t &ctx) override {
+        // Zero padding runs on the calling thread, hence it has to be ordered
+        // after the enqueued executions.
+        CHECK(wait());
+        return stream_t::zero_pad(memory, ctx);
+    }
+#endif
+
+    status_t reset_profiling() override {
+        if (!profiler_) return status::invalid_arguments;
+        profiler_->reset();
+        return status::success;
+    }
+
+    status_t get_profiling_data(profiling_data_kind_t data_kind,
+            int *num_entries, uint64_t *data) const override {
+        if (!profiler_) return status::invalid_arguments;
+        return profiler_->get_info(data_kind, num_entries, data);
+    }
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     cpu_stream_t(engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
-        : stream_t(engine, new impl::stream_impl_t(threadpool)) {}
+        : stream_t(engine, new impl::stream_impl_t(threadpool)) {
+        using namespace dnnl::threadpool_interop;
+        if (threadpool
+                && (threadpool->get_flags()
+                        & threadpool_iface::NON_BLOCKING_EXECUTE))
+            executor_ = utils::make_unique<cpu_stream_executor_t>(threadpool);
+    }
 
     void before_exec_hook() override {
         dnnl::threadpool_interop::threadpool_iface *tp;
@@ -56,6 +132,26 @@ struct cpu_stream_t : public stream_t {
         threadpool_utils::deactivate_threadpool();
     }
 #endif
+
+private:
+    status_t execute(const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+        return affinity_.execute([&]() {
+            if (!profiler_)
+                return stream_t::enqueue_primitive(primitive_iface, ctx);
+            profiler_->start_profiling();
+            status_t status = stream_t::enqueue_primitive(primitive_iface, ctx);
+            profiler_->stop_profiling();
+            return status;
+        });
+    }
+
+    std::unique_ptr<cpu_stream_profiler_t> profiler_;
+    cpu_stream_affinity_t affinity_;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    // Declared last to complete the enqueued executions, which use the
+    // members above, before they are destroyed.
+    std::unique_ptr<cpu_stream_executor_t> executor_;
+#endif
 };
 
 } // namespace cpu
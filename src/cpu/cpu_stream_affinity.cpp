@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "common/utils.hpp"
+
+#include "cpu/cpu_stream_affinity.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+cpu_stream_affinity_t::~cpu_stream_affinity_t() = default;
+
+status_t cpu_stream_affinity_t::init(int ncpus, const int *cpus) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    for (int i = 0; i < ncpus; i++)
+        if (cpus[i] < 0) return status::invalid_arguments;
+
+    cpus_.assign(cpus, cpus + ncpus);
+    static std::atomic<uint64_t> next_id {1};
+    id_ = next_id++;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    arena_.reset(ncpus > 0 ? new tbb::task_arena(ncpus) : nullptr);
+#endif
+    return status::success;
+#else
+    MAYBE_UNUSED(ncpus);
+    MAYBE_UNUSED(cpus);
+    return status::unimplemented;
+#endif
+}
+
+status_t cpu_stream_affinity_t::execute(
+        const std::function<status_t()> &f) const {
+    if (!is_set()) return f();
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // The number of threads is an attribute of the calling thread in OpenMP,
+    // so the streams used by other threads are not affected.
+    const int saved_nthr = omp_get_max_threads();
+    omp_set_num_threads((int)cpus_.size());
+    bind_threads();
+    const status_t status = f();
+    omp_set_num_threads(saved_nthr);
+    return status;
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    status_t status = status::success;
+    arena_->execute([&]() { status = f(); });
+    return status;
+#else
+    return f();
+#endif
+}
+
+void cpu_stream_affinity_t::bind_threads() const {
+#if defined(__linux__) && DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // An OpenMP runtime reuses the team of a thread, so the binding only
+    // needs to be redone when the calling thread executes on a stream with
+    // another CPU set.
+    static thread_local uint64_t bound_id = 0;
+    if (bound_id == id_) return;
+
+    const int nthr = (int)cpus_.size();
+    parallel(nthr, [&](int ithr, int) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (cpus_[ithr] < CPU_SETSIZE) CPU_SET(cpus_[ithr], &set);
+        // Failures are ignored: the execution is correct without binding.
+        sched_setaffinity(0, sizeof(set), &set);
+    });
+    bound_id = id_;
+#endif
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_STREAM_AFFINITY_HPP
+#define CPU_CPU_STREAM_AFFINITY_HPP
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Restricts the primitive executions on a CPU stream to a set of logical
+// CPUs. The executions use as many threads as there are CPUs in the set:
+// - with OpenMP, the number of threads of the calling thread is set for the
+//   duration of an execution and thread `i` of the team is bound to the i-th
+//   CPU of the set (Linux only),
+// - with TBB, the executions run in a task arena of the set size; the
+//   binding is left to the TBB scheduler.
+// Other threading runtimes are not supported.
+struct cpu_stream_affinity_t {
+    cpu_stream_affinity_t() = default;
+    ~cpu_stream_affinity_t();
+
+    status_t init(int ncpus, const int *cpus);
+    bool is_set() const { return !cpus_.empty(); }
+
+    status_t execute(const std::function<status_t()> &f) const;
+
+private:
+    void bind_threads() const;
+
+    std::vector<int> cpus_;
+    // Identifies the set the threads are bound to, see bind_threads().
+    uint64_t id_ = 0;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    std::unique_ptr<tbb::task_arena> arena_;
+#endif
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_stream_affinity_t);
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
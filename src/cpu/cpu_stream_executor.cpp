@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_stream_executor.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+cpu_stream_executor_t::cpu_stream_executor_t(
+        threadpool_interop::threadpool_iface *threadpool)
+    : threadpool_(threadpool), thread_([this]() { run(); }) {}
+
+cpu_stream_executor_t::~cpu_stream_executor_t() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_stopped_ = true;
+    }
+    task_cv_.notify_one();
+    // The remaining tasks are completed before the thread exits.
+    thread_.join();
+}
+
+void cpu_stream_executor_t::submit(task_t &&task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+    task_cv_.notify_one();
+}
+
+status_t cpu_stream_executor_t::wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this]() { return tasks_.empty() && !is_busy_; });
+    const status_t status = status_;
+    status_ = status::success;
+    return status;
+}
+
+void cpu_stream_executor_t::run() {
+    threadpool_utils::activate_threadpool(threadpool_);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        task_cv_.wait(lock, [this]() { return !tasks_.empty() || is_stopped_; });
+        if (tasks_.empty()) break;
+
+        task_t task = std::move(tasks_.front());
+        tasks_.pop_front();
+        is_busy_ = true;
+        lock.unlock();
+
+        const status_t status = task();
+
+        lock.lock();
+        is_busy_ = false;
+        if (status_ == status::success) status_ = status;
+        if (tasks_.empty()) done_cv_.notify_all();
+    }
+
+    threadpool_utils::deactivate_threadpool();
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_STREAM_EXECUTOR_HPP
+#define CPU_CPU_STREAM_EXECUTOR_HPP
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Runs the tasks submitted by a non-blocking threadpool stream in order on a
+// dedicated thread. The thread is not a threadpool worker, so `parallel()`
+// called from a task distributes the work over the threadpool as it would on
+// the user thread.
+struct cpu_stream_executor_t {
+    using task_t = std::function<status_t()>;
+
+    cpu_stream_executor_t(threadpool_interop::threadpool_iface *threadpool);
+    ~cpu_stream_executor_t();
+
+    void submit(task_t &&task);
+
+    // Blocks until all submitted tasks are completed. Returns the first error
+    // reported by a task since the previous call.
+    status_t wait();
+
+    // Returns true when called from a task.
+    bool is_executor_thread() const {
+        return std::this_thread::get_id() == thread_.get_id();
+    }
+
+private:
+    void run();
+
+    threadpool_interop::threadpool_iface *threadpool_;
+
+    std::mutex mutex_;
+    std::condition_variable task_cv_;
+    std::condition_variable done_cv_;
+    std::deque<task_t> tasks_;
+    bool is_busy_ = false;
+    bool is_stopped_ = false;
+    status_t status_ = status::success;
+
+    // Started last as it uses the members above.
+    std::thread thread_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_stream_executor_t);
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/utils.hpp"
+
+#include "cpu/cpu_stream_profiler.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+void cpu_stream_profiler_t::start_profiling() {
+    m_.lock();
+    // An execution nested into another one on the same stream is accounted
+    // as a part of the outer execution.
+    if (depth_++ > 0) return;
+
+    region_.reset();
+    // Restored on stop in case a profiled execution on another stream is
+    // in progress on this thread.
+    saved_region_ = parallel_profiler::active_region();
+    parallel_profiler::active_region() = &region_;
+    start_ns_ = parallel_profiler::get_time_ns();
+}
+
+void cpu_stream_profiler_t::stop_profiling() {
+    if (--depth_ > 0) {
+        m_.unlock();
+        return;
+    }
+
+    const uint64_t time_ns = parallel_profiler::get_time_ns() - start_ns_;
+    parallel_profiler::active_region() = saved_region_;
+    if (saved_region_) saved_region_->add(region_);
+
+    // The calling thread is busy outside of parallel regions as well.
+    const uint64_t serial_ns
+            = time_ns - nstl::min(time_ns, region_.parallel_time_ns);
+    entries_.push_back(
+            {time_ns, region_.thread_time_ns + serial_ns, region_.max_nthr});
+    m_.unlock();
+}
+
+void cpu_stream_profiler_t::reset() {
+    std::lock_guard<std::recursive_mutex> lock(m_);
+    entries_.clear();
+}
+
+status_t cpu_stream_profiler_t::get_info(profiling_data_kind_t data_kind,
+        int *num_entries, uint64_t *data) const {
+    if (!num_entries) return status::invalid_arguments;
+
+    std::lock_guard<std::recursive_mutex> lock(m_);
+    if (!data) {
+        *num_entries = (int)entries_.size();
+        return status::success;
+    }
+
+    for (size_t i = 0; i < entries_.size(); i++) {
+        const auto &e = entries_[i];
+        switch ((int)data_kind) {
+            case profiling_data_kind::time: data[i] = e.time_ns; break;
+            case profiling_data_kind::thread_time:
+                data[i] = e.thread_time_ns;
+                break;
+            case profiling_data_kind::nthr: data[i] = (uint64_t)e.nthr; break;
+            default: return status::invalid_arguments;
+        }
+    }
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_STREAM_PROFILER_HPP
+#define CPU_CPU_STREAM_PROFILER_HPP
+
+#include <mutex>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/parallel_profiler.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Collects an entry per primitive execution on a CPU stream. CPU execution is
+// synchronous, so an entry is complete by the time the execution returns.
+struct cpu_stream_profiler_t {
+    struct entry_t {
+        uint64_t time_ns; // wall time of the execution
+        uint64_t thread_time_ns; // total time all threads were busy
+        int nthr; // largest number of threads used by a parallel region
+    };
+
+    // The calls are expected to be paired around a primitive execution. The
+    // lock is held in between, so that executions submitted to the same
+    // stream from different threads are accounted one at a time.
+    void start_profiling();
+    void stop_profiling();
+
+    void reset();
+
+    status_t get_info(profiling_data_kind_t data_kind, int *num_entries,
+            uint64_t *data) const;
+
+private:
+    mutable std::recursive_mutex m_;
+    std::vector<entry_t> entries_;
+    parallel_profiler::region_t region_;
+    parallel_profiler::region_t *saved_region_ = nullptr;
+    uint64_t start_ns_ = 0;
+    int depth_ = 0;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -20,6 +20,7 @@
 
 #include "cpu/ref_sum.hpp"
 #include "cpu/simple_sum.hpp"
+#include "cpu/simple_tree_sum.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/jit_uni_xf16_sum.hpp"
@@ -45,6 +46,11 @@ constexpr impl_list_item_t cpu_sum_impl_list[] = REG_SUM_P({
         SUM_INSTANCE_AVX2(jit_xf16_sum_t<bf16, f32, avx2_vnni_2>)
         SUM_INSTANCE_AVX2(jit_xf16_sum_t<f16, f16, avx2_vnni_2>)
         SUM_INSTANCE_AVX2(jit_xf16_sum_t<f16, f32, avx2_vnni_2>)
+        INSTANCE(simple_tree_sum_t<f16>)
+        INSTANCE(simple_tree_sum_t<f16, f32>)
+        INSTANCE(simple_tree_sum_t<bf16>)
+        INSTANCE(simple_tree_sum_t<bf16, f32>)
+        INSTANCE(simple_tree_sum_t<f32>)
         INSTANCE(simple_sum_t<f16>)
         INSTANCE(simple_sum_t<f16, f32>)
         INSTANCE(simple_sum_t<bf16>)
@@ -0,0 +1,131 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <map>
+#include <mutex>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/utils.hpp"
+
+#include "cpu/file_mapping.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace file_mapping {
+
+namespace {
+
+struct mapping_t {
+    void *base;
+    size_t size;
+};
+
+std::mutex &mappings_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Indexed by the pointers returned to the users, which are not page aligned
+// when the file offset is not. The object is intentionally leaked as memory
+// may be unmapped during static destruction.
+std::map<void *, mapping_t> &mappings() {
+    static auto *mappings = new std::map<void *, mapping_t>();
+    return *mappings;
+}
+
+} // namespace
+
+status_t map(void **ptr, int fd, size_t offset, size_t size, unsigned flags) {
+#if defined(__linux__)
+    const unsigned known_flags = dnnl_memory_file_flags_writable
+            | dnnl_memory_file_flags_populate
+            | dnnl_memory_file_flags_huge_pages;
+    if (fd < 0 || size == 0 || (flags & ~known_flags))
+        return status::invalid_arguments;
+
+    // Pages past the end of the file cannot be accessed.
+    struct stat st;
+    if (::fstat(fd, &st) != 0) return status::invalid_arguments;
+    if (offset > (size_t)st.st_size || size > (size_t)st.st_size - offset)
+        return status::invalid_arguments;
+
+    // The mapping starts at a page boundary of the file.
+    const size_t page_size = (size_t)::sysconf(_SC_PAGESIZE);
+    const size_t head = offset % page_size;
+    const size_t map_size = head + size;
+
+    const bool writable = flags & dnnl_memory_file_flags_writable;
+    const int prot = PROT_READ | (writable ? PROT_WRITE : 0);
+    int map_flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+    if (flags & dnnl_memory_file_flags_populate) map_flags |= MAP_POPULATE;
+#endif
+    void *base = ::mmap(nullptr, map_size, prot, map_flags, fd,
+            static_cast<off_t>(offset - head));
+    if (base == MAP_FAILED) return status::runtime_error;
+
+    // The advice is rejected by file systems without huge page support for
+    // the page cache, and the mapping is still usable with regular pages.
+#ifdef MADV_HUGEPAGE
+    if (flags & dnnl_memory_file_flags_huge_pages)
+        ::madvise(base, map_size, MADV_HUGEPAGE);
+#endif
+
+    *ptr = static_cast<char *>(base) + head;
+    std::lock_guard<std::mutex> lock(mappings_mutex());
+    mappings().emplace(*ptr, mapping_t {base, map_size});
+    return status::success;
+#else
+    MAYBE_UNUSED(ptr);
+    MAYBE_UNUSED(fd);
+    MAYBE_UNUSED(offset);
+    MAYBE_UNUSED(size);
+    MAYBE_UNUSED(flags);
+    return status::unimplemented;
+#endif
+}
+
+bool unmap(void *ptr) {
+#if defined(__linux__)
+    mapping_t mapping;
+    {
+        std::lock_guard<std::mutex> lock(mappings_mutex());
+        auto &maps = mappings();
+        auto it = maps.find(ptr);
+        if (it == maps.end()) return false;
+        mapping = it->second;
+        maps.erase(it);
+    }
+    ::munmap(mapping.base, mapping.size);
+    return true;
+#else
+    MAYBE_UNUSED(ptr);
+    return false;
+#endif
+}
+
+} // namespace file_mapping
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,44 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_FILE_MAPPING_HPP
+#define CPU_FILE_MAPPING_HPP
+
+#include <cstddef>
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace file_mapping {
+
+// Maps `size` bytes of the file `fd` starting at `offset` into memory. The
+// `flags` are a combination of dnnl_memory_file_flags_t values. The mapping
+// is shared with the page cache: a read-only mapping does not copy the file,
+// and the writes to a writable one go to the file.
+status_t map(void **ptr, int fd, size_t offset, size_t size, unsigned flags);
+
+// Unmaps memory mapped with file_mapping::map(). Returns false if `ptr` was
+// not returned by file_mapping::map().
+bool unmap(void *ptr);
+
+} // namespace file_mapping
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
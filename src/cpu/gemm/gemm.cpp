@@ -44,6 +44,7 @@
 using namespace dnnl::impl::cpu::x64;
 #elif DNNL_PPC64
 #include "cpu/ppc64/gemm/gemm_driver.hpp"
+#include "cpu/ppc64/ppc64_gemm_f32.hpp"
 using namespace dnnl::impl::cpu::ppc64;
 #elif DNNL_S390X
 #include "cpu/s390x/gemm.h"
@@ -143,6 +144,16 @@ dnnl_status_t extended_sgemm(const char *transa, const char *transb,
                 force_jit_nocopy_gemm);
         if (status != status::unimplemented) return status;
     }
+#elif DNNL_PPC64
+#ifdef __MMA__
+    return gemm_f32_mma(transa, transb, M, N, K, alpha, A, lda, B, ldb, beta,
+            C, ldc, bias);
+#endif
+#elif DNNL_S390X
+#if DNNL_S390X_VXE
+    return s390x::sgemm(transa, transb, *M, *N, *K, *alpha, A, *lda, B, *ldb,
+            *beta, C, *ldc, bias);
+#endif
 #endif
 
     return ref_gemm<float>(
@@ -304,6 +315,9 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
             (const bfloat16 *)A, *lda, (const bfloat16 *)B, *ldb, *beta, C,
             *ldc);
     return dnnl_success;
+#elif defined(__MMA__)
+    return gemm_bf16bf16f32_mma(
+            transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 #endif
 #endif
 
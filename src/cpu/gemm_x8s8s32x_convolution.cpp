@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <atomic>
 
 #include "common/c_types_map.hpp"
@@ -76,7 +77,8 @@ const int32_t *mul_zp_src_comp_from_wei_by_zp_src(const int zp_comp_size,
 static zero_point_call_params_t prepare_zp_params(const conv_gemm_conf_t &jcp,
         const memory_tracking::grantor_t &scratchpad, const int8_t *weights,
         const memory_desc_wrapper &weights_md, bool with_groups,
-        const int32_t *src_zero_points, const int32_t *dst_zero_points) {
+        const int32_t *src_zero_points, const int32_t *dst_zero_points,
+        int32_t *cached_zp_src_comp_pad) {
 
     int32_t *zp_src_comp_pad = nullptr;
     const int32_t *zp_src_comp = nullptr;
@@ -97,7 +99,9 @@ static zero_point_call_params_t prepare_zp_params(const conv_gemm_conf_t &jcp,
         } else
             zp_src_comp = zp_src_comp_from_wei;
 
-        if (jit_gemm_convolution_utils::padding_exists(jcp)) {
+        if (cached_zp_src_comp_pad) {
+            zp_src_comp_pad = cached_zp_src_comp_pad;
+        } else if (jit_gemm_convolution_utils::padding_exists(jcp)) {
             const auto shift = jcp.zp.src_is_common
                     ? utils::rnd_up(zp_comp_size, cache_line_size)
                     : 0;
@@ -110,6 +114,38 @@ static zero_point_call_params_t prepare_zp_params(const conv_gemm_conf_t &jcp,
     return {src_zero_points, dst_zero_points, zp_src_comp, zp_src_comp_pad};
 }
 
+std::shared_ptr<std::vector<int32_t>>
+gemm_x8s8s32x_convolution_fwd_t::get_zp_src_comp_pad(
+        const int8_t *weights, uint64_t weights_id,
+        const int32_t *src_zero_points) const {
+    const conv_gemm_conf_t &jcp = pd()->jcp_;
+    const dim_t zp_src_size = jcp.zp.src_is_common ? 1 : jcp.oc * jcp.ngroups;
+
+    std::lock_guard<std::mutex> lock(zp_src_pad_comp_cache_.mutex);
+    // The compensation is recomputed when the weights or the values of the
+    // runtime zero points change.
+    const bool same_zp_src = zp_src_pad_comp_cache_.zero_points.size()
+                    == (size_t)zp_src_size
+            && std::equal(src_zero_points, src_zero_points + zp_src_size,
+                    zp_src_pad_comp_cache_.zero_points.begin());
+    // Weights without an id, e.g. the ones of an internal memory, are
+    // compensated on every execution.
+    if (!zp_src_pad_comp_cache_.data || weights_id == 0
+            || zp_src_pad_comp_cache_.weights_id != weights_id
+            || !same_zp_src) {
+        const dim_t size = jcp.oc * jcp.ngroups * jcp.zp.src_pad_comp.d
+                * jcp.zp.src_pad_comp.h * jcp.zp.src_pad_comp.w;
+        auto data = std::make_shared<std::vector<int32_t>>(size);
+        compute_zp_src_comp_pad(jcp, data->data(), src_zero_points, weights,
+                memory_desc_wrapper(pd()->weights_md(0)), pd()->with_groups());
+        zp_src_pad_comp_cache_.weights_id = weights_id;
+        zp_src_pad_comp_cache_.zero_points.assign(
+                src_zero_points, src_zero_points + zp_src_size);
+        zp_src_pad_comp_cache_.data = std::move(data);
+    }
+    return zp_src_pad_comp_cache_.data;
+}
+
 status_t gemm_x8s8s32x_convolution_fwd_t::execute_forward(
         const exec_ctx_t &ctx) const {
     const conv_gemm_conf_t &jcp = this->pd()->jcp_;
@@ -131,9 +167,18 @@ status_t gemm_x8s8s32x_convolution_fwd_t::execute_forward(
 
     assert(IMPLICATION(jcp.ow_block != jcp.ow, jcp.oh_block == 1));
 
+    std::shared_ptr<std::vector<int32_t>> zp_src_comp_pad;
+    if (pd()->attr()->constant_weights_ && jcp.zp.src_exists
+            && jit_gemm_convolution_utils::padding_exists(jcp)) {
+        const memory_t *weights_mem = ctx.input(DNNL_ARG_WEIGHTS);
+        zp_src_comp_pad = get_zp_src_comp_pad(wei_base,
+                weights_mem ? weights_mem->data_id() : 0, src_zero_points);
+    }
+
     const zero_point_call_params_t zp = prepare_zp_params(jcp, scratchpad,
             wei_base, memory_desc_wrapper(pd()->weights_md(0)),
-            this->pd()->with_groups(), src_zero_points, dst_zero_points);
+            this->pd()->with_groups(), src_zero_points, dst_zero_points,
+            zp_src_comp_pad ? zp_src_comp_pad->data() : nullptr);
 
     std::atomic<status_t> st(status::success);
 
@@ -18,6 +18,8 @@
 #define CPU_GEMM_X8S8S32X_CONVOLUTION_HPP
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "common/c_types_map.hpp"
 #include "common/memory_tracking.hpp"
@@ -121,9 +123,26 @@ private:
             const memory_tracking::grantor_t &scratchpad,
             const void *post_ops_binary_rhs_arg_vec,
             const exec_ctx_t &ctx) const;
+    std::shared_ptr<std::vector<int32_t>> get_zp_src_comp_pad(
+            const int8_t *weights, uint64_t weights_id,
+            const int32_t *src_zero_points) const;
 
     using pp_ker_t = gemm_x8s8s32x_convolution_utils::pp_ker_t;
     std::unique_ptr<pp_ker_t> pp_ker_;
+
+    // The source zero-point padding compensation for the weights and the
+    // zero points last passed to the primitive, used when the weights are
+    // constant. The weights are identified by the data id of their memory
+    // rather than by their address, which another buffer may take. An
+    // execution keeps the compensation alive while it is replaced for other
+    // weights or zero points.
+    struct zp_src_pad_comp_cache_t {
+        std::mutex mutex;
+        uint64_t weights_id = 0;
+        std::vector<int32_t> zero_points;
+        std::shared_ptr<std::vector<int32_t>> data;
+    };
+    mutable zp_src_pad_comp_cache_t zp_src_pad_comp_cache_;
 };
 
 struct gemm_x8s8s32x_convolution_bwd_data_t : public primitive_t {
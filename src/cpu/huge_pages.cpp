@@ -0,0 +1,220 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "common/memory_debug.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/huge_pages.hpp"
+
+#if defined(__linux__)
+// Older system headers may miss the page size selectors.
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace huge_pages {
+
+namespace {
+
+struct allocation_t {
+    size_t size;
+    bool is_thp;
+};
+
+std::mutex &allocations_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Ordered by address to look up the allocations within a mapping reported by
+// /proc/self/smaps. The object is intentionally leaked as memory may be freed
+// during static destruction.
+std::map<uintptr_t, allocation_t> &allocations() {
+    static auto *allocations = new std::map<uintptr_t, allocation_t>();
+    return *allocations;
+}
+
+size_t get_page_size(policy_t policy) {
+    return policy == policy_t::hugetlb_1g ? size_t(1) << 30 : size_t(2) << 20;
+}
+
+#if defined(__linux__)
+void *mmap_thp(size_t size, size_t page_size) {
+    // Transparent huge pages only back huge page aligned regions, hence the
+    // mapping is over-allocated and trimmed to an aligned range.
+    const size_t map_size = size + page_size;
+    void *ptr = ::mmap(nullptr, map_size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) return nullptr;
+
+    const uintptr_t start = reinterpret_cast<uintptr_t>(ptr);
+    const uintptr_t aligned = utils::rnd_up(start, page_size);
+    const size_t head = aligned - start;
+    const size_t tail = map_size - head - size;
+    if (head) ::munmap(ptr, head);
+    if (tail) ::munmap(reinterpret_cast<void *>(aligned + size), tail);
+
+    // The memory is still usable if the advice is rejected, e.g. when THP is
+    // disabled system-wide; it is just not reported as huge pages.
+    ::madvise(reinterpret_cast<void *>(aligned), size, MADV_HUGEPAGE);
+    return reinterpret_cast<void *>(aligned);
+}
+
+void *mmap_hugetlb(size_t size, policy_t policy) {
+    const int page_flag
+            = policy == policy_t::hugetlb_1g ? MAP_HUGE_1GB : MAP_HUGE_2MB;
+    void *ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | page_flag, -1, 0);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+// Returns the amount of anonymous memory promoted to transparent huge pages
+// in the mappings that hold THP allocations.
+size_t get_thp_promoted_size() {
+    FILE *fp = ::fopen("/proc/self/smaps", "r");
+    if (!fp) return 0;
+
+    size_t total = 0;
+    bool is_tracked_mapping = false;
+    char line[512];
+    while (::fgets(line, sizeof(line), fp)) {
+        uintptr_t start = 0, end = 0;
+        unsigned long long kb = 0;
+        if (::sscanf(line, "%" SCNxPTR "-%" SCNxPTR " ", &start, &end) == 2) {
+            // A mapping header. The kernel may merge adjacent mappings, so
+            // check for any THP allocation that overlaps the mapping.
+            is_tracked_mapping = false;
+            auto &allocs = allocations();
+            for (auto it = allocs.lower_bound(start);
+                    it != allocs.end() && it->first < end; ++it) {
+                if (it->second.is_thp) {
+                    is_tracked_mapping = true;
+                    break;
+                }
+            }
+        } else if (is_tracked_mapping
+                && ::sscanf(line, "AnonHugePages: %llu kB", &kb) == 1) {
+            total += static_cast<size_t>(kb) * 1024;
+        }
+    }
+    ::fclose(fp);
+    return total;
+}
+#endif
+
+} // namespace
+
+policy_t get_policy() {
+    static const policy_t policy = [] {
+        const std::string value = getenv_string_user("CPU_HUGE_PAGES");
+        if (value == "thp") return policy_t::thp;
+        if (value == "hugetlb" || value == "hugetlb_2m")
+            return policy_t::hugetlb_2m;
+        if (value == "hugetlb_1g") return policy_t::hugetlb_1g;
+        return policy_t::none;
+    }();
+    return policy;
+}
+
+void *malloc(size_t size) {
+#if defined(__linux__)
+    const policy_t policy = get_policy();
+    if (policy == policy_t::none || memory_debug::is_mem_debug())
+        return nullptr;
+
+    const size_t page_size = get_page_size(policy);
+    if (size < page_size) return nullptr;
+
+    const size_t alloc_size = utils::rnd_up(size, page_size);
+    const bool is_thp = policy == policy_t::thp;
+    void *ptr = is_thp ? mmap_thp(alloc_size, page_size)
+                       : mmap_hugetlb(alloc_size, policy);
+    if (!ptr) return nullptr;
+
+    std::lock_guard<std::mutex> lock(allocations_mutex());
+    allocations().emplace(
+            reinterpret_cast<uintptr_t>(ptr), allocation_t {alloc_size, is_thp});
+    return ptr;
+#else
+    MAYBE_UNUSED(size);
+    return nullptr;
+#endif
+}
+
+bool free(void *ptr) {
+#if defined(__linux__)
+    size_t size = 0;
+    {
+        std::lock_guard<std::mutex> lock(allocations_mutex());
+        auto &allocs = allocations();
+        auto it = allocs.find(reinterpret_cast<uintptr_t>(ptr));
+        if (it == allocs.end()) return false;
+        size = it->second.size;
+        allocs.erase(it);
+    }
+    ::munmap(ptr, size);
+    return true;
+#else
+    MAYBE_UNUSED(ptr);
+    return false;
+#endif
+}
+
+size_t get_allocated_size() {
+#if defined(__linux__)
+    std::lock_guard<std::mutex> lock(allocations_mutex());
+    // Explicit huge pages are reserved at mapping time.
+    size_t hugetlb_size = 0;
+    bool has_thp = false;
+    for (const auto &a : allocations()) {
+        if (a.second.is_thp)
+            has_thp = true;
+        else
+            hugetlb_size += a.second.size;
+    }
+    return hugetlb_size + (has_thp ? get_thp_promoted_size() : 0);
+#else
+    return 0;
+#endif
+}
+
+} // namespace huge_pages
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
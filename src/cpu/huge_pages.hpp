@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_HUGE_PAGES_HPP
+#define CPU_HUGE_PAGES_HPP
+
+#include <cstddef>
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace huge_pages {
+
+// Huge pages backing policy for library-owned CPU allocations. Controlled by
+// the ONEDNN_CPU_HUGE_PAGES environment variable.
+enum class policy_t {
+    none, // regular allocations (default)
+    thp, // transparent huge pages requested with madvise()
+    hugetlb_2m, // explicit 2M pages from the hugetlbfs pool
+    hugetlb_1g, // explicit 1G pages from the hugetlbfs pool
+};
+
+policy_t DNNL_API get_policy();
+
+// Allocates `size` bytes backed by huge pages according to the policy.
+// Returns nullptr if the policy is `none`, if the buffer is smaller than a huge
+// page, or if the system refused the request; the caller is expected to fall
+// back to a regular allocation in this case.
+void DNNL_API *malloc(size_t size);
+
+// Frees memory allocated with huge_pages::malloc(). Returns false if `ptr` was
+// not allocated by huge_pages::malloc().
+bool DNNL_API free(void *ptr);
+
+// Returns the number of bytes currently backed by huge pages. For
+// transparent huge pages, the value reflects the pages the kernel actually
+// promoted, which can be less than the amount of memory requested.
+size_t DNNL_API get_allocated_size();
+
+} // namespace huge_pages
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,165 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "common/utils.hpp"
+
+#include "cpu/huge_pages.hpp"
+#include "cpu/jit_utils/code_arena.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace jit_utils {
+namespace code_arena {
+
+namespace {
+
+constexpr size_t region_size = size_t(2) << 20;
+constexpr size_t block_alignment = 64;
+
+struct region_t {
+    size_t size;
+    // The blocks are allocated from the beginning of a region one after
+    // another, and the region is reused or released once all its blocks are
+    // freed.
+    size_t used;
+    size_t nblocks;
+};
+
+std::mutex &regions_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Ordered by address to find the region of a block. The object is
+// intentionally leaked as kernels may be freed during static destruction.
+std::map<uintptr_t, region_t> &regions() {
+    static auto *regions = new std::map<uintptr_t, region_t>();
+    return *regions;
+}
+
+// The region the small blocks are allocated from.
+uintptr_t current_region = 0;
+
+#if defined(__linux__)
+// Maps a region aligned to 2M, so that the kernel is able to back it with
+// huge pages.
+void *map_region(size_t size) {
+    const size_t map_size = size + region_size;
+    void *ptr = ::mmap(nullptr, map_size, PROT_READ | PROT_WRITE | PROT_EXEC,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) return nullptr;
+
+    const uintptr_t start = reinterpret_cast<uintptr_t>(ptr);
+    const uintptr_t aligned = utils::rnd_up(start, region_size);
+    const size_t head = aligned - start;
+    const size_t tail = map_size - head - size;
+    if (head) ::munmap(ptr, head);
+    if (tail) ::munmap(reinterpret_cast<void *>(aligned + size), tail);
+
+    // Code is not placed in the hugetlbfs pool, any huge pages policy
+    // requests transparent huge pages.
+    if (huge_pages::get_policy() != huge_pages::policy_t::none)
+        ::madvise(reinterpret_cast<void *>(aligned), size, MADV_HUGEPAGE);
+    return reinterpret_cast<void *>(aligned);
+}
+#endif
+
+} // namespace
+
+bool is_enabled() {
+#if defined(__linux__)
+    static const bool enabled = getenv_int_user("JIT_CODE_ARENA", 1) != 0;
+    return enabled;
+#else
+    return false;
+#endif
+}
+
+void *alloc(size_t size) {
+#if defined(__linux__)
+    if (!is_enabled() || size == 0) return nullptr;
+
+    const size_t block_size = utils::rnd_up(size, block_alignment);
+    std::lock_guard<std::mutex> lock(regions_mutex());
+    auto &regs = regions();
+
+    if (current_region) {
+        region_t &r = regs.at(current_region);
+        if (r.used + block_size <= r.size) {
+            void *ptr = reinterpret_cast<void *>(current_region + r.used);
+            r.used += block_size;
+            r.nblocks++;
+            return ptr;
+        }
+    }
+
+    // A kernel larger than a region gets a region of its own, which does not
+    // take the small blocks.
+    const size_t size_to_map = utils::rnd_up(block_size, region_size);
+    void *ptr = map_region(size_to_map);
+    if (!ptr) return nullptr;
+
+    const uintptr_t base = reinterpret_cast<uintptr_t>(ptr);
+    regs.emplace(base, region_t {size_to_map, block_size, 1});
+    if (size_to_map == region_size) current_region = base;
+    return ptr;
+#else
+    MAYBE_UNUSED(size);
+    return nullptr;
+#endif
+}
+
+bool free(void *ptr) {
+#if defined(__linux__)
+    if (ptr == nullptr) return false;
+
+    const uintptr_t addr = reinterpret_cast<uintptr_t>(ptr);
+    std::lock_guard<std::mutex> lock(regions_mutex());
+    auto &regs = regions();
+    auto it = regs.upper_bound(addr);
+    if (it == regs.begin()) return false;
+    --it;
+    region_t &r = it->second;
+    if (addr >= it->first + r.size) return false;
+
+    if (--r.nblocks > 0) return true;
+    if (it->first == current_region) {
+        r.used = 0;
+    } else {
+        ::munmap(reinterpret_cast<void *>(it->first), r.size);
+        regs.erase(it);
+    }
+    return true;
+#else
+    MAYBE_UNUSED(ptr);
+    return false;
+#endif
+}
+
+} // namespace code_arena
+} // namespace jit_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
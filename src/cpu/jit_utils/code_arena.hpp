@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_JIT_UTILS_CODE_ARENA_HPP
+#define CPU_JIT_UTILS_CODE_ARENA_HPP
+
+#include <cstddef>
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace jit_utils {
+namespace code_arena {
+
+// A process-wide pool of executable memory for the generated kernels. A
+// kernel usually takes a few kilobytes but gets its own pages when allocated
+// by the code generator, so the code of a model is spread over many pages and
+// the instruction TLB misses. The arena packs the kernels densely into 2M
+// regions, which are backed by transparent huge pages when the
+// ONEDNN_CPU_HUGE_PAGES environment variable requests huge pages. The regions
+// are readable, writable and executable, like the buffers of the code
+// generators. A region is released when the last of its kernels is freed.
+//
+// The arena is used on Linux only and is disabled with
+// ONEDNN_JIT_CODE_ARENA=0.
+bool DNNL_API is_enabled();
+
+// Returns a block of `size` bytes aligned to a cache line, or nullptr if the
+// arena is disabled or the memory cannot be mapped; the caller is expected
+// to keep the code in its own buffer in this case.
+void DNNL_API *alloc(size_t size);
+
+// Frees a block returned by code_arena::alloc(). Returns false if `ptr` does
+// not belong to the arena.
+bool DNNL_API free(void *ptr);
+
+} // namespace code_arena
+} // namespace jit_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -19,12 +19,14 @@
 
 #include <cstdlib>
 
+#include "oneapi/dnnl/dnnl_config.h"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
 namespace jit_utils {
 
-void register_jit_code(const void *code, size_t code_size,
+void DNNL_API register_jit_code(const void *code, size_t code_size,
         const char *code_name, const char *source_file_name);
 
 }
@@ -20,14 +20,20 @@
 
 #include "cpu/matmul/gemm_bf16_matmul.hpp"
 #include "cpu/matmul/gemm_f32_matmul.hpp"
+#include "cpu/matmul/gemm_grouped_matmul.hpp"
+#include "cpu/matmul/gemm_paged_matmul.hpp"
+#include "cpu/matmul/gemm_structured_matmul.hpp"
 #include "cpu/matmul/gemm_x8s8s32x_matmul.hpp"
 #include "cpu/matmul/ref_matmul.hpp"
 #include "cpu/matmul/ref_matmul_int8.hpp"
 #include "cpu/matmul/ref_sparse_matmul.hpp"
+#include "cpu/matmul/split_dst_matmul.hpp"
+#include "cpu/matmul/top_k_matmul.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
+#include "cpu/x64/matmul/jit_uni_tiny_matmul.hpp"
 using namespace dnnl::impl::cpu::x64::matmul;
 using namespace dnnl::impl::cpu::x64;
 #elif DNNL_AARCH64
@@ -67,6 +73,7 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE_AARCH64(jit_bf16_matmul_t)
         CPU_INSTANCE_AARCH64(brgemm_matmul_t<sve_256>)
         CPU_INSTANCE_AARCH64(jit_int8_matmul_t)
+        CPU_INSTANCE_X64(jit_uni_tiny_matmul_t)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx10_2_512_amx_2>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx_fp16>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx>)
@@ -85,6 +92,11 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE_AVX2(brgemm_matmul_t<avx2>)
         CPU_INSTANCE(ref_matmul_t)
         CPU_INSTANCE(ref_matmul_int8_t)
+        CPU_INSTANCE(gemm_grouped_matmul_t)
+        CPU_INSTANCE(gemm_paged_matmul_t)
+        CPU_INSTANCE(gemm_structured_matmul_t)
+        CPU_INSTANCE(top_k_matmul_t)
+        CPU_INSTANCE(split_dst_matmul_t)
         CPU_INSTANCE_X64(jit_uni_sparse_matmul_t)
         CPU_INSTANCE(ref_sparse_matmul_t)
         /* eol */
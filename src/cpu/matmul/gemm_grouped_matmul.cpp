@@ -0,0 +1,130 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/gemm/gemm.hpp"
+
+#include "cpu/matmul/gemm_grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+status_t gemm_grouped_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC, 0);
+    const auto src_offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+    const auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST, 0);
+    auto dst_offsets = CTX_OUT_MEM(int32_t *, DNNL_ARG_DST, 1);
+
+    const dim_t G = pd()->ngroups();
+    const dim_t M = pd()->dst_md()->dims[0];
+    const dim_t N = pd()->dst_md()->dims[1];
+    const dim_t K = pd()->src_md()->dims[1];
+
+    // The groups are known only at execution time, so the blocking is done
+    // here. The M blocks of a group never cross the group boundary.
+    std::vector<dim_t> group_start(G + 1, 0);
+    for (dim_t g = 0; g < G; g++) {
+        const dim_t end = src_offsets[g];
+        if (end < group_start[g] || end > M) return status::invalid_arguments;
+        group_start[g + 1] = end;
+    }
+    if (dst_offsets != src_offsets)
+        std::copy(src_offsets, src_offsets + G, dst_offsets);
+
+    // The rows after the last group belong to no group and are zeroed.
+    const dim_t M_tail = M - group_start[G];
+    if (M_tail > 0)
+        parallel_nd(M_tail, [&](dim_t m) {
+            float *row = dst + (group_start[G] + m) * N;
+            std::fill(row, row + N, 0.f);
+        });
+
+    constexpr dim_t m_blk = 64;
+    constexpr dim_t min_n_blk = 64;
+    const int nthr = dnnl_get_max_threads();
+
+    // Tiles are enumerated group by group, the first tile of each group is
+    // kept to find the group of a tile with a binary search.
+    std::vector<dim_t> tile_start(G + 1, 0);
+    auto init_tiles = [&](dim_t n_blk) {
+        const dim_t nb = utils::div_up(N, n_blk);
+        for (dim_t g = 0; g < G; g++) {
+            const dim_t M_g = group_start[g + 1] - group_start[g];
+            tile_start[g + 1] = tile_start[g] + utils::div_up(M_g, m_blk) * nb;
+        }
+        return tile_start[G];
+    };
+
+    // Split N when the groups are too small to occupy all the threads, as
+    // for decoding with few tokens per expert.
+    dim_t n_blk = N;
+    dim_t ntiles = init_tiles(n_blk);
+    while (ntiles < nthr && n_blk > min_n_blk) {
+        n_blk = nstl::max(min_n_blk, utils::rnd_up(n_blk / 2, 16));
+        ntiles = init_tiles(n_blk);
+    }
+    if (ntiles == 0) return status::success;
+    const dim_t nb = utils::div_up(N, n_blk);
+
+    const char trans = 'N';
+    const float alpha = 1.f, beta = 0.f;
+    std::atomic<status_t> st(status::success);
+
+    parallel(nstl::min<dim_t>(nthr, ntiles), [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(ntiles, nthr, ithr, start, end);
+
+        for (dim_t t = start; t < end; t++) {
+            const dim_t g = std::upper_bound(tile_start.begin(),
+                                    tile_start.end(), t)
+                    - tile_start.begin() - 1;
+            const dim_t t_g = t - tile_start[g];
+            const dim_t m = group_start[g] + (t_g / nb) * m_blk;
+            const dim_t n = (t_g % nb) * n_blk;
+            const dim_t gemm_M = nstl::min(m_blk, group_start[g + 1] - m);
+            const dim_t gemm_N = nstl::min(n_blk, N - n);
+
+            // Row-major C = A * B is computed as column-major C' = B' * A'.
+            const float *A = src + m * K;
+            const float *B = weights + g * K * N + n;
+            float *C = dst + m * N + n;
+            const status_t st_thr = extended_sgemm(&trans, &trans, &gemm_N,
+                    &gemm_M, &K, &alpha, B, &N, A, &K, &beta, C, &N, nullptr,
+                    false);
+            if (st_thr != status::success) {
+                st = st_thr;
+                return;
+            }
+        }
+    });
+
+    return st;
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_GEMM_GROUPED_MATMUL_HPP
+#define CPU_MATMUL_GEMM_GROUPED_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+// Grouped matmul, e.g. for Mixture-of-Experts layers: the rows of src and
+// dst are split into groups by a runtime array of offsets and each group is
+// multiplied by its own matrix of the stacked weights [G, K, N]. The tiles
+// of all the groups are distributed over the threads in a single parallel
+// region, each tile is computed by a sequential gemm call.
+struct gemm_grouped_matmul_t : public primitive_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("gemm:jit:grouped", gemm_grouped_matmul_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            const memory_desc_wrapper src_d(src_md());
+            const memory_desc_wrapper wei_d(weights_md());
+            const memory_desc_wrapper dst_d(dst_md());
+
+            VDISPATCH_MATMUL(src_d.is_sparse_desc()
+                            && src_d.encoding() == sparse_encoding::grouped,
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_MATMUL(dst_d.is_sparse_desc()
+                            && dst_d.encoding() == sparse_encoding::grouped,
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_MATMUL(
+                    utils::everyone_is(s32, src_d.metadata_type(0),
+                            dst_d.metadata_type(0)),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_MATMUL(utils::everyone_is(f32, src_d.data_type(),
+                                     wei_d.data_type(), dst_d.data_type()),
+                    VERBOSE_UNSUPPORTED_DT_CFG);
+            VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+            VDISPATCH_MATMUL(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_MATMUL(wei_d.matches_one_of_tag(format_tag::abc),
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            return status::success;
+        }
+
+        dim_t ngroups() const { return src_md()->format_desc.sparse_desc.nnz; }
+    };
+
+    gemm_grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
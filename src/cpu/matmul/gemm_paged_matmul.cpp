@@ -0,0 +1,174 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <cstring>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/gemm/gemm.hpp"
+
+#include "cpu/matmul/gemm_paged_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+using namespace memory_tracking::names;
+
+constexpr dim_t gemm_paged_matmul_t::pd_t::m_blk;
+
+void gemm_paged_matmul_t::pd_t::init_conf() {
+    const dim_t M = dst_md()->dims[0];
+    const dim_t N = dst_md()->dims[1];
+    const memory_desc_wrapper wei_d(weights_md());
+    const dim_t npages = wei_d.npages_in_table();
+    const dim_t mb = utils::div_up(M, m_blk);
+
+    nthr_ = dnnl_get_max_threads();
+    n_blk_ = N;
+    nchunks_ = 1;
+
+    // Pages give independent blocks of dst columns.
+    if (paged_dim() == 1) return;
+
+    // Split N down to a reasonable gemm size, then split the pages when
+    // there are still not enough tiles, as for decoding with few tokens.
+    constexpr dim_t min_n_blk = 64;
+    while (mb * utils::div_up(N, n_blk_) < nthr_ && n_blk_ > min_n_blk)
+        n_blk_ = nstl::max(min_n_blk, utils::rnd_up(n_blk_ / 2, 16));
+    const dim_t ntiles = mb * utils::div_up(N, n_blk_);
+    if (ntiles > 0 && ntiles < nthr_)
+        nchunks_ = nstl::min<dim_t>(npages, nthr_ / ntiles);
+}
+
+void gemm_paged_matmul_t::pd_t::init_scratchpad() {
+    if (nchunks_ <= 1) return;
+    const dim_t M = dst_md()->dims[0];
+    const dim_t N = dst_md()->dims[1];
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_gemm_accumulator, (nchunks_ - 1) * M * N);
+}
+
+status_t gemm_paged_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto pool = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS, 0);
+    const auto page_table = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const dim_t M = pd()->dst_md()->dims[0];
+    const dim_t N = pd()->dst_md()->dims[1];
+    const dim_t K = pd()->src_md()->dims[1];
+    const dim_t P = pd()->page_size();
+    const dim_t pool_npages = wei_d.nnz();
+    const dim_t npages = wei_d.npages_in_table();
+    const dim_t page_nelems = wei_d.page_nelems();
+    const bool paged_n = pd()->paged_dim() == 1;
+
+    for (dim_t p = 0; p < npages; p++) {
+        if (page_table[p] < 0 || page_table[p] >= pool_npages)
+            return status::invalid_arguments;
+    }
+
+    constexpr dim_t m_blk = pd_t::m_blk;
+    const dim_t mb = utils::div_up(M, m_blk);
+    const dim_t n_blk = pd()->n_blk_;
+    const dim_t nb = utils::div_up(N, n_blk);
+    const dim_t nchunks = pd()->nchunks_;
+    const dim_t ntiles = paged_n ? npages * mb : nchunks * mb * nb;
+    float *acc = nchunks > 1
+            ? ctx.get_scratchpad_grantor().template get<float>(
+                    key_gemm_accumulator)
+            : nullptr;
+    if (M == 0 || N == 0) return status::success;
+
+    // Nothing is accumulated without K, the result is zero, while there are
+    // no pages to compute it from for the weights paged along K.
+    if (K == 0) {
+        std::memset(dst, 0, M * N * sizeof(float));
+        return status::success;
+    }
+    if (ntiles == 0) return status::success;
+
+    const float alpha = 1.f, zero = 0.f, one = 1.f;
+    std::atomic<status_t> st(status::success);
+
+    // Row-major C = A * B is computed as column-major C' = B' * A'.
+    parallel(nstl::min<dim_t>(pd()->nthr_, ntiles), [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(ntiles, nthr, ithr, start, end);
+
+        for (dim_t t = start; t < end; t++) {
+            status_t st_thr = status::success;
+            if (paged_n) {
+                // The page is the [gemm_N, K] row-major transposed block of
+                // the weights for the columns [n, n + gemm_N).
+                const dim_t p = t / mb;
+                const dim_t m = (t % mb) * m_blk;
+                const dim_t n = p * P;
+                const dim_t gemm_M = nstl::min(m_blk, M - m);
+                const dim_t gemm_N = nstl::min(P, N - n);
+                const float *B = pool + page_table[p] * page_nelems;
+                st_thr = extended_sgemm("T", "N", &gemm_N, &gemm_M, &K,
+                        &alpha, B, &K, src + m * K, &K, &zero, dst + m * N + n,
+                        &N, nullptr, false);
+            } else {
+                // The page is the [P, N] row-major block of the weights for
+                // the rows [k, k + P), the pages of a chunk are accumulated.
+                const dim_t c = t / (mb * nb);
+                const dim_t m = ((t / nb) % mb) * m_blk;
+                const dim_t n = (t % nb) * n_blk;
+                const dim_t gemm_M = nstl::min(m_blk, M - m);
+                const dim_t gemm_N = nstl::min(n_blk, N - n);
+                float *C = (c == 0 ? dst : acc + (c - 1) * M * N) + m * N + n;
+                dim_t p_start {0}, p_end {0};
+                balance211(npages, nchunks, c, p_start, p_end);
+                for (dim_t p = p_start; p < p_end; p++) {
+                    const dim_t k = p * P;
+                    const dim_t gemm_K = nstl::min(P, K - k);
+                    const float *B = pool + page_table[p] * page_nelems + n;
+                    st_thr = extended_sgemm("N", "N", &gemm_N, &gemm_M,
+                            &gemm_K, &alpha, B, &N, src + m * K + k, &K,
+                            p == p_start ? &zero : &one, C, &N, nullptr,
+                            false);
+                    if (st_thr != status::success) break;
+                }
+            }
+            if (st_thr != status::success) {
+                st = st_thr;
+                return;
+            }
+        }
+    });
+    if (st != status::success || nchunks == 1) return st;
+
+    parallel_nd(M, N, [&](dim_t m, dim_t n) {
+        float s = dst[m * N + n];
+        for (dim_t c = 1; c < nchunks; c++)
+            s += acc[(c - 1) * M * N + m * N + n];
+        dst[m * N + n] = s;
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_GEMM_PAGED_MATMUL_HPP
+#define CPU_MATMUL_GEMM_PAGED_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+// Matmul with paged weights, e.g. the keys or the values of a paged key-value
+// cache. Each page of the weights is a dense matrix, so the pages are passed
+// to gemm directly from the page pool instead of being gathered first:
+// - paged_dim == 1 (transposed keys): a page is a block of columns of the
+//   weights and gives an independent block of columns of dst.
+// - paged_dim == 0 (values): a page is a block of rows of the weights and
+//   the products of the pages are accumulated. When there are not enough
+//   dst tiles for the threads, the pages are split into chunks that are
+//   accumulated in the scratchpad and reduced at the end.
+struct gemm_paged_matmul_t : public primitive_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("gemm:jit:paged", gemm_paged_matmul_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            const memory_desc_wrapper src_d(src_md());
+            const memory_desc_wrapper wei_d(weights_md());
+            const memory_desc_wrapper dst_d(dst_md());
+
+            VDISPATCH_MATMUL(wei_d.is_sparse_desc()
+                            && wei_d.encoding() == sparse_encoding::paged,
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_MATMUL(wei_d.metadata_type(0) == s32,
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_MATMUL(
+                    !src_d.is_sparse_desc() && !dst_d.is_sparse_desc(),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_MATMUL(utils::everyone_is(f32, src_d.data_type(),
+                                     wei_d.data_type(), dst_d.data_type()),
+                    VERBOSE_UNSUPPORTED_DT_CFG);
+            VDISPATCH_MATMUL(!has_runtime_dims_or_strides(),
+                    VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+            VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+            VDISPATCH_MATMUL(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_MATMUL(src_d.matches_one_of_tag(format_tag::ab)
+                            && dst_d.matches_one_of_tag(format_tag::ab),
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            init_conf();
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        int paged_dim() const {
+            return weights_md()->format_desc.sparse_desc.paged_dim;
+        }
+        dim_t page_size() const {
+            return weights_md()->format_desc.sparse_desc.page_size;
+        }
+
+        static constexpr dim_t m_blk = 64;
+
+        int nthr_ = 1;
+        dim_t n_blk_ = 0;
+        // The number of chunks the pages are split into when they are
+        // accumulated, only for paged_dim == 0.
+        dim_t nchunks_ = 1;
+
+    private:
+        void init_conf();
+        void init_scratchpad();
+    };
+
+    gemm_paged_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
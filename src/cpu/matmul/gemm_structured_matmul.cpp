@@ -0,0 +1,213 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <cstring>
+
+#include "common/bfloat16.hpp"
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/gemm/gemm.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/matmul/gemm_structured_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+using namespace memory_tracking::names;
+
+namespace {
+
+// Column-major C = A * B, with A being the decompressed weights.
+status_t call_gemm(const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *A, const dim_t *lda, const float *B, const dim_t *ldb,
+        const float *beta, float *C, const dim_t *ldc) {
+    const float alpha = 1.f;
+    return extended_sgemm("N", "N", M, N, K, &alpha, A, lda, B, ldb, beta, C,
+            ldc, nullptr, false);
+}
+
+status_t call_gemm(const dim_t *M, const dim_t *N, const dim_t *K,
+        const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
+        const dim_t *ldb, const float *beta, float *C, const dim_t *ldc) {
+    const float alpha = 1.f;
+    return gemm_bf16bf16f32(
+            "N", "N", M, N, K, &alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+// Decompresses the groups [g_start, g_end) of the columns [n, n + ncols) of
+// the weights into the row-major dense buffer `buf` with `ncols` columns.
+template <typename data_t>
+void decompress(const data_t *values, const uint8_t *masks, data_t *buf,
+        dim_t g_start, dim_t g_end, dim_t n, dim_t ncols, dim_t N, int sp_n,
+        int sp_m) {
+    std::memset(buf, 0, (g_end - g_start) * sp_m * ncols * sizeof(data_t));
+    for (dim_t g = g_start; g < g_end; g++) {
+        const data_t *v = values + g * sp_n * N + n;
+        const uint8_t *mk = masks + g * N + n;
+        data_t *b = buf + (g - g_start) * sp_m * ncols;
+        for (dim_t j = 0; j < ncols; j++) {
+            const unsigned mask = mk[j];
+            int slot = 0;
+            for (int i = 0; i < sp_m && slot < sp_n; i++) {
+                if (!(mask & (1u << i))) continue;
+                b[i * ncols + j] = v[slot * N + j];
+                slot++;
+            }
+        }
+    }
+}
+
+} // namespace
+
+status_t gemm_structured_matmul_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_MATMUL(wei_d.is_sparse_desc()
+                    && wei_d.encoding() == sparse_encoding::structured,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(
+            wei_d.metadata_type(0) == u8, VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(!src_d.is_sparse_desc() && !dst_d.is_sparse_desc(),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    const bool is_f32 = utils::everyone_is(
+            f32, src_d.data_type(), wei_d.data_type(), dst_d.data_type());
+    const bool is_bf16 = utils::everyone_is(
+                                 bf16, src_d.data_type(), wei_d.data_type())
+            && dst_d.data_type() == f32
+            && platform::has_data_type_support(bf16);
+    VDISPATCH_MATMUL(is_f32 || is_bf16, VERBOSE_UNSUPPORTED_DT_CFG);
+#if DNNL_X64
+    VDISPATCH_MATMUL(IMPLICATION(is_bf16, x64::mayiuse(x64::avx512_core)),
+            VERBOSE_UNSUPPORTED_ISA);
+#endif
+    VDISPATCH_MATMUL(
+            !has_runtime_dims_or_strides(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(src_d.matches_one_of_tag(format_tag::ab)
+                    && dst_d.matches_one_of_tag(format_tag::ab),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    init_conf();
+    init_scratchpad();
+
+    return status::success;
+}
+
+void gemm_structured_matmul_t::pd_t::init_conf() {
+    const dim_t N = dst_md()->dims[1];
+    const dim_t K = src_md()->dims[1];
+
+    // Split N so that every thread gets a block of columns, the weights are
+    // read, and decompressed, only once.
+    constexpr dim_t min_n_blk = 16;
+    nthr_ = dnnl_get_max_threads();
+    n_blk_ = N;
+    while (utils::div_up(N, n_blk_) < nthr_ && n_blk_ > min_n_blk)
+        n_blk_ = nstl::max(min_n_blk, utils::rnd_up(n_blk_ / 2, 16));
+
+    // Keep the decompressed chunk of the weights in L2.
+    constexpr dim_t buf_nelems = 64 * 1024;
+    const dim_t m = sparse_m();
+    k_blk_ = nstl::min(
+            K, nstl::max<dim_t>(m, utils::rnd_dn(buf_nelems / n_blk_, m)));
+}
+
+void gemm_structured_matmul_t::pd_t::init_scratchpad() {
+    const size_t dt_sz = types::data_type_size(weights_md()->data_type);
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_gemm_blocked_b,
+            (size_t)nstl::min<dim_t>(nthr_,
+                    utils::div_up(dst_md()->dims[1], n_blk_))
+                    * k_blk_ * n_blk_,
+            dt_sz, 64);
+}
+
+template <typename data_t>
+status_t gemm_structured_matmul_t::execute_impl(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    const auto values = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS, 0);
+    const auto masks = CTX_IN_MEM(const uint8_t *, DNNL_ARG_WEIGHTS, 1);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const dim_t M = pd()->dst_md()->dims[0];
+    const dim_t N = pd()->dst_md()->dims[1];
+    const dim_t K = pd()->src_md()->dims[1];
+    const int sp_n = pd()->sparse_n();
+    const int sp_m = pd()->sparse_m();
+    const dim_t n_blk = pd()->n_blk_;
+    const dim_t k_blk = pd()->k_blk_;
+    const dim_t nb = utils::div_up(N, n_blk);
+    if (M == 0 || nb == 0) return status::success;
+
+    // Nothing is accumulated without K, the result is zero.
+    if (K == 0) {
+        std::memset(dst, 0, M * N * sizeof(float));
+        return status::success;
+    }
+
+    data_t *buf_base = ctx.get_scratchpad_grantor().template get<data_t>(
+            key_gemm_blocked_b);
+
+    const float zero = 0.f, one = 1.f;
+    std::atomic<status_t> st(status::success);
+
+    // Row-major C = A * B is computed as column-major C' = B' * A'.
+    parallel(nstl::min<dim_t>(pd()->nthr_, nb), [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nb, nthr, ithr, start, end);
+        data_t *buf = buf_base + ithr * k_blk * n_blk;
+
+        for (dim_t t = start; t < end; t++) {
+            const dim_t n = t * n_blk;
+            const dim_t gemm_N = nstl::min(n_blk, N - n);
+            for (dim_t k = 0; k < K; k += k_blk) {
+                const dim_t gemm_K = nstl::min(k_blk, K - k);
+                decompress(values, masks, buf, k / sp_m, (k + gemm_K) / sp_m,
+                        n, gemm_N, N, sp_n, sp_m);
+                const status_t st_thr = call_gemm(&gemm_N, &M, &gemm_K, buf,
+                        &gemm_N, src + k, &K, k == 0 ? &zero : &one, dst + n,
+                        &N);
+                if (st_thr != status::success) {
+                    st = st_thr;
+                    return;
+                }
+            }
+        }
+    });
+
+    return st;
+}
+
+status_t gemm_structured_matmul_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->weights_md()->data_type == data_type::bf16)
+        return execute_impl<bfloat16_t>(ctx);
+    return execute_impl<float>(ctx);
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
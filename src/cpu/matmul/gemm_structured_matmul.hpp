@@ -0,0 +1,77 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_GEMM_STRUCTURED_MATMUL_HPP
+#define CPU_MATMUL_GEMM_STRUCTURED_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+// Matmul with N:M structured sparse weights, e.g. the weights of an LLM
+// pruned with 2:4 sparsity. Only the kept values and their bitmasks are read
+// from memory. Each thread owns a block of dst columns, and decompresses the
+// weights of that block by chunks of rows into a dense buffer that stays in
+// cache and is passed to gemm together with all rows of src.
+struct gemm_structured_matmul_t : public primitive_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("gemm:jit:structured", gemm_structured_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        int sparse_n() const {
+            return weights_md()->format_desc.sparse_desc.structured_n;
+        }
+        int sparse_m() const {
+            return weights_md()->format_desc.sparse_desc.structured_m;
+        }
+
+        int nthr_ = 1;
+        dim_t n_blk_ = 0;
+        dim_t k_blk_ = 0;
+
+    private:
+        void init_conf();
+        void init_scratchpad();
+    };
+
+    gemm_structured_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    template <typename data_t>
+    status_t execute_impl(const exec_ctx_t &ctx) const;
+};
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
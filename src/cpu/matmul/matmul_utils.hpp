@@ -18,6 +18,7 @@
 #ifndef CPU_MATMUL_MATMUL_UTILS_HPP
 #define CPU_MATMUL_MATMUL_UTILS_HPP
 
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
 #include "common/tag_traits.hpp"
 #include "common/utils.hpp"
@@ -222,6 +223,44 @@ private:
     }
 };
 
+// COO sparse encodings are converted to CSR format by compressing the
+// respective row indices into CSR pointers. `pointers` must be zeroed.
+inline void cvt_coo_indices_to_csr_pointers(const int32_t *indices,
+        int32_t *pointers, const dim_t nnz, const dim_t nrows) {
+    parallel_nd(
+            nnz, [&](dim_t i) { fetch_and_add(&pointers[indices[i] + 1], 1); });
+    for (dim_t i = 0; i < nrows; ++i) {
+        pointers[i + 1] += pointers[i];
+    }
+}
+
+// Splits CSR rows between threads so that every thread gets about the same
+// amount of non-zero elements rather than of rows, as row lengths of sparse
+// data may differ by orders of magnitude. Each row also weighs as a single
+// element to account for a per-row overhead, e.g. storing an empty row.
+inline void balance_csr_rows(const int32_t *pointers, dim_t nrows, int nthr,
+        int ithr, dim_t &start, dim_t &end) {
+    // The weight of rows preceding row `m` is strictly increasing in `m`.
+    const auto weight = [&](dim_t m) {
+        return static_cast<dim_t>(pointers[m]) - pointers[0] + m;
+    };
+    const dim_t total = weight(nrows);
+    // Returns the first row with at least `w` weight preceding it.
+    const auto find_row = [&](dim_t w) {
+        dim_t lo = 0, hi = nrows;
+        while (lo < hi) {
+            const dim_t mid = lo + (hi - lo) / 2;
+            if (weight(mid) < w)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    };
+    start = find_row(utils::div_up(total * ithr, nthr));
+    end = find_row(utils::div_up(total * (ithr + 1), nthr));
+}
+
 } // namespace matmul
 } // namespace cpu
 } // namespace impl
@@ -15,11 +15,13 @@
 *******************************************************************************/
 
 #include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
 #include "common/math_utils.hpp"
 #include "common/type_helpers.hpp"
 
 #include "cpu/ref_io_helper.hpp"
 
+#include "cpu/matmul/matmul_utils.hpp"
 #include "cpu/matmul/ref_sparse_matmul.hpp"
 
 namespace dnnl {
@@ -27,7 +29,103 @@ namespace impl {
 namespace cpu {
 namespace matmul {
 
+namespace {
+
+template <typename data_t>
+float dot(const data_t *a, const data_t *b, dim_t b_stride, dim_t K) {
+    float acc = 0.f;
+    if (b_stride == 1) {
+        for (dim_t k = 0; k < K; k++)
+            acc += static_cast<float>(a[k]) * static_cast<float>(b[k]);
+    } else {
+        for (dim_t k = 0; k < K; k++)
+            acc += static_cast<float>(a[k])
+                    * static_cast<float>(b[k * b_stride]);
+    }
+    return acc;
+}
+
+template <typename data_t>
+void run_sddmm_kernel(const data_t *src, const data_t *wei, data_t *values,
+        const int32_t *row_buf, const int32_t *col_buf, bool is_csr,
+        dim_t nnz, dim_t M, dim_t K, dim_t wei_stride_k,
+        dim_t wei_stride_n) {
+    const auto compute = [&](dim_t i, dim_t m) {
+        const dim_t n = col_buf[i];
+        values[i] = static_cast<data_t>(dot(
+                src + m * K, wei + n * wei_stride_n, wei_stride_k, K));
+    };
+
+    if (is_csr) {
+        // The rows of the pattern may have very different numbers of
+        // entries, hence the rows are split by entries.
+        parallel(0, [&](const int ithr, const int nthr) {
+            dim_t m_start = 0, m_end = 0;
+            balance_csr_rows(row_buf, M, nthr, ithr, m_start, m_end);
+            for (dim_t m = m_start; m < m_end; m++)
+                for (dim_t i = row_buf[m]; i < row_buf[m + 1]; i++)
+                    compute(i, m);
+        });
+    } else {
+        parallel_nd(nnz, [&](dim_t i) { compute(i, row_buf[i]); });
+    }
+}
+
+} // namespace
+
+status_t ref_sparse_matmul_t::execute_sddmm(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto weights = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    auto dst_values = CTX_OUT_MEM(void *, DNNL_ARG_DST, 0);
+    auto dst_buffer_1 = CTX_IN_MEM(const int32_t *, DNNL_ARG_DST, 1);
+    auto dst_buffer_2 = CTX_IN_MEM(const int32_t *, DNNL_ARG_DST, 2);
+
+    const auto weights_d = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd()->weights_md());
+    const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+
+    const dim_t M = dst_d.dims()[0];
+    const dim_t N = dst_d.dims()[1];
+    const dim_t K = weights_d.dims()[0];
+    const dim_t nnz = dst_d.nnz();
+    const dim_t wei_stride_k = weights_d.blocking_desc().strides[0];
+    const dim_t wei_stride_n = weights_d.blocking_desc().strides[1];
+
+    // For CSR, index 1 - index buffer, index 2 - pointer buffer. For COO,
+    // index 1 - row indices, index 2 - column indices. The pattern is
+    // validated so that a wrong one does not lead to reads out of bounds.
+    const bool is_csr = dst_d.encoding() == sparse_encoding::csr;
+    const int32_t *row_buf = is_csr ? dst_buffer_2 : dst_buffer_1;
+    const int32_t *col_buf = is_csr ? dst_buffer_1 : dst_buffer_2;
+    for (dim_t i = 0; i < nnz; i++) {
+        if (col_buf[i] < 0 || col_buf[i] >= N) return status::invalid_arguments;
+        if (!is_csr && (row_buf[i] < 0 || row_buf[i] >= M))
+            return status::invalid_arguments;
+    }
+    if (is_csr) {
+        if (row_buf[0] != 0 || row_buf[M] != nnz)
+            return status::invalid_arguments;
+        for (dim_t m = 0; m < M; m++)
+            if (row_buf[m] > row_buf[m + 1]) return status::invalid_arguments;
+    }
+
+    if (dst_d.data_type() == data_type::f16)
+        run_sddmm_kernel(static_cast<const float16_t *>(src),
+                static_cast<const float16_t *>(weights),
+                static_cast<float16_t *>(dst_values), row_buf, col_buf, is_csr,
+                nnz, M, K, wei_stride_k, wei_stride_n);
+    else
+        run_sddmm_kernel(static_cast<const float *>(src),
+                static_cast<const float *>(weights),
+                static_cast<float *>(dst_values), row_buf, col_buf, is_csr,
+                nnz, M, K, wei_stride_k, wei_stride_n);
+
+    return status::success;
+}
+
 status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->dst_md()->format_kind == format_kind::sparse)
+        return execute_sddmm(ctx);
+
     status_t status = status::success;
     auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
     CHECK(status);
@@ -137,16 +235,6 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
     return status::success;
 }
 
-void ref_sparse_matmul_t::cvt_coo_indices_to_csr_pointers(
-        const int32_t *indices, int32_t *pointers, const int nnz,
-        const int nrows) const {
-    parallel_nd(
-            nnz, [&](dim_t i) { fetch_and_add(&pointers[indices[i] + 1], 1); });
-    for (int i = 0; i < nrows; ++i) {
-        pointers[i + 1] += pointers[i];
-    }
-}
-
 void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
         const int32_t *indices, const int32_t *pointers, void *res,
         const dim_t M, const dim_t N, const dim_t K, const data_type_t mm_dt,
@@ -155,23 +243,29 @@ void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
     if (is_src_sparse) {
         // With a sparse source tensor, the matrix multiplication is carried out
         // for a sparse multiplier with parallelization over the sparse rows
-        // of the multiplier matrix.
-        parallel_nd(M, [&](dim_t m) {
-            const dim_t row_start = pointers[m];
-            const dim_t row_end = pointers[m + 1];
-
-            for (dim_t n = 0; n < N; n++) {
-                const dim_t c_idx = m * N + n;
-                float c_val = io::load_float_value(mm_dt, res, c_idx);
-
-                for (dim_t k = row_start; k < row_end; k++) {
-                    const dim_t b_idx = indices[k] * N + n;
-                    const float a_val = io::load_float_value(mm_dt, values, k);
-                    const float b_val
-                            = io::load_float_value(mm_dt, dmat, b_idx);
-                    c_val += a_val * b_val;
+        // of the multiplier matrix. The rows may have very different numbers
+        // of non-zero elements, hence the rows are split by non-zeros.
+        parallel(0, [&](const int ithr, const int nthr) {
+            dim_t m_start = 0, m_end = 0;
+            balance_csr_rows(pointers, M, nthr, ithr, m_start, m_end);
+            for (dim_t m = m_start; m < m_end; m++) {
+                const dim_t row_start = pointers[m];
+                const dim_t row_end = pointers[m + 1];
+
+                for (dim_t n = 0; n < N; n++) {
+                    const dim_t c_idx = m * N + n;
+                    float c_val = io::load_float_value(mm_dt, res, c_idx);
+
+                    for (dim_t k = row_start; k < row_end; k++) {
+                        const dim_t b_idx = indices[k] * N + n;
+                        const float a_val
+                                = io::load_float_value(mm_dt, values, k);
+                        const float b_val
+                                = io::load_float_value(mm_dt, dmat, b_idx);
+                        c_val += a_val * b_val;
+                    }
+                    io::store_float_value(mm_dt, c_val, res, c_idx);
                 }
-                io::store_float_value(mm_dt, c_val, res, c_idx);
             }
         });
     } else {
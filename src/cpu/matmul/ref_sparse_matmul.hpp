@@ -43,11 +43,13 @@ struct ref_sparse_matmul_t : public primitive_t {
 
             memory_desc_wrapper src_d(src_md());
             memory_desc_wrapper wei_d(weights_md(0));
+            memory_desc_wrapper dst_d(dst_md(0));
 
-            VDISPATCH_MATMUL(wei_d.is_sparse_desc() || src_d.is_sparse_desc(),
-                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
-            VDISPATCH_MATMUL(wei_d.is_sparse_desc() ^ src_d.is_sparse_desc(),
-                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            // Exactly one of the tensors is sparse. A sparse dst describes
+            // the pattern of the entries to compute (SDDMM).
+            const int nsparse = src_d.is_sparse_desc() + wei_d.is_sparse_desc()
+                    + dst_d.is_sparse_desc();
+            VDISPATCH_MATMUL(nsparse == 1, VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
             VDISPATCH_MATMUL(IMPLICATION(src_d.is_sparse_desc(),
                                      utils::one_of(src_d.encoding(),
@@ -59,6 +61,11 @@ struct ref_sparse_matmul_t : public primitive_t {
                                              sparse_encoding::csr,
                                              sparse_encoding::coo)),
                     VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_MATMUL(IMPLICATION(dst_d.is_sparse_desc(),
+                                     utils::one_of(dst_d.encoding(),
+                                             sparse_encoding::csr,
+                                             sparse_encoding::coo)),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
             VDISPATCH_MATMUL(
                     utils::everyone_is(f16, src_type, wei_type, dst_type)
@@ -91,6 +98,17 @@ struct ref_sparse_matmul_t : public primitive_t {
                                         wei_d.metadata_type(1))),
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
             }
+            if (dst_d.is_sparse_desc()) {
+                VDISPATCH_MATMUL(
+                        IMPLICATION(dst_d.encoding() == sparse_encoding::coo,
+                                s32 == dst_d.metadata_type(0)),
+                        VERBOSE_UNSUPPORTED_SPARSE_CFG);
+                VDISPATCH_MATMUL(
+                        IMPLICATION(dst_d.encoding() == sparse_encoding::csr,
+                                utils::everyone_is(s32, dst_d.metadata_type(0),
+                                        dst_d.metadata_type(1))),
+                        VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            }
 
             VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
             VDISPATCH_MATMUL(
@@ -104,6 +122,12 @@ struct ref_sparse_matmul_t : public primitive_t {
 
         bool formats_ok(const memory_desc_wrapper &src_d,
                 const memory_desc_wrapper &wei_d) const {
+            // The weights of SDDMM may be transposed, e.g. the keys of an
+            // attention.
+            if (memory_desc_wrapper(dst_md()).is_sparse_desc())
+                return src_d.matches_one_of_tag(format_tag::ab)
+                        && wei_d.matches_one_of_tag(
+                                format_tag::ab, format_tag::ba);
             if (!memory_desc_wrapper(dst_md()).matches_one_of_tag(
                         format_tag::ab))
                 return false;
@@ -135,11 +159,6 @@ struct ref_sparse_matmul_t : public primitive_t {
 
     ref_sparse_matmul_t(const pd_t *apd) : primitive_t(apd) {}
 
-    // COO sparse encodings are converted to CSR format by
-    // compressing the respective row indices into CSR pointers.
-    void cvt_coo_indices_to_csr_pointers(const int32_t *indices,
-            int32_t *pointers, const int nnz, const int nrows) const;
-
     // Executes the matrix mutiplication, C = A x B where one of the input
     // matrices is dense. Operation indices are determined depending on
     // whether the mulitplier or multiplicand is dense
@@ -148,6 +167,10 @@ struct ref_sparse_matmul_t : public primitive_t {
             const dim_t M, const dim_t N, const dim_t K,
             const data_type_t mm_dt, bool is_src_sparse) const;
 
+    // Computes only the entries of dst given by its CSR or COO pattern, the
+    // dot products of the rows of src with the columns of the weights.
+    status_t execute_sddmm(const exec_ctx_t &ctx) const;
+
     status_t execute(const exec_ctx_t &ctx) const override;
 
 private:
@@ -0,0 +1,252 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_engine.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/matmul/split_dst_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+using namespace dnnl::impl::memory_tracking::names;
+
+namespace {
+// Copies `len` elements of `dt_size` bytes with a source stride of one element
+// and a destination stride of `dst_stride` elements.
+void copy_strided(char *dst, const char *src, dim_t len, dim_t dst_stride,
+        size_t dt_size) {
+    if (dst_stride == 1) {
+        std::memcpy(dst, src, len * dt_size);
+        return;
+    }
+    for (dim_t i = 0; i < len; i++)
+        std::memcpy(dst + i * dst_stride * dt_size, src + i * dt_size, dt_size);
+}
+} // namespace
+
+status_t split_dst_matmul_t::pd_t::init(engine_t *engine) {
+    VDISPATCH_MATMUL(with_dst_split(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(ndims() == 2, VERBOSE_BAD_NDIMS, "dst", ndims());
+    VDISPATCH_MATMUL(
+            !has_runtime_dims_or_strides(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(attr_ok(), VERBOSE_UNSUPPORTED_ATTR);
+
+    // A chunk of rows of the source is a strided view of the user memory.
+    if (memory_desc_wrapper(src_md_).format_any())
+        CHECK(memory_desc_init_by_strides(src_md_, nullptr));
+    VDISPATCH_MATMUL(
+            memory_desc_wrapper(src_md_).is_plain(), VERBOSE_UNSUPPORTED_TAG);
+
+    init_conf();
+    // The nested matmul picks the layout of the weights, which are read for
+    // every chunk of rows, and the tail one takes the same layout.
+    CHECK(init_matmul(engine, m_chunk_, matmul_pd_));
+    weights_md_ = *matmul_pd_->weights_md(0);
+    if (with_bias()) bias_md_ = *matmul_pd_->weights_md(1);
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    const dim_t m_tail = M() - (nchunks_ - 1) * m_chunk_;
+    if (m_tail != m_chunk_) CHECK(init_matmul(engine, m_tail, matmul_tail_pd_));
+
+    name_.append(matmul_pd_->name());
+    init_scratchpad();
+    return status::success;
+}
+
+bool split_dst_matmul_t::pd_t::attr_ok() const {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    const auto dst_dt = dst_md_.data_type;
+    if (!attr()->has_default_values(smask_t::dst_split | smask_t::scales_groups
+                    | smask_t::scales_data_type
+                    | smask_t::zero_points_groups
+                    | smask_t::zero_points_data_type | smask_t::post_ops
+                    | smask_t::fpmath_mode | smask_t::accumulation_mode,
+                dst_dt))
+        return false;
+
+    // A chunk of rows is computed with the attributes of the full problem,
+    // so the ones that change along the rows are not supported.
+    const auto &scales = attr()->scales_;
+    const auto &zero_points = attr()->zero_points_;
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_DST}) {
+        if (!scales.has_default_values(arg) && (scales.get_mask(arg) & 1))
+            return false;
+        if (!zero_points.has_default_values(arg)
+                && (zero_points.get_mask(arg) & 1))
+            return false;
+    }
+    return attr()->post_ops_.has_default_values({primitive_kind::eltwise});
+}
+
+void split_dst_matmul_t::pd_t::init_conf() {
+    const dim_t nthr = dnnl_get_max_threads();
+    const dim_t dt_size = types::data_type_size(dst_md_.data_type);
+
+    // The dst tile of a chunk takes about half of the L2 caches of the
+    // threads, and has enough rows to keep the nested matmul efficient.
+    const dim_t tile_size = nthr * platform::get_per_core_cache_size(2) / 2;
+    m_chunk_ = utils::rnd_dn(tile_size / (N() * dt_size), 16);
+    m_chunk_ = nstl::min(M(), nstl::max<dim_t>(m_chunk_, 64));
+    nchunks_ = utils::div_up(M(), m_chunk_);
+}
+
+status_t split_dst_matmul_t::pd_t::init_matmul(engine_t *engine, dim_t m,
+        std::shared_ptr<primitive_desc_t> &matmul_pd) const {
+    const memory_desc_wrapper src_d(src_md_);
+    memory_desc_t src_md, dst_md;
+
+    const dims_t src_dims = {m, K()};
+    CHECK(memory_desc_init_by_strides(src_md, 2, src_dims, src_d.data_type(),
+            src_d.blocking_desc().strides));
+    const dims_t dst_dims = {m, N()};
+    CHECK(memory_desc_init_by_tag(
+            dst_md, 2, dst_dims, dst_md_.data_type, format_tag::ab));
+
+    primitive_attr_t matmul_attr(*attr());
+    matmul_attr.dst_split_ = dst_split_t();
+
+    matmul_desc_t matmul_d = matmul_desc_t();
+    CHECK(matmul_desc_init(&matmul_d, &src_md, &weights_md_,
+            with_bias() ? &bias_md_ : nullptr, &dst_md));
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&matmul_d, &matmul_attr, nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+    if (++it == it.end()) return status::unimplemented;
+    matmul_pd = *it;
+    return status::success;
+}
+
+void split_dst_matmul_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_matmul_dst_in_acc_dt, m_chunk_ * N(),
+            types::data_type_size(dst_md_.data_type));
+    scratchpad.book(key_nested_multiple, matmul_pd_->scratchpad_registry());
+    if (matmul_tail_pd_)
+        scratchpad.book(key_nested_multiple + 1,
+                matmul_tail_pd_->scratchpad_registry());
+}
+
+status_t split_dst_matmul_t::init(engine_t *engine) {
+    CHECK(pd()->matmul_pd_->create_primitive(matmul_p_, engine));
+    if (pd()->matmul_tail_pd_)
+        CHECK(pd()->matmul_tail_pd_->create_primitive(matmul_tail_p_, engine));
+    return status::success;
+}
+
+status_t split_dst_matmul_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    const auto *src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+
+    const auto &parts = pd()->attr()->dst_split_.mds_;
+    const int nparts = static_cast<int>(parts.size());
+    std::vector<char *> part_ptrs(nparts);
+    std::vector<dim_t> part_n0(nparts);
+    dim_t n0 = 0;
+    for (int p = 0; p < nparts; p++) {
+        part_ptrs[p] = CTX_OUT_CLEAN_MEM(
+                char *, DNNL_ARG_MULTIPLE_DST + p, status);
+        CHECK(status);
+        part_n0[p] = n0;
+        n0 += parts[p].dims[1] * parts[p].dims[3];
+    }
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const size_t dt_size = types::data_type_size(pd()->dst_md()->data_type);
+
+    const dim_t M = pd()->M();
+    const dim_t N = pd()->N();
+    const dim_t m_chunk = pd()->m_chunk_;
+    const dim_t nchunks = pd()->nchunks_;
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    char *tile = scratchpad.template get<char>(key_matmul_dst_in_acc_dt);
+
+    // The chunks of rows are passed to the nested matmul as raw CPU
+    // pointers, which only the classic CPU engine can wrap.
+    engine_t *service_engine = get_service_engine();
+    constexpr auto mem_flag = memory_flags_t::use_runtime_ptr;
+
+    for (dim_t c = 0; c < nchunks; c++) {
+        const dim_t m_start = c * m_chunk;
+        const dim_t m_len = nstl::min(m_chunk, M - m_start);
+        const bool is_tail = m_len != m_chunk;
+        const auto &matmul_p = is_tail ? matmul_tail_p_ : matmul_p_;
+        const auto *matmul_pd = matmul_p->pd().get();
+
+        const char *src_ptr = src
+                + (src_d.offset0() + m_start * src_d.blocking_desc().strides[0])
+                        * src_d.data_type_size();
+        std::unique_ptr<memory_t, memory_deleter_t> src_mem;
+        CHECK(safe_ptr_assign(src_mem,
+                new memory_t(service_engine, matmul_pd->src_md(0), mem_flag,
+                        const_cast<char *>(src_ptr))));
+        std::unique_ptr<memory_t, memory_deleter_t> tile_mem;
+        CHECK(safe_ptr_assign(tile_mem,
+                new memory_t(service_engine, matmul_pd->dst_md(), mem_flag,
+                        tile)));
+
+        exec_args_t matmul_args = ctx.args(); // copy args to include scales.
+        matmul_args[DNNL_ARG_SRC] = {src_mem.get(), true};
+        matmul_args[DNNL_ARG_DST] = {tile_mem.get(), false};
+        exec_ctx_t matmul_ctx(ctx, std::move(matmul_args));
+
+        nested_scratchpad_t ns(ctx, key_nested_multiple + is_tail, matmul_p);
+        matmul_ctx.set_scratchpad_grantor(ns.grantor());
+        CHECK(matmul_p->execute(matmul_ctx));
+
+        // Scatter the heads of the chunk to the parts while the tile is in
+        // cache. Row `m` of dst is the sequence position `m % S` of the
+        // batch `m / S` of every part.
+        parallel_nd(m_len, nparts, [&](dim_t ml, dim_t p) {
+            const memory_desc_wrapper part_d(parts[p]);
+            const auto &strides = part_d.blocking_desc().strides;
+            const dim_t H = part_d.dims()[1];
+            const dim_t S = part_d.dims()[2];
+            const dim_t D = part_d.dims()[3];
+            const dim_t m = m_start + ml;
+            const dim_t b = m / S, s = m % S;
+            const char *row = tile + (ml * N + part_n0[p]) * dt_size;
+            char *part = part_ptrs[p]
+                    + (part_d.offset0() + b * strides[0] + s * strides[2])
+                            * dt_size;
+            for (dim_t h = 0; h < H; h++)
+                copy_strided(part + h * strides[1] * dt_size,
+                        row + h * D * dt_size, D, strides[3], dt_size);
+        });
+    }
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,268 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/arg_reduction_utils.hpp"
+#include "cpu/cpu_engine.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/matmul/top_k_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+using namespace dnnl::impl::memory_tracking::names;
+
+status_t top_k_matmul_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_MATMUL(with_top_k(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(ndims() == 2, VERBOSE_BAD_NDIMS, "dst", ndims());
+    VDISPATCH_MATMUL(
+            !has_runtime_dims_or_strides(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(utils::one_of(dst_md_.data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+
+    // A chunk of columns of dst is computed with the same columns of the
+    // attributes, so only the ones common to all columns are supported.
+    VDISPATCH_MATMUL(attr()->has_default_values(smask_t::top_k
+                                     | smask_t::scales | smask_t::post_ops
+                                     | smask_t::fpmath_mode
+                                     | smask_t::accumulation_mode,
+                             dst_md_.data_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+    const auto &scales = attr()->scales_;
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST})
+        VDISPATCH_MATMUL(IMPLICATION(!scales.has_default_values(arg),
+                                 scales.get_mask(arg) == 0),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(
+            attr()->post_ops_.has_default_values({primitive_kind::eltwise}),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_MATMUL(IMPLICATION(with_bias(), is_bias_1xN()),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+
+    // A chunk of columns of the weights and of the bias is a strided view of
+    // the user memory.
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    const bool bias_ok = IMPLICATION(
+            with_bias(), memory_desc_wrapper(bias_md_).is_plain());
+    VDISPATCH_MATMUL(memory_desc_wrapper(weights_md_).is_plain() && bias_ok,
+            VERBOSE_UNSUPPORTED_TAG);
+
+    init_conf();
+    CHECK(init_matmul(engine, n_chunk_, matmul_pd_));
+    const dim_t n_tail = N() - (nchunks_ - 1) * n_chunk_;
+    if (n_tail != n_chunk_) CHECK(init_matmul(engine, n_tail, matmul_tail_pd_));
+
+    name_.append(matmul_pd_->name());
+    init_scratchpad();
+    return status::success;
+}
+
+void top_k_matmul_t::pd_t::init_conf() {
+    const dim_t nthr = dnnl_get_max_threads();
+    const dim_t dt_size = types::data_type_size(dst_md_.data_type);
+
+    // The dst tile of a chunk takes about half of the L2 caches of the
+    // threads, and has enough columns to keep the nested matmul efficient.
+    const dim_t tile_size = nthr * platform::get_per_core_cache_size(2) / 2;
+    n_chunk_ = utils::rnd_dn(tile_size / (M() * dt_size), 64);
+    n_chunk_ = nstl::min(N(), nstl::max<dim_t>(n_chunk_, 256));
+    nchunks_ = utils::div_up(N(), n_chunk_);
+
+    nslots_ = nstl::max<dim_t>(
+            1, nstl::min(utils::div_up(nthr, M()), n_chunk_ / 64));
+    slot_size_ = utils::div_up(n_chunk_, nslots_);
+}
+
+status_t top_k_matmul_t::pd_t::init_matmul(engine_t *engine, dim_t n,
+        std::shared_ptr<primitive_desc_t> &matmul_pd) const {
+    const memory_desc_wrapper wei_d(weights_md_);
+    memory_desc_t wei_md, bia_md, dst_md;
+
+    const dims_t wei_dims = {K(), n};
+    CHECK(memory_desc_init_by_strides(wei_md, 2, wei_dims, wei_d.data_type(),
+            wei_d.blocking_desc().strides));
+    if (with_bias()) {
+        const memory_desc_wrapper bia_d(bias_md_);
+        const dims_t bia_dims = {1, n};
+        CHECK(memory_desc_init_by_strides(bia_md, 2, bia_dims,
+                bia_d.data_type(), bia_d.blocking_desc().strides));
+    }
+    const dims_t dst_dims = {M(), n};
+    CHECK(memory_desc_init_by_tag(
+            dst_md, 2, dst_dims, dst_md_.data_type, format_tag::ab));
+
+    primitive_attr_t matmul_attr(*attr());
+    matmul_attr.top_k_ = 0;
+
+    matmul_desc_t matmul_d = matmul_desc_t();
+    CHECK(matmul_desc_init(&matmul_d, &src_md_, &wei_md,
+            with_bias() ? &bia_md : nullptr, &dst_md));
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&matmul_d, &matmul_attr, nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+    if (++it == it.end()) return status::unimplemented;
+    matmul_pd = *it;
+    return status::success;
+}
+
+void top_k_matmul_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_matmul_dst_in_acc_dt, M() * n_chunk_,
+            types::data_type_size(dst_md_.data_type));
+    scratchpad.book(key_nested_multiple, matmul_pd_->scratchpad_registry());
+    if (matmul_tail_pd_)
+        scratchpad.book(key_nested_multiple + 1,
+                matmul_tail_pd_->scratchpad_registry());
+}
+
+status_t top_k_matmul_t::init(engine_t *engine) {
+    CHECK(pd()->matmul_pd_->create_primitive(matmul_p_, engine));
+    if (pd()->matmul_tail_pd_)
+        CHECK(pd()->matmul_tail_pd_->create_primitive(matmul_tail_p_, engine));
+    return status::success;
+}
+
+status_t top_k_matmul_t::execute(const exec_ctx_t &ctx) const {
+    using arg_reduction_utils::top_k_t;
+
+    status_t status = status::success;
+    const auto *wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto *bia = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto *values
+            = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_ATTR_TOP_K_VALUES, status);
+    CHECK(status);
+    auto *indices = CTX_OUT_CLEAN_MEM(
+            int32_t *, DNNL_ARG_ATTR_TOP_K_INDICES, status);
+    CHECK(status);
+
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const memory_desc_wrapper bia_d(pd()->weights_md(1));
+    const memory_desc_wrapper values_d(
+            pd()->arg_md(DNNL_ARG_ATTR_TOP_K_VALUES));
+    const memory_desc_wrapper indices_d(
+            pd()->arg_md(DNNL_ARG_ATTR_TOP_K_INDICES));
+    const auto dst_dt = pd()->dst_md()->data_type;
+
+    const dim_t M = pd()->M();
+    const dim_t N = pd()->N();
+    const dim_t k = pd()->attr()->top_k_;
+    const dim_t n_chunk = pd()->n_chunk_;
+    const dim_t nchunks = pd()->nchunks_;
+    const dim_t nslots = pd()->nslots_;
+    const dim_t slot_size = pd()->slot_size_;
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    char *tile = scratchpad.template get<char>(key_matmul_dst_in_acc_dt);
+
+    // The chunks of columns are passed to the nested matmul as raw CPU
+    // pointers, which only the classic CPU engine can wrap.
+    engine_t *service_engine = get_service_engine();
+    constexpr auto mem_flag = memory_flags_t::use_runtime_ptr;
+
+    std::vector<top_k_t> heaps(M * nslots, top_k_t(k));
+    for (dim_t c = 0; c < nchunks; c++) {
+        const dim_t n_start = c * n_chunk;
+        const dim_t n_len = nstl::min(n_chunk, N - n_start);
+        const bool is_tail = n_len != n_chunk;
+        const auto &matmul_p = is_tail ? matmul_tail_p_ : matmul_p_;
+        const auto *matmul_pd = matmul_p->pd().get();
+
+        const char *wei_ptr = wei
+                + (wei_d.offset0() + n_start * wei_d.blocking_desc().strides[1])
+                        * wei_d.data_type_size();
+        std::unique_ptr<memory_t, memory_deleter_t> wei_mem;
+        CHECK(safe_ptr_assign(wei_mem,
+                new memory_t(service_engine, matmul_pd->weights_md(0),
+                        mem_flag, const_cast<char *>(wei_ptr))));
+        std::unique_ptr<memory_t, memory_deleter_t> bia_mem;
+        if (pd()->with_bias()) {
+            const char *bia_ptr = bia
+                    + (bia_d.offset0()
+                              + n_start * bia_d.blocking_desc().strides[1])
+                            * bia_d.data_type_size();
+            CHECK(safe_ptr_assign(bia_mem,
+                    new memory_t(service_engine, matmul_pd->weights_md(1),
+                            mem_flag, const_cast<char *>(bia_ptr))));
+        }
+        std::unique_ptr<memory_t, memory_deleter_t> tile_mem;
+        CHECK(safe_ptr_assign(tile_mem,
+                new memory_t(service_engine, matmul_pd->dst_md(), mem_flag,
+                        tile)));
+
+        exec_args_t matmul_args = ctx.args(); // copy args to include scales.
+        matmul_args[DNNL_ARG_WEIGHTS] = {wei_mem.get(), true};
+        if (pd()->with_bias())
+            matmul_args[DNNL_ARG_BIAS] = {bia_mem.get(), true};
+        matmul_args[DNNL_ARG_DST] = {tile_mem.get(), false};
+        exec_ctx_t matmul_ctx(ctx, std::move(matmul_args));
+
+        nested_scratchpad_t ns(ctx, key_nested_multiple + is_tail, matmul_p);
+        matmul_ctx.set_scratchpad_grantor(ns.grantor());
+        CHECK(matmul_p->execute(matmul_ctx));
+
+        // Fold the chunk into the heaps while the tile is in cache.
+        parallel_nd(M, nslots, [&](dim_t m, dim_t s) {
+            constexpr dim_t block_size = arg_reduction_utils::block_size;
+            const dim_t start = s * slot_size;
+            const dim_t end = nstl::min(n_len, start + slot_size);
+            auto &top_k = heaps[m * nslots + s];
+            float vals[block_size];
+            for (dim_t n = start; n < end; n += block_size) {
+                const dim_t len = nstl::min(block_size, end - n);
+                arg_reduction_utils::load_values(
+                        vals, tile, dst_dt, m * n_len + n, len, false);
+                top_k.push_block(vals, len, n_start + n);
+            }
+        });
+    }
+
+    parallel_nd(M, [&](dim_t m) {
+        auto &top_k = heaps[m * nslots];
+        for (dim_t s = 1; s < nslots; s++)
+            top_k.merge(heaps[m * nslots + s]);
+        top_k.sort();
+
+        std::vector<float> vals(k);
+        top_k.get(vals.data(), indices + indices_d.off(m, 0));
+        for (dim_t i = 0; i < k; i++)
+            io::store_float_value(values_d.data_type(), vals[i], values,
+                    values_d.off(m, i));
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_TOP_K_MATMUL_HPP
+#define CPU_MATMUL_TOP_K_MATMUL_HPP
+
+#include <memory>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+// Matmul that keeps the `k` largest values of each dst row, e.g. the logits
+// of a language model head. The columns of dst are computed in chunks by a
+// nested matmul into a scratchpad tile that stays in cache, and each chunk
+// is folded into running top-k heaps right away. So the full dst is neither
+// written to nor read back from memory. Every row has several heaps, each
+// for a range of the columns of a chunk, so that few rows still use all the
+// threads. The heaps of a row are merged at the end.
+struct top_k_matmul_t : public primitive_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(name_.c_str(), top_k_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // Nested matmuls for a chunk of columns and for the last one.
+        std::shared_ptr<primitive_desc_t> matmul_pd_;
+        std::shared_ptr<primitive_desc_t> matmul_tail_pd_;
+
+        // The number of columns of a chunk and the number of chunks.
+        dim_t n_chunk_ = 0;
+        dim_t nchunks_ = 1;
+        // The number of heaps per row and of columns they take in a chunk.
+        dim_t nslots_ = 1;
+        dim_t slot_size_ = 0;
+
+    private:
+        std::string name_ = "top_k:";
+
+        void init_conf();
+        status_t init_matmul(engine_t *engine, dim_t n,
+                std::shared_ptr<primitive_desc_t> &matmul_pd) const;
+        void init_scratchpad();
+    };
+
+    top_k_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::shared_ptr<primitive_t> matmul_p_;
+    std::shared_ptr<primitive_t> matmul_tail_p_;
+};
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
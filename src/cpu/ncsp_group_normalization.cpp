@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/normalization_utils.hpp"
 #include "cpu/ref_io_helper.hpp"
 
 #include "cpu/ncsp_group_normalization.hpp"
@@ -84,50 +85,37 @@ status_t ncsp_group_normalization_fwd_t::execute_forward(
         float m = 0.0f;
         float v = 0.0f;
         if (calculate_stats) {
-            for (dim_t c = get_c_start(g); c < get_c_start(g + 1); ++c) {
-                const size_t s_off = (size_t)n * C * SP + c * SP;
-                const char *__restrict _src
-                        = reinterpret_cast<const char *>(src)
-                        + s_off * src_d.data_type_size();
-                for (dim_t sp_block = 0; sp_block < n_sp_block; sp_block++) {
-                    const float *__restrict src_f32 {nullptr};
-                    if (src_dt != data_type::f32) {
-                        float *tmp = cvt_scratch + sp_block_nelems * ithr;
-                        for (dim_t sp = 0; sp < sp_block_nelems; ++sp)
-                            tmp[sp] = io::load_float_value(
-                                    src_d.data_type(), _src, sp);
-                        src_f32 = tmp;
-                    } else {
-                        src_f32 = reinterpret_cast<const float *__restrict>(
-                                _src);
-                    }
-                    PRAGMA_OMP_SIMD(reduction(+ : m))
-                    for (dim_t sp = 0; sp < sp_block_nelems; sp++) {
-                        float s = src_f32[sp];
-                        m += s;
-                    }
-                    _src += sp_block_nelems * src_d.data_type_size();
+            // Each block of spatial points is reduced twice while it is still
+            // in cache: to its mean and then to its sum of squared deviations.
+            // Statistics of the blocks are merged, so the source is read from
+            // memory once.
+            normalization_utils::welford_stat_t stat;
+            const auto accumulate_block = [&](const char *__restrict _src,
+                                                  dim_t nelems) {
+                const float *__restrict src_f32 {nullptr};
+                if (src_dt != data_type::f32) {
+                    float *tmp = cvt_scratch + sp_block_nelems * ithr;
+                    for (dim_t sp = 0; sp < nelems; ++sp)
+                        tmp[sp] = io::load_float_value(
+                                src_d.data_type(), _src, sp);
+                    src_f32 = tmp;
+                } else {
+                    src_f32 = reinterpret_cast<const float *__restrict>(_src);
                 }
-                if (sp_block_reminder) {
-                    const float *__restrict src_f32 {nullptr};
-                    if (src_dt != data_type::f32) {
-                        float *tmp = cvt_scratch + sp_block_nelems * ithr;
-                        for (dim_t sp = 0; sp < sp_block_reminder; ++sp)
-                            tmp[sp] = io::load_float_value(
-                                    src_d.data_type(), _src, sp);
-                        src_f32 = tmp;
-                    } else {
-                        src_f32 = reinterpret_cast<const float *__restrict>(
-                                _src);
-                    }
-                    PRAGMA_OMP_SIMD(reduction(+ : m))
-                    for (dim_t sp = 0; sp < sp_block_reminder; sp++) {
-                        float s = src_f32[sp];
-                        m += s;
-                    }
+                float block_m = 0.0f;
+                PRAGMA_OMP_SIMD(reduction(+ : block_m))
+                for (dim_t sp = 0; sp < nelems; sp++) {
+                    block_m += src_f32[sp];
                 }
-            }
-            m /= SP * C_PER_G;
+                block_m /= nelems;
+                float block_m2 = 0.0f;
+                PRAGMA_OMP_SIMD(reduction(+ : block_m2))
+                for (dim_t sp = 0; sp < nelems; sp++) {
+                    float s0 = src_f32[sp] - block_m;
+                    block_m2 += s0 * s0;
+                }
+                stat.merge(nelems, block_m, block_m2);
+            };
 
             for (dim_t c = get_c_start(g); c < get_c_start(g + 1); ++c) {
                 const size_t s_off = (size_t)n * C * SP + c * SP;
@@ -135,46 +123,14 @@ status_t ncsp_group_normalization_fwd_t::execute_forward(
                         = reinterpret_cast<const char *>(src)
                         + s_off * src_d.data_type_size();
                 for (dim_t sp_block = 0; sp_block < n_sp_block; sp_block++) {
-                    const float *__restrict src_f32 {nullptr};
-                    if (src_dt != data_type::f32) {
-                        float *tmp = cvt_scratch + sp_block_nelems * ithr;
-                        for (dim_t sp = 0; sp < sp_block_nelems; ++sp)
-                            tmp[sp] = io::load_float_value(
-                                    src_d.data_type(), _src, sp);
-                        src_f32 = tmp;
-                    } else {
-                        src_f32 = reinterpret_cast<const float *__restrict>(
-                                _src);
-                    }
-                    PRAGMA_OMP_SIMD(reduction(+ : v))
-                    for (dim_t sp = 0; sp < sp_block_nelems; sp++) {
-                        float s = src_f32[sp];
-                        float s0 = s - m;
-                        v += s0 * s0;
-                    }
+                    accumulate_block(_src, sp_block_nelems);
                     _src += sp_block_nelems * src_d.data_type_size();
                 }
-                if (sp_block_reminder) {
-                    const float *__restrict src_f32 {nullptr};
-                    if (src_dt != data_type::f32) {
-                        float *tmp = cvt_scratch + sp_block_nelems * ithr;
-                        for (dim_t sp = 0; sp < sp_block_reminder; ++sp)
-                            tmp[sp] = io::load_float_value(
-                                    src_d.data_type(), _src, sp);
-                        src_f32 = tmp;
-                    } else {
-                        src_f32 = reinterpret_cast<const float *__restrict>(
-                                _src);
-                    }
-                    PRAGMA_OMP_SIMD(reduction(+ : v))
-                    for (dim_t sp = 0; sp < sp_block_reminder; sp++) {
-                        float s = src_f32[sp];
-                        float s0 = s - m;
-                        v += s0 * s0;
-                    }
-                }
+                if (sp_block_reminder)
+                    accumulate_block(_src, sp_block_reminder);
             }
-            v /= SP * C_PER_G;
+            m = stat.mean();
+            v = stat.variance();
         } else {
             m = mean[n * G + g];
             v = variance[n * G + g];
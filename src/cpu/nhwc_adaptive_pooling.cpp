@@ -0,0 +1,352 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "common/bfloat16.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/nstl.hpp"
+
+#include "cpu/nhwc_adaptive_pooling.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/simple_q10n.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// Returns `len` source values converted to f32. Only the types that are not
+// f32 are converted into `buf`.
+inline const float *load_block(float *buf, const float *src, dim_t len) {
+    MAYBE_UNUSED(buf);
+    MAYBE_UNUSED(len);
+    return src;
+}
+
+inline const float *load_block(float *buf, const bfloat16_t *src, dim_t len) {
+    cvt_bfloat16_to_float(buf, src, len);
+    return buf;
+}
+
+inline const float *load_block(float *buf, const float16_t *src, dim_t len) {
+    cvt_float16_to_float(buf, src, len);
+    return buf;
+}
+
+template <typename data_t>
+inline const float *load_block(float *buf, const data_t *src, dim_t len) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t c = 0; c < len; c++)
+        buf[c] = static_cast<float>(src[c]);
+    return buf;
+}
+
+inline void store_block(float *dst, const float *vals, dim_t len) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t c = 0; c < len; c++)
+        dst[c] = vals[c];
+}
+
+inline void store_block(bfloat16_t *dst, const float *vals, dim_t len) {
+    cvt_float_to_bfloat16(dst, vals, len);
+}
+
+inline void store_block(float16_t *dst, const float *vals, dim_t len) {
+    cvt_float_to_float16(dst, vals, len);
+}
+
+template <typename data_t>
+inline void store_block(data_t *dst, const float *vals, dim_t len) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t c = 0; c < len; c++)
+        dst[c] = q10n::saturate_and_round<data_t>(vals[c]);
+}
+
+// The source points taken by a destination point.
+struct window_t {
+    window_t(const pooling_pd_t *pd, dim_t od, dim_t oh, dim_t ow)
+        : d_start(adaptive_pooling_start(od, pd->OD(), pd->ID()))
+        , d_end(adaptive_pooling_end(od, pd->OD(), pd->ID()))
+        , h_start(adaptive_pooling_start(oh, pd->OH(), pd->IH()))
+        , h_end(adaptive_pooling_end(oh, pd->OH(), pd->IH()))
+        , w_start(adaptive_pooling_start(ow, pd->OW(), pd->IW()))
+        , w_end(adaptive_pooling_end(ow, pd->OW(), pd->IW())) {}
+
+    // The rows of the window are its pairs of depth and height.
+    dim_t nrows() const { return (d_end - d_start) * (h_end - h_start); }
+    dim_t size() const { return nrows() * (w_end - w_start); }
+
+    dim_t d_start, d_end;
+    dim_t h_start, h_end;
+    dim_t w_start, w_end;
+};
+
+} // namespace
+
+template <data_type_t d_type>
+constexpr dim_t nhwc_adaptive_pooling_fwd_t<d_type>::c_block_max;
+
+template <data_type_t d_type>
+status_t nhwc_adaptive_pooling_fwd_t<d_type>::pd_t::init(engine_t *engine) {
+    using namespace alg_kind;
+    using namespace format_tag;
+    using sm = primitive_attr_t::skip_mask_t;
+
+    const auto alg = desc()->alg_kind;
+    VDISPATCH_POOLING(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_POOLING(is_adaptive() || is_global(),
+            VERBOSE_UNSUPPORTED_FEATURE, "non-adaptive window");
+    // The global max pooling keeps a workspace for training.
+    const bool is_inference = desc()->prop_kind == prop_kind::forward_inference;
+    VDISPATCH_POOLING(IMPLICATION(alg == pooling_max, is_inference),
+            VERBOSE_UNSUPPORTED_FEATURE, "workspace");
+    VDISPATCH_POOLING(utils::everyone_is(d_type, src_md()->data_type,
+                              dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_POOLING(
+            platform::has_data_type_support(d_type), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_POOLING(attr()->has_default_values(sm::post_ops, d_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_POOLING(ref_post_ops_t::primitive_kind_ok(attr()->post_ops_),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_POOLING(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_POOLING(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+
+    const format_tag_t desired_fmt_tag
+            = utils::pick(ndims() - 3, nwc, nhwc, ndhwc);
+    VDISPATCH_POOLING(memory_desc_matches_tag(*src_md(), desired_fmt_tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VDISPATCH_POOLING(memory_desc_matches_tag(*dst_md(), desired_fmt_tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+    VDISPATCH_POOLING(attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    init_conf();
+    init_scratchpad();
+    return status::success;
+}
+
+template <data_type_t d_type>
+void nhwc_adaptive_pooling_fwd_t<d_type>::pd_t::init_conf() {
+    c_block_ = nstl::min(IC(), c_block_max);
+    nb_c_ = utils::div_up(IC(), c_block_);
+
+    // A global window is split only when there are fewer blocks of work than
+    // threads. A slice reads at least a few pages of the source.
+    nsplit_ = 1;
+    slice_rows_ = ID() * IH();
+    const dim_t nthr = dnnl_get_max_threads();
+    const dim_t work = MB() * OD() * OH() * OW() * nb_c_;
+    if (!is_global() || work >= nthr) return;
+
+    const dim_t nrows = ID() * IH();
+    const dim_t min_rows = utils::div_up(4096, IW() * c_block_);
+    nsplit_ = nstl::max<dim_t>(
+            1, nstl::min(utils::div_up(nthr, work), nrows / min_rows));
+    slice_rows_ = utils::div_up(nrows, nsplit_);
+    nsplit_ = utils::div_up(nrows, slice_rows_);
+}
+
+template <data_type_t d_type>
+void nhwc_adaptive_pooling_fwd_t<d_type>::pd_t::init_scratchpad() {
+    if (nsplit_ == 1) return;
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_pool_reduction, MB() * nb_c_ * nsplit_ * c_block_);
+}
+
+template <data_type_t d_type>
+status_t nhwc_adaptive_pooling_fwd_t<d_type>::execute(
+        const exec_ctx_t &ctx) const {
+    using namespace alg_kind;
+
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(data_t *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    src += src_d.offset0();
+    dst += dst_d.offset0();
+
+    const int ndims = pd()->ndims();
+    const auto &src_str = src_d.blocking_desc().strides;
+    const auto &dst_str = dst_d.blocking_desc().strides;
+    const dim_t src_n_str = src_str[0];
+    const dim_t src_d_str = ndims == 5 ? src_str[2] : 0;
+    const dim_t src_h_str = ndims >= 4 ? src_str[ndims - 2] : 0;
+    const dim_t src_w_str = src_str[ndims - 1];
+    const dim_t dst_n_str = dst_str[0];
+    const dim_t dst_d_str = ndims == 5 ? dst_str[2] : 0;
+    const dim_t dst_h_str = ndims >= 4 ? dst_str[ndims - 2] : 0;
+    const dim_t dst_w_str = dst_str[ndims - 1];
+
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->OC();
+    const dim_t OD = pd()->OD();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t OSP = OD * OH * OW;
+    const dim_t c_block = pd()->c_block_;
+    const dim_t nb_c = pd()->nb_c_;
+    const dim_t nsplit = pd()->nsplit_;
+    const dim_t slice_rows = pd()->slice_rows_;
+
+    const auto alg = pd()->desc()->alg_kind;
+    const bool is_max = utils::one_of(alg, pooling_max, pooling_adaptive_max);
+    const bool are_postops_set = !pd()->attr()->post_ops_.entry_.empty();
+
+    const auto init_acc = [&](float *acc, dim_t len) {
+        utils::array_set(acc, is_max ? -INFINITY : 0.f, len);
+    };
+
+    // Reduces the rows [r_start, r_end) of the window `w` for the `len`
+    // channels starting at `c0`.
+    const auto reduce_rows = [&](float *acc, dim_t mb, dim_t c0, dim_t len,
+                                     const window_t &w, dim_t r_start,
+                                     dim_t r_end) {
+        float buf[c_block_max];
+        float row_acc[c_block_max];
+        const dim_t row_h = w.h_end - w.h_start;
+        for (dim_t r = r_start; r < r_end; r++) {
+            const dim_t id = w.d_start + r / row_h;
+            const dim_t ih = w.h_start + r % row_h;
+            const data_t *row = src + mb * src_n_str + id * src_d_str
+                    + ih * src_h_str + c0;
+            if (is_max) {
+                for (dim_t iw = w.w_start; iw < w.w_end; iw++) {
+                    const float *s = load_block(buf, row + iw * src_w_str, len);
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t c = 0; c < len; c++)
+                        acc[c] = nstl::max(acc[c], s[c]);
+                }
+                continue;
+            }
+            utils::array_set(row_acc, 0.f, len);
+            for (dim_t iw = w.w_start; iw < w.w_end; iw++) {
+                const float *s = load_block(buf, row + iw * src_w_str, len);
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < len; c++)
+                    row_acc[c] += s[c];
+            }
+            PRAGMA_OMP_SIMD()
+            for (dim_t c = 0; c < len; c++)
+                acc[c] += row_acc[c];
+        }
+    };
+
+    // Applies the average and the post-ops and writes the result.
+    const auto finalize = [&](float *acc, dim_t mb, dim_t c0, dim_t len,
+                                  const window_t &w, dim_t od, dim_t oh,
+                                  dim_t ow) {
+        if (!is_max) {
+            const float size = static_cast<float>(w.size());
+            PRAGMA_OMP_SIMD()
+            for (dim_t c = 0; c < len; c++)
+                acc[c] /= size;
+        }
+        if (are_postops_set) {
+            ref_post_ops_t::args_t args;
+            args.ctx = &ctx;
+            args.dst_md = pd()->dst_md();
+            args.l_offset = (mb * C + c0) * OSP + (od * OH + oh) * OW + ow;
+            for (dim_t c = 0; c < len; c++) {
+                ref_post_ops_->execute(acc[c], args);
+                args.l_offset += OSP;
+            }
+        }
+        data_t *d = dst + mb * dst_n_str + od * dst_d_str + oh * dst_h_str
+                + ow * dst_w_str + c0;
+        store_block(d, acc, len);
+    };
+
+    if (nsplit == 1) {
+        parallel_nd(MB, OD, OH, OW, nb_c,
+                [&](dim_t mb, dim_t od, dim_t oh, dim_t ow, dim_t cb) {
+                    const dim_t c0 = cb * c_block;
+                    const dim_t len = nstl::min(c_block, C - c0);
+                    const window_t w(pd(), od, oh, ow);
+                    float acc[c_block_max];
+                    init_acc(acc, len);
+                    reduce_rows(acc, mb, c0, len, w, 0, w.nrows());
+                    finalize(acc, mb, c0, len, w, od, oh, ow);
+                });
+        return status::success;
+    }
+
+    // A split window is global, so there is a single destination point.
+    const window_t w(pd(), 0, 0, 0);
+    const dim_t nrows = w.nrows();
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *partial = scratchpad.template get<float>(
+            memory_tracking::names::key_pool_reduction);
+    const auto partial_ptr = [&](dim_t mb, dim_t cb, dim_t s) {
+        return partial + ((mb * nb_c + cb) * nsplit + s) * c_block;
+    };
+
+    parallel_nd(MB, nb_c, nsplit, [&](dim_t mb, dim_t cb, dim_t s) {
+        const dim_t c0 = cb * c_block;
+        const dim_t len = nstl::min(c_block, C - c0);
+        const dim_t r_start = s * slice_rows;
+        const dim_t r_end = nstl::min(nrows, r_start + slice_rows);
+        float *acc = partial_ptr(mb, cb, s);
+        init_acc(acc, len);
+        reduce_rows(acc, mb, c0, len, w, r_start, r_end);
+    });
+
+    // Combines the slices pairwise.
+    parallel_nd(MB, nb_c, [&](dim_t mb, dim_t cb) {
+        const dim_t c0 = cb * c_block;
+        const dim_t len = nstl::min(c_block, C - c0);
+        for (dim_t step = 1; step < nsplit; step *= 2) {
+            for (dim_t s = 0; s + step < nsplit; s += 2 * step) {
+                float *acc = partial_ptr(mb, cb, s);
+                const float *other = partial_ptr(mb, cb, s + step);
+                if (is_max) {
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t c = 0; c < len; c++)
+                        acc[c] = nstl::max(acc[c], other[c]);
+                } else {
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t c = 0; c < len; c++)
+                        acc[c] += other[c];
+                }
+            }
+        }
+        finalize(partial_ptr(mb, cb, 0), mb, c0, len, w, 0, 0, 0);
+    });
+
+    return status::success;
+}
+
+template struct nhwc_adaptive_pooling_fwd_t<data_type::f32>;
+template struct nhwc_adaptive_pooling_fwd_t<data_type::bf16>;
+template struct nhwc_adaptive_pooling_fwd_t<data_type::f16>;
+template struct nhwc_adaptive_pooling_fwd_t<data_type::s8>;
+template struct nhwc_adaptive_pooling_fwd_t<data_type::u8>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
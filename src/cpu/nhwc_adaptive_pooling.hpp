@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_NHWC_ADAPTIVE_POOLING_HPP
+#define CPU_NHWC_ADAPTIVE_POOLING_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_pooling_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Adaptive and global pooling forward for plain channels-last tensors. A
+// destination point is computed for a block of channels at once, so the
+// window is read with unit-stride vector loads and the work is split over
+// images, destination points and channel blocks. A row of an average
+// window is summed on its own before it is added to the result, which keeps
+// the sums of long windows accurate. When there are fewer blocks of work
+// than threads, the window of a global pooling is split into slices of rows
+// that are reduced by different threads and combined pairwise at the end.
+template <data_type_t d_type>
+struct nhwc_adaptive_pooling_fwd_t : public primitive_t {
+    struct pd_t : public cpu_pooling_fwd_pd_t {
+        using cpu_pooling_fwd_pd_t::cpu_pooling_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                "simple_nhwc:adaptive", nhwc_adaptive_pooling_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // The number of channels of a block and the number of blocks.
+        dim_t c_block_ = 0;
+        dim_t nb_c_ = 0;
+        // The number of slices of a global window and their rows.
+        dim_t nsplit_ = 1;
+        dim_t slice_rows_ = 0;
+
+    private:
+        void init_conf();
+        void init_scratchpad();
+    };
+
+    nhwc_adaptive_pooling_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    using data_t = typename prec_traits_t<d_type>::type;
+
+    // The largest number of channels reduced at once.
+    static constexpr dim_t c_block_max = 64;
+
+    status_t init(engine_t *engine) override {
+        ref_post_ops_
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops_) return status::out_of_memory;
+        CHECK(ref_post_ops_->init(pd()->dst_md()));
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_NORMALIZATION_UTILS_HPP
+#define CPU_NORMALIZATION_UTILS_HPP
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace normalization_utils {
+
+// Statistics of a set of values: the number of values, their mean and the sum
+// of squared deviations from the mean (M2). Statistics of disjoint parts of a
+// tensor are merged with the parallel algorithm by Chan et al., which lets
+// a single read of the data produce both the mean and the variance. Unlike
+// `E[x^2] - E[x]^2` it stays accurate when the mean dominates the deviation.
+struct welford_stat_t {
+    void merge(dim_t n, float mean, float m2) {
+        if (n == 0) return;
+        const dim_t n_ab = n_ + n;
+        const float delta = mean - mean_;
+        const float w = static_cast<float>(n) / static_cast<float>(n_ab);
+        mean_ += delta * w;
+        m2_ += m2 + delta * delta * static_cast<float>(n_) * w;
+        n_ = n_ab;
+    }
+
+    float mean() const { return mean_; }
+    float variance() const {
+        // M2 of a part may be slightly negative due to rounding.
+        return n_ > 0 && m2_ > 0.f ? m2_ / static_cast<float>(n_) : 0.f;
+    }
+
+private:
+    dim_t n_ = 0;
+    float mean_ = 0.f;
+    float m2_ = 0.f;
+};
+
+} // namespace normalization_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
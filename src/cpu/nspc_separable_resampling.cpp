@@ -0,0 +1,309 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_q10n.hpp"
+
+#include "cpu/nspc_separable_resampling.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace resampling_utils;
+
+namespace {
+
+// The number of consecutive elements of a row computed at once.
+constexpr dim_t chunk_size = 256;
+
+void load_values(float *vals, const void *src, data_type_t dt, dim_t off,
+        dim_t len) {
+    using namespace data_type;
+    switch (dt) {
+        case bf16:
+            cvt_bfloat16_to_float(
+                    vals, static_cast<const bfloat16_t *>(src) + off, len);
+            break;
+        case f16:
+            cvt_float16_to_float(
+                    vals, static_cast<const float16_t *>(src) + off, len);
+            break;
+        case s8: {
+            const int8_t *s = static_cast<const int8_t *>(src) + off;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; i++)
+                vals[i] = static_cast<float>(s[i]);
+        } break;
+        case u8: {
+            const uint8_t *s = static_cast<const uint8_t *>(src) + off;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; i++)
+                vals[i] = static_cast<float>(s[i]);
+        } break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+void store_values(void *dst, data_type_t dt, const float *vals, dim_t off,
+        dim_t len) {
+    using namespace data_type;
+    switch (dt) {
+        case f32: {
+            float *d = static_cast<float *>(dst) + off;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; i++)
+                d[i] = vals[i];
+        } break;
+        case bf16:
+            cvt_float_to_bfloat16(
+                    static_cast<bfloat16_t *>(dst) + off, vals, len);
+            break;
+        case f16:
+            cvt_float_to_float16(
+                    static_cast<float16_t *>(dst) + off, vals, len);
+            break;
+        case s8: {
+            int8_t *d = static_cast<int8_t *>(dst) + off;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; i++)
+                d[i] = q10n::saturate_and_round<int8_t>(vals[i]);
+        } break;
+        case u8: {
+            uint8_t *d = static_cast<uint8_t *>(dst) + off;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; i++)
+                d[i] = q10n::saturate_and_round<uint8_t>(vals[i]);
+        } break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+} // namespace
+
+status_t nspc_separable_resampling_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+    using sm = primitive_attr_t::skip_mask_t;
+
+    const data_type_t src_dt = src_md()->data_type;
+    const data_type_t dst_dt = dst_md()->data_type;
+
+    VDISPATCH_RESAMPLING(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_RESAMPLING(
+            is_filter_alg(desc()->alg_kind), VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_RESAMPLING(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_RESAMPLING(utils::one_of(src_dt, f32, bf16, f16, s8, u8)
+                    && utils::one_of(dst_dt, f32, bf16, f16, s8, u8),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_RESAMPLING(platform::has_data_type_support(src_dt)
+                    && platform::has_data_type_support(dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_RESAMPLING(
+            set_default_params() == status::success, VERBOSE_BAD_PARAM, "");
+    VDISPATCH_RESAMPLING(attr()->has_default_values(sm::post_ops, dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_RESAMPLING(ref_post_ops_t::primitive_kind_ok(attr()->post_ops_),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_RESAMPLING(
+            attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    const format_tag_t dat_tag = utils::pick(ndims() - 3, nwc, nhwc, ndhwc);
+    VDISPATCH_RESAMPLING(memory_desc_matches_tag(*src_md(), dat_tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VDISPATCH_RESAMPLING(memory_desc_matches_tag(*dst_md(), dat_tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+
+    init_passes();
+    init_scratchpad();
+    return status::success;
+}
+
+void nspc_separable_resampling_fwd_t::pd_t::init_passes() {
+    const dim_t in_dims[3] = {ID(), IH(), IW()};
+    const dim_t out_dims[3] = {OD(), OH(), OW()};
+
+    // The axes that are resized, from the one with the smallest ratio of the
+    // destination to the source size. The width goes first on a tie. When no
+    // axis is resized, a single pass on the width still applies the filter.
+    int axes[3];
+    int naxes = 0;
+    for (int a = 2; a >= 0; a--)
+        if (in_dims[a] != out_dims[a]) axes[naxes++] = a;
+    std::stable_sort(axes, axes + naxes, [&](int a, int b) {
+        return out_dims[a] * in_dims[b] < out_dims[b] * in_dims[a];
+    });
+    if (naxes == 0) axes[naxes++] = 2;
+
+    dim_t dims[3] = {in_dims[0], in_dims[1], in_dims[2]};
+    npasses_ = naxes;
+    buf_size_ = 0;
+    for (int p = 0; p < npasses_; p++) {
+        const int a = axes[p];
+        auto &ps = passes_[p];
+        ps.axis = a;
+        ps.outer = MB();
+        for (int i = 0; i < a; i++)
+            ps.outer *= dims[i];
+        ps.inner = C();
+        for (int i = a + 1; i < 3; i++)
+            ps.inner *= dims[i];
+        ps.I = dims[a];
+        ps.O = out_dims[a];
+        dims[a] = out_dims[a];
+        if (p < npasses_ - 1)
+            buf_size_ = nstl::max(buf_size_, ps.outer * ps.O * ps.inner);
+    }
+}
+
+void nspc_separable_resampling_fwd_t::pd_t::init_scratchpad() {
+    if (npasses_ == 1) return;
+    using namespace memory_tracking::names;
+    // Intermediate tensors alternate between two buffers.
+    const dim_t nbufs = nstl::min(npasses_ - 1, 2);
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<float>(key_resampling_space, nbufs * buf_size_);
+}
+
+status_t nspc_separable_resampling_fwd_t::init(engine_t *engine) {
+    ref_post_ops_
+            = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+    if (!ref_post_ops_) return status::out_of_memory;
+    CHECK(ref_post_ops_->init(pd()->dst_md()));
+
+    const auto alg = pd()->desc()->alg_kind;
+    for (int p = 0; p < pd()->npasses_; p++) {
+        const auto &ps = pd()->passes_[p];
+        tables_[p] = filter_table_t(alg, ps.O, ps.I);
+    }
+    return status::success;
+}
+
+void nspc_separable_resampling_fwd_t::execute_pass(const exec_ctx_t &ctx,
+        int ipass, const void *in, data_type_t in_dt, void *out,
+        data_type_t out_dt) const {
+    const auto &ps = pd()->passes_[ipass];
+    const auto &table = tables_[ipass];
+    const bool is_last = ipass == pd()->npasses_ - 1;
+    const bool with_post_ops = is_last && pd()->attr()->post_ops_.len() > 0;
+
+    const dim_t C = pd()->C();
+    const dim_t OD = pd()->OD();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t nchunks = utils::div_up(ps.inner, chunk_size);
+
+    parallel_nd(ps.outer, ps.O, nchunks, [&](dim_t n, dim_t o, dim_t ic) {
+        const dim_t c0 = ic * chunk_size;
+        const dim_t len = nstl::min(chunk_size, ps.inner - c0);
+        const float *w = table.weights(o);
+
+        float acc[chunk_size];
+        float buf[chunk_size];
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < len; i++)
+            acc[i] = 0.f;
+
+        for (dim_t j = 0; j < table.size(o); j++) {
+            const dim_t off = (n * ps.I + table.start(o) + j) * ps.inner + c0;
+            const float *row = static_cast<const float *>(in) + off;
+            if (in_dt != data_type::f32) {
+                load_values(buf, in, in_dt, off, len);
+                row = buf;
+            }
+            const float wj = w[j];
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; i++)
+                acc[i] += wj * row[i];
+        }
+
+        const dim_t out_off = (n * ps.O + o) * ps.inner + c0;
+        if (with_post_ops) {
+            // The destination is dense channels-last, so the logical offset
+            // of a point follows from its physical one.
+            ref_post_ops_t::args_t args;
+            args.ctx = &ctx;
+            args.dst_md = pd()->dst_md();
+            for (dim_t i = 0; i < len; i++) {
+                dim_t sp = out_off + i;
+                const dim_t c = sp % C;
+                sp /= C;
+                const dim_t ow = sp % OW;
+                sp /= OW;
+                const dim_t oh = sp % OH;
+                sp /= OH;
+                const dim_t od = sp % OD;
+                const dim_t mb = sp / OD;
+                args.l_offset = (((mb * C + c) * OD + od) * OH + oh) * OW + ow;
+                args.dst_val = io::load_float_value(out_dt, out, out_off + i);
+                ref_post_ops_->execute(acc[i], args);
+            }
+        }
+        store_values(out, out_dt, acc, out_off, len);
+    });
+}
+
+status_t nspc_separable_resampling_fwd_t::execute(
+        const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    src += src_d.offset0() * src_d.data_type_size();
+    dst += dst_d.offset0() * dst_d.data_type_size();
+
+    const int npasses = pd()->npasses_;
+    float *bufs[2] = {nullptr, nullptr};
+    if (npasses > 1) {
+        const auto scratchpad = ctx.get_scratchpad_grantor();
+        bufs[0] = scratchpad.get<float>(key_resampling_space);
+        bufs[1] = bufs[0] + pd()->buf_size_;
+    }
+
+    for (int p = 0; p < npasses; p++) {
+        const bool is_first = p == 0;
+        const bool is_last = p == npasses - 1;
+        const void *in = is_first ? static_cast<const void *>(src)
+                                  : bufs[(p - 1) % 2];
+        void *out = is_last ? static_cast<void *>(dst) : bufs[p % 2];
+        execute_pass(ctx, p, in,
+                is_first ? src_d.data_type() : data_type::f32, out,
+                is_last ? dst_d.data_type() : data_type::f32);
+    }
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_NSPC_SEPARABLE_RESAMPLING_HPP
+#define CPU_NSPC_SEPARABLE_RESAMPLING_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_resampling_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+#include "cpu/resampling_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Cubic and antialiased linear resampling forward for plain channels-last
+// tensors. The filters are separable, so the source is resampled along one
+// spatial axis at a time, with the per-axis weights computed once when the
+// primitive is created. A pass reads whole rows of consecutive channels and
+// spatial points, which makes its loops unit-stride and vectorized. The
+// axes that shrink the most go first to keep the intermediate tensors small.
+// These are kept in f32 in the scratchpad, and the last pass applies the
+// post-ops and converts the result to the destination data type.
+struct nspc_separable_resampling_fwd_t : public primitive_t {
+    struct pd_t : public cpu_resampling_fwd_pd_t {
+        using cpu_resampling_fwd_pd_t::cpu_resampling_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                "simple_nspc:separable", nspc_separable_resampling_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // A pass resamples the middle dimension of an [outer][I][inner]
+        // tensor into an [outer][O][inner] one on spatial axis `axis`,
+        // 0 being the depth and 2 the width.
+        struct pass_t {
+            int axis;
+            dim_t outer, I, O, inner;
+        };
+        pass_t passes_[3] = {};
+        int npasses_ = 0;
+        // The number of elements of the largest intermediate tensor.
+        dim_t buf_size_ = 0;
+
+    private:
+        void init_passes();
+        void init_scratchpad();
+    };
+
+    nspc_separable_resampling_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    void execute_pass(const exec_ctx_t &ctx, int ipass, const void *in,
+            data_type_t in_dt, void *out, data_type_t out_dt) const;
+
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
+    resampling_utils::filter_table_t tables_[3];
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
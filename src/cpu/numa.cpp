@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_debug.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/numa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace numa {
+
+namespace {
+
+#if defined(__linux__) && defined(SYS_mbind)
+// Memory policy modes from <linux/mempolicy.h>. The header is not used to
+// avoid a dependency on libnuma development packages.
+constexpr int mpol_bind = 2;
+constexpr int mpol_interleave = 3;
+
+// Parses the list of online nodes in the "0-1,3" format.
+std::vector<int> get_online_nodes() {
+    std::vector<int> nodes;
+    FILE *fp = ::fopen("/sys/devices/system/node/online", "r");
+    if (!fp) return nodes;
+
+    char buf[256] = {};
+    const bool ok = ::fgets(buf, sizeof(buf), fp) != nullptr;
+    ::fclose(fp);
+    if (!ok) return nodes;
+
+    const char *p = buf;
+    while (*p != '\0' && *p != '\n') {
+        char *end = nullptr;
+        const long first = std::strtol(p, &end, 10);
+        if (end == p) break;
+        long last = first;
+        p = end;
+        if (*p == '-') {
+            last = std::strtol(p + 1, &end, 10);
+            p = end;
+        }
+        for (long n = first; n <= last; n++)
+            nodes.push_back((int)n);
+        if (*p == ',') p++;
+    }
+    return nodes;
+}
+
+void mbind(void *ptr, size_t size, int mode, const std::vector<int> &nodes) {
+    if (nodes.empty()) return;
+
+    constexpr int bits_per_word = 8 * sizeof(unsigned long);
+    int max_node = 0;
+    for (int n : nodes)
+        max_node = nstl::max(max_node, n);
+    std::vector<unsigned long> mask(max_node / bits_per_word + 1, 0);
+    for (int n : nodes)
+        mask[n / bits_per_word] |= 1UL << (n % bits_per_word);
+
+    // The kernel expects the number of bits in the mask plus one. Failures
+    // are ignored as the memory is still usable with the default placement.
+    ::syscall(SYS_mbind, ptr, size, mode, mask.data(),
+            (unsigned long)(mask.size() * bits_per_word + 1), 0);
+}
+#endif
+
+} // namespace
+
+const policy_t &get_policy() {
+    static const policy_t policy = [] {
+        const std::string value = getenv_string_user("CPU_NUMA_POLICY");
+        if (value == "local") return policy_t {policy_kind_t::local, 0};
+        if (value == "interleave")
+            return policy_t {policy_kind_t::interleave, 0};
+        const std::string bind_prefix = "bind:";
+        if (value.compare(0, bind_prefix.size(), bind_prefix) == 0) {
+            const int node = std::atoi(value.c_str() + bind_prefix.size());
+            if (node >= 0) return policy_t {policy_kind_t::bind, node};
+        }
+        return policy_t {policy_kind_t::none, 0};
+    }();
+    return policy;
+}
+
+void apply_policy(void *ptr, size_t size) {
+    const auto &policy = get_policy();
+    if (policy.kind == policy_kind_t::none || ptr == nullptr
+            || memory_debug::is_mem_debug())
+        return;
+
+    const size_t page_size = static_cast<size_t>(impl::getpagesize());
+    const uintptr_t start
+            = utils::rnd_up(reinterpret_cast<uintptr_t>(ptr), page_size);
+    const uintptr_t end
+            = utils::rnd_dn(reinterpret_cast<uintptr_t>(ptr) + size, page_size);
+    if (end <= start) return;
+    const size_t npages = (end - start) / page_size;
+
+    switch (policy.kind) {
+        case policy_kind_t::local: {
+            // The first write to a page makes the kernel allocate it on the
+            // node of the writing thread. The buffer content is undefined
+            // after allocation, so writing zeros is harmless.
+            char *base = reinterpret_cast<char *>(start);
+            parallel(0, [&](const int ithr, const int nthr) {
+                size_t p_start = 0, p_end = 0;
+                balance211(npages, nthr, ithr, p_start, p_end);
+                for (size_t p = p_start; p < p_end; p++)
+                    base[p * page_size] = 0;
+            });
+            break;
+        }
+#if defined(__linux__) && defined(SYS_mbind)
+        case policy_kind_t::interleave:
+            mbind(reinterpret_cast<void *>(start), end - start,
+                    mpol_interleave, get_online_nodes());
+            break;
+        case policy_kind_t::bind:
+            mbind(reinterpret_cast<void *>(start), end - start, mpol_bind,
+                    {policy.node});
+            break;
+#endif
+        default: break;
+    }
+}
+
+} // namespace numa
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
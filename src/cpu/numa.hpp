@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_NUMA_HPP
+#define CPU_NUMA_HPP
+
+#include <cstddef>
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace numa {
+
+// NUMA placement policy for library-owned CPU allocations. Controlled by the
+// ONEDNN_CPU_NUMA_POLICY environment variable.
+enum class policy_kind_t {
+    none, // operating system default placement (default)
+    local, // pages are first touched in parallel by the library threads
+    interleave, // pages are interleaved across all online nodes
+    bind, // pages are bound to a single node
+};
+
+struct policy_t {
+    policy_kind_t kind;
+    int node; // for policy_kind_t::bind only
+};
+
+const policy_t DNNL_API &get_policy();
+
+// Applies the NUMA policy to a freshly allocated buffer. Only whole pages
+// within the buffer are affected. With the `local` policy, the pages are
+// touched using the same static work partitioning over threads that
+// parallel_nd() uses, so that every page lands on the node of the thread that
+// is likely to process it.
+void DNNL_API apply_policy(void *ptr, size_t size);
+
+} // namespace numa
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -114,7 +114,7 @@ bool has_data_type_support(data_type_t data_type) {
             return x64::mayiuse(x64::avx512_core)
                     || x64::mayiuse(x64::avx2_vnni_2);
 #elif DNNL_PPC64
-#if defined(USE_CBLAS) && defined(BLAS_HAS_SBGEMM) && defined(__MMA__)
+#if defined(__MMA__)
             return true;
 #endif
 #elif DNNL_AARCH64
@@ -152,7 +152,7 @@ bool has_training_support(data_type_t data_type) {
 #if DNNL_X64
             return x64::mayiuse(x64::avx512_core);
 #elif DNNL_PPC64
-#if defined(USE_CBLAS) && defined(BLAS_HAS_SBGEMM) && defined(__MMA__)
+#if defined(__MMA__)
             return true;
 #endif
 #elif defined(DNNL_AARCH64_USE_ACL)
@@ -172,6 +172,36 @@ bool has_training_support(data_type_t data_type) {
     }
 }
 
+#if DNNL_X64
+namespace {
+// The data cache parameters reported by CPUID leaf 4, which are queried once
+// since executing CPUID is expensive, especially in virtual machines, and
+// the parameters are read at every primitive descriptor creation.
+struct cache_topology_t {
+    static constexpr unsigned max_subleaves = 8;
+    unsigned data_cache_levels = 0;
+    uint32_t num_sets[max_subleaves] = {};
+    uint32_t num_ways[max_subleaves] = {};
+};
+
+const cache_topology_t &cache_topology() {
+    static const cache_topology_t topology = []() {
+        cache_topology_t t;
+        t.data_cache_levels = nstl::min(x64::cpu().getDataCacheLevels(),
+                cache_topology_t::max_subleaves - 1);
+        for (unsigned l = 0; l <= t.data_cache_levels; l++) {
+            uint32_t data[4] = {0};
+            Xbyak::util::Cpu::getCpuidEx(4, l, data);
+            t.num_sets[l] = data[2] + 1;
+            t.num_ways[l] = ((data[1] & 0xFFC00000) >> 22) + 1;
+        }
+        return t;
+    }();
+    return topology;
+}
+} // namespace
+#endif
+
 float s8s8_weights_scale_factor() {
 #if DNNL_X64
     return x64::mayiuse(x64::avx512_core_vnni) || x64::mayiuse(x64::avx2_vnni)
@@ -196,16 +226,12 @@ uint32_t get_num_sets_in_cache(int level) {
     };
 
 #if DNNL_X64
-    using namespace x64;
+    const auto &t = cache_topology();
+    if (t.data_cache_levels == 0) return guess(level);
 
-    if (cpu().getDataCacheLevels() == 0) return guess(level);
-
-    if (level >= 0 && (unsigned)level <= cpu().getDataCacheLevels()) {
-        uint32_t data[4] = {0};
-        Xbyak::util::Cpu::getCpuidEx(4, level, data);
-        uint32_t num_sets = data[2] + 1;
-        return num_sets;
-    } else
+    if (level >= 0 && (unsigned)level <= t.data_cache_levels)
+        return t.num_sets[level];
+    else
         return 0;
 #else
     return guess(level);
@@ -226,18 +252,13 @@ uint32_t get_num_ways_in_cache(int level) {
     };
 
 #if DNNL_X64
+    const auto &t = cache_topology();
+    if (t.data_cache_levels == 0) return guess(level);
 
-    using namespace x64;
-    if (cpu().getDataCacheLevels() == 0) return guess(level);
-
-    if (level >= 0 && (unsigned)level <= cpu().getDataCacheLevels()) {
-        uint32_t data[4] = {0};
-        Xbyak::util::Cpu::getCpuidEx(4, level, data);
-        uint32_t num_ways = ((data[1] & 0xFFC00000) >> 22) + 1;
-        return num_ways;
-    } else
+    if (level >= 0 && (unsigned)level <= t.data_cache_levels)
+        return t.num_ways[level];
+    else
         return 0;
-
 #else
     return guess(level);
 #endif
@@ -267,6 +288,22 @@ unsigned get_per_core_cache_size(int level) {
 #endif
 }
 
+bool is_hybrid() {
+#if DNNL_X64
+    // The hybrid flag is reported in CPUID.(EAX=07H, ECX=0):EDX[15].
+    static const bool hybrid = []() {
+        uint32_t data[4] = {0};
+        Xbyak::util::Cpu::getCpuid(0, data);
+        if (data[0] < 7) return false;
+        Xbyak::util::Cpu::getCpuidEx(7, 0, data);
+        return ((data[3] >> 15) & 1) != 0;
+    }();
+    return hybrid;
+#else
+    return false;
+#endif
+}
+
 unsigned get_num_cores() {
 #if DNNL_X64
     return x64::cpu().getNumCores(Xbyak::util::CoreLevel);
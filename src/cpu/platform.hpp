@@ -82,7 +82,7 @@
 // Equivalent to: #if DNNL_$ARCH ... #endif
 #define DNNL_X64_ONLY(...) Z_CONDITIONAL_DO(DNNL_X64, __VA_ARGS__)
 #define DNNL_PPC64_ONLY(...) Z_CONDITIONAL_DO(DNNL_PPC64, __VA_ARGS__)
-#define DNNL_S390X_ONLY(...) Z_CONDITIONAL_DO(DNNL_S390X_ONLY, __VA_ARGS__)
+#define DNNL_S390X_ONLY(...) Z_CONDITIONAL_DO(DNNL_S390X, __VA_ARGS__)
 #define DNNL_AARCH64_ONLY(...) Z_CONDITIONAL_DO(DNNL_AARCH64, __VA_ARGS__)
 
 // Using RISC-V implementations optimized with RVV Intrinsics is optional for RISC-V builds
@@ -94,6 +94,16 @@
 #define DNNL_RV64GCV_ONLY(...)
 #endif
 
+// The f32 vector kernels of s390x use the vector enhancements facility 1,
+// which z14 introduced.
+#if DNNL_S390X && defined(__VX__) && defined(__ARCH__) && __ARCH__ >= 12
+#define DNNL_S390X_VXE 1
+#define DNNL_S390X_VXE_ONLY(...) __VA_ARGS__
+#else
+#define DNNL_S390X_VXE 0
+#define DNNL_S390X_VXE_ONLY(...)
+#endif
+
 // Negation of the helper macros above
 #define DNNL_NON_X64_ONLY(...) Z_CONDITIONAL_DO(Z_NOT(DNNL_X64), __VA_ARGS__)
 
@@ -172,6 +182,9 @@ unsigned DNNL_API get_per_core_cache_size(int level);
 uint32_t get_num_ways_in_cache(int level);
 uint32_t get_num_sets_in_cache(int level);
 unsigned DNNL_API get_num_cores();
+// Returns whether the CPU has cores of different types, e.g. the performance
+// and the efficient cores of hybrid Intel CPUs.
+bool DNNL_API is_hybrid();
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 unsigned DNNL_API get_max_threads_to_use();
 #endif
@@ -0,0 +1,249 @@
+/*******************************************************************************
+* Copyright 2025 IBM Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef __MMA__
+#include <altivec.h>
+
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ppc64/ppc64_gemm_f32.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace ppc64 {
+
+namespace {
+
+typedef __vector unsigned char vec_t;
+typedef __vector float vec_f32_t;
+
+// The micro-kernel computes MR rows by NR columns of C in the 8 accumulators,
+// each of 4 columns by 4 rows.
+constexpr dim_t MR = 16;
+constexpr dim_t NR = 8;
+// The blocking of C for the threads and of K for the caches.
+constexpr dim_t MC = 128;
+constexpr dim_t NC = 512;
+constexpr dim_t KC = 256;
+
+// A step of K is the number of values that a rank-k update of MMA reduces:
+// one for f32 and two for bf16.
+template <typename data_t>
+struct mma_traits_t;
+
+template <>
+struct mma_traits_t<float> {
+    static constexpr int k_step = 1;
+    static void ger(__vector_quad *acc, vec_t b, vec_t a) {
+        __builtin_mma_xvf32gerpp(acc, b, a);
+    }
+};
+
+template <>
+struct mma_traits_t<bfloat16_t> {
+    static constexpr int k_step = 2;
+    static void ger(__vector_quad *acc, vec_t b, vec_t a) {
+        __builtin_mma_xvbf16ger2pp(acc, b, a);
+    }
+};
+
+// Packs `nr` rows of `nk` values of K, the value (r, k) being at
+// src[r * rs + k * ks], in strips of R rows padded with zeros. A strip holds
+// the values of the R rows for a step of K next to each other.
+template <typename data_t, dim_t R>
+void pack(const data_t *src, dim_t rs, dim_t ks, dim_t nr, dim_t nk,
+        data_t *dst) {
+    constexpr int k_step = mma_traits_t<data_t>::k_step;
+    const dim_t nk_padded = utils::rnd_up(nk, k_step);
+    for (dim_t r0 = 0; r0 < nr; r0 += R) {
+        const dim_t rows = nstl::min(R, nr - r0);
+        const data_t *s = src + r0 * rs;
+        for (dim_t k = 0; k < nk_padded; k += k_step)
+            for (dim_t r = 0; r < R; r++)
+                for (int t = 0; t < k_step; t++) {
+                    const bool valid = r < rows && k + t < nk;
+                    *dst++ = valid ? s[r * rs + (k + t) * ks] : data_t(0.f);
+                }
+    }
+}
+
+// Computes C = alpha * A * B + beta * C + bias for a strip of packed A and
+// a strip of packed B, of which `m` rows and `n` columns are stored.
+template <typename data_t>
+void compute_block(dim_t ksteps, const data_t *ap, const data_t *bp, dim_t m,
+        dim_t n, float alpha, float beta, float *c, dim_t ldc,
+        const float *bias) {
+    constexpr int k_step = mma_traits_t<data_t>::k_step;
+
+    // acc[4 * j + i] holds the columns 4j to 4j + 3 of the rows 4i to 4i + 3.
+    __vector_quad acc[8];
+    for (int i = 0; i < 8; i++)
+        __builtin_mma_xxsetaccz(&acc[i]);
+
+    for (dim_t ks = 0; ks < ksteps; ks++) {
+        const vec_t *a = (const vec_t *)ap;
+        const vec_t *b = (const vec_t *)bp;
+        const vec_t a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+        const vec_t b0 = b[0], b1 = b[1];
+        mma_traits_t<data_t>::ger(&acc[0], b0, a0);
+        mma_traits_t<data_t>::ger(&acc[1], b0, a1);
+        mma_traits_t<data_t>::ger(&acc[2], b0, a2);
+        mma_traits_t<data_t>::ger(&acc[3], b0, a3);
+        mma_traits_t<data_t>::ger(&acc[4], b1, a0);
+        mma_traits_t<data_t>::ger(&acc[5], b1, a1);
+        mma_traits_t<data_t>::ger(&acc[6], b1, a2);
+        mma_traits_t<data_t>::ger(&acc[7], b1, a3);
+        ap += MR * k_step;
+        bp += NR * k_step;
+    }
+
+    const vec_f32_t valpha = vec_splats(alpha);
+    const vec_f32_t vbeta = vec_splats(beta);
+    vec_f32_t res[4];
+    for (int j = 0; j < 2; j++)
+        for (int i = 0; i < 4; i++) {
+            // The vectors of an accumulator are the columns of C.
+            __builtin_mma_disassemble_acc((void *)res, &acc[4 * j + i]);
+            const dim_t m0 = 4 * i;
+            if (m0 >= m) continue;
+            for (int jj = 0; jj < 4 && 4 * j + jj < n; jj++) {
+                float *cc = c + (4 * j + jj) * ldc + m0;
+                if (m0 + 4 <= m) {
+                    vec_f32_t v = vec_mul(res[jj], valpha);
+                    if (beta != 0.f) v = vec_madd(vec_xl(0, cc), vbeta, v);
+                    if (bias) v = vec_add(v, vec_xl(0, bias + m0));
+                    vec_xst(v, 0, cc);
+                } else {
+                    for (dim_t ii = 0; ii < m - m0; ii++) {
+                        float v = alpha * res[jj][ii];
+                        if (beta != 0.f) v += beta * cc[ii];
+                        if (bias) v += bias[m0 + ii];
+                        cc[ii] = v;
+                    }
+                }
+            }
+        }
+}
+
+template <typename data_t>
+dnnl_status_t gemm_mma(const char *transa, const char *transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const data_t *A, dim_t lda,
+        const data_t *B, dim_t ldb, float beta, float *C, dim_t ldc,
+        const float *bias) {
+    constexpr int k_step = mma_traits_t<data_t>::k_step;
+
+    if (M == 0 || N == 0) return dnnl_success;
+    if (K == 0 || alpha == 0.f) {
+        parallel_nd(N, [&](dim_t j) {
+            float *c = C + j * ldc;
+            for (dim_t i = 0; i < M; i++) {
+                c[i] = beta == 0.f ? 0.f : beta * c[i];
+                if (bias) c[i] += bias[i];
+            }
+        });
+        return dnnl_success;
+    }
+
+    const bool trA = utils::one_of(*transa, 't', 'T');
+    const bool trB = utils::one_of(*transb, 't', 'T');
+    // The strides of op(A) along M and K, and of op(B) along N and K.
+    const dim_t a_rs = trA ? lda : 1, a_ks = trA ? 1 : lda;
+    const dim_t b_rs = trB ? 1 : ldb, b_ks = trB ? ldb : 1;
+
+    const int nthr_max = dnnl_get_current_num_threads();
+    const dim_t mc = nstl::min(MC, utils::rnd_up(M, MR));
+    const dim_t m_blocks = utils::div_up(M, mc);
+    dim_t nc = nstl::min(NC, utils::rnd_up(N, NR));
+    // Splits N finer when the blocks of M do not keep all the threads busy.
+    if (m_blocks * utils::div_up(N, nc) < nthr_max) {
+        const dim_t n_blocks = utils::div_up(nthr_max, m_blocks);
+        nc = nstl::max(NR, utils::rnd_up(utils::div_up(N, n_blocks), NR));
+    }
+    const dim_t n_blocks = utils::div_up(N, nc);
+    const dim_t nblocks = m_blocks * n_blocks;
+    const int nthr_gemm = (int)nstl::min<dim_t>(nthr_max, nblocks);
+
+    const dim_t kc = nstl::min(KC, utils::rnd_up(K, k_step));
+    const dim_t a_size = mc * kc;
+    const dim_t b_size = nc * kc;
+    data_t *buf = (data_t *)malloc(
+            sizeof(data_t) * nthr_gemm * (a_size + b_size), 4096);
+    if (utils::any_null(buf)) return dnnl_out_of_memory;
+
+    parallel(nthr_gemm, [&](int ithr, int nthr) {
+        data_t *ap = buf + ithr * (a_size + b_size);
+        data_t *bp = ap + a_size;
+
+        dim_t start = 0, end = 0;
+        balance211(nblocks, nthr, ithr, start, end);
+        for (dim_t blk = start; blk < end; blk++) {
+            const dim_t m0 = (blk % m_blocks) * mc;
+            const dim_t n0 = (blk / m_blocks) * nc;
+            const dim_t m_cur = nstl::min(mc, M - m0);
+            const dim_t n_cur = nstl::min(nc, N - n0);
+            for (dim_t k0 = 0; k0 < K; k0 += kc) {
+                const dim_t k_cur = nstl::min(kc, K - k0);
+                const dim_t ksteps = utils::div_up(k_cur, k_step);
+                pack<data_t, MR>(A + m0 * a_rs + k0 * a_ks, a_rs, a_ks,
+                        m_cur, k_cur, ap);
+                pack<data_t, NR>(B + n0 * b_rs + k0 * b_ks, b_rs, b_ks,
+                        n_cur, k_cur, bp);
+                // The blocks of K after the first one accumulate to C.
+                const float beta_k = k0 == 0 ? beta : 1.f;
+                const float *bias_k = k0 == 0 ? bias : nullptr;
+                for (dim_t n = 0; n < n_cur; n += NR)
+                    for (dim_t m = 0; m < m_cur; m += MR)
+                        compute_block(ksteps, ap + m * ksteps * k_step,
+                                bp + n * ksteps * k_step,
+                                nstl::min(MR, m_cur - m),
+                                nstl::min(NR, n_cur - n), alpha, beta_k,
+                                C + (n0 + n) * ldc + m0 + m, ldc,
+                                bias_k ? bias_k + m0 + m : nullptr);
+            }
+        }
+    });
+
+    free(buf);
+    return dnnl_success;
+}
+
+} // namespace
+
+dnnl_status_t gemm_f32_mma(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *A, const dim_t *lda, const float *B, const dim_t *ldb,
+        const float *beta, float *C, const dim_t *ldc, const float *bias) {
+    return gemm_mma(transa, transb, *M, *N, *K, *alpha, A, *lda, B, *ldb,
+            *beta, C, *ldc, bias);
+}
+
+dnnl_status_t gemm_bf16bf16f32_mma(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
+        const dim_t *ldb, const float *beta, float *C, const dim_t *ldc) {
+    return gemm_mma(transa, transb, *M, *N, *K, *alpha, A, *lda, B, *ldb,
+            *beta, C, *ldc, nullptr);
+}
+
+} // namespace ppc64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // __MMA__
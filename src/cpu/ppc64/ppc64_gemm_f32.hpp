@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2025 IBM Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_PPC64_PPC64_GEMM_F32_HPP
+#define CPU_PPC64_PPC64_GEMM_F32_HPP
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "oneapi/dnnl/dnnl_types.h"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace ppc64 {
+
+// Column-major GEMMs on the MMA rank-k updates of POWER10, with f32 or bf16
+// A and B, and f32 C. The bias, of M values, is added to every column of C,
+// which requires beta == 0.
+dnnl_status_t gemm_f32_mma(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *A, const dim_t *lda, const float *B, const dim_t *ldb,
+        const float *beta, float *C, const dim_t *ldc, const float *bias);
+
+dnnl_status_t gemm_bf16bf16f32_mma(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
+        const dim_t *ldb, const float *beta, float *C, const dim_t *ldc);
+
+} // namespace ppc64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_PPC64_PPC64_GEMM_F32_HPP
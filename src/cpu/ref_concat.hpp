@@ -37,7 +37,8 @@ struct ref_concat_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             using sm = primitive_attr_t::skip_mask_t;
-            VDISPATCH_CONCAT(attr()->has_default_values(sm::scales),
+            VDISPATCH_CONCAT(attr()->has_default_values(
+                                     sm::scales | sm::zero_points),
                     VERBOSE_UNSUPPORTED_ATTR);
             tent_dst_md_ = types::zero_md();
             status_t status = cpu_concat_pd_t::init();
@@ -54,15 +55,29 @@ struct ref_concat_t : public primitive_t {
                         VERBOSE_PRIMITIVE_CREATION_FAIL, "concat");
             }
 
+            // The reorder of a source requantizes it into the destination
+            // with the scales and the zero points of both, so that the whole
+            // conversion is done in a single pass.
             const auto &sc = attr()->scales_;
+            const auto &zp = attr()->zero_points_;
             reorder_pds_.resize(n_ + use_tent_dst());
             for (int i = 0; i < n_; ++i) {
                 primitive_attr_t r_attr;
                 if (!sc.has_default_values(DNNL_ARG_MULTIPLE_SRC + i)) {
                     int mask = sc.get_mask(DNNL_ARG_MULTIPLE_SRC + i);
                     VDISPATCH_CONCAT(mask == 0, VERBOSE_UNSUPPORTED_SCALES_CFG);
-                    CHECK(r_attr.scales_.set(DNNL_ARG_SRC, mask));
+                    CHECK(r_attr.scales_.set(
+                            DNNL_ARG_SRC, sc.get(DNNL_ARG_MULTIPLE_SRC + i)));
                 }
+                if (!zp.has_default_values(DNNL_ARG_MULTIPLE_SRC + i))
+                    CHECK(r_attr.zero_points_.set(
+                            DNNL_ARG_SRC, zp.get(DNNL_ARG_MULTIPLE_SRC + i)));
+                if (!sc.has_default_values(DNNL_ARG_DST))
+                    CHECK(r_attr.scales_.set(
+                            DNNL_ARG_DST, sc.get(DNNL_ARG_DST)));
+                if (!zp.has_default_values(DNNL_ARG_DST))
+                    CHECK(r_attr.zero_points_.set(
+                            DNNL_ARG_DST, zp.get(DNNL_ARG_DST)));
                 CHECK(reorder_primitive_desc_create(reorder_pds_[i], engine,
                         src_md(i), src_image_md(i), &r_attr));
             }
@@ -116,16 +131,30 @@ struct ref_concat_t : public primitive_t {
         engine_t *engine = ctx.stream()->engine();
         const auto n = pd()->n_inputs();
 
+        // Passes the quantization parameters of the argument `arg` of the
+        // concat to the argument `r_arg` of a reorder.
+        auto add_quant_args = [&](exec_args_t &r_args, int arg, int r_arg) {
+            for (int attr_arg :
+                    {DNNL_ARG_ATTR_SCALES, DNNL_ARG_ATTR_ZERO_POINTS}) {
+                const auto it = ctx.args().find(attr_arg | arg);
+                if (it != ctx.args().end())
+                    r_args[attr_arg | r_arg] = it->second;
+            }
+        };
+
+        // The quantization parameters are passed only to the reorders of the
+        // sources, with `r_num` < n.
         auto execute_reorder = [&](const std::shared_ptr<primitive_t> &reorder,
                                        const memory_arg_t &src,
-                                       const memory_arg_t &dst,
-                                       const memory_arg_t *src_scales,
-                                       int r_num) {
+                                       const memory_arg_t &dst, int r_num) {
             exec_args_t r_args;
             r_args[DNNL_ARG_SRC] = src;
             r_args[DNNL_ARG_DST] = dst;
-            if (src_scales)
-                r_args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC] = *src_scales;
+            if (r_num < n) {
+                add_quant_args(r_args, DNNL_ARG_MULTIPLE_SRC + r_num,
+                        DNNL_ARG_SRC);
+                add_quant_args(r_args, DNNL_ARG_DST, DNNL_ARG_DST);
+            }
             exec_ctx_t r_ctx(ctx, std::move(r_args));
 
             nested_scratchpad_t ns(ctx, key_nested_multiple + r_num, reorder);
@@ -144,14 +173,9 @@ struct ref_concat_t : public primitive_t {
                 CHECK(safe_ptr_assign(tent_dst_i,
                         new memory_t(engine, pd()->src_image_md(i),
                                 tent_dst_storage->clone())));
-                const auto &src_scales_arg = ctx.args().find(
-                        DNNL_ARG_ATTR_SCALES | (DNNL_ARG_MULTIPLE_SRC + i));
-                const memory_arg_t *src_scales = nullptr;
-                if (src_scales_arg != ctx.args().end())
-                    src_scales = &src_scales_arg->second;
                 execute_reorder(reorders_[i],
                         ctx.args().at(DNNL_ARG_MULTIPLE_SRC + i),
-                        {tent_dst_i.get(), false}, src_scales, i);
+                        {tent_dst_i.get(), false}, i);
             }
 
             std::unique_ptr<memory_t, memory_deleter_t> tent_dst;
@@ -159,22 +183,18 @@ struct ref_concat_t : public primitive_t {
                     new memory_t(engine, &pd()->tent_dst_md_,
                             tent_dst_storage->clone())));
             execute_reorder(reorders_[n], {tent_dst.get(), true},
-                    ctx.args().at(DNNL_ARG_DST), nullptr, n);
+                    ctx.args().at(DNNL_ARG_DST), n);
         } else {
             auto &dst_mem_storage = CTX_OUT_STORAGE(DNNL_ARG_DST);
             for (int i = 0; i < n; ++i) {
+                if (pd()->src_is_dst_view(ctx, i)) continue;
                 std::unique_ptr<memory_t, memory_deleter_t> tent_dst_i;
                 CHECK(safe_ptr_assign(tent_dst_i,
                         new memory_t(engine, pd()->src_image_md(i),
                                 dst_mem_storage.clone())));
-                const auto &src_scales_arg = ctx.args().find(
-                        DNNL_ARG_ATTR_SCALES | (DNNL_ARG_MULTIPLE_SRC + i));
-                const memory_arg_t *src_scales = nullptr;
-                if (src_scales_arg != ctx.args().end())
-                    src_scales = &src_scales_arg->second;
                 execute_reorder(reorders_[i],
                         ctx.args().at(DNNL_ARG_MULTIPLE_SRC + i),
-                        {tent_dst_i.get(), false}, src_scales, i);
+                        {tent_dst_i.get(), false}, i);
             }
         }
         return status::success;
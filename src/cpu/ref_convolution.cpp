@@ -52,9 +52,12 @@ status_t ref_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
     const auto OD = pd()->OD();
     const auto OH = pd()->OH();
     const auto OW = pd()->OW();
-    const auto ID = pd()->ID();
-    const auto IH = pd()->IH();
-    const auto IW = pd()->IW();
+    // The source is upsampled on load: the spatial indices below are those
+    // of the upsampled source and are divided by US to address the source.
+    const auto US = pd()->src_upsampling();
+    const auto ID = pd()->ID() * US;
+    const auto IH = pd()->IH() * US;
+    const auto IW = pd()->IW() * US;
 
     const auto OC = pd()->OC() / G;
     const auto IC = pd()->IC() / G;
@@ -91,8 +94,8 @@ status_t ref_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
             if (ih < 0 || ih >= IH) continue;
             if (iw < 0 || iw >= IW) continue;
 
-            const auto src_off = ref_conv_utils::get_data_off(
-                    src_d, ndims, mb, g * IC + ic, id, ih, iw);
+            const auto src_off = ref_conv_utils::get_data_off(src_d, ndims, mb,
+                    g * IC + ic, id / US, ih / US, iw / US);
             const auto wei_off = ref_conv_utils::get_weights_off(
                     weights_d, with_groups, ndims, g, oc, ic, kd, kh, kw);
 
@@ -146,8 +149,9 @@ status_t ref_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
                     continue;
 
                 for (dim_t ic = 0; ic < IC; ++ic) {
-                    const dim_t src_off = ic + id * src_id_stride
-                            + ih * src_ih_stride + iw * src_iw_stride;
+                    const dim_t src_off = ic + id / US * src_id_stride
+                            + ih / US * src_ih_stride
+                            + iw / US * src_iw_stride;
                     const dim_t weights_off = ic * weights_ic_stride
                             + kd * weights_kd_stride + kh * weights_kh_stride
                             + kw;
@@ -170,8 +174,8 @@ status_t ref_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
                         || iw >= IW)
                     continue;
 
-                const dim_t src_off = ic + id * src_id_stride
-                        + ih * src_ih_stride + iw * src_iw_stride;
+                const dim_t src_off = ic + id / US * src_id_stride
+                        + ih / US * src_ih_stride + iw / US * src_iw_stride;
                 const dim_t weights_off = ic * weights_ic_stride
                         + kd * weights_kd_stride + kh * weights_kh_stride + kw;
                 const float s = io::load_float_value(
@@ -69,7 +69,8 @@ struct ref_convolution_fwd_t : public primitive_t {
             VDISPATCH_CONV(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_CONV(
                     attr()->has_default_values(smask_t::post_ops
-                                    | smask_t::sum_dt | smask_t::rounding_mode,
+                                    | smask_t::sum_dt | smask_t::rounding_mode
+                                    | smask_t::src_upsampling,
                             dst_type),
                     VERBOSE_UNSUPPORTED_POSTOP);
             VDISPATCH_CONV(attr()->post_ops_.check_sum_consistency(
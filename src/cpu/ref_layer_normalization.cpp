@@ -46,6 +46,8 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
             ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
             : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
     auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto src_1 = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
+    auto dst_1 = CTX_OUT_MEM(void *, DNNL_ARG_DST_1);
 
     const float *src_scales
             = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
@@ -64,6 +66,20 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
     const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
     const bool skip_mean = pd()->skip_mean();
+    const bool fuse_add_norm = pd()->fuse_add_norm();
+
+    // With the fused residual addition the sum is normalized as it is stored,
+    // i.e. rounded to the source data type.
+    const auto load_src = [&](dim_t off) {
+        float s = io::load_float_value(src_d.data_type(), src, off);
+        if (!fuse_add_norm) return s;
+        s += io::load_float_value(src_d.data_type(), src_1, off);
+        switch (src_d.data_type()) {
+            case data_type::bf16: return static_cast<float>(bfloat16_t(s));
+            case data_type::f16: return static_cast<float>(float16_t(s));
+            default: return s;
+        }
+    };
 
     /* fast return */
     if (this->pd()->has_zero_dim_memory()) {
@@ -85,8 +101,7 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
             if (!skip_mean) {
                 for (dim_t c = 0; c < C; ++c) {
                     const auto s_off = src_d.off_l(n * C + c);
-                    float s = io::load_float_value(
-                            src_d.data_type(), src, s_off);
+                    float s = load_src(s_off);
                     v_mean += s;
                 }
                 v_mean /= C;
@@ -94,7 +109,7 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
 
             for (dim_t c = 0; c < C; ++c) {
                 const auto s_off = src_d.off_l(n * C + c);
-                float s = io::load_float_value(src_d.data_type(), src, s_off);
+                float s = load_src(s_off);
                 float m = s - v_mean;
                 v_variance += m * m;
             }
@@ -113,7 +128,9 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
             const float sm = scale_val / sqrt_variance;
             const auto s_off = src_d.off_l(n * C + c);
             const auto d_off = dst_d.off_l(n * C + c);
-            float s = io::load_float_value(src_d.data_type(), src, s_off);
+            float s = load_src(s_off);
+            if (dst_1)
+                io::store_float_value(src_d.data_type(), s, dst_1, s_off);
             float d = sm * (s - v_mean) + shift_val;
             if (with_src_scales) d *= src_scales[0];
 
@@ -156,6 +173,7 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
     auto mean = CTX_IN_MEM(const float *, DNNL_ARG_MEAN);
     auto variance = CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE);
     auto diff_dst = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST);
+    auto diff_dst_1 = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST_1);
     auto scale = CTX_IN_MEM(void *, DNNL_ARG_SCALE);
     auto diff_src = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DIFF_SRC, status);
     CHECK(status);
@@ -260,6 +278,11 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
                 d_src -= (s - mean_val) * dd_gamma_x * inv_sqrt_variance / C;
             }
             d_src *= inv_sqrt_variance;
+            // The gradient of the residual branch is added, so that diff_src
+            // is the gradient of both addends of the fused residual addition.
+            if (diff_dst_1)
+                d_src += io::load_float_value(
+                        diff_dst_d.data_type(), diff_dst_1, diff_dst_off);
             io::store_float_value(
                     diff_src_d.data_type(), d_src, diff_src, diff_src_off);
         }
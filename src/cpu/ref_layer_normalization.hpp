@@ -52,6 +52,10 @@ struct ref_layer_normalization_fwd_t : public primitive_t {
             VDISPATCH_LNORM(
                     utils::one_of(dst_md()->data_type, f32, bf16, f16, s8, u8),
                     VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_LNORM(IMPLICATION(fuse_add_norm(),
+                                    utils::one_of(src_md()->data_type, f32,
+                                            bf16, f16)),
+                    VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_LNORM(
                     platform::has_data_type_support(src_md()->data_type),
                     VERBOSE_UNSUPPORTED_DT);
@@ -169,13 +169,40 @@ status_t ref_pooling_fwd_t<data_type, acc_type>::execute_forward(
         d /= num_summands;
     };
 
-    const bool is_max_pool = alg == alg_kind::pooling_max;
+    const bool is_adaptive_max_pool = alg == alg_kind::pooling_adaptive_max;
+    auto ker_adaptive = [=](float &d, dim_t mb, dim_t oc, dim_t od, dim_t oh,
+                                dim_t ow) {
+        const dim_t id_start = adaptive_pooling_start(od, OD, ID);
+        const dim_t id_end = adaptive_pooling_end(od, OD, ID);
+        const dim_t ih_start = adaptive_pooling_start(oh, OH, IH);
+        const dim_t ih_end = adaptive_pooling_end(oh, OH, IH);
+        const dim_t iw_start = adaptive_pooling_start(ow, OW, IW);
+        const dim_t iw_end = adaptive_pooling_end(ow, OW, IW);
+        for_(dim_t id = id_start; id < id_end; ++id)
+        for_(dim_t ih = ih_start; ih < ih_end; ++ih)
+        for (dim_t iw = iw_start; iw < iw_end; ++iw) {
+            const auto off = get_offset(src_d, mb, oc, id, ih, iw);
+            const float s = src[off];
+            if (is_adaptive_max_pool)
+                d = nstl::max(d, s);
+            else
+                d += s;
+        }
+        if (!is_adaptive_max_pool)
+            d /= (id_end - id_start) * (ih_end - ih_start)
+                    * (iw_end - iw_start);
+    };
+
+    const bool is_max_pool = utils::one_of(
+            alg, alg_kind::pooling_max, alg_kind::pooling_adaptive_max);
 
     float base_res
             = is_max_pool ? (float)numeric_limits<data_t>::lowest() : 0.f;
     using ker_t
             = std::function<void(float &, dim_t, dim_t, dim_t, dim_t, dim_t)>;
-    ker_t kernel = is_max_pool ? (ker_t)ker_max : (ker_t)ker_avg;
+    ker_t kernel = pd()->is_adaptive()
+            ? (ker_t)ker_adaptive
+            : (is_max_pool ? (ker_t)ker_max : (ker_t)ker_avg);
 
     parallel_nd(MB, OC, OD, OH, OW,
             [&](dim_t mb, dim_t oc, dim_t od, dim_t oh, dim_t ow) {
@@ -20,6 +20,7 @@
 #include "common/dnnl_thread.hpp"
 #include "common/nstl.hpp"
 
+#include "cpu/arg_reduction_utils.hpp"
 #include "cpu/simple_q10n.hpp"
 
 #include "cpu/ref_io_helper.hpp"
@@ -138,6 +139,65 @@ float ker(dim_t l_offset, alg_kind_t alg, float p, dim_t reduce_size,
     return acc;
 }
 
+status_t ref_reduction_t::execute_arg_ref(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(int32_t *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_mdw(pd()->src_md());
+    const memory_desc_wrapper dst_mdw(pd()->dst_md());
+
+    const int ndims = src_mdw.ndims();
+    const auto &src_dims = src_mdw.dims();
+    const auto &dst_dims = dst_mdw.dims();
+    const bool is_min = pd()->desc()->alg_kind == alg_kind::reduction_arg_min;
+
+    // The indices enumerate the reduced dimensions in the logical order. Top-k
+    // keeps `k` indices along the only reduced dimension, best first.
+    dims_t reduce_dims, idle_dims;
+    dim_t reduce_size {1}, idle_size {1}, k {1};
+    int k_dim = -1;
+    for (int d = 0; d < ndims; ++d) {
+        reduce_dims[d] = dim_t {1};
+        idle_dims[d] = dst_dims[d];
+        if (src_dims[d] != dst_dims[d]) {
+            reduce_dims[d] = src_dims[d];
+            reduce_size *= reduce_dims[d];
+            idle_dims[d] = dim_t {1};
+            if (dst_dims[d] > 1) {
+                k = dst_dims[d];
+                k_dim = d;
+            }
+        }
+        idle_size *= idle_dims[d];
+    }
+
+    parallel_nd(idle_size, [&](dim_t l_offset) {
+        dims_t idle_pos, reduce_pos;
+        utils::l_dims_by_l_offset(idle_pos, l_offset, idle_dims, ndims);
+        const dim_t src_idle_off = src_mdw.off_v(idle_pos);
+
+        arg_reduction_utils::top_k_t top_k(k);
+        for (dim_t r = 0; r < reduce_size; ++r) {
+            utils::l_dims_by_l_offset(reduce_pos, r, reduce_dims, ndims);
+            const dim_t src_off = src_idle_off + src_mdw.off_v(reduce_pos);
+            const float s
+                    = io::load_float_value(src_mdw.data_type(), src, src_off);
+            top_k.push(is_min ? -s : s, r);
+        }
+
+        std::vector<int32_t> indices(k);
+        top_k.get_indices(indices.data());
+        for (dim_t i = 0; i < k; ++i) {
+            if (k_dim >= 0) idle_pos[k_dim] = i;
+            dst[dst_mdw.off_v(idle_pos)] = indices[i];
+        }
+    });
+
+    return status::success;
+}
+
 status_t ref_reduction_t::execute_ref(const exec_ctx_t &ctx) const {
     status_t status = status::success;
     auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
@@ -70,12 +70,14 @@ struct ref_reduction_t : public primitive_t {
     }
 
     status_t execute(const exec_ctx_t &ctx) const override {
+        if (pd()->is_arg_reduction()) return execute_arg_ref(ctx);
         return execute_ref(ctx);
     }
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     status_t execute_ref(const exec_ctx_t &ctx) const;
+    status_t execute_arg_ref(const exec_ctx_t &ctx) const;
     std::unique_ptr<ref_post_ops_t> ref_post_ops;
 };
 
@@ -137,6 +137,13 @@ void ref_resampling_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
     const dim_t OH = pd()->OH();
     const dim_t OW = pd()->OW();
 
+    filter_table_t fd, fh, fw;
+    if (is_filter_alg(alg)) {
+        fd = filter_table_t(alg, OD, ID);
+        fh = filter_table_t(alg, OH, IH);
+        fw = filter_table_t(alg, OW, IW);
+    }
+
     auto lin_interp = [&](float c0, float c1, float w) {
         return c0 * w + c1 * (1 - w);
     };
@@ -190,6 +197,18 @@ void ref_resampling_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
                     res = trilin_interp(src_l[0], src_l[1], src_l[2], src_l[3],
                             src_l[4], src_l[5], src_l[6], src_l[7], id.wei[0],
                             ih.wei[0], iw.wei[0]);
+                } else if (is_filter_alg(alg)) {
+                    const float *wd = fd.weights(od);
+                    const float *wh = fh.weights(oh);
+                    const float *ww = fw.weights(ow);
+                    for_(dim_t i = 0; i < fd.size(od); i++)
+                    for_(dim_t j = 0; j < fh.size(oh); j++)
+                    for (dim_t k = 0; k < fw.size(ow); k++) {
+                        const dim_t off = get_offset(src_d, mb, ch,
+                                fd.start(od) + i, fh.start(oh) + j,
+                                fw.start(ow) + k);
+                        res += wd[i] * wh[j] * ww[k] * load_fn(src, off);
+                    }
                 }
 
                 ref_post_ops_t::args_t args;
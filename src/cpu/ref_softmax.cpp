@@ -212,6 +212,12 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
     const float *dst_scales
             = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
 
+    const bool with_dropout = pd()->with_dropout();
+    const auto p = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_DROPOUT_PROBABILITY);
+    const auto seed = CTX_IN_MEM(const uint32_t *, DNNL_ARG_ATTR_DROPOUT_SEED);
+    auto dropout_mask
+            = CTX_OUT_MEM(unsigned char *, DNNL_ARG_ATTR_DROPOUT_MASK);
+
     float *interim_scratchpad
             = ctx.get_scratchpad_grantor().template get<float>(
                     key_softmax_interim_store);
@@ -251,6 +257,31 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
     const auto axis_size = pd()->axis_size(true);
     const int nthr = pd()->nthr_;
 
+    // The mask keeps a prefix of each row, elements outside of it are not
+    // read and produce the value of a zero probability.
+    const auto &sm = pd()->attr()->softmax_mask_;
+    const auto *lengths
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_SOFTMAX_LENGTHS);
+    const memory_desc_wrapper lengths_d(&sm.lengths_desc_);
+    const dim_t nrows = sm.with_causal() ? src_d.dims()[pd()->axis() - 1] : 1;
+    const dim_t causal_shift
+            = sm.kind_ == softmax_mask_kind::causal_bottom_right
+            ? channels_ - nrows
+            : 0;
+    const float masked_val = pd()->is_logsoftmax() ? -INFINITY : 0.f;
+    auto valid_size = [&](dim_t ou, dim_t in) {
+        dim_t n = channels_;
+        if (sm.with_causal()) {
+            const dim_t row = ou % nrows;
+            n = nstl::min(n, nstl::max<dim_t>(0, row + causal_shift + 1));
+        }
+        if (sm.with_lengths()) {
+            const dim_t l = lengths[lengths_d.off_l(ou * inner_size_ + in)];
+            n = nstl::min(n, nstl::max<dim_t>(0, l));
+        }
+        return n;
+    };
+
     parallel_nd_ext(nthr, outer_size_, [&](int ithr, int, dim_t ou) {
         const dim_t thr_shift = ithr * axis_size;
 
@@ -268,14 +299,15 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
 
         for (int in = 0; in < inner_size_; in++) {
             dim_t ou_in_offset = ou * channels_ * inner_size_ + in;
+            const dim_t n_valid = valid_size(ou, in);
 
-            for (int c = 0; c < channels_; c++) {
+            for (int c = 0; c < n_valid; c++) {
                 size_t off = src_d.off_l(ou_in_offset + c * inner_size_);
                 float s = io::load_float_value(src_d.data_type(), src, off);
                 space_max[in] = nstl::max(space_max[in], s);
             }
 
-            for (int c = 0; c < channels_; c++) {
+            for (int c = 0; c < n_valid; c++) {
                 size_t src_off = src_d.off_l(ou_in_offset + c * inner_size_);
                 float s = io::load_float_value(src_d.data_type(), src, src_off);
                 float d = s - space_max[in];
@@ -301,16 +333,21 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
                 size_t interim_off = pd()->need_intermediate_scratchpad()
                         ? thr_shift + c
                         : dst_off;
-                float d = io::load_float_value(
-                        interim_dt, interim_ptr, interim_off);
-                if (pd()->is_softmax()) {
-                    float sd = space_denom[in] ? space_denom[in] : 1.f;
-                    d /= sd;
-                } else if (pd()->is_logsoftmax()) {
-                    float sd = space_denom[in];
-                    d -= sd;
+                float d = masked_val;
+                if (c < n_valid) {
+                    d = io::load_float_value(
+                            interim_dt, interim_ptr, interim_off);
+                    if (pd()->is_softmax()) {
+                        float sd = space_denom[in] ? space_denom[in] : 1.f;
+                        d /= sd;
+                    } else if (pd()->is_logsoftmax()) {
+                        float sd = space_denom[in];
+                        d -= sd;
+                    }
                 }
                 if (with_src_scales) d *= src_scales[0];
+                if (with_dropout)
+                    d = ref_dropout(d, dropout_mask, dst_off, *p, *seed);
 
                 // post-ops
                 ref_post_ops_t::args_t args;
@@ -328,13 +365,41 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
 }
 
 // softmax along last physical dimension
+status_t ref_softmax_fwd_t::execute_workspace(const exec_ctx_t &ctx) const {
+    if (types::is_zero_md(pd()->workspace_md())) return status::success;
+
+    auto dst = CTX_OUT_MEM(const void *, DNNL_ARG_DST);
+    auto ws = CTX_OUT_MEM(void *, DNNL_ARG_WORKSPACE);
+
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper ws_d(pd()->workspace_md());
+
+    // The workspace has the layout of the destination.
+    if (dst_d.is_dense()) {
+        parallel_nd(dst_d.nelems(), [&](dim_t e) {
+            const dim_t off = dst_d.offset0() + e;
+            const float d = io::load_float_value(dst_d.data_type(), dst, off);
+            io::store_float_value(ws_d.data_type(), d, ws, off);
+        });
+    } else {
+        parallel_nd(dst_d.nelems(), [&](dim_t e) {
+            const dim_t off = dst_d.off_l(e);
+            const float d = io::load_float_value(dst_d.data_type(), dst, off);
+            io::store_float_value(ws_d.data_type(), d, ws, off);
+        });
+    }
+    return status::success;
+}
+
 status_t ref_softmax_bwd_t::execute_backward_dense(
         const exec_ctx_t &ctx) const {
-    auto dst = CTX_IN_MEM(const void *, DNNL_ARG_DST);
+    const bool with_ws = !types::is_zero_md(pd()->workspace_md());
+    auto dst = CTX_IN_MEM(
+            const void *, with_ws ? DNNL_ARG_WORKSPACE : DNNL_ARG_DST);
     auto diff_dst = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST);
     auto diff_src = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_SRC);
 
-    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper dst_d(pd()->data_md());
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
 
@@ -383,11 +448,13 @@ status_t ref_softmax_bwd_t::execute_backward_dense(
 
 status_t ref_softmax_bwd_t::execute_backward_generic(
         const exec_ctx_t &ctx) const {
-    auto dst = CTX_IN_MEM(const void *, DNNL_ARG_DST);
+    const bool with_ws = !types::is_zero_md(pd()->workspace_md());
+    auto dst = CTX_IN_MEM(
+            const void *, with_ws ? DNNL_ARG_WORKSPACE : DNNL_ARG_DST);
     auto diff_dst = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST);
     auto diff_src = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_SRC);
 
-    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper dst_d(pd()->data_md());
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
 
@@ -58,13 +58,25 @@ struct ref_softmax_fwd_t : public primitive_t {
                                       f8_e5m2, f8_e4m3, s8, u8),
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_SOFTMAX(attr()->has_default_values(skip_mask_t::scales
-                                      | skip_mask_t::post_ops),
+                                      | skip_mask_t::post_ops
+                                      | skip_mask_t::softmax_mask
+                                      | skip_mask_t::dropout
+                                      | skip_mask_t::workspace_data_type),
                     VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_SOFTMAX(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
             VDISPATCH_SOFTMAX(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
 
             VDISPATCH_SOFTMAX(set_default_formats() == status::success,
                     VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SOFTMAX(attr_dropout_ok(), VERBOSE_UNSUPPORTED_ATTR);
+            // The workspace keeps the values of the destination, which are
+            // not known with destination scales.
+            VDISPATCH_SOFTMAX(
+                    IMPLICATION(attr()->workspace_dt_ != undef,
+                            attr()->scales_.has_default_values(DNNL_ARG_DST)),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_SOFTMAX(init_default_ws() == status::success,
+                    VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_SOFTMAX(
                     attr_.set_default_formats(dst_md(0)) == status::success,
                     VERBOSE_UNSUPPORTED_POSTOP);
@@ -134,9 +146,12 @@ struct ref_softmax_fwd_t : public primitive_t {
             if (bd.inner_idxs[iblk] == axis)
                 axis_blk_size *= bd.inner_blks[iblk];
 
+        // The mask and dropout are applied by the generic implementation
+        // only.
         use_dense_ = inner_size_ == 1 && src_d == dst_d && src_d.is_dense(true)
                 && src_d.only_padded_dim(axis)
-                && bd.strides[axis] == axis_blk_size;
+                && bd.strides[axis] == axis_blk_size && !pd()->with_mask()
+                && !pd()->with_dropout();
 
         ref_post_ops
                 = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
@@ -148,14 +163,17 @@ struct ref_softmax_fwd_t : public primitive_t {
 
     status_t execute(const exec_ctx_t &ctx) const override {
         if (use_dense_)
-            return execute_forward_dense(ctx);
+            CHECK(execute_forward_dense(ctx));
         else
-            return execute_forward_generic(ctx);
+            CHECK(execute_forward_generic(ctx));
+        return execute_workspace(ctx);
     }
 
 private:
     status_t execute_forward_dense(const exec_ctx_t &ctx) const;
     status_t execute_forward_generic(const exec_ctx_t &ctx) const;
+    // Copies the destination to the workspace, if any.
+    status_t execute_workspace(const exec_ctx_t &ctx) const;
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
@@ -172,20 +190,33 @@ struct ref_softmax_bwd_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             using namespace data_type;
+            init_default_ws();
+            const bool with_ws = !types::is_zero_md(workspace_md());
             bool ok = !is_fwd()
                     && utils::one_of(dst_md()->data_type, f32, bf16, f16)
                     && utils::one_of(diff_dst_md()->data_type, f32, bf16, f16)
                     && utils::one_of(diff_src_md()->data_type, f32, bf16, f16)
-                    && platform::has_data_type_support(dst_md()->data_type)
+                    && platform::has_data_type_support(data_md()->data_type)
                     && platform::has_data_type_support(diff_dst_md()->data_type)
                     && platform::has_data_type_support(diff_src_md()->data_type)
-                    && dst_md()->data_type == diff_dst_md()->data_type
+                    && IMPLICATION(!with_ws,
+                            dst_md()->data_type == diff_dst_md()->data_type)
+                    && IMPLICATION(with_ws,
+                            utils::array_cmp(workspace_md()->dims,
+                                    dst_md()->dims, dst_md()->ndims))
                     && attr()->has_default_values()
                     && set_default_formats() == status::success;
             if (!ok) return status::unimplemented;
 
             return status::success;
         }
+
+        // The values of the destination, which are read from the workspace
+        // of the forward pass if it keeps one.
+        const memory_desc_t *data_md() const {
+            return types::is_zero_md(workspace_md()) ? dst_md()
+                                                     : workspace_md();
+        }
     };
 
     ref_softmax_bwd_t(const pd_t *apd) : primitive_t(apd) {}
@@ -195,7 +226,7 @@ struct ref_softmax_bwd_t : public primitive_t {
         channels_ = pd()->axis_size();
         inner_size_ = pd()->inner_size();
 
-        const memory_desc_wrapper data_d(pd()->dst_md());
+        const memory_desc_wrapper data_d(pd()->data_md());
         const memory_desc_wrapper diff_d(pd()->diff_dst_md());
         const auto &bd = diff_d.blocking_desc();
 
@@ -205,7 +236,8 @@ struct ref_softmax_bwd_t : public primitive_t {
             if (bd.inner_idxs[iblk] == axis)
                 axis_blk_size *= bd.inner_blks[iblk];
 
-        use_dense_ = inner_size_ == 1 && diff_d == data_d && diff_d.is_dense()
+        use_dense_ = inner_size_ == 1 && diff_d.similar_to(data_d, true, false)
+                && diff_d.is_dense()
                 && bd.strides[axis] == axis_blk_size;
         return status::success;
     }
@@ -24,6 +24,8 @@
 #include "cpu/reorder/simple_reorder.hpp"
 #include "cpu/reorder/simple_sparse_reorder.hpp"
 
+#include "cpu/reorder/dynamic_quant_reorder.hpp"
+
 #include "common/impl_list_item.hpp"
 #include "common/memory.hpp"
 #include "common/type_helpers.hpp"
@@ -34,6 +36,7 @@
 #if DNNL_X64
 #include "cpu/x64/jit_uni_reorder.hpp"
 #include "cpu/x64/jit_uni_reorder_direct_copy.hpp"
+#include "cpu/x64/jit_uni_reorder_transpose.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_reorders.hpp"
 #elif DNNL_AARCH64
 #include "cpu/aarch64/jit_uni_reorder.hpp"
@@ -26,6 +26,7 @@ const impl_list_map_t &comp_bf16_s8_impl_list_map() {
     static const impl_list_map_t the_map = REG_REORDER_P({
         // bf16 -> s8
         {{bf16, s8, 2}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
             DNNL_NON_X64_ONLY(REG_SR(bf16, oi, s8, OI4i16o4i, fmt_order::keep, spec::conv_req_comp))
             DNNL_NON_X64_ONLY(REG_SR(bf16, format_tag::io, s8, OI4i16o4i, fmt_order::keep, spec::conv_req_comp))
@@ -53,6 +54,7 @@ const impl_list_map_t &comp_bf16_s8_impl_list_map() {
         }},
         // bf16 -> s8
         {{bf16, s8, 3}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
             DNNL_NON_X64_ONLY(REG_SR(bf16, any, s8, wio, fmt_order::keep, spec::conv_req_comp))
             DNNL_NON_X64_ONLY(REG_SR(bf16, iwo, s8, OIw4i16o4i, fmt_order::keep, spec::conv_req_comp))
@@ -90,6 +92,7 @@ const impl_list_map_t &comp_bf16_s8_impl_list_map() {
             nullptr,
         }},
         {{bf16, s8, 4}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
             DNNL_NON_X64_ONLY(REG_SR(bf16, any, s8, hwio, fmt_order::keep, spec::conv_req_comp))
             DNNL_NON_X64_ONLY(REG_SR(bf16, any, s8, wigo, fmt_order::keep, spec::conv_req_comp))
@@ -138,6 +141,7 @@ const impl_list_map_t &comp_bf16_s8_impl_list_map() {
             nullptr,
         }},
         {{bf16, s8, 5}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
             DNNL_NON_X64_ONLY(REG_SR(bf16, any, s8, hwigo, fmt_order::keep, spec::conv_req_comp))
             DNNL_NON_X64_ONLY(REG_SR(bf16, any, s8, dhwio, fmt_order::keep, spec::conv_req_comp))
@@ -183,6 +187,7 @@ const impl_list_map_t &comp_bf16_s8_impl_list_map() {
             nullptr,
         }},
         {{bf16, s8, 6}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
             DNNL_NON_X64_ONLY(REG_SR(bf16, any, s8, dhwigo, fmt_order::keep, spec::conv_req_comp))
             DNNL_NON_X64_ONLY(REG_SR(bf16, goidhw, s8, gOIdhw4i16o4i, fmt_order::keep, spec::conv_req_comp))
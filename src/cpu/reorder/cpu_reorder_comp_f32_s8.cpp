@@ -27,6 +27,7 @@ const impl_list_map_t &comp_f32_s8_impl_list_map() {
     static const impl_list_map_t the_map = REG_REORDER_P({
         // f32 -> s8
         {{f32, s8, 2}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
             DNNL_AARCH64_ONLY(CPU_REORDER_INSTANCE(aarch64::jit_uni_reorder_t))
             DNNL_NON_X64_ONLY(REG_SR(f32, oi, s8, OI4i16o4i, fmt_order::keep, spec::conv_req_comp))
@@ -47,6 +48,7 @@ const impl_list_map_t &comp_f32_s8_impl_list_map() {
         }},
         // f32 -> s8
         {{f32, s8, 3}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
             DNNL_AARCH64_ONLY(CPU_REORDER_INSTANCE(aarch64::jit_uni_reorder_t))
             DNNL_NON_X64_ONLY(REG_SR(f32, any, s8, wio, fmt_order::keep, spec::conv_req_comp))
@@ -85,6 +87,7 @@ const impl_list_map_t &comp_f32_s8_impl_list_map() {
             nullptr,
         }},
         {{f32, s8, 4}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
             DNNL_AARCH64_ONLY(CPU_REORDER_INSTANCE(aarch64::jit_uni_reorder_t))
             DNNL_NON_X64_ONLY(REG_SR(f32, any, s8, hwio, fmt_order::keep, spec::conv_req_comp))
@@ -134,6 +137,7 @@ const impl_list_map_t &comp_f32_s8_impl_list_map() {
             nullptr,
         }},
         {{f32, s8, 5}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
             DNNL_AARCH64_ONLY(CPU_REORDER_INSTANCE(aarch64::jit_uni_reorder_t))
 
@@ -181,6 +185,7 @@ const impl_list_map_t &comp_f32_s8_impl_list_map() {
             nullptr,
         }},
         {{f32, s8, 6}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
             DNNL_AARCH64_ONLY(CPU_REORDER_INSTANCE(aarch64::jit_uni_reorder_t))
             DNNL_NON_X64_ONLY(REG_SR(f32, any, s8, dhwigo, fmt_order::keep, spec::conv_req_comp))
@@ -26,9 +26,11 @@ const impl_list_map_t &regular_bf16_impl_list_map() {
     static const impl_list_map_t the_map = REG_REORDER_P({
         // bf16 ->
         {{bf16, data_type::undef, 0}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             CPU_REORDER_INSTANCE(rnn_weights_reorder_t<bf16, bf16>)
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::brgemm_matmul_copy_reorder_t))
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_direct_copy_t))
+            DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_transpose_t))
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_blk_reorder_t))
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
 
@@ -62,6 +64,8 @@ const impl_list_map_t &regular_bf16_impl_list_map() {
             REG_SR(bf16, any, f8_e5m2, any, fmt_order::any, spec::reference)
             REG_SR(bf16, any, f8_e4m3, any, fmt_order::any, spec::reference)
 
+            CPU_REORDER_INSTANCE(simple_structured_sparse_reorder_t<bf16>)
+
             nullptr,
         }},
     });
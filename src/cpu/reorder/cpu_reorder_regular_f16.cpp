@@ -26,10 +26,12 @@ const impl_list_map_t &regular_f16_impl_list_map() {
     static const impl_list_map_t the_map = REG_REORDER_P({
         // f16 ->
         {{f16, data_type::undef, 0}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             DNNL_AARCH64_ONLY(REG_SR_DIRECT_COPY(f16, f16))
 
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::brgemm_matmul_copy_reorder_t))
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_direct_copy_t))
+            DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_transpose_t))
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_blk_reorder_t))
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
 
@@ -42,6 +44,8 @@ const impl_list_map_t &regular_f16_impl_list_map() {
             REG_SR(f16, any, s8, any, fmt_order::any, spec::reference)
             REG_SR(f16, any, u8, any, fmt_order::any, spec::reference)
 
+            CPU_REORDER_INSTANCE(simple_csr_coo_reorder_t<f16>)
+
             nullptr,
         }},
     });
@@ -27,6 +27,7 @@ const impl_list_map_t &regular_f32_u8_impl_list_map() {
     static const impl_list_map_t the_map = REG_REORDER_P({
         // f32 -> u8
         {{f32, u8, 0}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             CPU_REORDER_INSTANCE(rnn_data_reorder_t<f32, u8>)
 
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_direct_copy_t))
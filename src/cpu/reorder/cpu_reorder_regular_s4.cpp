@@ -25,6 +25,7 @@ namespace cpu {
 const impl_list_map_t &regular_s4_impl_list_map() {
     static const impl_list_map_t the_map = REG_REORDER_P({
         {{f32, s4, 0}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             REG_SR(f32, any, s4, any, fmt_order::any, spec::reference)
             nullptr,
         }},
@@ -0,0 +1,684 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+
+#include "common/bfloat16.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/float4.hpp"
+#include "common/float8.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/reorder/dynamic_quant_reorder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+// The largest and the smallest number of channels of a block.
+constexpr dim_t c_block_max = 64;
+constexpr dim_t c_block_min = 16;
+
+// The range of the quantized values of a destination data type, and the
+// largest value a symmetric quantization maps the largest absolute source
+// value of a group to.
+template <data_type_t dt>
+struct q_range_t;
+#define DECLARE_Q_RANGE(dt, lo, hi, sym) \
+    template <> \
+    struct q_range_t<data_type::dt> { \
+        static constexpr float qmin() { return lo; } \
+        static constexpr float qmax() { return hi; } \
+        static constexpr float qsym() { return sym; } \
+    };
+DECLARE_Q_RANGE(s8, -128.f, 127.f, 127.f)
+DECLARE_Q_RANGE(u8, 0.f, 255.f, 0.f)
+DECLARE_Q_RANGE(s4, -8.f, 7.f, 7.f)
+DECLARE_Q_RANGE(u4, 0.f, 15.f, 0.f)
+DECLARE_Q_RANGE(f4_e2m1, -6.f, 6.f, 6.f)
+DECLARE_Q_RANGE(f8_e5m2, -57344.f, 57344.f, 57344.f)
+DECLARE_Q_RANGE(f8_e4m3, -448.f, 448.f, 448.f)
+#undef DECLARE_Q_RANGE
+
+// Writes a quantized value at an element offset and returns it as an integer
+// for the compensation, which is only defined for integer data types. Two
+// 4-bit values share a byte, the one with the even offset being in the low
+// nibble.
+template <data_type_t dt>
+int store_q(uint8_t *dst, dim_t off, float v) {
+    using namespace data_type;
+    using range_t = q_range_t<dt>;
+    const float x = nstl::min(nstl::max(v, range_t::qmin()), range_t::qmax());
+    const int q = utils::one_of(dt, f4_e2m1, f8_e5m2, f8_e4m3)
+            ? 0
+            : static_cast<int>(nearbyintf(x));
+    if (utils::one_of(dt, s8, u8)) {
+        dst[off] = static_cast<uint8_t>(q);
+        return q;
+    }
+    if (dt == f8_e5m2) {
+        dst[off] = float8_e5m2_t(x).raw_bits_;
+        return q;
+    }
+    if (dt == f8_e4m3) {
+        dst[off] = float8_e4m3_t(x).raw_bits_;
+        return q;
+    }
+    const uint8_t bits = dt == f4_e2m1 ? float4_e2m1_t(x).raw_bits_
+                                       : static_cast<uint8_t>(q & 0xf);
+    nibble2_t pair(dst[off / 2]);
+    pair.set(bits, off % 2);
+    dst[off / 2] = pair.get();
+    return q;
+}
+} // namespace
+
+status_t dynamic_quant_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
+        engine_t *engine, const primitive_attr_t *attr, engine_t *src_engine,
+        const memory_desc_t *src_md, engine_t *dst_engine,
+        const memory_desc_t *dst_md) {
+    auto _pd = make_unique_pd<pd_t>(
+            attr, src_engine->kind(), src_md, dst_engine->kind(), dst_md);
+    if (_pd == nullptr) return status::out_of_memory;
+
+    CHECK(_pd->init(engine, src_engine, dst_engine));
+
+    return safe_ptr_assign(*reorder_pd, _pd.release());
+}
+
+status_t dynamic_quant_reorder_t::pd_t::init(
+        engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    CHECK(cpu_reorder_pd_t::init(engine, src_engine, dst_engine));
+
+    VDISPATCH_REORDER(attr()->dynamic_quantization_, VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_REORDER(
+            attr()->has_default_values(smask_t::scales_groups
+                    | smask_t::scales_data_type | smask_t::zero_points_groups
+                    | smask_t::zero_points_data_type
+                    | smask_t::dynamic_quantization),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_REORDER(is_dense_format_kind({src_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_REORDER(!src_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(!dst_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(
+            src_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_REORDER(
+            dst_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_REORDER(!src_d.has_zero_dim(), VERBOSE_EMPTY_TENSOR, "src");
+    VDISPATCH_REORDER(utils::one_of(src_d.data_type(), f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_REORDER(utils::one_of(dst_d.data_type(), s8, u8, s4, u4, f4_e2m1,
+                              f8_e5m2, f8_e4m3),
+            VERBOSE_UNSUPPORTED_DT);
+
+    // Unsigned destinations have no symmetric quantization, and the
+    // compensations are only defined for s8 weights quantized symmetrically.
+    with_zero_points_ = !attr()->zero_points_.has_default_values(DNNL_ARG_DST);
+    VDISPATCH_REORDER(IMPLICATION(utils::one_of(dst_d.data_type(), u8, u4),
+                              with_zero_points_),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    VDISPATCH_REORDER(IMPLICATION(utils::one_of(dst_d.data_type(), f4_e2m1,
+                                          f8_e5m2, f8_e4m3),
+                              !with_zero_points_),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    VDISPATCH_REORDER(utils::one_of(attr()->scales_.get_data_type(DNNL_ARG_DST),
+                              f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_REORDER(IMPLICATION(with_zero_points_,
+                              utils::one_of(attr()->zero_points_.get_data_type(
+                                                    DNNL_ARG_DST),
+                                      s32, s8, u8)),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+
+    const auto allowed_flags = dst_d.data_type() == s8 && !with_zero_points_
+            ? memory_extra_flags::compensation_conv_s8s8
+                    | memory_extra_flags::compensation_conv_asymmetric_src
+                    | memory_extra_flags::scale_adjust
+            : 0u;
+    VDISPATCH_REORDER(
+            src_d.extra().flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG, "src");
+    VDISPATCH_REORDER((dst_d.extra().flags & ~allowed_flags) == 0,
+            VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
+
+    return init_conf(engine);
+}
+
+status_t dynamic_quant_reorder_t::pd_t::init_conf(engine_t *engine) {
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const int ndims = src_d.ndims();
+    const auto &dims = src_d.dims();
+
+    const auto &sc = attr()->scales_.get(DNNL_ARG_DST);
+    const int mask = attr()->scales_.get_mask(DNNL_ARG_DST);
+    VDISPATCH_REORDER(mask < (1 << ndims), VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    // A zero point is computed for every scale and stored the same way.
+    if (with_zero_points_) {
+        const auto &zp = attr()->zero_points_.get(DNNL_ARG_DST);
+        bool zp_ok = zp.get_mask() == mask
+                && zp.has_default_groups() == sc.has_default_groups();
+        if (zp_ok && !sc.has_default_groups())
+            zp_ok = zp.get_group(0) == sc.get_group(0)
+                    && zp.get_group(1) == sc.get_group(1);
+        VDISPATCH_REORDER(zp_ok, VERBOSE_UNSUPPORTED_ZP_CFG);
+    }
+
+    // A common scale is computed in two parallel passes over the source, the
+    // first one finding the range of the tensor and the second one
+    // quantizing it. The compensations are per channel and cannot be
+    // computed this way, and the points of the tensor are split between the
+    // threads regardless of the bytes of a 4-bit destination.
+    is_common_ = mask == 0;
+    if (is_common_) {
+        VDISPATCH_REORDER(
+                dst_d.extra().flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
+        VDISPATCH_REORDER(utils::one_of(dst_d.data_type(), data_type::s8,
+                                  data_type::u8, data_type::f8_e5m2,
+                                  data_type::f8_e4m3),
+                VERBOSE_UNSUPPORTED_DT);
+        return status::success;
+    }
+
+    channel_mask_ = 0;
+    for (int d = 0; d < ndims; d++) {
+        dim_t group = dims[d];
+        if (mask & (1 << d)) {
+            group = d >= ndims - 2 && !sc.has_default_groups()
+                    ? sc.get_group(d - (ndims - 2))
+                    : 1;
+            if (group == 1) channel_mask_ |= 1 << d;
+        }
+        group_dims_[d] = group;
+    }
+    // Groups along all the masked dimensions are not supported.
+    VDISPATCH_REORDER(channel_mask_ != 0, VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    const auto flags = dst_d.extra().flags;
+    const bool req_comp = flags & memory_extra_flags::compensation_conv_s8s8;
+    const bool req_asymmetric_comp
+            = flags & memory_extra_flags::compensation_conv_asymmetric_src;
+    VDISPATCH_REORDER(IMPLICATION(req_comp,
+                              dst_d.extra().compensation_mask == channel_mask_),
+            "s8s8 compensation configuration is not supported");
+    VDISPATCH_REORDER(IMPLICATION(req_asymmetric_comp,
+                              dst_d.extra().asymm_compensation_mask
+                                      == channel_mask_),
+            "zero-points compensation configuration is not supported");
+
+    // The scales are dense over the masked dimensions and the compensations
+    // are dense over the padded channels.
+    dim_t scale_stride = 1, comp_stride = 1;
+    for (int d = ndims - 1; d >= 0; d--) {
+        scale_strides_[d] = 0;
+        comp_strides_[d] = 0;
+        if (!(mask & (1 << d))) continue;
+        scale_strides_[d] = scale_stride;
+        scale_stride *= dims[d] / group_dims_[d];
+        if (!(channel_mask_ & (1 << d))) continue;
+        comp_strides_[d] = comp_stride;
+        comp_stride *= dst_d.padded_dims()[d];
+    }
+
+    // The blocks are taken along the channels with the smallest source
+    // stride, so that a block reads contiguous source elements when the
+    // channels are the innermost dimension.
+    const auto &src_strides = src_d.blocking_desc().strides;
+    c_inner_ = -1;
+    for (int d = 0; d < ndims; d++) {
+        if (!(channel_mask_ & (1 << d))) continue;
+        if (c_inner_ < 0 || src_strides[d] < src_strides[c_inner_])
+            c_inner_ = d;
+    }
+
+    // The group of a block is read twice, so it should stay in L2 between
+    // the reads. Smaller blocks are also used when there are too few of them
+    // for all the threads.
+    dim_t group_size = 1, nouter = 1;
+    for (int d = 0; d < ndims; d++) {
+        if (!(channel_mask_ & (1 << d)))
+            group_size *= group_dims_[d];
+        else if (d != c_inner_)
+            nouter *= dims[d];
+    }
+    const dim_t l2_size = platform::get_per_core_cache_size(2);
+    const dim_t group_bytes = group_size * src_d.data_type_size();
+    const dim_t C = dims[c_inner_];
+    const int nthr = dnnl_get_max_threads();
+    c_block_ = c_block_max;
+    while (c_block_ > c_block_min
+            && (2 * group_bytes * c_block_ > l2_size
+                    || nouter * utils::div_up(C, c_block_) < nthr))
+        c_block_ /= 2;
+    c_block_ = nstl::min(c_block_, C);
+
+    if (utils::one_of(dst_d.data_type(), data_type::s4, data_type::u4,
+                data_type::f4_e2m1))
+        VDISPATCH_REORDER(nibbles_ok(), VERBOSE_UNSUPPORTED_TAG_S, "dst");
+
+    return status::success;
+}
+
+// The two values of a byte of a 4-bit destination are written by one thread
+// when they differ only in one dimension, by an odd point and the previous
+// one, and this dimension is either a reduced one, all of which a block
+// covers, or the channels of the blocks with both points in the same block.
+bool dynamic_quant_reorder_t::pd_t::nibbles_ok() const {
+    const memory_desc_wrapper dst_d(dst_md());
+    const int ndims = dst_d.ndims();
+    const auto &dims = dst_d.dims();
+    if (dst_d.offset0() % 2 != 0) return false;
+
+    // The dimension whose points have odd offsets, if any.
+    int pair_dim = -1;
+    for_(int d = 0; d < ndims; d++)
+    for (dim_t x = 0; x < dims[d]; x++) {
+        dims_t pos = {};
+        pos[d] = x;
+        const dim_t off = dst_d.off_v(pos) - dst_d.offset0();
+        if (off % 2 == 0) continue;
+        if (pair_dim >= 0 && pair_dim != d) return false;
+        pair_dim = d;
+        if (x % 2 == 0) return false;
+        pos[d] = x - 1;
+        if (dst_d.off_v(pos) - dst_d.offset0() != off - 1) return false;
+    }
+    if (pair_dim < 0 || !(channel_mask_ & (1 << pair_dim))) return true;
+    return pair_dim == c_inner_
+            && (c_block_ % 2 == 0 || c_block_ == dims[c_inner_]);
+}
+
+status_t dynamic_quant_reorder_t::init(engine_t *engine) {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const int ndims = src_d.ndims();
+    const auto &dims = src_d.dims();
+
+    dim_t total = 0;
+    for (int d = 0; d < ndims; d++) {
+        offs_start_[d] = total;
+        total += dims[d];
+    }
+    src_offs_.resize(total);
+    dst_offs_.resize(total);
+    for_(int d = 0; d < ndims; d++)
+    for (dim_t x = 0; x < dims[d]; x++) {
+        dims_t pos = {};
+        pos[d] = x;
+        src_offs_[offs_start_[d] + x] = src_d.off_v(pos) - src_d.offset0();
+        dst_offs_[offs_start_[d] + x] = dst_d.off_v(pos) - dst_d.offset0();
+    }
+    return status::success;
+}
+
+template <typename src_data_t, data_type_t dst_dt>
+status_t dynamic_quant_reorder_t::execute_impl(const exec_ctx_t &ctx) const {
+    using range_t = q_range_t<dst_dt>;
+    auto input = CTX_IN_MEM(const src_data_t *, DNNL_ARG_FROM);
+    auto output = CTX_OUT_MEM(uint8_t *, DNNL_ARG_TO);
+    auto scales = CTX_OUT_MEM(void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_TO);
+    auto zero_points
+            = CTX_OUT_MEM(void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_TO);
+    const auto scales_dt = pd()->attr()->scales_.get_data_type(DNNL_ARG_DST);
+    const auto zp_dt = pd()->attr()->zero_points_.get_data_type(DNNL_ARG_DST);
+    const bool with_zp = pd()->with_zero_points_;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const int ndims = src_d.ndims();
+    const auto &dims = src_d.dims();
+
+    const auto flags = dst_d.extra().flags;
+    const bool req_comp = flags & memory_extra_flags::compensation_conv_s8s8;
+    const bool req_asymmetric_comp
+            = flags & memory_extra_flags::compensation_conv_asymmetric_src;
+    const float adj_scale = (flags & memory_extra_flags::scale_adjust)
+            ? dst_d.extra().scale_adjust
+            : 1.f;
+
+    // The kernel only writes the points inside the dimensions. The padding
+    // of a 4-bit destination may share bytes with them, so the whole
+    // destination is zeroed instead.
+    if (dst_d.nelems(true) != dst_d.nelems()) {
+        if (utils::one_of(dst_dt, data_type::s4, data_type::u4,
+                    data_type::f4_e2m1)) {
+            const size_t size = dst_d.size();
+            const size_t chunk = 64 * 1024;
+            parallel_nd(utils::div_up(size, chunk), [&](size_t i) {
+                const size_t n = nstl::min(chunk, size - i * chunk);
+                std::memset(output + i * chunk, 0, n);
+            });
+        } else
+            CHECK(ctx.zero_pad_output(DNNL_ARG_TO));
+    }
+
+    if (pd()->is_common_) return execute_common<src_data_t, dst_dt>(ctx);
+
+    const size_t comp_offset = dst_d.size() - dst_d.additional_buffer_size();
+    const size_t cp_size = dst_d.additional_buffer_size(
+            memory_extra_flags::compensation_conv_s8s8);
+    int32_t *cp = req_comp ? reinterpret_cast<int32_t *>(output + comp_offset)
+                           : nullptr;
+    int32_t *zp = req_asymmetric_comp
+            ? reinterpret_cast<int32_t *>(
+                    output + comp_offset + (req_comp ? cp_size : 0))
+            : nullptr;
+    if (req_comp || req_asymmetric_comp) {
+        // Both compensations are over the padded channels.
+        dim_t comp_count = 1;
+        for (int d = 0; d < ndims; d++)
+            if (pd()->channel_mask_ & (1 << d))
+                comp_count *= dst_d.padded_dims()[d];
+        parallel_nd(comp_count, [&](dim_t i) {
+            if (req_comp) cp[i] = 0;
+            if (req_asymmetric_comp) zp[i] = 0;
+        });
+    }
+
+    const src_data_t *src = input + src_d.offset0();
+    const dim_t dst_off0 = dst_d.offset0();
+
+    const int channel_mask = pd()->channel_mask_;
+    const int c_inner = pd()->c_inner_;
+    const dim_t c_block = pd()->c_block_;
+    const auto &group_dims = pd()->group_dims_;
+    const auto &scale_strides = pd()->scale_strides_;
+    const auto &comp_strides = pd()->comp_strides_;
+
+    // The dimensions reduced into a scale, from the outermost one, and the
+    // number of groups along them.
+    int k_dims[DNNL_MAX_NDIMS];
+    int nk = 0;
+    dim_t ngroups = 1, group_size = 1;
+    dim_t ntasks = utils::div_up(dims[c_inner], c_block);
+    for (int d = 0; d < ndims; d++) {
+        if (channel_mask & (1 << d)) {
+            if (d != c_inner) ntasks *= dims[d];
+            continue;
+        }
+        k_dims[nk++] = d;
+        ngroups *= dims[d] / group_dims[d];
+        group_size *= group_dims[d];
+    }
+
+    const dim_t *src_offs = src_offs_.data();
+    const dim_t *dst_offs = dst_offs_.data();
+    const auto &offs_start = offs_start_;
+
+    parallel_nd(ntasks, [&](dim_t task) {
+        // The channel block, with the other channel dimensions outside of it.
+        dims_t pos = {};
+        dim_t t = task;
+        const dim_t nb_c = utils::div_up(dims[c_inner], c_block);
+        const dim_t c0 = (t % nb_c) * c_block;
+        t /= nb_c;
+        for (int d = ndims - 1; d >= 0; d--) {
+            if (!(channel_mask & (1 << d)) || d == c_inner) continue;
+            pos[d] = t % dims[d];
+            t /= dims[d];
+        }
+        const dim_t cn = nstl::min(c_block, dims[c_inner] - c0);
+
+        dim_t ch_src = 0, ch_dst = dst_off0, ch_scale = 0, ch_comp = 0;
+        for (int d = 0; d < ndims; d++) {
+            if (!(channel_mask & (1 << d)) || d == c_inner) continue;
+            ch_src += src_offs[offs_start[d] + pos[d]];
+            ch_dst += dst_offs[offs_start[d] + pos[d]];
+            ch_scale += pos[d] * scale_strides[d];
+            ch_comp += pos[d] * comp_strides[d];
+        }
+        const dim_t *c_src_offs = src_offs + offs_start[c_inner] + c0;
+        const dim_t *c_dst_offs = dst_offs + offs_start[c_inner] + c0;
+
+        float vmin[c_block_max];
+        float vmax[c_block_max];
+        float qscale[c_block_max];
+        float qzp[c_block_max];
+        int32_t acc[c_block_max];
+        for (dim_t c = 0; c < cn; c++)
+            acc[c] = 0;
+
+        for (dim_t g = 0; g < ngroups; g++) {
+            // The first point of the group and the offset of its scales.
+            dims_t gpos = {};
+            dim_t r = g, g_scale = ch_scale;
+            for (int j = nk - 1; j >= 0; j--) {
+                const int d = k_dims[j];
+                const dim_t ng = dims[d] / group_dims[d];
+                g_scale += (r % ng) * scale_strides[d];
+                gpos[d] = (r % ng) * group_dims[d];
+                r /= ng;
+            }
+
+            auto elem_offs = [&](dim_t e, dim_t &s_off, dim_t &d_off) {
+                s_off = ch_src;
+                d_off = ch_dst;
+                for (int j = nk - 1; j >= 0; j--) {
+                    const int d = k_dims[j];
+                    const dim_t x = gpos[d] + e % group_dims[d];
+                    e /= group_dims[d];
+                    s_off += src_offs[offs_start[d] + x];
+                    d_off += dst_offs[offs_start[d] + x];
+                }
+            };
+
+            // The range always includes zero, so that it is represented
+            // exactly by the zero point.
+            for (dim_t c = 0; c < cn; c++)
+                vmin[c] = vmax[c] = 0.f;
+            for (dim_t e = 0; e < group_size; e++) {
+                dim_t s_off, d_off;
+                elem_offs(e, s_off, d_off);
+                const src_data_t *s = src + s_off;
+                for (dim_t c = 0; c < cn; c++) {
+                    const float v = static_cast<float>(s[c_src_offs[c]]);
+                    vmin[c] = nstl::min(vmin[c], v);
+                    vmax[c] = nstl::max(vmax[c], v);
+                }
+            }
+
+            for (dim_t c = 0; c < cn; c++) {
+                // Asymmetric quantization maps the range of the group to the
+                // range of the data type, and symmetric quantization maps
+                // the largest absolute value to qsym.
+                const float range = with_zp
+                        ? (vmax[c] - vmin[c])
+                                / (range_t::qmax() - range_t::qmin())
+                        : nstl::max(vmax[c], -vmin[c]) / range_t::qsym();
+                const dim_t idx = g_scale + (c0 + c) * scale_strides[c_inner];
+                io::store_float_value(
+                        scales_dt, range > 0.f ? range : 1.f, scales, idx);
+                // The quantization uses the scale the way it is stored.
+                const float scale
+                        = io::load_float_value(scales_dt, scales, idx);
+                qscale[c] = adj_scale / scale;
+                qzp[c] = 0.f;
+                if (with_zp) {
+                    const float zp
+                            = nearbyintf(range_t::qmin() - vmin[c] / scale);
+                    qzp[c] = nstl::min(
+                            nstl::max(zp, range_t::qmin()), range_t::qmax());
+                    io::store_float_value(zp_dt, qzp[c], zero_points, idx);
+                }
+            }
+
+            for (dim_t e = 0; e < group_size; e++) {
+                dim_t s_off, d_off;
+                elem_offs(e, s_off, d_off);
+                const src_data_t *s = src + s_off;
+                for (dim_t c = 0; c < cn; c++) {
+                    const float v = static_cast<float>(s[c_src_offs[c]])
+                                    * qscale[c]
+                            + qzp[c];
+                    acc[c] += store_q<dst_dt>(output, d_off + c_dst_offs[c], v);
+                }
+            }
+        }
+
+        for (dim_t c = 0; c < cn; c++) {
+            const dim_t off = ch_comp + (c0 + c) * comp_strides[c_inner];
+            if (req_comp) cp[off] = -128 * acc[c];
+            if (req_asymmetric_comp) zp[off] = -acc[c];
+        }
+    });
+
+    return status::success;
+}
+
+template <typename src_data_t, data_type_t dst_dt>
+status_t dynamic_quant_reorder_t::execute_common(const exec_ctx_t &ctx) const {
+    using range_t = q_range_t<dst_dt>;
+    auto input = CTX_IN_MEM(const src_data_t *, DNNL_ARG_FROM);
+    auto output = CTX_OUT_MEM(uint8_t *, DNNL_ARG_TO);
+    auto scales = CTX_OUT_MEM(void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_TO);
+    auto zero_points
+            = CTX_OUT_MEM(void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_TO);
+    const auto scales_dt = pd()->attr()->scales_.get_data_type(DNNL_ARG_DST);
+    const auto zp_dt = pd()->attr()->zero_points_.get_data_type(DNNL_ARG_DST);
+    const bool with_zp = pd()->with_zero_points_;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const int ndims = src_d.ndims();
+    const auto &dims = src_d.dims();
+    const src_data_t *src = input + src_d.offset0();
+    const dim_t dst_off0 = dst_d.offset0();
+
+    // The tensor is walked by rows of its innermost dimension.
+    const int inner = ndims - 1;
+    const dim_t row_size = dims[inner];
+    const dim_t nrows = src_d.nelems() / row_size;
+    const dim_t *src_offs = src_offs_.data();
+    const dim_t *dst_offs = dst_offs_.data();
+    const dim_t *row_src_offs = src_offs + offs_start_[inner];
+    const dim_t *row_dst_offs = dst_offs + offs_start_[inner];
+    const auto &offs_start = offs_start_;
+    auto row_offs = [&](dim_t row, dim_t &s_off, dim_t &d_off) {
+        s_off = 0;
+        d_off = dst_off0;
+        for (int d = inner - 1; d >= 0; d--) {
+            const dim_t x = row % dims[d];
+            row /= dims[d];
+            s_off += src_offs[offs_start[d] + x];
+            d_off += dst_offs[offs_start[d] + x];
+        }
+    };
+
+    // Every thread finds the range of its rows, which always includes zero
+    // so that it is represented exactly by the zero point.
+    const int max_nthr = dnnl_get_max_threads();
+    std::vector<float> thr_min(max_nthr, 0.f), thr_max(max_nthr, 0.f);
+    parallel(max_nthr, [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(nrows, nthr, ithr, start, end);
+        float vmin = 0.f, vmax = 0.f;
+        for (dim_t row = start; row < end; row++) {
+            dim_t s_off, d_off;
+            row_offs(row, s_off, d_off);
+            const src_data_t *s = src + s_off;
+            for (dim_t x = 0; x < row_size; x++) {
+                const float v = static_cast<float>(s[row_src_offs[x]]);
+                vmin = nstl::min(vmin, v);
+                vmax = nstl::max(vmax, v);
+            }
+        }
+        thr_min[ithr] = vmin;
+        thr_max[ithr] = vmax;
+    });
+    float vmin = 0.f, vmax = 0.f;
+    for (int ithr = 0; ithr < max_nthr; ithr++) {
+        vmin = nstl::min(vmin, thr_min[ithr]);
+        vmax = nstl::max(vmax, thr_max[ithr]);
+    }
+
+    const float range = with_zp
+            ? (vmax - vmin) / (range_t::qmax() - range_t::qmin())
+            : nstl::max(vmax, -vmin) / range_t::qsym();
+    io::store_float_value(scales_dt, range > 0.f ? range : 1.f, scales, 0);
+    const float scale = io::load_float_value(scales_dt, scales, 0);
+    const float qscale = 1.f / scale;
+    float qzp = 0.f;
+    if (with_zp) {
+        const float zp = nearbyintf(range_t::qmin() - vmin / scale);
+        qzp = nstl::min(nstl::max(zp, range_t::qmin()), range_t::qmax());
+        io::store_float_value(zp_dt, qzp, zero_points, 0);
+    }
+
+    parallel_nd(nrows, [&](dim_t row) {
+        dim_t s_off, d_off;
+        row_offs(row, s_off, d_off);
+        const src_data_t *s = src + s_off;
+        for (dim_t x = 0; x < row_size; x++) {
+            const float v = static_cast<float>(s[row_src_offs[x]]) * qscale
+                    + qzp;
+            store_q<dst_dt>(output, d_off + row_dst_offs[x], v);
+        }
+    });
+
+    return status::success;
+}
+
+template <typename src_data_t>
+status_t dynamic_quant_reorder_t::execute_dst(const exec_ctx_t &ctx) const {
+    using namespace data_type;
+    switch (pd()->dst_md()->data_type) {
+        case s8: return execute_impl<src_data_t, s8>(ctx);
+        case u8: return execute_impl<src_data_t, u8>(ctx);
+        case s4: return execute_impl<src_data_t, s4>(ctx);
+        case u4: return execute_impl<src_data_t, u4>(ctx);
+        case f4_e2m1: return execute_impl<src_data_t, f4_e2m1>(ctx);
+        case f8_e5m2: return execute_impl<src_data_t, f8_e5m2>(ctx);
+        case f8_e4m3: return execute_impl<src_data_t, f8_e4m3>(ctx);
+        default: assert(!"unsupported data type");
+    }
+    return status::runtime_error;
+}
+
+status_t dynamic_quant_reorder_t::execute(const exec_ctx_t &ctx) const {
+    using namespace data_type;
+    switch (pd()->src_md()->data_type) {
+        case f32: return execute_dst<float>(ctx);
+        case bf16: return execute_dst<bfloat16_t>(ctx);
+        case f16: return execute_dst<float16_t>(ctx);
+        default: assert(!"unsupported data type");
+    }
+    return status::runtime_error;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REORDER_DYNAMIC_QUANT_REORDER_HPP
+#define CPU_REORDER_DYNAMIC_QUANT_REORDER_HPP
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/reorder/cpu_reorder_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Reorder with the dynamic quantization attribute, e.g. of f32 weights to
+// the blocked s8 layout of a brgemm-based matmul or convolution. The
+// dimensions with a destination scale per point are the channels, and the
+// work is split over blocks of channels that are contiguous in the source.
+// For every group of a block, the group is read once to compute its scales
+// and once more, while it is still in cache, to quantize it. The quantized
+// values are written to any blocked layout and summed into the s8s8 and zero
+// point compensations right away, so the weights are read from memory once.
+// With destination zero points, the quantization is asymmetric and a zero
+// point is computed along with every scale. 4-bit destinations, e.g. the
+// packed int4 weights of a brgemm-based matmul with weights decompression,
+// are supported for layouts where both values of a byte belong to one block.
+// A common scale for the whole tensor is computed in a parallel pass over the
+// source before it is quantized in a second one.
+struct dynamic_quant_reorder_t : public primitive_t {
+    using primitive_t::primitive_t;
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:dynamic_quant", dynamic_quant_reorder_t);
+
+        status_t init(
+                engine_t *engine, engine_t *src_engine, engine_t *dst_engine);
+
+        // The channel dimensions and the one the blocks are taken along.
+        int channel_mask_ = 0;
+        int c_inner_ = -1;
+        // The number of channels of a block.
+        dim_t c_block_ = 0;
+        // The size of a scale group in every dimension, equal to the
+        // dimension when it has no scale mask bit, and 1 for channels.
+        dims_t group_dims_ = {};
+        // The strides of the scales and of the compensations in elements.
+        dims_t scale_strides_ = {};
+        dims_t comp_strides_ = {};
+        bool with_zero_points_ = false;
+        // Whether there is one scale for the whole tensor.
+        bool is_common_ = false;
+
+    private:
+        status_t init_conf(engine_t *engine);
+        bool nibbles_ok() const;
+
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md);
+
+        friend dnnl::impl::impl_list_item_t;
+    };
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    template <typename src_data_t>
+    status_t execute_dst(const exec_ctx_t &ctx) const;
+    template <typename src_data_t, data_type_t dst_dt>
+    status_t execute_impl(const exec_ctx_t &ctx) const;
+    template <typename src_data_t, data_type_t dst_dt>
+    status_t execute_common(const exec_ctx_t &ctx) const;
+
+    // Offsets of the points of every dimension in the source and in the
+    // destination, so that the offset of an element is a sum of one entry
+    // per dimension.
+    std::vector<dim_t> src_offs_;
+    std::vector<dim_t> dst_offs_;
+    dims_t offs_start_ = {};
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
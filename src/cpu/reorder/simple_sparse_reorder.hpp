@@ -16,7 +16,9 @@
 #define CPU_REORDER_SIMPLE_SPARSE_REORDER_HPP
 
 #include <bitset>
+#include <cmath>
 #include <iostream>
+#include <limits>
 
 #include <assert.h>
 #include "common/c_types_map.hpp"
@@ -167,15 +169,11 @@ struct simple_sparse_reorder_impl_t<SIMPLE_SPARSE_REORDER_TEMPL_CALL,
 
         // Calculate output_offsets using previously computed number of non-zero
         // elements in each block.
-        parallel_nd(nblks, [&](dim_t b) {
-            dim_t off = 0;
-            if (b != 0) {
-                for (dim_t i = 0; i < b; i++) {
-                    off += nnz_per_blocks[i];
-                }
-            }
+        dim_t off = 0;
+        for (dim_t b = 0; b < nblks; b++) {
             output_offsets[b] = off;
-        });
+            off += nnz_per_blocks[b];
+        }
 
         // Use the calculated output_offsets and number of non-zero elements
         // per block to copy the non-zero elements that we moved to the
@@ -263,6 +261,321 @@ private:
 #undef SIMPLE_SPARSE_REORDER_TEMPL_DECL
 #undef SIMPLE_SPARSE_REORDER_TEMPL_CALL
 
+// Reorder of a dense 2D tensor to the structured N:M sparse encoding. The n
+// elements of the largest magnitude are kept in each group of m rows of a
+// column, so a tensor that is already pruned is reordered without loss. Zero
+// elements are never kept, so a group of a pruned tensor may end up with
+// less than n bits set in its bitmask.
+template <impl::data_type_t type>
+struct simple_structured_sparse_reorder_t : public primitive_t {
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+        DECLARE_COMMON_PD_T(
+                "simple:structured", simple_structured_sparse_reorder_t);
+
+    private:
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md) {
+            const memory_desc_wrapper input_d(src_md);
+            const memory_desc_wrapper output_d(dst_md);
+
+            const bool ok = src_md->data_type == type
+                    && dst_md->data_type == type;
+            if (!ok) return status::invalid_arguments;
+
+            VDISPATCH_REORDER_IC(output_d.is_sparse_desc()
+                            && output_d.encoding()
+                                    == sparse_encoding::structured,
+                    VERBOSE_UNSUPPORTED_FEATURE,
+                    "only sparse_encoding::structured is supported for dst");
+            VDISPATCH_REORDER_IC(output_d.metadata_type(0) == data_type::u8,
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_REORDER_IC(input_d.is_blocking_desc(),
+                    VERBOSE_UNSUPPORTED_FORMAT_KIND);
+            VDISPATCH_REORDER_IC(!input_d.has_runtime_dims_or_strides(),
+                    VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+            VDISPATCH_REORDER_IC(
+                    attr == nullptr || attr->has_default_values(),
+                    VERBOSE_UNSUPPORTED_ATTR);
+
+            auto _pd = make_unique_pd<pd_t>(attr, src_engine->kind(), src_md,
+                    dst_engine->kind(), dst_md);
+            if (_pd == nullptr) return status::out_of_memory;
+            CHECK(_pd->init(engine, src_engine, dst_engine));
+
+            CHECK(_pd->init_scratchpad_md());
+            return safe_ptr_assign(*reorder_pd, _pd.release());
+        }
+
+        friend dnnl::impl::impl_list_item_t;
+    };
+
+    simple_structured_sparse_reorder_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        using data_t = typename prec_traits_t<type>::type;
+
+        auto input = CTX_IN_MEM(const data_t *, DNNL_ARG_FROM);
+        auto output_values = CTX_OUT_MEM(data_t *, DNNL_ARG_TO, 0);
+        auto output_masks = CTX_OUT_MEM(uint8_t *, DNNL_ARG_TO, 1);
+
+        const memory_desc_wrapper input_d(pd()->src_md());
+        const memory_desc_wrapper output_d(pd()->dst_md());
+        const int sp_n = output_d.sparse_desc().structured_n;
+        const int sp_m = output_d.sparse_desc().structured_m;
+        const dim_t ngroups = output_d.structured_ngroups();
+        const dim_t N = output_d.dims()[1];
+
+        parallel_nd(ngroups, N, [&](dim_t g, dim_t j) {
+            float v[8];
+            for (int i = 0; i < sp_m; i++)
+                v[i] = static_cast<float>(input[input_d.off(g * sp_m + i, j)]);
+
+            // Select the n non-zero elements of the largest magnitude, the
+            // first one wins a tie.
+            unsigned mask = 0;
+            for (int s = 0; s < sp_n; s++) {
+                int best = -1;
+                for (int i = 0; i < sp_m; i++) {
+                    if ((mask & (1u << i)) || v[i] == 0.f) continue;
+                    if (best < 0 || std::fabs(v[i]) > std::fabs(v[best]))
+                        best = i;
+                }
+                if (best < 0) break;
+                mask |= 1u << best;
+            }
+
+            // The kept elements are stored in the order of their rows.
+            int slot = 0;
+            for (int i = 0; i < sp_m; i++) {
+                if (!(mask & (1u << i))) continue;
+                output_values[(g * sp_n + slot++) * N + j]
+                        = input[input_d.off(g * sp_m + i, j)];
+            }
+            for (; slot < sp_n; slot++)
+                output_values[(g * sp_n + slot) * N + j]
+                        = static_cast<data_t>(0.f);
+            output_masks[g * N + j] = static_cast<uint8_t>(mask);
+        });
+
+        return status::success;
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+// Reorder between a dense 2D tensor and the CSR or COO encoding with s32
+// metadata, in both directions.
+//
+// A dense tensor is encoded in two passes over the rows: the non-zero
+// elements of every row are counted, and after a prefix sum of the counts
+// each row writes its elements at its own offset, so both passes run in
+// parallel. The encoding keeps the elements sorted by rows and columns. When
+// the tensor has less non-zero elements than the `nnz` of the descriptor, the
+// remaining entries are explicit zeros at the last element of the tensor, and
+// when it has more the reorder fails with status::invalid_arguments.
+//
+// A decoded tensor is filled with zeros and the entries are accumulated to
+// it, so the entries with the same coordinates are summed and the explicit
+// zeros of an encoding leave the last element as it is. The CSR rows are
+// decoded in parallel. The COO entries are not sorted, so they are decoded
+// sequentially.
+template <impl::data_type_t type>
+struct simple_csr_coo_reorder_t : public primitive_t {
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+        DECLARE_COMMON_PD_T("simple:csr_coo", simple_csr_coo_reorder_t);
+
+    private:
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md) {
+            const memory_desc_wrapper input_d(src_md);
+            const memory_desc_wrapper output_d(dst_md);
+
+            const bool ok = src_md->data_type == type
+                    && dst_md->data_type == type;
+            if (!ok) return status::invalid_arguments;
+
+            VDISPATCH_REORDER_IC(
+                    input_d.is_sparse_desc() != output_d.is_sparse_desc(),
+                    VERBOSE_UNSUPPORTED_FORMAT_KIND);
+            const auto &sparse_d = input_d.is_sparse_desc() ? input_d : output_d;
+            const auto &dense_d = input_d.is_sparse_desc() ? output_d : input_d;
+            const bool is_csr = sparse_d.encoding() == sparse_encoding::csr;
+            VDISPATCH_REORDER_IC(
+                    utils::one_of(sparse_d.encoding(), sparse_encoding::csr,
+                            sparse_encoding::coo),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_REORDER_IC(sparse_d.metadata_type(0) == data_type::s32
+                            && IMPLICATION(is_csr,
+                                    sparse_d.metadata_type(1)
+                                            == data_type::s32),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_REORDER_IC(dense_d.is_blocking_desc()
+                            && dense_d.blocking_desc().inner_nblks == 0,
+                    VERBOSE_UNSUPPORTED_FORMAT_KIND);
+            VDISPATCH_REORDER_IC(dense_d.ndims() == 2, VERBOSE_BAD_NDIMS,
+                    "dense", dense_d.ndims());
+            VDISPATCH_REORDER_IC(!dense_d.has_runtime_dims_or_strides(),
+                    VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+            VDISPATCH_REORDER_IC(
+                    sparse_d.nnz() <= std::numeric_limits<int32_t>::max(),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_REORDER_IC(
+                    attr == nullptr || attr->has_default_values(),
+                    VERBOSE_UNSUPPORTED_ATTR);
+
+            auto _pd = make_unique_pd<pd_t>(attr, src_engine->kind(), src_md,
+                    dst_engine->kind(), dst_md);
+            if (_pd == nullptr) return status::out_of_memory;
+            CHECK(_pd->init(engine, src_engine, dst_engine));
+
+            // The offsets of the rows in the encoding.
+            const dim_t M = dense_d.dims()[0];
+            auto scratchpad = _pd->scratchpad_registry().registrar();
+            scratchpad.template book<dim_t>(
+                    memory_tracking::names::key_reorder_space, M + 1);
+
+            CHECK(_pd->init_scratchpad_md());
+            return safe_ptr_assign(*reorder_pd, _pd.release());
+        }
+
+        friend dnnl::impl::impl_list_item_t;
+    };
+
+    simple_csr_coo_reorder_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return memory_desc_wrapper(pd()->src_md()).is_sparse_desc()
+                ? execute_decode(ctx)
+                : execute_encode(ctx);
+    }
+
+private:
+    using data_t = typename prec_traits_t<type>::type;
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    static void accumulate(data_t &dst, data_t v) {
+        dst = static_cast<data_t>(
+                static_cast<float>(dst) + static_cast<float>(v));
+    }
+
+    status_t execute_encode(const exec_ctx_t &ctx) const {
+        auto input = CTX_IN_MEM(const data_t *, DNNL_ARG_FROM);
+        auto values = CTX_OUT_MEM(data_t *, DNNL_ARG_TO, 0);
+        auto buffer_1 = CTX_OUT_MEM(int32_t *, DNNL_ARG_TO, 1);
+        auto buffer_2 = CTX_OUT_MEM(int32_t *, DNNL_ARG_TO, 2);
+
+        const memory_desc_wrapper input_d(pd()->src_md());
+        const memory_desc_wrapper output_d(pd()->dst_md());
+        const bool is_csr = output_d.encoding() == sparse_encoding::csr;
+        const dim_t M = input_d.dims()[0];
+        const dim_t N = input_d.dims()[1];
+        const dim_t nnz = output_d.nnz();
+        const auto &strides = input_d.blocking_desc().strides;
+        input += input_d.offset0();
+
+        auto *row_off = ctx.get_scratchpad_grantor().template get<dim_t>(
+                memory_tracking::names::key_reorder_space);
+
+        parallel_nd(M, [&](dim_t m) {
+            const data_t *row = input + m * strides[0];
+            dim_t cnt = 0;
+            for (dim_t n = 0; n < N; n++)
+                cnt += static_cast<float>(row[n * strides[1]]) != 0.f;
+            row_off[m + 1] = cnt;
+        });
+        row_off[0] = 0;
+        for (dim_t m = 0; m < M; m++)
+            row_off[m + 1] += row_off[m];
+        if (row_off[M] > nnz) return status::invalid_arguments;
+
+        // For CSR, index 1 - index buffer, index 2 - pointer buffer. For COO,
+        // index 1 - row indices, index 2 - column indices.
+        int32_t *col_buf = is_csr ? buffer_1 : buffer_2;
+        parallel_nd(M, [&](dim_t m) {
+            const data_t *row = input + m * strides[0];
+            dim_t i = row_off[m];
+            for (dim_t n = 0; n < N; n++) {
+                const data_t v = row[n * strides[1]];
+                if (static_cast<float>(v) == 0.f) continue;
+                values[i] = v;
+                col_buf[i] = static_cast<int32_t>(n);
+                if (!is_csr) buffer_1[i] = static_cast<int32_t>(m);
+                i++;
+            }
+            if (is_csr) buffer_2[m] = static_cast<int32_t>(row_off[m]);
+        });
+
+        for (dim_t i = row_off[M]; i < nnz; i++) {
+            values[i] = static_cast<data_t>(0.f);
+            col_buf[i] = static_cast<int32_t>(N - 1);
+            if (!is_csr) buffer_1[i] = static_cast<int32_t>(M - 1);
+        }
+        if (is_csr) buffer_2[M] = static_cast<int32_t>(nnz);
+
+        return status::success;
+    }
+
+    status_t execute_decode(const exec_ctx_t &ctx) const {
+        auto values = CTX_IN_MEM(const data_t *, DNNL_ARG_FROM, 0);
+        auto buffer_1 = CTX_IN_MEM(const int32_t *, DNNL_ARG_FROM, 1);
+        auto buffer_2 = CTX_IN_MEM(const int32_t *, DNNL_ARG_FROM, 2);
+        auto output = CTX_OUT_MEM(data_t *, DNNL_ARG_TO);
+
+        const memory_desc_wrapper input_d(pd()->src_md());
+        const memory_desc_wrapper output_d(pd()->dst_md());
+        const bool is_csr = input_d.encoding() == sparse_encoding::csr;
+        const dim_t M = output_d.dims()[0];
+        const dim_t N = output_d.dims()[1];
+        const dim_t nnz = input_d.nnz();
+        const auto &strides = output_d.blocking_desc().strides;
+        output += output_d.offset0();
+
+        // The pattern is validated so that a wrong one does not lead to
+        // writes out of bounds.
+        const int32_t *row_buf = is_csr ? buffer_2 : buffer_1;
+        const int32_t *col_buf = is_csr ? buffer_1 : buffer_2;
+        for (dim_t i = 0; i < nnz; i++) {
+            if (col_buf[i] < 0 || col_buf[i] >= N)
+                return status::invalid_arguments;
+            if (!is_csr && (row_buf[i] < 0 || row_buf[i] >= M))
+                return status::invalid_arguments;
+        }
+        if (is_csr) {
+            if (row_buf[0] != 0 || row_buf[M] != nnz)
+                return status::invalid_arguments;
+            for (dim_t m = 0; m < M; m++)
+                if (row_buf[m] > row_buf[m + 1])
+                    return status::invalid_arguments;
+        }
+
+        parallel_nd(M, [&](dim_t m) {
+            data_t *row = output + m * strides[0];
+            for (dim_t n = 0; n < N; n++)
+                row[n * strides[1]] = static_cast<data_t>(0.f);
+            if (!is_csr) return;
+            for (dim_t i = row_buf[m]; i < row_buf[m + 1]; i++)
+                accumulate(row[col_buf[i] * strides[1]], values[i]);
+        });
+        if (!is_csr) {
+            for (dim_t i = 0; i < nnz; i++) {
+                const dim_t off
+                        = row_buf[i] * strides[0] + col_buf[i] * strides[1];
+                accumulate(output[off], values[i]);
+            }
+        }
+
+        return status::success;
+    }
+};
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
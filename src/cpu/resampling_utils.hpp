@@ -18,8 +18,10 @@
 #define CPU_RESAMPLING_UTILS_HPP
 
 #include <cmath>
+#include <vector>
 
 #include "common/c_types_map.hpp"
+#include "common/utils.hpp"
 
 #include "cpu/simple_q10n.hpp"
 
@@ -100,6 +102,106 @@ private:
     }
 };
 
+// Returns true for the algorithms whose destination points take a variable
+// number of source points, described by a filter_table_t per spatial axis.
+static inline bool is_filter_alg(alg_kind_t alg) {
+    return utils::one_of(alg, alg_kind::resampling_cubic,
+            alg_kind::resampling_linear_antialias);
+}
+
+// Cubic convolution kernel with a = -0.75, as in PyTorch bicubic interpolation.
+static inline float cubic_weight(float t) {
+    constexpr float a = -0.75f;
+    t = nstl::abs(t);
+    if (t <= 1.f) return ((a + 2.f) * t - (a + 3.f)) * t * t + 1.f;
+    if (t < 2.f) return ((a * t - 5.f * a) * t + 8.f * a) * t - 4.f * a;
+    return 0.f;
+}
+
+// Source points and weights of every destination point along one spatial
+// axis for the filter algorithms:
+// - resampling_cubic takes the 4 points around the source coordinate of the
+//   destination point. Points out of the source are clamped to the edge, so
+//   their weights are added to the weights of the edge points.
+// - resampling_linear_antialias takes the points under a triangle filter
+//   that is stretched by the downsampling factor, so every source point
+//   contributes to the result. The weights are normalized to sum to one. For
+//   upsampling the filter is the one of the linear algorithm.
+// Destination point `y` takes `size(y)` consecutive source points starting at
+// `start(y)` with the weights `weights(y)`.
+struct filter_table_t {
+    filter_table_t() = default;
+    filter_table_t(alg_kind_t alg, dim_t y_max, dim_t x_max)
+        : start_(y_max), size_(y_max) {
+        const bool is_cubic = alg == alg_kind::resampling_cubic;
+        const float scale
+                = static_cast<float>(x_max) / static_cast<float>(y_max);
+        const float support = nstl::max(scale, 1.f);
+        const float invscale = 1.f / support;
+
+        for (dim_t y = 0; y < y_max; y++) {
+            dim_t lo = 0, hi = 0;
+            if (is_cubic) {
+                const float x = linear_map(y, y_max, x_max);
+                const dim_t x0 = static_cast<dim_t>(std::floor(x));
+                lo = utils::saturate<dim_t>(0, x_max - 1, x0 - 1);
+                hi = utils::saturate<dim_t>(0, x_max - 1, x0 + 2) + 1;
+            } else {
+                const float center = (static_cast<float>(y) + 0.5f) * scale;
+                lo = nstl::max(
+                        static_cast<dim_t>(center - support + 0.5f), dim_t(0));
+                hi = nstl::min(
+                        static_cast<dim_t>(center + support + 0.5f), x_max);
+            }
+            start_[y] = lo;
+            size_[y] = hi - lo;
+            max_size_ = nstl::max(max_size_, size_[y]);
+        }
+
+        weights_.assign(y_max * max_size_, 0.f);
+        for (dim_t y = 0; y < y_max; y++) {
+            float *w = &weights_[y * max_size_];
+            if (is_cubic) {
+                const float x = linear_map(y, y_max, x_max);
+                const float x0 = std::floor(x);
+                const float t = x - x0;
+                const float tap_w[4] = {cubic_weight(t + 1.f), cubic_weight(t),
+                        cubic_weight(1.f - t), cubic_weight(2.f - t)};
+                for (dim_t k = 0; k < 4; k++) {
+                    const dim_t idx = utils::saturate<dim_t>(0, x_max - 1,
+                            static_cast<dim_t>(x0) - 1 + k);
+                    w[idx - start_[y]] += tap_w[k];
+                }
+            } else {
+                const float center = (static_cast<float>(y) + 0.5f) * scale;
+                float total = 0.f;
+                for (dim_t j = 0; j < size_[y]; j++) {
+                    const float d = (static_cast<float>(j + start_[y])
+                                            - center + 0.5f)
+                            * invscale;
+                    w[j] = nstl::max(0.f, 1.f - nstl::abs(d));
+                    total += w[j];
+                }
+                if (total > 0.f)
+                    for (dim_t j = 0; j < size_[y]; j++)
+                        w[j] /= total;
+            }
+        }
+    }
+
+    dim_t start(dim_t y) const { return start_[y]; }
+    dim_t size(dim_t y) const { return size_[y]; }
+    const float *weights(dim_t y) const { return &weights_[y * max_size_]; }
+    // The largest number of source points of a destination point.
+    dim_t max_size() const { return max_size_; }
+
+private:
+    std::vector<dim_t> start_;
+    std::vector<dim_t> size_;
+    std::vector<float> weights_;
+    dim_t max_size_ = 0;
+};
+
 } // namespace resampling_utils
 
 } // namespace cpu
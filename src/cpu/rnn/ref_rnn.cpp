@@ -29,12 +29,16 @@
 
  */
 
+#include <atomic>
+#include <cstring>
+
 #include "common/dnnl_thread.hpp"
 #include "common/matmul_pd.hpp"
 #include "common/primitive.hpp"
 #include "common/primitive_desc_iterator.hpp"
 #include "common/stream.hpp"
 
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/simple_q10n.hpp"
 
 #include "cpu/gemm/gemm.hpp"
@@ -318,6 +322,11 @@ ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init_brgemm(
             this->attr()->fpmath_.mode_, fpmath_mode::bf16, fpmath_mode::any);
     bool allow_down_conversion_to_bf16
             = is_f32 && is_fpmath_bf16 && is_impl_bf16;
+    // int8 and int4 weights with bf16 activations are decompressed to bf16.
+    const bool allow_wei_decompression = aprop == prop_kind::forward
+            && is_impl_bf16 && src_layer_dt == data_type::bf16
+            && one_of(weights_layer_dt, data_type::s8, data_type::s4)
+            && weights_iter_dt == weights_layer_dt;
 
     // Initialized rnn_ early to get correct verbose output
     rnn_ = zero<decltype(rnn_)>();
@@ -344,8 +353,9 @@ ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init_brgemm(
                           this->diff_weights_overwrite() == false),
             VERBOSE_BAD_PROPKIND);
     // cell_type (or src_type) and primitive data type should
-    // match, except for the bf32 case.
-    VDISPATCH_RNN(IMPLICATION(!allow_down_conversion_to_bf16,
+    // match, except for the bf32 and the weights decompression cases.
+    VDISPATCH_RNN(IMPLICATION(!(allow_down_conversion_to_bf16
+                                      || allow_wei_decompression),
                           src_layer_dt == src_type
                                   && everyone_is(weights_type, weights_iter_dt,
                                           weights_layer_dt)),
@@ -433,7 +443,11 @@ ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init_brgemm(
     /* check that only supported attr have been passed */
     primitive_attr_t::skip_mask_t attr_mask
             = primitive_attr_t::skip_mask_t::rnn_tparams;
-    if (weights_layer_dt == data_type::s8)
+    if (rnn_.with_wei_decompression)
+        attr_mask = attr_mask
+                | primitive_attr_t::skip_mask_t::rnn_weights_qparams
+                | primitive_attr_t::skip_mask_t::rnn_weights_projection_qparams;
+    else if (weights_layer_dt == data_type::s8)
         attr_mask = attr_mask | primitive_attr_t::skip_mask_t::rnn_data_qparams
                 | primitive_attr_t::skip_mask_t::rnn_weights_qparams
                 | primitive_attr_t::skip_mask_t::rnn_weights_projection_qparams
@@ -532,12 +546,71 @@ ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init_brgemm(
                 weights_iter_d.md_, &weights_iter_md, nullptr));
     }
 
+    if (rnn_.with_wei_decompression) CHECK(init_wei_decompression(engine));
+
     return status::success;
 #else
     return status::unimplemented;
 #endif
 }
 
+#if DNNL_X64
+template <prop_kind_t aprop, impl::data_type_t src_type,
+        impl::data_type_t weights_type, impl::data_type_t acc_type>
+status_t ref_rnn_common_t<aprop, src_type, weights_type,
+        acc_type>::pd_t::init_wei_decompression(engine_t *engine) {
+    using namespace rnn_utils;
+    const auto &wei_qparams = this->attr()->rnn_weights_qparams_;
+    const auto &proj_qparams = this->attr()->rnn_weights_projection_qparams_;
+    // The scales are common or per output channel of every gate.
+    VDISPATCH_RNN(utils::one_of(wei_qparams.mask_, 0, (1 << 3) + (1 << 4)),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_RNN(IMPLICATION(rnn_.is_lstm_projection,
+                          utils::one_of(proj_qparams.mask_, 0, 1 << 3)),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_RNN(wei_qparams.defined()
+                    && IMPLICATION(rnn_.is_lstm_projection,
+                            proj_qparams.defined()),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    // The cells take the weights in the layout of the bf16 implementation.
+    rnn_conf_t rnn_bf16 = rnn_;
+    rnn_bf16.with_wei_decompression = false;
+
+    // A quantized weight is the real one times its scale, so the reorders
+    // use the inverse scales.
+    const auto init_reorder = [&](std::shared_ptr<primitive_desc_t> &rpd,
+                                      std::vector<float> &scales,
+                                      const memory_desc_t *md,
+                                      weights_type_t type,
+                                      const rnn_create_time_scales_t &qparams) {
+        memory_desc_t bf16_md;
+        CHECK(memory_desc_init_by_tag(bf16_md, md->ndims, md->dims,
+                data_type::bf16, format_tag::any));
+        CHECK(set_expected_desc(rnn_bf16, bf16_md, type));
+
+        scales.resize(qparams.count_);
+        for (dim_t i = 0; i < qparams.count_; i++)
+            scales[i] = 1.f / qparams.scales_[i];
+
+        primitive_attr_t attr;
+        CHECK(attr.scales_.set(DNNL_ARG_SRC, qparams.mask_));
+        return reorder_primitive_desc_create(rpd, engine, md, &bf16_md, &attr);
+    };
+
+    CHECK(init_reorder(wei_layer_decomp_reorder_pd_, wei_decomp_scales_,
+            this->weights_md(0), weights_type_t::layer, wei_qparams));
+    CHECK(init_reorder(wei_iter_decomp_reorder_pd_, wei_decomp_scales_,
+            this->weights_md(1), weights_type_t::iter, wei_qparams));
+    if (rnn_.is_lstm_projection)
+        CHECK(init_reorder(wei_projection_decomp_reorder_pd_,
+                wei_projection_decomp_scales_,
+                this->arg_md(DNNL_ARG_WEIGHTS_PROJECTION),
+                weights_type_t::projection, proj_qparams));
+    return status::success;
+}
+#endif
+
 template <prop_kind_t aprop, impl::data_type_t src_type,
         impl::data_type_t weights_type, impl::data_type_t acc_type>
 status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init(
@@ -595,10 +668,26 @@ void ref_rnn_common_t<aprop, src_type, weights_type,
     scratchpad.template book<void *>(
             key_rnn_ptrs_bia, ptr_wei_sz * bias_dt_size);
 
+    if (rnn_.needs_src_iter_copy_in_place(this->cell_kind()))
+        scratchpad.book(key_rnn_src_iter_in_place,
+                memory_desc_wrapper(this->src_md(1)).size(), 1,
+                alignof(float), 4096);
+
 #if DNNL_X64
     if (rnn_.is_brgemm)
         ref_rnn_brgemm_t::init_scratchpad(
                 rnn_, scratchpad, sizeof(gemm_acc_t), alignof(gemm_acc_t));
+
+    const auto book_decomp = [&](const std::shared_ptr<primitive_desc_t> &rpd,
+                                     memory_tracking::key_t key) {
+        if (rpd)
+            scratchpad.book(key, memory_desc_wrapper(rpd->dst_md()).size(), 1,
+                    alignof(weights_t), 4096);
+    };
+    book_decomp(wei_layer_decomp_reorder_pd_, key_rnn_wei_layer_decomp);
+    book_decomp(wei_iter_decomp_reorder_pd_, key_rnn_wei_iter_decomp);
+    book_decomp(
+            wei_projection_decomp_reorder_pd_, key_rnn_wei_projection_decomp);
 #endif
 
     // Below primitives may be run as part of execution.Fortunately, none of
@@ -618,7 +707,10 @@ void ref_rnn_common_t<aprop, src_type, weights_type,
                   matmul_part2_4_pd_,
 #if DNNL_X64
                   bf32_wei_layer_reorder_pd_,
-                  bf32_wei_iter_reorder_pd_
+                  bf32_wei_iter_reorder_pd_,
+                  wei_layer_decomp_reorder_pd_,
+                  wei_iter_decomp_reorder_pd_,
+                  wei_projection_decomp_reorder_pd_
 #endif
               };
 
@@ -730,6 +822,17 @@ status_t dnnl::impl::cpu::ref_rnn_common_t<aprop, src_type, weights_type,
             CHECK(pd()->bf32_wei_iter_reorder_pd_->create_primitive(
                     bf32_wei_iter_reorder_, engine));
         }
+        if (rnn.with_wei_decompression) {
+            CHECK(pd()->wei_layer_decomp_reorder_pd_->create_primitive(
+                    wei_layer_decomp_reorder_, engine));
+            CHECK(pd()->wei_iter_decomp_reorder_pd_->create_primitive(
+                    wei_iter_decomp_reorder_, engine));
+            if (rnn.is_lstm_projection) {
+                const auto &rpd = pd()->wei_projection_decomp_reorder_pd_;
+                CHECK(rpd->create_primitive(
+                        wei_projection_decomp_reorder_, engine));
+            }
+        }
         return rnn_brgemm_.init_kernels(rnn, src_type, weights_type);
     }
 #endif
@@ -1046,6 +1149,216 @@ rnn_grid_execution_sig((ref_rnn_common_t<aprop, src_type, weights_type,
                   return dnnl_success;
               };
 
+    const int32_t *seq_lengths = rnn.with_seq_lengths
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS)
+            : nullptr;
+    // Returns the number of rows up to the last sequence still running at an
+    // iteration.
+    const auto active_mb = [&](int iter) {
+        int mb = 0;
+        for (int b = 0; b < rnn.mb; b++)
+            if (rnn.seq_length(seq_lengths, b) > iter) mb = b + 1;
+        return mb;
+    };
+
+    const auto compute_cell = [&](int dir, int j, int i) {
+        const int lay = (aprop == prop_kind::forward) ? j : rnn.n_layer - j - 1;
+        const int iter = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
+
+        // We set parameters to the cell execution call
+
+        // dst_layer is equal to dst_iter. To avoid
+        // duplication of memory access we hence use only
+        // dst_layer and set dst_iter to nullptr, unless we
+        // cannot for one of the following condition:
+        // - in the last layer and last iteration, we need to
+        //   copy ht in two tensors (dst_layer and dst_iter)
+        dst_layer_t *cell_dst_layer
+                = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
+        dst_iter_t *cell_dst_iter = nullptr;
+        const src_layer_t *cell_src_layer
+                = &(ws_states_layer(lay, dir, iter + 1, 0));
+        const src_iter_t *cell_src_iter
+                = &(ws_states_iter(lay + 1, dir, iter, 0));
+
+        void *cell_dst_iter_c = const_cast<void *>(
+                ws_states_iter_c(lay + 1, dir, iter + 1, 0));
+        const void *cell_src_iter_c
+                = ws_states_iter_c(lay + 1, dir, iter, 0);
+
+        // the cell_position is used only when skip_data_copy is
+        // supported currently supported only for forward
+        cell_position_t cell_position = middle_cell;
+        if (iter == 0) cell_position |= first_iter;
+        if (lay == 0) cell_position |= first_layer;
+        if (iter == rnn.n_iter - 1) cell_position |= last_iter;
+        if (lay == rnn.n_layer - 1) cell_position |= last_layer;
+
+        // The dst_* paths should be before the src_* paths as
+        // the later will override cell_src_layer and
+        // cell_src_iter appropriately for 1st layer and 1st
+        // iter.
+        const bool last_iter_skip_copy
+                = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
+        if (last_iter_skip_copy) {
+            cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
+            cell_src_layer
+                    = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
+        }
+
+        if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
+            // Note: for last layer and last iter, the output is in dst_layer
+            // and still need to be copied to dst_iter
+            cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
+            cell_dst_iter = last_iter_skip_copy
+                    ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
+                    : nullptr;
+            cell_src_iter = (iter != 0)
+                    ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
+                    : cell_src_iter;
+        }
+        if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
+            cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
+
+        if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
+            cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
+
+        // because the c state is always f32 and require no
+        // conversion, we can always skip to copy for the 1st
+        // and last iteration
+        if (iter == 0 && src_iter_c_) {
+            cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
+                    src_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_first_iter;
+        }
+        if (iter == rnn.n_iter - 1 && dst_iter_c_) {
+            cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                    dst_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_last_iter;
+        }
+
+        // The rows of the sequences that ended are computed on stale states
+        // or left out, and are never copied to the outputs.
+        rnn_conf_t seq_rnn;
+        if (rnn.can_shrink_batch()) {
+            seq_rnn = rnn;
+            seq_rnn.mb = active_mb(iter);
+            if (seq_rnn.mb == 0) return dnnl_success;
+            if (rnn.is_brgemm)
+                seq_rnn.M_blocks = utils::div_up(seq_rnn.mb, rnn.m_block);
+        }
+        const rnn_conf_t &cell_rnn = rnn.can_shrink_batch() ? seq_rnn : rnn;
+
+        // In a wavefront, the cells of all the layers run concurrently and
+        // every layer has its own scratch buffers.
+        const size_t slot = rnn.wavefront ? lay : 0;
+        const size_t sg_start_idx
+                = (rnn.n_iter_scratch_gates == 1 ? slot : iter)
+                * rnn.scratch_gates_nld * rnn.scratch_gates_ld;
+        const auto cell_scratch_gates = &scratch_gates_[sg_start_idx];
+        const auto cell_scratch_cell = scratch_cell_
+                ? scratch_cell_
+                        + slot * rnn.scratch_gates_nld * rnn.scratch_gates_ld
+                : nullptr;
+
+        dst_iter_t *proj_ht = nullptr;
+        if (rnn.is_lstm_projection) {
+            if (rnn.is_training)
+                proj_ht = &(ws_ht(lay, dir, iter, 0));
+            else
+                proj_ht = scratch_ht_
+                        + slot * rnn.scratch_ht_nld * rnn.scratch_ht_ld;
+        }
+
+#if DNNL_X64
+        CHECK((this->*cell_func)(ctx, cell_rnn, cell_position, cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), cell_scratch_cell,
+                scratch_gates_blocked_, scratch_src_layer_,
+                scratch_src_iter_, cell_dst_iter, amx_scratchpad,
+                addr_batch_global));
+#else
+        CHECK((this->*cell_func)(ctx, cell_rnn, cell_position, cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), cell_scratch_cell,
+                cell_dst_iter, amx_scratchpad));
+#endif
+        return dnnl_success;
+    };
+
+    if (rnn.wavefront) {
+        // Cell (lay, iter) depends only on cells (lay - 1, iter) and
+        // (lay, iter - 1), so the cells of a diagonal lay + iter = w are
+        // independent and are computed concurrently, one cell per thread.
+        assert(aprop == prop_kind::forward && !rnn.merge_gemm_layer);
+        for_(int dir = 0; dir < rnn.n_dir; dir++)
+        for (int w = 0; w < rnn.n_layer + rnn.n_iter - 1; w++) {
+            const int lay_start = nstl::max(0, w - rnn.n_iter + 1);
+            const int lay_end = nstl::min(rnn.n_layer, w + 1);
+            const int ncells = lay_end - lay_start;
+
+            std::atomic<dnnl_status_t> st(dnnl_success);
+            parallel(ncells, [&](const int ithr, const int nthr) {
+                int start {0}, end {0};
+                balance211(ncells, nthr, ithr, start, end);
+                for (int lay = lay_start + start; lay < lay_start + end;
+                        lay++) {
+                    const dnnl_status_t st_cell
+                            = compute_cell(dir, lay, w - lay);
+                    if (st_cell != dnnl_success) st = st_cell;
+                }
+            });
+            CHECK(st);
+        }
+        return dnnl_success;
+    }
+
     // We run the grid of computation
     for_(int dir = 0; dir < rnn.n_dir; dir++)
     for (int j = 0; j < rnn.n_layer; j++) {
@@ -1056,155 +1369,8 @@ rnn_grid_execution_sig((ref_rnn_common_t<aprop, src_type, weights_type,
 
         // TODO: enable merging projection gemm in bwd lstm projection
 
-        for (int i = 0; i < rnn.n_iter; i++) {
-            const int iter
-                    = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
-
-            // We set parameters to the cell execution call
-
-            // dst_layer is equal to dst_iter. To avoid
-            // duplication of memory access we hence use only
-            // dst_layer and set dst_iter to nullptr, unless we
-            // cannot for one of the following condition:
-            // - in the last layer and last iteration, we need to
-            //   copy ht in two tensors (dst_layer and dst_iter)
-            dst_layer_t *cell_dst_layer
-                    = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
-            dst_iter_t *cell_dst_iter = nullptr;
-            const src_layer_t *cell_src_layer
-                    = &(ws_states_layer(lay, dir, iter + 1, 0));
-            const src_iter_t *cell_src_iter
-                    = &(ws_states_iter(lay + 1, dir, iter, 0));
-
-            void *cell_dst_iter_c = const_cast<void *>(
-                    ws_states_iter_c(lay + 1, dir, iter + 1, 0));
-            const void *cell_src_iter_c
-                    = ws_states_iter_c(lay + 1, dir, iter, 0);
-
-            // the cell_position is used only when skip_data_copy is
-            // supported currently supported only for forward
-            cell_position_t cell_position = middle_cell;
-            if (iter == 0) cell_position |= first_iter;
-            if (lay == 0) cell_position |= first_layer;
-            if (iter == rnn.n_iter - 1) cell_position |= last_iter;
-            if (lay == rnn.n_layer - 1) cell_position |= last_layer;
-
-            // The dst_* paths should be before the src_* paths as
-            // the later will override cell_src_layer and
-            // cell_src_iter appropriately for 1st layer and 1st
-            // iter.
-            const bool last_iter_skip_copy
-                    = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
-            if (last_iter_skip_copy) {
-                cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
-                cell_src_layer
-                        = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
-            }
-
-            if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
-                // Note: for last layer and last iter, the output is in dst_layer
-                // and still need to be copied to dst_iter
-                cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
-                cell_dst_iter = last_iter_skip_copy
-                        ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
-                        : nullptr;
-                cell_src_iter = (iter != 0)
-                        ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
-                        : cell_src_iter;
-            }
-            if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
-                cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
-
-            if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
-                cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
-
-            // because the c state is always f32 and require no
-            // conversion, we can always skip to copy for the 1st
-            // and last iteration
-            if (iter == 0 && src_iter_c_) {
-                cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
-                        src_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_first_iter;
-            }
-            if (iter == rnn.n_iter - 1 && dst_iter_c_) {
-                cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
-                        dst_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_last_iter;
-            }
-            const size_t sg_start_idx = rnn.n_iter_scratch_gates == 1
-                    ? static_cast<size_t>(0)
-                    : static_cast<size_t>(iter) * rnn.scratch_gates_nld
-                            * rnn.scratch_gates_ld;
-            const auto cell_scratch_gates = &scratch_gates_[sg_start_idx];
-
-            dst_iter_t *proj_ht = nullptr;
-            if (rnn.is_lstm_projection) {
-                if (rnn.is_training)
-                    proj_ht = &(ws_ht(lay, dir, iter, 0));
-                else
-                    proj_ht = scratch_ht_;
-            }
-
-#if DNNL_X64
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    scratch_gates_blocked_, scratch_src_layer_,
-                    scratch_src_iter_, cell_dst_iter, amx_scratchpad,
-                    addr_batch_global));
-#else
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    cell_dst_iter, amx_scratchpad));
-#endif
-        }
+        for (int i = 0; i < rnn.n_iter; i++)
+            CHECK(compute_cell(dir, j, i));
 
         CHECK(compute_merged_layer_part_if_applicable(
                 prop_kind::backward, dir, lay));
@@ -1546,7 +1712,7 @@ template <typename src_data_t, typename dst_layer_dt, typename dst_iter_dt>
 void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         dst_layer_dt *dst_layer_, memory_desc_wrapper &dst_layer_d,
         const dst_iter_dt *dst_iter_, const memory_desc_wrapper &dst_iter_d,
-        const src_data_t *ws_states_layer_) {
+        const src_data_t *ws_states_layer_, const int32_t *seq_lengths) {
 
     const AOC<const src_data_t, 5> ws_states_layer(ws_states_layer_,
             rnn.n_layer + 1, rnn.n_dir, rnn.n_iter + 1, rnn.mb,
@@ -1599,6 +1765,30 @@ void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         }
     };
 
+    // With sequence lengths, the outputs past the end of a sequence are zero.
+    // They are only defined for left-to-right execution.
+    const dst_layer_dt zero = q10n::qz_a1b0_t<float, dst_layer_dt>()(
+            rnn.is_int8_conf() && !dequantize ? shift : 0.f);
+    const auto is_past_end = [&](dim_t it, dim_t b) {
+        return seq_lengths && it >= rnn.seq_length(seq_lengths, b);
+    };
+    const auto zero_vec = [&](dst_layer_dt *dd) {
+        PRAGMA_OMP_SIMD()
+        for (int s = 0; s < rnn.dlc; s++)
+            dd[s] = zero;
+    };
+
+    // if skip_dst_layer_copy, the cells of the last layer have already
+    // written the outputs to dst_layer
+    if (rnn.skip_dst_layer_copy()) {
+        assert(seq_lengths);
+        parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t it, dim_t b) {
+            if (is_past_end(it, b))
+                zero_vec(&dst_layer_[dst_layer_d.blk_off(it, b, 0)]);
+        });
+        return;
+    }
+
     // if skip_dst_iter_copy, then the data for the last iteration is
     // in dst_iter, not in workspace
     parallel_nd(rnn.n_iter - (rnn.skip_dst_iter_copy() ? 1 : 0), rnn.mb,
@@ -1609,7 +1799,10 @@ void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
                             = &ws_states_layer(rnn.n_layer, dir, it + 1, b, 0);
                     auto *dd = &dst_layer_[dst_layer_d.blk_off(
                             it, b, dir * rnn.dlc)];
-                    copy_vec(dd, ss);
+                    if (is_past_end(it, b))
+                        zero_vec(dd);
+                    else
+                        copy_vec(dd, ss);
                     dir = 1;
                 }
                 if (rnn.exec_dir != l2r) {
@@ -1682,11 +1875,12 @@ void copy_res_layer_bwd_template(const rnn_conf_t &rnn,
     void cname::copy_res_layer(const rnn_conf_t &rnn, \
             dst_layer_dt *dst_layer_, gemm_acc_t *diff_src_layer, \
             const dst_iter_dt *dst_iter_, const src_layer_t *ws_states_layer_, \
-            const gemm_acc_t *ws_diff_states_layer_) const { \
+            const gemm_acc_t *ws_diff_states_layer_, \
+            const int32_t *seq_lengths) const { \
         auto dst_layer_d = memory_desc_wrapper(pd()->dst_md(0)); \
         auto dst_iter_d = memory_desc_wrapper(pd()->dst_md(1)); \
         copy_res_layer_fwd_template(rnn, pd(), dst_layer_, dst_layer_d, \
-                dst_iter_, dst_iter_d, ws_states_layer_); \
+                dst_iter_, dst_iter_d, ws_states_layer_, seq_lengths); \
     }
 
 RNN_DECL_COPY_RES_LAYER_FWD(ref_rnn_common_fwd_f32_t)
@@ -1701,7 +1895,8 @@ RNN_DECL_COPY_RES_LAYER_FWD(ref_rnn_common_fwd_s8s8_t)
     void cname::copy_res_layer(const rnn_conf_t &rnn, \
             dst_layer_dt *dst_layer_, gemm_acc_t *diff_src_layer_, \
             const dst_iter_dt *dst_iter_, const src_layer_t *ws_states_layer_, \
-            const gemm_acc_t *ws_diff_states_layer_) const { \
+            const gemm_acc_t *ws_diff_states_layer_, \
+            const int32_t *seq_lengths) const { \
         auto diff_src_layer_d = memory_desc_wrapper(pd()->diff_src_md(0)); \
         copy_res_layer_bwd_template(rnn, diff_src_layer_, diff_src_layer_d, \
                 ws_diff_states_layer_); \
@@ -1716,12 +1911,38 @@ void copy_res_iter_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         dst_iter_dt *dst_iter_, memory_desc_wrapper &dst_iter_d,
         void *dst_iter_c_, memory_desc_wrapper dst_iter_c_d,
         const dst_layer_dt *dst_layer_, memory_desc_wrapper dst_layer_d,
-        const src_data_t *ws_states_iter_, const void *ws_states_iter_c_) {
+        const src_data_t *ws_states_iter_, const void *ws_states_iter_c_,
+        const int32_t *seq_lengths) {
+    // The cells write the cell states of the last iteration to dst_iter_c.
+    // With sequence lengths, the rows of the sequences that end earlier are
+    // taken from the workspace instead.
+    if (seq_lengths && dst_iter_c_ != nullptr) {
+        const auto ws_states_iter_c = rnn_utils::make_raw_aoc(
+                ws_states_iter_c_, types::data_type_size(rnn.src_iter_c_dt),
+                rnn.n_layer + 1, rnn.n_dir, rnn.n_iter + 1, rnn.mb,
+                rnn.ws_states_iter_c_ld);
+        parallel_nd(rnn.n_layer, rnn.mb, [&](dim_t lay, dim_t b) {
+            const int len = rnn.seq_length(seq_lengths, b);
+            if (len == rnn.n_iter) return;
+            for (int s = 0; s < rnn.dhc; s++) {
+                const float c = rnn_utils::to_float(
+                        ws_states_iter_c(lay + 1, 0, len, b, s),
+                        rnn.src_iter_c_dt);
+                io::store_float_value(rnn.dst_iter_c_dt, c, dst_iter_c_,
+                        dst_iter_c_d.blk_off(lay, 0, b, s));
+            }
+        });
+    }
+
     if (dst_iter_ == nullptr) return;
 
     const AOC<const src_data_t, 5> ws_states_iter(ws_states_iter_,
             rnn.n_layer + 1, rnn.n_dir, rnn.n_iter + 1, rnn.mb,
             rnn.ws_states_iter_ld);
+    // The last state of a sequence is the one after its last iteration.
+    const auto last_iter = [&](dim_t b) {
+        return seq_lengths ? rnn.seq_length(seq_lengths, b) : rnn.n_iter;
+    };
 
     const float data_shift = pd->attr()->rnn_data_qparams_.shift_;
     const float data_scale = pd->attr()->rnn_data_qparams_.scale_;
@@ -1747,15 +1968,15 @@ void copy_res_iter_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
     parallel_nd(n_layer_in_ws, rnn.n_dir, rnn.mb,
             [&](dim_t lay, dim_t dir, dim_t b) {
                 const auto *ss
-                        = &ws_states_iter(lay + 1, dir, rnn.n_iter, b, 0);
+                        = &ws_states_iter(lay + 1, dir, last_iter(b), b, 0);
                 auto *dd = dst_iter_ + dst_iter_d.blk_off(lay, dir, b, 0);
                 copy_vec(dd, ss);
             });
 
     if (rnn.skip_dst_layer_copy()) {
         parallel_nd(rnn.n_dir, rnn.mb, [&](dim_t dir, dim_t b) {
-            const auto *ss
-                    = &dst_layer_[dst_layer_d.blk_off(rnn.n_iter - 1, b, dir)];
+            const auto *ss = &dst_layer_[dst_layer_d.blk_off(
+                    last_iter(b) - 1, b, dir)];
             auto *dd = &dst_iter_[dst_iter_d.blk_off(
                     rnn.n_layer - 1, dir, b, 0)];
             copy_vec(dd, (src_data_t *)ss);
@@ -1801,13 +2022,14 @@ void copy_res_iter_bwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
             const src_layer_t *ws_states_layer_, \
             const void *ws_states_iter_c_, \
             const gemm_acc_t *ws_diff_states_iter_, \
-            const gemm_acc_t *ws_diff_states_iter_c_) const { \
+            const gemm_acc_t *ws_diff_states_iter_c_, \
+            const int32_t *seq_lengths) const { \
         auto dst_layer_d = memory_desc_wrapper(pd()->dst_md(0)); \
         auto dst_iter_d = memory_desc_wrapper(pd()->dst_md(1)); \
         auto dst_iter_c_d = memory_desc_wrapper(pd()->dst_md(2)); \
         copy_res_iter_fwd_template(rnn, pd(), dst_iter_, dst_iter_d, \
                 dst_iter_c_, dst_iter_c_d, dst_layer_, dst_layer_d, \
-                ws_states_layer_, ws_states_iter_c_); \
+                ws_states_layer_, ws_states_iter_c_, seq_lengths); \
     }
 
 RNN_DECL_COPY_RES_ITER_FWD(ref_rnn_common_fwd_f32_t)
@@ -1825,7 +2047,8 @@ RNN_DECL_COPY_RES_ITER_FWD(ref_rnn_common_fwd_s8s8_t)
             const src_layer_t *ws_states_layer_, \
             const void *ws_states_iter_c_, \
             const gemm_acc_t *ws_diff_states_iter_, \
-            const gemm_acc_t *ws_diff_states_iter_c_) const { \
+            const gemm_acc_t *ws_diff_states_iter_c_, \
+            const int32_t *seq_lengths) const { \
         auto diff_src_iter_d = memory_desc_wrapper(pd()->diff_src_md(1)); \
         auto diff_src_iter_c_d = memory_desc_wrapper(pd()->diff_src_md(2)); \
         copy_res_iter_bwd_template(rnn, pd(), diff_src_iter_, diff_src_iter_d, \
@@ -2121,6 +2344,8 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
 
     const memory_desc_t *weights_layer_md = pd()->weights_md(0);
     const memory_desc_t *weights_iter_md = pd()->weights_md(1);
+    const memory_desc_t *weights_projection_md
+            = pd()->arg_md(DNNL_ARG_WEIGHTS_PROJECTION);
 
     const auto tag = rnn.n_block == 64 ? format_tag::ldgOI64o2i
                                        : format_tag::ldgOI32o2i;
@@ -2183,6 +2408,56 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
             weights_iter_md = &wei_iter_desc;
         }
     }
+
+    if (rnn.with_wei_decompression) {
+        // The weights are decompressed once for all the cells of the
+        // execution, into the layout the bf16 cells take.
+        engine_t *engine = ctx.stream()->engine();
+        const auto decompress = [&](const std::shared_ptr<primitive_t> &prim,
+                                        int arg, memory_tracking::key_t key,
+                                        const std::vector<float> &scales,
+                                        const weights_t *&wei,
+                                        const memory_desc_t *&wei_md) {
+            wei_md = prim->pd()->dst_md();
+            std::unique_ptr<memory_t, memory_deleter_t> reorder_dst;
+            CHECK(safe_ptr_assign(reorder_dst,
+                    new memory_t(engine, wei_md,
+                            scratchpad.get_memory_storage(key))));
+
+            memory_desc_t scales_md;
+            const dims_t scales_dims = {(dim_t)scales.size()};
+            CHECK(memory_desc_init_by_tag(scales_md, 1, scales_dims,
+                    data_type::f32, format_tag::a));
+            std::unique_ptr<memory_t, memory_deleter_t> scales_mem;
+            CHECK(safe_ptr_assign(scales_mem,
+                    new memory_t(get_service_engine(), &scales_md,
+                            memory_flags_t::use_runtime_ptr,
+                            const_cast<float *>(scales.data()))));
+
+            exec_args_t reorder_args;
+            reorder_args[DNNL_ARG_SRC] = ctx.args().at(arg);
+            reorder_args[DNNL_ARG_DST] = {reorder_dst.get(), false};
+            reorder_args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC]
+                    = {scales_mem.get(), true};
+            exec_ctx_t reorder_ctx(ctx, std::move(reorder_args));
+            nested_scratchpad_t ns(ctx, key_nested_multiple, prim);
+            reorder_ctx.set_scratchpad_grantor(ns.grantor());
+            CHECK(prim->execute(reorder_ctx));
+            wei = scratchpad.template get<weights_t>(key);
+            return status::success;
+        };
+        CHECK(decompress(wei_layer_decomp_reorder_, DNNL_ARG_WEIGHTS_LAYER,
+                key_rnn_wei_layer_decomp, pd()->wei_decomp_scales_, w_layer,
+                weights_layer_md));
+        CHECK(decompress(wei_iter_decomp_reorder_, DNNL_ARG_WEIGHTS_ITER,
+                key_rnn_wei_iter_decomp, pd()->wei_decomp_scales_, w_iter,
+                weights_iter_md));
+        if (rnn.is_lstm_projection)
+            CHECK(decompress(wei_projection_decomp_reorder_,
+                    DNNL_ARG_WEIGHTS_PROJECTION, key_rnn_wei_projection_decomp,
+                    pd()->wei_projection_decomp_scales_, w_projection,
+                    weights_projection_md));
+    }
 #endif
 
     (this->*weights_iter_assign_func)(rnn, weights_iter_md,
@@ -2193,8 +2468,7 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
             w_layer);
 
     if (rnn.is_lstm_projection) {
-        (this->*weights_projection_assign_func)(rnn,
-                pd()->arg_md(DNNL_ARG_WEIGHTS_PROJECTION),
+        (this->*weights_projection_assign_func)(rnn, weights_projection_md,
                 rnn.n_parts_weights_projection, rnn.parts_weights_projection,
                 ptr_wei_projection, w_projection);
     }
@@ -2224,6 +2498,19 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
                     diff_dst_iter_c);
     }
 
+    // The states of a streaming execution may be updated in place. When the
+    // cells would overwrite the hidden states before they are fully read,
+    // they read them from a copy. The states of a single iteration are
+    // small, so the copy is not worth a parallel region.
+    if (src_iter && src_iter == dst_iter
+            && rnn.needs_src_iter_copy_in_place(pd()->cell_kind())) {
+        char *src_iter_copy
+                = scratchpad.template get<char>(key_rnn_src_iter_in_place);
+        std::memcpy(src_iter_copy, src_iter,
+                memory_desc_wrapper(pd()->src_md(1)).size());
+        src_iter = src_iter_copy;
+    }
+
     // run the execution on the grid
 #if DNNL_X64
     CHECK((this->*grid_computation)(ctx, rnn, ptr_wei_layer, ptr_wei_iter,
@@ -2251,14 +2538,21 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
             diff_weights_peephole, diff_bias, amx_scratchpad));
 #endif
 
-    // Finally we copy the results to the result buffers
-    if (!(rnn.skip_dst_layer_copy() && rnn.is_fwd)) {
+    const int32_t *seq_lengths = rnn.with_seq_lengths
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS)
+            : nullptr;
+
+    // Finally we copy the results to the result buffers. With sequence
+    // lengths, dst_layer is padded with zeros even when the cells have
+    // written it.
+    if (!(rnn.skip_dst_layer_copy() && rnn.is_fwd) || seq_lengths) {
         if (pd()->dst_md(0)->data_type == data_type::f32)
             copy_res_layer(rnn, (float *)dst_layer, diff_src_layer, dst_iter,
-                    ws_states_layer, ws_diff_states_layer);
+                    ws_states_layer, ws_diff_states_layer, seq_lengths);
         else
             copy_res_layer(rnn, (dst_layer_t *)dst_layer, diff_src_layer,
-                    dst_iter, ws_states_layer, ws_diff_states_layer);
+                    dst_iter, ws_states_layer, ws_diff_states_layer,
+                    seq_lengths);
     }
 
     if (!(rnn.skip_dst_iter_copy() && rnn.is_fwd)) {
@@ -2266,12 +2560,12 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
             copy_res_iter(rnn, (float *)dst_iter, dst_iter_c, diff_src_iter,
                     diff_src_iter_c, dst_layer, ws_states_iter,
                     ws_states_iter_c, ws_diff_states_iter,
-                    ws_diff_states_iter_c);
+                    ws_diff_states_iter_c, seq_lengths);
         else
             copy_res_iter(rnn, (dst_iter_t *)dst_iter, dst_iter_c,
                     diff_src_iter, diff_src_iter_c, dst_layer, ws_states_iter,
                     ws_states_iter_c, ws_diff_states_iter,
-                    ws_diff_states_iter_c);
+                    ws_diff_states_iter_c, seq_lengths);
     }
 
     return status::success;
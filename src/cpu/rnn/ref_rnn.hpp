@@ -20,6 +20,7 @@
 
 #include <assert.h>
 #include <tuple>
+#include <vector>
 
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
@@ -171,9 +172,19 @@ struct ref_rnn_common_t : public primitive_t {
 #if DNNL_X64
         std::shared_ptr<primitive_desc_t> bf32_wei_layer_reorder_pd_;
         std::shared_ptr<primitive_desc_t> bf32_wei_iter_reorder_pd_;
+        // Decompression of int weights to bf16, see with_wei_decompression.
+        std::shared_ptr<primitive_desc_t> wei_layer_decomp_reorder_pd_;
+        std::shared_ptr<primitive_desc_t> wei_iter_decomp_reorder_pd_;
+        std::shared_ptr<primitive_desc_t> wei_projection_decomp_reorder_pd_;
+        // The inverses of the weights quantization scales.
+        std::vector<float> wei_decomp_scales_;
+        std::vector<float> wei_projection_decomp_scales_;
 #endif
     protected:
         void init_scratchpad(size_t scratchpad_sz);
+#if DNNL_X64
+        status_t init_wei_decompression(engine_t *engine);
+#endif
     };
 
     ref_rnn_common_t(const pd_t *apd)
@@ -189,6 +200,9 @@ protected:
     ref_rnn_brgemm_t rnn_brgemm_;
     std::shared_ptr<primitive_t> bf32_wei_layer_reorder_;
     std::shared_ptr<primitive_t> bf32_wei_iter_reorder_;
+    std::shared_ptr<primitive_t> wei_layer_decomp_reorder_;
+    std::shared_ptr<primitive_t> wei_iter_decomp_reorder_;
+    std::shared_ptr<primitive_t> wei_projection_decomp_reorder_;
 #endif
 
     template <typename input_t>
@@ -208,7 +222,8 @@ protected:
     void copy_res_layer(const rnn_utils::rnn_conf_t &rnn,
             dst_layer_dt *dst_layer_, gemm_acc_t *diff_src_layer_,
             const dst_iter_dt *dst_iter_, const src_layer_t *ws_states_layer_,
-            const gemm_acc_t *ws_diff_states_layer_) const;
+            const gemm_acc_t *ws_diff_states_layer_,
+            const int32_t *seq_lengths) const;
 
     template <typename prim_dst_iter_t, typename prim_dst_layer_t>
     void copy_res_iter(const rnn_utils::rnn_conf_t &rnn,
@@ -217,7 +232,8 @@ protected:
             const prim_dst_layer_t *dst_layer_,
             const src_iter_t *ws_states_iter_, const void *ws_states_iter_c,
             const gemm_acc_t *ws_diff_states_iter_,
-            const gemm_acc_t *ws_diff_states_iter_c_) const;
+            const gemm_acc_t *ws_diff_states_iter_c_,
+            const int32_t *seq_lengths) const;
 
     rnn_grid_execution_sig(linear_execution);
     rnn_matmul_sig(execute_matmul);
@@ -221,6 +221,13 @@ status_t rnn_utils::set_expected_desc(rnn_conf_t &rnn,
         default: assert(!"unsupported weights type");
     }
 
+    // The int weights to decompress are taken as they are stored, and the
+    // bf16 weights the cells use are only internal.
+    if (rnn.with_wei_decompression)
+        return memory_desc_init_by_tag(weights_md,
+                weights_type == weights_type_t::projection ? format_tag::ldio
+                                                           : format_tag::ldigo);
+
     if (use_packed_gemm) {
         weights_md.format_kind = format_kind::rnn_packed;
         rnn_packed_desc_t &rnn_pdata = weights_md.format_desc.rnn_packed_desc;
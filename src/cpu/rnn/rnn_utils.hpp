@@ -21,6 +21,7 @@
 #include <type_traits>
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
 #include "common/primitive.hpp"
 #include "common/utils.hpp"
@@ -407,9 +408,20 @@ struct rnn_conf_t {
          force_nocopy = false, use_layer_packed_gemm = false,
          use_iter_packed_gemm = false, use_projection_packed_gemm = false;
     int n_iter_scratch_gates = 0;
+    // Run the cells with the same layer + iteration concurrently, see
+    // linear_execution(). Every layer then has its own per-cell scratch.
+    bool wavefront = false;
 
     bool diff_weights_overwrite = false;
     bool use_matmul = false;
+    // The sequences of the batch have their own lengths. The cells of an
+    // iteration only compute the rows up to the last running sequence, and
+    // the outputs past the end of a sequence are fixed up by the copies.
+    bool with_seq_lengths = false;
+    // The weights are int8 or int4 with bf16 activations. They are
+    // decompressed to bf16 at the start of an execution, and the cells then
+    // run as for all_bf16.
+    bool with_wei_decompression = false;
 
     inline bool is_int8_conf() const {
         return is_signed_int8_conf() || is_unsigned_int8_conf();
@@ -478,6 +490,33 @@ struct rnn_conf_t {
 
     inline bool is_bf32() const { return is_cell_bf16_amx() && is_f32_conf(); }
 
+    // Returns the number of iterations of sequence b, clamped to [1, n_iter].
+    inline int seq_length(const int32_t *seq_lengths, int b) const {
+        return nstl::max(1, nstl::min((int)seq_lengths[b], n_iter));
+    }
+
+    // Returns whether a cell can leave out the rows of the sequences that
+    // ended. The matmul primitives, the packed gemm weights and the bf32
+    // transposes are set up for the full batch.
+    inline bool can_shrink_batch() const {
+        return with_seq_lengths && !use_matmul && !is_bf32()
+                && !(use_layer_packed_gemm || use_iter_packed_gemm
+                        || use_projection_packed_gemm);
+    }
+
+    // Returns whether the hidden states have to be read from a copy of
+    // src_iter when it is in place with dst_iter. A single-iteration cell
+    // reads src_iter and writes dst_iter directly, and the fused brgemm
+    // postgemm and the first part of a GRU cell write the hidden states
+    // while the source rows are still needed.
+    inline bool needs_src_iter_copy_in_place(alg_kind_t cell_kind) const {
+        return is_fwd && n_iter == 1 && skip_src_iter_copy()
+                && skip_dst_iter_copy()
+                && ((is_brgemm && !is_lstm_projection)
+                        || utils::one_of(cell_kind, alg_kind::vanilla_gru,
+                                alg_kind::vanilla_augru));
+    }
+
     inline bool skip_src_layer_copy() const {
         return (exec_dir == l2r) && !is_bf32()
                 && utils::one_of(dt_conf, s8s8s8f32, f32s8f32f32, s8s8s8s8,
@@ -496,6 +535,7 @@ struct rnn_conf_t {
     }
     inline bool skip_dst_iter_copy() const {
         return (exec_dir == l2r) && (dst_iter_ld_ > 0) && !is_bf32()
+                && !with_seq_lengths
                 && utils::one_of(dt_conf, s8s8s8s8, s8s8s8f32, u8u8u8u8,
                         u8u8u8f32, all_f32, all_bf16, all_f16);
     }
@@ -696,6 +736,7 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.is_training = utils::one_of(
             rd.prop_kind, prop_kind::forward_training, prop_kind::backward);
     rnn.is_lbr = utils::one_of(rd.cell_kind, dnnl_lbr_gru, dnnl_lbr_augru);
+    rnn.with_seq_lengths = rd.flags & rnn_flags::seq_lengths;
     rnn.is_lstm_peephole = rd.cell_kind == dnnl_vanilla_lstm
             && !memory_desc_wrapper(rd.weights_peephole_desc).is_zero();
     rnn.is_lstm_projection = rd.cell_kind == dnnl_vanilla_lstm
@@ -721,13 +762,17 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                 dst_layer_d.data_type(), weights_layer_d.data_type()))
         rnn.dt_conf = all_f32;
     else if (utils::everyone_is(data_type::bf16, src_layer_d.data_type(),
-                     dst_layer_d.data_type(), weights_layer_d.data_type())) {
+                     dst_layer_d.data_type())
+            && utils::one_of(weights_layer_d.data_type(), data_type::bf16,
+                    data_type::s8, data_type::s4)) {
         if (!platform::has_data_type_support(data_type::bf16)) return false;
 #if DNNL_X64
         if (!(x64::mayiuse(x64::avx512_core) || x64::mayiuse(x64::avx2_vnni_2)))
             return false;
 #endif
         rnn.dt_conf = all_bf16;
+        rnn.with_wei_decompression
+                = weights_layer_d.data_type() != data_type::bf16;
     } else if (utils::everyone_is(data_type::f16, src_layer_d.data_type(),
                        dst_layer_d.data_type(), weights_layer_d.data_type())) {
         if (!platform::has_data_type_support(data_type::f16)) return false;
@@ -784,8 +829,9 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
 
     // set members with user memories leading dimensions
     // Assumption: weights datatype size is the same as state datatype size
-    assert(types::data_type_size(weights_layer_d.data_type())
-            == types::data_type_size(src_layer_d.data_type()));
+    assert(IMPLICATION(!rnn.with_wei_decompression,
+            types::data_type_size(weights_layer_d.data_type())
+                    == types::data_type_size(src_layer_d.data_type())));
 
     // set workspace leading dimensions (and non leading-dimensions)
 
@@ -952,6 +998,23 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                             || rnn.is_int8_conf() || is_bf16)
             : false;
 
+    /* Decide to compute the cells of a wavefront concurrently */
+    // A small cell is not worth splitting over all the threads, while the
+    // cells of different layers along a diagonal of the grid are independent
+    // and can run one per thread. Nested gemm calls are then single-threaded,
+    // which the brgemm and matmul based cells and the packed gemm, whose
+    // weights are packed for a fixed thread count, do not support.
+    // The number of multiply-adds per thread below which a cell is small.
+    constexpr dim_t wavefront_cell_work = 1 << 16;
+    const dim_t cell_work = (dim_t)rnn.mb * rnn.n_gates * rnn.dhc
+            * (rnn.slc + rnn.sic);
+    rnn.wavefront = rnn.is_fwd && !(rnn.is_brgemm || rnn.use_matmul)
+            && !(rnn.use_layer_packed_gemm || rnn.use_iter_packed_gemm
+                    || rnn.use_projection_packed_gemm)
+            && rnn.n_layer > 1 && rnn.n_iter > 1 && dnnl_get_max_threads() > 1
+            && cell_work < (dim_t)dnnl_get_max_threads() * wavefront_cell_work;
+    if (rnn.wavefront) rnn.merge_gemm_layer = false;
+
     rnn.diff_weights_overwrite = rd.flags & rnn_flags::diff_weights_overwrite;
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL || BUILD_GEMM_KERNELS_NONE
@@ -1166,11 +1229,12 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
             : (size_t)0;
     rnn.n_iter_scratch_gates
             = (rnn.merge_gemm_layer || rnn.merge_gemm_iter) ? rnn.n_iter : 1;
+    const int n_scratch_slots = rnn.wavefront ? rnn.n_layer : 1;
     rnn.scratch_gates_size = sizeof(typename T::scratch_t)
-            * rnn.n_iter_scratch_gates * rnn.scratch_gates_nld
-            * rnn.scratch_gates_ld;
-    rnn.scratch_ht_size
-            = sizeof(typename T::ht_t) * rnn.scratch_ht_nld * rnn.scratch_ht_ld;
+            * nstl::max(rnn.n_iter_scratch_gates, n_scratch_slots)
+            * rnn.scratch_gates_nld * rnn.scratch_gates_ld;
+    rnn.scratch_ht_size = sizeof(typename T::ht_t) * n_scratch_slots
+            * rnn.scratch_ht_nld * rnn.scratch_ht_ld;
     rnn.scratch_diff_ht_size = rnn.is_training ? sizeof(typename T::gemm_acc_t)
                     * rnn.scratch_diff_ht_nld * rnn.scratch_diff_ht_ld
                                                : (size_t)0;
@@ -1180,8 +1244,8 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
     rnn.scratch_cell_size = (utils::one_of(rd.cell_kind, alg_kind::vanilla_gru,
                                      alg_kind::vanilla_augru, alg_kind::lbr_gru,
                                      alg_kind::lbr_augru)
-                    ? sizeof(typename T::scratch_t) * rnn.scratch_gates_nld
-                            * rnn.scratch_gates_ld
+                    ? sizeof(typename T::scratch_t) * n_scratch_slots
+                            * rnn.scratch_gates_nld * rnn.scratch_gates_ld
                     : 0);
     /// workspace needed for lbr GRU
     rnn.ws_per_cell = (size_t)rnn.is_lbr * rnn.mb * rnn.dhc
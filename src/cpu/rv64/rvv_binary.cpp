@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#include <riscv_vector.h>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/rv64/rvv_binary.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+namespace {
+inline vfloat32m1_t compute_binary(alg_kind_t alg, vfloat32m1_t a,
+        vfloat32m1_t b, size_t vl) {
+    using namespace alg_kind;
+    switch (alg) {
+        case binary_add: return __riscv_vfadd_vv_f32m1(a, b, vl);
+        case binary_mul: return __riscv_vfmul_vv_f32m1(a, b, vl);
+        case binary_sub: return __riscv_vfsub_vv_f32m1(a, b, vl);
+        case binary_div: return __riscv_vfdiv_vv_f32m1(a, b, vl);
+        case binary_max: return __riscv_vfmax_vv_f32m1(a, b, vl);
+        case binary_min: return __riscv_vfmin_vv_f32m1(a, b, vl);
+        default: assert(!"unsupported alg_kind"); return a;
+    }
+}
+} // namespace
+
+status_t rvv_binary_t::execute(const exec_ctx_t &ctx) const {
+    auto src0 = CTX_IN_MEM(const float *, DNNL_ARG_SRC_0);
+    auto src1 = CTX_IN_MEM(const float *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src0_d(pd()->src_md(0));
+    const memory_desc_wrapper src1_d(pd()->src_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const dim_t nelems = src0_d.nelems();
+    const alg_kind_t alg = pd()->desc()->alg_kind;
+    const bool is_scalar_src1 = pd()->is_scalar_src1_;
+    const rvv_postops_t postops(pd()->attr()->post_ops_);
+
+    src0 += src0_d.offset0();
+    src1 += src1_d.offset0();
+    dst += dst_d.offset0();
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(nelems, nthr, ithr, start, end);
+        for (dim_t i = start; i < end;) {
+            const size_t vl = __riscv_vsetvl_e32m1(end - i);
+            const vfloat32m1_t a = __riscv_vle32_v_f32m1(src0 + i, vl);
+            const vfloat32m1_t b = is_scalar_src1
+                    ? __riscv_vfmv_v_f_f32m1(src1[0], vl)
+                    : __riscv_vle32_v_f32m1(src1 + i, vl);
+            const vfloat32m1_t res = compute_binary(alg, a, b, vl);
+            __riscv_vse32_v_f32m1(dst + i, postops.apply(res, vl), vl);
+            i += vl;
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_RV64_RVV_BINARY_HPP
+#define CPU_RV64_RVV_BINARY_HPP
+
+#include "common/primitive.hpp"
+#include "cpu/cpu_binary_pd.hpp"
+#include "cpu/rv64/rvv_postops.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+// Binary operation of dense tensors of the same layout, where the second
+// source either has the shape of the first one or is a single value.
+struct rvv_binary_t : public primitive_t {
+    struct pd_t : public cpu_binary_pd_t {
+        using cpu_binary_pd_t::cpu_binary_pd_t;
+
+        DECLARE_COMMON_PD_T("RISCV64GCV", rvv_binary_t)
+
+        status_t init(engine_t *engine) {
+            UNUSED(engine);
+            using namespace alg_kind;
+            using sm = primitive_attr_t::skip_mask_t;
+
+            VDISPATCH_BINARY(utils::everyone_is(data_type::f32,
+                                     src_md(0)->data_type, src_md(1)->data_type,
+                                     dst_md()->data_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_BINARY(utils::one_of(desc()->alg_kind, binary_add,
+                                     binary_mul, binary_sub, binary_div,
+                                     binary_max, binary_min),
+                    VERBOSE_BAD_ALGORITHM);
+            VDISPATCH_BINARY(set_default_params() == status::success,
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_BINARY(attr()->has_default_values(sm::post_ops),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_BINARY(rvv_postops_t::post_ops_ok(attr()->post_ops_),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+
+            const memory_desc_wrapper src0_d(src_md(0));
+            const memory_desc_wrapper src1_d(src_md(1));
+            const memory_desc_wrapper dst_d(dst_md());
+            VDISPATCH_BINARY(
+                    src0_d == dst_d, VERBOSE_INCONSISTENT_MDS, "src0", "dst");
+            VDISPATCH_BINARY(src0_d.is_dense(), VERBOSE_UNSUPPORTED_TAG);
+            is_scalar_src1_ = src1_d.nelems() == 1;
+            VDISPATCH_BINARY(is_scalar_src1_ || src1_d.similar_to(src0_d),
+                    VERBOSE_UNSUPPORTED_TAG_S, "src1");
+            VDISPATCH_BINARY(
+                    attr_.set_default_formats(dst_md(0)) == status::success,
+                    VERBOSE_UNSUPPORTED_POSTOP);
+
+            return status::success;
+        }
+
+        bool is_scalar_src1_ = false;
+    };
+
+    rvv_binary_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_RV64_RVV_BINARY_HPP
@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#include <algorithm>
+#include <cstring>
+
+#include "cpu/rv64/rvv_gemm_convolution.hpp"
+#include "cpu/rv64/rvv_gemm_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+using namespace memory_tracking::names;
+
+status_t rvv_gemm_convolution_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const auto pd = this->pd();
+    const dim_t MB = pd->MB();
+    const dim_t IC = pd->IC(), OC = pd->OC();
+    const dim_t ID = pd->ID(), IH = pd->IH(), IW = pd->IW();
+    const dim_t OD = pd->OD(), OH = pd->OH(), OW = pd->OW();
+    const dim_t KD = pd->KD(), KH = pd->KH(), KW = pd->KW();
+    const dim_t KSD = pd->KSD(), KSH = pd->KSH(), KSW = pd->KSW();
+    const dim_t KDD = pd->KDD() + 1, KDH = pd->KDH() + 1, KDW = pd->KDW() + 1;
+    const dim_t padFront = pd->padFront(), padT = pd->padT();
+    const dim_t padL = pd->padL();
+    const dim_t K = pd->K_size();
+
+    const rvv_postops_t postops(pd->attr()->post_ops_);
+
+    if (pd->is_1x1_) {
+        // The source points are the rows of A, split in blocks between the
+        // threads.
+        constexpr dim_t sp_block = 64;
+        const dim_t SP = MB * OD * OH * OW;
+        parallel_nd(utils::div_up(SP, sp_block), [&](dim_t spb) {
+            const dim_t sp = spb * sp_block;
+            const dim_t M = nstl::min(sp_block, SP - sp);
+            rvv_gemm_f32(M, OC, IC, src + sp * IC, IC, weights, OC,
+                    dst + sp * OC, OC, bias, postops);
+        });
+        return status::success;
+    }
+
+    float *col_base = ctx.get_scratchpad_grantor().template get<float>(
+            key_conv_gemm_col);
+
+    const dim_t work_amount = MB * OD * OH;
+    parallel(pd->nthr_, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+        float *col = col_base + ithr * OW * K;
+
+        dim_t mb = 0, od = 0, oh = 0;
+        utils::nd_iterator_init(start, mb, MB, od, OD, oh, OH);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            // Gathers the patches of the output row, with zeros for the
+            // padding, as the rows of A.
+            for (dim_t ow = 0; ow < OW; ++ow) {
+                float *c = col + ow * K;
+                for_(dim_t kd = 0; kd < KD; ++kd)
+                for_(dim_t kh = 0; kh < KH; ++kh)
+                for (dim_t kw = 0; kw < KW; ++kw) {
+                    const dim_t id = od * KSD - padFront + kd * KDD;
+                    const dim_t ih = oh * KSH - padT + kh * KDH;
+                    const dim_t iw = ow * KSW - padL + kw * KDW;
+                    float *cc = c + ((kd * KH + kh) * KW + kw) * IC;
+                    if (id < 0 || id >= ID || ih < 0 || ih >= IH || iw < 0
+                            || iw >= IW) {
+                        std::fill(cc, cc + IC, 0.f);
+                        continue;
+                    }
+                    const float *s
+                            = src + (((mb * ID + id) * IH + ih) * IW + iw) * IC;
+                    std::memcpy(cc, s, IC * sizeof(float));
+                }
+            }
+
+            float *d = dst + ((mb * OD + od) * OH + oh) * OW * OC;
+            rvv_gemm_f32(OW, OC, K, col, K, weights, OC, d, OC, bias, postops);
+            utils::nd_iterator_step(mb, MB, od, OD, oh, OH);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
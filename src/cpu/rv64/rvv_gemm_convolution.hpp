@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_RV64_RVV_GEMM_CONVOLUTION_HPP
+#define CPU_RV64_RVV_GEMM_CONVOLUTION_HPP
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/rv64/rvv_postops.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+// Convolution of channels-last tensors computed with the GEMM micro-kernel.
+// The weights are kept with the output channels innermost, and the source
+// patches of a row of output points are gathered into a per-thread buffer
+// (im2col). A 1x1 convolution without strides and padding reads the source
+// directly.
+struct rvv_gemm_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("RISCV64GCV", rvv_gemm_convolution_fwd_t)
+
+        status_t init(engine_t *engine) {
+            UNUSED(engine);
+            using namespace data_type;
+            using namespace format_tag;
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+            VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
+                    VERBOSE_BAD_ALGORITHM);
+            VDISPATCH_CONV(expect_data_types(f32, f32, f32, f32, f32),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+            VDISPATCH_CONV(!with_groups(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "groups are not supported");
+            VDISPATCH_CONV(attr()->has_default_values(skip_mask_t::post_ops),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_CONV(rvv_postops_t::post_ops_ok(attr()->post_ops_),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+
+            const int sp_ndims = ndims() - 2;
+            const format_tag_t dat_tag
+                    = utils::pick(sp_ndims - 1, nwc, nhwc, ndhwc);
+            const format_tag_t wei_tag
+                    = utils::pick(sp_ndims - 1, wio, hwio, dhwio);
+            VDISPATCH_CONV(
+                    set_default_formats_common(dat_tag, wei_tag, dat_tag),
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_CONV(memory_desc_matches_tag(src_md_, dat_tag),
+                    VERBOSE_UNSUPPORTED_TAG_S, "src");
+            VDISPATCH_CONV(memory_desc_matches_tag(weights_md_, wei_tag),
+                    VERBOSE_UNSUPPORTED_TAG_S, "weights");
+            VDISPATCH_CONV(memory_desc_matches_tag(dst_md_, dat_tag),
+                    VERBOSE_UNSUPPORTED_TAG_S, "dst");
+            VDISPATCH_CONV(
+                    attr_.set_default_formats(dst_md(0)) == status::success,
+                    VERBOSE_UNSUPPORTED_POSTOP);
+
+            is_1x1_ = utils::everyone_is(1, KD(), KH(), KW(), KSD(), KSH(),
+                              KSW())
+                    && utils::everyone_is(0, padFront(), padT(), padL())
+                    && ID() == OD() && IH() == OH() && IW() == OW();
+            nthr_ = dnnl_get_max_threads();
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        // The size of a row of the im2col buffer.
+        dim_t K_size() const { return KD() * KH() * KW() * IC(); }
+
+        bool is_1x1_ = false;
+        int nthr_ = 0;
+
+    private:
+        void init_scratchpad() {
+            if (is_1x1_) return;
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.book<float>(key_conv_gemm_col, nthr_ * OW() * K_size());
+        }
+    };
+
+    rvv_gemm_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_RV64_RVV_GEMM_CONVOLUTION_HPP
@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#include <riscv_vector.h>
+
+#include "cpu/rv64/rvv_gemm_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+namespace {
+inline vfloat32m1_t init_acc(const float *bias, dim_t n0, size_t vl) {
+    return bias ? __riscv_vle32_v_f32m1(bias + n0, vl)
+                : __riscv_vfmv_v_f_f32m1(0.f, vl);
+}
+
+inline void store_acc(vfloat32m1_t acc, float *C, const rvv_postops_t &postops,
+        size_t vl) {
+    __riscv_vse32_v_f32m1(C, postops.apply(acc, vl), vl);
+}
+
+// Computes 4 rows of C for a vector of columns, so that every row of B loaded
+// from memory is used by 4 multiply-adds.
+void kernel_4xv(dim_t K, const float *A, dim_t lda, const float *B, dim_t ldb,
+        float *C, dim_t ldc, const float *bias, dim_t n0,
+        const rvv_postops_t &postops, size_t vl) {
+    vfloat32m1_t acc0 = init_acc(bias, n0, vl);
+    vfloat32m1_t acc1 = acc0;
+    vfloat32m1_t acc2 = acc0;
+    vfloat32m1_t acc3 = acc0;
+    const float *a0 = A;
+    const float *a1 = A + lda;
+    const float *a2 = A + 2 * lda;
+    const float *a3 = A + 3 * lda;
+    for (dim_t k = 0; k < K; ++k) {
+        const vfloat32m1_t b = __riscv_vle32_v_f32m1(B + k * ldb + n0, vl);
+        acc0 = __riscv_vfmacc_vf_f32m1(acc0, a0[k], b, vl);
+        acc1 = __riscv_vfmacc_vf_f32m1(acc1, a1[k], b, vl);
+        acc2 = __riscv_vfmacc_vf_f32m1(acc2, a2[k], b, vl);
+        acc3 = __riscv_vfmacc_vf_f32m1(acc3, a3[k], b, vl);
+    }
+    store_acc(acc0, C + n0, postops, vl);
+    store_acc(acc1, C + ldc + n0, postops, vl);
+    store_acc(acc2, C + 2 * ldc + n0, postops, vl);
+    store_acc(acc3, C + 3 * ldc + n0, postops, vl);
+}
+
+void kernel_1xv(dim_t K, const float *A, const float *B, dim_t ldb, float *C,
+        const float *bias, dim_t n0, const rvv_postops_t &postops, size_t vl) {
+    vfloat32m1_t acc = init_acc(bias, n0, vl);
+    for (dim_t k = 0; k < K; ++k) {
+        const vfloat32m1_t b = __riscv_vle32_v_f32m1(B + k * ldb + n0, vl);
+        acc = __riscv_vfmacc_vf_f32m1(acc, A[k], b, vl);
+    }
+    store_acc(acc, C + n0, postops, vl);
+}
+} // namespace
+
+void rvv_gemm_f32(dim_t M, dim_t N, dim_t K, const float *A, dim_t lda,
+        const float *B, dim_t ldb, float *C, dim_t ldc, const float *bias,
+        const rvv_postops_t &postops) {
+    constexpr dim_t m_block = 4;
+    for (dim_t n0 = 0; n0 < N;) {
+        const size_t vl = __riscv_vsetvl_e32m1(N - n0);
+        dim_t m = 0;
+        for (; m + m_block <= M; m += m_block)
+            kernel_4xv(K, A + m * lda, lda, B, ldb, C + m * ldc, ldc, bias, n0,
+                    postops, vl);
+        for (; m < M; ++m)
+            kernel_1xv(K, A + m * lda, B, ldb, C + m * ldc, bias, n0, postops,
+                    vl);
+        n0 += vl;
+    }
+}
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
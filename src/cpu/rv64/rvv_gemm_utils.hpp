@@ -0,0 +1,40 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_RV64_RVV_GEMM_UTILS_HPP
+#define CPU_RV64_RVV_GEMM_UTILS_HPP
+
+#include "common/c_types_map.hpp"
+#include "cpu/rv64/rvv_postops.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+// Computes C = A * B + bias for the row-major matrices A (M x K), B (K x N)
+// and C (M x N), and applies the post-ops to C. The bias, if any, has N
+// values. The function runs on the calling thread, so that the callers split
+// the matrices between the threads.
+void rvv_gemm_f32(dim_t M, dim_t N, dim_t K, const float *A, dim_t lda,
+        const float *B, dim_t ldb, float *C, dim_t ldc, const float *bias,
+        const rvv_postops_t &postops);
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_RV64_RVV_GEMM_UTILS_HPP
@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/rv64/rvv_gemm_utils.hpp"
+#include "cpu/rv64/rvv_inner_product.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+status_t rvv_inner_product_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const dim_t MB = pd()->MB();
+    const dim_t OC = pd()->OC();
+    const dim_t IC = pd()->IC_total();
+
+    const rvv_postops_t postops(pd()->attr()->post_ops_);
+
+    // The blocks keep a few rows of the source and the weights of a block of
+    // output channels in cache, and give work to all the threads for a small
+    // batch.
+    constexpr dim_t mb_block = 16;
+    constexpr dim_t oc_block = 256;
+    const dim_t nb_mb = utils::div_up(MB, mb_block);
+    const dim_t nb_oc = utils::div_up(OC, oc_block);
+
+    parallel_nd(nb_mb, nb_oc, [&](dim_t mbb, dim_t ocb) {
+        const dim_t mb = mbb * mb_block;
+        const dim_t oc = ocb * oc_block;
+        const dim_t M = nstl::min(mb_block, MB - mb);
+        const dim_t N = nstl::min(oc_block, OC - oc);
+        rvv_gemm_f32(M, N, IC, src + mb * IC, IC, weights + oc, OC,
+                dst + mb * OC + oc, OC, bias ? bias + oc : nullptr, postops);
+    });
+
+    return status::success;
+}
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
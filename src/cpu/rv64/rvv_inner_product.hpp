@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_RV64_RVV_INNER_PRODUCT_HPP
+#define CPU_RV64_RVV_INNER_PRODUCT_HPP
+
+#include "common/primitive.hpp"
+#include "cpu/cpu_inner_product_pd.hpp"
+#include "cpu/rv64/rvv_postops.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+// Inner product computed as a GEMM of the source, flattened to MB x IC, and
+// the weights kept in a layout with the output channels innermost, so that
+// the micro-kernel loads the weights of consecutive output channels as a
+// vector.
+struct rvv_inner_product_fwd_t : public primitive_t {
+    struct pd_t : public cpu_inner_product_fwd_pd_t {
+        using cpu_inner_product_fwd_pd_t::cpu_inner_product_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("RISCV64GCV", rvv_inner_product_fwd_t)
+
+        status_t init(engine_t *engine) {
+            UNUSED(engine);
+            using namespace data_type;
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+            VDISPATCH_INNER_PRODUCT(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_INNER_PRODUCT(
+                    !has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+            VDISPATCH_INNER_PRODUCT(
+                    utils::everyone_is(f32, src_md()->data_type,
+                            weights_md()->data_type, dst_md()->data_type,
+                            with_bias() ? weights_md(1)->data_type : f32),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_INNER_PRODUCT(
+                    attr()->has_default_values(skip_mask_t::post_ops),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_INNER_PRODUCT(
+                    rvv_postops_t::post_ops_ok(attr()->post_ops_),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+            VDISPATCH_INNER_PRODUCT(set_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_INNER_PRODUCT(
+                    attr_.set_default_formats(dst_md(0)) == status::success,
+                    VERBOSE_UNSUPPORTED_POSTOP);
+
+            return status::success;
+        }
+
+    private:
+        // Picks the weights layout which flattens to IC x OC in the order of
+        // the flattened source.
+        bool set_formats() {
+            using namespace format_tag;
+            const int sp_ndims = ndims() - 2;
+            const format_tag_t ncsp
+                    = utils::pick(sp_ndims, nc, ncw, nchw, ncdhw);
+            const format_tag_t nspc
+                    = utils::pick(sp_ndims, nc, nwc, nhwc, ndhwc);
+
+            if (src_md_.format_kind == format_kind::any
+                    && memory_desc_init_by_tag(src_md_, ncsp)
+                            != status::success)
+                return false;
+            if (dst_md_.format_kind == format_kind::any
+                    && memory_desc_init_by_tag(dst_md_, nc) != status::success)
+                return false;
+            if (with_bias() && bias_md_.format_kind == format_kind::any
+                    && memory_desc_init_by_tag(bias_md_, x) != status::success)
+                return false;
+
+            format_tag_t wei_tag = undef;
+            if (memory_desc_matches_tag(src_md_, ncsp))
+                wei_tag = utils::pick(sp_ndims, io, iwo, ihwo, idhwo);
+            else if (memory_desc_matches_tag(src_md_, nspc))
+                wei_tag = utils::pick(sp_ndims, io, wio, hwio, dhwio);
+            else
+                return false;
+
+            if (weights_md_.format_kind == format_kind::any
+                    && memory_desc_init_by_tag(weights_md_, wei_tag)
+                            != status::success)
+                return false;
+
+            return memory_desc_matches_tag(weights_md_, wei_tag)
+                    && memory_desc_matches_tag(dst_md_, nc)
+                    && IMPLICATION(with_bias(),
+                            memory_desc_matches_tag(bias_md_, x));
+        }
+    };
+
+    rvv_inner_product_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_RV64_RVV_INNER_PRODUCT_HPP
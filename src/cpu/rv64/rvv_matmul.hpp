@@ -61,6 +61,8 @@ struct rvv_matmul_t : public primitive_t {
 
             VDISPATCH_MATMUL(rvv_postops_t::post_ops_ok(attr()->post_ops_),
                     VERBOSE_UNSUPPORTED_POSTOP);
+            VDISPATCH_MATMUL(!with_top_k(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_MATMUL(!with_dst_split(), VERBOSE_UNSUPPORTED_ATTR);
 
             VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
 
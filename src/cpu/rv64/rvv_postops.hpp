@@ -18,14 +18,69 @@
 
 #include <riscv_vector.h>
 
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/utils.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
 namespace rv64 {
 
+// Eltwise operations which take a few vector instructions, shared between
+// the eltwise primitive and the post-ops of the other primitives.
+struct rvv_eltwise_ops_t {
+    static bool alg_ok(alg_kind_t alg) {
+        using namespace alg_kind;
+        return utils::one_of(alg, eltwise_relu, eltwise_linear, eltwise_abs,
+                eltwise_square, eltwise_sqrt, eltwise_clip, eltwise_clip_v2,
+                eltwise_hardsigmoid, eltwise_hardswish);
+    }
+
+    static inline vfloat32m1_t compute(alg_kind_t alg, float alpha, float beta,
+            vfloat32m1_t v, size_t vl) {
+        using namespace alg_kind;
+        switch (alg) {
+            case eltwise_relu: {
+                if (alpha == 0.f) return __riscv_vfmax_vf_f32m1(v, 0.f, vl);
+                // The negative values are scaled by alpha.
+                const vbool32_t neg = __riscv_vmflt_vf_f32m1_b32(v, 0.f, vl);
+                return __riscv_vfmul_vf_f32m1_mu(neg, v, v, alpha, vl);
+            }
+            case eltwise_linear:
+                return __riscv_vfadd_vf_f32m1(
+                        __riscv_vfmul_vf_f32m1(v, alpha, vl), beta, vl);
+            case eltwise_abs: return __riscv_vfabs_v_f32m1(v, vl);
+            case eltwise_square: return __riscv_vfmul_vv_f32m1(v, v, vl);
+            case eltwise_sqrt: return __riscv_vfsqrt_v_f32m1(v, vl);
+            case eltwise_clip:
+            case eltwise_clip_v2:
+                return __riscv_vfmin_vf_f32m1(
+                        __riscv_vfmax_vf_f32m1(v, alpha, vl), beta, vl);
+            case eltwise_hardsigmoid: return hardsigmoid(v, alpha, beta, vl);
+            case eltwise_hardswish:
+                return __riscv_vfmul_vv_f32m1(
+                        v, hardsigmoid(v, alpha, beta, vl), vl);
+            default: return v;
+        }
+    }
+
+private:
+    static inline vfloat32m1_t hardsigmoid(
+            vfloat32m1_t v, float alpha, float beta, size_t vl) {
+        const vfloat32m1_t x = __riscv_vfadd_vf_f32m1(
+                __riscv_vfmul_vf_f32m1(v, alpha, vl), beta, vl);
+        return __riscv_vfmin_vf_f32m1(
+                __riscv_vfmax_vf_f32m1(x, 0.f, vl), 1.f, vl);
+    }
+};
+
 struct rvv_postops_t {
     rvv_postops_t(const post_ops_t &po)
-        : alg_(po.len() > 0 ? po.entry_[0].eltwise.alg : alg_kind::undef) {
+        : alg_(po.len() > 0 ? po.entry_[0].eltwise.alg : alg_kind::undef)
+        , alpha_(po.len() > 0 ? po.entry_[0].eltwise.alpha : 0.f)
+        , beta_(po.len() > 0 ? po.entry_[0].eltwise.beta : 0.f)
+        , scale_(po.len() > 0 ? po.entry_[0].eltwise.scale : 1.f) {
         assert(po.len() <= 1 && "rvv_postops_t supports at most one post-op");
     }
 
@@ -36,24 +91,21 @@ struct rvv_postops_t {
         const auto &e = po.entry_[0];
         if (!e.is_eltwise()) return false;
 
-        switch (e.eltwise.alg) {
-            case alg_kind::eltwise_relu: return true;
-            default: return false;
-        }
+        return rvv_eltwise_ops_t::alg_ok(e.eltwise.alg);
     }
 
     inline vfloat32m1_t apply(vfloat32m1_t v, size_t vl) const {
-        switch (alg_) {
-            case alg_kind::eltwise_relu: {
-                vfloat32m1_t zero = __riscv_vfmv_v_f_f32m1(0.f, vl);
-                return __riscv_vfmax_vv_f32m1(v, zero, vl);
-            }
-            default: return v;
-        }
+        if (alg_ == alg_kind::undef) return v;
+        v = rvv_eltwise_ops_t::compute(alg_, alpha_, beta_, v, vl);
+        if (scale_ != 1.f) v = __riscv_vfmul_vf_f32m1(v, scale_, vl);
+        return v;
     }
 
 private:
     alg_kind_t alg_;
+    float alpha_;
+    float beta_;
+    float scale_;
 };
 
 } // namespace rv64
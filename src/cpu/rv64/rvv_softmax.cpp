@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#include <cmath>
+#include <riscv_vector.h>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/rv64/rvv_softmax.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+namespace {
+// Computes exp(x) for x <= 0, which holds once the maximum of the row is
+// subtracted. x = n * ln2 + r with |r| <= ln2 / 2, so that exp(r) is
+// approximated by a polynomial and 2^n is built in the exponent bits.
+inline vfloat32m1_t exp_ps(vfloat32m1_t x, size_t vl) {
+    // Below ln(FLT_MIN) the result is flushed to the smallest normal value,
+    // which is negligible next to the maximum of the row, equal to 1.
+    x = __riscv_vfmax_vf_f32m1(x, -87.33654f, vl);
+    const vint32m1_t n = __riscv_vfcvt_x_f_v_i32m1(
+            __riscv_vfmul_vf_f32m1(x, 1.44269504f, vl), vl);
+    const vfloat32m1_t r = __riscv_vfnmsac_vf_f32m1(
+            x, 0.693147181f, __riscv_vfcvt_f_x_v_f32m1(n, vl), vl);
+
+    vfloat32m1_t p = __riscv_vfmv_v_f_f32m1(1.f / 120, vl);
+    const float coeffs[] = {1.f / 24, 1.f / 6, 1.f / 2, 1.f, 1.f};
+    for (float c : coeffs)
+        p = __riscv_vfadd_vf_f32m1(__riscv_vfmul_vv_f32m1(p, r, vl), c, vl);
+
+    const vint32m1_t pow2n = __riscv_vsll_vx_i32m1(
+            __riscv_vadd_vx_i32m1(n, 127, vl), 23, vl);
+    return __riscv_vfmul_vv_f32m1(
+            p, __riscv_vreinterpret_v_i32m1_f32m1(pow2n), vl);
+}
+} // namespace
+
+status_t rvv_softmax_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const dim_t outer_size = pd()->outer_size();
+    const dim_t axis_size = pd()->axis_size();
+    const bool is_log = pd()->is_logsoftmax();
+
+    src += src_d.offset0();
+    dst += dst_d.offset0();
+
+    parallel_nd(outer_size, [&](dim_t ou) {
+        const float *s = src + ou * axis_size;
+        float *d = dst + ou * axis_size;
+        const size_t vlmax = __riscv_vsetvlmax_e32m1();
+
+        vfloat32m1_t acc = __riscv_vfmv_v_f_f32m1(-INFINITY, vlmax);
+        for (dim_t i = 0; i < axis_size;) {
+            const size_t vl = __riscv_vsetvl_e32m1(axis_size - i);
+            acc = __riscv_vfredmax_vs_f32m1_f32m1(
+                    __riscv_vle32_v_f32m1(s + i, vl), acc, vl);
+            i += vl;
+        }
+        const float max = __riscv_vfmv_f_s_f32m1_f32(acc);
+
+        // The exponents are stored for the plain softmax only, since the
+        // logarithmic one is computed from the source again.
+        acc = __riscv_vfmv_v_f_f32m1(0.f, vlmax);
+        for (dim_t i = 0; i < axis_size;) {
+            const size_t vl = __riscv_vsetvl_e32m1(axis_size - i);
+            const vfloat32m1_t e = exp_ps(
+                    __riscv_vfsub_vf_f32m1(
+                            __riscv_vle32_v_f32m1(s + i, vl), max, vl),
+                    vl);
+            if (!is_log) __riscv_vse32_v_f32m1(d + i, e, vl);
+            acc = __riscv_vfredusum_vs_f32m1_f32m1(e, acc, vl);
+            i += vl;
+        }
+        const float sum = __riscv_vfmv_f_s_f32m1_f32(acc);
+
+        if (is_log) {
+            const float shift = max + logf(sum);
+            for (dim_t i = 0; i < axis_size;) {
+                const size_t vl = __riscv_vsetvl_e32m1(axis_size - i);
+                __riscv_vse32_v_f32m1(d + i,
+                        __riscv_vfsub_vf_f32m1(
+                                __riscv_vle32_v_f32m1(s + i, vl), shift, vl),
+                        vl);
+                i += vl;
+            }
+        } else {
+            const float inv_sum = 1.f / sum;
+            for (dim_t i = 0; i < axis_size;) {
+                const size_t vl = __riscv_vsetvl_e32m1(axis_size - i);
+                __riscv_vse32_v_f32m1(d + i,
+                        __riscv_vfmul_vf_f32m1(
+                                __riscv_vle32_v_f32m1(d + i, vl), inv_sum, vl),
+                        vl);
+                i += vl;
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
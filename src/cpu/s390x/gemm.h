@@ -32,6 +32,12 @@ dnnl_status_t gemmx8x8s32(const char *transa, const char *transb,
         dim_t ldB, const int8_t *bo, float beta, int32_t *C, dim_t ldC,
         const int32_t *co);
 
+// Column-major f32 gemm. The bias, of M values, is added to every column of
+// C, which requires beta == 0.
+dnnl_status_t sgemm(const char *transa, const char *transb, dim_t M, dim_t N,
+        dim_t K, float alpha, const float *A, dim_t ldA, const float *B,
+        dim_t ldB, float beta, float *C, dim_t ldC, const float *bias);
+
 } // namespace s390x
 } // namespace cpu
 } // namespace impl
@@ -0,0 +1,190 @@
+/*******************************************************************************
+* Copyright 2025 IBM Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/s390x/vx_f32.hpp"
+
+#if DNNL_S390X_VXE
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+#include "gemm.h"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace s390x {
+
+namespace {
+
+// The micro-kernel computes MR rows by NR columns of C in 16 vectors.
+constexpr dim_t MR = 8;
+constexpr dim_t NR = 8;
+// The blocking of C for the threads and of K for the caches.
+constexpr dim_t MC = 128;
+constexpr dim_t NC = 512;
+constexpr dim_t KC = 256;
+
+// Packs `nr` rows of `nk` values of K, the value (r, k) being at
+// src[r * rs + k * ks], in strips of R rows padded with zeros. A strip holds
+// the values of the R rows for a value of K next to each other.
+template <dim_t R>
+void pack(const float *src, dim_t rs, dim_t ks, dim_t nr, dim_t nk,
+        float *dst) {
+    for (dim_t r0 = 0; r0 < nr; r0 += R) {
+        const dim_t rows = nstl::min(R, nr - r0);
+        const float *s = src + r0 * rs;
+        for (dim_t k = 0; k < nk; k++) {
+            for (dim_t r = 0; r < rows; r++)
+                dst[r] = s[r * rs + k * ks];
+            for (dim_t r = rows; r < R; r++)
+                dst[r] = 0.f;
+            dst += R;
+        }
+    }
+}
+
+// Computes C = alpha * A * B + beta * C + bias for a strip of packed A and
+// a strip of packed B, of which `m` rows and `n` columns are stored.
+void compute_block(dim_t k, const float *ap, const float *bp, dim_t m,
+        dim_t n, float alpha, float beta, float *c, dim_t ldc,
+        const float *bias) {
+    // acc[j][i] holds the rows 4i to 4i + 3 of the column j.
+    vfloat_t acc[NR][2];
+    for (int j = 0; j < NR; j++)
+        acc[j][0] = acc[j][1] = vec_splats(0.f);
+
+    for (dim_t p = 0; p < k; p++) {
+        const vfloat_t a0 = load_f32(ap);
+        const vfloat_t a1 = load_f32(ap + vfloat_len);
+        for (int j = 0; j < NR; j++) {
+            const vfloat_t b = vec_splats(bp[j]);
+            acc[j][0] = vec_madd(a0, b, acc[j][0]);
+            acc[j][1] = vec_madd(a1, b, acc[j][1]);
+        }
+        ap += MR;
+        bp += NR;
+    }
+
+    const vfloat_t valpha = vec_splats(alpha);
+    const vfloat_t vbeta = vec_splats(beta);
+    for (dim_t j = 0; j < n; j++) {
+        float *cc = c + j * ldc;
+        for (int i = 0; i < 2; i++) {
+            const dim_t m0 = i * vfloat_len;
+            if (m0 >= m) break;
+            if (m0 + vfloat_len <= m) {
+                vfloat_t v = acc[j][i] * valpha;
+                if (beta != 0.f) v = vec_madd(load_f32(cc + m0), vbeta, v);
+                if (bias) v = v + load_f32(bias + m0);
+                store_f32(v, cc + m0);
+            } else {
+                for (dim_t ii = 0; ii < m - m0; ii++) {
+                    float v = alpha * acc[j][i][ii];
+                    if (beta != 0.f) v += beta * cc[m0 + ii];
+                    if (bias) v += bias[m0 + ii];
+                    cc[m0 + ii] = v;
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+dnnl_status_t sgemm(const char *transa, const char *transb, dim_t M, dim_t N,
+        dim_t K, float alpha, const float *A, dim_t ldA, const float *B,
+        dim_t ldB, float beta, float *C, dim_t ldC, const float *bias) {
+    if (M == 0 || N == 0) return dnnl_success;
+    if (K == 0 || alpha == 0.f) {
+        parallel_nd(N, [&](dim_t j) {
+            float *c = C + j * ldC;
+            for (dim_t i = 0; i < M; i++) {
+                c[i] = beta == 0.f ? 0.f : beta * c[i];
+                if (bias) c[i] += bias[i];
+            }
+        });
+        return dnnl_success;
+    }
+
+    const bool trA = *transa == 't' || *transa == 'T';
+    const bool trB = *transb == 't' || *transb == 'T';
+    // The strides of op(A) along M and K, and of op(B) along N and K.
+    const dim_t a_rs = trA ? ldA : 1, a_ks = trA ? 1 : ldA;
+    const dim_t b_rs = trB ? 1 : ldB, b_ks = trB ? ldB : 1;
+
+    const int nthr_max = dnnl_get_current_num_threads();
+    const dim_t mc = nstl::min(MC, utils::rnd_up(M, MR));
+    const dim_t m_blocks = utils::div_up(M, mc);
+    dim_t nc = nstl::min(NC, utils::rnd_up(N, NR));
+    // Splits N finer when the blocks of M do not keep all the threads busy.
+    if (m_blocks * utils::div_up(N, nc) < nthr_max) {
+        const dim_t n_blocks = utils::div_up(nthr_max, m_blocks);
+        nc = nstl::max(NR, utils::rnd_up(utils::div_up(N, n_blocks), NR));
+    }
+    const dim_t n_blocks = utils::div_up(N, nc);
+    const dim_t nblocks = m_blocks * n_blocks;
+    const int nthr_gemm = (int)nstl::min<dim_t>(nthr_max, nblocks);
+
+    const dim_t kc = nstl::min(KC, K);
+    const dim_t a_size = mc * kc;
+    const dim_t b_size = nc * kc;
+    float *buf = (float *)malloc(
+            sizeof(float) * nthr_gemm * (a_size + b_size), 4096);
+    if (utils::any_null(buf)) return dnnl_out_of_memory;
+
+    parallel(nthr_gemm, [&](int ithr, int nthr) {
+        float *ap = buf + ithr * (a_size + b_size);
+        float *bp = ap + a_size;
+
+        dim_t start = 0, end = 0;
+        balance211(nblocks, nthr, ithr, start, end);
+        for (dim_t blk = start; blk < end; blk++) {
+            const dim_t m0 = (blk % m_blocks) * mc;
+            const dim_t n0 = (blk / m_blocks) * nc;
+            const dim_t m_cur = nstl::min(mc, M - m0);
+            const dim_t n_cur = nstl::min(nc, N - n0);
+            for (dim_t k0 = 0; k0 < K; k0 += kc) {
+                const dim_t k_cur = nstl::min(kc, K - k0);
+                pack<MR>(A + m0 * a_rs + k0 * a_ks, a_rs, a_ks, m_cur, k_cur,
+                        ap);
+                pack<NR>(B + n0 * b_rs + k0 * b_ks, b_rs, b_ks, n_cur, k_cur,
+                        bp);
+                // The blocks of K after the first one accumulate to C.
+                const float beta_k = k0 == 0 ? beta : 1.f;
+                const float *bias_k = k0 == 0 ? bias : nullptr;
+                for (dim_t n = 0; n < n_cur; n += NR)
+                    for (dim_t m = 0; m < m_cur; m += MR)
+                        compute_block(k_cur, ap + m * k_cur, bp + n * k_cur,
+                                nstl::min(MR, m_cur - m),
+                                nstl::min(NR, n_cur - n), alpha, beta_k,
+                                C + (n0 + n) * ldC + m0 + m, ldC,
+                                bias_k ? bias_k + m0 + m : nullptr);
+            }
+        }
+    });
+
+    free(buf);
+    return dnnl_success;
+}
+
+} // namespace s390x
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // DNNL_S390X_VXE
@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2025 IBM Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/s390x/vx_f32.hpp"
+
+#if DNNL_S390X_VXE
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/s390x/vx_eltwise.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace s390x {
+
+namespace {
+inline vfloat_t hardsigmoid(vfloat_t x, float alpha, float beta) {
+    const vfloat_t v = vec_madd(x, vec_splats(alpha), vec_splats(beta));
+    return vec_min(vec_max(v, vec_splats(0.f)), vec_splats(1.f));
+}
+
+inline vfloat_t compute_eltwise(
+        alg_kind_t alg, float alpha, float beta, vfloat_t x) {
+    using namespace alg_kind;
+    const vfloat_t zero = vec_splats(0.f);
+    const vfloat_t one = vec_splats(1.f);
+    switch (alg) {
+        case eltwise_relu:
+            if (alpha == 0.f) return vec_max(x, zero);
+            return vec_sel(x * vec_splats(alpha), x, vec_cmpgt(x, zero));
+        case eltwise_linear:
+            return vec_madd(x, vec_splats(alpha), vec_splats(beta));
+        case eltwise_abs: return vec_abs(x);
+        case eltwise_square: return x * x;
+        case eltwise_sqrt: return vec_sqrt(x);
+        case eltwise_clip:
+        case eltwise_clip_v2:
+            return vec_min(vec_max(x, vec_splats(alpha)), vec_splats(beta));
+        case eltwise_hardsigmoid: return hardsigmoid(x, alpha, beta);
+        case eltwise_hardswish: return x * hardsigmoid(x, alpha, beta);
+        case eltwise_exp: return exp_ps(x);
+        case eltwise_logistic: return one / (one + exp_ps(zero - x));
+        case eltwise_tanh: {
+            // tanh(x) = 1 - 2 / (exp(2x) + 1), where the saturation of the
+            // exponent gives +-1 for large |x|.
+            const vfloat_t e = exp_ps(x + x);
+            return one - vec_splats(2.f) / (e + one);
+        }
+        default: assert(!"unsupported alg_kind"); return x;
+    }
+}
+} // namespace
+
+status_t vx_eltwise_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const dim_t nelems = src_d.nelems();
+    const alg_kind_t alg = pd()->desc()->alg_kind;
+    const float alpha = pd()->desc()->alpha;
+    const float beta = pd()->desc()->beta;
+
+    src += src_d.offset0();
+    dst += src_d.offset0();
+
+    // The threads split whole vectors, so that only the last one has a tail.
+    const dim_t nvecs = utils::div_up(nelems, vfloat_len);
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(nvecs, nthr, ithr, start, end);
+        const dim_t e_start = start * vfloat_len;
+        const dim_t e_end = nstl::min(end * vfloat_len, nelems);
+        dim_t i = e_start;
+        for (; i + vfloat_len <= e_end; i += vfloat_len)
+            store_f32(compute_eltwise(alg, alpha, beta, load_f32(src + i)),
+                    dst + i);
+        if (i < e_end) {
+            float tail[vfloat_len] = {};
+            for (dim_t j = i; j < e_end; j++)
+                tail[j - i] = src[j];
+            store_f32(compute_eltwise(alg, alpha, beta, load_f32(tail)), tail);
+            for (dim_t j = i; j < e_end; j++)
+                dst[j] = tail[j - i];
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace s390x
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // DNNL_S390X_VXE
@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2025 IBM Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_S390X_VX_ELTWISE_HPP
+#define CPU_S390X_VX_ELTWISE_HPP
+
+#include "common/primitive.hpp"
+#include "cpu/cpu_eltwise_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace s390x {
+
+// Forward f32 eltwise over dense tensors with the vector facility.
+struct vx_eltwise_fwd_t : public primitive_t {
+    struct pd_t : public cpu_eltwise_fwd_pd_t {
+        using cpu_eltwise_fwd_pd_t::cpu_eltwise_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("s390x:vx", vx_eltwise_fwd_t)
+
+        status_t init(engine_t *engine) {
+            UNUSED(engine);
+
+            const memory_desc_wrapper src_d(src_md());
+            const memory_desc_wrapper dst_d(dst_md());
+
+            VDISPATCH_ELTWISE(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_ELTWISE(utils::everyone_is(data_type::f32,
+                                      src_md()->data_type, dst_md()->data_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_ELTWISE(alg_ok(desc()->alg_kind), VERBOSE_BAD_ALGORITHM);
+            VDISPATCH_ELTWISE(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_ELTWISE(
+                    set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_ELTWISE(
+                    src_d == dst_d, VERBOSE_INCONSISTENT_MDS, "src", "dst");
+            VDISPATCH_ELTWISE(src_d.is_dense(), VERBOSE_UNSUPPORTED_TAG);
+
+            return status::success;
+        }
+
+        static bool alg_ok(alg_kind_t alg) {
+            using namespace alg_kind;
+            return utils::one_of(alg, eltwise_relu, eltwise_linear,
+                    eltwise_abs, eltwise_square, eltwise_sqrt, eltwise_clip,
+                    eltwise_clip_v2, eltwise_hardsigmoid, eltwise_hardswish,
+                    eltwise_exp, eltwise_logistic, eltwise_tanh);
+        }
+    };
+
+    vx_eltwise_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace s390x
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_S390X_VX_ELTWISE_HPP
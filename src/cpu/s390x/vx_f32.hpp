@@ -0,0 +1,73 @@
+/*******************************************************************************
+* Copyright 2025 IBM Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_S390X_VX_F32_HPP
+#define CPU_S390X_VX_F32_HPP
+
+#include "cpu/platform.hpp"
+
+#if DNNL_S390X_VXE
+#include <vecintrin.h>
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace s390x {
+
+typedef __vector float vfloat_t;
+typedef __vector unsigned int vuint_t;
+
+// The number of f32 values of a vector register.
+constexpr int vfloat_len = 4;
+
+inline vfloat_t load_f32(const float *p) {
+    return vec_xl(0, p);
+}
+
+inline void store_f32(vfloat_t v, float *p) {
+    vec_xst(v, 0, p);
+}
+
+// Computes exp(x) as 2^n * exp(r), where x = n * ln2 + r, |r| <= ln2 / 2,
+// and exp(r) is approximated by a polynomial. n is rounded by adding a
+// shifter, which also leaves its value in the low bits of the sum, so that
+// the exponent of 2^n is built without the conversions of z15.
+inline vfloat_t exp_ps(vfloat_t x) {
+    x = vec_min(vec_max(x, vec_splats(-87.f)), vec_splats(88.f));
+    // 1.5 * 2^23, so that the low bits of t hold 2^22 + n.
+    const vfloat_t shifter = vec_splats(12582912.f);
+    const vfloat_t t = vec_madd(x, vec_splats(1.44269504f), shifter);
+    const vfloat_t n = t - shifter;
+    const vfloat_t r = vec_nmsub(n, vec_splats(0.693147181f), x);
+
+    vfloat_t p = vec_splats(1.f / 120);
+    p = vec_madd(p, r, vec_splats(1.f / 24));
+    p = vec_madd(p, r, vec_splats(1.f / 6));
+    p = vec_madd(p, r, vec_splats(0.5f));
+    p = vec_madd(p, r, vec_splats(1.f));
+    p = vec_madd(p, r, vec_splats(1.f));
+
+    const vuint_t pow2n = ((vuint_t)t + vec_splats(127u)) << 23;
+    return p * (vfloat_t)pow2n;
+}
+
+} // namespace s390x
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // DNNL_S390X_VXE
+
+#endif // CPU_S390X_VX_F32_HPP
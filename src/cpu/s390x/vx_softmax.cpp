@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2025 IBM Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/s390x/vx_f32.hpp"
+
+#if DNNL_S390X_VXE
+
+#include <cmath>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/s390x/vx_softmax.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace s390x {
+
+status_t vx_softmax_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const dim_t outer_size = pd()->outer_size();
+    const dim_t axis_size = pd()->axis_size();
+    const dim_t axis_vec = utils::rnd_dn(axis_size, vfloat_len);
+    const bool is_log = pd()->is_logsoftmax();
+
+    src += src_d.offset0();
+    dst += dst_d.offset0();
+
+    parallel_nd(outer_size, [&](dim_t ou) {
+        const float *s = src + ou * axis_size;
+        float *d = dst + ou * axis_size;
+
+        vfloat_t vmax = vec_splats(-INFINITY);
+        for (dim_t i = 0; i < axis_vec; i += vfloat_len)
+            vmax = vec_max(vmax, load_f32(s + i));
+        float max = nstl::max(
+                nstl::max(vmax[0], vmax[1]), nstl::max(vmax[2], vmax[3]));
+        for (dim_t i = axis_vec; i < axis_size; i++)
+            max = nstl::max(max, s[i]);
+
+        // The exponents are stored for the plain softmax only, since the
+        // logarithmic one is computed from the source again.
+        const vfloat_t vmax_s = vec_splats(max);
+        vfloat_t vsum = vec_splats(0.f);
+        for (dim_t i = 0; i < axis_vec; i += vfloat_len) {
+            const vfloat_t e = exp_ps(load_f32(s + i) - vmax_s);
+            if (!is_log) store_f32(e, d + i);
+            vsum = vsum + e;
+        }
+        float sum = (vsum[0] + vsum[1]) + (vsum[2] + vsum[3]);
+        for (dim_t i = axis_vec; i < axis_size; i++) {
+            const float e = ::expf(s[i] - max);
+            if (!is_log) d[i] = e;
+            sum += e;
+        }
+
+        if (is_log) {
+            const float shift = max + ::logf(sum);
+            const vfloat_t vshift = vec_splats(shift);
+            for (dim_t i = 0; i < axis_vec; i += vfloat_len)
+                store_f32(load_f32(s + i) - vshift, d + i);
+            for (dim_t i = axis_vec; i < axis_size; i++)
+                d[i] = s[i] - shift;
+        } else {
+            const float inv_sum = 1.f / sum;
+            const vfloat_t vinv_sum = vec_splats(inv_sum);
+            for (dim_t i = 0; i < axis_vec; i += vfloat_len)
+                store_f32(load_f32(d + i) * vinv_sum, d + i);
+            for (dim_t i = axis_vec; i < axis_size; i++)
+                d[i] *= inv_sum;
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace s390x
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // DNNL_S390X_VXE
@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2025 IBM Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_S390X_VX_SOFTMAX_HPP
+#define CPU_S390X_VX_SOFTMAX_HPP
+
+#include "common/primitive.hpp"
+#include "cpu/cpu_softmax_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace s390x {
+
+// Forward f32 softmax with the vector facility, for a dense innermost axis.
+struct vx_softmax_fwd_t : public primitive_t {
+    struct pd_t : public cpu_softmax_fwd_pd_t {
+        using cpu_softmax_fwd_pd_t::cpu_softmax_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("s390x:vx", vx_softmax_fwd_t)
+
+        status_t init(engine_t *engine) {
+            UNUSED(engine);
+
+            VDISPATCH_SOFTMAX(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_SOFTMAX(utils::everyone_is(data_type::f32,
+                                      src_md()->data_type, dst_md()->data_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SOFTMAX(utils::one_of(alg_kind(),
+                                      alg_kind::softmax_accurate,
+                                      alg_kind::softmax_log),
+                    VERBOSE_BAD_ALGORITHM);
+            VDISPATCH_SOFTMAX(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_SOFTMAX(set_default_formats() == status::success,
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            const memory_desc_wrapper src_d(src_md());
+            const memory_desc_wrapper dst_d(dst_md());
+            VDISPATCH_SOFTMAX(
+                    src_d == dst_d, VERBOSE_INCONSISTENT_MDS, "src", "dst");
+            VDISPATCH_SOFTMAX(src_d.is_dense(true), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SOFTMAX(inner_size() == 1 && axis_stride() == 1
+                            && axis_size(true) == axis_size(),
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            return status::success;
+        }
+    };
+
+    vx_softmax_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace s390x
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_S390X_VX_SOFTMAX_HPP
@@ -0,0 +1,157 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/tag_traits.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/arg_reduction_utils.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/simple_arg_reduction.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace memory_tracking::names;
+
+status_t simple_arg_reduction_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    const auto src_dt = src_md()->data_type;
+    VDISPATCH_REDUCTION(is_arg_reduction(), VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_REDUCTION(utils::one_of(src_dt, f32, bf16, f16, s32, s8, u8),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_REDUCTION(
+            platform::has_data_type_support(src_dt), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_REDUCTION(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_REDUCTION(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+
+    const int ndims = src_md()->ndims;
+    const auto tag = get_abx_tag(ndims);
+    VDISPATCH_REDUCTION(memory_desc_matches_tag(*src_md(), tag)
+                    && memory_desc_matches_tag(*dst_md(), tag),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    // The reduced dimensions are the innermost ones, so that a row of the
+    // source is contiguous.
+    const auto &src_dims = src_md()->dims;
+    const auto &dst_dims = dst_md()->dims;
+    int d = ndims - 1;
+    reduce_size_ = 1;
+    for (; d >= 0 && src_dims[d] != dst_dims[d]; --d) {
+        reduce_size_ *= src_dims[d];
+        if (dst_dims[d] > 1) k_ = dst_dims[d];
+    }
+    idle_size_ = 1;
+    for (; d >= 0; --d) {
+        VDISPATCH_REDUCTION(src_dims[d] == dst_dims[d],
+                VERBOSE_UNSUPPORTED_FEATURE, "non-innermost reduced dims");
+        idle_size_ *= src_dims[d];
+    }
+
+    // A row is split into chunks only when there are fewer rows than threads.
+    // Chunks hold a few pages of data and at least `k` values.
+    const dim_t nthr = dnnl_get_max_threads();
+    const dim_t min_chunk_size = nstl::max<dim_t>(k_, 4096);
+    nchunks_ = nstl::max<dim_t>(1,
+            nstl::min(utils::div_up(nthr, idle_size_),
+                    reduce_size_ / min_chunk_size));
+    chunk_size_ = utils::div_up(reduce_size_, nchunks_);
+    nchunks_ = utils::div_up(reduce_size_, chunk_size_);
+
+    init_scratchpad();
+    return status::success;
+}
+
+void simple_arg_reduction_t::pd_t::init_scratchpad() {
+    if (nchunks_ == 1) return;
+    auto scratchpad = scratchpad_registry().registrar();
+    const dim_t nelems = idle_size_ * nchunks_ * k_;
+    scratchpad.template book<float>(key_reduction, nelems);
+    scratchpad.template book<int32_t>(key_reduction_1, nelems);
+}
+
+status_t simple_arg_reduction_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(int32_t *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto src_dt = src_d.data_type();
+    const bool is_min = pd()->desc()->alg_kind == alg_kind::reduction_arg_min;
+    dst += dst_d.offset0();
+
+    const dim_t idle_size = pd()->idle_size_;
+    const dim_t reduce_size = pd()->reduce_size_;
+    const dim_t k = pd()->k_;
+    const dim_t nchunks = pd()->nchunks_;
+    const dim_t chunk_size = pd()->chunk_size_;
+    const auto chunk_len = [&](dim_t c) {
+        return nstl::min(chunk_size, reduce_size - c * chunk_size);
+    };
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *sp_vals = scratchpad.template get<float>(key_reduction);
+    int32_t *sp_idx = scratchpad.template get<int32_t>(key_reduction_1);
+
+    parallel_nd(idle_size, nchunks, [&](dim_t row, dim_t c) {
+        const dim_t start = c * chunk_size;
+        const dim_t len = chunk_len(c);
+        const dim_t src_off = src_d.offset0() + row * reduce_size + start;
+
+        arg_reduction_utils::top_k_t top_k(k);
+        constexpr dim_t block_size = arg_reduction_utils::block_size;
+        float vals[block_size];
+        for (dim_t b = 0; b < len; b += block_size) {
+            const dim_t blen = nstl::min(block_size, len - b);
+            arg_reduction_utils::load_values(
+                    vals, src, src_dt, src_off + b, blen, is_min);
+            top_k.push_block(vals, blen, start + b);
+        }
+
+        if (nchunks == 1) {
+            top_k.get_indices(dst + row * k);
+        } else {
+            const dim_t off = (row * nchunks + c) * k;
+            top_k.get(sp_vals + off, sp_idx + off);
+        }
+    });
+
+    if (nchunks == 1) return status::success;
+
+    // Merge the best values of the chunks of a row.
+    parallel_nd(idle_size, [&](dim_t row) {
+        arg_reduction_utils::top_k_t top_k(k);
+        for (dim_t c = 0; c < nchunks; c++) {
+            const dim_t off = (row * nchunks + c) * k;
+            const dim_t n = nstl::min(k, chunk_len(c));
+            for (dim_t i = 0; i < n; i++)
+                top_k.push(sp_vals[off + i], sp_idx[off + i]);
+        }
+        top_k.get_indices(dst + row * k);
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_ARG_REDUCTION_HPP
+#define CPU_SIMPLE_ARG_REDUCTION_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_reduction_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Arg max/min and top-k over the innermost dimensions of a plain tensor. Each
+// row of the source is split into chunks so that a few long rows, e.g. the
+// logits of a language model, still use all the threads. Every chunk keeps
+// its own `k` best values, and the chunks of a row are merged at the end.
+struct simple_arg_reduction_t : public primitive_t {
+    struct pd_t : public cpu_reduction_pd_t {
+        using cpu_reduction_pd_t::cpu_reduction_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_arg_reduction_t);
+
+        status_t init(engine_t *engine);
+
+        // The number of rows, their size and the number of kept indices.
+        dim_t idle_size_ = 0;
+        dim_t reduce_size_ = 0;
+        dim_t k_ = 1;
+        // The number of chunks per row and their size.
+        dim_t nchunks_ = 1;
+        dim_t chunk_size_ = 0;
+
+    private:
+        void init_scratchpad();
+    };
+
+    simple_arg_reduction_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -44,7 +44,9 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
         const memory_desc_wrapper i_d(pd()->src_md(a));
         const memory_desc_wrapper o_d(pd()->src_image_md(a));
         const auto iptr = CTX_IN_MEM(const data_t *, DNNL_ARG_MULTIPLE_SRC + a);
-        if (iptr == nullptr) {
+        // A source written in place by its producer is skipped the same way
+        // as an empty one.
+        if (iptr == nullptr || pd()->src_is_dst_view(ctx, a)) {
             iptrs[a] = nullptr;
             nelems_to_copy[a] = 0;
             continue;
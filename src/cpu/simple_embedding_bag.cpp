@@ -0,0 +1,244 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+
+#include "common/bfloat16.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/arg_reduction_utils.hpp"
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/simple_embedding_bag.hpp"
+
+#define VCHECK_EB_EXEC(cond, msg, ...) \
+    VCONDCHECK(primitive, exec, check, embedding_bag, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+// The block of the embedding dimension pooled at once.
+constexpr dim_t dim_block = 256;
+// The number of indices between a row being pooled and a row prefetched.
+constexpr dim_t prefetch_distance = 8;
+constexpr dim_t cache_line_size = 64;
+
+inline void prefetch(const void *p) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p, 0, 3);
+#else
+    UNUSED(p);
+#endif
+}
+} // namespace
+
+status_t simple_embedding_bag_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using sm = primitive_attr_t::skip_mask_t;
+
+    const auto src_dt = src_md(0)->data_type;
+    const auto dst_dt = dst_md(0)->data_type;
+    VDISPATCH_EMBEDDING_BAG(utils::one_of(src_dt, f32, bf16, f16, s8, u8),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_EMBEDDING_BAG(
+            utils::one_of(dst_dt, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_EMBEDDING_BAG(platform::has_data_type_support(src_dt)
+                    && platform::has_data_type_support(dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_EMBEDDING_BAG(
+            attr()->has_default_values(sm::scales), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_EMBEDDING_BAG(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+
+    VDISPATCH_EMBEDDING_BAG(memory_desc_matches_tag(*src_md(0), format_tag::ab)
+                    && memory_desc_matches_tag(*dst_md(0), format_tag::ab),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_EMBEDDING_BAG(memory_desc_matches_tag(*src_md(1), format_tag::a)
+                    && memory_desc_matches_tag(*src_md(2), format_tag::a)
+                    && IMPLICATION(with_weights(),
+                            memory_desc_matches_tag(
+                                    *weights_md(0), format_tag::a)),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    return status::success;
+}
+
+status_t simple_embedding_bag_t::execute(const exec_ctx_t &ctx) const {
+    using namespace data_type;
+
+    status_t status = status::success;
+    auto table = CTX_IN_MEM(const void *, DNNL_ARG_SRC_0);
+    auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_1);
+    auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_2);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    const auto &scales = pd()->attr()->scales_;
+    const bool per_row_scales = !scales.has_default_values(DNNL_ARG_SRC)
+            && scales.get_mask(DNNL_ARG_SRC) != 0;
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const auto src_dt = src_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    const size_t src_dt_size = src_d.data_type_size();
+    const dim_t src_off0 = src_d.offset0();
+    const dim_t dst_off0 = dst_d.offset0();
+
+    indices += memory_desc_wrapper(pd()->src_md(1)).offset0();
+    offsets += memory_desc_wrapper(pd()->src_md(2)).offset0();
+    if (weights) weights += memory_desc_wrapper(pd()->weights_md(0)).offset0();
+
+    const dim_t num_rows = pd()->num_rows();
+    const dim_t emb_dim = pd()->emb_dim();
+    const dim_t nnz = pd()->nnz();
+    const dim_t num_bags = pd()->num_bags();
+    const auto alg = pd()->desc()->alg_kind;
+    const bool is_max = alg == alg_kind::reduction_max;
+    const bool is_mean = alg == alg_kind::reduction_mean;
+
+    const auto bag_begin = [&](dim_t b) { return (dim_t)offsets[b]; };
+    const auto bag_end = [&](dim_t b) {
+        return b + 1 < num_bags ? (dim_t)offsets[b + 1] : nnz;
+    };
+    for (dim_t b = 0; b < num_bags; b++)
+        VCHECK_EB_EXEC(0 <= bag_begin(b) && bag_begin(b) <= bag_end(b)
+                        && bag_end(b) <= nnz,
+                VERBOSE_BAD_PARAM, "offsets");
+
+    // A bag costs its rows and one more for its destination row, so that the
+    // empty bags are split between the threads as well. The costs of the bags
+    // before a bag only grow with it.
+    const dim_t off0 = num_bags > 0 ? bag_begin(0) : 0;
+    const auto cost_before = [&](dim_t b) {
+        return (b < num_bags ? bag_begin(b) : nnz) - off0 + b;
+    };
+    const dim_t total_cost = cost_before(num_bags);
+    // Returns the first bag with at least `c` of cost before it.
+    const auto find_bag = [&](dim_t c) {
+        dim_t lo = 0, hi = num_bags;
+        while (lo < hi) {
+            const dim_t mid = lo + (hi - lo) / 2;
+            if (cost_before(mid) < c)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    };
+
+    std::atomic<bool> bad_index(false);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        const dim_t b_start = find_bag(total_cost * ithr / nthr);
+        const dim_t b_end = find_bag(total_cost * (ithr + 1) / nthr);
+
+        float acc[dim_block];
+        float vals[dim_block];
+        for (dim_t b = b_start; b < b_end; b++) {
+            const dim_t start = bag_begin(b);
+            const dim_t end = bag_end(b);
+            for (dim_t d0 = 0; d0 < emb_dim; d0 += dim_block) {
+                const dim_t len = nstl::min(dim_block, emb_dim - d0);
+                const float init = is_max && end > start
+                        ? -nstl::numeric_limits<float>::max()
+                        : 0.f;
+                utils::array_set(acc, init, len);
+
+                for (dim_t j = start; j < end; j++) {
+                    if (j + prefetch_distance < end) {
+                        const dim_t pf_row = indices[j + prefetch_distance];
+                        if (0 <= pf_row && pf_row < num_rows) {
+                            const char *p = static_cast<const char *>(table)
+                                    + (src_off0 + pf_row * emb_dim + d0)
+                                            * src_dt_size;
+                            const dim_t nbytes = len * src_dt_size;
+                            for (dim_t o = 0; o < nbytes; o += cache_line_size)
+                                prefetch(p + o);
+                        }
+                    }
+
+                    const dim_t row = indices[j];
+                    if (row < 0 || row >= num_rows) {
+                        bad_index = true;
+                        continue;
+                    }
+
+                    const float w = src_scales[per_row_scales ? row : 0]
+                            * (weights ? weights[j] : 1.f);
+                    const dim_t off = src_off0 + row * emb_dim + d0;
+                    const float *v = vals;
+                    if (src_dt == f32)
+                        v = static_cast<const float *>(table) + off;
+                    else
+                        arg_reduction_utils::load_values(
+                                vals, table, src_dt, off, len, false);
+
+                    if (is_max) {
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t i = 0; i < len; i++)
+                            acc[i] = nstl::max(acc[i], w * v[i]);
+                    } else {
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t i = 0; i < len; i++)
+                            acc[i] += w * v[i];
+                    }
+                }
+
+                if (is_mean && end > start) {
+                    const float inv_n = 1.f / (end - start);
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t i = 0; i < len; i++)
+                        acc[i] *= inv_n;
+                }
+
+                const dim_t dst_off = dst_off0 + b * emb_dim + d0;
+                switch (dst_dt) {
+                    case f32:
+                        utils::array_copy(
+                                static_cast<float *>(dst) + dst_off, acc, len);
+                        break;
+                    case bf16:
+                        cvt_float_to_bfloat16(
+                                static_cast<bfloat16_t *>(dst) + dst_off, acc,
+                                len);
+                        break;
+                    case f16:
+                        cvt_float_to_float16(
+                                static_cast<float16_t *>(dst) + dst_off, acc,
+                                len);
+                        break;
+                    default: assert(!"unsupported data type");
+                }
+            }
+        }
+    });
+
+    VCHECK_EB_EXEC(!bad_index, VERBOSE_BAD_PARAM, "indices");
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
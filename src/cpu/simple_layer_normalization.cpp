@@ -41,6 +41,8 @@ status_t simple_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
 
     VDISPATCH_LNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
     VDISPATCH_LNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_LNORM(!fuse_add_norm(), VERBOSE_UNSUPPORTED_FEATURE,
+            "fused residual addition");
     VDISPATCH_LNORM(utils::one_of(src_md()->data_type, f32, bf16, f16, s8, u8),
             VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_LNORM(utils::one_of(dst_md()->data_type, f32, bf16, f16, s8, u8),
@@ -52,8 +54,9 @@ status_t simple_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
     VDISPATCH_LNORM(stat_md()->data_type == f32, VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_LNORM(check_scale_shift_data_type(), VERBOSE_UNSUPPORTED_FEATURE,
             "unsupported scale or shift data type");
-    VDISPATCH_LNORM(attr()->has_default_values(
-                            skip_mask_t::scales | skip_mask_t::post_ops),
+    VDISPATCH_LNORM(attr()->has_default_values(skip_mask_t::scales
+                            | skip_mask_t::post_ops
+                            | skip_mask_t::dynamic_quantization),
             VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_LNORM(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
     VDISPATCH_LNORM(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
@@ -77,6 +80,7 @@ status_t simple_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
     bool ok = attr_.set_default_formats(dst_md(0)) == status::success;
     VDISPATCH_LNORM(ok, VERBOSE_UNSUPPORTED_POSTOP);
 
+    nthr_ = dnnl_get_max_threads();
     init_scratchpad();
     return status::success;
 }
@@ -114,13 +118,23 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
     const float *dst_scales
             = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
 
+    // With dynamic quantization, the destination scales are computed, one
+    // per row, instead of being read.
+    const bool dynamic_quantization = pd()->attr()->dynamic_quantization_;
+    float *row_scales = dynamic_quantization
+            ? CTX_OUT_MEM(float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST)
+            : nullptr;
+    float *tmp_dst = dynamic_quantization
+            ? scratchpad.template get<float>(key_lnorm_tmp_dst)
+            : nullptr;
+
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
 
     const bool with_src_scales
             = !pd()->attr()->scales_.has_default_values(DNNL_ARG_SRC);
-    const bool with_dst_scales
-            = !pd()->attr()->scales_.has_default_values(DNNL_ARG_DST);
+    const bool with_dst_scales = !dynamic_quantization
+            && !pd()->attr()->scales_.has_default_values(DNNL_ARG_DST);
 
     const dim_t N = pd()->across_axis();
     const dim_t C = pd()->norm_axis();
@@ -130,10 +144,13 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
     const auto calculate_stats = !pd()->stats_are_src();
     const auto src_dt = pd()->src_md()->data_type;
     const auto dst_dt = pd()->dst_md()->data_type;
+    // A row is normalized into the buffer of the thread when it is quantized
+    // dynamically, so that it is read from cache to find its scale.
+    const auto out_dt = dynamic_quantization ? f32 : dst_dt;
     const auto eps = pd()->desc()->layer_norm_epsilon;
     const auto save_stats = pd()->is_training();
 
-    parallel(0, [&](const int ithr, const int nthr) {
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
         dim_t N_start = 0, N_end = 0;
         balance211(N, nthr, ithr, N_start, N_end);
         const char *const __restrict src_ptr
@@ -143,6 +160,8 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                 + N_start * C_padded * dst_d.data_type_size();
         float *const __restrict mean_ptr = skip_mean ? nullptr : &mean[N_start];
         float *const __restrict var_ptr = &variance[N_start];
+        float *const __restrict tmp_ptr
+                = dynamic_quantization ? &tmp_dst[ithr * C] : nullptr;
         const size_t block_size = N_end - N_start;
         // Note: manual unrolling for scale and shift due to clang issue.
         //       see: CLANG_WA_01_SAFE_TO_USE_OMP_SIMD
@@ -173,6 +192,9 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
             }
 
             const float inv_sqrtvar = 1.f / sqrtf(v_variance + eps);
+            char *const __restrict out_ptr = dynamic_quantization
+                    ? reinterpret_cast<char *>(tmp_ptr)
+                    : dst_ptr + C * offset * dst_d.data_type_size();
             if (use_scale && use_shift) {
                 PRAGMA_OMP_SIMD()
                 for (dim_t c = 0; c < C; ++c) {
@@ -188,7 +210,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                     args.dst_md = pd()->dst_md();
                     ref_post_ops->execute(d, args);
                     if (with_dst_scales) d /= dst_scales[0];
-                    io::store_float_value(dst_dt, d, dst_ptr, off);
+                    io::store_float_value(out_dt, d, out_ptr, c);
                 }
             } else if (use_scale) {
                 PRAGMA_OMP_SIMD()
@@ -204,7 +226,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                     args.dst_md = pd()->dst_md();
                     ref_post_ops->execute(d, args);
                     if (with_dst_scales) d /= dst_scales[0];
-                    io::store_float_value(dst_dt, d, dst_ptr, off);
+                    io::store_float_value(out_dt, d, out_ptr, c);
                 }
             } else if (use_shift) {
                 PRAGMA_OMP_SIMD()
@@ -221,7 +243,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                     args.dst_md = pd()->dst_md();
                     ref_post_ops->execute(d, args);
                     if (with_dst_scales) d /= dst_scales[0];
-                    io::store_float_value(dst_dt, d, dst_ptr, off);
+                    io::store_float_value(out_dt, d, out_ptr, c);
                 }
             } else {
                 PRAGMA_OMP_SIMD()
@@ -237,7 +259,24 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                     args.dst_md = pd()->dst_md();
                     ref_post_ops->execute(d, args);
                     if (with_dst_scales) d /= dst_scales[0];
-                    io::store_float_value(dst_dt, d, dst_ptr, off);
+                    io::store_float_value(out_dt, d, out_ptr, c);
+                }
+            }
+            if (dynamic_quantization) {
+                // The largest absolute value of the row is mapped to the
+                // largest value of the destination data type.
+                float amax = 0.f;
+                PRAGMA_OMP_SIMD(reduction(max : amax))
+                for (dim_t c = 0; c < C; ++c)
+                    amax = nstl::max(amax, fabsf(tmp_ptr[c]));
+                const float row_scale = amax > 0.f ? amax / 127.f : 1.f;
+                row_scales[N_start + offset] = row_scale;
+                char *const __restrict row_dst_ptr
+                        = dst_ptr + C * offset * dst_d.data_type_size();
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < C; ++c) {
+                    io::store_float_value(
+                            dst_dt, tmp_ptr[c] / row_scale, row_dst_ptr, c);
                 }
             }
             if (calculate_stats && save_stats) {
@@ -254,6 +293,8 @@ status_t simple_layer_normalization_bwd_t::pd_t::init(engine_t *engine) {
     const memory_desc_wrapper src_d(src_md());
 
     VDISPATCH_LNORM(!is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_LNORM(!fuse_add_norm(), VERBOSE_UNSUPPORTED_FEATURE,
+            "fused residual addition");
     VDISPATCH_LNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
     VDISPATCH_LNORM(utils::one_of(src_md()->data_type, f32, bf16, f16),
             VERBOSE_UNSUPPORTED_DT);
@@ -48,11 +48,18 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
 
         std::shared_ptr<primitive_desc_t> reorder_pd_;
         memory_desc_t reordered_stat_md_;
+        int nthr_; // To not exceed the limit in execute used for set up.
 
     private:
         void init_scratchpad() {
             using namespace memory_tracking::names;
             auto scratchpad = scratchpad_registry().registrar();
+            // With dynamic quantization, every thread normalizes a row into
+            // a buffer before the row is quantized.
+            if (attr()->dynamic_quantization_) {
+                scratchpad.template book<float>(
+                        key_lnorm_tmp_dst, norm_axis() * nthr_);
+            }
             if (use_tmp_stats()) {
                 if (!skip_mean()) {
                     scratchpad.template book<float>(
@@ -0,0 +1,146 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/bfloat16.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+
+#include "cpu/simple_tree_sum.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+inline void prefetch(const void *p) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p, 0, 3);
+#else
+    UNUSED(p);
+#endif
+}
+} // namespace
+
+template <data_type_t src_data_type, data_type_t dst_data_type>
+void simple_tree_sum_t<src_data_type, dst_data_type>::sum_leaf(
+        const block_ctx_t &b, acc_data_t *acc, int a0, int a1) const {
+    const src_data_t *const *srcs = b.srcs;
+    const float *scales = b.scales;
+    // The sources of the next leaf are read right after this one, at the
+    // same offsets, so their lines are prefetched along the way.
+    const int p0 = a1, p1 = nstl::min(a1 + (int)leaf_size, b.nsrcs);
+    const dim_t line = platform::get_cache_line_size()
+            / (dim_t)sizeof(src_data_t);
+
+    for (dim_t c = 0; c < b.len; c += line) {
+        const dim_t c_end = nstl::min(c + line, b.len);
+        for (int a = p0; a < p1; a++)
+            prefetch(&srcs[a][b.off + c]);
+
+        PRAGMA_OMP_SIMD()
+        for (dim_t e = c; e < c_end; e++) {
+            acc_data_t s = 0;
+            for (int a = a0; a < a1; a++)
+                s += scales[a] * (acc_data_t)srcs[a][b.off + e];
+            acc[e] = s;
+        }
+    }
+}
+
+template <data_type_t src_data_type, data_type_t dst_data_type>
+void simple_tree_sum_t<src_data_type, dst_data_type>::sum_tree(
+        const block_ctx_t &b, acc_data_t *acc, int a0, int a1,
+        int level) const {
+    if (a1 - a0 <= leaf_size) {
+        sum_leaf(b, acc, a0, a1);
+        return;
+    }
+
+    const int mid = split(a0, a1);
+    acc_data_t *right = &b.bufs[level * pd()->block_size_];
+    sum_tree(b, acc, a0, mid, level + 1);
+    sum_tree(b, right, mid, a1, level + 1);
+    PRAGMA_OMP_SIMD()
+    for (dim_t e = 0; e < b.len; e++)
+        acc[e] += right[e];
+}
+
+template <data_type_t src_data_type, data_type_t dst_data_type>
+status_t simple_tree_sum_t<src_data_type, dst_data_type>::execute(
+        const exec_ctx_t &ctx) const {
+    auto output = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper o_d(pd()->dst_md());
+    output += o_d.blk_off(0);
+    const int num_arrs = pd()->n_inputs();
+    std::vector<const src_data_t *> input_ptrs(num_arrs);
+
+    for (int a = 0; a < num_arrs; ++a) {
+        const memory_desc_wrapper i_d(pd()->src_md(a));
+        input_ptrs[a]
+                = CTX_IN_MEM(const src_data_t *, DNNL_ARG_MULTIPLE_SRC + a)
+                + i_d.blk_off(0);
+    }
+
+    const dim_t nelems = pd()->nelems_;
+    const dim_t block_size = pd()->block_size_;
+    const dim_t blocks_number = pd()->blocks_number_;
+    const dim_t tail = pd()->tail_;
+    const int depth = pd()->depth_;
+    const int nbufs = pd()->nbufs_;
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    acc_data_t *wspace = scratchpad.template get<acc_data_t>(
+            memory_tracking::names::key_sum_tree_acc);
+
+    // A source is read at an offset only before the destination is written
+    // at it, which makes the sum in place into source 0 safe.
+    auto sum_block = [&](dim_t start_e, dim_t end_e, int ithr) {
+        acc_data_t *my_ws = wspace + ithr * nbufs * block_size;
+        const block_ctx_t b {input_ptrs.data(), pd()->scales(), num_arrs,
+                start_e, end_e - start_e, my_ws};
+        acc_data_t *root = dst_data_type == data_type::f32
+                ? (acc_data_t *)&output[start_e]
+                : &my_ws[depth * block_size];
+        sum_tree(b, root, 0, num_arrs, 0);
+        if (dst_data_type != data_type::f32)
+            types::cvt_from_float(&output[start_e], root, b.len);
+    };
+
+    const int max_nthr = pd()->nthr_;
+    parallel(max_nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(blocks_number, nthr, ithr, start, end);
+
+        for (dim_t nb = start; nb < end; ++nb)
+            sum_block(nb * block_size, (nb + 1) * block_size, ithr);
+
+        if (tail != 0 && ithr == nthr - 1)
+            sum_block(nelems - tail, nelems, ithr);
+    });
+
+    return status::success;
+}
+
+template struct simple_tree_sum_t<data_type::f32>;
+template struct simple_tree_sum_t<data_type::bf16>;
+template struct simple_tree_sum_t<data_type::bf16, data_type::f32>;
+template struct simple_tree_sum_t<data_type::f16>;
+template struct simple_tree_sum_t<data_type::f16, data_type::f32>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
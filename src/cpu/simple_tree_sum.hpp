@@ -0,0 +1,157 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_TREE_SUM_HPP
+#define CPU_SIMPLE_TREE_SUM_HPP
+
+#include "common/dnnl_thread.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_sum_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Sum of many sources, such as the gradients of a bucket in data parallel
+// training. A thread sums a block of the tensor at a time: the sources are
+// split in halves recursively down to the leaves of `leaf_size` sources,
+// which are read in a single pass, and the partial sums of the right halves
+// are kept in f32 buffers of the block, one per level of the tree. The
+// accumulation is always done in f32, and the destination may be source 0.
+template <data_type_t src_data_type, data_type_t dst_data_type = src_data_type>
+struct simple_tree_sum_t : public primitive_t {
+    struct pd_t : public cpu_sum_pd_t {
+        using cpu_sum_pd_t::cpu_sum_pd_t;
+
+        DECLARE_SUM_PD_T("simple:tree", simple_tree_sum_t);
+
+        status_t init(engine_t *engine) {
+            const int n = n_inputs();
+
+            VDISPATCH_SUM(platform::has_data_type_support(src_data_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SUM(platform::has_data_type_support(dst_data_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SUM(cpu_sum_pd_t::init(engine) == status::success,
+                    VERBOSE_BAD_ENGINE_KIND);
+            VDISPATCH_SUM(n >= min_num_arrs,
+                    "number of inputs is below min number of arrays");
+
+            const memory_desc_wrapper o_d(dst_md());
+            VDISPATCH_SUM(o_d.data_type() == dst_data_type,
+                    VERBOSE_INCONSISTENT_DT, "o_d", "dst");
+            VDISPATCH_SUM(o_d.is_dense(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+            for (int i = 0; i < n; ++i) {
+                const memory_desc_wrapper i_d(src_md(i));
+                VDISPATCH_SUM(i_d.data_type() == src_data_type,
+                        VERBOSE_UNSUPPORTED_DT);
+                VDISPATCH_SUM(o_d.similar_to(i_d, true, false, 0),
+                        VERBOSE_INCONSISTENT_MDS, "o_d", "i_d");
+                VDISPATCH_SUM(i_d.is_dense(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            }
+            nthr_ = dnnl_get_max_threads();
+            depth_ = tree_depth(n);
+            compute_blocking();
+            init_scratchpad();
+            return status::success;
+        }
+
+        int nthr_ = 1;
+        // The number of levels of the tree with a buffer.
+        int depth_ = 0;
+        // The number of f32 buffers of a thread, with the one for the root
+        // when the destination is not f32.
+        int nbufs_ = 0;
+        dim_t block_size_ = 0, nelems_ = 0, blocks_number_ = 0, tail_ = 0;
+
+    private:
+        void compute_blocking() {
+            nbufs_ = depth_ + (dst_data_type != data_type::f32);
+            // The buffers of a thread share a half of L1 with the lines of
+            // the sources being read.
+            const dim_t line = platform::get_cache_line_size()
+                    / (dim_t)sizeof(acc_data_t);
+            const dim_t bufs_size = platform::get_per_core_cache_size(1) / 2;
+            block_size_ = nstl::max(line,
+                    utils::rnd_dn(bufs_size
+                                    / ((nbufs_ + leaf_size)
+                                            * (dim_t)sizeof(acc_data_t)),
+                            line));
+            const memory_desc_wrapper o_d(dst_md());
+            nelems_ = o_d.nelems();
+            blocks_number_ = nelems_ / block_size_;
+            tail_ = nelems_ % block_size_;
+        }
+
+        void init_scratchpad() {
+            if (nbufs_ == 0) return;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<acc_data_t>(
+                    memory_tracking::names::key_sum_tree_acc,
+                    nbufs_ * block_size_ * nthr_);
+        }
+    };
+
+    simple_tree_sum_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+    // Fewer sources are summed in a single pass by the other
+    // implementations.
+    enum { min_num_arrs = 8, leaf_size = 4 };
+    using src_data_t = typename prec_traits_t<src_data_type>::type;
+    using dst_data_t = typename prec_traits_t<dst_data_type>::type;
+    using acc_data_t = typename prec_traits_t<data_type::f32>::type;
+
+    // Returns where the sources [a0, a1) are split, so that the leaves of
+    // the left half are full.
+    static int split(int a0, int a1) {
+        return a0 + utils::rnd_up(utils::div_up(a1 - a0, 2), (int)leaf_size);
+    }
+
+    static int tree_depth(int n) {
+        if (n <= leaf_size) return 0;
+        const int mid = split(0, n);
+        return 1 + tree_depth(nstl::max(mid, n - mid));
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    struct block_ctx_t {
+        const src_data_t *const *srcs;
+        const float *scales;
+        int nsrcs;
+        dim_t off;
+        dim_t len;
+        // The buffers of the levels of the tree.
+        acc_data_t *bufs;
+    };
+
+    void sum_leaf(const block_ctx_t &b, acc_data_t *acc, int a0, int a1) const;
+    void sum_tree(const block_ctx_t &b, acc_data_t *acc, int a0, int a1,
+            int level) const;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
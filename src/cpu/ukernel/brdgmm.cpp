@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_ukernel.h"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/ukernel/c_types_map.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/ukernel/brdgmm.hpp"
+#endif
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu;
+using namespace dnnl::impl::cpu::ukernel;
+
+status_t dnnl_brdgmm_create(brdgmm_t **brdgmm, dim_t M, dim_t N,
+        dim_t batch_size, dim_t lda, dim_t ldc, data_type_t a_dt,
+        data_type_t b_dt, data_type_t c_dt) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brdgmm_create(
+            brdgmm, M, N, batch_size, lda, ldc, a_dt, b_dt, c_dt);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_brdgmm_set_post_ops(brdgmm_t *brdgmm, dim_t ldd, data_type_t d_dt,
+        const post_ops_t *post_ops) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brdgmm_set_post_ops(brdgmm, ldd, d_dt, post_ops);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_brdgmm_set_A_scales(brdgmm_t *brdgmm, int a_scale_mask) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brdgmm_set_A_scales(brdgmm, a_scale_mask);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_brdgmm_set_B_scales(brdgmm_t *brdgmm, int b_scale_mask) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brdgmm_set_B_scales(brdgmm, b_scale_mask);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_brdgmm_set_D_scales(brdgmm_t *brdgmm, int d_scale_mask) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brdgmm_set_D_scales(brdgmm, d_scale_mask);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_brdgmm_set_batch_strides(
+        brdgmm_t *brdgmm, dim_t stride_A, dim_t stride_B) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brdgmm_set_batch_strides(
+            brdgmm, stride_A, stride_B);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_brdgmm_finalize(brdgmm_t *brdgmm) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brdgmm_finalize(brdgmm);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_brdgmm_generate(brdgmm_t *brdgmm) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brdgmm_generate(brdgmm);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_brdgmm_execute(const brdgmm_t *brdgmm, const void *A_ptr,
+        const void *B_ptr, const dim_t *A_B_offsets, void *D_ptr,
+        const attr_params_t *attr_params) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brdgmm_execute(
+            brdgmm, A_ptr, B_ptr, A_B_offsets, D_ptr, attr_params);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_brdgmm_destroy(brdgmm_t *brdgmm) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brdgmm_destroy(brdgmm);
+#endif
+    return status::unimplemented;
+}
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
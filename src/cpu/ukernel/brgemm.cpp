@@ -76,6 +76,15 @@ status_t dnnl_brgemm_set_D_scales(brgemm_t *brgemm, int d_scale_mask) {
     return status::unimplemented;
 }
 
+status_t dnnl_brgemm_set_batch_strides(
+        brgemm_t *brgemm, dim_t stride_A, dim_t stride_B) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brgemm_set_batch_strides(
+            brgemm, stride_A, stride_B);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_brgemm_finalize(brgemm_t *brgemm) {
 #if DNNL_X64
     return x64::ukernel::dnnl_brgemm_finalize(brgemm);
@@ -39,7 +39,10 @@ const pack_type_t pack32 = dnnl_pack_type_pack32;
 
 using attr_params_t = dnnl_ukernel_attr_params;
 using brgemm_t = dnnl_brgemm;
+using brdgmm_t = dnnl_brdgmm;
 using transform_t = dnnl_transform;
+using softmax_t = dnnl_ukernel_softmax;
+using postops_t = dnnl_ukernel_postops;
 
 } // namespace ukernel
 } // namespace cpu
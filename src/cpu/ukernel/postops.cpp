@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_ukernel.h"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/ukernel/c_types_map.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/ukernel/postops.hpp"
+#endif
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu;
+using namespace dnnl::impl::cpu::ukernel;
+
+status_t dnnl_ukernel_postops_create(
+        postops_t **postops, dim_t M, dim_t N, dim_t ldc, data_type_t c_dt) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_postops_create(postops, M, N, ldc, c_dt);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_postops_set_post_ops(postops_t *postops, dim_t ldd,
+        data_type_t d_dt, const post_ops_t *post_ops) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_postops_set_post_ops(
+            postops, ldd, d_dt, post_ops);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_postops_set_A_scales(
+        postops_t *postops, int a_scale_mask) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_postops_set_A_scales(
+            postops, a_scale_mask);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_postops_set_B_scales(
+        postops_t *postops, int b_scale_mask) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_postops_set_B_scales(
+            postops, b_scale_mask);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_postops_set_D_scales(
+        postops_t *postops, int d_scale_mask) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_postops_set_D_scales(
+            postops, d_scale_mask);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_postops_finalize(postops_t *postops) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_postops_finalize(postops);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_postops_generate(postops_t *postops) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_postops_generate(postops);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_postops_execute(const postops_t *postops,
+        const void *C_ptr, void *D_ptr, const attr_params_t *attr_params) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_postops_execute(
+            postops, C_ptr, D_ptr, attr_params);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_postops_destroy(postops_t *postops) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_postops_destroy(postops);
+#endif
+    return status::unimplemented;
+}
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_ukernel.h"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/ukernel/c_types_map.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/ukernel/softmax.hpp"
+#endif
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu;
+using namespace dnnl::impl::cpu::ukernel;
+
+status_t dnnl_ukernel_softmax_create(
+        softmax_t **softmax, dim_t M, dim_t N, dim_t ld_src, dim_t ld_dst) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_softmax_create(
+            softmax, M, N, ld_src, ld_dst);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_softmax_set_online(softmax_t *softmax, int online) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_softmax_set_online(softmax, online);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_softmax_generate(softmax_t *softmax) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_softmax_generate(softmax);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_softmax_execute(const softmax_t *softmax,
+        const void *src_ptr, void *dst_ptr, float *running_max,
+        float *running_sum, float *correction) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_softmax_execute(softmax, src_ptr, dst_ptr,
+            running_max, running_sum, correction);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_softmax_destroy(softmax_t *softmax) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_softmax_destroy(softmax);
+#endif
+    return status::unimplemented;
+}
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
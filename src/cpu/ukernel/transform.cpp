@@ -40,6 +40,22 @@ status_t dnnl_transform_create(transform_t **transform, dim_t K, dim_t N,
     return status::unimplemented;
 }
 
+status_t dnnl_transform_set_scales(
+        transform_t *transform, dim_t k_group_size, data_type_t scales_dt) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_transform_set_scales(
+            transform, k_group_size, scales_dt);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_transform_set_zero_points(transform_t *transform, int mask) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_transform_set_zero_points(transform, mask);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_transform_generate(transform_t *transform) {
 #if DNNL_X64
     return x64::ukernel::dnnl_transform_generate(transform);
@@ -55,6 +71,16 @@ status_t dnnl_transform_execute(
     return status::unimplemented;
 }
 
+status_t dnnl_transform_execute_decompress(const transform_t *transform,
+        const void *in_ptr, void *out_ptr, const void *scales_ptr,
+        const void *zero_points_ptr) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_transform_execute_decompress(
+            transform, in_ptr, out_ptr, scales_ptr, zero_points_ptr);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_transform_destroy(transform_t *transform) {
 #if DNNL_X64
     return x64::ukernel::dnnl_transform_destroy(transform);
@@ -14,6 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+
+#include "common/utils.hpp"
+
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
@@ -89,9 +93,48 @@ private:
     }
 };
 
+namespace {
+
+// The last palette loaded on a thread through the routines below. It lets a
+// primitive skip `ldtilecfg` when the previous primitive on that thread used
+// the same palette and left tiles configured with `amx_tile_lazy_release()`.
+struct tile_state_t {
+    bool is_configured;
+    char palette[AMX_PALETTE_SIZE];
+};
+
+tile_state_t &get_tile_state() {
+    static thread_local tile_state_t state = {false, {}};
+    return state;
+}
+
+void save_tile_state(const char palette[AMX_PALETTE_SIZE]) {
+    auto &state = get_tile_state();
+    std::memcpy(state.palette, palette, AMX_PALETTE_SIZE);
+    state.is_configured = true;
+}
+
+bool is_lazy_release_enabled() {
+    static const bool enabled
+            = getenv_int_user("AMX_TILE_LAZY_RELEASE", 0) != 0;
+    return enabled;
+}
+
+} // namespace
+
 status_t amx_tile_configure(const char palette[AMX_PALETTE_SIZE]) {
+    const auto &state = get_tile_state();
+    if (state.is_configured
+            && std::memcmp(state.palette, palette, AMX_PALETTE_SIZE) == 0) {
+        // Tiles may have been re-configured or released outside of these
+        // routines, e.g. by user code or by kernels managing tiles on their
+        // own. The lazy flavor checks the actual state before skipping.
+        return amx_tile_lazy_configure(palette);
+    }
+
     static const jit_amx_tilecfg_t tilecfg(/* is_lazy = */ false);
     tilecfg.tile_configure(palette);
+    save_tile_state(palette);
     return status::success;
 };
 
@@ -101,15 +144,22 @@ status_t amx_tile_lazy_configure(const char palette[AMX_PALETTE_SIZE]) {
     // a member of `jit_amx_tilecfg_t` class.
     char palette_storage[AMX_PALETTE_SIZE];
     tilecfg.tile_lazy_configure(palette, palette_storage);
+    save_tile_state(palette);
     return status::success;
 };
 
 status_t amx_tile_release() {
     static const jit_amx_tilerelease_t tilerls;
     tilerls.tile_release();
+    get_tile_state().is_configured = false;
     return status::success;
 };
 
+status_t amx_tile_lazy_release() {
+    if (is_lazy_release_enabled()) return status::success;
+    return amx_tile_release();
+};
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
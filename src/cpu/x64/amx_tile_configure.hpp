@@ -28,6 +28,11 @@ static constexpr size_t AMX_PALETTE_SIZE = 64;
 status_t DNNL_API amx_tile_configure(const char palette[AMX_PALETTE_SIZE]);
 status_t DNNL_API amx_tile_lazy_configure(const char palette[AMX_PALETTE_SIZE]);
 status_t DNNL_API amx_tile_release();
+// Releases tiles at the end of a primitive execution. With
+// ONEDNN_AMX_TILE_LAZY_RELEASE=1 keeps them configured instead, so that the
+// next primitive on the same thread configuring the same palette skips the
+// load.
+status_t DNNL_API amx_tile_lazy_release();
 
 } // namespace x64
 } // namespace cpu
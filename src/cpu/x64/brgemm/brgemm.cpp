@@ -436,6 +436,9 @@ status_t brgemm_desc_set_postops(brgemm_desc_t *brg,
     const auto &wei_scales = attr->scales_.get(DNNL_ARG_WEIGHTS);
     brg->with_src_scales
             = !brg->skip_scales && !src_scales.has_default_values();
+    // A non-common mask of src scales is assumed to be a value per row, and
+    // the driver checked that the mask has the correct value for this case.
+    brg->is_row_src_scale = brg->with_src_scales && src_scales.get_mask() > 0;
     brg->with_wei_scales
             = !brg->skip_scales && !wei_scales.has_default_values();
     if (brg->with_wei_scales) {
@@ -459,7 +462,10 @@ status_t brgemm_desc_set_postops(brgemm_desc_t *brg,
     const bool scales_ok = attr->scales_.has_default_values({DNNL_ARG_SRC,
                                    DNNL_ARG_WEIGHTS, DNNL_ARG_DST})
             && IMPLICATION(!src_scales.has_default_values(),
-                    src_scales.get_mask() == 0)
+                    src_scales.get_mask() == 0
+                            || (!brg->is_dgmm
+                                    && src_scales.get_data_type()
+                                            == data_type::f32))
             && IMPLICATION(!dst_scales.has_default_values(),
                     dst_scales.get_mask() == 0);
     if (!scales_ok) return status::unimplemented;
@@ -718,7 +724,9 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
 
     // This function compares brgemm_desc_t objects within a single brgemm primitive.
     // Comparison of objects from different primitives is not guaranteed due to
-    // dependencies of brgemm descriptor on a primitive attributes.
+    // dependencies of brgemm descriptor on a primitive attributes. The fields
+    // set by implementations after the descriptor initialization are compared
+    // as well, the kernel cache key compares the attributes on top of this.
 
     // Compare all non-pointer parameters of brgemm_desc_t except derived
     CMP_BRGEMM_FIELD(bcast_dim);
@@ -744,12 +752,14 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
     CMP_BRGEMM_FIELD(is_dgmm);
     CMP_BRGEMM_FIELD(with_sum);
     CMP_BRGEMM_FIELD(req_cal_comp_pads);
+    CMP_BRGEMM_FIELD(req_comp_pads_with_bcast);
 
     CMP_BRGEMM_FIELD(sum_scale);
     CMP_BRGEMM_FIELD(sum_zp);
     CMP_BRGEMM_FIELD(sum_dt);
     CMP_BRGEMM_FIELD(with_eltwise);
     CMP_BRGEMM_FIELD(with_binary);
+    CMP_BRGEMM_FIELD(skip_zp_b_compensation);
 
     CMP_BRGEMM_FIELD(zp_type_a);
     CMP_BRGEMM_FIELD(zp_type_b);
@@ -758,10 +768,12 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
     CMP_BRGEMM_FIELD(skip_scales);
     CMP_BRGEMM_FIELD(is_oc_scale);
     CMP_BRGEMM_FIELD(with_src_scales);
+    CMP_BRGEMM_FIELD(is_row_src_scale);
     CMP_BRGEMM_FIELD(with_wei_scales);
     CMP_BRGEMM_FIELD(with_dst_scales);
     CMP_BRGEMM_FIELD(dt_wei_scales);
     CMP_BRGEMM_FIELD(bs_group);
+    CMP_BRGEMM_FIELD(with_weights_scale_adjust);
 
     // Compare all non-pointer parameters of brgemm_attr_t except derived
     CMP_BRGEMM_FIELD(brgattr.max_bs);
@@ -791,6 +803,7 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
     CMP_BRGEMM_FIELD(brgattr.use_interleave_stores);
     CMP_BRGEMM_FIELD(brgattr.b_is_vnni);
     CMP_BRGEMM_FIELD(brgattr.fpmath_mode);
+    CMP_BRGEMM_FIELD(brgattr.acc_mode);
     CMP_BRGEMM_FIELD(brgattr.LDA2);
     CMP_BRGEMM_FIELD(brgattr.LDB2);
     CMP_BRGEMM_FIELD(brgattr.LDC2_M);
@@ -804,6 +817,7 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
     CMP_BRGEMM_FIELD(brgattr.hint_bd_block2);
     CMP_BRGEMM_FIELD(brgattr.hint_ld_block2);
     CMP_BRGEMM_FIELD(brgattr.hint_ununroll_bd_loop);
+    CMP_BRGEMM_FIELD(brgattr.mem_advice);
 
     CMP_BRGEMM_FIELD(brgattr.hint_load_nt_A);
     CMP_BRGEMM_FIELD(brgattr.hint_load_nt_B);
@@ -14,6 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <map>
+#include <tuple>
+
+#include "common/kernel_cache.hpp"
+#include "common/nstl.hpp"
+#include "common/primitive_hashing.hpp"
+
 #include "cpu/x64/brgemm/brgemm_containers.hpp"
 #include "cpu/x64/brgemm/jit_brdgmm_kernel.hpp"
 
@@ -26,6 +33,126 @@ using namespace dnnl::impl::utils;
 
 namespace brgemm_containers {
 
+namespace {
+// The key of a brgemm kernel in the kernel cache. The kernels read the
+// post-ops and the fpmath mode of the attributes, the latter to allow fast
+// approximations in the eltwise post-ops, and the descriptor comparison does
+// not cover either of them. So the key compares the post-ops, the fpmath mode
+// and, for the broadcast of binary post-ops, the destination descriptor on
+// top of the descriptor. The pointed to masks and offsets are copied to the
+// key.
+struct brgemm_kernel_key_t : public kernel_cache::key_impl_t {
+    brgemm_kernel_key_t(const brgemm_desc_t &brg) : brg_(brg) {
+        const auto &brgattr = brg.brgattr;
+        brg_.brgattr.bd_mask = nullptr;
+        if (brgattr.bd_mask_level > 0 && brgattr.bd_mask) {
+            bd_mask_.assign(brgattr.bd_mask, brgattr.bd_mask + brg.bcast_dim);
+            brg_.brgattr.bd_mask = bd_mask_.data();
+        }
+        brg_.brgattr.static_offsets = nullptr;
+        if (brg.type == brgemm_static_offs && brgattr.static_offsets) {
+            static_offsets_.assign(brgattr.static_offsets,
+                    brgattr.static_offsets + brgattr.max_bs);
+            brg_.brgattr.static_offsets = static_offsets_.data();
+        }
+        with_post_ops_ = brg.attr() && brg.attr()->post_ops_.len() > 0;
+        if (brg.attr()) fpmath_ = brg.attr()->fpmath_;
+        hash_ = compute_hash();
+    }
+
+    bool compare(const key_impl_t *key_impl) const override {
+        const auto *o = dynamic_cast<const brgemm_kernel_key_t *>(key_impl);
+        if (o == nullptr || hash_ != o->hash_) return false;
+        if (!(brg_ == o->brg_) || with_post_ops_ != o->with_post_ops_
+                || !(fpmath_ == o->fpmath_))
+            return false;
+        if (!with_post_ops_) return true;
+        if (!(brg_.attr()->post_ops_ == o->brg_.attr()->post_ops_))
+            return false;
+        const auto *dst_md = brg_.dst_md();
+        const auto *o_dst_md = o->brg_.dst_md();
+        if (dst_md == nullptr || o_dst_md == nullptr)
+            return dst_md == o_dst_md;
+        return *dst_md == *o_dst_md;
+    }
+
+    size_t hash() const override { return hash_; }
+
+private:
+    brgemm_desc_t brg_;
+    std::vector<char> bd_mask_;
+    std::vector<brgemm_batch_element_t> static_offsets_;
+    bool with_post_ops_ = false;
+    fpmath_t fpmath_;
+    size_t hash_ = 0;
+
+    // The fields that tell kernels apart most often, the comparison takes
+    // care of the rest.
+    size_t compute_hash() const {
+        size_t seed = 0;
+        seed = hash_combine(seed, brg_.bcast_dim);
+        seed = hash_combine(seed, brg_.load_dim);
+        seed = hash_combine(seed, brg_.reduce_dim);
+        seed = hash_combine(seed, brg_.LDA);
+        seed = hash_combine(seed, brg_.LDB);
+        seed = hash_combine(seed, brg_.LDC);
+        seed = hash_combine(seed, brg_.LDD);
+        seed = hash_combine(seed, static_cast<size_t>(brg_.isa_impl));
+        seed = hash_combine(seed, static_cast<size_t>(brg_.dt_a));
+        seed = hash_combine(seed, static_cast<size_t>(brg_.dt_b));
+        seed = hash_combine(seed, static_cast<size_t>(brg_.dt_c));
+        seed = hash_combine(seed, static_cast<size_t>(brg_.dt_d));
+        seed = hash_combine(seed, static_cast<size_t>(brg_.type));
+        seed = hash_combine(seed, brg_.beta);
+        seed = hash_combine(seed, brg_.brgattr.max_bs);
+        seed = hash_combine(seed, static_cast<size_t>(fpmath_.mode_));
+        seed = hash_combine(seed, fpmath_.apply_to_int_);
+        if (with_post_ops_) {
+            const auto &post_ops = brg_.attr()->post_ops_;
+            seed = hash_combine(seed, post_ops.len());
+            for (const auto &e : post_ops.entry_)
+                seed = hash_combine(seed, static_cast<size_t>(e.kind));
+            if (brg_.dst_md())
+                seed = hash_combine(
+                        seed, primitive_hashing::get_md_hash(*brg_.dst_md()));
+        }
+        return seed;
+    }
+};
+
+struct brgemm_kernel_value_t : public kernel_cache::value_impl_t {
+    brgemm_kernel_value_t(const std::shared_ptr<brgemm_kernel_t> &kernel)
+        : kernel(kernel) {}
+    std::shared_ptr<brgemm_kernel_t> kernel;
+};
+} // namespace
+
+status_t get_shared_kernel(
+        const brgemm_desc_t &brg, std::shared_ptr<brgemm_kernel_t> &kernel) {
+    kernel_cache::iface_t::create_func_ptr_t create = [](void *context) {
+        const auto &brg = *static_cast<const brgemm_desc_t *>(context);
+        brgemm_kernel_t *brg_kernel = nullptr;
+        const status_t status = brgemm_kernel_create(&brg_kernel, brg);
+        if (status != status::success)
+            return kernel_cache::iface_t::result_t {nullptr, status};
+        std::shared_ptr<kernel_cache::value_impl_t> value
+                = std::make_shared<brgemm_kernel_value_t>(
+                        std::shared_ptr<brgemm_kernel_t>(brg_kernel));
+        return kernel_cache::iface_t::result_t {
+                kernel_cache::value_t(std::move(value)), status};
+    };
+
+    const kernel_cache::key_t key(std::make_shared<brgemm_kernel_key_t>(brg));
+    auto result = kernel_cache::get().get_or_create(
+            key, *create, const_cast<brgemm_desc_t *>(&brg));
+    CHECK(result.status);
+    if (result.value.is_empty()) return status::runtime_error;
+    kernel = utils::downcast<const brgemm_kernel_value_t *>(
+            result.value.impl().get())
+                     ->kernel;
+    return status::success;
+}
+
 std::set<std::shared_ptr<brgemm_kernel_t>,
         decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *> &
 brgemm_kernel_container_t::get_set() {
@@ -100,6 +227,13 @@ bool brgemm_kernel_container_t::brgemm_kernel_cmp(
     return (std::memcmp(lcode, rcode, lsz) < 0);
 }
 
+void brgemm_kernel_container_t::resize(size_t ns) {
+    refs_.reset(new std::atomic<const brgemm_kernel_t *>[ns]);
+    for (size_t i = 0; i < ns; i++)
+        refs_[i].store(nullptr);
+    lazy_descs_.assign(ns, nullptr);
+}
+
 status_t brgemm_kernel_container_t::insert(int idx, const brgemm_desc_t *brg) {
     // Use two level hashing of brgemm kernels:
     // 1. Try to find entry in local brgemm_map_ using brgemm descriptor as a
@@ -108,21 +242,46 @@ status_t brgemm_kernel_container_t::insert(int idx, const brgemm_desc_t *brg) {
     // entry in kernel storage using kernel code as key
     const auto brgemm_it = brgemm_map_.find(brg);
     if (brgemm_it == brgemm_map_.end()) {
-        brgemm_kernel_t *brg_kernel = nullptr;
-        CHECK(brgemm_kernel_create(&brg_kernel, *brg));
-        std::shared_ptr<brgemm_kernel_t> sptr(brg_kernel);
+        std::shared_ptr<brgemm_kernel_t> sptr;
+        CHECK(get_shared_kernel(*brg, sptr));
         lock_write();
         const auto kernel_ret = get_set().insert(sptr);
-        refs_[idx] = kernel_ret.first->get();
+        const brgemm_kernel_t *ker = kernel_ret.first->get();
         unlock_write();
-        const auto brgemm_ret = brgemm_map_.insert({brg, refs_[idx]});
+        const auto brgemm_ret = brgemm_map_.insert({brg, ker});
         if (!brgemm_ret.second) return status::runtime_error;
+        refs_[idx].store(ker, std::memory_order_release);
     } else {
-        refs_[idx] = brgemm_it->second;
+        refs_[idx].store(brgemm_it->second, std::memory_order_release);
     }
     return status::success;
 }
 
+status_t brgemm_kernel_container_t::insert_lazy(
+        int idx, const brgemm_desc_t *brg) {
+    static const bool lazy = getenv_int_user("JIT_LAZY_KERNELS", 1) != 0;
+    if (!lazy) return insert(idx, brg);
+    lazy_descs_[idx] = brg;
+    return status::success;
+}
+
+const brgemm_kernel_t *brgemm_kernel_container_t::generate_lazy(
+        int idx, std::atomic<status_t> *status) const {
+    std::lock_guard<std::mutex> lock(lazy_mutex_);
+    const brgemm_kernel_t *ker = refs_[idx].load(std::memory_order_acquire);
+    if (ker) return ker;
+
+    // The kernels are generated on the execution of a const primitive, and
+    // the mutex guards the maps of the container.
+    auto *self = const_cast<brgemm_kernel_container_t *>(this);
+    const status_t st = self->insert(idx, lazy_descs_[idx]);
+    if (st != status::success) {
+        if (status) status->store(st);
+        return nullptr;
+    }
+    return refs_[idx].load(std::memory_order_acquire);
+}
+
 bool brgemm_palette_container_t::insert(int idx, const brgemm_desc_t *brg) {
     S_t kernel_palette;
     auto status = brgemm_init_tiles(*brg, kernel_palette.data());
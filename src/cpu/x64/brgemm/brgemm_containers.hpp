@@ -17,6 +17,9 @@
 #ifndef CPU_X64_BRGEMM_BRGEMM_CONTAINERS_HPP
 #define CPU_X64_BRGEMM_BRGEMM_CONTAINERS_HPP
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <set>
 #include "common/rw_mutex.hpp"
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -67,23 +70,57 @@ private:
     std::vector<std::vector<brgemm_batch_element_t>> static_offsets_list_;
 };
 
+// Returns the kernel for the descriptor from the process-wide kernel cache,
+// where primitives of any kind find the kernels generated for the same
+// descriptor and post-ops, or generates it.
+status_t DNNL_API get_shared_kernel(
+        const brgemm_desc_t &brg, std::shared_ptr<brgemm_kernel_t> &kernel);
+
 // global storage disabled for now
 // #define BRGEMM_KERNEL_GLOBAL_STORAGE
 
+// The kernels can be inserted lazily: only the descriptor is kept, and the
+// kernel is generated by the first thread that requests it during execution.
+// This saves the creation time and the code of the tail and border kernels
+// that a problem never hits. The generation may fail, so the primitive uses
+// get() with a status of the execution and returns it. A failed generation
+// is retried by the next request for the kernel.
 struct brgemm_kernel_container_t {
     brgemm_kernel_container_t() = default;
     brgemm_kernel_container_t(size_t ns) { resize(ns); }
-    void resize(size_t ns) { refs_.resize(ns); }
+    // Resets the references to the kernels.
+    void resize(size_t ns);
+    // Returns nullptr if the kernel was not inserted or failed to generate.
     inline const brgemm_kernel_t *operator[](int idx) const {
-        return refs_[idx];
+        const brgemm_kernel_t *ker = refs_[idx].load(std::memory_order_acquire);
+        if (ker || !lazy_descs_[idx]) return ker;
+        return generate_lazy(idx, nullptr);
+    }
+    // Same as operator[], but the failure of the generation is stored to
+    // `status`.
+    inline const brgemm_kernel_t *get(
+            int idx, std::atomic<status_t> &status) const {
+        const brgemm_kernel_t *ker = refs_[idx].load(std::memory_order_acquire);
+        if (ker || !lazy_descs_[idx]) return ker;
+        return generate_lazy(idx, &status);
     }
+    bool is_inserted(int idx) const { return refs_[idx] || lazy_descs_[idx]; }
 
     status_t insert(int idx, const brgemm_desc_t *brg);
+    // The descriptor must outlive the container. Falls back to insert() if
+    // the lazy generation is disabled with ONEDNN_JIT_LAZY_KERNELS=0.
+    status_t insert_lazy(int idx, const brgemm_desc_t *brg);
+
     static bool brgemm_kernel_cmp(const std::shared_ptr<brgemm_kernel_t> &lhs,
             const std::shared_ptr<brgemm_kernel_t> &rhs);
 
 private:
-    std::vector<const brgemm_kernel_t *> refs_;
+    std::unique_ptr<std::atomic<const brgemm_kernel_t *>[]> refs_;
+    std::vector<const brgemm_desc_t *> lazy_descs_;
+    mutable std::mutex lazy_mutex_;
+
+    const brgemm_kernel_t *generate_lazy(
+            int idx, std::atomic<status_t> *status) const;
 #ifdef BRGEMM_KERNEL_GLOBAL_STORAGE
     static utils::rw_mutex_t &rw_mutex() {
         static utils::rw_mutex_t mutex;
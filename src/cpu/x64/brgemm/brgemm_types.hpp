@@ -201,6 +201,9 @@ struct DNNL_API brgemm_attr_t {
     // interleave stores or not
     bool use_interleave_stores;
     impl::fpmath_mode_t fpmath_mode = fpmath_mode::strict;
+    // The `relaxed`, `any` and `f16` values allow f16 accumulators, see
+    // `brgemm_desc_t::is_f16_acc`.
+    impl::accumulation_mode_t acc_mode = accumulation_mode::strict;
     bool b_is_vnni {false};
     // Second level leading dimension describing distance between 16-line
     // blocks in case of blocked layout. Used to calculate address of next
@@ -295,6 +298,9 @@ struct brgemm_desc_t {
     bool skip_scales = false;
     int is_oc_scale = 0;
     bool with_src_scales = false;
+    // Src scales have a value per row of A, i.e. per `bcast_dim` point, and
+    // `ptr_src_scales` points to the value of the first row of the call.
+    bool is_row_src_scale = false;
     bool with_wei_scales = false;
     // `dst_scales` passed as a bare pointer making kernel change multiplication
     // to division was proved to be significantly slower, both for pure divps
@@ -333,6 +339,9 @@ struct brgemm_desc_t {
     bool is_bf16 = false, is_bf16_tmm = false, is_bf16_emu = false;
     bool is_fp8 = false, is_fp8_tmm = false;
     bool is_f16 = false, is_f16_tmm = false;
+    // f16 products are accumulated with f16 FMAs into registers of their
+    // own, which are added to the f32 accumulators periodically.
+    bool is_f16_acc = false;
     bool is_f32 = false;
     bool is_bf32 = false;
     bool is_tf32 = false;
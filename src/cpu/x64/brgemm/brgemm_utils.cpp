@@ -85,6 +85,7 @@ void init_common_conf(brgemm_desc_t *brg, brgemm_batch_kind_t type, float alpha,
     brg->sum_scale = 0;
     brg->sum_zp = 0;
     brg->with_src_scales = false;
+    brg->is_row_src_scale = false;
     brg->with_wei_scales = false;
     brg->with_dst_scales = false;
     brg->dt_wei_scales = data_type::undef;
@@ -201,6 +202,20 @@ void set_isa_impl(brgemm_desc_t *brg) {
     }
 }
 
+// f16 accumulation is implemented for the avx512_core_fp16 kernel reading
+// the plain rows of B, where the two neighbor ld blocks of a row are loaded
+// into a single zmm. There is no AMX instruction accumulating in f16.
+void set_f16_acc(brgemm_desc_t *brg) {
+    brg->is_f16_acc = brg->dt_a == data_type::f16
+            && brg->dt_b == data_type::f16
+            && brg->isa_impl == avx512_core_fp16 && !brg->is_tmm
+            && !brg->is_f16_b_non_amx_vnni()
+            && brg->layout == brgemm_row_major
+            && brg->brgattr.hint_loop_order != brgemm_lo_bl_1load
+            && one_of(brg->brgattr.acc_mode, accumulation_mode::relaxed,
+                    accumulation_mode::any, accumulation_mode::f16);
+}
+
 void set_brg_vmm(brgemm_desc_t *brg) {
     brg->is_tmm = brg->is_int8_tmm || brg->is_bf16_tmm || brg->is_f16_tmm
             || brg->is_bf32 || brg->is_fp8_tmm || brg->is_tf32;
@@ -234,6 +249,9 @@ int calculate_max_bcast_block(brgemm_desc_t *brg, const int adj_ld_block2) {
     int max_isa_regs = isa_num_vregs(brg->isa_impl);
     const int max_bcst_regs = brg->n_bcast_1_load ? 0 : 1;
     const int load_regs = brg->n_bcast_1_load ? 1 : adj_ld_block2;
+    // see accm_f16() in brgemm kernel, a row takes a register per a pair of
+    // ld blocks
+    const int f16_acc_row_regs = brg->is_f16_acc ? div_up(adj_ld_block2, 2) : 0;
     const bool req_zp_a_comp_pads
             = (brg->req_cal_comp_pads || brg->brgattr.max_top_vpad > 0
                       || brg->brgattr.max_bottom_vpad > 0)
@@ -272,8 +290,8 @@ int calculate_max_bcast_block(brgemm_desc_t *brg, const int adj_ld_block2) {
     const auto microkernel_max_reg_count
             = max_isa_regs - microkernel_regs - load_regs - max_bcst_regs;
 
-    auto microkernel_max_bcast_block
-            = microkernel_max_reg_count / (adj_ld_block2 + brg->n_bcast_1_load);
+    auto microkernel_max_bcast_block = microkernel_max_reg_count
+            / (adj_ld_block2 + brg->n_bcast_1_load + f16_acc_row_regs);
 
     // ----- post-ops and store accumulators -----
     const int beta_regs = !one_of(brg->beta, 1.f, 0.f);
@@ -791,6 +809,7 @@ status_t brgemm_blocking(brgemm_desc_t *brg) {
     set_brg_vmm(brg);
     if (!(brg->is_tmm || brg->is_zmm || brg->is_ymm))
         return status::unimplemented;
+    set_f16_acc(brg);
 
     if (brg->is_tmm)
         CHECK(brgemm_blocking_tmm(brg));
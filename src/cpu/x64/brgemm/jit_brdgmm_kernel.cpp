@@ -71,9 +71,13 @@ jit_brdgmm_kernel_base_t<Wmm>::jit_brdgmm_kernel_base_t(
         const binary_injector::static_params_t bsp {
                 this->param1, enabled_bcast_strategy, rhs_sp};
 
+        eltwise_injector::static_params_t esp;
+        esp.fast_approx = eltwise_injector::is_fast_approx_allowed(
+                brg.attr()->fpmath_.mode_);
+
         auto st = safe_ptr_assign(postops_injector_,
-                injector::jit_uni_postops_injector_base_t<Vmm>::create(
-                        this, brg.isa_impl, brg.attr()->post_ops_, bsp));
+                injector::jit_uni_postops_injector_base_t<Vmm>::create(this,
+                        brg.isa_impl, brg.attr()->post_ops_, bsp, esp));
         if (st != status::success) {
             assert(!"postops_injector creation failed");
         }
@@ -98,6 +98,8 @@ struct jit_brgemm_amx_uker_base_t : public jit_base_brgemm_kernel_t {
             eltwise_injector::static_params_t esp;
             esp.preserve_vmm = preserve_vmm;
             esp.preserve_p_table = false;
+            esp.fast_approx = eltwise_injector::is_fast_approx_allowed(
+                    brg.attr()->fpmath_.mode_);
 
             auto st = safe_ptr_assign(postops_injector_,
                     po_injector_t::create(this, brg.isa_impl,
@@ -189,6 +191,7 @@ private:
     const reg64_savable_t reg_zp_a_values {regscratchpad_, rbx, r18};
     const reg64_savable_t reg_zp_comp_b {regscratchpad_, rbx, r19};
     const reg64_savable_t reg_zp_c_values {regscratchpad_, rbx, r20};
+    const reg64_savable_t reg_src_scales {regscratchpad_, rbx, r21};
     const reg64_t reg_ptr_sum_zp = rbx;
     const reg64_t reg_converted_stride = rsi;
     const reg64_t reg_zp_comp_pad_a = rsi;
@@ -605,6 +608,7 @@ private:
     size_t zp_comp_pad_a_offset(const brgemm_iteration_t &bi, int bdb,
             int inp_bd, int ldb) const noexcept;
     size_t zp_comp_b_offset(int bd) const noexcept;
+    size_t src_scales_offset(int bd) const noexcept;
     size_t zp_c_values_offset(brgemm_iteration_t &bi, int ldb) const noexcept;
     bool is_out_bd(const bd_iteration_t *bdi, int bdb, int inp_bd) const;
     int get_out_bd(const bd_iteration_t *bdi, int bdb, int inp_bd) const;
@@ -815,6 +819,10 @@ size_t jit_brgemm_amx_uker_base_t::zp_comp_b_offset(int bd) const noexcept {
     return sizeof(int32_t) * bd;
 }
 
+size_t jit_brgemm_amx_uker_base_t::src_scales_offset(int bd) const noexcept {
+    return sizeof(float) * bd;
+}
+
 size_t jit_brgemm_amx_uker_base_t::zp_c_values_offset(
         brgemm_iteration_t &bi, int ldb) const noexcept {
     if (brg.zp_type_c == brgemm_broadcast_t::per_n) {
@@ -895,6 +903,11 @@ void jit_brgemm_amx_uker_base_t::read_params() {
         reg_zp_comp_b.save();
     }
 
+    if (brg.is_row_src_scale) {
+        mov(reg_src_scales, ptr[param1 + GET_OFF(ptr_src_scales)]);
+        reg_src_scales.save();
+    }
+
     if (brg.zp_type_c != brgemm_broadcast_t::none) {
         mov(reg_zp_c_values, ptr[param1 + GET_OFF(c_zp_values)]);
         reg_zp_c_values.save();
@@ -1099,7 +1112,10 @@ void jit_brgemm_amx_uker_base_t::prepare_post_ops_registers(
         }
     }
 
-    if (brg.with_src_scales) {
+    // Src scales per row are applied to the rows one by one instead.
+    const bool with_common_src_scales
+            = brg.with_src_scales && !brg.is_row_src_scale;
+    if (with_common_src_scales) {
         mov(reg_scales, ptr[param1 + GET_OFF(ptr_src_scales)]);
         for (int ldb = 0; ldb < ldi->block2(); ldb++) {
             // Hard-coded assumption for a single src scale value being
@@ -1124,7 +1140,7 @@ void jit_brgemm_amx_uker_base_t::prepare_post_ops_registers(
             if (is_single_scale) {
                 // Single value is not anticipated to be of any other type.
                 assert(brg.dt_wei_scales == data_type::f32);
-                if (brg.with_src_scales) {
+                if (with_common_src_scales) {
                     // Src scales are set, need to multiply by their value.
                     auto scales_bcast_ptr = EVEX_compress_addr(reg_scales,
                             scales_offset(ldi->pos(ldb)), /* bcast = */ true);
@@ -1152,7 +1168,7 @@ void jit_brgemm_amx_uker_base_t::prepare_post_ops_registers(
                 default: assert(!"unsupported wei_scales data type");
             }
 
-            if (brg.with_src_scales) {
+            if (with_common_src_scales) {
                 // Src scales are set, need to multiply by their value.
                 vmulps(zmm_scale_masked, zmm_scale, zmm_wei_scale);
             } else {
@@ -1443,7 +1459,9 @@ void jit_brgemm_amx_uker_base_t::process_output_range(
         }
     }
 
-    if (brg.with_src_scales || brg.with_wei_scales) {
+    const bool with_common_src_scales
+            = brg.with_src_scales && !brg.is_row_src_scale;
+    if (with_common_src_scales || brg.with_wei_scales) {
         for (auto bd = bd_start; bd < bd_finish; bd++) {
             if (!is_out_bd(bi.bdi, bdb, bd)) continue;
 
@@ -1453,6 +1471,20 @@ void jit_brgemm_amx_uker_base_t::process_output_range(
         }
     }
 
+    if (brg.is_row_src_scale) {
+        reg_src_scales.restore();
+        for (auto bd = bd_start; bd < bd_finish; bd++) {
+            if (!is_out_bd(bi.bdi, bdb, bd)) continue;
+
+            auto zmm = accm(bd);
+            const Xbyak::Zmm scaled_zmm = vmm_mask(zmm, true, false, k_mask);
+            const auto src_scales_off
+                    = src_scales_offset(get_out_bd(bi.bdi, bdb, bd));
+            vmulps(scaled_zmm, scaled_zmm,
+                    EVEX_compress_addr(reg_src_scales, src_scales_off, true));
+        }
+    }
+
     if (brg.with_bias) {
         for (auto bd = bd_start; bd < bd_finish; bd++) {
             if (!is_out_bd(bi.bdi, bdb, bd)) continue;
@@ -111,9 +111,13 @@ struct jit_brgemm_kernel_t : public jit_base_brgemm_kernel_t {
                     binary_injector::get_all_strategies_supported_by_injector(),
                     rhs_sp, f8_e5m2_cvt_.get(), f8_e4m3_cvt_.get()};
 
+            eltwise_injector::static_params_t esp;
+            esp.fast_approx = eltwise_injector::is_fast_approx_allowed(
+                    brg.attr()->fpmath_.mode_);
+
             auto st = safe_ptr_assign(postops_injector_,
-                    po_injector_t::create(
-                            this, brg.isa_impl, brg.attr()->post_ops_, bsp));
+                    po_injector_t::create(this, brg.isa_impl,
+                            brg.attr()->post_ops_, bsp, esp));
             if (st != status::success) {
                 assert(!"postops_injector creation failed");
             }
@@ -293,6 +297,18 @@ private:
         }
     }
 
+    // The f16 accumulator of the row `bd` and the ld blocks `2 * p` and
+    // `2 * p + 1`, if the latter exists, otherwise of the lower half only.
+    // They follow the registers of `load()`.
+    Vmm accm_f16(dim_t bd, dim_t p) {
+        const dim_t n_pairs = utils::div_up(brg.ld_block2, 2);
+        const dim_t idx = max_effective_vregs - 1
+                - (brg.ld_block2 * brg.bd_block) - brg.ld_block2
+                - (bd * n_pairs + p);
+        assert(brg.is_f16_acc && idx > 0);
+        return Vmm(idx);
+    }
+
     Vmm vmm_tmp(dim_t i) {
         assert(IMPLICATION(!brg.is_tmm,
                 i >= 0
@@ -415,6 +431,9 @@ private:
     void gemm_microkernel(dim_t bd_block2, bool is_bdb_tail, dim_t ld_block,
             bool is_rd_tail, bool is_ld_tail, dim_t vpad,
             dim_t rows_for_rd_tail);
+    void gemm_microkernel_f16_acc(dim_t bd_b, dim_t bd_e, dim_t ld_block2,
+            dim_t rd_loop, bool is_ld_tail);
+    void flush_f16_accumulators(dim_t bd_block, dim_t ld_block2);
     void gemm_microkernel_amx(dim_t bd_block2, bool is_bdb_tail,
             dim_t ld_block2, bool is_rd_tail, bool is_ld_tail, bool last_bdb);
 
@@ -454,6 +473,8 @@ private:
     dim_t compensations_offset(dim_t ld, bool is_tail = false) const noexcept;
     dim_t bdb_compensation_offset(dim_t bd_block2) const noexcept;
     dim_t bd_compensation_offset(dim_t ld, dim_t bd) const noexcept;
+    dim_t src_scales_offset(dim_t bd) const noexcept;
+    dim_t bdb_src_scales_offset(dim_t bd_block2) const noexcept;
     dim_t wei_scales_offset(dim_t ld, bool is_tail = false) const noexcept;
     dim_t zp_comp_a_offset(dim_t ld, bool is_tail = false) const noexcept;
     dim_t bd_zp_comp_a_offset(dim_t ld, dim_t bd) const noexcept;
@@ -620,6 +641,17 @@ dim_t jit_brgemm_kernel_t<Wmm>::bd_zp_comp_a_offset(
     return sizeof(int32_t) * (ld * brg.ld_block + bd * brg.LDB);
 }
 
+template <typename Wmm>
+dim_t jit_brgemm_kernel_t<Wmm>::src_scales_offset(dim_t bd) const noexcept {
+    return sizeof(float) * bd;
+}
+
+template <typename Wmm>
+dim_t jit_brgemm_kernel_t<Wmm>::bdb_src_scales_offset(
+        dim_t bd_block2) const noexcept {
+    return src_scales_offset(bd_block2 * brg.bd_block);
+}
+
 template <typename Wmm>
 dim_t jit_brgemm_kernel_t<Wmm>::zp_comp_b_offset(dim_t bd) const noexcept {
     return sizeof(int32_t) * bd;
@@ -743,6 +775,11 @@ void jit_brgemm_kernel_t<Wmm>::advance_bdb_post_op_regs(dim_t adj_bd_block) {
         add(reg_aux_zp_comp_b, bdb_zp_comp_b_offset(1));
         reg_aux_zp_comp_b.save();
     }
+    if (brg.is_row_src_scale) {
+        reg_aux_src_scales.restore();
+        add(reg_aux_src_scales, bdb_src_scales_offset(1));
+        reg_aux_src_scales.save();
+    }
     if (brg.req_comp_pads_with_bcast
             && brg.zp_type_a != brgemm_broadcast_t::none) {
         reg_aux_zp_comp_a.restore();
@@ -761,6 +798,11 @@ void jit_brgemm_kernel_t<Wmm>::restore_bdb_post_op_regs(dim_t bd_block2) {
             sub(reg_aux_zp_comp_b, bdb_zp_comp_b_offset(bd_block2 - 1));
             reg_aux_zp_comp_b.save();
         }
+        if (brg.is_row_src_scale) {
+            reg_aux_src_scales.restore();
+            sub(reg_aux_src_scales, bdb_src_scales_offset(bd_block2 - 1));
+            reg_aux_src_scales.save();
+        }
         if (brg.req_comp_pads_with_bcast
                 && brg.zp_type_a != brgemm_broadcast_t::none) {
             reg_aux_zp_comp_a.restore();
@@ -839,6 +881,12 @@ void jit_brgemm_kernel_t<Wmm>::advance_bd_block2_post_op_regs(dim_t bd_block2) {
         add(reg_zp_comp_b, bdb_zp_comp_b_offset(bd_block2));
         reg_zp_comp_b.save();
     }
+
+    if (brg.is_row_src_scale) {
+        reg_src_scales.restore();
+        add(reg_src_scales, bdb_src_scales_offset(bd_block2));
+        reg_src_scales.save();
+    }
 }
 
 template <typename Wmm>
@@ -875,6 +923,10 @@ void jit_brgemm_kernel_t<Wmm>::copy_post_ops_stack_values_to_aux(
         reg_zp_comp_b.restore();
         reg_zp_comp_b.saveTo(reg_aux_zp_comp_b);
     }
+    if (brg.is_row_src_scale) {
+        reg_src_scales.restore();
+        reg_src_scales.saveTo(reg_aux_src_scales);
+    }
 }
 
 template <typename Wmm>
@@ -987,6 +1039,13 @@ void jit_brgemm_kernel_t<Wmm>::zero_accumulators(dim_t bd_block2,
             auto vmm = accm(ld_block2, bd, ld);
             uni_vpxor(vmm, vmm, vmm);
         }
+        if (brg.is_f16_acc) {
+            for_(dim_t bd = 0; bd < bd_block; bd++)
+            for (dim_t p = 0; p < utils::div_up(ld_block2, 2); p++) {
+                auto vmm = accm_f16(bd, p);
+                uni_vpxor(vmm, vmm, vmm);
+            }
+        }
     }
 }
 
@@ -1265,7 +1324,30 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators_apply_post_ops(dim_t bd_block,
     // done in brgemm_post_ops kernel?
     bool dq2ps_cvt_done = false;
 
-    if (brg.with_src_scales) {
+    if (brg.with_src_scales && brg.is_row_src_scale) {
+        // The pointer to the scales of the rows of the block is advanced
+        // with the blocks of rows the same way as the one of `zp_comp_b`.
+        reg_aux_src_scales.restore();
+        auto vmm_src_scales = vmm_tmp(0);
+
+        for (dim_t bd = 0; bd < bd_block; bd++) {
+            const auto addr = ptr[reg_aux_src_scales + src_scales_offset(bd)];
+            if (!has_ptr_b_support) vbroadcastss(vmm_src_scales, addr);
+            for (dim_t ld = 0; ld < ld_block2; ld++) {
+                auto vmm = accm(ld_block2, bd, ld);
+                if (dq2ps_required && !dq2ps_cvt_done)
+                    uni_vcvtdq2ps(vmm, vmm);
+
+                if (has_ptr_b_support) {
+                    vmulps(vmm, vmm,
+                            ptr_b[reg_aux_src_scales + src_scales_offset(bd)]);
+                } else {
+                    vmulps(vmm, vmm, vmm_src_scales);
+                }
+            }
+        }
+        dq2ps_cvt_done = true;
+    } else if (brg.with_src_scales) {
         reg_src_scales.restoreTo(reg_aux_src_scales);
         auto vmm_src_scales = vmm_tmp(0);
         if (!has_ptr_b_support)
@@ -2272,6 +2354,11 @@ void jit_brgemm_kernel_t<Wmm>::gemm_microkernel(dim_t bd_block2,
     } else
         rd_loop = brg.rd_block;
 
+    if (brg.is_f16_acc) {
+        gemm_microkernel_f16_acc(bd_b, bd_e, ld_block2, rd_loop, is_ld_tail);
+        return;
+    }
+
     if (brg.req_s8s8_compensation) {
         reg_bdb_loop.save();
         mov(reg_s8_input_shift, 128);
@@ -2483,11 +2570,88 @@ void jit_brgemm_kernel_t<Wmm>::gemm_microkernel(dim_t bd_block2,
     if (max_prefetch_offset > INT_MAX) reg_aux_C.restore();
 }
 
+// A row of B has 32 f16 values of the ld blocks `2 * p` and `2 * p + 1`, so
+// a single `vfmadd231ph` accumulates the products of two ld blocks, and the
+// accumulators are added to the f32 ones by `flush_f16_accumulators()`.
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::gemm_microkernel_f16_acc(dim_t bd_b,
+        dim_t bd_e, dim_t ld_block2, dim_t rd_loop, bool is_ld_tail) {
+    const dim_t n_pairs = utils::div_up(ld_block2, 2);
+    const auto is_pair = [&](dim_t p) { return 2 * p + 1 < ld_block2; };
+
+    const dim_t max_prefetch_offset = B_offset(2 * (n_pairs - 1), rd_loop - 1)
+            + static_cast<dim_t>(brg.LDB) * brg.rd_block * brg.typesize_B;
+    if (max_prefetch_offset > INT_MAX) reg_aux_C.save();
+
+    for (dim_t rd = 0; rd < rd_loop; rd++) {
+        for (dim_t p = 0; p < n_pairs; p++) {
+            const auto addr = ptr[reg_aux_B + B_offset(2 * p, rd)];
+            if (is_pair(p))
+                vmovups(Zmm(load(p).getIdx()), addr);
+            else if (is_ld_tail)
+                vmovdqu16(Ymm(load(p).getIdx()) | ld_tail_mask | T_z, addr);
+            else
+                vmovups(Ymm(load(p).getIdx()), addr);
+            const dim_t prefetch_offset = B_offset(2 * p, rd)
+                    + static_cast<dim_t>(brg.LDB) * brg.rd_block
+                            * brg.typesize_B;
+            prefetcht0(EVEX_compress_addr_safe(
+                    reg_aux_B, prefetch_offset, reg_tmp_microkernel));
+        }
+        for (dim_t bd = bd_b; bd < bd_e; bd++) {
+            const Zmm zmm_bcst = Zmm(bcst().getIdx());
+            vpbroadcastw(zmm_bcst, ptr[reg_aux_A + A_offset(bd, rd)]);
+            for (dim_t p = 0; p < n_pairs; p++) {
+                const auto acc_idx = accm_f16(bd, p).getIdx();
+                const auto load_idx = load(p).getIdx();
+                if (is_pair(p))
+                    vfmadd231ph(Zmm(acc_idx), Zmm(load_idx), zmm_bcst);
+                else
+                    vfmadd231ph(Ymm(acc_idx), Ymm(load_idx),
+                            Ymm(zmm_bcst.getIdx()));
+            }
+        }
+    }
+
+    if (max_prefetch_offset > INT_MAX) reg_aux_C.restore();
+}
+
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::flush_f16_accumulators(
+        dim_t bd_block, dim_t ld_block2) {
+    // The registers of B are free between the microkernel calls.
+    const Zmm zmm_tmp = Zmm(load(0).getIdx());
+    const Ymm ymm_tmp = Ymm(zmm_tmp.getIdx());
+    for_(dim_t bd = 0; bd < bd_block; bd++)
+    for (dim_t p = 0; p < utils::div_up(ld_block2, 2); p++) {
+        const Zmm zmm_acc = Zmm(accm_f16(bd, p).getIdx());
+        const Zmm zmm_lo = Zmm(accm(ld_block2, bd, 2 * p).getIdx());
+        vcvtph2psx(zmm_tmp, Ymm(zmm_acc.getIdx()));
+        vaddps(zmm_lo, zmm_lo, zmm_tmp);
+        if (2 * p + 1 < ld_block2) {
+            const Zmm zmm_hi = Zmm(accm(ld_block2, bd, 2 * p + 1).getIdx());
+            vextractf64x4(ymm_tmp, zmm_acc, 1);
+            vcvtph2psx(zmm_tmp, ymm_tmp);
+            vaddps(zmm_hi, zmm_hi, zmm_tmp);
+        }
+        vpxord(zmm_acc, zmm_acc, zmm_acc);
+    }
+}
+
 template <typename Wmm>
 void jit_brgemm_kernel_t<Wmm>::bs_loop(dim_t bd_block2, bool is_bdb_tail,
         dim_t ld_block2, bool is_ld_tail, bool first_bdb, bool last_bdb,
         dim_t rows_for_rd_tail, bool skip_accumulation) {
 
+    // f16 accumulators are flushed to the f32 ones after a batch element,
+    // and after every `f16_acc_flush_rdb` blocks of a long reduction, which
+    // bounds the number of the f16 additions to 32 per value. The loop
+    // counter is tested against it, hence a power of 2.
+    const dim_t f16_acc_flush_rdb = utils::rnd_down_pow2(
+            nstl::max(dim_t(1), dim_t(32) / brg.rd_block));
+    const bool flush_f16_in_rdb_loop
+            = brg.is_f16_acc && brg.rdb > f16_acc_flush_rdb;
+
     auto ld_loop_body = [&](dim_t vpad, bool last_bdb) {
         set_A_B_matrices();
 
@@ -2516,6 +2680,13 @@ void jit_brgemm_kernel_t<Wmm>::bs_loop(dim_t bd_block2, bool is_bdb_tail,
                     add(reg_aux_B, rdb_B_offset());
 
                     dec(reg_rdb_loop);
+                    if (flush_f16_in_rdb_loop) {
+                        Label no_flush_label;
+                        test(reg_rdb_loop, f16_acc_flush_rdb - 1);
+                        jnz(no_flush_label, T_NEAR);
+                        flush_f16_accumulators(bd_block, ld_block2);
+                        L(no_flush_label);
+                    }
                     cmp(reg_rdb_loop, 0);
                 }
                 jg(rdb_loop_label, T_NEAR);
@@ -2531,6 +2702,9 @@ void jit_brgemm_kernel_t<Wmm>::bs_loop(dim_t bd_block2, bool is_bdb_tail,
                         is_ld_tail, vpad, rows_for_rd_tail);
             }
         }
+        // The loop above flushes after its last iteration as well.
+        if (brg.is_f16_acc && (!flush_f16_in_rdb_loop || brg.rdb_tail != 0))
+            flush_f16_accumulators(bd_block, ld_block2);
     };
 
     Label BS_loop_label;
@@ -15,8 +15,16 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <atomic>
 
+#include <immintrin.h>
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+
+#include "cpu/platform.hpp"
 #include "cpu/x64/cpu_barrier.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -99,6 +107,46 @@ void barrier(ctx_t *ctx, int nthr) {
     j(ctx, nthr);
 }
 
+namespace {
+size_t fetch_and_inc(volatile size_t *ctr) {
+#ifdef _WIN32
+    return (size_t)_InterlockedExchangeAdd64((volatile __int64 *)ctr, 1);
+#else
+    return __sync_fetch_and_add(ctr, 1);
+#endif
+}
+} // namespace
+
+void barrier(ctx_t *ctx, int nthr, int ithr) {
+    // A group holds the threads of a socket, i.e. the logical processors of
+    // its cores, which may run several threads each with SMT.
+    static const int group_size = (int)(platform::get_num_cores()
+            * nstl::max(1u, cpu().getNumCores(Xbyak::util::SmtLevel)));
+    const int ngroups = group_size > 0 ? utils::div_up(nthr, group_size) : 1;
+    if (ngroups <= 1 || ngroups > ctx_t::MAX_GROUPS) {
+        barrier(ctx, nthr);
+        return;
+    }
+
+    assert(0 <= ithr && ithr < nthr);
+    const int g = ithr / group_size;
+    const size_t group_nthr = nstl::min(group_size, nthr - g * group_size);
+    auto &group = ctx->groups[g];
+
+    const size_t sense = group.sense;
+    if (fetch_and_inc(&group.ctr) + 1 == group_nthr) {
+        /* the last thread of the group */
+        group.ctr = 0;
+        barrier(ctx, ngroups);
+        std::atomic_thread_fence(std::memory_order_release);
+        group.sense = ~sense;
+    } else {
+        while (group.sense == sense)
+            _mm_pause();
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+}
+
 } // namespace simple_barrier
 
 } // namespace x64
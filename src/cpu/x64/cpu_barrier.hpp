@@ -35,13 +35,22 @@ namespace simple_barrier {
 #define CTX_ALIGNMENT 4096
 #endif
 
+/* The groups are used by the hierarchical barrier only, the jitted barrier
+ * relies on the offsets of ctr and sense. */
 STRUCT_ALIGN(
         CTX_ALIGNMENT, struct ctx_t {
             enum { CACHE_LINE_SIZE = 64 };
+            enum { MAX_GROUPS = 8 };
             volatile size_t ctr;
             char pad1[CACHE_LINE_SIZE - 1 * sizeof(size_t)];
             volatile size_t sense;
             char pad2[CACHE_LINE_SIZE - 1 * sizeof(size_t)];
+            struct group_t {
+                volatile size_t ctr;
+                char pad1[CACHE_LINE_SIZE - 1 * sizeof(size_t)];
+                volatile size_t sense;
+                char pad2[CACHE_LINE_SIZE - 1 * sizeof(size_t)];
+            } groups[MAX_GROUPS];
         });
 
 /* TODO: remove ctx_64_t once batch normalization switches to barrier-less
@@ -66,6 +75,19 @@ inline void ctx_init(ctx_t *ctx) {
 }
 void barrier(ctx_t *ctx, int nthr);
 
+/** hierarchical barrier for the threads 0 .. nthr - 1 of a team
+ * The threads first synchronize in groups of the size of a socket, so that
+ * the arrivals and the spinning stay on the cache lines of the group, and
+ * only the last thread of every group takes part in the barrier between the
+ * groups. The threads of a group are expected to run on the same socket, as
+ * with the OpenMP close binding. A team of a single socket, or of more than
+ * MAX_GROUPS sockets, uses the flat barrier instead.
+ * @params:
+ *   ithr -- the index of the calling thread in the team, all the threads
+ *           using the context must pass their index
+ */
+void barrier(ctx_t *ctx, int nthr, int ithr);
+
 /** injects actual barrier implementation into another jitted code
  * @params:
  *   code      -- jit_generator_t object where the barrier is to be injected
@@ -219,8 +219,8 @@ struct cpu_reducer_t {
 
         auto bctx = scratchpad.template get<simple_barrier::ctx_t>(
                 memory_tracking::names::key_reducer_space_bctx);
-        simple_barrier::barrier(
-                &bctx[balancer().group_id(ithr)], balancer().nthr_per_group_);
+        simple_barrier::barrier(&bctx[balancer().group_id(ithr)],
+                balancer().nthr_per_group_, balancer().id_in_group(ithr));
 
         reduce_nolock(ithr, dst, scratchpad);
     }
@@ -298,8 +298,8 @@ struct cpu_reducer_2d_t {
 
         auto bctx = scratchpad.template get<simple_barrier::ctx_t>(
                 memory_tracking::names::key_reducer_space_bctx);
-        simple_barrier::barrier(
-                &bctx[balancer().group_id(ithr)], balancer().nthr_per_group_);
+        simple_barrier::barrier(&bctx[balancer().group_id(ithr)],
+                balancer().nthr_per_group_, balancer().id_in_group(ithr));
 
         reduce_nolock(ithr, dst, scratchpad);
     }
@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/x64/injectors/jit_avx512_core_dropout_injector.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+
+namespace {
+constexpr int simd_w = 16;
+constexpr uint32_t philox_m0 = 0xD2511F53;
+constexpr uint32_t philox_m1 = 0xCD9E8D57;
+constexpr uint32_t philox_w0 = 0x9E3779B9;
+constexpr uint32_t philox_w1 = 0xBB67AE85;
+constexpr int philox_n_rounds = 10;
+
+// The offsets of the table entries, in bytes.
+constexpr int iota_off = 0;
+constexpr int hi_perm_off = iota_off + simd_w * sizeof(uint32_t);
+// The multipliers are stored as 64-bit values for `vpmuludq`.
+constexpr int m0_off = hi_perm_off + simd_w * sizeof(uint32_t);
+constexpr int m1_off = m0_off + sizeof(uint64_t);
+constexpr int w0_off = m1_off + sizeof(uint64_t);
+constexpr int w1_off = w0_off + sizeof(uint32_t);
+constexpr int ctr_base_mask_off = w1_off + sizeof(uint32_t);
+// The constants 1, 2 and 3 follow each other.
+constexpr int one_off = ctr_base_mask_off + sizeof(uint32_t);
+constexpr int word_off(int w) {
+    return one_off + (w - 1) * static_cast<int>(sizeof(uint32_t));
+}
+} // namespace
+
+void jit_avx512_core_dropout_injector_t::compute_vector(const Zmm &vmm,
+        const Reg64 &reg_offset, const Address &seed, const Address &threshold,
+        const Address &inv_q) {
+    const Zmm vmm_offset = aux(0);
+    const Zmm vmm_key0 = aux(1);
+    const Zmm vmm_key1 = aux(2);
+    const Zmm vmm_t0 = aux(3);
+    const Zmm vmm_t1 = aux(4);
+    // The words of the state, and a spare register taking the place of a
+    // word consumed by a round.
+    Zmm ctr[4] = {aux(5), aux(6), aux(7), aux(8)};
+    Zmm spare = aux(9);
+
+    h->vpbroadcastd(vmm_offset, reg_offset.cvt32());
+    h->vpaddd(vmm_offset, vmm_offset, h->ptr[h->rip + l_table_ + iota_off]);
+    h->vpandd(ctr[0], vmm_offset, table_bcast(ctr_base_mask_off));
+    for (int w = 1; w < 4; w++)
+        h->vpaddd(ctr[w], ctr[0], table_bcast(word_off(w)));
+    h->vpbroadcastd(vmm_key0, seed);
+    h->vmovdqa32(vmm_key1, vmm_key0);
+
+    // Writes the high halves of the products of the lanes of `src` by a
+    // multiplier to `hi`, and the low ones to `src`. `vpmuludq` multiplies
+    // the even lanes, the odd ones are shifted to them first.
+    const auto mulhilo = [&](const Zmm &hi, const Zmm &src, int m_off) {
+        h->vpmuludq(vmm_t0, src, table_bcast(m_off));
+        h->vpsrlq(vmm_t1, src, 32);
+        h->vpmuludq(vmm_t1, vmm_t1, table_bcast(m_off));
+        h->vpmulld(src, src, table_bcast(m_off));
+        h->vmovdqu32(hi, h->ptr[h->rip + l_table_ + hi_perm_off]);
+        h->vpermi2d(hi, vmm_t0, vmm_t1);
+    };
+
+    for (int r = 0; r < philox_n_rounds; r++) {
+        if (r > 0) {
+            h->vpaddd(vmm_key0, vmm_key0, table_bcast(w0_off));
+            h->vpaddd(vmm_key1, vmm_key1, table_bcast(w1_off));
+        }
+        // ctr2' = hi(m0 * ctr0) ^ ctr3 ^ key1, ctr3' = lo(m0 * ctr0).
+        mulhilo(spare, ctr[0], m0_off);
+        h->vpternlogd(spare, ctr[3], vmm_key1, 0x96);
+        // ctr0' = hi(m1 * ctr2) ^ ctr1 ^ key0, ctr1' = lo(m1 * ctr2). The
+        // register of ctr3 is free at this point.
+        mulhilo(ctr[3], ctr[2], m1_off);
+        h->vpternlogd(ctr[3], ctr[1], vmm_key0, 0x96);
+
+        const Zmm next[4] = {ctr[3], ctr[2], spare, ctr[0]};
+        spare = ctr[1];
+        for (int w = 0; w < 4; w++)
+            ctr[w] = next[w];
+    }
+
+    // Select the word of every lane and compare it against the threshold.
+    h->vpandd(vmm_t0, vmm_offset, table_bcast(word_off(3)));
+    for (int w = 1; w < 4; w++) {
+        h->vpcmpeqd(k_mask_, vmm_t0, table_bcast(word_off(w)));
+        h->vmovdqa32(ctr[0] | k_mask_, ctr[w]);
+    }
+    h->vpbroadcastd(vmm_t1, threshold);
+    h->vpcmpud(k_mask_, ctr[0], vmm_t1, 6); // greater than
+
+    h->vbroadcastss(vmm_t1, inv_q);
+    h->vmulps(vmm | k_mask_ | h->T_z, vmm, vmm_t1);
+}
+
+void jit_avx512_core_dropout_injector_t::store_mask(
+        const Address &addr, bool tail, const Opmask &tail_opmask) {
+    const Xmm xmm_mask = Xmm(vmm_aux_idxs_[0]);
+    h->vpmovm2b(xmm_mask, k_mask_);
+    h->vpabsb(xmm_mask, xmm_mask);
+    if (tail)
+        h->vmovdqu8(addr | tail_opmask, xmm_mask);
+    else
+        h->vmovdqu8(addr, xmm_mask);
+}
+
+void jit_avx512_core_dropout_injector_t::prepare_table() {
+    h->align(64);
+    h->L(l_table_);
+    for (int i = 0; i < simd_w; i++)
+        h->dd(i);
+    // The high half of the product of an even lane is the odd dword of its
+    // qword in the first source, the one of an odd lane is at the same place
+    // in the second source.
+    for (int i = 0; i < simd_w; i++)
+        h->dd(i % 2 ? simd_w + i : i + 1);
+    h->dq(philox_m0);
+    h->dq(philox_m1);
+    h->dd(philox_w0);
+    h->dd(philox_w1);
+    h->dd(~3u);
+    for (int w = 1; w < 4; w++)
+        h->dd(w);
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
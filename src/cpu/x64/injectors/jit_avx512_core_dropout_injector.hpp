@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_INJECTORS_JIT_AVX512_CORE_DROPOUT_INJECTOR_HPP
+#define CPU_X64_INJECTORS_JIT_AVX512_CORE_DROPOUT_INJECTOR_HPP
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Applies dropout to the lanes of a zmm with the random numbers of
+// `philox4x32()` from common/math_utils.hpp, so that the result matches the
+// reference implementation bit for bit. The counter of a lane is the offset
+// of its destination element, and every lane runs the 10 rounds on its own
+// copy of the 4 words of the state, picking the word `offset & 3` at the
+// end. The words are kept in registers, which are renamed between the rounds
+// at generation time instead of being moved.
+//
+// A lane is kept when its random number is above `threshold`, then it is
+// multiplied by `inv_q`, and it is zeroed otherwise. The values of a call are
+// read from memory as 32-bit scalars:
+// - seed: the seed of the generator,
+// - threshold: `UINT32_MAX * p` rounded down to an integer,
+// - inv_q: `1 / (1 - p)`, or 0 for `p == 1`.
+// The keep mask of the last call stays in `k_mask` till `store_mask()`.
+struct jit_avx512_core_dropout_injector_t {
+    static constexpr size_t n_aux_vmms = 10;
+
+    // vmm_aux_idxs - the indices of `n_aux_vmms` zmms the injector may
+    //   clobber between the calls.
+    // k_mask - the opmask holding the keep mask.
+    jit_avx512_core_dropout_injector_t(jit_generator_t *host,
+            const std::vector<int> &vmm_aux_idxs, const Xbyak::Opmask &k_mask)
+        : h(host), vmm_aux_idxs_(vmm_aux_idxs), k_mask_(k_mask) {
+        assert(vmm_aux_idxs_.size() == n_aux_vmms);
+    }
+
+    // Applies dropout to `vmm`. The low 32 bits of `reg_offset` hold the
+    // counter of the first lane, the ones of the next lanes follow it.
+    void compute_vector(const Xbyak::Zmm &vmm, const Xbyak::Reg64 &reg_offset,
+            const Xbyak::Address &seed, const Xbyak::Address &threshold,
+            const Xbyak::Address &inv_q);
+    // Writes the keep mask of the last call as one byte of 0 or 1 per lane.
+    // When `tail` is set, only the lanes of `tail_opmask` are written.
+    void store_mask(const Xbyak::Address &addr, bool tail = false,
+            const Xbyak::Opmask &tail_opmask = Xbyak::Opmask(0));
+    void prepare_table();
+
+private:
+    Xbyak::Zmm aux(int i) const { return Xbyak::Zmm(vmm_aux_idxs_[i]); }
+    Xbyak::Address table_bcast(int off) const {
+        return h->ptr_b[h->rip + l_table_ + off];
+    }
+
+    jit_generator_t *const h;
+    const std::vector<int> vmm_aux_idxs_;
+    const Xbyak::Opmask k_mask_;
+    Xbyak::Label l_table_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
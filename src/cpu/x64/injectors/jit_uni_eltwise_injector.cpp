@@ -59,6 +59,11 @@ bool is_supported(cpu_isa_t isa, alg_kind_t alg, data_type_t dt) {
 
 #undef VCHECK_ELT_INJ_BOOL
 
+bool is_fast_approx_allowed(fpmath_mode_t fpmath_mode) {
+    // Only the most relaxed mode allows to trade accuracy for speed.
+    return fpmath_mode == fpmath_mode::any;
+}
+
 } // namespace eltwise_injector
 
 using namespace Xbyak;
@@ -390,6 +395,23 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::test_mask() {
     }
 }
 
+template <cpu_isa_t isa, typename Wmm>
+void jit_uni_eltwise_injector_t<isa, Wmm>::div_compute_vector(
+        const Vmm &vmm_dst, const Vmm &vmm_den, const Vmm &vmm_tmp) {
+    // dst = dst / den, `vmm_den` and `vmm_tmp` are spoiled by fast version.
+    if (!fast_approx_) {
+        h->uni_vdivps(vmm_dst, vmm_dst, vmm_den);
+        return;
+    }
+
+    // r = rcp(den) refined by a Newton-Raphson iteration:
+    // r' = r - r * (den * r - 1)
+    h->uni_vrcpps(vmm_tmp, vmm_den);
+    h->uni_vfmsub213ps(vmm_den, vmm_tmp, table_val(one));
+    h->uni_vfnmadd231ps(vmm_tmp, vmm_den, vmm_tmp);
+    h->uni_vmulps(vmm_dst, vmm_dst, vmm_tmp);
+}
+
 template <cpu_isa_t isa, typename Wmm>
 void jit_uni_eltwise_injector_t<isa, Wmm>::exp_compute_vector_fwd(
         const Vmm &vmm_src) {
@@ -488,9 +510,45 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::elu_compute_vector_fwd(
     blend_with_mask(vmm_src, vmm_aux(2));
 }
 
+template <cpu_isa_t isa, typename Wmm>
+void jit_uni_eltwise_injector_t<isa, Wmm>::tanh_fast_compute_vector_fwd(
+        const Vmm &vmm_src) {
+    // tanh(x) = x * P(x^2) / Q(x^2) with P of degree 6 and Q of degree 3 on
+    // [0; tanh_fast_saturation_lbound], tanh(x) = 1.f beyond it. Compared to
+    // the table based version there are no gathers and no intervals.
+    const Vmm vmm_x2 = vmm_aux(0);
+    const Vmm vmm_pol = vmm_aux(1);
+    const Vmm vmm_den = vmm_aux(2);
+    const Vmm vmm_sign = vmm_aux(3);
+
+    // tanh is odd, compute it for abs(x) and restore the sign at the end
+    h->uni_vmovups(vmm_sign, vmm_src);
+    h->uni_vandps(vmm_sign, vmm_sign, table_val(sign_mask));
+    h->uni_vandps(vmm_src, vmm_src, table_val(positive_mask));
+    h->uni_vminps(vmm_src, vmm_src, table_val(tanh_fast_saturation_lbound));
+
+    h->uni_vmulps(vmm_x2, vmm_src, vmm_src);
+    h->uni_vmovups(vmm_pol, table_val(tanh_fast_pol, 6));
+    for (int i = 5; i >= 0; i--)
+        h->uni_vfmadd213ps(vmm_pol, vmm_x2, table_val(tanh_fast_pol, i));
+    h->uni_vmulps(vmm_src, vmm_src, vmm_pol);
+
+    h->uni_vmovups(vmm_den, table_val(tanh_fast_den_pol, 3));
+    for (int i = 2; i >= 0; i--)
+        h->uni_vfmadd213ps(vmm_den, vmm_x2, table_val(tanh_fast_den_pol, i));
+
+    div_compute_vector(vmm_src, vmm_den, vmm_pol);
+    h->uni_vorps(vmm_src, vmm_src, vmm_sign);
+}
+
 template <cpu_isa_t isa, typename Wmm>
 void jit_uni_eltwise_injector_t<isa, Wmm>::tanh_compute_vector_fwd(
         const Vmm &vmm_src) {
+    if (fast_approx_) {
+        tanh_fast_compute_vector_fwd(vmm_src);
+        return;
+    }
+
     // we add a check as the avx2 code cannot be used for avx
     assert(IMPLICATION(isa == avx2, mayiuse(avx2)));
 
@@ -949,7 +1007,7 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::logistic_compute_vector_fwd(
     // (exp(x) + 1)
     h->uni_vaddps(vmm_aux(0), vmm_aux(0), table_val(one));
     // y = exp(x) / (exp(x) + 1)
-    h->uni_vdivps(vmm_src, vmm_src, vmm_aux(0));
+    div_compute_vector(vmm_src, vmm_aux(0), vmm_aux(1));
 
     // Now we have to apply the "symmetry" based on original sign
     h->uni_vmovups(vmm_aux(1), table_val(one));
@@ -1386,7 +1444,7 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::gelu_erf_compute_vector_fwd(
             vmm_aux(2), table_val(gelu_erf_Abramowitz_Stegun_approx_const));
     h->uni_vfmadd213ps(vmm_aux(2), vmm_aux(4), table_val(one));
     h->uni_vmovups(vmm_aux(4), table_val(one));
-    h->uni_vdivps(vmm_aux(4), vmm_aux(4), vmm_aux(2));
+    div_compute_vector(vmm_aux(4), vmm_aux(2), vmm_aux(0));
 
     // -exp(-x*x)
     h->uni_vmulps(vmm_src, vmm_src, vmm_src);
@@ -2221,6 +2279,22 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::register_table_entries() {
             {tanh_linear_ubound, {0x39ddb3d7, true}},
             {tanh_saturation_lbound, {0x41102cb3, true}}};
 
+    // fast tanh(x) constants and rational approximation coefficients
+    static const table_t tanh_fast_consts {
+            {tanh_fast_saturation_lbound, {0x40fcf84f, true}}, // 7.90531111f
+            {tanh_fast_pol, {0x3ba059dc, true}}, // p0 = 4.89352457e-03f
+            {tanh_fast_pol, {0x3a270ded, true}}, // p1 = 6.37261954e-04f
+            {tanh_fast_pol, {0x3779434a, true}}, // p2 = 1.48572235e-05f
+            {tanh_fast_pol, {0x335c0041, true}}, // p3 = 5.12229725e-08f
+            {tanh_fast_pol, {0xaebd37ff, true}}, // p4 = -8.60467184e-11f
+            {tanh_fast_pol, {0x2a61337e, true}}, // p5 = 2.00018794e-13f
+            {tanh_fast_pol, {0xa59f25c0, true}}, // p6 = -2.76076837e-16f
+            {tanh_fast_den_pol, {0x3ba059dd, true}}, // q0 = 4.89352504e-03f
+            {tanh_fast_den_pol, {0x3b14aa05, true}}, // q1 = 2.26843474e-03f
+            {tanh_fast_den_pol, {0x38f895d6, true}}, // q2 = 1.18534706e-04f
+            {tanh_fast_den_pol, {0x35a0d3d8, true}} // q3 = 1.19825836e-06f
+    };
+
     // tanh(x) polynomial approximation
     // For each coefficient, there is 32 entries
     static const table_t tanh_polynomial_table {
@@ -2898,8 +2972,9 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::register_table_entries() {
     if (need.exp()) push_entries_of(exp_consts);
     if (need.exp()) push_entries_of(exp_polynomial);
     if (need.mish()) push_entries_of(mish_consts);
-    if (need.tanh()) push_entries_of(tanh_consts);
-    if (need.tanh()) push_entries_of(tanh_polynomial_table);
+    if (need.tanh() && fast_approx_) push_entries_of(tanh_fast_consts);
+    if (need.tanh() && !fast_approx_) push_entries_of(tanh_consts);
+    if (need.tanh() && !fast_approx_) push_entries_of(tanh_polynomial_table);
     if (need.soft_relu()) push_entries_of(soft_relu_consts);
     if (need.soft_relu()) push_entries_of(soft_relu_polynomial);
     if (need.gelu_tanh()) push_entries_of(gelu_tanh_consts);
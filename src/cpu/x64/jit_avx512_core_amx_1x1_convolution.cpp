@@ -221,7 +221,7 @@ status_t jit_avx512_core_amx_1x1_convolution_fwd_t::execute_forward(
                     oc_chunks);
         }
 
-        amx_tile_release();
+        amx_tile_lazy_release();
     });
     return status::success;
 }
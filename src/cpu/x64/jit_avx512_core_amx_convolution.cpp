@@ -417,7 +417,7 @@ jit_avx512_core_amx_convolution_fwd_t::execute_forward_reduced_lowering(
                     oh_chunks, occ, oc_chunks);
         }
 
-        amx_tile_release();
+        amx_tile_lazy_release();
     });
     return status::success;
 }
@@ -812,7 +812,7 @@ status_t jit_avx512_core_amx_convolution_fwd_t::execute_forward(
                     oh_chunks, owb, jcp.nb_ow, occ, oc_chunks);
         }
 
-        amx_tile_release();
+        amx_tile_lazy_release();
     });
     return status::success;
 }
@@ -1847,7 +1847,7 @@ void jit_avx512_core_amx_convolution_bwd_weights_t::
 
     /* diff_weights[:] += sum(wei_reduction_[thr_mb][:]) */
     if (jcp.global_transpose)
-        simple_barrier::barrier(ti->wei_bia_reduction_bctx, nthr_);
+        simple_barrier::barrier(ti->wei_bia_reduction_bctx, nthr_, ti->ithr);
 
     const int ic_b_kh_work
             = ti->ic_b_work * ((jcp.ndims == 5) ? jcp.kd : jcp.kh);
@@ -1932,7 +1932,7 @@ void jit_avx512_core_amx_convolution_bwd_weights_t::
     }
 
     if (jcp.transform_to_vnni && jcp.global_transpose) {
-        simple_barrier::barrier(ti->wei_bia_reduction_bctx, nthr_);
+        simple_barrier::barrier(ti->wei_bia_reduction_bctx, nthr_, ti->ithr);
         store_in_vnni_format(ti);
     }
 }
@@ -2020,7 +2020,7 @@ void jit_avx512_core_amx_convolution_bwd_weights_t::execute_backward_weights(
             default: assert(!"Invalid harness type");
         }
 
-        amx_tile_release();
+        amx_tile_lazy_release();
     });
 
     if (!jcp.global_transpose) {
@@ -1001,7 +1001,7 @@ void jit_avx512_core_bf16_1x1_convolution_bwd_weights_t<diff_weights_type>::
         /* diff_weights[:] += sum(ws_reduction_[thr_mb][:]) */
         if (jcp.nthr_mb > _start_nthr_mb) {
             if (dnnl_thr_syncable())
-                simple_barrier::barrier(reduction_barrier, jcp.nthr);
+                simple_barrier::barrier(reduction_barrier, jcp.nthr, ithr);
             const int work = g_work * oc_b_work * ic_b_work;
             int start {0}, end {0};
             balance211(work, jcp.nthr_mb, ithr_mb, start, end);
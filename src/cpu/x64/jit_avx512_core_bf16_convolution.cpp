@@ -1830,7 +1830,7 @@ void jit_avx512_core_bf16_convolution_bwd_weights_t ::
 
     /* diff_weights[:] += sum(wei_reduction_[thr_mb][:]) */
     if (jcp.global_transpose)
-        simple_barrier::barrier(ti->wei_bia_reduction_bctx, nthr_);
+        simple_barrier::barrier(ti->wei_bia_reduction_bctx, nthr_, ti->ithr);
 
     const int ic_b_kh_work
             = ti->ic_b_work * ((jcp.ndims == 5) ? jcp.kd : jcp.kh);
@@ -566,9 +566,12 @@ status_t brdgmm_dw_convolution_fwd_t::init(engine_t *engine) {
     return status::success;
 }
 
-status_t brdgmm_dw_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
+status_t brdgmm_dw_convolution_fwd_t::execute_range(const exec_ctx_t &ctx,
+        const char *src_ptr, dim_t src_shift, int mb_s, int mb_e, int oh_s,
+        int oh_e) const {
 
-    const char *const __restrict src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const char *const __restrict src
+            = src_ptr ? src_ptr : CTX_IN_MEM(const char *, DNNL_ARG_SRC);
     const char *const __restrict weights
             = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
     const char *const __restrict bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
@@ -612,7 +615,9 @@ status_t brdgmm_dw_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
     const int chb_step = jcp.nb_ch_blocking;
     const int chb_work = div_up(jcp.ngroups, chb_step);
     const int ow_step = jcp.ow_block;
-    const int work_amount = jcp.mb * jcp.od * jcp.oh * jcp.nb_ow * chb_work;
+    const int mb_work = mb_e - mb_s;
+    const int oh_work = oh_e - oh_s;
+    const int work_amount = mb_work * jcp.od * oh_work * jcp.nb_ow * chb_work;
 
     const int max_bs = jcp.kd * jcp.kh * jcp.kw;
 
@@ -652,7 +657,7 @@ status_t brdgmm_dw_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
         int start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
-        int n {0}, chb {0}, od {0}, oh {0}, owb {0};
+        int n_l {0}, chb {0}, od {0}, oh_l {0}, owb {0};
 
         auto iwork = start;
         const brgemm_kernel_t *kernel = nullptr;
@@ -673,15 +678,17 @@ status_t brdgmm_dw_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
         }
 
         while (iwork < end) {
-            nd_iterator_init(iwork, n, jcp.mb, od, jcp.od, oh, jcp.oh, owb,
-                    jcp.nb_ow, chb, chb_work);
+            nd_iterator_init(iwork, n_l, mb_work, od, jcp.od, oh_l, oh_work,
+                    owb, jcp.nb_ow, chb, chb_work);
+            const int n = mb_s + n_l;
+            const int oh = oh_s + oh_l;
             const bool is_m_tail = jcp.ow_tail != 0 && (owb + 1 == jcp.nb_ow);
             const bool is_n_tail = jcp.chb_tail != 0 && (chb + 1 == chb_work);
             if (is_m_tail && chb != 0) {
                 // the tail ow_block is not split btw threads to reduce the
                 // number of kernels.
-                utils::nd_iterator_jump(iwork, end, n, jcp.mb, od, jcp.od, oh,
-                        jcp.oh, owb, jcp.nb_ow, chb, chb_work);
+                utils::nd_iterator_jump(iwork, end, n_l, mb_work, od, jcp.od,
+                        oh_l, oh_work, owb, jcp.nb_ow, chb, chb_work);
                 continue;
             }
 
@@ -745,9 +752,10 @@ status_t brdgmm_dw_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
             int ch = chb * chb_step;
 
             auto *ptr_A = src
-                    + static_cast<ptrdiff_t>(n * src_mb_stride
-                            + id_s * src_d_stride + ih_s * src_h_stride
-                            + iw_s * src_w_stride + ch * src_ch_stride);
+                    + (static_cast<ptrdiff_t>(n * src_mb_stride
+                               + id_s * src_d_stride + ih_s * src_h_stride
+                               + iw_s * src_w_stride + ch * src_ch_stride)
+                            - src_shift);
             auto *ptr_B = weights + ch * wei_ch_stride;
             auto *ptr_C = dst + n * dst_mb_stride + od * dst_d_stride
                     + oh * dst_h_stride + ow * dst_w_stride
@@ -32,7 +32,11 @@ namespace x64 {
 
 struct brdgmm_dw_convolution_fwd_t : public primitive_t {
     struct pd_t : public cpu_convolution_fwd_pd_t {
-        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+        // Note: check `USING_INHERITED_IS_IMPOSSIBLE` comment in other files
+        // for details why this ctor can't be removed.
+        pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
 
         DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brdgmm_dw:", jcp_.isa, ""),
                 brdgmm_dw_convolution_fwd_t);
@@ -52,7 +56,18 @@ struct brdgmm_dw_convolution_fwd_t : public primitive_t {
     brdgmm_dw_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
 
     status_t init(engine_t *engine) override;
-    status_t execute(const exec_ctx_t &ctx) const override;
+    status_t execute(const exec_ctx_t &ctx) const override {
+        const auto &jcp = pd()->jcp_;
+        return execute_range(ctx, nullptr, 0, 0, jcp.mb, 0, jcp.oh);
+    }
+
+    // Computes the output rows [oh_s, oh_e) of the images [mb_s, mb_e). A
+    // non-null `src` overrides the source pointer, it is addressed with the
+    // strides of the source tensor and the byte offsets are decreased by
+    // `src_shift`. Used by the fused 1x1 + depthwise convolution to consume
+    // the intermediate tensor band by band.
+    status_t execute_range(const exec_ctx_t &ctx, const char *src,
+            dim_t src_shift, int mb_s, int mb_e, int oh_s, int oh_e) const;
 
 private:
     std::vector<std::unique_ptr<brgemm_kernel_t>> brdgmm_kernels_;
@@ -214,6 +214,7 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init_brgemm_desc() {
         brgattr.use_interleave_stores = jcp_.use_interleave_stores;
         brgattr.hint_prefetching = jcp_.hint_prefetching;
         brgattr.fpmath_mode = attr()->fpmath_.mode_;
+        brgattr.acc_mode = attr()->acc_mode_;
         // if post-ops are required and there are no intermediate calculations
         // (like ic_chunks > 1) then we don't need code without post-ops in
         // brgemm kernel
@@ -469,7 +470,9 @@ void brgemm_1x1_convolution_fwd_t<isa>::exec_ker(
     const auto dst_offset = dst_dt_size
             * (od * dst_h_sz + oh * dst_w_sz + ow * jcp.oc_without_padding);
 
-    const auto ptr_D = dst + dst_base + dst_offset;
+    const auto ptr_D = dst
+            + (static_cast<dim_t>(dst_base + dst_offset)
+                    - brgemm_ctx.dst_shift);
     char *const ptr_C = (jcp.use_buffer) ? c_buffer : (char *)ptr_D;
 
     const auto bias_w
@@ -572,13 +575,15 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_os_blocking(
         const int32_t *src_zero_points, int32_t *src_zp_comp,
         const int32_t *dst_zero_points, int32_t *s8s8_compensation,
         char *const c_buffer_global, char *inp_buffer_base,
-        uint8_t *inp_buffer_mask_base) const {
+        uint8_t *inp_buffer_mask_base, int mb_s, int mb_e, int osb_s,
+        int osb_e) const {
 
     const auto &jcp = pd()->jcp_;
     const bool is_amx = brgemm_convolution_utils::is_amx(isa);
 
-    const int os_chunks = div_up(jcp.nb_os, jcp.nb_os_blocking);
-    const int work_amount = jcp.mb * jcp.ngroups * jcp.nb_oc * os_chunks;
+    const int mb_work = mb_e - mb_s;
+    const int os_chunks = div_up(osb_e - osb_s, jcp.nb_os_blocking);
+    const int work_amount = mb_work * jcp.ngroups * jcp.nb_oc * os_chunks;
 
     parallel(pd()->jcp_.nthr, [&](const int ithr, const int nthr) {
         if (ithr >= work_amount) return;
@@ -607,23 +612,24 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_os_blocking(
         int last_brg_idx = -1;
         int start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
-        int n {0}, g {0}, ocb {0}, oss {0};
+        int n_l {0}, g {0}, ocb {0}, oss {0};
 
         if (jcp.loop_order == loop_ndhwgc)
-            nd_iterator_init(start, n, jcp.mb, oss, os_chunks, g, jcp.ngroups,
-                    ocb, jcp.nb_oc);
+            nd_iterator_init(start, n_l, mb_work, oss, os_chunks, g,
+                    jcp.ngroups, ocb, jcp.nb_oc);
         else if (jcp.loop_order == loop_ngcdhw)
-            nd_iterator_init(start, n, jcp.mb, g, jcp.ngroups, ocb, jcp.nb_oc,
-                    oss, os_chunks);
+            nd_iterator_init(start, n_l, mb_work, g, jcp.ngroups, ocb,
+                    jcp.nb_oc, oss, os_chunks);
         else
             assert(!"Unknown loop order");
 
         for (auto work = start; work < end; work++) {
+            const int n = mb_s + n_l;
             if (jcp.is_rtus && (last_n != n || last_g != g))
                 std::memset(inp_buffer_mask, 0, jcp.inp_buffer_mask_size);
-            const auto osb_start = oss * jcp.nb_os_blocking;
+            const auto osb_start = osb_s + oss * jcp.nb_os_blocking;
             const auto osb_range
-                    = nstl::min(jcp.nb_os - osb_start, jcp.nb_os_blocking);
+                    = nstl::min(osb_e - osb_start, jcp.nb_os_blocking);
             for (int osb = 0; osb < osb_range; osb++) {
                 const int os = (osb_start + osb) * jcp.os_block;
                 const int od = os / (OH * OW);
@@ -648,15 +654,15 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_os_blocking(
             last_n = n;
             last_g = g;
             if (jcp.loop_order == loop_ndhwgc)
-                nd_iterator_step(n, jcp.mb, oss, os_chunks, g, jcp.ngroups, ocb,
-                        jcp.nb_oc);
+                nd_iterator_step(n_l, mb_work, oss, os_chunks, g, jcp.ngroups,
+                        ocb, jcp.nb_oc);
             else if (jcp.loop_order == loop_ngcdhw)
-                nd_iterator_step(n, jcp.mb, g, jcp.ngroups, ocb, jcp.nb_oc, oss,
-                        os_chunks);
+                nd_iterator_step(n_l, mb_work, g, jcp.ngroups, ocb, jcp.nb_oc,
+                        oss, os_chunks);
             else
                 assert(!"Unknown loop order");
         }
-        if (is_amx) amx_tile_release();
+        if (is_amx) amx_tile_lazy_release();
     });
 }
 
@@ -667,12 +673,15 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_full_spatial(
         const void *wei_scales, const void *dst_scales, void *dst_scales_inv,
         const int32_t *src_zero_points, int32_t *src_zp_comp,
         const int32_t *dst_zero_points, int32_t *s8s8_compensation,
-        char *const c_buffer_global) const {
+        char *const c_buffer_global, int mb_s, int mb_e, int oh_s,
+        int oh_e) const {
 
     const auto &jcp = pd()->jcp_;
     const bool is_amx = brgemm_convolution_utils::is_amx(isa);
+    const int mb_work = mb_e - mb_s;
+    const int oh_work = oh_e - oh_s;
     const int work_amount
-            = jcp.mb * jcp.ngroups * jcp.nb_oc * OD * OH * jcp.nb_ow;
+            = mb_work * jcp.ngroups * jcp.nb_oc * OD * oh_work * jcp.nb_ow;
     parallel(pd()->jcp_.nthr, [&](const int ithr, const int nthr) {
         if (ithr >= work_amount) return;
         brgemm_batch_element_t *const brg_batch
@@ -692,18 +701,20 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_full_spatial(
         int last_brg_idx = -1;
         int start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
-        int n {0}, g {0}, ocb {0}, od {0}, oh {0}, owb {0};
+        int n_l {0}, g {0}, ocb {0}, od {0}, oh_l {0}, owb {0};
 
         if (jcp.loop_order == loop_ndhwgc)
-            nd_iterator_init(start, n, jcp.mb, od, OD, oh, OH, owb, jcp.nb_ow,
-                    g, jcp.ngroups, ocb, jcp.nb_oc);
+            nd_iterator_init(start, n_l, mb_work, od, OD, oh_l, oh_work, owb,
+                    jcp.nb_ow, g, jcp.ngroups, ocb, jcp.nb_oc);
         else if (jcp.loop_order == loop_ngcdhw)
-            nd_iterator_init(start, n, jcp.mb, g, jcp.ngroups, ocb, jcp.nb_oc,
-                    od, OD, oh, OH, owb, jcp.nb_ow);
+            nd_iterator_init(start, n_l, mb_work, g, jcp.ngroups, ocb,
+                    jcp.nb_oc, od, OD, oh_l, oh_work, owb, jcp.nb_ow);
         else
             assert(!"Unknown loop order");
 
         for (auto work = start; work < end; work++) {
+            const int n = mb_s + n_l;
+            const int oh = oh_s + oh_l;
             for (int icc = 0; icc < pd()->ic_chunks_; icc++) {
                 const int ow = owb * jcp.ow_block;
                 exec_ker(brgemm_ctx, ithr, brg_batch, c_buffer, nullptr, g, n,
@@ -712,23 +723,24 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_full_spatial(
                         src_scales, wei_scales, dst_scales_inv_ptr);
             }
             if (jcp.loop_order == loop_ndhwgc)
-                nd_iterator_step(n, jcp.mb, od, OD, oh, OH, owb, jcp.nb_ow, g,
-                        jcp.ngroups, ocb, jcp.nb_oc);
+                nd_iterator_step(n_l, mb_work, od, OD, oh_l, oh_work, owb,
+                        jcp.nb_ow, g, jcp.ngroups, ocb, jcp.nb_oc);
             else if (jcp.loop_order == loop_ngcdhw)
-                nd_iterator_step(n, jcp.mb, g, jcp.ngroups, ocb, jcp.nb_oc, od,
-                        OD, oh, OH, owb, jcp.nb_ow);
+                nd_iterator_step(n_l, mb_work, g, jcp.ngroups, ocb, jcp.nb_oc,
+                        od, OD, oh_l, oh_work, owb, jcp.nb_ow);
             else
                 assert(!"Unknown loop order");
         }
-        if (is_amx) amx_tile_release();
+        if (is_amx) amx_tile_lazy_release();
     });
 }
 
 template <cpu_isa_t isa>
 status_t brgemm_1x1_convolution_fwd_t<isa>::execute_forward_all(
-        const exec_ctx_t &ctx) const {
+        const exec_ctx_t &ctx, char *dst, dim_t dst_shift, int mb_s, int mb_e,
+        int sp_s, int sp_e) const {
 
-    brgemm_exec_ctx_t brgemm_ctx(ctx, pd());
+    brgemm_exec_ctx_t brgemm_ctx(ctx, pd(), dst, dst_shift);
 
     const memory_tracking::grantor_t scratchpad = ctx.get_scratchpad_grantor();
 
@@ -778,16 +790,25 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::execute_forward_all(
             ? scratchpad.template get<void>(key_conv_dst_scales)
             : nullptr;
 
+    // A partial spatial range is only requested for 2D convolutions.
+    const bool is_full_sp = sp_s == 0 && sp_e == OD * OH * OW;
+    assert(is_full_sp || OD == 1);
+
     if (jcp.is_os_blocking) {
+        const int osb_s = sp_s / jcp.os_block;
+        const int osb_e = div_up(sp_e, jcp.os_block);
         execute_os_blocking(brgemm_ctx, brg_batch_global, src_scales,
                 wei_scales, dst_scales, dst_scales_inv, src_zero_points,
                 zp_compensation, dst_zero_points, s8s8_compensation,
-                c_buffer_global, inp_buffer_base, inp_buffer_mask_base);
+                c_buffer_global, inp_buffer_base, inp_buffer_mask_base, mb_s,
+                mb_e, osb_s, osb_e);
     } else {
+        const int oh_s = is_full_sp ? 0 : sp_s / OW;
+        const int oh_e = is_full_sp ? OH : div_up(sp_e, OW);
         execute_full_spatial(brgemm_ctx, brg_batch_global, src_scales,
                 wei_scales, dst_scales, dst_scales_inv, src_zero_points,
                 zp_compensation, dst_zero_points, s8s8_compensation,
-                c_buffer_global);
+                c_buffer_global, mb_s, mb_e, oh_s, oh_e);
     }
 
     return status::success;
@@ -45,7 +45,11 @@ namespace x64 {
 template <cpu_isa_t isa>
 struct brgemm_1x1_convolution_fwd_t : public primitive_t {
     struct pd_t : public cpu_convolution_fwd_pd_t {
-        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+        // Note: check `USING_INHERITED_IS_IMPOSSIBLE` comment in other files
+        // for details why this ctor can't be removed.
+        pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
 
         DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgconv_1x1:", isa, ""),
                 brgemm_1x1_convolution_fwd_t);
@@ -73,6 +77,13 @@ struct brgemm_1x1_convolution_fwd_t : public primitive_t {
         bool need_postwork_;
         int ic_chunks_;
 
+        // The number of spatial points computed by a single work item, a
+        // spatial range requested by `execute_spatial_range()` must be
+        // aligned to it.
+        int spatial_granularity() const {
+            return jcp_.is_os_blocking ? jcp_.os_block : jcp_.ow;
+        }
+
         jit_brgemm_conv_conf_t jcp_ = utils::zero<decltype(jcp_)>();
 
     private:
@@ -85,24 +96,39 @@ struct brgemm_1x1_convolution_fwd_t : public primitive_t {
     ~brgemm_1x1_convolution_fwd_t() override = default;
 
     status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward_all(ctx);
+        const auto &jcp = pd()->jcp_;
+        execute_forward_all(ctx, nullptr, 0, 0, jcp.mb, 0, OD * OH * OW);
 
-        if (pd()->wants_zero_pad_dst()) ctx.memory(DNNL_ARG_DST)->zero_pad(ctx);
+        if (pd()->wants_zero_pad_dst()) ctx.zero_pad_output(DNNL_ARG_DST);
 
         return status::success;
     }
 
+    // Computes the spatial points [sp_s, sp_e) of the image `n` and writes
+    // them to `dst` with the strides of the destination tensor, the byte
+    // offsets are decreased by `dst_shift`. Used by the fused 1x1 +
+    // depthwise convolution to produce the intermediate tensor band by band.
+    // 3D convolutions are not supported.
+    status_t execute_spatial_range(const exec_ctx_t &ctx, char *dst,
+            dim_t dst_shift, int n, int sp_s, int sp_e) const {
+        assert(OD == 1);
+        return execute_forward_all(
+                ctx, dst, dst_shift, n, n + 1, sp_s, sp_e);
+    }
+
 protected:
     status_t init(engine_t *engine) override;
 
 private:
     //  brgemm convolution execution context
     struct brgemm_exec_ctx_t {
-        brgemm_exec_ctx_t(const exec_ctx_t &ctx, const pd_t *pd)
+        brgemm_exec_ctx_t(const exec_ctx_t &ctx, const pd_t *pd,
+                char *dst_ptr = nullptr, dim_t dst_shift = 0)
             : src(CTX_IN_MEM(const char *, DNNL_ARG_SRC))
             , weights(CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS))
             , bias(CTX_IN_MEM(const char *, DNNL_ARG_BIAS))
-            , dst(CTX_OUT_MEM(char *, DNNL_ARG_DST))
+            , dst(dst_ptr ? dst_ptr : CTX_OUT_MEM(char *, DNNL_ARG_DST))
+            , dst_shift(dst_shift)
             , post_ops_binary_rhs_arg_vec(binary_injector::prepare_binary_args(
                       pd->attr()->post_ops_, ctx))
             , wsp_tile(ctx.get_scratchpad_grantor().template get<char>(
@@ -111,6 +137,7 @@ private:
         const char *const __restrict weights;
         const char *const __restrict bias;
         char *const __restrict dst;
+        const dim_t dst_shift;
         const std::vector<const void *> post_ops_binary_rhs_arg_vec;
         char *const wsp_tile;
     };
@@ -133,16 +160,21 @@ private:
             const int32_t *src_zero_points, int32_t *src_zp_comp,
             const int32_t *dst_zero_points, int32_t *s8s8_compensation,
             char *const c_buffer_global, char *inp_buffer_base,
-            uint8_t *inp_buffer_mask_base) const;
+            uint8_t *inp_buffer_mask_base, int mb_s, int mb_e, int osb_s,
+            int osb_e) const;
     void execute_full_spatial(const brgemm_exec_ctx_t &brgemm_ctx,
             brgemm_batch_element_t *const brg_batch_global,
             const void *src_scales, const void *wei_scales,
             const void *dst_scales, void *dst_scales_inv,
             const int32_t *src_zero_points, int32_t *src_zp_comp,
             const int32_t *dst_zero_points, int32_t *s8s8_compensation,
-            char *const c_buffer_global) const;
+            char *const c_buffer_global, int mb_s, int mb_e, int oh_s,
+            int oh_e) const;
 
-    status_t execute_forward_all(const exec_ctx_t &ctx) const;
+    // Computes the images [mb_s, mb_e) restricted to the spatial points
+    // [sp_s, sp_e). A non-null `dst` overrides the destination pointer.
+    status_t execute_forward_all(const exec_ctx_t &ctx, char *dst,
+            dim_t dst_shift, int mb_s, int mb_e, int sp_s, int sp_e) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     static int get_brg_idx(const jit_brgemm_conv_conf_t &jcp,
@@ -0,0 +1,304 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/dw_convolution_utils.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_brgemm_1x1_dw_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+template <cpu_isa_t isa>
+status_t brgemm_1x1_dw_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace primitive_kind;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const auto &po = attr()->post_ops_;
+    dw_po_idx_ = po.find(convolution);
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(dw_po_idx_ != -1, VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_CONV(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(ndims() == 4, VERBOSE_BAD_NDIMS, "src", ndims());
+    VDISPATCH_CONV(one_of(desc()->src_desc.data_type, f32, bf16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(attr()->has_default_values(
+                           skip_mask_t::post_ops, desc()->dst_desc.data_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(po.has_default_values({binary, eltwise, convolution}),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    // The intermediate tensor has no user data to accumulate to.
+    VDISPATCH_CONV(
+            po.find(sum, 0, dw_po_idx_) == -1, VERBOSE_UNSUPPORTED_POSTOP);
+    // The intermediate tensor is kept in a band buffer, so the binary
+    // post-ops of the 1x1 convolution can't depend on the image or the
+    // spatial point.
+    for (int idx = 0; idx < dw_po_idx_; ++idx) {
+        if (!po.contain(binary, idx)) continue;
+        const auto &src1_md = po.entry_[idx].binary.src1_desc;
+        VDISPATCH_CONV(src1_md.dims[0] == 1 && src1_md.dims[2] == 1
+                        && src1_md.dims[3] == 1,
+                VERBOSE_UNSUPPORTED_POSTOP);
+    }
+
+    // The 1x1 convolution takes the post-ops before the depthwise one.
+    primitive_attr_t attr_pw(*attr());
+    if (!attr_pw.is_initialized()) return status::out_of_memory;
+    auto &e = attr_pw.post_ops_.entry_;
+    e.erase(e.begin() + dw_po_idx_, e.end());
+
+    // The nested implementations are created directly rather than through
+    // the primitive descriptor iterator, since the fused execution relies on
+    // their spatial range entry points.
+    pw_pd_.reset(new pw_pd_t(desc(), &attr_pw, nullptr));
+    if (!pw_pd_ || !pw_pd_->is_initialized()) return status::out_of_memory;
+    CHECK(pw_pd_->init(engine));
+    CHECK(pw_pd_->init_scratchpad_md());
+
+    convolution_desc_t cd_dw;
+    primitive_attr_t attr_dw;
+    CHECK(get_depthwise_conv_desc(
+            cd_dw, *pw_pd_->dst_md(), *attr(), attr_dw, dw_po_idx_));
+    dw_pd_.reset(new dw_pd_t(&cd_dw, &attr_dw, nullptr));
+    if (!dw_pd_ || !dw_pd_->is_initialized()) return status::out_of_memory;
+    CHECK(dw_pd_->init(engine));
+    CHECK(dw_pd_->init_scratchpad_md());
+
+    VDISPATCH_CONV_IC(*pw_pd_->dst_md() == *dw_pd_->src_md(),
+            VERBOSE_INCONSISTENT_MDS, "pw_pd_->dst_md", "dw_pd_->src_md");
+    const memory_desc_wrapper inter_d(pw_pd_->dst_md());
+    VDISPATCH_CONV_IC(inter_d.matches_one_of_tag(format_tag::nhwc)
+                    && inter_d.is_dense(),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_bands());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_1x1_dw_convolution_fwd_t<isa>::pd_t::init_bands() {
+    const memory_desc_wrapper inter_d(pw_pd_->dst_md());
+    const dim_t IH = dw_pd_->IH();
+    const dim_t IW = dw_pd_->IW();
+    const dim_t OH = dw_pd_->OH();
+    const dim_t KH = dw_pd_->KH();
+    const dim_t SH = dw_pd_->KSH();
+
+    const size_t row_size = IW * dw_pd_->IC() * inter_d.data_type_size();
+    const size_t l2_cache = platform::get_per_core_cache_size(2)
+            * dnnl_get_max_threads();
+
+    VDISPATCH_CONV_IC(l2_cache * 2 < inter_d.size(),
+            VERBOSE_1x1CONV_HEURISTIC_FAIL, "cache size check failed");
+
+    // A band of the intermediate tensor takes up to a half of the cache, the
+    // rest is left for the weights and the depthwise destination.
+    const dim_t max_rows = nstl::max<dim_t>(1, l2_cache / 2 / row_size);
+    const dim_t band_oh = max_rows > KH ? (max_rows - KH) / SH + 1 : 1;
+    band_oh_ = static_cast<int>(nstl::min(OH, band_oh));
+
+    // The 1x1 convolution computes work items of `spatial_granularity()`
+    // points, a band may be extended by less than a work item at each end.
+    const dim_t band_ih = nstl::min(IH, (band_oh_ - 1) * SH + KH);
+    band_sp_ = band_ih * IW + 2 * pw_pd_->spatial_granularity();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_1x1_dw_convolution_fwd_t<isa>::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+
+    const memory_desc_wrapper inter_d(pw_pd_->dst_md());
+    scratchpad.book(key_fusion_inout_buffer, band_sp_ * dw_pd_->IC(),
+            inter_d.data_type_size(), 0, 64);
+    scratchpad.book(key_nested_multiple, pw_pd_->scratchpad_registry());
+    scratchpad.book(key_nested_multiple + 1, dw_pd_->scratchpad_registry());
+}
+
+template <cpu_isa_t isa>
+const memory_desc_t *brgemm_1x1_dw_convolution_fwd_t<isa>::pd_t::arg_md(
+        int arg, bool user_input) const {
+    if (!pw_pd_ || !dw_pd_)
+        return convolution_fwd_pd_t::arg_md(arg, user_input);
+
+    // Binary post-ops are initialized by the nested primitive descriptors.
+    const auto &po = attr()->post_ops_;
+    for (int idx = 0; idx < po.len(); ++idx) {
+        if (arg != (DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx) | DNNL_ARG_SRC_1))
+            continue;
+        if (idx < dw_po_idx_)
+            return &pw_pd_->attr()->post_ops_.entry_[idx].binary.src1_desc;
+        if (idx > dw_po_idx_)
+            return &dw_pd_->attr()
+                            ->post_ops_.entry_[idx - (dw_po_idx_ + 1)]
+                            .binary.src1_desc;
+    }
+
+    switch (arg) {
+        case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_SRC:
+            return pw_pd_->dst_md(0, user_input);
+        case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS:
+            return dw_pd_->weights_md(0);
+        case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS:
+            return dw_pd_->weights_md(1);
+        default: return convolution_fwd_pd_t::arg_md(arg, user_input);
+    }
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_1x1_dw_convolution_fwd_t<isa>::init(engine_t *engine) {
+    const primitive_desc_t *pw_pd = pd()->pw_pd_.get();
+    const primitive_desc_t *dw_pd = pd()->dw_pd_.get();
+    CHECK(pw_pd->create_primitive(pw_p_, engine));
+    CHECK(dw_pd->create_primitive(dw_p_, engine));
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_1x1_dw_convolution_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    using pw_conv_t = brgemm_1x1_convolution_fwd_t<isa>;
+    const auto *pw = static_cast<const pw_conv_t *>(pw_p_.get());
+    const auto *dw = static_cast<const brdgmm_dw_convolution_fwd_t *>(
+            dw_p_.get());
+
+    const auto &ctx_args = ctx.args();
+    const auto append_arg = [&](exec_args_t &args, int op_arg, int ctx_arg) {
+        if (ctx_args.count(ctx_arg)) args[op_arg] = ctx_args.at(ctx_arg);
+    };
+
+    exec_args_t pw_args;
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_BIAS})
+        append_arg(pw_args, arg, arg);
+    exec_args_t dw_args;
+    append_arg(dw_args, DNNL_ARG_WEIGHTS,
+            DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS);
+    append_arg(
+            dw_args, DNNL_ARG_BIAS, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS);
+    append_arg(dw_args, DNNL_ARG_DST, DNNL_ARG_DST);
+
+    const auto &po = pd()->attr()->post_ops_;
+    const int dw_po_idx = pd()->dw_po_idx_;
+    for (int idx = 0; idx < po.len(); ++idx) {
+        if (!po.contain(primitive_kind::binary, idx)) continue;
+        const int arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx) | DNNL_ARG_SRC_1;
+        if (idx < dw_po_idx)
+            append_arg(pw_args, arg, arg);
+        else
+            append_arg(dw_args,
+                    DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx - (dw_po_idx + 1))
+                            | DNNL_ARG_SRC_1,
+                    arg);
+    }
+
+    exec_ctx_t pw_ctx(ctx, std::move(pw_args));
+    nested_scratchpad_t pw_ns(ctx, key_nested_multiple, pw_p_);
+    pw_ctx.set_scratchpad_grantor(pw_ns.grantor());
+
+    exec_ctx_t dw_ctx(ctx, std::move(dw_args));
+    nested_scratchpad_t dw_ns(ctx, key_nested_multiple + 1, dw_p_);
+    dw_ctx.set_scratchpad_grantor(dw_ns.grantor());
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    char *const band_buf
+            = scratchpad.template get<char>(key_fusion_inout_buffer);
+
+    const auto *dw_pd = pd()->dw_pd_.get();
+    const memory_desc_wrapper inter_d(dw_pd->src_md());
+    const size_t dt_size = inter_d.data_type_size();
+    const dim_t MB = dw_pd->MB();
+    const dim_t C = dw_pd->IC();
+    const dim_t IH = dw_pd->IH();
+    const dim_t IW = dw_pd->IW();
+    const dim_t OH = dw_pd->OH();
+    const dim_t KH = dw_pd->KH();
+    const dim_t SH = dw_pd->KSH();
+    const dim_t t_pad = dw_pd->padT();
+    const dim_t sp_work = IH * IW;
+    const dim_t granularity = pd()->pw_pd_->spatial_granularity();
+    const dim_t band_oh = pd()->band_oh_;
+
+    for (dim_t n = 0; n < MB; n++) {
+        // The band buffer holds the spatial points [sp_buf, sp_done) of the
+        // intermediate tensor of the image `n`.
+        dim_t sp_buf = 0, sp_done = 0;
+        for (dim_t oh_s = 0; oh_s < OH; oh_s += band_oh) {
+            const dim_t oh_e = nstl::min(OH, oh_s + band_oh);
+            const dim_t ih_s = nstl::max<dim_t>(0, oh_s * SH - t_pad);
+            const dim_t ih_e = nstl::min(IH, (oh_e - 1) * SH - t_pad + KH);
+            const dim_t sp_s = ih_s * IW;
+            const dim_t sp_e = ih_e * IW;
+
+            // Keep the rows shared with the previous band and drop the rest.
+            if (sp_done <= sp_s) {
+                sp_done = rnd_dn(sp_s, granularity);
+                sp_buf = sp_done;
+            } else if (sp_buf < sp_s) {
+                std::memmove(band_buf,
+                        band_buf + (sp_s - sp_buf) * C * dt_size,
+                        (sp_done - sp_s) * C * dt_size);
+                sp_buf = sp_s;
+            }
+
+            // Both nested primitives address the intermediate tensor with
+            // its own strides, the offsets are shifted for `sp_buf` to land
+            // at the beginning of the band buffer.
+            const dim_t shift = (inter_d.blk_off(n) + sp_buf * C)
+                    * static_cast<dim_t>(dt_size);
+
+            const dim_t sp_end = nstl::min(sp_work, rnd_up(sp_e, granularity));
+            if (sp_end > sp_done) {
+                CHECK(pw->execute_spatial_range(
+                        pw_ctx, band_buf, shift, n, sp_done, sp_end));
+                sp_done = sp_end;
+            }
+            CHECK(dw->execute_range(
+                    dw_ctx, band_buf, shift, n, n + 1, oh_s, oh_e));
+        }
+    }
+
+    return status::success;
+}
+
+template struct brgemm_1x1_dw_convolution_fwd_t<avx512_core>;
+template struct brgemm_1x1_dw_convolution_fwd_t<avx512_core_bf16>;
+template struct brgemm_1x1_dw_convolution_fwd_t<avx512_core_amx>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_1X1_DW_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_1X1_DW_CONV_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/x64/jit_brdgmm_dw_conv.hpp"
+#include "cpu/x64/jit_brgemm_1x1_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// 1x1 convolution with a depthwise convolution post-op. The intermediate
+// tensor is produced by the brgemm 1x1 convolution and consumed by the brdgmm
+// depthwise convolution by bands of rows, so that a band stays in cache
+// between the two kernels instead of going through memory.
+template <cpu_isa_t isa>
+struct brgemm_1x1_dw_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgconv_1x1_dw:", isa, ""),
+                brgemm_1x1_dw_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // NOLINTBEGIN(google-default-arguments)
+        const memory_desc_t *src_md(
+                int index = 0, bool user_input = false) const override {
+            return pw_pd_ ? pw_pd_->src_md(index, user_input)
+                          : cpu_convolution_fwd_pd_t::src_md(index, user_input);
+        }
+
+        const memory_desc_t *weights_md(
+                int index = 0, bool user_input = false) const override {
+            return pw_pd_
+                    ? pw_pd_->weights_md(index, user_input)
+                    : cpu_convolution_fwd_pd_t::weights_md(index, user_input);
+        }
+
+        const memory_desc_t *dst_md(
+                int index = 0, bool user_input = false) const override {
+            return dw_pd_ ? dw_pd_->dst_md(index, user_input)
+                          : cpu_convolution_fwd_pd_t::dst_md(index, user_input);
+        }
+
+        const memory_desc_t *arg_md(
+                int arg, bool user_input = false) const override;
+        // NOLINTEND(google-default-arguments)
+
+        arg_usage_t arg_usage(int arg) const override {
+            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS))
+                return arg_usage_t::input;
+
+            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS))
+                return attr_post_op_dw_inputs() > 1 ? arg_usage_t::input
+                                                    : arg_usage_t::unused;
+
+            return convolution_fwd_pd_t::arg_usage(arg);
+        }
+
+        using pw_pd_t = typename brgemm_1x1_convolution_fwd_t<isa>::pd_t;
+        using dw_pd_t = brdgmm_dw_convolution_fwd_t::pd_t;
+
+        std::shared_ptr<pw_pd_t> pw_pd_;
+        std::shared_ptr<dw_pd_t> dw_pd_;
+        int dw_po_idx_ = -1;
+        // The number of depthwise output rows computed per band.
+        int band_oh_ = 0;
+        // The number of spatial points of the intermediate tensor kept in the
+        // band buffer.
+        dim_t band_sp_ = 0;
+
+    private:
+        status_t init_bands();
+        void init_scratchpad();
+    };
+
+    brgemm_1x1_dw_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::shared_ptr<primitive_t> pw_p_;
+    std::shared_ptr<primitive_t> dw_p_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
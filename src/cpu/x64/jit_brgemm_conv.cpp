@@ -312,6 +312,7 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::add_brg_descriptor(int vM,
         brgattr.max_bottom_vpad = jcp_.max_vpad;
     }
     brgattr.fpmath_mode = attr()->fpmath_.mode_;
+    brgattr.acc_mode = attr()->acc_mode_;
     brgattr.K_koef = (float)bs / KW;
 
     CHECK(brgemm_desc_set_attr(&brg, brgattr));
@@ -362,7 +363,8 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
 
     using skip_mask_t = primitive_attr_t::skip_mask_t;
     auto skip_mask = skip_mask_t::post_ops | skip_mask_t::sum_dt
-            | skip_mask_t::zero_points | skip_mask_t::fpmath_mode;
+            | skip_mask_t::zero_points | skip_mask_t::fpmath_mode
+            | skip_mask_t::src_upsampling;
     if (is_int8 || is_fp8) skip_mask |= skip_mask_t::scales;
 
     VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
@@ -442,9 +444,11 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     wei_dsz = jcp_.wei_dsz;
     dst_dsz = jcp_.dst_dsz;
 
-    // const variables used for address calculations
-    src_w_sz = static_cast<dim_t>(IW) * jcp_.ngroups * jcp_.ic_without_padding;
-    src_h_sz = IH * src_w_sz;
+    // const variables used for address calculations, the source sizes are the
+    // ones of the source before upsampling
+    src_w_sz = static_cast<dim_t>(IW / jcp_.src_upsampling) * jcp_.ngroups
+            * jcp_.ic_without_padding;
+    src_h_sz = (IH / jcp_.src_upsampling) * src_w_sz;
     dst_w_sz = static_cast<dim_t>(OW) * jcp_.oc_without_padding;
     dst_h_sz = OH * dst_w_sz;
     rd = jcp_.ic;
@@ -700,14 +704,18 @@ brgemm_convolution_fwd_t<isa>::brgemm_convolution_fwd_t(const pd_t *apd)
     : primitive_t(apd), bias_d(pd()->weights_md(1)) {}
 
 template <cpu_isa_t isa>
-status_t brgemm_convolution_fwd_t<isa>::add_brg_kernel(int brg_idx) {
+status_t brgemm_convolution_fwd_t<isa>::add_brg_kernel(
+        int brg_idx, bool is_lazy) {
     const auto _pd = pd();
     const auto &brgs = *(_pd->brgemm_descriptors_);
 
     auto brg = brgs[brg_idx];
-    if (!brgemm_kernels_[brg_idx] && brg && brg->bcast_dim > 0
+    if (!brgemm_kernels_.is_inserted(brg_idx) && brg && brg->bcast_dim > 0
             && brg->load_dim > 0 && brg->reduce_dim > 0) {
-        CHECK(brgemm_kernels_.insert(brg_idx, brg));
+        if (is_lazy)
+            CHECK(brgemm_kernels_.insert_lazy(brg_idx, brg));
+        else
+            CHECK(brgemm_kernels_.insert(brg_idx, brg));
         if (is_amx) brgemm_palettes_.insert(brg_idx, brg);
     }
     return status::success;
@@ -896,9 +904,11 @@ status_t brgemm_convolution_fwd_t<isa>::init(engine_t *engine) {
     DH = ndims_pick(jcp.dilate_h, jcp.dilate_h, 0) + 1;
     DW = jcp.dilate_w + 1;
 
-    // const variables used for address calculations
-    src_w_sz = static_cast<dim_t>(IW) * jcp.ngroups * jcp.ic_without_padding;
-    src_h_sz = IH * src_w_sz;
+    // const variables used for address calculations, the source sizes are the
+    // ones of the source before upsampling
+    src_w_sz = static_cast<dim_t>(IW / jcp.src_upsampling) * jcp.ngroups
+            * jcp.ic_without_padding;
+    src_h_sz = (IH / jcp.src_upsampling) * src_w_sz;
     dst_w_sz = static_cast<dim_t>(OW) * jcp.oc_without_padding;
     dst_h_sz = OH * dst_w_sz;
 
@@ -1007,9 +1017,13 @@ status_t brgemm_convolution_fwd_t<isa>::init(engine_t *engine) {
 
     is_amx = brgemm_convolution_utils::is_amx(isa);
 
+    // Only the kernels of the full blocks are generated at creation, the
+    // ones for the tails are generated on first use.
     for (const auto &key_value_pair : _pd->brg_indices) {
         const int brg_idx = key_value_pair.second;
-        add_brg_kernel(brg_idx);
+        const bool is_tail = key_value_pair.first[0] != jcp.M
+                || key_value_pair.first[1] || key_value_pair.first[2];
+        add_brg_kernel(brg_idx, is_tail);
     }
 
     for_(int i_N = N_begin; i_N < N_end; i_N++)
@@ -1306,18 +1320,31 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     auto inp_p_buffer_mask = (jcp.exec_type == exec_trans)
             ? scratchpad.template get<uint8_t>(key_conv_brgemm_inp_buffer_mask)
             : nullptr;
-    int32_t *src_zp_comp_base = jcp.src_zero_point
-            ? (jcp.req_cal_comp_pad ? scratchpad.template get<int32_t>(
-                       key_brgemm_primitive_zp_comp_a)
-                                    : zp_compensation)
-            : nullptr;
-    int32_t *s8s8_comp_base = jcp.s8s8_compensation_required
-            ? (jcp.req_cal_comp_pad ? scratchpad.template get<int32_t>(
-                       key_brgemm_primitive_buffer_comp)
-                                    : s8s8_compensation)
-            : nullptr;
+    int32_t *src_zp_comp_base = nullptr;
+    int32_t *s8s8_comp_base = nullptr;
+    std::shared_ptr<std::vector<int32_t>> cached_comp;
+    if (jcp.use_cached_comp_pad) {
+        const memory_t *weights_mem = ctx.input(DNNL_ARG_WEIGHTS);
+        CHECK(get_cached_compensation(wei,
+                weights_mem ? weights_mem->data_id() : 0, cached_comp));
+        if (jcp.src_zero_point) src_zp_comp_base = cached_comp->data();
+        if (jcp.s8s8_compensation_required)
+            s8s8_comp_base = cached_comp->data()
+                    + (jcp.src_zero_point ? jcp.comp_a_buffer_size : 0);
+    } else {
+        src_zp_comp_base = jcp.src_zero_point
+                ? (jcp.req_cal_comp_pad ? scratchpad.template get<int32_t>(
+                           key_brgemm_primitive_zp_comp_a)
+                                        : zp_compensation)
+                : nullptr;
+        s8s8_comp_base = jcp.s8s8_compensation_required
+                ? (jcp.req_cal_comp_pad ? scratchpad.template get<int32_t>(
+                           key_brgemm_primitive_buffer_comp)
+                                        : s8s8_compensation)
+                : nullptr;
 
-    cal_compensation(wei, src_zp_comp_base, s8s8_comp_base);
+        cal_compensation(wei, src_zp_comp_base, s8s8_comp_base);
+    }
 
     char *const wsp_tile_global = is_amx
             ? scratchpad.template get<char>(key_conv_amx_tile_buffer)
@@ -1413,9 +1440,18 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
             auto oh_end = jcp.is_os_blocking
                     ? oh_begin + 1
                     : nstl::min(OH, oh_begin + jcp.oh_block);
-            for_(int od = od_begin; od < od_end; od++)
-            for_(int oh = oh_begin; oh < oh_end; oh++)
+            // with is_od_inner_loop the input planes shared by neighbouring
+            // output depths are reused from cache within a block of rows
+            const int od_work = od_end - od_begin;
+            const int oh_work = oh_end - oh_begin;
+            for_(int odh = 0; odh < od_work * oh_work; odh++)
             for (int icc = 0; icc < _pd->ic_chunks; icc++) {
+                const int od = od_begin
+                        + (jcp.is_od_inner_loop ? odh % od_work
+                                                : odh / oh_work);
+                const int oh = oh_begin
+                        + (jcp.is_od_inner_loop ? odh / od_work
+                                                : odh % oh_work);
                 btc.od = od;
                 btc.oh = oh;
                 btc.icc = icc;
@@ -1438,12 +1474,12 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
             }
             BRGEMM_CONV_ITERATOR_STEP;
         }
-        if (is_amx) { amx_tile_release(); }
+        if (is_amx) { amx_tile_lazy_release(); }
     });
 
-    if (_pd->wants_zero_pad_dst()) ctx.memory(DNNL_ARG_DST)->zero_pad(ctx);
+    if (_pd->wants_zero_pad_dst()) ctx.zero_pad_output(DNNL_ARG_DST);
 
-    return status::success;
+    return brgemm_ctx.kernel_status.load();
 }
 
 template <cpu_isa_t isa>
@@ -1562,6 +1598,31 @@ status_t brgemm_convolution_fwd_t<isa>::cal_compensation(
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_convolution_fwd_t<isa>::get_cached_compensation(
+        const char *__restrict weights, uint64_t weights_id,
+        std::shared_ptr<std::vector<int32_t>> &comp) const {
+    const auto &jcp = pd()->jcp_;
+
+    std::lock_guard<std::mutex> lock(comp_pad_cache_.mutex);
+    // Weights without an id, e.g. the ones of an internal memory, are
+    // compensated on every execution.
+    if (!comp_pad_cache_.data || weights_id == 0
+            || comp_pad_cache_.weights_id != weights_id) {
+        const size_t zp_size = jcp.src_zero_point ? jcp.comp_a_buffer_size : 0;
+        const size_t s8s8_size = jcp.s8s8_compensation_required
+                ? jcp.s8s8_comp_buffer_size
+                : 0;
+        auto data = std::make_shared<std::vector<int32_t>>(zp_size + s8s8_size);
+        CHECK(cal_compensation(weights, zp_size ? data->data() : nullptr,
+                s8s8_size ? data->data() + zp_size : nullptr));
+        comp_pad_cache_.weights_id = weights_id;
+        comp_pad_cache_.data = std::move(data);
+    }
+    comp = comp_pad_cache_.data;
+    return status::success;
+}
+
 template <cpu_isa_t isa>
 void brgemm_convolution_fwd_t<isa>::perform_outwork(
         const brgemm_thread_ctx_t &btc, char *dst_base, const char *bias_w,
@@ -1851,10 +1912,13 @@ void brgemm_convolution_fwd_t<isa>::maybe_conv_inp(brgemm_thread_ctx_t &btc,
     const auto base_ih_buf = (jcp.copy_block_only ? 0 : ih_start)
             + (jcp.is_relo_whi() ? 0 : TP);
 
+    // The rows and the columns of the upsampled source are those of the
+    // source divided by US, the input transformation repeats them.
+    const auto US = jcp.src_upsampling;
     const memory_desc_wrapper src_d(pd()->src_md());
     const auto base_inp_offset_start = src_d.off_l(0)
             + static_cast<dim_t>(btc.n) * src_d.blk_off<false, true>(1)
-            + iw * jcp.ngroups * jcp.ic_without_padding + g_ic;
+            + (iw / US) * jcp.ngroups * jcp.ic_without_padding + g_ic;
 
     if (jcp.is_relo_whi()) {
         const auto base_out_offset_start
@@ -1930,12 +1994,13 @@ void brgemm_convolution_fwd_t<isa>::maybe_conv_inp(brgemm_thread_ctx_t &btc,
         cp.b_pad = jcp.is_os_blocking ? nstl::max(0, virt_ih_end - IH) : 0;
 
         cp.h_count = nstl::max(0, rows_to_copy) + cp.t_pad + cp.b_pad;
-        inp_offset_start = base_inp_offset_start + ih_start * src_w_sz;
+        cp.h_phase = ih_start % US;
+        inp_offset_start = base_inp_offset_start + (ih_start / US) * src_w_sz;
         // inp_buffer has physical padding
         out_offset_start = base_out_offset_start - cp.t_pad * _pd->pbuf_w_sz;
 
         for (int id = id_start; id < id_end; id++) {
-            const auto inp_offset = inp_offset_start + id * src_h_sz;
+            const auto inp_offset = inp_offset_start + (id / US) * src_h_sz;
             const auto id_buf = id - (jcp.copy_block_only ? id_start : 0) + FP;
             const auto out_offset = out_offset_start + id_buf * _pd->pbuf_h_sz;
             cp.src = src + src_dsz * inp_offset;
@@ -2057,7 +2122,10 @@ void brgemm_convolution_fwd_t<isa>::ker_base(brgemm_thread_ctx_t &btc) const {
             assert(!"Requested brgemm kernel was not created.");
             return;
         }
-        const auto brg_ker = brgemm_kernels_[brg_idx];
+        const auto brg_ker
+                = brgemm_kernels_.get(brg_idx, btc.brgemm_ctx.kernel_status);
+        // The failure of a lazy generation is reported by execute().
+        if (brg_ker == nullptr) return;
         brgemm_palettes_.maybe_tile_configure(is_amx, btc.cur_brg_idx, brg_idx);
 
         if (jcp.brg_type == brgemm_static_offs) {
@@ -2239,7 +2307,9 @@ void brgemm_convolution_fwd_t<isa>::ker_trans(brgemm_thread_ctx_t &btc) const {
             assert(!"Requested brgemm kernel was not created.");
             return;
         }
-        const auto brg_ker = brgemm_kernels_[brg_idx];
+        const auto brg_ker
+                = brgemm_kernels_.get(brg_idx, btc.brgemm_ctx.kernel_status);
+        if (brg_ker == nullptr) return;
         brgemm_palettes_.maybe_tile_configure(is_amx, btc.cur_brg_idx, brg_idx);
 
         const auto pbuf_base = btc.input
@@ -2355,7 +2425,9 @@ void brgemm_convolution_fwd_t<isa>::ker_vpad(brgemm_thread_ctx_t &btc) const {
             assert(!"Requested brgemm kernel was not created.");
             return;
         }
-        const auto brg_ker = brgemm_kernels_[brg_idx];
+        const auto brg_ker
+                = brgemm_kernels_.get(brg_idx, btc.brgemm_ctx.kernel_status);
+        if (brg_ker == nullptr) return;
 
         brgemm_palettes_.maybe_tile_configure(is_amx, btc.cur_brg_idx, brg_idx);
 
@@ -18,7 +18,10 @@
 #define CPU_X64_JIT_BRGEMM_CONV_HPP
 
 #include <array>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
@@ -161,6 +164,8 @@ private:
         const char *const __restrict bias;
         char *const __restrict dst;
         const std::vector<const void *> post_ops_binary_rhs_arg_vec;
+        // The failure of a lazy kernel generation in this execution.
+        std::atomic<status_t> kernel_status {status::success};
     };
 
     inline static int get_ker_po_idx(int m, bool do_postwork, bool is_N_tail) {
@@ -207,10 +212,13 @@ private:
 
     status_t add_po_kernel(brgemm_desc_t *bcfg, int ker_idx, bool is_init);
     void add_po_kernels(int i_N, int init_bcast_dim, int po_bcast_dim);
-    status_t add_brg_kernel(int brg_idx);
+    status_t add_brg_kernel(int brg_idx, bool is_lazy = false);
 
     status_t cal_compensation(const char *__restrict weights,
             int32_t *src_zp_buffer, int32_t *s8s8_comp_buffer) const;
+    status_t get_cached_compensation(const char *__restrict weights,
+            uint64_t weights_id,
+            std::shared_ptr<std::vector<int32_t>> &comp) const;
     int get_comp_oh(const int oh) const;
     int get_comp_ker_idx(const int kd_b, const int kd_e, const int kh_b,
             const int kh_e, const int kw_b, const int kw_e, const int oh) const;
@@ -253,6 +261,19 @@ private:
     bool is_relo_with_relo_weights;
     bool need_compensation;
     bool is_amx;
+
+    // The padding compensations for the weights last passed to the
+    // primitive, the source zero point one followed by the s8s8 one, used
+    // when the weights are constant. The weights are identified by the data
+    // id of their memory rather than by their address, which another buffer
+    // may take. An execution keeps the compensations alive while they are
+    // replaced for other weights.
+    struct comp_pad_cache_t {
+        std::mutex mutex;
+        uint64_t weights_id = 0;
+        std::shared_ptr<std::vector<int32_t>> data;
+    };
+    mutable comp_pad_cache_t comp_pad_cache_;
 };
 
 } // namespace x64
@@ -913,7 +913,7 @@ status_t brgemm_convolution_bwd_strided_t<isa>::execute(
             else
                 assert(!"Unknown loop order");
         }
-        if (is_amx) { amx_tile_release(); }
+        if (is_amx) { amx_tile_lazy_release(); }
     });
 
     return status::success;
@@ -57,7 +57,16 @@ status_t brgemm_convolution_bwd_weights_t::pd_t::init(engine_t *engine) {
     VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
             VERBOSE_BAD_ALGORITHM);
     VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
-    VDISPATCH_CONV(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(attr()->has_default_values(
+                           primitive_attr_t::skip_mask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+    // The sum accumulates in place, to f32 diff weights and diff bias only.
+    VDISPATCH_CONV(IMPLICATION(!attr()->post_ops_.has_default_values(),
+                           attr()->post_ops_.is_plain_sum()
+                                   && diff_wei_type == f32
+                                   && utils::one_of(diff_bia_type,
+                                           data_type::undef, f32)),
+            VERBOSE_UNSUPPORTED_POSTOP);
     VDISPATCH_CONV(impl::is_dense_format_kind({src_md(0), diff_weights_md(0),
                            diff_weights_md(1), diff_dst_md(0)}),
             VERBOSE_UNSUPPORTED_SPARSE_CFG);
@@ -774,11 +783,17 @@ struct brgemm_convolution_bwd_weights_t::thread_info_t {
         p_dst = &tr_diff_dst[tr_diff_dst_off(0, 0, 0, 0)]; //   p_tr_diff_dst;
     }
 
+    // With a sum, the first thread by minibatch computes directly to the f32
+    // diff weights and diff bias, and adds to their values instead of
+    // initializing them.
+    bool accumulates_to_dst() const { return jcp.with_sum && ithr_mb == 0; }
+
     bool just_init_output(
             int start, int end, float *diff_wei, float *diff_bias) {
         if (g_start >= g_end || oc_b_start >= oc_b_end
                 || ic_b_start >= ic_b_end)
             return false;
+        if (accumulates_to_dst()) return start >= end;
         if (start >= end) {
             // for rare case if thread has no work by spatial dimension then we
             // need to initialize the output at least
@@ -985,8 +1000,9 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_2d(
 
                         bp.bias = diff_bias + g * rnd_up(jcp.oc, jcp.oc_block)
                                 + oc_b * jcp.oc_block;
-                        bp.channel
-                                = (start == ti->img_start) && (ohb_s == oh_s);
+                        bp.channel = (start == ti->img_start)
+                                && (ohb_s == oh_s)
+                                && !ti->accumulates_to_dst();
 
                         bp.os_index_begin = ohb_s;
                         bp.os_index_end = ohb_e;
@@ -1005,7 +1021,8 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_2d(
                             || ti->ic_b_start == ti->ic_b_end)
                         continue;
 
-                    const auto do_init = (start == ti->img_start);
+                    const auto do_init = (start == ti->img_start)
+                            && !ti->accumulates_to_dst();
 
                     for (int kh = 0; kh < jcp.kh; kh++) {
                         const int bs_ih_s = _pd->get_start_ih(kh, ohb_s);
@@ -1186,7 +1203,8 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_3d(
 
                                 bp.channel = (start == ti->img_start)
                                         && (odb_s == od_s) && (iodb == odb_s)
-                                        && (ohb_s == oh_s);
+                                        && (ohb_s == oh_s)
+                                        && !ti->accumulates_to_dst();
                                 const auto dst_idx
                                         = ((iodb - od_s) * jcp.oh_block
                                                   + (ohb_s - oh_s))
@@ -1202,7 +1220,8 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_3d(
                             continue;
 
                         const auto do_init
-                                = (start == ti->img_start && ohb_s == oh_s);
+                                = (start == ti->img_start && ohb_s == oh_s)
+                                && !ti->accumulates_to_dst();
 
                         for (int kd = 0; kd < jcp.kd; kd++) {
                             const int bs_id_s = _pd->get_start_id(kd, odb_s);
@@ -1333,7 +1352,8 @@ void brgemm_convolution_bwd_weights_t::reduce_and_convert_diff_weights_and_bias(
 
     /* diff_weights[:] += sum(wei_reduction_[thr_mb][:]) */
     if (jcp.global_transpose)
-        simple_barrier::barrier(ti->wei_bia_reduction_bctx, jcp.nthr);
+        simple_barrier::barrier(
+                ti->wei_bia_reduction_bctx, jcp.nthr, ti->ithr);
 
     const int ic_b_kh_work
             = ti->ic_b_work * ((jcp.ndims == 5) ? jcp.kd : jcp.kh);
@@ -1341,7 +1361,8 @@ void brgemm_convolution_bwd_weights_t::reduce_and_convert_diff_weights_and_bias(
         // TODO: double check if a barrier is needed here
         // and at the end of function
         if (jcp.transform_to_vnni && jcp.global_transpose)
-            simple_barrier::barrier(ti->wei_bia_reduction_bctx, jcp.nthr);
+            simple_barrier::barrier(
+                    ti->wei_bia_reduction_bctx, jcp.nthr, ti->ithr);
         return;
     }
 
@@ -1459,7 +1480,8 @@ void brgemm_convolution_bwd_weights_t::reduce_and_convert_diff_weights_and_bias(
     }
 
     if (jcp.transform_to_vnni && jcp.global_transpose) {
-        simple_barrier::barrier(ti->wei_bia_reduction_bctx, jcp.nthr);
+        simple_barrier::barrier(
+                ti->wei_bia_reduction_bctx, jcp.nthr, ti->ithr);
         store_in_vnni_format(ti);
     }
 }
@@ -1522,6 +1544,21 @@ void brgemm_convolution_bwd_weights_t::prepare_scratchpad_data(
         simple_barrier::ctx_init(scratchpad.template get<simple_barrier::ctx_t>(
                 key_conv_wei_bia_reduction_bctx));
     }
+
+    if (jcp.with_sum && pd()->with_bias() && (jcp.oc % jcp.oc_block != 0)
+            && jcp.bia_dt == data_type::f32) {
+        // The diff bias is accumulated in the padded buffer, which starts
+        // from its values.
+        auto padded_bias = scratchpad.template get<float>(key_conv_padded_bias);
+        auto diff_bias = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_BIAS);
+        const int padded_stride = rnd_up(jcp.oc, jcp.oc_block);
+        for (int g = 0; g < jcp.ngroups; ++g) {
+            utils::array_copy(padded_bias + g * padded_stride,
+                    diff_bias + g * jcp.oc, jcp.oc);
+            utils::array_set(padded_bias + g * padded_stride + jcp.oc, 0,
+                    padded_stride - jcp.oc);
+        }
+    }
 }
 
 void brgemm_convolution_bwd_weights_t::execute_backward_weights(
@@ -1549,7 +1586,7 @@ void brgemm_convolution_bwd_weights_t::execute_backward_weights(
             default: assert(!"Invalid harness type");
         }
 
-        amx_tile_release();
+        amx_tile_lazy_release();
     });
 
     if (!jcp.global_transpose) {
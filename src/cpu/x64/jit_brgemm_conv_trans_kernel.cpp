@@ -192,6 +192,8 @@ void jit_avx512_core_brgemm_conv_trans_kernel_t::generate() {
 
         mov(aux_inp_ptr, inp_ptr);
         mov(aux_dst_ptr, dst_ptr);
+        if (jcp.src_upsampling > 1)
+            mov(reg_h_phase, ptr[param1 + GET_OFF(h_phase)]);
 
         cmp(reg_hc, 0);
         jle(finish_label, T_NEAR); // nothing to do
@@ -222,9 +224,19 @@ void jit_avx512_core_brgemm_conv_trans_kernel_t::generate() {
         L(kh_label);
         {
             copy_ow_block(is_ic_tail);
-            auto inp_h_offset = jcp.iw * iw_size;
-
-            add(aux_inp_ptr, inp_h_offset);
+            auto inp_h_offset = (jcp.iw / jcp.src_upsampling) * iw_size;
+
+            if (jcp.src_upsampling > 1) {
+                // a row of the source is copied to src_upsampling rows
+                Xbyak::Label same_row_label;
+                inc(reg_h_phase);
+                cmp(reg_h_phase, jcp.src_upsampling);
+                jl(same_row_label, T_NEAR);
+                add(aux_inp_ptr, inp_h_offset);
+                xor_(reg_h_phase, reg_h_phase);
+                L(same_row_label);
+            } else
+                add(aux_inp_ptr, inp_h_offset);
             add(aux_dst_ptr, dst_h_offset);
 
             dec(reg_hc);
@@ -359,8 +371,26 @@ void jit_avx512_core_brgemm_conv_trans_kernel_t::copy_ow_block(
         Xbyak::Label skip_full_blocks;
         cmp(reg_owb, end_full_block);
         jg(skip_full_blocks, T_NEAR);
-        copy_ow_block_body(0, jcp.ow_block, inp_w(jcp.ow_block), is_ic_tail);
-        jmp(copy_block_done_label, T_NEAR);
+        if ((jcp.ow_block * jcp.stride_w) % jcp.src_upsampling == 0) {
+            const auto iw_phase
+                    = inp_w_start(start_full_block) % jcp.src_upsampling;
+            copy_ow_block_body(0, jcp.ow_block, inp_w(jcp.ow_block),
+                    is_ic_tail, iw_phase);
+            jmp(copy_block_done_label, T_NEAR);
+        } else {
+            // the first column of a block is at different positions in the
+            // upsampled columns of the source
+            for (int b = start_full_block; b <= end_full_block; b++) {
+                const auto iw_phase = inp_w_start(b) % jcp.src_upsampling;
+                Xbyak::Label skip_full_block;
+                cmp(reg_owb, b);
+                jne(skip_full_block, T_NEAR);
+                copy_ow_block_body(0, jcp.ow_block, inp_w(jcp.ow_block),
+                        is_ic_tail, iw_phase);
+                jmp(copy_block_done_label, T_NEAR);
+                L(skip_full_block);
+            }
+        }
 
         L(skip_full_blocks);
     }
@@ -375,10 +405,12 @@ void jit_avx512_core_brgemm_conv_trans_kernel_t::copy_ow_block(
             const auto inp_end = inp_start + inp_block;
             const auto block_lpad = 0;
             const auto block_len = nstl::min(adj_iw, inp_end) - inp_start;
+            const auto iw_phase = inp_start % jcp.src_upsampling;
             Xbyak::Label skip_last_partial_block;
             cmp(reg_owb, b);
             jne(skip_last_partial_block, T_NEAR);
-            copy_ow_block_body(block_lpad, cur_ow_block, block_len, is_ic_tail);
+            copy_ow_block_body(block_lpad, cur_ow_block, block_len, is_ic_tail,
+                    iw_phase);
             jmp(copy_block_done_label, T_NEAR);
 
             L(skip_last_partial_block);
@@ -392,8 +424,10 @@ void jit_avx512_core_brgemm_conv_trans_kernel_t::copy_ow_block(
     L(copy_block_done_label);
 }
 
+// iw_phase is the column of the upsampled source at the input pointer,
+// relative to the column of the source it is upsampled from.
 void jit_avx512_core_brgemm_conv_trans_kernel_t::copy_ow_block_body(
-        int lpad, int ow_len, int iw_len, bool is_ic_tail) {
+        int lpad, int ow_len, int iw_len, bool is_ic_tail, int iw_phase) {
     const auto dst_width = dst_w(jcp, ow_len);
     for (dim_t ind_w = 0; ind_w < dst_width; ind_w++) {
         auto iw_idx = ind_w - lpad;
@@ -402,7 +436,8 @@ void jit_avx512_core_brgemm_conv_trans_kernel_t::copy_ow_block_body(
             // left or right padding
             zero_ic_block(is_ic_tail, dst_off);
         } else {
-            auto inp_off = iw_idx * iw_size;
+            auto inp_off
+                    = ((iw_phase + iw_idx) / jcp.src_upsampling) * iw_size;
             copy_ic_block(ind_w, is_ic_tail, inp_off, dst_off, true);
         }
     }
@@ -34,6 +34,9 @@ struct jit_brgemm_conv_trans_kernel_args_t {
     size_t t_pad = 0;
     size_t h_count = 0;
     size_t b_pad = 0;
+    // the row of the upsampled source of the first row to copy, relative to
+    // the row of the source it is upsampled from
+    size_t h_phase = 0;
 };
 
 struct jit_avx512_core_brgemm_conv_trans_kernel_t : public jit_generator_t {
@@ -71,6 +74,7 @@ protected:
     const reg64_t reg_b_pad = rbx;
 
     const reg64_t reg_tmp = rsi;
+    const reg64_t reg_h_phase = r11;
 
     const Xbyak::Opmask ktail_mask = Xbyak::Opmask(2);
     const Xbyak::Opmask kblock_tail_mask = Xbyak::Opmask(3);
@@ -88,7 +92,8 @@ protected:
     Xbyak::Zmm get_zmm(dim_t idx) const { return Xbyak::Zmm(1 + (idx % 31)); }
     void generate() override;
     void copy_ow_block(bool is_ic_tail);
-    void copy_ow_block_body(int lpad, int ow_len, int iw_len, bool is_ic_tail);
+    void copy_ow_block_body(int lpad, int ow_len, int iw_len, bool is_ic_tail,
+            int iw_phase = 0);
 
     int inp_w(int out_w) const;
     int inp_w(int out_w, int kw) const;
@@ -734,6 +734,7 @@ status_t brg_blocking_t::get_brgemm_ur(
         brgattr.max_top_vpad = max_vpad;
         brgattr.max_bottom_vpad = max_vpad;
         brgattr.fpmath_mode = attr->fpmath_.mode_;
+        brgattr.acc_mode = attr->acc_mode_;
         CHECK(brgemm_desc_set_attr(&brg, brgattr));
 
         brg.with_sum = with_sum;
@@ -1673,6 +1674,14 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     jcp.id = (ndims == 5) ? src_d.dims()[2] : 1;
     jcp.ih = (ndims == 3) ? 1 : src_d.dims()[ndims - 2];
     jcp.iw = src_d.dims()[ndims - 1];
+    // the convolution is set up for the upsampled source, which is read from
+    // the source by the input transformation
+    jcp.src_upsampling = attr.src_upsampling_;
+    if (jcp.src_upsampling > 1) {
+        if (ndims == 5) jcp.id *= jcp.src_upsampling;
+        if (ndims >= 4) jcp.ih *= jcp.src_upsampling;
+        jcp.iw *= jcp.src_upsampling;
+    }
     jcp.od = (ndims == 5) ? dst_d.dims()[2] : 1;
     jcp.oh = (ndims == 3) ? 1 : dst_d.dims()[ndims - 2];
     jcp.ow = dst_d.dims()[ndims - 1];
@@ -1760,6 +1769,7 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
                 prop_kind::forward_inference)
             && jcp.ngroups == 1 && jcp.dilate_w == 0 && jcp.kw > 1
             && jcp.stride_w > 1 && jcp.l_pad <= 0 && jcp.r_pad <= 0
+            && jcp.src_upsampling == 1
             && jcp.ic % jcp.vnni_block == 0
             && IMPLICATION(jcp.ic > jcp.simd_w, jcp.ic % jcp.simd_w == 0)) {
         // such convolutions are equivalent to
@@ -1962,6 +1972,55 @@ void adjust_nthr(jit_brgemm_conv_conf_t &jcp, const memory_desc_wrapper &src_d,
     }
 }
 
+void init_od_temporal_blocking(jit_brgemm_conv_conf_t &jcp) {
+    /* Consecutive output depths share kd - stride_d input planes. When the
+     * window of kd input planes doesn't fit into L2, the output plane is split
+     * into bands of rows small enough for the window of the input bands to
+     * stay in L2, and output depths are iterated inside of each band. */
+    if (jcp.ndims != 5 || jcp.exec_type != exec_base || jcp.is_os_blocking)
+        return;
+    if (jcp.kd == 1 || jcp.stride_d >= jcp.ext_kd) return;
+    if (jcp.od_block != 1 || jcp.oh_block != 1 || jcp.od == 1) return;
+
+    const size_t iw_block = nstl::min(
+            jcp.iw, (jcp.ow_block - 1) * jcp.stride_w + jcp.ext_kw);
+    const size_t row_size = static_cast<size_t>(jcp.src_dsz) * iw_block
+            * jcp.ic_without_padding;
+    const size_t wei_size = static_cast<size_t>(jcp.wei_dsz) * jcp.kd * jcp.kh
+            * jcp.kw * jcp.ic_without_padding * jcp.oc_block;
+    const size_t L2_half = div_up(brg_blocking_t::L2, 2);
+    if (wei_size >= L2_half) return;
+    const size_t L2_available = L2_half - wei_size;
+
+    const auto window_size = [&](int oh_block) {
+        const size_t ih_block = static_cast<size_t>(oh_block - 1)
+                        * jcp.stride_h
+                + jcp.ext_kh;
+        return jcp.kd * nstl::min(ih_block, static_cast<size_t>(jcp.ih))
+                * row_size;
+    };
+    // the default order of loops already keeps the input planes in L2
+    if (window_size(jcp.oh) <= L2_available) return;
+    const size_t band_size = jcp.kd * jcp.stride_h * row_size;
+    const size_t min_window_size = window_size(1);
+    if (min_window_size > L2_available) return;
+    int oh_block = utils::saturate(1, jcp.oh,
+            1 + static_cast<int>((L2_available - min_window_size) / band_size));
+    oh_block = div_up(jcp.oh, div_up(jcp.oh, oh_block));
+
+    // take as many output depths per band as threading allows
+    const dim_t other_work = static_cast<dim_t>(jcp.mb) * jcp.ngroups
+            * jcp.nb_oc * jcp.nb_ow * div_up(jcp.oh, oh_block);
+    const dim_t nb_od_thr = nstl::min(static_cast<dim_t>(jcp.od),
+            div_up(static_cast<dim_t>(jcp.nthr), other_work));
+    const int od_block = static_cast<int>(div_up(jcp.od, nb_od_thr));
+    if (od_block == 1) return;
+
+    jcp.od_block = od_block;
+    jcp.oh_block = oh_block;
+    jcp.is_od_inner_loop = true;
+}
+
 status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
@@ -1978,7 +2037,9 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
             (jcp.src_dt == u8 || jcp.src_dt == s8), jcp.wei_dt == s8,
             one_of(jcp.dst_dt, f32, s32, s8, u8, bf16));
 
-    if (jcp.is_1x1)
+    // the upsampled 1x1 convolutions are not supported by the 1x1
+    // implementation
+    if (jcp.is_1x1 && jcp.src_upsampling == 1)
         VDISPATCH_CONV_IC(!allow_perf_heuristics(jcp),
                 VERBOSE_IMPL_HEURISTIC_FAIL,
                 "no optimization for 1x1 convolution");
@@ -2204,6 +2265,16 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         if (try_relo_whi) try_exec_trans = true;
     }
 
+    // only the input transformation upsamples the source, the rows of which
+    // are copied several times to the input buffer
+    if (jcp.src_upsampling > 1) {
+        VDISPATCH_CONV_IC(
+                is_superset(isa, avx512_core), VERBOSE_UNSUPPORTED_ISA);
+        try_exec_base = try_exec_vpad = false;
+        try_relo_wi = try_relo_whi = false;
+        try_exec_trans = true;
+    }
+
     bool must_exec_vpad = false;
 
     // TODO: in future use (kd/kh/kw) and (kd/kh/kw)_pad blocks for more
@@ -2327,6 +2398,7 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
 
     jcp.buffer_size = static_cast<dim_t>(jcp.LDC) * jcp.M;
 
+    init_od_temporal_blocking(jcp);
     jcp.nb_od = div_up(jcp.od, jcp.od_block);
     jcp.nb_oh = div_up(jcp.oh, jcp.oh_block);
 
@@ -2435,6 +2507,9 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
             && IMPLICATION(jcp.exec_type == exec_vpad,
                     jcp.t_pad > 0 || jcp.b_pad > 0 || jcp.f_pad > 0
                             || jcp.back_pad > 0);
+    // The padding compensation depends on the weights only, the source zero
+    // point is applied to it by the kernels.
+    jcp.use_cached_comp_pad = jcp.req_cal_comp_pad && attr.constant_weights_;
 
     // enable ununroll_bd_loop for big shapes to reduce kernel sizes
     jcp.ununroll_bd_loop
@@ -2727,12 +2802,14 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         scratchpad.book(key_conv_amx_tile_buffer,
                 jcp.nthr * jcp.amx_buf_size_per_thread, sizeof(char), 0, P4K);
     }
-    if (jcp.s8s8_compensation_required && jcp.req_cal_comp_pad) {
+    const bool book_comp_pad
+            = jcp.req_cal_comp_pad && !jcp.use_cached_comp_pad;
+    if (jcp.s8s8_compensation_required && book_comp_pad) {
         scratchpad.book(key_brgemm_primitive_buffer_comp,
                 jcp.s8s8_comp_buffer_size, sizeof(int32_t), 0, P4K);
     }
 
-    if (jcp.src_zero_point && jcp.req_cal_comp_pad) {
+    if (jcp.src_zero_point && book_comp_pad) {
         scratchpad.book(key_brgemm_primitive_zp_comp_a, jcp.comp_a_buffer_size,
                 sizeof(int32_t), 0, P4K);
     }
@@ -3070,6 +3147,39 @@ void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
         nthr = nthr_mb * nthr_g * nthr_oc_b * nthr_ic_b;
     }
 
+    // Every thread across the spatial dimension accumulates into its own f32
+    // copy of diff weights, which are reduced in a fixed order afterwards.
+    // Keep the size of these copies bounded by the size of the activations
+    // by moving threads to the channel dimensions, where every thread owns a
+    // distinct slice of diff weights. The move is only taken when the channel
+    // dimensions absorb all the released threads, so the number of threads
+    // and the work per thread stay the same, and only the copies and their
+    // reduction go away.
+    if (nthr_mb > 1) {
+        const dim_t wei_size = (dim_t)jcp.ngroups * jcp.oc * jcp.ic * jcp.kd
+                * jcp.kh * jcp.kw;
+        const dim_t act_size = (dim_t)jcp.mb
+                * (jcp.ngroups * jcp.ic * jcp.id * jcp.ih * jcp.iw
+                        + jcp.ngroups * jcp.oc * jcp.od * jcp.oh * jcp.ow);
+        const int max_nthr_mb = static_cast<int>(nstl::max<dim_t>(
+                1, nstl::min<dim_t>(nthr_mb, act_size / wei_size)));
+        if (nthr_mb > max_nthr_mb) {
+            const int nthr_par = jcp.nthr / (max_nthr_mb * nthr_g);
+            const int new_nthr_oc_b = nstl::min(
+                    oc_chunks, nstl::max(nthr_oc_b, nthr_par / nthr_ic_b));
+            const int new_nthr_ic_b = nstl::min(ic_chunks,
+                    nstl::max(nthr_ic_b, nthr_par / new_nthr_oc_b));
+            const int new_nthr
+                    = max_nthr_mb * nthr_g * new_nthr_oc_b * new_nthr_ic_b;
+            if (new_nthr >= nthr && new_nthr <= jcp.nthr) {
+                nthr_mb = max_nthr_mb;
+                nthr_oc_b = new_nthr_oc_b;
+                nthr_ic_b = new_nthr_ic_b;
+                nthr = new_nthr;
+            }
+        }
+    }
+
     jcp.nthr = nthr;
     jcp.nthr_mb = nthr_mb;
     jcp.nthr_g = nthr_g;
@@ -0,0 +1,266 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/impl_list_item.hpp"
+#include "common/memory.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/reorder.hpp"
+#include "common/stream.hpp"
+#include "common/tag_traits.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_brgemm_group_packed_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t brgemm_group_packed_convolution_fwd_t::pd_t::init_g_block() {
+    // AMX tile is `k_blk` elements deep along input channels and 16 elements
+    // wide along output channels. Tile utilization accounts for the zeros
+    // outside of the diagonal blocks of the packed weights.
+    const bool is_int8 = weights_md_.data_type == data_type::s8;
+    const dim_t k_blk = is_int8 ? 64 : 32;
+    const dim_t n_blk = 16;
+    const dim_t ic = IC() / G();
+    const dim_t oc = OC() / G();
+
+    const auto utilization = [&](dim_t g_block) {
+        const dim_t k = g_block * ic;
+        const dim_t n = g_block * oc;
+        return (float)k / rnd_up(k, k_blk) * n / rnd_up(n, n_blk) / g_block;
+    };
+
+    g_block_ = 1;
+    float best_util = utilization(1);
+    for (dim_t g_block = 2; g_block <= G(); g_block++) {
+        if (G() % g_block != 0) continue;
+        if (g_block * ic > k_blk || g_block * oc > 4 * n_blk) break;
+        const float util = utilization(g_block);
+        if (util > best_util) {
+            best_util = util;
+            g_block_ = g_block;
+        }
+    }
+
+    VDISPATCH_CONV_IC(g_block_ > 1 && best_util > 1.5f * utilization(1),
+            VERBOSE_IMPL_HEURISTIC_FAIL, "no gain from packing groups");
+    return status::success;
+}
+
+status_t brgemm_group_packed_convolution_fwd_t::pd_t::init_convolution(
+        engine_t *engine) {
+    const dim_t G_packed = G() / g_block_;
+    const dim_t ic_packed = g_block_ * (IC() / G());
+    const dim_t oc_packed = g_block_ * (OC() / G());
+
+    dims_t wei_dims;
+    wei_dims[0] = G_packed;
+    wei_dims[1] = oc_packed;
+    wei_dims[2] = ic_packed;
+    for (int d = 3; d < weights_md_.ndims; d++)
+        wei_dims[d] = weights_md_.dims[d];
+    CHECK(memory_desc_init_by_tag(packed_wei_md_, weights_md_.ndims, wei_dims,
+            weights_md_.data_type, get_abx_tag(weights_md_.ndims)));
+
+    memory_desc_t conv_wei_md = packed_wei_md_;
+    conv_wei_md.format_kind = format_kind::any;
+
+    convolution_desc_t cd = convolution_desc_t();
+    const convolution_desc_t *d = desc();
+    CHECK(conv_desc_init(&cd, d->prop_kind, d->alg_kind, &src_md_,
+            &conv_wei_md, &bias_md_, &dst_md_, d->strides, d->dilates,
+            d->padding[0], d->padding[1]));
+
+    const int skip_this_idx
+            = impl_list_item_t::find<pd_t>(engine->get_implementation_list(
+                    reinterpret_cast<const op_desc_t *>(&cd)));
+    primitive_desc_iterator_t it(engine,
+            reinterpret_cast<const op_desc_t *>(&cd), attr(), nullptr,
+            skip_this_idx);
+    if (!it.is_initialized()) return status::out_of_memory;
+
+    // Only AMX brgemm implementations benefit from the packing.
+    while (++it != it.end()) {
+        const std::string impl_name((*it)->name());
+        if (impl_name.find("brg") == std::string::npos) continue;
+        if (impl_name.find("amx") == std::string::npos) continue;
+        conv_pd_ = *it;
+        break;
+    }
+    VDISPATCH_CONV_IC(conv_pd_, VERBOSE_IMPL_HEURISTIC_FAIL,
+            "no brgemm implementation for packed groups");
+
+    return reorder_primitive_desc_create(
+            wei_reorder_pd_, engine, &packed_wei_md_, conv_pd_->weights_md(0));
+}
+
+status_t brgemm_group_packed_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(mayiuse(avx512_core_amx), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(with_groups() && G() > 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "non-grouped convolution");
+
+    const auto src_dt = src_md_.data_type;
+    const auto wei_dt = weights_md_.data_type;
+    const bool is_bf16 = everyone_is(bf16, src_dt, wei_dt);
+    const bool is_int8 = one_of(src_dt, u8, s8) && wei_dt == s8;
+    VDISPATCH_CONV(is_bf16 || is_int8, VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(attr()->post_ops_.find(primitive_kind::convolution) == -1,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_CONV(attr()->zero_points_.has_default_values(DNNL_ARG_WEIGHTS),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+
+    // Channels of `g_block` consecutive groups are consecutive in channels
+    // last activations, so they are shared with the nested convolution.
+    const auto dat_tag = get_axb_tag(ndims());
+    VDISPATCH_CONV(set_default_formats_common(dat_tag, format_tag::undef,
+                           dat_tag),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(memory_desc_matches_tag(src_md_, dat_tag)
+                    && memory_desc_matches_tag(dst_md_, dat_tag),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    // The user weights are plain, they are packed and reordered to the
+    // layout of the nested convolution on each execution.
+    const auto wei_tag = get_abx_tag(ndims() + 1);
+    if (weights_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(weights_md_, wei_tag));
+    VDISPATCH_CONV(memory_desc_matches_tag(weights_md_, wei_tag)
+                    && memory_desc_wrapper(weights_md_).is_dense(),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_g_block());
+    CHECK(init_convolution(engine));
+
+    init_name();
+    init_scratchpad();
+    return status::success;
+}
+
+void brgemm_group_packed_convolution_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    const memory_desc_wrapper packed_wei_d(packed_wei_md_);
+    const memory_desc_wrapper conv_wei_d(conv_pd_->weights_md(0));
+    scratchpad.book(key_conv_group_packed_wei, packed_wei_d.size(), 1);
+    scratchpad.book(
+            key_conv_group_packed_wei_reordered, conv_wei_d.size(), 1);
+    scratchpad.book(
+            key_nested_multiple, wei_reorder_pd_->scratchpad_registry());
+    scratchpad.book(key_nested_multiple + 1, conv_pd_->scratchpad_registry());
+}
+
+status_t brgemm_group_packed_convolution_fwd_t::init(engine_t *engine) {
+    CHECK(pd()->wei_reorder_pd_->create_primitive(wei_reorder_p_, engine));
+    CHECK(pd()->conv_pd_->create_primitive(conv_p_, engine));
+    return status::success;
+}
+
+void brgemm_group_packed_convolution_fwd_t::pack_weights(
+        const exec_ctx_t &ctx) const {
+    const auto *wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    char *packed_wei = ctx.get_scratchpad_grantor().template get<char>(
+            key_conv_group_packed_wei);
+
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const dim_t dt_size = wei_d.data_type_size();
+    const dim_t G = pd()->G();
+    const dim_t g_block = pd()->g_block_;
+    const dim_t oc = pd()->OC() / G;
+    const dim_t ic = pd()->IC() / G;
+    const dim_t ks = pd()->KD() * pd()->KH() * pd()->KW();
+
+    // An output channel of a group and of a block of groups respectively.
+    const dim_t row_size = ic * ks * dt_size;
+    const dim_t packed_row_size = g_block * row_size;
+    const char *wei_base = wei + wei_d.offset0() * dt_size;
+
+    // The output channels of the packed weights enumerate the ones of the
+    // user weights in the same order, each row takes the input channels of
+    // its own group in the diagonal block and zeros elsewhere.
+    parallel_nd(G / g_block, g_block * oc, [&](dim_t gb, dim_t o) {
+        const dim_t row = gb * g_block * oc + o;
+        const dim_t g_in_block = o / oc;
+        char *packed_row = packed_wei + row * packed_row_size;
+        std::memset(packed_row, 0, packed_row_size);
+        std::memcpy(packed_row + g_in_block * row_size,
+                wei_base + row * row_size, row_size);
+    });
+}
+
+status_t brgemm_group_packed_convolution_fwd_t::execute(
+        const exec_ctx_t &ctx) const {
+    engine_t *engine = ctx.stream()->engine();
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+
+    pack_weights(ctx);
+
+    auto packed_wei_mem
+            = scratchpad.get_memory_storage(key_conv_group_packed_wei);
+    std::unique_ptr<memory_t, memory_deleter_t> packed_wei;
+    CHECK(safe_ptr_assign(packed_wei,
+            new memory_t(engine, &(pd()->packed_wei_md_),
+                    std::move(packed_wei_mem))));
+
+    auto conv_wei_mem = scratchpad.get_memory_storage(
+            key_conv_group_packed_wei_reordered);
+    std::unique_ptr<memory_t, memory_deleter_t> conv_wei;
+    CHECK(safe_ptr_assign(conv_wei,
+            new memory_t(engine, pd()->conv_pd_->weights_md(0),
+                    std::move(conv_wei_mem))));
+
+    // reorder packed weights to the layout of the nested convolution
+    exec_args_t r_args;
+    r_args[DNNL_ARG_SRC] = {packed_wei.get(), true};
+    r_args[DNNL_ARG_DST] = {conv_wei.get(), false};
+    exec_ctx_t r_ctx(ctx, std::move(r_args));
+
+    nested_scratchpad_t r_ns(ctx, key_nested_multiple, wei_reorder_p_);
+    r_ctx.set_scratchpad_grantor(r_ns.grantor());
+    CHECK(wei_reorder_p_->execute(r_ctx));
+
+    // execute the packed convolution
+    exec_args_t conv_args = ctx.args(); // copy args to include postops mem.
+    conv_args[DNNL_ARG_WEIGHTS] = {conv_wei.get(), true};
+    exec_ctx_t conv_ctx(ctx, std::move(conv_args));
+
+    nested_scratchpad_t ns(ctx, key_nested_multiple + 1, conv_p_);
+    conv_ctx.set_scratchpad_grantor(ns.grantor());
+    return conv_p_->execute(conv_ctx);
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
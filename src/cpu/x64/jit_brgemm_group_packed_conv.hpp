@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_GROUP_PACKED_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_GROUP_PACKED_CONV_HPP
+
+#include <memory>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Grouped convolution with few channels per group computed as a convolution
+// with `G / g_block` groups of `g_block` times more channels. The weights of
+// `g_block` consecutive groups are packed into a block-diagonal tensor, so
+// AMX tiles are filled with several groups at once instead of being mostly
+// padding. Activations and channel-wise attributes keep the same channel
+// order and are passed to the nested convolution as is.
+struct brgemm_group_packed_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                name_.c_str(), brgemm_group_packed_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        std::shared_ptr<primitive_desc_t> conv_pd_;
+        std::shared_ptr<primitive_desc_t> wei_reorder_pd_;
+        // Plain block-diagonal weights of the nested convolution.
+        memory_desc_t packed_wei_md_;
+        dim_t g_block_ = 1;
+
+    private:
+        std::string name_ = "brg_group_packed:";
+
+        status_t init_g_block();
+        status_t init_convolution(engine_t *engine);
+        void init_name() { name_.append(conv_pd_->name()); }
+        void init_scratchpad();
+    };
+
+    brgemm_group_packed_convolution_fwd_t(const pd_t *apd)
+        : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    void pack_weights(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const {
+        return static_cast<const pd_t *>(primitive_t::pd().get());
+    }
+
+    std::shared_ptr<primitive_t> conv_p_;
+    std::shared_ptr<primitive_t> wei_reorder_p_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -516,7 +516,7 @@ status_t brgemm_inner_product_fwd_t<isa>::execute_forward(
                     break;
             }
         }
-        if (is_amx) amx_tile_release();
+        if (is_amx) amx_tile_lazy_release();
     });
 
     if (jbgp.nthr_ic_b > 1) {
@@ -983,7 +983,7 @@ void brgemm_inner_product_bwd_data_t<isa>::execute_backward_data(
             nd_iterator_step(osc, os_chunks, kd, jbgp.kd, kh, jbgp.kh, kw,
                     jbgp.kw, icb, jbgp.nb_ic);
         }
-        if (is_amx) amx_tile_release();
+        if (is_amx) amx_tile_lazy_release();
     });
 
     if (jbgp.nthr_oc_b > 1) {
@@ -1431,7 +1431,10 @@ void brgemm_inner_product_bwd_weights_t<isa>::compute_diff_weights_and_bias(
         char *a_buffer = ti->get_buffer_a_ptr(sp_icb, osc);
         char *b_buffer = ti->get_buffer_b_ptr(ocb, osc);
 
-        bool kernel_init = (osc == ti->os_c_start);
+        // With a sum, the first thread by minibatch computes directly to
+        // the f32 diff weights and diff bias, and adds to their values.
+        bool kernel_init = (osc == ti->os_c_start)
+                && !(jbgp.with_sum && ti->ithr_os_c == 0);
 
         auto nb_os_b
                 = nstl::min((jbgp.mb - n) / jbgp.os_block, jbgp.nb_os_blocking);
@@ -1677,7 +1680,7 @@ void brgemm_inner_product_bwd_weights_t<isa>::compute_diff_weights_and_bias(
                         osc_idx, osc_work);
         };
     }
-    if (jbgp.is_amx) amx_tile_release();
+    if (jbgp.is_amx) amx_tile_lazy_release();
 }
 
 template <cpu_isa_t isa>
@@ -1687,7 +1690,7 @@ void brgemm_inner_product_bwd_weights_t<
     const auto &jbgp = pd()->jbgp_;
 
     if (dnnl_thr_syncable() && jbgp.nthr > 1)
-        simple_barrier::barrier(ti->barrier_ctx, jbgp.nthr);
+        simple_barrier::barrier(ti->barrier_ctx, jbgp.nthr, ti->ithr);
     if (ti->nthr_os_c == 1) return;
 
     const bool is_f32_out = jbgp.wei_dt == data_type::f32;
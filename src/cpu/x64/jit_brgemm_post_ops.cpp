@@ -41,7 +41,7 @@ dnnl::impl::cpu::x64::jit_brgemm_kernel_diff_bias_t<Vmm>::
     , acc_typesize_(types::data_type_size(acc_dt_))
     , mult_(data_type_vnni_granularity(ddst_dt_)) {}
 
-// This version is used from MatMul for src tensor.
+// This version is used from MatMul for src or weights tensor.
 template <typename Vmm>
 dnnl::impl::cpu::x64::jit_brgemm_kernel_diff_bias_t<Vmm>::
         jit_brgemm_kernel_diff_bias_t(const matmul::brgemm_matmul_conf_t &bgmmc,
@@ -49,8 +49,9 @@ dnnl::impl::cpu::x64::jit_brgemm_kernel_diff_bias_t<Vmm>::
     : jit_generator_t(jit_name())
     , brg_(abrg)
     , reduce_kind_(bgmmc.reduce_kind)
-    // MatMul `src`.
-    , ddst_dt_((bgmmc.isa == avx512_core_fp16 && bgmmc.use_buffer_a)
+    // MatMul `src` or `weights`.
+    , ddst_dt_(reduce_kind_ == matmul_reduce_kind::weights ? bgmmc.wei_dt
+                      : (bgmmc.isa == avx512_core_fp16 && bgmmc.use_buffer_a)
                       ? data_type::f32
                       : bgmmc.src_dt)
     // MatMul `reduce` buffer.
@@ -59,14 +60,21 @@ dnnl::impl::cpu::x64::jit_brgemm_kernel_diff_bias_t<Vmm>::
     , ddst_typesize_(types::data_type_size(ddst_dt_))
     , bia_typesize_(types::data_type_size(bia_dt_))
     , acc_typesize_(types::data_type_size(acc_dt_))
-    // Unused.
-    , mult_(0) {
-    // This kernel must be called after the copy A routine because it assumes
-    // that fp16 data has already been upconverted to f32.
-    // Only reduction for `src` is supported.
-    assert(reduce_kind_ == matmul_reduce_kind::src);
-    // `src` matrix is assumed to have a row major layout.
-    assert(bgmmc.treat_A_as_plain || bgmmc.use_buffer_a);
+    // Used only for `weights`, which are read in the layout of matrix B.
+    , mult_(reduce_kind_ == matmul_reduce_kind::weights
+                      ? data_type_vnni_granularity(ddst_dt_)
+                      : 0) {
+    assert(utils::one_of(reduce_kind_, matmul_reduce_kind::src,
+            matmul_reduce_kind::weights));
+    // For `src`, this kernel must be called after the copy A routine because
+    // it assumes that fp16 data has already been upconverted to f32, and the
+    // matrix is assumed to have a row major layout.
+    assert(IMPLICATION(reduce_kind_ == matmul_reduce_kind::src,
+            bgmmc.treat_A_as_plain || bgmmc.use_buffer_a));
+    // For `weights`, the blocks of B are reduced the way they are passed to
+    // the brgemm kernel, in a layout with N as the innermost dimension.
+    assert(IMPLICATION(reduce_kind_ == matmul_reduce_kind::weights,
+            bgmmc.use_buffer_b || !bgmmc.transposed_B));
 }
 
 template <typename Vmm>
@@ -449,8 +457,10 @@ void dnnl::impl::cpu::x64::jit_brgemm_kernel_diff_bias_t<Vmm>::generate() {
     int tail = 0;
 
     // Currently, `reduce_kind` is `undef` when this kernel is used from
-    // BRGEMM-based Inner Product.
-    if (reduce_kind_ == matmul_reduce_kind::undef) {
+    // BRGEMM-based Inner Product. MatMul `weights` are reduced the same way,
+    // as a matrix B.
+    if (utils::one_of(reduce_kind_, matmul_reduce_kind::undef,
+                matmul_reduce_kind::weights)) {
         tail = brg_.load_dim % brg_.ld_block;
         generate_for_b();
     } else if (reduce_kind_ == matmul_reduce_kind::src) {
@@ -562,8 +572,10 @@ dnnl::impl::cpu::x64::jit_brgemm_kernel_post_ops_t<
         const auto &reserved_eltwise_gpr = reg_reserved_eltwise;
         const auto reserved_eltwise_maskr = Xbyak::Opmask(1);
 
-        const eltwise_injector::static_params_t esp {
+        eltwise_injector::static_params_t esp {
                 save_state, reserved_eltwise_gpr, reserved_eltwise_maskr};
+        esp.fast_approx = eltwise_injector::is_fast_approx_allowed(
+                attr_.fpmath_.mode_);
 
         auto st = safe_ptr_assign(postops_injector_,
                 po_injector_t::create(
@@ -0,0 +1,430 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_brgemm_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace brgemm_sdpa_utils;
+
+namespace {
+// Block sizes are chosen so that the working set of a single (query block,
+// key block) step stays L2-resident for head sizes up to 256: Q block,
+// K block, V block, score tile and output accumulator.
+constexpr dim_t default_q_block = 32;
+constexpr dim_t default_k_block = 64;
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_SDPA(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_SDPA(!is_paged(), "paged keys and values are not supported");
+    VDISPATCH_SDPA(utils::everyone_is(f32, qry_md()->data_type,
+                           key_md()->data_type, val_md()->data_type,
+                           dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(IMPLICATION(with_attn_mask() && !with_causal_mask(),
+                           utils::one_of(attn_mask_md()->data_type, f32, bf16,
+                                   f16)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(IMPLICATION(with_attn_scale(),
+                           utils::one_of(desc()->scale_dt, f32, bf16, f16)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(utils::everyone_is(f32, kq_acc_dt(), vs_acc_dt()),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(!with_key_scales() && !with_key_zp() && !with_value_scales()
+                    && !with_value_zp(),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(attr()->has_default_values(smask_t::none),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(
+            utils::one_of(desc()->softmax_alg, alg_kind::softmax_accurate,
+                    alg_kind::softmax_accurate_inf_as_zero),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_SDPA(utils::everyone_is(4, qry_md()->ndims, key_md()->ndims,
+                           val_md()->ndims, dst_md()->ndims),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_SDPA(IMPLICATION(with_attn_mask() && !with_causal_mask(),
+                           attn_mask_md()->ndims == 4),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_conf(engine));
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::pd_t::init_conf(engine_t *engine) {
+    auto &c = conf_;
+    const memory_desc_wrapper q_d(qry_md());
+    const memory_desc_wrapper k_d(key_md());
+    const memory_desc_wrapper v_d(val_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_SDPA(utils::everyone_is(true, q_d.is_plain(), k_d.is_plain(),
+                           v_d.is_plain(), dst_d.is_plain()),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    const auto &qs = q_d.blocking_desc().strides;
+    const auto &ks = k_d.blocking_desc().strides;
+    const auto &vs = v_d.blocking_desc().strides;
+    const auto &ds = dst_d.blocking_desc().strides;
+
+    // Innermost dimension has to be dense for the A matrices, the B matrix of
+    // the VS product and the destination.
+    VDISPATCH_SDPA(utils::everyone_is(1, qs[3], vs[3], ds[3]),
+            VERBOSE_UNSUPPORTED_TAG);
+    c.k_direct = ks[3] == 1;
+    VDISPATCH_SDPA(c.k_direct || ks[2] == 1, VERBOSE_UNSUPPORTED_TAG);
+
+    c.MB = dst_d.dims()[0];
+    c.HQ = dst_d.dims()[1];
+    c.K_MB = k_d.dims()[0];
+    c.K_H = k_d.dims()[1];
+    c.V_MB = v_d.dims()[0];
+    c.V_H = v_d.dims()[1];
+    VDISPATCH_SDPA(utils::everyone_is(0, c.HQ % c.K_H, c.HQ % c.V_H)
+                    && utils::one_of(c.K_MB, 1, c.MB)
+                    && utils::one_of(c.V_MB, 1, c.MB),
+            VERBOSE_INCONSISTENT_DIM, "keys", 1, "queries", 1);
+
+    c.Q = desc()->queries();
+    c.K = desc()->keys();
+    c.D = desc()->head_size();
+    c.V = desc()->values();
+
+    for (int i = 0; i < 3; i++) {
+        c.q_strides[i] = qs[i];
+        c.v_strides[i] = vs[i];
+        c.dst_strides[i] = ds[i];
+    }
+    for (int i = 0; i < 4; i++)
+        c.k_strides[i] = ks[i];
+
+    c.with_causal_mask = with_causal_mask();
+    c.causal_bottom_right
+            = desc()->mask_type == attn_mask_type::bottom_right;
+    c.with_mask = with_attn_mask() && !c.with_causal_mask;
+    if (c.with_mask) {
+        const memory_desc_wrapper msk_d(attn_mask_md());
+        VDISPATCH_SDPA(msk_d.is_plain(), VERBOSE_UNSUPPORTED_TAG);
+        c.M_MB = msk_d.dims()[0];
+        c.M_H = msk_d.dims()[1];
+        c.M_Q = msk_d.dims()[2];
+        VDISPATCH_SDPA(utils::one_of(c.M_MB, 1, c.MB)
+                        && utils::one_of(c.M_H, 1, c.HQ)
+                        && utils::one_of(c.M_Q, 1, c.Q)
+                        && msk_d.dims()[3] == c.K,
+                VERBOSE_INCONSISTENT_DIM, "mask", 3, "keys", 3);
+        for (int i = 0; i < 4; i++)
+            c.msk_strides[i] = msk_d.blocking_desc().strides[i];
+        c.msk_dt = msk_d.data_type();
+    }
+
+    c.with_scale = with_attn_scale();
+    c.scale_dt = desc()->scale_dt;
+    c.invert_scale = desc()->invert_scale;
+    c.inf_as_zero
+            = desc()->softmax_alg == alg_kind::softmax_accurate_inf_as_zero;
+
+    c.q_block = nstl::min(default_q_block, c.Q);
+    c.k_block = nstl::min(default_k_block, c.K);
+    c.nb_q = div_up(c.Q, c.q_block);
+    c.q_tail = c.Q % c.q_block;
+    c.nb_k = div_up(c.K, c.k_block);
+    c.k_tail = c.K % c.k_block;
+
+    c.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::pd_t::init_brgemm_descs() {
+    using namespace data_type;
+    const auto &c = conf_;
+    bcps_.resize(8);
+
+    auto init_bcp = [&](int idx, dim_t M, dim_t N, dim_t K, dim_t LDA,
+                            dim_t LDB, dim_t LDC, float beta) {
+        if (M * N * K == 0) return status::success;
+        auto &bcp = bcps_[idx];
+        CHECK(brgemm_desc_init(&bcp, isa, brgemm_addr, f32, f32,
+                false /*transA*/, false /*transB*/, brgemm_row_major, 1.f,
+                beta, LDA, LDB, LDC, M, N, K));
+        brgemm_attr_t brg_attr;
+        brg_attr.max_bs = 1;
+        CHECK(brgemm_desc_set_attr(&bcp, brg_attr));
+        CHECK(brgemm_desc_finalize(&bcp));
+        return status::success;
+    };
+
+    const dim_t ldk = c.k_direct ? c.k_strides[2] : c.k_block;
+    for_(int m_tail = 0; m_tail < 2; m_tail++)
+    for (int nk_tail = 0; nk_tail < 2; nk_tail++) {
+        const dim_t M = m_tail ? c.q_tail : c.q_block;
+        const dim_t N_or_K = nk_tail ? c.k_tail : c.k_block;
+        // S = Q * K, scores are written into a dense q_block x k_block tile.
+        CHECK(init_bcp(get_brg_idx(false, m_tail, nk_tail), M, N_or_K, c.D,
+                c.q_strides[2], ldk, c.k_block, 0.f));
+        // O += P * V, accumulator is a dense q_block x values tile.
+        CHECK(init_bcp(get_brg_idx(true, m_tail, nk_tail), M, c.V, N_or_K,
+                c.k_block, c.v_strides[2], c.V, 1.f));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_sdpa_fwd_t<isa>::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    const size_t nthr = c.nthr;
+    scratchpad.template book<float>(
+            key_sdpa_scores, nthr * c.q_block * c.k_block);
+    scratchpad.template book<float>(key_sdpa_acc, nthr * c.q_block * c.V);
+    // Running maximum and sum of exponents for every query of a block.
+    scratchpad.template book<float>(key_sdpa_stats, nthr * 2 * c.q_block);
+    if (!c.k_direct)
+        scratchpad.template book<float>(
+                key_sdpa_key_pack, nthr * c.D * c.k_block);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::init(engine_t *engine) {
+    const auto &bcps = pd()->bcps_;
+    brg_kernels_.resize(bcps.size());
+
+    for (size_t idx = 0; idx < bcps.size(); ++idx) {
+        const auto &bcp = bcps[idx];
+        if (bcp.bcast_dim * bcp.load_dim * bcp.reduce_dim == 0) continue;
+        brgemm_kernel_t *brg_kernel = nullptr;
+        CHECK(brgemm_kernel_create(&brg_kernel, bcp));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], brg_kernel));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+
+    const auto *qry = CTX_IN_MEM(const float *, DNNL_ARG_QUERIES);
+    const auto *key = CTX_IN_MEM(const float *, DNNL_ARG_KEYS);
+    const auto *val = CTX_IN_MEM(const float *, DNNL_ARG_VALUES);
+    const auto *msk = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    auto *dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    float scale = 1.f;
+    if (c.with_scale) {
+        const auto *scale_ptr = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+        scale = io::load_float_value(c.scale_dt, scale_ptr, 0);
+        if (c.invert_scale) scale = 1.f / scale;
+    }
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *scores_base = scratchpad.template get<float>(key_sdpa_scores);
+    float *acc_base = scratchpad.template get<float>(key_sdpa_acc);
+    float *stats_base = scratchpad.template get<float>(key_sdpa_stats);
+    float *kpack_base = c.k_direct
+            ? nullptr
+            : scratchpad.template get<float>(key_sdpa_key_pack);
+
+    const dim_t k_group = c.HQ / c.K_H;
+    const dim_t v_group = c.HQ / c.V_H;
+    const dim_t causal_shift = c.causal_bottom_right ? c.K - c.Q : 0;
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+
+    const dim_t work_amount = c.MB * c.HQ * c.nb_q;
+    parallel(c.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        float *scores = scores_base + ithr * c.q_block * c.k_block;
+        float *acc = acc_base + ithr * c.q_block * c.V;
+        float *row_max = stats_base + ithr * 2 * c.q_block;
+        float *row_sum = row_max + c.q_block;
+        float *kpack = c.k_direct ? nullptr
+                                  : kpack_base + ithr * c.D * c.k_block;
+
+        brgemm_batch_element_t batch;
+
+        dim_t mb {0}, h {0}, qb {0};
+        nd_iterator_init(start, mb, c.MB, h, c.HQ, qb, c.nb_q);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t q0 = qb * c.q_block;
+            const dim_t cur_q = nstl::min(c.q_block, c.Q - q0);
+            const bool m_tail = cur_q < c.q_block;
+
+            const float *q_ptr = qry + mb * c.q_strides[0]
+                    + h * c.q_strides[1] + q0 * c.q_strides[2];
+            const float *k_ptr = key + (c.K_MB == 1 ? 0 : mb) * c.k_strides[0]
+                    + (h / k_group) * c.k_strides[1];
+            const float *v_ptr = val + (c.V_MB == 1 ? 0 : mb) * c.v_strides[0]
+                    + (h / v_group) * c.v_strides[1];
+            float *dst_ptr = dst + mb * c.dst_strides[0]
+                    + h * c.dst_strides[1] + q0 * c.dst_strides[2];
+
+            // Keys past the diagonal of the last query row are masked out
+            // for every row of the block and can be skipped entirely.
+            dim_t k_end = c.K;
+            if (c.with_causal_mask)
+                k_end = nstl::max(dim_t(0),
+                        nstl::min(c.K, q0 + cur_q + causal_shift));
+
+            for (dim_t i = 0; i < cur_q; i++) {
+                row_max[i] = neg_inf;
+                row_sum[i] = 0.f;
+            }
+            std::memset(acc, 0, sizeof(float) * c.q_block * c.V);
+
+            for (dim_t k0 = 0; k0 < k_end; k0 += c.k_block) {
+                const dim_t cur_k = nstl::min(c.k_block, c.K - k0);
+                const bool k_tail = cur_k < c.k_block;
+
+                const float *k_blk = k_ptr + k0 * c.k_strides[3];
+                if (!c.k_direct) {
+                    // Keys are stored as [keys][head_size], transpose the
+                    // block into a dense [head_size][k_block] panel.
+                    for_(dim_t j = 0; j < cur_k; j++)
+                    for (dim_t d = 0; d < c.D; d++)
+                        kpack[d * c.k_block + j]
+                                = k_blk[j * c.k_strides[3] + d];
+                    k_blk = kpack;
+                }
+
+                batch.ptr.A = q_ptr;
+                batch.ptr.B = k_blk;
+                brgemm_kernel_execute(
+                        brg_kernels_[get_brg_idx(false, m_tail, k_tail)].get(),
+                        1, &batch, scores);
+
+                for (dim_t i = 0; i < cur_q; i++) {
+                    float *s = scores + i * c.k_block;
+                    const dim_t q_idx = q0 + i;
+
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t j = 0; j < cur_k; j++)
+                        s[j] *= scale;
+
+                    if (c.with_mask) {
+                        const dim_t m_off
+                                = (c.M_MB == 1 ? 0 : mb) * c.msk_strides[0]
+                                + (c.M_H == 1 ? 0 : h) * c.msk_strides[1]
+                                + (c.M_Q == 1 ? 0 : q_idx) * c.msk_strides[2]
+                                + k0 * c.msk_strides[3];
+                        for (dim_t j = 0; j < cur_k; j++)
+                            s[j] += io::load_float_value(c.msk_dt, msk,
+                                    m_off + j * c.msk_strides[3]);
+                    }
+
+                    if (c.with_causal_mask) {
+                        const dim_t first_masked = nstl::max(
+                                dim_t(0), q_idx + causal_shift + 1 - k0);
+                        for (dim_t j = first_masked; j < cur_k; j++)
+                            s[j] = neg_inf;
+                    }
+
+                    float blk_max = row_max[i];
+                    for (dim_t j = 0; j < cur_k; j++)
+                        blk_max = nstl::max(blk_max, s[j]);
+
+                    // Until the first unmasked key is met the running
+                    // statistics are empty; use a zero reference to avoid
+                    // (-inf) - (-inf) and let the finalization decide what a
+                    // fully masked row turns into.
+                    const float ref_max = std::isinf(blk_max) ? 0.f : blk_max;
+                    const float corr = std::isinf(row_max[i])
+                            ? 0.f
+                            : std::exp(row_max[i] - ref_max);
+
+                    float blk_sum = 0.f;
+                    PRAGMA_OMP_SIMD(reduction(+ : blk_sum))
+                    for (dim_t j = 0; j < cur_k; j++) {
+                        s[j] = std::exp(s[j] - ref_max);
+                        blk_sum += s[j];
+                    }
+
+                    row_sum[i] = row_sum[i] * corr + blk_sum;
+                    row_max[i] = blk_max;
+
+                    if (corr != 1.f) {
+                        float *o = acc + i * c.V;
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t v = 0; v < c.V; v++)
+                            o[v] *= corr;
+                    }
+                }
+
+                batch.ptr.A = scores;
+                batch.ptr.B = v_ptr + k0 * c.v_strides[2];
+                brgemm_kernel_execute(
+                        brg_kernels_[get_brg_idx(true, m_tail, k_tail)].get(),
+                        1, &batch, acc);
+            }
+
+            for (dim_t i = 0; i < cur_q; i++) {
+                const float *o = acc + i * c.V;
+                float *d = dst_ptr + i * c.dst_strides[2];
+                const bool zero_row = c.inf_as_zero && row_sum[i] == 0.f;
+                const float inv_sum = zero_row ? 0.f : 1.f / row_sum[i];
+                PRAGMA_OMP_SIMD()
+                for (dim_t v = 0; v < c.V; v++)
+                    d[v] = o[v] * inv_sum;
+            }
+
+            nd_iterator_step(mb, c.MB, h, c.HQ, qb, c.nb_q);
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_sdpa_fwd_t<avx512_core>;
+template struct brgemm_sdpa_fwd_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
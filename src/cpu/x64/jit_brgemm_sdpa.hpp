@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SDPA_HPP
+#define CPU_X64_JIT_BRGEMM_SDPA_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace brgemm_sdpa_utils {
+
+struct conf_t {
+    dim_t MB, HQ; // outer batch and number of query heads
+    dim_t K_MB, K_H; // batch and heads of the key tensor
+    dim_t V_MB, V_H; // batch and heads of the value tensor
+    dim_t M_MB, M_H, M_Q; // attention mask dims, 1 means broadcast
+    dim_t Q, K, D, V; // queries, keys, head size, values
+
+    // Strides in elements. The innermost dimension of Q, V and dst is dense.
+    dim_t q_strides[3], k_strides[4], v_strides[3], dst_strides[3];
+    dim_t msk_strides[4];
+
+    // When false, the key tensor is stored in [keys][head_size] order and each
+    // key block is transposed into a dense [head_size][k_block] buffer.
+    bool k_direct;
+
+    dim_t q_block, k_block;
+    dim_t nb_q, q_tail, nb_k, k_tail;
+
+    bool with_scale, invert_scale, with_mask, with_causal_mask;
+    bool causal_bottom_right, inf_as_zero;
+    data_type_t scale_dt, msk_dt;
+
+    int nthr;
+};
+
+// Returns the index of the kernel in the list of BRGEMM descriptors. Index
+// layout: [is_vs][m_tail][n_or_k_tail].
+inline int get_brg_idx(bool is_vs, bool m_tail, bool nk_tail) {
+    return (is_vs ? 4 : 0) + (m_tail ? 2 : 0) + (nk_tail ? 1 : 0);
+}
+
+} // namespace brgemm_sdpa_utils
+
+// Flash-attention style SDPA: queries are split into blocks and, for every
+// block, keys and values are consumed in blocks while maintaining running
+// softmax statistics. The score tile of a single (query block, key block)
+// pair lives in a per-thread buffer, so the full QK^T matrix is never
+// materialized.
+template <cpu_isa_t isa>
+struct brgemm_sdpa_fwd_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg:", isa, ""),
+                brgemm_sdpa_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        brgemm_sdpa_utils::conf_t conf_ = utils::zero<decltype(conf_)>();
+        std::vector<brgemm_desc_t> bcps_;
+
+    private:
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_sdpa_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::vector<std::unique_ptr<brgemm_kernel_t>> brg_kernels_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
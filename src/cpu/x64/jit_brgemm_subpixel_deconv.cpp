@@ -0,0 +1,363 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/convolution_pd.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/reorder.hpp"
+#include "common/stream.hpp"
+#include "common/tag_traits.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_brgemm_subpixel_deconv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t brgemm_subpixel_deconvolution_fwd_t::pd_t::init_phase_convolution(
+        engine_t *engine, phase_t &phase, const dim_t *pad_l,
+        const dim_t *pad_r) {
+    const int nsp = ndims() - 2;
+    const int w_ndims = ndims() + with_groups();
+
+    dims_t wei_dims, dst_dims, strides, dilates, padding_l, padding_r;
+    for (int d = 0; d < w_ndims - nsp; d++)
+        wei_dims[d] = weights_md_.dims[d];
+    dst_dims[0] = dst_md_.dims[0];
+    dst_dims[1] = dst_md_.dims[1];
+    for (int sp = 0; sp < nsp; sp++) {
+        const int i = 3 - nsp + sp;
+        wei_dims[w_ndims - nsp + sp] = phase.kp[i];
+        dst_dims[2 + sp] = phase.op[i];
+        strides[sp] = 1;
+        dilates[sp] = 0;
+        padding_l[sp] = pad_l[i];
+        padding_r[sp] = pad_r[i];
+    }
+    CHECK(memory_desc_init_by_tag(phase.wei_md, w_ndims, wei_dims,
+            weights_md_.data_type, get_abx_tag(w_ndims)));
+    CHECK(memory_desc_init_by_tag(phase.dst_md, ndims(), dst_dims,
+            dst_md_.data_type, get_axb_tag(ndims())));
+
+    memory_desc_t conv_wei_md = phase.wei_md;
+    conv_wei_md.format_kind = format_kind::any;
+
+    convolution_desc_t cd = convolution_desc_t();
+    CHECK(conv_desc_init(&cd, desc()->prop_kind, alg_kind::convolution_direct,
+            &src_md_, &conv_wei_md, &bias_md_, &phase.dst_md, strides,
+            dilates, padding_l, padding_r));
+
+    primitive_desc_iterator_t it(
+            engine, reinterpret_cast<const op_desc_t *>(&cd), attr(), nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+
+    // Dense convolutions only pay off with AMX brgemm implementations.
+    while (++it != it.end()) {
+        const std::string impl_name((*it)->name());
+        if (impl_name.find("brg") == std::string::npos) continue;
+        if (impl_name.find("amx") == std::string::npos) continue;
+        phase.conv_pd = *it;
+        break;
+    }
+    VDISPATCH_DECONVOLUTION_IC(phase.conv_pd, VERBOSE_IMPL_HEURISTIC_FAIL,
+            "no brgemm implementation for sub-pixel convolution");
+
+    return reorder_primitive_desc_create(phase.wei_reorder_pd, engine,
+            &phase.wei_md, phase.conv_pd->weights_md(0));
+}
+
+status_t brgemm_subpixel_deconvolution_fwd_t::pd_t::init_phases(
+        engine_t *engine) {
+    const int nsp = ndims() - 2;
+    const int w_ndims = ndims() + with_groups();
+
+    dim_t K[3], P[3], I[3], O[3];
+    for (int i = 0; i < 3; i++) {
+        const int sp = i - (3 - nsp);
+        const bool is_trivial = sp < 0;
+        K[i] = is_trivial ? 1 : weights_md_.dims[w_ndims - nsp + sp];
+        strides_[i] = is_trivial ? 1 : desc()->strides[sp];
+        P[i] = is_trivial ? 0 : desc()->padding[0][sp];
+        I[i] = is_trivial ? 1 : src_md_.dims[2 + sp];
+        O[i] = is_trivial ? 1 : dst_md_.dims[2 + sp];
+        // Every phase must have at least one output point and one tap.
+        VDISPATCH_DECONVOLUTION_IC(K[i] >= strides_[i] && O[i] >= strides_[i],
+                VERBOSE_UNSUPPORTED_FEATURE, "kernel smaller than stride");
+        VDISPATCH_DECONVOLUTION_IC(
+                P[i] >= 0, VERBOSE_UNSUPPORTED_PAD_FEATURE, "negative padding");
+    }
+
+    // Output point `o = op * S + r` is computed from the taps
+    // `k = k0 + j * S` with `k0 = (r + P) % S` and the input points
+    // `i = op + c - j` with `c = (r + P - k0) / S`, that is a convolution with
+    // unit stride and the sub-kernel taps in reverse order.
+    for_(dim_t rd = 0; rd < strides_[0]; rd++)
+    for_(dim_t rh = 0; rh < strides_[1]; rh++)
+    for (dim_t rw = 0; rw < strides_[2]; rw++) {
+        const dim_t r[3] = {rd, rh, rw};
+        phase_t phase;
+        dim_t pad_l[3], pad_r[3];
+        for (int i = 0; i < 3; i++) {
+            const dim_t S = strides_[i];
+            phase.r[i] = r[i];
+            phase.k0[i] = (r[i] + P[i]) % S;
+            phase.kp[i] = div_up(K[i] - phase.k0[i], S);
+            phase.op[i] = div_up(O[i] - r[i], S);
+            const dim_t c = (r[i] + P[i] - phase.k0[i]) / S;
+            pad_l[i] = phase.kp[i] - 1 - c;
+            pad_r[i] = phase.op[i] + c - I[i];
+            VDISPATCH_DECONVOLUTION_IC(pad_l[i] >= 0 && pad_r[i] >= 0,
+                    VERBOSE_UNSUPPORTED_PAD_FEATURE,
+                    "negative padding of sub-pixel convolution");
+        }
+        CHECK(init_phase_convolution(engine, phase, pad_l, pad_r));
+        phases_.push_back(phase);
+    }
+    return status::success;
+}
+
+status_t brgemm_subpixel_deconvolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_DECONVOLUTION(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_DECONVOLUTION(desc()->alg_kind == alg_kind::deconvolution_direct,
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_DECONVOLUTION(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_DECONVOLUTION(mayiuse(avx512_core_amx), VERBOSE_UNSUPPORTED_ISA);
+
+    const auto skip_mask
+            = smask_t::post_ops | smask_t::scales | smask_t::zero_points;
+    VDISPATCH_DECONVOLUTION(
+            attr()->has_default_values(skip_mask, dst_md_.data_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+    // Phases are computed into an intermediate buffer, so post-ops that read
+    // the destination or depend on the spatial position are not supported.
+    VDISPATCH_DECONVOLUTION(
+            attr()->post_ops_.has_default_values({primitive_kind::eltwise}),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_DECONVOLUTION(
+            attr()->zero_points_.has_default_values(DNNL_ARG_SRC)
+                    && attr()->zero_points_.has_default_values(
+                            DNNL_ARG_WEIGHTS),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+
+    bool has_strides = false;
+    for (int sp = 0; sp < ndims() - 2; sp++) {
+        has_strides = has_strides || desc()->strides[sp] > 1;
+        VDISPATCH_DECONVOLUTION(desc()->dilates[sp] == 0,
+                VERBOSE_UNSUPPORTED_FEATURE, "dilation");
+    }
+    VDISPATCH_DECONVOLUTION(
+            has_strides, VERBOSE_UNSUPPORTED_FEATURE, "unit strides");
+
+    // Output phases are interleaved with whole channel vectors.
+    const auto dat_tag = get_axb_tag(ndims());
+    if (src_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(src_md_, dat_tag));
+    if (dst_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(dst_md_, dat_tag));
+    VDISPATCH_DECONVOLUTION(memory_desc_matches_tag(src_md_, dat_tag)
+                    && memory_desc_matches_tag(dst_md_, dat_tag),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    // The user weights are plain, the sub-kernels are extracted and reordered
+    // to the layout of the nested convolutions on each execution.
+    const auto wei_tag = get_abx_tag(ndims() + with_groups());
+    if (weights_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(weights_md_, wei_tag));
+    VDISPATCH_DECONVOLUTION(memory_desc_matches_tag(weights_md_, wei_tag)
+                    && weights_md_.extra.flags == 0,
+            VERBOSE_UNSUPPORTED_TAG);
+    if (bias_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(bias_md_, format_tag::x));
+    CHECK(attr_.set_default_formats(&dst_md_));
+
+    CHECK(init_phases(engine));
+
+    init_name();
+    init_scratchpad();
+    return status::success;
+}
+
+void brgemm_subpixel_deconvolution_fwd_t::pd_t::init_scratchpad() {
+    // Phases are computed one after another and share the buffers.
+    size_t wei_size = 0, conv_wei_size = 0, dst_size = 0;
+    const memory_tracking::registry_t *reorder_registry = nullptr;
+    const memory_tracking::registry_t *conv_registry = nullptr;
+    for (const auto &phase : phases_) {
+        const memory_desc_wrapper wei_d(phase.wei_md);
+        const memory_desc_wrapper conv_wei_d(phase.conv_pd->weights_md(0));
+        const memory_desc_wrapper dst_d(phase.dst_md);
+        wei_size = nstl::max(wei_size, wei_d.size());
+        conv_wei_size = nstl::max(conv_wei_size, conv_wei_d.size());
+        dst_size = nstl::max(dst_size, dst_d.size());
+        const auto &r_registry = phase.wei_reorder_pd->scratchpad_registry();
+        if (!reorder_registry || r_registry.size() > reorder_registry->size())
+            reorder_registry = &r_registry;
+        const auto &c_registry = phase.conv_pd->scratchpad_registry();
+        if (!conv_registry || c_registry.size() > conv_registry->size())
+            conv_registry = &c_registry;
+    }
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_deconv_subpixel_wei, wei_size, 1);
+    scratchpad.book(key_deconv_subpixel_wei_reordered, conv_wei_size, 1);
+    scratchpad.book(key_deconv_subpixel_dst, dst_size, 1);
+    scratchpad.book(key_nested_multiple, *reorder_registry);
+    scratchpad.book(key_nested_multiple + 1, *conv_registry);
+}
+
+status_t brgemm_subpixel_deconvolution_fwd_t::init(engine_t *engine) {
+    for (const auto &phase : pd()->phases_) {
+        std::shared_ptr<primitive_t> wei_reorder_p, conv_p;
+        CHECK(phase.wei_reorder_pd->create_primitive(wei_reorder_p, engine));
+        CHECK(phase.conv_pd->create_primitive(conv_p, engine));
+        wei_reorder_ps_.push_back(wei_reorder_p);
+        conv_ps_.push_back(conv_p);
+    }
+    return status::success;
+}
+
+void brgemm_subpixel_deconvolution_fwd_t::extract_weights(
+        const exec_ctx_t &ctx, const pd_t::phase_t &phase,
+        char *phase_wei) const {
+    const auto *wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const dim_t dt_size = wei_d.data_type_size();
+    const dim_t *S = pd()->strides_;
+    const dim_t KH = pd()->KH(), KW = pd()->KW();
+    const dim_t ks = pd()->KD() * KH * KW;
+    const dim_t *kp = phase.kp;
+    const dim_t *k0 = phase.k0;
+    const dim_t kps = kp[0] * kp[1] * kp[2];
+    const char *wei_base = wei + wei_d.offset0() * dt_size;
+
+    // Every pair of output and input channels is a row of spatial taps.
+    parallel_nd(wei_d.nelems() / ks, [&](dim_t row) {
+        const char *w = wei_base + row * ks * dt_size;
+        char *pw = phase_wei + row * kps * dt_size;
+        for_(dim_t jd = 0; jd < kp[0]; jd++)
+        for_(dim_t jh = 0; jh < kp[1]; jh++)
+        for (dim_t jw = 0; jw < kp[2]; jw++) {
+            const dim_t kd = k0[0] + (kp[0] - 1 - jd) * S[0];
+            const dim_t kh = k0[1] + (kp[1] - 1 - jh) * S[1];
+            const dim_t kw = k0[2] + (kp[2] - 1 - jw) * S[2];
+            std::memcpy(pw + ((jd * kp[1] + jh) * kp[2] + jw) * dt_size,
+                    w + ((kd * KH + kh) * KW + kw) * dt_size, dt_size);
+        }
+    });
+}
+
+void brgemm_subpixel_deconvolution_fwd_t::interleave_dst(
+        const exec_ctx_t &ctx, const pd_t::phase_t &phase,
+        const char *phase_dst) const {
+    auto *dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const dim_t dt_size = dst_d.data_type_size();
+    const dim_t *S = pd()->strides_;
+    const dim_t OD = pd()->OD(), OH = pd()->OH(), OW = pd()->OW();
+    const dim_t *op = phase.op;
+    const dim_t *r = phase.r;
+    const dim_t c_size = pd()->OC() * dt_size;
+    char *dst_base = dst + dst_d.offset0() * dt_size;
+
+    parallel_nd(pd()->MB(), op[0], op[1], [&](dim_t n, dim_t opd, dim_t oph) {
+        const dim_t od = opd * S[0] + r[0];
+        const dim_t oh = oph * S[1] + r[1];
+        const char *src_row = phase_dst
+                + ((n * op[0] + opd) * op[1] + oph) * op[2] * c_size;
+        char *dst_row = dst_base + ((n * OD + od) * OH + oh) * OW * c_size;
+        for (dim_t opw = 0; opw < op[2]; opw++)
+            std::memcpy(dst_row + (opw * S[2] + r[2]) * c_size,
+                    src_row + opw * c_size, c_size);
+    });
+}
+
+status_t brgemm_subpixel_deconvolution_fwd_t::execute(
+        const exec_ctx_t &ctx) const {
+    engine_t *engine = ctx.stream()->engine();
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    char *phase_wei = scratchpad.get<char>(key_deconv_subpixel_wei);
+    const char *phase_dst = scratchpad.get<char>(key_deconv_subpixel_dst);
+
+    const auto &phases = pd()->phases_;
+    for (size_t p = 0; p < phases.size(); p++) {
+        const auto &phase = phases[p];
+
+        extract_weights(ctx, phase, phase_wei);
+
+        std::unique_ptr<memory_t, memory_deleter_t> wei;
+        CHECK(safe_ptr_assign(wei,
+                new memory_t(engine, &phase.wei_md,
+                        scratchpad.get_memory_storage(
+                                key_deconv_subpixel_wei))));
+        std::unique_ptr<memory_t, memory_deleter_t> conv_wei;
+        CHECK(safe_ptr_assign(conv_wei,
+                new memory_t(engine, phase.conv_pd->weights_md(0),
+                        scratchpad.get_memory_storage(
+                                key_deconv_subpixel_wei_reordered))));
+        std::unique_ptr<memory_t, memory_deleter_t> conv_dst;
+        CHECK(safe_ptr_assign(conv_dst,
+                new memory_t(engine, &phase.dst_md,
+                        scratchpad.get_memory_storage(
+                                key_deconv_subpixel_dst))));
+
+        // reorder the sub-kernel to the layout of the nested convolution
+        exec_args_t r_args;
+        r_args[DNNL_ARG_SRC] = {wei.get(), true};
+        r_args[DNNL_ARG_DST] = {conv_wei.get(), false};
+        exec_ctx_t r_ctx(ctx, std::move(r_args));
+
+        nested_scratchpad_t r_ns(ctx, key_nested_multiple, wei_reorder_ps_[p]);
+        r_ctx.set_scratchpad_grantor(r_ns.grantor());
+        CHECK(wei_reorder_ps_[p]->execute(r_ctx));
+
+        // compute the phase
+        exec_args_t conv_args = ctx.args(); // copy args to include attr mem.
+        conv_args[DNNL_ARG_WEIGHTS] = {conv_wei.get(), true};
+        conv_args[DNNL_ARG_DST] = {conv_dst.get(), false};
+        exec_ctx_t conv_ctx(ctx, std::move(conv_args));
+
+        nested_scratchpad_t ns(ctx, key_nested_multiple + 1, conv_ps_[p]);
+        conv_ctx.set_scratchpad_grantor(ns.grantor());
+        CHECK(conv_ps_[p]->execute(conv_ctx));
+
+        interleave_dst(ctx, phase, phase_dst);
+    }
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SUBPIXEL_DECONV_HPP
+#define CPU_X64_JIT_BRGEMM_SUBPIXEL_DECONV_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_deconvolution_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Strided deconvolution computed as `SD * SH * SW` dense convolutions with
+// unit strides, one per phase of the output. The output points of a phase
+// depend only on the weights taps with the same remainder modulo the strides,
+// so every nested convolution works on a sub-kernel of the weights and skips
+// no work. The result of each phase is interleaved into the destination.
+struct brgemm_subpixel_deconvolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_deconvolution_fwd_pd_t {
+        using cpu_deconvolution_fwd_pd_t::cpu_deconvolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                name_.c_str(), brgemm_subpixel_deconvolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Spatial dimensions are ordered as depth, height and width, the ones
+        // missing in 1D and 2D problems are trivial.
+        struct phase_t {
+            // The first output point of the phase.
+            dim_t r[3];
+            // The first weights tap of the phase and the sub-kernel sizes.
+            dim_t k0[3];
+            dim_t kp[3];
+            // The number of output points of the phase.
+            dim_t op[3];
+            memory_desc_t wei_md;
+            memory_desc_t dst_md;
+            std::shared_ptr<primitive_desc_t> conv_pd;
+            std::shared_ptr<primitive_desc_t> wei_reorder_pd;
+        };
+
+        std::vector<phase_t> phases_;
+        dim_t strides_[3];
+
+    private:
+        std::string name_ = "brg_subpixel_deconv:";
+
+        status_t init_phases(engine_t *engine);
+        status_t init_phase_convolution(engine_t *engine, phase_t &phase,
+                const dim_t *pad_l, const dim_t *pad_r);
+        void init_name() { name_.append(phases_[0].conv_pd->name()); }
+        void init_scratchpad();
+    };
+
+    brgemm_subpixel_deconvolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    void extract_weights(const exec_ctx_t &ctx, const pd_t::phase_t &phase,
+            char *phase_wei) const;
+    void interleave_dst(const exec_ctx_t &ctx, const pd_t::phase_t &phase,
+            const char *phase_dst) const;
+    const pd_t *pd() const {
+        return static_cast<const pd_t *>(primitive_t::pd().get());
+    }
+
+    std::vector<std::shared_ptr<primitive_t>> conv_ps_;
+    std::vector<std::shared_ptr<primitive_t>> wei_reorder_ps_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,547 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_brgemm_winograd_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace data_type;
+using namespace brgemm_wino_utils;
+
+namespace {
+
+constexpr int max_alpha = 6;
+// The channels of a tile are transformed by chunks that fit into registers
+// and L1 together with the alpha * alpha points of the tile.
+constexpr dim_t c_chunk = 64;
+
+constexpr dim_t default_tile_blk = 16;
+constexpr dim_t default_oc_blk = 64;
+
+// Transform matrices of F(2x2, 3x3).
+const float BT_2[4 * 4] = {
+        1, 0, -1, 0, //
+        0, 1, 1, 0, //
+        0, -1, 1, 0, //
+        0, 1, 0, -1, //
+};
+const float G_2[4 * 3] = {
+        1, 0, 0, //
+        0.5f, 0.5f, 0.5f, //
+        0.5f, -0.5f, 0.5f, //
+        0, 0, 1, //
+};
+const float AT_2[2 * 4] = {
+        1, 1, 1, 0, //
+        0, 1, -1, -1, //
+};
+
+// Transform matrices of F(4x4, 3x3).
+const float BT_4[6 * 6] = {
+        4, 0, -5, 0, 1, 0, //
+        0, -4, -4, 1, 1, 0, //
+        0, 4, -4, -1, 1, 0, //
+        0, -2, -1, 2, 1, 0, //
+        0, 2, -1, -2, 1, 0, //
+        0, 4, 0, -5, 0, 1, //
+};
+const float G_4[6 * 3] = {
+        1.f / 4, 0, 0, //
+        -1.f / 6, -1.f / 6, -1.f / 6, //
+        -1.f / 6, 1.f / 6, -1.f / 6, //
+        1.f / 24, 1.f / 12, 1.f / 6, //
+        1.f / 24, -1.f / 12, 1.f / 6, //
+        0, 0, 1, //
+};
+const float AT_4[4 * 6] = {
+        1, 1, 1, 1, 1, 0, //
+        0, 1, -1, 2, -2, 0, //
+        0, 1, 1, 4, 4, 0, //
+        0, 1, -1, 8, -8, 1, //
+};
+
+const float *get_BT(int m) {
+    return m == 4 ? BT_4 : BT_2;
+}
+const float *get_G(int m) {
+    return m == 4 ? G_4 : G_2;
+}
+const float *get_AT(int m) {
+    return m == 4 ? AT_4 : AT_2;
+}
+
+// Transforms the tile `t` of the input into the row `t_local` of the alpha *
+// alpha matrices V, each matrix is a [tile_blk, ic_pad] row-major array.
+template <typename src_data_t>
+void transform_src_tile(const conf_t &c, const src_data_t *src,
+        src_data_t *V, dim_t t, dim_t t_local) {
+    const int alpha = c.alpha;
+    const float *BT = get_BT(c.m);
+
+    const dim_t n = t / (c.tiles_h * c.tiles_w);
+    const dim_t th = (t / c.tiles_w) % c.tiles_h;
+    const dim_t tw = t % c.tiles_w;
+    const dim_t ih0 = th * c.m - c.t_pad;
+    const dim_t iw0 = tw * c.m - c.l_pad;
+    const dim_t V_stride = c.tile_blk * c.ic_pad;
+
+    float d[max_alpha * max_alpha][c_chunk];
+    float tmp[max_alpha * max_alpha][c_chunk];
+
+    for (dim_t c0 = 0; c0 < c.ic; c0 += c_chunk) {
+        const dim_t cb = nstl::min(c_chunk, c.ic - c0);
+
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < alpha; j++) {
+            const dim_t ih = ih0 + i;
+            const dim_t iw = iw0 + j;
+            float *d_ij = d[i * alpha + j];
+            if (ih < 0 || ih >= c.ih || iw < 0 || iw >= c.iw) {
+                for (dim_t cc = 0; cc < cb; cc++)
+                    d_ij[cc] = 0.f;
+                continue;
+            }
+            const src_data_t *s
+                    = src + ((n * c.ih + ih) * c.iw + iw) * c.ic + c0;
+            PRAGMA_OMP_SIMD()
+            for (dim_t cc = 0; cc < cb; cc++)
+                d_ij[cc] = static_cast<float>(s[cc]);
+        }
+
+        // tmp = BT * d
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < alpha; j++) {
+            float *acc = tmp[i * alpha + j];
+            for (dim_t cc = 0; cc < cb; cc++)
+                acc[cc] = 0.f;
+            for (int k = 0; k < alpha; k++) {
+                const float b = BT[i * alpha + k];
+                if (b == 0.f) continue;
+                const float *d_kj = d[k * alpha + j];
+                PRAGMA_OMP_SIMD()
+                for (dim_t cc = 0; cc < cb; cc++)
+                    acc[cc] += b * d_kj[cc];
+            }
+        }
+
+        // V = tmp * B
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < alpha; j++) {
+            float acc[c_chunk];
+            for (dim_t cc = 0; cc < cb; cc++)
+                acc[cc] = 0.f;
+            for (int k = 0; k < alpha; k++) {
+                const float b = BT[j * alpha + k];
+                if (b == 0.f) continue;
+                const float *tmp_ik = tmp[i * alpha + k];
+                PRAGMA_OMP_SIMD()
+                for (dim_t cc = 0; cc < cb; cc++)
+                    acc[cc] += b * tmp_ik[cc];
+            }
+            src_data_t *v = V + (i * alpha + j) * V_stride
+                    + t_local * c.ic_pad + c0;
+            PRAGMA_OMP_SIMD()
+            for (dim_t cc = 0; cc < cb; cc++)
+                v[cc] = static_cast<src_data_t>(acc[cc]);
+        }
+    }
+
+    // The padded channels meet zero weights, but must not be garbage.
+    for_(int p = 0; p < alpha * alpha; p++)
+    for (dim_t cc = c.ic; cc < c.ic_pad; cc++)
+        V[p * V_stride + t_local * c.ic_pad + cc]
+                = static_cast<src_data_t>(0.f);
+}
+
+// Transforms the row `t_local` of the alpha * alpha matrices M, each matrix
+// is a [tile_blk, oc_blk] row-major array, into the tile `t` of dst for the
+// output channels [oc0, oc0 + ocb).
+template <typename dst_data_t>
+void transform_dst_tile(const conf_t &c, const float *M, const void *bias,
+        dst_data_t *dst, dim_t t, dim_t t_local, dim_t oc0, dim_t ocb) {
+    const int alpha = c.alpha;
+    const int m = c.m;
+    const float *AT = get_AT(m);
+
+    const dim_t n = t / (c.tiles_h * c.tiles_w);
+    const dim_t th = (t / c.tiles_w) % c.tiles_h;
+    const dim_t tw = t % c.tiles_w;
+    const dim_t M_stride = c.tile_blk * c.oc_blk;
+
+    float b[c_chunk];
+    float tmp[max_alpha * max_alpha][c_chunk];
+
+    for (dim_t c0 = 0; c0 < ocb; c0 += c_chunk) {
+        const dim_t cb = nstl::min(c_chunk, ocb - c0);
+        for (dim_t cc = 0; cc < cb; cc++)
+            b[cc] = c.with_bias
+                    ? io::load_float_value(c.bia_dt, bias, oc0 + c0 + cc)
+                    : 0.f;
+
+        // tmp = AT * M
+        for_(int i = 0; i < m; i++)
+        for (int j = 0; j < alpha; j++) {
+            float *acc = tmp[i * alpha + j];
+            for (dim_t cc = 0; cc < cb; cc++)
+                acc[cc] = 0.f;
+            for (int k = 0; k < alpha; k++) {
+                const float a = AT[i * alpha + k];
+                if (a == 0.f) continue;
+                const float *m_kj = M + (k * alpha + j) * M_stride
+                        + t_local * c.oc_blk + c0;
+                PRAGMA_OMP_SIMD()
+                for (dim_t cc = 0; cc < cb; cc++)
+                    acc[cc] += a * m_kj[cc];
+            }
+        }
+
+        // Y = tmp * A
+        for_(int i = 0; i < m; i++)
+        for (int j = 0; j < m; j++) {
+            const dim_t oh = th * m + i;
+            const dim_t ow = tw * m + j;
+            if (oh >= c.oh || ow >= c.ow) continue;
+            float acc[c_chunk];
+            for (dim_t cc = 0; cc < cb; cc++)
+                acc[cc] = b[cc];
+            for (int k = 0; k < alpha; k++) {
+                const float a = AT[j * alpha + k];
+                if (a == 0.f) continue;
+                const float *tmp_ik = tmp[i * alpha + k];
+                PRAGMA_OMP_SIMD()
+                for (dim_t cc = 0; cc < cb; cc++)
+                    acc[cc] += a * tmp_ik[cc];
+            }
+            dst_data_t *d = dst + ((n * c.oh + oh) * c.ow + ow) * c.oc + oc0
+                    + c0;
+            PRAGMA_OMP_SIMD()
+            for (dim_t cc = 0; cc < cb; cc++)
+                d[cc] = static_cast<dst_data_t>(acc[cc]);
+        }
+    }
+}
+
+} // namespace
+
+status_t brgemm_winograd_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    const bool is_f32 = expect_data_types(f32, f32, undef, f32, f32)
+            && IMPLICATION(with_bias(), weights_md(1)->data_type == f32);
+    const bool is_bf16 = expect_data_types(bf16, bf16, undef, undef, f32)
+            && one_of(dst_md()->data_type, f32, bf16)
+            && IMPLICATION(with_bias(),
+                    one_of(weights_md(1)->data_type, f32, bf16));
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(desc()->alg_kind == alg_kind::convolution_winograd,
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(is_f32 || is_bf16, VERBOSE_UNSUPPORTED_DT);
+    conf_.isa = is_f32 ? avx512_core : avx512_core_bf16;
+    VDISPATCH_CONV(mayiuse(conf_.isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(ndims() == 4, VERBOSE_UNSUPPORTED_FEATURE,
+            "only 2D convolutions are supported");
+    VDISPATCH_CONV(!with_groups(), VERBOSE_UNSUPPORTED_FEATURE,
+            "grouped convolutions are not supported");
+    VDISPATCH_CONV(everyone_is(3, KH(), KW()), VERBOSE_UNSUPPORTED_FEATURE,
+            "only 3x3 kernels are supported");
+    VDISPATCH_CONV(everyone_is(1, KSH(), KSW()), VERBOSE_UNSUPPORTED_FEATURE,
+            "only unit strides are supported");
+    VDISPATCH_CONV(everyone_is(0, KDH(), KDW()), VERBOSE_UNSUPPORTED_FEATURE,
+            "dilations are not supported");
+    using namespace format_tag;
+    VDISPATCH_CONV(set_default_formats_common(nhwc, hwio, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    VDISPATCH_CONV(src_d.matches_one_of_tag(nhwc)
+                    && dst_d.matches_one_of_tag(nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    // The weights are read once per execution to be transformed, so any
+    // plain layout works.
+    VDISPATCH_CONV(wei_d.is_plain(), VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_conf());
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_winograd_convolution_fwd_t::pd_t::init_conf() {
+    auto &c = conf_;
+
+    c.src_dt = src_md()->data_type;
+    c.wei_dt = weights_md()->data_type;
+    c.dst_dt = dst_md()->data_type;
+    c.with_bias = with_bias();
+    c.bia_dt = c.with_bias ? weights_md(1)->data_type : undef;
+
+    c.mb = MB();
+    c.ic = IC();
+    c.oc = OC();
+    c.ih = IH();
+    c.iw = IW();
+    c.oh = OH();
+    c.ow = OW();
+    c.t_pad = padT();
+    c.l_pad = padL();
+    c.use_cached_wei = attr()->constant_weights_;
+
+    // F(4x4, 3x3) does 4 times fewer multiplications than a direct
+    // convolution but amplifies the rounding errors, which bf16 does not
+    // afford. Small images do not have enough outputs for the larger tiles.
+    const bool use_f4 = c.src_dt == f32 && nstl::min(c.oh, c.ow) >= 4;
+    c.m = use_f4 ? 4 : 2;
+    c.alpha = c.m + 2;
+    c.tiles_h = div_up(c.oh, c.m);
+    c.tiles_w = div_up(c.ow, c.m);
+    c.ntiles = c.mb * c.tiles_h * c.tiles_w;
+
+    c.vnni_granularity = c.src_dt == bf16 ? 2 : 1;
+    c.ic_pad = rnd_up(c.ic, c.vnni_granularity);
+
+    c.tile_blk = nstl::min(default_tile_blk, c.ntiles);
+    c.nb_tiles = div_up(c.ntiles, c.tile_blk);
+    c.tile_tail = c.ntiles % c.tile_blk;
+    c.oc_blk = nstl::min(default_oc_blk, c.oc);
+    c.nb_oc = div_up(c.oc, c.oc_blk);
+    c.oc_tail = c.oc % c.oc_blk;
+
+    c.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+status_t brgemm_winograd_convolution_fwd_t::pd_t::init_brgemm_descs() {
+    const auto &c = conf_;
+    bcps_.resize(4);
+
+    // M = V * U: V is a [tiles, ic_pad] block of the transformed input, U is
+    // the [ic_pad, oc] transformed weights in VNNI layout for bf16.
+    for_(int m_tail = 0; m_tail < 2; m_tail++)
+    for (int n_tail = 0; n_tail < 2; n_tail++) {
+        const dim_t M = m_tail ? c.tile_tail : c.tile_blk;
+        const dim_t N = n_tail ? c.oc_tail : c.oc_blk;
+        if (M * N == 0) continue;
+        auto &bcp = bcps_[get_brg_idx(m_tail, n_tail)];
+        CHECK(brgemm_desc_init(&bcp, c.isa, brgemm_addr, c.src_dt, c.wei_dt,
+                false /*transA*/, false /*transB*/, brgemm_row_major, 1.f,
+                0.f, c.ic_pad, c.oc, c.oc_blk, M, N, c.ic_pad));
+        brgemm_attr_t brg_attr;
+        brg_attr.max_bs = 1;
+        CHECK(brgemm_desc_set_attr(&bcp, brg_attr));
+        CHECK(brgemm_desc_finalize(&bcp));
+    }
+
+    return status::success;
+}
+
+void brgemm_winograd_convolution_fwd_t::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    const size_t dt_sz = types::data_type_size(c.src_dt);
+    const size_t npoints = c.alpha * c.alpha;
+    const size_t nthr = c.nthr;
+    if (!c.use_cached_wei)
+        scratchpad.book(key_wino_U, npoints * c.ic_pad * c.oc, dt_sz);
+    scratchpad.book(
+            key_wino_V, nthr * npoints * c.tile_blk * c.ic_pad, dt_sz, 64);
+    scratchpad.template book<float>(
+            key_wino_M, nthr * npoints * c.tile_blk * c.oc_blk);
+}
+
+status_t brgemm_winograd_convolution_fwd_t::init(engine_t *engine) {
+    const auto &bcps = pd()->bcps_;
+    brg_kernels_.resize(bcps.size());
+
+    for (size_t idx = 0; idx < bcps.size(); ++idx) {
+        const auto &bcp = bcps[idx];
+        if (bcp.bcast_dim * bcp.load_dim * bcp.reduce_dim == 0) continue;
+        brgemm_kernel_t *brg_kernel = nullptr;
+        CHECK(brgemm_kernel_create(&brg_kernel, bcp));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], brg_kernel));
+    }
+
+    return status::success;
+}
+
+template <typename src_data_t>
+void brgemm_winograd_convolution_fwd_t::transform_weights(
+        const void *wei, src_data_t *U) const {
+    const auto &c = pd()->conf_;
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+
+    const int alpha = c.alpha;
+    const int vnni = c.vnni_granularity;
+
+    // U = G * g * GT for every pair of channels. The matrices of U are
+    // [ic_pad, oc] arrays, in VNNI layout [ic_pad / vnni, oc, vnni].
+    const float *G = get_G(c.m);
+    parallel_nd(c.ic_pad, c.oc, [&](dim_t ic, dim_t oc) {
+        float g[3 * 3] = {0};
+        if (ic < c.ic) {
+            for_(int kh = 0; kh < 3; kh++)
+            for (int kw = 0; kw < 3; kw++)
+                g[kh * 3 + kw] = io::load_float_value(
+                        c.wei_dt, wei, wei_d.off(oc, ic, kh, kw));
+        }
+        float tmp[max_alpha * 3];
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < 3; j++) {
+            float acc = 0.f;
+            for (int k = 0; k < 3; k++)
+                acc += G[i * 3 + k] * g[k * 3 + j];
+            tmp[i * 3 + j] = acc;
+        }
+        const dim_t u_off = ((ic / vnni) * c.oc + oc) * vnni + ic % vnni;
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < alpha; j++) {
+            float acc = 0.f;
+            for (int k = 0; k < 3; k++)
+                acc += tmp[i * 3 + k] * G[j * 3 + k];
+            U[(i * alpha + j) * c.ic_pad * c.oc + u_off]
+                    = static_cast<src_data_t>(acc);
+        }
+    });
+}
+
+template <typename src_data_t>
+void brgemm_winograd_convolution_fwd_t::get_cached_weights(const void *wei,
+        uint64_t weights_id, std::shared_ptr<std::vector<char>> &U) const {
+    const auto &c = pd()->conf_;
+
+    std::lock_guard<std::mutex> lock(wei_cache_.mutex);
+    // Weights without an id, e.g. the ones of an internal memory, are
+    // transformed on every execution.
+    if (!wei_cache_.data || weights_id == 0
+            || wei_cache_.weights_id != weights_id) {
+        const size_t size = c.alpha * c.alpha * c.ic_pad * c.oc;
+        auto data = std::make_shared<std::vector<char>>(
+                size * sizeof(src_data_t));
+        transform_weights(wei, reinterpret_cast<src_data_t *>(data->data()));
+        wei_cache_.weights_id = weights_id;
+        wei_cache_.data = std::move(data);
+    }
+    U = wei_cache_.data;
+}
+
+template <typename src_data_t, typename dst_data_t>
+status_t brgemm_winograd_convolution_fwd_t::execute_impl(
+        const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+
+    const auto *src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    const auto *wei = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    const auto *bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    auto *dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    auto *V_base = scratchpad.template get<src_data_t>(key_wino_V);
+    auto *M_base = scratchpad.template get<float>(key_wino_M);
+
+    const int npoints = c.alpha * c.alpha;
+    const int vnni = c.vnni_granularity;
+
+    std::shared_ptr<std::vector<char>> cached_U;
+    src_data_t *U = nullptr;
+    if (c.use_cached_wei) {
+        const memory_t *weights_mem = ctx.input(DNNL_ARG_WEIGHTS);
+        get_cached_weights<src_data_t>(
+                wei, weights_mem ? weights_mem->data_id() : 0, cached_U);
+        U = reinterpret_cast<src_data_t *>(cached_U->data());
+    } else {
+        U = scratchpad.template get<src_data_t>(key_wino_U);
+        transform_weights(wei, U);
+    }
+
+    const dim_t work_amount = c.nb_tiles * c.nb_oc;
+    parallel(nstl::min<dim_t>(c.nthr, work_amount), [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        src_data_t *V = V_base + ithr * npoints * c.tile_blk * c.ic_pad;
+        float *M = M_base + ithr * npoints * c.tile_blk * c.oc_blk;
+        brgemm_batch_element_t batch;
+
+        // Consecutive work items share the block of tiles, which is
+        // transformed only when it changes.
+        dim_t last_tb = -1;
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t tb = iwork / c.nb_oc;
+            const dim_t ocb = iwork % c.nb_oc;
+            const dim_t t0 = tb * c.tile_blk;
+            const dim_t cur_t = nstl::min(c.tile_blk, c.ntiles - t0);
+            const dim_t oc0 = ocb * c.oc_blk;
+            const dim_t cur_oc = nstl::min(c.oc_blk, c.oc - oc0);
+
+            if (tb != last_tb) {
+                for (dim_t t = 0; t < cur_t; t++)
+                    transform_src_tile(c, src, V, t0 + t, t);
+                last_tb = tb;
+            }
+
+            const auto *kernel = brg_kernels_[get_brg_idx(
+                    cur_t < c.tile_blk, cur_oc < c.oc_blk)]
+                                         .get();
+            for (int p = 0; p < npoints; p++) {
+                batch.ptr.A = V + p * c.tile_blk * c.ic_pad;
+                batch.ptr.B = U + p * c.ic_pad * c.oc + oc0 * vnni;
+                brgemm_kernel_execute(
+                        kernel, 1, &batch, M + p * c.tile_blk * c.oc_blk);
+            }
+
+            for (dim_t t = 0; t < cur_t; t++)
+                transform_dst_tile(c, M, bias, dst, t0 + t, t, oc0, cur_oc);
+        }
+    });
+
+    return status::success;
+}
+
+status_t brgemm_winograd_convolution_fwd_t::execute(
+        const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+    if (c.src_dt == f32) return execute_impl<float, float>(ctx);
+    if (c.dst_dt == f32) return execute_impl<bfloat16_t, float>(ctx);
+    return execute_impl<bfloat16_t, bfloat16_t>(ctx);
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
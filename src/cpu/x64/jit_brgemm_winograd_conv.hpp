@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINOGRAD_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_WINOGRAD_CONV_HPP
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace brgemm_wino_utils {
+
+struct conf_t {
+    cpu_isa_t isa;
+    data_type_t src_dt, wei_dt, bia_dt, dst_dt;
+
+    dim_t mb, ic, oc, ih, iw, oh, ow, t_pad, l_pad;
+    bool with_bias;
+
+    // F(m x m, 3 x 3): every tile of m x m outputs is computed from a tile of
+    // alpha x alpha inputs, alpha = m + 2.
+    int m, alpha;
+    dim_t tiles_h, tiles_w, ntiles;
+
+    // IC rounded up to the VNNI granularity of the transformed data.
+    dim_t ic_pad;
+    int vnni_granularity;
+
+    // The tiles and the output channels are processed by blocks. A block of
+    // tiles gives the M dimension of the alpha * alpha GEMMs, a block of
+    // output channels the N dimension.
+    dim_t tile_blk, nb_tiles, tile_tail;
+    dim_t oc_blk, nb_oc, oc_tail;
+
+    // The transformed weights are kept between the executions with constant
+    // weights instead of being computed in the scratchpad every time.
+    bool use_cached_wei;
+
+    int nthr;
+};
+
+// Returns the index of the kernel in the list of BRGEMM descriptors. Index
+// layout: [m_tail][n_tail].
+inline int get_brg_idx(bool m_tail, bool n_tail) {
+    return (m_tail ? 2 : 0) + (n_tail ? 1 : 0);
+}
+
+} // namespace brgemm_wino_utils
+
+// Winograd forward convolution F(4x4, 3x3) and F(2x2, 3x3) for 3x3 kernels
+// with unit strides. The weights and the tiles of the input are transformed,
+// then the alpha * alpha independent products in the transformed domain are
+// computed with BRGEMM kernels, and the output tiles are transformed back.
+// A block of input tiles is transformed into a per-thread buffer that stays
+// in cache for all blocks of output channels it is multiplied with.
+struct brgemm_winograd_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_wino:", conf_.isa, ""),
+                brgemm_winograd_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        brgemm_wino_utils::conf_t conf_ = utils::zero<decltype(conf_)>();
+        std::vector<brgemm_desc_t> bcps_;
+
+    private:
+        status_t init_conf();
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_winograd_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    template <typename src_data_t, typename dst_data_t>
+    status_t execute_impl(const exec_ctx_t &ctx) const;
+    template <typename src_data_t>
+    void transform_weights(const void *wei, src_data_t *U) const;
+    template <typename src_data_t>
+    void get_cached_weights(const void *wei, uint64_t weights_id,
+            std::shared_ptr<std::vector<char>> &U) const;
+
+    std::vector<std::unique_ptr<brgemm_kernel_t>> brg_kernels_;
+
+    // The transformed weights of the weights memory, see memory_t::data_id(),
+    // of the last execution with constant weights.
+    struct wei_cache_t {
+        std::mutex mutex;
+        uint64_t weights_id = 0;
+        std::shared_ptr<std::vector<char>> data;
+    };
+    mutable wei_cache_t wei_cache_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -17,6 +17,7 @@
 #ifndef CPU_X64_JIT_GENERATOR_HPP
 #define CPU_X64_JIT_GENERATOR_HPP
 
+#include <cstring>
 #include <limits.h>
 #include <vector>
 
@@ -27,6 +28,7 @@
 
 #include "cpu/x64/cpu_isa_traits.hpp"
 
+#include "cpu/jit_utils/code_arena.hpp"
 #include "cpu/jit_utils/jit_utils.hpp"
 
 #if defined(_WIN32) && !defined(__GNUC__)
@@ -2744,7 +2746,15 @@ public:
                   /*allocator=*/this)
         , max_cpu_isa_(max_cpu_isa) {}
 
-    ~jit_generator_t() override = default;
+    ~jit_generator_t() override {
+        // The code generator does not free or protect a buffer it does not
+        // own.
+        if (in_code_arena_) {
+            jit_utils::code_arena::free(top_);
+            top_ = nullptr;
+            maxSize_ = 0;
+        }
+    }
 
     virtual const char *name() const = 0;
     virtual const char *source_file() const = 0;
@@ -2776,13 +2786,36 @@ public:
 private:
     const cpu_isa_t max_cpu_isa_;
     const Xbyak::uint8 *getCode() {
-        this->ready();
+        if (move_to_code_arena()) {
+            // The regions of the arena stay executable, only the jumps are
+            // patched for the new location.
+            calcJmpAddress();
+        } else {
+            this->ready();
+        }
         if (!is_initialized()) return nullptr;
         const Xbyak::uint8 *code = CodeGenerator::getCode();
         register_jit_code(code, getSize());
         return code;
     }
 
+    // Moves the generated code from the buffer of the code generator to the
+    // code arena. The jumps are not patched yet, so the code is relocatable
+    // the same way it is when the buffer grows.
+    bool move_to_code_arena() {
+        if (!is_initialized() || hasUndefinedLabel()) return false;
+        const size_t size = getSize();
+        auto *code = static_cast<Xbyak::uint8 *>(
+                jit_utils::code_arena::alloc(size));
+        if (!code) return false;
+        std::memcpy(code, top_, size);
+        Xbyak::MmapAllocator::free(top_);
+        top_ = code;
+        maxSize_ = size;
+        in_code_arena_ = true;
+        return true;
+    }
+
     inline bool is_valid_isa(cpu_isa_t isa) {
         return is_subset(isa, max_cpu_isa_) && mayiuse(isa);
     }
@@ -2792,6 +2825,7 @@ private:
     }
 
     static constexpr unsigned max_code_size = 256 * 1024;
+    bool in_code_arena_ = false;
 
 protected:
     virtual void generate() = 0;
@@ -734,6 +734,9 @@ struct jit_brgemm_conv_conf_t {
     inline bool is_relo() const { return is_relo_whi() || is_relo_wi(); }
 
     int id, ih, iw, od, oh, ow, os, is, idp, ihp, iwp, icp, odp, ohp, owp, ocp;
+    // the factor of the nearest neighbor upsampling of the source applied by
+    // the input transformation, id, ih and iw are the upsampled dimensions
+    int src_upsampling {1};
     int f_pad, l_pad, t_pad;
     int back_pad, r_pad, b_pad;
     int l_ovf, r_ovf, t_ovf, b_ovf, f_ovf, back_ovf;
@@ -751,6 +754,9 @@ struct jit_brgemm_conv_conf_t {
     bool is_fused_conv;
     bool is_is_blocking;
     bool is_os_blocking;
+    // iterate over output depths inside of a block of output rows to reuse
+    // the input planes shared by neighbouring output depths
+    bool is_od_inner_loop {false};
     bool is_rtus;
     bool is_reduced_rtus;
     size_t rtus_ic_size, rtus_padded_ic_size;
@@ -825,6 +831,8 @@ struct jit_brgemm_conv_conf_t {
     bool dst_zero_point;
     bool req_brg_comp_pad;
     bool req_cal_comp_pad;
+    // The padding compensation is computed once for constant weights.
+    bool use_cached_comp_pad {false};
     bool is_bf32 {false};
     bool is_tf32 {false};
     bool is_fp8 {false};
@@ -918,6 +926,9 @@ struct jit_binary_conf_t {
     bool is_f16 = false;
     bool is_ternary_op = false;
     bool is_src_different_layouts = false;
+    // dst is written with non-temporal stores, only set for the kernel used
+    // by the no broadcast strategy when dst is aligned.
+    bool use_nt_stores = false;
     dim_t outer_dims = 1;
     int src1_stride = 1;
     int not_bcasted_sp_dims = 0;
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdint>
 #include <functional>
 
 #include "common/dnnl_thread.hpp"
@@ -228,6 +229,16 @@ status_t jit_uni_binary_t::pd_t::init(engine_t *engine) {
         VDISPATCH_BINARY(mayiuse(avx2), "unsupported isa for ternary op");
     }
 
+    // Outputs larger than the cache are written with non-temporal stores by
+    // the no broadcast strategy. int8 values don't fill a full vector
+    // register on store and the sum post-op brings dst to the cache anyway.
+    with_nt_stores_kernel_ = !conf_.is_i8 && !conf_.do_sum
+            && !conf_.is_src_different_layouts
+            && !conf_.postops_per_oc_broadcast_exists
+            && utils::one_of(conf_.bcast_type, bcast_t::none, bcast_t::scalar)
+            && io::is_nt_stores_beneficial(
+                    memory_desc_wrapper(dst_md(0)).size());
+
     return status::success;
 }
 
@@ -567,9 +578,10 @@ bool jit_uni_binary_t::post_ops_ok(const primitive_attr_t *attr,
                             }));
 }
 
-binary_kernel_t *create_binary_kernel(
-        const jit_uni_binary_t::pd_t *pd, bool tail_kernel) {
-    const auto &conf = pd->get_conf();
+binary_kernel_t *create_binary_kernel(const jit_uni_binary_t::pd_t *pd,
+        bool tail_kernel, bool use_nt_stores = false) {
+    auto conf = pd->get_conf();
+    conf.use_nt_stores = use_nt_stores;
     const memory_desc_wrapper src0_d(pd->src_md(0));
     // No support for different blocked memory layouts
     const auto blk_size = src0_d.blocking_desc().inner_blks[0];
@@ -700,6 +712,13 @@ status_t jit_uni_binary_t::init(engine_t *engine) {
     CHECK(safe_ptr_assign(
             kernel_, create_binary_kernel(pd(), false /*tail_kernel*/)));
 
+    if (pd()->with_nt_stores_kernel_) {
+        CHECK(safe_ptr_assign(kernel_nt_,
+                create_binary_kernel(pd(), false /*tail_kernel*/,
+                        true /*use_nt_stores*/)));
+        CHECK(kernel_nt_->create_kernel());
+    }
+
     if (utils::one_of(pd()->dst_md(0)->data_type, f32, s32, bf16, f16)) {
         const memory_desc_wrapper src0_d(pd_->src_md(0));
         const auto &simd_w = kernel_->simd_w();
@@ -810,10 +829,22 @@ void jit_uni_binary_t::execute_no_bcast_strategy(const data_t *src0,
 
         const bool point_broadcast = bcast_type == bcast_t::scalar;
 
+        // Every thread starts on a vector boundary, so the stores of the
+        // non-temporal kernel are aligned when dst is.
+        const bool use_nt_stores = kernel_nt_
+                && reinterpret_cast<uintptr_t>(dst) % kernel_->vlen() == 0;
+        const auto kernel_main
+                = use_nt_stores ? kernel_nt_.get() : kernel_.get();
+
         // Compute strategy:
         // Compute number of vectors, divide it equally between all threads.
-        // Last one will also handle a tail if present.
-        parallel(0, [&](const int ithr, const int nthr) {
+        // Last one will also handle a tail if present. Small problems are
+        // given the threads their traffic is worth.
+        const dim_t bytes = nelems0
+                * (src0_type_size + (point_broadcast ? 0 : src1_type_size)
+                        + dst_type_size);
+        const int nthr = nthr_by_work(0, bytes, min_bytes_per_thr);
+        parallel(nthr, [&](const int ithr, const int nthr) {
             dim_t start = 0, end = 0;
             balance211(nelems0_simd + has_tail, nthr, ithr, start, end);
             if (start >= end) return;
@@ -834,7 +865,7 @@ void jit_uni_binary_t::execute_no_bcast_strategy(const data_t *src0,
             p.scales_src1 = src1_scales;
             p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
             p.dst_orig = dst;
-            (*kernel)(&p);
+            (*kernel_main)(&p);
         });
     }
 }
@@ -42,6 +42,9 @@ struct jit_uni_binary_t : public primitive_t {
 
         jit_binary_conf_t get_conf() const { return conf_; };
 
+        // A kernel with non-temporal stores is created for large outputs.
+        bool with_nt_stores_kernel_ = false;
+
     private:
         op_t get_op_type(const memory_desc_wrapper &src0_d);
         bool is_only_dim0_bcasted(const dims_t &bcast_dims, const int ndims);
@@ -106,6 +109,8 @@ private:
     std::unique_ptr<binary_kernel_t> kernel_;
     // used only in bcast_c_blocked strategy if tail exists
     std::unique_ptr<binary_kernel_t> kernel_tail_;
+    // used only in no bcast strategy if dst is aligned
+    std::unique_ptr<binary_kernel_t> kernel_nt_;
 };
 
 } // namespace x64
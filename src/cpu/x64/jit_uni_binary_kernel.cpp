@@ -99,7 +99,8 @@ jit_uni_binary_kernel_t<isa, Vmm>::jit_uni_binary_kernel_t(
             = {conf_.src0_type, conf_.src1_type, conf_.dst_type};
     if (conf.is_ternary_op) dts.emplace(conf_.src2_type);
 
-    io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, isa, dts, {false},
+    io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, isa, dts,
+            {conf_.use_nt_stores},
             io::io_tail_conf_t {simd_w_, tail_size_, tail_opmask_,
                     vmm_tail_vmask_.getIdx(), reg_tmp_},
             io::io_emu_bf16_conf_t {vreg_bf16_emu_1_, vreg_bf16_emu_2_,
@@ -773,6 +774,7 @@ void jit_uni_binary_kernel_t<isa, Vmm>::generate() {
         forward_over_outer_dims();
     else
         forward();
+    if (conf_.use_nt_stores) sfence();
     postamble();
 
     if ((conf_.with_eltwise || conf_.is_i8) && postops_injector_)
@@ -14,16 +14,22 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdint>
+
 #include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/nstl.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/platform.hpp"
+
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
+#include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
 #include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_uni_eltwise.hpp"
 #include "cpu/x64/utils/jit_io_helper.hpp"
 
@@ -41,6 +47,8 @@ struct jit_args_t {
     const void *dst; // fwd: dst;  bwd: diff_src;
     const void *diff_dst; // fwd: nullptr;  bwd: diff_dst;
     size_t work_amount;
+    const void *post_ops_binary_rhs_arg_vec; // fwd only
+    const void *dst_orig; // fwd only
 };
 
 struct jit_uni_eltwise_kernel_t : public jit_generator_t {
@@ -79,13 +87,14 @@ template <cpu_isa_t isa>
 struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_kernel)
 
-    jit_uni_kernel_t(const eltwise_pd_t *pd)
+    jit_uni_kernel_t(const eltwise_pd_t *pd, bool use_nt_stores = false)
         : jit_uni_eltwise_kernel_t(pd, jit_name(), isa)
         , vlen_(is_bf16() || is_f16() ? cpu_isa_traits_t<isa>::vlen / 2
                           : is_f8()   ? cpu_isa_traits_t<isa>::vlen / 4
                                       : cpu_isa_traits_t<isa>::vlen)
         , simd_w_(vlen_ / dtype_size())
-        , is_fwd_(pd_->is_fwd()) {
+        , is_fwd_(pd_->is_fwd())
+        , use_nt_stores_(use_nt_stores) {
 
         const auto &desc = *pd_->desc();
         // we can consider that there's no auxiliary vregs on fwd path
@@ -95,8 +104,11 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         eltwise_injector_.reset(new jit_uni_eltwise_injector_t<injector_isa>(
                 this, desc.alg_kind, desc.alpha, desc.beta, 1.f, data_type::f32,
                 save_state, reg_injector_table, injector_mask, is_fwd_,
-                pd_->use_dst()));
-        io::io_conf_t io_conf;
+                pd_->use_dst(), /* preserve_vmm = */ true,
+                /* preserve_p_table = */ true,
+                eltwise_injector::is_fast_approx_allowed(
+                        pd_->attr()->fpmath_.mode_)));
+        io::io_conf_t io_conf(use_nt_stores_);
         io::io_tail_conf_t io_tail_conf(simd_w_, tail_size_, tail_opmask_idx_,
                 vmm_tail_mask.getIdx(), reg_tmp);
         io::io_emu_bf16_conf_t io_bf16_conf(emu_zmm_1_idx_, emu_zmm_2_idx_,
@@ -107,11 +119,55 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, get_io_isa(isa),
                 {data_type()}, io_conf, io_tail_conf, io_bf16_conf, {},
                 utils::nullopt, io_fp8_conf);
+
+        const auto &post_ops = pd_->attr()->post_ops_;
+        with_postops_ = is_fwd_ && post_ops.len() != 0;
+        with_binary_ = post_ops.find(primitive_kind::binary) != -1;
+        if (with_postops_) init_postops_injector();
+    }
+
+    void init_postops_injector() {
+        static constexpr bool preserve_gpr = false;
+        static constexpr bool preserve_vmm = false;
+        static constexpr bool use_exact_tail_scalar_bcast = false;
+
+        const memory_desc_wrapper dst_d(pd_->dst_md());
+        const binary_injector::rhs_arg_static_params_t rhs_sp {
+                static_cast<size_t>(vmm_rhs_helper.getIdx()), r11, r12, r13,
+                preserve_gpr, preserve_vmm,
+                GET_OFF(post_ops_binary_rhs_arg_vec), GET_OFF(dst_orig), dst_d,
+                static_cast<size_t>(tail_size_), Opmask(tail_opmask_idx_),
+                use_exact_tail_scalar_bcast};
+        const binary_injector::static_params_t bsp {abi_param1,
+                binary_injector::get_all_strategies_supported_by_injector(),
+                rhs_sp};
+
+        // Eltwise post-ops keep their own table pointer so that the one of
+        // the primitive algorithm stays loaded across the loop.
+        eltwise_injector::static_params_t esp;
+        esp.p_table_ = reg_po_injector_table;
+        esp.fast_approx = eltwise_injector::is_fast_approx_allowed(
+                pd_->attr()->fpmath_.mode_);
+
+        postops_injector_.reset(
+                injector::jit_uni_postops_injector_base_t<Vmm>::create(this,
+                        injector_isa, pd_->attr()->post_ops_, bsp, esp));
+    }
+
+    void apply_postops(const int vmm_idx, const bool tail) {
+        binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+        if (with_binary_) {
+            rhs_arg_params.vmm_idx_to_out_reg.emplace(vmm_idx, reg_dst);
+            rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(vmm_idx, 0);
+            if (tail) rhs_arg_params.vmm_tail_idx_.emplace(vmm_idx);
+        }
+        postops_injector_->compute_vector(vmm_idx, rhs_arg_params);
     }
 
     void compute_dst(const bool tail) {
         io_[data_type()]->load(ptr[reg_src], vmm_src, tail);
         eltwise_injector_->compute_vector(vmm_src.getIdx());
+        if (with_postops_) apply_postops(vmm_src.getIdx(), tail);
         if (!is_fwd_) {
             io_[data_type()]->load(ptr[reg_diff_dst], vmm_diff_dst, tail);
             uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
@@ -163,7 +219,7 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
     void compute() {
         // Compute two simdw at once in vectorized loop first
         // when ne_convert instructions is available for xf16
-        if (isa == avx2_vnni_2 && (is_bf16() || is_f16()))
+        if (isa == avx2_vnni_2 && (is_bf16() || is_f16()) && !with_postops_)
             compute_two_simdw_xf16();
 
         Label vectorized_loop_start, reminder_loop_start, loop_end;
@@ -223,10 +279,12 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         // can be relevantly easy controlled, this will cost much from code
         // perspective and will complicate the compute logic significantly.
         compute();
+        if (use_nt_stores_) sfence();
 
         postamble();
 
         eltwise_injector_->prepare_table();
+        if (with_postops_) postops_injector_->prepare_table(true);
         if (is_f8()) io_.prepare_table_fp8();
     }
 
@@ -238,6 +296,8 @@ private:
     const int vlen_;
     const int simd_w_;
     const bool is_fwd_;
+    // Requires dst aligned on the vector length, checked at execution.
+    const bool use_nt_stores_;
     const int tail_size_ = 1;
 
     Reg64 reg_src = rax;
@@ -247,6 +307,7 @@ private:
     Reg64 reg_work_amount = rsi;
     Reg64 imm_addr64 = rbx;
     Reg64 reg_tmp = r14;
+    Reg64 reg_po_injector_table = r15;
 
     Opmask injector_mask = Opmask(1);
 
@@ -261,9 +322,15 @@ private:
     Vmm vmm_src_odd = Vmm(8);
     Vmm vmm_diff_dst_even = vmm_diff_dst;
     Vmm vmm_diff_dst_odd = Vmm(9);
+    Vmm vmm_rhs_helper = Vmm(10);
     std::unique_ptr<jit_uni_eltwise_injector_t<injector_isa>> eltwise_injector_;
     io::jit_io_multi_dt_helper_t<Vmm> io_;
 
+    bool with_postops_ = false;
+    bool with_binary_ = false;
+    std::unique_ptr<injector::jit_uni_postops_injector_base_t<Vmm>>
+            postops_injector_;
+
     /* bf16 and fp8 support */
     const int emu_zmm_1_idx_ = 25;
     const int emu_zmm_2_idx_ = 26;
@@ -307,14 +374,57 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
     // refer to a comment in jit_uni_kernel why this is needed
     VDISPATCH_ELTWISE(IMPLICATION(!src_d.is_dense(), is_zero_preserved()),
             VERBOSE_UNSUPPORTED_SPARSE_CFG);
-    VDISPATCH_ELTWISE(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_ELTWISE(
+            attr()->has_default_values(primitive_attr_t::skip_mask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_ELTWISE(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
     VDISPATCH_ELTWISE(src_d == memory_desc_wrapper(dst_md()),
             VERBOSE_INCONSISTENT_MDS, "src", "dst");
+    VDISPATCH_ELTWISE(
+            attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_ELTWISE(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
+
+    // fp8 values don't fill a full vector register on store.
+    use_nt_stores_ = !utils::one_of(d_type, data_type::f8_e5m2,
+                             data_type::f8_e4m3)
+            && io::is_nt_stores_beneficial(
+                    memory_desc_wrapper(dst_md()).size());
 
     return status::success;
 }
 
+template <cpu_isa_t isa, data_type_t d_type>
+bool jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::post_ops_ok() const {
+    const auto &post_ops = attr()->post_ops_;
+    if (post_ops.len() == 0) return true;
+
+    static constexpr cpu_isa_t injector_isa
+            = isa == avx512_core_amx ? avx512_core : isa;
+
+    // Post-ops would break the zeros in the padded area and fp8 binary
+    // sources need conversion helpers the kernel doesn't set up.
+    const memory_desc_wrapper dst_d(dst_md());
+    if (!dst_d.is_dense()) return false;
+    if (utils::one_of(d_type, data_type::f8_e5m2, data_type::f8_e4m3))
+        return false;
+    for (int i = 0; i < post_ops.len(); i++) {
+        const auto &e = post_ops.entry_[i];
+        if (!e.is_binary()) continue;
+        if (utils::one_of(e.binary.src1_desc.data_type, data_type::f8_e5m2,
+                    data_type::f8_e4m3))
+            return false;
+    }
+
+    // The destination is never read, so the sum post-op is not supported.
+    const std::vector<injector::post_op_type> accepted_post_ops
+            = {injector::eltwise, injector::binary};
+    injector::post_ops_ok_args_t post_ops_args(injector_isa, accepted_post_ops,
+            post_ops, &dst_d, false, false, false, false,
+            binary_injector::get_all_strategies_supported_by_injector());
+    return injector::post_ops_ok(post_ops_args);
+}
+
 template <cpu_isa_t isa, data_type_t d_type>
 jit_uni_eltwise_fwd_t<isa, d_type>::jit_uni_eltwise_fwd_t(const pd_t *apd)
     : primitive_t(apd) {}
@@ -325,6 +435,11 @@ jit_uni_eltwise_fwd_t<isa, d_type>::~jit_uni_eltwise_fwd_t() = default;
 template <cpu_isa_t isa, data_type_t d_type>
 status_t jit_uni_eltwise_fwd_t<isa, d_type>::init(engine_t *engine) {
     CHECK(safe_ptr_assign(kernel_, new jit_uni_kernel_t<isa>(pd())));
+    if (pd()->use_nt_stores_) {
+        CHECK(safe_ptr_assign(kernel_nt_,
+                new jit_uni_kernel_t<isa>(pd(), /* use_nt_stores = */ true)));
+        CHECK(kernel_nt_->create_kernel());
+    }
     return kernel_->create_kernel();
 }
 
@@ -333,6 +448,9 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
         const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(
+                    pd()->attr()->post_ops_, ctx);
 
     const memory_desc_wrapper data_d(pd()->src_md());
     const auto nelems = data_d.nelems(true);
@@ -341,7 +459,18 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
     src += data_d.offset0();
     dst += data_d.offset0();
 
-    parallel(0, [&](const int ithr, const int nthr) {
+    // Every thread starts on a 64 byte boundary relative to dst, so the
+    // vector stores of the non-temporal kernel are aligned when dst is.
+    const bool use_nt_stores = kernel_nt_
+            && reinterpret_cast<uintptr_t>(dst)
+                            % platform::get_cache_line_size()
+                    == 0;
+    const auto kernel = use_nt_stores ? kernel_nt_.get() : kernel_.get();
+
+    // The pass reads src and writes dst.
+    const int nthr = nthr_by_work(
+            0, 2 * nelems * data_d.data_type_size(), min_bytes_per_thr);
+    parallel(nthr, [&](const int ithr, const int nthr) {
         dim_t start {0}, end {0};
 
         balance211(utils::div_up(nelems, simd_w), nthr, ithr, start, end);
@@ -354,7 +483,9 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
         args.dst = dst + start;
         args.diff_dst = nullptr;
         args.work_amount = end - start;
-        (*kernel_)(&args);
+        args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
+        args.dst_orig = dst;
+        (*kernel)(&args);
     });
 
     return status::success;
@@ -433,7 +564,10 @@ status_t jit_uni_eltwise_bwd_t<isa, d_type>::execute(
     diff_dst += diff_data_d.offset0();
     diff_src += diff_data_d.offset0();
 
-    parallel(0, [&](const int ithr, const int nthr) {
+    // The pass reads src and diff_dst and writes diff_src.
+    const int nthr = nthr_by_work(
+            0, 3 * nelems * data_d.data_type_size(), min_bytes_per_thr);
+    parallel(nthr, [&](const int ithr, const int nthr) {
         dim_t start {0}, end {0};
 
         balance211(utils::div_up(nelems, simd_w), nthr, ithr, start, end);
@@ -446,6 +580,8 @@ status_t jit_uni_eltwise_bwd_t<isa, d_type>::execute(
         args.dst = diff_src + start;
         args.diff_dst = diff_dst + start;
         args.work_amount = end - start;
+        args.post_ops_binary_rhs_arg_vec = nullptr;
+        args.dst_orig = nullptr;
         (*kernel_)(&args);
     });
 
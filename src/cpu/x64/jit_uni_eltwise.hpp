@@ -49,6 +49,13 @@ struct jit_uni_eltwise_fwd_t : public primitive_t {
                 jit_uni_eltwise_fwd_t);
 
         status_t init(engine_t *engine);
+
+        // The output doesn't fit into the cache, so a kernel writing it with
+        // non-temporal stores is created as well.
+        bool use_nt_stores_ = false;
+
+    private:
+        bool post_ops_ok() const;
     };
 
     jit_uni_eltwise_fwd_t(const pd_t *apd);
@@ -64,6 +71,7 @@ struct jit_uni_eltwise_fwd_t : public primitive_t {
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     std::unique_ptr<jit_uni_eltwise_kernel_t> kernel_;
+    std::unique_ptr<jit_uni_eltwise_kernel_t> kernel_nt_;
 };
 
 template <cpu_isa_t isa, impl::data_type_t d_type>
@@ -19,6 +19,9 @@
 #include "common/nstl.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/primitive_attr_postops.hpp"
+#include "cpu/simple_q10n.hpp"
+
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/jit_uni_eltwise_int.hpp"
@@ -437,6 +440,211 @@ void jit_uni_subkernel_int_t<avx512_core>::store_8bit(const bool vectorize,
     }
 }
 
+// The kernel for s8 and u8 data, which applies any algorithm through a table
+// of its results for the 256 values of the data type. The table is computed
+// with the reference at the kernel creation and then looked up by the source
+// bytes: with two vpermi2b of 128-byte halves on avx512_core_vbmi, and
+// otherwise with a pshufb of a 16-byte row per value of the high nibble.
+template <cpu_isa_t isa>
+struct jit_uni_lut_subkernel_int_t : public jit_uni_eltwise_int_kernel_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_lut_subkernel_int)
+
+    jit_uni_lut_subkernel_int_t(const eltwise_pd_t *pd)
+        : jit_uni_eltwise_int_kernel_t(pd, isa, jit_name())
+        , use_vbmi_(isa == avx512_core
+                  && cpu().has(Xbyak::util::Cpu::tAVX512_VBMI)) {
+        using namespace data_type;
+        assert(utils::one_of(data_type(), s8, u8));
+        assert(utils::one_of(isa, sse41, avx2, avx512_core));
+
+        const bool is_signed = data_type() == s8;
+        for (int i = 0; i < lut_size; i++) {
+            const float s = is_signed ? (float)(int8_t)i : (float)i;
+            const float d = compute_eltwise_scalar_fwd(
+                    desc().alg_kind, s, desc().alpha, desc().beta);
+            lut_[i] = is_signed
+                    ? (uint8_t)cpu::q10n::saturate_and_round<int8_t>(d)
+                    : cpu::q10n::saturate_and_round<uint8_t>(d);
+        }
+    }
+
+    void generate() override;
+
+private:
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+
+    static constexpr int lut_size = 256;
+    static constexpr int vlen = cpu_isa_traits_t<isa>::vlen;
+
+    Reg64 reg_from = rax;
+    Reg64 reg_to = r8;
+    Reg64 reg_work_amount = rsi;
+    Reg64 reg_table = rbx;
+    Reg64 reg_tmp = r9;
+
+    // The table is kept in registers by the vbmi lookup.
+    Zmm zmm_table(int i) const { return Zmm(i); }
+    Vmm vmm_src = Vmm(4);
+    Vmm vmm_dst = Vmm(5);
+    Vmm vmm_aux = Vmm(6);
+    Vmm vmm_lo = Vmm(7);
+    Vmm vmm_hi = Vmm(8);
+    Vmm vmm_row = Vmm(9);
+    Vmm vmm_mask = Vmm(10);
+    Vmm vmm_nibble = Vmm(11);
+    Vmm vmm_one = Vmm(12);
+    Vmm vmm_zero = Vmm(13);
+    const Opmask k_mask = k1;
+
+    const bool use_vbmi_;
+    uint8_t lut_[lut_size];
+    Label l_table;
+
+    void broadcast_bytes(const Vmm &v, uint8_t b);
+    void lookup_vbmi();
+    void lookup_shuffle();
+};
+
+template <cpu_isa_t isa>
+void jit_uni_lut_subkernel_int_t<isa>::broadcast_bytes(
+        const Vmm &v, uint8_t b) {
+    mov(reg_tmp.cvt32(), 0x01010101u * b);
+    if (isa == avx512_core) {
+        vpbroadcastd(v, reg_tmp.cvt32());
+    } else {
+        uni_vmovd(Xmm(v.getIdx()), reg_tmp.cvt32());
+        if (isa == avx2)
+            vpbroadcastd(v, Xmm(v.getIdx()));
+        else
+            pshufd(v, v, 0);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_lut_subkernel_int_t<isa>::lookup_vbmi() {
+    // The bit 7 of a byte picks the half of the table, and the rest of the
+    // bits index the half.
+    vmovdqu8(vmm_src, ptr[reg_from]);
+    vmovdqa64(vmm_dst, vmm_src);
+    vpermi2b(vmm_dst, zmm_table(0), zmm_table(1));
+    vmovdqa64(vmm_aux, vmm_src);
+    vpermi2b(vmm_aux, zmm_table(2), zmm_table(3));
+    vpmovb2m(k_mask, vmm_src);
+    vpblendmb(vmm_dst | k_mask, vmm_dst, vmm_aux);
+    vmovdqu8(ptr[reg_to], vmm_dst);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_lut_subkernel_int_t<isa>::lookup_shuffle() {
+    // The low nibble of a byte indexes a row of 16 entries and the high one
+    // selects the row. The rows are walked in order, and the high nibbles are
+    // decremented to match the rows against zero.
+    uni_vmovdqu(vmm_src, ptr[reg_from]);
+    if (isa == avx512_core) {
+        vpandd(vmm_lo, vmm_src, vmm_nibble);
+        vpsrlw(vmm_hi, vmm_src, 4);
+        vpandd(vmm_hi, vmm_hi, vmm_nibble);
+        vpxord(vmm_dst, vmm_dst, vmm_dst);
+    } else {
+        uni_vpand(vmm_lo, vmm_src, vmm_nibble);
+        if (isa == avx2) {
+            vpsrlw(vmm_hi, vmm_src, 4);
+        } else {
+            movdqa(vmm_hi, vmm_src);
+            psrlw(vmm_hi, 4);
+        }
+        uni_vpand(vmm_hi, vmm_hi, vmm_nibble);
+        uni_vpxor(vmm_dst, vmm_dst, vmm_dst);
+    }
+
+    for (int row = 0; row < lut_size / 16; row++) {
+        const auto row_addr = ptr[reg_table + row * 16];
+        if (isa == avx512_core) {
+            vbroadcasti32x4(Zmm(vmm_row.getIdx()), row_addr);
+            vpshufb(vmm_row, vmm_row, vmm_lo);
+            vpcmpeqb(k_mask, vmm_hi, vmm_zero);
+            vmovdqu8(vmm_dst | k_mask, vmm_row);
+        } else if (isa == avx2) {
+            vbroadcasti128(Ymm(vmm_row.getIdx()), row_addr);
+            vpshufb(vmm_row, vmm_row, vmm_lo);
+            vpcmpeqb(vmm_mask, vmm_hi, vmm_zero);
+            vpand(vmm_row, vmm_row, vmm_mask);
+            vpor(vmm_dst, vmm_dst, vmm_row);
+        } else {
+            movdqu(vmm_row, row_addr);
+            pshufb(vmm_row, vmm_lo);
+            movdqa(vmm_mask, vmm_hi);
+            pcmpeqb(vmm_mask, vmm_zero);
+            pand(vmm_row, vmm_mask);
+            por(vmm_dst, vmm_row);
+        }
+        if (row < lut_size / 16 - 1) uni_vpsubb(vmm_hi, vmm_hi, vmm_one);
+    }
+    uni_vmovdqu(ptr[reg_to], vmm_dst);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_lut_subkernel_int_t<isa>::generate() {
+    preamble();
+
+#define GET_OFF(field) offsetof(jit_args_int8_t, field)
+    mov(reg_from, ptr[abi_param1 + GET_OFF(from)]);
+    mov(reg_to, ptr[abi_param1 + GET_OFF(to)]);
+    mov(reg_work_amount, ptr[abi_param1 + GET_OFF(work_amount)]);
+#undef GET_OFF
+    mov(reg_table, l_table);
+
+    if (use_vbmi_) {
+        for (int i = 0; i < lut_size / 64; i++)
+            vmovdqu8(zmm_table(i), ptr[reg_table + i * 64]);
+    } else {
+        broadcast_bytes(vmm_nibble, 0x0f);
+        broadcast_bytes(vmm_one, 0x01);
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+    }
+
+    Label l_vec_loop, l_tail_loop, l_end;
+
+    L(l_vec_loop);
+    {
+        cmp(reg_work_amount, vlen);
+        jl(l_tail_loop, T_NEAR);
+
+        if (use_vbmi_)
+            lookup_vbmi();
+        else
+            lookup_shuffle();
+
+        add(reg_from, vlen);
+        add(reg_to, vlen);
+        sub(reg_work_amount, vlen);
+        jmp(l_vec_loop, T_NEAR);
+    }
+
+    L(l_tail_loop);
+    {
+        test(reg_work_amount, reg_work_amount);
+        jz(l_end, T_NEAR);
+
+        movzx(reg_tmp.cvt32(), byte[reg_from]);
+        mov(reg_tmp.cvt8(), byte[reg_table + reg_tmp]);
+        mov(byte[reg_to], reg_tmp.cvt8());
+
+        inc(reg_from);
+        inc(reg_to);
+        dec(reg_work_amount);
+        jmp(l_tail_loop, T_NEAR);
+    }
+
+    L(l_end);
+    postamble();
+
+    align(64);
+    L(l_table);
+    for (int i = 0; i < lut_size; i++)
+        db(lut_[i]);
+}
+
 } /* namespace */
 
 template <cpu_isa_t isa, data_type_t d_type>
@@ -448,9 +656,11 @@ status_t jit_uni_eltwise_int_fwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
     VDISPATCH_ELTWISE(utils::everyone_is(
                               d_type, src_md()->data_type, dst_md()->data_type),
             VERBOSE_UNSUPPORTED_DT);
-    // only relu and linear so far
-    VDISPATCH_ELTWISE(utils::one_of(desc()->alg_kind, alg_kind::eltwise_relu,
-                              alg_kind::eltwise_linear, alg_kind::eltwise_clip),
+    // s8 and u8 take any algorithm through a table of results, while s32
+    // supports only relu, linear and clip.
+    VDISPATCH_ELTWISE(d_type != data_type::s32
+                    || utils::one_of(desc()->alg_kind, alg_kind::eltwise_relu,
+                            alg_kind::eltwise_linear, alg_kind::eltwise_clip),
             VERBOSE_BAD_ALGORITHM);
     VDISPATCH_ELTWISE(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
     VDISPATCH_ELTWISE(memory_desc_wrapper(src_md()).is_dense(true),
@@ -471,7 +681,12 @@ jit_uni_eltwise_int_fwd_t<isa, d_type>::jit_uni_eltwise_int_fwd_t(
 
 template <cpu_isa_t isa, data_type_t d_type>
 status_t jit_uni_eltwise_int_fwd_t<isa, d_type>::init(engine_t *engine) {
-    CHECK(safe_ptr_assign(kernel_, new jit_uni_subkernel_int_t<isa>(pd())));
+    if (d_type == data_type::s32)
+        CHECK(safe_ptr_assign(
+                kernel_, new jit_uni_subkernel_int_t<isa>(pd())));
+    else
+        CHECK(safe_ptr_assign(
+                kernel_, new jit_uni_lut_subkernel_int_t<isa>(pd())));
     return kernel_->create_kernel();
 }
 
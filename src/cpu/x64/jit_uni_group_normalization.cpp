@@ -17,6 +17,7 @@
 #include "common/dnnl_thread.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/normalization_utils.hpp"
 
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_generator.hpp"
@@ -384,6 +385,11 @@ protected:
 template struct kernel_t<avx2>;
 template struct kernel_t<avx512_core>;
 
+// Computes per channel statistics of a block of spatial points within a single
+// read of the source: values are accumulated shifted by the first value of
+// their channel, which keeps the sum of squares from losing precision to the
+// mean. The kernel stores the mean and the sum of squared deviations (M2) of
+// every channel of a group, they are merged on the C++ side.
 template <cpu_isa_t isa>
 struct kernel_stat_t
     : public jit_uni_group_normalization_fwd_t::kernel_stat_base_t,
@@ -391,15 +397,14 @@ struct kernel_stat_t
     DECLARE_CPU_JIT_AUX_FUNCTIONS(
             jit_uni_group_normalization_fwd_t::kernel_stat_t);
 
-    kernel_stat_t(const group_normalization_pd_t *pd, bool compute_var = false)
+    kernel_stat_t(const group_normalization_pd_t *pd)
         : jit_generator_t(jit_name())
         , src_d_(pd->src_md())
-        , compute_var_(compute_var)
         , C_(pd->C())
         , C_PER_G_(C_ / pd->G())
-        , SP_(pd->D() * pd->H() * pd->W())
         , simd_w_(vlen / sizeof(float))
         , axis_simd_tail_(C_PER_G_ % simd_w_)
+        , unroll_c_(is_superset(isa, avx512_core) ? 4 : 3)
         , c_block_(unroll_c_ * simd_w_)
         , nc_blocks_(C_PER_G_ / c_block_)
         , c_block_tail_((C_PER_G_ % c_block_) - axis_simd_tail_)
@@ -418,21 +423,14 @@ struct kernel_stat_t
                 {src_d_.data_type(), f32 /* stats */}, io_conf, io_tail_conf,
                 io_bf16_conf);
 
-        io::io_tail_conf_t io_tail_conf_stats(
-                simd_w_, 1, tail_opmask_stats_idx, vmm_tmp.getIdx(), reg_tmp);
-        io_stat_ = io::jit_io_multi_dt_helper_t<Vmm>(
-                this, io_isa, {f32}, io_conf, io_tail_conf_stats);
-
         VDEBUGINFO(1, primitive, group_normalization,
-                "%s:\n    compute_var_=%d\n    C_=%" PRId64
-                "\n    C_PER_G_=%" PRId64
+                "%s:\n    C_=%" PRId64 "\n    C_PER_G_=%" PRId64
                 "\n    simd_w_=%zu\n    axis_simd_tail_=%" PRId64
                 "\n    unroll_c_=%" PRId64 "\n    c_block_=%" PRId64
                 "\n    nc_blocks_=%" PRId64 "\n    c_block_tail_=%" PRId64
                 "\n    unroll_c_tail_=%" PRId64,
-                jit_name(), compute_var_, C_, C_PER_G_, simd_w_,
-                axis_simd_tail_, unroll_c_, c_block_, nc_blocks_, c_block_tail_,
-                unroll_c_tail_);
+                jit_name(), C_, C_PER_G_, simd_w_, axis_simd_tail_, unroll_c_,
+                c_block_, nc_blocks_, c_block_tail_, unroll_c_tail_);
     }
 
     status_t create_kernel() override {
@@ -447,42 +445,25 @@ struct kernel_stat_t
 
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
         mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
-        if (compute_var_) mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
+        mov(reg_m2, ptr[reg_param + PARAM_OFF(m2)]);
         mov(reg_src_start, ptr[reg_param + PARAM_OFF(src)]);
+        uni_vbroadcastss(vmm_rcp_n, ptr[reg_param + PARAM_OFF(rcp_n)]);
 #undef PARAM_OFF
 
-        // Initializing registers for unrolling and further reduction of those
-        // is called with the maximum unroll value of a `compute_stat_block`
-        // function as they operate over vmms, which numeration depends on
-        // unroll value.
-        const size_t max_unroll = nc_blocks_ ? unroll_c_
-                : unroll_c_tail_             ? unroll_c_tail_
-                                             : 1;
-
-        if (!compute_var_) {
-            for (size_t ur = 0; ur < max_unroll; ur++) {
-                uni_vpxor(Vmm_mean(ur), Vmm_mean(ur), Vmm_mean(ur));
-            }
-        } else {
-            for (size_t ur = 0; ur < max_unroll; ur++) {
-                uni_vpxor(Vmm_var(ur), Vmm_var(ur), Vmm_var(ur));
-            }
-        }
-
         if (nc_blocks_) {
             xor_(reg_nc_block, reg_nc_block);
             Xbyak::Label c_blk_loop, c_blk_loop_end;
             L(c_blk_loop);
             {
-
                 cmp(reg_nc_block, nc_blocks_);
                 je(c_blk_loop_end, T_NEAR);
 
-                // calculate mean
                 compute_stat_block(unroll_c_);
 
                 add(reg_src_start,
                         c_block_ * types::data_type_size(src_d_.data_type()));
+                add(reg_mean, c_block_ * sizeof(float));
+                add(reg_m2, c_block_ * sizeof(float));
                 add(reg_nc_block, 1);
 
                 jmp(c_blk_loop);
@@ -494,79 +475,25 @@ struct kernel_stat_t
             compute_stat_block(unroll_c_tail_);
             add(reg_src_start,
                     c_block_tail_ * types::data_type_size(src_d_.data_type()));
+            add(reg_mean, c_block_tail_ * sizeof(float));
+            add(reg_m2, c_block_tail_ * sizeof(float));
         }
 
         if (axis_simd_tail_) compute_stat_block(1, true);
 
-        // Reduction on registers for Group normalization as the kernel
-        // processes a single group at a time.
-
-        // Part 1 is reducing over unrolled registers.
-        const Vmm &vmm_stat = !compute_var_ ? vmm_mean : vmm_var;
-
-        Vmm vmm_tmp_max0 = !compute_var_ ? Vmm_mean(0) : Vmm_var(0);
-        Vmm vmm_tmp_max1 = !compute_var_ ? Vmm_mean(1) : Vmm_var(1);
-        Vmm vmm_tmp_max2 = !compute_var_ ? Vmm_mean(2) : Vmm_var(2);
-        Vmm vmm_tmp_max3 = !compute_var_ ? Vmm_mean(3) : Vmm_var(3);
-
-        switch (max_unroll) {
-            case 4: {
-                uni_vaddps(vmm_tmp_max0, vmm_tmp_max0, vmm_tmp_max1);
-                uni_vaddps(vmm_tmp_max2, vmm_tmp_max2, vmm_tmp_max3);
-                uni_vaddps(vmm_stat, vmm_tmp_max0, vmm_tmp_max2);
-            } break;
-            case 3: {
-                uni_vaddps(vmm_tmp_max0, vmm_tmp_max0, vmm_tmp_max1);
-                uni_vaddps(vmm_stat, vmm_tmp_max0, vmm_tmp_max2);
-            } break;
-            case 2: {
-                uni_vaddps(vmm_stat, vmm_tmp_max0, vmm_tmp_max1);
-            } break;
-            case 1: {
-                uni_vmovups(vmm_stat, vmm_tmp_max0);
-            } break;
-            default: break;
-        }
-
-        // Part 2 is to reduce within a single register.
-        reduce_horizontal(vmm_stat, vmm_tmp);
-
-        // Divide a stat by N.
-        // Note: the behavior is aligned with with kernel execution model.
-        //   Check for `SINGLE_KERNEL_HEURISTIC_ANCHOR` for a pairing spot.
-        if (C_PER_G_ >= 32) {
-            mov(reg_tmp, float2int(C_PER_G_ * SP_));
-            uni_vmovq(xmm_tmp, reg_tmp);
-            uni_vbroadcastss(vmm_tmp, xmm_tmp);
-            uni_vdivps(vmm_stat, vmm_stat, vmm_tmp);
-        }
-
-        io_stat_.prepare_tail_mask();
-        const auto &stat_addr = !compute_var_ ? mean_ptr(0) : var_ptr(0);
-        io_stat_[f32]->store(vmm_stat, stat_addr, true);
-
         postamble();
     }
 
-    void operator()(
-            const void *src, float *mean, size_t block_size) const override {
-        ker_args_t args;
-        args.src = src;
-        args.mean = mean;
-        args.block_size
-                = block_size * C_ * types::data_type_size(src_d_.data_type());
-
-        jit_generator_t::operator()(&args);
-    }
-
-    void operator()(const void *src, const float *mean, float *var,
+    void operator()(const void *src, float *mean, float *m2,
             size_t block_size) const override {
+        assert(block_size > 0);
         ker_args_t args;
         args.src = src;
         args.mean = mean;
-        args.var = var;
+        args.m2 = m2;
         args.block_size
                 = block_size * C_ * types::data_type_size(src_d_.data_type());
+        args.rcp_n = 1.f / static_cast<float>(block_size);
 
         jit_generator_t::operator()(&args);
     }
@@ -580,51 +507,28 @@ protected:
 
     struct ker_args_t {
         const void *src;
-        const float *mean;
-        const float *var;
+        float *mean;
+        float *m2;
         size_t block_size;
+        float rcp_n;
     };
 
     const memory_desc_wrapper src_d_;
-    const bool compute_var_;
     const dim_t C_;
     const dim_t C_PER_G_;
-    const dim_t SP_;
     const size_t simd_w_;
     const dim_t axis_simd_tail_;
-    static constexpr dim_t unroll_c_ = 4;
+    // Four registers are used per unrolled vector of channels, so AVX2 can
+    // only afford three of them.
+    const dim_t unroll_c_;
     const dim_t c_block_;
     const dim_t nc_blocks_;
     const dim_t c_block_tail_;
     const dim_t unroll_c_tail_;
 
     io::jit_io_multi_dt_helper_t<Vmm> io_;
-    // `io_stat_` is to store a single element of mean or var.
-    io::jit_io_multi_dt_helper_t<Vmm> io_stat_;
-
-    void reduce_horizontal(const Vmm &vstat, const Vmm &vtmp) {
-        if (is_superset(isa, avx512_core)) {
-            const Zmm &zstat = Zmm(vstat.getIdx());
-            const Zmm &ztmp = Zmm(vtmp.getIdx());
-
-            vshuff32x4(ztmp, zstat, zstat, 0x4E); // 256-bit shuffle
-            uni_vaddps(vstat, vstat, vtmp);
-            vshuff32x4(ztmp, zstat, zstat, 0xB1); // 128/256-bit shuffle
-            uni_vaddps(vstat, vstat, vtmp);
-        } else if (is_superset(isa, avx2)) {
-            const Ymm &ystat = Ymm(vstat.getIdx());
-            const Ymm &ytmp = Ymm(vtmp.getIdx());
-
-            vperm2f128(ytmp, ystat, ystat, 0x1); // 128/256-bit shuffle
-            uni_vaddps(vstat, vstat, vtmp);
-        }
-        uni_vshufps(vtmp, vstat, vstat, 0x4E); // 64/128-bit shuffle
-        uni_vaddps(vstat, vstat, vtmp);
-        uni_vshufps(vtmp, vstat, vstat, 0xB1); // 32/64-bit shuffle
-        uni_vaddps(vstat, vstat, vtmp);
-    }
 
-    void compute_mean_block(size_t unroll, bool tail = false) {
+    void compute_stat_block(size_t unroll, bool tail = false) {
         const size_t c_src_size
                 = C_ * types::data_type_size(src_d_.data_type());
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
@@ -632,38 +536,14 @@ protected:
 #undef PARAM_OFF
 
         mov(reg_src, reg_src_start);
-        // add block_start to block_size to define block_end
-        add(reg_sp_block_end, reg_src);
-
-        Xbyak::Label sp_blk_loop, sp_blk_loop_end;
-        L(sp_blk_loop);
-        {
-            cmp(reg_sp_block_end, reg_src);
-            jle(sp_blk_loop_end, T_NEAR);
-
-            for (size_t ur = 0; ur < unroll; ur++) {
-                io_[src_d_.data_type()]->load(
-                        src_ptr(ur * simd_w_), Vmm_src(ur), tail);
-                uni_vaddps(Vmm_mean(ur), Vmm_mean(ur), Vmm_src(ur));
-            }
-
-            add(reg_src, c_src_size);
-            jmp(sp_blk_loop);
-        }
-        L(sp_blk_loop_end);
-    }
-
-    void compute_var_block(size_t unroll, bool tail = false) {
-        const size_t c_src_size
-                = C_ * types::data_type_size(src_d_.data_type());
-#define PARAM_OFF(x) offsetof(ker_args_t, x)
-        mov(reg_sp_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
-#undef PARAM_OFF
+        // The first point of the block is a shift for the whole block. Masked
+        // loads keep zeros in tail spots, so shifted values stay zero there.
         for (size_t ur = 0; ur < unroll; ur++) {
-            io_[data_type::f32]->broadcast(mean_ptr(0), Vmm_mean(ur));
+            io_[src_d_.data_type()]->load(
+                    src_ptr(ur * simd_w_), Vmm_shift(ur), tail);
+            uni_vpxor(Vmm_sum(ur), Vmm_sum(ur), Vmm_sum(ur));
+            uni_vpxor(Vmm_sum_sq(ur), Vmm_sum_sq(ur), Vmm_sum_sq(ur));
         }
-
-        mov(reg_src, reg_src_start);
         // add block_start to block_size to define block_end
         add(reg_sp_block_end, reg_src);
 
@@ -678,46 +558,30 @@ protected:
                         src_ptr(ur * simd_w_), Vmm_src(ur), tail);
             }
             for (size_t ur = 0; ur < unroll; ur++) {
-                if (!tail)
-                    uni_vsubps(Vmm_src(ur), Vmm_src(ur), Vmm_mean(ur));
-                else {
-                    // Subtract with mask to keep zeros in spots where there's
-                    // no data. Otherwise, subtracting mean and accumulating
-                    // towards variance will spoil the right answer.
-                    if (is_superset(isa, avx512_core)) {
-                        uni_vsubps(Vmm_src(ur) | tail_opmask, Vmm_src(ur),
-                                Vmm_mean(ur));
-                    } else if (is_superset(isa, avx)) {
-                        // Use a scratch zeroed register to keep stats properly
-                        // computed.
-                        uni_vpxor(vmm_tmp, vmm_tmp, vmm_tmp);
-                        uni_vblendvps(Vmm_mean(ur), vmm_tmp, Vmm_mean(ur),
-                                vmm_tail_mask);
-                        uni_vsubps(Vmm_src(ur), Vmm_src(ur), Vmm_mean(ur));
-                    } else {
-                        assert(!"unsupported isa");
-                    }
-                }
-            }
-            for (size_t ur = 0; ur < unroll; ur++) {
-                uni_vfmadd231ps(Vmm_var(ur), Vmm_src(ur), Vmm_src(ur));
+                uni_vsubps(Vmm_src(ur), Vmm_src(ur), Vmm_shift(ur));
+                uni_vaddps(Vmm_sum(ur), Vmm_sum(ur), Vmm_src(ur));
+                uni_vfmadd231ps(Vmm_sum_sq(ur), Vmm_src(ur), Vmm_src(ur));
             }
 
             add(reg_src, c_src_size);
             jmp(sp_blk_loop);
         }
         L(sp_blk_loop_end);
-    }
-    void compute_stat_block(size_t unroll, bool tail = false) {
-        if (compute_var_)
-            compute_var_block(unroll, tail);
-        else
-            compute_mean_block(unroll, tail);
+
+        // mean = shift + sum / n, M2 = sum_sq - sum * sum / n.
+        for (size_t ur = 0; ur < unroll; ur++) {
+            uni_vmulps(vmm_tmp, Vmm_sum(ur), vmm_rcp_n);
+            uni_vaddps(Vmm_shift(ur), Vmm_shift(ur), vmm_tmp);
+            uni_vfnmadd231ps(Vmm_sum_sq(ur), Vmm_sum(ur), vmm_tmp);
+            io_[f32]->store(Vmm_shift(ur), mean_ptr(ur * simd_w_), tail);
+            io_[f32]->store(Vmm_sum_sq(ur), m2_ptr(ur * simd_w_), tail);
+        }
     }
 
-    Vmm Vmm_mean(size_t ur = 0) { return Vmm(1 + 0 * unroll_c_ + ur); }
-    Vmm Vmm_var(size_t ur = 0) { return Vmm(1 + 1 * unroll_c_ + ur); }
-    Vmm Vmm_src(size_t ur = 0) { return Vmm(1 + 2 * unroll_c_ + ur); }
+    Vmm Vmm_shift(size_t ur = 0) { return Vmm(1 + 0 * unroll_c_ + ur); }
+    Vmm Vmm_sum(size_t ur = 0) { return Vmm(1 + 1 * unroll_c_ + ur); }
+    Vmm Vmm_sum_sq(size_t ur = 0) { return Vmm(1 + 2 * unroll_c_ + ur); }
+    Vmm Vmm_src(size_t ur = 0) { return Vmm(1 + 3 * unroll_c_ + ur); }
 
     Xbyak::Address src_ptr(size_t offt = 0) {
         return vmmword[reg_src + offt * src_d_.data_type_size()];
@@ -727,8 +591,8 @@ protected:
         return vmmword[reg_mean + offt * sizeof(float)];
     }
 
-    Xbyak::Address var_ptr(size_t offt = 0) {
-        return vmmword[reg_var + offt * sizeof(float)];
+    Xbyak::Address m2_ptr(size_t offt = 0) {
+        return vmmword[reg_m2 + offt * sizeof(float)];
     }
 
     const Xbyak::Reg64 reg_param = abi_param1;
@@ -738,21 +602,17 @@ protected:
     const Xbyak::Reg64 reg_sp_block_end = r9;
     const Xbyak::Reg64 reg_nc_block = r10;
     const Xbyak::Reg64 reg_tmp = r11;
-    const Xbyak::Reg64 reg_var = r12;
+    const Xbyak::Reg64 reg_m2 = r12;
 
     const Vmm vmm_tail_mask = Vmm(0);
-    const Vmm vmm_tmp = Vmm(13);
-    const Xmm xmm_tmp = Xmm(13);
-    const Vmm vmm_var = Vmm(14);
-    const Vmm vmm_mean = Vmm(15);
+    const Vmm vmm_tmp = Vmm(1 + 4 * unroll_c_);
+    const Vmm vmm_rcp_n = Vmm(2 + 4 * unroll_c_);
 
     const int bf16_emu_zmm_1_idx = 28;
     const int bf16_emu_zmm_2_idx = 29;
     const int bf16_emu_zmm_3_idx = 30;
     const int bf16_emu_zmm_4_idx = 31;
     const int tail_opmask_idx = 1;
-    const int tail_opmask_stats_idx = 2;
-    Opmask tail_opmask = Opmask(tail_opmask_idx);
 };
 
 template struct kernel_stat_t<avx2>;
@@ -775,11 +635,11 @@ jit_uni_group_normalization_fwd_t::kernel_base_t::create(
 
 jit_uni_group_normalization_fwd_t::kernel_stat_base_t *
 jit_uni_group_normalization_fwd_t::kernel_stat_base_t::create(
-        const group_normalization_pd_t *apd, bool compute_var) {
+        const group_normalization_pd_t *apd) {
     if (mayiuse(avx512_core)) {
-        return new kernel_stat_t<avx512_core>(apd, compute_var);
+        return new kernel_stat_t<avx512_core>(apd);
     } else if (mayiuse(avx2)) {
-        return new kernel_stat_t<avx2>(apd, compute_var);
+        return new kernel_stat_t<avx2>(apd);
     } else {
         assert(!"kernel is empty.");
         return nullptr;
@@ -849,10 +709,10 @@ status_t jit_uni_group_normalization_fwd_t::pd_t::init(engine_t *engine) {
     auto scratchpad = scratchpad_registry().registrar();
     if (!stats_is_src()) {
         using namespace memory_tracking::names;
-        // C() is used here for convenience, to let C++ reduce over the group.
-        // TODO: replace with G() instead and make reduction in registers.
+        // The stat kernel stores a mean and M2 per channel, they are merged
+        // over the group on the C++ side.
         const size_t stats_size = MB() * C();
-        const size_t stats_reduction_buf_sz = stats_size * nthr_;
+        const size_t stats_reduction_buf_sz = 2 * stats_size * nthr_;
         scratchpad.template book<float>(
                 key_gnorm_reduction, stats_reduction_buf_sz);
         if (!is_training()) {
@@ -917,10 +777,6 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
     //   it through all kernels. In this case there are no dependencies and
     //   no need to sync between threads. Beneficial for a decent number of
     //   channels in a group and short spatial.
-    //   Note: this algorithm requires a modification in the kernel that would
-    //   divide mean and variance by N. In case the heuristic change, the other
-    //   place must be updated accordingly.
-    //   Check for `SINGLE_KERNEL_HEURISTIC_ANCHOR` for a pairing spot.
     //
     // * Multi-threaded-group - it gives a single group to several threads.
     //   In this case, synchronization is required, to collect proper mean and
@@ -948,8 +804,15 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
                 float *var_ptr = variance + i;
 
                 if (calculate_stats) {
-                    (*kernel_mean_)(src_ptr, mean_ptr, SP);
-                    (*kernel_var_)(src_ptr, mean_ptr, var_ptr, SP);
+                    float *mean_c = stat_reduction + 2 * ithr * C_PER_G;
+                    float *m2_c = mean_c + C_PER_G;
+                    (*kernel_stat_)(src_ptr, mean_c, m2_c, SP);
+
+                    normalization_utils::welford_stat_t stat;
+                    for (dim_t c = 0; c < C_PER_G; c++)
+                        stat.merge(SP, mean_c[c], m2_c[c]);
+                    *mean_ptr = stat.mean();
+                    *var_ptr = stat.variance();
                 }
                 (*kernel_)(src_ptr, dst_ptr, scale_ptr, shift_ptr, mean_ptr,
                         var_ptr, src_scales, dst_scales,
@@ -960,18 +823,11 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
         dim_t nthr_per_g = std::min(static_cast<dim_t>(nthr), G);
         assert(nthr_per_g <= nthr);
 
-        auto reduce = [&](float *stat, const float *tmp_stat) {
-            for (dim_t g = 0; g < G * N; ++g)
-                stat[g] = 0.f;
-
-            for_(dim_t n = 0; n < N; n++)
-            for_(dim_t ithr = 0; ithr < nthr_per_g; ithr++)
-            for (dim_t g = 0; g < G; g++) {
-                stat[n * G + g] += tmp_stat[n * nthr_per_g * G + ithr * G + g];
-            }
-
-            for (dim_t g = 0; g < G * N; ++g)
-                stat[g] /= C_PER_G * SP;
+        const dim_t g_per_n = G * nthr_per_g;
+        const dim_t SP_chunk = SP / nthr_per_g;
+        const auto get_sp_chunk_size = [&](dim_t ithr_sp) {
+            return ithr_sp == nthr_per_g - 1 ? SP - ithr_sp * SP_chunk
+                                             : SP_chunk;
         };
 
         if (calculate_stats) {
@@ -981,65 +837,41 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
                         G * N * nthr_per_g, nthr, ithr, chunk_start, chunk_end);
                 if (chunk_start == chunk_end) return;
 
-                dim_t g_per_n = G * nthr_per_g;
-                dim_t SP_chunk = SP / nthr_per_g;
-
                 for (dim_t i = chunk_start; i < chunk_end; i++) {
+                    const dim_t ithr_sp = (i % g_per_n) / G;
+                    const dim_t kernel_sp_block_size
+                            = get_sp_chunk_size(ithr_sp);
+                    if (kernel_sp_block_size == 0) continue;
+
                     dim_t ithr_stride_n = (i / g_per_n) * C_padded * SP;
                     dim_t ithr_stride_g = (i % G) * C_PER_G;
-                    dim_t ithr_stride_sp
-                            = ((i % g_per_n) / G) * C_padded * SP_chunk;
+                    dim_t ithr_stride_sp = ithr_sp * C_padded * SP_chunk;
                     const size_t data_off = (size_t)ithr_stride_n
                             + ithr_stride_g + ithr_stride_sp;
                     const char *__restrict src_ptr
                             = static_cast<const char *>(src)
                             + data_off * src_d.data_type_size();
 
-                    float *mean_ptr = stat_reduction + i;
-
-                    dim_t SP_tail_chunk = SP - ((i % g_per_n) / G) * SP_chunk;
-                    dim_t kernel_sp_block_size
-                            = (((i % g_per_n) / G) == nthr_per_g - 1)
-                            ? SP_tail_chunk
-                            : SP_chunk;
-                    (*kernel_mean_)(src_ptr, mean_ptr, kernel_sp_block_size);
+                    float *mean_c = stat_reduction + 2 * i * C_PER_G;
+                    float *m2_c = mean_c + C_PER_G;
+                    (*kernel_stat_)(
+                            src_ptr, mean_c, m2_c, kernel_sp_block_size);
                 }
             });
-            reduce(mean, stat_reduction);
-
-            parallel(nthr, [&](const int ithr, const int nthr) {
-                dim_t chunk_start = 0, chunk_end = 0;
-                balance211(
-                        G * N * nthr_per_g, nthr, ithr, chunk_start, chunk_end);
-                if (chunk_start == chunk_end) return;
-
-                dim_t g_per_n = G * nthr_per_g;
-                dim_t SP_chunk = SP / nthr_per_g;
 
-                for (dim_t i = chunk_start; i < chunk_end; i++) {
-                    dim_t ithr_stride_n = (i / g_per_n) * C_padded * SP;
-                    dim_t ithr_stride_g = (i % G) * C_PER_G;
-                    dim_t ithr_stride_sp
-                            = ((i % g_per_n) / G) * C_padded * SP_chunk;
-                    const size_t data_off = (size_t)ithr_stride_n
-                            + ithr_stride_g + ithr_stride_sp;
-                    const char *__restrict src_ptr
-                            = static_cast<const char *>(src)
-                            + data_off * src_d.data_type_size();
-
-                    float *mean_ptr = mean + (i % G) + (i / g_per_n) * G;
-                    float *var_ptr = stat_reduction + i;
-
-                    dim_t SP_tail_chunk = SP - ((i % g_per_n) / G) * SP_chunk;
-                    dim_t kernel_sp_block_size
-                            = (((i % g_per_n) / G) == nthr_per_g - 1)
-                            ? SP_tail_chunk
-                            : SP_chunk;
-                    (*kernel_var_)(
-                            src_ptr, mean_ptr, var_ptr, kernel_sp_block_size);
+            parallel_nd(N, G, [&](dim_t n, dim_t g) {
+                normalization_utils::welford_stat_t stat;
+                for (dim_t ithr_sp = 0; ithr_sp < nthr_per_g; ithr_sp++) {
+                    const dim_t sp_size = get_sp_chunk_size(ithr_sp);
+                    const dim_t i = n * g_per_n + ithr_sp * G + g;
+                    const float *mean_c = stat_reduction + 2 * i * C_PER_G;
+                    const float *m2_c = mean_c + C_PER_G;
+                    for (dim_t c = 0; c < C_PER_G; c++)
+                        stat.merge(sp_size, mean_c[c], m2_c[c]);
                 }
+                mean[n * G + g] = stat.mean();
+                variance[n * G + g] = stat.variance();
             });
-            reduce(variance, stat_reduction);
         }
 
         parallel(nthr, [&](const int ithr, const int nthr) {
@@ -1047,14 +879,11 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
             balance211(G * N * nthr_per_g, nthr, ithr, chunk_start, chunk_end);
             if (chunk_start == chunk_end) return;
 
-            dim_t g_per_n = G * nthr_per_g;
-            dim_t SP_chunk = SP / nthr_per_g;
-
             for (dim_t i = chunk_start; i < chunk_end; i++) {
+                const dim_t ithr_sp = (i % g_per_n) / G;
                 dim_t ithr_stride_n = (i / g_per_n) * C_padded * SP;
                 dim_t ithr_stride_g = (i % G) * C_PER_G;
-                dim_t ithr_stride_sp
-                        = ((i % g_per_n) / G) * C_padded * SP_chunk;
+                dim_t ithr_stride_sp = ithr_sp * C_padded * SP_chunk;
                 const size_t data_off = (size_t)ithr_stride_n + ithr_stride_g
                         + ithr_stride_sp;
                 const char *__restrict src_ptr = static_cast<const char *>(src)
@@ -1069,11 +898,7 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
                 float *mean_ptr = mean + (i % G) + (i / g_per_n) * G;
                 float *var_ptr = variance + (i % G) + (i / g_per_n) * G;
 
-                dim_t SP_tail_chunk = SP - ((i % g_per_n) / G) * SP_chunk;
-                dim_t kernel_sp_block_size
-                        = (((i % g_per_n) / G) == nthr_per_g - 1)
-                        ? SP_tail_chunk
-                        : SP_chunk;
+                const dim_t kernel_sp_block_size = get_sp_chunk_size(ithr_sp);
                 (*kernel_)(src_ptr, dst_ptr, scale_ptr, shift_ptr, mean_ptr,
                         var_ptr, src_scales, dst_scales,
                         post_ops_binary_rhs_arg_vec.data(),
@@ -44,12 +44,9 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
 
     status_t init(engine_t *engine) override {
         CHECK(safe_ptr_assign(kernel_, kernel_base_t::create(pd())));
-        CHECK(safe_ptr_assign(kernel_mean_, kernel_stat_base_t::create(pd())));
-        CHECK(safe_ptr_assign(
-                kernel_var_, kernel_stat_base_t::create(pd(), true)));
+        CHECK(safe_ptr_assign(kernel_stat_, kernel_stat_base_t::create(pd())));
         if (kernel_) CHECK(kernel_->create_kernel());
-        if (kernel_mean_) CHECK(kernel_mean_->create_kernel());
-        if (kernel_var_) CHECK(kernel_var_->create_kernel());
+        if (kernel_stat_) CHECK(kernel_stat_->create_kernel());
         return status::success;
     }
 
@@ -76,12 +73,11 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
     };
 
     struct kernel_stat_base_t {
-        virtual void operator()(
-                const void *src, float *mean, size_t block_size) const = 0;
-        virtual void operator()(const void *src, const float *mean, float *var,
+        // Stores the mean and the sum of squared deviations from it of every
+        // channel of a group over `block_size` spatial points.
+        virtual void operator()(const void *src, float *mean, float *m2,
                 size_t block_size) const = 0;
-        static kernel_stat_base_t *create(
-                const group_normalization_pd_t *pd, bool compute_var = false);
+        static kernel_stat_base_t *create(const group_normalization_pd_t *pd);
         virtual status_t create_kernel() = 0;
         virtual ~kernel_stat_base_t() = default;
     };
@@ -91,8 +87,7 @@ protected:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<kernel_base_t> kernel_;
-    std::unique_ptr<kernel_stat_base_t> kernel_mean_;
-    std::unique_ptr<kernel_stat_base_t> kernel_var_;
+    std::unique_ptr<kernel_stat_base_t> kernel_stat_;
 };
 
 } // namespace x64
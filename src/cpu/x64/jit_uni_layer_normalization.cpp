@@ -23,6 +23,7 @@
 #include "common/type_helpers.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
@@ -81,13 +82,17 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
                                          public jit_generator_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_lnorm_stat_and_data_kernel_t);
 
-    void operator()(const void *src, void *dst, const float *scale,
+    void operator()(const void *src, void *dst, const void *src_1,
+            void *dst_1, const size_t dst_1_stride, const float *scale,
             const float *shift, float *mean, float *var, const void *src_scales,
             const void *dst_scales, const void *post_ops_binary_rhs_arg_vec,
             const size_t block_size) const override {
         ker_args_t args;
         args.src = src;
         args.dst = dst;
+        args.src_1 = src_1;
+        args.dst_1 = dst_1;
+        args.dst_1_stride = dst_1_stride;
         args.scale = scale;
         args.shift = shift;
         args.mean = mean;
@@ -122,7 +127,12 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
         , has_ne_convert_src_xf16_(isa == avx2 && mayiuse(avx2_vnni_2)
                   && utils::one_of(
                           src_d_.data_type(), data_type::f16, data_type::bf16))
-        , skip_mean_(pd_->skip_mean()) {
+        , skip_mean_(pd_->skip_mean())
+        , fuse_add_norm_(pd_->fuse_add_norm())
+        , single_pass_stats_(calculate_stats_ && !skip_mean_
+                  && axis_simd_full_ > 0
+                  && static_cast<size_t>(C_) * src_d_.data_type_size()
+                          > platform::get_per_core_cache_size(1)) {
 
         const auto &post_ops = pd_->attr()->post_ops_;
         with_postops_ = post_ops.len() != 0;
@@ -161,6 +171,9 @@ protected:
     struct ker_args_t {
         const void *src;
         void *dst;
+        const void *src_1;
+        void *dst_1;
+        size_t dst_1_stride;
         const float *scale;
         const float *shift;
         const float *mean;
@@ -185,6 +198,9 @@ protected:
     const float eps_;
     const bool has_ne_convert_src_xf16_;
     const bool skip_mean_;
+    const bool fuse_add_norm_;
+    // A row that does not fit L1 is read once to compute both statistics.
+    const bool single_pass_stats_;
     bool with_postops_ = false;
     bool with_binary_ = false;
     bool with_eltwise_ = false;
@@ -206,6 +222,8 @@ protected:
     const Reg64 reg_var = r13;
     const Reg64 reg_src_scales = r14;
     const Reg64 reg_dst_scales = r15;
+    const Reg64 reg_src_1 = rsi;
+    const Reg64 reg_dst_1 = rbp;
 
     const Vmm vmm_tail_mask = Vmm(0);
     const Vmm vmm_zero = Vmm(4); // In unroll range, safe for dst compute.
@@ -236,8 +254,15 @@ protected:
     const Xbyak::Reg64 reg_po_injector_helper_ = r14;
     Opmask elt_inj_opmask = Opmask(elt_inj_opmask_idx);
 
+    // With the fused residual addition the normalized tensor is the sum
+    // stored to `dst_1`.
     Address src_ptr(size_t offt = 0) {
-        return vmmword[reg_src + offt * src_d_.data_type_size()];
+        return vmmword[(fuse_add_norm_ ? reg_dst_1 : reg_src)
+                + offt * src_d_.data_type_size()];
+    }
+
+    Address residual_ptr(const Reg64 &reg, size_t offt = 0) {
+        return vmmword[reg + offt * src_d_.data_type_size()];
     }
 
     Address dst_ptr(size_t offt = 0) {
@@ -430,6 +455,75 @@ protected:
             uni_vmovss(ptr[reg_var], Xmm(vmm_inv_sqrtvar.getIdx()));
     }
 
+    // Computes mean and variance within a single read of the row. Values are
+    // accumulated shifted by the mean of the first vector of the row, which
+    // keeps the sum of squares from losing precision to the mean:
+    //   mean = shift + S1 / C, var = S2 / C - (S1 / C)^2,
+    // where S1 and S2 are the sums of shifted values and of their squares.
+    void compute_stats_single_pass() {
+        const auto dt = src_d_.data_type();
+        static constexpr int unroll = 2;
+        const auto vmm_sum = [](int j) { return Vmm(1 + j); };
+        const auto vmm_sum_sq = [](int j) { return Vmm(1 + unroll + j); };
+        const auto vmm_src = [](int j) { return Vmm(1 + 2 * unroll + j); };
+
+        io_[dt]->load(src_ptr(0), vmm_mean, false);
+        reduce(vmm_mean, vmm_tmp);
+        mov(reg_tmp, float2int(1.f / simd_w_));
+        uni_vmovq(xmm_tmp, reg_tmp);
+        uni_vbroadcastss(vmm_tmp, xmm_tmp);
+        uni_vmulps(vmm_mean, vmm_mean, vmm_tmp);
+
+        for (int j = 0; j < unroll; j++) {
+            uni_vpxor(vmm_sum(j), vmm_sum(j), vmm_sum(j));
+            uni_vpxor(vmm_sum_sq(j), vmm_sum_sq(j), vmm_sum_sq(j));
+        }
+        const auto body = [&](int j, size_t offt_elems, bool tail) {
+            io_[dt]->load(src_ptr(offt_elems), vmm_src(j), tail);
+            uni_vsubps_maybe_tail(vmm_src(j), vmm_mean, tail);
+            uni_vaddps(vmm_sum(j), vmm_sum(j), vmm_src(j));
+            uni_vfmadd231ps(vmm_sum_sq(j), vmm_src(j), vmm_src(j));
+        };
+        for (int i = 0; i < axis_simd_full_; i++)
+            body(i % unroll, i * simd_w_, false);
+        if (axis_simd_tail_) body(0, axis_simd_full_ * simd_w_, true);
+
+        for (int j = 1; j < unroll; j++) {
+            uni_vaddps(vmm_sum(0), vmm_sum(0), vmm_sum(j));
+            uni_vaddps(vmm_sum_sq(0), vmm_sum_sq(0), vmm_sum_sq(j));
+        }
+        reduce(vmm_sum(0), vmm_src(0));
+        reduce(vmm_sum_sq(0), vmm_src(0));
+
+        uni_vdivps(vmm_sum(0), vmm_sum(0), vmm_c, vmm_tmp);
+        uni_vdivps(vmm_inv_sqrtvar, vmm_sum_sq(0), vmm_c, vmm_tmp);
+        uni_vaddps(vmm_mean, vmm_mean, vmm_sum(0));
+        uni_vfnmadd231ps(vmm_inv_sqrtvar, vmm_sum(0), vmm_sum(0));
+        // Rounding may produce a tiny negative variance for constant rows.
+        uni_vpxor(vmm_src(0), vmm_src(0), vmm_src(0));
+        uni_vmaxps(vmm_inv_sqrtvar, vmm_inv_sqrtvar, vmm_src(0));
+
+        if (save_stats_) {
+            uni_vmovss(ptr[reg_mean], Xmm(vmm_mean.getIdx()));
+            uni_vmovss(ptr[reg_var], Xmm(vmm_inv_sqrtvar.getIdx()));
+        }
+    }
+
+    void compute_residual_sum() {
+        const auto dt = src_d_.data_type();
+        const Vmm vmm_src = Vmm(1); // In unroll range, precedes stats compute.
+        const Vmm vmm_src_1 = Vmm(2);
+        const auto body = [&](size_t offt_elems, bool tail) {
+            io_[dt]->load(residual_ptr(reg_src, offt_elems), vmm_src, tail);
+            io_[dt]->load(residual_ptr(reg_src_1, offt_elems), vmm_src_1, tail);
+            uni_vaddps(vmm_src, vmm_src, vmm_src_1);
+            io_[dt]->store(vmm_src, residual_ptr(reg_dst_1, offt_elems), tail);
+        };
+        for (int i = 0; i < axis_simd_full_; i++)
+            body(i * simd_w_, false);
+        if (axis_simd_tail_) body(axis_simd_full_ * simd_w_, true);
+    }
+
     void calculate_ne_convert_xf16_dst_body(
             size_t offt_elems, bool tail = false) {
         io_[src_d_.data_type()]->load_two_simdw_xf16(
@@ -583,7 +677,10 @@ protected:
         mov(reg_dst_scales, ptr[reg_param + PARAM_OFF(dst_scales)]);
         mov(reg_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
         mov(reg_eps, ptr[reg_param + PARAM_OFF(eps)]);
-#undef PARAM_OFF
+        if (fuse_add_norm_) {
+            mov(reg_src_1, ptr[reg_param + PARAM_OFF(src_1)]);
+            mov(reg_dst_1, ptr[reg_param + PARAM_OFF(dst_1)]);
+        }
 
         // load epsilon
         uni_vmovq(xmm_tmp, reg_eps);
@@ -607,7 +704,13 @@ protected:
             cmp(reg_block_end, reg_src);
             jle(end, T_NEAR);
 
-            if (calculate_stats_) {
+            // The sum is stored first and then read back from cache by the
+            // statistics and the dst computations.
+            if (fuse_add_norm_) compute_residual_sum();
+
+            if (single_pass_stats_) {
+                compute_stats_single_pass();
+            } else if (calculate_stats_) {
                 // compute stats
                 if (!skip_mean_) { compute_mean(); }
                 compute_var();
@@ -635,9 +738,14 @@ protected:
             add(reg_dst, c_dst_size);
             add(reg_mean, float_size);
             add(reg_var, float_size);
+            if (fuse_add_norm_) {
+                add(reg_src_1, c_src_size);
+                add(reg_dst_1, ptr[reg_param + PARAM_OFF(dst_1_stride)]);
+            }
             jmp(unroll_loop);
         }
         L(end);
+#undef PARAM_OFF
 
         postamble();
 
@@ -718,24 +826,14 @@ struct jit_diff_ss_kernel_t : diff_ss_kernel_t, public jit_generator_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_lnorm_diff_ss_kernel_t);
 
     void operator()(const void *src, const void *diff_dst, float *diff_scale,
-            float *diff_shift, const float *mean, const float *var,
-            float *const inv_sqrtvar, const size_t block_size) const override {
+            float *diff_shift, const float *mean, const float *inv_sqrtvar,
+            const size_t block_size) const override {
         ker_args_t args;
         args.src = src;
         args.diff_dst = diff_dst;
         args.diff_scale = diff_scale;
         args.diff_shift = diff_shift;
         args.mean = mean;
-        for (size_t i = 0; i < block_size; i++) {
-#ifdef __INTEL_COMPILER
-            //Without volatile ICC with -O2 & -O3 optimizes out denominator from
-            //inv_sqrtvar and computes 1/denom with lower precision
-            const volatile float denom = sqrtf(var[i] + eps_);
-#else
-            const float denom = sqrtf(var[i] + eps_);
-#endif
-            inv_sqrtvar[i] = 1.f / denom;
-        }
         args.inv_sqrtvar = inv_sqrtvar;
         args.block_size
                 = block_size * C_ * types::data_type_size(src_d_.data_type());
@@ -746,16 +844,15 @@ struct jit_diff_ss_kernel_t : diff_ss_kernel_t, public jit_generator_t {
         return jit_generator_t::create_kernel();
     }
 
-    jit_diff_ss_kernel_t(const layer_normalization_pd_t *pd)
+    jit_diff_ss_kernel_t(const layer_normalization_pd_t *pd, dim_t C_blk)
         : diff_ss_kernel_t(pd)
         , jit_generator_t(jit_name())
         , src_d_(pd_->src_md())
         , d_dst_d_(pd_->diff_dst_md())
         , simd_w_(vlen / sizeof(float))
         , C_(pd_->norm_axis())
-        , axis_simd_full_(C_ / simd_w_)
-        , axis_simd_tail_(C_ % simd_w_)
-        , eps_(pd_->desc()->layer_norm_epsilon)
+        , axis_simd_full_(C_blk / simd_w_)
+        , axis_simd_tail_(C_blk % simd_w_)
         , skip_mean_(pd_->skip_mean()) {
 
         io::io_conf_t io_conf;
@@ -795,7 +892,6 @@ protected:
     const dim_t C_;
     const dim_t axis_simd_full_;
     const dim_t axis_simd_tail_;
-    const float eps_;
     const bool skip_mean_;
 
     const Reg64 reg_param = abi_param1;
@@ -909,11 +1005,12 @@ protected:
     }
 };
 
-diff_ss_kernel_t *diff_ss_kernel_t::create(const layer_normalization_pd_t *pd) {
+diff_ss_kernel_t *diff_ss_kernel_t::create(
+        const layer_normalization_pd_t *pd, dim_t C_blk) {
     if (mayiuse(avx512_core)) {
-        return new jit_diff_ss_kernel_t<avx512_core>(pd);
+        return new jit_diff_ss_kernel_t<avx512_core>(pd, C_blk);
     } else if (mayiuse(avx2)) {
-        return new jit_diff_ss_kernel_t<avx2>(pd);
+        return new jit_diff_ss_kernel_t<avx2>(pd, C_blk);
     } else {
         assert(!"kernel is empty.");
         return nullptr;
@@ -925,12 +1022,14 @@ struct jit_diff_data_base_kernel_t : diff_data_kernel_t,
                                      public jit_generator_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_lnorm_diff_data_kernel_t);
 
-    void operator()(const void *src, const void *diff_dst, void *diff_src,
-            const float *ss, const float *mean, float *const inv_sqrtvar,
+    void operator()(const void *src, const void *diff_dst,
+            const void *diff_dst_1, void *diff_src, const float *ss,
+            const float *mean, float *const inv_sqrtvar,
             const size_t block_size) const override {
         ker_args_t args;
         args.src = src;
         args.diff_dst = diff_dst;
+        args.diff_dst_1 = diff_dst_1;
         args.diff_src = diff_src;
         args.ss = ss;
         args.mean = mean;
@@ -957,7 +1056,8 @@ struct jit_diff_data_base_kernel_t : diff_data_kernel_t,
         , use_scale_(pd_->use_scale())
         , use_shift_(pd_->use_shift())
         , calculate_diff_stats_(!pd_->stats_are_src())
-        , skip_mean_(pd_->skip_mean()) {
+        , skip_mean_(pd_->skip_mean())
+        , fuse_add_norm_(pd_->fuse_add_norm()) {
 
         io::io_conf_t io_conf;
         io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
@@ -987,6 +1087,7 @@ protected:
     struct ker_args_t {
         const void *src;
         const void *diff_dst;
+        const void *diff_dst_1;
         void *diff_src;
         const float *ss;
         const float *mean;
@@ -1004,10 +1105,12 @@ protected:
     const bool use_shift_;
     const bool calculate_diff_stats_;
     const bool skip_mean_;
+    const bool fuse_add_norm_;
 
     const Reg64 reg_param = abi_param1;
     const Reg64 reg_src = rdx;
     const Reg64 reg_diff_dst = rax;
+    const Reg64 reg_diff_dst_1 = r15;
     const Reg64 reg_diff_src = r14;
     const Reg64 reg_mean = rbx;
     const Reg64 reg_inv_sqrtvar = r13;
@@ -1043,6 +1146,10 @@ protected:
         return vmmword[reg_diff_dst + offt * d_dst_d_.data_type_size()];
     }
 
+    Address d_dst_1_ptr(size_t offt = 0) {
+        return vmmword[reg_diff_dst_1 + offt * d_dst_d_.data_type_size()];
+    }
+
     Address d_src_ptr(size_t offt = 0) {
         return vmmword[reg_diff_src + offt * d_src_d_.data_type_size()];
     }
@@ -1083,6 +1190,11 @@ protected:
             uni_vsubps(vmm_dsrc, vmm_dsrc, vmm_src);
         }
         uni_vmulps(vmm_dsrc, vmm_dsrc, vmm_inv_sqrtvar);
+        if (fuse_add_norm_) {
+            io_[d_dst_d_.data_type()]->load(
+                    d_dst_1_ptr(offt_elems), vmm_src, tail);
+            uni_vaddps(vmm_dsrc, vmm_dsrc, vmm_src);
+        }
         io_[d_src_d_.data_type()]->store(vmm_dsrc, d_src_ptr(offt_elems), tail);
     };
 
@@ -1103,6 +1215,8 @@ protected:
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
         mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
         mov(reg_diff_dst, ptr[reg_param + PARAM_OFF(diff_dst)]);
+        if (fuse_add_norm_)
+            mov(reg_diff_dst_1, ptr[reg_param + PARAM_OFF(diff_dst_1)]);
         mov(reg_diff_src, ptr[reg_param + PARAM_OFF(diff_src)]);
         mov(reg_scale, ptr[reg_param + PARAM_OFF(ss)]);
 
@@ -1155,6 +1269,7 @@ protected:
 
             add(reg_src, c_src_size);
             add(reg_diff_dst, c_ddst_size);
+            if (fuse_add_norm_) add(reg_diff_dst_1, c_ddst_size);
             add(reg_diff_src, c_dsrc_size);
             if (calculate_diff_stats_ && !skip_mean_) add(reg_mean, float_size);
             add(reg_inv_sqrtvar, float_size);
@@ -1224,6 +1339,9 @@ status_t jit_uni_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
             VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_LNORM(utils::one_of(dst_md()->data_type, f32, bf16, f16, s8, u8),
             VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_LNORM(IMPLICATION(fuse_add_norm(),
+                            utils::one_of(src_md()->data_type, f32, bf16, f16)),
+            VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_LNORM(IMPLICATION(utils::one_of(bf16, src_md()->data_type,
                                         dst_md()->data_type),
                             mayiuse(avx512_core) || mayiuse(avx2_vnni_2)),
@@ -1285,11 +1403,14 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
     auto scratchpad = ctx.get_scratchpad_grantor();
     const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    const auto src_1 = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
+    auto dst_1 = CTX_OUT_MEM(void *, DNNL_ARG_DST_1);
 
     auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
     auto shift = CTX_IN_MEM(const float *, DNNL_ARG_SHIFT);
 
     bool skip_mean = pd()->skip_mean();
+    const bool fuse_add_norm = pd()->fuse_add_norm();
 
     float *mean, *variance;
     if (pd()->use_tmp_stats()) {
@@ -1329,6 +1450,25 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
                 + N_start * C_padded * src_d.data_type_size();
         char *const __restrict dst_ptr = reinterpret_cast<char *>(dst)
                 + N_start * C_padded * dst_d.data_type_size();
+        const char *src_1_ptr = nullptr;
+        char *dst_1_ptr = nullptr;
+        size_t dst_1_stride = 0;
+        if (fuse_add_norm) {
+            const size_t row_size = C_padded * src_d.data_type_size();
+            src_1_ptr = reinterpret_cast<const char *>(src_1)
+                    + N_start * row_size;
+            // Without the sum output every row of the sum is written to the
+            // same per-thread buffer.
+            if (dst_1) {
+                dst_1_ptr = reinterpret_cast<char *>(dst_1)
+                        + N_start * row_size;
+                dst_1_stride = row_size;
+            } else {
+                dst_1_ptr = scratchpad.template get<char>(
+                                    key_lnorm_residual_sum)
+                        + ithr * row_size;
+            }
+        }
         const int block_size = N_end - N_start;
         float *mean_ptr = skip_mean ? nullptr : &mean[N_start];
         float *dst_scales_inv_ptr = nullptr;
@@ -1341,7 +1481,8 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
             dst_scales_inv_ptr[0] = 1.f / dst_scales_ptr[0];
         }
 
-        (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift, mean_ptr,
+        (*stat_and_data_kernel_)(src_ptr, dst_ptr, src_1_ptr, dst_1_ptr,
+                dst_1_stride, scale, shift, mean_ptr,
                 &variance[N_start], src_scales, dst_scales_inv_ptr,
                 post_ops_binary_rhs_arg_vec.data(), block_size);
     });
@@ -1355,6 +1496,7 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
     auto scratchpad = ctx.get_scratchpad_grantor();
     auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
     auto diff_dst = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST);
+    auto diff_dst_1 = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST_1);
     auto scale = CTX_IN_MEM(float *, DNNL_ARG_SCALE);
     auto diff_src = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DIFF_SRC, status);
 
@@ -1386,48 +1528,90 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
     const dim_t C = pd()->norm_axis();
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
 
-    float *reduce = scratchpad.template get<float>(key_lnorm_reduction);
-    if (diff_scale == nullptr)
-        diff_scale = scratchpad.template get<float>(key_lnorm_tmp_diff_ss);
-    if (diff_shift == nullptr) {
-        diff_shift = scratchpad.template get<float>(key_lnorm_tmp_diff_ss);
-    }
-
-    const int max_nthr = pd()->nthr_;
-
-    parallel(max_nthr, [&](int ithr, int nthr) {
-        dim_t N_start = 0, N_end = 0;
-        balance211(N, nthr, ithr, N_start, N_end);
-        const int block_size = N_end - N_start;
-        const char *const __restrict src_ptr
-                = reinterpret_cast<const char *>(src)
-                + N_start * C_padded * src_d.data_type_size();
-        const char *const __restrict diff_dst_ptr
-                = reinterpret_cast<const char *>(diff_dst)
-                + N_start * C_padded * diff_dst_d.data_type_size();
+    float *const tmp_diff_ss
+            = scratchpad.template get<float>(key_lnorm_tmp_diff_ss);
+    if (diff_scale == nullptr) diff_scale = tmp_diff_ss;
+    if (diff_shift == nullptr) diff_shift = tmp_diff_ss + C;
 
-        float *my_diff_gamma = reduce + C * ithr;
-        float *my_diff_beta = reduce + C * nthr + C * ithr;
-        for (dim_t c = 0; c < C; c++) {
-            my_diff_gamma[c] = 0.;
-            my_diff_beta[c] = 0.;
-        }
-        const float *mean_ptr = skip_mean ? nullptr : &mean[N_start];
-        (*diff_ss_kernel_)(src_ptr, diff_dst_ptr, my_diff_gamma, my_diff_beta,
-                mean_ptr, &variance[N_start], &inv_sqrtvar[N_start],
-                block_size);
+    const float eps = pd()->desc()->layer_norm_epsilon;
+    parallel_nd(N, [&](dim_t n) {
+#ifdef __INTEL_COMPILER
+        //Without volatile ICC with -O2 & -O3 optimizes out denominator from
+        //inv_sqrtvar and computes 1/denom with lower precision
+        const volatile float denom = sqrtf(variance[n] + eps);
+#else
+        const float denom = sqrtf(variance[n] + eps);
+#endif
+        inv_sqrtvar[n] = 1.f / denom;
     });
 
-    parallel_nd(C, [&](dim_t c) {
-        float diff_gamma = 0, diff_beta = 0;
-        for (dim_t n = 0; n < max_nthr; n++) {
-            diff_gamma += reduce[C * n + c];
-            diff_beta += reduce[C * max_nthr + C * n + c];
+    const bool calculate_diff_ss
+            = pd()->desc()->prop_kind == prop_kind::backward
+            && (pd()->use_scale() || pd()->use_shift());
+    if (calculate_diff_ss) {
+        const dim_t nthr_N = pd()->ss_nthr_N_;
+        const dim_t nthr_C = pd()->ss_nthr_C_;
+        const dim_t C_blk = pd()->ss_C_blk_;
+
+        float *const reduce
+                = scratchpad.template get<float>(key_lnorm_reduction);
+        float *const diff_gamma = nthr_N == 1 ? diff_scale : reduce;
+        float *const diff_beta = nthr_N == 1 ? diff_shift : reduce + C * nthr_N;
+
+        parallel_nd(nthr_N, nthr_C, [&](dim_t ithr_N, dim_t ithr_C) {
+            dim_t N_start = 0, N_end = 0;
+            balance211(N, nthr_N, ithr_N, N_start, N_end);
+            const bool is_tail = ithr_C == nthr_C - 1;
+            const dim_t C_start = ithr_C * C_blk;
+            const dim_t C_len = is_tail ? C - C_start : C_blk;
+            const char *const __restrict src_ptr
+                    = reinterpret_cast<const char *>(src)
+                    + (N_start * C_padded + C_start) * src_d.data_type_size();
+            const char *const __restrict diff_dst_ptr
+                    = reinterpret_cast<const char *>(diff_dst)
+                    + (N_start * C_padded + C_start)
+                            * diff_dst_d.data_type_size();
+
+            float *my_diff_gamma = diff_gamma + C * ithr_N + C_start;
+            float *my_diff_beta = diff_beta + C * ithr_N + C_start;
+            for (dim_t c = 0; c < C_len; c++) {
+                my_diff_gamma[c] = 0.;
+                my_diff_beta[c] = 0.;
+            }
+            const float *mean_ptr = skip_mean ? nullptr : &mean[N_start];
+            const auto &kernel
+                    = is_tail ? diff_ss_tail_kernel_ : diff_ss_kernel_;
+            (*kernel)(src_ptr, diff_dst_ptr, my_diff_gamma, my_diff_beta,
+                    mean_ptr, &inv_sqrtvar[N_start], N_end - N_start);
+        });
+
+        // The partial sums are reduced by blocks of columns, so that the
+        // reduction is spread over all threads and reads contiguous pieces
+        // of the rows.
+        if (nthr_N > 1) {
+            const dim_t C_chunk = 64;
+            parallel_nd(utils::div_up(C, C_chunk), [&](dim_t cb) {
+                const dim_t C_start = cb * C_chunk;
+                const dim_t C_end = nstl::min(C, C_start + C_chunk);
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = C_start; c < C_end; c++) {
+                    diff_scale[c] = diff_gamma[c];
+                    diff_shift[c] = diff_beta[c];
+                }
+                for (dim_t n = 1; n < nthr_N; n++) {
+                    const float *my_diff_gamma = diff_gamma + C * n;
+                    const float *my_diff_beta = diff_beta + C * n;
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t c = C_start; c < C_end; c++) {
+                        diff_scale[c] += my_diff_gamma[c];
+                        diff_shift[c] += my_diff_beta[c];
+                    }
+                }
+            });
         }
-        diff_scale[c] = diff_gamma;
-        diff_shift[c] = diff_beta;
-    });
+    }
 
+    const int max_nthr = pd()->nthr_;
     parallel(max_nthr, [&](int ithr, int nthr) {
         dim_t N_start = 0, N_end = 0;
         balance211(N, nthr, ithr, N_start, N_end);
@@ -1438,12 +1622,17 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
         const char *const __restrict diff_dst_ptr
                 = reinterpret_cast<const char *>(diff_dst)
                 + N_start * C_padded * diff_dst_d.data_type_size();
+        const char *const __restrict diff_dst_1_ptr = diff_dst_1
+                ? reinterpret_cast<const char *>(diff_dst_1)
+                        + N_start * C_padded * diff_dst_d.data_type_size()
+                : nullptr;
         char *const __restrict diff_src_ptr = reinterpret_cast<char *>(diff_src)
                 + N_start * C_padded * diff_src_d.data_type_size();
 
         const float *mean_ptr = skip_mean ? nullptr : &mean[N_start];
-        (*diff_data_kernel_)(src_ptr, diff_dst_ptr, diff_src_ptr, scale,
-                mean_ptr, &inv_sqrtvar[N_start], block_size);
+        (*diff_data_kernel_)(src_ptr, diff_dst_ptr, diff_dst_1_ptr,
+                diff_src_ptr, scale, mean_ptr, &inv_sqrtvar[N_start],
+                block_size);
     });
     return status::success;
 }
@@ -40,7 +40,8 @@ struct stat_and_data_kernel_t {
     static stat_and_data_kernel_t *create(const layer_normalization_pd_t *pd);
     virtual ~stat_and_data_kernel_t() = default;
 
-    virtual void operator()(const void *src, void *dst, const float *scale,
+    virtual void operator()(const void *src, void *dst, const void *src_1,
+            void *dst_1, const size_t dst_1_stride, const float *scale,
             const float *shift, float *mean, float *var, const void *src_scales,
             const void *dst_scales, const void *post_ops_binary_rhs_arg_vec,
             const size_t block_size) const {};
@@ -53,14 +54,16 @@ protected:
     const layer_normalization_pd_t *pd_;
 };
 
+// Accumulates diff_gamma and diff_beta over the rows of a block for `C_blk`
+// columns starting at the passed pointers; rows are `norm_axis()` apart.
 struct diff_ss_kernel_t {
-    static diff_ss_kernel_t *create(const layer_normalization_pd_t *pd);
+    static diff_ss_kernel_t *create(
+            const layer_normalization_pd_t *pd, dim_t C_blk);
     virtual ~diff_ss_kernel_t() = default;
 
     virtual void operator()(const void *src, const void *diff_dst,
             float *diff_gamma, float *diff_beta, const float *mean,
-            const float *var, float *const inv_sqrtvar,
-            const size_t block_size) const {};
+            const float *inv_sqrtvar, const size_t block_size) const {};
 
     virtual status_t create_kernel() { return status::success; }
 
@@ -75,8 +78,9 @@ struct diff_data_kernel_t {
     virtual ~diff_data_kernel_t() = default;
 
     virtual void operator()(const void *src, const void *diff_dst,
-            void *diff_src, const float *ss, const float *mean,
-            float *const inv_sqrtvar, const size_t block_size) const {};
+            const void *diff_dst_1, void *diff_src, const float *ss,
+            const float *mean, float *const inv_sqrtvar,
+            const size_t block_size) const {};
 
     virtual status_t create_kernel() { return status::success; }
 
@@ -120,6 +124,14 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
                 scratchpad.book(key_lnorm_dst_scales,
                         static_cast<size_t>(nthr_) * sizeof(float), 64);
             }
+            // A row of the residual sum per thread when it is not requested
+            // as an output.
+            if (fuse_add_norm()) {
+                scratchpad.book(key_lnorm_residual_sum,
+                        static_cast<size_t>(nthr_) * norm_axis()
+                                * types::data_type_size(src_md()->data_type),
+                        64);
+            }
         }
     };
 
@@ -266,6 +278,7 @@ struct jit_uni_layer_normalization_bwd_t : public primitive_t {
             }
 
             nthr_ = dnnl_get_max_threads();
+            init_ss_blocking();
             init_scratchpad();
             return status::success;
         }
@@ -276,7 +289,32 @@ struct jit_uni_layer_normalization_bwd_t : public primitive_t {
         memory_desc_t reordered_stat_md_;
         int nthr_; // To not exceed the limit in execute used for set up.
 
+        // The accumulation of diff_gamma and diff_beta is split between
+        // ss_nthr_N_ groups of rows and ss_nthr_C_ blocks of ss_C_blk_
+        // columns, the last block having ss_C_tail_ columns. The partial sums
+        // take ss_nthr_N_ rows of C values instead of a row per thread, and
+        // are final when there is a single group of rows.
+        dim_t ss_nthr_N_ = 1;
+        dim_t ss_nthr_C_ = 1;
+        dim_t ss_C_blk_ = 0;
+        dim_t ss_C_tail_ = 0;
+
     private:
+        void init_ss_blocking() {
+            // The columns are split only for rows long enough to keep whole
+            // pages of every row in a block.
+            const dim_t min_C_blk = 1024;
+            const dim_t simd_w = mayiuse(avx512_core) ? 16 : 8;
+            const dim_t C = norm_axis();
+            ss_nthr_C_ = nstl::max<dim_t>(
+                    1, nstl::min<dim_t>(nthr_, C / min_C_blk));
+            ss_C_blk_ = utils::rnd_up(utils::div_up(C, ss_nthr_C_), simd_w);
+            ss_nthr_C_ = utils::div_up(C, ss_C_blk_);
+            ss_C_tail_ = C - (ss_nthr_C_ - 1) * ss_C_blk_;
+            ss_nthr_N_ = nstl::max<dim_t>(1,
+                    nstl::min<dim_t>(across_axis(), nthr_ / ss_nthr_C_));
+        }
+
         void init_scratchpad() {
             using namespace memory_tracking::names;
             auto scratchpad = scratchpad_registry().registrar();
@@ -286,8 +324,9 @@ struct jit_uni_layer_normalization_bwd_t : public primitive_t {
                 scratchpad.template book<float>(
                         key_lnorm_tmp_var, across_axis());
             }
-            scratchpad.template book<float>(
-                    key_lnorm_reduction, 2 * norm_axis() * nthr_);
+            if (ss_nthr_N_ > 1)
+                scratchpad.template book<float>(
+                        key_lnorm_reduction, 2 * norm_axis() * ss_nthr_N_);
             scratchpad.template book<float>(
                     key_lnorm_tmp_diff_ss, 2 * norm_axis());
             if (reordered_stat_md_ != *stat_md() && !stats_are_tmp()) {
@@ -301,10 +340,16 @@ struct jit_uni_layer_normalization_bwd_t : public primitive_t {
     status_t init(engine_t *engine) override {
         if (pd()->reorder_pd_)
             pd()->reorder_pd_->create_primitive(reorder_, engine);
-        CHECK(safe_ptr_assign(diff_ss_kernel_, diff_ss_kernel_t::create(pd())));
+        if (pd()->ss_nthr_C_ > 1) {
+            CHECK(safe_ptr_assign(diff_ss_kernel_,
+                    diff_ss_kernel_t::create(pd(), pd()->ss_C_blk_)));
+            if (diff_ss_kernel_) CHECK(diff_ss_kernel_->create_kernel());
+        }
+        CHECK(safe_ptr_assign(diff_ss_tail_kernel_,
+                diff_ss_kernel_t::create(pd(), pd()->ss_C_tail_)));
         CHECK(safe_ptr_assign(
                 diff_data_kernel_, diff_data_kernel_t::create(pd())));
-        if (diff_ss_kernel_) CHECK(diff_ss_kernel_->create_kernel());
+        if (diff_ss_tail_kernel_) CHECK(diff_ss_tail_kernel_->create_kernel());
         if (diff_data_kernel_) CHECK(diff_data_kernel_->create_kernel());
         return status::success;
     }
@@ -370,6 +415,7 @@ private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<diff_ss_kernel_t> diff_ss_kernel_;
+    std::unique_ptr<diff_ss_kernel_t> diff_ss_tail_kernel_;
     std::unique_ptr<diff_data_kernel_t> diff_data_kernel_;
     std::shared_ptr<primitive_t> reorder_;
 };
@@ -382,6 +382,12 @@ status_t jit_uni_pool_kernel_t<isa>::init_conf(
 
     jpp.ind_dt = ppd->workspace_md() ? ppd->workspace_md()->data_type
                                      : data_type::undef;
+    VDISPATCH_POOLING_IC(IMPLICATION(jpp.ind_dt == data_type::u4,
+                                 is_avx512
+                                         && jpp.tag_kind
+                                                 == jit_memory_tag_kind_t::
+                                                         blocked),
+            VERBOSE_UNSUPPORTED_DT);
 
     jpp.simple_alg = jpp.is_training
             || IMPLICATION(jpp.is_backward, jpp.kd <= jpp.stride_d);
@@ -578,7 +584,21 @@ inline void jit_uni_pool_kernel_t<isa>::pad_with_zeros(const int idx) {
 template <cpu_isa_t isa>
 inline void jit_uni_pool_kernel_t<isa>::load_indices(
         const int indr_i, const int step_index, bool is_c_tail_processing) {
-    if (jpp.ind_dt == data_type::u8) {
+    if (jpp.ind_dt == data_type::u4) {
+        // The indices of the even and odd channels are in the low and the
+        // high nibbles of the bytes. The blocked layout is padded, so that
+        // the tail is loaded as a whole block.
+        assert(is_superset(isa, avx512_core)
+                && jpp.tag_kind == jit_memory_tag_kind_t::blocked);
+        auto indvr = vreg(indr_i);
+        auto indxr = xreg(indr_i);
+        vmovq(indxr, ptr[reg_index + step_index]);
+        vpsrlw(xmm_tmp, indxr, 4);
+        vpunpcklbw(indxr, indxr, xmm_tmp);
+        vpmovzxbd(indvr, indxr);
+        vpslld(indvr, indvr, 28);
+        vpsrld(indvr, indvr, 28);
+    } else if (jpp.ind_dt == data_type::u8) {
         auto indvr = vreg(indr_i);
         auto indxr = xreg(indr_i);
         if (isa == sse41) {
@@ -623,7 +643,25 @@ template <cpu_isa_t isa>
 inline void jit_uni_pool_kernel_t<isa>::store_indices(const int indr_i,
         const int step_index, const bool is_c_tail_processing,
         const bool is_first_w_block) {
-    if (jpp.ind_dt == data_type::u8) {
+    if (jpp.ind_dt == data_type::u4) {
+        // The indices are below 16, so that a word of two byte indices
+        // shifted by 4 and or-ed with itself has both nibbles in its low
+        // byte.
+        assert(is_superset(isa, avx512_core)
+                && jpp.tag_kind == jit_memory_tag_kind_t::blocked);
+        auto vr = vreg(indr_i);
+        auto xr = xreg(indr_i);
+        if (is_c_tail_processing) {
+            assert(jpp.is_c_padded);
+            knotw(k_c_tail_mask, k_c_tail_mask);
+            vpxord(vr | k_c_tail_mask, vr, vr);
+            knotw(k_c_tail_mask, k_c_tail_mask);
+        }
+        vpmovusdb(xr, vr);
+        vpsrlw(xmm_tmp, xr, 4);
+        vpor(xr, xr, xmm_tmp);
+        vpmovwb(ptr[reg_index + step_index], xr);
+    } else if (jpp.ind_dt == data_type::u8) {
         auto xr = xreg(indr_i);
         if (isa == sse41) {
             for (int i = 0; i < (jpp.c_block / 2); ++i) {
@@ -1092,8 +1130,8 @@ inline void jit_uni_pool_kernel_t<isa>::max_step_fwd(int ur_w, int ur_bc,
                 is_c_tail_processing);
 
         if (jpp.is_training) {
-            const size_t step_index = (jj * c_off + bci * c_block)
-                    * types::data_type_size(jpp.ind_dt);
+            const size_t step_index = types::elements_to_bytes(
+                    jpp.ind_dt, jj * c_off + bci * c_block);
 
             const auto indr_i = reg_ind(2, bci, jj, ur_bc, ur_w);
             const bool is_first_w_block = jj == 0;
@@ -1143,8 +1181,8 @@ inline void jit_uni_pool_kernel_t<isa>::max_step_bwd(int ur_w, int ur_bc,
         const bool is_c_tail_processing = is_tail_processing(bci);
         load(jpp.dst_dt, reg_idx(outr_i), reg_output, out_offset,
                 is_c_tail_processing);
-        const size_t step_index = (jj * output_c_off + bci * c_block)
-                * types::data_type_size(jpp.ind_dt);
+        const size_t step_index = types::elements_to_bytes(
+                jpp.ind_dt, jj * output_c_off + bci * c_block);
 
         const auto indr_i = reg_ind(1, bci, jj, ur_bc, ur_w);
         load_indices(indr_i, step_index, is_c_tail_processing);
@@ -1406,8 +1444,9 @@ void jit_uni_pool_kernel_t<isa>::generate() {
         add(reg_output, output_dt_size * ur_w * output_c_off - shift);
         if (jpp.alg == pooling_max && (jpp.is_training || jpp.is_backward)) {
             auto ishift = (isa == sse41) ? jpp.c_block / 2 : 0;
-            auto ind_dt_size = types::data_type_size(jpp.ind_dt);
-            add(reg_index, (ur_w * output_c_off - ishift) * ind_dt_size);
+            add(reg_index,
+                    types::elements_to_bytes(
+                            jpp.ind_dt, ur_w * output_c_off - ishift));
         }
     };
 
@@ -697,8 +697,6 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward(const data_t *src,
     const memory_desc_wrapper src_d = pd()->src_md();
     const memory_desc_wrapper dst_d = pd()->dst_md();
     const memory_desc_wrapper indices_d = pd()->workspace_md();
-    const auto ind_dt_size
-            = indices ? types::data_type_size(indices_d.data_type()) : 0;
     const auto &jpp = pd()->jpp_;
     const auto post_ops_binary_rhs_arg_vec
             = binary_injector::prepare_binary_args(jpp.post_ops, ctx);
@@ -756,9 +754,9 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward(const data_t *src,
             if (trans_dst)
                 args.indices = transpose_facade.get_indices_addr(ithr, oh, jpp);
             else {
-                const size_t ind_off = indices_d.blk_off(n, c_off, oh);
-                args.indices = static_cast<const void *>(
-                        &indices[ind_off * ind_dt_size]);
+                const size_t ind_off = types::elements_to_bytes(
+                        indices_d.data_type(), indices_d.blk_off(n, c_off, oh));
+                args.indices = static_cast<const void *>(&indices[ind_off]);
             }
         }
         args.kh_padding = jpp.kh - i_t_overflow - i_b_overflow;
@@ -827,8 +825,6 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward_3d(const data_t *src,
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
     const memory_desc_wrapper indices_d(pd()->workspace_md());
-    const size_t ind_dt_size
-            = indices ? types::data_type_size(indices_d.data_type()) : 0;
     const auto post_ops_binary_rhs_arg_vec
             = binary_injector::prepare_binary_args(jpp.post_ops, ctx);
 
@@ -885,8 +881,10 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward_3d(const data_t *src,
                 args.indices = transpose_facade.get_indices_addr_3d(
                         ithr, od, oh, jpp);
             } else {
-                const size_t ind_off = indices_d.blk_off(n, c_off, od, oh);
-                args.indices = &indices[ind_off * ind_dt_size];
+                const size_t ind_off = types::elements_to_bytes(
+                        indices_d.data_type(),
+                        indices_d.blk_off(n, c_off, od, oh));
+                args.indices = &indices[ind_off];
             }
         }
 
@@ -1042,8 +1040,6 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward(
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper indices_d(pd()->workspace_md());
-    const size_t ind_dt_size
-            = indices ? types::data_type_size(indices_d.data_type()) : 0;
     const auto &jpp = pd()->jpp_;
     const auto transpose_facade
             = jit_uni_pooling_utils::bwd_pooling_transpose_facade_t<data_t,
@@ -1086,8 +1082,9 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward(
                 args.indices = transpose_facade.get_indices_addr(ithr, oh, jpp);
 
             else {
-                const size_t ind_off = indices_d.blk_off(n, c_off, oh);
-                args.indices = &indices[ind_off * ind_dt_size];
+                const size_t ind_off = types::elements_to_bytes(
+                        indices_d.data_type(), indices_d.blk_off(n, c_off, oh));
+                args.indices = &indices[ind_off];
             }
         }
 
@@ -1167,8 +1164,6 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward_3d(
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper indices_d(pd()->workspace_md());
-    const size_t ind_dt_size
-            = indices ? types::data_type_size(indices_d.data_type()) : 0;
 
     const auto &jpp = pd()->jpp_;
 
@@ -1234,8 +1229,10 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward_3d(
                 args.indices = transpose_facade.get_indices_addr_3d(
                         ithr, od, oh, jpp);
             } else {
-                const size_t ind_off = indices_d.blk_off(n, c_off, od, oh);
-                args.indices = (const void *)&indices[ind_off * ind_dt_size];
+                const size_t ind_off = types::elements_to_bytes(
+                        indices_d.data_type(),
+                        indices_d.blk_off(n, c_off, od, oh));
+                args.indices = (const void *)&indices[ind_off];
             }
         }
 
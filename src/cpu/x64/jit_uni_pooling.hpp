@@ -68,7 +68,7 @@ struct jit_uni_pooling_fwd_t : public primitive_t {
             const bool is_training
                     = desc_.prop_kind == prop_kind::forward_training;
             if (desc()->alg_kind == alg_kind::pooling_max && is_training)
-                init_default_ws();
+                init_default_ws(compact_ws_data_type());
 
             CHECK(jit_uni_pool_kernel_t<isa>::init_conf(jpp_, attr_, this));
 
@@ -79,6 +79,23 @@ struct jit_uni_pooling_fwd_t : public primitive_t {
         }
 
         jit_pool_conf_t jpp_;
+
+    private:
+        // With AVX-512 and the blocked layouts, the indices of the kernels
+        // of up to 16 points are packed by 2 in the bytes of the workspace.
+        data_type_t compact_ws_data_type() const {
+            using namespace format_tag;
+            const bool is_blocked_16c = memory_desc_matches_one_of_tag(
+                                                *dst_md(), nCw16c, nChw16c,
+                                                nCdhw16c)
+                    != format_tag::undef;
+            const dim_t ker_sz
+                    = utils::array_product(desc()->kernel, spatial_ndims());
+            return is_superset(isa, avx512_core) && is_blocked_16c
+                            && ker_sz <= 16
+                    ? data_type::u4
+                    : data_type::undef;
+        }
     };
 
     explicit jit_uni_pooling_fwd_t(const pd_t *apd);
@@ -149,7 +149,8 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
     VDISPATCH_REDUCTION(
             !(utils::one_of(conf_.alg, reduction_norm_lp_max,
                     reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
-                    reduction_norm_lp_power_p_sum)),
+                    reduction_norm_lp_power_p_sum, reduction_arg_max,
+                    reduction_arg_min)),
             VERBOSE_BAD_ALGORITHM);
 
     return status::success;
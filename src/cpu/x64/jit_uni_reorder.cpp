@@ -15,7 +15,10 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <cstring>
+#include <map>
 #include <numeric>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl_debug.h"
 
@@ -24,6 +27,7 @@
 #include "common/memory_desc_wrapper.hpp"
 #include "common/nstl.hpp"
 #include "common/primitive.hpp"
+#include "common/rw_mutex.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -2708,9 +2712,110 @@ void jit_uni_reorder_t::fill_curr_data_chunks(const tr::prb_t &prb,
     }
 }
 
+namespace {
+// Kernels are shared between reorders through a process-wide registry keyed
+// by the kernel part of the problem, so that reorders differing only in the
+// dimensions processed by the driver (e.g. the outer dimensions of a batch
+// of tensors) or in offsets reuse the kernel instead of generating it again.
+// The driver nodes are visible to the kernel only through tail processing,
+// hence they are a part of the key only for problems with tails. The
+// registry does not own the kernels.
+struct shared_kernel_key_t {
+    shared_kernel_key_t(const tr::kernel_t::desc_t &desc) {
+        const auto &prb = desc.prb;
+        const auto push_float = [&](float f) {
+            uint32_t bits = 0;
+            std::memcpy(&bits, &f, sizeof(bits));
+            fields_.push_back(bits);
+        };
+        fields_.push_back(desc.id);
+        fields_.push_back(prb.itype);
+        fields_.push_back(prb.otype);
+        fields_.push_back(prb.ndims);
+        fields_.push_back(prb.full_ndims);
+        fields_.push_back(static_cast<int64_t>(prb.src_scale_type));
+        fields_.push_back(static_cast<int64_t>(prb.dst_scale_type));
+        push_float(prb.beta);
+        push_float(prb.scale_adjust);
+        fields_.push_back(prb.is_tail_present);
+        fields_.push_back(prb.compensation_mask);
+        fields_.push_back(prb.req_s8s8_comp);
+        fields_.push_back(prb.req_asymmetric_comp);
+        fields_.push_back(prb.req_src_zp);
+        fields_.push_back(prb.req_dst_zp);
+        const int nnodes = prb.is_tail_present ? prb.full_ndims : prb.ndims;
+        for (int d = 0; d < nnodes; d++) {
+            const auto &node = prb.nodes[d];
+            fields_.push_back(static_cast<int64_t>(node.n));
+            fields_.push_back(static_cast<int64_t>(node.tail_size));
+            fields_.push_back(node.dim_id);
+            fields_.push_back(node.parent_node_id);
+            fields_.push_back(node.is_zero_pad_needed);
+            fields_.push_back(node.is);
+            fields_.push_back(node.os);
+            fields_.push_back(node.ss);
+            fields_.push_back(node.cs);
+        }
+    }
+
+    bool operator<(const shared_kernel_key_t &rhs) const {
+        return fields_ < rhs.fields_;
+    }
+
+private:
+    std::vector<int64_t> fields_;
+};
+
+using shared_kernel_map_t
+        = std::map<shared_kernel_key_t, std::weak_ptr<tr::kernel_t>>;
+
+status_t get_shared_kernel(const tr::kernel_t::desc_t &desc,
+        std::shared_ptr<tr::kernel_t> &kernel) {
+    static utils::rw_mutex_t mutex;
+    static shared_kernel_map_t map;
+    // Entries of released kernels are dropped once the registry doubles.
+    static size_t prune_size = 64;
+
+    const shared_kernel_key_t key(desc);
+    {
+        utils::lock_read_t lock(mutex);
+        const auto it = map.find(key);
+        if (it != map.end()) kernel = it->second.lock();
+    }
+    if (kernel) return status::success;
+
+    // The kernel generation is done outside of the lock, another thread may
+    // register the same kernel meanwhile, in which case that one is used.
+    std::shared_ptr<tr::kernel_t> new_kernel(tr::kernel_t::create(desc));
+    if (!new_kernel) return status::out_of_memory;
+    CHECK(new_kernel->create_kernel());
+    kernel = new_kernel;
+
+    utils::lock_write_t lock(mutex);
+    auto it = map.find(key);
+    if (it == map.end()) {
+        if (map.size() >= prune_size) {
+            for (auto e = map.begin(); e != map.end();) {
+                if (e->second.expired())
+                    e = map.erase(e);
+                else
+                    ++e;
+            }
+            prune_size = nstl::max(prune_size, 2 * map.size());
+        }
+        it = map.emplace(key, std::weak_ptr<tr::kernel_t>()).first;
+    }
+    const auto registered = it->second.lock();
+    if (registered)
+        kernel = registered;
+    else
+        it->second = kernel;
+    return status::success;
+}
+} // namespace
+
 status_t jit_uni_reorder_t::init(engine_t *engine) {
-    CHECK(safe_ptr_assign(kernel_, tr::kernel_t::create(pd()->ker_desc_)));
-    return kernel_->create_kernel();
+    return get_shared_kernel(pd()->ker_desc_, kernel_);
 }
 
 status_t jit_uni_reorder_t::execute(const exec_ctx_t &ctx) const {
@@ -2762,7 +2867,12 @@ status_t jit_uni_reorder_t::execute(const exec_ctx_t &ctx) const {
     const auto wspace_per_thr_size = utils::rnd_up(G * N, cache_line_size);
     const auto wspace_per_thr_bytes = wspace_per_thr_size * sizeof(int32_t);
 
-    const int nthr_par = ndims_level == 0 ? 1 : pd()->nthr_;
+    // The scratchpad is booked for pd()->nthr_ threads, so a small problem
+    // may use fewer of them.
+    const dim_t bytes = memory_desc_wrapper(pd()->src_md()).size() + od.size();
+    const int nthr_par = ndims_level == 0
+            ? 1
+            : nthr_by_work(pd()->nthr_, bytes, min_bytes_per_thr);
     parallel(nthr_par, [&](const int ithr, const int nthr) {
         int32_t *compensation_scratch = nullptr;
         if (req_compensation) {
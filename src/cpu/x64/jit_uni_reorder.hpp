@@ -18,6 +18,7 @@
 #define CPU_X64_JIT_UNI_REORDER_HPP
 
 #include <assert.h>
+#include <memory>
 
 #include "common/c_types_map.hpp"
 #include "common/type_helpers.hpp"
@@ -267,7 +268,8 @@ private:
             const dim_t wspace_per_thr_size) const;
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
-    std::unique_ptr<tr::kernel_t> kernel_;
+    // Shared with other reorders with the same kernel problem.
+    std::shared_ptr<tr::kernel_t> kernel_;
 };
 
 struct jit_blk_reorder_t : public primitive_t {
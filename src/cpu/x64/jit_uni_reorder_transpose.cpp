@@ -0,0 +1,465 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_uni_reorder_transpose.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace Xbyak;
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Transposes tiles of `tile` x `tile` elements, with a row of a tile in a
+// vector register. The rows are interleaved in pairs in log2(tile) steps,
+// first with units of growing size within 128-bit lanes and then with whole
+// lanes, after which register `i` holds column `i` of the tile.
+template <typename Vmm>
+struct transpose_kernel_t : public jit_uni_reorder_transpose_t::kernel_base_t,
+                            public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(transpose_kernel_t)
+
+    transpose_kernel_t(const jit_uni_reorder_transpose_t::pd_t *pd)
+        : jit_uni_reorder_transpose_t::kernel_base_t(pd)
+        , jit_generator_t(jit_name(), pd->isa_)
+        , isa_(pd->isa_)
+        , dt_size_(pd->dt_size_)
+        , tile_(static_cast<int>(pd->tile_))
+        , src_ld_(pd->src_ld_ * pd->dt_size_)
+        , dst_ld_(pd->dst_ld_ * pd->dt_size_) {
+        assert(tile_ * dt_size_ == vlen_);
+    }
+
+    static constexpr int vlen_ = vreg_traits_t<Vmm>::vlen;
+
+    void operator()(const void *src, void *dst, dim_t m_tiles,
+            dim_t n_tiles) const override {
+        ker_args_t args;
+        args.src = src;
+        args.dst = dst;
+        args.m_tiles = m_tiles;
+        args.n_tiles = n_tiles;
+        jit_generator_t::operator()(&args);
+    }
+
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+    // Interleaves the units of `unit` bytes of the low or the high halves of
+    // the 128-bit lanes of `a` and `b`.
+    void unpack(int unit, bool lo, const Vmm &dst, const Vmm &a, const Vmm &b) {
+        switch (unit) {
+            case 1: lo ? vpunpcklbw(dst, a, b) : vpunpckhbw(dst, a, b); break;
+            case 2: lo ? vpunpcklwd(dst, a, b) : vpunpckhwd(dst, a, b); break;
+            case 4: lo ? vpunpckldq(dst, a, b) : vpunpckhdq(dst, a, b); break;
+            case 8:
+                lo ? vpunpcklqdq(dst, a, b) : vpunpckhqdq(dst, a, b);
+                break;
+            default: assert(!"unexpected unit size");
+        }
+    }
+
+    void transpose_tile() {
+        mov(reg_ptr_, reg_src_);
+        for (int i = 0; i < tile_; i++) {
+            if (i > 0) add(reg_ptr_, reg_src_ld_);
+            uni_vmovdqu(Vmm(i), ptr[reg_ptr_]);
+        }
+
+        // The steps alternate between registers [0, tile) and
+        // [tile, 2 * tile).
+        int in = 0, out = tile_;
+        int d = 1;
+        for (int unit = dt_size_; unit < 16; unit *= 2, d *= 2) {
+            for_(int b = 0; b < tile_; b += 2 * d)
+            for (int j = 0; j < d; j++) {
+                const Vmm a(in + b + j), c(in + b + j + d);
+                unpack(unit, true, Vmm(out + b + 2 * j), a, c);
+                unpack(unit, false, Vmm(out + b + 2 * j + 1), a, c);
+            }
+            std::swap(in, out);
+        }
+
+        if (vlen_ == 32) {
+            for (int j = 0; j < tile_ / 2; j++) {
+                const Ymm a(in + j), c(in + j + tile_ / 2);
+                const Ymm lo(out + j), hi(out + j + tile_ / 2);
+                if (is_superset(isa_, avx512_core)) {
+                    vshufi32x4(lo, a, c, 0x0);
+                    vshufi32x4(hi, a, c, 0x3);
+                } else {
+                    vperm2i128(lo, a, c, 0x20);
+                    vperm2i128(hi, a, c, 0x31);
+                }
+            }
+            std::swap(in, out);
+        } else if (vlen_ == 64) {
+            // Even and odd lanes of rows 4 apart, then of rows 8 apart.
+            for_(int g = 0; g < tile_; g += 8)
+            for (int j = 0; j < 4; j++) {
+                const Zmm a(in + g + j), c(in + g + j + 4);
+                vshufi32x4(Zmm(out + g + j), a, c, 0x88);
+                vshufi32x4(Zmm(out + g + j + 4), a, c, 0xdd);
+            }
+            std::swap(in, out);
+            for (int j = 0; j < 8; j++) {
+                const Zmm a(in + j), c(in + j + 8);
+                vshufi32x4(Zmm(out + j), a, c, 0x88);
+                vshufi32x4(Zmm(out + j + 8), a, c, 0xdd);
+            }
+            std::swap(in, out);
+        }
+
+        mov(reg_ptr_, reg_dst_);
+        for (int i = 0; i < tile_; i++) {
+            if (i > 0) add(reg_ptr_, reg_dst_ld_);
+            uni_vmovdqu(ptr[reg_ptr_], Vmm(in + i));
+        }
+    }
+
+    void generate() override {
+        preamble();
+
+        const Reg64 param = abi_param1;
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_src_row_, ptr[param + PARAM_OFF(src)]);
+        mov(reg_dst_col_, ptr[param + PARAM_OFF(dst)]);
+        mov(reg_m_, ptr[param + PARAM_OFF(m_tiles)]);
+        mov(reg_src_ld_, static_cast<size_t>(src_ld_));
+        mov(reg_dst_ld_, static_cast<size_t>(dst_ld_));
+        mov(reg_src_ld_tile_, static_cast<size_t>(src_ld_ * tile_));
+        mov(reg_dst_ld_tile_, static_cast<size_t>(dst_ld_ * tile_));
+
+        // A row of tiles is read from the source and written to a column of
+        // tiles of the destination.
+        Label m_loop, n_loop;
+        L(m_loop);
+        {
+            mov(reg_src_, reg_src_row_);
+            mov(reg_dst_, reg_dst_col_);
+            mov(reg_n_, ptr[param + PARAM_OFF(n_tiles)]);
+            L(n_loop);
+            {
+                transpose_tile();
+                add(reg_src_, vlen_);
+                add(reg_dst_, reg_dst_ld_tile_);
+                dec(reg_n_);
+                jnz(n_loop, T_NEAR);
+            }
+            add(reg_src_row_, reg_src_ld_tile_);
+            add(reg_dst_col_, vlen_);
+            dec(reg_m_);
+            jnz(m_loop, T_NEAR);
+        }
+#undef PARAM_OFF
+
+        postamble();
+    }
+
+private:
+    struct ker_args_t {
+        const void *src;
+        void *dst;
+        dim_t m_tiles;
+        dim_t n_tiles;
+    };
+
+    cpu_isa_t isa_;
+    int dt_size_;
+    int tile_;
+    // The strides of the source rows and of the destination rows in bytes.
+    dim_t src_ld_;
+    dim_t dst_ld_;
+
+    const Reg64 reg_src_row_ = r8;
+    const Reg64 reg_dst_col_ = r9;
+    const Reg64 reg_src_ld_ = r10;
+    const Reg64 reg_dst_ld_ = r11;
+    const Reg64 reg_src_ = r12;
+    const Reg64 reg_dst_ = r13;
+    const Reg64 reg_ptr_ = r14;
+    const Reg64 reg_m_ = r15;
+    const Reg64 reg_n_ = rax;
+    const Reg64 reg_src_ld_tile_ = rbx;
+    const Reg64 reg_dst_ld_tile_ = rdx;
+};
+
+namespace {
+
+// Copies the elements of the `m` x `n` block that are not covered by the
+// `m_full` x `n_full` register tiles.
+template <typename data_t>
+void transpose_tails(const char *src, char *dst, dim_t m, dim_t n,
+        dim_t m_full, dim_t n_full, dim_t src_ld, dim_t dst_ld) {
+    const data_t *s = reinterpret_cast<const data_t *>(src);
+    data_t *d = reinterpret_cast<data_t *>(dst);
+    for (dim_t i = 0; i < m; i++) {
+        const dim_t j_start = i < m_full ? n_full : 0;
+        for (dim_t j = j_start; j < n; j++)
+            d[j * dst_ld + i] = s[i * src_ld + j];
+    }
+}
+
+} // namespace
+
+status_t jit_uni_reorder_transpose_t::pd_t::create(reorder_pd_t **reorder_pd,
+        engine_t *engine, const primitive_attr_t *attr, engine_t *src_engine,
+        const memory_desc_t *src_md, engine_t *dst_engine,
+        const memory_desc_t *dst_md) {
+    auto _pd = make_unique_pd<pd_t>(
+            attr, src_engine->kind(), src_md, dst_engine->kind(), dst_md);
+    if (_pd == nullptr) return status::out_of_memory;
+
+    CHECK(_pd->init(engine, src_engine, dst_engine));
+
+    return safe_ptr_assign(*reorder_pd, _pd.release());
+}
+
+status_t jit_uni_reorder_transpose_t::pd_t::init(
+        engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
+    VDISPATCH_REORDER(is_dense_format_kind({src_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_REORDER(!src_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(!dst_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(
+            src_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_REORDER(
+            dst_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_REORDER(src_d.is_plain() && src_d.nelems() == src_d.nelems(true),
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "src");
+    VDISPATCH_REORDER(dst_d.is_plain() && dst_d.nelems() == dst_d.nelems(true),
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "dst");
+    VDISPATCH_REORDER(!src_d.has_zero_dim(), VERBOSE_EMPTY_TENSOR, "src");
+
+    // Only the elements are moved, so the data types must match.
+    VDISPATCH_REORDER(src_d.data_type() == dst_d.data_type(),
+            VERBOSE_UNSUPPORTED_DT);
+    dt_size_ = static_cast<int>(src_d.data_type_size());
+    VDISPATCH_REORDER(utils::one_of(dt_size_, 1, 2, 4), VERBOSE_UNSUPPORTED_DT);
+
+    VDISPATCH_REORDER(src_d.extra().flags == 0 && dst_d.extra().flags == 0,
+            VERBOSE_UNSUPPORTED_MD_FLAG, "src or dst");
+    VDISPATCH_REORDER(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+    // 8- and 16-bit tiles need the upper 16 vector registers.
+    if (mayiuse(avx512_core))
+        isa_ = avx512_core;
+    else if (mayiuse(avx2) && dt_size_ == 4)
+        isa_ = avx2;
+    VDISPATCH_REORDER(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    return init_conf(engine);
+}
+
+status_t jit_uni_reorder_transpose_t::pd_t::init_conf(engine_t *engine) {
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const auto &src_strides = src_d.blocking_desc().strides;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+
+    struct dim_info_t {
+        dim_t size, src_stride, dst_stride;
+    };
+    std::vector<dim_info_t> dims;
+    for (int d = 0; d < src_d.ndims(); d++) {
+        if (src_d.dims()[d] == 1) continue;
+        dims.push_back({src_d.dims()[d], src_strides[d], dst_strides[d]});
+    }
+
+    // A dimension is merged into another one when it is next to it in both
+    // tensors, e.g. `h` and `w` of `nchw` to `nhwc`.
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for_(size_t i = 0; i < dims.size() && !merged; i++)
+        for (size_t j = 0; j < dims.size() && !merged; j++) {
+            if (i == j) continue;
+            const auto &outer = dims[i];
+            auto &inner = dims[j];
+            if (outer.src_stride == inner.size * inner.src_stride
+                    && outer.dst_stride == inner.size * inner.dst_stride) {
+                inner.size *= outer.size;
+                dims.erase(dims.begin() + i);
+                merged = true;
+            }
+        }
+    }
+
+    int src_inner = -1, dst_inner = -1;
+    for (int i = 0; i < static_cast<int>(dims.size()); i++) {
+        if (dims[i].src_stride == 1) src_inner = i;
+        if (dims[i].dst_stride == 1) dst_inner = i;
+    }
+    VDISPATCH_REORDER(src_inner >= 0 && dst_inner >= 0,
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "src or dst");
+    // The innermost dimension is the same in both tensors, so the rows are
+    // copied as a whole by the generic reorder.
+    VDISPATCH_REORDER(src_inner != dst_inner, VERBOSE_UNSUPPORTED_TENSOR_LAYOUT,
+            "src or dst");
+
+    M_ = dims[dst_inner].size;
+    src_ld_ = dims[dst_inner].src_stride;
+    N_ = dims[src_inner].size;
+    dst_ld_ = dims[src_inner].dst_stride;
+
+    std::vector<dim_info_t> batch;
+    for (int i = 0; i < static_cast<int>(dims.size()); i++)
+        if (!utils::one_of(i, src_inner, dst_inner)) batch.push_back(dims[i]);
+    std::sort(batch.begin(), batch.end(),
+            [](const dim_info_t &a, const dim_info_t &b) {
+                return a.src_stride > b.src_stride;
+            });
+    nbatch_dims_ = static_cast<int>(batch.size());
+    for (int k = 0; k < nbatch_dims_; k++) {
+        batch_dims_[k] = batch[k].size;
+        src_batch_strides_[k] = batch[k].src_stride;
+        dst_batch_strides_[k] = batch[k].dst_stride;
+    }
+
+    tile_ = vreg_traits_t<Zmm>::vlen / 4;
+    if (isa_ == avx2) tile_ = vreg_traits_t<Ymm>::vlen / 4;
+    VDISPATCH_REORDER(M_ >= tile_ && N_ >= tile_, VERBOSE_SMALL_SHAPES);
+
+    // A tensor that fits in L2 is reordered fast enough by the generic
+    // implementation.
+    const size_t size = src_d.nelems() * dt_size_;
+    VDISPATCH_REORDER(size >= platform::get_per_core_cache_size(2),
+            VERBOSE_SMALL_SHAPES);
+
+    // A block of the source and its transpose fit in L1 together.
+    const dim_t l1_size = platform::get_per_core_cache_size(1);
+    const dim_t blk_max = 256;
+    blk_ = tile_;
+    while (blk_ + tile_ <= blk_max
+            && 2 * (blk_ + tile_) * (blk_ + tile_) * dt_size_ <= l1_size)
+        blk_ += tile_;
+
+    return status::success;
+}
+
+jit_uni_reorder_transpose_t::kernel_base_t *
+jit_uni_reorder_transpose_t::kernel_base_t::create(const pd_t *pd) {
+    if (pd->isa_ == avx2) return new transpose_kernel_t<Ymm>(pd);
+    switch (pd->dt_size_) {
+        case 4: return new transpose_kernel_t<Zmm>(pd);
+        case 2: return new transpose_kernel_t<Ymm>(pd);
+        case 1: return new transpose_kernel_t<Xmm>(pd);
+        default: assert(!"unexpected");
+    }
+    return nullptr;
+}
+
+status_t jit_uni_reorder_transpose_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_, kernel_base_t::create(pd())));
+    return kernel_->create_kernel();
+}
+
+void jit_uni_reorder_transpose_t::transpose_block(
+        const char *src, char *dst, dim_t m, dim_t n) const {
+    const dim_t tile = pd()->tile_;
+    const dim_t m_tiles = m / tile;
+    const dim_t n_tiles = n / tile;
+    if (m_tiles > 0 && n_tiles > 0) (*kernel_)(src, dst, m_tiles, n_tiles);
+
+    const dim_t m_full = m_tiles * tile;
+    const dim_t n_full = n_tiles * tile;
+    if (m_full == m && n_full == n) return;
+
+    const dim_t src_ld = pd()->src_ld_;
+    const dim_t dst_ld = pd()->dst_ld_;
+    switch (pd()->dt_size_) {
+        case 4:
+            transpose_tails<uint32_t>(
+                    src, dst, m, n, m_full, n_full, src_ld, dst_ld);
+            break;
+        case 2:
+            transpose_tails<uint16_t>(
+                    src, dst, m, n, m_full, n_full, src_ld, dst_ld);
+            break;
+        case 1:
+            transpose_tails<uint8_t>(
+                    src, dst, m, n, m_full, n_full, src_ld, dst_ld);
+            break;
+        default: assert(!"unexpected");
+    }
+}
+
+status_t jit_uni_reorder_transpose_t::execute(const exec_ctx_t &ctx) const {
+    auto in = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
+    auto out = CTX_OUT_MEM(char *, DNNL_ARG_TO);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const dim_t dt_size = pd()->dt_size_;
+    in += src_d.offset0() * dt_size;
+    out += dst_d.offset0() * dt_size;
+
+    const dim_t M = pd()->M_;
+    const dim_t N = pd()->N_;
+    const dim_t src_ld = pd()->src_ld_;
+    const dim_t dst_ld = pd()->dst_ld_;
+    const dim_t blk = pd()->blk_;
+    const dim_t nb_m = utils::div_up(M, blk);
+    const dim_t nb_n = utils::div_up(N, blk);
+    const int nbatch_dims = pd()->nbatch_dims_;
+    dim_t nbatch = 1;
+    for (int k = 0; k < nbatch_dims; k++)
+        nbatch *= pd()->batch_dims_[k];
+
+    parallel_nd(nbatch, nb_m, nb_n, [&](dim_t b, dim_t bm, dim_t bn) {
+        dim_t src_off = 0, dst_off = 0;
+        for (int k = nbatch_dims - 1; k >= 0; k--) {
+            const dim_t idx = b % pd()->batch_dims_[k];
+            b /= pd()->batch_dims_[k];
+            src_off += idx * pd()->src_batch_strides_[k];
+            dst_off += idx * pd()->dst_batch_strides_[k];
+        }
+        const dim_t m0 = bm * blk;
+        const dim_t n0 = bn * blk;
+        src_off += m0 * src_ld + n0;
+        dst_off += n0 * dst_ld + m0;
+        transpose_block(in + src_off * dt_size, out + dst_off * dt_size,
+                nstl::min(blk, M - m0), nstl::min(blk, N - n0));
+    });
+
+    return status::success;
+}
+
+template struct transpose_kernel_t<Zmm>;
+template struct transpose_kernel_t<Ymm>;
+template struct transpose_kernel_t<Xmm>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_REORDER_TRANSPOSE_HPP
+#define CPU_X64_JIT_UNI_REORDER_TRANSPOSE_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/reorder/cpu_reorder_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Reorder of large plain tensors that only permute dimensions and move the
+// innermost dimension of the source away from the innermost position, e.g.
+// `ab` to `ba` or `nchw` to `nhwc`. After the dimensions that stay contiguous
+// in both tensors are merged, the problem is a batch of 2D transposes
+// dst[n][m] = src[m][n]. The matrices are split into blocks that fit in L1
+// and are distributed over threads, and a block is transposed by tiles of
+// 16x16 (8x8 for f32 on avx2) elements that are shuffled in registers. Both
+// the reads of the source and the writes of the destination use whole cache
+// lines.
+struct jit_uni_reorder_transpose_t : public primitive_t {
+    using primitive_t::primitive_t;
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+
+        DECLARE_COMMON_PD_T("jit_transpose:uni", jit_uni_reorder_transpose_t);
+
+        status_t init(
+                engine_t *engine, engine_t *src_engine, engine_t *dst_engine);
+
+        cpu_isa_t isa_ = isa_undef;
+        // The size of an element in bytes.
+        int dt_size_ = 0;
+        // The number of rows and columns of a register tile and of a block.
+        dim_t tile_ = 0;
+        dim_t blk_ = 0;
+        // The rows and columns of a source matrix and their strides in
+        // elements in the source and the destination.
+        dim_t M_ = 0, N_ = 0;
+        dim_t src_ld_ = 0, dst_ld_ = 0;
+        // The remaining dimensions, from the outermost in the source.
+        int nbatch_dims_ = 0;
+        dims_t batch_dims_ = {};
+        dims_t src_batch_strides_ = {};
+        dims_t dst_batch_strides_ = {};
+
+    private:
+        status_t init_conf(engine_t *engine);
+
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md);
+
+        friend dnnl::impl::impl_list_item_t;
+    };
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+    struct kernel_base_t {
+        // Transposes `m_tiles` x `n_tiles` register tiles.
+        virtual void operator()(const void *src, void *dst, dim_t m_tiles,
+                dim_t n_tiles) const = 0;
+        static kernel_base_t *create(const pd_t *pd);
+        virtual status_t create_kernel() = 0;
+        virtual ~kernel_base_t() = default;
+
+    protected:
+        kernel_base_t(const pd_t *pd) : pd_(pd) {}
+
+        const pd_t *pd_;
+    };
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Transposes the `m` x `n` block at `src` to `dst`.
+    void transpose_block(
+            const char *src, char *dst, dim_t m, dim_t n) const;
+
+    std::unique_ptr<kernel_base_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
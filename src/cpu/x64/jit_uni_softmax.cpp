@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <limits>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
@@ -25,9 +26,11 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/x64/jit_generator.hpp"
 
+#include "cpu/x64/injectors/jit_avx512_core_dropout_injector.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_uni_softmax.hpp"
 #include "cpu/x64/utils/jit_io_helper.hpp"
@@ -69,6 +72,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     std::unique_ptr<jit_uni_eltwise_injector_t<isa>> log_injector_;
     std::unique_ptr<injector::jit_uni_postops_injector_t<isa>>
             postops_injector_;
+    std::unique_ptr<jit_avx512_core_dropout_injector_t> dropout_injector_;
 
     Reg64 reg_param = abi_param1;
 
@@ -117,7 +121,13 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     bool with_eltwise_ = false;
     bool with_src_scales_ = false;
     bool with_dst_scales_ = false;
+    bool with_dropout_ = false;
     bool use_ext_aux_vmms_ = false;
+    // Online softmax: the first pass keeps a running maximum and rescales
+    // the running sum of exponents accordingly, the second one computes dst
+    // straight from src. Used for axes that do not fit L2, to read them two
+    // times instead of three.
+    bool use_online_ = false;
 
     size_t unroll_regs_ = 4;
 
@@ -144,6 +154,11 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     const int fp8_emu_zmm_5_idx_ = 27;
     const int fp8_emu_kmask_idx_ = 3;
 
+    // Dropout uses the vmms after the unrolled ones and their scale vmms,
+    // which are free once the destination values are loaded.
+    const int dropout_zmm_start_idx_ = 9;
+    const int dropout_kmask_idx_ = 4;
+
     Opmask tail_opmask = Opmask(tail_opmask_idx_);
 
     void operator()(const call_params_t *p) const override {
@@ -513,6 +528,116 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         get_horizontal_op(vmax, vtmp = vsum, op_t::max);
     }
 
+    // Turns the sum of exponents into a multiplier for softmax and into
+    // a subtrahend for logsoftmax. `vtmp_div` may be clobbered.
+    void finalize_vsum(const Vmm &vtmp_div) {
+        if (pd_->alg_kind() == alg_kind::softmax_accurate_inf_as_zero) {
+            Xbyak::Label skip_div;
+            // `vptest` sets the `ZF` flag if all bits in the result are 0 of
+            // the bitwise AND of source operands.
+            // Note: using Vmm(1) is an ugly workaround EVEX versus VEX encoding
+            // as `vsum` uses index `30` on avx512_core. `Vmm(1)` is a tmp vreg
+            // used to read data just above. Should be safe.
+            uni_vmovups(Vmm(1), vsum);
+            uni_vptest(Xmm(1), Xmm(1));
+            jz(skip_div, T_NEAR); // Check if ZF is set.
+            uni_vdivps(vsum, vone, vsum, vtmp_div);
+            L(skip_div);
+        } else if (is_softmax_) {
+            uni_vdivps(vsum, vone, vsum, vtmp_div);
+        } else if (is_logsoftmax_) {
+            log_injector_->compute_vector(vsum.getIdx());
+        }
+    }
+
+    // Computes exp in place. When the injector doesn't preserve its auxiliary
+    // vmms, they are taken starting from `aux_idx` with `aux_stride`.
+    void compute_exp(const Vmm &vmm, int aux_idx, int aux_stride) {
+        if (use_ext_aux_vmms_) {
+            injector_utils::vmm_index_set_t exp_aux_indices;
+            const auto exp_vmm_aux_count
+                    = jit_uni_eltwise_injector_t<isa>::aux_vecs_count(
+                            alg_kind::eltwise_exp, pd_->is_fwd(), 0.f);
+            for (size_t j = 0; j < exp_vmm_aux_count; j++)
+                exp_aux_indices.insert(
+                        static_cast<size_t>(aux_idx + j * aux_stride));
+            exp_injector_->compute_vector(vmm.getIdx(), exp_aux_indices);
+        } else {
+            exp_injector_->compute_vector(vmm.getIdx());
+        }
+    }
+
+    // The first pass of the online softmax. Every unrolled vmm accumulates its
+    // own sum of exponents, all of them are relative to the running maximum in
+    // `vmax`. Once the maximum grows, the sums are rescaled by
+    // `exp(old_max - new_max)`.
+    void accumulate_online_vmax_vsum() {
+        // flush to -FLT_MAX before accumulation
+        uni_vmovups(vmax, vneg_flt_max);
+
+        const auto pre_body = [&](int max_unroll) {
+            // flush to zero before accumulation
+            for (int i = 0; i < max_unroll; i++) {
+                Vmm vreg_tmp_sum = get_aux_vmm(Vmm(i + 1), max_unroll);
+                uni_vpxor(vreg_tmp_sum, vreg_tmp_sum, vreg_tmp_sum);
+            }
+        };
+
+        const auto body = [&](int unroll, int max_unroll, bool tail = false) {
+            const Vmm vreg_new_max = Vmm(2 * max_unroll + 1);
+            uni_vmovups(vreg_new_max, vmax);
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_src = Vmm(i + 1);
+                io_[src_d_.data_type()]->load(
+                        src_ptr(src_next_vreg_stride_ * i), vreg_tmp_src, tail);
+                uni_vmaxps_maybe_tail(
+                        vreg_new_max, vreg_tmp_src, vtmp = vsum, tail);
+            }
+
+            uni_vsubps(vmax, vmax, vreg_new_max);
+            compute_exp(vmax, 2 * max_unroll + 2, 1);
+            for (int i = 0; i < max_unroll; i++) {
+                Vmm vreg_tmp_sum = get_aux_vmm(Vmm(i + 1), max_unroll);
+                uni_vmulps(vreg_tmp_sum, vreg_tmp_sum, vmax);
+            }
+            uni_vmovups(vmax, vreg_new_max);
+
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_src = Vmm(i + 1);
+                Vmm vreg_tmp_sum = get_aux_vmm(vreg_tmp_src, max_unroll);
+                uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
+                compute_exp(vreg_tmp_src, vreg_tmp_sum.getIdx() + max_unroll,
+                        max_unroll);
+                uni_vaddps_maybe_tail(
+                        vreg_tmp_sum, vreg_tmp_src, vtmp = vreg_new_max, tail);
+            }
+        };
+
+        const auto post_body = [&](int max_unroll) {
+            uni_vmovups(vsum, get_aux_vmm(Vmm(1), max_unroll));
+            for (int i = 1; i < max_unroll; i++)
+                uni_vaddps(vsum, vsum, get_aux_vmm(Vmm(i + 1), max_unroll));
+        };
+
+        axis_loop(pre_body, body, post_body);
+
+        // Lanes hold sums relative to their own maximums, rescale them to the
+        // maximum over the axis before the reduction.
+        const Vmm vreg_lane_max = Vmm(1);
+        uni_vmovups(vreg_lane_max, vmax);
+        get_horizontal_op(vmax, vtmp = Vmm(2), op_t::max);
+        uni_vsubps(vreg_lane_max, vreg_lane_max, vmax);
+        compute_exp(vreg_lane_max, 3, 1);
+        uni_vmulps(vsum, vsum, vreg_lane_max);
+        get_horizontal_op(vsum, vtmp = Vmm(2), op_t::sum);
+
+        // `vmax` is used by the second pass, so it is not a temporary here.
+        finalize_vsum(Vmm(2));
+
+        // Initialize saturation vector register, it overlaps `vneg_flt_max`.
+        io_.init_saturate_f32({dst_d_.data_type()});
+    }
+
     // TODO: introduce independent vmax split code for SRF.
     // Use ne_convert instruction to load xf16 even/odd elements from memory
     void accumulate_avx2_ne_xf16_vsum() {
@@ -573,23 +698,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
 
         get_horizontal_op(vsum, vtmp = vmax, op_t::sum);
 
-        if (pd_->alg_kind() == alg_kind::softmax_accurate_inf_as_zero) {
-            Xbyak::Label skip_div;
-            // `vptest` sets the `ZF` flag if all bits in the result are 0 of
-            // the bitwise AND of source operands.
-            // Note: using Vmm(1) is an ugly workaround EVEX versus VEX encoding
-            // as `vsum` uses index `30` on avx512_core. `Vmm(1)` is a tmp vreg
-            // used to read data just above. Should be safe.
-            uni_vmovups(Vmm(1), vsum);
-            uni_vptest(Xmm(1), Xmm(1));
-            jz(skip_div, T_NEAR); // Check if ZF is set.
-            uni_vdivps(vsum, vone, vsum, vtmp = vmax);
-            L(skip_div);
-        } else if (is_softmax_) {
-            uni_vdivps(vsum, vone, vsum, vtmp = vmax);
-        } else if (is_logsoftmax_) {
-            log_injector_->compute_vector(vsum.getIdx());
-        }
+        finalize_vsum(vmax);
     }
 
     void accumulate_vsum() {
@@ -699,23 +808,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
 
         get_horizontal_op(vsum, vtmp = vmax, op_t::sum);
 
-        if (pd_->alg_kind() == alg_kind::softmax_accurate_inf_as_zero) {
-            Xbyak::Label skip_div;
-            // `vptest` sets the `ZF` flag if all bits in the result are 0 of
-            // the bitwise AND of source operands.
-            // Note: using Vmm(1) is an ugly workaround EVEX versus VEX encoding
-            // as `vsum` uses index `30` on avx512_core. `Vmm(1)` is a tmp vreg
-            // used to read data just above. Should be safe.
-            uni_vmovups(Vmm(1), vsum);
-            uni_vptest(Xmm(1), Xmm(1));
-            jz(skip_div, T_NEAR); // Check if ZF is set.
-            uni_vdivps(vsum, vone, vsum, vtmp = vmax);
-            L(skip_div);
-        } else if (is_softmax_) {
-            uni_vdivps(vsum, vone, vsum, vtmp = vmax);
-        } else if (is_logsoftmax_) {
-            log_injector_->compute_vector(vsum.getIdx());
-        }
+        finalize_vsum(vmax);
     }
 
     // Use ne_convert instruction to load xf16 even/odd elements from memory
@@ -800,6 +893,28 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         axis_loop(pre_body, body, post_body);
     }
 
+    // Applies dropout to the vmm `i` of the unrolled ones and writes its mask.
+    // The axis is dense and innermost, so the dst element offset of a lane
+    // follows the one of the first lane of the call.
+    void apply_dropout(const Vmm &vmm, int i, bool tail) {
+        const int dt_size_shift = math::ilog2q(dst_d_.data_type_size());
+
+        mov(reg_tmp, reg_dst_spat_offt);
+        if (dt_size_shift) shr(reg_tmp, dt_size_shift);
+        add(reg_tmp, ptr[reg_param + PARAM_OFF(dropout_offset)]);
+        if (i) add(reg_tmp, i * simd_w_);
+        dropout_injector_->compute_vector(Zmm(vmm.getIdx()), reg_tmp,
+                ptr[reg_param + PARAM_OFF(dropout_seed)],
+                ptr[reg_param + PARAM_OFF(dropout_threshold)],
+                ptr[reg_param + PARAM_OFF(dropout_inv_q)]);
+
+        mov(reg_tmp, reg_dst_spat_offt);
+        if (dt_size_shift) shr(reg_tmp, dt_size_shift);
+        add(reg_tmp, ptr[reg_param + PARAM_OFF(dropout_mask)]);
+        dropout_injector_->store_mask(
+                ptr[reg_tmp + i * simd_w_], tail, tail_opmask);
+    }
+
     void compute_dst() {
         if (is_avx2_ne_xf16_ && is_data_type_xf16(dst_d_.data_type())) {
             compute_avx2_ne_xf16_dst();
@@ -811,7 +926,16 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         const auto body = [&](int unroll, int max_unroll, bool tail = false) {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
-                if (need_scratchpad_)
+                if (use_online_) {
+                    io_[src_d_.data_type()]->load(
+                            src_ptr(src_next_vreg_stride_ * i), vreg_tmp_src,
+                            tail);
+                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
+                    if (is_softmax_)
+                        compute_exp(vreg_tmp_src,
+                                get_aux_vmm(vreg_tmp_src, max_unroll).getIdx(),
+                                max_unroll);
+                } else if (need_scratchpad_)
                     io_[f32]->load(interim_ptr(interim_next_vreg_stride_ * i),
                             vreg_tmp_src, tail);
                 else
@@ -831,6 +955,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
                     uni_vbroadcastss(vreg_tmp_scale, ptr[reg_src_scales]);
                     uni_vmulps(vreg_tmp_src, vreg_tmp_src, vreg_tmp_scale);
                 }
+                if (with_dropout_) apply_dropout(vreg_tmp_src, i, tail);
                 if (with_postops_) {
                     binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
                     if (with_binary_) {
@@ -925,8 +1050,12 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     }
 
     void forward() {
-        accumulate_vmax();
-        accumulate_vsum();
+        if (use_online_) {
+            accumulate_online_vmax_vsum();
+        } else {
+            accumulate_vmax();
+            accumulate_vsum();
+        }
         compute_dst();
     }
 
@@ -968,6 +1097,15 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
                     injector::jit_uni_postops_injector_t<isa>>(
                     this, pd_->attr()->post_ops_, bsp);
         }
+        if (with_dropout_) {
+            std::vector<int> aux_idxs(
+                    jit_avx512_core_dropout_injector_t::n_aux_vmms);
+            for (size_t j = 0; j < aux_idxs.size(); j++)
+                aux_idxs[j] = dropout_zmm_start_idx_ + static_cast<int>(j);
+            dropout_injector_
+                    = utils::make_unique<jit_avx512_core_dropout_injector_t>(
+                            this, aux_idxs, Opmask(dropout_kmask_idx_));
+        }
 #undef PARAM_OFF
 
         compute_predefined_variables();
@@ -986,6 +1124,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         if (log_injector_) log_injector_->prepare_table();
         if (with_eltwise_ && postops_injector_)
             postops_injector_->prepare_table(/* generate = */ true);
+        if (dropout_injector_) dropout_injector_->prepare_table();
         io_.prepare_table_fp8();
     }
 
@@ -1021,6 +1160,8 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
                 && !attr_scales.has_default_values(DNNL_ARG_SRC);
         with_dst_scales_ = is_superset(isa, avx2)
                 && !attr_scales.has_default_values(DNNL_ARG_DST);
+        with_dropout_ = is_superset(isa, avx512_core)
+                && !pd_->attr()->dropout_.has_default_values();
 
         io::io_conf_t io_conf;
         io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
@@ -1038,6 +1179,13 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
                 io_conf, io_tail_conf, io_bf16_conf,
                 {{dst_d_.data_type(), io_saturation_conf}}, utils::nullopt,
                 io_fp8_conf);
+
+        // Note: must be aligned with pd_t::init().
+        use_online_ = pd_->is_fwd() && !is_avx2_ne_xf16_
+                && static_cast<size_t>(pd_->axis_size())
+                                * src_d_.data_type_size()
+                        > platform::get_per_core_cache_size(2);
+        if (use_online_) need_scratchpad_ = false;
     }
 };
 
@@ -1703,6 +1851,24 @@ status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
             = binary_injector::prepare_binary_args(
                     pd()->attr()->post_ops_, ctx);
 
+    // The threshold and the scale of dropout are computed once, the same way
+    // `ref_dropout()` does it.
+    auto dropout_mask
+            = CTX_OUT_MEM(unsigned char *, DNNL_ARG_ATTR_DROPOUT_MASK);
+    uint32_t dropout_seed = 0;
+    uint32_t dropout_threshold = 0;
+    float dropout_inv_q = 0.f;
+    if (pd()->with_dropout()) {
+        const float p = *CTX_IN_MEM(
+                const float *, DNNL_ARG_ATTR_DROPOUT_PROBABILITY);
+        dropout_seed
+                = *CTX_IN_MEM(const uint32_t *, DNNL_ARG_ATTR_DROPOUT_SEED);
+        dropout_inv_q = (p != 1.f) ? 1.f / (1.f - p) : 0.f;
+        const float p_clamped = nstl::max(nstl::min(p, 1.f), 0.f);
+        dropout_threshold = static_cast<uint32_t>(
+                double(std::numeric_limits<uint32_t>::max()) * p_clamped);
+    }
+
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
     const auto src_data_type_size = src_d.data_type_size();
@@ -1793,6 +1959,12 @@ status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
                 p.interim = interim_ptr;
                 p.src_scales = src_scales;
                 p.dst_scales = dst_scales_inv_ptr;
+                // dropout
+                p.dropout_mask = dropout_mask ? dropout_mask + offset : nullptr;
+                p.dropout_offset = offset;
+                p.dropout_seed = dropout_seed;
+                p.dropout_threshold = dropout_threshold;
+                p.dropout_inv_q = utils::bit_cast<uint32_t>(dropout_inv_q);
                 // post-ops
                 p.dst_orig = dst_orig_ptr;
                 p.post_ops_binary_rhs_arg_vec
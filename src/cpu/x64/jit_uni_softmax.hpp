@@ -26,6 +26,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_softmax_pd.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
@@ -56,6 +57,13 @@ struct jit_softmax_kernel_base_t {
         // post ops
         const void *dst_orig;
         const void *post_ops_binary_rhs_arg_vec;
+
+        // dropout, the scalars are read as 32-bit values
+        void *dropout_mask; // the mask of the first element of a call
+        size_t dropout_offset; // dst offset of the first element of a call
+        size_t dropout_seed;
+        size_t dropout_threshold; // UINT32_MAX * p rounded down
+        size_t dropout_inv_q; // bits of 1 / (1 - p)
     };
 
     virtual void operator()(const call_params_t *p) const = 0;
@@ -138,9 +146,17 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
             VDISPATCH_SOFTMAX(f8_isa_ok, VERBOSE_ISA_DT_MISMATCH);
 
             VDISPATCH_SOFTMAX(attr()->has_default_values(skip_mask_t::scales
-                                      | skip_mask_t::post_ops),
+                                      | skip_mask_t::post_ops
+                                      | skip_mask_t::dropout),
                     VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_SOFTMAX(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VDISPATCH_SOFTMAX(attr_dropout_ok(), VERBOSE_UNSUPPORTED_ATTR);
+            // Dropout keeps the state of the generator in zmms and computes
+            // the counters of a vector from the offset of its first element.
+            VDISPATCH_SOFTMAX(IMPLICATION(with_dropout(),
+                                      is_superset(isa_, avx512_core)
+                                              && axis_stride() == 1),
+                    VERBOSE_UNSUPPORTED_ATTR);
 
             VDISPATCH_SOFTMAX(set_default_formats() == status::success,
                     VERBOSE_UNSUPPORTED_TAG);
@@ -164,6 +180,15 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
 
             const memory_desc_wrapper dst_d(dst_md());
             axis_is_plain_and_strided_ = dst_d.is_plain() && axis_stride() > 1;
+            // Note: must be aligned with the dense kernel.
+            const bool is_avx2_ne_xf16 = mayiuse(avx2_vnni_2)
+                    && !mayiuse(avx512_core)
+                    && (utils::one_of(bf16, src_dt, dst_dt)
+                            || utils::one_of(f16, src_dt, dst_dt));
+            use_online_ = !axis_is_plain_and_strided_ && !is_avx2_ne_xf16
+                    && static_cast<size_t>(axis_size())
+                                    * types::data_type_size(src_dt)
+                            > platform::get_per_core_cache_size(2);
             nthr_ = dnnl_get_max_threads();
             init_scratchpad();
 
@@ -174,6 +199,9 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
         size_t scratch_size_per_thr_ = 0;
         cpu_isa_t isa_ = isa_undef;
         bool axis_is_plain_and_strided_ = false;
+        // The online softmax computes dst straight from src, with no
+        // intermediate f32 results.
+        bool use_online_ = false;
 
     private:
         void init_scratchpad() {
@@ -187,7 +215,7 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                             accumulation_mode::relaxed, accumulation_mode::any);
             auto scratchpad = scratchpad_registry().registrar();
             const bool need_f32_intermediate
-                    = dst_dt != data_type::f32 && !relaxed_acc;
+                    = dst_dt != data_type::f32 && !relaxed_acc && !use_online_;
             if (need_f32_intermediate) {
                 // When stride != 1, then each thread operates over simd at a
                 // time, thus, increased scratchpad size.
@@ -305,6 +333,8 @@ struct jit_uni_softmax_bwd_t : public primitive_t {
             VDISPATCH_SOFTMAX(!is_fwd(), VERBOSE_BAD_PROPKIND);
 
             VDISPATCH_SOFTMAX(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+            VDISPATCH_SOFTMAX(!hint_with_ws(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "workspace");
 
             const auto dst_dt = dst_md()->data_type;
             const auto diff_dst_dt = diff_dst_md()->data_type;
@@ -986,6 +986,17 @@ void matmul_amx_blocking_params_micro_t::find_best_blocking(
     }
 }
 
+blocking_table_entry_t
+matmul_amx_blocking_params_micro_t::get_blocking_parameters() const {
+    blocking_table_entry_t entry;
+    entry.nthr_k = static_cast<int>(nthr_k_);
+    entry.n_blk = static_cast<int>(n_blk_);
+    entry.n_chunk_size = static_cast<int>(n_chunk_size_);
+    entry.m_blk = static_cast<int>(m_blk_);
+    entry.m_chunk_size = static_cast<int>(m_chunk_size_);
+    return entry;
+}
+
 void matmul_amx_blocking_params_micro_t::update_k_blocking_dependent_params() {
     k_chunk_elems_ = k_blk_ * k_chunk_size_ * brgemm_batch_size_;
     current_lda_ = get_actual_lda();
@@ -18,6 +18,7 @@
 #define CPU_X64_MATMUL_AMX_BLOCKING_HEURISTICS_HPP
 
 #include "common/math_utils.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_blocking_table.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
 
 namespace dnnl {
@@ -157,6 +158,11 @@ public:
 
     void set_blocking_parameters(int nthr_k, int n_blk, int n_chunk_size,
             int m_blk, int m_chunk_size);
+    void set_blocking_parameters(const blocking_table_entry_t &entry) {
+        set_blocking_parameters(entry.nthr_k, entry.n_blk, entry.n_chunk_size,
+                entry.m_blk, entry.m_chunk_size);
+    }
+    blocking_table_entry_t get_blocking_parameters() const;
 
     static void find_best_blocking(const brgemm_matmul_conf_t &bgmmc,
             const brgemm_matmul_conf_utils_t &bm_conf_utils,
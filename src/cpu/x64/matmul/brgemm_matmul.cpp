@@ -24,6 +24,7 @@
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/matmul/matmul_utils.hpp"
 #include "cpu/scale_utils.hpp"
+#include "cpu/simple_q10n.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
@@ -45,6 +46,29 @@ using namespace nstl;
 using namespace data_type;
 namespace {
 
+// Quantizes the dense rows of a source to s8. The scale of a row maps its
+// largest absolute value to the largest value of s8.
+template <typename data_t>
+void quantize_src_rows(const data_t *src, int8_t *src_quant, float *scales,
+        dim_t rows, dim_t K) {
+    parallel_nd(rows, [&](dim_t r) {
+        const data_t *const __restrict row = src + r * K;
+        int8_t *const __restrict row_quant = src_quant + r * K;
+
+        float amax = 0.f;
+        PRAGMA_OMP_SIMD(reduction(max : amax))
+        for (dim_t k = 0; k < K; ++k)
+            amax = nstl::max(amax, fabsf(static_cast<float>(row[k])));
+        const float scale = amax > 0.f ? amax / 127.f : 1.f;
+        scales[r] = scale;
+
+        PRAGMA_OMP_SIMD()
+        for (dim_t k = 0; k < K; ++k)
+            row_quant[k] = q10n::saturate_and_round<int8_t>(
+                    static_cast<float>(row[k]) / scale);
+    });
+}
+
 int get_brg_batchsize(
         const brgemm_matmul_conf_t &bgmmc, bool is_bs_tail, bool is_K_tail) {
     auto bs = is_K_tail  ? 1
@@ -104,7 +128,10 @@ int brgemm_matmul_t<isa>::pd_t::get_brg_kernel_idx(bool is_bs_tail,
 
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
-    const auto src_dt = src_md_.data_type;
+    // With dynamic quantization, the source is quantized to s8 with a scale
+    // per row before the multiplication, which is then done as an int8 one.
+    const bool with_dynamic_quant = attr()->dynamic_quantization_;
+    const auto src_dt = with_dynamic_quant ? s8 : src_md_.data_type;
     const auto wei_dt = weights_md_.data_type;
     const auto dst_dt = dst_md_.data_type;
 
@@ -144,6 +171,22 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     auto check_reduce = [&]() -> bool {
         if (!with_reduce()) return true;
 
+        if (reduce_kind() == matmul_reduce_kind::weights) {
+            // The sums of B over K, e.g. the bias gradient when B is the
+            // destination gradient of a layer, are made from the blocks of B
+            // passed to the brgemm kernels.
+            const memory_desc_wrapper wei_mdw(weights_md_);
+            bool ok = wei_mdw.ndims() == 2 && reduce_md_.dims[0] == 1;
+            ok = ok && wei_dt == src_dt && one_of(wei_dt, f32, bf16);
+            ok = ok
+                    && IMPLICATION(wei_dt == bf16,
+                            is_superset(isa, avx512_core_bf16));
+            ok = ok && one_of(reduce_md_.data_type, f32, wei_dt);
+            ok = ok && !wei_mdw.has_runtime_dims();
+            ok = ok && attr()->has_default_values();
+            return ok;
+        }
+
         bool ok = reduce_kind() == matmul_reduce_kind::src;
         ok = ok && src_md()->ndims == 2;
         ok = ok && one_of(src_dt, f32, bf16, f16);
@@ -169,6 +212,12 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             // This case requires scratchpad
             if (N() == DNNL_RUNTIME_DIM_VAL) ok = false;
         }
+        // The brgemm kernels apply either a common source scale or a scale
+        // per row.
+        if (!asc.has_default_values(DNNL_ARG_SRC))
+            ok = ok
+                    && utils::one_of(asc.get_mask(DNNL_ARG_SRC), 0,
+                            full_tensor_mask() - src_qmask_K());
         // Impl suppports f32 scales only for non-weight decompression
         if (!(is_bf16_with_int_wei || is_f16_with_int_wei)) {
             ok = ok && one_of(asc.get_data_type(DNNL_ARG_SRC), undef, f32);
@@ -240,9 +289,21 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
                                     zero_points_data_type
                             | primitive_attr_t::skip_mask_t::post_ops
                             | primitive_attr_t::skip_mask_t::sum_dt
-                            | primitive_attr_t::skip_mask_t::fpmath_mode,
+                            | primitive_attr_t::skip_mask_t::fpmath_mode
+                            | primitive_attr_t::skip_mask_t::
+                                    dynamic_quantization
+                            | primitive_attr_t::skip_mask_t::
+                                    accumulation_mode,
                     dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
+    // The explicit accumulation data types must match the computation.
+    const auto acc_mode = attr()->acc_mode_;
+    VDISPATCH_MATMUL(IMPLICATION(acc_mode == accumulation_mode::f16, is_f16),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(IMPLICATION(acc_mode == accumulation_mode::s32, is_int8),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(IMPLICATION(acc_mode == accumulation_mode::f32, !is_int8),
+            VERBOSE_UNSUPPORTED_ATTR);
     const auto &po = attr()->post_ops_;
 
     VDISPATCH_MATMUL(po.check_sum_consistency(dst_dt, is_int8),
@@ -259,8 +320,37 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_MATMUL(check_reduce(), VERBOSE_UNSUPPORTED_FEATURE,
             "reduce is not supported");
 
-    CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
-            dst_md_, bias_md_, attr_));
+    // The quantized source is a copy of the dense plain source, so that the
+    // offsets of both in elements are the same.
+    memory_desc_t src_quant_md = src_md_;
+    if (with_dynamic_quant) {
+        VDISPATCH_MATMUL(!src_d.has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        memory_desc_t src_plain_md = src_md_;
+        CHECK(memory_desc_init_by_strides(src_plain_md, nullptr));
+        if (src_md_.format_kind == format_kind::any) src_md_ = src_plain_md;
+        VDISPATCH_MATMUL(src_md_ == src_plain_md, VERBOSE_UNSUPPORTED_TAG);
+        src_quant_md = src_md_;
+        src_quant_md.data_type = s8;
+    }
+
+    CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(),
+            with_dynamic_quant ? src_quant_md : src_md_, weights_md_, dst_md_,
+            bias_md_, attr_));
+
+    // Transposed weights are reduced from their copy only.
+    VDISPATCH_MATMUL(IMPLICATION(reduce_kind() == matmul_reduce_kind::weights,
+                             bgmmc_.use_buffer_b || !bgmmc_.transposed_B),
+            VERBOSE_UNSUPPORTED_FEATURE, "reduce is not supported");
+
+    // With constant weights, the copy of B, including the decompression and
+    // the scales applied in the copy, is done once. The compensations for
+    // the source are computed with the copy per thread, which is still done
+    // on every execution for them.
+    bgmmc_.use_cached_b = attr()->constant_weights_ && bgmmc_.use_buffer_b
+            && !bgmmc_.packed_sparse_weights
+            && !memory_desc_wrapper(weights_md_).has_runtime_dims_or_strides()
+            && !bgmmc_.s8s8_compensation_required && !bgmmc_.has_zero_point_a;
 
     // f32:f16 configuration on AVX2 doesn't support tails with proper
     // instruction sequence in copy routines. Anchor: F32_F16_AVX2_NO_TAIL.
@@ -335,6 +425,7 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         brgattr.generate_skip_accumulation
                 = bgmmc_.post_ops_applicable && bgmmc_.nthr_k > 1;
         brgattr.mem_advice = bgmmc_.mem_advice;
+        brgattr.acc_mode = attr()->acc_mode_;
         if (is_superset(kernel_isa, avx512_core_amx)) {
             brgattr.use_uker = true;
             brgattr.use_interleave_stores = true;
@@ -377,6 +468,9 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             : N();
     book_precomputed_scales(scratchpad, attr()->scales_, wei_scale_count,
             /* scale_adjust_factor = */ 1.f, bgmmc_.req_transpose_scales);
+    if (bgmmc_.with_src_dynamic_quant)
+        scratchpad.book(key_matmul_src_quant,
+                memory_desc_wrapper(src_md_).nelems(), sizeof(int8_t), 64);
 
     return status::success;
 }
@@ -403,28 +497,35 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
                 i_bs, i_init, i_M, i_N, i_K, prefetching);
         if (idx < 0) continue;
 
-        brgemm_kernel_t *ker = nullptr;
-        CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
-        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        // The kernels for the tails and the batch tail are generated on
+        // first use.
+        const bool is_tail = i_bs || i_M || i_N || i_K;
+        if (is_tail)
+            CHECK(brg_kernels_.insert_lazy(idx, &pd()->get_brg_desc(idx)));
+        else
+            CHECK(brg_kernels_.insert(idx, &pd()->get_brg_desc(idx)));
         if (is_superset(pd()->get_brg_desc(idx).isa_impl, avx512_core_amx))
             brgemm_palettes_.insert(idx, pd()->get_brg_desc(idx));
 
         if (pd()->with_reduce()) {
-            if (pd()->reduce_kind() == matmul_reduce_kind::src) {
-                if (i_N == 0 && i_init == i_init_start) {
-                    reducers_[i_M][i_K] = nullptr;
-                    auto db_desc = pd()->get_brg_desc(idx);
-                    db_desc.reduce_dim = i_K ? bgmmc.K_tail : bgmmc.K_blk;
-                    db_desc.load_dim = i_M ? bgmmc.M_tail : bgmmc.M_blk;
-
-                    if (db_desc.reduce_dim > 0 && db_desc.load_dim > 0) {
-                        CHECK(safe_ptr_assign(reducers_[i_M][i_K],
-                                new reducer_t(bgmmc, db_desc)));
-                        CHECK(reducers_[i_M][i_K]->create_kernel());
-                    }
+            // The reducers of A are indexed by the kernel of M, and the
+            // reducers of B by the kernel of N.
+            const bool reduce_a
+                    = pd()->reduce_kind() == matmul_reduce_kind::src;
+            const int i_MN = reduce_a ? i_M : i_N;
+            if ((reduce_a ? i_N : i_M) == 0 && i_init == i_init_start) {
+                reducers_[i_MN][i_K] = nullptr;
+                auto db_desc = pd()->get_brg_desc(idx);
+                db_desc.reduce_dim = i_K ? bgmmc.K_tail : bgmmc.K_blk;
+                db_desc.load_dim = reduce_a
+                        ? (i_M ? bgmmc.M_tail : bgmmc.M_blk)
+                        : (i_N ? bgmmc.N_tail : bgmmc.N_blk);
+
+                if (db_desc.reduce_dim > 0 && db_desc.load_dim > 0) {
+                    CHECK(safe_ptr_assign(reducers_[i_MN][i_K],
+                            new reducer_t(bgmmc, db_desc)));
+                    CHECK(reducers_[i_MN][i_K]->create_kernel());
                 }
-            } else {
-                assert(!"unsupported reduce kind");
             }
         }
     }
@@ -486,9 +587,18 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
     matmul_helper_t helper(src_d, weights_d, dst_d);
 
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    if (bgmmc.with_src_dynamic_quant) quantize_src(ctx);
+
     brg_matmul_exec_ctx_t brgmm_ctx(ctx, pd(), helper);
 
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    std::shared_ptr<char> packed_b;
+    if (bgmmc.use_cached_b) {
+        const memory_t *weights = ctx.input(DNNL_ARG_WEIGHTS);
+        CHECK(get_packed_b(brgmm_ctx, weights ? weights->data_id() : 0,
+                packed_b));
+    }
+
     const bool use_buffer_a
             = bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only;
     const bool is_amx = is_superset(isa, avx512_core_amx);
@@ -609,8 +719,8 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
                                 mb, m_end, nb, n_end, bgmmc, brgmm_ctx);
                         for (int kb = kb_start; kb < kb_end; kb++) {
 
-                            if (bgmmc.use_buffer_b && mb == m_start
-                                    && !skip_copy_b)
+                            if (bgmmc.use_buffer_b && !bgmmc.use_cached_b
+                                    && mb == m_start && !skip_copy_b)
                                 copy_b_chunk_in_buffer(brgmm_ctx, b_batch_ptr,
                                         ithr, b, nb, kb);
 
@@ -633,13 +743,32 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
 
             advance_func();
         }
-        if (is_amx) { amx_tile_release(); }
+        if (is_amx) { amx_tile_lazy_release(); }
     });
 
-    maybe_reduce_and_convert_partial_results_A(brgmm_ctx);
+    maybe_reduce_and_convert_partial_results(brgmm_ctx);
     maybe_reduce_partial_results_and_apply_postops(brgmm_ctx);
 
-    return status::success;
+    return brgmm_ctx.kernel_status().load();
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::quantize_src(const exec_ctx_t &ctx) const {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const dim_t K = pd()->K();
+    const dim_t rows = src_d.nelems() / K;
+
+    const void *src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    float *scales = CTX_OUT_MEM(float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    int8_t *src_quant = ctx.get_scratchpad_grantor().template get<int8_t>(
+            key_matmul_src_quant);
+
+    if (src_d.data_type() == bf16)
+        quantize_src_rows(static_cast<const bfloat16_t *>(src), src_quant,
+                scales, rows, K);
+    else
+        quantize_src_rows(
+                static_cast<const float *>(src), src_quant, scales, rows, K);
 }
 
 template <cpu_isa_t isa>
@@ -698,8 +827,10 @@ void brgemm_matmul_t<isa>::compute_kernel(
     if (gemm_batch > 0 && brg_ker_idx >= 0) {
         const bool is_amx = is_superset(
                 pd()->get_brg_desc(brg_ker_idx).isa_impl, avx512_core_amx);
-        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
-        assert(brg_kernel != nullptr);
+        const auto brg_kernel
+                = brg_kernels_.get(brg_ker_idx, brgmm_ctx.kernel_status());
+        // The failure of a lazy generation is reported by execute_body().
+        if (brg_kernel == nullptr) return;
         brgemm_palettes_.maybe_tile_configure(
                 is_amx, prev_ker_idx, brg_ker_idx);
 
@@ -729,7 +860,8 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_src_scales_ptr(),
+                    false,
+                    brgmm_ctx.get_src_scales_ptr(b_idx, dst_row_logical_off),
                     brgmm_ctx.get_wei_scales_ptr(n),
                     brgmm_ctx.get_dst_scales_inv_ptr(ithr)};
             brgemm_kernel_execute_postops(brg_kernel, gemm_batch, addr_batch,
@@ -741,7 +873,7 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     &leading_dimensions);
         }
 
-        maybe_reduce_A(brgmm_ctx, ithr, gemm_batch, m_blk_idx, n_blk_idx,
+        maybe_reduce(brgmm_ctx, ithr, gemm_batch, m_blk_idx, n_blk_idx,
                 k_blk_idx, do_init, is_K_tail, /* do_K_tail */ false);
     }
     if (is_K_tail) {
@@ -760,7 +892,9 @@ void brgemm_matmul_t<isa>::compute_kernel(
                 pd()->get_brg_desc(brg_ker_idx).isa_impl, avx512_core_amx);
         brgemm_palettes_.maybe_tile_configure(
                 is_amx, prev_ker_idx, brg_ker_idx);
-        const auto brg_kernel_k_tail = brg_kernels_[brg_ker_idx].get();
+        const auto brg_kernel_k_tail
+                = brg_kernels_.get(brg_ker_idx, brgmm_ctx.kernel_status());
+        if (brg_kernel_k_tail == nullptr) return;
 
         if (post_ops_applicable) {
             void *scratch = is_amx
@@ -785,7 +919,8 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_src_scales_ptr(),
+                    false,
+                    brgmm_ctx.get_src_scales_ptr(b_idx, dst_row_logical_off),
                     brgmm_ctx.get_wei_scales_ptr(n),
                     brgmm_ctx.get_dst_scales_inv_ptr(ithr)};
 
@@ -798,7 +933,7 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     &leading_dimensions);
         }
 
-        maybe_reduce_A(brgmm_ctx, ithr, gemm_batch, m_blk_idx, n_blk_idx,
+        maybe_reduce(brgmm_ctx, ithr, gemm_batch, m_blk_idx, n_blk_idx,
                 k_blk_idx, do_init, is_K_tail,
                 /* do_K_tail */ true);
     }
@@ -808,38 +943,43 @@ void brgemm_matmul_t<isa>::compute_kernel(
 }
 
 template <cpu_isa_t isa>
-void brgemm_matmul_t<isa>::maybe_reduce_A(
+void brgemm_matmul_t<isa>::maybe_reduce(
         const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr, int gemm_batch,
         int m_blk_idx, int n_blk_idx, int k_chunk_idx, bool do_init,
         bool has_K_tail, bool do_K_tail) const {
 
     if (!pd()->with_reduce()) return;
-    //current state macro heuristics don't support reduce_A -> kb =1 -> kb == kc
+    //current state macro heuristics don't support reduce -> kb =1 -> kb == kc
     assert(!pd()->get_brgemm_matmul_conf().is_macro_heuristics);
     const bool reduce_a = pd()->reduce_kind() == matmul_reduce_kind::src;
-    // Only `matmul_reduce_kind::src` is supported for now.
-    assert(reduce_a);
 
     const auto &bgmmc = pd()->get_brgemm_matmul_conf();
     const auto *addr_batch = brgmm_ctx.get_batch_elem_ptr(ithr);
 
-    if (reduce_a && n_blk_idx == 0) {
-        const dim_t m = brgmm_ctx.get_M_idx(m_blk_idx, true);
+    // A is reduced along with the first block of N, and B along with the
+    // first block of M.
+    if (reduce_a ? n_blk_idx == 0 : m_blk_idx == 0) {
+        const dim_t off = reduce_a ? brgmm_ctx.get_M_idx(m_blk_idx, true)
+                                   : brgmm_ctx.get_N_idx(n_blk_idx, true);
 
         auto *reduce_ptr = bgmmc.use_buffer_reduce
-                ? brgmm_ctx.get_buf_reduce_ptr(ithr, m)
-                : brgmm_ctx.get_data_reduce_ptr(m);
+                ? brgmm_ctx.get_buf_reduce_ptr(ithr, off)
+                : brgmm_ctx.get_data_reduce_ptr(off);
 
         brgemm_kernel_diff_bias_t p;
 
         p.ptr_diff_bias_acc = (void *)reduce_ptr;
-        p.ptr_diff_bias = (void *)brgmm_ctx.get_data_reduce_ptr(m);
+        p.ptr_diff_bias = (void *)brgmm_ctx.get_data_reduce_ptr(off);
 
-        const int m_ker_idx = brgmm_ctx.get_M_kernel_idx(m_blk_idx);
+        const int ker_idx = reduce_a ? brgmm_ctx.get_M_kernel_idx(m_blk_idx)
+                                     : brgmm_ctx.get_N_kernel_idx(n_blk_idx);
+        const auto batch_ptr = [&](int gb) {
+            return reduce_a ? addr_batch[gb].ptr.A : addr_batch[gb].ptr.B;
+        };
 
         if (!do_K_tail) {
             for (int gb = 0; gb < gemm_batch; gb++) {
-                p.ptr_diff_dst = (void *)addr_batch[gb].ptr.A;
+                p.ptr_diff_dst = (void *)batch_ptr(gb);
 
                 const bool is_first = do_init && gb == 0;
                 const bool is_last = (bgmmc.nthr_k == 1 || bgmmc.K_chunks == 1)
@@ -849,10 +989,10 @@ void brgemm_matmul_t<isa>::maybe_reduce_A(
                 p.flags = 0 | (is_first ? FLAG_REDUCE_FIRST : 0)
                         | (is_last ? FLAG_REDUCE_LAST : 0);
 
-                (*reducers_[m_ker_idx][do_K_tail])(&p);
+                (*reducers_[ker_idx][do_K_tail])(&p);
             }
         } else {
-            p.ptr_diff_dst = (void *)addr_batch[0].ptr.A;
+            p.ptr_diff_dst = (void *)batch_ptr(0);
 
             const bool is_first = do_init && gemm_batch == 0;
             const bool is_last = (bgmmc.nthr_k == 1 || bgmmc.K_chunks == 1)
@@ -861,13 +1001,13 @@ void brgemm_matmul_t<isa>::maybe_reduce_A(
             p.flags = 0 | (is_first ? FLAG_REDUCE_FIRST : 0)
                     | (is_last ? FLAG_REDUCE_LAST : 0);
 
-            (*reducers_[m_ker_idx][do_K_tail])(&p);
+            (*reducers_[ker_idx][do_K_tail])(&p);
         }
     }
 }
 
 template <cpu_isa_t isa>
-void brgemm_matmul_t<isa>::maybe_reduce_and_convert_partial_results_A(
+void brgemm_matmul_t<isa>::maybe_reduce_and_convert_partial_results(
         const brg_matmul_exec_ctx_t &brgmm_ctx) const {
     // Partial results appear when parallel reduction is used.
     //
@@ -922,44 +1062,50 @@ void brgemm_matmul_t<isa>::maybe_reduce_and_convert_partial_results_A(
         const int ithr_k = brgmm_ctx.get_thread_idx_for_k(ithr);
         if (ithr_bmn < 0 || ithr_k < 0) return;
 
-        const int M_chunks = brgmm_ctx.get_M_chunks();
-
-        int start_mc {0}, end_mc {0};
-        balance211(M_chunks, brgmm_ctx.get_num_threads_for_bmn(), ithr_bmn,
-                start_mc, end_mc);
-        if (start_mc != end_mc && ithr_k == 0) {
-            const size_t m = start_mc * bgmmc.M_chunk_elems;
-            const size_t mc_work = end_mc - start_mc;
-            const size_t acc_size
-                    = std::min(mc_work * bgmmc.M_chunk_elems, bgmmc.M - m);
+        // The sums of A are split by the chunks of M, and those of B by the
+        // chunks of N.
+        const bool reduce_a = bgmmc.reduce_kind == matmul_reduce_kind::src;
+        const int chunks = reduce_a ? brgmm_ctx.get_M_chunks()
+                                    : brgmm_ctx.get_N_chunks();
+        const size_t chunk_elems
+                = reduce_a ? bgmmc.M_chunk_elems : bgmmc.N_chunk_elems;
+        const size_t len = reduce_a ? bgmmc.M : bgmmc.N;
+
+        int start_c {0}, end_c {0};
+        balance211(chunks, brgmm_ctx.get_num_threads_for_bmn(), ithr_bmn,
+                start_c, end_c);
+        if (start_c != end_c && ithr_k == 0) {
+            const size_t off = start_c * chunk_elems;
+            const size_t c_work = end_c - start_c;
+            const size_t acc_size = std::min(c_work * chunk_elems, len - off);
 
             const bool is_reduce_f32 = bgmmc.reduce_dt == f32;
 
             float *reduce_acc = is_reduce_f32
-                    ? (float *)brgmm_ctx.get_data_reduce_ptr(m)
-                    : (float *)brgmm_ctx.get_buf_reduce_ptr_by_index(0, m);
+                    ? (float *)brgmm_ctx.get_data_reduce_ptr(off)
+                    : (float *)brgmm_ctx.get_buf_reduce_ptr_by_index(0, off);
 
             int ibuf = !is_reduce_f32;
             for (; ibuf < bgmmc.nthr_k - 1; ibuf++) {
                 float *reduce_buf
                         = (float *)brgmm_ctx.get_buf_reduce_ptr_by_index(
-                                ibuf, m);
+                                ibuf, off);
                 acc_ker_f32_->accumulate(reduce_acc, reduce_buf, acc_size);
             }
 
             if (!is_reduce_f32) {
                 float *reduce_buf
                         = (float *)brgmm_ctx.get_buf_reduce_ptr_by_index(
-                                ibuf, m);
+                                ibuf, off);
                 switch (bgmmc.reduce_dt) {
                     case data_type::bf16:
-                        add_floats_and_cvt_to_bfloat16(
-                                (bfloat16_t *)brgmm_ctx.get_data_reduce_ptr(m),
+                        add_floats_and_cvt_to_bfloat16((bfloat16_t *)
+                                        brgmm_ctx.get_data_reduce_ptr(off),
                                 reduce_acc, reduce_buf, acc_size);
                         break;
                     case data_type::f16:
-                        add_floats_and_cvt_to_float16(
-                                (float16_t *)brgmm_ctx.get_data_reduce_ptr(m),
+                        add_floats_and_cvt_to_float16((float16_t *)
+                                        brgmm_ctx.get_data_reduce_ptr(off),
                                 reduce_acc, reduce_buf, acc_size);
                         break;
                     default: assert(!"invalid data type");
@@ -1053,7 +1199,9 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                                 avx512_core_amx);
                         brgemm_palettes_.maybe_tile_configure(
                                 is_amx, prev_ker_idx, brg_ker_idx);
-                        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+                        const auto brg_kernel = brg_kernels_.get(
+                                brg_ker_idx, brgmm_ctx.kernel_status());
+                        if (brg_kernel == nullptr) return;
                         const int m = brgmm_ctx.get_M_idx(mb);
                         const int n = nb * bgmmc.N_blk;
                         const auto ptr_bias = brgmm_ctx.get_bias_ptr(n);
@@ -1094,7 +1242,7 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                                 static_cast<const void *>(zp_comp_b),
                                 static_cast<const void *>(zp_c_val_ptr),
                                 skip_accumulation, 1, false, false,
-                                brgmm_ctx.get_src_scales_ptr(),
+                                brgmm_ctx.get_src_scales_ptr(b, m),
                                 brgmm_ctx.get_wei_scales_ptr(n),
                                 brgmm_ctx.get_dst_scales_inv_ptr(ithr)};
 
@@ -1183,7 +1331,7 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
             p.bitmask_ptr
                     = (void *)brgmm_ctx.get_data_B_bitmask_ptr(b_idx, k, n);
             p.dst_ptr = (void *)brgmm_ctx.get_buf_B_ptr(
-                    ithr, k_blk_idx, n_blk_idx, gb);
+                    ithr, b_idx, k_blk_idx, n_blk_idx, gb);
             (*sparse_decompress_kernel_)(&p);
         }
         return;
@@ -1222,7 +1370,7 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
         const int k = k_start + gb * bgmmc.K_blk + k_i * wei_scales_gK;
         ctx.src = (void *)brgmm_ctx.get_data_B_kn_ptr(B_data_batch_ptr, k, n);
         ctx.tr_src = (void *)brgmm_ctx.get_buf_B_ptr(
-                ithr, k_blk_idx, n_blk_idx, gb, k_i * wei_scales_gK);
+                ithr, b_idx, k_blk_idx, n_blk_idx, gb, k_i * wei_scales_gK);
         ctx.compensation_ptr
                 = (void *)brgmm_ctx.get_s8s8_comp_ptr(ithr, b_idx, n_blk_idx);
         ctx.current_K_start = k;
@@ -1254,8 +1402,8 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
     for (int k_i = 0; k_i < wei_scales_n_g_tail; k_i++) {
         const int k = k_start + gemm_batch * bgmmc.K_blk + k_i * wei_scales_gK;
         ctx.src = (void *)brgmm_ctx.get_data_B_kn_ptr(B_data_batch_ptr, k, n);
-        ctx.tr_src = (void *)brgmm_ctx.get_buf_B_ptr(
-                ithr, k_blk_idx, n_blk_idx, gemm_batch, k_i * wei_scales_gK);
+        ctx.tr_src = (void *)brgmm_ctx.get_buf_B_ptr(ithr, b_idx, k_blk_idx,
+                n_blk_idx, gemm_batch, k_i * wei_scales_gK);
         ctx.compensation_ptr
                 = (void *)brgmm_ctx.get_s8s8_comp_ptr(ithr, b_idx, n_blk_idx);
         ctx.current_K_start = k;
@@ -1277,6 +1425,59 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
     }
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::get_packed_b(brg_matmul_exec_ctx_t &brgmm_ctx,
+        uint64_t weights_id, std::shared_ptr<char> &packed_b) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+
+    std::lock_guard<std::mutex> lock(packed_b_cache_.mutex);
+    // Weights without an id, e.g. the ones of an internal memory, are packed
+    // on every execution.
+    if (!packed_b_cache_.data || weights_id == 0
+            || packed_b_cache_.weights_id != weights_id) {
+        const int B_batches = brgmm_ctx.get_packed_B_batches();
+        const size_t size
+                = (size_t)B_batches * brgmm_ctx.get_packed_B_batch_sz();
+        char *ptr = static_cast<char *>(impl::malloc(size, PAGE_4K));
+        if (!ptr) return status::out_of_memory;
+        std::shared_ptr<char> data(ptr, [](char *p) { impl::free(p); });
+        brgmm_ctx.set_packed_B_ptr(ptr);
+
+        // A batch of B broadcast over several batches of dst is packed once.
+        std::vector<int> b_of_bb(B_batches, -1);
+        for (int b = 0; b < bgmmc.batch; b++) {
+            int &b_rep = b_of_bb[brgmm_ctx.get_bb_idx(b, bgmmc.bcast_B_desc)];
+            if (b_rep < 0) b_rep = b;
+        }
+
+        const int work_amount
+                = B_batches * bgmmc.num_N_blocks * bgmmc.num_K_blocks;
+        parallel(0, [&](const int ithr, const int nthr) {
+            int start {0}, end {0};
+            balance211(work_amount, nthr, ithr, start, end);
+            int bb {0}, nb {0}, kb {0};
+            nd_iterator_init(start, bb, B_batches, nb, bgmmc.num_N_blocks, kb,
+                    bgmmc.num_K_blocks);
+            for (int w = start; w < end; w++) {
+                const int b = b_of_bb[bb];
+                if (b >= 0)
+                    copy_b_chunk_in_buffer(brgmm_ctx,
+                            brgmm_ctx.get_data_B_batch_ptr(b), ithr, b, nb,
+                            kb);
+                nd_iterator_step(bb, B_batches, nb, bgmmc.num_N_blocks, kb,
+                        bgmmc.num_K_blocks);
+            }
+        });
+
+        packed_b_cache_.weights_id = weights_id;
+        packed_b_cache_.data = std::move(data);
+    }
+
+    packed_b = packed_b_cache_.data;
+    brgmm_ctx.set_packed_B_ptr(packed_b.get());
+    return status::success;
+}
+
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::accumulate(
         char *result_ptr, const char *reduce_ptr, size_t size) const {
@@ -1345,6 +1546,10 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
         src_scales_ = CTX_IN_MEM(
                 const float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+        // The source quantized by `quantize_src` replaces the user one, and
+        // the source scales were written by it.
+        if (bgmmc_.with_src_dynamic_quant)
+            data_A_ptr_ = scratchpad.template get<char>(key_matmul_src_quant);
         wei_scales_ = CTX_IN_MEM(
                 const float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
         wei_scales_tr_ = bgmmc_.is_wei_scale_per_k
@@ -1788,7 +1993,8 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                     ? get_buf_A_ptr(ithr, m_blk_idx, k_blk_idx, brg_batch_idx)
                     : get_data_A_mk_ptr(A_data_batch_ptr, m, k);
             addr_batch[b_iter].ptr.B = (bgmmc_.use_buffer_b)
-                    ? get_buf_B_ptr(ithr, k_blk_idx, n_blk_idx, brg_batch_idx)
+                    ? get_buf_B_ptr(
+                            ithr, b_idx, k_blk_idx, n_blk_idx, brg_batch_idx)
                     : get_data_B_kn_ptr(B_data_batch_ptr, k, n);
         }
     }
@@ -1835,15 +2041,38 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     //   `k` defines an offset inside a specific block over K. It is the
     //     smallest granularity possible. It is used only when wei_decompression
     //     feature is requested with a single scale over a sub-piece of `K_blk`.
-    char *get_buf_B_ptr(
-            int ithr, int k_blk_idx, int n_blk_idx, int gb, int k = 0) const {
-        UNUSED(n_blk_idx);
+    // When B is cached, the whole packed B is kept and `b_idx`, `n_blk_idx`
+    // and `k_blk_idx` select the block instead of `ithr`.
+    char *get_buf_B_ptr(int ithr, int b_idx, int k_blk_idx, int n_blk_idx,
+            int gb, int k = 0) const {
         if (!bgmmc_.use_buffer_b) return nullptr;
+        const dim_t blk_off = gb * bgmmc_.buffer_b_gb_stride
+                + k * bgmmc_.buffer_b_k_stride;
+        if (bgmmc_.use_cached_b) {
+            const int bb = get_bb_idx(b_idx, bgmmc_.bcast_B_desc);
+            return packed_B_ptr_ + bb * get_packed_B_batch_sz()
+                    + n_blk_idx * get_packed_B_n_blk_sz()
+                    + k_blk_idx * bgmmc_.buffer_b_k_brg_stride + blk_off;
+        }
         int k_blk_local = k_blk_idx % get_K_chunk_size();
         return buf_B_ptr_ + ithr * bgmmc_.buffer_b_per_thread_sz
-                + k_blk_local * bgmmc_.buffer_b_k_brg_stride
-                + gb * bgmmc_.buffer_b_gb_stride + k * bgmmc_.buffer_b_k_stride;
+                + k_blk_local * bgmmc_.buffer_b_k_brg_stride + blk_off;
+    }
+
+    // The sizes of the packed B for a block over N and for a batch, when B
+    // is cached.
+    dim_t get_packed_B_n_blk_sz() const {
+        return bgmmc_.num_K_blocks * bgmmc_.buffer_b_k_brg_stride;
     }
+    dim_t get_packed_B_batch_sz() const {
+        return bgmmc_.num_N_blocks * get_packed_B_n_blk_sz();
+    }
+    int get_packed_B_batches() const {
+        return get_bb_idx(bgmmc_.batch - 1, bgmmc_.bcast_B_desc) + 1;
+    }
+
+    const char *get_data_B_ptr() const { return data_B_ptr_; }
+    void set_packed_B_ptr(char *ptr) { packed_B_ptr_ = ptr; }
 
     char *get_buf_C_ptr(int ithr, int m_blk_idx, int n_blk_idx) const {
         if (!bgmmc_.use_buffer_c) return nullptr;
@@ -1969,8 +2198,8 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     // corresponding index @p ibuf, shifted by the specified offset @p off.
     char *get_buf_reduce_ptr_by_index(int ibuf, int off) const {
         if (!bgmmc_.with_reduce) return nullptr;
-        const size_t _off = bgmmc_.M * ibuf + off;
-        return buf_reduce_ptr_ + _off * bgmmc_.acc_dt_sz;
+        return buf_reduce_ptr_ + ibuf * bgmmc_.buffer_reduce_per_thread_sz
+                + off * bgmmc_.acc_dt_sz;
     }
 
     const char *get_bias_ptr(int n) const {
@@ -1991,6 +2220,13 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     }
 
     const void *get_src_scales_ptr() const { return src_scales_; }
+    // Returns the scales of the rows of a block starting at the row `m` of
+    // the matrix `b` when the source scales have a value per row.
+    const void *get_src_scales_ptr(int b, dim_t m) const {
+        if (!bgmmc_.is_src_scale_per_row) return src_scales_;
+        const dim_t row = get_bb_idx(b, bgmmc_.bcast_A_desc) * bgmmc_.M + m;
+        return static_cast<const float *>(src_scales_) + row;
+    }
 
     // Returns a pointer to the weights scales for the correspondent block based
     // on @p n and @p k.
@@ -2409,6 +2645,9 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                                    : 0;
     }
 
+    // The failure of a lazy kernel generation in this execution.
+    std::atomic<status_t> &kernel_status() const { return kernel_status_; }
+
 private:
     struct tail_processing_t {
         // dimension index kernel is applied to
@@ -2450,6 +2689,7 @@ private:
 
     char *buf_A_ptr_;
     char *buf_B_ptr_;
+    char *packed_B_ptr_ = nullptr;
     char *buf_C_ptr_;
     char *buf_D_ptr_;
     char *buf_reduce_ptr_;
@@ -2520,6 +2760,7 @@ private:
     dim_t copy_B_wei_stride_;
     std::vector<tail_processing_t> m_tail_processing_;
     std::vector<tail_processing_t> n_tail_processing_;
+    mutable std::atomic<status_t> kernel_status_ {status::success};
 
     char *get_buf_D_ptr(int ithr) const {
         return buf_D_ptr_ + bgmmc_.c_dt_sz * bgmmc_.M_blk * bgmmc_.N_blk * ithr;
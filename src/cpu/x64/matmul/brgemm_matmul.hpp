@@ -17,6 +17,9 @@
 #ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 #define CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 
+#include <memory>
+#include <mutex>
+
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
@@ -68,6 +71,14 @@ struct brgemm_matmul_t : public primitive_t {
             return bgmmc_;
         }
 
+        // fp8 activations are commonly quantized per token with static
+        // scales, which the brgemm kernels apply to the rows of C.
+        bool src_scales_per_row_ok() const override {
+            using namespace data_type;
+            return utils::one_of(src_md()->data_type, f8_e5m2, f8_e4m3)
+                    && utils::one_of(weights_md()->data_type, f8_e5m2, f8_e4m3);
+        }
+
     private:
         brgemm_desc_t brg_descs_[max_num_brg_kernels_matmul];
         brgemm_matmul_conf_t bgmmc_;
@@ -87,6 +98,7 @@ private:
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     status_t execute_body(const exec_ctx_t &ctx) const;
+    void quantize_src(const exec_ctx_t &ctx) const;
     void compute_kernel(const brg_matmul_exec_ctx_t &brgmm_ctx,
             const char *A_data_batch_ptr, const char *B_data_batch_ptr,
             int ithr, int b_idx, int m_blk_idx, int n_blk_idx, int k_blk_idx,
@@ -102,17 +114,20 @@ private:
     void copy_b_chunk_in_buffer(const brg_matmul_exec_ctx_t &brgmm_ctx,
             const char *B_data_batch_ptr, int ithr, int b_idx, int n_blk_idx,
             int k_blk_idx) const;
+    status_t get_packed_b(brg_matmul_exec_ctx_t &brgmm_ctx,
+            uint64_t weights_id, std::shared_ptr<char> &packed_b) const;
     void maybe_reduce_partial_results_and_apply_postops(
             const brg_matmul_exec_ctx_t &brgmm_ctx) const;
-    void maybe_reduce_A(const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr,
+    void maybe_reduce(const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr,
             int gemm_batch, int m_blk_idx, int n_blk_idx, int k_chunk_idx,
             bool do_init, bool has_K_tail, bool do_K_tail) const;
-    void maybe_reduce_and_convert_partial_results_A(
+    void maybe_reduce_and_convert_partial_results(
             const brg_matmul_exec_ctx_t &brgmm_ctx) const;
     void accumulate(
             char *result_ptr, const char *reduce_ptr, size_t size) const;
 
-    std::unique_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
+    brgemm_containers::brgemm_kernel_container_t brg_kernels_ {
+            max_num_brg_kernels_matmul};
     brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {
             max_num_brg_kernels_matmul};
 
@@ -126,6 +141,18 @@ private:
     using reducer_t = x64::jit_brgemm_kernel_diff_bias_t<
             typename cpu_isa_traits_t<isa>::Vmm>;
     std::unique_ptr<reducer_t> reducers_[2][2];
+
+    // B packed for the weights last passed to the primitive, used when the
+    // weights are constant. The weights are identified by the data id of
+    // their memory rather than by their address, which another buffer may
+    // take. An execution keeps the packed data alive while it is replaced
+    // for other weights.
+    struct packed_b_cache_t {
+        std::mutex mutex;
+        uint64_t weights_id = 0;
+        std::shared_ptr<char> data;
+    };
+    mutable packed_b_cache_t packed_b_cache_;
 };
 
 } // namespace matmul
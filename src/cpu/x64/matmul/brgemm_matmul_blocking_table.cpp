@@ -0,0 +1,150 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#include "oneapi/dnnl/dnnl_debug.h"
+
+#include "common/utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_blocking_table.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+namespace {
+
+const std::string &get_file_name() {
+    static const std::string name = getenv_path_user("MATMUL_BLOCKING_TABLE");
+    return name;
+}
+
+struct blocking_table_t {
+    static blocking_table_t &get() {
+        // Intentionally leaked: primitives may be created while static
+        // objects are destroyed, and the atexit save needs the entries.
+        static blocking_table_t *table = new blocking_table_t();
+        return *table;
+    }
+
+    bool lookup(const std::string &key, blocking_table_entry_t &entry) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = entries_.find(key);
+        if (it == entries_.end()) return false;
+        entry = it->second;
+        return true;
+    }
+
+    void record(const std::string &key, const blocking_table_entry_t &entry) {
+        if (!record_) return;
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.emplace(key, entry);
+    }
+
+private:
+    blocking_table_t()
+        : record_(getenv_int_user("MATMUL_BLOCKING_TABLE_RECORD", 0) != 0) {
+        load();
+        if (record_) std::atexit(save_at_exit);
+    }
+
+    void load() {
+        std::ifstream in(get_file_name());
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.empty() || line[0] == '#') continue;
+            std::istringstream ss(line);
+            std::string key;
+            blocking_table_entry_t e;
+            if (!(ss >> key >> e.nthr_k >> e.n_blk >> e.n_chunk_size >> e.m_blk
+                        >> e.m_chunk_size))
+                continue;
+            entries_[key] = e;
+        }
+    }
+
+    static void save_at_exit() {
+        auto &t = get();
+        std::lock_guard<std::mutex> lock(t.mutex_);
+        std::ofstream out(get_file_name(), std::ios::trunc);
+        if (!out) return;
+        out << "# key nthr_k n_blk n_chunk_size m_blk m_chunk_size\n";
+        for (const auto &kv : t.entries_) {
+            const auto &e = kv.second;
+            out << kv.first << " " << e.nthr_k << " " << e.n_blk << " "
+                << e.n_chunk_size << " " << e.m_blk << " " << e.m_chunk_size
+                << "\n";
+        }
+    }
+
+    std::mutex mutex_;
+    // Ordered to keep the saved file stable between runs.
+    std::map<std::string, blocking_table_entry_t> entries_;
+    const bool record_;
+};
+
+} // namespace
+
+bool blocking_table_enabled() {
+    return !get_file_name().empty();
+}
+
+std::string blocking_table_key(const brgemm_matmul_conf_t &bgmmc) {
+    std::ostringstream ss;
+    ss << isa2str(bgmmc.isa) << "," << dnnl_dt2str(bgmmc.orig_src_dt) << ":"
+       << dnnl_dt2str(bgmmc.orig_wei_dt) << ":" << dnnl_dt2str(bgmmc.dst_dt)
+       << "," << dnnl_fmt_tag2str(bgmmc.src_tag) << ":"
+       << dnnl_fmt_tag2str(bgmmc.wei_tag) << ":"
+       << dnnl_fmt_tag2str(bgmmc.dst_tag) << "," << bgmmc.batch << "x"
+       << bgmmc.M << "x" << bgmmc.N << "x" << bgmmc.K << ",nthr"
+       << bgmmc.nthr;
+    return ss.str();
+}
+
+bool blocking_table_lookup(
+        const std::string &key, blocking_table_entry_t &entry) {
+    if (!blocking_table_enabled()) return false;
+    return blocking_table_t::get().lookup(key, entry);
+}
+
+bool blocking_table_entry_is_valid(const blocking_table_entry_t &entry,
+        int nthr, dim_t M, dim_t N, dim_t wei_n_blk) {
+    return entry.nthr_k > 0 && entry.n_blk > 0 && entry.n_chunk_size > 0
+            && entry.m_blk > 0 && entry.m_chunk_size > 0
+            && entry.nthr_k <= nthr && wei_n_blk > 0
+            && entry.n_blk % wei_n_blk == 0 && entry.m_blk <= M
+            && entry.n_blk <= N;
+}
+
+void blocking_table_record(
+        const std::string &key, const blocking_table_entry_t &entry) {
+    if (!blocking_table_enabled()) return;
+    blocking_table_t::get().record(key, entry);
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_BLOCKING_TABLE_HPP
+#define CPU_X64_MATMUL_BRGEMM_MATMUL_BLOCKING_TABLE_HPP
+
+#include <string>
+
+#include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Persistent table of the blocking parameters used by the AMX micro
+// heuristic, keyed by the problem. The table is loaded from the file set with
+// ONEDNN_MATMUL_BLOCKING_TABLE and its entries take precedence over the
+// analytic model, so that the blocking found the fastest for a fixed set of
+// shapes, e.g. with benchdnn, is reused by later runs.
+// With ONEDNN_MATMUL_BLOCKING_TABLE_RECORD=1 the blocking picked by the
+// heuristic for the problems missing in the table is added to it, and the
+// file is rewritten at exit, which gives the starting table to tune.
+//
+// The file holds one entry per line, lines starting with '#' are skipped:
+//   <key> <nthr_k> <n_blk> <n_chunk_size> <m_blk> <m_chunk_size>
+struct blocking_table_entry_t {
+    int nthr_k = 0;
+    int n_blk = 0;
+    int n_chunk_size = 0;
+    int m_blk = 0;
+    int m_chunk_size = 0;
+};
+
+// Returns true if the table file is set.
+bool DNNL_API blocking_table_enabled();
+
+std::string blocking_table_key(const brgemm_matmul_conf_t &bgmmc);
+
+// Returns true and fills `entry` if the table has an entry for `key`.
+bool DNNL_API blocking_table_lookup(
+        const std::string &key, blocking_table_entry_t &entry);
+
+// Returns true if `entry` is a valid blocking for the problem: all values
+// are positive, nthr_k does not exceed the number of threads, n_blk is a
+// multiple of the weights N block and the blocks do not exceed the problem.
+bool DNNL_API blocking_table_entry_is_valid(
+        const blocking_table_entry_t &entry, int nthr, dim_t M, dim_t N,
+        dim_t wei_n_blk);
+
+// Adds the entry if it is missing and the recording is enabled.
+void blocking_table_record(
+        const std::string &key, const blocking_table_entry_t &entry);
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -23,6 +23,7 @@
 #include "cpu/platform.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/matmul/amx_blocking_heuristics.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_blocking_table.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
 #include "cpu/x64/matmul/postops_estimator.hpp"
 #include "oneapi/dnnl/dnnl_debug.h"
@@ -805,6 +806,33 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
         // TODO: expand to other data types.
         use_k_partitioning = use_k_partitioning && bm_conf_utils.is_f32();
 
+        // The compensations are computed per K chunk of B in the copy
+        // routines and are not reduced by the k-partitioning yet.
+        const bool k_partitioning_supported = bgmmc.batch == 1
+                && !bm_conf_utils.check_is_transposed(bgmmc.src_tag)
+                && !bgmmc.s8s8_compensation_required
+                && bgmmc.src_zp_type == brgemm_broadcast_t::none
+                && IMPLICATION(bgmmc.wei_zp_type != brgemm_broadcast_t::none,
+                        bgmmc.with_wei_decompression);
+
+        // Decode-like shapes with a few rows of src, e.g. the tokens of an
+        // LLM generation step, are bound by the read of the weights. As M
+        // gives no parallel work, split K as well so all the threads stream
+        // the weights.
+        const bool is_decode = matmul.M <= 8 && matmul.K >= 1024;
+        // Shapes with fewer M x N blocks than threads and a K much larger
+        // than M and N, e.g. M = 64, N = 1024, K = 16384, leave most of the
+        // threads idle without the split of K.
+        const bool is_k_dominant = max_bmn_parallel < nthr
+                && matmul.K >= 8192
+                && matmul.K >= 8 * nstl::max(matmul.M, matmul.N);
+        const bool is_k_bound = k_partitioning_supported
+                && (is_decode || is_k_dominant
+                        || (is_huge_k && is_small_mn));
+        use_k_partitioning = use_k_partitioning || is_k_bound;
+        // Smaller K blocks give every thread in K its share of the work.
+        if (is_k_bound) k_blk = nstl::min(k_blk, 256);
+
         if (use_k_partitioning) {
             auto least_prime_factor = [](int n) {
                 assert(n > 0);
@@ -826,9 +854,13 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
                 nthr_remainder = nthr % nthr_bmn;
             }
 
-            // Reduce number of threads in k-dim to balanced work.
+            // Reduce number of threads in k-dim to balanced work. K-bound
+            // shapes have little other work, so a single chunk per thread
+            // is enough.
             dim_t k_chunks = div_up(matmul.K, k_blk);
-            while (k_chunks <= 5 * nthr_k && nthr_k > 1)
+            while (nthr_k > 1
+                    && (is_k_bound ? k_chunks < nthr_k
+                                   : k_chunks <= 5 * nthr_k))
                 nthr_k /= least_prime_factor(nthr_k);
 
             // Fix number of threads for k-dim.
@@ -1085,8 +1117,27 @@ status_t compute_blocking_heuristic(brgemm_matmul_conf_t &bgmmc,
 
         matmul_amx_blocking_params_micro_t best_blocking(bgmmc);
 
-        matmul_amx_blocking_params_micro_t::find_best_blocking(
-                bgmmc, bm_conf_utils, best_blocking);
+        // A blocking from the table that is invalid for the problem is
+        // skipped, and the heuristic is used instead.
+        const bool use_blocking_table = blocking_table_enabled();
+        const std::string blocking_key = use_blocking_table
+                ? blocking_table_key(bgmmc)
+                : std::string();
+        blocking_table_entry_t table_entry;
+        if (use_blocking_table
+                && blocking_table_lookup(blocking_key, table_entry)
+                && blocking_table_entry_is_valid(table_entry, bgmmc.nthr,
+                        bgmmc.M, bgmmc.N, bgmmc.wei_n_blk))
+            best_blocking.set_blocking_parameters(table_entry);
+
+        if (best_blocking.get_blocking_scores() == 0.0f) {
+            matmul_amx_blocking_params_micro_t::find_best_blocking(
+                    bgmmc, bm_conf_utils, best_blocking);
+            if (use_blocking_table
+                    && best_blocking.get_blocking_scores() != 0.0f)
+                blocking_table_record(
+                        blocking_key, best_blocking.get_blocking_parameters());
+        }
 
         VCONDCHECK_BG(best_blocking.get_blocking_scores() != 0.0f,
                 VERBOSE_BLOCKING_FAIL, "");
@@ -1272,6 +1323,9 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     const auto &src_scales = attr.scales_.get(DNNL_ARG_SRC);
     const auto &wei_scales = attr.scales_.get(DNNL_ARG_WEIGHTS);
     bgmmc.with_src_scales = !src_scales.has_default_values();
+    bgmmc.with_src_dynamic_quant = attr.dynamic_quantization_;
+    bgmmc.is_src_scale_per_row
+            = bgmmc.with_src_scales && src_scales.get_mask() > 0;
     bgmmc.with_wei_scales = !wei_scales.has_default_values();
     if (bgmmc.with_wei_scales) {
         const auto wei_qmask_N = 1 << (bgmmc.ndims - 1);
@@ -1339,9 +1393,13 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     // Single runtime dimension is only supported for now
     VCONDCHECK_BG(!(bgmmc.is_runtime_M && bgmmc.is_runtime_N),
             VERBOSE_RUNTIMEDIM_UNSUPPORTED)
-    // Runtime value for M dimension is supported for 2d AMX int8/bfloat16
-    // problems only.
-    const bool runtime_M_supported = bgmmc.is_amx && bgmmc.ndims == 2
+    // Runtime value for M dimension is supported for 2d and 3d AMX
+    // int8/bfloat16 problems only. The M blocking and the set of tail kernels
+    // do not depend on M, so the batch stride is the only value which has to
+    // be taken from the memory descriptors at execution time, and it is always
+    // trivial for 3d tensors.
+    const bool runtime_M_supported = bgmmc.is_amx
+            && one_of(bgmmc.ndims, 2, 3)
             && one_of(true, bm_conf_utils.is_int8(), bm_conf_utils.is_bf16());
     VCONDCHECK_BG(!(bgmmc.is_runtime_M && !runtime_M_supported),
             VERBOSE_RUNTIMEDIM_UNSUPPORTED)
@@ -1872,6 +1930,9 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
     if (bgmmc.reduce_kind == matmul_reduce_kind::src) {
         assert(bgmmc.acc_dt == f32);
         bgmmc.buffer_reduce_per_thread_sz = bgmmc.M * bgmmc.acc_dt_sz;
+    } else if (bgmmc.reduce_kind == matmul_reduce_kind::weights) {
+        assert(bgmmc.acc_dt == f32);
+        bgmmc.buffer_reduce_per_thread_sz = bgmmc.N * bgmmc.acc_dt_sz;
     }
 
     bgmmc.s8s8_comp_ithr_str
@@ -1999,8 +2060,10 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
                 bgmmc.nthr * bgmmc.buffer_a_per_thread_sz, default_data_align);
 
     if (bgmmc.use_buffer_b) {
-        scratchpad.book(key_brgemm_primitive_buffer_b,
-                bgmmc.nthr * bgmmc.buffer_b_per_thread_sz, default_data_align);
+        if (!bgmmc.use_cached_b)
+            scratchpad.book(key_brgemm_primitive_buffer_b,
+                    bgmmc.nthr * bgmmc.buffer_b_per_thread_sz,
+                    default_data_align);
 
         if (bgmmc.s8s8_compensation_required && (!bgmmc.blocked_B))
             scratchpad.book(key_brgemm_primitive_buffer_comp,
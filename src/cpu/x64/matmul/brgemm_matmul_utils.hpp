@@ -108,6 +108,11 @@ struct brgemm_matmul_conf_t {
     bool with_eltwise;
     bool with_binary;
     bool with_src_scales;
+    // The source scales are computed per row and the source is quantized
+    // before the multiplication.
+    bool with_src_dynamic_quant;
+    // The source scales have a value per row, either computed or given.
+    bool is_src_scale_per_row;
     bool with_wei_scales;
     bool with_dst_scales;
     bool s8s8_compensation_required;
@@ -231,6 +236,10 @@ struct brgemm_matmul_conf_t {
     bool is_wei_scale_per_k = false;
     bool req_transpose_scales = false;
     bool apply_scales_in_buffer_b = false;
+    // With constant weights, B is packed into a buffer kept with the
+    // primitive once instead of into the per-thread B buffer on every
+    // execution. Set by the primitive descriptor after the configuration.
+    bool use_cached_b = false;
     // For generic cases, when groups are selected the way they can't divide a
     // K_blk in equal pieces, it gets really hard to call a kernel with a
     // single "per_N line" of scales. In this case weights will be copied
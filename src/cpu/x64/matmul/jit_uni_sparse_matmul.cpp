@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <cassert>
+#include <cstring>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
@@ -23,6 +24,8 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/matmul/matmul_utils.hpp"
+
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
@@ -348,8 +351,8 @@ jit_uni_sparse_matmul_t::~jit_uni_sparse_matmul_t() = default;
 status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
     const auto *weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
     const auto *src_values = CTX_IN_MEM(const float *, DNNL_ARG_SRC, 0);
-    const auto *src_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
-    const auto *src_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
+    const auto *src_buffer_1 = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+    const auto *src_buffer_2 = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
 
     status_t status = status::success;
     auto dst = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DST, status);
@@ -361,9 +364,21 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
     const dim_t M = dst_d.dims()[0];
     const dim_t N = dst_d.dims()[1];
 
-    // TODO: Implement a load balancing mechanism that would distribute
-    // rows between threads based on the number of non-zero elements in those
-    // rows.
+    const int32_t *src_indices = src_buffer_1;
+    const int32_t *src_pointers = src_buffer_2;
+    if (src_d.encoding() == sparse_encoding::coo) {
+        // For COO encoding, the two index buffers hold the row and column
+        // indices respectively. The row indices are compressed into CSR
+        // pointers in a temporary buffer.
+        auto *src_row_pointers = ctx.get_scratchpad_grantor().get<int32_t>(
+                memory_tracking::names::key_matmul_sparse_tmp_ptr);
+        std::memset(src_row_pointers, 0, (M + 1) * sizeof(int32_t));
+        cpu::matmul::cvt_coo_indices_to_csr_pointers(
+                src_buffer_1, src_row_pointers, src_d.nnz(), M);
+        src_indices = src_buffer_2;
+        src_pointers = src_row_pointers;
+    }
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     // Empirical.
     const size_t threshold_in_kb = 1400;
@@ -372,10 +387,16 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
 
     // If not, use 0, which means all threads.
     const int nthr = data_to_process_in_kb < threshold_in_kb;
+#else
+    const int nthr = 0;
+#endif
 
+    // Rows are split between threads by the number of non-zero elements, as
+    // row lengths of sparse data are usually far from uniform.
     parallel(nthr, [&](const int ithr, const int nthr) {
         dim_t start = 0, end = 0;
-        balance211(M, nthr, ithr, start, end);
+        cpu::matmul::balance_csr_rows(
+                src_pointers, M, nthr, ithr, start, end);
         if (start >= end) return;
 
         for (dim_t m = start; m < end; m++) {
@@ -393,23 +414,6 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
             (*kernel_)(&p);
         }
     });
-#else
-
-    parallel_nd(M, [&](dim_t m) {
-        const int row_begin = src_pointers[m];
-        const int row_end = src_pointers[m + 1];
-        const int nnz = row_end - row_begin;
-
-        sparse_matmul_kernel_t::call_params_t p;
-        p.nnz = nnz;
-        p.src_values = src_values + row_begin;
-        p.src_indices = src_indices + row_begin;
-        p.wei = weights;
-        p.dst = dst + (m * N);
-        p.block_size = kernel_->block_size();
-        (*kernel_)(&p);
-    });
-#endif
     return status::success;
 }
 
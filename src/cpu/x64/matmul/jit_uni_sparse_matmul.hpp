@@ -52,11 +52,18 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
 
             const bool problem_dt_correct
                     = utils::everyone_is(f32, src_type, wei_type, dst_type)
-                    && src_d.is_sparse_desc() && !wei_d.is_sparse_desc()
-                    && utils::everyone_is(s32, src_d.metadata_type(0),
-                            src_d.metadata_type(1));
+                    && src_d.is_sparse_desc() && !wei_d.is_sparse_desc();
 
             VDISPATCH_MATMUL(problem_dt_correct, VERBOSE_UNSUPPORTED_DT_CFG);
+            // COO indices are compressed into CSR pointers before the
+            // computations, the kernel processes CSR rows only.
+            VDISPATCH_MATMUL(
+                    (src_d.encoding() == sparse_encoding::csr
+                            && utils::everyone_is(s32, src_d.metadata_type(0),
+                                    src_d.metadata_type(1)))
+                            || (src_d.encoding() == sparse_encoding::coo
+                                    && src_d.metadata_type(0) == s32),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
             VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
             VDISPATCH_MATMUL(
                     attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
@@ -64,6 +71,7 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
             VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
 
+            init_scratchpad();
             return status::success;
         }
 
@@ -75,6 +83,17 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
                                            .matches_one_of_tag(format_tag::ab);
             return is_dst_ab && is_wei_ab;
         }
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            const memory_desc_wrapper src_d(src_md());
+            if (src_d.encoding() != sparse_encoding::coo) return;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<int32_t>(
+                    key_matmul_sparse_tmp_ptr, src_d.dims()[0] + 1);
+        }
     };
 
     jit_uni_sparse_matmul_t(const pd_t *apd);
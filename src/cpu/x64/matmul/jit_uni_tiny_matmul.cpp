@@ -0,0 +1,378 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/matmul_utils.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+#include "cpu/x64/matmul/jit_uni_tiny_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace Xbyak;
+
+namespace {
+// The largest M and K, and the largest number of matrices computed at once.
+constexpr int max_dim = 16;
+constexpr int max_unroll = 8;
+
+int n_vregs(cpu_isa_t isa) {
+    return isa == avx512_core ? 32 : 16;
+}
+
+// AVX2 keeps the tail mask and a broadcast of the source in vector
+// registers, while AVX-512 uses an opmask and embedded broadcasts.
+int n_reserved_vregs(cpu_isa_t isa) {
+    return isa == avx512_core ? 0 : 2;
+}
+
+// Returns the number of matrices which fit in registers at once, with a row
+// of the weights per matrix or the rows of the shared weights.
+int get_unroll(cpu_isa_t isa, int M, int K, bool wei_in_regs) {
+    const int avail = n_vregs(isa) - n_reserved_vregs(isa);
+    const int unroll = wei_in_regs ? (avail - K) / M : avail / (M + 1);
+    return nstl::min(unroll, max_unroll);
+}
+} // namespace
+
+struct tiny_matmul_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(tiny_matmul_kernel_t);
+
+    struct call_params_t {
+        const float *src, *wei;
+        float *dst;
+        size_t nb;
+    };
+
+    tiny_matmul_kernel_t(const jit_uni_tiny_matmul_t::pd_t::conf_t &conf)
+        : jit_generator_t(jit_name()), conf_(conf) {}
+
+    void operator()(const call_params_t *p) {
+        return jit_generator_t::operator()(p);
+    }
+
+protected:
+    const jit_uni_tiny_matmul_t::pd_t::conf_t conf_;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_tiny_matmul_kernel_t : public tiny_matmul_kernel_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_tiny_matmul_kernel_t)
+
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+    static constexpr int simd_w = cpu_isa_traits_t<isa>::vlen / sizeof(float);
+
+    jit_uni_tiny_matmul_kernel_t(
+            const jit_uni_tiny_matmul_t::pd_t::conf_t &conf)
+        : tiny_matmul_kernel_t(conf) {}
+
+private:
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_src = r8;
+    Reg64 reg_wei = r9;
+    Reg64 reg_dst = r10;
+    Reg64 reg_nb = r11;
+    Reg64 reg_tmp = r12;
+
+    Opmask tail_opmask = Opmask(2);
+    Vmm tail_vmask = Vmm(0);
+    Vmm vreg_bcast = Vmm(1);
+
+    bool is_tail() const { return conf_.N < simd_w; }
+
+    // The weights rows come first, followed by the destination rows.
+    Vmm wei_reg(int u, int k) const {
+        const int idx = conf_.wei_in_regs ? k : u;
+        return Vmm(n_reserved_vregs(isa) + idx);
+    }
+    Vmm acc_reg(int u, int m) const {
+        const int nb_wei = conf_.wei_in_regs ? conf_.K : conf_.unroll;
+        return Vmm(n_reserved_vregs(isa) + nb_wei + u * conf_.M + m);
+    }
+
+    dim_t src_stride() const { return conf_.M * conf_.K; }
+    dim_t wei_stride() const {
+        return conf_.wei_broadcast ? 0 : conf_.K * conf_.N;
+    }
+    dim_t dst_stride() const { return conf_.M * conf_.N; }
+
+    void load_row(const Vmm &v, const Address &addr);
+    void store_row(const Address &addr, const Vmm &v);
+    void fma_src(const Vmm &acc, const Vmm &wei, const Address &src);
+    void prepare_tail_mask();
+
+    // Computes `n` consecutive matrices.
+    void compute(int n) {
+        const int M = conf_.M, K = conf_.K;
+        for_(int u = 0; u < n; u++)
+        for (int m = 0; m < M; m++)
+            uni_vpxor(acc_reg(u, m), acc_reg(u, m), acc_reg(u, m));
+
+        for (int k = 0; k < K; k++) {
+            if (!conf_.wei_in_regs)
+                for (int u = 0; u < n; u++)
+                    load_row(wei_reg(u, k),
+                            ptr[reg_wei
+                                    + (u * wei_stride() + k * conf_.N)
+                                            * sizeof(float)]);
+            // The matrices are interleaved, so that consecutive FMAs
+            // accumulate to different registers.
+            for_(int m = 0; m < M; m++)
+            for (int u = 0; u < n; u++)
+                fma_src(acc_reg(u, m), wei_reg(u, k),
+                        ptr[reg_src
+                                + (u * src_stride() + m * K + k)
+                                        * sizeof(float)]);
+        }
+
+        for_(int u = 0; u < n; u++)
+        for (int m = 0; m < M; m++)
+            store_row(ptr[reg_dst
+                              + (u * dst_stride() + m * conf_.N)
+                                      * sizeof(float)],
+                    acc_reg(u, m));
+
+        add(reg_src, n * src_stride() * sizeof(float));
+        if (wei_stride() != 0) add(reg_wei, n * wei_stride() * sizeof(float));
+        add(reg_dst, n * dst_stride() * sizeof(float));
+        sub(reg_nb, n);
+    }
+
+    void generate() override {
+        preamble();
+        prepare_tail_mask();
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_wei, ptr[reg_param + PARAM_OFF(wei)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_nb, ptr[reg_param + PARAM_OFF(nb)]);
+#undef PARAM_OFF
+
+        if (conf_.wei_in_regs)
+            for (int k = 0; k < conf_.K; k++)
+                load_row(wei_reg(0, k),
+                        ptr[reg_wei + k * conf_.N * sizeof(float)]);
+
+        Label unroll_loop, single_loop, end;
+        if (conf_.unroll > 1) {
+            L(unroll_loop);
+            cmp(reg_nb, conf_.unroll);
+            jl(single_loop, T_NEAR);
+            compute(conf_.unroll);
+            jmp(unroll_loop, T_NEAR);
+        }
+
+        L(single_loop);
+        cmp(reg_nb, 0);
+        jle(end, T_NEAR);
+        compute(1);
+        jmp(single_loop, T_NEAR);
+
+        L(end);
+        postamble();
+    }
+};
+
+template <>
+void jit_uni_tiny_matmul_kernel_t<avx512_core>::prepare_tail_mask() {
+    if (!is_tail()) return;
+    mov(reg_tmp.cvt32(), (1 << conf_.N) - 1);
+    kmovw(tail_opmask, reg_tmp.cvt32());
+}
+
+template <>
+void jit_uni_tiny_matmul_kernel_t<avx2>::prepare_tail_mask() {
+    if (!is_tail()) return;
+    static const uint32_t mask_f32[] = {0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0, 0, 0, 0, 0, 0,
+            0};
+    mov(reg_tmp, reinterpret_cast<size_t>(&mask_f32[7 - conf_.N]));
+    vmovups(tail_vmask, ptr[reg_tmp]);
+}
+
+template <>
+void jit_uni_tiny_matmul_kernel_t<avx512_core>::load_row(
+        const Vmm &v, const Address &addr) {
+    if (is_tail())
+        uni_vmovups_tail(v, tail_opmask, addr);
+    else
+        uni_vmovups(v, addr);
+}
+
+template <>
+void jit_uni_tiny_matmul_kernel_t<avx2>::load_row(
+        const Vmm &v, const Address &addr) {
+    if (is_tail())
+        uni_vmovups_tail(v, tail_vmask, addr);
+    else
+        uni_vmovups(v, addr);
+}
+
+template <>
+void jit_uni_tiny_matmul_kernel_t<avx512_core>::store_row(
+        const Address &addr, const Vmm &v) {
+    if (is_tail())
+        uni_vmovups_tail(addr, tail_opmask, v);
+    else
+        uni_vmovups(addr, v);
+}
+
+template <>
+void jit_uni_tiny_matmul_kernel_t<avx2>::store_row(
+        const Address &addr, const Vmm &v) {
+    if (is_tail())
+        uni_vmovups_tail(addr, tail_vmask, v);
+    else
+        uni_vmovups(addr, v);
+}
+
+template <>
+void jit_uni_tiny_matmul_kernel_t<avx512_core>::fma_src(
+        const Vmm &acc, const Vmm &wei, const Address &src) {
+    vfmadd231ps(acc, wei, zword_b[src.getRegExp()]);
+}
+
+template <>
+void jit_uni_tiny_matmul_kernel_t<avx2>::fma_src(
+        const Vmm &acc, const Vmm &wei, const Address &src) {
+    vbroadcastss(vreg_bcast, src);
+    vfmadd231ps(acc, wei, vreg_bcast);
+}
+
+status_t jit_uni_tiny_matmul_t::pd_t::init(engine_t *engine) {
+    VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(
+            utils::everyone_is(f32, src_md()->data_type,
+                    weights_md()->data_type, dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(!with_reduce(), VERBOSE_UNSUPPORTED_FEATURE, "reduce");
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(batched(), VERBOSE_BAD_NDIMS, "dst", ndims());
+    VDISPATCH_MATMUL(!has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+    const cpu::matmul::matmul_helper_t helper(src_md(), weights_md(), dst_md());
+    conf_.isa = mayiuse(avx512_core) ? avx512_core : avx2;
+    conf_.M = (int)helper.M();
+    conf_.N = (int)helper.N();
+    conf_.K = (int)helper.K();
+    conf_.batch = helper.batch();
+
+    const int simd_w = conf_.isa == avx512_core ? 16 : 8;
+    VDISPATCH_MATMUL(conf_.M <= max_dim && conf_.K <= max_dim
+                    && conf_.N <= simd_w,
+            VERBOSE_SHAPE_RESTRICTION);
+    // The source is not broadcast, and the weights are either not broadcast
+    // or shared by the whole batch.
+    VDISPATCH_MATMUL(helper.src_batch() == conf_.batch,
+            VERBOSE_UNSUPPORTED_FEATURE, "source broadcast");
+    conf_.wei_broadcast = helper.wei_batch() == 1 && conf_.batch > 1;
+    VDISPATCH_MATMUL(conf_.wei_broadcast || helper.wei_batch() == conf_.batch,
+            VERBOSE_UNSUPPORTED_FEATURE, "partial weights broadcast");
+
+    conf_.wei_in_regs = conf_.wei_broadcast
+            && get_unroll(conf_.isa, conf_.M, conf_.K, true) >= 1;
+    conf_.unroll = get_unroll(conf_.isa, conf_.M, conf_.K, conf_.wei_in_regs);
+    VDISPATCH_MATMUL(conf_.unroll >= 1, VERBOSE_SHAPE_RESTRICTION);
+
+    return status::success;
+}
+
+bool jit_uni_tiny_matmul_t::pd_t::formats_ok() const {
+    using namespace format_tag;
+    // Row-major matrices with no padding, and the batch dimensions outside.
+    const format_tag_t plain_tag
+            = utils::pick(ndims() - 3, abc, abcd, abcde, abcdef);
+    return memory_desc_wrapper(src_md()).matches_tag(plain_tag)
+            && memory_desc_wrapper(weights_md()).matches_tag(plain_tag)
+            && memory_desc_wrapper(dst_md()).matches_tag(plain_tag);
+}
+
+jit_uni_tiny_matmul_t::jit_uni_tiny_matmul_t(const pd_t *apd)
+    : primitive_t(apd) {}
+jit_uni_tiny_matmul_t::~jit_uni_tiny_matmul_t() = default;
+
+status_t jit_uni_tiny_matmul_t::init(engine_t *engine) {
+    const auto &conf = pd()->conf();
+    if (conf.isa == avx512_core) {
+        using kernel_t = jit_uni_tiny_matmul_kernel_t<avx512_core>;
+        kernel_ = std::unique_ptr<kernel_t> {new kernel_t(conf)};
+    } else {
+        using kernel_t = jit_uni_tiny_matmul_kernel_t<avx2>;
+        kernel_ = std::unique_ptr<kernel_t> {new kernel_t(conf)};
+    }
+    return kernel_->create_kernel();
+}
+
+status_t jit_uni_tiny_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto *wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto *dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    src += src_d.off_l(0);
+    wei += wei_d.off_l(0);
+    dst += dst_d.off_l(0);
+
+    const auto &conf = pd()->conf();
+    const dim_t src_stride = conf.M * conf.K;
+    const dim_t wei_stride = conf.wei_broadcast ? 0 : conf.K * conf.N;
+    const dim_t dst_stride = conf.M * conf.N;
+
+    // A thread takes at least this many matrices, as a matrix is too small
+    // to be worth the threading overhead.
+    const dim_t min_batch_per_thread = 512;
+    const int nthr = (int)nstl::min<dim_t>(dnnl_get_max_threads(),
+            utils::div_up(conf.batch, min_batch_per_thread));
+
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(conf.batch, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        tiny_matmul_kernel_t::call_params_t p;
+        p.src = src + start * src_stride;
+        p.wei = wei + start * wei_stride;
+        p.dst = dst + start * dst_stride;
+        p.nb = (size_t)(end - start);
+        (*kernel_)(&p);
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
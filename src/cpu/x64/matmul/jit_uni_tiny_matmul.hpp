@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_JIT_UNI_TINY_MATMUL_HPP
+#define CPU_X64_MATMUL_JIT_UNI_TINY_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+struct tiny_matmul_kernel_t;
+
+// Batched f32 matmul of tiny matrices, such as 4x4 to 16x16 mixing per token
+// or transforms of 3D points, with batches of up to millions of matrices.
+// A thread makes a single kernel call for its range of the batch, and the
+// kernel computes several matrices at once with all their rows of the
+// destination in registers, so that the independent chains of FMAs of the
+// matrices hide the latency of each other. The weights shared by the batch
+// are kept in registers when they fit.
+struct jit_uni_tiny_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("jit:tiny", jit_uni_tiny_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // The kernel parameters, which are derived from the problem.
+        struct conf_t {
+            cpu_isa_t isa;
+            int M, N, K;
+            dim_t batch;
+            // The weights are the same for the whole batch.
+            bool wei_broadcast;
+            // The rows of the shared weights are loaded once per call.
+            bool wei_in_regs;
+            // The matrices computed at once by the main loop of the kernel.
+            int unroll;
+        };
+
+        const conf_t &conf() const { return conf_; }
+
+    private:
+        conf_t conf_ = {};
+
+        bool formats_ok() const;
+    };
+
+    jit_uni_tiny_matmul_t(const pd_t *apd);
+    ~jit_uni_tiny_matmul_t() override;
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<tiny_matmul_kernel_t> kernel_;
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+#endif
@@ -49,11 +49,11 @@ status_t create_matmul_pd(std::shared_ptr<primitive_desc_t> &matmul_pd,
         engine_t *engine, const memory_desc_t *src_md,
         const memory_desc_t *wei_md, const memory_desc_t *dst_md,
         const memory_desc_t *bia_md, const memory_desc_t *reduce_md,
-        const primitive_attr_t *attr) {
+        const primitive_attr_t *attr, matmul_reduce_kind_t reduce_kind) {
     auto matmul_desc = matmul_desc_t();
 
     CHECK(matmul_desc_init(&matmul_desc, src_md, wei_md, bia_md, dst_md,
-            reduce_md, matmul_reduce_kind::src));
+            reduce_md, reduce_kind));
 
     primitive_desc_iterator_t it(
             engine, (op_desc_t *)&matmul_desc, attr, nullptr);
@@ -124,6 +124,33 @@ status_t set_training_formats(memory_desc_t *src_md, memory_desc_t *wei_md,
             : status::unimplemented;
 }
 
+status_t matmul_inner_product_bwd_weights_t::pd_t::set_formats() {
+    using namespace format_tag;
+
+    const memory_desc_wrapper diff_wei_d(diff_weights_md_);
+    transposed_ = src_md_.ndims == 2 && !diff_wei_d.format_any()
+            && diff_wei_d.matches_tag(ba);
+    if (!transposed_)
+        return set_training_formats(
+                &src_md_, &diff_weights_md_, &diff_bias_md_, &diff_dst_md_);
+
+    if (src_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(src_md_, ab));
+    if (diff_dst_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(diff_dst_md_, ab));
+    if (diff_bias_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(diff_bias_md_, x));
+
+    const memory_desc_wrapper src_d(src_md_);
+    const memory_desc_wrapper diff_dst_d(diff_dst_md_);
+    const memory_desc_wrapper diff_bias_d(diff_bias_md_);
+    const bool ok = src_d.matches_tag(ab) && diff_dst_d.matches_tag(ab)
+            && IMPLICATION(!diff_bias_d.is_zero(), diff_bias_d.matches_tag(x))
+            && src_d.is_dense() && diff_wei_d.is_dense()
+            && diff_dst_d.is_dense();
+    return ok ? status::success : status::unimplemented;
+}
+
 int matmul_inner_product_fwd_t::pd_t::get_k_blk(format_tag_t tag) const {
     using namespace format_tag;
     switch (tag) {
@@ -352,17 +379,29 @@ status_t matmul_inner_product_bwd_weights_t::pd_t::init_matmul_params(
     memory_desc_t mm_wei_md {};
     memory_desc_t mm_dst_md {};
 
-    CHECK(init_matmul_md(mm_src_md, *diff_dst_md(), format_tag::ba, true));
-    CHECK(init_matmul_md(mm_wei_md, *src_md(), format_tag::ab));
-    CHECK(init_matmul_md(mm_dst_md, *diff_weights_md(), format_tag::ab));
+    // The diff bias is the sum of diff_dst over the minibatch, which is the
+    // reduction dimension of the product, so the matmul reduces the operand
+    // holding diff_dst: diff_dst^T * src computes OI diff weights and reduces
+    // its source, and src^T * diff_dst computes IO diff weights and reduces
+    // its weights.
+    if (transposed_) {
+        CHECK(init_matmul_md(mm_src_md, *src_md(), format_tag::ba, true));
+        CHECK(init_matmul_md(mm_wei_md, *diff_dst_md(), format_tag::ab));
+        CHECK(init_matmul_md(
+                mm_dst_md, *diff_weights_md(), format_tag::ab, true));
+    } else {
+        CHECK(init_matmul_md(mm_src_md, *diff_dst_md(), format_tag::ba, true));
+        CHECK(init_matmul_md(mm_wei_md, *src_md(), format_tag::ab));
+        CHECK(init_matmul_md(mm_dst_md, *diff_weights_md(), format_tag::ab));
+    }
 
     memory_desc_t reduce_md {};
 
     if (with_bias()) {
         const memory_desc_t &diff_bias_md = *diff_weights_md(1);
         dims_t reduce_dims {};
-        reduce_dims[0] = diff_bias_md.dims[0];
-        reduce_dims[1] = 1;
+        reduce_dims[0] = transposed_ ? 1 : diff_bias_md.dims[0];
+        reduce_dims[1] = transposed_ ? diff_bias_md.dims[0] : 1;
 
         CHECK(memory_desc_reshape(reduce_md, diff_bias_md, 2, reduce_dims));
     }
@@ -370,7 +409,9 @@ status_t matmul_inner_product_bwd_weights_t::pd_t::init_matmul_params(
     VDISPATCH_INNER_PRODUCT_SC(
             create_matmul_pd(matmul_pd_, engine, &mm_src_md, &mm_wei_md,
                     &mm_dst_md, nullptr, with_bias() ? &reduce_md : nullptr,
-                    attr()),
+                    attr(),
+                    transposed_ ? matmul_reduce_kind::weights
+                                : matmul_reduce_kind::src),
             VERBOSE_PRIMITIVE_CREATION_FAIL, "matmul");
 
     return status::success;
@@ -408,9 +449,12 @@ status_t matmul_inner_product_bwd_weights_t::execute(
         const exec_ctx_t &ctx) const {
     using namespace memory_tracking::names;
 
+    const bool transposed = pd()->transposed_;
     exec_args_t matmul_args;
-    matmul_args[DNNL_ARG_SRC] = ctx.args().at(DNNL_ARG_DIFF_DST);
-    matmul_args[DNNL_ARG_WEIGHTS] = ctx.args().at(DNNL_ARG_SRC);
+    matmul_args[DNNL_ARG_SRC]
+            = ctx.args().at(transposed ? DNNL_ARG_SRC : DNNL_ARG_DIFF_DST);
+    matmul_args[DNNL_ARG_WEIGHTS]
+            = ctx.args().at(transposed ? DNNL_ARG_DIFF_DST : DNNL_ARG_SRC);
     matmul_args[DNNL_ARG_DST] = ctx.args().at(DNNL_ARG_DIFF_WEIGHTS);
 
     if (pd()->with_bias())
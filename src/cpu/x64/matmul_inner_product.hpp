@@ -35,7 +35,8 @@ namespace x64 {
 status_t create_matmul_pd(std::shared_ptr<primitive_desc_t> &matmul_pd,
         engine_t *engine, const memory_desc_t *a_md, const memory_desc_t *b_md,
         const memory_desc_t *c_md, const memory_desc_t *ip_bia_md,
-        const memory_desc_t *reduce_md, const primitive_attr_t *attr);
+        const memory_desc_t *reduce_md, const primitive_attr_t *attr,
+        matmul_reduce_kind_t reduce_kind = matmul_reduce_kind::src);
 
 status_t init_matmul_md(memory_desc_t &mm_md, const memory_desc_t &ip_md,
         format_tag_t tag, bool swap_dims = false);
@@ -239,13 +240,13 @@ struct matmul_inner_product_bwd_weights_t : public primitive_t {
         }
 
         std::shared_ptr<primitive_desc_t> matmul_pd_;
+        // Whether the 2D diff weights are IC-major, which makes them the
+        // destination of the product of the transposed source and diff_dst.
+        bool transposed_ = false;
 
     private:
         status_t init_matmul_params(engine_t *engine);
-        status_t set_formats() {
-            return set_training_formats(
-                    &src_md_, &diff_weights_md_, &diff_bias_md_, &diff_dst_md_);
-        }
+        status_t set_formats();
 
         void init_scratchpad() {
             auto scratchpad = scratchpad_registry().registrar();
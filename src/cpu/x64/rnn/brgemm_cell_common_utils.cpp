@@ -32,7 +32,7 @@ void amx_tile_configuration_loader_t::operator()(
 }
 
 amx_tile_configuration_loader_t::~amx_tile_configuration_loader_t() {
-    if (current_cfg_addr) { amx_tile_release(); }
+    if (current_cfg_addr) { amx_tile_lazy_release(); }
 }
 
 } // namespace x64
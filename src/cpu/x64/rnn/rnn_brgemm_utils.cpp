@@ -574,8 +574,8 @@ status_t rnn_brgemm_t<prop_kind::forward>::configure_brgemm(
 
 status_t init_brgemm_kernel(x64::brgemm_desc_t *desc, x64::cpu_isa_t isa,
         impl::data_type_t src_type, impl::data_type_t weights_type,
-        std::unique_ptr<x64::brgemm_kernel_t> &ker, dim_t M, dim_t N, dim_t K,
-        dim_t LDA, dim_t LDB, dim_t LDC, float beta, dim_t max_bs,
+        brgemm_ker_ptr_t &ker, dim_t M, dim_t N, dim_t K, dim_t LDA, dim_t LDB,
+        dim_t LDC, float beta, dim_t max_bs,
         dim_t hint_expected_A_size = LLONG_MAX,
         dim_t hint_expected_B_size = LLONG_MAX,
         dim_t hint_expected_C_size = LLONG_MAX) {
@@ -597,9 +597,7 @@ status_t init_brgemm_kernel(x64::brgemm_desc_t *desc, x64::cpu_isa_t isa,
     CHECK(brgemm_desc_set_attr(desc, brgattr));
     CHECK(brgemm_desc_finalize(desc));
 
-    x64::brgemm_kernel_t *_t_ptr;
-    CHECK(brgemm_kernel_create(&_t_ptr, *desc));
-    CHECK(safe_ptr_assign<x64::brgemm_kernel_t>(ker, _t_ptr));
+    CHECK(brgemm_containers::get_shared_kernel(*desc, ker));
 
     return status::success;
 };
@@ -632,9 +630,9 @@ status_t rnn_brgemm_t<prop_kind::forward>::init_kernels(
 
     const auto init_brgemm
             = [&](x64::brgemm_desc_t *desc, x64::cpu_isa_t isa,
-                      std::unique_ptr<x64::brgemm_kernel_t> &ker, dim_t M,
-                      dim_t N, dim_t K, dim_t LDA, dim_t LDB, dim_t LDC,
-                      float beta, dim_t max_bs) {
+                      brgemm_ker_ptr_t &ker, dim_t M, dim_t N, dim_t K,
+                      dim_t LDA, dim_t LDB, dim_t LDC, float beta,
+                      dim_t max_bs) {
                   return init_brgemm_kernel(desc, isa, src_type, weights_type,
                           ker, M, N, K, LDA, LDB, LDC, beta, max_bs);
               };
@@ -1129,9 +1127,9 @@ static status_t init_kernels_diff_src(rnn_diff_src_brgemm_t &diff_src,
 
     const auto init_brgemm_diff_src
             = [&](x64::brgemm_desc_t *desc, x64::cpu_isa_t isa,
-                      std::unique_ptr<x64::brgemm_kernel_t> &ker, dim_t M,
-                      dim_t N, dim_t K, dim_t LDA, dim_t LDB, dim_t LDC,
-                      float beta, dim_t max_bs) {
+                      brgemm_ker_ptr_t &ker, dim_t M, dim_t N, dim_t K,
+                      dim_t LDA, dim_t LDB, dim_t LDC, float beta,
+                      dim_t max_bs) {
                   const dim_t A_size
                           = rnn.diff_src_brgemm.M * rnn.diff_src_brgemm.Kpadded;
                   const dim_t B_size
@@ -1254,9 +1252,9 @@ static status_t init_kernels_diff_wei(rnn_diff_wei_brgemm_t &diff_wei,
 
     const auto init_brgemm_diff_wei
             = [&](x64::brgemm_desc_t *desc, x64::cpu_isa_t isa,
-                      std::unique_ptr<x64::brgemm_kernel_t> &ker, dim_t M,
-                      dim_t N, dim_t K, dim_t LDA, dim_t LDB, dim_t LDC,
-                      float beta, dim_t max_bs) {
+                      brgemm_ker_ptr_t &ker, dim_t M, dim_t N, dim_t K,
+                      dim_t LDA, dim_t LDB, dim_t LDC, float beta,
+                      dim_t max_bs) {
                   const dim_t A_size
                           = rnn.diff_wei_brgemm.M * rnn.diff_wei_brgemm.Kpadded;
                   const dim_t B_size
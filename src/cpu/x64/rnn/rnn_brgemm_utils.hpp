@@ -21,6 +21,7 @@
 #include "common/c_types_map.hpp"
 #include "common/memory_tracking.hpp"
 #include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
 #include "cpu/x64/jit_brgemm_transpose_utils.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_copy_utils.hpp"
 #include "cpu/x64/rnn/jit_brgemm_transpose_single_row.hpp"
@@ -41,7 +42,7 @@ struct jit_brgemm_trans_src_t;
 
 namespace rnn_brgemm_utils {
 
-using brgemm_ker_ptr_t = std::unique_ptr<brgemm_kernel_t>;
+using brgemm_ker_ptr_t = std::shared_ptr<brgemm_kernel_t>;
 using brgemm_pallete_t = char[64];
 using srcatch_gates_reorder_ker_ptr_t
         = std::unique_ptr<matmul::jit_brgemm_matmul_copy_b_t>;
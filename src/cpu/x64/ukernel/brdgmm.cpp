@@ -0,0 +1,331 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/memory_desc_wrapper.hpp"
+#include "common/verbose.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+
+#include "cpu/x64/ukernel/brdgmm.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+using namespace dnnl::impl::cpu::ukernel;
+
+#define VCHECK_BRDGMM(cond, msg, ...) \
+    VCONDCHECK(ukernel, create, check, brdgmm, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__)
+
+#define VCHECK_BRDGMM_STATUS(status, cond, msg, ...) \
+    VCONDCHECK(ukernel, create, check, brdgmm, (cond), (status), msg, \
+            ##__VA_ARGS__)
+
+dnnl_brdgmm::~dnnl_brdgmm() {
+    brgemm_kernel_destroy(brgemm_kernel_);
+}
+
+status_t brdgmm_t::set_post_ops(
+        dim_t ldd, data_type_t d_dt, const post_ops_t *post_ops) {
+    ldd_ = ldd;
+    d_dt_ = d_dt;
+    CHECK(attr_.set_post_ops(*post_ops));
+    return status::success;
+}
+
+status_t brdgmm_t::set_scales(int mask, int arg) {
+    if (mask < 0) return status::invalid_arguments;
+    CHECK(attr_.scales_.set(arg, mask));
+    return status::success;
+}
+
+status_t brdgmm_t::set_batch_strides(dim_t stride_A, dim_t stride_B) {
+    if (stride_A < 0 || stride_B < 0) return status::invalid_arguments;
+    use_batch_strides_ = true;
+    stride_A_ = stride_A;
+    stride_B_ = stride_B;
+    return status::success;
+}
+
+status_t brdgmm_t::finalize() {
+    brgemm_batch_kind_t batch_kind = use_batch_strides_
+            ? brgemm_batch_kind_t::brgemm_strd
+            : brgemm_batch_kind_t::brgemm_offs;
+    brgemm_strides_t batch_strides {stride_A_, stride_B_};
+
+    auto status = brdgmm_desc_init(&brgemm_desc_, cpu_isa_t::isa_undef,
+            batch_kind, a_dt_, b_dt_, /* transA = */ false, brgemm_row_major,
+            /* alpha = */ 1.f, /* beta = */ 0.f, lda_, ldc_, M_, N_,
+            use_batch_strides_ ? &batch_strides : nullptr);
+    if (status != status::success) {
+        VCHECK_BRDGMM_STATUS(status, false, "brdgmm_desc_init failed");
+    }
+    if (brgemm_desc_.isa_impl == cpu_isa_t::isa_undef) {
+        VCHECK_BRDGMM_STATUS(status::unimplemented, false,
+                "no isa is available for the data types");
+    }
+
+    // Note: API can't take a compensation buffer externally, and the kernel
+    // would shift the values of tensor A without it.
+    VCHECK_BRDGMM_STATUS(status::unimplemented,
+            !brgemm_desc_.req_s8s8_compensation,
+            "s8 tensor A requires compensation on this isa");
+
+    // The accumulation data type is defined by the kernel.
+    VCHECK_BRDGMM(c_dt_ == brgemm_desc_.dt_c, "unsupported tensor C data type");
+
+    memory_desc_t D_md;
+    dims_t dims {M_, N_};
+    dims_t strides {ldd_, 1};
+    status = memory_desc_init_by_strides(
+            D_md, /* ndims = */ 2, dims, d_dt_, strides);
+    if (status != status::success) {
+        VCHECK_BRDGMM_STATUS(status, false, "D_md creation failed");
+    }
+
+    status = brgemm_desc_set_postops(
+            &brgemm_desc_, &attr_, &D_md, ldd_, data_type::undef);
+    if (status != status::success) {
+        VCHECK_BRDGMM_STATUS(status, false, "brgemm_desc_set_postops failed");
+    }
+
+    brgemm_attr_t brgemm_attr;
+    brgemm_attr.max_bs = batch_size_;
+    status = brgemm_desc_set_attr(&brgemm_desc_, brgemm_attr);
+    if (status != status::success) {
+        VCHECK_BRDGMM_STATUS(status, false, "brgemm_desc_set_attr failed");
+    }
+
+    status = brgemm_desc_finalize(&brgemm_desc_);
+    if (status != status::success) {
+        VCHECK_BRDGMM_STATUS(status, false, "brgemm_desc_finalize failed");
+    }
+
+    return status::success;
+}
+
+status_t brdgmm_t::generate() {
+    // Re-generation won't take any effect.
+    if (brgemm_kernel_ != nullptr) return status::success;
+
+    auto status = brgemm_kernel_create(&brgemm_kernel_, brgemm_desc_);
+    VCHECK_BRDGMM_STATUS(
+            status, status == status::success, "brgemm_kernel_create failed");
+
+    // Generate a verbose info string at the point where configuration is done.
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
+        create_verbose_info();
+    }
+    return status::success;
+}
+
+status_t brdgmm_t::execute(const void *A_ptr, const void *B_ptr,
+        const dim_t *A_B_offsets, void *D_ptr,
+        const attr_params_t *attr_params) const {
+    if (brgemm_kernel_ == nullptr) return status::invalid_arguments;
+
+    const auto batch_size = brgemm_desc_.brgattr.max_bs;
+    std::vector<brgemm_batch_element_t> v_batch_element;
+    // The kernel walks the batch with the strides by itself.
+    if (!use_batch_strides_) {
+        if (A_B_offsets == nullptr) return status::invalid_arguments;
+        v_batch_element.resize(batch_size);
+        for (int i = 0; i < batch_size; i++) {
+            v_batch_element[i].offset.A = A_B_offsets[2 * i];
+            v_batch_element[i].offset.B = A_B_offsets[2 * i + 1];
+        }
+    }
+
+    const bool with_binary = attr_.post_ops_.find(primitive_kind::binary) != -1;
+    const bool with_scales = !attr_.scales_.has_default_values();
+    if ((with_binary || with_scales) && attr_params == nullptr)
+        return status::invalid_arguments;
+
+    brgemm_post_ops_data_t post_ops_data;
+    // Note: this member is used to compute an offset from the base DST address.
+    post_ops_data.data_C_ptr_ = reinterpret_cast<const char *>(D_ptr);
+    if (attr_params)
+        post_ops_data.binary_post_ops_rhs = attr_params->get_post_ops_args();
+
+    if (!attr_.scales_.has_default_values(DNNL_ARG_SRC)) {
+        const void *src_scales_ptr = attr_params->get_scales(DNNL_ARG_SRC);
+        if (src_scales_ptr == nullptr) return status::invalid_arguments;
+        post_ops_data.src_scales = src_scales_ptr;
+    }
+    if (!attr_.scales_.has_default_values(DNNL_ARG_WEIGHTS)) {
+        const void *wei_scales_ptr = attr_params->get_scales(DNNL_ARG_WEIGHTS);
+        if (wei_scales_ptr == nullptr) return status::invalid_arguments;
+        post_ops_data.wei_scales = wei_scales_ptr;
+    }
+    float dst_scale_inv = 0.f;
+    if (!attr_.scales_.has_default_values(DNNL_ARG_DST)) {
+        const void *dst_scales_ptr = attr_params->get_scales(DNNL_ARG_DST);
+        if (dst_scales_ptr == nullptr) return status::invalid_arguments;
+
+        dst_scale_inv = 1.f / static_cast<const float *>(dst_scales_ptr)[0];
+        post_ops_data.dst_scales = &dst_scale_inv;
+    }
+
+    // The kernel keeps the accumulators in registers for the whole batch and
+    // stores either C or D, so both are the user output.
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
+        double start_ms = get_msec();
+        brgemm_kernel_execute_postops(brgemm_kernel_, batch_size, A_ptr, B_ptr,
+                v_batch_element.data(), D_ptr, D_ptr, post_ops_data,
+                /* scratch = */ nullptr, /* dynamic_values = */ nullptr);
+        double duration_ms = get_msec() - start_ms;
+
+        stringstream_t ss;
+        ss << "cpu,brdgmm,,undef," << verbose_info_;
+        VPROF(start_ms, ukernel, exec, VERBOSE_profile, ss.str().c_str(),
+                duration_ms);
+    } else {
+        brgemm_kernel_execute_postops(brgemm_kernel_, batch_size, A_ptr, B_ptr,
+                v_batch_element.data(), D_ptr, D_ptr, post_ops_data,
+                /* scratch = */ nullptr, /* dynamic_values = */ nullptr);
+    }
+    return status::success;
+}
+
+status_t brdgmm_t::create_verbose_info() {
+#if defined(DISABLE_VERBOSE)
+    return status::success;
+#endif
+
+    const auto &d = brgemm_desc_;
+    stringstream_t ss;
+
+    memory_desc_t src_md;
+    const dims_t src_dims = {M_, N_};
+    const dims_t src_strides = {lda_, 1};
+    CHECK(memory_desc_init_by_strides(src_md, 2, src_dims, a_dt_, src_strides));
+
+    memory_desc_t wei_md;
+    const dims_t wei_dims = {N_};
+    CHECK(memory_desc_init_by_strides(wei_md, 1, wei_dims, b_dt_, nullptr));
+
+    memory_desc_t dst_md;
+    const dims_t dst_dims = {M_, N_};
+    const dims_t dst_strides = {ldd_, 1};
+    CHECK(memory_desc_init_by_strides(dst_md, 2, dst_dims, d_dt_, dst_strides));
+
+    ss << md2fmt_str("src", &src_md, format_kind::undef) << " ";
+    ss << md2fmt_str("wei", &wei_md, format_kind::undef) << " ";
+    ss << md2fmt_str("dst", &dst_md, format_kind::undef);
+    ss << "," << attr2str(&attr_) << ",";
+    ss << "bs:" << d.brgattr.max_bs;
+    if (use_batch_strides_)
+        ss << " strides:" << stride_A_ << ":" << stride_B_;
+    ss << "," << md2dim_str(&src_md) << ":" << md2dim_str(&wei_md);
+
+    verbose_info_ = ss.str();
+    return status::success;
+}
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace ukernel {
+
+status_t dnnl_brdgmm_create(brdgmm_t **brdgmm, dim_t M, dim_t N,
+        dim_t batch_size, dim_t lda, dim_t ldc, data_type_t a_dt,
+        data_type_t b_dt, data_type_t c_dt) {
+    if (batch_size <= 0) {
+        VCHECK_BRDGMM_STATUS(
+                status::invalid_arguments, false, "batch size is non-positive");
+    }
+
+    *brdgmm = new brdgmm_t(M, N, batch_size, lda, ldc, a_dt, b_dt, c_dt);
+    return status::success;
+}
+
+status_t dnnl_brdgmm_set_post_ops(brdgmm_t *brdgmm, dim_t ldd, data_type_t d_dt,
+        const post_ops_t *post_ops) {
+    if (brdgmm == nullptr || post_ops == nullptr)
+        return status::invalid_arguments;
+
+    CHECK(brdgmm->set_post_ops(ldd, d_dt, post_ops));
+    return status::success;
+}
+
+status_t dnnl_brdgmm_set_A_scales(brdgmm_t *brdgmm, int a_scale_mask) {
+    if (brdgmm == nullptr) return status::invalid_arguments;
+
+    CHECK(brdgmm->set_scales(a_scale_mask, DNNL_ARG_SRC));
+    return status::success;
+}
+
+status_t dnnl_brdgmm_set_B_scales(brdgmm_t *brdgmm, int b_scale_mask) {
+    if (brdgmm == nullptr) return status::invalid_arguments;
+
+    CHECK(brdgmm->set_scales(b_scale_mask, DNNL_ARG_WEIGHTS));
+    return status::success;
+}
+
+status_t dnnl_brdgmm_set_D_scales(brdgmm_t *brdgmm, int d_scale_mask) {
+    if (brdgmm == nullptr) return status::invalid_arguments;
+
+    CHECK(brdgmm->set_scales(d_scale_mask, DNNL_ARG_DST));
+    return status::success;
+}
+
+status_t dnnl_brdgmm_set_batch_strides(
+        brdgmm_t *brdgmm, dim_t stride_A, dim_t stride_B) {
+    if (brdgmm == nullptr) return status::invalid_arguments;
+
+    CHECK(brdgmm->set_batch_strides(stride_A, stride_B));
+    return status::success;
+}
+
+status_t dnnl_brdgmm_finalize(brdgmm_t *brdgmm) {
+    if (brdgmm == nullptr) return status::invalid_arguments;
+
+    CHECK(brdgmm->finalize());
+    return status::success;
+}
+
+status_t dnnl_brdgmm_generate(brdgmm_t *brdgmm) {
+    if (brdgmm == nullptr) return status::invalid_arguments;
+
+    CHECK(brdgmm->generate());
+    return status::success;
+}
+
+status_t dnnl_brdgmm_execute(const brdgmm_t *brdgmm, const void *A_ptr,
+        const void *B_ptr, const dim_t *A_B_offsets, void *D_ptr,
+        const attr_params_t *attr_params) {
+    if (brdgmm == nullptr) return status::invalid_arguments;
+
+    CHECK(brdgmm->execute(A_ptr, B_ptr, A_B_offsets, D_ptr, attr_params));
+    return status::success;
+}
+
+status_t dnnl_brdgmm_destroy(brdgmm_t *brdgmm) {
+    delete brdgmm;
+    return status::success;
+}
+
+} // namespace ukernel
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,131 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_UKERNEL_BRDGMM_HPP
+#define CPU_X64_UKERNEL_BRDGMM_HPP
+
+#include <string>
+#include <vector>
+
+#include "cpu/ukernel/c_types_map.hpp"
+
+#include "cpu/x64/brgemm/brgemm_types.hpp"
+
+#include "cpu/x64/ukernel/attr_params.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+struct dnnl_brdgmm : public dnnl::impl::c_compatible {
+    dnnl_brdgmm(dnnl::impl::dim_t M, dnnl::impl::dim_t N,
+            dnnl::impl::dim_t batch_size, dnnl::impl::dim_t lda,
+            dnnl::impl::dim_t ldc, dnnl::impl::data_type_t a_dt,
+            dnnl::impl::data_type_t b_dt, dnnl::impl::data_type_t c_dt)
+        : M_(M)
+        , N_(N)
+        , batch_size_(batch_size)
+        , lda_(lda)
+        , ldc_(ldc)
+        , ldd_(ldc) // User may overwrite with set_post_ops().
+        , a_dt_(a_dt)
+        , b_dt_(b_dt)
+        , c_dt_(c_dt)
+        , d_dt_(c_dt) // User may overwrite with set_post_ops().
+        , brgemm_kernel_(nullptr) {}
+
+    ~dnnl_brdgmm();
+
+    dnnl::impl::status_t set_post_ops(dnnl::impl::dim_t ldd,
+            dnnl::impl::data_type_t d_dt,
+            const dnnl::impl::post_ops_t *post_ops);
+
+    dnnl::impl::status_t set_scales(int mask, int arg);
+
+    dnnl::impl::status_t set_batch_strides(
+            dnnl::impl::dim_t stride_A, dnnl::impl::dim_t stride_B);
+
+    dnnl::impl::status_t finalize();
+
+    dnnl::impl::status_t generate();
+
+    dnnl::impl::status_t execute(const void *A_ptr, const void *B_ptr,
+            const dnnl::impl::dim_t *A_B_offsets, void *D_ptr,
+            const dnnl::impl::cpu::ukernel::attr_params_t *attr_params) const;
+
+private:
+    // User's inputs.
+    dnnl::impl::dim_t M_, N_, batch_size_;
+    dnnl::impl::dim_t lda_, ldc_, ldd_;
+    dnnl::impl::data_type_t a_dt_, b_dt_, c_dt_, d_dt_;
+    // Strides in bytes between the tensors of consecutive batches. When set,
+    // the kernel walks the batch by itself and no offsets are passed.
+    bool use_batch_strides_ = false;
+    dnnl::impl::dim_t stride_A_ = 0, stride_B_ = 0;
+    // A copy of attributes to avoid dependency on user's attributes lifetime.
+    dnnl::impl::primitive_attr_t attr_;
+
+    // A main kernel.
+    dnnl::impl::cpu::x64::brgemm_desc_t brgemm_desc_;
+    dnnl::impl::cpu::x64::brgemm_kernel_t *brgemm_kernel_;
+
+    // Creates a `verbose_info_` string once during `generate()` call, and calls
+    // it during execute(). This is done to avoid string re-creation.
+    dnnl::impl::status_t create_verbose_info();
+    std::string verbose_info_;
+};
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace ukernel {
+
+status_t dnnl_brdgmm_create(dnnl_brdgmm **brdgmm, dim_t M, dim_t N,
+        dim_t batch_size, dim_t lda, dim_t ldc, data_type_t a_dt,
+        data_type_t b_dt, data_type_t c_dt);
+
+status_t dnnl_brdgmm_set_post_ops(dnnl_brdgmm *brdgmm, dim_t ldd,
+        data_type_t d_dt, const post_ops_t *post_ops);
+
+status_t dnnl_brdgmm_set_A_scales(dnnl_brdgmm *brdgmm, int a_scale_mask);
+
+status_t dnnl_brdgmm_set_B_scales(dnnl_brdgmm *brdgmm, int b_scale_mask);
+
+status_t dnnl_brdgmm_set_D_scales(dnnl_brdgmm *brdgmm, int d_scale_mask);
+
+status_t dnnl_brdgmm_set_batch_strides(
+        dnnl_brdgmm *brdgmm, dim_t stride_A, dim_t stride_B);
+
+status_t dnnl_brdgmm_finalize(dnnl_brdgmm *brdgmm);
+
+status_t dnnl_brdgmm_generate(dnnl_brdgmm *brdgmm);
+
+status_t dnnl_brdgmm_execute(const dnnl_brdgmm *brdgmm, const void *A_ptr,
+        const void *B_ptr, const dim_t *A_B_offsets, void *D_ptr,
+        const dnnl_ukernel_attr_params *attr_params);
+
+status_t dnnl_brdgmm_destroy(dnnl_brdgmm *brdgmm);
+
+} // namespace ukernel
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -68,14 +68,25 @@ status_t brgemm_t::set_scales(int mask, int arg) {
     return status::success;
 }
 
+status_t brgemm_t::set_batch_strides(dim_t stride_A, dim_t stride_B) {
+    if (stride_A < 0 || stride_B < 0) return status::invalid_arguments;
+    use_batch_strides_ = true;
+    stride_A_ = stride_A;
+    stride_B_ = stride_B;
+    return status::success;
+}
+
 status_t brgemm_t::finalize() {
-    brgemm_batch_kind_t batch_kind = brgemm_batch_kind_t::brgemm_offs;
+    brgemm_batch_kind_t batch_kind = use_batch_strides_
+            ? brgemm_batch_kind_t::brgemm_strd
+            : brgemm_batch_kind_t::brgemm_offs;
+    brgemm_strides_t batch_strides {stride_A_, stride_B_};
 
     auto status = brgemm_desc_init(&brgemm_desc_, cpu_isa_t::isa_undef,
             batch_kind, a_dt_, b_dt_, /* transA = */ false,
             /* trans_B = */ false, brgemm_row_major, /* alpha = */ 1.f, beta_,
             lda_, ldb_, ldc_, M_, N_, K_,
-            /* strides = */ nullptr);
+            use_batch_strides_ ? &batch_strides : nullptr);
     if (status != status::success) {
         VCHECK_BRGEMM_STATUS(status, false, "brgemm_desc_init failed");
     }
@@ -184,14 +195,26 @@ status_t brgemm_t::generate() {
     return status::success;
 }
 
-status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
-        const dim_t *A_B_offsets, void *C_ptr, void *scratchpad_ptr) const {
+status_t brgemm_t::init_batch(const dim_t *A_B_offsets,
+        std::vector<brgemm_batch_element_t> &v_batch_element) const {
+    // The kernel walks the batch with the strides by itself.
+    if (use_batch_strides_) return status::success;
+    if (A_B_offsets == nullptr) return status::invalid_arguments;
+
     const auto batch_size = brgemm_desc_.brgattr.max_bs;
-    std::vector<brgemm_batch_element_t> v_batch_element(batch_size);
+    v_batch_element.resize(batch_size);
     for (int i = 0; i < batch_size; i++) {
         v_batch_element[i].offset.A = A_B_offsets[2 * i];
         v_batch_element[i].offset.B = A_B_offsets[2 * i + 1];
     }
+    return status::success;
+}
+
+status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
+        const dim_t *A_B_offsets, void *C_ptr, void *scratchpad_ptr) const {
+    const auto batch_size = brgemm_desc_.brgattr.max_bs;
+    std::vector<brgemm_batch_element_t> v_batch_element;
+    CHECK(init_batch(A_B_offsets, v_batch_element));
 
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
         double start_ms = get_msec();
@@ -229,11 +252,8 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
     }
 
     const auto batch_size = brgemm_desc_.brgattr.max_bs;
-    std::vector<brgemm_batch_element_t> v_batch_element(batch_size);
-    for (int i = 0; i < batch_size; i++) {
-        v_batch_element[i].offset.A = A_B_offsets[2 * i];
-        v_batch_element[i].offset.B = A_B_offsets[2 * i + 1];
-    }
+    std::vector<brgemm_batch_element_t> v_batch_element;
+    CHECK(init_batch(A_B_offsets, v_batch_element));
 
     brgemm_post_ops_data_t post_ops_data;
     // Note: this member is used to compute an offset from the base DST address.
@@ -311,6 +331,8 @@ status_t brgemm_t::create_verbose_info() {
     ss << md2fmt_str("dst", &dst_md, format_kind::undef);
     ss << "," << attr2str(&attr_) << ",";
     ss << "bs:" << d.brgattr.max_bs << " beta:" << beta_;
+    if (use_batch_strides_)
+        ss << " strides:" << stride_A_ << ":" << stride_B_;
     ss << "," << md2dim_str(&src_md) << ":" << md2dim_str(&wei_md);
 
     verbose_info_ = ss.str();
@@ -353,6 +375,8 @@ status_t dnnl_brgemm_set_post_ops(brgemm_t *brgemm, dim_t ldd, data_type_t d_dt,
 
 status_t dnnl_brgemm_set_A_scales(brgemm_t *brgemm, int a_scale_mask) {
     if (brgemm == nullptr) return status::invalid_arguments;
+    // A scale per row of A is applied to the rows of C.
+    if (!utils::one_of(a_scale_mask, 0, 1)) return status::unimplemented;
 
     CHECK(brgemm->set_scales(a_scale_mask, DNNL_ARG_SRC));
     return status::success;
@@ -372,6 +396,14 @@ status_t dnnl_brgemm_set_D_scales(brgemm_t *brgemm, int d_scale_mask) {
     return status::success;
 }
 
+status_t dnnl_brgemm_set_batch_strides(
+        brgemm_t *brgemm, dim_t stride_A, dim_t stride_B) {
+    if (brgemm == nullptr) return status::invalid_arguments;
+
+    CHECK(brgemm->set_batch_strides(stride_A, stride_B));
+    return status::success;
+}
+
 status_t dnnl_brgemm_finalize(brgemm_t *brgemm) {
     if (brgemm == nullptr) return status::invalid_arguments;
 
@@ -57,6 +57,9 @@ struct dnnl_brgemm : public dnnl::impl::c_compatible {
 
     dnnl::impl::status_t set_scales(int mask, int arg);
 
+    dnnl::impl::status_t set_batch_strides(
+            dnnl::impl::dim_t stride_A, dnnl::impl::dim_t stride_B);
+
     dnnl::impl::status_t finalize();
 
     static dnnl::impl::status_t get_B_pack_type(
@@ -85,6 +88,10 @@ private:
     dnnl::impl::dim_t lda_, ldb_, ldc_, ldd_;
     dnnl::impl::data_type_t a_dt_, b_dt_, c_dt_, d_dt_;
     float beta_;
+    // Strides in bytes between the matrices of consecutive batches. When set,
+    // the kernel walks the batch by itself and no offsets are passed.
+    bool use_batch_strides_ = false;
+    dnnl::impl::dim_t stride_A_ = 0, stride_B_ = 0;
     // A copy of attributes to avoid dependency on user's attributes lifetime.
     dnnl::impl::primitive_attr_t attr_;
 
@@ -92,6 +99,12 @@ private:
     dnnl::impl::cpu::x64::brgemm_desc_t brgemm_desc_;
     dnnl::impl::cpu::x64::brgemm_kernel_t *brgemm_kernel_;
 
+    // Fills the batch elements from the user offsets unless the batch
+    // strides are used.
+    dnnl::impl::status_t init_batch(const dnnl::impl::dim_t *A_B_offsets,
+            std::vector<dnnl::impl::cpu::x64::brgemm_batch_element_t>
+                    &v_batch_element) const;
+
     // Creates a `verbose_info_` string once during `generate()` call, and calls
     // it during execute(). This is done to avoid string re-creation.
     dnnl::impl::status_t create_verbose_info();
@@ -122,6 +135,9 @@ status_t dnnl_brgemm_set_B_scales(dnnl_brgemm *brgemm, int b_scale_mask);
 
 status_t dnnl_brgemm_set_D_scales(dnnl_brgemm *brgemm, int d_scale_mask);
 
+status_t dnnl_brgemm_set_batch_strides(
+        dnnl_brgemm *brgemm, dim_t stride_A, dim_t stride_B);
+
 status_t dnnl_brgemm_finalize(dnnl_brgemm *brgemm);
 
 status_t dnnl_brgemm_get_B_pack_type(
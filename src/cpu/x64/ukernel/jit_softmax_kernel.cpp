@@ -0,0 +1,299 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cfloat>
+#include <memory>
+
+#include "common/utils.hpp"
+
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+#include "cpu/x64/ukernel/jit_softmax_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+
+#define GET_OFF(field) \
+    offsetof(jit_softmax_ukernel_base_t::call_params_t, field)
+
+template <cpu_isa_t isa>
+struct jit_softmax_ukernel_t : public jit_softmax_ukernel_base_t,
+                               public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_softmax_ukernel_t)
+
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+    static constexpr auto vlen = cpu_isa_traits_t<isa>::vlen;
+    static constexpr auto simd_w = vlen / sizeof(float);
+
+    jit_softmax_ukernel_t(dim_t N, bool online)
+        : jit_generator_t(jit_name(), isa)
+        , online_(online)
+        , nb_(N / simd_w)
+        , tail_(N % simd_w) {}
+
+    void operator()(const call_params_t *p) const override {
+        jit_generator_t::operator()(p);
+    }
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+private:
+    const bool online_;
+    const dim_t nb_;
+    const dim_t tail_;
+
+    std::unique_ptr<jit_uni_eltwise_injector_t<isa>> exp_injector_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_exp_injector_table = rax;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_dst = r9;
+    const Reg64 reg_offt = r10;
+    const Reg64 reg_cnt = r11;
+    const Reg64 reg_tmp = r12;
+    const Reg64 reg_max = r13;
+    const Reg64 reg_sum = r14;
+    const Reg64 reg_correction = r15;
+
+    // The exp injector takes auxiliary registers starting from index 0.
+    const Vmm vsrc = Vmm(8);
+    const Vmm vtmp = Vmm(9);
+    const Vmm vmax = Vmm(10);
+    const Vmm vsum = Vmm(11);
+    const Vmm vlowest = Vmm(12);
+    const Vmm vtail_mask = Vmm(13);
+    const Vmm vcorrection = Vmm(14);
+
+    const Opmask injector_mask = Opmask(1);
+    const Opmask tail_opmask = Opmask(2);
+
+    Label l_tail_mask_table_;
+
+    static bool has_masks() { return is_superset(isa, avx512_core); }
+
+    Address src_ptr() { return ptr[reg_src + reg_offt]; }
+    Address dst_ptr() { return ptr[reg_dst + reg_offt]; }
+
+    void load(const Vmm &v, const Address &addr, bool tail) {
+        if (!tail)
+            uni_vmovups(v, addr);
+        else if (has_masks())
+            vmovups(v | tail_opmask | T_z, addr);
+        else
+            vmaskmovps(v, vtail_mask, addr);
+    }
+
+    void store(const Address &addr, const Vmm &v, bool tail) {
+        if (!tail)
+            uni_vmovups(addr, v);
+        else if (has_masks())
+            vmovups(addr | tail_opmask, v);
+        else
+            vmaskmovps(addr, vtail_mask, v);
+    }
+
+    void broadcast_float(const Vmm &v, float value) {
+        mov(reg_tmp.cvt32(), float2int(value));
+        uni_vmovd(Xmm(v.getIdx()), reg_tmp.cvt32());
+        uni_vbroadcastss(v, Xmm(v.getIdx()));
+    }
+
+    enum class op_t : unsigned { max, sum };
+
+    void perform_op(
+            const Vmm &vmm_dst, const Vmm &vmm1, const Vmm &vmm2, op_t op) {
+        if (op == op_t::max)
+            uni_vmaxps(vmm_dst, vmm1, vmm2);
+        else if (op == op_t::sum)
+            uni_vaddps(vmm_dst, vmm1, vmm2);
+    }
+
+    void get_horizontal_op(const Vmm &vsrc, const Vmm &vtmp, op_t op) {
+        const Zmm &zsrc = Zmm(vsrc.getIdx());
+        const Zmm &ztmp = Zmm(vtmp.getIdx());
+        const Ymm &ysrc = Ymm(vsrc.getIdx());
+        const Ymm &ytmp = Ymm(vtmp.getIdx());
+
+        if (is_superset(isa, avx512_core)) {
+            vshuff32x4(ztmp, zsrc, zsrc, 0x4E); // 256-bit shuffle
+            perform_op(vsrc, vsrc, vtmp, op);
+            vshuff32x4(ztmp, zsrc, zsrc, 0xB1); // 128/256-bit shuffle
+            perform_op(vsrc, vsrc, vtmp, op);
+        } else {
+            vperm2f128(ytmp, ysrc, ysrc, 0x1); // 128/256-bit shuffle
+            perform_op(vsrc, vsrc, vtmp, op);
+        }
+        uni_vshufps(vtmp, vsrc, vsrc, 0x4E); // 64/128-bit shuffle
+        perform_op(vsrc, vsrc, vtmp, op);
+        uni_vshufps(vtmp, vsrc, vsrc, 0xB1); // 32/64-bit shuffle
+        perform_op(vsrc, vsrc, vtmp, op);
+    }
+
+    // Calls `body` for every full vector of the row, and once more for the
+    // tail, if any.
+    template <typename body_t>
+    void row_loop(body_t body) {
+        xor_(reg_offt, reg_offt);
+        if (nb_ > 0) {
+            Label l_loop;
+            mov(reg_cnt, nb_);
+            L(l_loop);
+            {
+                body(false);
+                add(reg_offt, vlen);
+                dec(reg_cnt);
+                jnz(l_loop, T_NEAR);
+            }
+        }
+        if (tail_ > 0) body(true);
+    }
+
+    void accumulate_vmax() {
+        uni_vmovups(vmax, vlowest);
+        row_loop([&](bool tail) {
+            if (!tail) {
+                uni_vmaxps(vmax, vmax, src_ptr());
+            } else if (has_masks()) {
+                vmaxps(vmax | tail_opmask, vmax, src_ptr());
+            } else {
+                // Masked out lanes are loaded as zeros, replace them with the
+                // lowest value not to affect the maximum.
+                load(vtmp, src_ptr(), true);
+                vblendvps(vtmp, vlowest, vtmp, vtail_mask);
+                uni_vmaxps(vmax, vmax, vtmp);
+            }
+        });
+        get_horizontal_op(vmax, vtmp, op_t::max);
+
+        if (online_) {
+            // correction = exp(running_max - new_max).
+            uni_vbroadcastss(vcorrection, ptr[reg_max]);
+            uni_vmaxps(vmax, vmax, vcorrection);
+            uni_vsubps(vcorrection, vcorrection, vmax);
+            exp_injector_->compute_vector(vcorrection.getIdx());
+            uni_vmovss(ptr[reg_correction], Xmm(vcorrection.getIdx()));
+            uni_vmovss(ptr[reg_max], Xmm(vmax.getIdx()));
+        }
+    }
+
+    void accumulate_vsum() {
+        uni_vpxor(vsum, vsum, vsum);
+        row_loop([&](bool tail) {
+            load(vsrc, src_ptr(), tail);
+            uni_vsubps(vsrc, vsrc, vmax);
+            exp_injector_->compute_vector(vsrc.getIdx());
+            if (!tail) {
+                uni_vaddps(vsum, vsum, vsrc);
+            } else if (has_masks()) {
+                vaddps(vsum | tail_opmask, vsum, vsrc);
+            } else {
+                uni_vandps(vsrc, vsrc, vtail_mask);
+                uni_vaddps(vsum, vsum, vsrc);
+            }
+            store(dst_ptr(), vsrc, tail);
+        });
+        get_horizontal_op(vsum, vtmp, op_t::sum);
+
+        if (online_) {
+            // running_sum = running_sum * correction + sum.
+            const Xmm xtmp = Xmm(vtmp.getIdx());
+            uni_vmovss(xtmp, ptr[reg_sum]);
+            uni_vmulss(xtmp, xtmp, Xmm(vcorrection.getIdx()));
+            uni_vaddss(xtmp, xtmp, Xmm(vsum.getIdx()));
+            uni_vmovss(ptr[reg_sum], xtmp);
+        }
+    }
+
+    void compute_dst() {
+        broadcast_float(vtmp, 1.f);
+        uni_vdivps(vsum, vtmp, vsum);
+        row_loop([&](bool tail) {
+            load(vsrc, dst_ptr(), tail);
+            uni_vmulps(vsrc, vsrc, vsum);
+            store(dst_ptr(), vsrc, tail);
+        });
+    }
+
+    void prepare_tail_mask() {
+        if (has_masks()) {
+            mov(reg_tmp.cvt32(), (1 << tail_) - 1);
+            kmovw(tail_opmask, reg_tmp.cvt32());
+        } else {
+            uni_vmovups(vtail_mask, ptr[rip + l_tail_mask_table_]);
+        }
+    }
+
+    void generate() override {
+        exp_injector_.reset(new jit_uni_eltwise_injector_t<isa>(this,
+                alg_kind::eltwise_exp, 0.0f, 0.0f, 1.0f, data_type::f32,
+                /* save_state = */ false, reg_exp_injector_table,
+                injector_mask, /* is_fwd = */ true, /* use_dst = */ false,
+                /* preserve_vmm = */ false));
+
+        preamble();
+        exp_injector_->load_table_addr();
+        if (tail_ > 0) prepare_tail_mask();
+        broadcast_float(vlowest, -FLT_MAX);
+
+        mov(reg_src, ptr[reg_param + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+        if (online_) {
+            mov(reg_max, ptr[reg_param + GET_OFF(running_max)]);
+            mov(reg_sum, ptr[reg_param + GET_OFF(running_sum)]);
+            mov(reg_correction, ptr[reg_param + GET_OFF(correction)]);
+        }
+
+        accumulate_vmax();
+        accumulate_vsum();
+        // The online flavor leaves the normalization to the user, since the
+        // sum is not final until the last chunk of the row is processed.
+        if (!online_) compute_dst();
+
+        postamble();
+
+        exp_injector_->prepare_table();
+        if (tail_ > 0 && !has_masks()) {
+            align(vlen);
+            L(l_tail_mask_table_);
+            for (dim_t i = 0; i < static_cast<dim_t>(simd_w); i++)
+                dd(i < tail_ ? 0xffffffff : 0);
+        }
+    }
+};
+
+#undef GET_OFF
+
+jit_softmax_ukernel_base_t *jit_softmax_ukernel_base_t::create(
+        cpu_isa_t isa, dim_t N, bool online) {
+    if (is_superset(isa, avx512_core))
+        return new jit_softmax_ukernel_t<avx512_core>(N, online);
+    if (is_superset(isa, avx2))
+        return new jit_softmax_ukernel_t<avx2>(N, online);
+    return nullptr;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
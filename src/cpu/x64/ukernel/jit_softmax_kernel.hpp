@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_UKERNEL_JIT_SOFTMAX_KERNEL_HPP
+#define CPU_X64_UKERNEL_JIT_SOFTMAX_KERNEL_HPP
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Computes a softmax over a single row of f32 values. The kernel is generated
+// for a fixed row length, and the caller walks the rows.
+struct jit_softmax_ukernel_base_t {
+    // `online` stands for the softmax chunk that updates the running maximum
+    // and sum, and doesn't normalize the destination.
+    static jit_softmax_ukernel_base_t *create(
+            cpu_isa_t isa, dim_t N, bool online);
+
+    virtual ~jit_softmax_ukernel_base_t() = default;
+
+    struct call_params_t {
+        const void *src;
+        void *dst;
+        // Online flavor only.
+        float *running_max;
+        float *running_sum;
+        float *correction;
+    };
+
+    virtual void operator()(const call_params_t *p) const = 0;
+    virtual status_t create_kernel() = 0;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,272 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/memory_desc_wrapper.hpp"
+#include "common/verbose.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+
+#include "cpu/x64/ukernel/postops.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+using namespace dnnl::impl::cpu::ukernel;
+
+#define VCHECK_POSTOPS(cond, msg, ...) \
+    VCONDCHECK(ukernel, create, check, postops, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__)
+
+#define VCHECK_POSTOPS_STATUS(status, cond, msg, ...) \
+    VCONDCHECK(ukernel, create, check, postops, (cond), (status), msg, \
+            ##__VA_ARGS__)
+
+status_t postops_t::set_post_ops(
+        dim_t ldd, data_type_t d_dt, const post_ops_t *post_ops) {
+    ldd_ = ldd;
+    d_dt_ = d_dt;
+    CHECK(attr_.set_post_ops(*post_ops));
+    return status::success;
+}
+
+status_t postops_t::set_scales(int mask, int arg) {
+    if (mask < 0) return status::invalid_arguments;
+    CHECK(attr_.scales_.set(arg, mask));
+    return status::success;
+}
+
+status_t postops_t::finalize() {
+    VCHECK_POSTOPS(utils::one_of(c_dt_, data_type::f32, data_type::s32),
+            "unsupported tensor C data type");
+
+    // The kernel takes the accumulation data type from the tensors A and B
+    // data types, hence pick the ones that give tensor C data type. A single
+    // reduction step is enough for the descriptor to be valid.
+    const bool is_int8 = c_dt_ == data_type::s32;
+    const auto a_dt = is_int8 ? data_type::u8 : data_type::f32;
+    const auto b_dt = is_int8 ? data_type::s8 : data_type::f32;
+    auto status = brgemm_desc_init(&brgemm_desc_, cpu_isa_t::isa_undef,
+            brgemm_batch_kind_t::brgemm_addr, a_dt, b_dt,
+            /* transA = */ false, /* transB = */ false, brgemm_row_major,
+            /* alpha = */ 1.f, /* beta = */ 1.f, /* LDA = */ 1, /* LDB = */ N_,
+            ldc_, M_, N_, /* K = */ 1);
+    if (status != status::success) {
+        VCHECK_POSTOPS_STATUS(status, false, "brgemm_desc_init failed");
+    }
+
+    memory_desc_t D_md;
+    dims_t dims {M_, N_};
+    dims_t strides {ldd_, 1};
+    status = memory_desc_init_by_strides(
+            D_md, /* ndims = */ 2, dims, d_dt_, strides);
+    if (status != status::success) {
+        VCHECK_POSTOPS_STATUS(status, false, "D_md creation failed");
+    }
+
+    status = brgemm_desc_set_postops(
+            &brgemm_desc_, &attr_, &D_md, ldd_, data_type::undef);
+    if (status != status::success) {
+        VCHECK_POSTOPS_STATUS(status, false, "brgemm_desc_set_postops failed");
+    }
+
+    // The post-ops kernel reads the input when `alpha` is set, and applies
+    // the post-work when `beta` is set.
+    brgemm_desc_.alpha = 1;
+    brgemm_desc_.beta = 1;
+    return status::success;
+}
+
+status_t postops_t::generate() {
+    // Re-generation won't take any effect.
+    if (kernel_ != nullptr) return status::success;
+
+    kernel_.reset(jit_brgemm_kernel_post_ops_base_t::create(
+            brgemm_desc_.isa_impl, brgemm_desc_, attr_));
+    if (kernel_ == nullptr) return status::out_of_memory;
+    auto status = kernel_->generate_kernel();
+    VCHECK_POSTOPS_STATUS(
+            status, status == status::success, "post-ops kernel create failed");
+
+    // Generate a verbose info string at the point where configuration is done.
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
+        CHECK(create_verbose_info());
+    }
+    return status::success;
+}
+
+status_t postops_t::execute(const void *C_ptr, void *D_ptr,
+        const attr_params_t *attr_params) const {
+    if (kernel_ == nullptr) return status::invalid_arguments;
+
+    const bool with_binary = attr_.post_ops_.find(primitive_kind::binary) != -1;
+    const bool with_scales = !attr_.scales_.has_default_values();
+    if ((with_binary || with_scales) && attr_params == nullptr)
+        return status::invalid_arguments;
+
+    brgemm_kernel_post_ops_args_t p;
+    p.ptr_in = const_cast<void *>(C_ptr);
+    p.ptr_out = D_ptr;
+    p.ptr_bias = nullptr;
+    p.ptr_binary_post_ops_rhs
+            = attr_params ? attr_params->get_post_ops_args() : nullptr;
+    p.a_zp_compensation = nullptr;
+    p.c_zp_values = nullptr;
+    p.s8s8_compensation = nullptr;
+    // Note: this member is used to compute an offset from the base DST address.
+    p.dst_orig = D_ptr;
+
+    if (!attr_.scales_.has_default_values(DNNL_ARG_SRC)) {
+        p.ptr_src_scales = attr_params->get_scales(DNNL_ARG_SRC);
+        if (p.ptr_src_scales == nullptr) return status::invalid_arguments;
+    }
+    if (!attr_.scales_.has_default_values(DNNL_ARG_WEIGHTS)) {
+        p.ptr_wei_scales = attr_params->get_scales(DNNL_ARG_WEIGHTS);
+        if (p.ptr_wei_scales == nullptr) return status::invalid_arguments;
+    }
+    float dst_scale_inv = 0.f;
+    if (!attr_.scales_.has_default_values(DNNL_ARG_DST)) {
+        const void *dst_scales_ptr = attr_params->get_scales(DNNL_ARG_DST);
+        if (dst_scales_ptr == nullptr) return status::invalid_arguments;
+
+        dst_scale_inv = 1.f / static_cast<const float *>(dst_scales_ptr)[0];
+        p.ptr_dst_scales = &dst_scale_inv;
+    }
+
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
+        double start_ms = get_msec();
+        (*kernel_)(&p);
+        double duration_ms = get_msec() - start_ms;
+
+        stringstream_t ss;
+        ss << "cpu,postops,,undef," << verbose_info_;
+        VPROF(start_ms, ukernel, exec, VERBOSE_profile, ss.str().c_str(),
+                duration_ms);
+    } else {
+        (*kernel_)(&p);
+    }
+    return status::success;
+}
+
+status_t postops_t::create_verbose_info() {
+#if defined(DISABLE_VERBOSE)
+    return status::success;
+#endif
+
+    stringstream_t ss;
+
+    memory_desc_t src_md;
+    const dims_t dims = {M_, N_};
+    const dims_t src_strides = {ldc_, 1};
+    CHECK(memory_desc_init_by_strides(src_md, 2, dims, c_dt_, src_strides));
+
+    memory_desc_t dst_md;
+    const dims_t dst_strides = {ldd_, 1};
+    CHECK(memory_desc_init_by_strides(dst_md, 2, dims, d_dt_, dst_strides));
+
+    ss << md2fmt_str("src", &src_md, format_kind::undef) << " ";
+    ss << md2fmt_str("dst", &dst_md, format_kind::undef);
+    ss << "," << attr2str(&attr_) << ",";
+    ss << "," << md2dim_str(&src_md);
+
+    verbose_info_ = ss.str();
+    return status::success;
+}
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace ukernel {
+
+status_t dnnl_ukernel_postops_create(
+        postops_t **postops, dim_t M, dim_t N, dim_t ldc, data_type_t c_dt) {
+    if (postops == nullptr || M <= 0 || N <= 0 || ldc < N)
+        return status::invalid_arguments;
+
+    *postops = new postops_t(M, N, ldc, c_dt);
+    return status::success;
+}
+
+status_t dnnl_ukernel_postops_set_post_ops(postops_t *postops, dim_t ldd,
+        data_type_t d_dt, const post_ops_t *post_ops) {
+    if (postops == nullptr || post_ops == nullptr)
+        return status::invalid_arguments;
+
+    CHECK(postops->set_post_ops(ldd, d_dt, post_ops));
+    return status::success;
+}
+
+status_t dnnl_ukernel_postops_set_A_scales(
+        postops_t *postops, int a_scale_mask) {
+    if (postops == nullptr) return status::invalid_arguments;
+
+    CHECK(postops->set_scales(a_scale_mask, DNNL_ARG_SRC));
+    return status::success;
+}
+
+status_t dnnl_ukernel_postops_set_B_scales(
+        postops_t *postops, int b_scale_mask) {
+    if (postops == nullptr) return status::invalid_arguments;
+
+    CHECK(postops->set_scales(b_scale_mask, DNNL_ARG_WEIGHTS));
+    return status::success;
+}
+
+status_t dnnl_ukernel_postops_set_D_scales(
+        postops_t *postops, int d_scale_mask) {
+    if (postops == nullptr) return status::invalid_arguments;
+
+    CHECK(postops->set_scales(d_scale_mask, DNNL_ARG_DST));
+    return status::success;
+}
+
+status_t dnnl_ukernel_postops_finalize(postops_t *postops) {
+    if (postops == nullptr) return status::invalid_arguments;
+
+    CHECK(postops->finalize());
+    return status::success;
+}
+
+status_t dnnl_ukernel_postops_generate(postops_t *postops) {
+    if (postops == nullptr) return status::invalid_arguments;
+
+    CHECK(postops->generate());
+    return status::success;
+}
+
+status_t dnnl_ukernel_postops_execute(const postops_t *postops,
+        const void *C_ptr, void *D_ptr, const attr_params_t *attr_params) {
+    if (postops == nullptr) return status::invalid_arguments;
+
+    CHECK(postops->execute(C_ptr, D_ptr, attr_params));
+    return status::success;
+}
+
+status_t dnnl_ukernel_postops_destroy(postops_t *postops) {
+    delete postops;
+    return status::success;
+}
+
+} // namespace ukernel
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
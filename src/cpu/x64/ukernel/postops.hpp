@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_UKERNEL_POSTOPS_HPP
+#define CPU_X64_UKERNEL_POSTOPS_HPP
+
+#include <memory>
+#include <string>
+
+#include "cpu/ukernel/c_types_map.hpp"
+
+#include "cpu/x64/brgemm/brgemm_types.hpp"
+#include "cpu/x64/jit_brgemm_post_ops.hpp"
+
+#include "cpu/x64/ukernel/attr_params.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+struct dnnl_ukernel_postops : public dnnl::impl::c_compatible {
+    dnnl_ukernel_postops(dnnl::impl::dim_t M, dnnl::impl::dim_t N,
+            dnnl::impl::dim_t ldc, dnnl::impl::data_type_t c_dt)
+        : M_(M)
+        , N_(N)
+        , ldc_(ldc)
+        , ldd_(ldc) // User may overwrite with set_post_ops().
+        , c_dt_(c_dt)
+        , d_dt_(c_dt) {} // User may overwrite with set_post_ops().
+
+    dnnl::impl::status_t set_post_ops(dnnl::impl::dim_t ldd,
+            dnnl::impl::data_type_t d_dt,
+            const dnnl::impl::post_ops_t *post_ops);
+
+    dnnl::impl::status_t set_scales(int mask, int arg);
+
+    dnnl::impl::status_t finalize();
+
+    dnnl::impl::status_t generate();
+
+    dnnl::impl::status_t execute(const void *C_ptr, void *D_ptr,
+            const dnnl::impl::cpu::ukernel::attr_params_t *attr_params) const;
+
+private:
+    // User's inputs.
+    dnnl::impl::dim_t M_, N_;
+    dnnl::impl::dim_t ldc_, ldd_;
+    dnnl::impl::data_type_t c_dt_, d_dt_;
+    // A copy of attributes to avoid dependency on user's attributes lifetime.
+    // The kernel keeps a reference to it.
+    dnnl::impl::primitive_attr_t attr_;
+
+    // The brgemm descriptor serves as a configuration of the post-ops kernel
+    // which brgemm-based primitives use to finalize the accumulators.
+    dnnl::impl::cpu::x64::brgemm_desc_t brgemm_desc_;
+    std::unique_ptr<dnnl::impl::cpu::x64::jit_brgemm_kernel_post_ops_base_t>
+            kernel_;
+
+    // Creates a `verbose_info_` string once during `generate()` call, and calls
+    // it during execute(). This is done to avoid string re-creation.
+    dnnl::impl::status_t create_verbose_info();
+    std::string verbose_info_;
+};
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace ukernel {
+
+status_t dnnl_ukernel_postops_create(dnnl_ukernel_postops **postops, dim_t M,
+        dim_t N, dim_t ldc, data_type_t c_dt);
+
+status_t dnnl_ukernel_postops_set_post_ops(dnnl_ukernel_postops *postops,
+        dim_t ldd, data_type_t d_dt, const post_ops_t *post_ops);
+
+status_t dnnl_ukernel_postops_set_A_scales(
+        dnnl_ukernel_postops *postops, int a_scale_mask);
+
+status_t dnnl_ukernel_postops_set_B_scales(
+        dnnl_ukernel_postops *postops, int b_scale_mask);
+
+status_t dnnl_ukernel_postops_set_D_scales(
+        dnnl_ukernel_postops *postops, int d_scale_mask);
+
+status_t dnnl_ukernel_postops_finalize(dnnl_ukernel_postops *postops);
+
+status_t dnnl_ukernel_postops_generate(dnnl_ukernel_postops *postops);
+
+status_t dnnl_ukernel_postops_execute(const dnnl_ukernel_postops *postops,
+        const void *C_ptr, void *D_ptr,
+        const dnnl_ukernel_attr_params *attr_params);
+
+status_t dnnl_ukernel_postops_destroy(dnnl_ukernel_postops *postops);
+
+} // namespace ukernel
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/verbose.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+#include "cpu/x64/ukernel/softmax.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+using namespace dnnl::impl::cpu::ukernel;
+
+#define VCHECK_SOFTMAX_STATUS(status, cond, msg, ...) \
+    VCONDCHECK(ukernel, create, check, softmax, (cond), (status), msg, \
+            ##__VA_ARGS__)
+
+status_t softmax_t::set_online(bool online) {
+    // The kernel is generated for the flavor and can't be changed after.
+    if (kernel_ != nullptr) return status::invalid_arguments;
+    online_ = online;
+    return status::success;
+}
+
+status_t softmax_t::generate() {
+    // Re-generation won't take any effect.
+    if (kernel_ != nullptr) return status::success;
+
+    const cpu_isa_t isa = mayiuse(avx512_core) ? avx512_core
+            : mayiuse(avx2)                    ? avx2
+                                               : isa_undef;
+    VCHECK_SOFTMAX_STATUS(status::unimplemented, isa != isa_undef,
+            "no isa is available for softmax ukernel");
+
+    kernel_.reset(jit_softmax_ukernel_base_t::create(isa, N_, online_));
+    if (kernel_ == nullptr) return status::out_of_memory;
+    auto status = kernel_->create_kernel();
+    VCHECK_SOFTMAX_STATUS(
+            status, status == status::success, "softmax kernel create failed");
+
+    // Generate a verbose info string at the point where configuration is done.
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
+        CHECK(create_verbose_info());
+    }
+    return status::success;
+}
+
+status_t softmax_t::execute(const void *src_ptr, void *dst_ptr,
+        float *running_max, float *running_sum, float *correction) const {
+    if (kernel_ == nullptr) return status::invalid_arguments;
+    if (online_ && utils::any_null(running_max, running_sum, correction))
+        return status::invalid_arguments;
+
+    double start_ms = 0;
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel))
+        start_ms = get_msec();
+
+    const float *src = static_cast<const float *>(src_ptr);
+    float *dst = static_cast<float *>(dst_ptr);
+
+    jit_softmax_ukernel_base_t::call_params_t p;
+    p.running_max = nullptr;
+    p.running_sum = nullptr;
+    p.correction = nullptr;
+    for (dim_t m = 0; m < M_; m++) {
+        p.src = src + m * ld_src_;
+        p.dst = dst + m * ld_dst_;
+        if (online_) {
+            p.running_max = running_max + m;
+            p.running_sum = running_sum + m;
+            p.correction = correction + m;
+        }
+        (*kernel_)(&p);
+    }
+
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
+        double duration_ms = get_msec() - start_ms;
+
+        stringstream_t ss;
+        ss << "cpu,softmax,,undef," << verbose_info_;
+        VPROF(start_ms, ukernel, exec, VERBOSE_profile, ss.str().c_str(),
+                duration_ms);
+    }
+    return status::success;
+}
+
+status_t softmax_t::create_verbose_info() {
+#if defined(DISABLE_VERBOSE)
+    return status::success;
+#endif
+
+    stringstream_t ss;
+
+    memory_desc_t src_md;
+    const dims_t dims = {M_, N_};
+    const dims_t src_strides = {ld_src_, 1};
+    CHECK(memory_desc_init_by_strides(
+            src_md, 2, dims, data_type::f32, src_strides));
+
+    memory_desc_t dst_md;
+    const dims_t dst_strides = {ld_dst_, 1};
+    CHECK(memory_desc_init_by_strides(
+            dst_md, 2, dims, data_type::f32, dst_strides));
+
+    ss << md2fmt_str("src", &src_md, format_kind::undef) << " ";
+    ss << md2fmt_str("dst", &dst_md, format_kind::undef);
+    ss << ",," << (online_ ? "online" : "regular");
+    ss << "," << md2dim_str(&src_md);
+
+    verbose_info_ = ss.str();
+    return status::success;
+}
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace ukernel {
+
+status_t dnnl_ukernel_softmax_create(
+        softmax_t **softmax, dim_t M, dim_t N, dim_t ld_src, dim_t ld_dst) {
+    if (softmax == nullptr || M <= 0 || N <= 0 || ld_src < N || ld_dst < N)
+        return status::invalid_arguments;
+
+    *softmax = new softmax_t(M, N, ld_src, ld_dst);
+    return status::success;
+}
+
+status_t dnnl_ukernel_softmax_set_online(softmax_t *softmax, int online) {
+    if (softmax == nullptr) return status::invalid_arguments;
+
+    CHECK(softmax->set_online(online != 0));
+    return status::success;
+}
+
+status_t dnnl_ukernel_softmax_generate(softmax_t *softmax) {
+    if (softmax == nullptr) return status::invalid_arguments;
+
+    CHECK(softmax->generate());
+    return status::success;
+}
+
+status_t dnnl_ukernel_softmax_execute(const softmax_t *softmax,
+        const void *src_ptr, void *dst_ptr, float *running_max,
+        float *running_sum, float *correction) {
+    if (softmax == nullptr) return status::invalid_arguments;
+
+    CHECK(softmax->execute(
+            src_ptr, dst_ptr, running_max, running_sum, correction));
+    return status::success;
+}
+
+status_t dnnl_ukernel_softmax_destroy(softmax_t *softmax) {
+    delete softmax;
+    return status::success;
+}
+
+} // namespace ukernel
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_UKERNEL_SOFTMAX_HPP
+#define CPU_X64_UKERNEL_SOFTMAX_HPP
+
+#include <memory>
+#include <string>
+
+#include "cpu/ukernel/c_types_map.hpp"
+
+#include "cpu/x64/ukernel/jit_softmax_kernel.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+struct dnnl_ukernel_softmax : public dnnl::impl::c_compatible {
+    dnnl_ukernel_softmax(dnnl::impl::dim_t M, dnnl::impl::dim_t N,
+            dnnl::impl::dim_t ld_src, dnnl::impl::dim_t ld_dst)
+        : M_(M), N_(N), ld_src_(ld_src), ld_dst_(ld_dst) {}
+
+    dnnl::impl::status_t set_online(bool online);
+
+    dnnl::impl::status_t generate();
+
+    dnnl::impl::status_t execute(const void *src_ptr, void *dst_ptr,
+            float *running_max, float *running_sum, float *correction) const;
+
+private:
+    // User's inputs.
+    dnnl::impl::dim_t M_, N_;
+    dnnl::impl::dim_t ld_src_, ld_dst_;
+    bool online_ = false;
+
+    // A row kernel, called for each of M rows.
+    std::unique_ptr<dnnl::impl::cpu::x64::jit_softmax_ukernel_base_t>
+            kernel_;
+
+    // Creates a `verbose_info_` string once during `generate()` call, and calls
+    // it during execute(). This is done to avoid string re-creation.
+    dnnl::impl::status_t create_verbose_info();
+    std::string verbose_info_;
+};
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace ukernel {
+
+status_t dnnl_ukernel_softmax_create(dnnl_ukernel_softmax **softmax, dim_t M,
+        dim_t N, dim_t ld_src, dim_t ld_dst);
+
+status_t dnnl_ukernel_softmax_set_online(
+        dnnl_ukernel_softmax *softmax, int online);
+
+status_t dnnl_ukernel_softmax_generate(dnnl_ukernel_softmax *softmax);
+
+status_t dnnl_ukernel_softmax_execute(const dnnl_ukernel_softmax *softmax,
+        const void *src_ptr, void *dst_ptr, float *running_max,
+        float *running_sum, float *correction);
+
+status_t dnnl_ukernel_softmax_destroy(dnnl_ukernel_softmax *softmax);
+
+} // namespace ukernel
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
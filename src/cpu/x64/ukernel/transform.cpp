@@ -28,6 +28,10 @@ using namespace dnnl::impl::cpu::ukernel;
     VCONDCHECK(ukernel, create, check, brgemm, (cond), \
             status::invalid_arguments, msg, ##__VA_ARGS__)
 
+#define VCHECK_TRANSFORM_STATUS(status, cond, msg, ...) \
+    VCONDCHECK(ukernel, create, check, brgemm, (cond), (status), msg, \
+            ##__VA_ARGS__)
+
 dnnl_transform::dnnl_transform(dim_t K, dim_t N, pack_type_t in_pack_type,
         dim_t in_ld, dim_t out_ld, data_type_t in_dt, data_type_t out_dt)
     : K_(K)
@@ -50,6 +54,10 @@ dnnl_transform::dnnl_transform(dim_t K, dim_t N, pack_type_t in_pack_type,
             in_ld_, out_ld_, in_dt_, out_dt_, in_tag);
     assert(status == status::success);
     if (status != status::success) return;
+    // `init_conf()` only tips the bf16 flavor of weights decompression, the
+    // f16 one is signaled here to make copy routines convert the output.
+    bmc_.is_f16_with_int_wei
+            = bmc_.with_wei_decompression && out_dt_ == data_type::f16;
 
     if (in_pack_type == pack_type::trans) {
         strides_[0] = 1;
@@ -62,10 +70,82 @@ dnnl_transform::dnnl_transform(dim_t K, dim_t N, pack_type_t in_pack_type,
     }
 }
 
+status_t transform_t::set_scales(dim_t k_group_size, data_type_t scales_dt) {
+    VCHECK_TRANSFORM(bmc_.with_wei_decompression,
+            "Scales are supported only for weights decompression.");
+    VCHECK_TRANSFORM(pack_B_kernel_ == nullptr,
+            "Scales must be set before the transform is generated.");
+    VCHECK_TRANSFORM(utils::one_of(scales_dt, data_type::f32, data_type::bf16,
+                             data_type::f16),
+            "Unsupported scales data type.");
+    VCHECK_TRANSFORM(k_group_size > 0 && K_ % k_group_size == 0,
+            "\'k_group_size\' must divide K.");
+
+    // Copy routines can apply a single group of scales per call only when
+    // groups and a K block split each other evenly. A single group over the
+    // whole K reduces to the same case.
+    const dim_t gK = k_group_size;
+    const dim_t K_blk = bmc_.K_blk;
+    const dim_t vnni_granularity = data_type_vnni_granularity(out_dt_);
+    const bool single_group_ok = gK == K_
+            || ((K_blk % gK == 0 || gK % K_blk == 0)
+                    && gK % vnni_granularity == 0);
+    VCHECK_TRANSFORM_STATUS(status::unimplemented,
+            gK == 1 || single_group_ok,
+            "\'k_group_size\' of %ld is not supported with the K block of "
+            "%ld.",
+            (long)gK, (long)K_blk);
+
+    bmc_.with_wei_scales = true;
+    bmc_.is_wei_scale_per_k = true;
+    bmc_.is_wei_scale_per_n = true;
+    bmc_.apply_scales_in_buffer_b = true;
+    bmc_.wei_scales_dt = scales_dt;
+    bmc_.wei_scales_dt_sz = types::data_type_size(scales_dt);
+    bmc_.wei_scales_k_group_size = gK;
+    bmc_.gK_and_K_blk_are_divisible = gK > 1;
+    with_scales_ = true;
+    return status::success;
+}
+
+status_t transform_t::set_zero_points(int mask) {
+    VCHECK_TRANSFORM(bmc_.with_wei_decompression,
+            "Zero points are supported only for weights decompression.");
+    VCHECK_TRANSFORM(pack_B_kernel_ == nullptr,
+            "Zero points must be set before the transform is generated.");
+    VCHECK_TRANSFORM_STATUS(status::unimplemented, mask == 0,
+            "Only a common zero point is supported, got mask %d.", mask);
+
+    bmc_.wei_zp_type = brgemm_broadcast_t::per_tensor;
+    bmc_.has_zero_point_b = true;
+    with_zero_points_ = true;
+    return status::success;
+}
+
 status_t transform_t::generate() {
     // Re-generation won't take any effect.
     if (pack_B_kernel_ != nullptr) return status::success;
 
+    if (bmc_.with_wei_decompression) {
+        // Integer outputs keep weights as is for VNNI brgemm, the conversion
+        // from int4 and the dequantization are only done into floating-point.
+        VCHECK_TRANSFORM_STATUS(status::unimplemented,
+                utils::one_of(out_dt_, data_type::f32, data_type::bf16,
+                        data_type::f16),
+                "Weights decompression supports only f32, bf16 or f16 "
+                "outputs.");
+        const auto isa = bmc_.isa;
+        const bool isa_ok
+                = IMPLICATION(out_dt_ == data_type::bf16,
+                          is_superset(isa, avx512_core_bf16))
+                && IMPLICATION(out_dt_ == data_type::f16,
+                        is_superset(isa, avx512_core_fp16))
+                && IMPLICATION(
+                        out_dt_ == data_type::f32, is_superset(isa, avx2));
+        VCHECK_TRANSFORM_STATUS(
+                status::unimplemented, isa_ok, VERBOSE_UNSUPPORTED_ISA);
+    }
+
     CHECK(matmul::create_brgemm_matmul_copy_b(pack_B_kernel_, &bmc_));
 
     // Generate a verbose info string at the point where configuration is done.
@@ -75,7 +155,12 @@ status_t transform_t::generate() {
     return status::success;
 }
 
-status_t transform_t::execute(const void *src, void *dst) const {
+status_t transform_t::execute(const void *src, void *dst,
+        const void *scales, const void *zero_points) const {
+    if ((with_scales_ && scales == nullptr)
+            || (with_zero_points_ && zero_points == nullptr))
+        return status::invalid_arguments;
+
     double start_ms = 0;
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel))
         start_ms = get_msec();
@@ -90,6 +175,17 @@ status_t transform_t::execute(const void *src, void *dst) const {
 
     const auto i_dt_sz = kernel_conf.b_dt_sz;
     const auto o_dt_sz = kernel_conf.a_dt_sz;
+    // int4 values are packed two per byte.
+    const dim_t src_elems_per_byte
+            = utils::one_of(in_dt_, data_type::s4, data_type::u4) ? 2 : 1;
+
+    // When a single group of scales applies to a part of a K block, the
+    // kernel is called for every group, see `gK_and_K_blk_are_divisible`.
+    const dim_t gK = kernel_conf.wei_scales_k_group_size;
+    const dim_t K_step = kernel_conf.gK_and_K_blk_are_divisible
+            ? nstl::min(gK, kernel_conf.K_blk)
+            : kernel_conf.K_blk;
+    const auto *scales_ptr = reinterpret_cast<const uint8_t *>(scales);
 
     for (dim_t n_blk_idx = 0; n_blk_idx < n_blks; n_blk_idx++) {
         const auto n = n_blk_idx * kernel_conf.N_blk;
@@ -97,31 +193,33 @@ status_t transform_t::execute(const void *src, void *dst) const {
         auto ker_exec_ctx = matmul::jit_brgemm_matmul_copy_b_t::ctx_t();
         ker_exec_ctx.current_N_blk
                 = is_N_tail ? kernel_conf.N_tail : kernel_conf.N_blk;
+        ker_exec_ctx.zp_b_value_ptr = zero_points;
 
-        int k_blk_idx = 0;
-        for (; k_blk_idx < kernel_conf.K / kernel_conf.K_blk; k_blk_idx++) {
-            const auto k = k_blk_idx * kernel_conf.K_blk;
-            const auto src_offset
-                    = i_dt_sz * (k * strides_[0] + n * strides_[1]);
-            const auto dst_offset
+        for (dim_t k_blk_idx = 0; k_blk_idx < k_blks; k_blk_idx++) {
+            const auto k_blk_start = k_blk_idx * kernel_conf.K_blk;
+            const auto cur_K_blk = nstl::min(
+                    kernel_conf.K_blk, kernel_conf.K - k_blk_start);
+            const auto dst_blk_offset
                     = o_dt_sz * (k_blk_idx * blk_size + n_blk_idx * k_blks);
-            ker_exec_ctx.src = &src_ptr[src_offset];
-            ker_exec_ctx.tr_src = &dst_ptr[dst_offset];
-            ker_exec_ctx.current_K_start = k;
-            ker_exec_ctx.current_K_iters = kernel_conf.K_blk;
-            (*pack_B_kernel_)(&ker_exec_ctx);
-        }
-        if (kernel_conf.K_tail > 0) {
-            const auto k = k_blk_idx * kernel_conf.K_blk;
-            const auto src_offset
-                    = i_dt_sz * (k * strides_[0] + n * strides_[1]);
-            const auto dst_offset
-                    = o_dt_sz * (k_blk_idx * blk_size + n_blk_idx * k_blks);
-            ker_exec_ctx.src = &src_ptr[src_offset];
-            ker_exec_ctx.tr_src = &dst_ptr[dst_offset];
-            ker_exec_ctx.current_K_start = k;
-            ker_exec_ctx.current_K_iters = kernel_conf.K_tail;
-            (*pack_B_kernel_)(&ker_exec_ctx);
+            for (dim_t kk = 0; kk < cur_K_blk; kk += K_step) {
+                const auto k = k_blk_start + kk;
+                const auto src_offset = i_dt_sz
+                        * (k * strides_[0] + n * strides_[1])
+                        / src_elems_per_byte;
+                const auto dst_offset = dst_blk_offset
+                        + o_dt_sz * kk * kernel_conf.N_blk;
+                ker_exec_ctx.src = &src_ptr[src_offset];
+                ker_exec_ctx.tr_src = &dst_ptr[dst_offset];
+                ker_exec_ctx.current_K_start = k;
+                ker_exec_ctx.current_K_iters
+                        = nstl::min(K_step, cur_K_blk - kk);
+                if (with_scales_) {
+                    const auto scales_offset = kernel_conf.wei_scales_dt_sz
+                            * ((k / gK) * kernel_conf.N + n);
+                    ker_exec_ctx.wei_scales_ptr = &scales_ptr[scales_offset];
+                }
+                (*pack_B_kernel_)(&ker_exec_ctx);
+            }
         }
     }
 
@@ -177,6 +275,21 @@ status_t dnnl_transform_create(transform_t **transform, dim_t K, dim_t N,
     return status::success;
 }
 
+status_t dnnl_transform_set_scales(
+        transform_t *transform, dim_t k_group_size, data_type_t scales_dt) {
+    if (transform == nullptr) return status::invalid_arguments;
+
+    CHECK(transform->set_scales(k_group_size, scales_dt));
+    return status::success;
+}
+
+status_t dnnl_transform_set_zero_points(transform_t *transform, int mask) {
+    if (transform == nullptr) return status::invalid_arguments;
+
+    CHECK(transform->set_zero_points(mask));
+    return status::success;
+}
+
 status_t dnnl_transform_generate(transform_t *transform) {
     if (transform == nullptr) return status::invalid_arguments;
 
@@ -193,6 +306,16 @@ status_t dnnl_transform_execute(
     return status::success;
 }
 
+status_t dnnl_transform_execute_decompress(const transform_t *transform,
+        const void *in_ptr, void *out_ptr, const void *scales_ptr,
+        const void *zero_points_ptr) {
+    if (utils::any_null(transform, in_ptr, out_ptr))
+        return status::invalid_arguments;
+
+    CHECK(transform->execute(in_ptr, out_ptr, scales_ptr, zero_points_ptr));
+    return status::success;
+}
+
 status_t dnnl_transform_destroy(transform_t *transform) {
     delete transform;
     return status::success;
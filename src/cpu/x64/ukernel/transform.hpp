@@ -33,17 +33,29 @@ struct dnnl_transform : public dnnl::impl::c_compatible {
             dnnl::impl::dim_t in_ld, dnnl::impl::dim_t out_ld,
             dnnl::impl::data_type_t in_dt, dnnl::impl::data_type_t out_dt);
 
+    // Sets B scales applied during weights decompression. `k_group_size` must
+    // divide K, scales are dense and have `K / k_group_size x N` elements.
+    dnnl::impl::status_t set_scales(dnnl::impl::dim_t k_group_size,
+            dnnl::impl::data_type_t scales_dt);
+
+    // Sets B zero points subtracted during weights decompression.
+    dnnl::impl::status_t set_zero_points(int mask);
+
     // Generates a transform kernel.
     dnnl::impl::status_t generate();
 
     // Executes a transform kernel.
-    dnnl::impl::status_t execute(const void *src, void *dst) const;
+    dnnl::impl::status_t execute(const void *src, void *dst,
+            const void *scales = nullptr,
+            const void *zero_points = nullptr) const;
 
 private:
     // User's inputs.
     dnnl::impl::dim_t K_, N_;
     dnnl::impl::dim_t in_ld_, out_ld_;
     dnnl::impl::data_type_t in_dt_, out_dt_;
+    bool with_scales_ = false;
+    bool with_zero_points_ = false;
     // Save `strides_` for `execute` to get proper source offset.
     dnnl::impl::dims_t strides_ {};
 
@@ -71,11 +83,20 @@ status_t dnnl_transform_create(dnnl_transform **transform, dim_t K, dim_t N,
         dnnl::impl::cpu::ukernel::pack_type_t in_pack_type, dim_t in_ld,
         dim_t out_ld, data_type_t in_dt, data_type_t out_dt);
 
+status_t dnnl_transform_set_scales(dnnl_transform *transform,
+        dim_t k_group_size, data_type_t scales_dt);
+
+status_t dnnl_transform_set_zero_points(dnnl_transform *transform, int mask);
+
 status_t dnnl_transform_generate(dnnl_transform *transform);
 
 status_t dnnl_transform_execute(
         const dnnl_transform *transform, const void *in_ptr, void *out_ptr);
 
+status_t dnnl_transform_execute_decompress(const dnnl_transform *transform,
+        const void *in_ptr, void *out_ptr, const void *scales_ptr,
+        const void *zero_points_ptr);
+
 status_t dnnl_transform_destroy(dnnl_transform *transform);
 
 } // namespace ukernel
@@ -44,9 +44,17 @@ public:
 
     io_conf_t &operator=(const io_conf_t &other) = default;
 
+    // Non-temporal stores are used for full vectors only, tails are always
+    // stored with regular instructions.
     bool nt_stores_enabled_ = false;
 };
 
+// Returns true when the output is large enough for non-temporal stores to
+// pay off: it doesn't fit into the last level cache available to the
+// threads, so regular stores would evict useful data and read every
+// destination line before overwriting it.
+bool is_nt_stores_beneficial(size_t dst_size);
+
 class io_tail_conf_t {
 public:
     io_tail_conf_t(const std::size_t simd_w, const std::size_t tail_size,
@@ -229,11 +237,14 @@ private:
             const int store_size);
     void store_f32(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
             const bool tail);
-    void store_bf16(const Vmm &src_vmm, const Xbyak::Address &dst_addr);
-    void store_f16(const Vmm &src_vmm, const Xbyak::Address &dst_addr);
-    void store_f8(const Vmm &src_vmm, const Xbyak::Address &dst_addr);
+    void store_bf16(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
+            const bool use_nt_stores);
+    void store_f16(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
+            const bool use_nt_stores);
+    void store_f8(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
+            const bool use_nt_stores);
     void store_i8(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
-            const bool use_sat_cvt);
+            const bool use_sat_cvt, const bool use_nt_stores);
     void convert_to_f32(const Vmm &dst_vmm, const Xbyak::Xmm &src_vmm,
             const data_type_t src_data_type);
 
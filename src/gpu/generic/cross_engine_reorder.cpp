@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <vector>
+
+#include "common/math_utils.hpp"
 #include "common/reorder.hpp"
 #include "common/utils.hpp"
 
@@ -27,6 +30,99 @@ namespace impl {
 namespace gpu {
 namespace generic {
 
+namespace {
+// Tensors smaller than this are copied at once, larger ones are split into
+// at most max_nchunks chunks of at least min_chunk_size bytes.
+constexpr size_t min_chunked_size = 16 * 1024 * 1024;
+constexpr size_t min_chunk_size = 4 * 1024 * 1024;
+constexpr size_t max_nchunks = 8;
+
+// Returns the size of the points of the first dimension in bytes when it is
+// the outermost dimension of a dense tensor without padding in it, so that a
+// range of its points is a contiguous range of memory, and 0 otherwise.
+size_t outer_point_size(const memory_desc_wrapper &mdw) {
+    if (mdw.ndims() < 2 || !mdw.is_blocking_desc() || !mdw.is_dense()
+            || mdw.offset0() != 0 || mdw.extra().flags != 0
+            || mdw.padded_dims()[0] != mdw.dims()[0])
+        return 0;
+    const auto &bd = mdw.blocking_desc();
+    dim_t blk = 1;
+    for (int i = 0; i < bd.inner_nblks; i++)
+        if (bd.inner_idxs[i] == 0) blk *= bd.inner_blks[i];
+    const size_t outer_size = bd.strides[0] * (mdw.dims()[0] / blk)
+            * types::data_type_size(mdw.data_type());
+    if (outer_size != mdw.size()) return 0;
+    return mdw.size() / mdw.dims()[0];
+}
+
+dim_t outer_block(const memory_desc_wrapper &mdw) {
+    const auto &bd = mdw.blocking_desc();
+    dim_t blk = 1;
+    for (int i = 0; i < bd.inner_nblks; i++)
+        if (bd.inner_idxs[i] == 0) blk *= bd.inner_blks[i];
+    return blk;
+}
+
+memory_desc_t chunk_md(const memory_desc_t &md, dim_t chunk_dim) {
+    memory_desc_t ret = md;
+    ret.dims[0] = ret.padded_dims[0] = chunk_dim;
+    return ret;
+}
+} // namespace
+
+void cross_engine_reorder_t::pd_t::init_chunks(impl::engine_t *reorder_engine,
+        const primitive_attr_t &r_attr, int gpu_align) {
+    memory_desc_wrapper src_mdw(src_md());
+    memory_desc_wrapper dst_mdw(dst_md());
+    const size_t src_point = outer_point_size(src_mdw);
+    const size_t dst_point = outer_point_size(dst_mdw);
+    if (src_point == 0 || dst_point == 0) return;
+
+    const size_t size = nstl::max(src_mdw.size(), dst_mdw.size());
+    if (size < min_chunked_size) return;
+
+    // A chunk is a whole number of blocks of the first dimension on both
+    // sides, and its sub-buffers start at aligned offsets.
+    const dim_t dim0 = src_mdw.dims()[0];
+    dim_t unit = math::lcm(outer_block(src_mdw), outer_block(dst_mdw));
+    const auto is_aligned = [&](dim_t n) {
+        return (n * src_point) % gpu_align == 0
+                && (n * dst_point) % gpu_align == 0;
+    };
+    while (unit < dim0 && !is_aligned(unit))
+        unit *= 2;
+    if (!is_aligned(unit)) return;
+
+    const size_t chunk_size
+            = nstl::max(min_chunk_size, utils::div_up(size, max_nchunks));
+    const size_t point = nstl::max(src_point, dst_point);
+    const dim_t chunk_dim = utils::rnd_up(
+            static_cast<dim_t>(utils::div_up(chunk_size, point)), unit);
+    if (chunk_dim >= dim0) return;
+
+    const auto create_pd = [&](std::shared_ptr<primitive_desc_t> &pd,
+                                   dim_t n) {
+        const auto c_src_md = chunk_md(*src_md(), n);
+        const auto c_dst_md = chunk_md(*dst_md(), n);
+        return reorder_primitive_desc_create(
+                pd, reorder_engine, &c_src_md, &c_dst_md, &r_attr);
+    };
+    const dim_t nchunks = utils::div_up(dim0, chunk_dim);
+    const dim_t tail_dim = dim0 - (nchunks - 1) * chunk_dim;
+    if (create_pd(chunk_reorder_pd_, chunk_dim) != status::success) {
+        chunk_reorder_pd_.reset();
+        return;
+    }
+    if (tail_dim != chunk_dim
+            && create_pd(tail_reorder_pd_, tail_dim) != status::success) {
+        chunk_reorder_pd_.reset();
+        tail_reorder_pd_.reset();
+        return;
+    }
+    nchunks_ = nchunks;
+    chunk_dim_ = chunk_dim;
+}
+
 void cross_engine_reorder_t::pd_t::init_scratchpad(impl::engine_t *gpu_engine) {
     if (do_reorder_) {
         using namespace memory_tracking::names;
@@ -36,8 +132,12 @@ void cross_engine_reorder_t::pd_t::init_scratchpad(impl::engine_t *gpu_engine) {
         auto needs_dst = desc()->src_engine_kind == reorder_engine_kind_;
         memory_desc_wrapper wspace((needs_dst) ? dst_md() : src_md());
         scratchpad.book(key_reorder_cross_space, wspace.size(), 1, gpu_align);
-        scratchpad.book(key_nested, reorder_pd_->scratchpad_registry().size(),
-                1, gpu_align);
+        size_t nested_size = reorder_pd_->scratchpad_registry().size();
+        for (const auto &c_pd : {chunk_reorder_pd_, tail_reorder_pd_})
+            if (c_pd)
+                nested_size = nstl::max(
+                        nested_size, c_pd->scratchpad_registry().size());
+        scratchpad.book(key_nested, nested_size, 1, gpu_align);
     }
 }
 
@@ -85,8 +185,16 @@ status_t cross_engine_reorder_t::pd_t::init(impl::engine_t *engine,
 
     VDISPATCH_REORDER_SC(maybe_create_zp_precompute_conv_pd(dst_engine),
             "failed to create nested zp precompute convolution");
-    init_scratchpad(
-            (dst_engine->kind() == engine_kind::gpu) ? dst_engine : src_engine);
+
+    impl::engine_t *gpu_engine
+            = dst_engine->kind() == engine_kind::gpu ? dst_engine : src_engine;
+    // Quantization arguments are not split, hence chunks are not used with
+    // them.
+    if (do_reorder_ && !with_sum_ab)
+        init_chunks(reorder_engine, r_attr,
+                utils::downcast<gpu::engine_t *>(gpu_engine)
+                        ->get_buffer_alignment());
+    init_scratchpad(gpu_engine);
     return status::success;
 }
 
@@ -94,11 +202,192 @@ status_t cross_engine_reorder_t::init(impl::engine_t *engine) {
     CHECK(pd()->maybe_create_zp_precompute_conv(
             zp_precomp_conv_, engine, this));
     if (!pd()->do_reorder_) return status::success;
+    if (pd()->chunk_reorder_pd_)
+        CHECK(create_nested_primitive(
+                chunk_reorder_, pd()->chunk_reorder_pd_, engine));
+    if (pd()->tail_reorder_pd_)
+        CHECK(create_nested_primitive(
+                tail_reorder_, pd()->tail_reorder_pd_, engine));
     return create_nested_primitive(reorder_, pd()->reorder_pd_, engine);
 }
 
+status_t cross_engine_reorder_t::execute_chunked(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+    auto *gpu_stream = utils::downcast<gpu::stream_t *>(ctx.stream());
+    auto &deps = gpu_stream->ctx().get_deps();
+
+    const bool from_gpu = pd()->desc()->src_engine_kind == engine_kind::gpu;
+    const auto &src = CTX_IN_STORAGE(DNNL_ARG_FROM);
+    const auto &dst = CTX_OUT_STORAGE(DNNL_ARG_TO);
+    const auto wspace = ctx.get_scratchpad_grantor().get_memory_storage(
+            key_reorder_cross_space);
+
+    memory_desc_wrapper src_mdw(pd()->src_md());
+    memory_desc_wrapper dst_mdw(pd()->dst_md());
+    const dim_t dim0 = src_mdw.dims()[0];
+    const size_t src_point = src_mdw.size() / dim0;
+    const size_t dst_point = dst_mdw.size() / dim0;
+
+    // The reorder runs on the GPU side, and the copy moves its destination
+    // to the CPU, or its source from the CPU, through the workspace.
+    const memory_storage_t &r_src = from_gpu ? src : *wspace;
+    const memory_storage_t &r_dst = from_gpu ? *wspace : dst;
+    const memory_storage_t &c_src = from_gpu ? *wspace : src;
+    const memory_storage_t &c_dst = from_gpu ? dst : *wspace;
+    const size_t c_point = from_gpu ? dst_point : src_point;
+
+    const dim_t nchunks = pd()->nchunks_;
+    const dim_t chunk_dim = pd()->chunk_dim_;
+    const auto chunk_off = [&](dim_t c) { return c * chunk_dim; };
+    const auto chunk_len = [&](dim_t c) {
+        return nstl::min(chunk_dim, dim0 - chunk_off(c));
+    };
+
+    const auto exec_chunk = [&](dim_t c) {
+        const bool is_tail = c == nchunks - 1 && tail_reorder_;
+        const auto &reorder = is_tail ? tail_reorder_ : chunk_reorder_;
+        const size_t off = chunk_off(c), len = chunk_len(c);
+
+        auto src_storage
+                = r_src.get_sub_storage(off * src_point, len * src_point);
+        auto dst_storage
+                = r_dst.get_sub_storage(off * dst_point, len * dst_point);
+        if (!src_storage || !dst_storage) return status::out_of_memory;
+
+        std::unique_ptr<memory_t, memory_deleter_t> src_mem;
+        std::unique_ptr<memory_t, memory_deleter_t> dst_mem;
+        CHECK(safe_ptr_assign(src_mem,
+                new memory_t(ctx.stream()->engine(), reorder->pd()->src_md(),
+                        std::move(src_storage))));
+        CHECK(safe_ptr_assign(dst_mem,
+                new memory_t(ctx.stream()->engine(), reorder->pd()->dst_md(),
+                        std::move(dst_storage))));
+
+        exec_args_t r_args;
+        r_args[DNNL_ARG_SRC] = memory_arg_t {src_mem.get(), true};
+        r_args[DNNL_ARG_DST] = memory_arg_t {dst_mem.get(), false};
+        exec_ctx_t r_ctx(ctx, std::move(r_args));
+
+        nested_scratchpad_t ns(ctx, key_nested, reorder);
+        r_ctx.set_scratchpad_grantor(ns.grantor());
+        return reorder->execute(r_ctx);
+    };
+
+    // The copies of chunks depend only on the events the reorder was called
+    // with, or on the reorder of their chunk for GPU -> CPU, and not on each
+    // other, so a copy may run while the reorder of another chunk does.
+    std::vector<std::unique_ptr<xpu::event_t>> copy_deps(nchunks);
+    const auto copy_chunk = [&](dim_t c, const xpu::event_t &in_deps) {
+        const size_t off = chunk_off(c), len = chunk_len(c);
+        auto from = c_src.get_sub_storage(off * c_point, len * c_point);
+        auto to = c_dst.get_sub_storage(off * c_point, len * c_point);
+        if (!from || !to) return status::out_of_memory;
+        copy_deps[c] = in_deps.clone();
+        return gpu_stream->copy(
+                *from, *to, len * c_point, in_deps, *copy_deps[c]);
+    };
+
+    if (from_gpu) {
+        // GPU -> CPU or GPU -> GPU
+        if (pd()->beta() != 0.f)
+            CHECK(gpu_stream->copy(dst, *wspace, dst_mdw.size(), deps, deps));
+        // The reorder of the next chunk is submitted before the copy of the
+        // current one, which may block the host.
+        CHECK(exec_chunk(0));
+        auto reorder_deps = deps.clone();
+        for (dim_t c = 0; c < nchunks; c++) {
+            std::unique_ptr<xpu::event_t> next_deps;
+            if (c + 1 < nchunks) {
+                CHECK(exec_chunk(c + 1));
+                next_deps = deps.clone();
+            }
+            CHECK(copy_chunk(c, *reorder_deps));
+            reorder_deps = std::move(next_deps);
+        }
+        for (const auto &e : copy_deps)
+            gpu_stream->ctx().append_deps(*e);
+    } else {
+        // CPU -> GPU
+        const auto in_deps = deps.clone();
+        for (dim_t c = 0; c < nchunks; c++) {
+            CHECK(copy_chunk(c, *in_deps));
+            gpu_stream->ctx().append_deps(*copy_deps[c]);
+            CHECK(exec_chunk(c));
+        }
+    }
+    return status::success;
+}
+
+status_t cross_engine_reorder_t::execute_zero_copy(const exec_ctx_t &ctx,
+        const memory_storage_t &host_storage, bool &done) const {
+    using namespace memory_tracking::names;
+    done = false;
+    const bool from_gpu = pd()->desc()->src_engine_kind == engine_kind::gpu;
+    const auto *gpu_engine
+            = utils::downcast<const gpu::engine_t *>(ctx.stream()->engine());
+    void *host_ptr = host_storage.data_handle();
+    if (!gpu_engine->is_zero_copy_ptr(host_ptr)) return status::success;
+
+    const auto &src = CTX_IN_STORAGE(DNNL_ARG_FROM);
+    const auto &dst = CTX_OUT_STORAGE(DNNL_ARG_TO);
+    if (!pd()->do_reorder_) {
+        // The CPU memory object refers to the GPU one, nothing to copy.
+        done = src.data_handle() == dst.data_handle()
+                && src.offset() == dst.offset();
+        return status::success;
+    }
+
+    // The GPU reorder accesses the CPU side memory in place.
+    memory_storage_t *storage_ptr = nullptr;
+    CHECK(ctx.stream()->engine()->create_memory_storage(&storage_ptr,
+            memory_flags_t::use_runtime_ptr | memory_flags_t::prefer_device_usm,
+            0, host_ptr));
+    std::unique_ptr<memory_storage_t> storage(storage_ptr);
+    storage->set_offset(host_storage.offset());
+
+    std::unique_ptr<memory_t, memory_deleter_t> host_mem;
+    CHECK(safe_ptr_assign(host_mem,
+            new memory_t(ctx.stream()->engine(),
+                    from_gpu ? pd()->dst_md() : pd()->src_md(),
+                    std::move(storage))));
+
+    exec_args_t r_args;
+    r_args[DNNL_ARG_SRC] = from_gpu ? ctx.args().at(DNNL_ARG_FROM)
+                                    : memory_arg_t {host_mem.get(), true};
+    r_args[DNNL_ARG_DST] = from_gpu ? memory_arg_t {host_mem.get(), false}
+                                    : ctx.args().at(DNNL_ARG_TO);
+    for (int arg : {DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC,
+                 DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST}) {
+        auto it = ctx.args().find(arg);
+        if (it != ctx.args().end()) r_args[arg] = it->second;
+    }
+    exec_ctx_t r_ctx(ctx, std::move(r_args));
+
+    nested_scratchpad_t ns(ctx, key_nested, reorder_);
+    r_ctx.set_scratchpad_grantor(ns.grantor());
+    CHECK(reorder_->execute(r_ctx));
+    if (!from_gpu)
+        CHECK(pd()->maybe_exec_zp_precompute_conv(ctx, zp_precomp_conv_));
+    done = true;
+    return status::success;
+}
+
 status_t cross_engine_reorder_t::execute(const exec_ctx_t &ctx) const {
     using namespace memory_tracking::names;
+    // On integrated GPUs, CPU memory objects may refer to memory that the GPU
+    // accesses without copies.
+    const bool from_gpu = pd()->desc()->src_engine_kind == engine_kind::gpu;
+    const bool to_gpu = pd()->desc()->dst_engine_kind == engine_kind::gpu;
+    if (from_gpu != to_gpu) {
+        bool done = false;
+        CHECK(execute_zero_copy(ctx,
+                from_gpu ? CTX_OUT_STORAGE(DNNL_ARG_TO)
+                         : CTX_IN_STORAGE(DNNL_ARG_FROM),
+                done));
+        if (done) return status::success;
+    }
+    if (pd()->nchunks_ > 1) return execute_chunked(ctx);
+
     auto *gpu_stream = utils::downcast<gpu::stream_t *>(ctx.stream());
 
     status_t status = status::success;
@@ -38,6 +38,15 @@ namespace generic {
 // For GPU -> CPU reorder, it includes 2 steps:
 // 1. GPU reorder
 // 2. GPU -> CPU copying
+//
+// Large tensors whose outermost dimension is the first one on both sides are
+// split into chunks along it, and the copy of a chunk depends only on the
+// reorder of the same chunk (or on nothing for CPU -> GPU), so the copies
+// overlap the reorders of the other chunks when the runtime allows it.
+//
+// On integrated GPUs, when the CPU side memory is a host or shared USM
+// allocation of the GPU engine, the GPU reorder accesses it in place, and
+// there is nothing to do when both memory objects refer to the same memory.
 struct cross_engine_reorder_t : public gpu::primitive_t {
     using gpu::primitive_t::primitive_t;
     struct pd_t : public gpu_reorder_pd_t {
@@ -52,7 +61,17 @@ struct cross_engine_reorder_t : public gpu::primitive_t {
         engine_kind_t reorder_engine_kind_ = engine_kind::gpu;
         bool do_reorder_ = true;
 
+        // Reorders of a chunk and of the last one when it is shorter, along
+        // with the number of chunks and of the points of the first
+        // dimension per chunk. The tensor is not split when nchunks_ is 1.
+        std::shared_ptr<primitive_desc_t> chunk_reorder_pd_;
+        std::shared_ptr<primitive_desc_t> tail_reorder_pd_;
+        dim_t nchunks_ = 1;
+        dim_t chunk_dim_ = 0;
+
     private:
+        void init_chunks(impl::engine_t *reorder_engine,
+                const primitive_attr_t &r_attr, int gpu_align);
         void init_scratchpad(impl::engine_t *engine);
         DECLARE_GPU_REORDER_CREATE();
     };
@@ -62,7 +81,15 @@ struct cross_engine_reorder_t : public gpu::primitive_t {
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_chunked(const exec_ctx_t &ctx) const;
+    // Runs the reorder without copies when the GPU accesses the CPU side
+    // memory in place, and sets done then.
+    status_t execute_zero_copy(const exec_ctx_t &ctx,
+            const memory_storage_t &host_storage, bool &done) const;
+
     std::shared_ptr<impl::primitive_t> reorder_;
+    std::shared_ptr<impl::primitive_t> chunk_reorder_;
+    std::shared_ptr<impl::primitive_t> tail_reorder_;
     std::shared_ptr<impl::primitive_t> zp_precomp_conv_;
 };
 
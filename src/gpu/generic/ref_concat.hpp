@@ -42,6 +42,8 @@ struct ref_concat_t : public gpu::primitive_t {
 
             VDISPATCH_CONCAT(attr()->has_default_values(sm::scales),
                     VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_CONCAT(attr()->scales_.has_default_values(DNNL_ARG_DST),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
 
             tent_dst_md_ = types::zero_md();
 
@@ -171,6 +173,7 @@ struct ref_concat_t : public gpu::primitive_t {
                     ctx.args().at(DNNL_ARG_DST), nullptr, n));
         } else {
             for (int i = 0; i < n; ++i) {
+                if (pd()->src_is_dst_view(ctx, i)) continue;
                 const auto &src_scales_arg = ctx.args().find(
                         DNNL_ARG_ATTR_SCALES | (DNNL_ARG_MULTIPLE_SRC + i));
 
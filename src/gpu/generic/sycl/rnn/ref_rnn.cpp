@@ -205,6 +205,8 @@ status_t ref_rnn_fwd_t::pd_t::init(impl::engine_t *engine) {
     VDISPATCH_RNN(weights_iter_dt == weights_layer_dt, VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_RNN_SC(this->set_default_params(), VERBOSE_UNSUPPORTED_TAG);
     VDISPATCH_RNN(this->with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_RNN(!this->with_seq_lengths(), VERBOSE_UNSUPPORTED_FEATURE,
+            "sequence lengths");
     VDISPATCH_RNN(IMPLICATION(this->desc()->prop_kind != forward_inference,
                           bias_dt == dnnl_f32),
             VERBOSE_UNSUPPORTED_BIAS_CFG);
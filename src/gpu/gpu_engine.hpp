@@ -19,7 +19,9 @@
 
 #include <mutex>
 
+#include "common/device_memory_pool.hpp"
 #include "common/engine.hpp"
+#include "common/host_staging_pool.hpp"
 #include "common/stream.hpp"
 
 #include "gpu/gpu_impl_list.hpp"
@@ -59,6 +61,11 @@ public:
 
     int get_buffer_alignment() const { return impl()->get_buffer_alignment(); }
 
+    // Returns true when the device accesses the host memory at the pointer
+    // in place, i.e. the pointer is a host or shared USM allocation of the
+    // engine and the device shares physical memory with the host.
+    virtual bool is_zero_copy_ptr(const void *ptr) const { return false; }
+
     status_t get_service_stream(impl::stream_t *&stream) override {
         status_t status = status::success;
         if (service_stream_ == nullptr) {
@@ -75,9 +82,30 @@ public:
         return status;
     }
 
+    host_staging_pool_t *get_host_staging_pool() override {
+        return &host_staging_pool_;
+    }
+
+    // The pool may be disabled with ONEDNN_GPU_MEMORY_POOL=0, e.g. to debug
+    // out of bounds accesses with the runtime tools.
+    device_memory_pool_t *get_device_memory_pool() override {
+        static const bool enabled = getenv_int_user("GPU_MEMORY_POOL", 1);
+        return enabled ? &device_memory_pool_ : nullptr;
+    }
+
+protected:
+    // The cached buffers are freed while the runtime context owned by the
+    // engine implementation is still alive.
+    ~engine_t() override {
+        host_staging_pool_.clear();
+        device_memory_pool_.clear();
+    }
+
 private:
     std::unique_ptr<impl::stream_t> service_stream_;
     std::mutex service_stream_mutex_;
+    host_staging_pool_t host_staging_pool_;
+    device_memory_pool_t device_memory_pool_;
 };
 
 } // namespace gpu
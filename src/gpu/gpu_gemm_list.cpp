@@ -17,6 +17,7 @@
 #include "gpu/gpu_impl_list.hpp"
 
 #if DNNL_GPU_VENDOR == DNNL_VENDOR_INTEL
+#include "gpu/intel/gemm/gemv.hpp"
 #include "gpu/intel/gemm/jit.hpp"
 #include "gpu/intel/gemm/jit_xe_hp_systolic.hpp"
 #include "gpu/intel/gemm/ref.hpp"
@@ -39,6 +40,7 @@ constexpr impl_list_item_t impl_list[] = {
         GPU_INSTANCE_INTEL_DEVMODE(intel::gemm::conv_t)
         GPU_INSTANCE_INTEL(intel::gemm::xe_hp_systolic_t)
         GPU_INSTANCE_INTEL(intel::gemm::with_post_ops_t)
+        GPU_INSTANCE_INTEL(intel::gemm::gemv_t)
         GPU_INSTANCE_INTEL(intel::gemm::gen_t)
         GPU_INSTANCE_INTEL_REF(intel::gemm::ref_t)
         nullptr,
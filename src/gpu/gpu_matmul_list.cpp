@@ -18,7 +18,9 @@
 
 #if DNNL_GPU_VENDOR == DNNL_VENDOR_INTEL
 #include "gpu/intel/matmul/gemm.hpp"
+#include "gpu/intel/matmul/grouped.hpp"
 #include "gpu/intel/matmul/ref.hpp"
+#include "gpu/intel/matmul/sparse.hpp"
 #include "gpu/intel/matmul/sparse_ref.hpp"
 #endif
 
@@ -44,6 +46,8 @@ namespace {
 // clang-format off
 constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         GPU_INSTANCE_INTEL(intel::matmul::gemm_t)
+        GPU_INSTANCE_INTEL(intel::matmul::grouped_t)
+        GPU_INSTANCE_INTEL(intel::matmul::sparse_t)
         GPU_INSTANCE_INTEL(intel::matmul::ref_sparse_t)
         GPU_INSTANCE_INTEL_REF(intel::matmul::ref_t)
         GPU_INSTANCE_NVIDIA(nvidia::cudnn_matmul_lt_t)
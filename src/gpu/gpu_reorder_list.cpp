@@ -21,6 +21,7 @@
 
 #if DNNL_GPU_VENDOR == DNNL_VENDOR_INTEL
 #include "gpu/intel/reorder/custom.hpp"
+#include "gpu/intel/reorder/dynamic_quant.hpp"
 #include "gpu/intel/reorder/generic.hpp"
 #include "gpu/intel/reorder/jit.hpp"
 #include "gpu/intel/reorder/ref.hpp"
@@ -51,6 +52,7 @@ using namespace dnnl::impl::data_type;
 constexpr impl_list_item_t impl_list[] = REG_REORDER_P({
         GPU_REORDER_INSTANCE_INTEL(intel::rnn::weights_reorder_t::pd_t)
         GPU_REORDER_INSTANCE_GENERIC(generic::direct_copy_t::pd_t)
+        GPU_REORDER_INSTANCE_INTEL(intel::reorder::dynamic_quant_t::pd_t)
         GPU_REORDER_INSTANCE_INTEL(intel::reorder::gen_t::pd_t)
         GPU_REORDER_INSTANCE_INTEL(intel::reorder::custom_t::pd_t) // for specific tensor shapes
         GPU_REORDER_INSTANCE_INTEL(intel::reorder::generic_t::pd_t)// fast and quite generic
@@ -46,7 +46,10 @@ public:
     }
     xpu::stream_profiler_t &profiler() { return *profiler_; }
 
-    virtual double get_freq(const xpu::event_t &event) const { return 0.0; }
+    virtual xpu::stream_profiler_t::counters_t get_counters(
+            const xpu::event_t &event) const {
+        return {};
+    }
 
 protected:
     std::unique_ptr<xpu::stream_profiler_t> profiler_;
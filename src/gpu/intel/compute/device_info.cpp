@@ -320,6 +320,8 @@ status_t device_info_t::init_serialized_device_info(
     serialized_device_info_.append(mayiuse_ngen_kernels_);
     serialized_device_info_.append(mayiuse_system_memory_allocators_);
     serialized_device_info_.append(mayiuse_non_uniform_work_groups_);
+    serialized_device_info_.append(host_unified_memory_);
+    serialized_device_info_.append(tile_count_);
 
     const size_t name_size = name_.size();
     serialized_device_info_.append(name_size);
@@ -360,6 +362,8 @@ status_t device_info_t::init_from_cache_blob(
     DESERIALIZE(mayiuse_ngen_kernels_, bool);
     DESERIALIZE(mayiuse_system_memory_allocators_, bool);
     DESERIALIZE(mayiuse_non_uniform_work_groups_, bool);
+    DESERIALIZE(host_unified_memory_, bool);
+    DESERIALIZE(tile_count_, int);
 #undef DESERIALIZE
 
     // name_ is not trivially copyable type
@@ -241,6 +241,14 @@ public:
 
     bool mayiuse_sub_group(int size) const;
 
+    // Returns true when the runtime reports that the device shares physical
+    // memory with the host, as integrated GPUs do.
+    bool has_host_unified_memory() const { return host_unified_memory_; }
+
+    // Returns the number of tiles (sub-devices) of a device exposed with
+    // implicit scaling, or 1.
+    int tile_count() const { return tile_count_; }
+
     bool mayiuse_float_atomic_add(data_type_t type) const;
 
     bool has_native(data_type_t type) const;
@@ -274,6 +282,8 @@ protected:
     bool mayiuse_systolic_ = false;
     bool mayiuse_ngen_kernels_ = false;
     bool mayiuse_system_memory_allocators_ = false;
+    bool host_unified_memory_ = false;
+    int tile_count_ = 1;
 
     std::string name_;
     xpu::runtime_version_t runtime_version_;
@@ -114,6 +114,7 @@ struct multi_t : public primitive_t {
         const auto n = pd()->n_inputs();
         const auto max_batch_size = pd()->max_batch_size();
         if (max_batch_size == pd_t::batch_failure) return status::runtime_error;
+        if (pd()->srcs_are_dst_views(ctx)) return status::success;
 
         auto execute_concat
                 = [&](const std::shared_ptr<impl::primitive_t> &concat,
@@ -442,6 +442,7 @@ status_t simple_t::execute_concat(const exec_ctx_t &ctx) const {
     const auto &conf = pd()->conf;
     const auto &rt_conf = pd()->rt_conf;
     if (conf.n == 0) return status::success;
+    if (pd()->srcs_are_dst_views(ctx)) return status::success;
 
     compute::kernel_arg_list_t arg_list;
     auto &dst = CTX_OUT_STORAGE(DNNL_ARG_DST);
@@ -46,6 +46,8 @@ struct xe_t : public primitive_t {
             VDISPATCH_CONCAT(n_inputs() <= 16, VERBOSE_BAD_PARAM, "n_inputs");
             VDISPATCH_CONCAT(attr()->has_default_values(sm::scales),
                     VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_CONCAT(attr()->scales_.has_default_values(DNNL_ARG_DST),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
             VDISPATCH_CONCAT_SC(set_default_params(), VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_CONCAT(memory_desc_ndims_ok(dst_md()), VERBOSE_BAD_NDIMS,
                     "dst", dst_md()->ndims);
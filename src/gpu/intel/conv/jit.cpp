@@ -16,13 +16,18 @@
 
 #include "gpu/intel/conv/jit.hpp"
 
+#include <limits>
 #include <utility>
+#include <vector>
 
+#include "common/memory.hpp"
 #include "common/utils.hpp"
 #include "common/verbose.hpp"
+#include "gpu/gpu_stream.hpp"
 #include "gpu/gpu_zero_points_conv.hpp"
 #include "gpu/intel/conv/jit/config.hpp"
 #include "gpu/intel/conv/jit/kernel.hpp"
+#include "gpu/intel/conv/jit/lookup_table.hpp"
 #include "gpu/intel/conv/jit/tiler.hpp"
 #include "gpu/intel/conv/jit/zero_out.hpp"
 #include "gpu/intel/jit/ir/kernel_info.hpp"
@@ -145,9 +150,13 @@ public:
             tiler->set_cur_version(primitive->version());
         }
 
+        const int ntune = tune_candidates(primitive, *tiler);
+        std::vector<candidate_t> candidates;
+
         for (int try_iter = 0; try_iter < max_tries; try_iter++) {
             if (try_iter != 0 && !tiler->is_tuning_mode())
                 tiler->move_next(cfg);
+            if (ok && !tiler->is_valid()) break;
             try {
                 cfg = data.pd_cfg;
                 cfg.set_pd(pd);
@@ -232,19 +241,26 @@ public:
                 ok = true;
                 primitive->set_version(tiler->cur_version());
                 kernels_ = std::move(tmp_kernels);
+                if (ntune > 1) {
+                    candidates.push_back({cfg, tiler->cur_version(), kernels_,
+                            nd_ranges_});
+                    if ((int)candidates.size() < ntune) continue;
+                }
                 break;
             } catch (ngen::out_of_registers_exception &err) {
-                if (handle_exception(try_iter, max_tries))
+                if (!ok && handle_exception(try_iter, max_tries))
                     return report_runtime_error(pd, engine, err.what());
                 tiler->notify_out_of_registers(cfg);
                 continue;
             } catch (std::runtime_error &err) {
-                if (handle_exception(try_iter, max_tries))
+                if (!ok && handle_exception(try_iter, max_tries))
                     return report_runtime_error(pd, engine, err.what());
                 continue;
             }
         }
         if (!ok) return report_runtime_error(pd, engine);
+        if (!candidates.empty())
+            select_candidate(primitive, engine, candidates, cfg);
         gpu_assert(kernels_.size() == data.kernel_infos.size());
         CONV_CHECK(primitive->register_kernels(kernels_));
 
@@ -483,6 +499,137 @@ private:
         }
     }
 
+    // A plan that built successfully, benchmarked by the online tuner.
+    struct candidate_t {
+        config_t cfg;
+        int32_t version;
+        std::vector<compute::kernel_t> kernels;
+        std::vector<compute::nd_range_t> nd_ranges;
+    };
+
+    // The number of plans to benchmark on creation, set with
+    // ONEDNN_GPU_CONV_TUNE. Problems with a tuned entry in the user lookup
+    // table use it directly. Problems with attributes are not tuned, as the
+    // tuner only provides the problem tensors.
+    template <typename T>
+    static int tune_candidates(const T *primitive, const tiler_t &tiler) {
+        static const int ntune = getenv_int_user("GPU_CONV_TUNE", 0);
+        if (ntune <= 1) return 0;
+        auto *pd = primitive->pd();
+        if (primitive->cache_blob() || tiler.is_tuning_mode()) return 0;
+        if (tiler_params().mode != tiler_mode_t::lookup) return 0;
+        if (pd->data->zp_pd) return 0;
+        using smask_t = primitive_attr_t::skip_mask_t;
+        if (!pd->attr()->has_default_values(
+                    smask_t::fpmath_mode | smask_t::accumulation_mode))
+            return 0;
+        if (!find_user_lookup_params(pd->data->pd_cfg.key()).is_empty())
+            return 0;
+        return ntune;
+    }
+
+    // Keeps the fastest candidate and records it in the user lookup table.
+    // A failure to benchmark is not fatal, the first candidate is kept then.
+    template <typename T>
+    void select_candidate(T *primitive, impl::engine_t *engine,
+            std::vector<candidate_t> &candidates, config_t &cfg) {
+        size_t best = 0;
+        bool tuned = candidates.size() > 1
+                && benchmark(primitive, engine, candidates, best)
+                        == status::success;
+        if (!tuned) best = 0;
+
+        auto &c = candidates[best];
+        kernels_ = std::move(c.kernels);
+        nd_ranges_ = std::move(c.nd_ranges);
+        primitive->set_version(c.version);
+        cfg = c.cfg;
+        if (!tuned) return;
+
+        const auto undef = blocking_params_t::bufs_hint_undef;
+        update_user_lookup_table(cfg.key().to_filter(),
+                cfg.params((!cfg.slm() && !cfg.prefetch()) ? 0 : undef));
+    }
+
+    // Runs every candidate on zero-initialized tensors on the service stream
+    // and returns the index of the fastest one.
+    template <typename T>
+    status_t benchmark(T *primitive, impl::engine_t *engine,
+            const std::vector<candidate_t> &candidates, size_t &best) {
+        auto *pd = primitive->pd();
+        impl::stream_t *stream = nullptr;
+        CHECK(engine->get_service_stream(stream));
+        if (!stream) return status::runtime_error;
+
+        auto create_zero_storage
+                = [&](size_t size, std::unique_ptr<memory_storage_t> &storage) {
+                      memory_storage_t *ptr = nullptr;
+                      CHECK(engine->create_memory_storage(&ptr, size));
+                      storage.reset(ptr);
+                      if (size == 0) return status::success;
+                      auto *compute_stream
+                              = utils::downcast<gpu::stream_t *>(stream);
+                      return compute_stream->fill(*storage, 0, size,
+                              compute_stream->ctx().get_deps(),
+                              compute_stream->ctx().get_deps());
+                  };
+
+        exec_args_t args;
+        std::vector<std::unique_ptr<memory_t, memory_deleter_t>> mems;
+        for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_BIAS,
+                     DNNL_ARG_DST, DNNL_ARG_DIFF_SRC, DNNL_ARG_DIFF_WEIGHTS,
+                     DNNL_ARG_DIFF_BIAS, DNNL_ARG_DIFF_DST}) {
+            const auto usage = pd->arg_usage(arg);
+            if (usage == primitive_desc_t::arg_usage_t::unused) continue;
+            const memory_desc_t *md = pd->arg_md(arg);
+            std::unique_ptr<memory_storage_t> storage;
+            CHECK(create_zero_storage(memory_desc_wrapper(md).size(), storage));
+            mems.emplace_back();
+            CHECK(safe_ptr_assign(
+                    mems.back(), new memory_t(engine, md, std::move(storage))));
+            args[arg] = {mems.back().get(),
+                    usage == primitive_desc_t::arg_usage_t::input};
+        }
+        std::unique_ptr<memory_storage_t> scratchpad;
+        const size_t scratchpad_size = pd->scratchpad_registry().size();
+        CHECK(create_zero_storage(scratchpad_size, scratchpad));
+
+        exec_ctx_t ctx(stream, std::move(args));
+        auto grantor = pd->scratchpad_registry().grantor(scratchpad.get(), ctx);
+        ctx.set_scratchpad_grantor(&grantor);
+
+        auto run = [&](const candidate_t &c, double &ms) {
+            const int niters = 5;
+            kernels_ = c.kernels;
+            nd_ranges_ = c.nd_ranges;
+            // The first run is a warm-up.
+            CHECK(execute(primitive, ctx));
+            CHECK(stream->wait());
+            const double start_ms = get_msec();
+            for (int iter = 0; iter < niters; iter++)
+                CHECK(execute(primitive, ctx));
+            CHECK(stream->wait());
+            ms = (get_msec() - start_ms) / niters;
+            return status::success;
+        };
+
+        double best_ms = std::numeric_limits<double>::max();
+        status_t status = status::success;
+        stream->before_exec_hook();
+        for (size_t i = 0; i < candidates.size(); i++) {
+            double ms = 0;
+            status = run(candidates[i], ms);
+            if (status != status::success) break;
+            gpu_info() << "Tuning candidate " << i << ": " << ms << " ms";
+            if (ms < best_ms) {
+                best_ms = ms;
+                best = i;
+            }
+        }
+        stream->after_exec_hook();
+        return status;
+    }
+
     static bool can_skip_zero_out(
             const kernel_info_t &info, const config_t &cfg) {
         gpu_assert(info.id() == kernel_id_t::zero_out);
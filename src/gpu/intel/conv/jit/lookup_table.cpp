@@ -16,10 +16,12 @@
 
 #include "gpu/intel/conv/jit/lookup_table.hpp"
 
+#include <cstdio>
 #include <fstream>
 #include <mutex>
 
 #include "common/utils.hpp"
+#include "common/verbose.hpp"
 #include "gpu/intel/jit/utils/utils.hpp"
 
 namespace dnnl {
@@ -123,49 +125,70 @@ void lookup_table_t::parse(std::istream &in) {
 struct lookup_table_instance_t {
     lookup_table_instance_t() {
         table = lookup_table_t(get_lookup_table_entries());
-#ifdef DNNL_DEV_MODE
-        table_path = getenv_string_user(env_table_path_name);
-#endif
-        if (!table_path.empty()) {
-            std::ifstream in(table_path);
+        user_table_path = getenv_string_user(env_table_path_name);
+        if (!user_table_path.empty()) {
+            std::ifstream in(user_table_path);
             if (!in.good()) return;
-            lookup_table_t file_table;
-            file_table.parse(in);
-            table.merge(file_table);
+            user_table.parse(in);
         }
     }
 
-    ~lookup_table_instance_t() {
-        if (table_path.empty()) return;
-        std::ofstream out(table_path, std::ios::binary);
-        table.stringify(out);
+    // The table is written to a temporary file first, so that a process
+    // reading it at start never sees a partially written table.
+    void save_user_table() const {
+        if (user_table_path.empty()) return;
+        const std::string tmp_path = user_table_path + ".tmp";
+        {
+            std::ofstream out(tmp_path, std::ios::binary);
+            if (!out.good()) return;
+            user_table.stringify(out);
+            out << "\n";
+            if (!out.good()) return;
+        }
+        std::rename(tmp_path.c_str(), user_table_path.c_str());
     }
 
     static const char *env_table_path_name;
-    std::string table_path;
+    // The built-in table.
     lookup_table_t table;
+    // The table of tuned entries loaded from and saved to the user file.
+    std::string user_table_path;
+    lookup_table_t user_table;
+    std::mutex user_table_mutex;
 };
 
 const char *lookup_table_instance_t::env_table_path_name
         = "GPU_CONV_LOOKUP_TABLE_PATH";
 
-lookup_table_t &lookup_table_impl(bool read_only = true) {
+lookup_table_instance_t &lookup_table_instance() {
     static lookup_table_instance_t instance;
-    if (!read_only && instance.table_path.empty()) {
+    return instance;
+}
+
+const lookup_table_t &const_lookup_table() {
+    return lookup_table_instance().table;
+}
+
+blocking_params_t find_user_lookup_params(const key_t &key) {
+    auto &instance = lookup_table_instance();
+    std::lock_guard<std::mutex> lock(instance.user_table_mutex);
+    return instance.user_table.find(key);
+}
+
+void update_user_lookup_table(
+        const key_t &key, const blocking_params_t &params) {
+    auto &instance = lookup_table_instance();
+    std::lock_guard<std::mutex> lock(instance.user_table_mutex);
+    if (instance.user_table_path.empty()) {
         static std::once_flag flag;
         std::call_once(flag, [&] {
-            printf("Warning: %s is not set. All tuning data will be lost.\n",
+            VWARN(primitive, gpu,
+                    "ONEDNN_%s is not set, tuning data will be lost",
                     lookup_table_instance_t::env_table_path_name);
         });
     }
-    return instance.table;
-}
-
-const lookup_table_t &const_lookup_table() {
-    return lookup_table_impl();
-}
-lookup_table_t &lookup_table() {
-    return lookup_table_impl(/*read_only=*/false);
+    instance.user_table.set(key, params);
+    instance.save_user_table();
 }
 
 } // namespace jit
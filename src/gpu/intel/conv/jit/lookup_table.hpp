@@ -54,8 +54,16 @@ private:
     std::unordered_map<std::string, std::vector<entry_t>> data_;
 };
 
+// The built-in table.
 const lookup_table_t &const_lookup_table();
-lookup_table_t &lookup_table();
+
+// The table of tuned entries kept in the file set with
+// ONEDNN_GPU_CONV_LOOKUP_TABLE_PATH. It is loaded at start and consulted
+// before the built-in table.
+blocking_params_t find_user_lookup_params(const key_t &key);
+// Records the tuned parameters for the key and saves the table to the file.
+void update_user_lookup_table(
+        const key_t &key, const blocking_params_t &params);
 
 } // namespace jit
 } // namespace conv
@@ -1274,7 +1274,7 @@ public:
     void finalize(const blocking_params_t &params) {
         bool is_best = (tune_data_.best_id() == params.id());
         if (is_best) {
-            lookup_table().set(key_.to_filter(), params);
+            update_user_lookup_table(key_.to_filter(), params);
             best_params_dbg_ = params;
         }
         uint64_t nsec = tune_data_.nsec(params.id());
@@ -1583,7 +1583,9 @@ private:
                 break;
                 break;
             case tiler_mode_t::lookup: {
-                const auto params = const_lookup_table().find(cfg.key());
+                auto params = find_user_lookup_params(cfg.key());
+                if (params.is_empty() || !chk.is_ok(params.blocking()))
+                    params = const_lookup_table().find(cfg.key());
                 if (!params.is_empty() && chk.is_ok(params.blocking())) {
                     gpu_info() << "Using lookup table config: " << params.str();
                     params_gen_ = params_generator_t(tune_level, simd_size, chk,
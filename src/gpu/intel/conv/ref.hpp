@@ -142,11 +142,13 @@ struct ref_fwd_t : public primitive_t {
         if (status != status::success) return status;
         kernels_.resize(2);
 
-        CHECK(create_kernel(
-                engine, &kernels_[0], "ref_convolution_fwd", kernel_ctx));
         if (pd()->subbyte_pack_)
+            CHECK(create_kernels(engine, {&kernels_[0], &kernels_[1]},
+                    {"ref_convolution_fwd", "subbyte_pack"},
+                    {&kernel_ctx, &kernel_ctx}));
+        else
             CHECK(create_kernel(
-                    engine, &kernels_[1], "subbyte_pack", kernel_ctx));
+                    engine, &kernels_[0], "ref_convolution_fwd", kernel_ctx));
         if (!kernels_[0]) return status::runtime_error;
         if (pd()->subbyte_pack_ && !kernels_[1]) return status::runtime_error;
 
@@ -255,11 +257,13 @@ struct ref_bwd_data_t : public primitive_t {
         if (status != status::success) return status;
 
         kernels_.resize(2);
-        CHECK(create_kernel(
-                engine, &kernels_[0], "ref_convolution_bwd_data", kernel_ctx));
         if (pd()->subbyte_pack_)
-            CHECK(create_kernel(
-                    engine, &kernels_[1], "subbyte_pack", kernel_ctx));
+            CHECK(create_kernels(engine, {&kernels_[0], &kernels_[1]},
+                    {"ref_convolution_bwd_data", "subbyte_pack"},
+                    {&kernel_ctx, &kernel_ctx}));
+        else
+            CHECK(create_kernel(engine, &kernels_[0],
+                    "ref_convolution_bwd_data", kernel_ctx));
         if (!kernels_[0]) return status::runtime_error;
         if (pd()->subbyte_pack_ && !kernels_[1]) return status::runtime_error;
 
@@ -370,11 +374,13 @@ struct ref_bwd_weights_t : public primitive_t {
         if (status != status::success) return status;
 
         kernels_.resize(2);
-        CHECK(create_kernel(engine, &kernels_[0], "ref_convolution_bwd_weights",
-                kernel_ctx));
         if (pd()->subbyte_pack_)
-            CHECK(create_kernel(
-                    engine, &kernels_[1], "subbyte_pack", kernel_ctx));
+            CHECK(create_kernels(engine, {&kernels_[0], &kernels_[1]},
+                    {"ref_convolution_bwd_weights", "subbyte_pack"},
+                    {&kernel_ctx, &kernel_ctx}));
+        else
+            CHECK(create_kernel(engine, &kernels_[0],
+                    "ref_convolution_bwd_weights", kernel_ctx));
         if (!kernels_[0]) return status::runtime_error;
         if (pd()->subbyte_pack_ && !kernels_[1]) return status::runtime_error;
 
@@ -14,6 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 
 #include "gpu/intel/engine.hpp"
@@ -65,6 +72,120 @@ void device_info_cache_set(impl::engine_t *engine,
     device_info_cache().insert({intel_engine->device_id(), device_info});
 }
 
+namespace {
+
+// Threads building the programs of independent kernels of a primitive. The
+// number of threads is set with ONEDNN_GPU_COMPILE_THREADS, where 1 makes
+// all kernels be created on the calling thread.
+class compile_pool_t {
+public:
+    static compile_pool_t &get() {
+        // The pool is never destroyed, as its threads may outlive the
+        // static objects at exit.
+        static compile_pool_t *pool = new compile_pool_t();
+        return *pool;
+    }
+
+    int nthr() const { return nthr_; }
+
+    void submit(std::function<void()> &&job) {
+        std::call_once(start_, [this]() {
+            for (int i = 1; i < nthr_; i++)
+                std::thread([this]() { run(); }).detach();
+        });
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            jobs_.push_back(std::move(job));
+        }
+        cv_.notify_one();
+    }
+
+private:
+    compile_pool_t() {
+        int def_nthr = (int)std::min(4u, std::thread::hardware_concurrency());
+        nthr_ = std::max(1, getenv_int_user("GPU_COMPILE_THREADS", def_nthr));
+    }
+
+    void run() {
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]() { return !jobs_.empty(); });
+                job = std::move(jobs_.front());
+                jobs_.pop_front();
+            }
+            job();
+        }
+    }
+
+    int nthr_ = 1;
+    std::once_flag start_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> jobs_;
+};
+
+// Tasks of one run_compile_tasks() call. Threads take the next task until
+// none is left, so a job started after the caller finished all the tasks
+// returns right away.
+struct compile_batch_t {
+    compile_batch_t(size_t n, const std::function<status_t(size_t)> &task)
+        : n(n), task(task) {}
+
+    void run() {
+        for (size_t i = next++; i < n; i = next++) {
+            status_t status = status::runtime_error;
+            std::exception_ptr exception;
+            try {
+                status = task(i);
+            } catch (...) { exception = std::current_exception(); }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (exception && !first_exception) first_exception = exception;
+            if (status != status::success && first_status == status::success)
+                first_status = status;
+            if (++ndone == n) cv.notify_all();
+        }
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this]() { return ndone == n; });
+    }
+
+    const size_t n;
+    const std::function<status_t(size_t)> &task;
+    std::atomic<size_t> next {0};
+    size_t ndone = 0;
+    status_t first_status = status::success;
+    std::exception_ptr first_exception;
+    std::mutex mutex;
+    std::condition_variable cv;
+};
+
+} // namespace
+
+status_t engine_t::run_compile_tasks(
+        size_t n, const std::function<status_t(size_t)> &task) const {
+    auto &pool = compile_pool_t::get();
+    if (n <= 1 || pool.nthr() == 1) {
+        for (size_t i = 0; i < n; i++)
+            CHECK(task(i));
+        return status::success;
+    }
+
+    auto batch = std::make_shared<compile_batch_t>(n, task);
+    size_t njobs = std::min(n, (size_t)pool.nthr()) - 1;
+    for (size_t i = 0; i < njobs; i++)
+        pool.submit([batch]() { batch->run(); });
+    batch->run();
+    batch->wait();
+
+    if (batch->first_exception) std::rethrow_exception(batch->first_exception);
+    return batch->first_status;
+}
+
 status_t engine_t::init() {
     return init({});
 }
@@ -18,6 +18,7 @@
 #define GPU_INTEL_ENGINE_HPP
 
 #include <cassert>
+#include <functional>
 #include <memory>
 #include <vector>
 #include <initializer_list>
@@ -100,6 +101,13 @@ public:
         return status::success;
     };
 
+    // Runs `n` independent kernel creation tasks, e.g. builds of separate
+    // programs, on the compile threads shared by all engines. The calling
+    // thread takes tasks as well, so nested calls never wait for a free
+    // thread. Returns the first failure after all started tasks complete.
+    status_t run_compile_tasks(
+            size_t n, const std::function<status_t(size_t)> &task) const;
+
     status_t get_zero_pad_primitive(
             impl::primitive_t *&result, const resource_mapper_t *&resources) {
         std::call_once(zero_pad_init_, [&]() -> void {
@@ -159,6 +167,21 @@ public:
     bool mayiuse_sub_group(int size) const {
         return device_info_->mayiuse_sub_group(size);
     }
+    bool has_host_unified_memory() const {
+        return device_info_->has_host_unified_memory();
+    }
+    bool use_zero_copy_memory() const override {
+        static const bool enabled = getenv_int_user("GPU_ZERO_COPY", 0) != 0;
+        return enabled && has_host_unified_memory();
+    }
+    // Returns the number of tiles that large problems are partitioned
+    // between, enabled on devices with several tiles and implicit scaling
+    // with ONEDNN_GPU_TILE_PARTITION=1.
+    int tile_partition_count() const {
+        static const bool enabled
+                = getenv_int_user("GPU_TILE_PARTITION", 0) != 0;
+        return enabled ? device_info_->tile_count() : 1;
+    }
     bool mayiuse_sub_group(std::initializer_list<int> sizes) const {
         for (int size : sizes)
             if (!mayiuse_sub_group(size)) return false;
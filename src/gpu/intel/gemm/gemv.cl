@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/intel/include/math_utils.h"
+#include "gpu/intel/include/types.h"
+
+#if WEI_SCALES_DT_BF16
+#define WEI_SCALES_TO_REF(x) cvt_bf16_to_f32(x)
+#else
+#define WEI_SCALES_TO_REF(x) convert_float(x)
+#endif
+
+#if WEI_ZP_DT_S4 || WEI_ZP_DT_U4
+#define WEI_ZP_BITS 4
+#else
+#define WEI_ZP_BITS 8
+#endif
+
+// The number of weights in the 8 bytes a lane reads at once.
+#define CHUNK (64 / WEI_BITS)
+#define K_STEP (SG_SIZE * CHUNK)
+#define WEI_SIGNED (WEI_DT_S4 || WEI_DT_S8)
+
+float load_zp(__global const uchar *zp, dim_t off) {
+#if WEI_ZP_DT_S4
+    return cvt_s4_to_f32(get_half_byte((__global const char *)zp, off));
+#elif WEI_ZP_DT_U4
+    return convert_float(get_half_byte(zp, off));
+#elif WEI_ZP_DT_S32
+    return convert_float(((__global const int *)zp)[off]);
+#elif WEI_ZP_DT_S8
+    return convert_float(((__global const char *)zp)[off]);
+#else
+    return convert_float(zp[off]);
+#endif
+}
+
+// Unpacks the weights of a chunk, the low nibble of a byte first.
+void unpack_chunk(uchar8 bytes, float *w) {
+    const uchar b[8] = {bytes.s0, bytes.s1, bytes.s2, bytes.s3, bytes.s4,
+            bytes.s5, bytes.s6, bytes.s7};
+    for (int i = 0; i < 8; i++) {
+#if WEI_BITS == 4
+#if WEI_SIGNED
+        w[2 * i] = cvt_s4_to_f32((char)(b[i] & 0xf));
+        w[2 * i + 1] = cvt_s4_to_f32((char)(b[i] >> 4));
+#else
+        w[2 * i] = convert_float(b[i] & 0xf);
+        w[2 * i + 1] = convert_float(b[i] >> 4);
+#endif
+#elif WEI_SIGNED
+        w[i] = convert_float(as_char(b[i]));
+#else
+        w[i] = convert_float(b[i]);
+#endif
+    }
+}
+
+// A work-group computes the output channel n of all the rows. Its NSPLIT
+// sub-groups take interleaved steps of K_STEP weights, and lane l of a
+// sub-group reads the chunk of CHUNK weights at offset l * CHUNK of a step.
+// The scale and the zero point of the chunk are applied to the dot product
+// with the source once: scale * (sum(w * x) - zp * sum(x)).
+__attribute__((intel_reqd_sub_group_size(SG_SIZE))) __kernel void
+gemv_wei_decomp(__global const uchar *wei, __global const SRC_DATA_T *src,
+        __global DST_DATA_T *dst, __global const BIA_DATA_T *bias,
+        __global const WEI_SCALES_DATA_T *scales, __global const uchar *zp,
+        dim_t wei_off, dim_t src_off, dim_t dst_off, dim_t bia_off) {
+    const dim_t n = get_group_id(0);
+    const int sg = get_sub_group_id();
+    const int lane = get_sub_group_local_id();
+
+    __global const uchar *wei_n = wei + wei_off + n * WEI_LD * WEI_BITS / 8;
+    src += src_off;
+
+    float acc[ROWS];
+    for (int r = 0; r < ROWS; r++)
+        acc[r] = 0.f;
+
+    for (dim_t k0 = (sg * SG_SIZE + lane) * CHUNK; k0 < K;
+            k0 += NSPLIT * K_STEP) {
+        float w[CHUNK];
+        unpack_chunk(vload8(0, wei_n + k0 * WEI_BITS / 8), w);
+
+#if WITH_WEI_SCALES
+        const float scale = WEI_SCALES_TO_REF(
+                scales[(k0 / WEI_SCALES_GROUP_K) * WEI_SCALES_K_STRIDE
+                        + n * WEI_SCALES_N_STRIDE]);
+#else
+        const float scale = 1.f;
+#endif
+#if WITH_WEI_ZP
+        const float wzp = load_zp(zp,
+                (k0 / WEI_ZP_GROUP_K) * WEI_ZP_K_STRIDE + n * WEI_ZP_N_STRIDE);
+#endif
+
+        for (int r = 0; r < ROWS; r++) {
+            __global const SRC_DATA_T *x = src + r * SRC_LD + k0;
+            float dot = 0.f;
+            float xsum = 0.f;
+            for (int i = 0; i < CHUNK; i++) {
+                const float xi = SRC_TO_REF(x[i]);
+                dot = fma(w[i], xi, dot);
+                xsum += xi;
+            }
+#if WITH_WEI_ZP
+            dot = fma(-wzp, xsum, dot);
+#endif
+            acc[r] = fma(scale, dot, acc[r]);
+        }
+    }
+
+    for (int r = 0; r < ROWS; r++)
+        acc[r] = sub_group_reduce_add(acc[r]);
+
+#if NSPLIT > 1
+    __local float partial[NSPLIT * ROWS];
+    if (lane == 0) {
+        for (int r = 0; r < ROWS; r++)
+            partial[sg * ROWS + r] = acc[r];
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+    if (sg != 0) return;
+    for (int r = 0; r < ROWS; r++) {
+        acc[r] = 0.f;
+        for (int s = 0; s < NSPLIT; s++)
+            acc[r] += partial[s * ROWS + r];
+    }
+#endif
+
+    if (lane != 0) return;
+#if WITH_BIAS
+    const float b = BIA_TO_REF(bias[bia_off + n]);
+#else
+    const float b = 0.f;
+#endif
+    for (int r = 0; r < ROWS; r++)
+        dst[dst_off + r * DST_LD + n] = TO_DST(acc[r] + b);
+}
@@ -0,0 +1,225 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/intel/gemm/gemv.hpp"
+#include "gpu/intel/compute/utils.hpp"
+#include "gpu/intel/engine.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+namespace gemm {
+
+bool gemv_t::pd_t::set_default_formats() {
+    // The weights are streamed along K.
+    auto &wei_md = desc_.b_desc;
+    if (memory_desc_wrapper(wei_md).format_any()
+            && memory_desc_init_by_tag(wei_md, format_tag::ba)
+                    != status::success)
+        return false;
+    return gemm::pd_t::set_default_formats();
+}
+
+bool gemv_t::pd_t::init_quant(const quant_entry_t &entry, quant_t &q) const {
+    const dim_t N = desc()->c_desc.dims[1];
+    const dim_t K = desc()->a_desc.dims[1];
+    if (entry.has_default_values()) return true;
+
+    // The mask is over the (K, N) dimensions of the weights.
+    const int mask = entry.get_mask();
+    const bool per_k = mask & (1 << 0);
+    const bool per_n = mask & (1 << 1);
+    q.with = true;
+    q.dt = entry.get_data_type();
+    q.group_k = per_k ? entry.get_group(0) : K;
+    q.k_stride = per_k ? (per_n ? N : 1) : 0;
+    q.n_stride = per_n ? 1 : 0;
+
+    // A chunk of weights read by a lane shares the parameter.
+    const bool groups_ok = IMPLICATION(per_k,
+            !entry.has_default_groups() && entry.get_group(1) == 1
+                    && K % q.group_k == 0 && q.group_k % chunk() == 0);
+    return groups_ok;
+}
+
+status_t gemv_t::pd_t::init(impl::engine_t *engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+    auto *intel_engine = utils::downcast<intel::engine_t *>(engine);
+    const auto d = desc();
+
+    const auto src_dt = d->a_desc.data_type;
+    const auto wei_dt = d->b_desc.data_type;
+    const auto dst_dt = d->c_desc.data_type;
+    const auto bia_dt = d->bias_type();
+
+    VDISPATCH_GEMM(d->c_desc.ndims == 2, VERBOSE_BAD_NDIMS, "dst",
+            d->c_desc.ndims);
+    VDISPATCH_GEMM(!utils::one_of(DNNL_RUNTIME_DIM_VAL, d->m(), d->n(), d->k()),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_GEMM(d->c_desc.dims[0] <= max_rows, VERBOSE_SHAPE_RESTRICTION);
+    VDISPATCH_GEMM(utils::one_of(wei_dt, s4, u4, s8, u8)
+                    && utils::one_of(src_dt, f32, bf16, f16)
+                    && utils::one_of(dst_dt, f32, bf16, f16)
+                    && utils::one_of(bia_dt, undef, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_GEMM(d->acc_type == f32, VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_GEMM(attr()->mayiconvert(wei_dt, f32),
+            VERBOSE_UNSUPPORTED_FPMATH_MODE);
+    VDISPATCH_GEMM(d->sum_ab == sum_ab::sum_none, VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_GEMM(
+            attr()->has_default_values(smask_t::scales_data_type
+                    | smask_t::scales_groups | smask_t::zero_points_data_type
+                    | smask_t::zero_points_groups | smask_t::fpmath_mode),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_GEMM(attr()->scales_.has_default_values({DNNL_ARG_A}),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_GEMM(attr()->zero_points_.has_default_values({DNNL_ARG_A}),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    VDISPATCH_GEMM(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_GEMM(!has_blocks(), VERBOSE_UNSUPPORTED_FEATURE,
+            "blocked format");
+
+    const dim_t N = d->c_desc.dims[1];
+    const dim_t K = d->a_desc.dims[1];
+    const auto &src_strides = d->a_desc.format_desc.blocking.strides;
+    const auto &wei_strides = d->b_desc.format_desc.blocking.strides;
+    const auto &dst_strides = d->c_desc.format_desc.blocking.strides;
+    VDISPATCH_GEMM(src_strides[1] == 1 && wei_strides[0] == 1
+                    && dst_strides[1] == 1,
+            VERBOSE_UNSUPPORTED_MEM_STRIDE);
+    src_ld_ = src_strides[0];
+    wei_ld_ = wei_strides[1];
+    dst_ld_ = dst_strides[0];
+    // The chunks of weights are whole bytes.
+    VDISPATCH_GEMM(K % chunk() == 0
+                    && (wei_ld_ * types::data_type_bits(wei_dt)) % 8 == 0,
+            VERBOSE_SHAPE_RESTRICTION);
+    VDISPATCH_GEMM(IMPLICATION(bia_dt != undef,
+                           d->bias_desc.dims[0] == 1
+                                   && d->bias_desc.dims[1] == N),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+
+    VDISPATCH_GEMM(init_quant(attr()->scales_.get(DNNL_ARG_A), scales_),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_GEMM(utils::one_of(scales_.dt, undef, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_GEMM(init_quant(attr()->zero_points_.get(DNNL_ARG_A), zp_),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    VDISPATCH_GEMM(utils::one_of(zp_.dt, undef, s4, u4, s8, u8, s32),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+
+    VDISPATCH_GEMM(intel_engine->mayiuse_sub_group(sg_size_),
+            VERBOSE_UNSUPPORTED_DEVICE_FEATURE, "subgroup");
+
+    // Splitting K between up to 16 sub-groups keeps the device occupied
+    // with few output channels.
+    const dim_t max_nsplit = 16;
+    const dim_t hw_threads = intel_engine->device_info()->hw_threads();
+    const dim_t k_steps = utils::div_up(K, sg_size_ * chunk());
+    nsplit_ = nstl::max<dim_t>(1,
+            nstl::min(max_nsplit,
+                    nstl::min(k_steps, utils::div_up(hw_threads, N))));
+
+    return status::success;
+}
+
+status_t gemv_t::init(impl::engine_t *engine) {
+    using namespace data_type;
+    compute::kernel_ctx_t kernel_ctx;
+
+    const auto d = pd()->desc();
+    const auto wei_dt = d->b_desc.data_type;
+    const auto &scales = pd()->scales_;
+    const auto &zp = pd()->zp_;
+
+    kernel_ctx.set_data_type(d->c_desc.data_type);
+    def_data_type(kernel_ctx, d->a_desc.data_type, "SRC");
+    def_data_type(kernel_ctx, wei_dt, "WEI");
+    def_data_type(kernel_ctx, d->c_desc.data_type, "DST");
+    def_data_type(kernel_ctx, d->bias_type(), "BIA");
+    def_data_type(kernel_ctx, scales.with ? scales.dt : f32, "WEI_SCALES");
+    def_data_type(kernel_ctx, zp.with ? zp.dt : s32, "WEI_ZP");
+
+    kernel_ctx.define_int("SG_SIZE", pd()->sg_size_);
+    kernel_ctx.define_int("NSPLIT", pd()->nsplit_);
+    kernel_ctx.define_int("ROWS", d->c_desc.dims[0]);
+    kernel_ctx.define_int("K", d->a_desc.dims[1]);
+    kernel_ctx.define_int("WEI_BITS", types::data_type_bits(wei_dt));
+    kernel_ctx.define_int("WEI_LD", pd()->wei_ld_);
+    kernel_ctx.define_int("SRC_LD", pd()->src_ld_);
+    kernel_ctx.define_int("DST_LD", pd()->dst_ld_);
+    kernel_ctx.define_int("WITH_BIAS", d->bias_type() != undef);
+    kernel_ctx.define_int("WITH_WEI_SCALES", scales.with);
+    kernel_ctx.define_int("WEI_SCALES_GROUP_K", scales.group_k);
+    kernel_ctx.define_int("WEI_SCALES_K_STRIDE", scales.k_stride);
+    kernel_ctx.define_int("WEI_SCALES_N_STRIDE", scales.n_stride);
+    kernel_ctx.define_int("WITH_WEI_ZP", zp.with);
+    kernel_ctx.define_int("WEI_ZP_GROUP_K", zp.group_k);
+    kernel_ctx.define_int("WEI_ZP_K_STRIDE", zp.k_stride);
+    kernel_ctx.define_int("WEI_ZP_N_STRIDE", zp.n_stride);
+
+    CHECK(create_kernel(engine, &kernel_, "gemv_wei_decomp", kernel_ctx));
+    if (!kernel_) return status::runtime_error;
+
+    return status::success;
+}
+
+status_t gemv_t::execute(const exec_ctx_t &ctx) const {
+    const auto d = pd()->desc();
+    // See the note in gpu/intel/gemm/primitive.hpp for the naming of the
+    // arguments: A is the weights and B is the source here.
+    const auto &wei = GEMM_CTX_ARG_STORAGE(a);
+    const auto &src = GEMM_CTX_ARG_STORAGE(b);
+    const auto &bias = GEMM_CTX_ARG_STORAGE(bias);
+    const auto &wei_scales = GEMM_CTX_ARG_STORAGE(a_scales);
+    const auto &wei_zp = GEMM_CTX_ARG_STORAGE(a_zero_point);
+    auto &dst = GEMM_CTX_ARG_STORAGE(c);
+
+    const dim_t N = d->c_desc.dims[1];
+    if (N == 0 || d->c_desc.dims[0] == 0) return status::success;
+
+    const auto src_dt_size = types::data_type_size(d->a_desc.data_type);
+    const auto dst_dt_size = types::data_type_size(d->c_desc.data_type);
+    const dim_t bia_off = d->bias_type() != data_type::undef
+            ? bias.offset() / types::data_type_size(d->bias_type())
+            : 0;
+
+    compute::kernel_arg_list_t arg_list;
+    arg_list.set(0, wei);
+    arg_list.set(1, src);
+    arg_list.set(2, dst);
+    arg_list.set(3, bias);
+    arg_list.set(4, wei_scales);
+    arg_list.set(5, wei_zp);
+    arg_list.set(6, (dim_t)wei.offset());
+    arg_list.set(7, (dim_t)(src.offset() / src_dt_size));
+    arg_list.set(8, (dim_t)(dst.offset() / dst_dt_size));
+    arg_list.set(9, bia_off);
+
+    const size_t wg_size = pd()->sg_size_ * pd()->nsplit_;
+    const compute::range_t gws = {(size_t)N * wg_size};
+    const compute::range_t lws = {wg_size};
+
+    return parallel_for(ctx, compute::nd_range_t(gws, lws), kernel_, arg_list);
+}
+
+} // namespace gemm
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_INTEL_GEMM_GEMV_HPP
+#define GPU_INTEL_GEMM_GEMV_HPP
+
+#include "gpu/intel/gemm/config.hpp"
+#include "gpu/intel/gemm/primitive.hpp"
+#include "gpu/intel/primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+namespace gemm {
+
+// GEMV-shaped gemm with weight-only quantization for the decode phase of
+// language models: up to 8 rows of f32, bf16 or f16 source, and s4, u4, s8
+// or u8 weights with scales and zero points grouped along K.
+//
+// In the terms of the row-major gemm descriptor, the source is a_desc (M x K),
+// the weights are b_desc (K x N) and the destination is c_desc (M x N). The
+// weights are read with K contiguous, which is the default layout the
+// implementation picks for them. A sub-group computes one output channel for
+// all the rows: its lanes read consecutive chunks of 8 bytes of the weights
+// and the partial sums are reduced over the lanes. When there are too few
+// output channels to occupy the device, K is split between the sub-groups of
+// a work-group, and the partial sums are reduced through shared local memory.
+struct gemv_t : public primitive_t {
+    using primitive_t::primitive_t;
+    struct pd_t : public gemm::pd_t {
+        using gemm::pd_t::pd_t;
+
+        DECLARE_COMMON_PD_T("ocl:gemv", gemv_t);
+
+        status_t init(impl::engine_t *engine);
+
+        // Quantization parameters of the weights. A group of `group_k`
+        // values along K shares the same parameter, at the offset
+        // `k_stride * (k / group_k) + n_stride * n`.
+        struct quant_t {
+            bool with = false;
+            data_type_t dt = data_type::undef;
+            dim_t group_k = 0;
+            dim_t k_stride = 0;
+            dim_t n_stride = 0;
+        };
+
+        static constexpr int max_rows = 8;
+
+        int sg_size_ = 16;
+        // The number of sub-groups splitting K.
+        dim_t nsplit_ = 1;
+        dim_t wei_ld_ = 0;
+        dim_t src_ld_ = 0;
+        dim_t dst_ld_ = 0;
+        quant_t scales_;
+        quant_t zp_;
+
+        // The number of weights a lane reads at once.
+        dim_t chunk() const {
+            return types::data_type_bits(desc()->b_desc.data_type) == 4 ? 16
+                                                                         : 8;
+        }
+
+    private:
+        bool set_default_formats();
+        bool init_quant(const quant_entry_t &entry, quant_t &q) const;
+    };
+
+    status_t init(impl::engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    compute::kernel_t kernel_;
+};
+
+} // namespace gemm
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -517,14 +517,15 @@ status_t xe_hp_systolic_t::init(impl::engine_t *engine) {
     }
 
     // Initialize copy kernels (OpenCL)
+    using copy_kernel_params_t = xe_systolic_copy_kernel_t;
+    std::vector<compute::kernel_t *> copy_kernels;
+    std::vector<const char *> copy_kernel_names;
+    std::vector<copy_kernel_params_t> copy_kernel_params;
     for (bool copy_b : {false, true}) {
         for (bool clear_sum : {false, true}) {
             if (clear_sum && !pd()->with_ab_zero_points()) continue;
             if (!copy_b ? pd()->packed_a() : pd()->packed_b()) continue;
 
-            using copy_kernel_params_t = xe_systolic_copy_kernel_t;
-            compute::kernel_ctx_t kernel_ctx;
-
             auto trans
                     = !copy_b ? pd()->desc()->transa() : pd()->desc()->transb();
             copy_kernel_params_t params;
@@ -532,14 +533,18 @@ status_t xe_hp_systolic_t::init(impl::engine_t *engine) {
                     pd()->unroll_n(), copy_b, trans,
                     pd()->with_ab_zero_points(), clear_sum));
 
-            // TODO: Refactor so this can be switched to 1 batch compilation.
-            // Having up to 4 calls to the OpenCL compiler is sub-optimal.
-            CHECK(create_kernel(engine, copy_kernel_[copy_b][clear_sum],
-                    params.name(), params));
-            if (!copy_kernel_[copy_b][clear_sum]) return status::runtime_error;
+            copy_kernels.push_back(&copy_kernel_[copy_b][clear_sum]);
+            copy_kernel_names.push_back(params.name());
+            copy_kernel_params.push_back(params);
         }
     }
 
+    // The up to 4 programs are built concurrently.
+    CHECK(create_kernels(
+            engine, copy_kernels, copy_kernel_names, copy_kernel_params));
+    for (auto *k : copy_kernels)
+        if (!*k) return status::runtime_error;
+
     if (get_verbose(verbose_t::debuginfo) >= 2) {
         verbose_printf("info,gpu,gemm,kernel:%dx%d,%dx%dx%d\n",
                 pd()->unroll_m(), pd()->unroll_n(), compute_info_.wg[LoopM],
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2023-2024 Intel Corporation
+* Copyright 2023-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,6 +14,23 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
 #include "gpu/intel/kernel_cache.hpp"
 
 namespace dnnl {
@@ -23,6 +40,208 @@ namespace intel {
 
 using namespace compute;
 
+status_t get_persistent_kernels(impl::engine_t *engine, const kernel_t &kernel,
+        persistent_kernels_t &pkernels) {
+    if (!kernel) return status::unimplemented;
+    pkernels.binaries.emplace_back();
+    CHECK(kernel.get_binary(engine, pkernels.binaries.back()));
+    pkernels.kernels.push_back({kernel.name(), 0});
+    return status::success;
+}
+
+status_t get_persistent_kernels(impl::engine_t *engine,
+        const kernel_bundle_t &bundle, persistent_kernels_t &pkernels) {
+    // The kernels of a bundle are usually built from one program.
+    std::unordered_map<size_t, size_t> binary_idx;
+    for (const auto &entry : bundle.bundle) {
+        const kernel_t &kernel = entry.second;
+        if (!kernel) return status::unimplemented;
+        xpu::binary_t binary;
+        CHECK(kernel.get_binary(engine, binary));
+        const size_t hash = serialization_stream_t::get_hash(binary);
+        auto it = binary_idx.find(hash);
+        if (it == binary_idx.end()
+                || pkernels.binaries[it->second] != binary) {
+            it = binary_idx.emplace(hash, pkernels.binaries.size()).first;
+            pkernels.binaries.push_back(std::move(binary));
+        }
+        pkernels.kernels.push_back({entry.first, it->second});
+    }
+    return status::success;
+}
+
+status_t create_from_persistent_kernels(const intel::engine_t &engine,
+        const persistent_kernels_t &pkernels, kernel_t &kernel) {
+    if (pkernels.kernels.size() != 1) return status::runtime_error;
+    const auto &pkernel = pkernels.kernels[0];
+    return engine.create_kernel_from_binary(kernel,
+            pkernels.binaries[pkernel.binary_idx], pkernel.name.c_str(), {});
+}
+
+status_t create_from_persistent_kernels(const intel::engine_t &engine,
+        const persistent_kernels_t &pkernels, kernel_bundle_t &bundle) {
+    for (const auto &pkernel : pkernels.kernels) {
+        kernel_t kernel;
+        CHECK(engine.create_kernel_from_binary(kernel,
+                pkernels.binaries[pkernel.binary_idx], pkernel.name.c_str(),
+                {}));
+        bundle.bundle[pkernel.name] = std::move(kernel);
+    }
+    return status::success;
+}
+
+namespace {
+
+const std::string &get_persistent_cache_dir() {
+    static const std::string dir = []() {
+        std::string value = getenv_path_user("GPU_KERNEL_CACHE_DIR");
+        // Strip trailing separators to keep file names canonical.
+        while (value.size() > 1
+                && (value.back() == '/' || value.back() == '\\'))
+            value.pop_back();
+        return value;
+    }();
+    return dir;
+}
+
+// The persistent kernel cache stores the kernels created on a kernel cache
+// miss in a file per key. The file starts with the description of the key,
+// which is the serialization of the key, the device, the driver and the
+// library version, and it is only used when the description matches. The
+// kernels are stored as program binaries and created with
+// create_kernel_from_binary(), e.g. clCreateProgramWithBinary() for OpenCL.
+struct persistent_cache_entry_t {
+    persistent_cache_entry_t(
+            const gpu_kernel_key_impl_t &key, impl::engine_t *engine)
+        : key_(key), engine_(engine) {
+        const auto &dir = get_persistent_cache_dir();
+        if (dir.empty()) return;
+
+        auto *intel_engine = utils::downcast<intel::engine_t *>(engine);
+        const auto *info = intel_engine->device_info();
+        const auto &version = info->runtime_version();
+        const auto *lib_version = dnnl_version();
+        const std::string lib_hash = lib_version->hash;
+        const std::string device_name = info->name();
+        const auto device_id = intel_engine->device_id();
+
+        key_.serialize(desc_);
+        desc_.append(static_cast<int>(engine->runtime_kind()),
+                std::get<0>(device_id), std::get<1>(device_id),
+                std::get<2>(device_id), static_cast<int>(info->gpu_arch()));
+        desc_.append(version.major, version.minor, version.build);
+        desc_.append(lib_version->major, lib_version->minor,
+                lib_version->patch);
+        desc_.append_array(lib_hash.size(), lib_hash.data());
+        desc_.append_array(device_name.size(), device_name.data());
+
+        std::ostringstream oss;
+        oss << dir << "/" << std::hex << desc_.get_hash() << ".bin";
+        path_ = oss.str();
+    }
+
+    bool is_enabled() const { return !path_.empty(); }
+
+    status_t load(gpu_kernel_value_t &generator) const {
+        std::ifstream ifs(path_, std::ios::binary);
+        if (!ifs) return status::runtime_error;
+        const std::vector<uint8_t> data {
+                std::istreambuf_iterator<char>(ifs),
+                std::istreambuf_iterator<char>()};
+
+        size_t off = 0;
+        const auto read = [&](void *ptr, size_t size) {
+            if (data.size() - off < size) return false;
+            std::memcpy(ptr, data.data() + off, size);
+            off += size;
+            return true;
+        };
+        const auto read_size = [&](size_t &size) {
+            return read(&size, sizeof(size))
+                    && size <= data.size() - std::min(off, data.size());
+        };
+
+        const auto &desc = desc_.get_data();
+        size_t size = 0;
+        if (!read_size(size) || size != desc.size()
+                || std::memcmp(data.data() + off, desc.data(), size) != 0)
+            return status::runtime_error;
+        off += size;
+
+        persistent_kernels_t pkernels;
+        size_t nbinaries = 0, nkernels = 0;
+        if (!read_size(nbinaries)) return status::runtime_error;
+        pkernels.binaries.resize(nbinaries);
+        for (auto &binary : pkernels.binaries) {
+            if (!read_size(size)) return status::runtime_error;
+            binary.resize(size);
+            if (!read(binary.data(), size)) return status::runtime_error;
+        }
+        if (!read_size(nkernels)) return status::runtime_error;
+        pkernels.kernels.resize(nkernels);
+        for (auto &kernel : pkernels.kernels) {
+            if (!read_size(size)) return status::runtime_error;
+            kernel.name.resize(size);
+            if (!read(&kernel.name[0], size)
+                    || !read(&kernel.binary_idx, sizeof(kernel.binary_idx))
+                    || kernel.binary_idx >= nbinaries)
+                return status::runtime_error;
+        }
+        if (off != data.size()) return status::runtime_error;
+
+        return key_.create_from_persistent_kernels(
+                engine_, pkernels, generator);
+    }
+
+    status_t store(const gpu_kernel_value_t &generator) const {
+        persistent_kernels_t pkernels;
+        CHECK(key_.get_persistent_kernels(engine_, generator, pkernels));
+
+        serialization_stream_t sstream;
+        const auto &desc = desc_.get_data();
+        sstream.append_array(desc.size(), desc.data());
+        sstream.append(pkernels.binaries.size());
+        for (const auto &binary : pkernels.binaries)
+            sstream.append_array(binary.size(), binary.data());
+        sstream.append(pkernels.kernels.size());
+        for (const auto &kernel : pkernels.kernels) {
+            sstream.append_array(kernel.name.size(), kernel.name.data());
+            sstream.append(kernel.binary_idx);
+        }
+
+        // Another process may store the same kernels meanwhile, so the file
+        // is written under a unique name and renamed when it is complete.
+        std::ostringstream oss;
+        oss << path_ << ".tmp." << std::this_thread::get_id() << "."
+            << std::random_device()();
+        const std::string tmp_path = oss.str();
+        {
+            std::ofstream ofs(tmp_path, std::ios::binary | std::ios::trunc);
+            const auto &data = sstream.get_data();
+            ofs.write(reinterpret_cast<const char *>(data.data()),
+                    static_cast<std::streamsize>(data.size()));
+            if (!ofs) {
+                ofs.close();
+                std::remove(tmp_path.c_str());
+                return status::runtime_error;
+            }
+        }
+        if (std::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+            std::remove(tmp_path.c_str());
+            return status::runtime_error;
+        }
+        return status::success;
+    }
+
+private:
+    const gpu_kernel_key_impl_t &key_;
+    impl::engine_t *engine_;
+    serialization_stream_t desc_;
+    std::string path_;
+};
+
+} // namespace
+
 status_t get_or_create(const kernel_cache::key_t &key,
         gpu_kernel_value_t &jit_generator, impl::engine_t *engine,
         cache_state_t &kernel_cache_hit) {
@@ -35,8 +254,20 @@ status_t get_or_create(const kernel_cache::key_t &key,
     kernel_cache::iface_t::create_func_ptr_t create = [](void *context) {
         auto &c = *static_cast<create_context_t *>(context);
         gpu_kernel_value_t generator;
+        persistent_cache_entry_t entry(c.params, c.engine);
+        if (entry.is_enabled() && entry.load(generator) == status::success) {
+            c.cache_status = cache_state_t::persistent_hit;
+            return kernel_cache::iface_t::result_t {
+                    generator.release(), status::success};
+        }
         auto status = c.params.create_generator(c.engine, generator);
         c.cache_status = cache_state_t::miss;
+        // The kernels are created anyway, so a failure to store them is only
+        // reported in the verbose output.
+        if (status == status::success && entry.is_enabled()
+                && entry.store(generator) != status::success)
+            VWARN(common, runtime,
+                    "could not store kernels in the persistent kernel cache");
         return kernel_cache::iface_t::result_t {generator.release(), status};
     };
     create_context_t context {
@@ -18,7 +18,10 @@
 #define GPU_INTEL_KERNEL_CACHE_HPP
 
 #include <memory>
+#include <string>
 #include <type_traits>
+#include <typeinfo>
+#include <vector>
 
 #include "common/cache_hit_types.hpp"
 #include "common/engine_id.hpp"
@@ -109,6 +112,10 @@ struct trivial_key_t : public T {
     }
     size_t hash() const { return hash_; }
 
+    const serialization_stream_t &get_serialization() const {
+        return serialization;
+    }
+
     bool is_valid() const {
         const T *base = this;
         return trivial_key_validator_t<T>::is_valid(*base);
@@ -145,10 +152,42 @@ private:
     std::shared_ptr<kernel_cache::value_impl_t> impl_;
 };
 
+// The binary of a kernel stored in the persistent kernel cache. The kernels
+// of a bundle built from one program refer to the same binary.
+struct persistent_kernel_t {
+    std::string name;
+    size_t binary_idx;
+};
+
+struct persistent_kernels_t {
+    std::vector<persistent_kernel_t> kernels;
+    std::vector<xpu::binary_t> binaries;
+};
+
+status_t get_persistent_kernels(impl::engine_t *engine,
+        const compute::kernel_t &kernel, persistent_kernels_t &pkernels);
+status_t get_persistent_kernels(impl::engine_t *engine,
+        const compute::kernel_bundle_t &bundle, persistent_kernels_t &pkernels);
+status_t create_from_persistent_kernels(const intel::engine_t &engine,
+        const persistent_kernels_t &pkernels, compute::kernel_t &kernel);
+status_t create_from_persistent_kernels(const intel::engine_t &engine,
+        const persistent_kernels_t &pkernels, compute::kernel_bundle_t &bundle);
+
 // GPU specific abstract interface for kernel_cache::key_impl_t
 struct gpu_kernel_key_impl_t : public kernel_cache::key_impl_t {
     virtual status_t create_generator(
             impl::engine_t *engine, gpu_kernel_value_t &generator) const = 0;
+
+    // Interface of the persistent kernel cache. The key is stored as its
+    // serialization, which identifies the kernels across processes together
+    // with the device and the library version.
+    virtual void serialize(serialization_stream_t &sstream) const = 0;
+    virtual status_t get_persistent_kernels(impl::engine_t *engine,
+            const gpu_kernel_value_t &generator,
+            persistent_kernels_t &pkernels) const = 0;
+    virtual status_t create_from_persistent_kernels(impl::engine_t *engine,
+            const persistent_kernels_t &pkernels,
+            gpu_kernel_value_t &generator) const = 0;
 };
 
 // Templated key container which implements the necessary virtual interfaces
@@ -182,6 +221,36 @@ struct gpu_kernel_key_container_t final : public gpu_kernel_key_impl_t {
         return status;
     }
 
+    void serialize(serialization_stream_t &sstream) const override {
+        // Keys of different types may have the same serialization.
+        const std::string type_name = typeid(K).name();
+        sstream.append_array(type_name.size(), type_name.data());
+        const auto &data = key.get_serialization().get_data();
+        sstream.append_array(data.size(), data.data());
+    }
+
+    status_t get_persistent_kernels(impl::engine_t *engine,
+            const gpu_kernel_value_t &generator,
+            persistent_kernels_t &pkernels) const override {
+        const auto &value = utils::downcast<
+                const gpu_kernel_value_container_t<value_type> *>(
+                generator.impl())
+                                    ->value;
+        return intel::get_persistent_kernels(engine, value, pkernels);
+    }
+
+    status_t create_from_persistent_kernels(impl::engine_t *engine,
+            const persistent_kernels_t &pkernels,
+            gpu_kernel_value_t &generator) const override {
+        auto g = std::make_shared<gpu_kernel_value_container_t<value_type>>(
+                value_type());
+        auto *intel_engine = utils::downcast<intel::engine_t *>(engine);
+        CHECK(intel::create_from_persistent_kernels(
+                *intel_engine, pkernels, g->value));
+        generator = std::static_pointer_cast<kernel_cache::value_impl_t>(g);
+        return status::success;
+    }
+
     bool compare(const key_impl_t *key_impl) const override {
         auto *o = dynamic_cast<const gpu_kernel_key_container_t<K> *>(key_impl);
         if (o == nullptr) return false;
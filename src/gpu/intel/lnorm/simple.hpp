@@ -50,6 +50,8 @@ struct simple_fwd_t : public primitive_t {
             bool uses_f16 = utils::one_of(f16, src_dt, dst_dt);
             bool uses_f64 = utils::one_of(f64, src_dt, dst_dt);
             VDISPATCH_LNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(!fuse_add_norm(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "fused residual addition");
             VDISPATCH_LNORM(IMPLICATION(uses_f16,
                                     intel_engine->mayiuse(
                                             compute::device_ext_t::khr_fp16))
@@ -131,6 +133,8 @@ struct simple_bwd_t : public primitive_t {
                     = utils::one_of(f64, src_dt, diff_dst_dt, diff_src_dt);
 
             VDISPATCH_LNORM(!is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(!fuse_add_norm(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "fused residual addition");
             VDISPATCH_LNORM(IMPLICATION(uses_f16,
                                     intel_engine->mayiuse(
                                             compute::device_ext_t::khr_fp16))
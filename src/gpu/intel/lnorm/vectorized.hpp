@@ -44,6 +44,8 @@ struct vectorized_fwd_t : public primitive_t {
             auto dst_data_t = dst_md()->data_type;
 
             VDISPATCH_LNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(!fuse_add_norm(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "fused residual addition");
             VDISPATCH_LNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
             VDISPATCH_LNORM(
                     (utils::everyone_is(u8, src_data_t, dst_data_t)
@@ -122,6 +124,8 @@ struct vectorized_bwd_t : public primitive_t {
             auto diff_src_dt = diff_src_md()->data_type;
 
             VDISPATCH_LNORM(!is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(!fuse_add_norm(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "fused residual addition");
             VDISPATCH_LNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
             VDISPATCH_LNORM(
                     (utils::everyone_is(f32, src_dt, diff_dst_dt, diff_src_dt)
@@ -161,22 +165,25 @@ struct vectorized_bwd_t : public primitive_t {
         status_t status = pd()->init_kernel_ctx(kernel_ctx);
         CHECK(status);
 
+        std::vector<compute::kernel_t *> kernels;
+        std::vector<const char *> kernel_names;
         if (pd()->conf.use_fused) {
-            CHECK(create_kernel(engine, &kernel_fused_,
-                    "vectorized_lnorm_bwd_fused", kernel_ctx));
-            if (!kernel_fused_) return status::runtime_error;
+            kernels.push_back(&kernel_fused_);
+            kernel_names.push_back("vectorized_lnorm_bwd_fused");
         }
-        CHECK(create_kernel(
-                engine, &kernel_, "vectorized_lnorm_bwd", kernel_ctx));
-        if (!kernel_) return status::runtime_error;
+        kernels.push_back(&kernel_);
+        kernel_names.push_back("vectorized_lnorm_bwd");
         if (pd()->conf.use_scale || pd()->conf.use_shift) {
-            CHECK(create_kernel(engine, &kernel_scaleshift_,
-                    "vectorized_lnorm_bwd_scaleshift", kernel_ctx));
-            if (!kernel_scaleshift_) return status::runtime_error;
-            CHECK(create_kernel(engine, &kernel_scaleshift_finalize_,
-                    "vectorized_lnorm_bwd_scaleshift_final", kernel_ctx));
-            if (!kernel_scaleshift_finalize_) return status::runtime_error;
+            kernels.push_back(&kernel_scaleshift_);
+            kernel_names.push_back("vectorized_lnorm_bwd_scaleshift");
+            kernels.push_back(&kernel_scaleshift_finalize_);
+            kernel_names.push_back("vectorized_lnorm_bwd_scaleshift_final");
         }
+        CHECK(create_kernels(engine, kernels, kernel_names,
+                std::vector<const compute::kernel_ctx_t *>(
+                        kernels.size(), &kernel_ctx)));
+        for (auto *k : kernels)
+            if (!*k) return status::runtime_error;
 
         return status::success;
     }
@@ -60,8 +60,14 @@ status_t gemm_t::execute(const exec_ctx_t &ctx) const {
     args.sround_seed = &CTX_IN_STORAGE(DNNL_ARG_ATTR_ROUNDING_SEED);
     args.exec_args = ctx.args();
     gemm::desc_t desc;
-    CHECK(create_gemm_desc(&desc, src_d.md_, weights_d.md_, dst_d.md_,
-            bia_d.md_, pd()->desc()->accum_data_type, ctx.stream()->engine()));
+    if (pd()->tile_partition_)
+        CHECK(create_gemm_desc(&desc, &pd()->part_src_md_,
+                &pd()->part_wei_md_, &pd()->part_dst_md_, bia_d.md_,
+                pd()->desc()->accum_data_type, ctx.stream()->engine()));
+    else
+        CHECK(create_gemm_desc(&desc, src_d.md_, weights_d.md_, dst_d.md_,
+                bia_d.md_, pd()->desc()->accum_data_type,
+                ctx.stream()->engine()));
 
     gemm::exec_ctx_t gemm_ctx(ctx, args, &desc);
 
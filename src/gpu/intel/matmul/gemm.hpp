@@ -320,6 +320,72 @@ struct gemm_t : public primitive_t {
             VDISPATCH_MATMUL_SC(maybe_reshape(), VERBOSE_IMPL_HEURISTIC_FAIL,
                     "2D/3D reshaping");
 
+            // On a device with several tiles, a large 2D problem is split
+            // into equal slices of N that make the batch of the gemm, with
+            // the source broadcast over it. The batch is the outermost
+            // dimension of the gemm dispatch, which implicit scaling splits
+            // between the tiles, so that every tile reads only its slice of
+            // the weights and writes only its slice of the destination.
+            auto maybe_partition = [&]() {
+                auto *intel_engine = utils::downcast<intel::engine_t *>(engine);
+                const dim_t P = intel_engine->tile_partition_count();
+                if (P <= 1 || with_bia) return;
+                if (!utils::everyone_is(
+                            2, a_md->ndims, b_md->ndims, c_md->ndims))
+                    return;
+                for (auto md : {a_md, b_md, c_md}) {
+                    const memory_desc_wrapper mdw(md);
+                    if (mdw.format_any() || !mdw.is_plain()
+                            || mdw.has_runtime_dims_or_strides())
+                        return;
+                }
+                // The attributes must not depend on the position along N.
+                if (!gemm_attr.zero_points_.has_default_values()
+                        || !gemm_attr.rounding_mode_.has_default_values())
+                    return;
+                for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST})
+                    if (!gemm_attr.scales_.has_default_values(arg)
+                            && gemm_attr.scales_.get_mask(arg) != 0)
+                        return;
+                for (int i = 0; i < gemm_attr.post_ops_.len(); i++) {
+                    const auto &po = gemm_attr.post_ops_.entry_[i];
+                    if (!po.is_eltwise() && !po.is_sum()) return;
+                }
+
+                // A slice is kept large enough to fill a tile on its own.
+                constexpr dim_t min_slice_n = 256;
+                constexpr dim_t min_slice_ops = dim_t(1) << 30;
+                const dim_t M = c_md->dims[0], N = c_md->dims[1];
+                const dim_t K = a_md->dims[1];
+                const dim_t Ns = N / P;
+                if (N % P != 0 || Ns < min_slice_n || Ns % 64 != 0
+                        || M * Ns * K < min_slice_ops)
+                    return;
+
+                const auto &bs = b_md->format_desc.blocking.strides;
+                const auto &cs = c_md->format_desc.blocking.strides;
+                const dims_t a_dims = {1, M, K};
+                const dims_t b_dims = {P, K, Ns};
+                const dims_t b_strides = {Ns * bs[1], bs[0], bs[1]};
+                const dims_t c_dims = {P, M, Ns};
+                const dims_t c_strides = {Ns * cs[1], cs[0], cs[1]};
+                if (memory_desc_reshape(part_src_md_, *a_md, 3, a_dims)
+                                != status::success
+                        || memory_desc_init_by_strides(part_wei_md_, 3, b_dims,
+                                   b_md->data_type, b_strides)
+                                != status::success
+                        || memory_desc_init_by_strides(part_dst_md_, 3, c_dims,
+                                   c_md->data_type, c_strides)
+                                != status::success)
+                    return;
+
+                a_md = &part_src_md_;
+                b_md = &part_wei_md_;
+                c_md = &part_dst_md_;
+                tile_partition_ = true;
+            };
+            maybe_partition();
+
             // We create a gemm_pd and resolve 'any' desc by querying gemm_pd
             VDISPATCH_MATMUL(
                     is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
@@ -336,12 +402,18 @@ struct gemm_t : public primitive_t {
         }
 
         std::shared_ptr<primitive_desc_t> gemm_pd_;
+        // The problem is split between the tiles of the device, and the
+        // gemm is created for the partitioned tensors below.
+        bool tile_partition_ = false;
+        memory_desc_t part_src_md_, part_wei_md_, part_dst_md_;
 
     private:
         // We cannot change the number of dimensions in the input mds.
         // Grab the gemm_pd_ mds (which should have resolved any tags
         // by now) and unsquash the squashed dims
         status_t set_default_params() {
+            // The partitioned tensors have no format `any` to resolve.
+            if (tile_partition_) return status::success;
             auto update_md
                     = [](memory_desc_t &md,
                               const memory_desc_t &reshaped_md) -> status_t {
@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/intel/include/types.h"
+
+// A work item computes a column of a tile of M_BLOCK rows that belong to the
+// same group. The tiles are enumerated group by group, and the work items
+// beyond the last tile of the last group exit right away.
+__kernel void grouped_matmul(__global const SRC_DATA_T *A,
+        __global const int *src_offsets, __global const WEI_DATA_T *B,
+        __global DST_DATA_T *C, __global int *dst_offsets,
+        __global const WEI_SCALES_DATA_T *wei_scales,
+        __global const WEI_ZP_DATA_T *wei_zp) {
+    const dim_t n = get_global_id(0);
+    dim_t t = get_global_id(1);
+
+    if (n == 0 && t == 0) {
+        for (int g = 0; g < G; g++)
+            dst_offsets[g] = src_offsets[g];
+    }
+
+    int g = 0;
+    dim_t m_start = 0;
+    for (; g < G; g++) {
+        const dim_t m_end = src_offsets[g];
+        const dim_t ntiles = m_end > m_start
+                ? (m_end - m_start + M_BLOCK - 1) / M_BLOCK
+                : 0;
+        if (t < ntiles) break;
+        t -= ntiles;
+        m_start = max(m_start, m_end);
+    }
+    if (g == G || n >= N) return;
+
+    const dim_t m0 = m_start + t * M_BLOCK;
+    const dim_t nrows = min((dim_t)M_BLOCK, (dim_t)src_offsets[g] - m0);
+    if (nrows <= 0 || m0 + nrows > M) return;
+
+    float acc[M_BLOCK];
+    for (int i = 0; i < M_BLOCK; i++)
+        acc[i] = 0.f;
+
+    for (dim_t k0 = 0; k0 < K; k0 += K_CHUNK) {
+        float acc_k[M_BLOCK];
+        for (int i = 0; i < M_BLOCK; i++)
+            acc_k[i] = 0.f;
+
+        float zp = 0.f;
+#if WITH_WEI_ZP
+        const dim_t zp_off = g * WEI_ZP_STRIDE_G
+                + (k0 / WEI_ZP_GROUP_K) * WEI_ZP_STRIDE_K
+                + (n / WEI_ZP_GROUP_N) * WEI_ZP_STRIDE_N;
+        zp = WEI_ZP_TO_REF(wei_zp, zp_off);
+#endif
+
+        for (dim_t k = k0; k < k0 + K_CHUNK; k++) {
+            // The weight is loaded and decompressed once for all the rows of
+            // the tile.
+            const dim_t wei_off = (g * K + k) * N + n;
+#if WEI_DT_S4 || WEI_DT_U4
+            const float w = WEI_TO_REF(GET_HALF_BYTE(B, wei_off)) - zp;
+#else
+            const float w = WEI_TO_REF(B[wei_off]) - zp;
+#endif
+            for (int i = 0; i < M_BLOCK; i++) {
+                if (i < nrows) acc_k[i] += SRC_TO_REF(A[(m0 + i) * K + k]) * w;
+            }
+        }
+
+        float scale = 1.f;
+#if WITH_WEI_SCALES
+        const dim_t scale_off = g * WEI_SCALES_STRIDE_G
+                + (k0 / WEI_SCALES_GROUP_K) * WEI_SCALES_STRIDE_K
+                + (n / WEI_SCALES_GROUP_N) * WEI_SCALES_STRIDE_N;
+        scale = WEI_SCALES_TO_REF(wei_scales[scale_off]);
+#endif
+        for (int i = 0; i < M_BLOCK; i++)
+            acc[i] += acc_k[i] * scale;
+    }
+
+    for (int i = 0; i < M_BLOCK; i++) {
+        if (i < nrows) C[(m0 + i) * N + n] = TO_DST(acc[i]);
+    }
+}
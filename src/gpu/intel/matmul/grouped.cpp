@@ -0,0 +1,212 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/intel/matmul/grouped.hpp"
+#include "common/c_types_map.hpp"
+#include "gpu/intel/compute/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+namespace matmul {
+
+bool grouped_t::pd_t::init_quant(const quant_entry_t &e, quant_t &q) const {
+    q = quant_t();
+    if (e.has_default_values()) return true;
+    if (e.is_host_scalar()) return false;
+
+    // The mask is over the weights [G, K, N].
+    const int mask = e.get_mask();
+    const bool per_g = mask & 1;
+    const bool per_k = mask & wei_qmask_K();
+    const bool per_n = mask & wei_qmask_N();
+    q.with = true;
+    q.group_k = per_k ? e.get_group(0) : K();
+    q.group_n = per_n ? e.get_group(1) : N();
+    if (q.group_k <= 0 || q.group_n <= 0) return false;
+    if (K() % q.group_k != 0 || N() % q.group_n != 0) return false;
+
+    const dim_t nk = K() / q.group_k;
+    const dim_t nn = N() / q.group_n;
+    q.stride_n = nn > 1 ? 1 : 0;
+    q.stride_k = nk > 1 ? nn : 0;
+    q.stride_g = per_g ? nk * nn : 0;
+    return true;
+}
+
+status_t grouped_t::pd_t::init(impl::engine_t *engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_MATMUL(src_d.is_sparse_desc()
+                    && src_d.encoding() == sparse_encoding::grouped,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(dst_d.is_sparse_desc()
+                    && dst_d.encoding() == sparse_encoding::grouped,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(
+            utils::everyone_is(
+                    s32, src_d.metadata_type(0), dst_d.metadata_type(0)),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    src_dt_ = src_d.data_type();
+    wei_dt_ = wei_d.data_type();
+    dst_dt_ = dst_d.data_type();
+    const bool is_int_wei = utils::one_of(wei_dt_, s8, u8, s4, u4);
+    VDISPATCH_MATMUL(utils::one_of(src_dt_, f32, f16, bf16),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(utils::one_of(dst_dt_, src_dt_, f32),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(wei_dt_ == src_dt_ || is_int_wei,
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    // Integer weights are decompressed to the source data type.
+    VDISPATCH_MATMUL(IMPLICATION(is_int_wei, attr()->fpmath_.apply_to_int_),
+            VERBOSE_UNSUPPORTED_FPMATH_MODE);
+
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(smask_t::scales_data_type
+                             | smask_t::scales_groups
+                             | smask_t::zero_points_data_type
+                             | smask_t::zero_points_groups
+                             | smask_t::fpmath_mode),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(
+            attr()->zero_points_.has_default_values({DNNL_ARG_WEIGHTS}),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    VDISPATCH_MATMUL(attr_scales_ok({DNNL_ARG_WEIGHTS}),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(
+            init_quant(attr()->scales_.get(DNNL_ARG_WEIGHTS), wei_scales_),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(IMPLICATION(wei_scales_.with,
+                             utils::one_of(attr()->scales_.get_data_type(
+                                                   DNNL_ARG_WEIGHTS),
+                                     f32, f16, bf16)),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(
+            init_quant(attr()->zero_points_.get(DNNL_ARG_WEIGHTS), wei_zp_),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    VDISPATCH_MATMUL(IMPLICATION(wei_zp_.with,
+                             is_int_wei
+                                     && utils::one_of(
+                                             attr()->zero_points_.get_data_type(
+                                                     DNNL_ARG_WEIGHTS),
+                                             s32, s8, u8, s4, u4)),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+
+    // The points of K are accumulated in chunks sharing both a scale and a
+    // zero point.
+    k_chunk_ = K();
+    if (wei_scales_.with) k_chunk_ = nstl::min(k_chunk_, wei_scales_.group_k);
+    if (wei_zp_.with) k_chunk_ = nstl::min(k_chunk_, wei_zp_.group_k);
+    VDISPATCH_MATMUL(IMPLICATION(wei_scales_.with,
+                             wei_scales_.group_k % k_chunk_ == 0)
+                    && IMPLICATION(
+                            wei_zp_.with, wei_zp_.group_k % k_chunk_ == 0),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(
+            wei_d.matches_one_of_tag(format_tag::abc), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(
+            !has_runtime_dims_or_strides(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    return status::success;
+}
+
+status_t grouped_t::init(impl::engine_t *engine) {
+    compute::kernel_ctx_t kernel_ctx;
+
+    kernel_ctx.set_data_type(pd()->dst_dt_);
+    def_data_type(kernel_ctx, pd()->src_dt_, "SRC");
+    def_data_type(kernel_ctx, pd()->wei_dt_, "WEI");
+    def_data_type(kernel_ctx, pd()->dst_dt_, "DST");
+    def_data_type(kernel_ctx,
+            pd()->attr()->scales_.get_data_type(DNNL_ARG_WEIGHTS),
+            "WEI_SCALES");
+    def_data_type(kernel_ctx,
+            pd()->attr()->zero_points_.get_data_type(DNNL_ARG_WEIGHTS),
+            "WEI_ZP");
+
+    kernel_ctx.define_int("M", pd()->M());
+    kernel_ctx.define_int("N", pd()->N());
+    kernel_ctx.define_int("K", pd()->K());
+    kernel_ctx.define_int("G", pd()->ngroups());
+    kernel_ctx.define_int("M_BLOCK", m_block);
+    kernel_ctx.define_int("K_CHUNK", pd()->k_chunk_);
+
+    const auto def_quant = [&](const pd_t::quant_t &q, const char *name) {
+        const std::string n(name);
+        kernel_ctx.define_int("WITH_" + n, q.with);
+        kernel_ctx.define_int(n + "_STRIDE_G", q.stride_g);
+        kernel_ctx.define_int(n + "_STRIDE_K", q.stride_k);
+        kernel_ctx.define_int(n + "_STRIDE_N", q.stride_n);
+        kernel_ctx.define_int(n + "_GROUP_K", q.group_k);
+        kernel_ctx.define_int(n + "_GROUP_N", q.group_n);
+    };
+    def_quant(pd()->wei_scales_, "WEI_SCALES");
+    def_quant(pd()->wei_zp_, "WEI_ZP");
+
+    CHECK(create_kernel(engine, &kernel_, "grouped_matmul", kernel_ctx));
+    if (!kernel_) return status::runtime_error;
+
+    return status::success;
+}
+
+status_t grouped_t::execute(const exec_ctx_t &ctx) const {
+    const auto &src = CTX_IN_STORAGE(DNNL_ARG_SRC, 0);
+    const auto &src_offsets = CTX_IN_STORAGE(DNNL_ARG_SRC, 1);
+    const auto &wei = CTX_IN_STORAGE(DNNL_ARG_WEIGHTS);
+    auto &dst = CTX_OUT_STORAGE(DNNL_ARG_DST);
+    auto &dst_offsets = *ctx.output(DNNL_ARG_DST)->memory_storage(1);
+    const auto &wei_scales
+            = CTX_IN_STORAGE(DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    const auto &wei_zp
+            = CTX_IN_STORAGE(DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS);
+
+    const dim_t M = pd()->M();
+    const dim_t N = pd()->N();
+    const dim_t G = pd()->ngroups();
+
+    compute::kernel_arg_list_t arg_list;
+    arg_list.set(0, src);
+    arg_list.set(1, src_offsets);
+    arg_list.set(2, wei);
+    arg_list.set(3, dst);
+    arg_list.set(4, dst_offsets);
+    arg_list.set(5, wei_scales);
+    arg_list.set(6, wei_zp);
+
+    // The groups are known only at execution time, so the kernel is
+    // launched over an upper bound of the number of tiles: every group adds
+    // at most one partial tile to the tiles of M.
+    const dim_t ntiles = utils::div_up(M, m_block) + G;
+    compute::range_t gws = {(size_t)N, (size_t)ntiles};
+    auto nd_range = compute::nd_range_t(gws);
+
+    return parallel_for(ctx, nd_range, kernel_, arg_list);
+}
+
+} // namespace matmul
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_INTEL_MATMUL_GROUPED_HPP
+#define GPU_INTEL_MATMUL_GROUPED_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+#include "gpu/intel/matmul/config.hpp"
+#include "gpu/intel/primitive.hpp"
+#include "gpu/intel/primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+namespace matmul {
+
+// Grouped matmul, e.g. for Mixture-of-Experts layers: the rows of src and
+// dst are split into groups by a runtime array of offsets and each group is
+// multiplied by its own matrix of the stacked weights [G, K, N]. All the
+// groups are computed by a single kernel: the tiles of rows of all the
+// groups are enumerated group by group, and a work item finds the group of
+// its tile by walking the offsets. A weight is loaded and decompressed once
+// for all the rows of a tile, so int8 and int4 weights with scales and zero
+// points are read once per tile instead of once per row.
+struct grouped_t : public primitive_t {
+    using primitive_t::primitive_t;
+    struct pd_t : public matmul::pd_t {
+        using matmul::pd_t::pd_t;
+
+        DECLARE_COMMON_PD_T("ocl:grouped", grouped_t);
+
+        // The quantization parameters of the weights: the strides of the
+        // scales or zero points along the groups, K, and N, and the number
+        // of points of K and N sharing a value.
+        struct quant_t {
+            bool with = false;
+            dim_t stride_g = 0, stride_k = 0, stride_n = 0;
+            dim_t group_k = 1, group_n = 1;
+        };
+
+        status_t init(impl::engine_t *engine);
+
+        dim_t ngroups() const { return src_md()->format_desc.sparse_desc.nnz; }
+
+        data_type_t src_dt_ = data_type::undef;
+        data_type_t wei_dt_ = data_type::undef;
+        data_type_t dst_dt_ = data_type::undef;
+        quant_t wei_scales_;
+        quant_t wei_zp_;
+        // The number of K points accumulated before a scale is applied.
+        dim_t k_chunk_ = 0;
+
+    private:
+        bool init_quant(const quant_entry_t &e, quant_t &q) const;
+    };
+
+    // The number of rows of a tile.
+    static constexpr dim_t m_block = 8;
+
+    status_t init(impl::engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    compute::kernel_t kernel_;
+};
+
+} // namespace matmul
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
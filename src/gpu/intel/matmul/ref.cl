@@ -22,19 +22,6 @@
     ((d0) * (s0) + (d1) * (s1) + (d2) * (s2) + (d3) * (s3) + (d4) * (s4) \
             + (d5) * (s5))
 
-#if WITH_DROPOUT
-// No need to enable fp64 extensions just to compute (double)p * 0xFFFFFFFFu
-uint get_dropout_threshold(float p) {
-    if (p >= 1.f) return 0xFFFFFFFFu;
-    char exponent = 126 - ((as_uint(p) >> 23) & 0x7F);
-    if ((p <= 0.f) || (exponent > 31)) return 0u;
-    uint mantissa = (as_uint(p) << 8) | 0x80000000u;
-    if (!exponent) return (convert_ulong(mantissa) * 0xFFFFFFFFuL) >> 32;
-    return ((convert_ulong(mantissa >> exponent) * 0xFFFFFFFFuL) >> 32)
-            + !!(mantissa & ((1u << exponent) - 1u));
-}
-#endif
-
 __kernel void ref_matmul(__global SRC_DATA_T *A, __global WEI_DATA_T *B,
         __global DST_DATA_T *C, __global BIA_DATA_T *bia,
 #if WITH_HOST_SRC_ZP
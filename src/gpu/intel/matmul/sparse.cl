@@ -0,0 +1,78 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/intel/include/types.h"
+
+#if IS_CSR
+// Returns the first row whose nonzeros start at or after the nonzero `idx`.
+int first_row(__global const int *A_ptrs, int idx) {
+    int lo = 0, hi = M;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (A_ptrs[mid] < idx)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+#endif
+
+// A work item computes the column `n` of the rows whose first nonzero is in
+// the chunk `w`. The rows of the last chunk include the trailing empty rows.
+// A_rows keeps the row pointers for CSR and the sorted row indices for COO.
+__kernel void sparse_matmul(__global const SRC_DATA_T *A_values,
+        __global const int *A_rows, __global const int *A_cols,
+        __global const WEI_DATA_T *B, __global DST_DATA_T *C) {
+    const dim_t n = get_global_id(0);
+    const int w = get_global_id(1);
+    if (n >= N) return;
+
+    const int begin = w * CHUNK;
+    const bool is_last = begin + CHUNK >= NNZ;
+
+#if IS_CSR
+    const int r_begin = w == 0 ? 0 : first_row(A_rows, begin);
+    const int r_end = is_last ? M : first_row(A_rows, begin + CHUNK);
+#else
+    // The rows are sorted, so a row starts in the chunk if and only if the
+    // nonzero before the chunk belongs to a previous row.
+    const int r_begin = w == 0 ? 0 : A_rows[begin - 1] + 1;
+    const int r_end = is_last ? M : A_rows[begin + CHUNK - 1] + 1;
+    int idx = begin;
+    while (idx < NNZ && A_rows[idx] < r_begin)
+        idx++;
+#endif
+
+    for (int m = r_begin; m < r_end; m++) {
+#if IS_CSR
+        const int row_end = A_rows[m + 1];
+        int idx = A_rows[m];
+#endif
+        float acc = 0.f;
+#if IS_CSR
+        for (; idx < row_end; idx++) {
+#else
+        for (; idx < NNZ && A_rows[idx] == m; idx++) {
+#endif
+            // The nonzero is the same for all the work items of the chunk.
+            const float a = SRC_TO_REF(A_values[idx]);
+            const dim_t wei_off = WEI_OFF(0, A_cols[idx], n, 0, 0, 0);
+            acc += a * WEI_TO_REF(B[wei_off]);
+        }
+        C[DST_OFF(m, n, 0, 0, 0)] = TO_DST(acc);
+    }
+}
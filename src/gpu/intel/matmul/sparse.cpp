@@ -0,0 +1,131 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/intel/matmul/sparse.hpp"
+#include "common/c_types_map.hpp"
+#include "gpu/intel/compute/utils.hpp"
+#include "gpu/intel/engine.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+namespace matmul {
+
+status_t sparse_t::pd_t::init(impl::engine_t *engine) {
+    using namespace data_type;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md(0));
+
+    const data_type_t src_dt = src_md()->data_type;
+    const data_type_t wei_dt = weights_md(0)->data_type;
+    const data_type_t dst_dt = dst_md()->data_type;
+    VDISPATCH_MATMUL(utils::one_of(src_dt, f32, f16, bf16)
+                    && utils::everyone_is(src_dt, wei_dt, dst_dt),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+
+    VDISPATCH_MATMUL(src_d.is_sparse_desc()
+                    && utils::one_of(src_d.encoding(), sparse_encoding::csr,
+                            sparse_encoding::coo),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    is_csr_ = src_d.encoding() == sparse_encoding::csr;
+    VDISPATCH_MATMUL(src_d.metadata_type(0) == s32
+                    && IMPLICATION(is_csr_, src_d.metadata_type(1) == s32),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(!has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(ndims() == 2, VERBOSE_BAD_NDIMS, "dst", ndims());
+
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(wei_d.matches_one_of_tag(format_tag::ab, format_tag::ba),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+
+    // Enough chunks are created to occupy the device with the columns of
+    // every chunk, but a chunk is kept long enough to amortize the search
+    // of its first row.
+    auto *intel_engine = utils::downcast<intel::engine_t *>(engine);
+    const auto *dev_info = intel_engine->device_info();
+    constexpr dim_t min_chunk = 16;
+    const dim_t nthr = dev_info->hw_threads() * dev_info->min_subgroup_size();
+    const dim_t target_nchunks = nstl::max<dim_t>(1, utils::div_up(nthr, N()));
+    nnz_ = src_d.nnz();
+    chunk_ = nstl::max(min_chunk, utils::div_up(nnz_, target_nchunks));
+    nchunks_ = nstl::max<dim_t>(1, utils::div_up(nnz_, chunk_));
+
+    return status::success;
+}
+
+status_t sparse_t::init(impl::engine_t *engine) {
+    compute::kernel_ctx_t kernel_ctx;
+
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    offsets_t off;
+    set_offsets(wei_d, off.wei_off);
+    set_offsets(dst_d, off.dst_off);
+    def_offsets(off.wei_off, kernel_ctx, "WEI", 2);
+    def_offsets(off.dst_off, kernel_ctx, "DST", 2);
+    kernel_ctx.define_int("NDIMS", 2);
+
+    kernel_ctx.set_data_type(pd()->dst_md()->data_type);
+    def_data_type(kernel_ctx, pd()->src_md()->data_type, "SRC");
+    def_data_type(kernel_ctx, pd()->weights_md(0)->data_type, "WEI");
+    def_data_type(kernel_ctx, pd()->dst_md()->data_type, "DST");
+
+    kernel_ctx.define_int("M", pd()->M());
+    kernel_ctx.define_int("N", pd()->N());
+    kernel_ctx.define_int("NNZ", pd()->nnz_);
+    kernel_ctx.define_int("CHUNK", pd()->chunk_);
+    kernel_ctx.define_int("IS_CSR", pd()->is_csr_);
+
+    CHECK(create_kernel(engine, &kernel_, "sparse_matmul", kernel_ctx));
+    if (!kernel_) return status::runtime_error;
+
+    return status::success;
+}
+
+status_t sparse_t::execute(const exec_ctx_t &ctx) const {
+    // CSR keeps the column indices first and the row pointers second, COO
+    // keeps the row indices first and the column indices second.
+    const auto &a_values = CTX_IN_STORAGE(DNNL_ARG_SRC, 0);
+    const auto &a_cols = pd()->is_csr_ ? CTX_IN_STORAGE(DNNL_ARG_SRC, 1)
+                                       : CTX_IN_STORAGE(DNNL_ARG_SRC, 2);
+    const auto &a_rows = pd()->is_csr_ ? CTX_IN_STORAGE(DNNL_ARG_SRC, 2)
+                                       : CTX_IN_STORAGE(DNNL_ARG_SRC, 1);
+    const auto &b = CTX_IN_STORAGE(DNNL_ARG_WEIGHTS);
+    auto &c = CTX_OUT_STORAGE(DNNL_ARG_DST);
+
+    compute::kernel_arg_list_t arg_list;
+    arg_list.set(0, a_values);
+    arg_list.set(1, a_rows);
+    arg_list.set(2, a_cols);
+    arg_list.set(3, b);
+    arg_list.set(4, c);
+
+    compute::range_t gws = {(size_t)pd()->N(), (size_t)pd()->nchunks_};
+    auto nd_range = compute::nd_range_t(gws);
+
+    return parallel_for(ctx, nd_range, kernel_, arg_list);
+}
+
+} // namespace matmul
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
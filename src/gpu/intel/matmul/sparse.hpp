@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_INTEL_MATMUL_SPARSE_HPP
+#define GPU_INTEL_MATMUL_SPARSE_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+#include "gpu/intel/matmul/config.hpp"
+#include "gpu/intel/primitive.hpp"
+#include "gpu/intel/primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+namespace matmul {
+
+// Sparse matmul with a CSR or sorted COO source and dense weights. The
+// nonzeros are split into chunks of the same size, and a row is computed by
+// the chunk its first nonzero belongs to, so the work is balanced over the
+// nonzeros rather than over the rows and no row is split between work
+// items. The work items of a chunk compute the columns of its rows and read
+// the same nonzeros, which are shared by the lanes of a sub-group.
+struct sparse_t : public primitive_t {
+    using primitive_t::primitive_t;
+    struct pd_t : public matmul::pd_t {
+        using matmul::pd_t::pd_t;
+
+        DECLARE_COMMON_PD_T("ocl:sparse", sparse_t);
+
+        status_t init(impl::engine_t *engine);
+
+        bool is_csr_ = false;
+        dim_t nnz_ = 0;
+        // The number of nonzeros of a chunk and the number of chunks.
+        dim_t chunk_ = 0;
+        dim_t nchunks_ = 0;
+    };
+
+    status_t init(impl::engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    compute::kernel_t kernel_;
+};
+
+} // namespace matmul
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
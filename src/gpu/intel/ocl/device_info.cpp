@@ -152,6 +152,14 @@ status_t device_info_t::init_attributes(impl::engine_t *engine) {
     OCL_CHECK(err);
     device_address_bits_ = device_address_bits;
 
+    CHECK(get_ocl_device_host_unified_memory(device, host_unified_memory_));
+
+    cl_uint max_sub_devices = 0;
+    err = clGetDeviceInfo(device, CL_DEVICE_PARTITION_MAX_SUB_DEVICES,
+            sizeof(max_sub_devices), &max_sub_devices, nullptr);
+    OCL_CHECK(err);
+    tile_count_ = nstl::max(1, (int)max_sub_devices);
+
 #ifdef cl_intel_unified_shared_memory
     cl_device_unified_shared_memory_capabilities_intel
             system_memory_capabilities_intel
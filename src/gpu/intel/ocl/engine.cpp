@@ -24,6 +24,7 @@
 #include "common/utils.hpp"
 
 #include "xpu/ocl/memory_storage.hpp"
+#include "xpu/ocl/usm_utils.hpp"
 
 #include "gpu/intel/jit/dsl/runtime.hpp"
 #include "gpu/intel/jit/generator_base.hpp"
@@ -114,6 +115,13 @@ status_t engine_t::create_stream(
     return stream_t::create_stream(stream, this, stream_impl);
 }
 
+bool engine_t::is_zero_copy_ptr(const void *ptr) const {
+    if (!ptr || !has_host_unified_memory()) return false;
+    using namespace xpu::ocl::usm;
+    const auto kind = get_pointer_type(const_cast<engine_t *>(this), ptr);
+    return utils::one_of(kind, kind_t::host, kind_t::shared);
+}
+
 namespace {
 
 status_t create_ocl_kernel_from_cache_blob(const engine_t *ocl_engine,
@@ -101,6 +101,8 @@ public:
         return device_info_->get_cache_blob_size(size);
     }
 
+    bool is_zero_copy_ptr(const void *ptr) const override;
+
     status_t get_cache_blob(size_t size, uint8_t *cache_blob) const override {
         return device_info_->get_cache_blob(size, cache_blob);
     }
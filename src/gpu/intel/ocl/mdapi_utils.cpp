@@ -23,9 +23,9 @@
 #endif
 
 #ifdef DNNL_GPU_ENABLE_MDAPI
-#include <cassert>
 #include <cstring>
 #include <dlfcn.h>
+#include <initializer_list>
 #include <vector>
 
 #include "gpu/intel/ocl/utils.hpp"
@@ -71,12 +71,23 @@ static void open_lib(std::shared_ptr<void> &lib) {
     }
 }
 
+static double to_double(const MetricsDiscovery::TTypedValue_1_0 &value) {
+    using namespace MetricsDiscovery;
+    switch (value.ValueType) {
+        case VALUE_TYPE_UINT32: return value.ValueUInt32;
+        case VALUE_TYPE_UINT64: return (double)value.ValueUInt64;
+        case VALUE_TYPE_FLOAT: return value.ValueFloat;
+        case VALUE_TYPE_BOOL: return value.ValueBool;
+        default: return 0;
+    }
+}
+
 class mdapi_helper_impl_t {
 public:
     mdapi_helper_impl_t() {
         if (!lib) open_lib(lib);
         if (!open_metrics_device(&metric_device_, lib)) return;
-        if (!activate_freq_metric()) return;
+        if (!activate_metrics()) return;
         is_initialized_ = true;
     }
 
@@ -105,8 +116,9 @@ public:
         return func(ctx, dev, CL_QUEUE_PROFILING_ENABLE, config, err);
     }
 
-    double get_freq(cl_event event) const {
-        if (!is_initialized_) return 0;
+    xpu::stream_profiler_t::counters_t get_counters(cl_event event) const {
+        xpu::stream_profiler_t::counters_t counters;
+        if (!is_initialized_) return counters;
 
         using namespace MetricsDiscovery;
         auto mparams = metric_set_->GetParams();
@@ -118,8 +130,8 @@ public:
         err = clGetEventProfilingInfo(event,
                 CL_PROFILING_COMMAND_PERFCOUNTERS_INTEL, report_size,
                 report.data(), &out_size);
-        if (err != CL_SUCCESS) return 0;
-        if (out_size != report_size) return 0;
+        if (err != CL_SUCCESS) return counters;
+        if (out_size != report_size) return counters;
 
         std::vector<TTypedValue_1_0> results(
                 mparams->MetricsCount + mparams->InformationCount);
@@ -130,16 +142,59 @@ public:
                 results.data(),
                 (uint32_t)(results.size() * sizeof(TTypedValue_1_0)),
                 &report_count, false);
-        if (code != CC_OK) return 0;
-        if (report_count < 1) return 0;
-
-        auto &value = results[freq_metric_idx_];
-        assert(value.ValueType == EValueType::VALUE_TYPE_UINT64);
-        return value.ValueUInt64 * 1e6;
+        if (code != CC_OK) return counters;
+        if (report_count < 1) return counters;
+
+        auto get = [&](int idx) {
+            return idx < 0 ? 0.0 : to_double(results[idx]);
+        };
+        counters.freq = get(idx_.freq) * 1e6;
+        counters.eu_active = get(idx_.eu_active) / 100;
+        counters.eu_stall = get(idx_.eu_stall) / 100;
+        if (idx_.read_bytes >= 0 || idx_.write_bytes >= 0) {
+            counters.mem_bytes = get(idx_.read_bytes) + get(idx_.write_bytes);
+        } else {
+            // Older devices only report the throughput in bytes per second.
+            double sec = get(idx_.gpu_time) / 1e9;
+            counters.mem_bytes
+                    = (get(idx_.read_tput) + get(idx_.write_tput)) * sec;
+        }
+        return counters;
     }
 
 private:
-    bool activate_freq_metric() {
+    // Metric indices in the ComputeBasic set, -1 for the missing ones. The
+    // symbol names differ between GPU generations.
+    struct metric_indices_t {
+        int freq = -1;
+        int gpu_time = -1;
+        int eu_active = -1;
+        int eu_stall = -1;
+        int read_bytes = -1;
+        int write_bytes = -1;
+        int read_tput = -1;
+        int write_tput = -1;
+
+        void set(const char *name, int k) {
+            auto is = [&](std::initializer_list<const char *> names) {
+                for (auto *n : names)
+                    if (!strcmp(name, n)) return true;
+                return false;
+            };
+            if (is({"AvgGpuCoreFrequencyMHz"})) freq = k;
+            if (is({"GpuTime"})) gpu_time = k;
+            if (is({"EuActive", "XveActive"})) eu_active = k;
+            if (is({"EuStall", "XveStall"})) eu_stall = k;
+            if (is({"GpuMemoryByteRead", "GpuMemoryReadBytes"}))
+                read_bytes = k;
+            if (is({"GpuMemoryByteWrite", "GpuMemoryWriteBytes"}))
+                write_bytes = k;
+            if (is({"GtiReadThroughput"})) read_tput = k;
+            if (is({"GtiWriteThroughput"})) write_tput = k;
+        }
+    };
+
+    bool activate_metrics() {
         using namespace MetricsDiscovery;
 
         auto *params = metric_device_->GetParams();
@@ -163,15 +218,13 @@ private:
                     for (uint32_t k = 0; k < sparams->MetricsCount; k++) {
                         auto metric = set->GetMetric(k);
                         auto mparams = metric->GetParams();
-                        if (!strcmp(mparams->SymbolName,
-                                    "AvgGpuCoreFrequencyMHz"))
-                            freq_metric_idx_ = k;
+                        idx_.set(mparams->SymbolName, (int)k);
                     }
                 }
             }
         }
 
-        if (freq_metric_idx_ < 0) return false;
+        if (idx_.freq < 0) return false;
 
         TCompletionCode code;
         code = metric_set_->SetApiFiltering(api_mask);
@@ -186,7 +239,7 @@ private:
     bool is_initialized_ = false;
     MetricsDiscovery::IMetricsDevice_1_13 *metric_device_ = nullptr;
     MetricsDiscovery::IMetricSet_1_1 *metric_set_ = nullptr;
-    int freq_metric_idx_ = -1;
+    metric_indices_t idx_;
     std::shared_ptr<void> lib = nullptr;
 };
 
@@ -202,8 +255,9 @@ cl_command_queue mdapi_helper_t::create_queue(
     return impl_->create_queue(ctx, dev, err);
 }
 
-double mdapi_helper_t::get_freq(cl_event event) const {
-    return impl_->get_freq(event);
+xpu::stream_profiler_t::counters_t mdapi_helper_t::get_counters(
+        cl_event event) const {
+    return impl_->get_counters(event);
 }
 
 #else
@@ -216,8 +270,9 @@ cl_command_queue mdapi_helper_t::create_queue(
     return nullptr;
 }
 
-double mdapi_helper_t::get_freq(cl_event event) const {
-    return 0;
+xpu::stream_profiler_t::counters_t mdapi_helper_t::get_counters(
+        cl_event event) const {
+    return {};
 }
 
 #endif
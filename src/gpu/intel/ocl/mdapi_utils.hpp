@@ -20,6 +20,8 @@
 #include <memory>
 #include <CL/cl.h>
 
+#include "xpu/stream_profiler.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace gpu {
@@ -33,7 +35,9 @@ public:
     mdapi_helper_t();
     cl_command_queue create_queue(
             cl_context cl_ctx, cl_device_id dev, cl_int *err) const;
-    double get_freq(cl_event event) const;
+    // Returns the hardware counters of the kernel that completed the event,
+    // zeros when they are not available.
+    xpu::stream_profiler_t::counters_t get_counters(cl_event event) const;
 
 private:
     std::shared_ptr<mdapi_helper_impl_t> impl_;
@@ -18,6 +18,8 @@
 
 #include <CL/cl.h>
 
+#include "common/memory.hpp"
+#include "common/primitive_exec_types.hpp"
 #include "common/verbose.hpp"
 
 #include "xpu/ocl/engine_impl.hpp"
@@ -111,6 +113,99 @@ cl_command_queue stream_t::create_queue(
 #endif
 }
 
+namespace {
+
+// The number of reader events after which they are merged into one marker,
+// to bound the wait lists of the following writers.
+constexpr size_t max_reader_events = 16;
+
+void append_unique(xpu::ocl::event_t &dst, const xpu::ocl::event_t &src) {
+    for (const auto &e : src.events) {
+        bool found = false;
+        for (const auto &d : dst.events)
+            found = found || d.get() == e.get();
+        if (!found) dst.events.push_back(e);
+    }
+}
+
+} // namespace
+
+status_t stream_t::enqueue_primitive(
+        const primitive_iface_t *prim_iface, exec_ctx_t &exec_ctx) {
+    if (!(flags() & stream_flags::out_of_order))
+        return impl::stream_t::enqueue_primitive(prim_iface, exec_ctx);
+
+    // The memory accessed by the execution keyed by the runtime handle, and
+    // whether it is written. The primitive itself is written to order the
+    // executions sharing its scratchpad.
+    std::vector<std::pair<const void *, bool>> keys;
+    for (const auto &arg : exec_ctx.args()) {
+        const memory_t *mem = arg.second.mem;
+        if (!mem) continue;
+        for (int i = 0; i < (int)mem->get_num_handles(); i++) {
+            const auto *storage = mem->memory_storage(i);
+            if (!storage || storage->is_null()) continue;
+            keys.emplace_back(storage->data_handle(), !arg.second.is_const);
+        }
+    }
+    keys.emplace_back(prim_iface, true);
+
+    // The tracked dependencies are added to the events passed by the user
+    // through the interoperability API or left by the previous execution of
+    // a batch.
+    xpu::ocl::event_t deps = ocl_ctx().get_ocl_deps();
+    CHECK(get_access_deps(keys, deps));
+    ocl_ctx().set_deps(std::move(deps));
+
+    CHECK(impl::stream_t::enqueue_primitive(prim_iface, exec_ctx));
+
+    const auto &out_event = ocl_ctx().get_ocl_deps();
+    if (out_event.size() == 0) return status::success;
+    return record_accesses(keys, out_event);
+}
+
+status_t stream_t::get_access_deps(
+        const std::vector<std::pair<const void *, bool>> &keys,
+        xpu::ocl::event_t &deps) {
+    std::lock_guard<std::mutex> lock(accesses_mutex_);
+    for (const auto &k : keys) {
+        auto it = accesses_.find(k.first);
+        if (it == accesses_.end()) continue;
+        append_unique(deps, it->second.writer);
+        if (k.second) append_unique(deps, it->second.readers);
+    }
+    return status::success;
+}
+
+status_t stream_t::record_accesses(
+        const std::vector<std::pair<const void *, bool>> &keys,
+        const xpu::ocl::event_t &event) {
+    std::lock_guard<std::mutex> lock(accesses_mutex_);
+    for (const auto &k : keys) {
+        auto &access = accesses_[k.first];
+        if (k.second) {
+            access.writer = event;
+            access.readers = xpu::ocl::event_t();
+            continue;
+        }
+        append_unique(access.readers, event);
+        if (access.readers.size() <= max_reader_events) continue;
+
+        std::vector<cl_event> events(
+                access.readers.events.begin(), access.readers.events.end());
+        xpu::ocl::wrapper_t<cl_event> marker;
+        OCL_CHECK(clEnqueueMarkerWithWaitList(queue(), (cl_uint)events.size(),
+                events.data(), &marker.unwrap()));
+        access.readers = xpu::ocl::event_t(std::move(marker));
+    }
+    return status::success;
+}
+
+void stream_t::clear_accesses() {
+    std::lock_guard<std::mutex> lock(accesses_mutex_);
+    accesses_.clear();
+}
+
 void stream_t::before_exec_hook() {
     if (is_profiling_enabled()) profiler_->start_profiling();
 }
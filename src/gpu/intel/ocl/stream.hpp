@@ -18,6 +18,10 @@
 #define GPU_INTEL_OCL_STREAM_HPP
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "common/c_types_map.hpp"
 
@@ -53,15 +57,23 @@ struct stream_t : public intel::stream_t {
         return status::success;
     }
 
-    status_t wait() override { return impl()->wait(); }
+    status_t wait() override {
+        CHECK(impl()->wait());
+        clear_accesses();
+        return status::success;
+    }
+
+    status_t enqueue_primitive(const primitive_iface_t *prim_iface,
+            exec_ctx_t &exec_ctx) override;
 
     void before_exec_hook() override;
     void after_exec_hook() override;
 
-    double get_freq(const xpu::event_t &event) const override {
+    xpu::stream_profiler_t::counters_t get_counters(
+            const xpu::event_t &event) const override {
         const auto &ocl_event = xpu::ocl::event_t::from(event).events;
         gpu_assert(ocl_event.size() == 1);
-        return mdapi_helper().get_freq(ocl_event[0]);
+        return mdapi_helper().get_counters(ocl_event[0]);
     }
 
     status_t reset_profiling() override {
@@ -113,7 +125,28 @@ private:
     cl_command_queue create_queue(
             cl_context ctx, cl_device_id dev, cl_int *err) const;
 
+    // On an out-of-order queue, executions submitted without events are
+    // ordered by the memory they access: an execution waits for the last
+    // writer of its inputs, and for the last writer and the readers since of
+    // its outputs. Independent executions, e.g. parallel branches of a model,
+    // run concurrently on the device.
+    struct access_t {
+        xpu::ocl::event_t writer;
+        xpu::ocl::event_t readers;
+    };
+
+    status_t get_access_deps(
+            const std::vector<std::pair<const void *, bool>> &keys,
+            xpu::ocl::event_t &deps);
+    status_t record_accesses(
+            const std::vector<std::pair<const void *, bool>> &keys,
+            const xpu::ocl::event_t &event);
+    void clear_accesses();
+
     std::unique_ptr<mdapi_helper_t> mdapi_helper_;
+
+    std::mutex accesses_mutex_;
+    std::unordered_map<const void *, access_t> accesses_;
 };
 
 } // namespace ocl
@@ -298,6 +298,15 @@ status_t get_kernel_arg_types(cl_kernel ocl_kernel,
     return status::success;
 }
 
+status_t get_ocl_device_host_unified_memory(
+        cl_device_id device, bool &host_unified_memory) {
+    cl_bool value = CL_FALSE;
+    OCL_CHECK(clGetDeviceInfo(device, CL_DEVICE_HOST_UNIFIED_MEMORY,
+            sizeof(value), &value, nullptr));
+    host_unified_memory = value == CL_TRUE;
+    return status::success;
+}
+
 status_t get_ocl_device_enabled_systolic_intel(
         cl_device_id device, bool &enabled_systolic) {
     cl_bitfield res;
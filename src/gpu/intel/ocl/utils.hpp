@@ -64,6 +64,9 @@ status_t get_kernel_arg_types(cl_kernel ocl_kernel,
 status_t get_ocl_device_eu_count(cl_device_id device,
         gpu::intel::compute::gpu_arch_t arch, int32_t *eu_count);
 
+status_t get_ocl_device_host_unified_memory(
+        cl_device_id device, bool &host_unified_memory);
+
 status_t get_ocl_device_enabled_systolic_intel(
         cl_device_id device, bool &systolic_enabled);
 
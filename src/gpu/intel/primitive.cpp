@@ -73,6 +73,52 @@ status_t primitive_t::create_kernel(impl::engine_t *engine,
     return status::success;
 }
 
+status_t primitive_t::create_kernels(impl::engine_t *engine,
+        const std::vector<compute::kernel_t *> &kernels,
+        const std::vector<const char *> &kernel_names,
+        const std::vector<const compute::kernel_ctx_t *> &kernel_ctxs) {
+    auto *intel_engine = utils::downcast<intel::engine_t *>(engine);
+    return create_kernels_concurrently(engine, kernels, kernel_names,
+            [&](size_t i, compute::kernel_t &kernel) {
+                std::vector<compute::kernel_t> k;
+                CHECK(intel_engine->create_kernels(
+                        &k, {kernel_names[i]}, *kernel_ctxs[i]));
+                kernel = k[0];
+                return status::success;
+            });
+}
+
+status_t primitive_t::create_kernels_concurrently(impl::engine_t *engine,
+        const std::vector<compute::kernel_t *> &kernels,
+        const std::vector<const char *> &kernel_names,
+        const std::function<status_t(size_t, compute::kernel_t &)> &create) {
+    gpu_assert(kernels.size() == kernel_names.size());
+    auto *intel_engine = utils::downcast<intel::engine_t *>(engine);
+    if (cache_blob()) {
+        // The binaries are read from the blob in order.
+        for (size_t i = 0; i < kernels.size(); i++) {
+            VCHECK_KERNEL(intel_engine->create_kernel_from_cache_blob(
+                                  cache_blob(), *kernels[i], kernel_names[i]),
+                    VERBOSE_KERNEL_CREATION_FAIL, kernel_names[i]);
+            kernels[i]->hash_dump("blob");
+            CHECK(register_kernels({*kernels[i]}));
+        }
+        return status::success;
+    }
+
+    std::vector<compute::kernel_t> created(kernels.size());
+    CHECK(intel_engine->run_compile_tasks(kernels.size(), [&](size_t i) {
+        VCHECK_KERNEL(create(i, created[i]), VERBOSE_KERNEL_CREATION_FAIL,
+                kernel_names[i]);
+        return status::success;
+    }));
+    for (size_t i = 0; i < kernels.size(); i++) {
+        *kernels[i] = created[i];
+        kernels[i]->hash_dump("real");
+    }
+    return register_kernels(created);
+}
+
 // Intel GPU hardware has a limitation on the size of work group dimensions to
 // be at most uint32_t. This function works around that by passing an offset
 // argument. The OpenCL native offset cannot be used due to lack of SYCL
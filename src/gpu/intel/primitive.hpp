@@ -18,6 +18,7 @@
 #define GPU_INTEL_PRIMITIVE_HPP
 
 #include <cassert>
+#include <functional>
 #include "gpu/intel/compute/utils.hpp"
 
 #include "common/cache_blob.hpp"
@@ -97,6 +98,13 @@ struct primitive_t : public gpu::primitive_t {
     status_t create_kernel(impl::engine_t *engine, compute::kernel_t *kernel,
             const char *kernel_name, const compute::kernel_ctx_t &kernel_ctx);
 
+    // Creates kernels of separate programs. Unless the kernels come from a
+    // cache blob, the programs are built concurrently.
+    status_t create_kernels(impl::engine_t *engine,
+            const std::vector<compute::kernel_t *> &kernels,
+            const std::vector<const char *> &kernel_names,
+            const std::vector<const compute::kernel_ctx_t *> &kernel_ctxs);
+
     template <typename T>
     status_t create_kernels(impl::engine_t *engine,
             std::vector<compute::kernel_t> &kernels,
@@ -119,8 +127,9 @@ struct primitive_t : public gpu::primitive_t {
         CHECK(get_cached_kernels<typename trivial_key_t<T>::value_type>(
                 std::move(key), engine, kernels, kernel_names,
                 kernel_cache_status));
-        if (kernel_cache_status == cache_state_t::kernel_hit) {
-            creation_cached_state_ = cache_state_t::kernel_hit;
+        if (utils::one_of(kernel_cache_status, cache_state_t::kernel_hit,
+                    cache_state_t::persistent_hit)) {
+            creation_cached_state_ = kernel_cache_status;
         }
 
         for (auto &k : kernels)
@@ -130,6 +139,35 @@ struct primitive_t : public gpu::primitive_t {
         return status::success;
     }
 
+    template <typename T>
+    status_t create_kernels(impl::engine_t *engine,
+            const std::vector<compute::kernel_t *> &kernels,
+            const std::vector<const char *> &kernel_names,
+            const std::vector<T> &params) {
+        auto *intel_engine = utils::downcast<intel::engine_t *>(engine);
+        std::vector<cache_state_t> states(kernels.size(), cache_state_t::miss);
+        CHECK(create_kernels_concurrently(engine, kernels, kernel_names,
+                [&](size_t i, compute::kernel_t &kernel) {
+                    auto key = std::make_shared<trivial_key_container_t<T>>(
+                            params[i], intel_engine->engine_id());
+                    gpu_assert(key->key.is_valid());
+
+                    std::vector<compute::kernel_t> k(1);
+                    CHECK(get_cached_kernels<
+                            typename trivial_key_t<T>::value_type>(
+                            std::move(key), engine, k, {kernel_names[i]},
+                            states[i]));
+                    kernel = k[0];
+                    return status::success;
+                }));
+        for (auto state : states) {
+            if (utils::one_of(state, cache_state_t::kernel_hit,
+                        cache_state_t::persistent_hit))
+                creation_cached_state_ = state;
+        }
+        return status::success;
+    }
+
     template <typename T>
     status_t create_kernel(impl::engine_t *engine, compute::kernel_t &kernel,
             const char *kernel_name, const T &params) {
@@ -182,6 +220,15 @@ protected:
     }
 
 private:
+    // Runs `create` for every kernel on the compile threads of the engine
+    // and registers the kernels in order, so that a cache blob holds them
+    // the same way as if they were created one after another.
+    status_t create_kernels_concurrently(impl::engine_t *engine,
+            const std::vector<compute::kernel_t *> &kernels,
+            const std::vector<const char *> &kernel_names,
+            const std::function<status_t(size_t, compute::kernel_t &)>
+                    &create);
+
     static status_t parallel_for(impl::stream_t &stream,
             const compute::nd_range_t &range, const compute::kernel_t &kernel,
             const compute::kernel_arg_list_t &arg_list,
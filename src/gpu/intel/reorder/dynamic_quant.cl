@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/intel/include/types.h"
+
+#if SCALES_DT_BF16
+#define TO_SCALES(x) cvt_f32_to_bf16(x)
+#define SCALES_TO_REF(x) cvt_bf16_to_f32(x)
+#elif SCALES_DT_F16
+#define TO_SCALES(x) convert_half(x)
+#define SCALES_TO_REF(x) convert_float(x)
+#else
+#define TO_SCALES(x) (x)
+#define SCALES_TO_REF(x) (x)
+#endif
+
+#define PAIR_NONE 0
+#define PAIR_IN_GROUP 1
+#define PAIR_CHANNELS 2
+
+// The number of groups of a work item.
+#define NCH (PAIR == PAIR_CHANNELS ? 2 : 1)
+
+// Returns the source offset of the point `e` of a group relative to its
+// first point, and sets the destination offset the same way.
+dim_t point_off(dim_t e, dim_t *dst_off) {
+    const dim_t count[] = {GROUP_COUNT0, GROUP_COUNT1, GROUP_COUNT2,
+            GROUP_COUNT3, GROUP_COUNT4, GROUP_COUNT5};
+    const dim_t src_stride[] = {GROUP_SRC_S0, GROUP_SRC_S1, GROUP_SRC_S2,
+            GROUP_SRC_S3, GROUP_SRC_S4, GROUP_SRC_S5};
+    const dim_t dst_stride[] = {GROUP_DST_S0, GROUP_DST_S1, GROUP_DST_S2,
+            GROUP_DST_S3, GROUP_DST_S4, GROUP_DST_S5};
+    dim_t src_off = 0;
+    *dst_off = 0;
+    for (int i = GROUP_NDIMS - 1; i >= 0; i--) {
+        const dim_t x = e % count[i];
+        e /= count[i];
+        src_off += x * src_stride[i];
+        *dst_off += x * dst_stride[i];
+    }
+    return src_off;
+}
+
+// Loads the values of a point, and of its neighbor sharing a byte of the
+// destination, if any.
+float2 load_point(__global const SRC_DATA_T *src, dim_t off) {
+#if PAIR == PAIR_NONE
+    return (float2)(SRC_TO_REF(src[off]), 0.f);
+#elif PAIR_SRC_STRIDE == 1
+    const SRC_DATA2_T v = vload2(0, src + off);
+    return (float2)(SRC_TO_REF(v.s0), SRC_TO_REF(v.s1));
+#else
+    return (float2)(
+            SRC_TO_REF(src[off]), SRC_TO_REF(src[off + PAIR_SRC_STRIDE]));
+#endif
+}
+
+// Returns the bits of a quantized value.
+uchar quantize(float v, float qscale, float qzp) {
+    const float x = clamp(v * qscale + qzp, (float)QMIN, (float)QMAX);
+#if DST_DT_F4_E2M1
+    return cvt_f32_to_f4_e2m1(x) & 0xf;
+#elif DST_DT_S4 || DST_DT_U4
+    return convert_int_rte(x) & 0xf;
+#else
+    return (uchar)convert_int_rte(x);
+#endif
+}
+
+// A work item finds the range of its groups, writes their scales and zero
+// points, and then quantizes the points. With a 4-bit destination, a point
+// is read with its neighbor, either in the same group or in the group of the
+// next channel, and the byte of the two values is written at once.
+__kernel void dynamic_quant_reorder(__global const SRC_DATA_T *src,
+        __global uchar *dst, __global SCALES_DATA_T *scales,
+        __global ZP_DATA_T *zero_points) {
+    dim_t t = get_global_id(0);
+    if (t >= NTASKS) return;
+
+    const dim_t task_count[] = {TASK_COUNT0, TASK_COUNT1, TASK_COUNT2,
+            TASK_COUNT3, TASK_COUNT4, TASK_COUNT5};
+    const dim_t task_src_stride[] = {TASK_SRC_S0, TASK_SRC_S1, TASK_SRC_S2,
+            TASK_SRC_S3, TASK_SRC_S4, TASK_SRC_S5};
+    const dim_t task_dst_stride[] = {TASK_DST_S0, TASK_DST_S1, TASK_DST_S2,
+            TASK_DST_S3, TASK_DST_S4, TASK_DST_S5};
+    const dim_t task_scale_stride[] = {TASK_SCALE_S0, TASK_SCALE_S1,
+            TASK_SCALE_S2, TASK_SCALE_S3, TASK_SCALE_S4, TASK_SCALE_S5};
+
+    dim_t src_off = SRC_OFFSET0;
+    dim_t dst_off = DST_OFFSET0;
+    dim_t scale_off = 0;
+    for (int i = TASK_NDIMS - 1; i >= 0; i--) {
+        const dim_t x = t % task_count[i];
+        t /= task_count[i];
+        src_off += x * task_src_stride[i];
+        dst_off += x * task_dst_stride[i];
+        scale_off += x * task_scale_stride[i];
+    }
+
+    // The range always includes zero, so that it is represented exactly by
+    // the zero point.
+    float vmin[2] = {0.f, 0.f};
+    float vmax[2] = {0.f, 0.f};
+    for (dim_t e = 0; e < GROUP_SIZE; e++) {
+        dim_t d_off;
+        const float2 v = load_point(src, src_off + point_off(e, &d_off));
+        vmin[0] = fmin(vmin[0], v.s0);
+        vmax[0] = fmax(vmax[0], v.s0);
+#if PAIR != PAIR_NONE
+        vmin[NCH - 1] = fmin(vmin[NCH - 1], v.s1);
+        vmax[NCH - 1] = fmax(vmax[NCH - 1], v.s1);
+#endif
+    }
+
+    float qscale[2];
+    float qzp[2] = {0.f, 0.f};
+    for (int c = 0; c < NCH; c++) {
+        // Asymmetric quantization maps the range of the group to the range
+        // of the data type, and symmetric quantization maps the largest
+        // absolute value to QSYM.
+#if WITH_ZP
+        const float range = (vmax[c] - vmin[c]) / (QMAX - QMIN);
+#else
+        const float range = fmax(vmax[c], -vmin[c]) / QSYM;
+#endif
+        const dim_t idx = scale_off + c * PAIR_SCALE_STRIDE;
+        scales[idx] = TO_SCALES(range > 0.f ? range : 1.f);
+        // The quantization uses the scale the way it is stored.
+        const float scale = SCALES_TO_REF(scales[idx]);
+        qscale[c] = 1.f / scale;
+#if WITH_ZP
+        const float zp = rint((float)QMIN - vmin[c] / scale);
+        qzp[c] = clamp(zp, (float)QMIN, (float)QMAX);
+        zero_points[idx] = convert_int(qzp[c]);
+#endif
+    }
+
+    for (dim_t e = 0; e < GROUP_SIZE; e++) {
+        dim_t d_off;
+        const float2 v = load_point(src, src_off + point_off(e, &d_off));
+        const uchar q0 = quantize(v.s0, qscale[0], qzp[0]);
+#if PAIR == PAIR_NONE
+        dst[dst_off + d_off] = q0;
+#else
+        // The first point is at an even offset and takes the low nibble.
+        const uchar q1 = quantize(v.s1, qscale[NCH - 1], qzp[NCH - 1]);
+        dst[(dst_off + d_off) / 2] = q0 | (q1 << 4);
+#endif
+    }
+}
@@ -0,0 +1,295 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/intel/reorder/dynamic_quant.hpp"
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+#include "gpu/intel/compute/utils.hpp"
+#include "gpu/intel/engine.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+namespace reorder {
+
+namespace {
+// The range of the quantized values of a destination data type, and the
+// largest value a symmetric quantization maps the largest absolute source
+// value of a group to.
+struct q_range_t {
+    int qmin, qmax, qsym;
+};
+
+q_range_t q_range(data_type_t dt) {
+    using namespace data_type;
+    switch (dt) {
+        case s8: return {-128, 127, 127};
+        case u8: return {0, 255, 0};
+        case s4: return {-8, 7, 7};
+        case u4: return {0, 15, 0};
+        case f4_e2m1: return {-6, 6, 6};
+        default: assert(!"unexpected data type");
+    }
+    return {0, 0, 0};
+}
+
+void add_dim(dynamic_quant_t::pd_t::walk_t &w, dim_t count, dim_t src_stride,
+        dim_t dst_stride, dim_t scale_stride) {
+    if (count == 1) return;
+    w.count[w.ndims] = count;
+    w.src_stride[w.ndims] = src_stride;
+    w.dst_stride[w.ndims] = dst_stride;
+    w.scale_stride[w.ndims] = scale_stride;
+    w.ndims++;
+}
+} // namespace
+
+status_t dynamic_quant_t::pd_t::init(impl::engine_t *engine,
+        impl::engine_t *src_engine, impl::engine_t *dst_engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_REORDER(src_engine == dst_engine, VERBOSE_BAD_ENGINE_KIND);
+    VDISPATCH_REORDER(
+            src_engine->kind() == engine_kind::gpu, VERBOSE_BAD_ENGINE_KIND);
+    VDISPATCH_REORDER(attr()->dynamic_quantization_, VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_REORDER(
+            attr()->has_default_values(smask_t::scales_groups
+                    | smask_t::scales_data_type | smask_t::zero_points_groups
+                    | smask_t::zero_points_data_type
+                    | smask_t::dynamic_quantization),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_REORDER(!src_d.has_runtime_dims_or_strides()
+                    && !dst_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(src_d.is_plain(), VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VDISPATCH_REORDER(dst_d.is_plain(), VERBOSE_UNSUPPORTED_TAG_S, "dst");
+    VDISPATCH_REORDER(!src_d.has_zero_dim(), VERBOSE_EMPTY_TENSOR, "src");
+    VDISPATCH_REORDER(src_d.extra().flags == 0 && dst_d.extra().flags == 0,
+            VERBOSE_UNSUPPORTED_MD_FLAG, "extra_ok");
+
+    const auto sdt = src_d.data_type();
+    const auto ddt = dst_d.data_type();
+    VDISPATCH_REORDER(
+            utils::one_of(sdt, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_REORDER(utils::one_of(ddt, s8, u8, s4, u4, f4_e2m1),
+            VERBOSE_UNSUPPORTED_DT);
+
+    // Unsigned destinations have no symmetric quantization.
+    with_zero_points_ = !attr()->zero_points_.has_default_values(DNNL_ARG_DST);
+    VDISPATCH_REORDER(
+            IMPLICATION(utils::one_of(ddt, u8, u4), with_zero_points_),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    VDISPATCH_REORDER(IMPLICATION(ddt == f4_e2m1, !with_zero_points_),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    const auto scales_dt = attr()->scales_.get_data_type(DNNL_ARG_DST);
+    VDISPATCH_REORDER(utils::one_of(scales_dt, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_REORDER(IMPLICATION(with_zero_points_,
+                              utils::one_of(attr()->zero_points_.get_data_type(
+                                                    DNNL_ARG_DST),
+                                      s32, s8, u8)),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+
+    auto *intel_engine = utils::downcast<intel::engine_t *>(engine);
+    VDISPATCH_REORDER(IMPLICATION(utils::one_of(f16, sdt, scales_dt),
+                              intel_engine->mayiuse(
+                                      compute::device_ext_t::khr_fp16)),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+
+    return init_conf(engine);
+}
+
+status_t dynamic_quant_t::pd_t::init_conf(impl::engine_t *engine) {
+    using namespace data_type;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const int ndims = src_d.ndims();
+    const auto &dims = src_d.dims();
+    const auto &src_strides = src_d.blocking_desc().strides;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+
+    const auto &sc = attr()->scales_.get(DNNL_ARG_DST);
+    const int mask = attr()->scales_.get_mask(DNNL_ARG_DST);
+    VDISPATCH_REORDER(mask < (1 << ndims), VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    // A zero point is computed for every scale and stored the same way.
+    if (with_zero_points_) {
+        const auto &zp = attr()->zero_points_.get(DNNL_ARG_DST);
+        bool zp_ok = zp.get_mask() == mask
+                && zp.has_default_groups() == sc.has_default_groups();
+        if (zp_ok && !sc.has_default_groups())
+            zp_ok = zp.get_group(0) == sc.get_group(0)
+                    && zp.get_group(1) == sc.get_group(1);
+        VDISPATCH_REORDER(zp_ok, VERBOSE_UNSUPPORTED_ZP_CFG);
+    }
+
+    // The scales are dense over the masked dimensions.
+    dims_t group_dims, scale_strides;
+    dim_t scale_stride = 1;
+    for (int d = ndims - 1; d >= 0; d--) {
+        group_dims[d] = dims[d];
+        scale_strides[d] = 0;
+        if (!(mask & (1 << d))) continue;
+        group_dims[d] = d >= ndims - 2 && !sc.has_default_groups()
+                ? sc.get_group(d - (ndims - 2))
+                : 1;
+        scale_strides[d] = scale_stride;
+        scale_stride *= dims[d] / group_dims[d];
+    }
+
+    // The two values of a byte of a 4-bit destination are neighbors along
+    // its innermost dimension, and both of them are handled by one work
+    // item.
+    int pair_dim = -1;
+    pair_ = pair_kind_t::none;
+    pair_src_stride_ = 0;
+    pair_scale_stride_ = 0;
+    if (utils::one_of(dst_d.data_type(), s4, u4, f4_e2m1)) {
+        for (int d = 0; d < ndims; d++)
+            if (dims[d] > 1 && dst_strides[d] == 1) pair_dim = d;
+        bool ok = pair_dim >= 0 && dims[pair_dim] % 2 == 0
+                && dst_d.offset0() % 2 == 0;
+        for (int d = 0; d < ndims; d++)
+            if (d != pair_dim && dims[d] > 1)
+                ok = ok && dst_strides[d] % 2 == 0;
+        VDISPATCH_REORDER(ok, VERBOSE_UNSUPPORTED_TAG_S, "dst");
+
+        const bool is_channel = group_dims[pair_dim] == 1;
+        VDISPATCH_REORDER(is_channel || group_dims[pair_dim] % 2 == 0,
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        pair_ = is_channel ? pair_kind_t::channels : pair_kind_t::in_group;
+        pair_src_stride_ = src_strides[pair_dim];
+        pair_scale_stride_ = is_channel ? scale_strides[pair_dim] : 0;
+    }
+
+    // The work items are enumerated over the groups, with the last
+    // dimension being the fastest, and the points of a group the same way.
+    tasks_ = walk_t();
+    group_ = walk_t();
+    ntasks_ = 1;
+    for (int d = 0; d < ndims; d++) {
+        const bool is_pair = d == pair_dim;
+        const dim_t step = is_pair && pair_ == pair_kind_t::channels
+                ? 2
+                : group_dims[d];
+        add_dim(tasks_, dims[d] / step, src_strides[d] * step,
+                dst_strides[d] * step,
+                scale_strides[d] * (step / group_dims[d]));
+        ntasks_ *= dims[d] / step;
+
+        const dim_t inner = is_pair && pair_ == pair_kind_t::in_group ? 2 : 1;
+        add_dim(group_, group_dims[d] / inner, src_strides[d] * inner,
+                dst_strides[d] * inner, 0);
+    }
+
+    return status::success;
+}
+
+status_t dynamic_quant_t::init(impl::engine_t *engine) {
+    using namespace data_type;
+    compute::kernel_ctx_t kernel_ctx;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto *attr = pd()->attr();
+
+    kernel_ctx.set_data_type(src_d.data_type());
+    def_data_type(kernel_ctx, src_d.data_type(), "SRC");
+    def_data_type(kernel_ctx, dst_d.data_type(), "DST");
+    def_data_type(kernel_ctx, attr->scales_.get_data_type(DNNL_ARG_DST),
+            "SCALES");
+    def_data_type(kernel_ctx,
+            pd()->with_zero_points_
+                    ? attr->zero_points_.get_data_type(DNNL_ARG_DST)
+                    : s32,
+            "ZP");
+
+    const auto range = q_range(dst_d.data_type());
+    kernel_ctx.define_int("QMIN", range.qmin);
+    kernel_ctx.define_int("QMAX", range.qmax);
+    kernel_ctx.define_int("QSYM", range.qsym);
+    kernel_ctx.define_int("WITH_ZP", pd()->with_zero_points_);
+    kernel_ctx.define_int("PAIR", static_cast<int>(pd()->pair_));
+    kernel_ctx.define_int("PAIR_SRC_STRIDE", pd()->pair_src_stride_);
+    kernel_ctx.define_int("PAIR_SCALE_STRIDE", pd()->pair_scale_stride_);
+    kernel_ctx.define_int("SRC_OFFSET0", src_d.offset0());
+    kernel_ctx.define_int("DST_OFFSET0", dst_d.offset0());
+    kernel_ctx.define_int("NTASKS", pd()->ntasks_);
+
+    const auto &tasks = pd()->tasks_;
+    const auto &group = pd()->group_;
+    dim_t group_size = 1;
+    for (int i = 0; i < group.ndims; i++)
+        group_size *= group.count[i];
+    kernel_ctx.define_int("TASK_NDIMS", tasks.ndims);
+    kernel_ctx.define_int("GROUP_NDIMS", group.ndims);
+    kernel_ctx.define_int("GROUP_SIZE", group_size);
+    for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
+        const bool is_task = i < tasks.ndims;
+        const bool is_group = i < group.ndims;
+        kernel_ctx.define_int(utils::format("TASK_COUNT%d", i),
+                is_task ? tasks.count[i] : 1);
+        kernel_ctx.define_int(utils::format("TASK_SRC_S%d", i),
+                is_task ? tasks.src_stride[i] : 0);
+        kernel_ctx.define_int(utils::format("TASK_DST_S%d", i),
+                is_task ? tasks.dst_stride[i] : 0);
+        kernel_ctx.define_int(utils::format("TASK_SCALE_S%d", i),
+                is_task ? tasks.scale_stride[i] : 0);
+        kernel_ctx.define_int(utils::format("GROUP_COUNT%d", i),
+                is_group ? group.count[i] : 1);
+        kernel_ctx.define_int(utils::format("GROUP_SRC_S%d", i),
+                is_group ? group.src_stride[i] : 0);
+        kernel_ctx.define_int(utils::format("GROUP_DST_S%d", i),
+                is_group ? group.dst_stride[i] : 0);
+    }
+
+    CHECK(create_kernel(engine, &kernel_, "dynamic_quant_reorder", kernel_ctx));
+    if (!kernel_) return status::runtime_error;
+
+    return status::success;
+}
+
+status_t dynamic_quant_t::execute(const exec_ctx_t &ctx) const {
+    auto &src = CTX_IN_STORAGE(DNNL_ARG_FROM);
+    auto &dst = CTX_OUT_STORAGE(DNNL_ARG_TO);
+    auto &scales = CTX_OUT_STORAGE(DNNL_ARG_ATTR_SCALES | DNNL_ARG_TO);
+    auto &zero_points
+            = CTX_OUT_STORAGE(DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_TO);
+
+    compute::kernel_arg_list_t arg_list;
+    arg_list.set(0, src);
+    arg_list.set(1, dst);
+    arg_list.set(2, scales);
+    arg_list.set(3, zero_points);
+
+    compute::range_t gws = {(size_t)pd()->ntasks_};
+    auto nd_range = compute::nd_range_t(gws);
+
+    return parallel_for(ctx, nd_range, kernel_, arg_list);
+}
+
+} // namespace reorder
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
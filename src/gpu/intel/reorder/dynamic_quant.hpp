@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_INTEL_REORDER_DYNAMIC_QUANT_HPP
+#define GPU_INTEL_REORDER_DYNAMIC_QUANT_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+#include "gpu/intel/primitive.hpp"
+#include "gpu/intel/reorder/config.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+namespace reorder {
+
+// Reorder with dynamic quantization of a plain source to a plain s8, u8, s4,
+// u4, or f4_e2m1 destination, which computes the destination scales and zero
+// points of the groups. A work item quantizes one group, or the two groups of
+// neighboring channels for a 4-bit destination with a scale per channel of
+// its innermost dimension, so that the two values of a byte are packed in
+// registers and every byte is written once.
+struct dynamic_quant_t : public primitive_t {
+    using primitive_t::primitive_t;
+    struct pd_t : public reorder::pd_t {
+        using reorder::pd_t::pd_t;
+
+        DECLARE_COMMON_PD_T("ocl:dynamic_quant", dynamic_quant_t);
+
+        status_t init(impl::engine_t *engine, impl::engine_t *src_engine,
+                impl::engine_t *dst_engine);
+
+        // How the two values of a byte of a 4-bit destination are split
+        // between the groups.
+        enum class pair_kind_t { none, in_group, channels };
+
+        // The work items and the points of a group walk the dimensions
+        // with these counts and strides, in elements.
+        struct walk_t {
+            int ndims = 0;
+            dim_t count[DNNL_MAX_NDIMS] = {};
+            dim_t src_stride[DNNL_MAX_NDIMS] = {};
+            dim_t dst_stride[DNNL_MAX_NDIMS] = {};
+            dim_t scale_stride[DNNL_MAX_NDIMS] = {};
+        };
+
+        bool with_zero_points_ = false;
+        pair_kind_t pair_ = pair_kind_t::none;
+        // The offsets of the second value of a byte from the first one.
+        dim_t pair_src_stride_ = 0;
+        dim_t pair_scale_stride_ = 0;
+        walk_t tasks_;
+        walk_t group_;
+        dim_t ntasks_ = 0;
+
+    private:
+        status_t init_conf(impl::engine_t *engine);
+
+        DECLARE_GPU_REORDER_CREATE();
+    };
+
+    status_t init(impl::engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    compute::kernel_t kernel_;
+};
+
+} // namespace reorder
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
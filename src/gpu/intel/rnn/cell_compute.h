@@ -73,8 +73,14 @@ typedef struct {
     cell_strides_t strides;
 } const_wei_layer_cell_t;
 
+// With CELL_WEI_ITER_SLM_SIZE, the recurrent weights are read from a copy in
+// SLM. The weights are then accessed through generic pointers.
 typedef struct {
+#if CELL_WEI_ITER_SLM_SIZE
+    __local const WEI_ITER_DATA_T *ptr;
+#else
     __global const WEI_ITER_DATA_T *ptr;
+#endif
     cell_strides_t strides;
 } const_wei_iter_cell_t;
 
@@ -157,18 +163,18 @@ inline int checkCopyScratchMemory(
 }
 
 inline void __attribute__((overloadable))
-load(float *s, const __global float *data, bool is_valid) {
+load(float *s, const float *data, bool is_valid) {
     *s = is_valid ? data[get_sub_group_local_id()] : 0;
 }
 
 inline void __attribute__((overloadable))
-load(float *s, const __global half *data, bool is_valid) {
+load(float *s, const half *data, bool is_valid) {
     *s = is_valid ? into_float(data[get_sub_group_local_id()]) : 0;
 }
 
 // Bfloat 16
 inline void __attribute__((overloadable))
-load(float *s, const __global ushort *data, bool is_valid) {
+load(float *s, const ushort *data, bool is_valid) {
     *s = is_valid ? into_float(as_bf16(data[get_sub_group_local_id()])) : 0;
 }
 
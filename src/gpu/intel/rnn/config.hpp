@@ -193,6 +193,9 @@ struct ocl_conf_t {
         int dhc_tg = 0;
         int mb_thr = 0;
         int mb_tg = 0;
+        // The number of recurrent weights kept in SLM by the loop over the
+        // iterations, 0 when the weights are read from global memory.
+        int wei_iter_slm_size = 0;
 #if __cplusplus >= 202002L
         bool operator==(const comp_conf_t &) const = default;
 #endif
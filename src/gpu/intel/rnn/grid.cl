@@ -815,7 +815,7 @@ __kernel void simple_rnn_elemwise_bwd() {}
 
 void gemm_sum_inner(float(C)[M_THR_BLOCK][N_THR_BLOCK],
         const __global WS_STATE_DATA_T *restrict A, const int a_stride,
-        const __global WEI_LAYER_DATA_T *restrict B, const int b_stride,
+        const WEI_LAYER_DATA_T *restrict B, const int b_stride,
         const int m_thr_stride, const int n_thr_stride, int m_l_end,
         int k_l_end, int n_l_end, bool mn_valid) {
 
@@ -849,10 +849,11 @@ void gemm_sum_inner(float(C)[M_THR_BLOCK][N_THR_BLOCK],
     }
 }
 
-// Perform C += A * B where all matrices are in row major layout
+// Perform C += A * B where all matrices are in row major layout. B is in
+// global memory or in SLM.
 void gemm_sum(float(C)[N_OUTER_BLOCK][M_THR_BLOCK][N_THR_BLOCK],
         const __global WS_STATE_DATA_T *restrict A, const int a_stride,
-        const __global WEI_LAYER_DATA_T *restrict B, const int b_stride,
+        const WEI_LAYER_DATA_T *restrict B, const int b_stride,
         gemm_dims_t size, int m_sg, int m_thr_stride, int n_sg,
         int n_thr_stride, bool enable_m_tail, bool enable_k_tail,
         bool enable_n_tail) {
@@ -1127,14 +1128,27 @@ simple_rnn_cell_fwd(__global const WEI_LAYER_DATA_T *wei_layer_,
     cell_dims_t dims = {.mb = mb, .dhc = dhc, .slc = slc, .sic = sic};
     cell_loops_t cell_loops = {.mb = BATCH_LOCAL, .dhc = dhc_loop};
 
-    // Optimization Opportunity: The weights buffers are reused across
-    // iterations. Because of this, we can load and reorder the weights buffers
-    // into SLM so that we can get optimal load patterns in the GEMM operations
-    // below.
     const_wei_layer_cell_t wei_layer = {.ptr = wei_layer_ + wei_layer_off,
             .strides = wei_layer_strides.cell};
+#if CELL_WEI_ITER_SLM_SIZE
+    // The recurrent weights are used by every iteration of the loop, so the
+    // work group reads them from memory once, into dense rows in SLM.
+    __local WEI_ITER_DATA_T wei_iter_slm[CELL_WEI_ITER_SLM_SIZE];
+    const dim_t wei_iter_ld = n_gates * dhc;
+    const dim_t wg_size = get_local_size(0) * get_local_size(1);
+    for (dim_t i = get_local_linear_id(); i < sic * wei_iter_ld;
+            i += wg_size) {
+        const dim_t k = i / wei_iter_ld;
+        wei_iter_slm[i] = wei_iter_[wei_iter_off + k * wei_iter_strides.cell.sic
+                + i % wei_iter_ld];
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+    const_wei_iter_cell_t wei_iter
+            = {.ptr = wei_iter_slm, .strides = {.sic = wei_iter_ld}};
+#else
     const_wei_iter_cell_t wei_iter = {
             .ptr = wei_iter_ + wei_iter_off, .strides = wei_iter_strides.cell};
+#endif
 
     // Optimization Opportunity: bias can be preloaded to a register if n_gates*dhc
     // is small enough.
@@ -323,6 +323,21 @@ static status_t init_ocl_conf(ocl_conf_t &ocl_conf, const pd_t *pd,
         ocl_conf.cell_comp.dhc_tg = into<int>(dhc_tg);
         ocl_conf.cell_comp.mb_thr = mb_thr;
         ocl_conf.cell_comp.mb_tg = into<int>(mb_tg);
+
+        // Looping over the iterations in one kernel, the recurrent weights
+        // are read by every iteration, so they are kept in SLM if they fit.
+        const dim_t wei_iter_size = conf.sic * conf.n_gates * conf.dhc;
+        const bool wei_iter_fits_slm = wei_iter_size
+                        * into<dim_t>(types::data_type_size(ocl_conf.wei_dt))
+                <= compute::device_info_t::max_slm_size_per_tg(
+                        device_info.gpu_arch());
+        // The override may only disable SLM, as the kernel requires all of
+        // the conditions below to use it.
+        const bool use_wei_iter_slm = dev_getenv("wei_iter_slm", true)
+                && wei_iter_fits_slm && ocl_conf.cell_comp.enable_iter_block
+                && fuse_gemm_iter;
+        ocl_conf.cell_comp.wei_iter_slm_size
+                = use_wei_iter_slm ? into<int>(wei_iter_size) : 0;
     }
 
     return status::success;
@@ -452,6 +467,8 @@ status_t ocl_conf_t::init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const {
                 "CELL_ENABLE_ITER_BLOCK", cell_comp.enable_iter_block);
         kernel_ctx.define_int("CELL_DHC_THR", cell_comp.dhc_thr);
         kernel_ctx.define_int("CELL_BATCH_THR", cell_comp.mb_thr);
+        kernel_ctx.define_int(
+                "CELL_WEI_ITER_SLM_SIZE", cell_comp.wei_iter_slm_size);
     }
 
     return status::success;
@@ -594,6 +611,8 @@ status_t simple_common_t<aprop>::pd_t::init(impl::engine_t *engine) {
             VERBOSE_BAD_ALGORITHM);
     VDISPATCH_RNN(!this->is_lstm_peephole(), "is_lstm_peephole");
     VDISPATCH_RNN(!this->is_lstm_projection(), "is_lstm_projection");
+    VDISPATCH_RNN(!this->with_seq_lengths(), VERBOSE_UNSUPPORTED_FEATURE,
+            "sequence lengths");
     VDISPATCH_RNN(IMPLICATION(aprop == prop_kind::forward,
                           one_of(this->desc()->prop_kind, forward_training,
                                   forward_inference)),
@@ -633,6 +633,18 @@ dim_t nearest_conf_seq_interval(compute::gpu_arch_t arch, dim_t head_size,
     return utils::rnd_up_pow2(seq);
 }
 
+int choose_kv_split(dim_t nwg, dim_t keys, int wg_tile_k, int max_wgs) {
+    // A chunk takes a few key tiles at least to amortize the load of the
+    // query tile and the merge of the partial results.
+    const dim_t min_tiles_per_chunk = 4;
+    const dim_t max_split = 64;
+
+    if (nwg <= 0 || 2 * nwg > max_wgs) return 1;
+    dim_t split = nstl::min(utils::div_up(max_wgs, nwg),
+            utils::div_up(keys, wg_tile_k) / min_tiles_per_chunk);
+    return static_cast<int>(utils::saturate(dim_t(1), max_split, split));
+}
+
 void deserialize_config_to_gemmstone(gemmstone::HWInformation &hwInfo,
         gemmstone::GEMMProblem &problem_kq, gemmstone::GEMMProblem &problem_vs,
         micro::GEMMProtocol::Options &opts_kq,
@@ -106,6 +106,13 @@ dim_t nearest_conf_seq_interval(compute::gpu_arch_t arch, dim_t head_size,
         dim_t seq, bool is_thin_q, bool is_quantized, bool is_integrated,
         bool is_fma, bool is_f32);
 
+// Returns the number of chunks to split the keys into, so that a problem with
+// too few work-groups to fill the device, e.g. the decoding of one token with
+// a long KV cache, runs a work-group per chunk of keys. `nwg` is the number
+// of work-groups without the split and `max_wgs` is the number of
+// work-groups the device runs at once.
+int choose_kv_split(dim_t nwg, dim_t keys, int wg_tile_k, int max_wgs);
+
 // serializable options for microkernel configuration
 // follows reduced subset of structs from gemmstone that
 // are used for ukernel generation
@@ -179,6 +179,22 @@ DECLARE_2D_TILE_COPY_REBLOCK(mask_tile_type, SUBGROUP_SIZE, mask_br, mask_bc,
         mask_bc, mask_nbr, mask_nbc, CONVERT_FLOAT_T)
 #endif
 
+#if SPLIT_KV
+DECLARE_2D_TILE(a_tile_type_part, float, SUBGROUP_SIZE, ugemm_vs_sg_tile_m, 8,
+        1, ugemm_vs_sg_tile_n / 8)
+#if VS_F16_ACC
+DECLARE_2D_TILE_COPY_REBLOCK(a_tile_type_float, SUBGROUP_SIZE,
+        ugemm_vs_c_type_block0, ugemm_vs_c_type_block1, ugemm_vs_c_type_nblock0,
+        ugemm_vs_c_type_nblock1, a_tile_type_part, SUBGROUP_SIZE,
+        ugemm_vs_sg_tile_m, 8, 1, ugemm_vs_sg_tile_n / 8, CONVERT_FLOAT_T)
+#else
+DECLARE_2D_TILE_COPY_REBLOCK(a_tile_type, SUBGROUP_SIZE, ugemm_vs_c_type_block0,
+        ugemm_vs_c_type_block1, ugemm_vs_c_type_nblock0,
+        ugemm_vs_c_type_nblock1, a_tile_type_part, SUBGROUP_SIZE,
+        ugemm_vs_sg_tile_m, 8, 1, ugemm_vs_sg_tile_n / 8, CONVERT_FLOAT_T)
+#endif
+#endif
+
 #if BLOCK_A
 DECLARE_2D_TILE_BLOCK_OPS(a_tile_type_dst, DST_DATA_T, SUBGROUP_SIZE,
         ugemm_vs_sg_tile_m, 1, 1, ugemm_vs_sg_tile_n)
@@ -386,11 +402,39 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
         MSK_OFFSETS
 #endif
         ,
-        const int remainder_k) {
+        const int remainder_k
+#if PAGED_KV
+        ,
+        const global int *block_table, const global int *context_lens,
+        const int max_pages
+#endif
+#if SPLIT_KV
+        ,
+        global float *A_part, global float *S_part, const int kv_chunk,
+        const int nsplit
+#endif
+) {
 
     uint sg_ij = sub_group_broadcast(get_local_id(1), 0);
     uint b1 = get_group_id(2);
 
+    /* Leading dimension of the mask, which is not affected by key chunks */
+    const int ldmsk = k;
+
+#if SPLIT_KV
+    /* Work-groups of a split-KV problem take a chunk of the keys each and
+       proceed as if the chunk were all the keys */
+    const uint kv_split = b1 % nsplit;
+    b1 /= nsplit;
+    const int k_begin = kv_split * kv_chunk;
+    k = min(k - k_begin, kv_chunk);
+#endif
+
+#if PAGED_KV
+    /* Sequences of a ragged batch have their own numbers of keys */
+    k = context_lens[b1];
+#endif
+
     uint b0, b0_kv;
     uint wg_j0 = get_group_id(0) * ugemm_kq_wg_tile_n;
 
@@ -464,8 +508,15 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
     const bool need_sum_barrier = (ugemm_vs_barrier_count == 0);
 
     /* Convert to half precision and store */
+#if PAGED_KV
+    /* The pages of the sequence are located in the main loop */
+    const size_t k_offset = KEY_BATCH(0, b0_kv);
+    const size_t v_offset = VAL_BATCH(0, b0_kv);
+    block_table += b1 * max_pages;
+#else
     const size_t k_offset = KEY_BATCH(b1, b0_kv);
     const size_t v_offset = VAL_BATCH(b1, b0_kv);
+#endif
     /* Locate K/Q/V/A matrices within batch */
     K += k_offset / KEY_ELEMENTS_PER_BYTE;
     Q += QRY_BATCH(b1, b0);
@@ -473,6 +524,9 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
     A += DST_BATCH(b1, b0);
 #if WITH_ATTN_MASK
     msk += MSK_BATCH(b1 % MSK_D0, b0 % MSK_D1);
+#if SPLIT_KV
+    msk += k_begin;
+#endif
 #if BLOCK_MSK == false
     int mask_aligned = (((size_t)msk) % 4) == 0;
 #endif
@@ -497,6 +551,24 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
     V_zp += v_offset / VAL_GROUP_SIZE / VAL_ZP_ELEMENTS_PER_BYTE;
 #endif
 
+#if SPLIT_KV
+    /* Locate the key chunk */
+    K += (size_t)k_begin * KEY_S3 / KEY_ELEMENTS_PER_BYTE;
+    V += (size_t)k_begin * ldv / VAL_ELEMENTS_PER_BYTE;
+#if KEY_SCALES == QUANTIZE_2D
+    K_scales += k_begin;
+#endif
+#if KEY_ZERO_POINTS == QUANTIZE_2D
+    K_zp += k_begin / KEY_ZP_ELEMENTS_PER_BYTE;
+#endif
+#if VAL_SCALES == QUANTIZE_2D
+    V_scales += (size_t)ldvq * k_begin;
+#endif
+#if VAL_ZERO_POINTS == QUANTIZE_2D
+    V_zp += (size_t)ldvq * k_begin / VAL_ZP_ELEMENTS_PER_BYTE;
+#endif
+#endif
+
     if (k0end > 0) {
         /* Load Q tile, destined for SLM */
         q_tile_type Q_tile;
@@ -634,7 +706,8 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
         }
 #endif
 #else
-        tile_load_t(&mask_tile, msk, q, k, sg_j0_kq + wg_j0, k0 + sg_i0_kq);
+        tile_load_t(&mask_tile, msk, q, k, ldmsk, sg_j0_kq + wg_j0,
+                k0 + sg_i0_kq);
 #endif
 #endif
 
@@ -651,14 +724,30 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
             }
         }
 
+        /* Locate the K and V tiles */
+        const global KEY_DATA_T *K_tile = K;
+        const global VAL_DATA_T *V_tile = V;
+        int k_tile_m = k0end, k_tile_i0 = k0;
+#if PAGED_KV
+        /* A tile of keys lies within a page */
+        const int page = block_table[k0 / PAGE_SIZE];
+        const int k0_page = k0 % PAGE_SIZE;
+        K_tile += (size_t)page * KEY_S.array[0] / KEY_ELEMENTS_PER_BYTE;
+        V_tile += ((size_t)page * VAL_S.array[0] + (size_t)k0_page * ldv)
+                / VAL_ELEMENTS_PER_BYTE;
+        k_tile_m = k0_page + k0end - k0;
+        k_tile_i0 = k0_page;
+#endif
+
         /* Calculate S = (K^T) * Q */
 #if KQ_F16_ACC
         s_tile_type S_tile_f16
 #else
         s_tile_type S_tile
 #endif
-                = ugemm_kq(K, ldk, Q_slm, D_MAX, k0end, ugemm_kq_wg_tile_n, d,
-                        k0, 0, 0, sg_i_kq, sg_j_kq, (local char *)ugemm_slm
+                = ugemm_kq(K_tile, ldk, Q_slm, D_MAX, k_tile_m,
+                        ugemm_kq_wg_tile_n, d, k_tile_i0, 0, 0, sg_i_kq,
+                        sg_j_kq, (local char *)ugemm_slm
 #if KEY_SCALES == QUANTIZE_2D
                         ,
                         K_scales
@@ -950,7 +1039,7 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
 #else
         a_tile_type A_tile1
 #endif
-                = ugemm_vs(V, ldv, S_slm, ugemm_kq_wg_tile_m, d,
+                = ugemm_vs(V_tile, ldv, S_slm, ugemm_kq_wg_tile_m, d,
                         ugemm_kq_wg_tile_n, k_chunk, 0, 0, 0, sg_i_vs, sg_j_vs,
                         (local char *)ugemm_slm
 #if VAL_SCALES == QUANTIZE_2D
@@ -981,6 +1070,13 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
         tile_binary(A_tile, A_tile1, binary_add);
     }
 
+#if SPLIT_KV
+    /* Column maxima, in the log2 domain, and sums of the chunk */
+    a_scale_tile_type S_max_part_tile, S_sum_part_tile;
+    tile_fill(S_max_part_tile, -INFINITY);
+    tile_fill(S_sum_part_tile, 0.0f);
+#endif
+
     if (k0end > 0) {
         /* Wait for column sums to be ready */
         if (need_sum_barrier)
@@ -996,6 +1092,13 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
                     ugemm_vs_sg_tile_n * sg_j_vs, sg1);
             tile_binary(A_scale_tile, A_scale_tile_load, binary_add);
         }
+#if SPLIT_KV
+        tile_copy(A_scale_tile, S_sum_part_tile);
+        tile_load_full(&S_max_part_tile, S_max_slm, ugemm_kq_wg_tile_n,
+                ugemm_vs_sg_tile_n * sg_j_vs, 0);
+#define scale_max(x) ((x)*scale)
+        tile_elementwise(S_max_part_tile, scale_max);
+#endif
 #if VAL_SCALES == QUANTIZE_COMMON
 #define v_scale_op(x) ((x)*v_scale)
         tile_elementwise(A_tile, v_scale_op);
@@ -1011,6 +1114,35 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
         tile_hbroadcast_mul(&A_tile, A_scale_tile);
     }
 
+#if SPLIT_KV
+    /* Store the result of the chunk, which the merge kernel combines with
+       the results of the other chunks. The maxima of all the chunks are
+       followed by the sums in S_part. */
+    const size_t part_rows = (size_t)DST_D.array[0] * DST_D.array[1] * q;
+    global float *S_max_part = S_part;
+    global float *S_sum_part = S_part + nsplit * part_rows;
+    const size_t part_off = kv_split * part_rows
+            + ((size_t)b1 * DST_D.array[1] + b0) * q;
+
+    a_tile_type_part A_tile_part;
+    if (k0end > 0) {
+        tile_copy_reblock(A_tile, &A_tile_part);
+    } else {
+        tile_fill(A_tile_part, 0.0f);
+    }
+
+    uint sg_i0_vs = sg_i_vs * ugemm_vs_sg_tile_m;
+    uint sg_j0_vs = sg_j_vs * ugemm_vs_sg_tile_n + wg_j0;
+
+    tile_store(A_tile_part, A_part + part_off * d, d, q_group_size, d,
+            sg_i0_vs, sg_j0_vs);
+    if (sg_i_vs == 0) {
+        tile_store(S_max_part_tile, S_max_part + part_off, q_group_size, 1,
+                q_group_size, sg_j0_vs, 0);
+        tile_store(S_sum_part_tile, S_sum_part + part_off, q_group_size, 1,
+                q_group_size, sg_j0_vs, 0);
+    }
+#else
     a_tile_type_dst A_tile_dst;
     if (k0end > 0) {
         /* Convert to half precision and store */
@@ -1030,4 +1162,46 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
 #else
     tile_store(A_tile_dst, A, d, q_group_size, lda, sg_i0_vs, sg_j0_vs);
 #endif
+#endif
 }
+
+#if SPLIT_KV
+/* Combines the results of the key chunks of a split-KV problem. The result
+   of a chunk is normalized by its softmax sum, so it is weighted by the sum
+   rescaled to the largest maximum over all the chunks. */
+kernel void micro_sdpa_merge(const global float *A_part,
+        const global float *S_part, global DST_DATA_T *A, int d, int q,
+        const int nsplit, DST_OFFSETS) {
+    const uint i = get_global_id(0);
+    const uint row = get_global_id(1);
+    const size_t part_rows = (size_t)DST_D.array[0] * DST_D.array[1] * q;
+    const global float *S_max_part = S_part;
+    const global float *S_sum_part = S_part + nsplit * part_rows;
+
+    float S_max = -INFINITY;
+    for (int s = 0; s < nsplit; s++)
+        S_max = max(S_max, S_max_part[s * part_rows + row]);
+
+    float S_sum = 0.0f, acc = 0.0f;
+    for (int s = 0; s < nsplit; s++) {
+        const float S_max_s = S_max_part[s * part_rows + row];
+        if (S_max_s == -INFINITY) continue;
+        const float w = native_exp2(S_max_s - S_max)
+                * S_sum_part[s * part_rows + row];
+        S_sum += w;
+        acc += w * A_part[(s * part_rows + row) * d + i];
+    }
+
+#if SOFTMAX_INF_AS_ZERO
+    const float a = (S_sum == 0.0f) ? 0.0f : acc / S_sum;
+#else
+    const float a = acc / S_sum;
+#endif
+
+    const uint heads = DST_D.array[1];
+    const uint b1 = row / (heads * q);
+    const uint b0 = (row / q) % heads;
+    const uint j = row % q;
+    A[DST_BATCH(b1, b0) + j * DST_S2 + i] = CONVERT_DATA_T(a);
+}
+#endif
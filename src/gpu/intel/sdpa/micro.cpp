@@ -365,12 +365,30 @@ status_t micro_t::pd_t::init_conf_microkernels(impl::engine_t *engine) {
 }
 
 status_t micro_t::init(impl::engine_t *engine) {
-    CHECK(create_kernel(
-            engine, kernel_, pd()->conf.get_kernel_names()[0], pd()->conf));
-    if (!kernel_) return status::runtime_error;
+    const auto &kernel_names = pd()->conf.get_kernel_names();
+    kernels_.resize(kernel_names.size());
+    CHECK(create_kernels(engine, kernels_, kernel_names, pd()->conf));
+    for (const auto &k : kernels_)
+        if (!k) return status::runtime_error;
     return status::success;
 }
 
+void micro_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    if (!conf.split_kv) return;
+
+    // Partial results and softmax statistics (maxima, then sums) of every
+    // chunk of keys for every query.
+    auto rows = into<size_t>(dst_md()->dims[0] * dst_md()->dims[1]
+            * desc()->queries());
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<float>(key_sdpa_acc,
+            kv_split_ * rows * into<size_t>(desc()->head_size()),
+            OCL_BUFFER_ALIGNMENT);
+    scratchpad.book<float>(
+            key_sdpa_stats, 2 * kv_split_ * rows, OCL_BUFFER_ALIGNMENT);
+}
+
 status_t micro_t::pd_t::init_conf(impl::engine_t *engine) {
     using namespace micro;
 
@@ -527,6 +545,44 @@ status_t micro_t::pd_t::init_conf(impl::engine_t *engine) {
     conf.use_systolic_ukernel = pd->use_systolic_ukernel();
     conf.kq_f16_accumulate = (kq_acc_dt() == data_type::f16);
     conf.vs_f16_accumulate = (vs_acc_dt() == data_type::f16);
+
+    /* Paged keys and values are read a tile at a time from the page holding
+       it, and the number of keys is only known per sequence at runtime */
+    conf.paged_kv = pd->is_paged();
+    conf.page_size = conf.paged_kv ? into<int>(d->page_size()) : 0;
+    if (conf.paged_kv) {
+        VCHECK_SDPA_COND(conf.page_size % kq_wg_tile_m == 0,
+                "page size(%d) must be a multiple of the key tile size(%d)",
+                conf.page_size, kq_wg_tile_m);
+        conf.prefetch_k0 = conf.prefetch_k = conf.prefetch_v = false;
+    }
+
+    /* Split the keys across work-groups when there are too few work-groups
+       to fill the device */
+    const dim_t H = pd->dst_md()->dims[1];
+    const dim_t nwg = pd->dst_md()->dims[0]
+            * (Q == 1 ? utils::div_up(Q_per_kv_group, kq_wg_tile_n)
+                            * utils::div_up(H, conf.kv_group_size)
+                      : utils::div_up(Q, kq_wg_tile_n) * H);
+    auto *dev_info = utils::downcast<intel::engine_t *>(engine)->device_info();
+    const int max_wgs
+            = dev_info->hw_threads() / (config.wg_m_kq * config.wg_n_kq);
+    const dim_t K = d->keys();
+    kv_split_ = (pd->with_causal_mask() || conf.paged_kv)
+            ? 1
+            : choose_kv_split(nwg, K, kq_wg_tile_m, max_wgs);
+    kv_split_ = gpu_utils::dev_getenv("SDPA_KV_SPLIT", kv_split_);
+    VCHECK_SDPA_COND(kv_split_ == 1 || !pd->with_causal_mask(),
+            "causal mask is not supported with split keys");
+    VCHECK_SDPA_COND(kv_split_ == 1 || !conf.paged_kv,
+            "paged keys and values are not supported with split keys");
+    kv_split_ = utils::saturate(1, into<int>(K), kv_split_);
+    kv_chunk_ = into<int>(
+            utils::rnd_up(utils::div_up(K, kv_split_), kq_wg_tile_m));
+    kv_split_ = into<int>(utils::div_up(K, kv_chunk_));
+    conf.split_kv = (kv_split_ > 1);
+
+    init_scratchpad();
     return status::success;
 }
 
@@ -605,6 +661,9 @@ status_t micro_params_t::get_kernel_ctx(
     kernel_ctx.define_int("USE_SYSTOLIC_UKERNEL", use_systolic_ukernel);
     kernel_ctx.define_int("KQ_F16_ACC", kq_f16_accumulate);
     kernel_ctx.define_int("VS_F16_ACC", vs_f16_accumulate);
+    kernel_ctx.define_int("SPLIT_KV", split_kv);
+    kernel_ctx.define_int("PAGED_KV", paged_kv);
+    kernel_ctx.define_int("PAGE_SIZE", page_size);
 
     gemmstone::HWInformation hw_info;
     gemmstone::GEMMProblem problem_kq, problem_vs;
@@ -773,10 +832,31 @@ status_t micro_t::execute(const exec_ctx_t &ctx) const {
     append_offs(arg_list, dst_off);
 
     if (pd()->with_attn_mask()) { append_offs(arg_list, msk_off); }
-    const int remainder_k = (K % kq_wg_tile_m) != 0;
+    // The keys of a sequence of a paged problem may end in any tile.
+    const int remainder_k = conf.paged_kv || (K % kq_wg_tile_m) != 0;
 
     arg_list.append(remainder_k);
 
+    if (conf.paged_kv) {
+        const auto &block_table = CTX_IN_STORAGE(DNNL_ARG_BLOCK_TABLE);
+        const auto &context_lens = CTX_IN_STORAGE(DNNL_ARG_CONTEXT_LENS);
+        arg_list.append(block_table);
+        arg_list.append(context_lens);
+        arg_list.append((int)pd()->block_table_md()->dims[1]);
+    }
+
+    using namespace memory_tracking::names;
+    std::unique_ptr<memory_storage_t> A_part, S_part;
+    if (conf.split_kv) {
+        A_part = ctx.get_scratchpad_grantor().get_memory_storage(key_sdpa_acc);
+        S_part = ctx.get_scratchpad_grantor().get_memory_storage(
+                key_sdpa_stats);
+        arg_list.append(*A_part);
+        arg_list.append(*S_part);
+        arg_list.append(pd()->kv_chunk());
+        arg_list.append(pd()->kv_split());
+    }
+
     compute::range_t lws = {(size_t)pd()->sg_size(), (size_t)sg_per_wg, 1};
     compute::range_t gws = lws;
 
@@ -791,9 +871,25 @@ status_t micro_t::execute(const exec_ctx_t &ctx) const {
         gws[1] *= pd()->dst_md()->dims[1];
     }
     gws[2] *= pd()->dst_md()->dims[0];
+    if (conf.split_kv) gws[2] *= pd()->kv_split();
 
     auto nd_range = compute::nd_range_t(gws, lws);
-    return parallel_for(ctx, nd_range, kernel_, arg_list);
+    CHECK(parallel_for(ctx, nd_range, kernels_[0], arg_list));
+    if (!conf.split_kv) return status::success;
+
+    compute::kernel_arg_list_t merge_arg_list;
+    merge_arg_list.append(*A_part);
+    merge_arg_list.append(*S_part);
+    merge_arg_list.append(dst);
+    merge_arg_list.append((int)D);
+    merge_arg_list.append((int)Q);
+    merge_arg_list.append(pd()->kv_split());
+    append_offs(merge_arg_list, dst_off);
+
+    compute::range_t merge_gws = {(size_t)D,
+            (size_t)(pd()->dst_md()->dims[0] * pd()->dst_md()->dims[1] * Q)};
+    return parallel_for(
+            ctx, compute::nd_range_t(merge_gws), kernels_[1], merge_arg_list);
 }
 
 } // namespace sdpa
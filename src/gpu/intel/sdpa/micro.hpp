@@ -40,7 +40,9 @@ struct micro_params_t : trivially_serializable_t<micro_params_t> {
 
     const std::vector<const char *> &get_kernel_names() const {
         static const std::vector<const char *> kernel_names = {"micro_sdpa"};
-        return kernel_names;
+        static const std::vector<const char *> split_kv_kernel_names
+                = {"micro_sdpa", "micro_sdpa_merge"};
+        return split_kv ? split_kv_kernel_names : kernel_names;
     }
 
     status_t create_generator(const intel::engine_t &engine,
@@ -90,7 +92,9 @@ struct micro_params_t : trivially_serializable_t<micro_params_t> {
     bool q_arrive_await_barrier;
     bool use_systolic_ukernel;
     bool kq_f16_accumulate, vs_f16_accumulate;
-    uint8_t padding3[7] = {0};
+    bool split_kv, paged_kv;
+    uint8_t padding3[1] = {0};
+    int page_size;
 
     micro_ukernel_params_t ukernel_config;
 };
@@ -192,6 +196,22 @@ struct micro_t : public primitive_t {
                     static_cast<long int>(key_md()->dims[1]),
                     static_cast<long int>(val_md()->dims[1]));
 
+            if (is_paged()) {
+                VCHECK_SDPA_COND(
+                        memory_desc_wrapper(block_table_md())
+                                        .matches_tag(format_tag::ab)
+                                && memory_desc_wrapper(context_lens_md())
+                                           .matches_tag(format_tag::a),
+                        VERBOSE_UNSUPPORTED_TAG);
+                VCHECK_SDPA_COND(!with_attn_mask() || with_causal_mask(),
+                        "attention mask buffers are not supported with paged "
+                        "keys and values");
+                VCHECK_SDPA_COND(!with_key_scales() && !with_key_zp()
+                                && !with_value_scales() && !with_value_zp(),
+                        "quantized keys and values are not supported with "
+                        "paged keys and values");
+            }
+
             VCHECK_SDPA_COND(utils::one_of(kq_acc_dt(), f16, f32),
                     "KQ accumulation data type should be f16 or f32");
             VCHECK_SDPA_COND(utils::one_of(vs_acc_dt(), f16, f32),
@@ -291,15 +311,24 @@ struct micro_t : public primitive_t {
         }
 
         compute::gpu_arch_t arch() const { return arch_; }
+
+        // The number of chunks the keys are split into and the number of
+        // keys of a chunk, see choose_kv_split().
+        int kv_split() const { return kv_split_; }
+        int kv_chunk() const { return kv_chunk_; }
+
         micro_params_t conf;
 
     private:
         int sg_size_ = 0;
+        int kv_split_ = 1;
+        int kv_chunk_ = 0;
         bool use_systolic_ukernel_ = true;
         compute::gpu_arch_t arch_ = compute::gpu_arch_t::unknown;
 
         status_t init_conf_microkernels(impl::engine_t *engine);
         status_t init_conf(impl::engine_t *engine);
+        void init_scratchpad();
     };
 
     status_t init(impl::engine_t *engine) override;
@@ -308,7 +337,8 @@ private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     status_t execute(const exec_ctx_t &ctx) const override;
 
-    compute::kernel_t kernel_;
+    // The main kernel and, for split-KV problems, the merge kernel.
+    std::vector<compute::kernel_t> kernels_;
 };
 
 } // namespace sdpa
@@ -15,6 +15,10 @@
 *******************************************************************************/
 #include "gpu/intel/softmax/simple.h"
 
+#if WITH_DROPOUT
+#include "gpu/intel/include/philox.h"
+#endif
+
 #if IS_FWD
 
 #if SUB_GROUP_SIZE == 16
@@ -24,7 +28,17 @@ __attribute__((intel_reqd_sub_group_size(SUB_GROUP_SIZE)))
 
 __kernel void
 simple_softmax_fwd_generic(__global SRC_DATA_T *src, __global DATA_T *dst,
-        __global float *src_scale, __global float *dst_scale POST_OP_ARGS) {
+        __global float *src_scale, __global float *dst_scale
+#if WITH_MASK_LENGTHS
+        ,
+        __global int *mask_lengths
+#endif
+#if WITH_DROPOUT
+        ,
+        __global uchar *dropout_mask_buf, __global uint *dropout_seed_buf,
+        __global float *dropout_p_buf
+#endif
+                POST_OP_ARGS) {
 
     const int dim[] = {
             (get_global_id(0) / GROUP_SIZE) % BLOCK_0,
@@ -82,9 +96,31 @@ simple_softmax_fwd_generic(__global SRC_DATA_T *src, __global DATA_T *dst,
     acc_t max_ = -acc_max;
     acc_t denom_ = acc_zero;
 
+    // Only a prefix of the row is kept by the mask, the rest is neither read
+    // nor accounted in the reductions.
+    int n_valid = DD(SOFTMAX_AXIS_IDX);
+#if WITH_CAUSAL_MASK
+    const int row = dim[SOFTMAX_AXIS_IDX - 1];
+    n_valid = min(n_valid, max(0, row + CAUSAL_SHIFT + 1));
+#endif
+#if WITH_MASK_LENGTHS
+    if (!(NEEDS_PADDING(dim[0], dim[1], dim[2], dim[3], dim[4], 0))) {
+        const int len = mask_lengths[MD_OFF(
+                LENGTHS, dim[0], dim[1], dim[2], dim[3], dim[4], 0)];
+        n_valid = min(n_valid, max(0, len));
+    }
+#endif
+
+#if WITH_DROPOUT
+    const uint dropout_seed = dropout_seed_buf[0];
+    const uint dropout_threshold = get_dropout_threshold(dropout_p_buf[0]);
+    const float dropout_inv_q
+            = (dropout_p_buf[0] != 1.f) ? 1.f / (1.f - dropout_p_buf[0]) : 0.f;
+#endif
+
     // finding max value for each sub_group
     if (!(NEEDS_PADDING(dim[0], dim[1], dim[2], dim[3], dim[4], begin))) {
-        for (int i = begin; i < end && i < DD(SOFTMAX_AXIS_IDX); ++i) {
+        for (int i = begin; i < end && i < n_valid; ++i) {
             size_t data_off
                     = DATA_OFF(dim[0], dim[1], dim[2], dim[3], dim[4], i);
             d[i - begin] = SRC_TO_REF(src[data_off]);
@@ -104,7 +140,7 @@ simple_softmax_fwd_generic(__global SRC_DATA_T *src, __global DATA_T *dst,
 
     // updating dst tensor and accumulating denom for last step
     if (!(NEEDS_PADDING(dim[0], dim[1], dim[2], dim[3], dim[4], begin))) {
-        for (int i = begin; i < end && i < DD(SOFTMAX_AXIS_IDX); ++i) {
+        for (int i = begin; i < end && i < n_valid; ++i) {
 #if LOGSOFTMAX
             denom_ += exp(d[i - begin] - max_);
 #else
@@ -136,11 +172,17 @@ simple_softmax_fwd_generic(__global SRC_DATA_T *src, __global DATA_T *dst,
         } else {
             float unscaled;
 #if LOGSOFTMAX
-            unscaled = d[i - begin] - max_ - denom_;
+            unscaled = i < n_valid ? d[i - begin] - max_ - denom_ : -INFINITY;
 #else
-            unscaled = d[i - begin] * denom_;
+            unscaled = i < n_valid ? d[i - begin] * denom_ : 0.f;
 #endif
             tmp = (POST_OP_DATA_T)(scale * unscaled);
+#if WITH_DROPOUT
+            uchar dropout
+                    = philox_4x32(data_off, dropout_seed) > dropout_threshold;
+            tmp = dropout ? tmp * dropout_inv_q : 0;
+            dropout_mask_buf[data_off] = dropout;
+#endif
         }
         // post op service
         POST_OP_DATA_T sum_src;
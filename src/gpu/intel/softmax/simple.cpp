@@ -31,12 +31,22 @@ status_t simple_fwd_t::execute_generic(const exec_ctx_t &ctx) const {
     auto &dst_scale = CTX_IN_STORAGE(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
 
     compute::kernel_arg_list_t arg_list;
-    arg_list.set(0, src);
-    arg_list.set(1, dst);
-    arg_list.set(2, src_scale);
-    arg_list.set(3, dst_scale);
+    int arg_idx = 0;
+    arg_list.set(arg_idx++, src);
+    arg_list.set(arg_idx++, dst);
+    arg_list.set(arg_idx++, src_scale);
+    arg_list.set(arg_idx++, dst_scale);
+    if (pd()->with_mask_lengths())
+        arg_list.set(
+                arg_idx++, CTX_IN_STORAGE(DNNL_ARG_ATTR_SOFTMAX_LENGTHS));
+    if (pd()->with_dropout()) {
+        arg_list.set(arg_idx++, CTX_OUT_STORAGE(DNNL_ARG_ATTR_DROPOUT_MASK));
+        arg_list.set(arg_idx++, CTX_IN_STORAGE(DNNL_ARG_ATTR_DROPOUT_SEED));
+        arg_list.set(
+                arg_idx++, CTX_IN_STORAGE(DNNL_ARG_ATTR_DROPOUT_PROBABILITY));
+    }
     append_post_ops_to_arg_list(
-            ctx, arg_list, 4, pd()->attr()->post_ops_, *pd()->dst_md());
+            ctx, arg_list, arg_idx, pd()->attr()->post_ops_, *pd()->dst_md());
 
     if (pd()->group_size > 1) {
         auto nd_range = compute::nd_range_t(pd()->gws, pd()->lws);
@@ -34,49 +34,57 @@
 #error unsupported data parameter
 #endif
 
-#define OFF(dim, idx) \
-    (dim % CONCAT2(DATA_B, idx)) * CONCAT2(DATA_SB, idx) \
-            + (dim / CONCAT2(DATA_B, idx)) * CONCAT2(DATA_S, idx)
+#define OFF(prefix, dim, idx) \
+    (dim % CONCAT2(prefix, CONCAT2(_B, idx))) \
+                    * CONCAT2(prefix, CONCAT2(_SB, idx)) \
+            + (dim / CONCAT2(prefix, CONCAT2(_B, idx))) \
+                    * CONCAT2(prefix, CONCAT2(_S, idx))
 
 #if SOFTMAX_AXIS_IDX == 0
-#define DATA_OFF(dim0, dim1, dim2, dim3, dim4, softmax_dim) \
-    OFF(softmax_dim, 0) + OFF(dim0, 1) + OFF(dim1, 2) + OFF(dim2, 3) \
-            + OFF(dim3, 4) + OFF(dim4, 5)
+#define MD_OFF(prefix, dim0, dim1, dim2, dim3, dim4, softmax_dim) \
+    OFF(prefix, softmax_dim, 0) + OFF(prefix, dim0, 1) \
+            + OFF(prefix, dim1, 2) + OFF(prefix, dim2, 3) \
+            + OFF(prefix, dim3, 4) + OFF(prefix, dim4, 5)
 #define NEEDS_PADDING(dim0, dim1, dim2, dim3, dim4, softmax_dim) \
     softmax_dim >= DD(0) || dim0 >= DD(1) || dim1 >= DD(2) || dim2 >= DD(3) \
             || dim3 >= DD(4) || dim4 >= DD(5)
 #elif SOFTMAX_AXIS_IDX == 1
-#define DATA_OFF(dim0, dim1, dim2, dim3, dim4, softmax_dim) \
-    OFF(dim0, 0) + OFF(softmax_dim, 1) + OFF(dim1, 2) + OFF(dim2, 3) \
-            + OFF(dim3, 4) + OFF(dim4, 5)
+#define MD_OFF(prefix, dim0, dim1, dim2, dim3, dim4, softmax_dim) \
+    OFF(prefix, dim0, 0) + OFF(prefix, softmax_dim, 1) \
+            + OFF(prefix, dim1, 2) + OFF(prefix, dim2, 3) \
+            + OFF(prefix, dim3, 4) + OFF(prefix, dim4, 5)
 #define NEEDS_PADDING(dim0, dim1, dim2, dim3, dim4, softmax_dim) \
     dim0 >= DD(0) || softmax_dim >= DD(1) || dim1 >= DD(2) || dim2 >= DD(3) \
             || dim3 >= DD(4) || dim4 >= DD(5)
 #elif SOFTMAX_AXIS_IDX == 2
-#define DATA_OFF(dim0, dim1, dim2, dim3, dim4, softmax_dim) \
-    OFF(dim0, 0) + OFF(dim1, 1) + OFF(softmax_dim, 2) + OFF(dim2, 3) \
-            + OFF(dim3, 4) + OFF(dim4, 5)
+#define MD_OFF(prefix, dim0, dim1, dim2, dim3, dim4, softmax_dim) \
+    OFF(prefix, dim0, 0) + OFF(prefix, dim1, 1) \
+            + OFF(prefix, softmax_dim, 2) + OFF(prefix, dim2, 3) \
+            + OFF(prefix, dim3, 4) + OFF(prefix, dim4, 5)
 #define NEEDS_PADDING(dim0, dim1, dim2, dim3, dim4, softmax_dim) \
     dim0 >= DD(0) || dim1 >= DD(1) || softmax_dim >= DD(2) || dim2 >= DD(3) \
             || dim3 >= DD(4) || dim4 >= DD(5)
 #elif SOFTMAX_AXIS_IDX == 3
-#define DATA_OFF(dim0, dim1, dim2, dim3, dim4, softmax_dim) \
-    OFF(dim0, 0) + OFF(dim1, 1) + OFF(dim2, 2) + OFF(softmax_dim, 3) \
-            + OFF(dim3, 4) + OFF(dim4, 5)
+#define MD_OFF(prefix, dim0, dim1, dim2, dim3, dim4, softmax_dim) \
+    OFF(prefix, dim0, 0) + OFF(prefix, dim1, 1) \
+            + OFF(prefix, dim2, 2) + OFF(prefix, softmax_dim, 3) \
+            + OFF(prefix, dim3, 4) + OFF(prefix, dim4, 5)
 #define NEEDS_PADDING(dim0, dim1, dim2, dim3, dim4, softmax_dim) \
     dim0 >= DD(0) || dim1 >= DD(1) || dim2 >= DD(2) || softmax_dim >= DD(3) \
             || dim3 >= DD(4) || dim4 >= DD(5)
 #elif SOFTMAX_AXIS_IDX == 4
-#define DATA_OFF(dim0, dim1, dim2, dim3, dim4, softmax_dim) \
-    OFF(dim0, 0) + OFF(dim1, 1) + OFF(dim2, 2) + OFF(dim3, 3) \
-            + OFF(softmax_dim, 4) + OFF(dim4, 5)
+#define MD_OFF(prefix, dim0, dim1, dim2, dim3, dim4, softmax_dim) \
+    OFF(prefix, dim0, 0) + OFF(prefix, dim1, 1) \
+            + OFF(prefix, dim2, 2) + OFF(prefix, dim3, 3) \
+            + OFF(prefix, softmax_dim, 4) + OFF(prefix, dim4, 5)
 #define NEEDS_PADDING(dim0, dim1, dim2, dim3, dim4, softmax_dim) \
     dim0 >= DD(0) || dim1 >= DD(1) || dim2 >= DD(2) || dim3 >= DD(3) \
             || softmax_dim >= DD(4) || dim4 >= DD(5)
 #elif SOFTMAX_AXIS_IDX == 5
-#define DATA_OFF(dim0, dim1, dim2, dim3, dim4, softmax_dim) \
-    OFF(dim0, 0) + OFF(dim1, 1) + OFF(dim2, 2) + OFF(dim3, 3) + OFF(dim4, 4) \
-            + OFF(softmax_dim, 5)
+#define MD_OFF(prefix, dim0, dim1, dim2, dim3, dim4, softmax_dim) \
+    OFF(prefix, dim0, 0) + OFF(prefix, dim1, 1) \
+            + OFF(prefix, dim2, 2) + OFF(prefix, dim3, 3) \
+            + OFF(prefix, dim4, 4) + OFF(prefix, softmax_dim, 5)
 #define NEEDS_PADDING(dim0, dim1, dim2, dim3, dim4, softmax_dim) \
     dim0 >= DD(0) || dim1 >= DD(1) || dim2 >= DD(2) || dim3 >= DD(3) \
             || dim4 >= DD(4) || softmax_dim >= DD(5)
@@ -84,4 +92,7 @@
 #error unsupported softmax dimension
 #endif
 
+#define DATA_OFF(dim0, dim1, dim2, dim3, dim4, softmax_dim) \
+    MD_OFF(DATA, dim0, dim1, dim2, dim3, dim4, softmax_dim)
+
 #endif // GPU_INTEL_SOFTMAX_SIMPLE_H
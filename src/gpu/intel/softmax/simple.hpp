@@ -71,7 +71,9 @@ struct simple_fwd_t : public primitive_t {
             VDISPATCH_SOFTMAX(memory_desc_ndims_ok(src_md(), dst_md()),
                     VERBOSE_INCONSISTENT_NDIMS, "src", "dst");
             VDISPATCH_SOFTMAX(attr()->has_default_values(skip_mask_t::scales
-                                      | skip_mask_t::post_ops),
+                                      | skip_mask_t::post_ops
+                                      | skip_mask_t::softmax_mask
+                                      | skip_mask_t::dropout),
                     VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_SOFTMAX(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
             VDISPATCH_SOFTMAX(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
@@ -79,6 +81,7 @@ struct simple_fwd_t : public primitive_t {
                     set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_SOFTMAX_SC(attr_.set_default_formats(dst_md(0)),
                     VERBOSE_UNSUPPORTED_POSTOP);
+            VDISPATCH_SOFTMAX(attr_dropout_ok(), VERBOSE_UNSUPPORTED_ATTR);
 
             dim_t nelems = axis_size(true);
 
@@ -172,6 +175,22 @@ struct simple_fwd_t : public primitive_t {
         CHECK(def_attr_info(kernel_ctx, attr_info_t::create(pd()->attr()),
                 pd()->attr()->post_ops_, *pd()->invariant_dst_md()));
 
+        // The mask, softmax and dropout are applied in a single pass, so
+        // the attention scores are read once and written once.
+        const auto &sm = pd()->attr()->softmax_mask_;
+        kernel_ctx.define_int("WITH_CAUSAL_MASK", sm.with_causal());
+        if (sm.with_causal()) {
+            const dim_t nrows = pd()->dst_md()->dims[desc->softmax_axis - 1];
+            kernel_ctx.define_int("CAUSAL_SHIFT",
+                    sm.kind_ == softmax_mask_kind::causal_bottom_right
+                            ? pd()->axis_size() - nrows
+                            : 0);
+        }
+        kernel_ctx.define_int("WITH_MASK_LENGTHS", sm.with_lengths());
+        if (sm.with_lengths())
+            set_offsets(kernel_ctx, &sm.lengths_desc_, "LENGTHS");
+        kernel_ctx.define_int("WITH_DROPOUT", pd()->with_dropout());
+
         for (int i = 0; i < 3; i++)
             kernel_ctx.define_int(utils::format("BLOCK_%d", i), pd()->block[i]);
 
@@ -25,6 +25,20 @@ namespace impl {
 namespace gpu {
 namespace intel {
 
+status_t stream_t::get_last_exec_counters(exec_counters_t &counters) const {
+    if (!is_profiling_enabled()) return status::unimplemented;
+    xpu::stream_profiler_t::entry_t entry;
+    CHECK(profiler().get_last_entry(entry));
+    // Without Metrics Discovery, the frequency is not reported either.
+    if (entry.kernel_count == 0 || entry.freq == 0)
+        return status::unimplemented;
+    counters.nsec = entry.get_nsec();
+    counters.eu_active_nsec = entry.eu_active_nsec;
+    counters.eu_stall_nsec = entry.eu_stall_nsec;
+    counters.mem_bytes = entry.mem_bytes;
+    return status::success;
+}
+
 status_t stream_t::zero_pad(const memory_t *memory, const exec_ctx_t &ctx) {
     memory_desc_wrapper mdw(memory->md());
 
@@ -29,6 +29,7 @@ public:
     using gpu::stream_t::stream_t;
 
     status_t notify_profiling_complete() const override;
+    status_t get_last_exec_counters(exec_counters_t &counters) const override;
 
     virtual status_t barrier() = 0;
     virtual status_t enter_immediate_mode() { return status::success; }
@@ -130,6 +130,8 @@ status_t device_info_t::init_attributes(impl::engine_t *engine) {
                     = xpu::sycl::compat::get_native<cl_device_id>(device);
             CHECK(gpu::intel::ocl::get_ocl_device_eu_count(
                     ocl_dev, gpu_arch_, &eu_count_));
+            CHECK(gpu::intel::ocl::get_ocl_device_host_unified_memory(
+                    ocl_dev, host_unified_memory_));
         } else {
             auto slices = device.get_info<
                     xpu::sycl::compat::ext_intel_gpu_slices>();
@@ -141,6 +143,9 @@ status_t device_info_t::init_attributes(impl::engine_t *engine) {
                 eus_per_subslice
                         = 8; /* override incorrect driver information */
             eu_count_ = slices * sub_slices * eus_per_subslice;
+            if (be == xpu::sycl::backend_t::level0)
+                CHECK(get_l0_device_host_unified_memory(
+                        device, host_unified_memory_));
         }
     } else {
         eu_count_ = device.get_info<::sycl::info::device::max_compute_units>();
@@ -150,6 +155,9 @@ status_t device_info_t::init_attributes(impl::engine_t *engine) {
             = device.get_info<::sycl::info::device::global_mem_cache_size>();
     mayiuse_system_memory_allocators_
             = device.has(::sycl::aspect::usm_system_allocations);
+    tile_count_ = nstl::max(1,
+            (int)device.get_info<
+                    ::sycl::info::device::partition_max_sub_devices>());
     return status::success;
 }
 
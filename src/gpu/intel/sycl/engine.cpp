@@ -48,6 +48,13 @@ status_t engine_t::create_stream(
     return gpu::intel::sycl::stream_t::create_stream(stream, this, stream_impl);
 }
 
+bool engine_t::is_zero_copy_ptr(const void *ptr) const {
+    if (!ptr || !has_host_unified_memory()) return false;
+    using ::sycl::usm::alloc;
+    const auto kind = ::sycl::get_pointer_type(ptr, context());
+    return utils::one_of(kind, alloc::host, alloc::shared);
+}
+
 status_t engine_t::create_kernel(gpu::intel::compute::kernel_t *kernel,
         gpu::intel::jit::generator_base_t *jitter) const {
     if (kind() != engine_kind::gpu) {
@@ -135,6 +135,8 @@ public:
         return gpu::intel::sycl::device_id(device());
     }
 
+    bool is_zero_copy_ptr(const void *ptr) const override;
+
     DECLARE_COMMON_SYCL_ENGINE_FUNCTIONS();
 
 protected:
@@ -304,6 +304,18 @@ bool compare_ze_devices(const ::sycl::device &lhs, const ::sycl::device &rhs) {
     return lhs_ze_handle == rhs_ze_handle;
 }
 
+status_t get_l0_device_host_unified_memory(
+        const ::sycl::device &dev, bool &host_unified_memory) {
+    auto deviceProps = ze_device_properties_t();
+    deviceProps.stype = ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES;
+
+    auto ze_device = xpu::sycl::compat::get_native<ze_device_handle_t>(dev);
+    CHECK(func_zeDeviceGetProperties(ze_device, &deviceProps));
+    host_unified_memory
+            = deviceProps.flags & ZE_DEVICE_PROPERTY_FLAG_INTEGRATED;
+    return status::success;
+}
+
 status_t get_device_ip(ze_device_handle_t device, uint32_t &ip_version) {
     auto devicePropsIP = ze_device_ip_version_ext_t();
     devicePropsIP.stype = ZE_STRUCTURE_TYPE_DEVICE_IP_VERSION_EXT;
@@ -42,6 +42,9 @@ status_t sycl_create_kernels_with_level_zero(
 
 bool compare_ze_devices(const ::sycl::device &lhs, const ::sycl::device &rhs);
 
+status_t get_l0_device_host_unified_memory(
+        const ::sycl::device &dev, bool &host_unified_memory);
+
 #ifdef DNNL_EXPERIMENTAL_SYCL_KERNEL_COMPILER
 status_t func_zeGetKernelBinary(
         ze_kernel_handle_t hKernel, size_t *pSize, uint8_t *pKernelBinary);
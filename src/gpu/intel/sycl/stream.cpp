@@ -148,6 +148,65 @@ status_t stream_t::exit_immediate_mode() {
     return status::success;
 }
 
+stream_t::~stream_t() {
+    if (!capture_graph_) return;
+    try {
+        capture_graph_->end_recording();
+    } catch (const ::sycl::exception &) {}
+}
+
+status_t stream_t::begin_native_capture() {
+    using graph_t = syclex::command_graph<syclex::graph_state::modifiable>;
+    // The queue may already be recorded into a graph of the user.
+    if (recording()) return status::invalid_arguments;
+
+    auto &q = queue();
+    replay_graph_.reset();
+    try {
+        capture_graph_.reset(new graph_t(q.get_context(), q.get_device()));
+        capture_graph_->begin_recording(q);
+    } catch (const ::sycl::exception &e) {
+        capture_graph_.reset();
+        VERROR(common, dpcpp, "could not record the queue into a graph: %s",
+                e.what());
+        return status::unimplemented;
+    }
+    sycl_ctx().set_deps(xpu::sycl::event_t());
+    return status::success;
+}
+
+status_t stream_t::end_native_capture() {
+    using exec_graph_t = syclex::command_graph<syclex::graph_state::executable>;
+    if (!capture_graph_) return status::invalid_arguments;
+
+    status_t status = status::success;
+    try {
+        capture_graph_->end_recording();
+        replay_graph_.reset(new exec_graph_t(capture_graph_->finalize()));
+    } catch (const ::sycl::exception &e) {
+        VERROR(common, dpcpp, "could not finalize the recorded graph: %s",
+                e.what());
+        status = status::runtime_error;
+    }
+    capture_graph_.reset();
+    return status;
+}
+
+status_t stream_t::replay_native_capture() {
+    if (!replay_graph_) return status::invalid_arguments;
+    try {
+        auto event = queue().ext_oneapi_graph(*replay_graph_);
+        // Out-of-order executions submitted next depend on the replay.
+        if (!queue().is_in_order())
+            sycl_ctx().set_deps(xpu::sycl::event_t({event}));
+    } catch (const ::sycl::exception &e) {
+        VERROR(common, dpcpp, "could not submit the recorded graph: %s",
+                e.what());
+        return status::runtime_error;
+    }
+    return status::success;
+}
+
 status_t stream_t::pause_recording() {
     using graph_t = syclex::command_graph<syclex::graph_state::modifiable>;
     if (recording()) {
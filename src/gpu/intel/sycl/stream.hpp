@@ -120,7 +120,17 @@ struct stream_t : public gpu::intel::stream_t {
     status_t enter_immediate_mode() override;
     status_t exit_immediate_mode() override;
 
+    ~stream_t() override;
+
 protected:
+    // The capture records the queue into a command graph owned by the
+    // stream, which is finalized at the end of the capture and submitted at
+    // once on replay, so a decode step of many small kernels pays for a
+    // single submission.
+    status_t begin_native_capture() override;
+    status_t end_native_capture() override;
+    status_t replay_native_capture() override;
+
     xpu::sycl::stream_impl_t *impl() const {
         return (xpu::sycl::stream_impl_t *)impl::stream_t::impl_.get();
     }
@@ -140,6 +150,13 @@ private:
             ::sycl::ext::oneapi::experimental::graph_state::modifiable>>
             paused_graph_;
     xpu::sycl::event_t paused_dep_;
+
+    std::unique_ptr<::sycl::ext::oneapi::experimental::command_graph<
+            ::sycl::ext::oneapi::experimental::graph_state::modifiable>>
+            capture_graph_;
+    std::unique_ptr<::sycl::ext::oneapi::experimental::command_graph<
+            ::sycl::ext::oneapi::experimental::graph_state::executable>>
+            replay_graph_;
 };
 
 } // namespace sycl
@@ -448,6 +448,24 @@ bool is_plain(const memory::desc &adesc) {
     return adesc.get_inner_nblks() == 0;
 }
 
+bool prefer_blocked_layout(const dnnl::primitive_desc_base &blocked_pd,
+        const dnnl::primitive_desc_base &plain_pd,
+        const memory::desc &given_src) {
+    // The implementation did not pick a blocked layout for `any`.
+    const auto blocked_src = blocked_pd.src_desc();
+    if (is_plain(blocked_src)) return false;
+
+    // The optimized implementations reorder the weights, given with `any`
+    // format, into a blocked layout for their kernels, while the reference
+    // and gemm-based ones keep them plain.
+    const auto is_optimized = [](const dnnl::primitive_desc_base &pd) {
+        return !is_plain(pd.weights_desc());
+    };
+    const bool blocked_optimized = is_optimized(blocked_pd);
+    if (blocked_optimized != is_optimized(plain_pd)) return blocked_optimized;
+    return given_src == blocked_src;
+}
+
 // get the dense strides of a given shape
 // eg. (3, 4, 5) -> (20, 5, 1)
 dims get_dense_strides(const dims &shape) {
@@ -34,6 +34,7 @@
 #include "graph/utils/any.hpp"
 
 #define DNNL_GRAPH_ARG_POST_SRC (-1)
+#define DNNL_GRAPH_ARG_QUANT_DIVISOR (-2)
 
 namespace dnnl {
 namespace impl {
@@ -123,6 +124,18 @@ bool is_4c_blocked(const memory::desc &adesc);
 
 bool is_plain(const memory::desc &adesc);
 
+// A cost model for the activation layouts of a primitive on CPU, where the
+// plain channels-last layout usually gives an optimal kernel and needs no
+// reorders at the boundaries of partitions. The layouts chosen by the
+// primitive descriptors, created with `any` weights, are compared. The blocked
+// layout is preferred if the blocked src is chosen for `any` and either only
+// its implementation uses blocked weights, i.e. is an optimized one, or both
+// or none of them do and the given source already has the blocked layout,
+// e.g. the output of a previous partition.
+bool prefer_blocked_layout(const dnnl::primitive_desc_base &blocked_pd,
+        const dnnl::primitive_desc_base &plain_pd,
+        const memory::desc &given_src);
+
 memory::desc to_ncx_format(const memory::desc &adesc);
 
 void set_all_layout_to_any(std::vector<std::shared_ptr<op_t>> &subgraph);
@@ -64,13 +64,14 @@ struct dnnl_constant_buffer_t : public graph::constant_buffer_t {
 
 inline graph::constant_tensor_cache_t::value_t dnnl_constant_cache_get_or_add(
         const dnnl::engine &eng, graph::constant_tensor_cache_t::key_t key,
-        size_t size, const graph::constant_tensor_cache_t::value_t &value) {
+        size_t size, const graph::constant_tensor_cache_t::value_t &value,
+        int32_t priority = 0) {
     auto cache = graph::get_constant_tensor_cache(
             eng.get()->kind(), eng.get()->index());
     assertm(cache,
             "no available constant cache for specified engine kind and index");
-    return cache->get_or_add(
-            dnnl_backend_t::get_singleton().get_id(), key, size, value);
+    return cache->get_or_add(dnnl_backend_t::get_singleton().get_id(), key,
+            size, value, priority);
 }
 
 inline void dnnl_constant_cache_remove_if_exist(
@@ -82,6 +83,15 @@ inline void dnnl_constant_cache_remove_if_exist(
     cache->remove_if_exist(dnnl_backend_t::get_singleton().get_id(), key);
 }
 
+inline bool dnnl_constant_cache_is_ready(
+        const dnnl::engine &eng, graph::constant_tensor_cache_t::key_t key) {
+    auto cache = graph::get_constant_tensor_cache(
+            eng.get()->kind(), eng.get()->index());
+    assertm(cache,
+            "no available constant cache for specified engine kind and index");
+    return cache->is_ready(dnnl_backend_t::get_singleton().get_id(), key);
+}
+
 inline bool is_constant_cache_enabled(const dnnl::engine &eng) {
     auto cache = graph::get_constant_tensor_cache(
             eng.get()->kind(), eng.get()->index());
@@ -1038,7 +1038,7 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_layernorm, 1,
                 .set_inputs_option(op_schema_t::param_num_option::variadic)
                 .set_num_inputs(std::set<size_t>({1, 32}))
                 .set_outputs_option(op_schema_t::param_num_option::optional)
-                .set_num_outputs(std::set<size_t>({2, 4}))
+                .set_num_outputs(std::set<size_t>({2, 3, 4, 5}))
                 .set_input(0, "input")
                 .set_input(1, "gamma")
                 .set_input(2, "beta")
@@ -1055,6 +1055,8 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_layernorm, 1,
                 .set_attr(op_attr::fusion_info, false,
                         attribute_kind::fusion_info)
                 // New added attributes
+                .set_attr(op_attr::with_dynamic_quant, false,
+                        attribute_kind::b, false)
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
                 // Analysis rules
                 .set_shape_inference_function(infer_norm_output_shape)
@@ -14,6 +14,8 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <algorithm>
+
 #include "graph/backend/dnnl/dnnl_partition_impl.hpp"
 
 #include "graph/backend/dnnl/kernels/kernels.hpp"
@@ -41,8 +43,85 @@ status_t get_ordered_inputs_outputs(
     if (ordered.size() != expected.size()) return status::invalid_arguments;
     return status::success;
 }
+
+// Whether some dimensions of the inputs are only known at execution. The
+// ranks of the inputs are still required.
+bool has_dynamic_dims(const std::vector<logical_tensor_t> &inputs) {
+    for (const auto &lt : inputs) {
+        const logical_tensor_wrapper_t ltw(lt);
+        for (int d = 0; d < ltw.ndims(); d++) {
+            if (ltw.dims()[d] == DNNL_GRAPH_UNKNOWN_DIM) return true;
+        }
+    }
+    return false;
+}
 } // namespace
 
+status_t dnnl_dynamic_compiled_partition_impl_t::reset_engine(
+        const engine_t *engine) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    engine_ = const_cast<engine_t *>(engine);
+    for (auto &entry : kernels_)
+        CHECK(entry.second->reset_engine(engine));
+    return status::success;
+}
+
+size_t dnnl_dynamic_compiled_partition_impl_t::get_temporary_size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t size = 0;
+    for (const auto &entry : kernels_)
+        size = std::max(size, entry.second->get_temporary_size());
+    return size;
+}
+
+void dnnl_dynamic_compiled_partition_impl_t::set_constant_cache_priority(
+        int32_t priority) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    constant_cache_priority_ = priority;
+    for (auto &entry : kernels_)
+        entry.second->set_constant_cache_priority(priority);
+}
+
+status_t dnnl_dynamic_compiled_partition_impl_t::get_kernel(
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs, kernel_ptr &kernel) {
+    std::vector<logical_tensor_t> ins, outs;
+    shape_key_t key;
+    const auto add_tensors = [&](const std::vector<tensor_t> &tensors,
+                                     std::vector<logical_tensor_t> &lts) {
+        for (const auto &t : tensors) {
+            const logical_tensor_t &lt = t.get_logical_tensor();
+            const logical_tensor_wrapper_t ltw(lt);
+            // The tensors give the shapes, so they must be known.
+            if (!ltw.is_strided() || ltw.is_shape_unknown()
+                    || ltw.is_stride_unknown())
+                return status::invalid_arguments;
+            key.push_back(static_cast<dim_t>(lt.id));
+            key.push_back(ltw.ndims());
+            key.insert(key.end(), ltw.dims(), ltw.dims() + ltw.ndims());
+            key.insert(key.end(), ltw.strides(), ltw.strides() + ltw.ndims());
+            lts.push_back(lt);
+        }
+        return status::success;
+    };
+    CHECK(add_tensors(inputs, ins));
+    CHECK(add_tensors(outputs, outs));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = kernels_.begin(); it != kernels_.end(); ++it) {
+        if (it->first != key) continue;
+        kernels_.splice(kernels_.begin(), kernels_, it);
+        kernel = kernels_.front().second;
+        return status::success;
+    }
+
+    CHECK(part_->compile_kernel(kernel, ins, outs, engine_));
+    kernel->set_constant_cache_priority(constant_cache_priority_);
+    if (kernels_.size() == kernels_capacity) kernels_.pop_back();
+    kernels_.emplace_front(std::move(key), kernel);
+    return status::success;
+}
+
 void dnnl_partition_impl_t::init(FCreateKernel kernel_creator) {
     init_inputs_outputs();
 
@@ -114,6 +193,51 @@ status_t dnnl_partition_impl_t::compile(
         const std::vector<logical_tensor_t> &inputs,
         const std::vector<logical_tensor_t> &outputs,
         const engine_t *g_engine) const {
+    // The kernels for inputs with unknown dimensions are only compiled at
+    // execution, for the shapes of the given tensors.
+    if (has_dynamic_dims(inputs)) {
+        for (const auto &lt : inputs) {
+            if (!logical_tensor_wrapper_t(lt).is_strided())
+                return status::invalid_arguments;
+        }
+        for (const auto &lt : outputs) {
+            if (logical_tensor_wrapper_t(lt).is_opaque())
+                return status::invalid_arguments;
+        }
+
+        std::vector<logical_tensor_t> ordered_inputs;
+        std::vector<logical_tensor_t> ordered_outputs;
+        CHECK(get_ordered_inputs_outputs(inputs_, inputs, ordered_inputs));
+        CHECK(get_ordered_inputs_outputs(outputs_, outputs, ordered_outputs));
+
+        auto part = std::dynamic_pointer_cast<const dnnl_partition_impl_t>(
+                this->clone());
+        auto pimpl = std::make_shared<dnnl_dynamic_compiled_partition_impl_t>(
+                *g_engine, ordered_inputs, ordered_outputs, part);
+        compiled_partition->init(pimpl);
+        return status::success;
+    }
+
+    kernel_ptr kernel;
+    CHECK(compile_kernel(kernel, inputs, outputs, g_engine));
+
+    std::vector<logical_tensor_t> ordered_inputs;
+    std::vector<logical_tensor_t> ordered_outputs;
+    CHECK(get_ordered_inputs_outputs(inputs_, inputs, ordered_inputs));
+    CHECK(get_ordered_inputs_outputs(outputs_, outputs, ordered_outputs));
+
+    // wrapper kernel to dnnl_compiled_partition_impl_t
+    auto pimpl = std::make_shared<dnnl_compiled_partition_impl_t>(
+            *g_engine, ordered_inputs, ordered_outputs, kernel);
+    compiled_partition->init(pimpl);
+
+    return status::success;
+}
+
+status_t dnnl_partition_impl_t::compile_kernel(kernel_ptr &kernel,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs,
+        const engine_t *g_engine) const {
     // compile will transform the subgraph in partition, so we make
     // a copy
     auto part = std::dynamic_pointer_cast<dnnl_partition_impl_t>(this->clone());
@@ -143,31 +267,13 @@ status_t dnnl_partition_impl_t::compile(
         }
     }
 
-    kernel_ptr kernel = kernel_creator();
+    kernel = kernel_creator();
     if (!kernel) return status::unimplemented;
 
-    status_t ret;
-
     // compile kernel.
     // FIXME(qun) will modify the outputs inside the compile, which
     // break the constant semantics
-    ret = kernel->compile(part.get(), g_engine, inputs, outputs);
-    if (ret != status::success) return ret;
-
-    std::vector<logical_tensor_t> ordered_inputs;
-    std::vector<logical_tensor_t> ordered_outputs;
-    ret = get_ordered_inputs_outputs(inputs_, inputs, ordered_inputs);
-    if (status::success != ret) return ret;
-
-    ret = get_ordered_inputs_outputs(outputs_, outputs, ordered_outputs);
-    if (status::success != ret) return ret;
-
-    // wrapper kernel to dnnl_compiled_partition_impl_t
-    auto pimpl = std::make_shared<dnnl_compiled_partition_impl_t>(
-            *g_engine, ordered_inputs, ordered_outputs, kernel);
-    compiled_partition->init(pimpl);
-
-    return status::success;
+    return kernel->compile(part.get(), g_engine, inputs, outputs);
 }
 
 status_t dnnl_partition_impl_t::infer_shape(
@@ -17,7 +17,11 @@
 #ifndef GRAPH_BACKEND_DNNL_DNNL_PARTITION_IMPL_HPP
 #define GRAPH_BACKEND_DNNL_DNNL_PARTITION_IMPL_HPP
 
+#include <chrono>
+#include <future>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -62,6 +66,7 @@ public:
     status_t execute(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
             const std::vector<tensor_t> &outputs) override {
+        CHECK(get_prepare_constants_status());
         // We don't need to resort the inputs and outputs
         return kernel_->execute(g_stream, inputs, outputs);
     }
@@ -72,6 +77,7 @@ public:
             const std::vector<tensor_t> &outputs,
             const std::vector<::sycl::event> &sycl_deps,
             ::sycl::event *sycl_event) override {
+        CHECK(get_prepare_constants_status());
         // We don't need to resort the inputs and outputs
         return kernel_->execute_sycl(
                 g_stream, inputs, outputs, sycl_deps, sycl_event);
@@ -86,6 +92,7 @@ public:
             const std::vector<tensor_t> &outputs,
             const std::vector<cl_event> &ocl_deps,
             cl_event *ocl_event) override {
+        CHECK(get_prepare_constants_status());
         return kernel_->execute_ocl(
                 g_stream, inputs, outputs, ocl_deps, ocl_event);
     }
@@ -93,8 +100,136 @@ public:
 
     std::string str() const override { return kernel_->str(); }
 
+    size_t get_temporary_size() const override {
+        return kernel_->get_temporary_size();
+    }
+
+    void set_constant_cache_priority(int32_t priority) override {
+        kernel_->set_constant_cache_priority(priority);
+    }
+
+    // The constants are computed by a thread of their own, which the
+    // destruction of the compiled partition waits for. The thread does not
+    // use the stream of the application, so the stream is only checked to
+    // belong to the engine. A failure of the computation is returned by the
+    // next call to prepare_constants() or execute().
+    status_t prepare_constants(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs) override {
+        UNUSED(g_stream);
+        if (!kernel_->can_prepare_constants()) return status::unimplemented;
+        if (!kernel_->enabled_constant_cache())
+            return status::invalid_arguments;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (constants_prepared_.valid()) CHECK(constants_prepared_.get());
+        kernel_ptr kernel = kernel_;
+        constants_prepared_ = std::async(
+                std::launch::async, [kernel, inputs]() -> status_t {
+                    try {
+                        return kernel->prepare_constants_impl(inputs);
+                    } catch (...) { return status::runtime_error; }
+                });
+        return status::success;
+    }
+
+    bool constants_ready(const std::vector<tensor_t> &inputs) const override {
+        return kernel_->constants_ready(inputs);
+    }
+
 private:
     kernel_ptr kernel_;
+    std::future<status_t> constants_prepared_;
+    std::mutex mutex_;
+
+    // Returns the status of a completed preparation of the constants, once.
+    status_t get_prepare_constants_status() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!constants_prepared_.valid()
+                || constants_prepared_.wait_for(std::chrono::seconds(0))
+                        != std::future_status::ready)
+            return status::success;
+        return constants_prepared_.get();
+    }
+};
+
+class dnnl_partition_impl_t;
+
+// A compiled partition for inputs with dimensions that are only known at
+// execution, e.g. the sequence length of an SDPA or MLP partition. A kernel
+// is compiled by the first execution with the shapes of the given tensors,
+// and the kernels of the most recent shapes are kept for the next
+// executions, so that one compilation serves all the shapes.
+class dnnl_dynamic_compiled_partition_impl_t
+    : public compiled_partition_impl_t {
+public:
+    dnnl_dynamic_compiled_partition_impl_t(const engine_t &engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs,
+            const std::shared_ptr<const dnnl_partition_impl_t> &part)
+        : compiled_partition_impl_t(engine, inputs, outputs, {})
+        , part_(part) {}
+
+    status_t reset_engine(const engine_t *engine) override;
+
+    status_t execute(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override {
+        kernel_ptr kernel;
+        CHECK(get_kernel(inputs, outputs, kernel));
+        return kernel->execute(g_stream, inputs, outputs);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    status_t execute_sycl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        kernel_ptr kernel;
+        CHECK(get_kernel(inputs, outputs, kernel));
+        return kernel->execute_sycl(
+                g_stream, inputs, outputs, sycl_deps, sycl_event);
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t execute_ocl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &ocl_deps,
+            cl_event *ocl_event) override {
+        kernel_ptr kernel;
+        CHECK(get_kernel(inputs, outputs, kernel));
+        return kernel->execute_ocl(
+                g_stream, inputs, outputs, ocl_deps, ocl_event);
+    }
+#endif
+
+    std::string str() const override { return "dynamic_shape_kernel_t"; }
+
+    // The largest temporary size of the kernels compiled so far.
+    size_t get_temporary_size() const override;
+
+    // The priority applies to the kernels compiled so far and later.
+    void set_constant_cache_priority(int32_t priority) override;
+
+    // The number of shapes the kernels are kept for.
+    static constexpr size_t kernels_capacity = 64;
+
+private:
+    // Gets the kernel for the shapes of the tensors, compiling it on the
+    // first use of the shapes.
+    status_t get_kernel(const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, kernel_ptr &kernel);
+
+    std::shared_ptr<const dnnl_partition_impl_t> part_;
+
+    // The ids, dimensions and strides of the tensors of a shape, and its
+    // kernel. The most recently used shape comes first.
+    using shape_key_t = std::vector<dim_t>;
+    std::list<std::pair<shape_key_t, kernel_ptr>> kernels_;
+    int32_t constant_cache_priority_ = 0;
+    mutable std::mutex mutex_;
 };
 
 class dnnl_partition_impl_t : public partition_impl_t {
@@ -133,6 +268,12 @@ public:
     status_t infer_shape(std::vector<const logical_tensor_t *> &inputs,
             std::vector<logical_tensor_t *> &outputs) const override;
 
+    // Compiles a kernel of the partition for the given logical tensors.
+    status_t compile_kernel(kernel_ptr &kernel,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs,
+            const engine_t *g_engine) const;
+
 private:
     FCreateKernel kernel_creator_;
 };
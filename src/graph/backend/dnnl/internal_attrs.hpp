@@ -48,6 +48,7 @@ const op_attr_t keep_dst_layout = 0x1000f;
 const op_attr_t with_scale = 0x10010;
 const op_attr_t is_invert_scale = 0x10011;
 const op_attr_t mask_type = 0x10012;
+const op_attr_t with_dynamic_quant = 0x10013;
 
 // int64_t
 const op_attr_t alg_kind = 0x10100;
@@ -94,6 +95,7 @@ static inline std::string internal_attr2str(op_attr_t attr) {
         CASE(with_scale);
         CASE(is_invert_scale);
         CASE(mask_type);
+        CASE(with_dynamic_quant);
         CASE(alg_kind);
         CASE(axis_row);
         CASE(axis_col);
@@ -127,7 +127,7 @@ status_t batch_norm_fwd_t::execute_impl(const stream_t *g_stream,
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     assertm(scratchpad.size()
                     >= memory_planner_.total_internal_temporary_size(),
             "no enough scratchpad memory");
@@ -141,7 +141,7 @@ status_t batch_norm_fwd_t::execute_impl(const stream_t *g_stream,
         constant_tensor_cache_t::value_t cached_value
                 = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
                         memory_planner_.total_internal_persistent_size(),
-                        c_promise.get_future());
+                        c_promise.get_future(), constant_cache_priority_);
         bool is_from_cache = cached_value.valid();
         if (is_from_cache) {
             c_buffer = cached_value.get();
@@ -152,9 +152,9 @@ status_t batch_norm_fwd_t::execute_impl(const stream_t *g_stream,
                         c_grantor.get(mem_offkey.second));
             }
         } else {
-            c_buffer = std::make_shared<dnnl_constant_buffer_t>(
-                    memory_planner_.total_internal_persistent_size(), p_engine_,
-                    g_alloc_);
+            c_buffer = create_constant_buffer(
+                    memory_planner_.total_internal_persistent_size(), g_alloc_,
+                    inputs);
             grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
                     c_buffer->data<char>());
             for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
@@ -162,10 +162,13 @@ status_t batch_norm_fwd_t::execute_impl(const stream_t *g_stream,
                         c_grantor.get(mem_offkey.second));
             }
 
-            for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
-                if (!subgraph_->is_constant_[i]) continue;
-                subgraph_->execs_[i]->execute(
-                        p_stream, res->get_exec_args()[i]);
+            if (!c_buffer->is_filled()) {
+                for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+                    if (!subgraph_->is_constant_[i]) continue;
+                    subgraph_->execs_[i]->execute(
+                            p_stream, res->get_exec_args()[i]);
+                }
+                c_buffer->set_filled();
             }
 
             c_promise.set_value(c_buffer);
@@ -198,7 +201,7 @@ status_t batch_norm_fwd_t::sycl_execute_impl(const stream_t *g_stream,
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     assertm(scratchpad.size()
                     >= memory_planner_.total_internal_temporary_size(),
             "no enough scratchpad memory");
@@ -212,7 +215,7 @@ status_t batch_norm_fwd_t::sycl_execute_impl(const stream_t *g_stream,
         constant_tensor_cache_t::value_t cached_value
                 = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
                         memory_planner_.total_internal_persistent_size(),
-                        c_promise.get_future());
+                        c_promise.get_future(), constant_cache_priority_);
         bool is_from_cache = cached_value.valid();
         if (is_from_cache) {
             c_buffer = cached_value.get();
@@ -275,7 +278,7 @@ status_t batch_norm_fwd_t::ocl_execute_impl(const stream_t *g_stream,
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     assertm(scratchpad.size()
                     >= memory_planner_.total_internal_temporary_size(),
             "no enough scratchpad memory");
@@ -289,7 +292,7 @@ status_t batch_norm_fwd_t::ocl_execute_impl(const stream_t *g_stream,
         constant_tensor_cache_t::value_t cached_value
                 = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
                         memory_planner_.total_internal_persistent_size(),
-                        c_promise.get_future());
+                        c_promise.get_future(), constant_cache_priority_);
         bool is_from_cache = cached_value.valid();
         if (is_from_cache) {
             c_buffer = cached_value.get();
@@ -415,7 +418,7 @@ status_t batch_norm_bwd_t::execute_impl(const stream_t *g_stream,
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     assertm(scratchpad.size()
                     >= memory_planner_.total_internal_temporary_size(),
             "no enough scratchpad memory");
@@ -446,7 +449,7 @@ status_t batch_norm_bwd_t::sycl_execute_impl(const stream_t *g_stream,
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     assertm(scratchpad.size()
                     >= memory_planner_.total_internal_temporary_size(),
             "no enough scratchpad memory");
@@ -482,7 +485,7 @@ status_t batch_norm_bwd_t::ocl_execute_impl(const stream_t *g_stream,
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     assertm(scratchpad.size()
                     >= memory_planner_.total_internal_temporary_size(),
             "no enough scratchpad memory");
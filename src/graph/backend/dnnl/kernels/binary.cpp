@@ -123,7 +123,7 @@ status_t binary_t::execute_impl(const stream_t *g_stream,
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     assertm(scratchpad.size()
                     >= memory_planner_.total_internal_temporary_size(),
             "no enough scratchpad memory");
@@ -154,7 +154,7 @@ status_t binary_t::sycl_execute_impl(const stream_t *g_stream,
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     assertm(scratchpad.size()
                     >= memory_planner_.total_internal_temporary_size(),
             "no enough scratchpad memory");
@@ -190,7 +190,7 @@ status_t binary_t::ocl_execute_impl(const stream_t *g_stream,
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     assertm(scratchpad.size()
                     >= memory_planner_.total_internal_temporary_size(),
             "no enough scratchpad memory");
@@ -101,6 +101,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(binary_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(binary_t)
 };
 
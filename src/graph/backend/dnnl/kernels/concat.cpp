@@ -117,7 +117,7 @@ status_t concat_t<quantized>::execute_impl(const stream_t *g_stream,
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     assertm(scratchpad.size()
                     >= memory_planner_.total_internal_temporary_size(),
             "no enough scratchpad memory");
@@ -148,7 +148,7 @@ status_t concat_t<quantized>::sycl_execute_impl(const stream_t *g_stream,
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     assertm(scratchpad.size()
                     >= memory_planner_.total_internal_temporary_size(),
             "no enough scratchpad memory");
@@ -184,7 +184,7 @@ status_t concat_t<quantized>::ocl_execute_impl(const stream_t *g_stream,
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     assertm(scratchpad.size()
                     >= memory_planner_.total_internal_temporary_size(),
             "no enough scratchpad memory");
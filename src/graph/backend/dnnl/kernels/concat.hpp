@@ -47,6 +47,11 @@ private:
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
+    status_t prepare_inplace_pairs_impl() override {
+        inplace_pairs_ = memory_planner_.get_subgraph_inplace_pairs();
+        return status::success;
+    }
+
 public:
     concat_t() {
         thread_local_cache_t<execution_args_set_t> res_cache;
@@ -89,6 +94,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(concat_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(concat_t)
 };
 
@@ -99,6 +99,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(eltwise_fwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(eltwise_fwd_t)
 };
 
@@ -156,6 +159,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(eltwise_bwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(eltwise_bwd_t)
 };
 #endif
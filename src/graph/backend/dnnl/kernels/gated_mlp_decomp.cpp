@@ -0,0 +1,221 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+
+#include "graph/backend/dnnl/kernels/gated_mlp_decomp.hpp"
+
+#include "graph/backend/dnnl/passes/utils.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#include "oneapi/dnnl/dnnl_threadpool.h"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+status_t gated_mlp_decomp_kernel_t::compile_impl(
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+
+    // get subgraph from the deep copied partition
+    subgraph_ = std::make_shared<subgraph_t>(part->get_ops(), p_engine_,
+            part->get_fpmath_mode(), part->get_use_blocked_layout(), true);
+    BACKEND_DNNL_CHECK(set_given_inputs_outputs(subgraph_, inputs, outputs));
+    BACKEND_DNNL_CHECK(infer_shape(subgraph_));
+
+    // Check if it's supported by decomposition kernel
+    if (!cfg_.initial_check(subgraph_, inputs, subgraph_->outs_))
+        return status::unimplemented;
+    CHECK(cfg_.construct_params(p_engine_));
+
+    // fill information for outputs logical tensors, which are computed in
+    // the plain layout.
+    for (size_t i = 0; i < outputs.size(); i++) {
+        auto &out = const_cast<logical_tensor_t &>(outputs[i]);
+        out = subgraph_->outs_[i];
+        if (ltw(out).is_any()) {
+            out.layout_type = layout_type::strided;
+            const auto strides = get_dense_strides(ltw(out).vdims());
+            std::copy(strides.begin(), strides.end(), out.layout.strides);
+        }
+    }
+    return status::success;
+}
+
+status_t gated_mlp_decomp_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    dnnl::stream strm = make_dnnl_stream(p_engine_, *g_stream);
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+    int thread_num = 1;
+    dnnl_threadpool_interop_get_max_concurrency(&thread_num);
+    cfg_.nthr = thread_num;
+#endif
+    const int nthr = cfg_.nthr;
+
+    using config_t = gated_mlp_decomp_config_t;
+    const auto get_input = [&](int idx) {
+        return static_cast<char *>(
+                inputs[cfg_.graph_inport[idx]].get_data_handle());
+    };
+    char *src = get_input(config_t::src);
+    char *wei0 = get_input(config_t::wei0);
+    char *wei1 = get_input(config_t::wei1);
+    char *wei_down = get_input(config_t::wei_down);
+    char *dst = static_cast<char *>(outputs[0].get_data_handle());
+
+    temporary_scratchpad_t scratchpad(
+            get_buffer_size(nthr), p_engine_, *g_alloc_, g_stream);
+    assertm(scratchpad.size() >= get_buffer_size(nthr),
+            "no enough scratchpad memory");
+    char *partial = scratchpad.get_buffer();
+    const auto get_thread_buffer = [&](int ithr) {
+        return partial + get_thread_buffer_offset(nthr)
+                + ithr * get_thread_buffer_stride();
+    };
+
+    const auto &main = cfg_.main_prims;
+    const size_t src_dt_size = memory::data_type_size(
+            main.src_md.get_data_type());
+    const size_t dst_dt_size = memory::data_type_size(cfg_.dst_dt);
+    const dim_t m_blocks = cfg_.m_blocks();
+    const dim_t n_split = cfg_.n_split(nthr);
+    const dim_t n_blocks = cfg_.N / cfg_.n_block;
+    // The partial output of a chunk of N for a block of rows, in f32.
+    const auto get_acc = [&](dim_t mb, dim_t ns) {
+        if (cfg_.acc_in_dst && ns == 0)
+            return dst + mb * cfg_.m_block * cfg_.O * sizeof(float);
+        return partial + (mb * n_split + ns) * main.acc_md.get_size();
+    };
+    const int binary_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(
+                                   cfg_.binary_post_op_idx())
+            | DNNL_ARG_SRC_1;
+
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        char *buf = get_thread_buffer(ithr);
+        for_nd(ithr, nthr, m_blocks, n_split, [&](dim_t mb, dim_t ns) {
+            // in parallel region - these primitives should use single thread.
+            const bool is_tail = mb == m_blocks - 1 && cfg_.M % cfg_.m_block;
+            const auto &p = is_tail ? cfg_.tail_prims : main;
+            memory src_mem(p.src_md, p_engine_,
+                    src + mb * cfg_.m_block * cfg_.K * src_dt_size);
+            memory wei0_mem(p.wei0_md, p_engine_, nullptr);
+            memory wei1_mem(p.wei1_md, p_engine_, nullptr);
+            memory wei_down_mem(p.wei_down_md, p_engine_, nullptr);
+            memory buf1_mem(p.buf1_md, p_engine_, buf);
+            memory inter_mem(
+                    p.inter_md, p_engine_, buf + cfg_.get_inter_offset());
+            memory acc_mem(p.acc_md, p_engine_, get_acc(mb, ns));
+            memory scratchpad_mem(
+                    memory::desc({static_cast<dim_t>(p.scratchpad_size)},
+                            memory::data_type::u8, memory::format_tag::a),
+                    p_engine_, buf + cfg_.get_scratchpad_offset());
+
+            dim_t nb_start {0}, nb_end {0};
+            balance211(n_blocks, n_split, ns, nb_start, nb_end);
+            for (dim_t nb = nb_start; nb < nb_end; nb++) {
+                const dim_t n0 = nb * cfg_.n_block;
+                wei0_mem.set_data_handle(
+                        wei0 + n0 * cfg_.wei0_strides[1] * src_dt_size);
+                wei1_mem.set_data_handle(
+                        wei1 + n0 * cfg_.wei1_strides[1] * src_dt_size);
+                wei_down_mem.set_data_handle(wei_down
+                        + n0 * cfg_.wei_down_strides[0] * src_dt_size);
+
+                p.mm1.execute(strm,
+                        {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei1_mem},
+                                {DNNL_ARG_DST, buf1_mem},
+                                {DNNL_ARG_SCRATCHPAD, scratchpad_mem}});
+                p.mm0.execute(strm,
+                        {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei0_mem},
+                                {DNNL_ARG_DST, inter_mem},
+                                {binary_arg, buf1_mem},
+                                {DNNL_ARG_SCRATCHPAD, scratchpad_mem}});
+                // The first block of the chunk initializes the partial
+                // output, the next ones accumulate to it.
+                const auto &mm_down
+                        = nb == nb_start ? p.mm_down : p.mm_down_acc;
+                mm_down.execute(strm,
+                        {{DNNL_ARG_SRC, inter_mem},
+                                {DNNL_ARG_WEIGHTS, wei_down_mem},
+                                {DNNL_ARG_DST, acc_mem},
+                                {DNNL_ARG_SCRATCHPAD, scratchpad_mem}});
+            }
+
+            if (n_split == 1 && !cfg_.acc_in_dst) {
+                memory dst_mem(p.dst_md, p_engine_,
+                        dst + mb * cfg_.m_block * cfg_.O * dst_dt_size);
+                p.to_dst.execute(strm,
+                        {{DNNL_ARG_SRC, acc_mem}, {DNNL_ARG_DST, dst_mem},
+                                {DNNL_ARG_SCRATCHPAD, scratchpad_mem}});
+            }
+        });
+    });
+
+    // The partial outputs of the chunks are summed to the first one, which
+    // is converted to the output when it is not f32.
+    if (n_split > 1) {
+        parallel_nd_ext(nthr, m_blocks, [&](int ithr, int, dim_t mb) {
+            const bool is_tail = mb == m_blocks - 1 && cfg_.M % cfg_.m_block;
+            const auto &p = is_tail ? cfg_.tail_prims : main;
+            float *acc = reinterpret_cast<float *>(get_acc(mb, 0));
+            const dim_t size = p.rows * cfg_.O;
+            for (dim_t ns = 1; ns < n_split; ns++) {
+                const float *part
+                        = reinterpret_cast<const float *>(get_acc(mb, ns));
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = 0; i < size; i++)
+                    acc[i] += part[i];
+            }
+            if (cfg_.acc_in_dst) return;
+
+            char *buf = get_thread_buffer(ithr);
+            memory acc_mem(p.acc_md, p_engine_, acc);
+            memory dst_mem(p.dst_md, p_engine_,
+                    dst + mb * cfg_.m_block * cfg_.O * dst_dt_size);
+            memory scratchpad_mem(
+                    memory::desc({static_cast<dim_t>(p.scratchpad_size)},
+                            memory::data_type::u8, memory::format_tag::a),
+                    p_engine_, buf + cfg_.get_scratchpad_offset());
+            p.to_dst.execute(strm,
+                    {{DNNL_ARG_SRC, acc_mem}, {DNNL_ARG_DST, dst_mem},
+                            {DNNL_ARG_SCRATCHPAD, scratchpad_mem}});
+        });
+    }
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
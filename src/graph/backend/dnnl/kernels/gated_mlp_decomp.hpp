@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_DECOMP_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_DECOMP_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "graph/backend/dnnl/kernels/gated_mlp_decomp_config.hpp"
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+#include "graph/backend/dnnl/subgraph.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// The decomposition kernel of the gated MLP on CPU. A task computes a block
+// of rows of the output from a chunk of the intermediate channels, and the
+// partial outputs of the chunks are summed at the end when the intermediate
+// channels are split between the threads.
+struct gated_mlp_decomp_kernel_t : public kernel_base_t {
+private:
+    allocator_t *g_alloc_ = nullptr;
+    gated_mlp_decomp_config_t cfg_;
+
+public:
+    gated_mlp_decomp_kernel_t() = default;
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(sycl_deps);
+        UNUSED(sycl_event);
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps,
+            cl_event *ret_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(cl_deps);
+        UNUSED(ret_event);
+        return status::unimplemented;
+    }
+#endif
+
+    DEF_KERNEL_METHOD_STR(gated_mlp_decomp_kernel_t)
+    size_t get_temporary_size() const override {
+        return get_buffer_size(cfg_.nthr);
+    }
+    DNNL_DISALLOW_COPY_AND_ASSIGN(gated_mlp_decomp_kernel_t)
+    status_t reset_engine(const engine_t *g_engine) override {
+        dnnl::engine p_engine = make_dnnl_engine(*g_engine);
+        return cfg_.reset_engine(p_engine);
+    }
+
+private:
+    // The partial outputs come first in the temporary buffer, followed by
+    // the buffers of the threads.
+    size_t get_buffer_size(int nthr) const {
+        return get_thread_buffer_offset(nthr)
+                + static_cast<size_t>(nthr) * get_thread_buffer_stride();
+    }
+    size_t get_thread_buffer_offset(int nthr) const {
+        return impl::utils::rnd_up(cfg_.get_partial_size(nthr), alignment);
+    }
+    size_t get_thread_buffer_stride() const {
+        return impl::utils::rnd_up(cfg_.get_thread_buffer_size(), alignment);
+    }
+
+    static constexpr size_t alignment = 64;
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
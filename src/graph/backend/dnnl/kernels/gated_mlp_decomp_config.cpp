@@ -0,0 +1,341 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+
+#include "graph/backend/dnnl/kernels/gated_mlp_decomp_config.hpp"
+#include "graph/backend/dnnl/passes/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+#define VCHECK_GATED_MLP_DECOMP(cond, status, msg, ...) \
+    VCONDCHECK(graph, create, check, gated_mlp_decomp_config, (cond), status, \
+            msg, ##__VA_ARGS__);
+
+namespace {
+
+// The largest block of the intermediate channels, which keeps the
+// intermediate of a block of rows in L1 or L2.
+constexpr dim_t max_n_block = 256;
+constexpr dim_t min_n_block = 16;
+constexpr dim_t max_m_block = 32;
+
+op_ptr get_producer(const std::shared_ptr<value_t> &val) {
+    if (!val->has_producer()) return nullptr;
+    return val->get_producer().shared_from_this();
+}
+
+int find_input(const std::shared_ptr<value_t> &val,
+        const std::vector<logical_tensor_t> &inputs) {
+    for (size_t i = 0; i < inputs.size(); i++)
+        if (val->get_logical_tensor().id == inputs[i].id)
+            return static_cast<int>(i);
+    return -1;
+}
+
+bool is_dense_row_major(const ltw &lt) {
+    const auto dims = lt.vdims();
+    const auto strides = lt.vstrides();
+    dim_t stride = 1;
+    for (int i = lt.ndims() - 1; i >= 0; i--) {
+        if (dims[i] != 1 && strides[i] != stride) return false;
+        stride *= dims[i];
+    }
+    return true;
+}
+
+} // namespace
+
+bool gated_mlp_decomp_config_t::initial_check(
+        const std::shared_ptr<subgraph_t> &sg,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    // The down matmul produces the output, and its source is the binary op.
+    op_ptr down, binary;
+    for (const auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() == graph::op_kind::MatMul
+                && cur_op->get_output_value(0)->get_consumers().empty())
+            down = cur_op;
+    }
+    VCHECK_GATED_MLP_DECOMP(down != nullptr && outputs.size() == 1, false,
+            "the down matmul is not found");
+    binary = get_producer(down->get_input_value(0));
+    const auto &binary_map = get_binary_alg_map();
+    VCHECK_GATED_MLP_DECOMP(binary != nullptr
+                    && binary->get_kind() != graph::op_kind::BiasAdd
+                    && binary->get_kind() != graph::op_kind::Select
+                    && binary_map.count(binary->get_kind()),
+            false, "unsupported binary op");
+    binary_alg_ = binary_map.at(binary->get_kind());
+
+    // An operand of the binary op is a matmul, a matmul with an activation,
+    // or a matmul with a swish expressed as sigmoid and multiply.
+    size_t nops = 2;
+    for (int i = 0; i < 2; i++) {
+        auto &opnd = operands_[i];
+        op_ptr op = get_producer(binary->get_input_value(i));
+        VCHECK_GATED_MLP_DECOMP(op != nullptr, false, "unexpected operand");
+        if (op->get_kind() == graph::op_kind::Multiply) {
+            const op_ptr sig0 = get_producer(op->get_input_value(0));
+            const op_ptr sig1 = get_producer(op->get_input_value(1));
+            const bool sig_first
+                    = sig0 && sig0->get_kind() == graph::op_kind::Sigmoid;
+            const op_ptr sig = sig_first ? sig0 : sig1;
+            const auto x = op->get_input_value(sig_first ? 1 : 0);
+            VCHECK_GATED_MLP_DECOMP(sig != nullptr
+                            && sig->get_kind() == graph::op_kind::Sigmoid
+                            && sig->get_input_value(0).get() == x.get(),
+                    false, "unsupported activation");
+            opnd.act_alg = dnnl::algorithm::eltwise_swish;
+            opnd.act_alpha = 1.f;
+            op = get_producer(x);
+            nops += 2;
+        } else if (get_eltwise_alg_map().count(op->get_kind())) {
+            opnd.act_alg = get_eltwise_alg(op, false);
+            // The attributes follow the ones of the lowered eltwise.
+            if (op->has_attr(op_attr::alpha))
+                opnd.act_alpha = op->get_attr<float>(op_attr::alpha);
+            else if (op->has_attr(op_attr::min))
+                opnd.act_alpha = op->get_attr<float>(op_attr::min);
+            else if (op->get_kind() == graph::op_kind::HardSwish)
+                opnd.act_alpha = 1.f / 6.f;
+            if (op->has_attr(op_attr::beta))
+                opnd.act_beta = op->get_attr<float>(op_attr::beta);
+            else if (op->has_attr(op_attr::max))
+                opnd.act_beta = op->get_attr<float>(op_attr::max);
+            else if (op->get_kind() == graph::op_kind::HardSwish)
+                opnd.act_beta = 1.f / 2.f;
+            op = get_producer(op->get_input_value(0));
+            nops += 1;
+        }
+        VCHECK_GATED_MLP_DECOMP(
+                op != nullptr && op->get_kind() == graph::op_kind::MatMul,
+                false, "an operand of the binary op is not a matmul");
+        opnd.matmul = op;
+    }
+    VCHECK_GATED_MLP_DECOMP(sg->get_ops().size() == nops + 2, false,
+            "unexpected ops in the partition");
+    const auto src_val = operands_[0].matmul->get_input_value(0);
+    VCHECK_GATED_MLP_DECOMP(operands_[0].matmul != operands_[1].matmul
+                    && operands_[1].matmul->get_input_value(0).get()
+                            == src_val.get(),
+            false, "the gate and up matmuls should share the source");
+
+    // The matmuls have no bias, and 2D weights.
+    for (const auto &mm : {operands_[0].matmul, operands_[1].matmul, down}) {
+        const bool transpose_a = mm->has_attr(op_attr::transpose_a)
+                && mm->get_attr<bool>(op_attr::transpose_a);
+        VCHECK_GATED_MLP_DECOMP(mm->num_inputs() == 2 && !transpose_a, false,
+                "matmuls with bias or transposed source are not supported");
+    }
+
+    graph_inport[src] = find_input(src_val, inputs);
+    graph_inport[wei0] = find_input(
+            operands_[0].matmul->get_input_value(1), inputs);
+    graph_inport[wei1] = find_input(
+            operands_[1].matmul->get_input_value(1), inputs);
+    graph_inport[wei_down] = find_input(down->get_input_value(1), inputs);
+    for (int i = 0; i < n_inputs; i++)
+        VCHECK_GATED_MLP_DECOMP(graph_inport[i] >= 0, false,
+                "an input of the partition is not found");
+
+    const ltw src_lt(inputs[graph_inport[src]]);
+    VCHECK_GATED_MLP_DECOMP(src_lt.ndims() >= 2 && src_lt.is_strided()
+                    && is_dense_row_major(src_lt),
+            false, "the source should be dense and row-major");
+    const auto src_dims = src_lt.vdims();
+    K = src_dims.back();
+    M = src_lt.nelems() / K;
+
+    // The weights are described as K x N or N x O matrices, whether they are
+    // transposed or not.
+    const auto get_wei = [&](const op_ptr &mm, int inport, dims &wdims,
+                                 dims &strides) {
+        const ltw lt(inputs[graph_inport[inport]]);
+        if (lt.ndims() != 2 || !lt.is_strided()) return false;
+        wdims = lt.vdims();
+        strides = lt.vstrides();
+        if (mm->has_attr(op_attr::transpose_b)
+                && mm->get_attr<bool>(op_attr::transpose_b)) {
+            std::swap(wdims[0], wdims[1]);
+            std::swap(strides[0], strides[1]);
+        }
+        return true;
+    };
+    dims wei0_dims, wei1_dims, wei_down_dims;
+    VCHECK_GATED_MLP_DECOMP(
+            get_wei(operands_[0].matmul, wei0, wei0_dims, wei0_strides)
+                    && get_wei(operands_[1].matmul, wei1, wei1_dims,
+                            wei1_strides)
+                    && get_wei(down, wei_down, wei_down_dims,
+                            wei_down_strides),
+            false, "the weights should be 2D and strided");
+    N = wei0_dims[1];
+    O = wei_down_dims[1];
+    VCHECK_GATED_MLP_DECOMP(wei0_dims[0] == K && wei1_dims[0] == K
+                    && wei1_dims[1] == N && wei_down_dims[0] == N,
+            false, "the shapes of the weights do not match");
+
+    src_dt_ = static_cast<memory::data_type>(src_lt.data_type());
+    inter_dt_ = static_cast<memory::data_type>(
+            ltw(binary->get_output_value(0)->get_logical_tensor())
+                    .data_type());
+    dst_dt = static_cast<memory::data_type>(ltw(outputs[0]).data_type());
+    for (int i = wei0; i < n_inputs; i++) {
+        VCHECK_GATED_MLP_DECOMP(
+                ltw(inputs[graph_inport[i]]).data_type() == src_lt.data_type(),
+                false, "the weights should have the data type of the source");
+    }
+    VCHECK_GATED_MLP_DECOMP(impl::utils::one_of(src_dt_, memory::data_type::f32,
+                                    memory::data_type::bf16,
+                                    memory::data_type::f16),
+            false, "unsupported data type %s",
+            dnnl_dt2str(static_cast<dnnl_data_type_t>(src_dt_)));
+
+    // The output has the shape of the source with O channels.
+    const ltw dst_lt(outputs[0]);
+    auto dst_dims = src_dims;
+    dst_dims.back() = O;
+    VCHECK_GATED_MLP_DECOMP(dst_lt.vdims() == dst_dims
+                    && (dst_lt.is_any()
+                            || (dst_lt.is_strided()
+                                    && is_dense_row_major(dst_lt))),
+            false, "the output should be dense and row-major");
+    acc_in_dst = dst_dt == memory::data_type::f32;
+
+    n_block = 0;
+    for (dim_t nb = max_n_block; nb >= min_n_block && !n_block; nb /= 2)
+        if (N % nb == 0) n_block = nb;
+    VCHECK_GATED_MLP_DECOMP(n_block > 0, false,
+            "the intermediate channels %ld should be a multiple of %ld",
+            static_cast<long int>(N), static_cast<long int>(min_n_block));
+    m_block = std::min(M, max_m_block);
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    nthr = dnnl_get_current_num_threads();
+#else
+    nthr = dnnl_get_max_threads();
+#endif
+    return true;
+}
+
+dim_t gated_mlp_decomp_config_t::n_split(int nthr) const {
+    const dim_t n_blocks = N / n_block;
+    return std::min(n_blocks,
+            std::max<dim_t>(1, impl::utils::div_up(nthr, m_blocks())));
+}
+
+size_t gated_mlp_decomp_config_t::get_thread_buffer_size() const {
+    return get_scratchpad_offset()
+            + std::max(main_prims.scratchpad_size, tail_prims.scratchpad_size);
+}
+
+size_t gated_mlp_decomp_config_t::get_partial_size(int nthr) const {
+    return static_cast<size_t>(m_blocks() * n_split(nthr))
+            * main_prims.acc_md.get_size();
+}
+
+status_t gated_mlp_decomp_config_t::init_block_prims(
+        const dnnl::engine &p_engine, dim_t rows, block_prims_t &prims) const {
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+
+    prims.rows = rows;
+    prims.src_md = memory::desc({rows, K}, src_dt_, tag::ab);
+    prims.wei0_md = memory::desc({K, n_block}, src_dt_, wei0_strides);
+    prims.wei1_md = memory::desc({K, n_block}, src_dt_, wei1_strides);
+    prims.wei_down_md = memory::desc({n_block, O}, src_dt_, wei_down_strides);
+    prims.buf1_md = memory::desc({rows, n_block}, dt::f32, tag::ab);
+    prims.inter_md = memory::desc({rows, n_block}, inter_dt_, tag::ab);
+    prims.acc_md = memory::desc({rows, O}, dt::f32, tag::ab);
+    prims.dst_md = memory::desc({rows, O}, dst_dt, tag::ab);
+
+    // The primitives run on one thread each inside of the parallel region.
+    primitive_attr attr;
+    attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    const auto with_act = [&](const operand_t &opnd) {
+        primitive_attr a = attr;
+        post_ops pops;
+        if (opnd.act_alg != dnnl::algorithm::undef)
+            pops.append_eltwise(opnd.act_alg, opnd.act_alpha, opnd.act_beta);
+        return std::make_pair(a, pops);
+    };
+
+    auto attr1 = with_act(operands_[1]);
+    attr1.first.set_post_ops(attr1.second);
+    auto attr0 = with_act(operands_[0]);
+    attr0.second.append_binary(binary_alg_, prims.buf1_md);
+    attr0.first.set_post_ops(attr0.second);
+    primitive_attr attr_acc = attr;
+    post_ops pops_acc;
+    pops_acc.append_sum(1.f);
+    attr_acc.set_post_ops(pops_acc);
+
+    const matmul::primitive_desc pds[] = {
+            {p_engine, prims.src_md, prims.wei1_md, prims.buf1_md, attr1.first,
+                    true},
+            {p_engine, prims.src_md, prims.wei0_md, prims.inter_md,
+                    attr0.first, true},
+            {p_engine, prims.inter_md, prims.wei_down_md, prims.acc_md, attr,
+                    true},
+            {p_engine, prims.inter_md, prims.wei_down_md, prims.acc_md,
+                    attr_acc, true},
+    };
+    dnnl::primitive *mms[]
+            = {&prims.mm1, &prims.mm0, &prims.mm_down, &prims.mm_down_acc};
+    prims.scratchpad_size = 0;
+    for (int i = 0; i < 4; i++) {
+        VCHECK_GATED_MLP_DECOMP(pds[i], status::unimplemented,
+                "the matmul %d of a block is not supported", i);
+        *mms[i] = matmul(pds[i]);
+        prims.scratchpad_size = std::max(
+                prims.scratchpad_size, pds[i].scratchpad_desc().get_size());
+    }
+
+    if (!acc_in_dst) {
+        const reorder::primitive_desc pd(p_engine, prims.acc_md, p_engine,
+                prims.dst_md, attr, true);
+        VCHECK_GATED_MLP_DECOMP(pd, status::unimplemented,
+                "the conversion of the output is not supported");
+        prims.to_dst = reorder(pd);
+        prims.scratchpad_size = std::max(
+                prims.scratchpad_size, pd.scratchpad_desc().get_size());
+    }
+    return status::success;
+}
+
+status_t gated_mlp_decomp_config_t::construct_params(
+        const dnnl::engine &p_engine) {
+    CHECK(init_block_prims(p_engine, m_block, main_prims));
+    if (M % m_block)
+        CHECK(init_block_prims(p_engine, M % m_block, tail_prims));
+    return status::success;
+}
+
+status_t gated_mlp_decomp_config_t::reset_engine(
+        const dnnl::engine &p_engine) {
+    // The primitives are cheap to create again, and most of them come from
+    // the primitive cache.
+    return construct_params(p_engine);
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
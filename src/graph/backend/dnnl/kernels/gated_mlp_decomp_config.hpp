@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_DECOMP_CONFIG_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_DECOMP_CONFIG_HPP
+
+#include <memory>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "graph/interface/c_types_map.hpp"
+
+#include "graph/backend/dnnl/subgraph.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+using ltw = logical_tensor_wrapper_t;
+using op_ptr = std::shared_ptr<op_t>;
+
+// The gated MLP dst = (act0(src * wei0) op act1(src * wei1)) * wei2 is
+// computed by blocks of the intermediate dimension N, the gate and the up
+// matmuls being the operands of `op`. For a block of rows of the source and a
+// block of N, the second operand is computed to a buffer, the first one is
+// computed with the activation and the binary op as post-ops, and the block
+// of the intermediate is accumulated right away to the output with the down
+// matmul. The intermediate thus stays in the cache of a thread instead of
+// going through memory.
+struct gated_mlp_decomp_config_t {
+public:
+    gated_mlp_decomp_config_t() = default;
+
+    // The offsets of the inputs in the inputs of the partition.
+    enum { src = 0, wei0, wei1, wei_down, n_inputs };
+    int graph_inport[n_inputs] = {-1, -1, -1, -1};
+
+    // The rows of the source, the input channels, the intermediate channels
+    // and the output channels.
+    dim_t M = 0, K = 0, N = 0, O = 0;
+    // The rows and the intermediate channels of a block.
+    dim_t m_block = 0, n_block = 0;
+
+    // The strides of the weights as K x N, K x N and N x O matrices.
+    dims wei0_strides, wei1_strides, wei_down_strides;
+
+    // Thread nums during the workflow
+    int nthr = 0;
+
+    // The primitives of the blocks with m_block rows and of the last block
+    // of rows, if smaller.
+    struct block_prims_t {
+        dim_t rows = 0;
+        dnnl::primitive mm1, mm0, mm_down, mm_down_acc, to_dst;
+        memory::desc src_md, wei0_md, wei1_md, wei_down_md, buf1_md,
+                inter_md, acc_md, dst_md;
+        size_t scratchpad_size = 0;
+    };
+    block_prims_t main_prims, tail_prims;
+
+    memory::data_type dst_dt = memory::data_type::undef;
+    // The partial outputs are accumulated in the user's output when it is
+    // f32.
+    bool acc_in_dst = false;
+
+    // The number of row blocks.
+    dim_t m_blocks() const { return impl::utils::div_up(M, m_block); }
+    // The number of chunks of N the row blocks are split into for the
+    // threads to have work at small M.
+    dim_t n_split(int nthr) const;
+    // The sizes of the buffers of a thread and of the partial outputs. The
+    // buffer of a thread holds the second operand, the intermediate and the
+    // scratchpad of the primitives.
+    size_t get_thread_buffer_size() const;
+    size_t get_inter_offset() const {
+        return impl::utils::rnd_up(main_prims.buf1_md.get_size(), 64);
+    }
+    size_t get_scratchpad_offset() const {
+        return get_inter_offset()
+                + impl::utils::rnd_up(main_prims.inter_md.get_size(), 64);
+    }
+    size_t get_partial_size(int nthr) const;
+    // The index of the binary post-op of the first operand.
+    int binary_post_op_idx() const {
+        return operands_[0].act_alg != dnnl::algorithm::undef ? 1 : 0;
+    }
+
+    // Checks that the partition is supported and records its shapes and
+    // operations. If no, the kernel falls back to the large partition one.
+    bool initial_check(const std::shared_ptr<subgraph_t> &sg,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs);
+
+    status_t construct_params(const dnnl::engine &p_engine);
+    status_t reset_engine(const dnnl::engine &p_engine);
+
+private:
+    // An operand of the binary op: a matmul with an optional activation.
+    struct operand_t {
+        op_ptr matmul;
+        dnnl::algorithm act_alg = dnnl::algorithm::undef;
+        float act_alpha = 0.f, act_beta = 0.f;
+    };
+    operand_t operands_[2];
+    dnnl::algorithm binary_alg_ = dnnl::algorithm::undef;
+    memory::data_type src_dt_ = memory::data_type::undef;
+    memory::data_type inter_dt_ = memory::data_type::undef;
+
+    status_t init_block_prims(const dnnl::engine &p_engine, dim_t rows,
+            block_prims_t &prims) const;
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
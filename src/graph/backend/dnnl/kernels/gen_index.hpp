@@ -79,6 +79,9 @@ public:
             cl_event *ocl_event) override;
 #endif
     DEF_KERNEL_METHOD_STR(genindex_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(genindex_t)
 };
 
@@ -14,8 +14,24 @@
  * limitations under the License.
  *******************************************************************************/
 
-#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+#include <cstring>
+#include <exception>
+#include <future>
+#include <new>
+
+#include "common/dnnl_thread.hpp"
+
+#include "graph/interface/partition_hashing.hpp"
+
 #include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/op_executable.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/cpu_isa_traits.hpp"
+#endif
 
 namespace dnnl {
 namespace impl {
@@ -25,6 +41,19 @@ namespace dnnl_impl {
 status_t kernel_base_t::compile(const dnnl_partition_impl_t *part,
         const engine_t *aengine, const std::vector<logical_tensor_t> &inputs,
         const std::vector<logical_tensor_t> &outputs) {
+    // The layouts of the constants depend on the library version, the ISA,
+    // and the number of threads besides the partition.
+    const auto *version = dnnl_version();
+    part_hash_ = hash_combine(0, std::string(version->hash));
+    part_hash_ = hash_combine(part_hash_, dnnl_get_max_threads());
+#if DNNL_X64
+    part_hash_ = hash_combine(part_hash_,
+            static_cast<size_t>(cpu::x64::get_max_cpu_isa()));
+#endif
+    for (const auto &op : part->get_ops())
+        part_hash_ = hash_combine(
+                part_hash_, partition_hashing::get_op_hash(*op));
+
     auto ret = compile_impl(part, aengine, inputs, outputs);
     if (ret != status::success) return ret;
     return prepare_inplace_pairs_impl();
@@ -56,6 +85,127 @@ size_t kernel_base_t::encode_constant_cache_key(
     return encoded_cache_key;
 }
 
+constant_tensor_cache_t::cached_t kernel_base_t::create_constant_buffer(
+        size_t size, allocator_t *alloc,
+        const std::vector<tensor_t> &inputs) {
+    const std::string &dir = get_constant_tensor_cache_dir();
+    bool use_mapped = !dir.empty() && p_engine_.get_kind() == engine::kind::cpu;
+    // The file is published right after the constants are computed, which
+    // requires a synchronous execution on host memory.
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL \
+        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    use_mapped = false;
+#endif
+    if (use_mapped) {
+        // Unlike the key of the constant tensor cache, which holds the
+        // addresses of the constant inputs, the key of the file holds their
+        // values.
+        size_t key = hash_combine(part_hash_, size);
+        for (const auto &in : inputs) {
+            const logical_tensor_wrapper_t ltw(in.get_logical_tensor());
+            if (!ltw.is_constant()) continue;
+            key = hash_combine(key, ltw.hash());
+            const auto *data = static_cast<const char *>(in.get_data_handle());
+            const size_t nbytes = ltw.size();
+            size_t i = 0;
+            for (; i + sizeof(uint64_t) <= nbytes; i += sizeof(uint64_t)) {
+                uint64_t word;
+                std::memcpy(&word, data + i, sizeof(word));
+                key = hash_combine(key, word);
+            }
+            for (; i < nbytes; i++)
+                key = hash_combine(key, data[i]);
+        }
+        auto buf = mapped_constant_buffer_t::create(
+                dir, key, size, p_engine_.get(), alloc);
+        if (buf) return buf;
+    }
+    return std::make_shared<dnnl_constant_buffer_t>(size, p_engine_, alloc);
+}
+
+status_t kernel_base_t::prepare_planned_constants(
+        const std::vector<tensor_t> &inputs, execution_args_set_t *res,
+        const memory_planner_t &planner, size_t const_md_hash,
+        allocator_t *alloc) {
+    const size_t size = planner.total_internal_persistent_size();
+    if (!enabled_constant_cache() || size == 0) return status::success;
+
+    const size_t encoded_key = encode_constant_cache_key(inputs, const_md_hash);
+    std::promise<constant_tensor_cache_t::cached_t> c_promise;
+    constant_tensor_cache_t::value_t cached_value
+            = dnnl_constant_cache_get_or_add(p_engine_, encoded_key, size,
+                    c_promise.get_future(), constant_cache_priority_);
+    if (cached_value.valid()) return status::success;
+
+    // The executions that found the entry wait on its future, so the promise
+    // is satisfied on every path. A failed entry is removed for the next
+    // execution to compute the constants again.
+    const auto fail = [&](status_t status, std::exception_ptr e) {
+        dnnl_constant_cache_remove_if_exist(p_engine_, encoded_key);
+        c_promise.set_exception(e);
+        return status;
+    };
+
+    try {
+        dnnl::stream p_stream(p_engine_);
+        temporary_scratchpad_t scratchpad(
+                planner.total_internal_temporary_size(), p_engine_, *alloc,
+                p_stream.get());
+        if (scratchpad.size() < planner.total_internal_temporary_size()) {
+            return fail(status::out_of_memory,
+                    std::make_exception_ptr(std::bad_alloc()));
+        }
+
+        // The outputs of the partition are not written by the constant ops.
+        for (const auto &mem_idx : res->get_mems_use_external_inputs()) {
+            mem_idx.first.set_data_handle(
+                    inputs[mem_idx.second].get_data_handle());
+        }
+        grantor_t var_grantor
+                = planner.internal_temporary_grantor(scratchpad.get_buffer());
+        for (auto &mem_offkey : res->get_mems_use_internal_temporary()) {
+            mem_offkey.first.set_data_handle(
+                    var_grantor.get(mem_offkey.second));
+        }
+
+        constant_tensor_cache_t::cached_t c_buffer
+                = create_constant_buffer(size, alloc, inputs);
+        grantor_t c_grantor
+                = planner.internal_persistent_grantor(c_buffer->data<char>());
+        for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
+            mem_offkey.first.set_data_handle(c_grantor.get(mem_offkey.second));
+        }
+
+        if (!c_buffer->is_filled()) {
+            for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+                if (!subgraph_->is_constant_[i]) continue;
+                subgraph_->execs_[i]->execute(
+                        p_stream, res->get_exec_args()[i]);
+            }
+            // The constants are ready once the cache entry is, so the
+            // computation has to be completed here.
+            p_stream.wait();
+            c_buffer->set_filled();
+        }
+
+        c_promise.set_value(c_buffer);
+    } catch (const dnnl::error &e) {
+        return fail(static_cast<status_t>(e.status), std::current_exception());
+    } catch (...) {
+        return fail(status::runtime_error, std::current_exception());
+    }
+    return status::success;
+}
+
+bool kernel_base_t::planned_constants_ready(
+        const std::vector<tensor_t> &inputs, const memory_planner_t &planner,
+        size_t const_md_hash) const {
+    if (planner.total_internal_persistent_size() == 0) return true;
+    if (!enabled_constant_cache()) return false;
+    return dnnl_constant_cache_is_ready(
+            p_engine_, encode_constant_cache_key(inputs, const_md_hash));
+}
+
 const std::vector<inplace_pair_t> &kernel_base_t::get_inplace_pairs() const {
     return inplace_pairs_;
 };
@@ -18,11 +18,14 @@
 #define GRAPH_BACKEND_DNNL_KERNELS_KERNEL_BASE_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <vector>
 
 #include "graph/backend/dnnl/subgraph.hpp"
+#include "graph/backend/dnnl/passes/memory_planning.hpp"
 #include "graph/interface/c_types_map.hpp"
+#include "graph/interface/constant_tensor_cache.hpp"
 #include "graph/interface/logical_tensor.hpp"
 
 // required for dnnl::engine
@@ -108,14 +111,69 @@ struct kernel_base_t {
     // for a compiled partition.
     virtual std::string str() const = 0;
 
+    // The size of the temporary buffer allocated on every execution, which
+    // holds the internal memories and the scratchpads of the primitives.
+    virtual size_t get_temporary_size() const { return 0; }
+
     bool enabled_constant_cache() const;
 
     size_t encode_constant_cache_key(
             const std::vector<tensor_t> &inputs, size_t cache_key) const;
 
+    // Creates the buffer for constants missing in the constant tensor cache.
+    // If a cache directory is set, the buffer of a CPU engine is a mapped
+    // file shared by all the processes executing the same partition with
+    // the same constant inputs, and may hold the constants already.
+    constant_tensor_cache_t::cached_t create_constant_buffer(size_t size,
+            allocator_t *alloc, const std::vector<tensor_t> &inputs);
+
+    virtual void set_constant_cache_priority(int32_t priority) {
+        constant_cache_priority_ = priority;
+    }
+
+    // Whether the kernel computes its constants separately from the
+    // execution, through prepare_constants_impl().
+    virtual bool can_prepare_constants() const { return false; }
+
+    // Computes the constants of the given inputs into the constant tensor
+    // cache without executing the rest of the partition, so that the
+    // executions with the same constant inputs find them there. Only the
+    // constant inputs need to hold data. The computation runs on a stream of
+    // its own, as it is called on a thread the application does not know of.
+    virtual status_t prepare_constants_impl(
+            const std::vector<tensor_t> &inputs) {
+        UNUSED(inputs);
+        return status::unimplemented;
+    }
+
+    // Whether the constants of the given inputs are computed into the
+    // constant tensor cache.
+    virtual bool constants_ready(const std::vector<tensor_t> &inputs) const {
+        UNUSED(inputs);
+        return false;
+    }
+
     const std::vector<inplace_pair_t> &get_inplace_pairs() const;
 
 protected:
+    // The common part of prepare_constants_impl() for the kernels planning
+    // the memory of their subgraph with a memory planner: executes the
+    // constant ops of the subgraph with the execution arguments of the
+    // calling thread, unless the constants are in the cache already. On a
+    // failure, the cache entry is removed and the executions waiting for it
+    // get the error.
+    status_t prepare_planned_constants(const std::vector<tensor_t> &inputs,
+            execution_args_set_t *res, const memory_planner_t &planner,
+            size_t const_md_hash, allocator_t *alloc);
+
+    bool planned_constants_ready(const std::vector<tensor_t> &inputs,
+            const memory_planner_t &planner, size_t const_md_hash) const;
+
+    // A hash of the ops of the partition and of the library setup, which
+    // unlike the partition id is the same in all the processes.
+    size_t part_hash_ = 0;
+    // The priority of the constants in the constant tensor cache.
+    std::atomic<int32_t> constant_cache_priority_ {0};
     std::vector<inplace_pair_t> inplace_pairs_;
     dnnl::engine p_engine_;
     std::shared_ptr<subgraph_t> subgraph_;
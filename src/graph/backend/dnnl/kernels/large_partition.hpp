@@ -108,7 +108,26 @@ public:
             const std::vector<cl_event> &ocl_deps, cl_event *event) override;
 #endif
 
+    bool can_prepare_constants() const override { return true; }
+
+    status_t prepare_constants_impl(
+            const std::vector<tensor_t> &inputs) override {
+        thread_local_cache_t<execution_args_set_t> res_cache;
+        execution_args_set_t *res = res_cache.get_or_add(
+                reinterpret_cast<size_t>(this), resource_ctor_);
+        prepare_host_scalar_args(res, inputs);
+        return prepare_planned_constants(
+                inputs, res, memory_planner_, const_md_hash_, g_alloc_);
+    }
+
+    bool constants_ready(const std::vector<tensor_t> &inputs) const override {
+        return planned_constants_ready(inputs, memory_planner_, const_md_hash_);
+    }
+
     DEF_KERNEL_METHOD_STR(larger_partition_kernel_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(larger_partition_kernel_t)
 };
 
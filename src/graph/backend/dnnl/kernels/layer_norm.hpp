@@ -90,6 +90,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(layer_norm_fwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(layer_norm_fwd_t)
 };
 
@@ -149,6 +152,9 @@ public:
     }
 
     DEF_KERNEL_METHOD_STR(layer_norm_bwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(layer_norm_bwd_t)
 };
 #endif
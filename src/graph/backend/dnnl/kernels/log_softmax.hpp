@@ -92,6 +92,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(logsoftmax_fwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(logsoftmax_fwd_t)
 };
 
@@ -151,6 +154,9 @@ public:
     }
 
     DEF_KERNEL_METHOD_STR(logsoftmax_bwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(logsoftmax_bwd_t)
 };
 #endif
@@ -91,12 +91,30 @@ public:
             const std::vector<cl_event> &cl_deps, cl_event *ret_event) override;
 #endif
 
+    bool can_prepare_constants() const override { return true; }
+
+    status_t prepare_constants_impl(
+            const std::vector<tensor_t> &inputs) override {
+        thread_local_cache_t<execution_args_set_t> res_cache;
+        execution_args_set_t *res = res_cache.get_or_add(
+                reinterpret_cast<size_t>(this), resource_ctor_);
+        return prepare_planned_constants(
+                inputs, res, memory_planner_, const_md_hash_, g_alloc_);
+    }
+
+    bool constants_ready(const std::vector<tensor_t> &inputs) const override {
+        return planned_constants_ready(inputs, memory_planner_, const_md_hash_);
+    }
+
     status_t prepare_inplace_pairs_impl() override {
         inplace_pairs_ = memory_planner_.get_subgraph_inplace_pairs();
         return status::success;
     }
 
     DEF_KERNEL_METHOD_STR(matmul_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(matmul_t)
 };
 
@@ -107,6 +107,12 @@ public:
     }
 
     std::string str() const override { return kernel->str(); }
+    size_t get_temporary_size() const override {
+        return kernel->get_temporary_size();
+    }
+    void set_constant_cache_priority(int32_t priority) override {
+        kernel->set_constant_cache_priority(priority);
+    }
 };
 } // namespace dnnl_impl
 } // namespace graph
@@ -191,7 +191,7 @@ status_t mqa_decomp_kernel_t<quantized, dt>::execute_impl(
     // allocate the internal memory
     size_t block_size = mqa_registry_.size();
     temporary_scratchpad_t scratchpad(
-            block_size * mqa_cfg_.nthr, p_engine_, *g_alloc_);
+            block_size * mqa_cfg_.nthr, p_engine_, *g_alloc_, g_stream);
     assertm(scratchpad.size() >= mqa_registry_.size(),
             "no enough scratchpad memory");
     grantor_t var_grantor = mqa_registry_.grantor(scratchpad.get_buffer());
@@ -163,6 +163,10 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(mqa_decomp_kernel_t)
+    // Every thread works on its own block of the temporary buffer.
+    size_t get_temporary_size() const override {
+        return mqa_registry_.size() * static_cast<size_t>(mqa_cfg_.nthr);
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(mqa_decomp_kernel_t)
     status_t reset_engine(const engine_t *g_engine) override {
         dnnl::engine p_engine = make_dnnl_engine(*g_engine);
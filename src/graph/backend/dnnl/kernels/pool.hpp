@@ -92,6 +92,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(pooling_fwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(pooling_fwd_t)
 };
 
@@ -149,6 +152,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(pooling_bwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(pooling_bwd_t)
 };
 #endif
@@ -90,6 +90,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(prelu_fwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(prelu_fwd_t)
 };
 
@@ -146,6 +149,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(prelu_bwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(prelu_bwd_t)
 };
 #endif
@@ -91,6 +91,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(quantize_dequantize_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(quantize_dequantize_t)
 };
 
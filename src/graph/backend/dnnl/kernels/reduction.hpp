@@ -95,6 +95,9 @@ public:
     }
 
     DEF_KERNEL_METHOD_STR(reduction_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(reduction_t)
 };
 
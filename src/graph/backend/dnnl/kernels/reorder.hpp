@@ -97,6 +97,9 @@ public:
     }
 
     DEF_KERNEL_METHOD_STR(reorder_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(reorder_t)
 };
 
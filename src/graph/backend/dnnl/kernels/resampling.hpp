@@ -94,6 +94,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(resampling_fwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(resampling_fwd_t)
 };
 
@@ -148,6 +151,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(resampling_bwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(resampling_bwd_t)
 };
 #endif
@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+#include <limits>
+
 #include "graph/backend/dnnl/kernels/sdp_decomp.hpp"
 
 #include "graph/backend/dnnl/passes/compile_ops.hpp"
@@ -27,6 +30,8 @@
 
 #include "graph/backend/dnnl/op_executable.hpp"
 
+#include "cpu/ref_io_helper.hpp"
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include "cpu/cpu_stream.hpp"
 #include "oneapi/dnnl/dnnl_threadpool.h"
@@ -36,6 +41,76 @@ namespace dnnl {
 namespace impl {
 namespace graph {
 namespace dnnl_impl {
+
+namespace {
+// Masks the first `nmasked` scores of every row of a kv chunk, which belong
+// to the previous chunk, and computes the log-sum-exp of every row.
+void compute_kv_chunk_lse(void *scores, data_type_t dt, dim_t nrows,
+        dim_t ncols, dim_t nmasked, float *lse) {
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+    for (dim_t r = 0; r < nrows; r++) {
+        const dim_t off = r * ncols;
+        float max_val = neg_inf;
+        for (dim_t c = 0; c < nmasked; c++)
+            cpu::io::store_float_value(dt, neg_inf, scores, off + c);
+        for (dim_t c = nmasked; c < ncols; c++)
+            max_val = std::max(
+                    max_val, cpu::io::load_float_value(dt, scores, off + c));
+        if (max_val == neg_inf) {
+            lse[r] = neg_inf;
+            continue;
+        }
+        float sum = 0.f;
+        for (dim_t c = nmasked; c < ncols; c++)
+            sum += ::expf(
+                    cpu::io::load_float_value(dt, scores, off + c) - max_val);
+        lse[r] = max_val + ::logf(sum);
+    }
+}
+
+// Merges the partial outputs of `nsplit` kv chunks, `nrows` x `ncols` dense
+// matrices that are `split_stride` floats apart, weighting every row by the
+// share of its chunk in the sum of exponentials. `dst` may be the output of
+// the first chunk.
+void merge_kv_chunks(const float *partial, const float *lse, dim_t nsplit,
+        dim_t nrows, dim_t ncols, dim_t split_stride, dim_t lse_stride,
+        bool inf_as_zero, float *dst) {
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+    std::vector<float> weights(nsplit);
+    for (dim_t r = 0; r < nrows; r++) {
+        float max_lse = neg_inf;
+        for (dim_t s = 0; s < nsplit; s++)
+            max_lse = std::max(max_lse, lse[s * lse_stride + r]);
+        float *dst_row = dst + r * ncols;
+        if (max_lse == neg_inf) {
+            // All the scores of the row are masked out.
+            const float val = inf_as_zero
+                    ? 0.f
+                    : std::numeric_limits<float>::quiet_NaN();
+            for (dim_t c = 0; c < ncols; c++)
+                dst_row[c] = val;
+            continue;
+        }
+        float sum = 0.f;
+        for (dim_t s = 0; s < nsplit; s++) {
+            weights[s] = ::expf(lse[s * lse_stride + r] - max_lse);
+            sum += weights[s];
+        }
+        for (dim_t s = 0; s < nsplit; s++)
+            weights[s] /= sum;
+        for (dim_t c = 0; c < ncols; c++) {
+            float acc = 0.f;
+            for (dim_t s = 0; s < nsplit; s++) {
+                // A chunk with all the scores masked out has no share, and
+                // its output may be undefined.
+                if (weights[s] == 0.f) continue;
+                acc += weights[s] * partial[s * split_stride + r * ncols + c];
+            }
+            dst_row[c] = acc;
+        }
+    }
+}
+} // namespace
 template <bool quantized, memory::data_type dt>
 status_t sdp_decomp_kernel_t<quantized, dt>::compile_impl(
         const dnnl_partition_impl_t *part, const engine_t *g_engine,
@@ -51,8 +126,9 @@ status_t sdp_decomp_kernel_t<quantized, dt>::compile_impl(
     BACKEND_DNNL_CHECK(set_given_inputs_outputs(subgraph_, inputs, outputs));
 
     // Check if it's supported by decomposition kernel
-    if (!sdp_cfg_.initial_check(subgraph_, inputs, outputs))
+    if (!sdp_cfg_.initial_check(subgraph_, inputs, outputs, quantized))
         return status::unimplemented;
+    BACKEND_DNNL_CHECK(sdp_cfg_.detach_kv_dequant(subgraph_));
 
     subgraph_visualizer_t vis(part->id(), [this](const value_t *val) {
         return this->memory_planner_.get_memory_info(val);
@@ -177,7 +253,11 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
     sdp_args_set_t *res = res_cache.get_or_add(
             reinterpret_cast<size_t>(this), resource_ctor_);
 
-    int MBO = sdp_cfg_.batch_size, MBI = sdp_cfg_.num_head_q;
+    // A work item computes kv_group query heads over a chunk of the kv
+    // sequence.
+    const dim_t MBO = sdp_cfg_.batch_size,
+                MBI = sdp_cfg_.num_head_q / sdp_cfg_.kv_group,
+                KV_SPLIT = sdp_cfg_.kv_split;
 
     char *src1_user_pointer = static_cast<char *>(
             inputs[sdp_cfg_.graph_inport[sdp_decomp_config_t::mm1_src]]
@@ -191,24 +271,51 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
     char *dst2_user_pointer = static_cast<char *>(outputs[0].get_data_handle());
 
     size_t block_size = sdp_registry_.size();
+    // The partial outputs of the kv chunks are shared by the threads and
+    // follow their blocks.
+    const size_t kv_split_offset = block_size * sdp_cfg_.nthr;
     temporary_scratchpad_t scratchpad(
-            block_size * sdp_cfg_.nthr, p_engine_, *g_alloc_);
+            kv_split_offset + sdp_cfg_.get_kv_split_size(), p_engine_,
+            *g_alloc_, g_stream);
     assertm(scratchpad.size() >= sdp_registry_.size(),
             "no enough scratchpad memory");
     grantor_t var_grantor = sdp_registry_.grantor(scratchpad.get_buffer());
 
+    // The rows of a work item, and the partial outputs and log-sum-exps of
+    // the work items, in this order.
+    const dim_t kv_rows = sdp_cfg_.kv_group * sdp_cfg_.seq_len_q;
+    const dim_t kv_nitems = MBO * MBI * KV_SPLIT;
+    float *kv_partial = reinterpret_cast<float *>(
+            scratchpad.get_buffer() + kv_split_offset);
+    float *kv_lse = kv_partial + kv_nitems * kv_rows * sdp_cfg_.head_size_v;
+
     const auto get_mem_dt_size = [](const memory &m) -> size_t {
         return memory::data_type_size(m.get_desc().get_data_type());
     };
+    // The size in bytes of a number of elements, of int4 data as well.
+    const auto get_mem_bytes = [](const memory &m, size_t nelems) -> size_t {
+        return types::elements_to_bytes(
+                static_cast<data_type_t>(m.get_desc().get_data_type()),
+                nelems);
+    };
 
-    const auto loop = [&](int tid, int nthr, dim_t bo, dim_t bi) {
+    const auto loop = [&](int tid, int nthr, dim_t bo, dim_t bh, dim_t sp) {
         // prepare execution args and allocate real memory
         prepare_sub_args(var_grantor, tid, block_size, res->mem_map);
 
+        // the first query head of the work item
+        const dim_t bi = bh * sdp_cfg_.kv_group;
         const size_t group_head = sdp_cfg_.num_head_q / sdp_cfg_.num_head_kv;
         const size_t wei_head_offset = bi / group_head;
         const size_t group_id = bi % group_head;
 
+        // The last chunk ends with the sequence, the tokens it shares with
+        // the previous chunk are masked.
+        const dim_t kv_start = std::min(sp * sdp_cfg_.kv_chunk,
+                sdp_cfg_.seq_len_kv - sdp_cfg_.kv_chunk);
+        const dim_t kv_nmasked = sp * sdp_cfg_.kv_chunk - kv_start;
+        const dim_t item = (bo * MBI + bh) * KV_SPLIT + sp;
+
         // reorder0
         auto &sub_src1_tid = res->mem_map[sdp_cfg_.sub_src1.get()][tid];
         // reorder1:
@@ -256,6 +363,8 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
                 if (mask_dims[2] != 1)
                     mask_offset += group_id * mask_strides[2];
             }
+            if (mask_dims.back() != 1)
+                mask_offset += kv_start * mask_strides.back();
             sub_mm1_post_add_tid.set_data_handle(
                     static_cast<char *>(mask_input.get_data_handle())
                     + mask_offset * get_mem_dt_size(sub_mm1_post_add_tid));
@@ -288,6 +397,8 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
                 if (select_src_dims[2] != 1)
                     select_src_offset += group_id * select_src_strides[2];
             }
+            if (select_src_dims.back() != 1)
+                select_src_offset += kv_start * select_src_strides.back();
             sub_select_src_tid.set_data_handle(
                     static_cast<char *>(select_src_input.get_data_handle())
                     + select_src_offset * get_mem_dt_size(sub_select_src_tid));
@@ -319,6 +430,8 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
                 if (select_cond_dims[2] != 1)
                     select_cond_offset += group_id * select_cond_strides[2];
             }
+            if (select_cond_dims.back() != 1)
+                select_cond_offset += kv_start * select_cond_strides.back();
             sub_select_cond_tid.set_data_handle(
                     static_cast<char *>(select_cond_input.get_data_handle())
                     + select_cond_offset
@@ -342,14 +455,47 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
                 = (bo * sdp_cfg_.src1_strides[0] + sub_src1_head_offset)
                 * get_mem_dt_size(sub_src1_tid);
 
-        const size_t sub_wei1_offset
-                = (bo * sdp_cfg_.wei1_strides[0]
-                          + wei_head_offset * sdp_cfg_.wei1_strides[1])
-                * get_mem_dt_size(sub_wei1_user_tid);
-        const size_t sub_wei2_offset
-                = (bo * sdp_cfg_.wei2_strides[0]
-                          + wei_head_offset * sdp_cfg_.wei2_strides[1])
-                * get_mem_dt_size(sub_wei2_user_tid);
+        const size_t sub_wei1_offset = get_mem_bytes(sub_wei1_user_tid,
+                bo * sdp_cfg_.wei1_strides[0]
+                        + wei_head_offset * sdp_cfg_.wei1_strides[1]
+                        + kv_start * sdp_cfg_.wei1_strides[sdp_cfg_.ndims - 1]);
+        const size_t sub_wei2_offset = get_mem_bytes(sub_wei2_user_tid,
+                bo * sdp_cfg_.wei2_strides[0]
+                        + wei_head_offset * sdp_cfg_.wei2_strides[1]
+                        + kv_start * sdp_cfg_.wei2_strides[sdp_cfg_.ndims - 2]);
+
+        // scales and zero points of the compressed key and value
+        const auto set_kv_dequant_handles
+                = [&](const sdp_decomp_config_t::kv_dequant_t &dq,
+                          const memory &scale, const memory &zp, int scale_port,
+                          int zp_port) {
+                      if (!dq.enabled) return;
+                      auto &scale_tid = res->mem_map[scale.get()][tid];
+                      scale_tid.set_data_handle(
+                              static_cast<char *>(
+                                      inputs[sdp_cfg_.graph_inport[scale_port]]
+                                              .get_data_handle())
+                              + get_mem_bytes(scale_tid,
+                                      bo * dq.scale_batch_stride
+                                              + wei_head_offset
+                                                      * dq.scale_head_stride));
+                      if (!dq.with_zp) return;
+                      auto &zp_tid = res->mem_map[zp.get()][tid];
+                      zp_tid.set_data_handle(
+                              static_cast<char *>(
+                                      inputs[sdp_cfg_.graph_inport[zp_port]]
+                                              .get_data_handle())
+                              + get_mem_bytes(zp_tid,
+                                      bo * dq.zp_batch_stride
+                                              + wei_head_offset
+                                                      * dq.zp_head_stride));
+                  };
+        set_kv_dequant_handles(sdp_cfg_.wei1_dequant,
+                sdp_cfg_.sub_wei1_dq_scale, sdp_cfg_.sub_wei1_dq_zp,
+                sdp_decomp_config_t::wei1_scale, sdp_decomp_config_t::wei1_zp);
+        set_kv_dequant_handles(sdp_cfg_.wei2_dequant,
+                sdp_cfg_.sub_wei2_dq_scale, sdp_cfg_.sub_wei2_dq_zp,
+                sdp_decomp_config_t::wei2_scale, sdp_decomp_config_t::wei2_zp);
 
         const size_t sub_dst_user_head_offset = sdp_cfg_.ndims == 4
                 ? bi * sdp_cfg_.dst_strides[1]
@@ -367,8 +513,12 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
 
         // If the last reorder is inplace, it means we don't have to do
         // extra reorder, thus we should set matmul's output to the user's
-        // output directly.
-        if (sdp_cfg_.sub_reorder3.get_inplace()) {
+        // output directly. The partial outputs of kv chunks are merged
+        // later.
+        if (KV_SPLIT > 1) {
+            sub_mm2_dst_tid.set_data_handle(
+                    kv_partial + item * kv_rows * sdp_cfg_.head_size_v);
+        } else if (sdp_cfg_.sub_reorder3.get_inplace()) {
             sub_mm2_dst_tid.set_data_handle(
                     dst2_user_pointer + sub_dst_user_offset);
         }
@@ -379,18 +529,60 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
         sdp_cfg_.sub_mm1_prim.execute(strm, res->sub_mm1_args[tid]);
         if (sdp_cfg_.has_select && !sdp_cfg_.select_fusiable)
             sdp_cfg_.sub_select_prim.execute(strm, res->sub_select_args[tid]);
+        if (KV_SPLIT > 1) {
+            auto &sub_mm1_dst_tid
+                    = res->mem_map[sdp_cfg_.sub_mm1_dst.get()][tid];
+            compute_kv_chunk_lse(sub_mm1_dst_tid.get_data_handle(),
+                    static_cast<data_type_t>(
+                            sub_mm1_dst_tid.get_desc().get_data_type()),
+                    kv_rows, sdp_cfg_.kv_chunk, kv_nmasked,
+                    kv_lse + item * kv_rows);
+        }
         sdp_cfg_.sub_softmax_prim.execute(strm, res->sub_softmax_args[tid]);
 
         sdp_cfg_.sub_reorder2.execute(strm, res->sub_reorder2_args[tid]);
 
         sdp_cfg_.sub_mm2_prim.execute(strm, res->sub_mm2_args[tid]);
+        if (KV_SPLIT == 1)
+            sdp_cfg_.sub_reorder3.execute(strm, res->sub_reorder3_args[tid]);
+    };
+
+    // Merges the partial outputs of the kv chunks of a work item and writes
+    // the result to the user's output.
+    const auto merge = [&](int tid, int nthr, dim_t bo, dim_t bh) {
+        prepare_sub_args(var_grantor, tid, block_size, res->mem_map);
+
+        const dim_t bi = bh * sdp_cfg_.kv_group;
+        const size_t group_head = sdp_cfg_.num_head_q / sdp_cfg_.num_head_kv;
+        const size_t sub_dst_user_head_offset = sdp_cfg_.ndims == 4
+                ? bi * sdp_cfg_.dst_strides[1]
+                : (bi / group_head) * sdp_cfg_.dst_strides[1]
+                        + (bi % group_head) * sdp_cfg_.dst_strides[2];
+        auto &sub_dst_user_tid = res->mem_map[sdp_cfg_.sub_dst_user.get()][tid];
+        auto &sub_mm2_dst_tid = res->mem_map[sdp_cfg_.sub_mm2_dst.get()][tid];
+        char *dst_user = dst2_user_pointer
+                + (bo * sdp_cfg_.dst_strides[0] + sub_dst_user_head_offset)
+                        * get_mem_dt_size(sub_dst_user_tid);
+
+        const dim_t item = (bo * MBI + bh) * KV_SPLIT;
+        float *partial = kv_partial + item * kv_rows * sdp_cfg_.head_size_v;
+        float *dst = sdp_cfg_.sub_reorder3.get_inplace()
+                ? reinterpret_cast<float *>(dst_user)
+                : partial;
+        merge_kv_chunks(partial, kv_lse + item * kv_rows, KV_SPLIT, kv_rows,
+                sdp_cfg_.head_size_v, kv_rows * sdp_cfg_.head_size_v, kv_rows,
+                sdp_cfg_.softmax_inf_as_zero, dst);
+
+        sub_mm2_dst_tid.set_data_handle(partial);
+        sub_dst_user_tid.set_data_handle(dst_user);
         sdp_cfg_.sub_reorder3.execute(strm, res->sub_reorder3_args[tid]);
     };
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     tp_stream->before_exec_hook();
 #endif
 
-    parallel_nd_ext(sdp_cfg_.nthr, MBO, MBI, loop);
+    parallel_nd_ext(sdp_cfg_.nthr, MBO, MBI, KV_SPLIT, loop);
+    if (KV_SPLIT > 1) parallel_nd_ext(sdp_cfg_.nthr, MBO, MBI, merge);
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     tp_stream->after_exec_hook();
@@ -170,6 +170,12 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(sdp_decomp_kernel_t)
+    // Every thread works on its own block of the temporary buffer, followed
+    // by the partial outputs of the kv chunks.
+    size_t get_temporary_size() const override {
+        return sdp_registry_.size() * static_cast<size_t>(sdp_cfg_.nthr)
+                + sdp_cfg_.get_kv_split_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(sdp_decomp_kernel_t)
     status_t reset_engine(const engine_t *g_engine) override {
         dnnl::engine p_engine = make_dnnl_engine(*g_engine);
@@ -28,7 +28,7 @@ namespace dnnl_impl {
 
 bool sdp_decomp_config_t::initial_check(const std::shared_ptr<subgraph_t> &sg,
         const std::vector<logical_tensor_t> &inputs,
-        const std::vector<logical_tensor_t> &outputs) {
+        const std::vector<logical_tensor_t> &outputs, bool quantized) {
     // The order of input logical tensors in inputs is not certain, we need
     // to record the input offset in a certain order of ops.
     CHECK_BOOL(record_input_offset(sg, inputs));
@@ -67,6 +67,15 @@ bool sdp_decomp_config_t::initial_check(const std::shared_ptr<subgraph_t> &sg,
             static_cast<long int>(wei2_user_dims[0]));
 
     head_size_v = wei2_user_dims.back();
+    seq_len_kv = wei2_user_dims[ndims - 2];
+
+    if (!init_kv_dequant(wei1_dequant, inputs, graph_inport[mm1_wei],
+                graph_inport[wei1_scale], graph_inport[wei1_zp]))
+        return false;
+    if (!init_kv_dequant(wei2_dequant, inputs, graph_inport[mm2_wei],
+                graph_inport[wei2_scale], graph_inport[wei2_zp]))
+        return false;
+
     // Check scale size
     if (graph_inport[mm1_scale] != -1) {
         auto scale_sz = ltw(inputs[graph_inport[mm1_scale]]).nelems();
@@ -84,14 +93,19 @@ bool sdp_decomp_config_t::initial_check(const std::shared_ptr<subgraph_t> &sg,
                 static_cast<long int>(scale_sz));
     }
 
-    VCHECK_SDP_DECOMP(ltw(inputs[graph_inport[mm1_wei]]).data_type()
-                    == ltw(inputs[graph_inport[mm2_wei]]).data_type(),
-            false,
+    // A compressed key or value is compared by its dequantized data type.
+    const auto get_kv_dt = [&](const kv_dequant_t &dq, int port) {
+        if (!dq.enabled) return ltw(inputs[port]).data_type();
+        return ltw(dq.op->get_output_value(0)->get_logical_tensor())
+                .data_type();
+    };
+    const auto key_dt = get_kv_dt(wei1_dequant, graph_inport[mm1_wei]);
+    const auto value_dt = get_kv_dt(wei2_dequant, graph_inport[mm2_wei]);
+    VCHECK_SDP_DECOMP(key_dt == value_dt, false,
             "Key and value should have the same data type. But got key:%s, "
             "value:%s",
-            dnnl_dt2str(ltw(inputs[graph_inport[mm1_wei]]).data_type()),
-            dnnl_dt2str(ltw(inputs[graph_inport[mm2_wei]]).data_type()));
-#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+            dnnl_dt2str(key_dt), dnnl_dt2str(value_dt));
+
 // RATIO is an empirical value used to determine the numerical relationship
 // between batch_size, num_head_q and thread number to determine whether to use
 // decompose kernel. The key to the decompose kernel is that we do parallel in
@@ -103,14 +117,63 @@ bool sdp_decomp_config_t::initial_check(const std::shared_ptr<subgraph_t> &sg,
 // TODO: Refine the inequation based on the relationship of cache size and sdp
 // memory footprint requirements.
 #define RATIO 2
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
     // Initialize nthr with current threads num
     nthr = dnnl_get_current_num_threads();
-    VCHECK_SDP_DECOMP(batch_size * num_head_q > RATIO * nthr, false,
-            "Doesn't meet condition for decompose: Batch size * num_head_q "
-            "should be larger than ratio * nthr, but got batch_size %ld, "
-            "num_head_q %ld, ration %d , nthr %d",
-            static_cast<long int>(batch_size),
-            static_cast<long int>(num_head_q), RATIO, nthr);
+    const int max_nthr = nthr;
+#else
+    const int max_nthr = dnnl_get_max_threads();
+#endif
+
+    // The query heads of a kv head are computed together, and the kv
+    // sequence may be split, for a floating-point SDPA with select as a
+    // post-op. The attributes of the quantized primitives and of the
+    // dequantization of a compressed key or value are defined per head.
+    const bool compressed_kv = wei1_dequant.enabled || wei2_dequant.enabled;
+    const bool is_int8 = quantized && !compressed_kv;
+    const bool with_select_prim = has_select && !select_fusiable;
+    const bool can_group = !is_int8 && !compressed_kv && !with_select_prim;
+    kv_group = can_group ? num_head_q / num_head_kv : 1;
+    kv_split = 1;
+    kv_chunk = seq_len_kv;
+
+    // When there are too few heads to keep the threads busy, e.g. at decoding
+    // with a small batch, the kv sequence is split over the threads as well.
+    const dim_t work = batch_size * num_head_q / kv_group;
+    if (work <= RATIO * max_nthr && can_group) {
+        const dim_t max_split = seq_len_kv / kv_split_min_len;
+        const dim_t split = std::min(
+                impl::utils::div_up(static_cast<dim_t>(max_nthr), work),
+                max_split);
+        if (split > 1) {
+            kv_chunk = impl::utils::div_up(seq_len_kv, split);
+            kv_split = impl::utils::div_up(seq_len_kv, kv_chunk);
+        }
+    }
+    // Heads that are not split are computed one by one if there are enough
+    // of them, as grouping would leave threads idle.
+    if (kv_split == 1 && kv_group > 1 && work <= RATIO * max_nthr
+            && batch_size * num_head_q > RATIO * max_nthr)
+        kv_group = 1;
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    if (kv_split > 1) {
+        VCHECK_SDP_DECOMP(work * kv_split >= nthr, false,
+                "Doesn't meet condition for decompose: the number of kv "
+                "chunks should be at least nthr, but got batch_size %ld, "
+                "num_head_kv %ld, kv chunks %ld, nthr %d",
+                static_cast<long int>(batch_size),
+                static_cast<long int>(num_head_kv),
+                static_cast<long int>(kv_split), nthr);
+    } else {
+        VCHECK_SDP_DECOMP(batch_size * num_head_q / kv_group > RATIO * nthr,
+                false,
+                "Doesn't meet condition for decompose: Batch size * num_head_q "
+                "should be larger than ratio * nthr, but got batch_size %ld, "
+                "num_head_q %ld, ration %d , nthr %d",
+                static_cast<long int>(batch_size),
+                static_cast<long int>(num_head_q), RATIO, nthr);
+    }
 #endif
     return true;
 }
@@ -121,8 +184,13 @@ impl::status_t sdp_decomp_config_t::construct_params(
         const dnnl::engine &p_engine,
         const std::vector<logical_tensor_t> &inputs) {
 
+    // SDPA with a compressed key or value has floating-point matmuls, the
+    // weights are dequantized by the reorders.
+    const bool is_int8
+            = quantized && !wei1_dequant.enabled && !wei2_dequant.enabled;
+
     // Record the ops inside of SDP pattern for later usage
-    CHECK(record_sdp_ops(sg, quantized));
+    CHECK(record_sdp_ops(sg, is_int8));
     const int last_dim = ndims - 1, second_last_dim = ndims - 2;
 
     // Update SDPA input params. Sequence length for query and key/value are
@@ -137,8 +205,10 @@ impl::status_t sdp_decomp_config_t::construct_params(
             ltw(inputs[graph_inport[mm1_src]]).data_type());
     memory::data_type dt_wei_user = static_cast<memory::data_type>(
             ltw(inputs[graph_inport[mm1_wei]]).data_type());
-    memory::data_type dt_wei = quantized ? memory::data_type::s8 : dt_src_user;
-    memory::data_type dt_inter = quantized
+    memory::data_type dt_wei2_user = static_cast<memory::data_type>(
+            ltw(inputs[graph_inport[mm2_wei]]).data_type());
+    memory::data_type dt_wei = is_int8 ? memory::data_type::s8 : dt_src_user;
+    memory::data_type dt_inter = is_int8
             ? dt
             : static_cast<memory::data_type>(
                     ltw(sdp_op[1]->get_output_value(0)->get_logical_tensor())
@@ -152,6 +222,19 @@ impl::status_t sdp_decomp_config_t::construct_params(
     // pending on primitive investigation and fix
     omp_set_num_threads(1);
 #endif
+    // A work item computes kv_group query heads at once. The mds of their
+    // queries, scores and outputs get a leading head dimension, over which
+    // the key and value of the kv head are broadcast.
+    const bool grouped = kv_group > 1;
+    const auto group_dims = [&](dims d, dim_t n) {
+        if (grouped) d.insert(d.begin(), n);
+        return d;
+    };
+    const auto tag_ab = grouped ? format_tag::abc : format_tag::ab;
+    const auto tag_ba = grouped ? format_tag::acb : format_tag::ba;
+    // The dimension of the query heads of a kv head.
+    const int q_head_dim = ndims == 4 ? 1 : 2;
+
     // intermediate md used to create primitives
     memory::desc sub_src1_md, sub_wei1_user_md, sub_wei1_md, sub_mm1_src_md,
             sub_mm1_wei_md, sub_mm1_dst_md, sub_softmax_dst_md,
@@ -164,12 +247,12 @@ impl::status_t sdp_decomp_config_t::construct_params(
     sub_reorder0_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
 
     // per-head: reorder src1 to dense, for first matmul
-    dims sub_src1_dims = {seq_len_q, head_size_qk};
+    dims sub_src1_dims = group_dims({seq_len_q, head_size_qk}, kv_group);
     src1_strides = ltw(inputs[graph_inport[mm1_src]]).vstrides();
     sub_src1_md = memory::desc(sub_src1_dims, dt_src_user,
-            {src1_strides[second_last_dim], src1_strides[last_dim]});
-    auto sub_src1_d_md
-            = memory::desc(sub_src1_dims, dt_src_user, format_tag::ab);
+            group_dims({src1_strides[second_last_dim], src1_strides[last_dim]},
+                    src1_strides[q_head_dim]));
+    auto sub_src1_d_md = memory::desc(sub_src1_dims, dt_src_user, tag_ab);
     auto sub_reorder0_pd = reorder::primitive_desc(
             p_engine, sub_src1_md, p_engine, sub_src1_d_md, sub_reorder0_attr);
     sub_reorder0.init(sub_reorder0_pd);
@@ -177,14 +260,21 @@ impl::status_t sdp_decomp_config_t::construct_params(
     // per-head: reorder u8->s8 wei for first matmul
     // create reorder1 primitive attr
     dnnl::primitive_attr sub_reorder1_attr = make_primitive_attr(sdp_op[0]);
-    dims sub_wei1_dims = {head_size_qk, seq_len_kv};
-    auto wei_md = make_dnnl_memory_desc(
-            sdp_op[1]->get_input_value(1)->get_logical_tensor());
-    wei1_strides = wei_md.get_strides();
+    set_kv_dequant_attr(wei1_dequant, sub_reorder1_attr);
+    dims sub_wei1_dims = group_dims({head_size_qk, kv_chunk}, 1);
+    if (wei1_dequant.enabled) {
+        // The compressed key is read from the user buffer directly.
+        wei1_strides = ltw(inputs[graph_inport[mm1_wei]]).vstrides();
+    } else {
+        auto wei_md = make_dnnl_memory_desc(
+                sdp_op[1]->get_input_value(1)->get_logical_tensor());
+        wei1_strides = wei_md.get_strides();
+    }
     sub_wei1_user_md = memory::desc(sub_wei1_dims, dt_wei_user,
-            {wei1_strides[second_last_dim], wei1_strides[last_dim]});
+            group_dims({wei1_strides[second_last_dim], wei1_strides[last_dim]},
+                    wei1_strides[1]));
     // Flip the format to have `ba` weights MBI item in per thread loop.
-    sub_wei1_md = memory::desc(sub_wei1_dims, dt_wei, format_tag::ba);
+    sub_wei1_md = memory::desc(sub_wei1_dims, dt_wei, tag_ba);
     auto sub_reorder1_pd = reorder::primitive_desc(p_engine, sub_wei1_user_md,
             p_engine, sub_wei1_md, sub_reorder1_attr);
     sub_reorder1.init(sub_reorder1_pd);
@@ -192,14 +282,13 @@ impl::status_t sdp_decomp_config_t::construct_params(
     // first matmul
     // create first matmul primitive attr
     dnnl::primitive_attr sub_matmul1_attr = make_primitive_attr(sdp_op[1]);
-    dims sub_mm1_src_dims = {seq_len_q, head_size_qk};
-    dims sub_mm1_wei_dims = {head_size_qk, seq_len_kv};
-    dims sub_mm1_dst_dims = {seq_len_q, seq_len_kv};
-
-    sub_mm1_src_md
-            = memory::desc(sub_mm1_src_dims, dt_src_user, format_tag::ab);
-    sub_mm1_wei_md = memory::desc(sub_mm1_wei_dims, dt_wei, format_tag::ba);
-    sub_mm1_dst_md = memory::desc(sub_mm1_dst_dims, dt_inter, format_tag::ab);
+    dims sub_mm1_src_dims = group_dims({seq_len_q, head_size_qk}, kv_group);
+    dims sub_mm1_wei_dims = group_dims({head_size_qk, kv_chunk}, 1);
+    dims sub_mm1_dst_dims = group_dims({seq_len_q, kv_chunk}, kv_group);
+
+    sub_mm1_src_md = memory::desc(sub_mm1_src_dims, dt_src_user, tag_ab);
+    sub_mm1_wei_md = memory::desc(sub_mm1_wei_dims, dt_wei, tag_ba);
+    sub_mm1_dst_md = memory::desc(sub_mm1_dst_dims, dt_inter, tag_ab);
     dnnl::post_ops dnnl_pops;
     auto mm1_ori_dnnl_pops = sub_matmul1_attr.get_post_ops();
     auto make_sub_md
@@ -208,11 +297,16 @@ impl::status_t sdp_decomp_config_t::construct_params(
         auto post_shape = ori_desc.dims;
         auto post_stride = ori_desc.format_desc.blocking.strides;
         auto post_dt = static_cast<dnnl::memory::data_type>(ori_desc.data_type);
-        dims post_stride_dims
-                = {post_stride[second_last_dim], post_stride[last_dim]};
-        return dnnl::memory::desc(
-                {post_shape[second_last_dim], post_shape[last_dim]}, post_dt,
-                post_stride_dims);
+        // A post-op source along the kv sequence is taken for a chunk.
+        const dim_t post_kv = post_shape[last_dim] == seq_len_kv
+                ? kv_chunk
+                : post_shape[last_dim];
+        dims post_dims = group_dims({post_shape[second_last_dim], post_kv},
+                post_shape[q_head_dim] == 1 ? 1 : kv_group);
+        dims post_stride_dims = group_dims(
+                {post_stride[second_last_dim], post_stride[last_dim]},
+                post_stride[q_head_dim]);
+        return dnnl::memory::desc(post_dims, post_dt, post_stride_dims);
     };
     for (int i = 0; i < mm1_ori_dnnl_pops.get()->len(); i++) {
         if (mm1_ori_dnnl_pops.get()->entry_[i].is_binary()) {
@@ -307,9 +401,9 @@ impl::status_t sdp_decomp_config_t::construct_params(
     }
     sub_softmax_attr.set_post_ops(dnnl_pops);
 
-    sub_softmax_dst_md
-            = memory::desc(sub_mm1_dst_dims, dt_src_user, format_tag::ab);
+    sub_softmax_dst_md = memory::desc(sub_mm1_dst_dims, dt_src_user, tag_ab);
     const auto mode = sdp_op[2]->get_attr<std::string>(op_attr::mode);
+    softmax_inf_as_zero = mode == "inf_as_zero";
     const dnnl::algorithm algo = mode == "inf_as_zero"
             ? static_cast<dnnl::algorithm>(
                     dnnl::impl::alg_kind::softmax_accurate_inf_as_zero)
@@ -323,12 +417,14 @@ impl::status_t sdp_decomp_config_t::construct_params(
     // reorder u8->s8 wei for second matmul
     // create reorder2 primitive attr
     dnnl::primitive_attr sub_reorder2_attr = make_primitive_attr(sdp_op[3]);
-    dims sub_wei2_dims = {seq_len_kv, head_size_v};
+    set_kv_dequant_attr(wei2_dequant, sub_reorder2_attr);
+    dims sub_wei2_dims = group_dims({kv_chunk, head_size_v}, 1);
     wei2_strides = ltw(inputs[graph_inport[mm2_wei]]).vstrides();
-    sub_wei2_user_md = memory::desc(sub_wei2_dims, dt_wei_user,
-            {wei2_strides[second_last_dim], wei2_strides[last_dim]});
+    sub_wei2_user_md = memory::desc(sub_wei2_dims, dt_wei2_user,
+            group_dims({wei2_strides[second_last_dim], wei2_strides[last_dim]},
+                    wei2_strides[1]));
     // The format is `ab` due to performance of reorder to `ba` is low.
-    auto sub_wei2_md = memory::desc(sub_wei2_dims, dt_wei, format_tag::ab);
+    auto sub_wei2_md = memory::desc(sub_wei2_dims, dt_wei, tag_ab);
     auto sub_reorder2_pd = reorder::primitive_desc(p_engine, sub_wei2_user_md,
             p_engine, sub_wei2_md, sub_reorder2_attr);
     sub_reorder2.init(sub_reorder2_pd);
@@ -336,14 +432,16 @@ impl::status_t sdp_decomp_config_t::construct_params(
     // second matmul
     // create second matmul primitive attr
     dnnl::primitive_attr sub_matmul2_attr = make_primitive_attr(sdp_op[4]);
-    dims sub_mm2_src_dims = {seq_len_q, seq_len_kv};
-    dims sub_mm2_wei_dims = {seq_len_kv, head_size_v};
-    dims sub_mm2_dst_dims = {seq_len_q, head_size_v};
+    dims sub_mm2_src_dims = group_dims({seq_len_q, kv_chunk}, kv_group);
+    dims sub_mm2_wei_dims = group_dims({kv_chunk, head_size_v}, 1);
+    dims sub_mm2_dst_dims = group_dims({seq_len_q, head_size_v}, kv_group);
+    // The partial outputs of kv chunks are merged in f32.
+    const memory::data_type dt_mm2_dst
+            = kv_split > 1 ? memory::data_type::f32 : dt_src_user;
     auto sub_mm2_src_md
-            = memory::desc(sub_mm2_src_dims, dt_src_user, format_tag::ab);
-    sub_mm2_wei_md = memory::desc(sub_mm2_wei_dims, dt_wei, format_tag::ab);
-    sub_mm2_dst_md
-            = memory::desc(sub_mm2_dst_dims, dt_src_user, format_tag::ab);
+            = memory::desc(sub_mm2_src_dims, dt_src_user, tag_ab);
+    sub_mm2_wei_md = memory::desc(sub_mm2_wei_dims, dt_wei, tag_ab);
+    sub_mm2_dst_md = memory::desc(sub_mm2_dst_dims, dt_mm2_dst, tag_ab);
     auto sub_mm2_pd = matmul::primitive_desc(p_engine, sub_mm2_src_md,
             sub_mm2_wei_md, sub_mm2_dst_md, sub_matmul2_attr);
     sub_mm2_prim = matmul(sub_mm2_pd);
@@ -351,12 +449,13 @@ impl::status_t sdp_decomp_config_t::construct_params(
     // per-head: reorder dst2 from dense to strided
     primitive_attr sub_reorder3_attr;
     sub_reorder3_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
-    dims sub_dst_dims = {seq_len_q, head_size_v};
+    dims sub_dst_dims = group_dims({seq_len_q, head_size_v}, kv_group);
     auto out_lt = sdp_op[4]->get_output_value(0)->get_logical_tensor();
     dst_strides = ltw(out_lt).vstrides();
-    sub_dst_md = memory::desc(sub_dst_dims, dt_src_user, format_tag::ab);
+    sub_dst_md = memory::desc(sub_dst_dims, dt_mm2_dst, tag_ab);
     sub_dst_user_md = memory::desc(sub_dst_dims, dt_src_user,
-            {dst_strides[second_last_dim], dst_strides[last_dim]});
+            group_dims({dst_strides[second_last_dim], dst_strides[last_dim]},
+                    dst_strides[q_head_dim]));
     auto sub_reorder3_pd = reorder::primitive_desc(
             p_engine, sub_dst_md, p_engine, sub_dst_user_md, sub_reorder3_attr);
     sub_reorder3.init(sub_reorder3_pd);
@@ -512,6 +611,10 @@ impl::status_t sdp_decomp_config_t::construct_params(
     prepare_sdp_scales_zps(sdp_op[2], 1, sub_softmax_args, p_engine);
     prepare_sdp_scales_zps(sdp_op[3], 1, sub_reorder2_args, p_engine);
     prepare_sdp_scales_zps(sdp_op[4], 2, sub_mm2_args, p_engine);
+    add_kv_dequant_args(wei1_dequant, sub_reorder1_args, sub_wei1_dq_scale,
+            sub_wei1_dq_zp, p_engine);
+    add_kv_dequant_args(wei2_dequant, sub_reorder2_args, sub_wei2_dq_scale,
+            sub_wei2_dq_zp, p_engine);
     ////////////////////////////////////////////////////////////////////////
     /////////////// End Constructing exec args /////////////////////////////
     ////////////////////////////////////////////////////////////////////////
@@ -525,6 +628,15 @@ impl::status_t sdp_decomp_config_t::construct_params(
     return status::success;
 }
 
+size_t sdp_decomp_config_t::get_kv_split_size() const {
+    if (kv_split == 1) return 0;
+    // Every row of the output of every chunk has the partial output and the
+    // log-sum-exp of its scores.
+    const size_t nrows = static_cast<size_t>(
+            batch_size * num_head_q * seq_len_q * kv_split);
+    return nrows * static_cast<size_t>(head_size_v + 1) * sizeof(float);
+}
+
 op_ptr sdp_decomp_config_t::get_post_op(const op_ptr &op) const {
     const auto out_val = op->get_output_value(0);
     const auto &consumers = out_val->get_consumers();
@@ -563,9 +675,6 @@ impl::status_t sdp_decomp_config_t::record_input_offset(
         const auto &op_kind = cur_op->get_kind();
         VCHECK_SDP_DECOMP(op_kind != graph::op_kind::GenIndex,
                 status::unimplemented, "Not support implicit causal mask");
-        VCHECK_SDP_DECOMP(op_kind != graph::op_kind::DynamicDequantize,
-                status::unimplemented,
-                "Decomposed kernel does not support dynamic quantization");
         // both mm1 and mm2 are found.
         if (mm1 && mm2) break;
         if (op_kind != graph::op_kind::MatMul) continue;
@@ -620,6 +729,29 @@ impl::status_t sdp_decomp_config_t::record_input_offset(
     }
     VCHECK_SDP_DECOMP(mm1 != nullptr && mm2 != nullptr, status::invalid_graph,
             "Failed to find matmul1 or matmul2");
+
+    // Only the dynamic dequantization of the key and the value is supported.
+    const auto get_wei_dequant = [](const op_ptr &mm) -> op_ptr {
+        const auto in_val = mm->get_input_value(1);
+        if (!in_val->has_producer()
+                || in_val->get_producer().get_kind()
+                        != graph::op_kind::DynamicDequantize)
+            return nullptr;
+        VCHECK_SDP_DECOMP(!mm->get_attr<bool>(op_attr::transpose_b), nullptr,
+                "Not support transposed compressed key or value");
+        return in_val->get_producer().shared_from_this();
+    };
+    wei1_dequant.op = get_wei_dequant(mm1);
+    wei2_dequant.op = get_wei_dequant(mm2);
+    for (const auto &cur_op : sg->get_ops()) {
+        VCHECK_SDP_DECOMP(
+                cur_op->get_kind() != graph::op_kind::DynamicDequantize
+                        || cur_op == wei1_dequant.op
+                        || cur_op == wei2_dequant.op,
+                status::unimplemented,
+                "Decomposed kernel only supports dynamic dequantization of "
+                "key and value");
+    }
     int src1_id = find_graph_inport(mm1->get_input_value(0));
     graph_inport.emplace_back(src1_id);
     int wei1_id = find_graph_inport(mm1->get_input_value(1));
@@ -690,6 +822,141 @@ impl::status_t sdp_decomp_config_t::record_input_offset(
         graph_inport.emplace_back(-1);
         graph_inport.emplace_back(-1);
     }
+
+    for (const auto &dq : {wei1_dequant.op, wei2_dequant.op}) {
+        if (dq) {
+            graph_inport.emplace_back(
+                    find_graph_inport(dq->get_input_value(1)));
+            graph_inport.emplace_back(dq->num_inputs() > 2
+                            ? find_graph_inport(dq->get_input_value(2))
+                            : -1);
+        } else {
+            //placeholder
+            graph_inport.emplace_back(-1);
+            graph_inport.emplace_back(-1);
+        }
+    }
+    return status::success;
+}
+
+bool sdp_decomp_config_t::init_kv_dequant(kv_dequant_t &dq,
+        const std::vector<logical_tensor_t> &inputs, int wei_port,
+        int scale_port, int zp_port) const {
+    if (!dq.op) return true;
+    VCHECK_SDP_DECOMP(ndims == 4, false,
+            "Compressed key or value requires 4 dims, but got %ld",
+            static_cast<long int>(ndims));
+    VCHECK_SDP_DECOMP(wei_port != -1 && scale_port != -1, false,
+            "Failed to find the inputs of the key or value dequantization");
+    VCHECK_SDP_DECOMP(
+            ltw(dq.op->get_output_value(0)->get_logical_tensor()).is_strided(),
+            false, "Dequantized key or value should be strided");
+
+    const ltw wei(inputs[wei_port]);
+    const dims wei_dims = wei.vdims();
+    const auto &qtype = dq.op->get_attr<std::string>(op_attr::qtype);
+
+    // Computes the head strides of the scales or zero points and checks that
+    // the ones of a head are a dense matrix for per-group quantization.
+    const auto init_head_strides = [&](const ltw &q, dim_t &batch_stride,
+                                           dim_t &head_stride) {
+        if (qtype == "per_tensor") return true;
+        const dims q_dims = q.vdims(), q_strides = q.vstrides();
+        if (qtype == "per_channel") {
+            int64_t axis = dq.op->get_attr<int64_t>(op_attr::axis);
+            if (axis < 0) axis += ndims;
+            if (axis == 0) batch_stride = q_strides[0];
+            if (axis == 1) head_stride = q_strides[0];
+            return true;
+        }
+        if (q_dims.size() != 4 || q_strides[3] != 1
+                || q_strides[2] != q_dims[3])
+            return false;
+        batch_stride = q_dims[0] == 1 ? 0 : q_strides[0];
+        head_stride = q_dims[1] == 1 ? 0 : q_strides[1];
+        return true;
+    };
+
+    if (qtype == "per_channel") {
+        int64_t axis = dq.op->get_attr<int64_t>(op_attr::axis);
+        if (axis < 0) axis += ndims;
+        if (axis >= ndims - 2) {
+            dq.mask = 1 << (axis - (ndims - 2));
+            dq.nscales = wei_dims[axis];
+        }
+    } else if (qtype == "per_group") {
+        const auto &group_shape = dq.op->get_attr<std::vector<int64_t>>(
+                op_attr::group_shape);
+        VCHECK_SDP_DECOMP(group_shape.size() == 4 && group_shape[0] == 1
+                        && group_shape[1] == 1,
+                false, "Only supports groups in the last two dims");
+        dq.mask = 3;
+        dq.groups = {group_shape[2], group_shape[3]};
+        dq.nscales = (wei_dims[2] / group_shape[2])
+                * (wei_dims[3] / group_shape[3]);
+    }
+    // The reorder dequantizes int4 data with per-channel or grouped scales
+    // only.
+    VCHECK_SDP_DECOMP(!impl::utils::one_of(wei.data_type(), data_type::s4,
+                              data_type::u4)
+                    || dq.mask != 0,
+            false, "Not support per-tensor scales of int4 key or value");
+
+    const ltw scale(inputs[scale_port]);
+    dq.scale_dt = static_cast<memory::data_type>(scale.data_type());
+    VCHECK_SDP_DECOMP(init_head_strides(scale, dq.scale_batch_stride,
+                              dq.scale_head_stride),
+            false, "Scales of a head should be dense");
+    dq.with_zp = zp_port != -1;
+    if (dq.with_zp) {
+        const ltw zp(inputs[zp_port]);
+        dq.zp_dt = static_cast<memory::data_type>(zp.data_type());
+        VCHECK_SDP_DECOMP(
+                init_head_strides(zp, dq.zp_batch_stride, dq.zp_head_stride),
+                false, "Zero points of a head should be dense");
+    }
+    dq.enabled = true;
+    return true;
+}
+
+void sdp_decomp_config_t::set_kv_dequant_attr(
+        const kv_dequant_t &dq, primitive_attr &attr) const {
+    if (!dq.enabled) return;
+    attr.set_scales(DNNL_ARG_SRC, dq.mask, dq.groups, dq.scale_dt);
+    if (dq.with_zp)
+        attr.set_zero_points(DNNL_ARG_SRC, dq.mask, dq.groups, dq.zp_dt);
+}
+
+void sdp_decomp_config_t::add_kv_dequant_args(const kv_dequant_t &dq,
+        std::unordered_map<int, memory> &args, memory &scale, memory &zp,
+        const dnnl::engine &p_engine) const {
+    if (!dq.enabled) return;
+    // The buffers are set to the scales and zero points of a head at
+    // execution.
+    scale = memory(memory::desc({dq.nscales}, dq.scale_dt, format_tag::x),
+            p_engine, nullptr);
+    args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, scale});
+    if (dq.with_zp) {
+        zp = memory(memory::desc({dq.nscales}, dq.zp_dt, format_tag::x),
+                p_engine, nullptr);
+        args.insert({DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC, zp});
+    }
+}
+
+impl::status_t sdp_decomp_config_t::detach_kv_dequant(
+        std::shared_ptr<subgraph_t> &sg) {
+    subgraph_rewriter_t rewriter(sg);
+    for (auto *dq : {&wei1_dequant, &wei2_dequant}) {
+        if (!dq->enabled) continue;
+        // The dequantized key or value becomes an input of the subgraph, so
+        // the passes see a floating-point SDPA.
+        const auto &op = dq->op;
+        for (size_t i = 0; i < op->num_inputs(); ++i)
+            op->get_input_value(i)->remove_consumer(*op, i);
+        op->get_output_value(0)->reset_producer();
+        rewriter.to_remove(op);
+    }
+    rewriter.run();
     return status::success;
 }
 
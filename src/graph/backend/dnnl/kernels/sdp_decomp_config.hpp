@@ -92,8 +92,24 @@ public:
     // Thread nums during the workflow
     int nthr;
 
+    // The number of query heads computed by a work item, either 1 or all the
+    // query heads of a kv head. The heads of a group are batched in the
+    // matmuls and share one copy of the key and value.
+    dim_t kv_group = 1;
+    // The number of chunks of the kv sequence computed by different work
+    // items, and their length. Every chunk gives a partial output and the
+    // log-sum-exp of its scores, which are merged into the output at the
+    // end. The last chunk is aligned to the end of the sequence and the
+    // scores of the tokens it shares with the previous chunk are masked.
+    dim_t kv_split = 1, kv_chunk = 0;
+    // The shortest chunk the kv sequence is split into.
+    static constexpr dim_t kv_split_min_len = 128;
+    // A row of scores that is masked out entirely gives zeros.
+    bool softmax_inf_as_zero = false;
+
     // Used to record the exact input offset in subgraph
-    // [mm1_src,mm1_wei,mm2_wei,mm1_scale,mm1_soft_capping,mm1_add,select_condition,select_other_input]
+    // [mm1_src,mm1_wei,mm2_wei,mm1_scale,mm1_soft_capping,mm1_add,select_condition,select_other_input,
+    //  wei1_scale,wei1_zp,wei2_scale,wei2_zp]
     std::vector<int> graph_inport;
     enum input_index_t {
         mm1_src = 0,
@@ -103,8 +119,34 @@ public:
         mm1_soft_capping,
         mm1_add,
         select_condition,
-        select_other_input
+        select_other_input,
+        wei1_scale,
+        wei1_zp,
+        wei2_scale,
+        wei2_zp
+    };
+
+    // Dequantization of a compressed key or value. The int8 or int4 weights
+    // of a head are dequantized by the reorder that copies them for the
+    // matmul, with the scales and zero points of the head passed as the
+    // source scales and zero points of the reorder.
+    struct kv_dequant_t {
+        bool enabled = false;
+        bool with_zp = false;
+        op_ptr op;
+        // The mask and the groups of the scales and zero points of a head.
+        int mask = 0;
+        dims groups;
+        // The number of scales of a head.
+        dim_t nscales = 1;
+        memory::data_type scale_dt = memory::data_type::undef;
+        memory::data_type zp_dt = memory::data_type::undef;
+        // The offsets of the scales and zero points of a head, in elements,
+        // are `bo * batch_stride + head * head_stride`.
+        dim_t scale_batch_stride = 0, scale_head_stride = 0;
+        dim_t zp_batch_stride = 0, zp_head_stride = 0;
     };
+    kv_dequant_t wei1_dequant, wei2_dequant;
 
     // Primitives that actually perform calculations
     primitive sub_mm1_prim, sub_softmax_prim, sub_mm2_prim, sub_select_prim;
@@ -123,7 +165,7 @@ public:
     // reorder0
     memory sub_src1;
     // reorder1
-    memory sub_wei1_user, sub_wei1_zp;
+    memory sub_wei1_user, sub_wei1_zp, sub_wei1_dq_scale, sub_wei1_dq_zp;
     //mm1
     memory sub_mm1_src, sub_mm1_wei, sub_mm1_dst;
     // sub_mm1_post_mem contains [post_scale, attn_mask(optional)]
@@ -133,7 +175,7 @@ public:
     //softmax
     memory sub_softmax_dst;
     //reorder2
-    memory sub_wei2_user, sub_wei2_zp;
+    memory sub_wei2_user, sub_wei2_zp, sub_wei2_dq_scale, sub_wei2_dq_zp;
     //mm2
     memory sub_mm2_wei, sub_mm2_dst;
     //reorder3
@@ -165,7 +207,11 @@ public:
     // If no, return unimplemented status directly and fallback to large kernel
     bool initial_check(const std::shared_ptr<subgraph_t> &sg,
             const std::vector<logical_tensor_t> &inputs,
-            const std::vector<logical_tensor_t> &outputs);
+            const std::vector<logical_tensor_t> &outputs, bool quantized);
+
+    // The size in bytes of the partial outputs and log-sum-exps of all the
+    // kv chunks, shared by the threads.
+    size_t get_kv_split_size() const;
 
     // Used to construct all params that SDP need
     template <bool quantized = false,
@@ -175,12 +221,27 @@ public:
             const std::vector<logical_tensor_t> &inputs);
     impl::status_t reset_engine(const dnnl::engine &p_engine);
 
+    // Removes the dequantization of the compressed key and value from the
+    // subgraph. The dequantization is done by the reorders of the weights.
+    impl::status_t detach_kv_dequant(std::shared_ptr<subgraph_t> &sg);
+
 private:
     op_ptr get_post_op(const op_ptr &op) const;
 
     impl::status_t record_input_offset(const std::shared_ptr<subgraph_t> &sg,
             const std::vector<logical_tensor_t> &inputs);
 
+    bool init_kv_dequant(kv_dequant_t &dq,
+            const std::vector<logical_tensor_t> &inputs, int wei_port,
+            int scale_port, int zp_port) const;
+
+    void set_kv_dequant_attr(
+            const kv_dequant_t &dq, primitive_attr &attr) const;
+
+    void add_kv_dequant_args(const kv_dequant_t &dq,
+            std::unordered_map<int, memory> &args, memory &scale, memory &zp,
+            const dnnl::engine &p_engine) const;
+
     impl::status_t record_sdp_ops(
             std::shared_ptr<subgraph_t> &sg, bool is_quantize);
 
@@ -162,7 +162,7 @@ status_t sdp_primitive_kernel_t<quantized>::execute_impl(
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     prepare_args_set(res, inputs, outputs, scratchpad);
 
     for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
@@ -194,7 +194,7 @@ status_t sdp_primitive_kernel_t<quantized>::sycl_execute_impl(
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     prepare_args_set(res, inputs, outputs, scratchpad);
 
     for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
@@ -228,7 +228,7 @@ status_t sdp_primitive_kernel_t<quantized>::ocl_execute_impl(
 
     temporary_scratchpad_t scratchpad(
             memory_planner_.total_internal_temporary_size(), p_engine_,
-            *g_alloc_);
+            *g_alloc_, g_stream);
     prepare_args_set(res, inputs, outputs, scratchpad);
 
     for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
@@ -94,6 +94,9 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(softmax_fwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(softmax_fwd_t)
 };
 
@@ -153,6 +156,9 @@ public:
     }
 
     DEF_KERNEL_METHOD_STR(softmax_bwd_t)
+    size_t get_temporary_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
     DNNL_DISALLOW_COPY_AND_ASSIGN(softmax_bwd_t)
 };
 #endif
@@ -865,7 +865,9 @@ status_t layout_propagator_for_layernorm(op_ptr &op,
     VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
             "failed to fill layout info for reorder after layernorm dst");
 
-    if (op->num_outputs() > 2) {
+    const bool with_dynamic_quant = op->has_attr(op_attr::with_dynamic_quant)
+            && op->get_attr<bool>(op_attr::with_dynamic_quant);
+    if (op->num_outputs() > static_cast<size_t>(2 + with_dynamic_quant)) {
         // keep_stats is true
         value_ptr mean = op->get_output_value(1);
         value_ptr variance = op->get_output_value(2);
@@ -877,6 +879,16 @@ status_t layout_propagator_for_layernorm(op_ptr &op,
                 "failed to fill layout info for layernorm variance");
     }
 
+    if (with_dynamic_quant) {
+        // the computed scales are the output before scratchpad
+        value_ptr scales = op->get_output_value(op->num_outputs() - 2);
+        status = fill_layout_info(scales,
+                to_ncx_format(
+                        make_dnnl_memory_desc(scales->get_logical_tensor())));
+        VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+                "failed to fill layout info for layernorm scales");
+    }
+
     // scratchpad is layernorm's last output
     value_ptr scratchpad_val = op->get_output_values().back();
     status = fill_layout_info(scratchpad_val, pd.scratchpad_desc());
@@ -13,6 +13,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  *******************************************************************************/
+#include <algorithm>
+#include <cmath>
 #include <map>
 #include <memory>
 #include <string>
@@ -146,8 +148,20 @@ conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
             }
         }
         if (!is_format(dst, "nxc") && !permute_nxc_dst) {
+            const auto given_src = src;
             src = to_format_any(src);
             dst = to_format_any(dst);
+            // Blocked layouts may also be enabled on CPU, where they are
+            // only used if they pay for the reorders around them.
+            if (p_engine.get_kind() == dnnl::engine::kind::cpu) {
+                const auto plain_src = to_nxc_format(src);
+                const auto plain_dst = to_nxc_format(dst);
+                if (!prefer_blocked_layout(create_pd(src, dst),
+                            create_pd(plain_src, plain_dst), given_src)) {
+                    src = plain_src;
+                    dst = plain_dst;
+                }
+            }
         } else {
             auto tmp_src = to_format_any(src);
             auto tmp_dst = to_format_any(dst);
@@ -344,11 +358,23 @@ matmul_executable_t::desc_t matmul_executable_t::create_desc(
         prm_attr = make_dnnl_primitive_attr(op, fusion_info);
     }
     prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
-    prm_attr.set_fpmath_mode(
-            static_cast<dnnl::fpmath_mode>(fpmath.mode_), fpmath.apply_to_int_);
 
     auto src = make_dnnl_memory_desc(
             op->get_input_value(0)->get_logical_tensor());
+    // Integer weights with a floating-point source come from a dynamic
+    // dequantize fused to the matmul, whose f32 semantics is kept by
+    // decompressing the weights in the primitive.
+    const bool wei_decomp = impl::utils::one_of(src.get_data_type(),
+                                    dnnl::memory::data_type::f32,
+                                    dnnl::memory::data_type::bf16,
+                                    dnnl::memory::data_type::f16)
+            && impl::utils::one_of(op->get_input_value(1)
+                                           ->get_logical_tensor()
+                                           .data_type,
+                    graph::data_type::s4, graph::data_type::u4,
+                    graph::data_type::s8, graph::data_type::u8);
+    prm_attr.set_fpmath_mode(static_cast<dnnl::fpmath_mode>(fpmath.mode_),
+            fpmath.apply_to_int_ || wei_decomp);
     // For non-constant activation and weight, create primitive desc with
     // strided layout
     bool const_activation
@@ -731,6 +757,15 @@ layernorm_executable_t::desc_t layernorm_executable_t::create_desc(
     auto dst = make_dnnl_memory_desc(
             op->get_output_value(0)->get_logical_tensor());
     dst = to_format_any(dst);
+
+    // The primitive computes a destination scale for every row.
+    if (op->has_attr(op_attr::with_dynamic_quant)
+            && op->get_attr<bool>(op_attr::with_dynamic_quant)) {
+        const int row_mask = (1 << (src.get_ndims() - 1)) - 1;
+        prm_attr.set_scales_mask(DNNL_ARG_DST, row_mask);
+        prm_attr.set_dynamic_quantization(true);
+    }
+
     dnnl::layer_normalization_forward::primitive_desc pd(
             p_engine, pkind, src, dst, epsilon, flags, prm_attr);
 
@@ -738,6 +773,81 @@ layernorm_executable_t::desc_t layernorm_executable_t::create_desc(
     return {pd, false};
 }
 
+void layernorm_executable_t::create_plain_prim(
+        const dnnl::layer_normalization_forward::primitive_desc &pd) {
+    const memory::desc dst_md = pd.dst_desc();
+    plain_dst_md_ = memory::desc(
+            dst_md.get_dims(), memory::data_type::f32, dst_md.get_strides());
+    dnnl::primitive_attr attr;
+    attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    dnnl::layer_normalization_forward::primitive_desc plain_pd(
+            pd.get_engine(), pd.get_prop_kind(), pd.src_desc(), plain_dst_md_,
+            pd.get_epsilon(), pd.get_flags(), attr);
+    plain_prim_ = dnnl::layer_normalization_forward(plain_pd);
+}
+
+bool layernorm_executable_t::divisor_is_qmax(
+        const std::unordered_map<int, memory> &args) const {
+    const memory &divisor = args.at(DNNL_GRAPH_ARG_QUANT_DIVISOR);
+    return *static_cast<const float *>(divisor.get_data_handle()) == 127.f;
+}
+
+void layernorm_executable_t::execute_with_divisor(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const memory &dst = args.at(DNNL_ARG_DST);
+    const memory &scales = args.at(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
+    const float divisor = *static_cast<const float *>(
+            args.at(DNNL_GRAPH_ARG_QUANT_DIVISOR).get_data_handle());
+
+    // The scratchpad of the primitive with dynamic quantization is large
+    // enough for the plain one.
+    std::vector<float> buf(plain_dst_md_.get_size() / sizeof(float));
+    std::unordered_map<int, memory> plain_args = args;
+    plain_args.erase(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
+    plain_args[DNNL_ARG_DST]
+            = memory(plain_dst_md_, stream.get_engine(), buf.data());
+    plain_prim_.execute(stream, plain_args);
+    stream.get()->wait();
+
+    const auto dims = plain_dst_md_.get_dims();
+    const auto src_strides = plain_dst_md_.get_strides();
+    const auto dst_strides = dst.get_desc().get_strides();
+    const int ndims = static_cast<int>(dims.size());
+    const dim_t C = dims[ndims - 1];
+    dim_t N = 1;
+    for (int d = 0; d < ndims - 1; d++)
+        N *= dims[d];
+    auto *dst_ptr = static_cast<int8_t *>(dst.get_data_handle());
+    auto *scales_ptr = static_cast<float *>(scales.get_data_handle());
+
+    stream.get()->before_exec_hook();
+    dnnl::impl::parallel_nd(N, [&](dim_t n) {
+        // The first elements of the row in the f32 data and the destination.
+        const float *src_row = buf.data();
+        int8_t *dst_row = dst_ptr;
+        dim_t r = n;
+        for (int d = ndims - 2; d >= 0; d--) {
+            src_row += (r % dims[d]) * src_strides[d];
+            dst_row += (r % dims[d]) * dst_strides[d];
+            r /= dims[d];
+        }
+        const dim_t src_c_stride = src_strides[ndims - 1];
+        const dim_t dst_c_stride = dst_strides[ndims - 1];
+
+        float amax = 0.f;
+        for (dim_t c = 0; c < C; c++)
+            amax = std::max(amax, std::fabs(src_row[c * src_c_stride]));
+        const float scale = amax > 0.f ? amax / divisor : 1.f;
+        scales_ptr[n] = scale;
+        for (dim_t c = 0; c < C; c++) {
+            const float q = std::nearbyint(src_row[c * src_c_stride] / scale);
+            dst_row[c * dst_c_stride] = static_cast<int8_t>(
+                    std::min(std::max(q, -128.f), 127.f));
+        }
+    });
+    stream.get()->after_exec_hook();
+}
+
 layernorm_bwd_executable_t::desc_t layernorm_bwd_executable_t::create_desc(
         std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
         pd_cache_t &pd_cache, const fpmath_t &fpmath, bool use_block_layout) {
@@ -1067,6 +1177,13 @@ concat_executable_t::desc_t concat_executable_t::create_desc(
             op->get_output_value(0)->get_logical_tensor());
     auto dst = memory::desc {tmp_desc.get_dims(), tmp_desc.get_data_type(),
             get_forced_format_tag(tmp_desc.get_dims())};
+    // Keep the given layouts of an append, so the output can share the
+    // buffer of the first input without reorders around the concat.
+    if (is_append(op.get())) {
+        src_mds[0] = make_dnnl_memory_desc(
+                op->get_input_value(0)->get_logical_tensor());
+        dst = tmp_desc;
+    }
 
     dnnl::concat::primitive_desc pd(
             p_engine, dst, static_cast<int>(axis), src_mds, prm_attr);
@@ -1075,6 +1192,56 @@ concat_executable_t::desc_t concat_executable_t::create_desc(
     return {pd, false};
 }
 
+bool concat_executable_t::is_append(const op_t *op) {
+    if (op->num_inputs() < 2 || op->has_attr(op_attr::fusion_info))
+        return false;
+
+    using ltw = logical_tensor_wrapper_t;
+    const ltw in0(op->get_input_value(0)->get_logical_tensor());
+    const ltw out(op->get_output_value(0)->get_logical_tensor());
+    if (!in0.is_strided() || !out.is_strided() || in0.ndims() <= 0
+            || in0.ndims() != out.ndims()
+            || in0.data_type() != out.data_type()
+            || in0.vstrides() != out.vstrides())
+        return false;
+
+    const auto res = utils::try_reverse_axis(
+            op->get_attr<int64_t>(op_attr::axis), out.ndims());
+    if (!res.first) return false;
+    const auto in0_dims = in0.vdims();
+    const auto out_dims = out.vdims();
+    for (int32_t d = 0; d < out.ndims(); d++) {
+        if (d == res.second ? in0_dims[d] >= out_dims[d]
+                            : in0_dims[d] != out_dims[d])
+            return false;
+    }
+    return true;
+}
+
+void concat_executable_t::create_append_prim(const std::shared_ptr<op_t> &op,
+        const dnnl::concat::primitive_desc &pd, const dnnl::engine &p_engine) {
+    const auto rank = op->get_output_value(0)->get_logical_tensor().ndims;
+    const auto axis = utils::try_reverse_axis(
+            op->get_attr<int64_t>(op_attr::axis), rank)
+                              .second;
+
+    // The rest of the output starts after the first input along the axis.
+    const auto dst_md = pd.dst_desc();
+    memory::dims dims = dst_md.get_dims();
+    memory::dims offsets(dims.size(), 0);
+    offsets[axis] = pd.src_desc(0).get_dims()[axis];
+    dims[axis] -= offsets[axis];
+    append_dst_md_ = dst_md.submemory_desc(dims, offsets);
+
+    num_srcs_ = static_cast<int>(op->num_inputs());
+    std::vector<memory::desc> src_mds;
+    for (int i = 1; i < num_srcs_; i++)
+        src_mds.emplace_back(pd.src_desc(i));
+    dnnl::concat::primitive_desc append_pd(
+            p_engine, append_dst_md_, static_cast<int>(axis), src_mds);
+    append_prim_ = dnnl::concat(append_pd);
+}
+
 resampling_executable_t::desc_t resampling_executable_t::create_desc(
         std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
         pd_cache_t &pd_cache, const fpmath_t &fpmath, bool use_block_layout) {
@@ -2210,6 +2377,13 @@ static arg_indices_t get_arg_indices_for_lnorm_and_gnorm(const op_t *op) {
                 indices_t {input, in_index++}});
     }
 
+    const bool with_dynamic_quant = op->has_attr(op_attr::with_dynamic_quant)
+            && op->get_attr<bool>(op_attr::with_dynamic_quant);
+    if (with_dynamic_quant) {
+        arg_indices.insert(
+                {DNNL_GRAPH_ARG_QUANT_DIVISOR, indices_t {input, in_index++}});
+    }
+
     size_t out_index = 0;
     arg_indices.insert({DNNL_ARG_DST, indices_t {output, out_index++}});
     if (!op->has_attr(op_attr::keep_stats)
@@ -2219,6 +2393,11 @@ static arg_indices_t get_arg_indices_for_lnorm_and_gnorm(const op_t *op) {
                 {DNNL_ARG_VARIANCE, indices_t {output, out_index++}});
     }
 
+    if (with_dynamic_quant) {
+        arg_indices.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST,
+                indices_t {output, out_index++}});
+    }
+
     arg_indices.insert({DNNL_ARG_SCRATCHPAD, indices_t {output, out_index++}});
 
     return arg_indices;
@@ -1211,7 +1211,17 @@ private:
 struct concat_executable_t : public op_executable_t {
     DECLARE_DESC_CLASS_AND_CREATOR(dnnl::concat::primitive_desc);
     DECLARE_ARG_INDICES_GETTER;
-    DECLARE_RESET_ENGINE(dnnl::concat);
+
+    status_t reset_engine(const dnnl::engine &p_engine) override {
+        for (auto *p : {&prim_, &append_prim_}) {
+            if (!*p) continue;
+            const auto desc_t = p->get_primitive_desc()->impl();
+            dnnl_primitive_desc new_pd_t(desc_t, p_engine.get());
+            dnnl::concat::primitive_desc new_pd(&new_pd_t);
+            *p = dnnl::concat(new_pd);
+        }
+        return status::success;
+    }
 
     concat_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
             pd_cache_t &pd_cache, const fpmath_t &fpmath,
@@ -1219,11 +1229,34 @@ struct concat_executable_t : public op_executable_t {
         auto desc
                 = create_desc(op, p_engine, pd_cache, fpmath, use_block_layout);
         prim_ = dnnl::concat(desc);
+        if (is_append(op.get())) create_append_prim(op, desc, p_engine);
     }
 
+    // Checks if the first input of the concat is the leading part of the
+    // output, i.e. both are strided with the same strides, e.g. a KV cache
+    // allocated with a larger capacity along the concat axis. Then the
+    // output can share the buffer of the first input, and only the other
+    // inputs are copied when it does.
+    static bool is_append(const op_t *op);
+
     void execute(const stream &stream,
             const std::unordered_map<int, memory> &args) const override {
-        prim_.execute(stream, args);
+        if (!append_prim_
+                || args.at(DNNL_ARG_MULTIPLE_SRC).get_data_handle()
+                        != args.at(DNNL_ARG_DST).get_data_handle()) {
+            prim_.execute(stream, args);
+            return;
+        }
+
+        std::unordered_map<int, memory> append_args;
+        for (int i = 1; i < num_srcs_; i++)
+            append_args.insert({DNNL_ARG_MULTIPLE_SRC + i - 1,
+                    args.at(DNNL_ARG_MULTIPLE_SRC + i)});
+        const auto &dst = args.at(DNNL_ARG_DST);
+        append_args.insert({DNNL_ARG_DST,
+                memory(append_dst_md_, dst.get_engine(),
+                        dst.get_data_handle())});
+        append_prim_.execute(stream, append_args);
     }
 
 #ifdef DNNL_WITH_SYCL
@@ -1246,7 +1279,16 @@ struct concat_executable_t : public op_executable_t {
 #endif
 
 private:
+    void create_append_prim(const std::shared_ptr<op_t> &op,
+            const dnnl::concat::primitive_desc &pd,
+            const dnnl::engine &p_engine);
+
     dnnl::concat prim_;
+    // The concat of the inputs after the first one into the rest of the
+    // output, which is used when the output shares the first input's buffer.
+    dnnl::concat append_prim_;
+    memory::desc append_dst_md_;
+    int num_srcs_ = 0;
 };
 
 struct shuffle_executable_t : public op_executable_t {
@@ -2410,7 +2452,18 @@ struct layernorm_executable_t : public op_executable_t {
     DECLARE_DESC_CLASS_AND_CREATOR(
             dnnl::layer_normalization_forward::primitive_desc);
     DECLARE_ARG_INDICES_GETTER;
-    DECLARE_RESET_ENGINE(dnnl::layer_normalization_forward);
+
+    status_t reset_engine(const dnnl::engine &p_engine) override {
+        for (auto *p : {&prim_, &plain_prim_}) {
+            if (!*p) continue;
+            const auto desc_t = p->get_primitive_desc()->impl();
+            dnnl_primitive_desc new_pd_t(desc_t, p_engine.get());
+            dnnl::layer_normalization_forward::primitive_desc new_pd(
+                    &new_pd_t);
+            *p = dnnl::layer_normalization_forward(new_pd);
+        }
+        return status::success;
+    }
 
     layernorm_executable_t(std::shared_ptr<op_t> &op,
             const dnnl::engine &p_engine, pd_cache_t &pd_cache,
@@ -2418,10 +2471,17 @@ struct layernorm_executable_t : public op_executable_t {
         auto desc
                 = create_desc(op, p_engine, pd_cache, fpmath, use_block_layout);
         prim_ = dnnl::layer_normalization_forward(desc);
+        if (op->has_attr(op_attr::with_dynamic_quant)
+                && op->get_attr<bool>(op_attr::with_dynamic_quant))
+            create_plain_prim(desc);
     }
 
     void execute(const stream &stream,
             const std::unordered_map<int, memory> &args) const override {
+        if (plain_prim_ && !divisor_is_qmax(args)) {
+            execute_with_divisor(stream, args);
+            return;
+        }
         prim_.execute(stream, args);
     }
 
@@ -2445,7 +2505,19 @@ struct layernorm_executable_t : public op_executable_t {
 #endif
 
 private:
+    // With dynamic quantization, the primitive maps the largest absolute
+    // value of a row to the largest int8 value. Other divisors of the scales
+    // are applied on the host to the output of a primitive with an f32
+    // destination.
+    void create_plain_prim(
+            const dnnl::layer_normalization_forward::primitive_desc &pd);
+    bool divisor_is_qmax(const std::unordered_map<int, memory> &args) const;
+    void execute_with_divisor(const stream &stream,
+            const std::unordered_map<int, memory> &args) const;
+
     dnnl::layer_normalization_forward prim_;
+    dnnl::layer_normalization_forward plain_prim_;
+    memory::desc plain_dst_md_;
 };
 
 struct layernorm_bwd_executable_t : public op_executable_t {
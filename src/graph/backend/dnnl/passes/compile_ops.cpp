@@ -14,10 +14,13 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <exception>
 #include <memory>
 #include <vector>
 #include <unordered_map>
 
+#include "common/dnnl_thread.hpp"
+
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/value.hpp"
 
@@ -35,6 +38,38 @@ namespace dnnl {
 namespace impl {
 namespace graph {
 namespace dnnl_impl {
+// Creates the executable of an op, which creates its primitive. The given pd
+// cache may hold the primitive descriptor of this op only, so that the
+// executables of different ops can be created concurrently.
+static status_t create_executable(op_t *op, const dnnl::engine &p_engine,
+        pd_cache_t &pd_cache, const fpmath_t &fpm, bool use_block_layout,
+        std::shared_ptr<op_executable_t> &exec) {
+    const op_schema_t *opm
+            = op_schema_registry_t::get_op_schema(op->get_kind());
+
+    VCHECK_COMPILE_OPS(opm != nullptr, status::invalid_graph_op,
+            "no schema for current op %s", op->get_name().c_str());
+
+    VCHECK_COMPILE_OPS(opm->has_additional_item("executable_creator"),
+            status::invalid_graph_op,
+            "no executable creator in schema of op %s", op->get_name().c_str());
+
+    auto cur_op = op->shared_from_this();
+    auto creator = opm->get_additional_item<executable_creator_func>(
+            "executable_creator");
+
+    exec = creator(cur_op, p_engine, pd_cache, fpm, use_block_layout);
+    VCHECK_COMPILE_OPS(exec != nullptr, status::invalid_graph_op,
+            "unimplemented op, can't compile op %s", op->get_name().c_str());
+    if (cur_op->get_kind() == op_kind::dnnl_sdpa) {
+        auto sdpa_exec = std::dynamic_pointer_cast<sdpa_executable_t>(exec);
+        VCHECK_COMPILE_OPS(sdpa_exec->is_initialized(), status::unimplemented,
+                "failed to create executable for op %s",
+                op->get_name().c_str());
+    }
+    return status::success;
+}
+
 /// After the lower down, infer shape, infer type and layout propagation passes,
 /// each op in the subgraph will has complete attributes and each edge will have
 /// complete shape/dtype/layout information. We can create executable for these
@@ -45,40 +80,43 @@ status_t compile_ops(std::shared_ptr<subgraph_t> &sg) {
     auto &fpm = sg->get_fpmath_mode();
     bool use_block_layout = sg->can_use_blocked_layout_;
 
-    return topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
-        const op_schema_t *opm
-                = op_schema_registry_t::get_op_schema(op->get_kind());
-
-        VCHECK_COMPILE_OPS(opm != nullptr, status::invalid_graph_op,
-                "no schema for current op %s", op->get_name().c_str());
-
-        VCHECK_COMPILE_OPS(opm->has_additional_item("executable_creator"),
-                status::invalid_graph_op,
-                "no executable creator in schema of op %s",
-                op->get_name().c_str());
+    std::vector<op_t *> ops;
+    CHECK(topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+        ops.push_back(op);
+        return status::success;
+    }));
 
-        auto cur_op = op->shared_from_this();
-        auto creator = opm->get_additional_item<executable_creator_func>(
-                "executable_creator");
+    // The executables are independent of each other, so the primitives of
+    // the ops, whose creation is dominated by JIT compilation, are created in
+    // parallel. Every op gets a pd cache of its own, which is merged back
+    // afterwards, and the errors are reported in the topological order.
+    const size_t nops = ops.size();
+    std::vector<std::shared_ptr<op_executable_t>> execs(nops);
+    std::vector<pd_cache_t> pd_caches(nops);
+    std::vector<status_t> statuses(nops, status::success);
+    std::vector<std::exception_ptr> exceptions(nops);
+    for (size_t i = 0; i < nops; i++) {
+        auto it = pd_cache.find(ops[i]);
+        if (it != pd_cache.end()) pd_caches[i].insert(*it);
+    }
+    parallel_nd(static_cast<dim_t>(nops), [&](dim_t i) {
+        try {
+            statuses[i] = create_executable(ops[i], p_engine, pd_caches[i],
+                    fpm, use_block_layout, execs[i]);
+        } catch (...) { exceptions[i] = std::current_exception(); }
+    });
 
-        std::shared_ptr<op_executable_t> exec
-                = creator(cur_op, p_engine, pd_cache, fpm, use_block_layout);
-        VCHECK_COMPILE_OPS(exec != nullptr, status::invalid_graph_op,
-                "unimplemented op, can't compile op %s",
-                op->get_name().c_str());
-        if (cur_op->get_kind() == op_kind::dnnl_sdpa) {
-            auto sdpa_exec = std::dynamic_pointer_cast<sdpa_executable_t>(exec);
-            VCHECK_COMPILE_OPS(sdpa_exec->is_initialized(),
-                    status::unimplemented,
-                    "failed to create executable for op %s",
-                    op->get_name().c_str());
-        }
-        sg->execs_.emplace_back(exec);
+    for (size_t i = 0; i < nops; i++) {
+        if (exceptions[i]) std::rethrow_exception(exceptions[i]);
+        CHECK(statuses[i]);
+        pd_cache.insert(pd_caches[i].begin(), pd_caches[i].end());
+        sg->execs_.emplace_back(execs[i]);
 
+        const op_t *op = ops[i];
         sg->is_constant_.push_back(op->has_attr(op_attr::is_constant)
                 && op->get_attr<bool>(op_attr::is_constant));
-        return status::success;
-    });
+    }
+    return status::success;
 }
 
 } // namespace dnnl_impl
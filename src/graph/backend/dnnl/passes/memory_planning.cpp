@@ -135,6 +135,11 @@ std::vector<op_inplace_pair_t> get_op_inplace_pairs(op_t &op) {
         const bool can_inplace
                 = make_dnnl_memory_desc(in0) == make_dnnl_memory_desc(out0);
         if (can_inplace) { pairs.emplace_back(0, 0); }
+    } else if (op.get_kind() == op_kind::dnnl_concat
+            && concat_executable_t::is_append(&op)) {
+        // the output may share the buffer of the first input, which is its
+        // leading part
+        pairs.emplace_back(0, 0);
     } else if (op.get_kind() == op_kind::dnnl_layernorm_bwd) {
         auto diff_dst = op.get_input_value(1)->get_logical_tensor();
         auto diff_src = op.get_output_value(0)->get_logical_tensor();
@@ -528,10 +533,16 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
                 assign_info_t info = buffer_assignments_.at(in);
                 if (info.kind_ != internal_temporary) continue;
 
+                // the output may be larger than the input, e.g. of an append
+                value_t *out = op->get_output_value(pair.out_idx_).get();
+                const size_t out_size
+                        = make_dnnl_memory_desc(out->get_logical_tensor())
+                                  .get_size();
                 bool reuse_in_buffer
-                        = temporary_buffer_ref_count[info.index_] == 1;
+                        = temporary_buffer_ref_count[info.index_] == 1
+                        && out_size <= temporary_buffer_assigner_.query_size(
+                                   info.index_);
                 if (reuse_in_buffer) {
-                    value_t *out = op->get_output_value(pair.out_idx_).get();
                     if (!buffer_assignments_.count(out)) {
                         buffer_assignments_.insert(std::make_pair(out, info));
                         temporary_buffer_ref_count[info.index_]
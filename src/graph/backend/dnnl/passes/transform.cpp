@@ -1021,6 +1021,129 @@ status_t fuse_post_ops(std::shared_ptr<subgraph_t> &sg) {
     return status::success;
 }
 
+status_t fuse_elementwise_chain(std::shared_ptr<subgraph_t> &sg) {
+    const auto &pops_fusible_map = get_post_ops_fusible_map();
+    const auto ekind = sg->get_engine_kind();
+
+    // check if the op will be fused as a post op into its producer by the
+    // fuse_post_ops pass, then the chain should be anchored there instead
+    const auto absorbed_by_producer = [&](const op_t *op) {
+        for (const auto &in_val : op->get_input_values()) {
+            if (!in_val->has_producer()) continue;
+            const op_t *pred = &in_val->get_producer();
+            if (in_val->get_consumers().size() != 1
+                    || !pops_fusible_map.count(pred->get_kind())
+                    || !pops_fusible_map.at(pred->get_kind())
+                                .count(op->get_kind()))
+                continue;
+            if (op->get_kind() == op_kind::dnnl_binary
+                    && post_binary_fusible(pred, op, ekind))
+                return true;
+            if (op->get_kind() == op_kind::dnnl_eltwise
+                    && post_eltwise_fusible(pred, op, ekind))
+                return true;
+        }
+        return false;
+    };
+
+    // check if the binary op with the chain value as the input at offset
+    // `offset` can be appended to the chain of the base op. The chain value is
+    // not broadcasted and the other input broadcasts to it in any dimensions.
+    const auto chain_binary_fusible = [&](const op_t *base, const op_t *bin,
+                                              size_t offset) {
+        if (bin->num_inputs() != 2 || bin->has_attr(op_attr::fusion_info))
+            return false;
+        const auto alg = static_cast<dnnl::algorithm>(
+                bin->get_attr<int64_t>(op_attr::alg_kind));
+        if (impl::utils::one_of(alg, dnnl::algorithm::binary_sub,
+                    dnnl::algorithm::binary_div)
+                && offset != 0)
+            return false;
+        // leave the int8 patterns to fuse_post_ops
+        auto other_val = bin->get_input_value(1 - offset);
+        if (other_val->has_producer()
+                && impl::utils::one_of(other_val->get_producer().get_kind(),
+                        op_kind::dnnl_mul_scales, op_kind::dnnl_sub_zps))
+            return false;
+
+        const auto base_dims
+                = ltw(base->get_output_value(0)->get_logical_tensor()).vdims();
+        const auto out_dims
+                = ltw(bin->get_output_value(0)->get_logical_tensor()).vdims();
+        const auto other_dims = ltw(other_val->get_logical_tensor()).vdims();
+        if (base_dims.empty() || out_dims != base_dims
+                || other_dims.size() != base_dims.size())
+            return false;
+        for (size_t i = 0; i < base_dims.size(); ++i) {
+            if (other_dims[i] != 1 && other_dims[i] != base_dims[i])
+                return false;
+        }
+        return true;
+    };
+
+    std::vector<std::vector<op_t *>> chains;
+    std::set<op_t *> visited;
+    status_t ret = topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+        if (op->get_kind() != op_kind::dnnl_binary || visited.count(op)
+                || op->has_attr(op_attr::fusion_info)
+                || absorbed_by_producer(op))
+            return status::success;
+
+        // collect the maximal chain of the elementwise ops, where every
+        // intermediate value is only consumed by the next op
+        std::vector<op_t *> chain {op};
+        op_t *cur = op;
+        while (true) {
+            const auto consumers = cur->get_output_value(0)->get_consumers();
+            if (consumers.size() != 1) break;
+            op_t *next = &consumers[0].get_op();
+            if (visited.count(next)) break;
+            if (next->get_kind() == op_kind::dnnl_eltwise) {
+                if (next->has_attr(op_attr::fusion_info)
+                        || !post_eltwise_fusible(op, next, ekind))
+                    break;
+            } else if (next->get_kind() == op_kind::dnnl_binary) {
+                if (!chain_binary_fusible(op, next, consumers[0].get_offset()))
+                    break;
+            } else {
+                break;
+            }
+            chain.emplace_back(next);
+            cur = next;
+        }
+        if (chain.size() < 2) return status::success;
+
+        visited.insert(chain.begin(), chain.end());
+        chains.emplace_back(std::move(chain));
+        return status::success;
+    });
+    VCHECK_TRANSFORM(ret == status::success, ret,
+            "Error finding fusible elementwise chains");
+
+    subgraph_rewriter_t rewriter(sg);
+    for (const auto &chain : chains) {
+        op_t *base_op = chain[0];
+        fusion_info_t fusion_info;
+        for (size_t i = 1; i < chain.size(); ++i) {
+            op_t *post_op = chain[i];
+            const size_t offset = base_op->get_output_value(0)
+                                          ->get_consumers()[0]
+                                          .get_offset();
+            if (post_op->get_kind() == op_kind::dnnl_eltwise) {
+                fusion_info.append_post_eltwise(post_op->shared_from_this());
+            } else {
+                fusion_info.append_post_binary(post_op->shared_from_this(),
+                        std::vector<size_t> {base_op->num_inputs()});
+            }
+            rewriter.fuse_op_to_predecessor(
+                    post_op->shared_from_this(), offset);
+        }
+        base_op->set_attr<fusion_info_t>(op_attr::fusion_info, fusion_info);
+    }
+    rewriter.run();
+    return status::success;
+}
+
 status_t sdp_fuse_post_ops(std::shared_ptr<subgraph_t> &sg) {
     // lambda function to fuse one post op into base primitive
     auto fuse_post_ops_func = [&](bool &changed) -> status_t {
@@ -2192,6 +2315,94 @@ status_t fuse_post_typecast_to_predecessor(std::shared_ptr<subgraph_t> &sg) {
     return status::success;
 }
 
+status_t fuse_dynamic_quant_to_layernorm(std::shared_ptr<subgraph_t> &sg) {
+    auto has_alg = [](const op_t &op, op_kind_t kind, dnnl::algorithm alg) {
+        return op.get_kind() == kind
+                && static_cast<dnnl::algorithm>(
+                           op.get_attr<int64_t>(op_attr::alg_kind))
+                == alg;
+    };
+    auto single_consumer = [](const value_ptr &val) -> op_t * {
+        const auto &csms = val->get_consumers();
+        if (csms.size() != 1 || csms[0].get_offset() != 0) return nullptr;
+        return &csms[0].get_op();
+    };
+
+    std::vector<std::vector<op_t *>> fusion_groups;
+    for (auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_layernorm
+                || cur_op->has_attr(op_attr::fusion_info))
+            continue;
+
+        auto dst = cur_op->get_output_value(0);
+        const auto &dst_csms = dst->get_consumers();
+        if (dst_csms.size() != 2) continue;
+
+        op_t *abs = nullptr, *quant = nullptr;
+        for (const auto &csm : dst_csms) {
+            op_t &csm_op = csm.get_op();
+            if (has_alg(csm_op, op_kind::dnnl_eltwise,
+                        dnnl::algorithm::eltwise_abs))
+                abs = &csm_op;
+            else if (csm_op.get_kind() == op_kind::dnnl_mul_scales
+                    && csm.get_offset() == 0)
+                quant = &csm_op;
+        }
+        if (!abs || !quant) continue;
+
+        op_t *rmax = single_consumer(abs->get_output_value(0));
+        if (!rmax
+                || !has_alg(*rmax, op_kind::dnnl_reduction,
+                        dnnl::algorithm::reduction_max))
+            continue;
+        op_t *div = single_consumer(rmax->get_output_value(0));
+        if (!div
+                || !has_alg(*div, op_kind::dnnl_binary,
+                        dnnl::algorithm::binary_div))
+            continue;
+
+        // The scales are inverted for mul_scales when DynamicQuantize is
+        // lowered.
+        auto quant_scales = quant->get_input_value(1);
+        if (!quant_scales->has_producer()) continue;
+        op_t &inv = quant_scales->get_producer();
+        if (!has_alg(inv, op_kind::dnnl_eltwise, dnnl::algorithm::eltwise_pow)
+                || inv.get_input_value(0) != div->get_output_value(0))
+            continue;
+
+        fusion_groups.emplace_back(std::vector<op_t *> {
+                cur_op.get(), abs, rmax, div, &inv, quant});
+    }
+
+    subgraph_rewriter_t rewriter(sg);
+    for (auto &fusion_group : fusion_groups) {
+        op_t *lnorm = fusion_group[0];
+        op_t *div = fusion_group[3];
+        op_t *inv = fusion_group[4];
+        op_t *quant = fusion_group[5];
+
+        auto divisor = div->get_input_value(1);
+        divisor->remove_consumer(*div, 1);
+        lnorm->connect_input(lnorm->num_inputs(), divisor);
+
+        // The outputs are the quantized data, the statistics if any, the
+        // scales and the scratchpad.
+        auto quant_dst = quant->get_output_value(0);
+        lnorm->connect_output(0, quant_dst);
+        auto scales = div->get_output_value(0);
+        scales->remove_consumer(*inv, 0);
+        auto scratchpad = lnorm->get_output_values().back();
+        lnorm->connect_output(lnorm->num_outputs() - 1, scales);
+        lnorm->add_output(scratchpad);
+        lnorm->set_attr<bool>(op_attr::with_dynamic_quant, true);
+
+        for (size_t i = 1; i < fusion_group.size(); i++)
+            rewriter.to_remove(fusion_group[i]->shared_from_this());
+    }
+    rewriter.run();
+    return status::success;
+}
+
 status_t fuse_reciprocal_mul_to_div(std::shared_ptr<subgraph_t> &sg) {
     /* transformation below graphs
     Case 1:
@@ -48,6 +48,13 @@ status_t replace_quant_data_with_binary_post_op(
 
 status_t fuse_post_ops(std::shared_ptr<subgraph_t> &sg);
 
+// This pass collapses the maximal chains of elementwise ops that start with a
+// binary op into the binary op with a chain of post ops, so the chain is
+// executed by one primitive. Comparing with fuse_post_ops, the other inputs of
+// the binary post ops can be broadcasted in any dimensions, and a whole chain
+// is fused at once. It is expected to run before fuse_post_ops.
+status_t fuse_elementwise_chain(std::shared_ptr<subgraph_t> &sg);
+
 // This pass is only used in the sdpa decompose kernel and handle matmul post
 // op. There is no any limit for matmul+post_binary about dims broadcast like
 // full tensor and per tensor broadcast. Because the implementation of sdpa
@@ -108,6 +115,29 @@ status_t fuse_typecast_to_add(std::shared_ptr<subgraph_t> &sg);
 ///          |
 status_t fuse_post_typecast_to_predecessor(std::shared_ptr<subgraph_t> &sg);
 
+/// This pass fuses the per-row dynamic quantization of a layernorm output
+/// into the layernorm. The scales are computed by abs, reduce max and a
+/// division, and the layernorm computes them itself, one per row, with the
+/// dynamic quantization primitive attribute. The divisor becomes an input of
+/// the layernorm and the scales an output after the statistics.
+///
+///       layernorm            divisor
+///        /      \               |
+///      abs       |   -->    layernorm
+///       |        |           |      |
+///   reduce max   |       (int8)   scales
+///       |        |
+///    divide      |
+///      |         |
+///  reciprocal    |
+///       \       /
+///      mul_scales
+///          |
+///       (int8)
+///
+/// It is expected to run right after lowering.
+status_t fuse_dynamic_quant_to_layernorm(std::shared_ptr<subgraph_t> &sg);
+
 status_t batchnorm_bwd_canonicalization(std::shared_ptr<subgraph_t> &sg);
 
 /// translate the subgraph containing chain of Adds into dnnl_sum
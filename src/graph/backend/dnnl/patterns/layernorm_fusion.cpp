@@ -31,6 +31,28 @@ using in_edges_t = pm::in_edges_t;
 using pb_graph_t = pm::pb_graph_t;
 using FCreatePattern = graph::pass::FCreatePattern;
 
+namespace {
+// The scales of a per-token dynamic quantization are reduced over the last
+// axis, i.e. the normalized one.
+bool check_reduce_last_axis(op_t *graph_op) {
+    if (!graph_op->has_attr(op_attr::axes)) return false;
+    const auto &axes = graph_op->get_attr<std::vector<int64_t>>(op_attr::axes);
+    return axes.size() == 1 && (axes[0] == -1 || axes[0] == 1);
+}
+
+bool check_scalar_divisor(op_t *graph_op) {
+    const logical_tensor_t &lt
+            = graph_op->get_input_value(1)->get_logical_tensor();
+    return logical_tensor_wrapper_t(lt).nelems() == 1;
+}
+
+bool check_per_token_quant(op_t *graph_op) {
+    return graph_op->num_inputs() == 2
+            && graph_op->get_attr<std::string>(op_attr::qtype) == "per_channel"
+            && graph_op->get_attr<int64_t>(op_attr::axis) == 0;
+}
+} // namespace
+
 //             LayerNorm
 //                 |
 //            [TypeCast]*
@@ -91,6 +113,67 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, layernorm_post_ops_fusion_cpu)
             return std::make_shared<layer_norm_fwd_t>();
         });
 #endif
+
+//             LayerNorm
+//             |       |
+//            Abs      |
+//             |       |
+//         ReduceMax   |
+//             |       |
+//          Divide     |
+//             |\      |
+//             | DynamicQuantize
+//             |       |
+//          (scales) (int8)
+//
+// The per-token dynamic quantization of a 2D layernorm output, whose scales
+// are the largest absolute value of a row divided by a scalar, is computed
+// by the layernorm right after a row is normalized. The divisor is read on
+// the host when the partition is executed.
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
+        dnnl, layernorm_dynamic_quant_fusion_cpu)
+        .set_priority(8.3f)
+        .set_kind(graph::partition_kind_t::misc_quantized_post_ops)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *layernorm
+                            = pgraph->append_op(graph::op_kind::LayerNorm);
+                    layernorm->append_decision_function(
+                            check_input_dtype_from_offset<impl::data_type::f32,
+                                    1>);
+                    layernorm->append_decision_function(
+                            check_begin_norm_axis_attr);
+                    layernorm->append_decision_function(
+                            check_input_ndim_from_offset<0, 2, 2>);
+
+                    pm::pb_op_t *pabs = pgraph->append_op(graph::op_kind::Abs,
+                            in_edges_t {in_edge(0, layernorm, 0)});
+                    pm::pb_op_t *preduce
+                            = pgraph->append_op(graph::op_kind::ReduceMax,
+                                    in_edges_t {in_edge(0, pabs, 0)});
+                    preduce->append_decision_function(check_reduce_last_axis);
+                    pm::pb_op_t *pdiv
+                            = pgraph->append_op(graph::op_kind::Divide,
+                                    in_edges_t {in_edge(0, preduce, 0)});
+                    pdiv->append_decision_function(check_scalar_divisor);
+                    // The scales are an output of the partition as well.
+                    pdiv->allow_external_outputs();
+
+                    pm::pb_op_t *pquant = pgraph->append_op(
+                            graph::op_kind::DynamicQuantize,
+                            in_edges_t {in_edge(0, layernorm, 0),
+                                    in_edge(1, pdiv, 0)});
+                    pquant->append_decision_function(check_per_token_quant);
+                    pquant->append_decision_function(
+                            check_output_dtype<impl::data_type::s8>);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<layer_norm_fwd_t>();
+        });
+#endif
 DNNL_BACKEND_REGISTER_PATTERN_DEF_END
 
 } // namespace pattern
@@ -211,6 +211,63 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, x8x8x_matmul_post_ops)
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
             return std::make_shared<quantized_matmul>();
         });
+
+/*
+                   int4/int8 weight
+        |                  |
+        |       dynamic_dequant_weight
+        \_____       _____/
+              matmul
+                |
+              [bias]*
+                |
+[unary/binary]*[0,MAX_REPETITION)
+                |
+            [select]*
+                |
+*/
+/*
+Note: The weights are dequantized with per-channel or grouped scales and zero
+points, which are lowered to the weights-decompression attributes of the
+matmul primitive, so that the f32/bf16/f16 weights are never materialized.
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
+        dnnl, compressed_wei_matmul_post_ops_cpu)
+        .set_priority(9.9f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::quantized_matmul_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *dequant_weight = pgraph->append_op(
+                            graph::op_kind::DynamicDequantize);
+                    dequant_weight->append_decision_function(
+                            check_compressed_weight);
+                    pm::pb_op_t *pmatmul
+                            = pgraph->append_op(graph::op_kind::MatMul,
+                                    in_edges_t {in_edge(1, dequant_weight, 0)});
+
+                    // Optional bias_add
+                    auto popt_bias = optional_bias_add(pgraph, pmatmul, false);
+
+                    auto postop_graph = std::make_shared<pb_graph_t>();
+                    pm::pb_op_t *pop = postop_graph->append_alternation(
+                            get_unary_binary_ops());
+                    pop->allow_internal_inputs();
+                    postop_graph->create_input_port(0, pop, 0);
+                    postop_graph->create_input_port(1, pop, 1);
+                    postop_graph->create_output_port(0, pop, 0);
+
+                    auto prep = pgraph->append_repetition(postop_graph, {0, 0},
+                            0, MAX_REPETITION,
+                            in_edges_t {in_edge(0, popt_bias, 0)});
+
+                    // Optional select
+                    optional_select(pgraph, prep, 2);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<quantized_matmul>();
+        });
+
 /*
                     [quant_weight]*
         |                  |
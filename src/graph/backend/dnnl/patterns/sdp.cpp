@@ -112,6 +112,34 @@ graph::utils::pm::repetition_t *optional_scale_and_masks(
     return opt_select;
 }
 
+/*
+Rotary position embedding (RoPE) of the query or the key. The rotation of
+pairs of elements, rotate-half or interleaved, is expressed as a MatMul with
+a [D, D] matrix of 0, 1 and -1 given by the application.
+        [x]   [rotation]
+      /    \   /
+     |     MatMul   [sin]
+     |         \    /
+     |  [cos]  Multiply
+      \  /      /
+    Multiply   /
+          \   /
+           Add
+*/
+pm::pb_op_t *append_rope(
+        const std::shared_ptr<pb_graph_t> &pgraph, int input_port) {
+    auto mul_cos = pgraph->append_op(graph::op_kind::Multiply);
+    auto rotate = pgraph->append_op(graph::op_kind::MatMul);
+    auto mul_sin = pgraph->append_op(
+            graph::op_kind::Multiply, {in_edge(0, rotate, 0)});
+    auto add = pgraph->append_op(graph::op_kind::Add,
+            {in_edge(0, mul_cos, 0), in_edge(1, mul_sin, 0)});
+    // x is a shared input for the two branches
+    pgraph->create_input_port(input_port, mul_cos, 0);
+    pgraph->create_input_port(input_port, rotate, 0);
+    return add;
+}
+
 DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(sdp)
 
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_fusion_cpu)
@@ -177,6 +205,30 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_fusion_gpu)
             return std::make_shared<sdp_base_t<>>();
         });
 
+// SDPA with RoPE applied to the query and the key. The rotation is computed
+// by a matmul with the sin multiplication and the cos term fused as post-ops.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_rope_fusion)
+        .set_priority(21.2f)
+        .set_kind(partition_kind_t::sdp)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto rope_q = append_rope(pgraph, 0);
+                    auto rope_k = append_rope(pgraph, 1);
+                    auto matmul_qk = pgraph->append_op(graph::op_kind::MatMul,
+                            {in_edge(0, rope_q, 0), in_edge(1, rope_k, 0)});
+                    auto optional_scale_and_mask
+                            = optional_scale_and_masks(pgraph, matmul_qk);
+                    auto softmax = pgraph->append_op(graph::op_kind::SoftMax,
+                            {in_edge(0, optional_scale_and_mask, 0)});
+                    auto matmul_v = pgraph->append_op(
+                            graph::op_kind::MatMul, {in_edge(0, softmax, 0)});
+                    // Optional transpose + reshape/reorder
+                    optional_transpose_reshape(pgraph, matmul_v, 0);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_backward_fusion)
         .set_priority(21.0f)
         .set_kind(partition_kind_t::sdp)
@@ -99,6 +99,18 @@ bool check_input_dtype_from_offset(op_t *op) {
     return true;
 }
 
+// Checks that a dynamic dequantize op expands int4 or int8 weights with
+// per-channel or grouped scales, which matmul can decompress on the fly.
+inline bool check_compressed_weight(op_t *op) {
+    if (op->num_inputs() < 2 || !op->has_attr(op_attr::qtype)) return false;
+    const auto wei_dt = op->get_input_value(0)->get_logical_tensor().data_type;
+    const auto &qtype = op->get_attr<std::string>(op_attr::qtype);
+    return impl::utils::one_of(wei_dt, graph::data_type::s4,
+                   graph::data_type::u4, graph::data_type::s8,
+                   graph::data_type::u8)
+            && (qtype == "per_channel" || qtype == "per_group");
+}
+
 template <dim N>
 static inline bool check_conv_weight_size(op_t *op) {
     std::string weight_fmt = op->get_attr<std::string>(op_attr::weights_format);
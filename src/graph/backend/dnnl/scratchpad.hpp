@@ -20,6 +20,8 @@
 #include <memory>
 #include <unordered_map>
 
+#include "common/stream.hpp"
+
 #include "graph/interface/allocator.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
@@ -42,12 +44,38 @@ public:
     virtual size_t size() const = 0;
 };
 
+// Returns true if the executions on the stream are completed when they return.
+// With the threadpool runtime this depends on the threadpool of the stream,
+// hence it is false when the stream is not known.
+inline bool is_sync_stream(const dnnl::engine &eng, const stream_t *stream) {
+    if (eng.get_kind() != dnnl::engine::kind::cpu) return false;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+    return false;
+#elif DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    using namespace dnnl::threadpool_interop;
+    threadpool_iface *tp = nullptr;
+    if (!stream || stream->get_threadpool(&tp) != status::success) return false;
+    return !tp
+            || !(tp->get_flags()
+                    & (threadpool_iface::ASYNCHRONOUS
+                            | threadpool_iface::NON_BLOCKING_EXECUTE));
+#else
+    UNUSED(stream);
+    return true;
+#endif
+}
+
 // The buffer is allocated when creating the temporary_scratchpad_t and
-// deallocated when destroying the temporary_scratchpad_t
+// deallocated when destroying the temporary_scratchpad_t. If the allocator has
+// a temporary arena bound that is large enough and free, the buffer is taken
+// from the arena instead. The arena is returned when destroying the
+// temporary_scratchpad_t, so it is only used for the streams that execute
+// synchronously: with asynchronous runtimes or threadpools, the kernels may
+// still run at destruction.
 class temporary_scratchpad_t : public scratchpad_t {
 public:
-    temporary_scratchpad_t(
-            size_t size, const dnnl::engine &eng, const allocator_t &alloc)
+    temporary_scratchpad_t(size_t size, const dnnl::engine &eng,
+            const allocator_t &alloc, const stream_t *stream = nullptr)
         : buffer_(nullptr)
         , size_(size)
         , eng_(&eng)
@@ -56,7 +84,11 @@ public:
         , ocl_e_(nullptr)
 #endif
     {
-        if (size > 0) {
+        if (size > 0 && is_sync_stream(eng, stream)) {
+            buffer_ = static_cast<char *>(alloc.acquire_temporary_arena(size));
+            from_arena_ = buffer_ != nullptr;
+        }
+        if (size > 0 && !from_arena_) {
             buffer_ = reinterpret_cast<char *>(dnnl_allocator_t::malloc(
                     size, eng, &alloc, allocator_t::mem_type_t::temp));
         }
@@ -64,7 +96,9 @@ public:
     }
 
     ~temporary_scratchpad_t() override {
-        if (eng_->get_kind() == dnnl::engine::kind::cpu) {
+        if (from_arena_) {
+            alloc_->release_temporary_arena(buffer_);
+        } else if (eng_->get_kind() == dnnl::engine::kind::cpu) {
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
             dnnl_allocator_t::free(buffer_, *eng_, alloc_, e_);
 #else
@@ -101,6 +135,7 @@ public:
 private:
     char *buffer_;
     size_t size_;
+    bool from_arena_ = false;
     const dnnl::engine *eng_;
     const allocator_t *alloc_;
 #ifdef DNNL_WITH_SYCL
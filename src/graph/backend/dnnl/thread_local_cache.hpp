@@ -16,6 +16,7 @@
 #ifndef GRAPH_BACKEND_DNNL_THREAD_LOCAL_CACHE_HPP
 #define GRAPH_BACKEND_DNNL_THREAD_LOCAL_CACHE_HPP
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -57,6 +58,11 @@ namespace dnnl_impl {
 //   weak_ptr to the thread local table correspondingly. Ann we need to use a
 //   lock to protect the global table. The performance should be bad, but cache
 //   miss should be rare.
+// - The value found last is also kept in a slot of the thread local table
+//   together with a generation of the global table, which is changed when
+//   values are removed from it. A thread executing the same kernel repeatedly
+//   hits the slot with a single atomic load and no table lookup, and the
+//   shared cache lines are only written on cache miss or removal.
 // - We can read/write the found resource in each thread without lock, because
 //   each thread has its own replica.
 // - If a thread existed, the thread local table will be destroyed, during
@@ -76,7 +82,8 @@ public:
     // Check if we have a cached value for the given key in current thread
     bool has_resource(const size_t &key) {
         cache_type_t &cache = get_thread_local_cache();
-        return cache.data().count(key) && !cache.data()[key].expired();
+        auto it = cache.data().find(key);
+        return it != cache.data().end() && !it->second.expired();
     }
 
     // return the number of cached values in current thread
@@ -114,6 +121,7 @@ public:
             }
         }
         lcache.data().clear();
+        lcache.reset_last();
     }
 
     // Remove the cached values for the given key in ALL threads
@@ -123,7 +131,10 @@ public:
         if (gcache) {
             std::lock_guard<std::mutex> lock(gcache->mutex());
             auto pos = gcache->data().find(key);
-            if (pos != gcache->data().end()) { pos->second.clear(); }
+            if (pos != gcache->data().end() && !pos->second.empty()) {
+                pos->second.clear();
+                gcache->bump_generation();
+            }
         }
     }
 
@@ -132,15 +143,23 @@ public:
     T *get_or_add(const size_t &key,
             const std::function<std::shared_ptr<T>()> &creator) {
         cache_type_t &cache = get_thread_local_cache();
-        if (has_resource(key)) { // cache hit
-            return cache.data()[key].lock().get();
-        } else { // cache miss
+        auto *gcache = global_cache_type_t::get_global_cache();
+        // The generation is read before the lookup, so a value removed after
+        // this point is not hit in the slot on the next call.
+        const size_t generation = gcache ? gcache->generation() : 0;
+        if (cache.last_value_ && cache.last_key_ == key
+                && cache.last_generation_ == generation)
+            return cache.last_value_;
+
+        auto it = cache.data().find(key);
+        std::shared_ptr<T> ins;
+        if (it != cache.data().end()) ins = it->second.lock();
+        if (!ins) { // cache miss
             // Cache miss shouldn't happen frequently, because the lock is
             // heavy. No double-check is needed here since cached values won't
             // be shared between threads
-            std::shared_ptr<T> ins = creator();
+            ins = creator();
             {
-                auto *gcache = global_cache_type_t::get_global_cache();
                 // for safety purpose. it should not be nullptr.
                 if (gcache) {
                     std::lock_guard<std::mutex> lock(gcache->mutex());
@@ -153,8 +172,11 @@ public:
                 }
             }
             cache.data()[key] = ins;
-            return ins.get();
         }
+        cache.last_key_ = key;
+        cache.last_value_ = ins.get();
+        cache.last_generation_ = generation;
+        return ins.get();
     }
 
     // This function increments the reference count
@@ -171,7 +193,7 @@ public:
 private:
     class global_cache_type_t {
     public:
-        global_cache_type_t() : counter_(1) {}
+        global_cache_type_t() : counter_(1), generation_(0) {}
         ~global_cache_type_t() = default;
         std::mutex &mutex() { return mutex_; }
         std::unordered_map<size_t, std::vector<std::shared_ptr<T>>> &data() {
@@ -194,6 +216,15 @@ private:
         // This function increments the reference count
         void retain() { counter_.fetch_add(1, std::memory_order_relaxed); }
 
+        size_t generation() const {
+            return generation_.load(std::memory_order_acquire);
+        }
+        // Invalidates the values kept in the slots of all threads. Called
+        // with the mutex held.
+        void bump_generation() {
+            generation_.fetch_add(1, std::memory_order_release);
+        }
+
         void release() {
             if (counter_.fetch_sub(1, std::memory_order_relaxed) == 1) {
                 delete this;
@@ -204,6 +235,7 @@ private:
         std::mutex mutex_;
         std::unordered_map<size_t, std::vector<std::shared_ptr<T>>> data_;
         std::atomic<int32_t> counter_;
+        std::atomic<size_t> generation_;
     };
 
     class cache_type_t {
@@ -245,8 +277,15 @@ private:
 
         std::unordered_map<size_t, std::weak_ptr<T>> &data() { return data_; }
 
+        void reset_last() { last_value_ = nullptr; }
+
         global_cache_type_t &global_cache_ref_;
         std::unordered_map<size_t, std::weak_ptr<T>> data_;
+        // The value found last. It is owned by the global table and valid
+        // while the generation of the table is unchanged.
+        size_t last_key_ = 0;
+        T *last_value_ = nullptr;
+        size_t last_generation_ = 0;
     };
 
     thread_local_cache_t(const thread_local_cache_t &other) = delete;
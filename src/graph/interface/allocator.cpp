@@ -78,6 +78,13 @@ status_t DNNL_API dnnl_graph_allocator_destroy(allocator_t *allocator) {
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_allocator_set_temporary_arena(
+        allocator_t *allocator, void *arena, size_t size) {
+    if (allocator == nullptr) return status::invalid_arguments;
+    allocator->set_temporary_arena(arena, size);
+    return status::success;
+}
+
 status_t DNNL_API dnnl_graph_make_engine_with_allocator(engine_t **engine,
         engine_kind_t kind, size_t index, const allocator_t *alloc) {
     auto ret = dnnl_engine_create(engine, kind, index);
@@ -17,6 +17,9 @@
 #ifndef GRAPH_INTERFACE_ALLOCATOR_HPP
 #define GRAPH_INTERFACE_ALLOCATOR_HPP
 
+#include <atomic>
+#include <memory>
+
 #include "oneapi/dnnl/dnnl_graph.h"
 
 #include "graph/interface/c_types_map.hpp"
@@ -181,7 +184,38 @@ public:
     }
 #endif
 
+    /// Binds a user buffer that the temporary memory of executions is taken
+    /// from instead of being allocated on every execution. The arena is
+    /// shared by all the copies of the allocator, e.g. the ones held by the
+    /// engines created with it, so it can be bound after the engines.
+    void set_temporary_arena(void *buffer, size_t size) {
+        arena_->buffer_ = size > 0 ? buffer : nullptr;
+        arena_->size_ = buffer ? size : 0;
+    }
+
+    /// Returns the arena if it is bound, can hold the requested size, and is
+    /// not used by another execution at the moment. Otherwise, returns
+    /// nullptr and the memory should be allocated as usual.
+    void *acquire_temporary_arena(size_t size) const {
+        if (!arena_->buffer_ || size > arena_->size_) return nullptr;
+        bool in_use = false;
+        if (!arena_->in_use_.compare_exchange_strong(in_use, true))
+            return nullptr;
+        return arena_->buffer_;
+    }
+
+    void release_temporary_arena(void *buffer) const {
+        if (buffer && buffer == arena_->buffer_) arena_->in_use_ = false;
+    }
+
 private:
+    struct arena_t {
+        void *buffer_ = nullptr;
+        size_t size_ = 0;
+        std::atomic<bool> in_use_ {false};
+    };
+    std::shared_ptr<arena_t> arena_ {std::make_shared<arena_t>()};
+
     dnnl_graph_host_allocate_f host_malloc_ {
             dnnl::impl::graph::utils::cpu_allocator_t::malloc};
     dnnl_graph_host_deallocate_f host_free_ {
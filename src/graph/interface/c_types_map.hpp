@@ -22,6 +22,7 @@
 #include <type_traits>
 
 #include "oneapi/dnnl/dnnl_graph_sycl.h"
+#include "oneapi/dnnl/dnnl_graph_threadpool.h"
 #include "oneapi/dnnl/dnnl_graph_types.h"
 
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
@@ -326,6 +327,7 @@ using op_t = dnnl_graph_op;
 using partition_t = dnnl_graph_partition;
 using compiled_partition_t = dnnl_graph_compiled_partition;
 using tensor_t = dnnl_graph_tensor;
+using threadpool_event_t = dnnl_graph_threadpool_event;
 
 // oneDNN common objects
 using engine_t = dnnl_engine;
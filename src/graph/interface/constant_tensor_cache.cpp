@@ -15,6 +15,9 @@
  *******************************************************************************/
 
 #include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
 #include <memory>
 #include <string>
 #include <vector>
@@ -41,6 +44,12 @@
 
 #ifdef _WIN32
 #include <windows.h>
+#else
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 namespace std {
@@ -61,6 +70,87 @@ namespace graph {
 using c_key_t = constant_tensor_cache_t::key_t;
 using c_value_t = constant_tensor_cache_t::value_t;
 
+std::shared_ptr<constant_buffer_t> mapped_constant_buffer_t::create(
+        const std::string &dir, size_t key, size_t size, impl::engine_t *eng,
+        allocator_t *alc) {
+#ifdef _WIN32
+    UNUSED(dir);
+    UNUSED(key);
+    UNUSED(size);
+    UNUSED(eng);
+    UNUSED(alc);
+    return nullptr;
+#else
+    if (dir.empty() || size == 0) return nullptr;
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016" PRIx64 ".bin",
+            static_cast<uint64_t>(key));
+    std::shared_ptr<mapped_constant_buffer_t> buf(
+            new mapped_constant_buffer_t(size, eng, alc));
+    buf->path_ = dir + "/" + name;
+
+    // The constants of the key were computed already.
+    int fd = open(buf->path_.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) == size) {
+            void *data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            close(fd);
+            if (data == MAP_FAILED) return nullptr;
+            buf->data_ = data;
+            buf->filled_ = true;
+            return buf;
+        }
+        close(fd);
+    }
+
+    // Every buffer computing the constants has a file of its own.
+    std::vector<char> tmp_path(buf->path_.begin(), buf->path_.end());
+    const std::string suffix = ".tmp.XXXXXX";
+    tmp_path.insert(tmp_path.end(), suffix.begin(), suffix.end());
+    tmp_path.push_back('\0');
+    fd = mkstemp(tmp_path.data());
+    if (fd < 0) return nullptr;
+    buf->tmp_path_ = tmp_path.data();
+    void *data = MAP_FAILED;
+    if (fchmod(fd, 0644) == 0 && ftruncate(fd, static_cast<off_t>(size)) == 0)
+        data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        unlink(buf->tmp_path_.c_str());
+        return nullptr;
+    }
+    buf->data_ = data;
+    return buf;
+#endif
+}
+
+mapped_constant_buffer_t::~mapped_constant_buffer_t() {
+#ifndef _WIN32
+    if (data_) munmap(data_, size_);
+    if (!filled_ && !tmp_path_.empty()) unlink(tmp_path_.c_str());
+#endif
+}
+
+void mapped_constant_buffer_t::set_filled() {
+#ifndef _WIN32
+    if (filled_) return;
+    // Another process may have published the same constants meanwhile, in
+    // which case its file is replaced with an identical one. The mapping
+    // stays valid if publishing fails, it is only not shared then.
+    if (rename(tmp_path_.c_str(), path_.c_str()) != 0)
+        unlink(tmp_path_.c_str());
+    filled_ = true;
+#endif
+}
+
+const std::string &get_constant_tensor_cache_dir() {
+    static const std::string dir
+            = impl::getenv_string_user("GRAPH_CONSTANT_TENSOR_CACHE_DIR");
+    return dir;
+}
+
 static size_t get_timestamp() {
     return std::chrono::steady_clock::now().time_since_epoch().count();
 }
@@ -141,6 +231,7 @@ status_t constant_tensor_cache_t::set_capacity(size_t capacity) {
     lock_write();
     capacity_in_bytes_ = capacity;
     evict(get_size()); // completely flushed cache
+    dropped_keys_.clear();
     unlock_write();
     return status::success;
 }
@@ -157,7 +248,8 @@ c_key_t constant_tensor_cache_t::combine_key(
 }
 
 c_value_t constant_tensor_cache_t::get_or_add(c_key_t backend_id,
-        c_key_t backend_specific_key, size_t size, const c_value_t &value) {
+        c_key_t backend_specific_key, size_t size, const c_value_t &value,
+        int32_t priority) {
     if (!size) { return c_value_t(); }
 
     c_key_t key = combine_key(backend_id, backend_specific_key);
@@ -195,7 +287,8 @@ c_value_t constant_tensor_cache_t::get_or_add(c_key_t backend_id,
     e = get(key);
     if (!e.valid()) {
         // If the entry is missing in the cache then add it (cache_miss)
-        add(key, size, value);
+        if (dropped_keys_.count(key)) recomputed_bytes_ += size;
+        add(key, size, value, priority);
     }
     unlock_write();
     return e;
@@ -220,29 +313,60 @@ void constant_tensor_cache_t::remove_if_exist(
     }
 }
 
+bool constant_tensor_cache_t::is_ready(
+        c_key_t backend_id, c_key_t backend_specific_key) {
+    c_key_t key = combine_key(backend_id, backend_specific_key);
+
+    lock_read();
+    auto it = constant_map().find(key);
+    const bool ready = it != constant_map().end()
+            && it->second.value_.wait_for(std::chrono::seconds(0))
+                    == std::future_status::ready;
+    unlock_read();
+    return ready;
+}
+
+void constant_tensor_cache_t::accumulate_stats(
+        dnnl_graph_constant_tensor_cache_stats_t &stats) {
+    lock_read();
+    stats.size += get_size();
+    unlock_read();
+    stats.evicted_bytes += get_evicted_bytes();
+    stats.recomputed_bytes += get_recomputed_bytes();
+}
+
 // Get the total size of all cached buffers
 size_t constant_tensor_cache_t::get_size() const {
     size_t total_size = 0;
     for (const auto &pair : constant_map()) {
-        total_size += pair.second.value_.get()->size();
+        total_size += pair.second.size_;
     }
     return total_size;
 }
 
-void constant_tensor_cache_t::add(
-        const c_key_t &key, size_t size, const c_value_t &constant) {
+void constant_tensor_cache_t::add(const c_key_t &key, size_t size,
+        const c_value_t &constant, int32_t priority) {
     size_t current_size = get_size();
 
-    // No enough capacity to cache the new tensor, ignore the new tensor
-    // directly
-    if (current_size + size > capacity_in_bytes_) { return; }
+    // No enough capacity to cache the new tensor, make room for it with
+    // entries of a lower priority, or ignore the new tensor directly
+    if (current_size + size > capacity_in_bytes_) {
+        const bool fits = size <= capacity_in_bytes_
+                && evict_lower_priority(
+                        current_size + size - capacity_in_bytes_, priority);
+        if (!fits) {
+            dropped_keys_.insert(key);
+            return;
+        }
+    }
+    dropped_keys_.erase(key);
 
     // Cache tensors
     size_t timestamp = get_timestamp();
 
     auto res = constant_map().emplace(std::piecewise_construct,
             std::forward_as_tuple(key),
-            std::forward_as_tuple(constant, timestamp));
+            std::forward_as_tuple(constant, timestamp, size, priority));
     UNUSED(res);
     assert(res.second);
 }
@@ -253,6 +377,7 @@ c_value_t constant_tensor_cache_t::get(const c_key_t &key) {
 
     size_t timestamp = get_timestamp();
     it->second.timestamp_.store(timestamp);
+    it->second.hits_.fetch_add(1, std::memory_order_relaxed);
     // Return the entry
     return it->second.value_;
 }
@@ -282,13 +407,59 @@ void constant_tensor_cache_t::evict(size_t n) {
                             < right.second.timestamp_.load(
                                     std::memory_order_relaxed);
                 });
-        evicted_size += it->second.value_.get()->size();
+        evicted_size += it->second.size_;
         auto res = constant_map().erase(it->first);
         UNUSED(res);
         assert(res);
     }
 }
 
+// Evict at least n size of cached buffers with a priority lower than the given
+// one, or nothing if there are not enough of them
+bool constant_tensor_cache_t::evict_lower_priority(size_t n, int32_t priority) {
+    using v_t = std::unordered_map<c_key_t, timed_entry_t>::value_type;
+    std::vector<v_t *> candidates;
+    size_t candidates_size = 0;
+    for (auto &pair : constant_map()) {
+        if (pair.second.priority_ >= priority) continue;
+        // The buffers still being computed by other threads are kept.
+        if (pair.second.value_.wait_for(std::chrono::seconds(0))
+                != std::future_status::ready)
+            continue;
+        candidates.push_back(&pair);
+        candidates_size += pair.second.size_;
+    }
+    if (candidates_size < n) return false;
+
+    // The lowest priority goes first, then the least frequently used, then
+    // the largest, so that few entries are evicted, then the least recently
+    // used.
+    std::sort(candidates.begin(), candidates.end(),
+            [](const v_t *left, const v_t *right) {
+                const auto &l = left->second, &r = right->second;
+                if (l.priority_ != r.priority_)
+                    return l.priority_ < r.priority_;
+                const size_t l_hits = l.hits_.load(std::memory_order_relaxed);
+                const size_t r_hits = r.hits_.load(std::memory_order_relaxed);
+                if (l_hits != r_hits) return l_hits < r_hits;
+                if (l.size_ != r.size_) return l.size_ > r.size_;
+                return l.timestamp_.load(std::memory_order_relaxed)
+                        < r.timestamp_.load(std::memory_order_relaxed);
+            });
+
+    size_t evicted_size = 0;
+    for (auto *candidate : candidates) {
+        if (evicted_size >= n) break;
+        const c_key_t key = candidate->first;
+        evicted_size += candidate->second.size_;
+        candidate->second.value_.get()->notify_evict();
+        constant_map().erase(key);
+        dropped_keys_.insert(key);
+    }
+    evicted_bytes_ += evicted_size;
+    return true;
+}
+
 // copy from src/common/engine.cpp
 static std::unique_ptr<impl::engine_factory_t> get_engine_factory(
         impl::engine_kind_t kind, impl::runtime_kind_t runtime_kind) {
@@ -519,3 +690,20 @@ dnnl::impl::graph::status_t dnnl_graph_get_constant_tensor_cache_capacity(
 
     return dnnl::impl::graph::status::success;
 }
+
+dnnl::impl::graph::status_t dnnl_graph_get_constant_tensor_cache_stats(
+        dnnl_engine_kind_t eng_kind,
+        dnnl_graph_constant_tensor_cache_stats_t *stats) {
+    if (stats == nullptr) return dnnl::impl::graph::status::invalid_arguments;
+    *stats = {0, 0, 0};
+
+    auto &caches = dnnl::impl::graph::global_cache_manager_t::get_instance()
+                           .get_caches();
+    if (caches.count(eng_kind)) {
+        for (auto &cache : caches.at(eng_kind)) {
+            if (cache) cache->accumulate_stats(*stats);
+        }
+    }
+
+    return dnnl::impl::graph::status::success;
+}
@@ -21,8 +21,10 @@
 #include <future>
 #include <limits>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "common/c_types_map.hpp"
 #include "common/engine.hpp"
@@ -53,7 +55,7 @@ public:
     }
 
     virtual ~constant_buffer_t() {
-        free_func_(data_, eng_, alc_);
+        if (free_func_) free_func_(data_, eng_, alc_);
         eng_->release();
     };
 
@@ -74,7 +76,26 @@ public:
     // api to avoid query constant cache frequently to reduce overhead.
     virtual void notify_evict() {}
 
+    // Whether the buffer holds the constants already, e.g. when they were
+    // computed by another process sharing the buffer. Backends skip
+    // computing the constants in this case, and call set_filled() after
+    // computing them otherwise.
+    virtual bool is_filled() const { return false; }
+    virtual void set_filled() {}
+
 protected:
+    // For buffers whose memory is not allocated by the backend, which should
+    // set data_ on their own.
+    constant_buffer_t(size_t size, impl::engine_t *eng, allocator_t *alc)
+        : data_(nullptr)
+        , size_(size)
+        , eng_(eng)
+        , alc_(alc)
+        , malloc_func_(nullptr)
+        , free_func_(nullptr) {
+        eng_->retain();
+    }
+
     void *data_;
     size_t size_;
     impl::engine_t *eng_;
@@ -85,6 +106,36 @@ private:
     free_func_t free_func_;
 };
 
+// A constant buffer in a file mapped to memory, so that the processes that
+// map the file of a key share one copy of the constants, and the constants
+// outlive the process. The file is created under a temporary name and gets
+// its final name once the constants are computed, so a file found under the
+// final name is always complete.
+class mapped_constant_buffer_t : public constant_buffer_t {
+public:
+    // Returns nullptr if the file cannot be created or mapped, in which case
+    // backends should allocate the buffer as usual.
+    static std::shared_ptr<constant_buffer_t> create(const std::string &dir,
+            size_t key, size_t size, impl::engine_t *eng, allocator_t *alc);
+
+    ~mapped_constant_buffer_t() override;
+
+    bool is_filled() const override { return filled_; }
+    void set_filled() override;
+
+private:
+    mapped_constant_buffer_t(size_t size, impl::engine_t *eng, allocator_t *alc)
+        : constant_buffer_t(size, eng, alc) {}
+
+    std::string path_;
+    std::string tmp_path_;
+    bool filled_ = false;
+};
+
+// The directory of the files of mapped constant buffers, which is empty if
+// the constants are kept in the memory of the process.
+const std::string &get_constant_tensor_cache_dir();
+
 struct constant_tensor_cache_t {
     using key_t = size_t;
     using cached_t = std::shared_ptr<constant_buffer_t>;
@@ -108,12 +159,27 @@ struct constant_tensor_cache_t {
     status_t set_capacity(size_t capacity);
     size_t get_capacity();
 
+    // When the cache is full, a new entry evicts entries of a lower priority
+    // only, so entries of the same priority are never evicted for each
+    // other.
     value_t get_or_add(key_t backend_id, key_t backend_specific_key,
-            size_t size, const value_t &value);
+            size_t size, const value_t &value, int32_t priority = 0);
     void remove_if_exist(key_t backend_id, key_t backend_specific_key);
+    // Returns whether an entry is present and its constants are computed,
+    // without counting it as a use of the entry.
+    bool is_ready(key_t backend_id, key_t backend_specific_key);
 
     size_t get_size() const;
 
+    // The bytes of the entries evicted for entries of a higher priority, and
+    // the bytes of the constants computed again because the cache did not
+    // keep them, either evicted or not admitted for the lack of capacity.
+    size_t get_evicted_bytes() const { return evicted_bytes_.load(); }
+    size_t get_recomputed_bytes() const { return recomputed_bytes_.load(); }
+
+    // Adds the statistics of the cache to the given ones.
+    void accumulate_stats(dnnl_graph_constant_tensor_cache_stats_t &stats);
+
     // The key_t is composed of two parts: backend id and backend specific key.
     // The backend id occupies 4 bits, and the backend specific key occupies the
     // remained 60 bits. So backends should ensure not encode any information in
@@ -124,8 +190,10 @@ struct constant_tensor_cache_t {
 
 private:
     void evict(size_t n);
+    bool evict_lower_priority(size_t n, int32_t priority);
     value_t get(const key_t &key);
-    void add(const key_t &key, size_t size, const value_t &constant);
+    void add(const key_t &key, size_t size, const value_t &constant,
+            int32_t priority);
 
     void lock_read() { rw_mutex_.lock_read(); }
     void lock_write() { rw_mutex_.lock_write(); }
@@ -142,8 +210,16 @@ private:
     struct timed_entry_t {
         value_t value_;
         std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
+        std::atomic<size_t> hits_;
+        size_t size_;
+        int32_t priority_;
+        timed_entry_t(const value_t &value, size_t timestamp, size_t size,
+                int32_t priority)
+            : value_(value)
+            , timestamp_(timestamp)
+            , hits_(0)
+            , size_(size)
+            , priority_(priority) {}
     };
 
     std::unordered_map<key_t, timed_entry_t> &constant_map() {
@@ -159,6 +235,11 @@ private:
     // an element*, since it invokes the copy constructor of std::atomic, which
     // is deleted.
     std::unique_ptr<std::unordered_map<key_t, timed_entry_t>> constant_map_;
+    // The keys of the entries that were evicted or not admitted, so that
+    // computing them again is counted as recomputation.
+    std::unordered_set<key_t> dropped_keys_;
+    std::atomic<size_t> evicted_bytes_ {0};
+    std::atomic<size_t> recomputed_bytes_ {0};
     impl::utils::rw_mutex_t rw_mutex_;
     std::string name_;
     std::atomic<size_t> capacity_in_bytes_;
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <limits>
@@ -28,6 +29,7 @@
 #endif
 
 #include "common/cache_hit_types.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
 #include "common/verbose.hpp"
 
@@ -39,6 +41,7 @@
 #include "graph/interface/op_schema.hpp"
 #include "graph/interface/partition.hpp"
 #include "graph/interface/partition_cache.hpp"
+#include "graph/interface/threadpool_event.hpp"
 
 #ifdef DNNL_WITH_SYCL
 #include "oneapi/dnnl/dnnl_sycl.hpp"
@@ -217,6 +220,50 @@ status_t DNNL_API dnnl_graph_partition_compile(partition_t *partition,
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_partition_compile_from_cache_blob(
+        partition_t *partition, compiled_partition_t *compiled_partition,
+        size_t in_num, const logical_tensor_t **inputs, size_t out_num,
+        const logical_tensor_t **outputs, engine_t *engine, size_t size,
+        const uint8_t *cache_blob) {
+    if (utils::any_null(cache_blob) || size == 0)
+        return status::invalid_arguments;
+
+    // The primitives created on compilation load their kernels from the
+    // bundle attached to the thread.
+    dnnl::impl::persistent_cache::bundle_t bundle;
+    CHECK(bundle.deserialize(cache_blob, size));
+    dnnl::impl::persistent_cache::bundle_scope_t scope(bundle);
+    return dnnl_graph_partition_compile(partition, compiled_partition, in_num,
+            inputs, out_num, outputs, engine);
+}
+
+status_t DNNL_API dnnl_graph_partitions_compile(size_t num_partitions,
+        partition_t **partitions, compiled_partition_t **compiled_partitions,
+        const size_t *in_nums, const logical_tensor_t ***inputs,
+        const size_t *out_nums, const logical_tensor_t ***outputs,
+        engine_t *engine) {
+    if (num_partitions == 0) return status::success;
+    if (utils::any_null(partitions, compiled_partitions, in_nums, inputs,
+                out_nums, outputs, engine)) {
+        return status::invalid_arguments;
+    }
+
+    // The partitions are independent of each other, and a partition compiles
+    // its ops sequentially when it is compiled in a parallel region.
+    std::vector<status_t> statuses(num_partitions, status::success);
+    dnnl::impl::parallel_nd(static_cast<dim_t>(num_partitions), [&](dim_t i) {
+        try {
+            statuses[i] = dnnl_graph_partition_compile(partitions[i],
+                    compiled_partitions[i], in_nums[i], inputs[i], out_nums[i],
+                    outputs[i], engine);
+        } catch (...) { statuses[i] = status::runtime_error; }
+    });
+
+    for (const auto s : statuses)
+        CHECK(s);
+    return status::success;
+}
+
 status_t DNNL_API dnnl_graph_partition_get_input_ports_num(
         const partition_t *partition, size_t *num) {
     if (utils::any_null(partition, num)) { return status::invalid_arguments; }
@@ -335,6 +382,116 @@ status_t DNNL_API dnnl_graph_compiled_partition_execute(
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_compiled_partitions_execute(
+        size_t num_partitions, const compiled_partition_t **compiled_partitions,
+        stream_t *stream, const size_t *in_nums, const tensor_t ***inputs,
+        const size_t *out_nums, const tensor_t ***outputs) {
+    if (num_partitions == 0) return status::success;
+    if (utils::any_null(compiled_partitions, stream, in_nums, inputs,
+                out_nums, outputs))
+        return status::invalid_arguments;
+
+    const auto execute = [&](size_t i) {
+        return dnnl_graph_compiled_partition_execute(compiled_partitions[i],
+                stream, in_nums[i], inputs[i], out_nums[i], outputs[i]);
+    };
+
+    bool concurrent = stream->engine()->kind() == engine_kind::cpu;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_OMP && DNNL_CPU_RUNTIME != DNNL_RUNTIME_TBB
+    // The threads of other runtimes are owned by the stream.
+    concurrent = false;
+#endif
+    if (!concurrent || num_partitions == 1) {
+        for (size_t i = 0; i < num_partitions; ++i)
+            CHECK(execute(i));
+        return status::success;
+    }
+
+    // A partition depends on an earlier one if a buffer written by one of
+    // them overlaps a buffer accessed by the other. The level of a partition
+    // is one more than the highest level of the partitions it depends on, so
+    // the partitions of a level are independent of each other.
+    const auto tensor_size = [](const tensor_t *t) {
+        return logical_tensor_wrapper_t(t->get_logical_tensor()).size();
+    };
+    const auto shares_buffer = [&](const tensor_t **ts, size_t num,
+                                       const tensor_t **other_ts,
+                                       size_t other_num) {
+        for (size_t i = 0; i < num; ++i) {
+            const auto *beg
+                    = static_cast<const char *>(ts[i]->get_data_handle());
+            const auto *end = beg + std::max<size_t>(tensor_size(ts[i]), 1);
+            for (size_t j = 0; j < other_num; ++j) {
+                const auto *other_beg = static_cast<const char *>(
+                        other_ts[j]->get_data_handle());
+                const auto *other_end = other_beg
+                        + std::max<size_t>(tensor_size(other_ts[j]), 1);
+                if (beg < other_end && other_beg < end) return true;
+            }
+        }
+        return false;
+    };
+    std::vector<size_t> levels(num_partitions, 0);
+    size_t num_levels = 1;
+    for (size_t j = 0; j < num_partitions; ++j) {
+        for (size_t i = 0; i < j; ++i) {
+            const bool depends = shares_buffer(
+                                         outputs[i], out_nums[i], inputs[j],
+                                         in_nums[j])
+                    || shares_buffer(outputs[i], out_nums[i], outputs[j],
+                            out_nums[j])
+                    || shares_buffer(
+                            inputs[i], in_nums[i], outputs[j], out_nums[j]);
+            if (depends) levels[j] = std::max(levels[j], levels[i] + 1);
+        }
+        num_levels = std::max(num_levels, levels[j] + 1);
+    }
+
+    // A partition executed in a parallel region runs on its thread only, as
+    // nested parallelism is not allowed. That pays off only for the partitions
+    // too small to use all the threads, so the partitions of a level are
+    // executed concurrently only if all of them touch less memory than roughly
+    // fits in the per core cache. Otherwise they are executed one after
+    // another, each of them using all the threads.
+    const size_t small_partition_size = 1024 * 1024;
+    const auto is_small = [&](size_t i) {
+        size_t size = 0;
+        for (size_t k = 0; k < in_nums[i]; ++k)
+            size += tensor_size(inputs[i][k]);
+        for (size_t k = 0; k < out_nums[i]; ++k)
+            size += tensor_size(outputs[i][k]);
+        return size <= small_partition_size;
+    };
+
+    std::vector<status_t> statuses(num_partitions, status::success);
+    std::vector<size_t> level_parts;
+    for (size_t l = 0; l < num_levels; ++l) {
+        level_parts.clear();
+        for (size_t i = 0; i < num_partitions; ++i)
+            if (levels[i] == l) level_parts.push_back(i);
+        if (level_parts.size() == 1
+                || !std::all_of(
+                        level_parts.begin(), level_parts.end(), is_small)) {
+            for (const auto i : level_parts) {
+                statuses[i] = execute(i);
+                CHECK(statuses[i]);
+            }
+        } else {
+            dnnl::impl::parallel_nd(
+                    static_cast<dim_t>(level_parts.size()), [&](dim_t k) {
+                        const size_t i = level_parts[k];
+                        try {
+                            statuses[i] = execute(i);
+                        } catch (...) { statuses[i] = status::runtime_error; }
+                    });
+        }
+        // The later levels depend on this one.
+        for (const auto i : level_parts)
+            CHECK(statuses[i]);
+    }
+    return status::success;
+}
+
 status_t DNNL_API dnnl_graph_sycl_interop_compiled_partition_execute(
         const compiled_partition_t *compiled_partition, stream_t *stream,
         size_t num_inputs, const tensor_t **inputs, size_t num_outputs,
@@ -455,6 +612,71 @@ status_t DNNL_API dnnl_graph_ocl_interop_compiled_partition_execute(
 }
 #endif
 
+status_t DNNL_API dnnl_graph_threadpool_interop_compiled_partition_execute(
+        const compiled_partition_t *compiled_partition, stream_t *stream,
+        size_t num_inputs, const tensor_t **inputs, size_t num_outputs,
+        const tensor_t **outputs, size_t num_deps,
+        const threadpool_event_t **deps, threadpool_event_t **event) {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    if (utils::any_null(stream, compiled_partition, inputs, outputs, event))
+        return status::invalid_arguments;
+    if (num_deps > 0 && deps == nullptr) return status::invalid_arguments;
+    if (stream->engine()->kind() != engine_kind::cpu)
+        return status::invalid_arguments;
+
+    std::vector<tensor_t> ins, outs;
+    ins.reserve(num_inputs);
+    outs.reserve(num_outputs);
+    for (size_t i = 0; i < num_inputs; ++i) {
+        ins.emplace_back(**(inputs + i));
+    }
+    for (size_t i = 0; i < num_outputs; ++i) {
+        outs.emplace_back(**(outputs + i));
+    }
+
+    // The task keeps the states of the events, so the user may destroy them
+    // before the execution.
+    using state_t = threadpool_event_t::state_t;
+    std::vector<std::shared_ptr<state_t>> dep_states;
+    dep_states.reserve(num_deps);
+    for (size_t i = 0; i < num_deps; ++i) {
+        if (deps[i] == nullptr) return status::invalid_arguments;
+        dep_states.push_back(deps[i]->get_state());
+    }
+
+    std::unique_ptr<threadpool_event_t> ev(new threadpool_event_t());
+    std::shared_ptr<state_t> state = ev->get_state();
+    // Executed on the thread of an asynchronous stream, the primitives of the
+    // partition run right away on that thread, so the temporary memory of the
+    // partition is not released before they are completed.
+    CHECK(stream->enqueue_host_task([=]() {
+        status_t status = status::success;
+        for (const auto &dep : dep_states) {
+            status = dep->wait();
+            if (status != status::success) break;
+        }
+        if (status == status::success)
+            status = compiled_partition->execute(stream, ins, outs);
+        state->complete(status);
+        return status;
+    }));
+
+    *event = ev.release();
+    return status::success;
+#else
+    UNUSED(compiled_partition);
+    UNUSED(stream);
+    UNUSED(num_inputs);
+    UNUSED(inputs);
+    UNUSED(num_outputs);
+    UNUSED(outputs);
+    UNUSED(num_deps);
+    UNUSED(deps);
+    UNUSED(event);
+    return status::unimplemented;
+#endif
+}
+
 status_t DNNL_API dnnl_graph_compiled_partition_destroy(
         compiled_partition_t *compiled_partition) {
     delete compiled_partition;
@@ -482,6 +704,94 @@ status_t DNNL_API dnnl_graph_compiled_partition_get_inplace_ports(
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_compiled_partition_get_temporary_size(
+        const compiled_partition_t *compiled_partition, size_t *size) {
+    if (utils::any_null(compiled_partition, size))
+        return status::invalid_arguments;
+
+    *size = compiled_partition->get_temporary_size();
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_compiled_partition_get_cache_blob(
+        const compiled_partition_t *compiled_partition, size_t *size,
+        uint8_t *cache_blob) {
+    if (utils::any_null(compiled_partition, size))
+        return status::invalid_arguments;
+    if (!compiled_partition->is_initialized()) return status::invalid_arguments;
+
+    static const dnnl::impl::persistent_cache::bundle_t empty_bundle;
+    const auto *bundle = compiled_partition->get_pimpl()->get_cache_bundle();
+    if (!bundle) bundle = &empty_bundle;
+
+    if (!cache_blob) {
+        *size = bundle->get_serialized_size();
+        return status::success;
+    }
+    return bundle->serialize(cache_blob, *size);
+}
+
+status_t DNNL_API dnnl_graph_compiled_partition_set_constant_cache_priority(
+        compiled_partition_t *compiled_partition, int32_t priority) {
+    if (compiled_partition == nullptr) return status::invalid_arguments;
+
+    compiled_partition->set_constant_cache_priority(priority);
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_compiled_partition_prepare_constants(
+        const compiled_partition_t *compiled_partition, stream_t *stream,
+        size_t num_inputs, const tensor_t **inputs) {
+    if (utils::any_null(compiled_partition, stream, inputs))
+        return status::invalid_arguments;
+    if (!compiled_partition->is_initialized()) return status::invalid_arguments;
+
+    std::vector<tensor_t> ins;
+    ins.reserve(num_inputs);
+    for (size_t i = 0; i < num_inputs; ++i) {
+        ins.emplace_back(**(inputs + i));
+    }
+    return compiled_partition->prepare_constants(stream, ins);
+}
+
+status_t DNNL_API dnnl_graph_compiled_partition_constants_ready(
+        const compiled_partition_t *compiled_partition, size_t num_inputs,
+        const tensor_t **inputs, int *ready) {
+    if (utils::any_null(compiled_partition, inputs, ready))
+        return status::invalid_arguments;
+    if (!compiled_partition->is_initialized()) return status::invalid_arguments;
+
+    std::vector<tensor_t> ins;
+    ins.reserve(num_inputs);
+    for (size_t i = 0; i < num_inputs; ++i) {
+        ins.emplace_back(**(inputs + i));
+    }
+    bool is_ready = false;
+    CHECK(compiled_partition->constants_ready(ins, is_ready));
+    *ready = is_ready;
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_get_temporary_arena_size(size_t *size,
+        size_t num_compiled_partitions,
+        const compiled_partition_t *const *compiled_partitions) {
+    if (size == nullptr) return status::invalid_arguments;
+    if (num_compiled_partitions > 0 && compiled_partitions == nullptr)
+        return status::invalid_arguments;
+
+    // The temporary memory of an execution is released when the execution
+    // returns, so the lifetimes of the temporaries of partitions executed
+    // one after another do not overlap and all of them are placed at the
+    // start of the arena.
+    *size = 0;
+    for (size_t i = 0; i < num_compiled_partitions; ++i) {
+        if (compiled_partitions[i] == nullptr)
+            return status::invalid_arguments;
+        *size = std::max(*size, compiled_partitions[i]->get_temporary_size());
+    }
+    return status::success;
+}
+
 status_t dnnl_graph_partition::infer_shape(
         std::vector<const logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs) {
@@ -594,8 +904,16 @@ status_t dnnl_graph_partition::compile(compiled_partition_t *cp,
     // safely use blocked layout to improve performance. Otherwise, we must
     // use plain layout, since: 1. plain layout usually give optimal layout
     // on CPU. 2. we don't want to pass blocked layout cross backends.
-    const bool can_use_blocked_layout
-            = effective_backends == 1 && kind == engine_kind::gpu;
+    // Blocked layout can be enabled on CPU with
+    // ONEDNN_GRAPH_CPU_BLOCKED_LAYOUT, then the outputs with `any` layout keep
+    // the blocked layouts chosen by the backend and the next partitions take
+    // them without reorders. The variable is read at every compilation, which
+    // is cheap compared to it.
+    const bool cpu_blocked_layout
+            = dnnl::impl::getenv_int_user("GRAPH_CPU_BLOCKED_LAYOUT", 0) > 0;
+    const bool can_use_blocked_layout = effective_backends == 1
+            && (kind == engine_kind::gpu
+                    || (kind == engine_kind::cpu && cpu_blocked_layout));
     const_cast<partition_impl_t *>(pimpl_.get())
             ->set_use_blocked_layout(can_use_blocked_layout);
 
@@ -625,9 +943,16 @@ status_t dnnl_graph_partition::compile(compiled_partition_t *cp,
 #endif
 
     // The impl's compile will generate the compiled_partition_impl and
-    // modify the given inputs outputs logical tensor
-    ret = pimpl_->compile(cp, tmp_inputs, tmp_outputs, aengine);
+    // modify the given inputs outputs logical tensor. The cache blobs of the
+    // primitives it creates are recorded to be exported with the compiled
+    // partition.
+    auto bundle = std::make_shared<dnnl::impl::persistent_cache::bundle_t>();
+    {
+        dnnl::impl::persistent_cache::bundle_scope_t scope(*bundle);
+        ret = pimpl_->compile(cp, tmp_inputs, tmp_outputs, aengine);
+    }
     if (status::success != ret) return ret;
+    if (cp->pimpl_) cp->pimpl_->set_cache_bundle(bundle);
 
     // Post-process the modified logical tensor and store them
     // to compiled_partition_impl. The post-process includes
@@ -687,6 +1012,31 @@ status_t dnnl_graph_partition::compile(
 
     return result.status;
 }
+
+status_t dnnl_graph_compiled_partition::prepare_constants(
+        const stream_t *astream, const std::vector<tensor_t> &inputs) const {
+    if (!astream || (astream->engine()->kind() != pimpl_->get_engine()->kind()))
+        return status::invalid_arguments;
+
+    const backend_t *backend = src_partition_.get_assigned_backend();
+    if (!backend) return status::invalid_arguments;
+
+    std::vector<tensor_t> processed_inputs;
+    pre_process(processed_inputs, inputs, backend);
+    return pimpl_->prepare_constants(astream, processed_inputs);
+}
+
+status_t dnnl_graph_compiled_partition::constants_ready(
+        const std::vector<tensor_t> &inputs, bool &ready) const {
+    const backend_t *backend = src_partition_.get_assigned_backend();
+    if (!backend) return status::invalid_arguments;
+
+    std::vector<tensor_t> processed_inputs;
+    pre_process(processed_inputs, inputs, backend);
+    ready = pimpl_->constants_ready(processed_inputs);
+    return status::success;
+}
+
 status_t dnnl_graph_compiled_partition::reset_engine(const engine_t *e) {
     return pimpl_->reset_engine(e);
 }
@@ -206,6 +206,20 @@ public:
 
     const graph::engine_t *get_engine() const { return pimpl_->get_engine(); }
 
+    size_t get_temporary_size() const {
+        return pimpl_ ? pimpl_->get_temporary_size() : 0;
+    }
+
+    void set_constant_cache_priority(int32_t priority) {
+        if (pimpl_) pimpl_->set_constant_cache_priority(priority);
+    }
+
+    graph::status_t prepare_constants(const graph::stream_t *astream,
+            const std::vector<graph::tensor_t> &inputs) const;
+
+    graph::status_t constants_ready(
+            const std::vector<graph::tensor_t> &inputs, bool &ready) const;
+
     std::vector<graph::logical_tensor_t> &get_mutable_inputs() {
         return pimpl_->get_mutable_inputs();
     }
@@ -28,6 +28,7 @@
 #include <unordered_set>
 
 #include "common/engine.hpp"
+#include "common/persistent_cache.hpp"
 
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/graph_attr.hpp"
@@ -286,6 +287,40 @@ public:
 
     virtual std::string str() const { return "n/a"; }
 
+    /// The size of the temporary memory the compiled partition allocates on
+    /// every execution, which is used in C API
+    virtual size_t get_temporary_size() const { return 0; }
+
+    /// The setter for the constant tensor cache priority, which is used in C
+    /// API
+    virtual void set_constant_cache_priority(int32_t priority) {
+        UNUSED(priority);
+    }
+
+    /// Starts computing the constants of the given inputs into the constant
+    /// tensor cache in the background, and the query of whether they are
+    /// computed, which are used in C API
+    virtual status_t prepare_constants(
+            const stream_t *astream, const std::vector<tensor_t> &inputs) {
+        UNUSED(astream);
+        UNUSED(inputs);
+        return status::unimplemented;
+    }
+    virtual bool constants_ready(const std::vector<tensor_t> &inputs) const {
+        UNUSED(inputs);
+        return false;
+    }
+
+    /// The setter and getter for the cache blobs of the primitives created on
+    /// compilation, which are used in C API to export the compiled partition
+    void set_cache_bundle(
+            const std::shared_ptr<const persistent_cache::bundle_t> &bundle) {
+        cache_bundle_ = bundle;
+    }
+    const persistent_cache::bundle_t *get_cache_bundle() const {
+        return cache_bundle_.get();
+    }
+
     /// The getters for engine_, which is used in C API implementation
     const engine_t *get_engine() const { return engine_; }
 
@@ -400,6 +435,9 @@ protected:
     /// If B and C can share same buffer, then the inplace_pairs_
     /// should be [{2, 3}]
     std::vector<inplace_pair_t> inplace_pairs_;
+
+    /// The cache blobs of the primitives created on compilation.
+    std::shared_ptr<const persistent_cache::bundle_t> cache_bundle_;
 };
 
 } // namespace graph
@@ -0,0 +1,44 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_graph_threadpool.h"
+
+#include "graph/interface/c_types_map.hpp"
+#include "graph/interface/threadpool_event.hpp"
+
+#include "graph/utils/utils.hpp"
+
+using namespace dnnl::impl::graph;
+
+status_t DNNL_API dnnl_graph_threadpool_interop_event_wait(
+        const threadpool_event_t *event) {
+    if (utils::any_null(event)) return status::invalid_arguments;
+    return event->get_state()->wait();
+}
+
+status_t DNNL_API dnnl_graph_threadpool_interop_event_query_completed(
+        const threadpool_event_t *event, uint8_t *is_completed) {
+    if (utils::any_null(event, is_completed))
+        return status::invalid_arguments;
+    *is_completed = event->get_state()->is_completed() ? 1 : 0;
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_threadpool_interop_event_destroy(
+        threadpool_event_t *event) {
+    delete event;
+    return status::success;
+}
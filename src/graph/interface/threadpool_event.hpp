@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_INTERFACE_THREADPOOL_EVENT_HPP
+#define GRAPH_INTERFACE_THREADPOOL_EVENT_HPP
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+#include "graph/interface/c_types_map.hpp"
+
+// The completion of a compiled partition execution enqueued to a threadpool
+// stream. The state is shared with the enqueued task and with the tasks that
+// depend on it, so the event can be destroyed before it is completed.
+struct dnnl_graph_threadpool_event {
+public:
+    struct state_t {
+        void complete(dnnl::impl::graph::status_t status) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                status_ = status;
+                is_completed_ = true;
+            }
+            cv_.notify_all();
+        }
+
+        dnnl::impl::graph::status_t wait() {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return is_completed_; });
+            return status_;
+        }
+
+        bool is_completed() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return is_completed_;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool is_completed_ = false;
+        dnnl::impl::graph::status_t status_
+                = dnnl::impl::graph::status::success;
+    };
+
+    dnnl_graph_threadpool_event() : state_(std::make_shared<state_t>()) {}
+
+    const std::shared_ptr<state_t> &get_state() const { return state_; }
+
+private:
+    std::shared_ptr<state_t> state_;
+};
+
+#endif
@@ -134,6 +134,7 @@ status_t dnnl_ocl_interop_memory_get_mem_object(
     bool args_ok = (memory->engine()->runtime_kind() == runtime_kind::ocl);
     if (!args_ok) return status::invalid_arguments;
 
+    memory->untrack_padding();
     void *handle;
     status_t status = memory->get_data_handle(&handle);
     if (status == status::success) *mem_object = static_cast<cl_mem>(handle);
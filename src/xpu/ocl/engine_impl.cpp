@@ -34,8 +34,13 @@ status_t engine_impl_t::create_memory_storage(memory_storage_t **storage,
     assert(engine->impl() == this);
 
     if (flags & memory_flags_t::prefer_device_usm) {
+        const bool use_pool = flags & memory_flags_t::use_pool;
         _storage.reset(new xpu::ocl::usm_memory_storage_t(
-                engine, xpu::ocl::usm::kind_t::device));
+                engine, xpu::ocl::usm::kind_t::device, use_pool));
+    } else if ((flags & memory_flags_t::alloc)
+            && engine->use_zero_copy_memory()) {
+        _storage.reset(new xpu::ocl::usm_memory_storage_t(
+                engine, xpu::ocl::usm::kind_t::shared));
     } else
         _storage.reset(new xpu::ocl::buffer_memory_storage_t(engine));
 
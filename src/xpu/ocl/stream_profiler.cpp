@@ -32,6 +32,19 @@ namespace impl {
 namespace xpu {
 namespace ocl {
 
+static status_t get_event_times(
+        const xpu::stream_profiler_t::registered_event_t &ev, cl_ulong &beg,
+        cl_ulong &end) {
+    const xpu::ocl::event_t &ocl_event
+            = *utils::downcast<xpu::ocl::event_t *>(ev.event.get());
+    assert(ocl_event.size() == 1);
+    OCL_CHECK(clGetEventProfilingInfo(ocl_event[0].get(),
+            CL_PROFILING_COMMAND_START, sizeof(beg), &beg, nullptr));
+    OCL_CHECK(clGetEventProfilingInfo(ocl_event[0].get(),
+            CL_PROFILING_COMMAND_END, sizeof(end), &end, nullptr));
+    return status::success;
+}
+
 status_t stream_profiler_t::get_info(profiling_data_kind_t data_kind,
         int *num_entries, uint64_t *data) const {
     if (!num_entries) return status::invalid_arguments;
@@ -51,30 +64,37 @@ status_t stream_profiler_t::get_info(profiling_data_kind_t data_kind,
     std::map<uint64_t, xpu::stream_profiler_t::entry_t> stamp2entry;
     int idx = 0;
     for (auto &ev : events_) {
-        const xpu::ocl::event_t &ocl_event
-                = *utils::downcast<xpu::ocl::event_t *>(ev.event.get());
-        cl_ulong beg, end;
-        assert(ocl_event.size() == 1);
-        OCL_CHECK(clGetEventProfilingInfo(ocl_event[0].get(),
-                CL_PROFILING_COMMAND_START, sizeof(beg), &beg, nullptr));
-        OCL_CHECK(clGetEventProfilingInfo(ocl_event[0].get(),
-                CL_PROFILING_COMMAND_END, sizeof(end), &end, nullptr));
         if (is_per_kernel) {
+            cl_ulong beg, end;
+            CHECK(get_event_times(ev, beg, end));
             data[idx++] = static_cast<uint64_t>(end - beg);
             continue;
         }
-        auto &entry = stamp2entry[ev.stamp];
-        entry.min_nsec = std::min(entry.min_nsec, beg);
-        entry.max_nsec = std::max(entry.max_nsec, end);
-        const auto *gpu_stream
-                = utils::downcast<const gpu::stream_t *>(stream_);
-        entry.freq += gpu_stream->get_freq(*ev.event);
-        entry.kernel_count++;
+        CHECK(add_event(stamp2entry[ev.stamp], ev));
     }
     if (is_per_kernel) return status::success;
     return xpu::stream_profiler_t::get_info_impl(stamp2entry, data_kind, data);
 }
 
+status_t stream_profiler_t::get_last_entry(
+        xpu::stream_profiler_t::entry_t &entry) const {
+    entry = xpu::stream_profiler_t::entry_t();
+    for (auto it = events_.rbegin(); it != events_.rend(); ++it) {
+        if (it->stamp != stamp_) break;
+        CHECK(add_event(entry, *it));
+    }
+    return status::success;
+}
+
+status_t stream_profiler_t::add_event(xpu::stream_profiler_t::entry_t &entry,
+        const registered_event_t &ev) const {
+    cl_ulong beg, end;
+    CHECK(get_event_times(ev, beg, end));
+    const auto *gpu_stream = utils::downcast<const gpu::stream_t *>(stream_);
+    entry.add(beg, end, gpu_stream->get_counters(*ev.event));
+    return status::success;
+}
+
 } // namespace ocl
 } // namespace xpu
 } // namespace impl
@@ -32,6 +32,10 @@ struct stream_profiler_t : public xpu::stream_profiler_t {
 
     status_t get_info(profiling_data_kind_t data_kind, int *num_entries,
             uint64_t *data) const override;
+    status_t get_last_entry(entry_t &entry) const override;
+
+private:
+    status_t add_event(entry_t &entry, const registered_event_t &ev) const;
 };
 
 } // namespace ocl
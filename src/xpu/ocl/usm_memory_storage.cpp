@@ -16,6 +16,7 @@
 
 #include <CL/cl.h>
 
+#include "common/host_staging_pool.hpp"
 #include "common/memory_map_manager.hpp"
 
 #include "xpu/ocl/usm_memory_storage.hpp"
@@ -43,22 +44,37 @@ status_t usm_memory_storage_t::map_data(
 
     if (!stream) CHECK(engine()->get_service_stream(stream));
 
-    void *host_ptr = usm::malloc_host(stream->engine(), size);
+    // Staging buffers are taken from the engine pool when it has one to
+    // avoid allocating and pinning host memory on every map.
+    impl::engine_t *host_engine = stream->engine();
+    host_staging_pool_t *pool = host_engine->get_host_staging_pool();
+    auto alloc_host = [host_engine](size_t sz) {
+        return usm::malloc_host(host_engine, sz);
+    };
+    auto free_host = [host_engine](void *p) { usm::free(host_engine, p); };
+    void *host_ptr = pool ? pool->acquire(size, alloc_host, free_host)
+                          : alloc_host(size);
     if (!host_ptr) return status::out_of_memory;
 
-    auto leak_guard = decltype(usm_ptr_)(
-            host_ptr, [this](void *p) { usm::free(engine(), p); });
+    auto free_host_ptr = [pool, free_host](void *p) {
+        if (pool)
+            pool->release(p);
+        else
+            free_host(p);
+    };
+
+    auto leak_guard = decltype(usm_ptr_)(host_ptr, free_host_ptr);
     CHECK(usm::memcpy(stream, host_ptr, usm_ptr(), size, 0, nullptr, nullptr));
     CHECK(stream->wait());
     leak_guard.release();
 
     auto *usm_ptr_for_unmap = usm_ptr();
-    auto unmap_callback = [size, usm_ptr_for_unmap](
+    auto unmap_callback = [size, usm_ptr_for_unmap, free_host_ptr](
                                   impl::stream_t *stream, void *mapped_ptr) {
         CHECK(usm::memcpy(stream, usm_ptr_for_unmap, mapped_ptr, size, 0,
                 nullptr, nullptr));
         CHECK(stream->wait());
-        usm::free(stream->engine(), mapped_ptr);
+        free_host_ptr(mapped_ptr);
         return status::success;
     };
 
@@ -22,6 +22,8 @@
 #include <functional>
 
 #include "common/c_types_map.hpp"
+#include "common/device_memory_pool.hpp"
+#include "common/engine.hpp"
 #include "common/memory_storage.hpp"
 #include "common/utils.hpp"
 
@@ -37,8 +39,9 @@ class usm_memory_storage_t : public memory_storage_base_t {
 public:
     using memory_storage_base_t::memory_storage_base_t;
 
-    usm_memory_storage_t(impl::engine_t *engine, usm::kind_t kind)
-        : memory_storage_base_t(engine), usm_kind_(kind) {}
+    usm_memory_storage_t(
+            impl::engine_t *engine, usm::kind_t kind, bool use_pool = false)
+        : memory_storage_base_t(engine), usm_kind_(kind), use_pool_(use_pool) {}
 
     void *usm_ptr() const { return usm_ptr_.get(); }
 
@@ -72,10 +75,30 @@ public:
 protected:
     status_t init_allocate(size_t size) override {
         using kind_t = usm::kind_t;
-        if (usm_kind_ == kind_t::unknown) usm_kind_ = kind_t::device;
+        // Memory of an unknown kind is allocated on the device, or in memory
+        // shared with the host in the zero-copy mode.
+        if (usm_kind_ == kind_t::unknown)
+            usm_kind_ = engine()->use_zero_copy_memory() ? kind_t::shared
+                                                         : kind_t::device;
 
         void *usm_ptr_alloc = nullptr;
 
+        // Device memory may come from the engine pool, which outlives this
+        // storage, so its functions must not refer to it.
+        auto *pool = engine()->get_device_memory_pool();
+        if (use_pool_ && pool && usm_kind_ == kind_t::device) {
+            impl::engine_t *eng = engine();
+            usm_ptr_alloc = pool->acquire(
+                    size,
+                    [eng](size_t s) { return usm::malloc_device(eng, s); },
+                    [eng](void *ptr) { usm::free(eng, ptr); });
+            if (!usm_ptr_alloc) return status::out_of_memory;
+
+            usm_ptr_ = decltype(usm_ptr_)(
+                    usm_ptr_alloc, [pool](void *ptr) { pool->release(ptr); });
+            return status::success;
+        }
+
         switch (usm_kind_) {
             case kind_t::host:
                 usm_ptr_alloc = usm::malloc_host(engine(), size);
@@ -98,6 +121,7 @@ protected:
 private:
     std::unique_ptr<void, std::function<void(void *)>> usm_ptr_;
     usm::kind_t usm_kind_ = usm::kind_t::unknown;
+    bool use_pool_ = false;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(usm_memory_storage_t);
 };
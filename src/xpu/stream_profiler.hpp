@@ -17,6 +17,7 @@
 #ifndef XPU_STREAM_PROFILER_HPP
 #define XPU_STREAM_PROFILER_HPP
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
 #include <map>
@@ -36,13 +37,38 @@ struct stream_profiler_t {
         : stamp_(stamp), stream_(stream) {}
     virtual ~stream_profiler_t() = default;
 
+    // Hardware counters of a kernel: the frequency in Hz, the fractions of
+    // the kernel time the execution units were active and stalled, and the
+    // bytes transferred to and from GPU memory.
+    struct counters_t {
+        double freq = 0;
+        double eu_active = 0;
+        double eu_stall = 0;
+        double mem_bytes = 0;
+    };
+
     struct entry_t {
         uint64_t min_nsec = std::numeric_limits<uint64_t>::max();
         uint64_t max_nsec = 0;
         double freq = 0;
+        // The counters summed over kernels, with the fractions weighted by
+        // the kernel time.
+        double eu_active_nsec = 0;
+        double eu_stall_nsec = 0;
+        double mem_bytes = 0;
         int kernel_count = 0;
 
         uint64_t get_nsec() const { return max_nsec - min_nsec; }
+
+        void add(uint64_t beg, uint64_t end, const counters_t &counters) {
+            min_nsec = std::min(min_nsec, beg);
+            max_nsec = std::max(max_nsec, end);
+            freq += counters.freq;
+            eu_active_nsec += counters.eu_active * (double)(end - beg);
+            eu_stall_nsec += counters.eu_stall * (double)(end - beg);
+            mem_bytes += counters.mem_bytes;
+            kernel_count++;
+        }
     };
 
     struct registered_event_t {
@@ -57,6 +83,11 @@ struct stream_profiler_t {
     virtual status_t get_info(profiling_data_kind_t data_kind, int *num_entries,
             uint64_t *data) const = 0;
 
+    // Returns the entry of the latest stamp, for the verbose output.
+    virtual status_t get_last_entry(entry_t &entry) const {
+        return status::unimplemented;
+    }
+
     uint64_t stamp() const { return stamp_; }
 
     void register_event(std::unique_ptr<xpu::event_t> &&event) {
@@ -105,7 +136,16 @@ protected:
                     if (callback_) callback_(kv.first, e.get_nsec());
                     break;
                 }
-                default: assert(!"unexpected data kind");
+                case profiling_data_kind::eu_active_time:
+                    data[idx] = static_cast<uint64_t>(e.eu_active_nsec);
+                    break;
+                case profiling_data_kind::eu_stall_time:
+                    data[idx] = static_cast<uint64_t>(e.eu_stall_nsec);
+                    break;
+                case profiling_data_kind::memory_bytes:
+                    data[idx] = static_cast<uint64_t>(e.mem_bytes);
+                    break;
+                default: return status::invalid_arguments;
             }
             idx++;
         }
@@ -34,8 +34,9 @@ status_t engine_impl_t::create_memory_storage(memory_storage_t **storage,
     assert(engine->impl() == this);
 
     if (flags & memory_flags_t::prefer_device_usm) {
+        const bool use_pool = flags & memory_flags_t::use_pool;
         _storage.reset(new xpu::sycl::usm_memory_storage_t(
-                engine, ::sycl::usm::alloc::device));
+                engine, ::sycl::usm::alloc::device, use_pool));
     } else
         _storage.reset(new xpu::sycl::buffer_memory_storage_t(engine));
 
@@ -16,6 +16,7 @@
 
 #include "xpu/sycl/usm_memory_storage.hpp"
 
+#include "common/host_staging_pool.hpp"
 #include "common/memory.hpp"
 #include "common/memory_map_manager.hpp"
 #include "common/stream.hpp"
@@ -60,20 +61,33 @@ status_t usm_memory_storage_t::map_data(
             = *utils::downcast<xpu::sycl::stream_impl_t *>(stream->impl())
                        ->queue();
 
-    void *host_ptr = ::sycl::malloc_host(size, sycl_queue.get_context());
+    // Staging buffers are taken from the engine pool when it has one to
+    // avoid allocating and pinning host memory on every map.
+    host_staging_pool_t *pool = stream->engine()->get_host_staging_pool();
+    ::sycl::context sycl_ctx = sycl_queue.get_context();
+    auto alloc_host = [sycl_ctx](size_t sz) {
+        return ::sycl::malloc_host(sz, sycl_ctx);
+    };
+    auto free_host = [sycl_ctx](void *p) { ::sycl::free(p, sycl_ctx); };
+    void *host_ptr = pool ? pool->acquire(size, alloc_host, free_host)
+                          : alloc_host(size);
     if (!host_ptr) return status::out_of_memory;
 
     sycl_queue.wait_and_throw();
     sycl_queue.memcpy(host_ptr, usm_ptr, size).wait();
 
     *mapped_ptr = host_ptr;
-    auto unmap_callback = [usm_ptr, size](stream_t *stream, void *mapped_ptr) {
+    auto unmap_callback = [usm_ptr, size, pool, free_host](
+                                  stream_t *stream, void *mapped_ptr) {
         ::sycl::queue sycl_queue
                 = *utils::downcast<xpu::sycl::stream_impl_t *>(stream->impl())
                            ->queue();
         sycl_queue.wait_and_throw();
         sycl_queue.memcpy(usm_ptr, mapped_ptr, size).wait();
-        ::sycl::free(mapped_ptr, sycl_queue.get_context());
+        if (pool)
+            pool->release(mapped_ptr);
+        else
+            free_host(mapped_ptr);
         return status::success;
     };
 
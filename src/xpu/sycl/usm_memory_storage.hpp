@@ -19,6 +19,7 @@
 
 #include "oneapi/dnnl/dnnl_config.h"
 
+#include "common/device_memory_pool.hpp"
 #include "common/engine.hpp"
 #include "common/memory_storage.hpp"
 #include "common/utils.hpp"
@@ -37,8 +38,11 @@ class usm_memory_storage_t : public memory_storage_base_t {
 public:
     using memory_storage_base_t::memory_storage_base_t;
 
-    usm_memory_storage_t(engine_t *engine, ::sycl::usm::alloc usm_kind)
-        : memory_storage_base_t(engine), usm_kind_(usm_kind) {}
+    usm_memory_storage_t(engine_t *engine, ::sycl::usm::alloc usm_kind,
+            bool use_pool = false)
+        : memory_storage_base_t(engine)
+        , usm_kind_(usm_kind)
+        , use_pool_(use_pool) {}
     ~usm_memory_storage_t() override = default;
 
     uint8_t *usm_ptr() const { return static_cast<uint8_t *>(usm_ptr_.get()); }
@@ -120,10 +124,33 @@ protected:
         auto &sycl_ctx = sycl_engine_impl->context();
         using ::sycl::usm::alloc;
 
-        if (usm_kind_ == alloc::unknown) usm_kind_ = alloc::device;
+        // Memory of an unknown kind is allocated on the device, or in memory
+        // shared with the host in the zero-copy mode.
+        if (usm_kind_ == alloc::unknown)
+            usm_kind_ = engine()->use_zero_copy_memory() ? alloc::shared
+                                                         : alloc::device;
 
         void *usm_ptr_alloc = nullptr;
 
+        // Device memory may come from the engine pool, which outlives this
+        // storage, so its functions must not refer to it.
+        auto *pool = engine()->get_device_memory_pool();
+        if (use_pool_ && pool && usm_kind_ == alloc::device) {
+            ::sycl::device dev = sycl_dev;
+            ::sycl::context ctx = sycl_ctx;
+            usm_ptr_alloc = pool->acquire(
+                    size,
+                    [dev, ctx](size_t s) {
+                        return ::sycl::malloc_device(s, dev, ctx);
+                    },
+                    [ctx](void *ptr) { ::sycl::free(ptr, ctx); });
+            if (!usm_ptr_alloc) return status::out_of_memory;
+
+            usm_ptr_ = decltype(usm_ptr_)(
+                    usm_ptr_alloc, [pool](void *ptr) { pool->release(ptr); });
+            return status::success;
+        }
+
         switch (usm_kind_) {
             case alloc::host:
                 usm_ptr_alloc = ::sycl::malloc_host(size, sycl_ctx);
@@ -146,6 +173,7 @@ protected:
 private:
     std::unique_ptr<void, std::function<void(void *)>> usm_ptr_;
     ::sycl::usm::alloc usm_kind_ = ::sycl::usm::alloc::unknown;
+    bool use_pool_ = false;
 };
 
 } // namespace sycl
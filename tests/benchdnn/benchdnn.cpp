@@ -68,6 +68,16 @@ int fix_times_per_prb {default_fix_times_per_prb};
 int default_fix_times_per_prb {0};
 int repeats_per_prb {default_repeats_per_prb};
 int default_repeats_per_prb {1};
+double default_peak_bw {0};
+double peak_bw {default_peak_bw};
+double default_peak_flops {0};
+double peak_flops {default_peak_flops};
+bool default_steady_warmup {false};
+bool steady_warmup {default_steady_warmup};
+std::string default_pmu_events;
+std::string pmu_events {default_pmu_events};
+bool default_measure_energy {false};
+bool measure_energy {default_measure_energy};
 
 bool default_fast_ref {DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE};
 bool fast_ref {default_fast_ref};
@@ -131,6 +131,11 @@ struct perf_report_t : public base_perf_report_t {
 
     void dump_desc_csv(std::ostream &s) const override { dump_desc(s); }
 
+    // A single operation per destination element.
+    double ops() const override {
+        return (double)p_->nelems(p_->n_inputs(), -1);
+    }
+
     const std::vector<dnnl_data_type_t> *sdt() const override {
         return &p_->sdt;
     }
@@ -49,6 +49,7 @@ const flags_t USE_SHIFT = dnnl_use_shift;
 const flags_t FUSE_NORM_RELU = dnnl_fuse_norm_relu;
 const flags_t FUSE_NORM_ADD_RELU = dnnl_fuse_norm_add_relu;
 const flags_t USE_RMS_NORM = dnnl_rms_norm;
+const flags_t FUSE_ADD_NORM = dnnl_fuse_add_norm;
 flags_t str2flags(const char *str);
 std::string flags2str(flags_t flags);
 
@@ -238,6 +239,12 @@ struct perf_report_t : public base_perf_report_t {
         s << flags2str(p_->flags);
     }
 
+    double ops() const override {
+        const double nelems
+                = (double)p_->mb * p_->ic * p_->id * p_->ih * p_->iw;
+        return norm_ops_per_elem(p_->dir, p_->use_stats()) * nelems;
+    }
+
     const attr_t *attr() const override { return &p_->attr; }
     const thr_ctx_t *ctx_init() const override { return &p_->ctx_init; }
     const thr_ctx_t *ctx_exe() const override { return &p_->ctx_exe; }
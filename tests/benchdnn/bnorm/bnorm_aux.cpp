@@ -71,6 +71,7 @@ std::string flags2str(flags_t flags) {
     if (flags & FUSE_NORM_RELU) str += "R";
     if (flags & FUSE_NORM_ADD_RELU) str += "A";
     if (flags & USE_RMS_NORM) str += "M";
+    if (flags & FUSE_ADD_NORM) str += "S";
     return str;
 }
 
@@ -17,6 +17,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <sstream>
+
 #include "dnnl_common.hpp"
 #include "utils/parser.hpp"
 
@@ -62,6 +64,102 @@ void check_correctness(const settings_t &s) {
     }
 }
 
+// Returns the candidates of `cands` dividing `dim`, and `dim` itself when it
+// doesn't exceed `max_blk`.
+static std::vector<int64_t> get_blk_candidates(
+        int64_t dim, const std::vector<int64_t> &cands, int64_t max_blk) {
+    std::vector<int64_t> blks;
+    for (auto b : cands)
+        if (b < dim && dim % b == 0) blks.push_back(b);
+    if (dim <= max_blk) blks.push_back(dim);
+    return blks;
+}
+
+// Splits the problem into kernel calls over the candidate blockings and
+// batch sizes, with dense or problem-wide leading dimensions and different
+// prefetching hints, and reports a CSV line per kernel configuration. The
+// time of the problem is estimated as the time of a kernel call multiplied
+// by the number of calls.
+void sweep(const settings_t &s) {
+    const auto &src_dims = s.prb_vdims.vdims[0];
+    const auto &wei_dims = s.prb_vdims.vdims[1];
+    const int64_t M = src_dims[0], K = src_dims[1], N = wei_dims[1];
+
+    // Batching over K requires K blocks divisible by the weights block of
+    // all data types, see `prb_t::check_block_size()`.
+    const auto m_blks = get_blk_candidates(M, {8, 16, 32, 64}, 64);
+    const auto n_blks = get_blk_candidates(N, {16, 32, 48, 64}, 64);
+    const auto k_blks = get_blk_candidates(K, {64, 128, 256, 512}, K);
+    // `hint_prefetching` takes `brgemm_kernel_prefetching_t` values.
+    const std::vector<std::pair<std::string, std::string>> prefetches = {
+            {"default", ""},
+            {"prf0", "hint_prefetching:2"},
+            {"prf1", "hint_prefetching:3"},
+            {"prf2", "hint_prefetching:4"},
+    };
+
+    const bool report = has_bench_mode_bit(mode_bit_t::perf);
+    if (report)
+        BENCHDNN_PRINT(0, "%s\n",
+                "sweep,M,N,K,dt,brgemm_attr,m_blk,n_blk,k_blk,bs,lda,ldb,ldd,"
+                "prefetch,impl,min_ms,avg_ms,calls,est_ms,est_Gflops");
+
+    for_(const auto &i_dt : s.dt)
+    for_(const auto &i_bia_dt : s.bia_dt)
+    for_(const auto &i_stag : s.stag)
+    for_(const auto &i_wtag : s.wtag)
+    for_(const auto &i_dtag : s.dtag)
+    for_(const auto &i_strides : s.strides)
+    for_(const auto &i_alpha : s.alpha)
+    for_(const auto &i_beta : s.beta)
+    for_(const auto &i_brgemm_attr : s.brgemm_attr)
+    for_(const auto &i_batch_kind : s.batch_kind)
+    for_(const auto &i_attr : s.attributes)
+    for_(const auto &i_ctx_init : s.ctx_init)
+    for_(const auto &i_ctx_exe : s.ctx_exe)
+    for_(auto m_blk : m_blks)
+    for_(auto n_blk : n_blks)
+    for_(auto k_blk : k_blks)
+    for_(bool full_ld : {false, true})
+    for (const auto &prf : prefetches) {
+        // Problem-wide leading dimensions differ from dense ones only when
+        // N is split.
+        if (full_ld && n_blk == N) continue;
+        const std::vector<int64_t> ld = full_ld
+                ? std::vector<int64_t> {0, rnd_up(N, 16), N}
+                : std::vector<int64_t> {};
+        std::string brgemm_attr = i_brgemm_attr;
+        if (!prf.second.empty())
+            brgemm_attr += (brgemm_attr.empty() ? "" : "+") + prf.second;
+
+        const int bs = static_cast<int>(K / k_blk);
+        const prb_vdims_t blk_vdims(vdims_t {{m_blk, k_blk}, {k_blk, n_blk}});
+        const prb_t prb(blk_vdims, i_dt, i_stag, i_wtag, i_dtag, i_strides, ld,
+                i_bia_dt, i_alpha, i_beta, bs, brgemm_attr, i_batch_kind,
+                i_attr, i_ctx_init, i_ctx_exe, s.impl_filter);
+        if (s.pattern && !match_regex(prb.str(), s.pattern)) continue;
+        BENCHDNN_PRINT(1, "run: %s\n", prb.str());
+
+        res_t res {};
+        doit(&prb, &res);
+        parse_result(res, prb.str());
+        if (!report || res.state == SKIPPED || res.state == FAILED) continue;
+
+        const auto &t = res.timer_map.perf_timer();
+        const int64_t calls = (M / m_blk) * (N / n_blk);
+        const double est_ms = t.ms(timer::timer_t::min) * calls;
+        const double gflops = est_ms > 0 ? 2e-6 * M * N * K / est_ms : 0;
+        std::stringstream ss;
+        ss << "sweep," << M << "," << N << "," << K << "," << prb.dt << ","
+           << i_brgemm_attr << "," << m_blk << "," << n_blk << "," << k_blk
+           << "," << bs << "," << prb.get_lda() << "," << prb.get_ldb() << ","
+           << prb.get_ldd() << "," << prf.first << "," << res.impl_name << ","
+           << t.ms(timer::timer_t::min) << "," << t.ms(timer::timer_t::avg)
+           << "," << calls << "," << est_ms << "," << gflops;
+        BENCHDNN_PRINT(0, "%s\n", ss.str().c_str());
+    }
+}
+
 int verify_input(const settings_t &s, const settings_t &def) {
     static constexpr int n_inputs = 3;
 
@@ -146,9 +244,16 @@ static const std::string help_brgemm_attr
         = "STRING    (Default: empty)\n    Specifies BRGeMM kernel attributes. "
           "If some values are skipped, the default one will be used.\n";
 
+static const std::string help_sweep
+        = "BOOL    (Default: `false`)\n    Instructs the driver to sweep the "
+          "kernel configurations of a problem: M, N and K blocking, batch "
+          "size, leading dimensions and prefetching hints.\n    In "
+          "performance mode, a CSV line with the timings is reported per "
+          "configuration.\n";
+
 static const std::string help_batch_kind
         = "STRING    (Default: addr)\n    Specifies BRGeMM batch kind. "
-          "Supported values are: `addr`, `offs`.\n";
+          "Supported values are: `addr`, `offs`, `strd`.\n";
 
 int bench(int argc, char **argv) {
     // BRGeMM kernel support is available on x86 Intel CPU only.
@@ -177,6 +282,8 @@ int bench(int argc, char **argv) {
                         argv[0], "brgemm-attr", help_brgemm_attr)
                 || parse_vector_option(s.batch_kind, def.batch_kind, cstr2str,
                         argv[0], "batch-kind", help_batch_kind)
+                || parse_single_value_option(s.sweep, def.sweep, str2bool,
+                        argv[0], "sweep", help_sweep)
                 || parse_attributes(s, def, argv[0])
                 || parse_test_pattern_match(s.pattern, argv[0])
                 || parse_perf_template(s.perf_template,
@@ -190,7 +297,10 @@ int bench(int argc, char **argv) {
 
             SAFE(verify_input(s, def), WARN);
             s.finalize();
-            check_correctness(s);
+            if (s.sweep)
+                sweep(s);
+            else
+                check_correctness(s);
         }
     }
     return parse_last_argument();
@@ -209,6 +209,8 @@ namespace_impl::brgemm_batch_kind_t str2batch_kind(const std::string &str) {
         return namespace_impl::brgemm_batch_kind_t::brgemm_addr;
     else if (str == "offs")
         return namespace_impl::brgemm_batch_kind_t::brgemm_offs;
+    else if (str == "strd")
+        return namespace_impl::brgemm_batch_kind_t::brgemm_strd;
     assert(!"Unsupported batch kind value");
     return namespace_impl::brgemm_batch_kind_t::brgemm_batch_kind_undef;
 }
@@ -339,13 +341,15 @@ int init_kernel(kernel_args_t &kernel_args) {
     const auto isa_undef = cpu_isa_t::isa_undef;
 
     brgemm_desc_t brgemm_desc;
+    brgemm_strides_t strides {
+            prb->get_src_batch_offset(), prb->get_wei_batch_offset()};
 
     // Create BRGeMM descriptor, analogous to primitive descriptor creation
     const auto status_init = brgemm_desc_init(&brgemm_desc, isa_undef,
             batch_kind, prb->src_dt(), prb->wei_dt(), false /* transA */,
             false /* transB */, layout, prb->alpha, prb->beta, prb->get_lda(),
             prb->get_ldb(), prb->get_ldc(), prb->m, prb->n, prb->k,
-            nullptr /* strides */);
+            batch_kind == brgemm_strd ? &strides : nullptr);
     SAFE(check_dnnl_status(status_init, prb, res), WARN);
     if (res->state == SKIPPED) return OK;
 
@@ -432,6 +436,12 @@ int init_kernel(kernel_args_t &kernel_args) {
                          brgemm, prb->attr.scales.get_mask(DNNL_ARG_DST)),
                 WARN);
     }
+    if (prb->batch_kind == "strd") {
+        DNN_SAFE(dnnl_brgemm_set_batch_strides(brgemm,
+                         prb->get_src_batch_offset(),
+                         prb->get_wei_batch_offset()),
+                WARN);
+    }
     // This call is responsible whether the final configuration is supported
     // or not.
     st = dnnl_brgemm_finalize(brgemm);
@@ -639,7 +649,7 @@ dnnl_status_t brgemm_kernel_execute_postops_wrapper(
     if (batch_kind == "addr") {
         brgemm_kernel_execute_postops(brgemm_kernel, batch_size, batch_element,
                 acc_ptr, dst_ptr, post_ops_data, scratchpad_ptr);
-    } else if (batch_kind == "offs") {
+    } else if (batch_kind == "offs" || batch_kind == "strd") {
         brgemm_kernel_execute_postops(brgemm_kernel, batch_size, src_ptr,
                 wei_ptr, batch_element, acc_ptr, dst_ptr, post_ops_data,
                 scratchpad_ptr);
@@ -1321,8 +1331,10 @@ int doit(const prb_t *prb, res_t *res) {
         SAFE(wei_packed_dt.reorder(wei_dt), WARN);
     }
 
-    std::vector<dnnl_dim_t> offsets(2 * prb->batch_size);
-    for (dnnl_dim_t i = 0; i < prb->batch_size; i++) {
+    // The strided batch is executed without offsets.
+    std::vector<dnnl_dim_t> offsets(
+            prb->batch_kind == "strd" ? 0 : 2 * prb->batch_size);
+    for (size_t i = 0; i < offsets.size() / 2; i++) {
         offsets[2 * i + 0] = i * prb->get_src_batch_offset();
         offsets[2 * i + 1] = i * prb->get_wei_batch_offset();
     }
@@ -1349,7 +1361,7 @@ int doit(const prb_t *prb, res_t *res) {
         brgemm_kernel_execute_postops(brgemm_kernel, prb->batch_size,
                 v_batch_element.data(), acc_ptr, dst_ptr, post_ops_data,
                 scratchpad_ptr);
-    } else if (prb->batch_kind == "offs") {
+    } else if (prb->batch_kind == "offs" || prb->batch_kind == "strd") {
         brgemm_kernel_execute_postops(brgemm_kernel, prb->batch_size, src_ptr,
                 wei_ptr, v_batch_element.data(), acc_ptr, dst_ptr,
                 post_ops_data, scratchpad_ptr);
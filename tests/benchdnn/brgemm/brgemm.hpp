@@ -61,6 +61,7 @@ struct settings_t : public base_settings_t {
     std::vector<float> alpha {1.f}, beta {0.f};
     std::vector<std::string> brgemm_attr {std::string()};
     std::vector<std::string> batch_kind {"addr"};
+    bool sweep = false;
 
     const char *perf_template_csv() const {
         static const std::string args;
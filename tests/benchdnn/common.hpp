@@ -124,6 +124,16 @@ extern int min_times_per_prb; // min number of runs per prb
 extern int fix_times_per_prb; // if non-zero run prb that many times
 extern int default_fix_times_per_prb; // 0, rely on time criterion
 extern int repeats_per_prb; // test repeats per prb
+extern double peak_bw; // peak bandwidth in GB/s: 0 if unknown, -1 to measure
+extern double default_peak_bw; // 0, unknown
+extern double peak_flops; // peak FLOPS in GFLOPS, 0 if unknown
+extern double default_peak_flops; // 0, unknown
+extern bool steady_warmup; // skip runs until times converge before measuring
+extern bool default_steady_warmup; // false, measure from the first run
+extern std::string pmu_events; // PMU events to count in performance mode
+extern std::string default_pmu_events; // empty, no counting
+extern bool measure_energy; // measure the energy in performance mode
+extern bool default_measure_energy; // false, no measurement
 extern int default_repeats_per_prb; // default test repeats per prb
 
 extern bool fast_ref;
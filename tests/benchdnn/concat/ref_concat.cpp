@@ -39,6 +39,9 @@ void compute_ref(const prb_t *prb, dir_t dir, const args_t &args,
     int64_t outer_size {0}, inner_size {0}, axis_size {0};
     get_sizes(prb, outer_size, inner_size, axis_size);
 
+    const float dst_scale = prb->attr.scales.get(DNNL_ARG_DST).scale;
+    const int dst_zp = prb->attr.zero_points[DNNL_ARG_DST];
+
     benchdnn_parallel_nd(outer_size, inner_size, [&](int64_t ou, int64_t in) {
         int64_t off_dst = ou * axis_size * inner_size;
         for (int i_input = 0; i_input < prb->n_inputs(); ++i_input) {
@@ -49,11 +52,14 @@ void compute_ref(const prb_t *prb, dir_t dir, const args_t &args,
             float scale_i
                     = prb->attr.scales.get(DNNL_ARG_MULTIPLE_SRC + i_input)
                               .scale;
+            const int zp_i
+                    = prb->attr.zero_points[DNNL_ARG_MULTIPLE_SRC + i_input];
 
             for (int64_t as = 0; as < i_axis_size; ++as) {
                 int64_t idx = as * inner_size + in;
-                dst_ptr[off_dst + idx]
-                        = src_i.get_f32_elem(off_src + idx) * scale_i;
+                const float s = (src_i.get_f32_elem(off_src + idx) - zp_i)
+                        * scale_i;
+                dst_ptr[off_dst + idx] = s / dst_scale + dst_zp;
             }
             // the next input start point
             off_dst += i_axis_size * inner_size;
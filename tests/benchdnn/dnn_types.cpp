@@ -1045,6 +1045,22 @@ std::ostream &dump_global_params(std::ostream &s) {
         s << "--max-ms-per-prb=" << max_ms_per_prb << " ";
     if (canonical || fix_times_per_prb != default_fix_times_per_prb)
         s << "--fix-times-per-prb=" << fix_times_per_prb << " ";
+    if (canonical || peak_bw != default_peak_bw) {
+        s << "--peak-bw=";
+        if (peak_bw < 0)
+            s << "stream";
+        else
+            s << peak_bw;
+        s << " ";
+    }
+    if (canonical || peak_flops != default_peak_flops)
+        s << "--peak-flops=" << peak_flops << " ";
+    if (canonical || steady_warmup != default_steady_warmup)
+        s << "--steady-warmup=" << bool2str(steady_warmup) << " ";
+    if (canonical || pmu_events != default_pmu_events)
+        s << "--pmu=" << pmu_events << " ";
+    if (canonical || measure_energy != default_measure_energy)
+        s << "--energy=" << bool2str(measure_energy) << " ";
 
     s << "--" << driver_name << " ";
     if (canonical) s << "--canonical=" << bool2str(canonical) << " ";
@@ -1104,6 +1120,10 @@ dnnl_scratchpad_mode_t str2scratchpad_mode(const char *str) {
     if (!strncasecmp(param, str, strlen(param)))
         return dnnl_scratchpad_mode_user;
 
+    param = "stream";
+    if (!strncasecmp(param, str, strlen(param)))
+        return dnnl_scratchpad_mode_stream;
+
     assert(!"not expected");
     return attr_t::get_default_scratchpad_mode();
 }
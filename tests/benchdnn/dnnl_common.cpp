@@ -15,10 +15,14 @@
 *******************************************************************************/
 
 #include <algorithm> // for std::reverse and std::copy
+#include <chrono>
+#include <cmath>
 #include <functional> // for std::bind and std::placeholders
 #include <list>
+#include <memory>
 #include <numeric>
 #include <string> // for std::string
+#include <thread>
 #include <utility> // for std::pair
 #include <vector> // for std::vector
 
@@ -48,7 +52,10 @@
 
 #include "utils/cold_cache.hpp"
 #include "utils/dnnl_query.hpp"
+#include "utils/energy.hpp"
 #include "utils/fill.hpp"
+#include "utils/parallel.hpp"
+#include "utils/pmu.hpp"
 #include "utils/stream_kind.hpp"
 
 extern "C" dnnl_status_t dnnl_impl_notify_profiling_complete(
@@ -125,6 +132,31 @@ int get_cache_blob(std::vector<uint8_t> &cache_blob, dnnl_primitive_t prim) {
     return OK;
 }
 
+int measure_cache_blob_creation(dnnl_primitive_t prim, res_t *res) {
+    // Implementations without cache blobs, e.g., on CPU, have nothing to
+    // report.
+    size_t size = 0;
+    if (dnnl_primitive_get_cache_blob(prim, &size, nullptr) != dnnl_success
+            || size == 0)
+        return OK;
+
+    std::vector<uint8_t> cache_blob;
+    SAFE(get_cache_blob(cache_blob, prim), WARN);
+
+    // The primitive cache is disabled to make the primitive come from the
+    // cache blob.
+    const auto old_capacity = set_primitive_cache_capacity_without_clearing(0);
+    dnnl_primitive_t p {};
+    dnnl_status_t status = dnnl_success;
+    TIME_FUNC(status = dnnl_primitive_create_from_cache_blob(&p, query_pd(prim),
+                      cache_blob.size(), cache_blob.data()),
+            res, timer::names::cblob_timer);
+    set_primitive_cache_capacity_without_clearing(old_capacity);
+    auto pw = make_benchdnn_dnnl_wrapper(p);
+    DNN_SAFE(status, WARN);
+    return OK;
+}
+
 struct lru_cache_t {
     lru_cache_t(size_t capacity) : capacity_(capacity) {}
     ~lru_cache_t() = default;
@@ -495,24 +527,144 @@ void finalize() {
     finalize_tbb();
 }
 
+// Executes the problem in windows of runs until the average time of a window
+// is within a tolerance of the previous one, so that the measurements skip the
+// warm-up of caches, pages and frequency. The warm-up is bounded by a quarter
+// of the time limit per problem.
+inline int warmup_until_steady(dnnl_stream_t stream, perf_function_t &perf_func,
+        std::vector<dnnl_exec_arg_t> &dnnl_args) {
+    constexpr int window = 5;
+    constexpr double tolerance = 0.05;
+
+    timer::timer_t total;
+    double prev_avg_ms = 0;
+    while (total.ms(timer::timer_t::sum) < max_ms_per_prb / 4) {
+        timer::timer_t t;
+        for (int i = 0; i < window; i++) {
+            t.start();
+            DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+            t.stamp();
+        }
+        total.merge(t);
+        const double avg_ms = t.ms(timer::timer_t::avg);
+        if (prev_avg_ms > 0
+                && std::abs(avg_ms - prev_avg_ms) <= tolerance * prev_avg_ms)
+            break;
+        prev_avg_ms = avg_ms;
+    }
+    BENCHDNN_PRINT(2, "[PERF] warm-up: times:%d time(ms):%g\n", total.times(),
+            total.ms(timer::timer_t::sum));
+    return OK;
+}
+
+// When `pmu_counts` is set, the events of `--pmu` are counted over the timed
+// executions only, and their counts per execution are returned. When `meter`
+// is set, it measures the energy of the timed loop.
 inline int measure_perf_individual(timer::timer_t &t, dnnl_stream_t stream,
-        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args) {
+        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args,
+        pmu::counts_t *pmu_counts, energy::meter_t *meter) {
+    if (steady_warmup)
+        SAFE(warmup_until_steady(stream, perf_func, dnnl_args), WARN);
+
+    pmu::counters_t counters;
+    if (pmu_counts && !pmu_events.empty()) {
+        std::vector<pmu::event_t> events;
+        SAFE(pmu::parse_events(events, pmu_events), WARN);
+        SAFE(counters.init(events), WARN);
+    }
+
     cold_cache_t cold_cache(dnnl_args, stream);
 
     t.reset();
+    if (meter) meter->start();
     while (true) {
         if (!cold_cache.update_dnnl_args(dnnl_args)) break;
         t.start();
+        counters.start();
         DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+        counters.stop();
         t.stamp();
         if (should_stop(t)) break;
     }
+    if (meter) meter->stop();
+
+    if (counters.is_initialized()) {
+        *pmu_counts = counters.read();
+        for (auto &c : *pmu_counts)
+            c.second /= MAX2(1, t.times());
+    }
+    return OK;
+}
+
+// Instances of a problem share the CPU only when the threading runtime can
+// limit the threads of each one.
+#define BENCHDNN_CPU_MULTI_INSTANCE \
+    (DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+            || DNNL_TBB_THREADING_WITH_CONSTRAINTS)
+
+// Runs `num_streams` instances of the problem at the same time, each with its
+// own stream, memory and share of the threads, the way throughput-oriented
+// deployments do. The reported timer collects the latencies of all the
+// instances, and the aggregate throughput is reported separately. The energy
+// is measured for all the instances together.
+inline int measure_perf_multi_instance(timer::timer_t &t, const thr_ctx_t &ctx,
+        const std::vector<stream_t> &v_stream, perf_function_t &perf_func,
+        std::vector<std::vector<dnnl_exec_arg_t>> &dnnl_args,
+        energy::meter_t *meter) {
+    const int nthr = ctx.max_concurrency > 0 ? ctx.max_concurrency
+                                             : benchdnn_get_max_threads();
+    thr_ctx_t inst_ctx = ctx;
+    inst_ctx.max_concurrency = MAX2(1, nthr / num_streams);
+
+    std::vector<timer::timer_t> v_t(num_streams);
+    std::vector<int> v_ret(num_streams, OK);
+    std::vector<std::thread> workers;
+    workers.reserve(num_streams);
+    // Counters of the instances would mix the threads of all of them.
+    pmu::counts_t *no_pmu_counts = nullptr;
+    energy::meter_t *no_meter = nullptr;
+
+    if (meter) meter->start();
+    const auto start = std::chrono::steady_clock::now();
+    for (int j = 0; j < num_streams; j++) {
+        workers.emplace_back([&, j]() {
+            v_ret[j] = execute_in_thr_ctx(inst_ctx, measure_perf_individual,
+                    v_t[j], v_stream[j], perf_func, dnnl_args[j],
+                    no_pmu_counts, no_meter);
+        });
+    }
+    for (auto &w : workers)
+        w.join();
+    if (meter) meter->stop();
+    const double wall_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start)
+                                   .count();
+
+    t.reset();
+    int total_times = 0;
+    for (int j = 0; j < num_streams; j++) {
+        if (v_ret[j] != OK) return v_ret[j];
+        t.merge(v_t[j]);
+        total_times += v_t[j].times();
+        BENCHDNN_PRINT(1,
+                "[PERF] instance:%d threads:%d times:%d min(ms):%g "
+                "avg(ms):%g\n",
+                j, inst_ctx.max_concurrency, v_t[j].times(),
+                v_t[j].ms(timer::timer_t::min),
+                v_t[j].ms(timer::timer_t::avg));
+    }
+    BENCHDNN_PRINT(0,
+            "[PERF] instances:%d threads-per-instance:%d throughput(1/s):%g\n",
+            num_streams, inst_ctx.max_concurrency,
+            wall_ms > 0 ? total_times * 1e3 / wall_ms : 0.);
+
     return OK;
 }
 
 inline int measure_perf_aggregate(timer::timer_t &t,
         const std::vector<stream_t> &v_stream, perf_function_t &perf_func,
-        std::vector<std::vector<dnnl_exec_arg_t>> &dnnl_args) {
+        std::vector<std::vector<dnnl_exec_arg_t>> &dnnl_args,
+        energy::meter_t *meter) {
     // There seems to be some limit to how many kernels can be queued in OCL
     // builds and 4096 seems to be a nice number under that limit.
     // Otherwise, hangs in perf validation are observed due to many kernels
@@ -538,6 +690,7 @@ inline int measure_perf_aggregate(timer::timer_t &t,
             = fix_times_per_prb ? fix_times_per_prb : min_times_per_prb;
 
     t.reset();
+    if (meter) meter->start();
     while (true) {
         // Keep separate var due to a `break` inside the loop.
         int execute_count = 0;
@@ -598,6 +751,7 @@ inline int measure_perf_aggregate(timer::timer_t &t,
             is_first_loop = false;
         }
     }
+    if (meter) meter->stop();
 
     if (use_profiling) {
         for (size_t j = 0; j < v_stream.size(); j++) {
@@ -636,18 +790,43 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
     }
     execute_unmap_args(args, dnnl_args[0]);
 
+    energy::meter_t energy_meter;
+    if (measure_energy) SAFE(energy_meter.init(), WARN);
+    energy::meter_t *meter
+            = energy_meter.is_initialized() ? &energy_meter : nullptr;
+
     auto &t = res->timer_map.perf_timer();
     // For non-DPCPP CPU: measure individual iterations.
     // For DPCPP CPU and GPU: measure iterations in batches to hide driver
     // overhead. DPCPP CPU follows the model of GPU, thus, handled similar.
     int ret = OK;
     if (is_cpu() && !is_sycl_engine(engine)) {
-        ret = execute_in_thr_ctx(ctx, measure_perf_individual, t, v_stream[0],
-                perf_func, dnnl_args[0]);
+#if BENCHDNN_CPU_MULTI_INSTANCE
+        const bool multi_instance = num_streams > 1;
+#else
+        const bool multi_instance = false;
+        static bool warned = false;
+        if (num_streams > 1 && !warned) {
+            BENCHDNN_PRINT(0, "%s\n",
+                    "WARNING: multiple CPU instances are supported with OMP "
+                    "and TBB threading runtimes only, measuring one "
+                    "instance.");
+            warned = true;
+        }
+#endif
+        if (multi_instance) {
+            ret = measure_perf_multi_instance(
+                    t, ctx, v_stream, perf_func, dnnl_args, meter);
+        } else {
+            pmu::counts_t *pmu_counts = &res->pmu_counts;
+            ret = execute_in_thr_ctx(ctx, measure_perf_individual, t,
+                    v_stream[0], perf_func, dnnl_args[0], pmu_counts, meter);
+        }
     } else {
-        ret = execute_in_thr_ctx(
-                ctx, measure_perf_aggregate, t, v_stream, perf_func, dnnl_args);
+        ret = execute_in_thr_ctx(ctx, measure_perf_aggregate, t, v_stream,
+                perf_func, dnnl_args, meter);
     }
+    if (meter) res->energy_readings = meter->read(t.times());
 
     if (ret != OK) res->state = FAILED;
     execute_map_args(args);
@@ -1104,6 +1283,53 @@ int get_gpu_cache_size(size_t &cache_size) {
     return OK;
 }
 
+// Measures the memory bandwidth of the host with the triad kernel of the
+// STREAM benchmark, `a = b + s * c`, on arrays four times larger than the
+// caches. STREAM counts two reads and one write per element.
+static double measure_stream_bw() {
+    cpu_cache_args_t cache_args;
+    SAFE_V(get_cpu_cache_size(cache_args));
+    const int64_t n = MAX2(cache_args.total_socket_size, (size_t)1 << 24)
+            * 4 / sizeof(float);
+    std::unique_ptr<float[]> a(new float[n]), b(new float[n]), c(new float[n]);
+    // The arrays are initialized in parallel to place the pages the same way
+    // as the measurements touch them.
+    benchdnn_parallel_nd(n, [&](int64_t i) {
+        a[i] = 0.f;
+        b[i] = 1.f;
+        c[i] = 2.f;
+    });
+
+    double best_ms = 0;
+    for (int r = 0; r < 5; r++) {
+        timer::timer_t t;
+        benchdnn_parallel_nd(n, [&](int64_t i) { a[i] = b[i] + 3.f * c[i]; });
+        t.stamp();
+        const double ms = t.ms();
+        if (r == 0 || ms < best_ms) best_ms = ms;
+    }
+    if (best_ms <= 0) return 0;
+    return 3. * n * sizeof(float) / (best_ms / 1e3) / 1e9;
+}
+
+double get_peak_bw() {
+    if (peak_bw >= 0) return peak_bw;
+
+    static double measured_bw = -1;
+    if (measured_bw >= 0) return measured_bw;
+
+    if (!is_cpu()) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "Warning: `--peak-bw=stream` measures the host memory only. "
+                "Please specify the peak bandwidth of the device explicitly.");
+        measured_bw = 0;
+        return measured_bw;
+    }
+    measured_bw = measure_stream_bw();
+    BENCHDNN_PRINT(1, "[PERF] STREAM triad bandwidth(GB/s): %g\n", measured_bw);
+    return measured_bw;
+}
+
 // `checkit` function verifies the amount of memory needed for the case is
 // complied with the system limits.
 //
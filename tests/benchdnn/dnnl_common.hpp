@@ -234,6 +234,9 @@ size_t get_cpu_ram_size();
 int get_gpu_ram_sizes(size_t &ram_size, size_t &max_alloc_size);
 int get_cpu_cache_size(cpu_cache_args_t &cache_args);
 int get_gpu_cache_size(size_t &cache_size);
+// Returns the peak memory bandwidth in GB/s, measured on the first call when
+// `--peak-bw=stream` is requested, or 0 if it is unknown.
+double get_peak_bw();
 
 int check_total_size(res_t *res, dnnl_primitive_t prim_ref = nullptr);
 bool is_fwd_training(dnnl_prop_kind_t prop_kind);
@@ -269,6 +272,10 @@ void skip_invalid_inplace(res_t *res, dnnl_data_type_t sdt,
         dnnl_data_type_t ddt, const std::string &stag, const std::string &dtag);
 void skip_unimplemented_arg_scale(const attr_t &attr, res_t *res);
 
+// Measures the creation of a primitive from the cache blob of `prim`, if its
+// implementation supports cache blobs.
+int measure_cache_blob_creation(dnnl_primitive_t prim, res_t *res);
+
 template <typename prb_t>
 int check_caches(benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &primw,
         const prb_t *prb, res_t *res) {
@@ -532,6 +539,9 @@ int init_prim(benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &user_prim,
     // Collect memory footprint (perf report) for a given primitive descriptor.
     SAFE(get_memory_footprint(pd, res), WARN);
 
+    if (has_bench_mode_modifier(mode_modifier_t::create_time))
+        SAFE(measure_cache_blob_creation(primw, res), WARN);
+
     if (has_bench_mode_bit(mode_bit_t::corr)) {
         // Check if adding attributes doesn't cause a fall back to another impl.
         SAFE(check_pd_w_and_wo_attr(
@@ -134,6 +134,12 @@ struct perf_report_t : public base_perf_report_t {
 
     void dump_desc_csv(std::ostream &s) const override { dump_desc(s); }
 
+    // A nominal operation per element, and the multiplication by the
+    // derivative for backward.
+    double ops() const override {
+        return (p_->dir & FLAG_FWD ? 1. : 2.) * p_->nelems(-1);
+    }
+
     const attr_t *attr() const override { return &p_->attr; }
     const thr_ctx_t *ctx_init() const override { return &p_->ctx_init; }
     const thr_ctx_t *ctx_exe() const override { return &p_->ctx_exe; }
@@ -70,13 +70,34 @@ void graph_mem_manager_t::clear_memory_pool() {
 }
 
 bool graph_mem_manager_t::enable_host_mem_pool() {
-    return (!has_bench_mode_bit(mode_bit_t::corr)) && is_cpu();
+    return (!has_bench_mode_bit(mode_bit_t::corr)) && is_cpu() && mem_reuse_;
+}
+
+void graph_mem_manager_t::record_alloc(
+        void *ptr, size_t size, bool from_system, bool pooled) {
+    if (!ptr) return;
+    std::lock_guard<std::mutex> guard(stats_lock_);
+    held_mem_[ptr] = {size, pooled};
+    held_bytes_ += size;
+    if (from_system) n_system_allocs_++;
+}
+
+bool graph_mem_manager_t::record_free(void *ptr, bool pooled_by_default) {
+    std::lock_guard<std::mutex> guard(stats_lock_);
+    const auto it = held_mem_.find(ptr);
+    if (it == held_mem_.end()) return pooled_by_default;
+    const bool pooled = it->second.pooled;
+    held_bytes_ -= it->second.size;
+    held_mem_.erase(it);
+    return pooled;
 }
 
 void *graph_mem_manager_t::host_malloc_wrapper(size_t size, size_t alignment) {
     void *ptr = nullptr;
-    if (enable_host_mem_pool()) {
-        bool need_alloc_new_mm = mem_pool_.check_allocated_mem(ptr, size);
+    bool need_alloc_new_mm = true;
+    const bool pooled = enable_host_mem_pool();
+    if (pooled) {
+        need_alloc_new_mm = mem_pool_.check_allocated_mem(ptr, size);
 
         if (need_alloc_new_mm) {
             CHECK_GRAPH_MEM_SIZE(need_mem_check_, size);
@@ -87,11 +108,12 @@ void *graph_mem_manager_t::host_malloc_wrapper(size_t size, size_t alignment) {
         if (alignment == 0) alignment = default_alignment;
         ptr = host_malloc(size, alignment);
     }
+    record_alloc(ptr, size, need_alloc_new_mm, pooled);
     return ptr;
 }
 
 void graph_mem_manager_t::host_free_wrapper(void *ptr) {
-    if (enable_host_mem_pool())
+    if (record_free(ptr, enable_host_mem_pool()))
         mem_pool_.deallocate(ptr);
     else
         host_free(ptr);
@@ -112,27 +134,33 @@ void *graph_mem_manager_t::sycl_malloc_wrapper(
         size_t size, size_t alignment, const void *dev, const void *ctx) {
     void *ptr {nullptr};
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_SYCL
-    if (!has_bench_mode_bit(mode_bit_t::corr) && is_gpu()) {
+    if (!has_bench_mode_bit(mode_bit_t::corr) && is_gpu() && mem_reuse_) {
         bool need_alloc_new_mm = mem_pool_.check_allocated_mem(ptr, size);
 
         if (need_alloc_new_mm) {
             CHECK_GRAPH_MEM_SIZE(need_mem_check_, size);
             ptr = mem_pool_.allocate(size, alignment, dev, ctx);
         }
+        record_alloc(ptr, size, need_alloc_new_mm, true);
         return ptr;
     }
 #endif
     CHECK_GRAPH_MEM_SIZE(need_mem_check_, size);
     ptr = default_sycl_malloc(size, alignment, dev, ctx);
+    record_alloc(ptr, size, true, false);
     return ptr;
 }
 
 void graph_mem_manager_t::sycl_free_wrapper(
         void *ptr, const void *device, const void *context, void *event) {
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_SYCL
-    if (!has_bench_mode_bit(mode_bit_t::corr) && is_gpu())
+    if (record_free(ptr,
+                !has_bench_mode_bit(mode_bit_t::corr) && is_gpu()
+                        && mem_reuse_))
         mem_pool_.deallocate(ptr);
     else
+#else
+    record_free(ptr, false);
 #endif
         default_sycl_free(ptr, device, context, event);
 }
@@ -153,18 +181,29 @@ void sycl_deallocator(
 void *graph_mem_manager_t::ocl_malloc_wrapper(size_t size, size_t alignment,
         cl_device_id device, cl_context context) {
     void *ptr {nullptr};
+    if (!mem_reuse_ && !has_bench_mode_bit(mode_bit_t::corr)) {
+        CHECK_GRAPH_MEM_SIZE(need_mem_check_, size);
+        ptr = ocl_malloc_device(size, alignment, device, context);
+        record_alloc(ptr, size, true, false);
+        return ptr;
+    }
+
     bool need_alloc_new_mm = mem_pool_.check_allocated_mem(ptr, size);
 
     if (need_alloc_new_mm) {
         CHECK_GRAPH_MEM_SIZE(need_mem_check_, size);
         ptr = mem_pool_.allocate(size, alignment, device, context);
     }
+    record_alloc(ptr, size, need_alloc_new_mm, true);
     return ptr;
 }
 
 void graph_mem_manager_t::ocl_free_wrapper(
         void *buf, cl_device_id device, cl_context context, cl_event event) {
-    mem_pool_.deallocate(buf);
+    if (record_free(buf, mem_reuse_ || has_bench_mode_bit(mode_bit_t::corr)))
+        mem_pool_.deallocate(buf);
+    else
+        ocl_free(buf, device, context, event);
 }
 
 void *ocl_allocator(size_t size, size_t alignment, cl_device_id device,
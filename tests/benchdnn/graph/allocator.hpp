@@ -17,6 +17,8 @@
 #ifndef BENCHDNN_GRAPH_ALLOCATOR_HPP
 #define BENCHDNN_GRAPH_ALLOCATOR_HPP
 
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "dnnl_common.hpp"
@@ -62,6 +64,16 @@ public:
 
     void clear_memory_pool();
 
+    // When `reuse` is false in performance mode, every allocation of the
+    // library gets fresh memory from the system and every release returns it.
+    void set_mem_reuse(bool reuse) { mem_reuse_ = reuse; }
+
+    // The number of allocations served by the system rather than the pool.
+    size_t get_n_system_allocs() const { return n_system_allocs_; }
+    // The size of the memory the library holds, i.e. allocated and not
+    // released yet, in bytes.
+    size_t get_held_bytes() const { return held_bytes_; }
+
 private:
     graph_mem_manager_t() : need_mem_check_(false) {}
     ~graph_mem_manager_t() = default;
@@ -84,8 +96,26 @@ private:
     }
 #endif
 
+    // The origin of the memory is recorded as the reuse setting may change
+    // between the allocation and the release, e.g. for a constant tensor
+    // cache entry, and a pool entry must go back to the pool.
+    void record_alloc(void *ptr, size_t size, bool from_system, bool pooled);
+    // Returns whether `ptr` comes from the pool, or `pooled_by_default` if
+    // it was not recorded.
+    bool record_free(void *ptr, bool pooled_by_default);
+
     bool need_mem_check_;
+    bool mem_reuse_ = true;
     simple_memory_pool_t mem_pool_;
+
+    std::mutex stats_lock_;
+    struct held_mem_t {
+        size_t size;
+        bool pooled;
+    };
+    std::unordered_map<void *, held_mem_t> held_mem_;
+    size_t held_bytes_ = 0;
+    size_t n_system_allocs_ = 0;
 };
 
 dnnl::graph::allocator &get_graph_allocator(bool use_host = false);
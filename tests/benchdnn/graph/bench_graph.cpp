@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <stdio.h>
+#include <fstream>
 #include <string>
 
 #include "flex_rewrite.hpp"
@@ -34,13 +35,16 @@ void check_correctness(const settings_t &s) {
     for_(const auto &i_dt : s.dt)
     for_(const auto &i_dt_map : s.dt_map)
     for (const auto &i_mb : s.mb) {
+        auto &graph_mem_mgr = graph_mem_manager_t::get_instance();
+        graph_mem_mgr.set_mem_reuse(s.mem_reuse);
+
         deserialized_graph_t dg;
         dg.load(locate_file(s.json_file));
 
         res_t res {};
         const auto &cpp_pstr = case_to_str(s.json_file, i_in_shapes, i_op_attrs,
                 i_fpmath_mode, i_expected_n_partition, i_mb, i_dt, i_dt_map,
-                i_op_kind_map);
+                i_op_kind_map, s.mem_reuse);
         const char *pstr = cpp_pstr.c_str();
 
         // rewrite the graph
@@ -76,11 +80,95 @@ void check_correctness(const settings_t &s) {
     }
 }
 
+// Returns the JSON files listed in a model file. Empty lines and lines
+// starting with `#` are skipped.
+std::vector<std::string> read_model_file(const std::string &model_file) {
+    std::vector<std::string> json_files;
+    std::ifstream ifs(locate_file(model_file));
+    if (!ifs.is_open()) {
+        BENCHDNN_PRINT(0, "Error: cannot open the model file \'%s\'.\n",
+                model_file.c_str());
+        SAFE_V(FAIL);
+    }
+    std::string line;
+    while (std::getline(ifs, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        json_files.push_back(line);
+    }
+    return json_files;
+}
+
+// Replays all the graphs of a model as a single problem, applying the same
+// rewriting options to each of them.
+void check_model(const settings_t &s) {
+    const auto json_files = read_model_file(s.model_file);
+
+    for_(const auto &i_in_shapes : s.in_shapes_vec)
+    for_(const auto &i_op_attrs : s.op_attrs_vec)
+    for_(const auto &i_expected_n_partition : s.expected_n_partition_vec)
+    for_(const auto &i_fpmath_mode : s.fpmath_mode_vec)
+    for_(const auto &i_op_kind_map : s.op_kind_map)
+    for_(const auto &i_dt : s.dt)
+    for_(const auto &i_dt_map : s.dt_map)
+    for (const auto &i_mb : s.mb) {
+        auto &graph_mem_mgr = graph_mem_manager_t::get_instance();
+        graph_mem_mgr.set_mem_reuse(s.mem_reuse);
+
+        res_t res {};
+        const auto &cpp_pstr = case_to_str(s.model_file, i_in_shapes,
+                i_op_attrs, i_fpmath_mode, i_expected_n_partition, i_mb, i_dt,
+                i_dt_map, i_op_kind_map, s.mem_reuse, "model");
+        const char *pstr = cpp_pstr.c_str();
+
+        flex_rewrite_t fw(i_in_shapes, i_op_attrs, i_fpmath_mode, i_mb, i_dt,
+                i_dt_map, i_op_kind_map);
+        std::vector<prb_t> prbs;
+        prbs.reserve(json_files.size());
+        bool rewritten = true;
+        for (const auto &json_file : json_files) {
+            deserialized_graph_t dg;
+            dg.load(locate_file(json_file));
+            if (fw.rewrite(dg) != OK) {
+                rewritten = false;
+                break;
+            }
+            BENCHDNN_PRINT(
+                    7, "[INFO] Graph dump:\n%s\n", dg.get_string().c_str());
+            prbs.emplace_back(dg, i_expected_n_partition);
+        }
+        if (!rewritten) {
+            res.state = UNTESTED;
+            res.reason = "Rewriting unsupported";
+            parse_result(res, pstr);
+            continue;
+        }
+        BENCHDNN_PRINT(1, "run: %s\n", pstr);
+
+        auto &tct = res.timer_map.get_timer(timer::names::test_case_timer);
+        tct.start();
+        doit_model(prbs, json_files, &res);
+        tct.stamp();
+
+        reset_graph_mem_req();
+
+        parse_result(res, pstr);
+        if (has_bench_mode_bit(mode_bit_t::perf)) {
+            perf_report_t pr(cpp_pstr, s.perf_template);
+            pr.report(&res, pstr);
+        }
+    }
+}
+
 int bench(int argc, char **argv) {
     driver_name = "graph";
     using namespace parser;
     static settings_t s;
     static const settings_t def {};
+    static const std::string help_mem_reuse
+            = "BOOL    (Default: `true`)\n    Instructs the driver to serve "
+              "the allocations of the library from a pool of the released "
+              "memory in performance mode.\n    When set to `false`, every "
+              "allocation gets fresh memory from the system.\n";
 
     for (; argc > 0; --argc, ++argv) {
         const bool parsed_options = parse_bench_settings(argv[0])
@@ -92,11 +180,18 @@ int bench(int argc, char **argv) {
                 || parse_graph_expected_n_partitions(
                         s.expected_n_partition_vec, argv[0])
                 || parse_graph_fpmath_mode(s.fpmath_mode_vec, argv[0])
-                || parse_mb(s.mb, def.mb, argv[0]) || parse_reset(s, argv[0]);
+                || parse_mb(s.mb, def.mb, argv[0])
+                || parse_single_value_option(s.mem_reuse, def.mem_reuse,
+                        str2bool, argv[0], "mem-reuse", help_mem_reuse)
+                || parse_reset(s, argv[0]);
         if (!parsed_options) {
-            if (!parse_input_file(s.json_file, argv[0]))
-                catch_unknown_options(argv[0]);
-            check_correctness(s);
+            if (parse_model_file(s.model_file, argv[0])) {
+                check_model(s);
+            } else {
+                if (!parse_input_file(s.json_file, argv[0]))
+                    catch_unknown_options(argv[0]);
+                check_correctness(s);
+            }
             flush_temp_memory();
         }
     }
@@ -350,7 +350,8 @@ std::string case_to_str(const std::string &json_file,
         const size_t expected_n_partitions, const int64_t mb,
         const dnnl_data_type_t dt,
         const std::map<size_t, dnnl_data_type_t> &dt_map,
-        const std::map<size_t, std::string> &op_kind_map) {
+        const std::map<size_t, std::string> &op_kind_map, const bool mem_reuse,
+        const std::string &case_option) {
     dnnl::impl::stringstream_t s;
     dump_global_params(s);
 
@@ -414,7 +415,9 @@ std::string case_to_str(const std::string &json_file,
           << " ";
     }
 
-    s << "--case=" << json_file;
+    if (!mem_reuse) s << "--mem-reuse=false ";
+
+    s << "--" << case_option << "=" << json_file;
     return s.str();
 }
 
@@ -547,12 +550,23 @@ int skip_unimplemented_partitions(const std::vector<partition> &partitions,
     return OK;
 }
 
-int doit(const prb_t *prb, res_t *res) {
-    if (bench_mode == bench_mode_t::list) return res->state = LISTED, OK;
-
-    skip_start(res);
-    if (res->state == SKIPPED) return OK;
+// The compiled partitions of a graph and the tensors to execute them with.
+struct graph_exec_t {
+    std::vector<compiled_partition> c_partitions;
+    std::vector<std::vector<tensor>> input_ts_all, output_ts_all;
+    // Extend the partition_mem_map_t's lifecycle as input_ts/output_ts hold
+    // the same addresses as in partition_mem_map_t for perf mode
+    // TODO: Once the API allocating memory when creating tensors is provided
+    // by the Graph library, use a single partition_mem_map_t object, and move
+    // it inside of the loop, perform tensor copy to input_ts/output_ts when
+    // make_graph_tensor
+    std::vector<partition_mem_map_t> partition_mem_map_v;
+};
 
+// Compiles and executes the partitions of the graph once, checking them in
+// correctness mode, and keeps them in `ge` for the performance measurement.
+// Returns `OK` when the testing stops expectedly, with the state in `res`.
+int init_graph_exec(const prb_t *prb, res_t *res, graph_exec_t &ge) {
     const auto &dg = prb->dg;
     const auto &graph_in_ports = dg.get_input_ports();
     auto ograph = dg.to_graph(prb->fpmath_mode);
@@ -574,15 +588,11 @@ int doit(const prb_t *prb, res_t *res) {
 
     // mark the output logical tensors of partition as ANY layout enabled
     std::unordered_set<size_t> id_to_set_any_layout;
-    std::vector<compiled_partition> c_partitions;
-    std::vector<std::vector<tensor>> input_ts_all, output_ts_all;
-    // Extend the partition_mem_map_t's lifecycle as input_ts/output_ts hold the
-    // same addresses as in partition_mem_map_t for perf mode
-    // TODO: Once the API allocating memory when creating tensors is provided by
-    // the Graph library, use a single partition_mem_map_t object, and move it
-    // inside of the loop, perform tensor copy to input_ts/output_ts when
-    // make_graph_tensor
-    std::vector<partition_mem_map_t> partition_mem_map_v(partitions.size());
+    auto &c_partitions = ge.c_partitions;
+    auto &input_ts_all = ge.input_ts_all;
+    auto &output_ts_all = ge.output_ts_all;
+    auto &partition_mem_map_v = ge.partition_mem_map_v;
+    partition_mem_map_v.resize(partitions.size());
 
     // mapping from id to queried logical tensor from compiled partition used to
     // record the logical tensors that are previously enabled with ANY layout
@@ -594,6 +604,9 @@ int doit(const prb_t *prb, res_t *res) {
         set_any_layout(dg, partitions, id_to_set_any_layout);
     }
 
+    // The compilation of all the partitions is timed as the creation.
+    auto &compile_timer = res->timer_map.cp_timer();
+    compile_timer.start();
     for (size_t i = 0; i < partitions.size(); ++i) {
         auto inputs = partitions[i].get_input_ports();
         auto outputs = partitions[i].get_output_ports();
@@ -615,6 +628,7 @@ int doit(const prb_t *prb, res_t *res) {
         record_queried_logical_tensors(
                 outputs, c_partitions.back(), id_to_queried_logical_tensors);
     }
+    compile_timer.stamp();
     if (bench_mode == bench_mode_t::init) return res->state = INITIALIZED, OK;
 
     // `idx_offset` points to the correspondent `compiled_partition`, if any
@@ -737,12 +751,105 @@ int doit(const prb_t *prb, res_t *res) {
         }
     }
 
+    return OK;
+}
+
+// Whether all the partitions were executed and can be measured.
+bool is_graph_exec_complete(const res_t *res) {
+    return res->state != SKIPPED && res->state != UNIMPLEMENTED
+            && res->state != INITIALIZED;
+}
+
+int doit(const prb_t *prb, res_t *res) {
+    if (bench_mode == bench_mode_t::list) return res->state = LISTED, OK;
+
+    skip_start(res);
+    if (res->state == SKIPPED) return OK;
+
+    graph_exec_t ge;
+    SAFE(init_graph_exec(prb, res, ge), WARN);
+    if (!is_graph_exec_complete(res)) return OK;
+
     if (has_bench_mode_bit(mode_bit_t::perf)) {
-        SAFE(measure_perf(res->timer_map.perf_timer(), c_partitions,
-                     input_ts_all, output_ts_all, res),
+        SAFE(measure_perf(res->timer_map.perf_timer(), ge.c_partitions,
+                     ge.input_ts_all, ge.output_ts_all, res),
                 WARN);
     }
 
     return OK;
 }
+
+int doit_model(const std::vector<prb_t> &prbs,
+        const std::vector<std::string> &graph_names, res_t *res) {
+    if (bench_mode == bench_mode_t::list) return res->state = LISTED, OK;
+
+    skip_start(res);
+    if (res->state == SKIPPED) return OK;
+
+    // The constant tensor cache keeps the entries of the previous problems.
+    auto &graph_mem_mgr = graph_mem_manager_t::get_instance();
+    const size_t init_held_bytes = graph_mem_mgr.get_held_bytes();
+
+    std::vector<graph_exec_t> ges(prbs.size());
+    for (size_t g = 0; g < prbs.size(); g++) {
+        BENCHDNN_PRINT(3, "[INFO]: Start graph #%zu: %s.\n", g,
+                graph_names[g].c_str());
+        SAFE(init_graph_exec(&prbs[g], res, ges[g]), WARN);
+        if (!is_graph_exec_complete(res)) return OK;
+    }
+    if (!has_bench_mode_bit(mode_bit_t::perf)) return OK;
+
+    // The graphs run one after another as the layers of the model.
+    std::vector<compiled_partition> c_partitions;
+    std::vector<std::vector<tensor>> input_ts_all, output_ts_all;
+    std::vector<size_t> partition_graphs;
+    for (size_t g = 0; g < ges.size(); g++) {
+        const auto &ge = ges[g];
+        c_partitions.insert(c_partitions.end(), ge.c_partitions.begin(),
+                ge.c_partitions.end());
+        input_ts_all.insert(input_ts_all.end(), ge.input_ts_all.begin(),
+                ge.input_ts_all.end());
+        output_ts_all.insert(output_ts_all.end(), ge.output_ts_all.begin(),
+                ge.output_ts_all.end());
+        partition_graphs.insert(
+                partition_graphs.end(), ge.c_partitions.size(), g);
+    }
+
+    // The memory the library holds after the first executions is the one of
+    // the constant tensor cache, the other allocations being released.
+    const size_t held_bytes = graph_mem_mgr.get_held_bytes() - init_held_bytes;
+    const size_t n_system_allocs = graph_mem_mgr.get_n_system_allocs();
+
+    auto &t = res->timer_map.perf_timer();
+    SAFE(measure_perf(t, c_partitions, input_ts_all, output_ts_all, res),
+            WARN);
+
+    const double compile_ms = res->timer_map.cp_timer().ms(timer::timer_t::sum);
+    const double allocs_per_run = t.times()
+            ? (double)(graph_mem_mgr.get_n_system_allocs() - n_system_allocs)
+                    / t.times()
+            : 0.;
+    BENCHDNN_PRINT(0,
+            "[PERF] model: graphs:%zu partitions:%zu compile(ms):%g "
+            "min(ms):%g avg(ms):%g constant-memory(MB):%g "
+            "system-allocations-per-run:%g\n",
+            prbs.size(), c_partitions.size(), compile_ms,
+            t.ms(timer::timer_t::min), t.ms(timer::timer_t::avg),
+            held_bytes / 1024. / 1024., allocs_per_run);
+
+    const double total_avg_ms = t.ms(timer::timer_t::avg);
+    for (size_t p = 0; p < c_partitions.size(); p++) {
+        const auto &pt = res->timer_map.get_timer(partition_timer_name(p));
+        if (!pt.times()) continue;
+        const double avg_ms = pt.ms(timer::timer_t::avg);
+        BENCHDNN_PRINT(0,
+                "[PERF] partition:%zu graph:%s min(ms):%g avg(ms):%g "
+                "share(%%):%g\n",
+                p, graph_names[partition_graphs[p]].c_str(),
+                pt.ms(timer::timer_t::min), avg_ms,
+                total_avg_ms > 0 ? 100. * avg_ms / total_avg_ms : 0.);
+    }
+
+    return OK;
+}
 } // namespace graph
@@ -42,6 +42,9 @@ struct settings_t : public base_settings_t {
         : base_settings_t(perf_template) {}
 
     std::string json_file;
+    // A file listing the JSON files of the graphs of a model, one per line.
+    std::string model_file;
+    bool mem_reuse = true;
     std::vector<std::map<size_t, std::string>> in_shapes_vec {{{0, "default"}}};
     std::vector<std::map<size_t, std::string>> op_attrs_vec {{{0, "default"}}};
     // By default, we expect the graph should be fused as a single partition.
@@ -84,7 +87,8 @@ std::string case_to_str(const std::string &json_file,
         const size_t expected_n_partitions, const int64_t mb,
         const dnnl_data_type_t dt,
         const std::map<size_t, dnnl_data_type_t> &dt_map,
-        const std::map<size_t, std::string> &op_kind_map);
+        const std::map<size_t, std::string> &op_kind_map,
+        const bool mem_reuse = true, const std::string &case_option = "case");
 
 struct perf_report_t : public base_perf_report_t {
     perf_report_t(const std::string &case_str, const char *perf_template)
@@ -97,6 +101,10 @@ private:
 };
 
 int doit(const prb_t *prb, res_t *res);
+// Executes the graphs of a model one after another as a single problem, and
+// reports the times of the partitions and the memory of the library.
+int doit_model(const std::vector<prb_t> &prbs,
+        const std::vector<std::string> &graph_names, res_t *res);
 int bench(int argc, char **argv);
 } // namespace graph
 
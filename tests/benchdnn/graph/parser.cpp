@@ -318,4 +318,8 @@ bool parse_input_file(std::string &json_file, const char *str) {
     return parse_string(json_file, str, "case");
 }
 
+bool parse_model_file(std::string &model_file, const char *str) {
+    return parse_string(model_file, str, "model");
+}
+
 } // namespace graph
@@ -44,6 +44,8 @@ bool parse_graph_fpmath_mode(
 
 bool parse_input_file(std::string &json_file, const char *str);
 
+bool parse_model_file(std::string &model_file, const char *str);
+
 bool parse_dt(std::vector<dnnl_data_type_t> &dt,
         std::vector<std::map<size_t, dnnl_data_type_t>> &dt_map,
         const char *str, const std::string &option_name = "dt");
@@ -135,6 +135,12 @@ int execute_and_wait(const std::vector<dnnl::graph::compiled_partition> &cp_v,
         const std::vector<std::vector<dnnl::graph::tensor>> &outputs_v,
         res_t *res);
 
+// Returns the name of the timer of the execution of the `idx`-th partition,
+// which is collected on CPU only.
+inline std::string partition_timer_name(size_t idx) {
+    return "perf_partition_timer_" + std::to_string(idx);
+}
+
 int measure_perf(timer::timer_t &t,
         const std::vector<dnnl::graph::compiled_partition> &cp_v,
         const std::vector<std::vector<dnnl::graph::tensor>> &inputs_v,
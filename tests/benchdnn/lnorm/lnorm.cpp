@@ -141,6 +141,28 @@ int fill_src(const prb_t *prb, const cfg_t &cfg, dnn_mem_t &mem_fp,
     return OK;
 }
 
+// With the fused residual addition, the sum of the sources must match the data
+// from `fill_src` for the statistics to stay exact. Each element is moved to
+// one of the sources or halved between them, so the sum is not rounded.
+int fill_src_1(const prb_t *prb, dnn_mem_t &mem_fp, dnn_mem_t &mem_dt,
+        dnn_mem_t &ref_src, dnn_mem_t &src) {
+    if (!prb->fuse_add()) return OK;
+
+    benchdnn_parallel_nd(prb->n * prb->c, [&](int64_t off) {
+        const float sum = ref_src.get_f32_elem(off);
+        float val = 0.f;
+        if (off % 3 == 1) val = sum;
+        if (off % 3 == 2) val = sum / 2;
+        mem_fp.set_f32_elem(off, val);
+        ref_src.set_f32_elem(off, sum - val);
+    });
+
+    if (mem_dt) SAFE(mem_dt.reorder(mem_fp), WARN);
+    if (src) SAFE(src.reorder(ref_src), WARN);
+
+    return OK;
+}
+
 int fill_variance_fwd(const prb_t *prb, const cfg_t &cfg, dnn_mem_t &mem_fp,
         dnn_mem_t &mem_dt, const dnn_mem_t &ref_src,
         const dnn_mem_t &ref_mean) {
@@ -242,6 +264,16 @@ int prepare_fwd(const prb_t *prb, dnn_mem_map_t &mem_map,
     auto &ref_src = ref_mem_map.at(DNNL_ARG_SRC);
     SAFE(fill_src(prb, cfg, ref_src, src, ref_mean, res), WARN);
 
+    auto &var = mem_map.at(DNNL_ARG_VARIANCE);
+    auto &ref_var = ref_mem_map.at(DNNL_ARG_VARIANCE);
+    SAFE(fill_variance_fwd(prb, cfg, ref_var, var, ref_src, ref_mean), WARN);
+
+    if (prb->fuse_add()) {
+        auto &src_1 = mem_map.at(DNNL_ARG_SRC_1);
+        auto &ref_src_1 = ref_mem_map.at(DNNL_ARG_SRC_1);
+        SAFE(fill_src_1(prb, ref_src_1, src_1, ref_src, src), WARN);
+    }
+
     // Need a copy of source data for inplace mode for bitwise testing.
     if (has_bench_mode_bit(mode_bit_t::bitwise) && prb->inplace) {
         auto &src_copy = mem_map.at(-DNNL_ARG_SRC);
@@ -249,10 +281,6 @@ int prepare_fwd(const prb_t *prb, dnn_mem_map_t &mem_map,
         SAFE(src_copy.reorder(src), WARN);
     }
 
-    auto &var = mem_map.at(DNNL_ARG_VARIANCE);
-    auto &ref_var = ref_mem_map.at(DNNL_ARG_VARIANCE);
-    SAFE(fill_variance_fwd(prb, cfg, ref_var, var, ref_src, ref_mean), WARN);
-
     auto &scale = mem_map.at(DNNL_ARG_SCALE);
     auto &ref_scale = ref_mem_map.at(DNNL_ARG_SCALE);
     SAFE(fill_scale(prb, ref_scale, scale), WARN);
@@ -369,6 +397,21 @@ int fill_diff_dst_bwd(
     return OK;
 }
 
+// The gradient of the residual branch is added to diff_src as is, so its
+// values are exact in any data type and differ from the diff_dst ones.
+int fill_diff_dst_1_bwd(
+        const prb_t *prb, dnn_mem_t &mem_fp, dnn_mem_t &mem_dt) {
+    if (!prb->fuse_add()) return OK;
+
+    benchdnn_parallel_nd(prb->n * prb->c, [&](int64_t off) {
+        mem_fp.set_f32_elem(off, 0.25f * (off % 9 - 4));
+    });
+
+    if (mem_dt) SAFE(mem_dt.reorder(mem_fp), WARN);
+
+    return OK;
+}
+
 int prepare_bwd(const prb_t *prb, dnn_mem_map_t &mem_map,
         dnn_mem_map_t &ref_mem_map, res_t *res) {
     cfg_t cfg(prb);
@@ -389,6 +432,12 @@ int prepare_bwd(const prb_t *prb, dnn_mem_map_t &mem_map,
     auto &ref_d_dst = ref_mem_map.at(DNNL_ARG_DIFF_DST);
     SAFE(fill_diff_dst_bwd(prb, ref_d_dst, d_dst, res), WARN);
 
+    if (prb->fuse_add()) {
+        auto &d_dst_1 = mem_map.at(DNNL_ARG_DIFF_DST_1);
+        auto &ref_d_dst_1 = ref_mem_map.at(DNNL_ARG_DIFF_DST_1);
+        SAFE(fill_diff_dst_1_bwd(prb, ref_d_dst_1, d_dst_1), WARN);
+    }
+
     // Need a copy of source data for inplace mode for bitwise testing.
     if (has_bench_mode_bit(mode_bit_t::bitwise) && prb->inplace) {
         auto &d_dst_copy = mem_map.at(-DNNL_ARG_DIFF_DST);
@@ -466,6 +515,14 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
         return;
     }
 
+    if (prb->fuse_add() && (is_gpu() || is_integral_dt(prb->dt[0]))) {
+        // Fused residual addition is supported on CPU for floating-point
+        // source only.
+        res->state = SKIPPED;
+        res->reason = skip_reason::case_not_supported;
+        return;
+    }
+
     if ((is_nvidia_gpu() || is_amd_gpu() || is_generic_gpu())
             && prb->skip_mean()) {
         // non-intel GPU does not support rms normalization
@@ -498,6 +555,8 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
     float trh = trh_coeff * ((kind == SRC || kind == DST) ? 5e-7 : 0);
     if ((kind == SC || kind == SH) && prb->dir & FLAG_BWD)
         trh = trh_coeff * 5e-6;
+    // The residual sum is exact by construction of the inputs.
+    if (kind == DST_1) trh = 0.f;
     cmp.set_threshold(trh);
 
     // u8 turns half of output into zeros.
@@ -548,6 +607,8 @@ std::vector<int> supported_exec_args(dir_t dir) {
             DNNL_ARG_SCALE,
             DNNL_ARG_SHIFT,
             DNNL_ARG_DST,
+            DNNL_ARG_SRC_1,
+            DNNL_ARG_DST_1,
     };
     static const std::vector<int> exec_bwd_args = {
             DNNL_ARG_SRC,
@@ -556,6 +617,7 @@ std::vector<int> supported_exec_args(dir_t dir) {
             DNNL_ARG_SCALE,
             DNNL_ARG_SHIFT,
             DNNL_ARG_DIFF_DST,
+            DNNL_ARG_DIFF_DST_1,
             DNNL_ARG_DIFF_SCALE,
             DNNL_ARG_DIFF_SHIFT,
             DNNL_ARG_DIFF_SRC,
@@ -663,6 +725,7 @@ std::vector<data_kind_t> get_kinds_to_check(const prb_t *prb) {
         }
 #endif
         check_kinds.push_back(DST);
+        if (prb->fuse_add()) check_kinds.push_back(DST_1);
     } else {
         if (prb->dir & FLAG_WEI) {
             if (prb->use_sc()) check_kinds.push_back(SC);
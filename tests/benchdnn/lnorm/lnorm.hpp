@@ -42,6 +42,7 @@ const flags_t GLOB_STATS = bnorm::GLOB_STATS;
 const flags_t USE_SCALE = bnorm::USE_SCALE;
 const flags_t USE_SHIFT = bnorm::USE_SHIFT;
 const flags_t USE_RMS_NORM = bnorm::USE_RMS_NORM;
+const flags_t FUSE_ADD_NORM = bnorm::FUSE_ADD_NORM;
 const auto flags2str = bnorm::flags2str;
 flags_t str2flags(const char *str);
 
@@ -134,6 +135,7 @@ struct prb_t : public prb_dims_t {
     bool use_sc() const { return flags & USE_SCALE; }
     bool use_sh() const { return flags & USE_SHIFT; }
     bool skip_mean() const { return flags & USE_RMS_NORM; }
+    bool fuse_add() const { return flags & FUSE_ADD_NORM; }
 
     // Used to construct memory desc when dimensions are runtime since such mds
     // can't be used directly from query and memory objects can't be constructed.
@@ -230,6 +232,10 @@ struct perf_report_t : public base_perf_report_t {
         s << flags2str(p_->flags);
     }
 
+    double ops() const override {
+        return norm_ops_per_elem(p_->dir, p_->use_stats()) * p_->n * p_->c;
+    }
+
     const attr_t *attr() const override { return &p_->attr; }
     const thr_ctx_t *ctx_init() const override { return &p_->ctx_init; }
     const thr_ctx_t *ctx_exe() const override { return &p_->ctx_exe; }
@@ -33,6 +33,8 @@ flags_t str2flags(const char *str) {
             flags |= USE_SHIFT;
         } else if (*str == 'M') {
             flags |= USE_RMS_NORM;
+        } else if (*str == 'S') {
+            flags |= FUSE_ADD_NORM;
         } else {
             BENCHDNN_PRINT(0, "%s \'%c\'\n",
                     "Error: --flags option doesn't support value", *str);
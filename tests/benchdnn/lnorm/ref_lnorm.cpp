@@ -27,6 +27,8 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
     const dnn_mem_t &sc = args.find(DNNL_ARG_SCALE);
     const dnn_mem_t &sh = args.find(DNNL_ARG_SHIFT);
     const dnn_mem_t &dst = args.find(DNNL_ARG_DST);
+    const dnn_mem_t &src_1 = args.find(DNNL_ARG_SRC_1);
+    const dnn_mem_t &dst_1 = args.find(DNNL_ARG_DST_1);
     const dnn_mem_t &src_scale = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
     const dnn_mem_t &dst_scale = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
 
@@ -35,6 +37,7 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
     const bool use_sc = prb->use_sc();
     const bool use_sh = prb->use_sh();
     const bool skip_mean = prb->skip_mean();
+    const bool fuse_add = prb->fuse_add();
 
     const bool has_src_scale = !prb->attr.scales.get(DNNL_ARG_SRC).is_def();
     const bool has_dst_scale = !prb->attr.scales.get(DNNL_ARG_DST).is_def();
@@ -57,7 +60,14 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
             float gamma = (use_sc ? sc.get_f32_elem(c) : 1.0f) / sqrt_var;
             float beta = use_sh ? sh.get_f32_elem(c) : 0;
             auto off = n * prb->c + c;
-            float res = gamma * (src.get_f32_elem(off) - smean) + beta;
+            float s = src.get_f32_elem(off);
+            if (fuse_add) {
+                // The sum is normalized as stored in the source data type.
+                s = round_to_nearest_representable(
+                        prb->dt[0], s + src_1.get_f32_elem(off));
+                if (dst_1) dst_1.set_f32_elem(off, s);
+            }
+            float res = gamma * (s - smean) + beta;
 
             const auto v_po_vals = prepare_po_vals(dst, args, v_po_masks, off);
             res *= src_scale_val;
@@ -73,6 +83,7 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
     const dnn_mem_t &mean = args.find(DNNL_ARG_MEAN);
     const dnn_mem_t &var = args.find(DNNL_ARG_VARIANCE);
     const dnn_mem_t &d_dst = args.find(DNNL_ARG_DIFF_DST);
+    const dnn_mem_t &d_dst_1 = args.find(DNNL_ARG_DIFF_DST_1);
     const dnn_mem_t &sc = args.find(DNNL_ARG_SCALE);
     const dnn_mem_t &d_src = args.find(DNNL_ARG_DIFF_SRC);
     const dnn_mem_t &d_sc = args.find(DNNL_ARG_DIFF_SCALE);
@@ -127,7 +138,9 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
                 ds -= (dd_gamma + x * dd_gamma_x * rcp_denom) / prb->c;
             }
 
-            d_src.set_f32_elem(off, rcp_denom * ds);
+            float res = rcp_denom * ds;
+            if (prb->fuse_add()) res += d_dst_1.get_f32_elem(off);
+            d_src.set_f32_elem(off, res);
         }
     });
 }
@@ -507,13 +507,25 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     const auto wei_encoding
             = prb->sparse_options.get_encoding(DNNL_ARG_WEIGHTS);
     bool is_wei_dense = (wei_encoding == dnnl_sparse_encoding_undef);
-    bool is_src_coo_sparse
-            = (prb->sparse_options.get_encoding(DNNL_ARG_SRC) == dnnl_coo);
+    const auto src_encoding = prb->sparse_options.get_encoding(DNNL_ARG_SRC);
+    bool is_src_coo_or_csr_sparse
+            = (src_encoding == dnnl_coo || src_encoding == dnnl_csr);
     if (!prb->sparse_options.is_def() && is_gpu()
-            && (!is_wei_dense || !is_src_coo_sparse)) {
+            && (!is_wei_dense || !is_src_coo_or_csr_sparse)) {
         BENCHDNN_PRINT(2,
-                "[SKIP][%s:%d]: GPU sparse matmul only supports COO encoding "
-                "for source.\n",
+                "[SKIP][%s:%d]: GPU sparse matmul only supports COO and CSR "
+                "encodings for source.\n",
+                __FILE__, __LINE__);
+        res->state = SKIPPED;
+        res->reason = skip_reason::case_not_supported;
+        return;
+    }
+
+    if (!prb->sparse_options.is_def() && is_cpu()
+            && prb->src_dt() == dnnl_bf16) {
+        BENCHDNN_PRINT(2,
+                "[SKIP][%s:%d]: bf16 sparse matmul is not supported on "
+                "CPU.\n",
                 __FILE__, __LINE__);
         res->state = SKIPPED;
         res->reason = skip_reason::case_not_supported;
@@ -30,6 +30,7 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
 
     // Used for graph reference version only when runs SDPA fwd training.
     const dnn_mem_t &stats = args.find(DNNL_ARG_DST_1);
+    const dnn_mem_t &dropout = args.find(DNNL_ARG_ATTR_DROPOUT_MASK);
 
     const auto alg = prb->alg;
     int64_t outer_size {0}, inner_size {0}, axis_size {0};
@@ -90,6 +91,7 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
 
             const auto v_po_vals = prepare_po_vals(dst, args, v_po_masks, idx);
             dst_ptr[idx] *= src_scale_val;
+            maybe_dropout(prb->attr, dst_ptr[idx], idx, dropout);
             maybe_post_ops(prb->attr, dst_ptr[idx], 0.f, v_po_vals);
             dst_ptr[idx] *= r_dst_scale_val;
         }
@@ -252,10 +252,22 @@ void skip_invalid_prb(const prb_t *prb, res_t *res) {
         skip_invalid_inplace(res, prb->sdt, prb->ddt, prb->stag, prb->dtag);
         if (res->state == SKIPPED) return;
     }
+
+    // Dropout is only defined for forward training.
+    if (!prb->attr.dropout.is_def() && prb->dir != FWD_D) {
+        res->state = SKIPPED;
+        res->reason = skip_reason::invalid_case;
+        return;
+    }
 }
 
 void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
         const args_t &ref_args) {
+    if (kind == DROPOUT_MASK) {
+        cmp.set_zero_trust_percent(100.f);
+        return;
+    }
+
     const auto trh_dt = (prb->dir & FLAG_FWD) ? prb->ddt : prb->sdt;
     const bool is_flt_or_dbl = trh_dt == dnnl_f32 || trh_dt == dnnl_f64;
     const float trh_coeff_log = prb->alg == LOGSOFTMAX ? 5 : 1;
@@ -299,6 +311,8 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
     if (prb->alg == LOGSOFTMAX && (axis_size == 1 || prb->ddt == dnnl_u8))
         zero_trust_percent = 100.f;
     if (prb->dir & FLAG_BWD) zero_trust_percent = 30.f;
+    // Dropout zeroes a part of the destination by design.
+    if (!prb->attr.dropout.is_def()) zero_trust_percent = 100.f;
     cmp.set_zero_trust_percent(zero_trust_percent);
 
     const auto softmax_add_check
@@ -420,6 +434,13 @@ int init_ref_memory_args(dnn_mem_map_t &ref_mem_map, dnn_mem_map_t &mem_map,
                     SAFE(diff_dst_copy.reorder(mem), WARN);
                 }
             } break;
+            case DNNL_ARG_ATTR_DROPOUT_SEED:
+                ref_mem = dnn_mem_t(mem.md_, dnnl_s32, tag::abx, ref_engine,
+                        /* prefill = */ false);
+                SAFE(init_ref_memory_args_default_case(
+                             exec_arg, mem, ref_mem, prb->attr, res),
+                        WARN);
+                break;
             default: {
                 std::unordered_map<int, fill_cfg_t> fill_cfg_map;
                 binary_po_fill_cfg(fill_cfg_map, exec_arg, mem, prb->attr);
@@ -439,6 +460,7 @@ std::vector<data_kind_t> get_kinds_to_check(const prb_t *prb) {
     std::vector<data_kind_t> check_kinds;
     if (prb->dir & FLAG_FWD) {
         check_kinds = {DST};
+        if (!prb->attr.dropout.is_def()) check_kinds.push_back(DROPOUT_MASK);
     } else if (prb->dir & FLAG_BWD) {
         check_kinds = {SRC};
     } else {
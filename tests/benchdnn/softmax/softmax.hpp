@@ -149,6 +149,13 @@ struct perf_report_t : public base_perf_report_t {
 
     void dump_desc_csv(std::ostream &s) const override { dump_desc(s); }
 
+    // Forward takes the maximum, the exponent of the difference, the sum and
+    // the scaling per element, and backward takes the multiply-add of the dot
+    // product, the subtraction and the multiplication.
+    double ops() const override {
+        return (p_->dir & FLAG_FWD ? 4. : 3.) * p_->nelems(-1);
+    }
+
     const attr_t *attr() const override { return &p_->attr; }
     const thr_ctx_t *ctx_init() const override { return &p_->ctx_init; }
     const thr_ctx_t *ctx_exe() const override { return &p_->ctx_exe; }
@@ -51,6 +51,9 @@ enum class mode_modifier_t : unsigned {
     // Disable usage of reference memories in the flow. It removes mapping,
     // unmapping and filling functionality.
     no_ref_memory = 0x2,
+    // Measure the creation of test objects stage by stage, including the
+    // creation from a cache blob, and report it with the performance template.
+    create_time = 0x4,
 };
 
 mode_modifier_t operator|(mode_modifier_t lhs, mode_modifier_t rhs);
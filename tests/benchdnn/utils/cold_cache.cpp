@@ -18,6 +18,7 @@
 
 #include "utils/cold_cache.hpp"
 #include "utils/fill.hpp"
+#include "utils/numa.hpp"
 
 cold_cache_input_t cold_cache_input;
 
@@ -54,6 +55,8 @@ cold_cache_t::cold_cache_t(
     // that no buffers are needed.
     if (!enabled_) return;
 
+    if (cold_cache_input_.numa_) SAFE_V(init_numa());
+
     static cpu_cache_args_t cpu_cache_args {};
     SAFE_V(get_cpu_cache_size(cpu_cache_args));
     const auto cpu_cache_capacity = cpu_cache_args.total_socket_size;
@@ -145,6 +148,19 @@ cold_cache_t::cold_cache_t(
                 smart_bytes(cold_cache_input_.cold_tlb_size_).c_str());
     }
     if (n_buffers_ <= 0) {
+        // The original memories of cold arguments are measured, so they get
+        // the NUMA placement instead.
+        for (int arg : cc_args) {
+            const int idx = cold_cache_utils::get_arg_idx(dnnl_args, arg);
+            if (numa_mem_node_ < 0 || idx < 0 || !dnnl_args[idx].memory)
+                continue;
+            void *ptr = nullptr;
+            const auto &mem = dnnl_args[idx].memory;
+            DNN_SAFE_V(dnnl_memory_get_data_handle(mem, &ptr));
+            SAFE_V(numa::bind_memory(ptr,
+                    cold_cache_utils::get_arg_size(dnnl_args, arg),
+                    numa_mem_node_));
+        }
         // No buffers allocation needed, return to avoid scratching `cache_`
         // object. This allows to keep rest logic intact.
         return;
@@ -175,6 +191,16 @@ cold_cache_t::cold_cache_t(
             const bool prefill = n_mem_pool_buffers > gpu_n_buffers_top_limit_;
             cc_entry[i] = dnn_mem_t(orig_cc_mem_md, get_test_engine(), prefill);
 
+            // The pages are bound before the reorder fills them, and the ones
+            // touched by the prefill are migrated.
+            if (numa_mem_node_ >= 0) {
+                void *ptr = nullptr;
+                DNN_SAFE_V(dnnl_memory_get_data_handle(cc_entry[i].m_, &ptr));
+                SAFE_V(numa::bind_memory(ptr,
+                        dnnl_memory_desc_get_size(orig_cc_mem_md),
+                        numa_mem_node_));
+            }
+
             // Sparse memories require this call to replicate the exact original
             // data distribution because the data structure affects performance
             // in a direct way.
@@ -248,6 +274,8 @@ cold_cache_t::cold_cache_t(
 }
 
 cold_cache_t::~cold_cache_t() {
+    if (threads_bound_) numa::restore_threads();
+
     if (has_bench_mode_modifier(mode_modifier_t::no_ref_memory)) return;
 
     // Mapping memories after execution to have them destroyed gracefully.
@@ -270,12 +298,55 @@ cold_cache_t &cold_cache_t::operator=(cold_cache_t &&rhs) {
     n_buffers_bottom_limit_ = rhs.n_buffers_bottom_limit_;
     n_buffers_ = rhs.n_buffers_;
     override_n_buffers_ = rhs.override_n_buffers_;
+    numa_mem_node_ = rhs.numa_mem_node_;
+    threads_bound_ = rhs.threads_bound_;
+    rhs.threads_bound_ = false;
     cold_cache_input_ = std::move(rhs.cold_cache_input_);
     cache_ = std::move(rhs.cache_);
 
     return *this;
 }
 
+int cold_cache_t::init_numa() {
+    if (!is_cpu()) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "Error: cold-cache NUMA extension is supported for CPU only.");
+        return FAIL;
+    }
+
+    const int n_nodes = numa::get_num_nodes();
+    const int cpu_node = cold_cache_input_.numa_cpu_node_ >= 0
+            ? cold_cache_input_.numa_cpu_node_
+            : numa::get_current_node();
+    if (cpu_node < 0 || cpu_node >= n_nodes) {
+        BENCHDNN_PRINT(0, "Error: NUMA node %d for CPU is not available.\n",
+                cpu_node);
+        return FAIL;
+    }
+    const auto &mem_node_str = cold_cache_input_.numa_mem_node_str_;
+    numa_mem_node_ = numa::resolve_node(mem_node_str, cpu_node);
+    if (numa_mem_node_ < 0) {
+        BENCHDNN_PRINT(0,
+                "Error: NUMA node \'%s\' for memory is not available for "
+                "CPU node %d.\n",
+                mem_node_str.c_str(), cpu_node);
+        return FAIL;
+    }
+
+    BENCHDNN_PRINT(3,
+            "[COLD_CACHE] numa: memory node:%d (package %d); cpu node:%d "
+            "(package %d); distance:%s;\n",
+            numa_mem_node_, numa::get_node_package(numa_mem_node_), cpu_node,
+            numa::get_node_package(cpu_node),
+            numa::node_distance_str(numa_mem_node_, cpu_node).c_str());
+
+    if (cold_cache_input_.numa_cpu_node_ >= 0) {
+        SAFE(numa::bind_threads(cpu_node), WARN);
+        threads_bound_ = true;
+    }
+    return OK;
+}
+
 // `mem_size` is the amount of memory in bytes for reorder.
 // `granularity` defines the stride between elements to make an object of
 //   `granularity` size to fit the specific cache. Mostly designed for
@@ -406,5 +477,10 @@ std::ostream &operator<<(
             s << ":" << cold_cache_input.cold_tlb_size_str_;
         }
     }
+    if (cold_cache_input.numa_) {
+        s << "+numa:" << cold_cache_input.numa_mem_node_str_;
+        if (cold_cache_input.numa_cpu_node_ >= 0)
+            s << ":" << cold_cache_input.numa_cpu_node_;
+    }
     return s;
 }
@@ -52,13 +52,23 @@ struct cold_cache_input_t {
     std::string cold_tlb_size_str_ = "1.0G";
     // Countable value of the string stored to use inside the implementation.
     size_t cold_tlb_size_ = 1024 * 1024 * 1024;
+    // Optional binding of cold buffers to a NUMA node.
+    bool numa_ = false;
+    // The node of cold buffers: an index, `snc` or `socket`, see
+    // `numa::resolve_node()`.
+    std::string numa_mem_node_str_;
+    // The node to run the problem on, `-1` to keep the thread affinities.
+    int numa_cpu_node_ = -1;
 
     bool operator==(const cold_cache_input_t &other) const {
         // Don't compare `cold_tlb_size_` as it's the product of
         // `cold_tlb_size_str_`.
         return cold_cache_mode_ == other.cold_cache_mode_
                 && cold_tlb_ == other.cold_tlb_
-                && cold_tlb_size_str_ == other.cold_tlb_size_str_;
+                && cold_tlb_size_str_ == other.cold_tlb_size_str_
+                && numa_ == other.numa_
+                && numa_mem_node_str_ == other.numa_mem_node_str_
+                && numa_cpu_node_ == other.numa_cpu_node_;
     }
     bool operator!=(const cold_cache_input_t &other) const {
         return !operator==(other);
@@ -129,12 +139,18 @@ private:
     static constexpr size_t cpu_n_buffers_top_limit_ = 10000;
 
     size_t cc_counter_ = 0;
+    // The node the cold buffers are bound to, `-1` if not bound.
+    int numa_mem_node_ = -1;
+    bool threads_bound_ = false;
 
     // Returns `true`, if cold-cache was requested and eligible.
     bool use_cold_cache(const std::vector<dnnl_exec_arg_t> &dnnl_args) const;
 
     int thrash_reorder(size_t mem_size, size_t granularity) const;
 
+    // Resolves the NUMA nodes of the cold buffers and binds the threads.
+    int init_numa();
+
     BENCHDNN_DISALLOW_COPY_AND_ASSIGN(cold_cache_t);
 };
 
@@ -44,6 +44,7 @@ static data_kind_entry_t data_kind_table[] = {
         {DST, {DNNL_ARG_DST, DNNL_ARG_DIFF_DST}},
         {DST_ITER, {DNNL_ARG_DST_ITER, DNNL_ARG_DIFF_DST_ITER}},
         {DST_ITER_C, {DNNL_ARG_DST_ITER_C, DNNL_ARG_DIFF_DST_ITER_C}},
+        {DST_1, {DNNL_ARG_DST_1}},
         {MEAN, {DNNL_ARG_MEAN}},
         {VAR, {DNNL_ARG_VARIANCE}},
         {SC, {DNNL_ARG_DIFF_SCALE, DNNL_ARG_SCALE}},
@@ -117,6 +118,7 @@ const char *data_kind2str(data_kind_t kind) {
         case WEI_PEEPHOLE: return "WEI_PEEPHOLE";
         case WEI_PROJECTION: return "WEI_PROJECTION";
         case DROPOUT_MASK: return "DROPOUT_MASK";
+        case DST_1: return "DST_1";
         default: assert(!"incorrect data kind");
     }
     return "incorrect data kind";
@@ -44,7 +44,7 @@ enum data_kind_t {
     DROPOUT_MASK,
 
     DAT_TOTAL,
-    // softmax stats
+    // softmax stats, lnorm residual sum
     DST_1,
 };
 const char *data_kind2str(data_kind_t kind);
@@ -0,0 +1,154 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <fstream>
+
+#include "common.hpp"
+
+#include "utils/energy.hpp"
+
+#ifdef __linux__
+#include <dirent.h>
+#endif
+
+namespace energy {
+
+#ifdef __linux__
+namespace {
+
+bool read_value(const std::string &path, double &value) {
+    std::ifstream f(path);
+    return bool(f >> value);
+}
+
+bool read_string(const std::string &path, std::string &value) {
+    std::ifstream f(path);
+    return bool(std::getline(f, value));
+}
+
+// Returns the names of the entries of `dir` starting with `prefix`.
+std::vector<std::string> list_dir(
+        const std::string &dir, const std::string &prefix) {
+    std::vector<std::string> entries;
+    DIR *d = opendir(dir.c_str());
+    if (!d) return entries;
+    while (const dirent *e = readdir(d)) {
+        const std::string name = e->d_name;
+        if (name.compare(0, prefix.size(), prefix) == 0)
+            entries.push_back(name);
+    }
+    closedir(d);
+    std::sort(entries.begin(), entries.end());
+    return entries;
+}
+
+} // namespace
+
+int meter_t::init() {
+    domains_.clear();
+    bool has_unreadable = false;
+    const auto add_domain = [&](const std::string &name,
+                                    const std::string &path, double range_uj) {
+        double value = 0;
+        if (!read_value(path, value)) {
+            has_unreadable = true;
+            return;
+        }
+        domains_.push_back({name, path, range_uj, 0., 0.});
+    };
+
+    // A package zone `intel-rapl:P` has the subzones `intel-rapl:P:S`, one of
+    // which may be its DRAM. AMD CPUs are exposed the same way.
+    const std::string powercap = "/sys/class/powercap/";
+    for (const auto &zone : list_dir(powercap, "intel-rapl:")) {
+        const std::string dir = powercap + zone + "/";
+        std::string name;
+        if (!read_string(dir + "name", name)) continue;
+        const bool is_package = name.compare(0, 8, "package-") == 0;
+        if (!is_package && name != "dram") continue;
+        if (name == "dram") {
+            // The package index is the one of the parent zone.
+            const size_t pos = zone.rfind(':');
+            name = "dram-" + zone.substr(11, pos - 11);
+        }
+        double range_uj = 0;
+        read_value(dir + "max_energy_range_uj", range_uj);
+        add_domain(name, dir + "energy_uj", range_uj);
+    }
+
+    // The GPUs driven by i915 or xe report their energy with hwmon.
+    const std::string drm = "/sys/class/drm/";
+    int gpu_idx = 0;
+    for (const auto &card : list_dir(drm, "card")) {
+        if (card.find('-') != std::string::npos) continue; // A connector.
+        const std::string hwmon = drm + card + "/device/hwmon/";
+        for (const auto &h : list_dir(hwmon, "hwmon")) {
+            const std::string path = hwmon + h + "/energy1_input";
+            if (!std::ifstream(path)) continue;
+            add_domain("gpu-" + std::to_string(gpu_idx++), path, 0.);
+        }
+    }
+
+    if (domains_.empty()) {
+        BENCHDNN_PRINT(0, "%s\n",
+                has_unreadable ? "Error: reading energy counters failed, "
+                                 "check the permissions of "
+                                 "/sys/class/powercap/*/energy_uj."
+                               : "Error: no energy counters found.");
+        return FAIL;
+    }
+    return OK;
+}
+
+void meter_t::start() {
+    for (auto &d : domains_)
+        read_value(d.path, d.start_uj);
+}
+
+void meter_t::stop() {
+    for (auto &d : domains_) {
+        double value = d.start_uj;
+        read_value(d.path, value);
+        double delta = value - d.start_uj;
+        if (delta < 0) delta += d.range_uj;
+        d.total_uj += MAX2(delta, 0.);
+    }
+}
+
+readings_t meter_t::read(int times) const {
+    readings_t readings;
+    for (const auto &d : domains_)
+        readings.emplace_back(d.name, d.total_uj / 1e6 / MAX2(1, times));
+    return readings;
+}
+
+#else
+
+int meter_t::init() {
+    BENCHDNN_PRINT(
+            0, "%s\n", "Error: energy counters are supported on Linux only.");
+    return FAIL;
+}
+void meter_t::start() {}
+void meter_t::stop() {}
+readings_t meter_t::read(int times) const {
+    return {};
+}
+
+#endif
+
+} // namespace energy
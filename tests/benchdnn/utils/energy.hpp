@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_ENERGY_HPP
+#define UTILS_ENERGY_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// Helpers to measure the energy of the CPU packages, their DRAM and the GPUs
+// with the energy counters the Linux kernel exposes in sysfs: RAPL through
+// powercap for Intel and AMD CPUs, and hwmon for the GPUs of the i915 and xe
+// drivers. They are available on Linux only; elsewhere they report an error.
+namespace energy {
+
+// The energy of each domain, in joules.
+using readings_t = std::vector<std::pair<std::string, double>>;
+
+// The counters accumulate the energy of every domain found by `init()`
+// between `start()` and `stop()`. The counters are updated by the hardware
+// about every millisecond, so the measured interval should be much longer.
+struct meter_t {
+    int init();
+    bool is_initialized() const { return !domains_.empty(); }
+
+    void start();
+    void stop();
+    // Returns the measured energy divided by `times`.
+    readings_t read(int times) const;
+
+private:
+    struct domain_t {
+        std::string name;
+        // The file with the counter, in microjoules.
+        std::string path;
+        // The value after which the counter wraps around, in microjoules.
+        double range_uj;
+        double start_uj;
+        double total_uj;
+    };
+    std::vector<domain_t> domains_;
+};
+
+} // namespace energy
+
+#endif
@@ -0,0 +1,223 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <fstream>
+#include <sstream>
+
+#include "common.hpp"
+
+#include "utils/numa.hpp"
+#include "utils/parallel.hpp"
+
+#ifdef __linux__
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+namespace numa {
+
+#ifdef __linux__
+namespace {
+const std::string sysfs_node_dir = "/sys/devices/system/node/node";
+
+// Parses a list of CPUs in sysfs format, e.g. `0-3,8,10-11`.
+std::vector<int> parse_cpu_list(const std::string &s) {
+    std::vector<int> cpus;
+    std::stringstream ss(s);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty() || range == "\n") continue;
+        const size_t dash = range.find('-');
+        const int first = std::stoi(range.substr(0, dash));
+        const int last = dash == std::string::npos
+                ? first
+                : std::stoi(range.substr(dash + 1));
+        for (int c = first; c <= last; c++)
+            cpus.push_back(c);
+    }
+    return cpus;
+}
+
+std::string read_line(const std::string &path) {
+    std::ifstream f(path);
+    std::string line;
+    if (f) std::getline(f, line);
+    return line;
+}
+
+// The affinities of the threads saved by `bind_threads()`.
+std::vector<cpu_set_t> &saved_affinities() {
+    static std::vector<cpu_set_t> affinities;
+    return affinities;
+}
+} // namespace
+
+int get_num_nodes() {
+    int n = 0;
+    while (std::ifstream(sysfs_node_dir + std::to_string(n) + "/cpulist"))
+        n++;
+    return n;
+}
+
+std::vector<int> get_node_cpus(int node) {
+    return parse_cpu_list(
+            read_line(sysfs_node_dir + std::to_string(node) + "/cpulist"));
+}
+
+int get_node_package(int node) {
+    const auto cpus = get_node_cpus(node);
+    if (cpus.empty()) return -1; // A memory-only node.
+    const auto s = read_line("/sys/devices/system/cpu/cpu"
+            + std::to_string(cpus[0]) + "/topology/physical_package_id");
+    return s.empty() ? -1 : std::stoi(s);
+}
+
+int get_current_node() {
+    const int cpu = sched_getcpu();
+    if (cpu < 0) return -1;
+    for (int node = 0; node < get_num_nodes(); node++) {
+        for (int c : get_node_cpus(node))
+            if (c == cpu) return node;
+    }
+    return -1;
+}
+
+int bind_memory(void *ptr, size_t size, int node) {
+    // The kernel binds whole pages, so the range is extended to them.
+    const size_t page_size = sysconf(_SC_PAGESIZE);
+    const uintptr_t start = reinterpret_cast<uintptr_t>(ptr) & ~(page_size - 1);
+    const uintptr_t end = reinterpret_cast<uintptr_t>(ptr) + size;
+    const size_t len = div_up(end - start, page_size) * page_size;
+
+    constexpr size_t bits = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> nodemask(node / bits + 1, 0);
+    nodemask[node / bits] |= 1UL << (node % bits);
+
+    // The values of MPOL_BIND and MPOL_MF_MOVE of <numaif.h>, which comes
+    // with libnuma and is not required by benchdnn.
+    constexpr int mpol_bind = 2;
+    constexpr unsigned mpol_mf_move = 1 << 1;
+    const long st = syscall(SYS_mbind, reinterpret_cast<void *>(start), len,
+            mpol_bind, nodemask.data(), nodemask.size() * bits + 1,
+            mpol_mf_move);
+    if (st != 0) {
+        BENCHDNN_PRINT(0, "Error: binding memory to NUMA node %d failed.\n",
+                node);
+        return FAIL;
+    }
+    return OK;
+}
+
+int bind_threads(int node) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
+    cpu_set_t node_set;
+    CPU_ZERO(&node_set);
+    for (int c : get_node_cpus(node))
+        CPU_SET(c, &node_set);
+
+    auto &affinities = saved_affinities();
+    affinities.resize(benchdnn_get_max_threads());
+    std::atomic<bool> ok(true);
+    benchdnn_parallel(0, [&](int ithr, int nthr) {
+        sched_getaffinity(0, sizeof(cpu_set_t), &affinities[ithr]);
+        if (sched_setaffinity(0, sizeof(cpu_set_t), &node_set) != 0)
+            ok = false;
+    });
+    if (!ok) {
+        BENCHDNN_PRINT(0, "Error: binding threads to NUMA node %d failed.\n",
+                node);
+        return FAIL;
+    }
+    return OK;
+#else
+    // Other runtimes don't guarantee to reach every worker thread.
+    BENCHDNN_PRINT(0, "%s\n",
+            "Error: binding threads to a NUMA node requires the OMP or "
+            "sequential CPU runtime.");
+    return FAIL;
+#endif
+}
+
+int restore_threads() {
+    auto &affinities = saved_affinities();
+    if (affinities.empty()) return OK;
+    benchdnn_parallel(0, [&](int ithr, int nthr) {
+        if (ithr < (int)affinities.size())
+            sched_setaffinity(0, sizeof(cpu_set_t), &affinities[ithr]);
+    });
+    affinities.clear();
+    return OK;
+}
+
+#else
+
+int get_num_nodes() {
+    return 0;
+}
+std::vector<int> get_node_cpus(int node) {
+    return {};
+}
+int get_node_package(int node) {
+    return -1;
+}
+int get_current_node() {
+    return -1;
+}
+int bind_memory(void *ptr, size_t size, int node) {
+    BENCHDNN_PRINT(
+            0, "%s\n", "Error: NUMA binding is supported on Linux only.");
+    return FAIL;
+}
+int bind_threads(int node) {
+    BENCHDNN_PRINT(
+            0, "%s\n", "Error: NUMA binding is supported on Linux only.");
+    return FAIL;
+}
+int restore_threads() {
+    return OK;
+}
+
+#endif
+
+int resolve_node(const std::string &spec, int cpu_node) {
+    const int n_nodes = get_num_nodes();
+    const bool is_snc = spec == "snc";
+    if (is_snc || spec == "socket") {
+        const int cpu_package = get_node_package(cpu_node);
+        if (cpu_package < 0) return -1;
+        for (int node = 0; node < n_nodes; node++) {
+            if (node == cpu_node) continue;
+            const bool same_package = get_node_package(node) == cpu_package;
+            if (same_package == is_snc) return node;
+        }
+        return -1;
+    }
+    const int node = std::stoi(spec);
+    return node >= 0 && node < n_nodes ? node : -1;
+}
+
+std::string node_distance_str(int mem_node, int cpu_node) {
+    if (mem_node == cpu_node) return "local";
+    const int mem_package = get_node_package(mem_node);
+    return mem_package >= 0 && mem_package == get_node_package(cpu_node)
+            ? "snc"
+            : "socket";
+}
+
+} // namespace numa
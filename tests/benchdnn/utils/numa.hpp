@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_NUMA_HPP
+#define UTILS_NUMA_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Helpers to place memory and threads on NUMA nodes. They read the topology
+// from sysfs and are available on Linux only; elsewhere they report an error.
+namespace numa {
+
+// Returns the number of NUMA nodes, or 0 if the topology is unknown.
+int get_num_nodes();
+// Returns the CPUs of `node`.
+std::vector<int> get_node_cpus(int node);
+// Returns the physical package, or socket, of `node`, or -1 if unknown.
+int get_node_package(int node);
+// Returns the node of the CPU the calling thread runs on, or -1 if unknown.
+int get_current_node();
+
+// Resolves a node specification to a node index. `spec` is either a node
+// index, `snc` for another node in the package of `cpu_node`, which is a
+// sub-NUMA cluster, or `socket` for a node in another package. Returns -1 if
+// there is no such node.
+int resolve_node(const std::string &spec, int cpu_node);
+// Returns how far the memory of `mem_node` is from the CPUs of `cpu_node`:
+// `local`, `snc` or `socket`.
+std::string node_distance_str(int mem_node, int cpu_node);
+
+// Binds the pages of `size` bytes at `ptr` to `node`, migrating the pages
+// already touched.
+int bind_memory(void *ptr, size_t size, int node);
+
+// Binds the threads of the CPU runtime to the CPUs of `node` and saves their
+// affinities to restore them with `restore_threads()`.
+int bind_threads(int node);
+int restore_threads();
+
+} // namespace numa
+
+#endif
@@ -67,6 +67,11 @@ void benchdnn_parallel_nd(int64_t D0, int64_t D1, int64_t D2, int64_t D3,
     dnnl::impl::parallel_nd(D0, D1, D2, D3, D4, D5, f);
 }
 
+void benchdnn_parallel(int nthr, const std::function<void(int, int)> &f) {
+    ACTIVATE_THREADPOOL;
+    dnnl::impl::parallel(nthr, f);
+}
+
 int benchdnn_get_max_threads() {
     return dnnl_get_max_threads();
 }
@@ -47,6 +47,10 @@ void benchdnn_parallel_nd(int64_t D0, int64_t D1, int64_t D2, int64_t D3,
         const std::function<void(
                 int64_t, int64_t, int64_t, int64_t, int64_t, int64_t)> &f);
 
+// Calls `f(ithr, nthr)` once on each of `nthr` threads, or on every thread of
+// the runtime when `nthr` is 0.
+void benchdnn_parallel(int nthr, const std::function<void(int, int)> &f);
+
 int benchdnn_get_max_threads();
 
 #endif
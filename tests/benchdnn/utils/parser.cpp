@@ -19,6 +19,7 @@
 
 #include "utils/cold_cache.hpp"
 #include "utils/parser.hpp"
+#include "utils/pmu.hpp"
 #include "utils/stream_kind.hpp"
 
 #include "dnnl_common.hpp"
@@ -509,7 +510,7 @@ summary_t parse_summary_str(const std::string &s) {
 
 cold_cache_input_t str2cold_cache_input(const std::string &s) {
     // Allowed input: MODE[+EXTENSION[+...]]
-    // Allowed extensions: TLB[:SIZE]
+    // Allowed extensions: TLB[:SIZE], NUMA:MEM_NODE[:CPU_NODE]
     cold_cache_input_t c;
 
     size_t start_pos = 0;
@@ -568,10 +569,33 @@ cold_cache_input_t str2cold_cache_input(const std::string &s) {
                 // Save the input string once all values are verified.
                 c.cold_tlb_size_str_ = std::move(ext_aux_str);
             }
+        } else if (ext_main_str == "numa") {
+            c.numa_ = true;
+            if (ext_pos == std::string::npos) {
+                BENCHDNN_PRINT(0, "%s\n",
+                        "Error: cold-cache NUMA extension requires a memory "
+                        "node.");
+                SAFE_V(FAIL);
+            }
+            c.numa_mem_node_str_ = get_substr(ext_str, ext_pos, ':');
+            if (c.numa_mem_node_str_ != "snc"
+                    && c.numa_mem_node_str_ != "socket")
+                c.numa_mem_node_str_ = std::to_string(
+                        MAX2(0, stoll_safe(c.numa_mem_node_str_)));
+            if (ext_pos != std::string::npos) {
+                c.numa_cpu_node_ = static_cast<int>(
+                        stoll_safe(get_substr(ext_str, ext_pos, '\0')));
+                if (c.numa_cpu_node_ < 0) {
+                    BENCHDNN_PRINT(0, "%s\n",
+                            "Error: cold-cache NUMA CPU node must be "
+                            "non-negative.");
+                    SAFE_V(FAIL);
+                }
+            }
         } else {
             BENCHDNN_PRINT(0,
                     "Error: unknown cold-cache extension \'%s\'. Supported "
-                    "values are \'tlb\'\n.",
+                    "values are \'tlb\' and \'numa\'\n.",
                     ext_main_str.c_str());
             SAFE_V(FAIL);
         }
@@ -1288,6 +1312,76 @@ static bool parse_fix_times_per_prb(
     return parsed;
 }
 
+static bool parse_peak_bw(
+        const char *str, const std::string &option_name = "peak-bw") {
+    static const std::string help
+            = "GBPS    (Default: `0`)\n    Specifies the peak memory "
+              "bandwidth `GBPS` in GB/s to report the bandwidth utilization "
+              "in performance mode.\n    When set to `stream`, the bandwidth "
+              "is measured with the STREAM triad kernel on CPU.\n";
+    const auto str2bw = [](const std::string &s) -> double {
+        if (s == "stream") return -1;
+        return MAX2(0.f, parser_utils::stof_safe(s));
+    };
+    return parse_single_value_option(
+            peak_bw, default_peak_bw, str2bw, str, option_name, help);
+}
+
+static bool parse_peak_flops(
+        const char *str, const std::string &option_name = "peak-flops") {
+    static const std::string help
+            = "GFLOPS    (Default: `0`)\n    Specifies the peak compute rate "
+              "`GFLOPS` in GFLOPS to report the compute utilization in "
+              "performance mode.\n";
+    const auto str2flops = [](const std::string &s) -> double {
+        return MAX2(0.f, parser_utils::stof_safe(s));
+    };
+    return parse_single_value_option(
+            peak_flops, default_peak_flops, str2flops, str, option_name, help);
+}
+
+static bool parse_steady_warmup(
+        const char *str, const std::string &option_name = "steady-warmup") {
+    static const std::string help
+            = "BOOL    (Default: `false`)\n    Instructs the driver to discard "
+              "the warm-up executions of a problem in performance mode.\n    "
+              "When set to `true`, the problem runs until the average time of "
+              "consecutive windows of runs converges, and only the following "
+              "runs are measured.\n";
+    return parse_single_value_option(steady_warmup, default_steady_warmup,
+            str2bool, str, option_name, help);
+}
+
+static bool parse_pmu(const char *str, const std::string &option_name = "pmu") {
+    static const std::string help
+            = "EVENT[,EVENT...]    (Default: not specified)\n    Instructs "
+              "the driver to count hardware events of the CPU threads during "
+              "the measured executions in performance mode.\n    `EVENT` is "
+              "one of `cycles`, `ref-cycles`, `instructions`, `llc-refs`, "
+              "`llc-misses`, `branch-misses`, or `raw:0xCONFIG` for a "
+              "model-specific event.\n    The counts are reported with the "
+              "`%pmu%` option of `--perf-template`.\n";
+    const auto str2events = [](const std::string &s) -> std::string {
+        std::vector<pmu::event_t> events;
+        SAFE_V(pmu::parse_events(events, s));
+        return s;
+    };
+    return parse_single_value_option(pmu_events, default_pmu_events,
+            str2events, str, option_name, help);
+}
+
+static bool parse_energy(
+        const char *str, const std::string &option_name = "energy") {
+    static const std::string help
+            = "BOOL    (Default: `false`)\n    Instructs the driver to "
+              "measure the energy of the CPU packages, their DRAM and the "
+              "GPUs during the measured executions in performance mode.\n    "
+              "The energy is reported with the `%energy%` and "
+              "`%flops_per_watt%` options of `--perf-template`.\n";
+    return parse_single_value_option(measure_energy, default_measure_energy,
+            str2bool, str, option_name, help);
+}
+
 static bool parse_max_ms_per_prb(
         const char *str, const std::string &option_name = "max-ms-per-prb") {
     static const std::string help
@@ -1315,7 +1409,8 @@ static bool parse_num_streams(
     static const std::string help
             = "N    (Default: `1`)\n    Specifies the number `N` of streams "
               "used for performance benchmarking.\n    `N` is a positive "
-              "integer.\n";
+              "integer. On CPU, `N` instances of the problem run at the same "
+              "time, each with its share of the threads.\n";
     bool parsed = parse_single_value_option(num_streams, default_num_streams,
             parser_utils::stoll_safe, str, option_name, help);
     if (parsed) {
@@ -1461,6 +1556,9 @@ static bool parse_mode_modifier(
               "    * `M` to disable usage of reference memory.\n"
               "          It removes any overheads for mapping, unmapping and \n"
               "          reorders used in filling functions (disabled).\n"
+              "    * `T` to measure the creation stages of test objects.\n"
+              "          Creation times are reported with the performance \n"
+              "          template in any mode.\n"
               "    More details at "
             + doc_url + "benchdnn_general_info.md\n";
 
@@ -1472,6 +1570,8 @@ static bool parse_mode_modifier(
                 case 'P': modifier |= mode_modifier_t::par_create; break;
                 case 'm':
                 case 'M': modifier |= mode_modifier_t::no_ref_memory; break;
+                case 't':
+                case 'T': modifier |= mode_modifier_t::create_time; break;
                 default:
                     BENCHDNN_PRINT(0, "%s\n%s",
                             "Error: modifier value is invalid.", help.c_str());
@@ -1596,9 +1696,12 @@ bool parse_bench_settings(const char *str) {
             || parse_fast_ref(str) || parse_fix_times_per_prb(str)
             || parse_global_impl(str) || parse_global_skip_impl(str)
             || parse_max_ms_per_prb(str) || parse_num_streams(str)
+            || parse_peak_bw(str) || parse_peak_flops(str)
             || parse_repeats_per_prb(str) || parse_mem_check(str)
             || parse_memory_kind(str) || parse_mode(str)
             || parse_mode_modifier(str) || parse_start(str)
+            || parse_steady_warmup(str) || parse_pmu(str)
+            || parse_energy(str)
             || parse_stream_kind(str) || parse_summary(str)
             || parse_verbose(str) || parse_execution_mode(str);
 
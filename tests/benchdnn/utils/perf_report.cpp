@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <ctype.h>
+
 #include "dnn_types.hpp"
 #include "dnnl_common.hpp"
 
@@ -53,12 +55,27 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     timer::timer_t::mode_t mode = timer::timer_t::min;
     timer::timer_t::mode_t user_mode = timer::timer_t::n_modes;
     double unit = 1e0;
+    // A non-zero value requests the percentile of the execution times
+    // instead of the timer mode.
+    int percentile = 0;
     char c = *option;
 
     if (c == '-' || c == '0' || c == '+') {
         user_mode = modifier2mode(c);
         mode = user_mode;
         c = *(++option);
+    } else if (c == 'p' && isdigit(option[1])) {
+        // `p` is a modifier only when a number follows to keep `%prb%` and
+        // `%prop%` intact.
+        while (isdigit(*(++option)))
+            percentile = 10 * percentile + (*option - '0');
+        if (percentile < 1 || percentile > 100) {
+            BENCHDNN_PRINT(0,
+                    "Error: percentile %d is out of (0, 100] range\n",
+                    percentile);
+            SAFE_V(FAIL);
+        }
+        c = *option;
     }
 
     if (c == 'K' || c == 'M' || c == 'G') {
@@ -66,14 +83,66 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
         c = *(++option);
     }
 
+    auto get_ms = [&](const timer::timer_t &t) -> double {
+        return percentile ? t.percentile_ms(percentile) : t.ms(mode);
+    };
+
     auto get_flops = [&](const timer::timer_t &t) -> double {
-        if (!t.sec(mode)) return 0;
-        return ops() / t.sec(mode) / unit;
+        const double ms = get_ms(t);
+        if (!ms) return 0;
+        return ops() / (ms / 1e3) / unit;
     };
 
     auto get_bw = [&](const timer::timer_t &t) -> double {
-        if (!t.sec(mode)) return 0;
-        return (res->ibytes + res->obytes) / t.sec(mode) / unit;
+        const double ms = get_ms(t);
+        if (!ms) return 0;
+        return (res->ibytes + res->obytes) / (ms / 1e3) / unit;
+    };
+
+    // Utilization of the peak rate in percent.
+    auto get_util = [&](const timer::timer_t &t, double amount,
+                            double peak_g) -> double {
+        const double ms = get_ms(t);
+        if (!ms || peak_g <= 0) return 0;
+        return 100. * amount / (ms / 1e3) / (peak_g * 1e9);
+    };
+
+    auto dump_hist = [&](const timer::timer_t &t) {
+        const auto bins = t.histogram(10);
+        for (size_t i = 0; i < bins.size(); i++)
+            s << (i ? ":" : "") << bins[i];
+    };
+
+    // The counts per execution, and the instructions per cycle when both are
+    // counted.
+    auto dump_pmu = [&](const pmu::counts_t &counts) {
+        double cycles = 0, instructions = 0;
+        for (size_t i = 0; i < counts.size(); i++) {
+            s << (i ? ":" : "") << counts[i].first << "="
+              << counts[i].second / unit;
+            if (counts[i].first == "cycles") cycles = counts[i].second;
+            if (counts[i].first == "instructions")
+                instructions = counts[i].second;
+        }
+        if (cycles > 0 && instructions > 0)
+            s << ":ipc=" << instructions / cycles;
+    };
+
+    // The energy per execution of each domain.
+    auto dump_energy = [&](const energy::readings_t &readings) {
+        for (size_t i = 0; i < readings.size(); i++)
+            s << (i ? ":" : "") << readings[i].first << "="
+              << readings[i].second / unit;
+    };
+
+    // The operations per joule of all the domains, which are the FLOPS per
+    // watt.
+    auto get_flops_per_watt = [&](const energy::readings_t &readings) {
+        double joules = 0;
+        for (const auto &r : readings)
+            joules += r.second;
+        if (joules <= 0) return 0.;
+        return ops() / joules / unit;
     };
 
     auto get_freq = [&](const timer::timer_t &t) -> double {
@@ -130,23 +199,34 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     HANDLE("ctx-exe", s << *ctx_exe());
     // Options operating on driver independent objects, e.g. timer values.
     HANDLE("bw", s << get_bw(res->timer_map.perf_timer()));
+    HANDLE("bw_util",
+            s << get_util(res->timer_map.perf_timer(),
+                    res->ibytes + res->obytes, get_peak_bw()));
     HANDLE("driver", s << driver_name);
     HANDLE("flops", s << get_flops(res->timer_map.perf_timer()));
+    HANDLE("flops_util",
+            s << get_util(res->timer_map.perf_timer(), ops(), peak_flops));
+    HANDLE("flops_per_watt",
+            s << get_flops_per_watt(res->energy_readings));
     HANDLE("clocks", s << res->timer_map.perf_timer().ticks(mode) / unit);
     HANDLE("prb", s << prb_str);
     HANDLE("freq", s << get_freq(res->timer_map.perf_timer()));
+    HANDLE("hist", dump_hist(res->timer_map.perf_timer()));
     HANDLE("ops", s << ops() / unit);
+    HANDLE("pmu", dump_pmu(res->pmu_counts));
+    HANDLE("energy", dump_energy(res->energy_readings));
     HANDLE("impl", s << res->impl_name);
     HANDLE("ibytes", s << res->ibytes / unit);
     HANDLE("obytes", s << res->obytes / unit);
     HANDLE("iobytes", s << (res->ibytes + res->obytes) / unit);
     HANDLE("idx", s << benchdnn_stat.tests);
-    HANDLE("time", s << res->timer_map.perf_timer().ms(mode) / unit);
+    HANDLE("time", s << get_ms(res->timer_map.perf_timer()) / unit);
     HANDLE("ctime",
             s << get_create_time(res->timer_map.cp_timer())
                             + get_create_time(res->timer_map.cpd_timer()));
     HANDLE("cptime", s << get_create_time(res->timer_map.cp_timer()));
     HANDLE("cpdtime", s << get_create_time(res->timer_map.cpd_timer()));
+    HANDLE("cblobtime", s << get_create_time(res->timer_map.cblob_timer()));
 
 #undef HANDLE
 
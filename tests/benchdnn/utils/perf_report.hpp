@@ -39,6 +39,17 @@ struct base_perf_report_t {
 
     /* truly common types */
     virtual double ops() const { return 0.; }
+
+    // The nominal number of operations per element of a normalization:
+    // forward takes an addition for the mean and a multiply-add for the
+    // variance unless the statistics are given, and a subtraction and a
+    // multiplication to normalize; backward takes an addition and a
+    // multiply-add to reduce the difference of the destination, and three
+    // operations to compute the difference of the source.
+    static double norm_ops_per_elem(dir_t dir, bool use_stats) {
+        if (!(dir & FLAG_FWD)) return 6.;
+        return use_stats ? 2. : 5.;
+    }
     virtual const attr_t *attr() const { return nullptr; }
     virtual const int *axis() const { return nullptr; }
     virtual const std::string *name() const { return nullptr; }
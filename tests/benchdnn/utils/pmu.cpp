@@ -0,0 +1,194 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <sstream>
+
+#include "common.hpp"
+
+#include "utils/parallel.hpp"
+#include "utils/pmu.hpp"
+
+#ifdef __linux__
+#include <unistd.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+namespace pmu {
+
+int parse_events(std::vector<event_t> &events, const std::string &list) {
+#ifdef __linux__
+    static const std::vector<event_t> known_events = {
+            {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {"ref-cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_REF_CPU_CYCLES},
+            {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {"llc-refs", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES},
+            {"llc-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {"branch-misses", PERF_TYPE_HARDWARE,
+                    PERF_COUNT_HW_BRANCH_MISSES},
+    };
+    static const std::string raw_prefix = "raw:";
+
+    events.clear();
+    std::stringstream ss(list);
+    std::string name;
+    while (std::getline(ss, name, ',')) {
+        if (name.compare(0, raw_prefix.size(), raw_prefix) == 0) {
+            const std::string config = name.substr(raw_prefix.size());
+            size_t pos = 0;
+            uint64_t value = 0;
+            try {
+                value = std::stoull(config, &pos, 0);
+            } catch (...) { pos = 0; }
+            if (config.empty() || pos != config.size()) {
+                BENCHDNN_PRINT(0, "Error: invalid raw PMU event \'%s\'.\n",
+                        name.c_str());
+                return FAIL;
+            }
+            events.push_back({name, PERF_TYPE_RAW, value});
+            continue;
+        }
+
+        bool found = false;
+        for (const auto &e : known_events) {
+            if (e.name != name) continue;
+            events.push_back(e);
+            found = true;
+            break;
+        }
+        if (!found) {
+            BENCHDNN_PRINT(0, "Error: unknown PMU event \'%s\'.\n",
+                    name.c_str());
+            return FAIL;
+        }
+    }
+    if (events.empty()) {
+        BENCHDNN_PRINT(0, "%s\n", "Error: no PMU events specified.");
+        return FAIL;
+    }
+    return OK;
+#else
+    BENCHDNN_PRINT(
+            0, "%s\n", "Error: PMU counters are supported on Linux only.");
+    return FAIL;
+#endif
+}
+
+#ifdef __linux__
+counters_t::~counters_t() {
+    for (const auto &thr_fds : fds_)
+        for (int fd : thr_fds)
+            close(fd);
+}
+
+int counters_t::init(const std::vector<event_t> &events) {
+    events_ = events;
+
+    // The counters of a thread are opened by the thread itself as they count
+    // the calling thread only. The workers of the runtime are expected to
+    // stay the same for the problem, which the OMP and sequential runtimes
+    // guarantee.
+    const int nthr = benchdnn_get_max_threads();
+    std::vector<std::vector<int>> fds(nthr);
+    std::atomic<bool> ok(true);
+    benchdnn_parallel(nthr, [&](int ithr, int nthr) {
+        for (const auto &e : events_) {
+            perf_event_attr attr {};
+            attr.size = sizeof(attr);
+            attr.type = e.type;
+            attr.config = e.config;
+            attr.disabled = fds[ithr].empty();
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP
+                    | PERF_FORMAT_TOTAL_TIME_ENABLED
+                    | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            const int leader = fds[ithr].empty() ? -1 : fds[ithr][0];
+            const long fd = syscall(
+                    SYS_perf_event_open, &attr, 0, -1, leader, 0);
+            if (fd < 0) {
+                ok = false;
+                return;
+            }
+            fds[ithr].push_back((int)fd);
+        }
+    });
+    fds_ = std::move(fds);
+
+    if (!ok) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "Error: opening PMU counters failed, check "
+                "/proc/sys/kernel/perf_event_paranoid and the events "
+                "supported by the CPU.");
+        for (const auto &thr_fds : fds_)
+            for (int fd : thr_fds)
+                close(fd);
+        fds_.clear();
+        return FAIL;
+    }
+    return OK;
+}
+
+void counters_t::start() const {
+    for (const auto &thr_fds : fds_)
+        ioctl(thr_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+void counters_t::stop() const {
+    for (const auto &thr_fds : fds_)
+        ioctl(thr_fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+}
+
+counts_t counters_t::read() const {
+    counts_t counts;
+    for (const auto &e : events_)
+        counts.emplace_back(e.name, 0.);
+    if (fds_.empty()) return counts;
+
+    // The layout of a group read: the number of events, the times the group
+    // was enabled and running, and the values.
+    std::vector<uint64_t> buf(3 + events_.size());
+    for (const auto &thr_fds : fds_) {
+        const ssize_t size = buf.size() * sizeof(uint64_t);
+        if (::read(thr_fds[0], buf.data(), size) != size) continue;
+        const double enabled = (double)buf[1];
+        const double running = (double)buf[2];
+        if (running == 0) continue;
+        for (size_t i = 0; i < events_.size(); i++)
+            counts[i].second += buf[3 + i] * (enabled / running);
+    }
+    return counts;
+}
+
+#else
+
+counters_t::~counters_t() = default;
+int counters_t::init(const std::vector<event_t> &events) {
+    BENCHDNN_PRINT(
+            0, "%s\n", "Error: PMU counters are supported on Linux only.");
+    return FAIL;
+}
+void counters_t::start() const {}
+void counters_t::stop() const {}
+counts_t counters_t::read() const {
+    return {};
+}
+
+#endif
+
+} // namespace pmu
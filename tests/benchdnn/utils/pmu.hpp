@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_PMU_HPP
+#define UTILS_PMU_HPP
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Helpers to count hardware events of the threads of the CPU runtime with
+// perf_event. They are available on Linux only; elsewhere they report an
+// error.
+namespace pmu {
+
+struct event_t {
+    std::string name;
+    uint32_t type;
+    uint64_t config;
+};
+
+// The counts of the events, in the order they were requested.
+using counts_t = std::vector<std::pair<std::string, double>>;
+
+// Parses a comma-separated list of events. An event is one of `cycles`,
+// `ref-cycles`, `instructions`, `llc-refs`, `llc-misses`, `branch-misses`, or
+// `raw:0xCONFIG` for a model-specific event, e.g. the retired AMX or AVX-512
+// operations.
+int parse_events(std::vector<event_t> &events, const std::string &list);
+
+// A group of counters per thread of the CPU runtime. The counters run only
+// between `start()` and `stop()`, and `read()` returns their sums over the
+// threads, scaled when the kernel multiplexed the events.
+struct counters_t {
+    counters_t() = default;
+    ~counters_t();
+
+    counters_t(const counters_t &) = delete;
+    counters_t &operator=(const counters_t &) = delete;
+
+    int init(const std::vector<event_t> &events);
+    bool is_initialized() const { return !fds_.empty(); }
+
+    void start() const;
+    void stop() const;
+    counts_t read() const;
+
+private:
+    std::vector<event_t> events_;
+    // The descriptors of the counters of each thread, the group leader
+    // first.
+    std::vector<std::vector<int>> fds_;
+};
+
+} // namespace pmu
+
+#endif
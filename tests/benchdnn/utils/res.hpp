@@ -19,6 +19,8 @@
 
 #include "oneapi/dnnl/dnnl_types.h"
 
+#include "utils/energy.hpp"
+#include "utils/pmu.hpp"
 #include "utils/timer.hpp"
 
 #include <string>
@@ -117,6 +119,10 @@ struct res_t {
     // TODO: fuse `ibytes` and `obytes` into `mem_size_args`.
     size_t ibytes, obytes;
     check_mem_size_args_t mem_size_args;
+    // The counts of the PMU events per execution, see `--pmu`.
+    pmu::counts_t pmu_counts;
+    // The energy of the domains per execution, see `--energy`.
+    energy::readings_t energy_readings;
 };
 
 #endif
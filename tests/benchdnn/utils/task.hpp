@@ -118,7 +118,8 @@ private:
     int report() {
         const prb_t *prb = &prb_;
         parse_result(res_, prb_.str());
-        if (has_bench_mode_bit(mode_bit_t::perf)) {
+        if (has_bench_mode_bit(mode_bit_t::perf)
+                || has_bench_mode_modifier(mode_modifier_t::create_time)) {
             perf_report_t pr(prb, perf_template_.c_str());
             pr.report(&res_, prb_.str());
         }
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 
 #include "common.hpp"
 #include "utils/timer.hpp"
@@ -51,6 +52,7 @@ void timer_t::reset() {
     for (int i = 0; i < n_modes; ++i)
         ms_[i] = 0;
     ms_start_ = 0;
+    samples_ms_.clear();
 
     start();
 }
@@ -86,12 +88,62 @@ void timer_t::stop(int add_times, int64_t add_ticks, double add_ms) {
             = times_ ? std::max(ticks_[mode_t::max], d_ticks) : d_ticks;
 
     times_ += add_times;
+    samples_ms_.push_back(d_ms);
 }
 
 void timer_t::stamp(int add_times) {
     stop(add_times, ticks_now() - ticks_start_, ms_now() - ms_start_);
 }
 
+void timer_t::merge(const timer_t &rhs) {
+    if (rhs.times_ == 0) return;
+
+    for (auto mode : {mode_t::avg, mode_t::sum}) {
+        ms_[mode] += rhs.ms_[mode];
+        ticks_[mode] += rhs.ticks_[mode];
+    }
+    ms_[mode_t::min] = times_ ? std::min(ms_[mode_t::min], rhs.ms_[mode_t::min])
+                              : rhs.ms_[mode_t::min];
+    ms_[mode_t::max] = times_ ? std::max(ms_[mode_t::max], rhs.ms_[mode_t::max])
+                              : rhs.ms_[mode_t::max];
+    ticks_[mode_t::min] = times_
+            ? std::min(ticks_[mode_t::min], rhs.ticks_[mode_t::min])
+            : rhs.ticks_[mode_t::min];
+    ticks_[mode_t::max] = times_
+            ? std::max(ticks_[mode_t::max], rhs.ticks_[mode_t::max])
+            : rhs.ticks_[mode_t::max];
+
+    times_ += rhs.times_;
+    samples_ms_.insert(samples_ms_.end(), rhs.samples_ms_.begin(),
+            rhs.samples_ms_.end());
+}
+
+double timer_t::percentile_ms(double p) const {
+    if (samples_ms_.empty()) return 0; // nothing to report
+
+    // The nearest-rank percentile.
+    std::vector<double> sorted(samples_ms_);
+    const size_t n = sorted.size();
+    size_t rank = (size_t)std::ceil(p / 100. * n);
+    rank = std::min(std::max(rank, (size_t)1), n);
+    std::nth_element(sorted.begin(), sorted.begin() + (rank - 1), sorted.end());
+    return sorted[rank - 1];
+}
+
+std::vector<int> timer_t::histogram(int nbins) const {
+    std::vector<int> bins(nbins, 0);
+    if (samples_ms_.empty() || nbins <= 0) return bins;
+
+    const auto mm = std::minmax_element(samples_ms_.begin(), samples_ms_.end());
+    const double lo = *mm.first;
+    const double width = (*mm.second - lo) / nbins;
+    for (double v : samples_ms_) {
+        int b = width > 0 ? (int)((v - lo) / width) : 0;
+        bins[std::min(b, nbins - 1)]++;
+    }
+    return bins;
+}
+
 timer_t &timer_t::operator=(const timer_t &rhs) {
     if (this == &rhs) return *this;
     *this = timer_t(rhs);
@@ -19,6 +19,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #define TIME_FUNC(func, res, name) \
     do { \
@@ -63,6 +64,17 @@ struct timer_t {
         stop(add_times, add_ticks, add_ms);
     }
 
+    // Accumulates the measurements of `rhs`.
+    void merge(const timer_t &rhs);
+
+    // Returns the time of the `p`-th percentile, 0 < p <= 100, of the
+    // measurements, in milliseconds.
+    double percentile_ms(double p) const;
+
+    // Returns the number of measurements in each of `nbins` bins of equal
+    // width between the minimum and the maximum time.
+    std::vector<int> histogram(int nbins) const;
+
     int times() const { return times_; }
 
     double total_ms() const { return ms_[avg]; }
@@ -86,6 +98,8 @@ struct timer_t {
     int times_;
     uint64_t ticks_[n_modes], ticks_start_;
     double ms_[n_modes], ms_start_;
+    // The time of an execution for every measurement, in milliseconds.
+    std::vector<double> samples_ms_;
 };
 
 // Designated timers to support benchdnn performance reporting and general time
@@ -99,6 +113,8 @@ const std::string ref_timer = "compute_ref_timer";
 const std::string cpd_timer = "create_pd_timer";
 // Primitive creation performace.
 const std::string cp_timer = "create_prim_timer";
+// Primitive creation from a cache blob performance.
+const std::string cblob_timer = "create_prim_from_cache_blob_timer";
 // Driver's comparison.
 const std::string compare_timer = "compare_timer";
 // Driver's memory filling.
@@ -115,6 +131,7 @@ struct timer_map_t {
     timer_t &perf_timer() { return get_timer(names::perf_timer); }
     timer_t &cpd_timer() { return get_timer(names::cpd_timer); }
     timer_t &cp_timer() { return get_timer(names::cp_timer); }
+    timer_t &cblob_timer() { return get_timer(names::cblob_timer); }
 
     std::unordered_map<std::string, timer_t> timers;
 };
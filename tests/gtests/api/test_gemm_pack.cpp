@@ -0,0 +1,151 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include <cstring>
+#include <vector>
+
+namespace dnnl {
+
+namespace {
+// Small integers keep the products exact, so that the packed and the regular
+// multiplications give the same results.
+template <typename T>
+std::vector<T> make_matrix(dnnl_dim_t size, int seed) {
+    std::vector<T> m(size);
+    for (dnnl_dim_t i = 0; i < size; i++)
+        m[i] = static_cast<T>((i * 7 + seed) % 9 - 4);
+    return m;
+}
+
+uint16_t f32_to_bf16_bits(float f) {
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    return static_cast<uint16_t>(bits >> 16);
+}
+} // namespace
+
+class gemm_pack_test_t : public ::testing::TestWithParam<char> {
+protected:
+    void SetUp() override {
+        SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE,
+                "CPU runtime is not enabled.");
+        transb = GetParam();
+        ldb = transb == 'N' ? N : K;
+    }
+
+    // Weights B are packed once and used by several multiplications.
+    const dnnl_dim_t M = 13, N = 35, K = 21;
+    const dnnl_dim_t lda = K, ldc = N;
+    char transb = 'N';
+    dnnl_dim_t ldb = N;
+};
+
+TEST_P(gemm_pack_test_t, TestSgemm) {
+    size_t size = 0;
+    dnnl_status_t st = dnnl_sgemm_pack_get_size(
+            'B', 'N', transb, M, N, K, lda, ldb, &size);
+    SKIP_IF(st == dnnl_unimplemented, "Packed sgemm is not supported.");
+    ASSERT_EQ(st, dnnl_success);
+
+    auto B = make_matrix<float>(K * N, 1);
+    std::vector<float> B_packed(size / sizeof(float) + 1);
+    ASSERT_EQ(dnnl_sgemm_pack('B', 'N', transb, M, N, K, lda, ldb, B.data(),
+                      B_packed.data()),
+            dnnl_success);
+
+    for (int seed = 0; seed < 2; seed++) {
+        auto A = make_matrix<float>(M * K, seed);
+        std::vector<float> C(M * N, 1.f), C_ref(M * N, 1.f);
+        ASSERT_EQ(dnnl_sgemm('N', transb, M, N, K, 1.f, A.data(), lda,
+                          B.data(), ldb, 1.f, C_ref.data(), ldc),
+                dnnl_success);
+        ASSERT_EQ(dnnl_sgemm_compute('N', 'P', M, N, K, A.data(), lda,
+                          B_packed.data(), ldb, 1.f, C.data(), ldc),
+                dnnl_success);
+        for (dnnl_dim_t i = 0; i < M * N; i++)
+            ASSERT_EQ(C[i], C_ref[i]);
+    }
+}
+
+TEST_P(gemm_pack_test_t, TestBf16) {
+    size_t size = 0;
+    dnnl_status_t st = dnnl_gemm_bf16bf16f32_pack_get_size(
+            'B', 'N', transb, M, N, K, lda, ldb, &size);
+    SKIP_IF(st == dnnl_unimplemented, "Packed bf16 gemm is not supported.");
+    ASSERT_EQ(st, dnnl_success);
+
+    const auto A_f32 = make_matrix<float>(M * K, 0);
+    const auto B_f32 = make_matrix<float>(K * N, 1);
+    std::vector<uint16_t> A(M * K), B(K * N);
+    for (dnnl_dim_t i = 0; i < M * K; i++)
+        A[i] = f32_to_bf16_bits(A_f32[i]);
+    for (dnnl_dim_t i = 0; i < K * N; i++)
+        B[i] = f32_to_bf16_bits(B_f32[i]);
+
+    std::vector<uint16_t> B_packed(size / sizeof(uint16_t) + 1);
+    ASSERT_EQ(dnnl_gemm_bf16bf16f32_pack('B', 'N', transb, M, N, K, lda, ldb,
+                      B.data(), B_packed.data()),
+            dnnl_success);
+
+    std::vector<float> C(M * N, 0.f), C_ref(M * N, 0.f);
+    ASSERT_EQ(dnnl_sgemm('N', transb, M, N, K, 1.f, A_f32.data(), lda,
+                      B_f32.data(), ldb, 0.f, C_ref.data(), ldc),
+            dnnl_success);
+    ASSERT_EQ(dnnl_gemm_bf16bf16f32_compute('N', 'P', M, N, K, A.data(), lda,
+                      B_packed.data(), ldb, 0.f, C.data(), ldc),
+            dnnl_success);
+    for (dnnl_dim_t i = 0; i < M * N; i++)
+        ASSERT_EQ(C[i], C_ref[i]);
+}
+
+TEST_P(gemm_pack_test_t, TestU8s8s32) {
+    size_t size = 0;
+    dnnl_status_t st = dnnl_gemm_u8s8s32_pack_get_size(
+            'B', 'N', transb, M, N, K, lda, ldb, &size);
+    SKIP_IF(st == dnnl_unimplemented, "Packed int8 gemm is not supported.");
+    ASSERT_EQ(st, dnnl_success);
+
+    auto A = make_matrix<uint8_t>(M * K, 0);
+    for (auto &a : A)
+        a = static_cast<uint8_t>(a + 4);
+    const auto B = make_matrix<int8_t>(K * N, 1);
+    std::vector<uint8_t> B_packed(size + 1);
+    ASSERT_EQ(dnnl_gemm_u8s8s32_pack('B', 'N', transb, M, N, K, lda, ldb,
+                      B.data(), B_packed.data()),
+            dnnl_success);
+
+    const int32_t co = 3;
+    std::vector<int32_t> C(M * N, 0), C_ref(M * N, 0);
+    ASSERT_EQ(dnnl_gemm_u8s8s32('N', transb, 'F', M, N, K, 1.f, A.data(), lda,
+                      0, B.data(), ldb, 0, 0.f, C_ref.data(), ldc, &co),
+            dnnl_success);
+    ASSERT_EQ(dnnl_gemm_u8s8s32_compute('N', 'P', 'F', M, N, K, A.data(), lda,
+                      reinterpret_cast<const int8_t *>(B_packed.data()), ldb,
+                      0.f, C.data(), ldc, &co),
+            dnnl_success);
+    for (dnnl_dim_t i = 0; i < M * N; i++)
+        ASSERT_EQ(C[i], C_ref[i]);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+        TestGemmPack, gemm_pack_test_t, ::testing::Values('N', 'T'));
+
+} // namespace dnnl
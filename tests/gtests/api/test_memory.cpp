@@ -23,6 +23,11 @@
 #include <limits>
 #include <new>
 
+#if defined(__linux__)
+#include <cstdlib>
+#include <unistd.h>
+#endif
+
 #ifdef DNNL_WITH_SYCL
 #include "oneapi/dnnl/dnnl_sycl.hpp"
 #endif
@@ -112,6 +117,40 @@ TEST_P(memory_test_cpp_t, OutOfMemory) {
     if (!is_sycl) FAIL() << "Expected exception.";
 }
 
+TEST_P(memory_test_cpp_t, PaddingZeroedAfterUserWrite) {
+    dnnl_engine_kind_t eng_kind_c = GetParam();
+    engine::kind eng_kind = static_cast<engine::kind>(eng_kind_c);
+    SKIP_IF(engine::get_count(eng_kind) == 0, "Engine is not found.");
+
+    engine eng(eng_kind, 0);
+    stream strm(eng);
+
+    // C = 3 leaves most of the 16c block in the padded area.
+    memory::desc md({2, 3, 4, 4}, memory::data_type::f32,
+            memory::format_tag::nChw16c);
+    memory src(md, eng), dst(md, eng);
+    fill_data<float>(md.get_size() / sizeof(float), src);
+    check_zero_tail<float>(1, src);
+
+    auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, md, 0.f);
+    eltwise_forward prim(pd);
+    prim.execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    strm.wait();
+    check_zero_tail<float>(0, dst);
+
+    // Pollute the padded area through a mapping. The next execution must
+    // leave it zeroed again even though it was zeroed before.
+    {
+        auto dst_data = map_memory<float>(dst);
+        for (size_t i = 0; i < md.get_size() / sizeof(float); i++)
+            dst_data[i] = 1.f;
+    }
+    prim.execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    strm.wait();
+    check_zero_tail<float>(0, dst);
+}
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
@@ -313,4 +352,106 @@ TEST(cpp_api_host_scalar_mem, TestDataTypeMismatch) {
     }
 }
 
+TEST(cpp_api_stream_mem, TestReuse) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine::kind eng_kind = engine::kind::cpu;
+    SKIP_IF(engine::get_count(eng_kind) == 0, "Engine is not found.");
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Stream allocation is not supported with SYCL CPU runtime.");
+    engine eng(eng_kind, 0);
+    stream s(eng);
+
+    const memory::dim N = 1024;
+    memory::desc md({N}, dt::f32, tag::a);
+    memory src_mem(md, eng);
+    memory dst_mem(md, eng);
+    {
+        float *ptr = static_cast<float *>(src_mem.map_data());
+        for (memory::dim i = 0; i < N; i++)
+            ptr[i] = (float)i;
+        src_mem.unmap_data(ptr);
+    }
+
+    // Every iteration takes the buffer released by the previous one in
+    // stream order, which holds with asynchronous execution as well.
+    for (int iter = 0; iter < 3; iter++) {
+        memory tmp_mem(md, s);
+        reorder(src_mem, tmp_mem).execute(s, src_mem, tmp_mem);
+        reorder(tmp_mem, dst_mem).execute(s, tmp_mem, dst_mem);
+    }
+    s.wait();
+
+    const float *ptr = static_cast<const float *>(dst_mem.map_data());
+    for (memory::dim i = 0; i < N; i++)
+        ASSERT_EQ(ptr[i], (float)i);
+    dst_mem.unmap_data(const_cast<float *>(ptr));
+
+    // A memory object may outlive its stream.
+    memory tmp_mem;
+    {
+        stream s_tmp(eng);
+        tmp_mem = memory(md, s_tmp);
+    }
+    ASSERT_NE(tmp_mem.get_data_handle(), nullptr);
+}
+
+#if defined(__linux__)
+TEST(cpp_api_file_mem, TestPackedWeightsRoundTrip) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine::kind eng_kind = engine::kind::cpu;
+    SKIP_IF(engine::get_count(eng_kind) == 0, "Engine is not found.");
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "File mapping is not supported with SYCL CPU runtime.");
+    engine eng(eng_kind, 0);
+    stream s(eng);
+
+    const memory::dim K = 64, N = 48;
+    memory::desc user_md({K, N}, dt::f32, tag::ab);
+    memory::desc packed_md({K, N}, dt::f32, tag::ba);
+    // The offset of the packed weights is not page aligned.
+    const size_t offset = 64;
+    const size_t file_size = offset + packed_md.get_size();
+
+    char path[] = "/tmp/dnnl_test_file_memXXXXXX";
+    const int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    unlink(path);
+    ASSERT_EQ(ftruncate(fd, (off_t)file_size), 0);
+
+    memory user_mem(user_md, eng);
+    {
+        float *ptr = static_cast<float *>(user_mem.map_data());
+        for (memory::dim i = 0; i < K * N; i++)
+            ptr[i] = (float)i;
+        user_mem.unmap_data(ptr);
+    }
+
+    // The reorder writes the packed weights straight to the file.
+    {
+        memory file_mem(packed_md, eng, fd, offset,
+                memory::file_flags::writable);
+        reorder(user_mem, file_mem).execute(s, user_mem, file_mem);
+        s.wait();
+    }
+
+    // A new mapping reads them back from the page cache.
+    memory file_mem(packed_md, eng, fd, offset,
+            memory::file_flags::populate | memory::file_flags::huge_pages);
+    // The range must be within the file.
+    EXPECT_THROW(memory(packed_md, eng, fd, offset + 4,
+                         memory::file_flags::none),
+            dnnl::error);
+    close(fd);
+    const float *ptr = static_cast<const float *>(file_mem.map_data());
+    for_(memory::dim k = 0; k < K; k++)
+    for (memory::dim n = 0; n < N; n++)
+        ASSERT_EQ(ptr[n * K + k], (float)(k * N + n));
+    file_mem.unmap_data(const_cast<float *>(ptr));
+}
+#endif
+
 } // namespace dnnl
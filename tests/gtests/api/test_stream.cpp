@@ -19,6 +19,7 @@
 
 #include "oneapi/dnnl/dnnl.h"
 
+#include <thread>
 #include <tuple>
 
 namespace dnnl {
@@ -137,6 +138,118 @@ TEST(stream_test_c_t, GetStream) {
 }
 #endif
 
+#if defined(DNNL_EXPERIMENTAL_PROFILING) \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+TEST(stream_test_cpp_t, ProfilingCPU) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng, stream::flags::in_order | stream::flags::profiling);
+
+    memory::desc md({16, 1024}, memory::data_type::f32, memory::format_tag::ab);
+    memory src(md, eng), dst(md, eng);
+    auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, md, 0.f);
+    eltwise_forward prim(pd);
+
+    reset_profiling(s);
+    const int n_execs = 3;
+    for (int i = 0; i < n_execs; i++)
+        prim.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    const auto time = get_profiling_data(s, profiling_data_kind::time);
+    const auto thread_time
+            = get_profiling_data(s, profiling_data_kind::thread_time);
+    const auto nthr = get_profiling_data(s, profiling_data_kind::nthr);
+    ASSERT_EQ(time.size(), (size_t)n_execs);
+    ASSERT_EQ(thread_time.size(), (size_t)n_execs);
+    ASSERT_EQ(nthr.size(), (size_t)n_execs);
+    for (int i = 0; i < n_execs; i++) {
+        ASSERT_GT(time[i], 0u);
+        ASSERT_GE(nthr[i], 1u);
+    }
+
+    reset_profiling(s);
+    ASSERT_TRUE(get_profiling_data(s, profiling_data_kind::time).empty());
+}
+#endif
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+TEST(stream_test_cpp_t, CaptureReplayCPU) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+
+    const memory::dim n = 32;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    memory mem(md, eng);
+    auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_linear, md, md, 2.f, 1.f);
+
+    float *ptr = static_cast<float *>(mem.get_data_handle());
+    for (memory::dim i = 0; i < n; i++)
+        ptr[i] = 1.f;
+
+    begin_stream_capture(s);
+    {
+        // The recording keeps the primitive alive.
+        eltwise_forward prim(pd);
+        prim.execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+        prim.execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+    }
+    end_stream_capture(s);
+
+    // Captured executions are not executed.
+    for (memory::dim i = 0; i < n; i++)
+        ASSERT_EQ(ptr[i], 1.f);
+
+    replay_stream_capture(s);
+    s.wait();
+    for (memory::dim i = 0; i < n; i++)
+        ASSERT_EQ(ptr[i], 7.f);
+
+    replay_stream_capture(s);
+    s.wait();
+    for (memory::dim i = 0; i < n; i++)
+        ASSERT_EQ(ptr[i], 31.f);
+
+    EXPECT_ANY_THROW(end_stream_capture(s));
+}
+#endif
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+TEST(stream_test_cpp_t, CpuAffinity) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+
+    EXPECT_ANY_THROW(set_stream_cpu_affinity(s, {-1}));
+    ASSERT_NO_THROW(set_stream_cpu_affinity(s, {0}));
+
+    const memory::dim n = 4096;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    memory mem(md, eng);
+    float *ptr = static_cast<float *>(mem.get_data_handle());
+    for (memory::dim i = 0; i < n; i++)
+        ptr[i] = -1.f;
+
+    auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, md, 0.f);
+    eltwise_forward prim(pd);
+    // The executing threads stay bound to the CPU set, so a separate thread
+    // is used to keep the binding from affecting other tests.
+    std::thread t([&]() {
+        prim.execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+        s.wait();
+    });
+    t.join();
+    for (memory::dim i = 0; i < n; i++)
+        ASSERT_EQ(ptr[i], 0.f);
+
+    ASSERT_NO_THROW(set_stream_cpu_affinity(s, {}));
+}
+#endif
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
@@ -19,7 +19,15 @@
 #include "test_api_common.hpp"
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <vector>
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "oneapi/dnnl/dnnl_graph_threadpool.hpp"
+#include "oneapi/dnnl/dnnl_threadpool.hpp"
+#include "test_thread.hpp"
+#endif
 
 TEST(APIPartition, PartitionTest) {
     using namespace dnnl::graph;
@@ -390,3 +398,357 @@ TEST(APIPartition, F8MatmulPartition) {
         parts[0].compile({deq0_src, deq1_src}, {mm_dst}, eng);
     }
 }
+
+TEST(APIPartition, TemporaryArena) {
+    using namespace dnnl::graph;
+    dnnl::engine::kind engine_kind
+            = static_cast<dnnl::engine::kind>(api_test_engine_kind);
+    if (engine_kind != dnnl::engine::kind::cpu) {
+        GTEST_SKIP() << "the arena is bound to a host buffer";
+    }
+
+    allocator alloc;
+    dnnl::engine eng = make_engine_with_allocator(engine_kind, 0, alloc);
+    dnnl::stream strm {eng};
+
+    logical_tensor conv_src {0, logical_tensor::data_type::f32,
+            {2, 16, 14, 14}, logical_tensor::layout_type::strided};
+    logical_tensor conv_wei {1, logical_tensor::data_type::f32,
+            {32, 16, 3, 3}, logical_tensor::layout_type::strided};
+    logical_tensor conv_dst {2, logical_tensor::data_type::f32,
+            {2, 32, 12, 12}, logical_tensor::layout_type::strided};
+    op conv(0, op::kind::Convolution, "conv");
+    conv.set_attr<std::vector<int64_t>>(op::attr::strides, {1, 1});
+    conv.set_attr<std::vector<int64_t>>(op::attr::pads_begin, {0, 0});
+    conv.set_attr<std::vector<int64_t>>(op::attr::pads_end, {0, 0});
+    conv.set_attr<std::vector<int64_t>>(op::attr::dilations, {1, 1});
+    conv.set_attr<std::string>(op::attr::data_format, "NCX");
+    conv.set_attr<std::string>(op::attr::weights_format, "OIX");
+    conv.set_attr<int64_t>(op::attr::groups, 1);
+    conv.add_inputs({conv_src, conv_wei});
+    conv.add_output(conv_dst);
+
+    logical_tensor mm_src {3, logical_tensor::data_type::f32, {64, 48},
+            logical_tensor::layout_type::strided};
+    logical_tensor mm_wei {4, logical_tensor::data_type::f32, {48, 32},
+            logical_tensor::layout_type::strided};
+    logical_tensor mm_dst {5, logical_tensor::data_type::f32, {64, 32},
+            logical_tensor::layout_type::strided};
+    op mm(1, op::kind::MatMul, "matmul");
+    mm.add_inputs({mm_src, mm_wei});
+    mm.add_output(mm_dst);
+
+    partition conv_part {conv, engine_kind};
+    partition mm_part {mm, engine_kind};
+    ASSERT_TRUE(conv_part.is_supported());
+    ASSERT_TRUE(mm_part.is_supported());
+    std::vector<compiled_partition> cps {
+            conv_part.compile({conv_src, conv_wei}, {conv_dst}, eng),
+            mm_part.compile({mm_src, mm_wei}, {mm_dst}, eng)};
+
+    const size_t arena_size = get_temporary_arena_size(cps);
+    ASSERT_EQ(arena_size,
+            std::max(cps[0].get_temporary_size(),
+                    cps[1].get_temporary_size()));
+
+    const std::vector<std::vector<logical_tensor>> ins {
+            {conv_src, conv_wei}, {mm_src, mm_wei}};
+    const std::vector<logical_tensor> outs {conv_dst, mm_dst};
+    std::vector<std::vector<std::vector<float>>> in_data(2);
+    for (size_t i = 0; i < ins.size(); ++i) {
+        for (const auto &lt : ins[i]) {
+            std::vector<float> data(lt.get_mem_size() / sizeof(float));
+            for (size_t j = 0; j < data.size(); ++j)
+                data[j] = static_cast<float>(j % 7) - 3.f;
+            in_data[i].push_back(data);
+        }
+    }
+
+    const auto run = [&](std::vector<std::vector<float>> &results) {
+        results.clear();
+        for (size_t i = 0; i < cps.size(); ++i) {
+            std::vector<tensor> in_ts;
+            for (size_t j = 0; j < ins[i].size(); ++j)
+                in_ts.emplace_back(ins[i][j], eng, in_data[i][j].data());
+            std::vector<float> out(outs[i].get_mem_size() / sizeof(float));
+            tensor out_t {outs[i], eng, out.data()};
+            cps[i].execute(strm, in_ts, {out_t});
+            strm.wait();
+            results.push_back(out);
+        }
+    };
+
+    std::vector<std::vector<float>> ref, res;
+    run(ref);
+
+    // The partitions are executed one after another, so all of them take
+    // their temporary memory from the same arena.
+    std::vector<char> arena(arena_size);
+    alloc.set_temporary_arena(arena.data(), arena.size());
+    run(res);
+    alloc.set_temporary_arena(nullptr, 0);
+
+    ASSERT_EQ(ref, res);
+}
+
+TEST(APIPartition, CompilePartitions) {
+    using namespace dnnl::graph;
+    dnnl::engine::kind engine_kind
+            = static_cast<dnnl::engine::kind>(api_test_engine_kind);
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(engine_kind);
+
+    std::vector<partition> parts;
+    std::vector<std::vector<logical_tensor>> ins, outs;
+    for (size_t i = 0; i < 4; ++i) {
+        const auto id = static_cast<size_t>(3 * i);
+        const int64_t k = 16 * static_cast<int64_t>(i + 1);
+        logical_tensor src {id, logical_tensor::data_type::f32, {32, k},
+                logical_tensor::layout_type::strided};
+        logical_tensor wei {id + 1, logical_tensor::data_type::f32, {k, 32},
+                logical_tensor::layout_type::strided};
+        logical_tensor dst {id + 2, logical_tensor::data_type::f32, {32, 32},
+                logical_tensor::layout_type::strided};
+        op mm(i, op::kind::MatMul, "matmul");
+        mm.add_inputs({src, wei});
+        mm.add_output(dst);
+        parts.emplace_back(mm, engine_kind);
+        ASSERT_TRUE(parts.back().is_supported());
+        ins.push_back({src, wei});
+        outs.push_back({dst});
+    }
+
+    const auto cps = compile_partitions(parts, ins, outs, eng);
+    ASSERT_EQ(cps.size(), parts.size());
+    for (size_t i = 0; i < parts.size(); ++i) {
+        const auto ref = parts[i].compile(ins[i], outs[i], eng);
+        const auto id = outs[i][0].get_id();
+        ASSERT_EQ(cps[i].query_logical_tensor(id).get_mem_size(),
+                ref.query_logical_tensor(id).get_mem_size());
+    }
+
+    EXPECT_TRUE(compile_partitions({}, {}, {}, eng).empty());
+    EXPECT_THROW(compile_partitions(parts, ins, {}, eng), dnnl::error);
+}
+
+TEST(APIPartition, ExecutePartitions) {
+    using namespace dnnl::graph;
+    dnnl::engine::kind engine_kind
+            = static_cast<dnnl::engine::kind>(api_test_engine_kind);
+    if (engine_kind != dnnl::engine::kind::cpu) {
+        GTEST_SKIP() << "the tensors are bound to host buffers";
+    }
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(engine_kind);
+    dnnl::stream strm {eng};
+
+    // Two independent ReLU branches merged by an Add.
+    const logical_tensor::dims shape {8, 32};
+    std::vector<logical_tensor> lts;
+    for (size_t id = 0; id < 5; ++id)
+        lts.emplace_back(id, logical_tensor::data_type::f32, shape,
+                logical_tensor::layout_type::strided);
+    op relu0(0, op::kind::ReLU, "relu0");
+    relu0.add_input(lts[0]);
+    relu0.add_output(lts[1]);
+    op relu1(1, op::kind::ReLU, "relu1");
+    relu1.add_input(lts[2]);
+    relu1.add_output(lts[3]);
+    op add(2, op::kind::Add, "add");
+    add.add_inputs({lts[1], lts[3]});
+    add.add_output(lts[4]);
+
+    const std::vector<std::vector<logical_tensor>> ins {
+            {lts[0]}, {lts[2]}, {lts[1], lts[3]}};
+    const std::vector<std::vector<logical_tensor>> outs {
+            {lts[1]}, {lts[3]}, {lts[4]}};
+    std::vector<compiled_partition> cps;
+    for (const auto &o : {relu0, relu1, add}) {
+        partition p {o, engine_kind};
+        ASSERT_TRUE(p.is_supported());
+        cps.push_back(p.compile(ins[cps.size()], outs[cps.size()], eng));
+    }
+
+    const size_t nelems = static_cast<size_t>(shape[0] * shape[1]);
+    std::vector<std::vector<float>> data(
+            lts.size(), std::vector<float>(nelems));
+    for (size_t i = 0; i < nelems; ++i) {
+        data[0][i] = static_cast<float>(i % 7) - 3.f;
+        data[2][i] = static_cast<float>(i % 5) - 2.f;
+    }
+    std::vector<tensor> ts;
+    for (size_t id = 0; id < lts.size(); ++id)
+        ts.emplace_back(lts[id], eng, data[id].data());
+
+    execute_partitions(strm, cps, {{ts[0]}, {ts[2]}, {ts[1], ts[3]}},
+            {{ts[1]}, {ts[3]}, {ts[4]}});
+    strm.wait();
+    for (size_t i = 0; i < nelems; ++i) {
+        ASSERT_EQ(data[4][i],
+                std::max(data[0][i], 0.f) + std::max(data[2][i], 0.f));
+    }
+
+    EXPECT_NO_THROW(execute_partitions(strm, {}, {}, {}));
+    EXPECT_THROW(execute_partitions(strm, cps, {}, {}), dnnl::error);
+}
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+namespace {
+// Forwards the work to the testing threadpool and requests non-blocking
+// execution.
+struct non_blocking_threadpool_t
+    : public dnnl::threadpool_interop::threadpool_iface {
+    non_blocking_threadpool_t(dnnl::threadpool_interop::threadpool_iface *tp)
+        : tp_(tp) {}
+
+    int get_num_threads() const override { return tp_->get_num_threads(); }
+    bool get_in_parallel() const override { return tp_->get_in_parallel(); }
+    void parallel_for(
+            int n, const std::function<void(int, int)> &fn) override {
+        tp_->parallel_for(n, fn);
+    }
+    uint64_t get_flags() const override {
+        return tp_->get_flags() | NON_BLOCKING_EXECUTE;
+    }
+
+private:
+    dnnl::threadpool_interop::threadpool_iface *tp_;
+};
+} // namespace
+
+TEST(APIPartition, ExecuteAsyncWithEvents) {
+    using namespace dnnl::graph;
+    dnnl::engine::kind engine_kind
+            = static_cast<dnnl::engine::kind>(api_test_engine_kind);
+    if (engine_kind != dnnl::engine::kind::cpu) {
+        GTEST_SKIP() << "threadpool events are supported on CPU only";
+    }
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(engine_kind);
+    non_blocking_threadpool_t tp(dnnl::testing::get_threadpool());
+    dnnl::stream strm = dnnl::threadpool_interop::make_stream(eng, &tp);
+
+    // ReLU followed by Abs, the second partition depends on the first one.
+    const logical_tensor::dims shape {8, 32};
+    std::vector<logical_tensor> lts;
+    for (size_t id = 0; id < 3; ++id)
+        lts.emplace_back(id, logical_tensor::data_type::f32, shape,
+                logical_tensor::layout_type::strided);
+    op relu(0, op::kind::ReLU, "relu");
+    relu.add_input(lts[0]);
+    relu.add_output(lts[1]);
+    op abs(1, op::kind::Abs, "abs");
+    abs.add_input(lts[1]);
+    abs.add_output(lts[2]);
+
+    partition p0 {relu, engine_kind};
+    partition p1 {abs, engine_kind};
+    ASSERT_TRUE(p0.is_supported() && p1.is_supported());
+    compiled_partition cp0 = p0.compile({lts[0]}, {lts[1]}, eng);
+    compiled_partition cp1 = p1.compile({lts[1]}, {lts[2]}, eng);
+
+    const size_t nelems = static_cast<size_t>(shape[0] * shape[1]);
+    std::vector<std::vector<float>> data(
+            lts.size(), std::vector<float>(nelems, 0.f));
+    for (size_t i = 0; i < nelems; ++i)
+        data[0][i] = static_cast<float>(i % 7) - 3.f;
+    std::vector<tensor> ts;
+    for (size_t id = 0; id < lts.size(); ++id)
+        ts.emplace_back(lts[id], eng, data[id].data());
+
+    threadpool_interop::event e1;
+    {
+        // The dependency event may be destroyed before the execution.
+        threadpool_interop::event e0
+                = threadpool_interop::execute(cp0, strm, {ts[0]}, {ts[1]});
+        e1 = threadpool_interop::execute(cp1, strm, {ts[1]}, {ts[2]}, {e0});
+    }
+    e1.wait();
+    ASSERT_TRUE(e1.is_completed());
+    for (size_t i = 0; i < nelems; ++i)
+        ASSERT_EQ(data[2][i], std::max(data[0][i], 0.f));
+    strm.wait();
+}
+#endif
+
+TEST(APIPartition, CompileFromCacheBlob) {
+    using namespace dnnl::graph;
+    dnnl::engine::kind engine_kind
+            = static_cast<dnnl::engine::kind>(api_test_engine_kind);
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(engine_kind);
+
+    logical_tensor src {0, logical_tensor::data_type::f32, {32, 64},
+            logical_tensor::layout_type::strided};
+    logical_tensor wei {1, logical_tensor::data_type::f32, {64, 32},
+            logical_tensor::layout_type::strided};
+    logical_tensor dst {2, logical_tensor::data_type::f32, {32, 32},
+            logical_tensor::layout_type::strided};
+    op mm(0, op::kind::MatMul, "matmul");
+    mm.add_inputs({src, wei});
+    mm.add_output(dst);
+    partition p {mm, engine_kind};
+    ASSERT_TRUE(p.is_supported());
+
+    const auto cp = p.compile({src, wei}, {dst}, eng);
+    const auto cache_blob = cp.get_cache_blob();
+    ASSERT_FALSE(cache_blob.empty());
+
+    const auto cp_from_blob = p.compile({src, wei}, {dst}, eng, cache_blob);
+    ASSERT_EQ(cp_from_blob.query_logical_tensor(2).get_mem_size(),
+            cp.query_logical_tensor(2).get_mem_size());
+
+    const std::vector<uint8_t> bad_blob(cache_blob.size(), 0);
+    EXPECT_THROW(p.compile({src, wei}, {dst}, eng, bad_blob), dnnl::error);
+}
+
+TEST(APIPartition, ExecutePartitionsAliasing) {
+    using namespace dnnl::graph;
+    dnnl::engine::kind engine_kind
+            = static_cast<dnnl::engine::kind>(api_test_engine_kind);
+    if (engine_kind != dnnl::engine::kind::cpu) {
+        GTEST_SKIP() << "the tensors are bound to host buffers";
+    }
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(engine_kind);
+    dnnl::stream strm {eng};
+
+    // The second ReLU reads a buffer that starts in the middle of the one
+    // written by the first ReLU, so the handles differ but the ranges
+    // overlap and the partitions must be executed in order.
+    const logical_tensor::dims shape {8, 32};
+    std::vector<logical_tensor> lts;
+    for (size_t id = 0; id < 4; ++id)
+        lts.emplace_back(id, logical_tensor::data_type::f32, shape,
+                logical_tensor::layout_type::strided);
+    op relu0(0, op::kind::ReLU, "relu0");
+    relu0.add_input(lts[0]);
+    relu0.add_output(lts[1]);
+    op relu1(1, op::kind::ReLU, "relu1");
+    relu1.add_input(lts[2]);
+    relu1.add_output(lts[3]);
+
+    const std::vector<std::vector<logical_tensor>> ins {{lts[0]}, {lts[2]}};
+    const std::vector<std::vector<logical_tensor>> outs {{lts[1]}, {lts[3]}};
+    std::vector<compiled_partition> cps;
+    for (const auto &o : {relu0, relu1}) {
+        partition p {o, engine_kind};
+        ASSERT_TRUE(p.is_supported());
+        cps.push_back(p.compile(ins[cps.size()], outs[cps.size()], eng));
+    }
+
+    const size_t nelems = static_cast<size_t>(shape[0] * shape[1]);
+    const size_t offset = nelems / 2;
+    std::vector<float> src(nelems), shared(offset + nelems, -1.f),
+            dst(nelems);
+    for (size_t i = 0; i < nelems; ++i)
+        src[i] = static_cast<float>(i % 7) - 3.f;
+    tensor t_src {lts[0], eng, src.data()};
+    tensor t_mid {lts[1], eng, shared.data()};
+    tensor t_mid_view {lts[2], eng, shared.data() + offset};
+    tensor t_dst {lts[3], eng, dst.data()};
+
+    execute_partitions(
+            strm, cps, {{t_src}, {t_mid_view}}, {{t_mid}, {t_dst}});
+    strm.wait();
+    for (size_t i = 0; i < nelems; ++i) {
+        const float expected
+                = i + offset < nelems ? std::max(src[i + offset], 0.f) : 0.f;
+        ASSERT_EQ(dst[i], expected);
+    }
+}
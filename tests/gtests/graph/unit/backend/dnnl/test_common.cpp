@@ -120,3 +120,40 @@ TEST(test_common, FillLayoutInfoDeathTest) {
         ASSERT_EQ(ltw(lt).vstrides(), strides);
     }
 }
+
+TEST(test_common, PreferBlockedLayout) {
+    graph::engine_t &eng = *get_engine();
+    if (eng.kind() != graph::engine_kind::cpu) {
+        GTEST_SKIP() << "the cost model is used on CPU only";
+    }
+
+    using md_t = dnnl::memory::desc;
+    using tag = dnnl::memory::format_tag;
+    const auto f32 = dnnl::memory::data_type::f32;
+    const dnnl::engine p_engine(dnnl::engine::kind::cpu, 0);
+    const md_t wei {{32, 16, 3, 3}, f32, tag::any};
+    auto create_pd = [&](tag src_tag, tag dst_tag) {
+        return dnnl::convolution_forward::primitive_desc(p_engine,
+                dnnl::prop_kind::forward_inference,
+                dnnl::algorithm::convolution_direct,
+                md_t {{1, 16, 14, 14}, f32, src_tag}, wei,
+                md_t {{1, 32, 14, 14}, f32, dst_tag}, {1, 1}, {1, 1}, {1, 1});
+    };
+    const auto any_pd = create_pd(tag::any, tag::any);
+    const auto plain_pd = create_pd(tag::nhwc, tag::nhwc);
+
+    // A plain layout chosen for `any` is never reported as blocked.
+    ASSERT_FALSE(dnnl_impl::prefer_blocked_layout(
+            plain_pd, plain_pd, plain_pd.src_desc()));
+    if (dnnl_impl::is_plain(any_pd.src_desc())) {
+        ASSERT_FALSE(dnnl_impl::prefer_blocked_layout(
+                any_pd, plain_pd, any_pd.src_desc()));
+        return;
+    }
+    // With the same implementation for both layouts, the blocked one is
+    // kept only if the source already has it.
+    ASSERT_TRUE(dnnl_impl::prefer_blocked_layout(
+            any_pd, any_pd, any_pd.src_desc()));
+    ASSERT_FALSE(dnnl_impl::prefer_blocked_layout(
+            any_pd, any_pd, plain_pd.src_desc()));
+}
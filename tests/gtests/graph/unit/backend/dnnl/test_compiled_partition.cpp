@@ -360,3 +360,71 @@ TEST(test_compiled_partition, GetInputsAndOutputs) {
                 ltw(cp->get_outputs()[i]).is_identical(ltw(outputs[i])), true);
     }
 }
+
+TEST(test_compiled_partition, DynamicShapeMatMul) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    const graph::dim_t K = 8, N = 4;
+    const graph::dim_t unknown = DNNL_GRAPH_UNKNOWN_DIM;
+    graph::op_t matmul_op(graph::op_kind::MatMul, "matmul");
+
+    // The number of rows is only known at execution.
+    const graph::logical_tensor_t lt_src = utils::logical_tensor_init(
+            /* tid= */ 1, {unknown, K}, {K, 1}, graph::data_type::f32);
+    const graph::logical_tensor_t lt_wei = utils::logical_tensor_init(
+            /* tid= */ 2, {K, N}, graph::data_type::f32);
+    const graph::logical_tensor_t lt_dst = utils::logical_tensor_init(
+            /* tid= */ 3, {unknown, N}, {N, 1}, graph::data_type::f32);
+
+    matmul_op.add_input(lt_src);
+    matmul_op.add_input(lt_wei);
+    matmul_op.add_output(lt_dst);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&matmul_op);
+    g.finalize();
+    run_all_passes(g);
+
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> lt_inputs {&lt_src, &lt_wei};
+    std::vector<const graph::logical_tensor_t *> lt_outputs {&lt_dst};
+    ASSERT_EQ(p.compile(&cp, lt_inputs, lt_outputs, eng),
+            graph::status::success);
+
+    std::vector<float> wei(K * N);
+    for (size_t i = 0; i < wei.size(); i++)
+        wei[i] = static_cast<float>(i % 5) - 2.f;
+    test_tensor_t t_wei(lt_wei, eng, wei);
+
+    // A shape is executed a second time with the kernel of the first one.
+    for (graph::dim_t M : {3, 5, 3}) {
+        const auto lt_src_m = utils::logical_tensor_init(
+                lt_src.id, {M, K}, graph::data_type::f32);
+        const auto lt_dst_m = utils::logical_tensor_init(
+                lt_dst.id, {M, N}, graph::data_type::f32);
+        std::vector<float> src(M * K), dst(M * N, 0.f);
+        for (size_t i = 0; i < src.size(); i++)
+            src[i] = static_cast<float>(i % 7) - 3.f;
+        test_tensor_t t_src(lt_src_m, eng, src), t_dst(lt_dst_m, eng, dst);
+
+        EXPECT_SUCCESS(
+                cp.execute(strm, {t_src.get(), t_wei.get()}, {t_dst.get()}));
+        strm->wait();
+
+        dst = t_dst.as_vec_type<float>();
+        for (graph::dim_t m = 0; m < M; m++)
+            for (graph::dim_t n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (graph::dim_t k = 0; k < K; k++)
+                    ref += src[m * K + k] * wei[k * N + n];
+                ASSERT_FLOAT_EQ(dst[m * N + n], ref);
+            }
+    }
+}
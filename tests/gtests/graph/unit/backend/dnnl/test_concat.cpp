@@ -424,3 +424,74 @@ TEST(test_concat_execute, ConcatEmptyInput) {
             graph::status::success);
     strm->wait();
 }
+
+TEST(test_concat_execute, AppendInplace) {
+    graph::engine_t *eng = get_engine();
+    if (eng->kind() != graph::engine_kind::cpu) {
+        GTEST_SKIP() << "the tensors are bound to host buffers";
+    }
+
+    // A KV cache with a capacity of 8 tokens holding 3 tokens, appended with
+    // 1 token along the sequence dimension.
+    const graph::dim_t H = 2, S = 3, cap = 8, D = 4;
+    const std::vector<graph::dim_t> cache_strides {H * cap * D, cap * D, D, 1};
+
+    graph::op_t concat_op(graph::op_kind::Concat);
+    concat_op.set_attr<int64_t>(graph::op_attr::axis, 2);
+
+    graph::logical_tensor_t past = utils::logical_tensor_init(
+            0, {1, H, S, D}, cache_strides, graph::data_type::f32);
+    graph::logical_tensor_t cur = utils::logical_tensor_init(
+            1, {1, H, 1, D}, graph::data_type::f32);
+    graph::logical_tensor_t present = utils::logical_tensor_init(
+            2, {1, H, S + 1, D}, cache_strides, graph::data_type::f32);
+
+    concat_op.add_input(past);
+    concat_op.add_input(cur);
+    concat_op.add_output(present);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&concat_op);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("concat_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&past, &cur};
+    std::vector<const graph::logical_tensor_t *> outputs {&present};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    const auto &pairs = cp.get_inplace_pairs();
+    ASSERT_EQ(pairs.size(), 1U);
+    ASSERT_EQ(pairs[0].input_id, past.id);
+    ASSERT_EQ(pairs[0].output_id, present.id);
+
+    std::vector<float> cache(H * cap * D, -1.f);
+    for (graph::dim_t h = 0; h < H; h++)
+        for (graph::dim_t s = 0; s < S; s++)
+            for (graph::dim_t d = 0; d < D; d++)
+                cache[(h * cap + s) * D + d] = static_cast<float>(s);
+    std::vector<float> cur_data(H * D, static_cast<float>(S));
+
+    graph::tensor_t past_ts(past, eng, cache.data());
+    graph::tensor_t cur_ts(cur, eng, cur_data.data());
+    graph::tensor_t present_ts(present, eng, cache.data());
+
+    graph::stream_t *strm = get_stream();
+    ASSERT_EQ(cp.execute(strm, {past_ts, cur_ts}, {present_ts}),
+            graph::status::success);
+    strm->wait();
+
+    for (graph::dim_t h = 0; h < H; h++)
+        for (graph::dim_t s = 0; s < cap; s++)
+            for (graph::dim_t d = 0; d < D; d++) {
+                const float ref = s <= S ? static_cast<float>(s) : -1.f;
+                ASSERT_EQ(cache[(h * cap + s) * D + d], ref);
+            }
+}
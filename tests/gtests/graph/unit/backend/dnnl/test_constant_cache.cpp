@@ -13,6 +13,14 @@
 * See the License for the specific language governing permissions and
 * limitations under the License.
 *******************************************************************************/
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
 #include "gtest/gtest.h"
 
 #include "interface/constant_tensor_cache.hpp"
@@ -110,3 +118,97 @@ TEST(test_constant_cache, NoEvictWhenCacheFull) {
     // ignore since we use no_evict policy
     ASSERT_FALSE(cache.get_or_add(0, 3, 3, c_promise3_2.get_future()).valid());
 }
+
+TEST(test_constant_cache, EvictLowerPriority) {
+    using cached_t = graph::constant_tensor_cache_t::cached_t;
+    graph::engine_t &engine = *get_engine();
+    auto p_engine_ = dnnl_impl::make_dnnl_engine(engine);
+    auto g_alloc_ = static_cast<graph::allocator_t *>(engine.get_allocator());
+
+    graph::constant_tensor_cache_t cache(5);
+    std::vector<cached_t> buffers;
+    // Returns whether the entry is a cache hit, and adds it otherwise.
+    const auto get_or_add = [&](size_t key, size_t size, int32_t priority) {
+        std::promise<cached_t> c_promise;
+        auto value = cache.get_or_add(
+                0, key, size, c_promise.get_future(), priority);
+        if (value.valid()) return true;
+        buffers.push_back(std::make_shared<dnnl_impl::dnnl_constant_buffer_t>(
+                size, p_engine_, g_alloc_));
+        c_promise.set_value(buffers.back());
+        return false;
+    };
+
+    ASSERT_FALSE(get_or_add(1, 2, 0));
+    ASSERT_FALSE(get_or_add(2, 2, 0));
+    ASSERT_TRUE(get_or_add(1, 2, 0));
+
+    // Entries of the same priority never evict each other.
+    ASSERT_FALSE(get_or_add(3, 3, 0));
+    ASSERT_EQ(cache.get_size(), 4U);
+    ASSERT_EQ(cache.get_evicted_bytes(), 0U);
+
+    // The least frequently used entry of a lower priority is evicted.
+    ASSERT_FALSE(get_or_add(3, 3, 1));
+    ASSERT_EQ(cache.get_size(), 5U);
+    ASSERT_EQ(cache.get_evicted_bytes(), 2U);
+    ASSERT_EQ(cache.get_recomputed_bytes(), 3U);
+    ASSERT_TRUE(get_or_add(1, 2, 0));
+    ASSERT_FALSE(get_or_add(2, 2, 0));
+    ASSERT_EQ(cache.get_recomputed_bytes(), 5U);
+
+    // Pinned entries are never evicted.
+    const int32_t pinned = DNNL_GRAPH_CONSTANT_CACHE_PRIORITY_PINNED;
+    ASSERT_FALSE(get_or_add(4, 2, pinned));
+    ASSERT_FALSE(get_or_add(5, 3, pinned));
+    ASSERT_EQ(cache.get_evicted_bytes(), 7U);
+    ASSERT_FALSE(get_or_add(6, 1, pinned));
+    ASSERT_TRUE(get_or_add(4, 2, 0));
+    ASSERT_TRUE(get_or_add(5, 3, 0));
+    ASSERT_EQ(cache.get_size(), 5U);
+}
+
+#ifndef _WIN32
+TEST(test_constant_cache, MappedBufferReuse) {
+    graph::engine_t &engine = *get_engine();
+    if (engine.kind() != graph::engine_kind::cpu) {
+        GTEST_SKIP() << "mapped buffers are for CPU engines";
+    }
+    auto g_alloc_ = static_cast<graph::allocator_t *>(engine.get_allocator());
+
+    char dir_template[] = "/tmp/dnnl_constant_cache_XXXXXX";
+    const char *dir = mkdtemp(dir_template);
+    ASSERT_NE(dir, nullptr);
+
+    const size_t key = 42, size = 1000;
+    auto c_buffer1 = graph::mapped_constant_buffer_t::create(
+            dir, key, size, &engine, g_alloc_);
+    ASSERT_NE(c_buffer1, nullptr);
+    ASSERT_FALSE(c_buffer1->is_filled());
+    for (size_t i = 0; i < size; i++)
+        c_buffer1->data<uint8_t>()[i] = static_cast<uint8_t>(i % 251);
+
+    // The constants are not visible under the key until they are published.
+    auto c_buffer2 = graph::mapped_constant_buffer_t::create(
+            dir, key, size, &engine, g_alloc_);
+    ASSERT_NE(c_buffer2, nullptr);
+    ASSERT_FALSE(c_buffer2->is_filled());
+    c_buffer2.reset();
+
+    c_buffer1->set_filled();
+    c_buffer1.reset();
+
+    // The constants outlive the buffer they were computed in.
+    auto c_buffer3 = graph::mapped_constant_buffer_t::create(
+            dir, key, size, &engine, g_alloc_);
+    ASSERT_NE(c_buffer3, nullptr);
+    ASSERT_TRUE(c_buffer3->is_filled());
+    for (size_t i = 0; i < size; i++)
+        ASSERT_EQ(c_buffer3->data<uint8_t>()[i], i % 251);
+    c_buffer3.reset();
+
+    const std::string path = std::string(dir) + "/000000000000002a.bin";
+    ASSERT_EQ(unlink(path.c_str()), 0);
+    ASSERT_EQ(rmdir(dir), 0);
+}
+#endif
@@ -29,6 +29,15 @@
 namespace graph = dnnl::impl::graph;
 namespace utils = dnnl::graph::tests::unit::utils;
 
+static inline void custom_setenv(
+        const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    SetEnvironmentVariable(name, value);
+#else
+    ::setenv(name, value, overwrite);
+#endif
+}
+
 struct eltwise_param_t {
     std::string pass_name;
     std::vector<float> bias;
@@ -99,6 +108,69 @@ TEST(test_convolution_compile, ConvolutionFp32) {
 #endif
 }
 
+TEST(test_convolution_compile, ConvolutionFp32CpuBlockedLayout) {
+    using dims = graph::dnnl_impl::dims;
+
+    graph::engine_t *engine = get_engine();
+    if (engine->kind() != graph::engine_kind::cpu) {
+        GTEST_SKIP() << "the knob is used on CPU only";
+    }
+
+    graph::op_t conv_op(graph::op_kind::Convolution);
+    conv_op.set_attr<dims>(graph::op_attr::strides, dims {1, 1});
+    conv_op.set_attr<dims>(graph::op_attr::dilations, dims {1, 1});
+    conv_op.set_attr<dims>(graph::op_attr::pads_begin, dims {1, 1});
+    conv_op.set_attr<dims>(graph::op_attr::pads_end, dims {1, 1});
+    conv_op.set_attr<int64_t>(graph::op_attr::groups, 1);
+    conv_op.set_attr<std::string>(graph::op_attr::data_format, "NCX");
+    conv_op.set_attr<std::string>(graph::op_attr::weights_format, "OIX");
+
+    graph::logical_tensor_t src = utils::logical_tensor_init(
+            0, {2, 64, 28, 28}, graph::data_type::f32);
+    graph::logical_tensor_t weight = utils::logical_tensor_init(
+            1, {64, 64, 3, 3}, graph::data_type::f32);
+    graph::logical_tensor_t dst = utils::logical_tensor_init(2,
+            {2, 64, 28, 28}, graph::data_type::f32, graph::layout_type::any);
+
+    conv_op.add_input(src);
+    conv_op.add_input(weight);
+    conv_op.add_output(dst);
+
+    graph::graph_t g(engine->kind());
+    g.add_op(&conv_op);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("conv_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src, &weight};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst};
+    auto compile = [&]() {
+        graph::partition_t p;
+        p.init(part);
+        graph::compiled_partition_t cp(p);
+        EXPECT_EQ(p.compile(&cp, inputs, outputs, engine),
+                graph::status::success);
+        graph::logical_tensor_t lt;
+        cp.query_logical_tensor(dst.id, &lt);
+        return lt;
+    };
+
+    // The knob allows a blocked output, which the cost model keeps only if
+    // it pays for the reorders, and is read at every compilation.
+    custom_setenv("ONEDNN_GRAPH_CPU_BLOCKED_LAYOUT", "1", 1);
+    const auto blocked_lt = compile();
+    EXPECT_TRUE(blocked_lt.layout_type == graph::layout_type::strided
+            || blocked_lt.layout_type == graph::layout_type::opaque);
+    EXPECT_GE(graph::logical_tensor_wrapper_t(blocked_lt).size(),
+            graph::logical_tensor_wrapper_t(src).size());
+
+    custom_setenv("ONEDNN_GRAPH_CPU_BLOCKED_LAYOUT", "0", 1);
+    ASSERT_EQ(compile().layout_type, graph::layout_type::strided);
+}
+
 TEST(test_convolution_compile, ConvolutionBackwardDataFp32) {
     using dims = dnnl::impl::graph::dnnl_impl::dims;
 
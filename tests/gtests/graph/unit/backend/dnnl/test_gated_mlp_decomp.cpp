@@ -0,0 +1,154 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_graph.hpp"
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+using dim_t = dnnl_dim_t;
+using dims = std::vector<dim_t>;
+
+static inline void custom_setenv(
+        const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    SetEnvironmentVariable(name, value);
+#else
+    ::setenv(name, value, overwrite);
+#endif
+}
+
+// Compiles and executes the partition of a gated MLP with the primitive based
+// and the decomposition kernels, and compares the outputs.
+static void test_gated_mlp_decomp(
+        dim_t M, dim_t K, dim_t N, graph::op_kind_t act_kind, bool wei_t) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    const auto dt = graph::data_type::f32;
+    const dims wei_dims = wei_t ? dims {N, K} : dims {K, N};
+    const dims wei_down_dims = wei_t ? dims {K, N} : dims {N, K};
+    graph::logical_tensor_t src = utils::logical_tensor_init(0, {M, K}, dt);
+    graph::logical_tensor_t wei_gt
+            = utils::logical_tensor_init(1, wei_dims, dt);
+    graph::logical_tensor_t wei_up
+            = utils::logical_tensor_init(2, wei_dims, dt);
+    graph::logical_tensor_t wei_down
+            = utils::logical_tensor_init(3, wei_down_dims, dt);
+    graph::logical_tensor_t fc_gt = utils::logical_tensor_init(4, {M, N}, dt);
+    graph::logical_tensor_t fc_up = utils::logical_tensor_init(5, {M, N}, dt);
+    graph::logical_tensor_t act = utils::logical_tensor_init(6, {M, N}, dt);
+    graph::logical_tensor_t mul = utils::logical_tensor_init(7, {M, N}, dt);
+    graph::logical_tensor_t dst = utils::logical_tensor_init(8, {M, K}, dt);
+
+    graph::op_t fc_gt_op(0, graph::op_kind::MatMul, "fc_gt");
+    graph::op_t fc_up_op(1, graph::op_kind::MatMul, "fc_up");
+    graph::op_t act_op(2, act_kind, "act");
+    graph::op_t mul_op(3, graph::op_kind::Multiply, "mul");
+    graph::op_t fc_down_op(4, graph::op_kind::MatMul, "fc_down");
+    for (auto *op : {&fc_gt_op, &fc_up_op, &fc_down_op})
+        op->set_attr<bool>(graph::op_attr::transpose_b, wei_t);
+
+    fc_gt_op.add_input(src);
+    fc_gt_op.add_input(wei_gt);
+    fc_gt_op.add_output(fc_gt);
+    fc_up_op.add_input(src);
+    fc_up_op.add_input(wei_up);
+    fc_up_op.add_output(fc_up);
+    act_op.add_input(fc_gt);
+    act_op.add_output(act);
+    mul_op.add_input(act);
+    mul_op.add_input(fc_up);
+    mul_op.add_output(mul);
+    fc_down_op.add_input(mul);
+    fc_down_op.add_input(wei_down);
+    fc_down_op.add_output(dst);
+
+    graph::graph_t g(eng->kind());
+    for (auto *op : {&fc_gt_op, &fc_up_op, &act_op, &mul_op, &fc_down_op})
+        ASSERT_EQ(g.add_op(op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("gated_mlp");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    ASSERT_EQ(partition_inputs.size(), 4U);
+    ASSERT_EQ(partition_outputs.size(), 1U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs)
+        inputs.emplace_back(&lt);
+    for (auto &lt : partition_outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+        outputs.emplace_back(&lt);
+    }
+
+    std::vector<test_tensor_t> inputs_ts;
+    for (auto &lt : inputs) {
+        inputs_ts.emplace_back(*lt, eng);
+        inputs_ts.back().fill<float>(0.f, 0.5f);
+    }
+
+    const auto run = [&](const char *force_prim,
+                             std::vector<test_tensor_t> &outputs_ts) {
+        custom_setenv("_ONEDNN_GRAPH_MLP_FORCE_PRIMITIVE", force_prim, 1);
+        graph::compiled_partition_t cp(p);
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+        for (auto &lt : outputs) {
+            graph::logical_tensor_t compiled_output;
+            cp.query_logical_tensor(lt->id, &compiled_output);
+            outputs_ts.emplace_back(compiled_output, eng);
+        }
+        ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(outputs_ts)),
+                graph::status::success);
+        strm->wait();
+    };
+
+    std::vector<test_tensor_t> outputs1_ts, outputs2_ts;
+    run("1", outputs1_ts);
+    run("0", outputs2_ts);
+
+    ASSERT_TRUE(allclose<float>(outputs1_ts[0], outputs2_ts[0],
+            /*rtol*/ 0.01f,
+            /*atol*/ 1e-4f));
+}
+
+TEST(test_gated_mlp_decomp_execute, F32GatedMlpDecomp_CPU) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    // A tail of rows, and a single row with the intermediate channels split
+    // between the threads.
+    test_gated_mlp_decomp(70, 64, 512, graph::op_kind::GELU, false);
+    test_gated_mlp_decomp(1, 128, 1024, graph::op_kind::Sigmoid, true);
+}
@@ -527,3 +527,128 @@ TEST(test_layer_norm_execute_subgraph_int8, LayernormTypecastQuant_CPU) {
         ASSERT_FLOAT_EQ(ref_data[i], dst_data[i]);
     }
 }
+
+TEST(test_layer_norm_execute_subgraph_int8, LayernormDynamicQuant_CPU) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet");
+
+    std::vector<int64_t> layernorm_shape {4, 16};
+    std::vector<int64_t> ss_shape {16};
+    std::vector<int64_t> scales_shape {4};
+    std::vector<float> src_data(product(layernorm_shape));
+    std::vector<float> scale(product(ss_shape));
+    std::vector<float> shift(product(ss_shape));
+
+    // random seed = 7
+    std::default_random_engine generator(7);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    for (auto *v : {&src_data, &scale, &shift})
+        std::generate(v->begin(), v->end(),
+                [&]() { return distribution(generator); });
+
+    graph::op_t layernorm_op(0, graph::op_kind::LayerNorm, "layernorm");
+    layernorm_op.set_attr<bool>(graph::op_attr::keep_stats, false);
+    graph::op_t abs_op(1, graph::op_kind::Abs, "abs");
+    graph::op_t reduce_op(2, graph::op_kind::ReduceMax, "reduce_max");
+    reduce_op.set_attr<std::vector<int64_t>>(graph::op_attr::axes, {-1});
+    reduce_op.set_attr<bool>(graph::op_attr::keep_dims, false);
+    graph::op_t div_op(3, graph::op_kind::Divide, "divide");
+    graph::op_t quant_op(4, graph::op_kind::DynamicQuantize, "quantize");
+    quant_op.set_attr<std::string>(graph::op_attr::qtype, "per_channel");
+    quant_op.set_attr<int64_t>(graph::op_attr::axis, 0);
+
+    graph::logical_tensor_t src = utils::logical_tensor_init(
+            0, layernorm_shape, graph::data_type::f32);
+    graph::logical_tensor_t scale_lt
+            = utils::logical_tensor_init(1, ss_shape, graph::data_type::f32);
+    graph::logical_tensor_t shift_lt
+            = utils::logical_tensor_init(2, ss_shape, graph::data_type::f32);
+    graph::logical_tensor_t layernorm_dst = utils::logical_tensor_init(
+            3, layernorm_shape, graph::data_type::f32);
+    graph::logical_tensor_t abs_dst = utils::logical_tensor_init(
+            4, layernorm_shape, graph::data_type::f32);
+    graph::logical_tensor_t amax = utils::logical_tensor_init(
+            5, scales_shape, graph::data_type::f32);
+    graph::logical_tensor_t divisor
+            = utils::logical_tensor_init(6, {1}, graph::data_type::f32);
+    graph::logical_tensor_t scales = utils::logical_tensor_init(
+            7, scales_shape, graph::data_type::f32);
+    graph::logical_tensor_t quant_dst = utils::logical_tensor_init(
+            8, layernorm_shape, graph::data_type::s8);
+
+    layernorm_op.add_input(src);
+    layernorm_op.add_input(scale_lt);
+    layernorm_op.add_input(shift_lt);
+    layernorm_op.add_output(layernorm_dst);
+    abs_op.add_input(layernorm_dst);
+    abs_op.add_output(abs_dst);
+    reduce_op.add_input(abs_dst);
+    reduce_op.add_output(amax);
+    div_op.add_input(amax);
+    div_op.add_input(divisor);
+    div_op.add_output(scales);
+    quant_op.add_input(layernorm_dst);
+    quant_op.add_input(scales);
+    quant_op.add_output(quant_dst);
+
+    graph::graph_t g(engine->kind());
+    for (auto *op : {&layernorm_op, &abs_op, &reduce_op, &div_op, &quant_op})
+        ASSERT_EQ(g.add_op(op), graph::status::success);
+    ASSERT_EQ(g.finalize(), graph::status::success);
+
+    graph::pass::pass_base_ptr apass
+            = get_pass("layernorm_dynamic_quant_fusion_cpu");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 5U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> lt_ins {
+            &src, &scale_lt, &shift_lt, &divisor};
+    std::vector<const graph::logical_tensor_t *> lt_outs {&scales, &quant_dst};
+    ASSERT_EQ(p.compile(&cp, lt_ins, lt_outs, engine), graph::status::success);
+
+    // The largest int8 value is handled by the primitive, and other divisors
+    // on the host.
+    for (float divisor_value : {127.f, 100.f}) {
+        std::vector<float> divisor_data {divisor_value};
+        test_tensor_t src_ts(src, engine, src_data);
+        test_tensor_t scale_ts(scale_lt, engine, scale);
+        test_tensor_t shift_ts(shift_lt, engine, shift);
+        test_tensor_t divisor_ts(divisor, engine, divisor_data);
+        test_tensor_t scales_ts(scales, engine);
+        test_tensor_t dst_ts(quant_dst, engine);
+        test_tensor_t ref_scales_ts(scales, engine);
+        test_tensor_t ref_ts(quant_dst, engine);
+
+        ASSERT_EQ(run_graph(g, {src_ts, scale_ts, shift_ts, divisor_ts},
+                          {ref_scales_ts, ref_ts}, *engine, *strm),
+                graph::status::success);
+        ASSERT_EQ(cp.execute(strm,
+                          {src_ts.get(), scale_ts.get(), shift_ts.get(),
+                                  divisor_ts.get()},
+                          {scales_ts.get(), dst_ts.get()}),
+                graph::status::success);
+        strm->wait();
+
+        auto scales_data = scales_ts.as_vec_type<float>();
+        auto ref_scales_data = ref_scales_ts.as_vec_type<float>();
+        for (size_t i = 0; i < ref_scales_data.size(); ++i) {
+            ASSERT_NEAR(ref_scales_data[i], scales_data[i],
+                    1e-4f * ref_scales_data[i]);
+        }
+        // The quantization may round a value that is half-way between two
+        // integers differently.
+        auto dst_data = dst_ts.as_vec_type<int8_t>();
+        auto ref_data = ref_ts.as_vec_type<int8_t>();
+        for (size_t i = 0; i < ref_data.size(); ++i) {
+            ASSERT_LE(std::abs(ref_data[i] - dst_data[i]), 1);
+        }
+    }
+}
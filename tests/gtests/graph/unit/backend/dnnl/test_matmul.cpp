@@ -16,6 +16,7 @@
 
 #include <functional>
 #include <random>
+#include <thread>
 
 #include "interface/c_types_map.hpp"
 
@@ -8183,3 +8184,104 @@ TEST(test_matmul_execute_subgraph_int8, NoShareCachedWeight) {
     dnnl::graph::set_constant_tensor_cache_capacity(
             static_cast<engine::kind>(engine->kind()), 0);
 }
+
+TEST(test_matmul_execute_subgraph_int8, PrepareCachedWeight) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    std::vector<int64_t> src_shape = {32, 1024};
+    std::vector<int64_t> weight_shape = {1024, 1024};
+    std::vector<int64_t> dst_shape = {32, 1024};
+
+    std::vector<float> scale_wei(weight_shape.back(), 1 / 127.f);
+    std::vector<int64_t> zp_wei(weight_shape.back(), 0);
+
+    graph::op_t dqdata_op(1, graph::op_kind::Dequantize, "dqdata_op");
+    dqdata_op.set_attr<std::string>(graph::op_attr::qtype, "per_tensor");
+    dqdata_op.set_attr<std::vector<int64_t>>(graph::op_attr::zps, {0});
+    dqdata_op.set_attr<std::vector<float>>(graph::op_attr::scales, {1.f});
+    dqdata_op.set_attr<int64_t>(graph::op_attr::axis, 0);
+
+    graph::op_t dqweight_op(2, graph::op_kind::Dequantize, "dqweight_op");
+    dqweight_op.set_attr<std::string>(graph::op_attr::qtype, "per_channel");
+    dqweight_op.set_attr<std::vector<int64_t>>(graph::op_attr::zps, zp_wei);
+    dqweight_op.set_attr<std::vector<float>>(graph::op_attr::scales, scale_wei);
+    dqweight_op.set_attr<int64_t>(graph::op_attr::axis, 1);
+
+    graph::op_t matmul_op(3, graph::op_kind::MatMul, "matmul_op");
+
+    auto src_u8
+            = utils::logical_tensor_init(1, src_shape, graph::data_type::u8);
+    auto src_f32_dq = utils::logical_tensor_init(2, graph::data_type::f32);
+    auto weight_s8
+            = utils::logical_tensor_init(4, weight_shape, graph::data_type::s8);
+    weight_s8.property = graph::property_type::constant;
+    auto weight_f32_dq = utils::logical_tensor_init(
+            5, weight_shape, graph::data_type::f32);
+    auto dst_f32
+            = utils::logical_tensor_init(7, dst_shape, graph::data_type::f32);
+
+    dqdata_op.add_input(src_u8);
+    dqdata_op.add_output(src_f32_dq);
+    dqweight_op.add_input(weight_s8);
+    dqweight_op.add_output(weight_f32_dq);
+    matmul_op.add_input(src_f32_dq);
+    matmul_op.add_input(weight_f32_dq);
+    matmul_op.add_output(dst_f32);
+
+    graph::graph_t g(engine->kind());
+    g.add_op(&dqdata_op);
+    g.add_op(&dqweight_op);
+    g.add_op(&matmul_op);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("x8x8x_matmul_post_ops");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+    std::vector<const graph::logical_tensor_t *> lt_ins {&src_u8, &weight_s8};
+    std::vector<const graph::logical_tensor_t *> lt_outs {&dst_f32};
+
+    dnnl::graph::set_constant_tensor_cache_capacity(
+            static_cast<engine::kind>(engine->kind()), 1024);
+    ASSERT_EQ(p.compile(&cp, lt_ins, lt_outs, engine), graph::status::success);
+
+    std::default_random_engine generator(7);
+    std::uniform_real_distribution<float> s8_distribution(-127.0f, 128.0f);
+    std::vector<int8_t> weight_data(product(weight_shape));
+    std::generate(weight_data.begin(), weight_data.end(),
+            [&]() { return static_cast<int8_t>(s8_distribution(generator)); });
+    test_tensor_t weight_s8_ts(weight_s8, engine, weight_data);
+    test_tensor_t src_u8_ts(src_u8, engine);
+    test_tensor_t dst_f32_ts(dst_f32, engine);
+
+    // Only the constant inputs need to hold data for the preparation.
+    std::vector<graph::tensor_t> inputs {src_u8_ts.get(), weight_s8_ts.get()};
+    bool ready = false;
+    ASSERT_EQ(cp.prepare_constants(strm, inputs), graph::status::success);
+    while (!ready) {
+        ASSERT_EQ(cp.constants_ready(inputs, ready), graph::status::success);
+        std::this_thread::yield();
+    }
+    // The next call reports the status of the completed preparation and
+    // finds the constants in the cache.
+    ASSERT_EQ(cp.prepare_constants(strm, inputs), graph::status::success);
+    const size_t prepared_size
+            = graph::get_constant_tensor_cache(engine->kind(), engine->index())
+                      ->get_size();
+
+    // The execution finds the constants in the cache.
+    ASSERT_EQ(cp.execute(strm, inputs, {dst_f32_ts.get()}),
+            graph::status::success);
+    strm->wait();
+    ASSERT_EQ(graph::get_constant_tensor_cache(engine->kind(), engine->index())
+                      ->get_size(),
+            prepared_size);
+
+    dnnl::graph::set_constant_tensor_cache_capacity(
+            static_cast<engine::kind>(engine->kind()), 0);
+}
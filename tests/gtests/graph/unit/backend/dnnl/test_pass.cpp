@@ -3541,6 +3541,66 @@ TEST(test_pass, FuseMatmulReluCase2) {
     ASSERT_EQ(agraph.get_partitions()[0]->get_outputs()[0].id, 4U);
 }
 
+TEST(test_pass, FuseCompressedWeightMatmulRelu) {
+    /*     int4 weight
+               |
+    \   dynamic_dequant
+     \     /
+      matmul
+        |
+       relu
+    */
+    const auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind == engine_kind::gpu, "skip on gpu");
+
+    graph_t agraph(engine_kind);
+    op_t dequant {0, DynamicDequantize, "dequant"};
+    dequant.set_attr<std::string>(op_attr::qtype, "per_group");
+    dequant.set_attr<int64_t>(op_attr::axis, 1);
+    dequant.set_attr<std::vector<int64_t>>(op_attr::group_shape, {32, 1});
+    op_t matmul {1, MatMul, "matmul"};
+    op_t relu {2, ReLU, "relu"};
+
+    logical_tensor_t src = logical_tensor_init(0, {16, 64}, data_type::bf16);
+    logical_tensor_t int4_weight
+            = logical_tensor_init(1, {64, 128}, data_type::u4);
+    logical_tensor_t scales = logical_tensor_init(2, {2, 128}, data_type::bf16);
+    logical_tensor_t zps = logical_tensor_init(3, {2, 128}, data_type::u4);
+    logical_tensor_t bf16_weight
+            = logical_tensor_init(4, {64, 128}, data_type::bf16);
+    dequant.add_input(int4_weight);
+    dequant.add_input(scales);
+    dequant.add_input(zps);
+    dequant.add_output(bf16_weight);
+
+    logical_tensor_t matmul_out
+            = logical_tensor_init(5, {16, 128}, data_type::bf16);
+    matmul.add_input(src);
+    matmul.add_input(bf16_weight);
+    matmul.add_output(matmul_out);
+
+    logical_tensor_t relu_out
+            = logical_tensor_init(6, {16, 128}, data_type::bf16);
+    relu.add_input(matmul_out);
+    relu.add_output(relu_out);
+
+    ASSERT_EQ(agraph.add_op(&dequant), status::success);
+    ASSERT_EQ(agraph.add_op(&matmul), status::success);
+    ASSERT_EQ(agraph.add_op(&relu), status::success);
+    agraph.finalize();
+
+    pass::pass_base_ptr apass = get_pass("compressed_wei_matmul_post_ops_cpu");
+    apass->run(agraph);
+
+    ASSERT_EQ(agraph.get_num_partitions(), 1U);
+    ASSERT_EQ((agraph.get_partitions()[0])->get_kind(),
+            partition_kind_t::quantized_matmul_post_ops);
+
+    ASSERT_EQ(agraph.get_partitions()[0]->get_inputs().size(), 4U);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_outputs().size(), 1U);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_outputs()[0].id, 6U);
+}
+
 TEST(test_pass, FailToFuseReluMatmul) {
     /*  relu
           |
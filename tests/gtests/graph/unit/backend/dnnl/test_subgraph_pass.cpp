@@ -1474,6 +1474,67 @@ TEST(test_subgraph_pass, FuseSigmoidMultiplyToSwish) {
             dnnl::algorithm::eltwise_swish);
 }
 
+TEST(test_subgraph_pass, FuseElementwiseChain) {
+    /*  add -> multiply -> sigmoid -> multiply -> add, where the other inputs
+        of the multiplies are broadcasted per batch and spatial dimensions
+    */
+    graph::engine_t *g_eng = get_engine();
+    dnnl::engine p_eng = dnnl::impl::graph::dnnl_impl::make_dnnl_engine(*g_eng);
+
+    std::vector<int64_t> src_shape {2, 16, 4, 4};
+    std::vector<int64_t> bcast_shape {2, 1, 4, 4};
+
+    graph::op_t add0 {0, graph::op_kind::Add, "add0"};
+    graph::op_t mul0 {1, graph::op_kind::Multiply, "mul0"};
+    graph::op_t sigmoid {2, graph::op_kind::Sigmoid, "sigmoid"};
+    graph::op_t mul1 {3, graph::op_kind::Multiply, "mul1"};
+    graph::op_t add1 {4, graph::op_kind::Add, "add1"};
+
+    std::vector<graph::logical_tensor_t> lts;
+    for (size_t i = 0; i < 10; ++i) {
+        const bool bcast = i == 3 || i == 6;
+        lts.emplace_back(logical_tensor_init(i,
+                bcast ? bcast_shape : src_shape, graph::data_type::f32));
+    }
+
+    add0.add_input(lts[0]);
+    add0.add_input(lts[1]);
+    add0.add_output(lts[2]);
+    mul0.add_input(lts[2]);
+    mul0.add_input(lts[3]);
+    mul0.add_output(lts[4]);
+    sigmoid.add_input(lts[4]);
+    sigmoid.add_output(lts[5]);
+    mul1.add_input(lts[5]);
+    mul1.add_input(lts[6]);
+    mul1.add_output(lts[7]);
+    add1.add_input(lts[7]);
+    add1.add_input(lts[8]);
+    add1.add_output(lts[9]);
+
+    graph::graph_t g;
+    for (auto *op : {&add0, &mul0, &sigmoid, &mul1, &add1})
+        g.add_op(op);
+    g.finalize();
+
+    const graph::fpmath_t fpm {fpmath_mode::strict, false};
+    auto subgraph = std::make_shared<dnnl_impl::subgraph_t>(
+            g.get_ops(), p_eng, fpm, false, true);
+    dnnl_impl::pass_pipeline_t pipeline(
+            dnnl_impl::subgraph_visualizer_t(), true, false);
+    dnnl_impl::larger_partition_kernel_t::setup_pipeline_stage1(pipeline);
+    ASSERT_EQ(pipeline.run(subgraph), graph::status::success);
+    ASSERT_EQ(subgraph->num_ops(), 1U);
+
+    const auto &fused_op = subgraph->get_ops()[0];
+    ASSERT_EQ(fused_op->get_kind(), dnnl_impl::op_kind::dnnl_binary);
+    ASSERT_EQ(fused_op->num_inputs(), 5U);
+    ASSERT_TRUE(fused_op->has_attr(dnnl_impl::op_attr::fusion_info));
+    const auto &fusion_info = fused_op->get_attr<dnnl_impl::fusion_info_t>(
+            dnnl_impl::op_attr::fusion_info);
+    ASSERT_EQ(fusion_info.get_post_ops().size(), 4U);
+}
+
 TEST(test_subgraph_pass_int8_matmul_passes_with_diff_inputs,
         X8X8BF16MatmulScaleAddPasses_CPU) {
     /*
@@ -100,6 +100,31 @@ TEST(test_thread_local_cache, Multithreading) {
     t3.join();
 }
 
+TEST(test_thread_local_cache, RemoveInvalidatesLastValue) {
+    thread_local_cache_t<test_resource_t> cache;
+    cache.clear();
+
+    size_t key = 1U;
+    test_resource_t *resource_ptr = cache.get_or_add(
+            key, []() { return std::make_shared<test_resource_t>(10); });
+    ASSERT_EQ(cache.get_or_add(key,
+                      []() { return std::make_shared<test_resource_t>(20); }),
+            resource_ptr);
+
+    // The value found last must not be returned after it is removed.
+    cache.remove_if_exist(key);
+    ASSERT_FALSE(cache.has_resource(key));
+    resource_ptr = cache.get_or_add(
+            key, []() { return std::make_shared<test_resource_t>(30); });
+    ASSERT_EQ(resource_ptr->data_, 30U);
+
+    cache.clear();
+    resource_ptr = cache.get_or_add(
+            key, []() { return std::make_shared<test_resource_t>(40); });
+    ASSERT_EQ(resource_ptr->data_, 40U);
+    cache.remove_if_exist(key);
+}
+
 TEST(test_thread_local_cache, Clear) {
     thread_local_cache_t<test_resource_t> cache;
     size_t key1 = (size_t)1;
@@ -26,6 +26,7 @@
 
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
 
 namespace dnnl {
 
@@ -287,4 +288,77 @@ TEST_P(brgemm_test_t, TestsBRGEMM) {}
 INSTANTIATE_TEST_SUITE_P(TestBRGEMMSimple, brgemm_test_t,
         ::testing::ValuesIn(params_creator_t().create_simple_brgemm_params()));
 
+TEST(brgemm_kernel_container_test, TestLazyGeneration) {
+    using namespace dnnl::impl::cpu::x64;
+    using namespace dnnl::impl::cpu::x64::brgemm_containers;
+
+    brgemm_desc_t desc;
+    ASSERT_EQ(brgemm_desc_init(&desc, cpu_isa_t::isa_undef, brgemm_addr,
+                      dnnl_f32, dnnl_f32, false, false, brgemm_row_major, 1.f,
+                      0.f, 16, 16, 16, 16, 16, 16),
+            dnnl_success);
+    ASSERT_EQ(brgemm_desc_finalize(&desc), dnnl_success);
+    // A descriptor no kernel can be generated for.
+    brgemm_desc_t bad_desc = desc;
+    bad_desc.dt_d = dnnl_f64;
+
+    brgemm_kernel_container_t kernels(2);
+    ASSERT_EQ(kernels.insert_lazy(0, &desc), dnnl_success);
+    const bool is_lazy = kernels.insert_lazy(1, &bad_desc) == dnnl_success;
+    SKIP_IF(!is_lazy, "The lazy generation is disabled.");
+    ASSERT_TRUE(kernels.is_inserted(0));
+    ASSERT_TRUE(kernels.is_inserted(1));
+
+    std::atomic<dnnl_status_t> status {dnnl_success};
+    const brgemm_kernel_t *ker = kernels.get(0, status);
+    ASSERT_NE(ker, nullptr);
+    ASSERT_EQ(status.load(), dnnl_success);
+    // The kernel is generated once.
+    ASSERT_EQ(kernels.get(0, status), ker);
+    ASSERT_EQ(kernels[0], ker);
+
+    // The failure is reported to the status of the request only.
+    ASSERT_EQ(kernels.get(1, status), nullptr);
+    ASSERT_NE(status.load(), dnnl_success);
+    std::atomic<dnnl_status_t> next_status {dnnl_success};
+    ASSERT_EQ(kernels.get(0, next_status), ker);
+    ASSERT_EQ(next_status.load(), dnnl_success);
+    ASSERT_EQ(kernels.get(1, next_status), nullptr);
+    ASSERT_NE(next_status.load(), dnnl_success);
+}
+
+TEST(brgemm_kernel_container_test, TestSharedKernelKey) {
+    using namespace dnnl::impl::cpu::x64;
+    using namespace dnnl::impl::cpu::x64::brgemm_containers;
+
+    brgemm_desc_t desc;
+    ASSERT_EQ(brgemm_desc_init(&desc, cpu_isa_t::isa_undef, brgemm_addr,
+                      dnnl_f32, dnnl_f32, false, false, brgemm_row_major, 1.f,
+                      0.f, 16, 16, 16, 16, 16, 16),
+            dnnl_success);
+    ASSERT_EQ(brgemm_desc_finalize(&desc), dnnl_success);
+
+    // Implementations set these fields after the descriptor initialization,
+    // so descriptors of different primitives may differ only by them.
+    std::vector<brgemm_desc_t> descs(4, desc);
+    descs[0].req_comp_pads_with_bcast = !desc.req_comp_pads_with_bcast;
+    descs[1].skip_zp_b_compensation = !desc.skip_zp_b_compensation;
+    descs[2].with_weights_scale_adjust = !desc.with_weights_scale_adjust;
+    descs[3].brgattr.mem_advice = brgemm_hint_mem_advice_A_B;
+    for (size_t i = 0; i < descs.size(); i++) {
+        ASSERT_FALSE(descs[i] == desc) << "i=" << i;
+        ASSERT_TRUE(descs[i] < desc || desc < descs[i]) << "i=" << i;
+    }
+
+    SKIP_IF(get_primitive_cache_capacity() == 0,
+            "The kernel cache is disabled.");
+    std::shared_ptr<brgemm_kernel_t> ker, same_ker, other_ker;
+    ASSERT_EQ(get_shared_kernel(desc, ker), dnnl_success);
+    const brgemm_desc_t same_desc = desc;
+    ASSERT_EQ(get_shared_kernel(same_desc, same_ker), dnnl_success);
+    ASSERT_EQ(ker, same_ker);
+    ASSERT_EQ(get_shared_kernel(descs[3], other_ker), dnnl_success);
+    ASSERT_NE(ker, other_ker);
+}
+
 } // namespace dnnl
@@ -0,0 +1,73 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/cpu/jit_utils/code_arena.hpp"
+#include "src/cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+
+namespace code_arena = impl::cpu::jit_utils::code_arena;
+
+namespace {
+
+struct jit_return_42_t : public impl::cpu::x64::jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_return_42_t)
+
+    jit_return_42_t() : jit_generator_t(jit_name()) {}
+
+    void generate() override {
+        mov(eax, 42);
+        ret();
+    }
+};
+
+} // namespace
+
+TEST(test_code_arena, blocks) {
+    SKIP_IF(!code_arena::is_enabled(), "The code arena is disabled.");
+
+    void *a = code_arena::alloc(100);
+    void *b = code_arena::alloc(100);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    const auto a_addr = reinterpret_cast<uintptr_t>(a);
+    const auto b_addr = reinterpret_cast<uintptr_t>(b);
+    EXPECT_EQ(a_addr % 64, 0u);
+    EXPECT_EQ(b_addr % 64, 0u);
+    EXPECT_TRUE(b_addr >= a_addr + 100 || a_addr >= b_addr + 100);
+
+    int not_in_arena = 0;
+    EXPECT_FALSE(code_arena::free(&not_in_arena));
+    EXPECT_TRUE(code_arena::free(a));
+    EXPECT_TRUE(code_arena::free(b));
+}
+
+TEST(test_code_arena, kernel) {
+    for (int i = 0; i < 2; i++) {
+        jit_return_42_t kernel;
+        ASSERT_EQ(kernel.create_kernel(), impl::status::success);
+        auto *fptr = reinterpret_cast<int (*)()>(
+                const_cast<uint8_t *>(kernel.jit_ker()));
+        EXPECT_EQ(fptr(), 42);
+    }
+}
+
+} // namespace dnnl
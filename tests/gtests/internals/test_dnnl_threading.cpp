@@ -160,4 +160,105 @@ CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_t,
                 np_t {{4, 1, 4, 5, 2}}, np_t {{4, 3, 0, 3, 0, 1}},
                 np_t {{2, 1, 3, 1, 2, 1}}, np_t {{4, 1, 4, 3, 2, 2}}));
 
+// On hybrid CPUs, parallel_nd() takes the work dynamically.
+class test_parallel_nd_hybrid_t : public test_parallel_nd_t {
+protected:
+    void SetUp() override {
+        test_parallel_nd_t::SetUp();
+        was_dynamic = impl::parallel_nd_is_dynamic();
+        impl::parallel_nd_is_dynamic() = true;
+    }
+    void TearDown() override { impl::parallel_nd_is_dynamic() = was_dynamic; }
+
+    bool was_dynamic = false;
+};
+
+TEST_P(test_parallel_nd_hybrid_t, Test) {
+    emit_parallel_nd();
+    CheckID();
+}
+
+CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_hybrid_t,
+        ::testing::Values(np_t {{0}}, np_t {{100}}, np_t {{10, 10}},
+                np_t {{4, 4, 10}}, np_t {{0, 3, 0, 1}}, np_t {{4, 4, 5, 2}},
+                np_t {{4, 1, 4, 5, 2}}, np_t {{4, 3, 0, 3, 0, 1}},
+                np_t {{4, 1, 4, 3, 2, 2}}));
+
+class test_parallel_nd_dynamic_t : public test_nd_t {
+protected:
+    void emit_parallel_nd_dynamic() {
+        switch ((int)p.dims.size()) {
+            case 1:
+                impl::parallel_nd_dynamic(p.dims[0], [&](ptrdiff_t d0) {
+                    ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                    data[d0] = d0;
+                });
+                break;
+            case 2:
+                impl::parallel_nd_dynamic(
+                        p.dims[0], p.dims[1], [&](ptrdiff_t d0, ptrdiff_t d1) {
+                            ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                            ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                            const ptrdiff_t idx = d0 * p.dims[1] + d1;
+                            data[idx] = idx;
+                        });
+                break;
+            case 3:
+                impl::parallel_nd_dynamic(p.dims[0], p.dims[1], p.dims[2],
+                        [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2) {
+                            ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                            ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                            ASSERT_TRUE(0 <= d2 && d2 < p.dims[2]);
+                            const ptrdiff_t idx
+                                    = (d0 * p.dims[1] + d1) * p.dims[2] + d2;
+                            data[idx] = idx;
+                        });
+                break;
+            default: ASSERT_TRUE(false);
+        }
+    }
+};
+
+TEST_P(test_parallel_nd_dynamic_t, Test) {
+    emit_parallel_nd_dynamic();
+    CheckID();
+}
+
+CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_dynamic_t,
+        ::testing::Values(np_t {{0}}, np_t {{1}}, np_t {{1000}},
+                np_t {{0, 0}}, np_t {{1, 2}}, np_t {{10, 77}},
+                np_t {{0, 1, 0}}, np_t {{1, 2, 1}}, np_t {{4, 13, 10}}));
+
+TEST(test_parallel_dynamic, TestChunks) {
+    const impl::dim_t work_amount = 1003;
+    for (impl::dim_t chunk : {0, 1, 7, 2000}) {
+        std::vector<int> visits(work_amount, 0);
+        impl::parallel_dynamic(0, work_amount, chunk,
+                [&](int ithr, int nthr, impl::dim_t start, impl::dim_t end) {
+                    ASSERT_LE(0, ithr);
+                    ASSERT_LT(ithr, nthr);
+                    ASSERT_LT(start, end);
+                    if (chunk > 0) { ASSERT_LE(end - start, chunk); }
+                    for (impl::dim_t i = start; i < end; i++)
+                        visits[i]++;
+                });
+        for (impl::dim_t i = 0; i < work_amount; i++)
+            ASSERT_EQ(visits[i], 1);
+    }
+}
+
+TEST(test_nthr_by_work, TestCap) {
+    const bool was_enabled = impl::nthr_by_work_is_enabled();
+    impl::nthr_by_work_is_enabled() = true;
+    const int max_nthr = dnnl_get_current_num_threads();
+    ASSERT_EQ(impl::nthr_by_work(0, 0, 100), 1);
+    ASSERT_EQ(impl::nthr_by_work(0, 250, 100), std::min(max_nthr, 2));
+    ASSERT_EQ(impl::nthr_by_work(3, 100000, 100), 3);
+    ASSERT_EQ(impl::nthr_by_work(0, 100000, 0), max_nthr);
+
+    impl::nthr_by_work_is_enabled() = false;
+    ASSERT_EQ(impl::nthr_by_work(0, 0, 100), max_nthr);
+    impl::nthr_by_work_is_enabled() = was_enabled;
+}
+
 } // namespace dnnl
@@ -20,6 +20,12 @@
 
 #include "stdlib.h"
 
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -27,6 +33,19 @@
 
 #include "tests/test_isa_common.hpp"
 
+#include "common/memory_debug.hpp"
+#include "common/persistent_cache.hpp"
+#include "common/utils.hpp"
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/huge_pages.hpp"
+#include "cpu/numa.hpp"
+#endif
+
+#if DNNL_X64
+#include "cpu/x64/matmul/brgemm_matmul_blocking_table.hpp"
+#endif
+
 // Note: use one non-default value to validate functionality.
 
 namespace {
@@ -138,6 +157,156 @@ TEST(onednn_default_fpmath_mode_env_var_test, TestEnvVars) {
     EXPECT_EQ(func_got_val, dnnl_fpmath_mode_strict);
 }
 
+TEST(onednn_path_env_var_test, TestEnvVars) {
+    // Paths are read in full and keep their case.
+    const std::string path(200, 'P');
+    custom_setenv("ONEDNN_TEST_PATH", (path + "/Dir").c_str(), 1);
+    EXPECT_EQ(impl::getenv_path_user("TEST_PATH"), path + "/Dir");
+
+    EXPECT_EQ(impl::getenv_path_user("TEST_PATH_UNSET"), "");
+}
+
+TEST(onednn_primitive_cache_dir_env_var_test, TestEnvVars) {
+    custom_setenv("ONEDNN_PRIMITIVE_CACHE_DIR", "Primitive_Cache_Dir/", 1);
+    // The trailing separator is stripped.
+    EXPECT_EQ(impl::persistent_cache::get_dir(), "Primitive_Cache_Dir");
+    EXPECT_TRUE(impl::persistent_cache::is_enabled());
+}
+
+#if DNNL_X64
+TEST(onednn_matmul_blocking_table_env_var_test, TestEnvVars) {
+    const char *file_name = "test_matmul_blocking_table.txt";
+    {
+        std::ofstream out(file_name, std::ios::trunc);
+        out << "# key nthr_k n_blk n_chunk_size m_blk m_chunk_size\n";
+        out << "test_key 2 64 3 32 4\n";
+        // Malformed lines are skipped.
+        out << "short_key 2 64\n";
+        out << "text_key a b c d e\n";
+    }
+    custom_setenv("ONEDNN_MATMUL_BLOCKING_TABLE", file_name, 1);
+
+    using namespace impl::cpu::x64::matmul;
+    EXPECT_TRUE(blocking_table_enabled());
+    blocking_table_entry_t e;
+    ASSERT_TRUE(blocking_table_lookup("test_key", e));
+    EXPECT_EQ(e.nthr_k, 2);
+    EXPECT_EQ(e.n_blk, 64);
+    EXPECT_EQ(e.n_chunk_size, 3);
+    EXPECT_EQ(e.m_blk, 32);
+    EXPECT_EQ(e.m_chunk_size, 4);
+    EXPECT_FALSE(blocking_table_lookup("missing_key", e));
+    EXPECT_FALSE(blocking_table_lookup("short_key", e));
+    EXPECT_FALSE(blocking_table_lookup("text_key", e));
+    std::remove(file_name);
+}
+
+TEST(onednn_matmul_blocking_table_env_var_test, TestEntryValidation) {
+    using namespace impl::cpu::x64::matmul;
+    const int nthr = 4;
+    const impl::dim_t M = 128, N = 256, wei_n_blk = 32;
+    auto is_valid = [&](int nthr_k, int n_blk, int n_chunk_size, int m_blk,
+                            int m_chunk_size) {
+        blocking_table_entry_t e;
+        e.nthr_k = nthr_k;
+        e.n_blk = n_blk;
+        e.n_chunk_size = n_chunk_size;
+        e.m_blk = m_blk;
+        e.m_chunk_size = m_chunk_size;
+        return blocking_table_entry_is_valid(e, nthr, M, N, wei_n_blk);
+    };
+    EXPECT_TRUE(is_valid(2, 64, 1, 32, 1));
+    EXPECT_TRUE(is_valid(nthr, N, 1, M, 1));
+    // Non-positive values.
+    EXPECT_FALSE(is_valid(0, 64, 1, 32, 1));
+    EXPECT_FALSE(is_valid(2, -64, 1, 32, 1));
+    EXPECT_FALSE(is_valid(2, 64, 0, 32, 1));
+    EXPECT_FALSE(is_valid(2, 64, 1, -1, 1));
+    EXPECT_FALSE(is_valid(2, 64, 1, 32, 0));
+    // More K threads than threads.
+    EXPECT_FALSE(is_valid(nthr + 1, 64, 1, 32, 1));
+    // N block not a multiple of the weights block.
+    EXPECT_FALSE(is_valid(2, 48, 1, 32, 1));
+    // Blocks larger than the problem.
+    EXPECT_FALSE(is_valid(2, 64, 1, M + 1, 1));
+    EXPECT_FALSE(is_valid(2, N + wei_n_blk, 1, 32, 1));
+}
+#endif // DNNL_X64
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE && defined(__linux__)
+TEST(onednn_cpu_huge_pages_env_var_test, TestEnvVars) {
+    namespace huge_pages = impl::cpu::huge_pages;
+
+    custom_setenv("ONEDNN_CPU_HUGE_PAGES", "thp", 1);
+    ASSERT_EQ(huge_pages::get_policy(), huge_pages::policy_t::thp);
+    // Memory debug mode keeps its own allocations.
+    if (impl::memory_debug::is_mem_debug()) return;
+
+    // Buffers smaller than a huge page use regular allocations.
+    const size_t page_size = size_t(2) << 20;
+    EXPECT_EQ(huge_pages::malloc(page_size - 1), nullptr);
+
+    char *ptr = static_cast<char *>(huge_pages::malloc(page_size + 1));
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % page_size, 0u);
+    // The allocation is rounded up to whole huge pages.
+    std::memset(ptr, 1, 2 * page_size);
+
+    int not_allocated = 0;
+    EXPECT_FALSE(huge_pages::free(&not_allocated));
+    EXPECT_TRUE(huge_pages::free(ptr));
+    EXPECT_FALSE(huge_pages::free(ptr));
+    EXPECT_EQ(huge_pages::get_allocated_size(), 0u);
+
+    // Memory objects keep working with huge pages backing them.
+    engine eng(engine::kind::cpu, 0);
+    const memory::dim nelems = 2 * page_size / sizeof(float);
+    memory mem({{nelems}, memory::data_type::f32, memory::format_tag::a}, eng);
+    float *data = static_cast<float *>(mem.get_data_handle());
+    data[0] = 1.f;
+    data[nelems - 1] = 2.f;
+    EXPECT_EQ(data[0] + data[nelems - 1], 3.f);
+    EXPECT_NO_THROW(get_cpu_huge_pages_size());
+}
+#endif
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+TEST(onednn_cpu_numa_policy_env_var_test, TestEnvVars) {
+    namespace numa = impl::cpu::numa;
+
+    custom_setenv("ONEDNN_CPU_NUMA_POLICY", "local", 1);
+    ASSERT_EQ(numa::get_policy().kind, numa::policy_kind_t::local);
+    // Memory debug mode keeps its own allocations.
+    if (impl::memory_debug::is_mem_debug()) return;
+
+    // The local policy touches the whole pages within the buffer, the bytes
+    // of the partial pages at its ends are left as is.
+    const size_t page_size = static_cast<size_t>(impl::getpagesize());
+    const size_t npages = 16;
+    std::vector<char> buf((npages + 2) * page_size, 1);
+    const uintptr_t base = reinterpret_cast<uintptr_t>(buf.data());
+    char *first_page = reinterpret_cast<char *>(
+            impl::utils::rnd_up(base + 1, page_size));
+    char *ptr = first_page - 1;
+    const size_t size = npages * page_size + 2;
+    numa::apply_policy(ptr, size);
+
+    EXPECT_EQ(ptr[0], 1);
+    EXPECT_EQ(ptr[size - 1], 1);
+    for (size_t p = 0; p < npages; p++)
+        EXPECT_EQ(first_page[p * page_size], 0) << "page = " << p;
+
+    // Memory objects keep working with the policy applied.
+    engine eng(engine::kind::cpu, 0);
+    const memory::dim nelems = npages * page_size / sizeof(float);
+    memory mem({{nelems}, memory::data_type::f32, memory::format_tag::a}, eng);
+    float *data = static_cast<float *>(mem.get_data_handle());
+    data[0] = 1.f;
+    data[nelems - 1] = 2.f;
+    EXPECT_EQ(data[0] + data[nelems - 1], 3.f);
+}
+#endif
+
 // There's no a separate test for VERBOSE variable as there's no programmable
 // public API to identify if it was set through env var or not.
 // Same situation with the rest of variables.
@@ -1752,6 +1752,176 @@ memory::format_tag no_key_transposed = memory::format_tag::abcd;
 using sdpa_test = sdpa_test_t<sdpa_dims_t>;
 using sdpa_test_datatypes = sdpa_test_t<sdpa_dims_t_tuple>;
 
+struct sdpa_paged_dims_t {
+    num_heads_t heads;
+    memory::dim head_size;
+    memory::dim queries;
+    memory::dim page_size;
+    std::vector<memory::dim> context_lens;
+    mask_type mask;
+};
+
+std::ostream &operator<<(std::ostream &ss, const sdpa_paged_dims_t &p) {
+    ss << "heads_" << p.heads << "_hd_" << p.head_size << "_q_" << p.queries
+       << "_page_" << p.page_size << "_ctx";
+    for (auto l : p.context_lens)
+        ss << "_" << l;
+    ss << "_" << p.mask;
+    return ss;
+}
+
+// Runs a ragged batch of sequences with their pages scattered over the K/V
+// pools, and compares every sequence with an SDPA of its own contiguous keys
+// and values.
+class sdpa_paged_test_t : public ::testing::TestWithParam<sdpa_paged_dims_t> {
+public:
+    void SetUp() override {
+#ifdef DNNL_SYCL_CUDA
+        GTEST_SKIP() << "SDPA primitive tests do not support CUDA";
+#endif
+#ifdef DNNL_SYCL_HIP
+        GTEST_SKIP() << "SDPA primitive tests do not support HIP";
+#endif
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != dnnl::engine::kind::gpu,
+                "This test requires GPU engine");
+        eng = get_test_engine();
+#else
+        SKIP_IF(engine::get_count(engine::kind::gpu) == 0,
+                "SDPA tests require gpus.");
+        eng = dnnl::engine(engine::kind::gpu, 0);
+#endif
+        strm = dnnl::stream(eng);
+        p = GetParam();
+    }
+
+    void compare() {
+        using namespace dnnl::impl;
+        using tag = memory::format_tag;
+
+        const memory::dim mb = p.context_lens.size();
+        const memory::dim H = p.heads.q, KVH = p.heads.kv;
+        const memory::dim D = p.head_size, Q = p.queries, P = p.page_size;
+
+        memory::dim max_pages = 0, npages = 0;
+        for (auto l : p.context_lens) {
+            max_pages = std::max(max_pages, (l + P - 1) / P);
+            npages += (l + P - 1) / P;
+        }
+
+        // Hand out the pages of the pools in a random order.
+        std::vector<int> pages(npages);
+        for (memory::dim i = 0; i < npages; i++)
+            pages[i] = static_cast<int>(i);
+        std::shuffle(pages.begin(), pages.end(), get_generator());
+        std::vector<int> block_table(mb * max_pages, 0), context_lens(mb);
+        memory::dim next_page = 0;
+        for (memory::dim b = 0; b < mb; b++) {
+            context_lens[b] = static_cast<int>(p.context_lens[b]);
+            for (memory::dim j = 0; j < (p.context_lens[b] + P - 1) / P; j++)
+                block_table[b * max_pages + j] = pages[next_page++];
+        }
+
+        auto q_md = memory::desc({mb, H, Q, D}, mdt::f16, tag::abcd);
+        auto k_md = memory::desc({npages, KVH, D, P}, mdt::f16, tag::abcd);
+        auto v_md = memory::desc({npages, KVH, P, D}, mdt::f16, tag::abcd);
+        auto block_table_md = memory::desc({mb, max_pages}, mdt::s32, tag::ab);
+        auto context_lens_md = memory::desc({mb}, mdt::s32, tag::a);
+
+        std::vector<float> q_data(product(q_md.get_dims()));
+        std::vector<float> k_data(product(k_md.get_dims()));
+        std::vector<float> v_data(product(v_md.get_dims()));
+        fill_random(q_data, q_md);
+        fill_random(k_data, k_md);
+        fill_random(v_data, v_md);
+
+        memory q_mem(q_md, eng), k_mem(k_md, eng), v_mem(v_md, eng);
+        memory block_table_mem(block_table_md, eng);
+        memory context_lens_mem(context_lens_md, eng);
+        memory dst_mem(q_md, eng);
+        write_to_dnnl_memory(q_data.data(), q_mem, eng, strm);
+        write_to_dnnl_memory(k_data.data(), k_mem, eng, strm);
+        write_to_dnnl_memory(v_data.data(), v_mem, eng, strm);
+        write_to_dnnl_memory(block_table.data(), block_table_mem, eng, strm);
+        write_to_dnnl_memory(context_lens.data(), context_lens_mem, eng, strm);
+
+        const int attn_mask_type = to_attn_mask_type(p.mask);
+        const auto softmax_alg = alg_kind::softmax_accurate_inf_as_zero;
+
+        sdpa::primitive_desc paged_pd;
+        try {
+            paged_pd = sdpa::primitive_desc(eng, q_md, k_md, v_md,
+                    block_table_md, context_lens_md, nullptr, mdt::undef,
+                    q_md, false, KVH, attn_mask_type, softmax_alg);
+        } catch (const dnnl::error &e) {
+            if (e.status == dnnl_unimplemented)
+                GTEST_SKIP() << "Unimplemented: " << e.what();
+            else
+                throw;
+        }
+        sdpa(paged_pd).execute(strm,
+                {{DNNL_ARG_QUERIES, q_mem}, {DNNL_ARG_KEYS, k_mem},
+                        {DNNL_ARG_VALUES, v_mem},
+                        {DNNL_ARG_BLOCK_TABLE, block_table_mem},
+                        {DNNL_ARG_CONTEXT_LENS, context_lens_mem},
+                        {DNNL_ARG_DST, dst_mem}});
+        strm.wait();
+
+        const memory::dim seq_q_size = H * Q * D;
+        for (memory::dim b = 0; b < mb; b++) {
+            const memory::dim L = p.context_lens[b];
+            if (L == 0) continue;
+
+            // Gather the keys and values of the sequence from its pages.
+            std::vector<float> k_seq(KVH * D * L), v_seq(KVH * L * D);
+            for_(memory::dim h = 0; h < KVH; h++)
+            for_(memory::dim j = 0; j < L; j++)
+            for (memory::dim i = 0; i < D; i++) {
+                const memory::dim page = block_table[b * max_pages + j / P];
+                k_seq[(h * D + i) * L + j]
+                        = k_data[((page * KVH + h) * D + i) * P + j % P];
+                v_seq[(h * L + j) * D + i]
+                        = v_data[((page * KVH + h) * P + j % P) * D + i];
+            }
+
+            auto q_seq_md = memory::desc({1, H, Q, D}, mdt::f16, tag::abcd);
+            auto k_seq_md = memory::desc({1, KVH, D, L}, mdt::f16, tag::abcd);
+            auto v_seq_md = memory::desc({1, KVH, L, D}, mdt::f16, tag::abcd);
+            memory q_seq_mem(q_seq_md, eng), k_seq_mem(k_seq_md, eng),
+                    v_seq_mem(v_seq_md, eng), gold_mem(q_seq_md, eng);
+            write_to_dnnl_memory(
+                    q_data.data() + b * seq_q_size, q_seq_mem, eng, strm);
+            write_to_dnnl_memory(k_seq.data(), k_seq_mem, eng, strm);
+            write_to_dnnl_memory(v_seq.data(), v_seq_mem, eng, strm);
+
+            auto seq_pd = sdpa::primitive_desc(eng, q_seq_md, k_seq_md,
+                    v_seq_md, nullptr, mdt::undef, q_seq_md, false, KVH,
+                    attn_mask_type, softmax_alg);
+            sdpa(seq_pd).execute(strm,
+                    {{DNNL_ARG_QUERIES, q_seq_mem}, {DNNL_ARG_KEYS, k_seq_mem},
+                            {DNNL_ARG_VALUES, v_seq_mem},
+                            {DNNL_ARG_DST, gold_mem}});
+            strm.wait();
+
+            // Copy the result of the sequence out of the paged output.
+            memory test_mem(q_seq_md, eng);
+            auto *dst_ptr = (float16_t *)dst_mem.map_data();
+            auto *test_ptr = (float16_t *)test_mem.map_data();
+            std::copy(dst_ptr + b * seq_q_size, dst_ptr + (b + 1) * seq_q_size,
+                    test_ptr);
+            test_mem.unmap_data(test_ptr);
+            dst_mem.unmap_data(dst_ptr);
+
+            check_memory<float16_t>(strm, gold_mem, test_mem);
+        }
+    }
+
+protected:
+    dnnl::engine eng;
+    dnnl::stream strm;
+    sdpa_paged_dims_t p;
+};
+
 // clang-format off
 
 INSTANTIATE_TEST_SUITE_P(DataTypes_f16_s8, sdpa_test_datatypes,
@@ -1859,6 +2029,21 @@ INSTANTIATE_TEST_SUITE_P(GQA, sdpa_test_datatypes,
                 ),
         &print_to_string2);
 
+INSTANTIATE_TEST_SUITE_P(SplitKV, sdpa_test_datatypes,
+        testing::Combine(testing::Values(1, 2), // mb
+                testing::Values(num_heads_t {8, 8}, num_heads_t {32, 8}), // hd_num
+                testing::Values(seq_len_size_t {1, 2048}, seq_len_size_t {1, 4097}), // seq_len
+                testing::Values(head_group_size_t {128, 128, 128}), // hd_size
+                testing::Values(tensor_type_t("Q", mdt::f16)), // dt
+                testing::Values(tensor_type_t("K", mdt::f16), tensor_type_t("K", mdt::s8, mdt::f16, mdt::s8)), // kdt
+                testing::Values(tensor_type_t("V", mdt::f16), tensor_type_t("V", mdt::s8, mdt::f16, mdt::s8)), // vdt
+                testing::Values(quantize_type::per_token), // qtype
+                testing::Values(dnnl::memory::format_tag::abdc), // key_format_tag
+                testing::Values(mask_config_t {mask_type::no_mask}, mask_config_t {mask_type::oneD, mdt::f16}), // mask_type
+                testing::Values(accumulation_t {accumulation_mode::f32, accumulation_mode::f32}) // accumulation_mode
+                ),
+        &print_to_string2);
+
 INSTANTIATE_TEST_SUITE_P(f16_accumulation, sdpa_test_datatypes,
         testing::Combine(testing::Values(1), // mb
                 testing::Values(num_heads_t {16, 16}, num_heads_t {12, 2}), // hd_num
@@ -1874,6 +2059,12 @@ INSTANTIATE_TEST_SUITE_P(f16_accumulation, sdpa_test_datatypes,
                 ),
         &print_to_string2);
 
+INSTANTIATE_TEST_SUITE_P(Paged, sdpa_paged_test_t,
+        testing::Values(
+                sdpa_paged_dims_t {{32, 8}, 128, 1, 64, {1000, 64, 17, 2048}, mask_type::no_mask},
+                sdpa_paged_dims_t {{32, 32}, 128, 1, 128, {384, 4000, 129}, mask_type::no_mask},
+                sdpa_paged_dims_t {{16, 16}, 64, 32, 64, {512, 100, 1}, mask_type::causal_br}));
+
 
 ////llama-2-7b-chat shape: Q [1x32xSEQ_LENx128] KV [1x32xSEQ_LENx128]
 ////llama-3-8b shape: Q [1x32xSEQ_LENx128] KV [1x8xSEQ_LENx128]
@@ -1974,6 +2165,10 @@ GPU_TEST_P(sdpa_test_datatypes, compare) {
     compare();
 }
 
+GPU_TEST_P(sdpa_paged_test_t, compare) {
+    compare();
+}
+
 GPU_TEST_P(sdpa_test, perf) {
     perf();
 }
@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "common/sdpa_types.hpp"
+#include "sdpa_internal.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+enum class cpu_mask_t { none, buffer_2d, causal_tl, causal_br };
+
+struct sdpa_cpu_params_t {
+    memory::dim mb, heads, kv_heads, queries, keys, head_size;
+    cpu_mask_t mask;
+    bool key_transposed;
+};
+
+class sdpa_cpu_test_t : public ::testing::TestWithParam<sdpa_cpu_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "CPU engine not found.");
+        p_ = ::testing::TestWithParam<sdpa_cpu_params_t>::GetParam();
+        Test();
+    }
+
+    static void fill(memory &m, std::minstd_rand &gen) {
+        std::uniform_real_distribution<float> dist(-1.f, 1.f);
+        auto *ptr = static_cast<float *>(m.get_data_handle());
+        const size_t n = m.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < n; i++)
+            ptr[i] = dist(gen);
+    }
+
+    void Test() {
+        using namespace dnnl::impl;
+        const auto &p = p_;
+        engine eng(engine::kind::cpu, 0);
+        stream strm(eng);
+
+        const memory::dim D = p.head_size;
+        memory::desc q_md({p.mb, p.heads, p.queries, D}, dt::f32, tag::abcd);
+        memory::desc k_md({p.mb, p.kv_heads, D, p.keys}, dt::f32,
+                p.key_transposed ? tag::abdc : tag::abcd);
+        memory::desc v_md({p.mb, p.kv_heads, p.keys, D}, dt::f32, tag::abcd);
+        memory::desc dst_md({p.mb, p.heads, p.queries, D}, dt::f32, tag::abcd);
+        memory::desc msk_md({1, 1, p.queries, p.keys}, dt::f32, tag::abcd);
+        memory::desc scl_md({1, 1, 1, 1}, dt::f32, tag::abcd);
+
+        int mask_type = static_cast<int>(attn_mask_type::undef);
+        if (p.mask == cpu_mask_t::buffer_2d)
+            mask_type = static_cast<int>(attn_mask_type::buffer);
+        if (p.mask == cpu_mask_t::causal_tl)
+            mask_type = static_cast<int>(attn_mask_type::top_left);
+        if (p.mask == cpu_mask_t::causal_br)
+            mask_type = static_cast<int>(attn_mask_type::bottom_right);
+        const bool with_buffer = p.mask == cpu_mask_t::buffer_2d;
+
+        impl::sdpa::primitive_desc pd;
+        try {
+            pd = impl::sdpa::primitive_desc(eng, q_md, k_md, v_md,
+                    with_buffer ? &msk_md : nullptr, dt::f32, dst_md,
+                    /* invert_scale = */ true, p.kv_heads, mask_type,
+                    static_cast<int>(alg_kind::softmax_accurate_inf_as_zero));
+        } catch (const dnnl::error &e) {
+            if (e.status == dnnl_unimplemented)
+                GTEST_SKIP() << "Unimplemented: " << e.what();
+            throw;
+        }
+
+        memory q(q_md, eng), k(k_md, eng), v(v_md, eng), dst(dst_md, eng);
+        memory msk(msk_md, eng), scl(scl_md, eng);
+        std::minstd_rand gen(42);
+        fill(q, gen);
+        fill(k, gen);
+        fill(v, gen);
+        fill(msk, gen);
+        const float scale = std::sqrt(static_cast<float>(D));
+        *static_cast<float *>(scl.get_data_handle()) = scale;
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_QUERIES, q},
+                {DNNL_ARG_KEYS, k}, {DNNL_ARG_VALUES, v}, {DNNL_ARG_DST, dst},
+                {DNNL_ARG_SCALE, scl}};
+        if (with_buffer) args.insert({DNNL_ARG_ATTN_MASK, msk});
+        impl::sdpa(pd).execute(strm, args);
+        strm.wait();
+
+        const auto *q_ptr = static_cast<const float *>(q.get_data_handle());
+        const auto *k_ptr = static_cast<const float *>(k.get_data_handle());
+        const auto *v_ptr = static_cast<const float *>(v.get_data_handle());
+        const auto *m_ptr = static_cast<const float *>(msk.get_data_handle());
+        const auto *d_ptr = static_cast<const float *>(dst.get_data_handle());
+        const auto ks = k_md.get_strides();
+
+        const memory::dim group = p.heads / p.kv_heads;
+        const memory::dim shift
+                = p.mask == cpu_mask_t::causal_br ? p.keys - p.queries : 0;
+        const bool causal = utils::one_of(
+                p.mask, cpu_mask_t::causal_tl, cpu_mask_t::causal_br);
+        std::vector<float> s(p.keys);
+        for_(memory::dim mb = 0; mb < p.mb; mb++)
+        for_(memory::dim h = 0; h < p.heads; h++)
+        for (memory::dim i = 0; i < p.queries; i++) {
+            const memory::dim kh = h / group;
+            float max = -std::numeric_limits<float>::infinity();
+            for (memory::dim j = 0; j < p.keys; j++) {
+                float acc = 0.f;
+                for (memory::dim d = 0; d < D; d++)
+                    acc += q_ptr[((mb * p.heads + h) * p.queries + i) * D + d]
+                            * k_ptr[mb * ks[0] + kh * ks[1] + d * ks[2]
+                                    + j * ks[3]];
+                acc /= scale;
+                if (with_buffer) acc += m_ptr[i * p.keys + j];
+                if (causal && j > i + shift)
+                    acc = -std::numeric_limits<float>::infinity();
+                s[j] = acc;
+                max = std::max(max, acc);
+            }
+            float sum = 0.f;
+            for (memory::dim j = 0; j < p.keys; j++) {
+                s[j] = std::isinf(max) ? 0.f : std::exp(s[j] - max);
+                sum += s[j];
+            }
+            for (memory::dim d = 0; d < D; d++) {
+                float acc = 0.f;
+                for (memory::dim j = 0; j < p.keys; j++)
+                    acc += s[j]
+                            * v_ptr[((mb * p.kv_heads + kh) * p.keys + j) * D
+                                    + d];
+                const float ref = sum == 0.f ? 0.f : acc / sum;
+                const float got
+                        = d_ptr[((mb * p.heads + h) * p.queries + i) * D + d];
+                ASSERT_NEAR(ref, got, 1e-4f)
+                        << "mb:" << mb << " h:" << h << " q:" << i
+                        << " d:" << d;
+            }
+        }
+    }
+
+    sdpa_cpu_params_t p_;
+};
+
+TEST_P(sdpa_cpu_test_t, TestsSDPA) {}
+
+INSTANTIATE_TEST_SUITE_P(TestSDPACPU, sdpa_cpu_test_t,
+        ::testing::Values(
+                sdpa_cpu_params_t {1, 2, 2, 37, 37, 64, cpu_mask_t::none,
+                        false},
+                sdpa_cpu_params_t {
+                        2, 4, 2, 33, 100, 32, cpu_mask_t::buffer_2d, true},
+                sdpa_cpu_params_t {
+                        1, 4, 1, 70, 70, 80, cpu_mask_t::causal_tl, true},
+                sdpa_cpu_params_t {
+                        1, 2, 2, 5, 130, 64, cpu_mask_t::causal_br, false},
+                sdpa_cpu_params_t {
+                        1, 2, 2, 130, 65, 16, cpu_mask_t::causal_br, true}));
+
+} // namespace dnnl
@@ -182,6 +182,50 @@ TEST_P(sycl_stream_test_t, TestProfilingAPIDisabledAndEnabled) {
 #endif
 }
 
+TEST_P(sycl_stream_test_t, CaptureReplay) {
+    engine::kind kind = GetParam();
+    SKIP_IF(kind != engine::kind::gpu, "Native capture is for GPU streams.");
+    SKIP_IF(!has(kind), "Device not found.");
+
+    engine eng = get_engine(kind);
+    stream s(eng);
+
+    const memory::dim n = 1024;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    memory mem(md, eng);
+    {
+        auto ptr = map_memory<float>(mem);
+        for (memory::dim i = 0; i < n; i++)
+            ptr[i] = static_cast<float>(i % 3);
+    }
+    auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_linear, md, md, 2.f, 1.f);
+
+    const dnnl_status_t st = dnnl_stream_begin_capture(s.get());
+    SKIP_IF(st == dnnl_unimplemented, "Graph recording is not supported.");
+    ASSERT_EQ(st, dnnl_success);
+    {
+        // The recording keeps the primitive alive.
+        eltwise_forward prim(pd);
+        prim.execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+        prim.execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+    }
+    end_stream_capture(s);
+
+    const int n_replays = 2;
+    for (int r = 0; r < n_replays; r++)
+        replay_stream_capture(s);
+    s.wait();
+
+    auto ptr = map_memory<float>(mem);
+    for (memory::dim i = 0; i < n; i++) {
+        float ref = static_cast<float>(i % 3);
+        for (int k = 0; k < 2 * n_replays; k++)
+            ref = ref * 2.f + 1.f;
+        ASSERT_EQ(ptr[i], ref);
+    }
+}
+
 // TODO: Enable the test below after sycl_stream_t is fixed to not reuse the
 // service stream. Now it ignores the input stream flags and reuses the service
 // stream which is constructed without any flags.
@@ -457,4 +457,46 @@ GPU_INSTANTIATE_TEST_SUITE_P(TestConcat, concat_test_float, cases_concat_gpu());
 GPU_INSTANTIATE_TEST_SUITE_P(
         TestConcat, concat_test_float16, cases_concat_gpu());
 
+// The first source is a view of the destination written in place, and only
+// the second one is copied.
+HANDLE_EXCEPTIONS_FOR_TEST(concat_in_place_test_t, TestSrcsAreDstViews) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Sharing a data handle between memories is tested on CPU only");
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const memory::dim N = 2, C0 = 16, C1 = 8, H = 3;
+    memory::desc dst_md({N, C0 + C1, H}, memory::data_type::f32, fmt::abc);
+    memory::desc src0_md = dst_md.submemory_desc({N, C0, H}, {0, 0, 0});
+    memory::desc src1_md({N, C1, H}, memory::data_type::f32, fmt::abc);
+
+    auto dst = test::make_memory(dst_md, eng);
+    memory src0(src0_md, eng, dst.get_data_handle());
+    auto src1 = test::make_memory(src1_md, eng);
+    {
+        auto dst_ptr = map_memory<float>(dst);
+        for (memory::dim i = 0; i < N * (C0 + C1) * H; i++)
+            dst_ptr[i] = (float)i;
+        auto src1_ptr = map_memory<float>(src1);
+        for (memory::dim i = 0; i < N * C1 * H; i++)
+            src1_ptr[i] = -(float)i;
+    }
+
+    auto pd = concat::primitive_desc(eng, dst_md, 1, {src0_md, src1_md});
+    concat(pd).execute(strm,
+            {{DNNL_ARG_MULTIPLE_SRC, src0}, {DNNL_ARG_MULTIPLE_SRC + 1, src1},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    auto dst_ptr = map_memory<float>(dst);
+    for_(memory::dim n = 0; n < N; n++)
+    for_(memory::dim c = 0; c < C0 + C1; c++)
+    for (memory::dim h = 0; h < H; h++) {
+        const memory::dim off = (n * (C0 + C1) + c) * H + h;
+        const float ref = c < C0 ? (float)off
+                                 : -(float)((n * C1 + c - C0) * H + h);
+        ASSERT_EQ(dst_ptr[off], ref);
+    }
+}
+
 } // namespace dnnl
@@ -459,4 +459,54 @@ INST_TEST_CASE(EltwiseSimpleF32, all_cases, EXPAND_DTS(f32, f32, f32));
 INST_TEST_CASE(EltwiseSimpleBF16, all_cases, EXPAND_DTS(bf16, bf16, bf16));
 INST_TEST_CASE(EltwiseSimpleF16, all_cases, EXPAND_DTS(f16, f16, undef));
 INST_TEST_CASE(EltwiseSimpleU8, all_cases, EXPAND_DTS(u8, u8, undef));
+
+// The `any` floating-point math mode allows faster approximations of tanh,
+// logistic and gelu_erf. Check that their error stays within the documented
+// bound.
+TEST(eltwise_fpmath_test, TestApproximationAccuracy) {
+    const float max_err = 1e-5f;
+    const memory::dim n = 8192;
+    const float lo = -10.f, hi = 10.f;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+    auto md = memory::desc({n}, dt::f32, tag::a);
+
+    primitive_attr attr;
+    attr.set_fpmath_mode(fpmath_mode::any);
+
+    const std::vector<std::pair<algorithm, float (*)(float)>> algs = {
+            {algorithm::eltwise_tanh, [](float x) { return ::tanhf(x); }},
+            {algorithm::eltwise_logistic,
+                    [](float x) { return 1.f / (1.f + ::expf(-x)); }},
+            {algorithm::eltwise_gelu_erf, [](float x) {
+                 return 0.5f * x * (1.f + ::erff(x / ::sqrtf(2.f)));
+             }}};
+
+    for (const auto &a : algs) {
+        auto pd = eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, a.first, md, md, 0.f, 0.f, attr);
+        auto src = test::make_memory(md, eng);
+        auto dst = test::make_memory(md, eng);
+        {
+            auto s = map_memory<float>(src);
+            for (memory::dim i = 0; i < n; i++)
+                s[i] = lo + (hi - lo) * i / (n - 1);
+        }
+        eltwise_forward(pd).execute(
+                strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        auto s = map_memory<float>(src);
+        auto d = map_memory<float>(dst);
+        float err = 0.f;
+        for (memory::dim i = 0; i < n; i++) {
+            const float ref = a.second(s[i]);
+            err = std::max(err,
+                    std::fabs(d[i] - ref) / std::max(1.f, std::fabs(ref)));
+        }
+        EXPECT_LE(err, max_err) << "alg: " << static_cast<int>(a.first);
+    }
+}
+
 } // namespace dnnl
@@ -0,0 +1,202 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct embedding_bag_test_params_t {
+    algorithm aalgorithm;
+    memory::dim rows;
+    memory::dim dim;
+    // The number of rows of every bag.
+    std::vector<int> bag_sizes;
+    bool with_weights;
+    bool per_row_scales;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class embedding_bag_test_t
+    : public ::testing::TestWithParam<embedding_bag_test_params_t> {
+private:
+    embedding_bag_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<embedding_bag_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Embedding bag is supported on CPU only.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using pd_t = embedding_bag::primitive_desc;
+        using dt = memory::data_type;
+        using tag = memory::format_tag;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const memory::dim bags = p.bag_sizes.size();
+        std::vector<int32_t> offsets(bags);
+        memory::dim nnz = 0;
+        for (memory::dim b = 0; b < bags; b++) {
+            offsets[b] = static_cast<int32_t>(nnz);
+            nnz += p.bag_sizes[b];
+        }
+
+        auto src_md = memory::desc({p.rows, p.dim}, dt::f32, tag::ab);
+        auto indices_md = memory::desc({nnz}, dt::s32, tag::a);
+        auto offsets_md = memory::desc({bags}, dt::s32, tag::a);
+        auto wei_md = memory::desc({nnz}, dt::f32, tag::a);
+        auto dst_md = memory::desc({bags, p.dim}, dt::f32, tag::any);
+
+        primitive_attr attr;
+        if (p.per_row_scales) attr.set_scales_mask(DNNL_ARG_SRC, 1 << 0);
+
+        auto pd = p.with_weights
+                ? pd_t(eng, p.aalgorithm, src_md, indices_md, offsets_md,
+                        wei_md, dst_md, attr)
+                : pd_t(eng, p.aalgorithm, src_md, indices_md, offsets_md,
+                        dst_md, attr);
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+        ASSERT_TRUE(pd.indices_desc() == indices_md);
+        ASSERT_TRUE(pd.offsets_desc() == offsets_md);
+        ASSERT_EQ(pd.dst_desc().get_dims(), dst_md.get_dims());
+
+        auto prim = embedding_bag(pd);
+
+        auto src = test::make_memory(src_md, eng);
+        auto indices = test::make_memory(indices_md, eng);
+        auto offs = test::make_memory(offsets_md, eng);
+        auto wei = test::make_memory(wei_md, eng);
+        auto scales = test::make_memory(
+                memory::desc({p.rows}, dt::f32, tag::a), eng);
+        auto dst = test::make_memory(pd.dst_desc(), eng);
+
+        std::vector<float> table(p.rows * p.dim);
+        std::vector<int32_t> idx(nnz);
+        std::vector<float> w(nnz);
+        std::vector<float> sc(p.rows);
+        for (size_t i = 0; i < table.size(); i++)
+            table[i] = static_cast<float>((i * 7) % 13) - 6.f;
+        for (memory::dim j = 0; j < nnz; j++) {
+            idx[j] = static_cast<int32_t>((j * 5 + 3) % p.rows);
+            w[j] = 0.25f * static_cast<float>(j % 4 + 1);
+        }
+        for (memory::dim r = 0; r < p.rows; r++)
+            sc[r] = 0.5f * static_cast<float>(r % 3 + 1);
+
+        {
+            auto ptr = map_memory<float>(src);
+            for (size_t i = 0; i < table.size(); i++)
+                ptr[i] = table[i];
+        }
+        {
+            auto ptr = map_memory<int32_t>(indices);
+            for (memory::dim j = 0; j < nnz; j++)
+                ptr[j] = idx[j];
+        }
+        {
+            auto ptr = map_memory<int32_t>(offs);
+            for (memory::dim b = 0; b < bags; b++)
+                ptr[b] = offsets[b];
+        }
+        {
+            auto ptr = map_memory<float>(wei);
+            for (memory::dim j = 0; j < nnz; j++)
+                ptr[j] = w[j];
+        }
+        {
+            auto ptr = map_memory<float>(scales);
+            for (memory::dim r = 0; r < p.rows; r++)
+                ptr[r] = sc[r];
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_SRC_1, indices}, {DNNL_ARG_SRC_2, offs},
+                {DNNL_ARG_DST, dst}};
+        if (p.with_weights) args.insert({DNNL_ARG_WEIGHTS, wei});
+        if (p.per_row_scales)
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, scales});
+        prim.execute(strm, args);
+        strm.wait();
+
+        auto dst_ptr = map_memory<float>(dst);
+        for (memory::dim b = 0; b < bags; b++) {
+            const memory::dim start = offsets[b];
+            const memory::dim end = start + p.bag_sizes[b];
+            for (memory::dim d = 0; d < p.dim; d++) {
+                float ref = p.aalgorithm == algorithm::reduction_max
+                                && end > start
+                        ? -INFINITY
+                        : 0.f;
+                for (memory::dim j = start; j < end; j++) {
+                    const int32_t r = idx[j];
+                    float v = table[r * p.dim + d];
+                    if (p.per_row_scales) v *= sc[r];
+                    if (p.with_weights) v *= w[j];
+                    if (p.aalgorithm == algorithm::reduction_max)
+                        ref = std::max(ref, v);
+                    else
+                        ref += v;
+                }
+                if (p.aalgorithm == algorithm::reduction_mean && end > start)
+                    ref /= static_cast<float>(end - start);
+                ASSERT_NEAR(dst_ptr[b * p.dim + d], ref,
+                        1e-4f * (1.f + std::fabs(ref)))
+                        << "bag " << b << " dim " << d;
+            }
+        }
+    }
+};
+
+TEST_P(embedding_bag_test_t, TestsEmbeddingBag) {}
+
+INSTANTIATE_TEST_SUITE_P(TestEmbeddingBagEF, embedding_bag_test_t,
+        ::testing::Values(
+                // not supported alg_kind
+                embedding_bag_test_params_t {algorithm::reduction_min, 8, 4,
+                        {2, 1}, false, false, true, dnnl_invalid_arguments},
+                // weights with max
+                embedding_bag_test_params_t {algorithm::reduction_max, 8, 4,
+                        {2, 1}, true, false, true, dnnl_invalid_arguments}));
+
+INSTANTIATE_TEST_SUITE_P(TestEmbeddingBag, embedding_bag_test_t,
+        ::testing::Values(embedding_bag_test_params_t {algorithm::reduction_sum,
+                                  16, 8, {3, 0, 5, 1}, false, false},
+                embedding_bag_test_params_t {algorithm::reduction_sum, 16, 8,
+                        {3, 0, 5, 1}, true, true},
+                embedding_bag_test_params_t {algorithm::reduction_mean, 32,
+                        300, {4, 7, 0, 2, 9}, false, true},
+                embedding_bag_test_params_t {algorithm::reduction_max, 32, 17,
+                        {1, 0, 12, 3}, false, false},
+                embedding_bag_test_params_t {algorithm::reduction_sum, 1000,
+                        64, std::vector<int>(257, 20), true, false}));
+
+} // namespace dnnl
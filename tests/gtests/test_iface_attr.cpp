@@ -84,7 +84,8 @@ TEST_F(attr_test_t, TestAccMode) {
 
 TEST_F(attr_test_t, TestScratchpadMode) {
     dnnl::primitive_attr attr;
-    for (auto m : {scratchpad_mode::library, scratchpad_mode::user}) {
+    for (auto m : {scratchpad_mode::library, scratchpad_mode::user,
+                 scratchpad_mode::stream}) {
         attr.set_scratchpad_mode(m);
         ASSERT_EQ(m, attr.get_scratchpad_mode());
     }
@@ -127,6 +128,997 @@ TEST_F(attr_test_t, TestDeterministic) {
     }
 }
 
+TEST_F(attr_test_t, TestConstantWeights) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(false, attr.get_constant_weights());
+
+    for (auto b : {true, false}) {
+        attr.set_constant_weights(b);
+        ASSERT_EQ(b, attr.get_constant_weights());
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestConstantWeightsMatmul) {
+    engine eng = get_test_engine();
+
+    // Plain weights with a large power of 2 N are repacked by the
+    // implementations, the packed weights must follow the weights buffer.
+    const memory::dim M = 4, K = 64, N = 512;
+    memory::desc src_md({M, K}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc wei_md({K, N}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc dst_md({M, N}, memory::data_type::f32, memory::format_tag::ab);
+
+    dnnl::primitive_attr attr;
+    attr.set_constant_weights(true);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    ASSERT_TRUE(pd.get_primitive_attr().get_constant_weights());
+    auto prim = matmul(pd);
+
+    auto src = test::make_memory(src_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < M * K; i++)
+            src_ptr[i] = (float)(i % 7) - 3.f;
+    }
+
+    const auto fill_weights = [&](float *wei_ptr, int w) {
+        for (memory::dim i = 0; i < K * N; i++)
+            wei_ptr[i] = (float)((i * w) % 5) - 2.f;
+    };
+
+    stream s(eng);
+    const auto check = [&](const memory &wei) {
+        prim.execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        s.wait();
+
+        auto src_ptr = map_memory<float>(src);
+        auto wei_ptr = map_memory<float>(wei);
+        auto dst_ptr = map_memory<float>(dst);
+        for_(memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float ref = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                ref += src_ptr[m * K + k] * wei_ptr[k * N + n];
+            ASSERT_EQ(dst_ptr[m * N + n], ref);
+        }
+    };
+
+    // Two weights alive at the same time, passed in turns.
+    std::vector<memory> weis;
+    for (int w : {1, 2}) {
+        weis.push_back(test::make_memory(wei_md, eng));
+        auto wei_ptr = map_memory<float>(weis.back());
+        fill_weights(wei_ptr, w);
+    }
+    for (int i : {0, 1, 1, 0})
+        check(weis[i]);
+
+    // New weights at the address of the previous ones.
+    if (eng.get_kind() == engine::kind::cpu) {
+        std::vector<float> buf(K * N);
+        for (int w : {3, 4}) {
+            fill_weights(buf.data(), w);
+            check(memory(wei_md, eng, buf.data()));
+        }
+        memory wei(wei_md, eng, buf.data());
+        check(wei);
+        std::vector<float> other_buf(K * N);
+        fill_weights(other_buf.data(), 1);
+        wei.set_data_handle(other_buf.data());
+        check(wei);
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestConstantWeightsConvolution) {
+    engine eng = get_test_engine();
+
+    // The padding compensation of the source zero point depends on the
+    // weights, the cached compensation must follow the weights buffer.
+    const memory::dim IC = 16, OC = 64, H = 16, W = 16, KH = 3, KW = 3;
+    const int32_t zp_src = 2;
+    memory::desc src_md({1, IC, H, W}, data_type::u8, tag::nhwc);
+    memory::desc dst_md({1, OC, H, W}, data_type::f32, tag::nhwc);
+    memory::desc user_wei_md({OC, IC, KH, KW}, data_type::s8, tag::oihw);
+    memory::desc any_wei_md({OC, IC, KH, KW}, data_type::s8, tag::any);
+
+    dnnl::primitive_attr attr;
+    attr.set_constant_weights(true);
+    attr.set_zero_points_mask(DNNL_ARG_SRC, 0);
+    auto pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, any_wei_md, dst_md, {1, 1}, {1, 1}, {1, 1}, attr);
+    auto prim = convolution_forward(pd);
+    const auto wei_md = pd.weights_desc();
+
+    auto src = test::make_memory(src_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    auto zp = test::make_memory(
+            memory::desc({1}, data_type::s32, tag::x), eng);
+    {
+        auto src_ptr = map_memory<uint8_t>(src);
+        for (memory::dim i = 0; i < H * W * IC; i++)
+            src_ptr[i] = (uint8_t)(i % 7);
+        auto zp_ptr = map_memory<int32_t>(zp);
+        zp_ptr[0] = zp_src;
+    }
+    std::vector<uint8_t> src_vals(H * W * IC);
+    for (memory::dim i = 0; i < H * W * IC; i++)
+        src_vals[i] = (uint8_t)(i % 7);
+
+    const auto get_weights = [&](int w) {
+        std::vector<int8_t> vals(OC * IC * KH * KW);
+        for (size_t i = 0; i < vals.size(); i++)
+            vals[i] = (int8_t)((i * w) % 5) - 2;
+        return vals;
+    };
+
+    stream s(eng);
+    const auto load_weights = [&](memory &wei, const std::vector<int8_t> &v) {
+        auto user_wei = test::make_memory(user_wei_md, eng);
+        {
+            auto ptr = map_memory<int8_t>(user_wei);
+            for (size_t i = 0; i < v.size(); i++)
+                ptr[i] = v[i];
+        }
+        reorder(user_wei, wei).execute(s, user_wei, wei);
+        s.wait();
+    };
+
+    const auto check = [&](const memory &wei, const std::vector<int8_t> &v) {
+        prim.execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC, zp}});
+        s.wait();
+
+        // The padded area contributes nothing after the zero point shift.
+        auto dst_ptr = map_memory<float>(dst);
+        for_(memory::dim oh = 0; oh < H; oh++)
+        for_(memory::dim ow = 0; ow < W; ow++)
+        for (memory::dim oc = 0; oc < OC; oc++) {
+            float ref = 0.f;
+            for_(memory::dim ic = 0; ic < IC; ic++)
+            for_(memory::dim kh = 0; kh < KH; kh++)
+            for (memory::dim kw = 0; kw < KW; kw++) {
+                const memory::dim ih = oh + kh - 1, iw = ow + kw - 1;
+                if (ih < 0 || ih >= H || iw < 0 || iw >= W) continue;
+                const int32_t s_val = src_vals[(ih * W + iw) * IC + ic];
+                const int32_t w_val = v[((oc * IC + ic) * KH + kh) * KW + kw];
+                ref += (float)((s_val - zp_src) * w_val);
+            }
+            ASSERT_EQ(dst_ptr[(oh * W + ow) * OC + oc], ref)
+                    << "oh = " << oh << " ow = " << ow << " oc = " << oc;
+        }
+    };
+
+    // Two weights alive at the same time, passed in turns.
+    std::vector<memory> weis;
+    std::vector<std::vector<int8_t>> vals;
+    for (int w : {1, 2}) {
+        weis.push_back(test::make_memory(wei_md, eng));
+        vals.push_back(get_weights(w));
+        load_weights(weis.back(), vals.back());
+    }
+    for (int i : {0, 1, 1, 0})
+        check(weis[i], vals[i]);
+
+    // New weights at the address of the freed ones.
+    if (eng.get_kind() == engine::kind::cpu) {
+        std::vector<char> buf(wei_md.get_size());
+        for (int w : {3, 4}) {
+            memory wei(wei_md, eng, buf.data());
+            const auto v = get_weights(w);
+            load_weights(wei, v);
+            check(wei, v);
+        }
+        memory wei(wei_md, eng, buf.data());
+        const auto v = get_weights(1);
+        std::vector<char> other_buf(wei_md.get_size());
+        memory other(wei_md, eng, other_buf.data());
+        load_weights(other, v);
+        wei.set_data_handle(other_buf.data());
+        check(wei, v);
+    }
+}
+
+TEST_F(attr_test_t, TestSoftmaxMask) {
+    dnnl::primitive_attr attr;
+    softmax_mask_kind kind;
+    memory::desc lengths_md;
+    // Check the default value
+    attr.get_softmax_mask(kind, lengths_md);
+    ASSERT_EQ(kind, softmax_mask_kind::none);
+    ASSERT_EQ(lengths_md, memory::desc());
+
+    memory::desc md({2, 3, 1}, data_type::s32, tag::abc);
+    for (auto k : {softmax_mask_kind::causal_top_left,
+                 softmax_mask_kind::causal_bottom_right,
+                 softmax_mask_kind::none}) {
+        attr.set_softmax_mask(k, md);
+        attr.get_softmax_mask(kind, lengths_md);
+        ASSERT_EQ(k, kind);
+        ASSERT_EQ(md, lengths_md);
+    }
+
+    // Lengths are integer
+    EXPECT_ANY_THROW(attr.set_softmax_mask(softmax_mask_kind::none,
+            memory::desc({2, 3, 1}, data_type::f32, tag::abc)));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestSoftmaxMaskExecution) {
+    SKIP_IF(get_test_engine_kind() == engine::kind::gpu
+                    && DNNL_GPU_VENDOR != DNNL_VENDOR_INTEL,
+            "Softmax mask is only supported on CPU and Intel GPU engines");
+    engine eng = get_test_engine();
+
+    const memory::dim B = 2, R = 3, C = 5;
+    memory::desc data_md({B, R, C}, data_type::f32, tag::abc);
+    memory::desc lengths_md({B, R, 1}, data_type::s32, tag::abc);
+
+    // The causal mask requires a row dimension
+    {
+        dnnl::primitive_attr attr;
+        attr.set_softmax_mask(softmax_mask_kind::causal_top_left);
+        EXPECT_ANY_THROW(softmax_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::softmax_accurate,
+                data_md, data_md, 0, attr));
+    }
+
+    stream s(eng);
+    for (auto k : {softmax_mask_kind::none, softmax_mask_kind::causal_top_left,
+                 softmax_mask_kind::causal_bottom_right}) {
+        dnnl::primitive_attr attr;
+        attr.set_softmax_mask(k, lengths_md);
+        auto pd = softmax_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::softmax_accurate,
+                data_md, data_md, 2, attr);
+        auto prim = softmax_forward(pd);
+
+        auto src = test::make_memory(data_md, eng);
+        auto dst = test::make_memory(data_md, eng);
+        auto lengths = test::make_memory(lengths_md, eng);
+        {
+            auto src_ptr = map_memory<float>(src);
+            for (memory::dim i = 0; i < B * R * C; i++)
+                src_ptr[i] = 0.25f * (float)(i % 7);
+            auto lengths_ptr = map_memory<int32_t>(lengths);
+            for (memory::dim i = 0; i < B * R; i++)
+                lengths_ptr[i] = i < R ? (int32_t)C : (int32_t)(i % R);
+        }
+
+        prim.execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_ATTR_SOFTMAX_LENGTHS, lengths}});
+        s.wait();
+
+        auto src_ptr = map_memory<float>(src);
+        auto dst_ptr = map_memory<float>(dst);
+        auto lengths_ptr = map_memory<int32_t>(lengths);
+        for_(memory::dim b = 0; b < B; b++)
+        for (memory::dim r = 0; r < R; r++) {
+            memory::dim n = std::min<memory::dim>(C, lengths_ptr[b * R + r]);
+            if (k == softmax_mask_kind::causal_top_left)
+                n = std::min(n, r + 1);
+            if (k == softmax_mask_kind::causal_bottom_right)
+                n = std::min(n, r + C - R + 1);
+
+            const memory::dim off = (b * R + r) * C;
+            float max = -FLT_MAX, denom = 0.f;
+            for (memory::dim c = 0; c < n; c++)
+                max = std::max(max, src_ptr[off + c]);
+            for (memory::dim c = 0; c < n; c++)
+                denom += expf(src_ptr[off + c] - max);
+            for (memory::dim c = 0; c < C; c++) {
+                const float ref
+                        = c < n ? expf(src_ptr[off + c] - max) / denom : 0.f;
+                ASSERT_NEAR(dst_ptr[off + c], ref, 1e-6f);
+            }
+        }
+    }
+}
+
+TEST_F(attr_test_t, TestTopK) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(attr.get_top_k(), 0);
+    attr.set_top_k(8);
+    ASSERT_EQ(attr.get_top_k(), 8);
+    attr.set_top_k(0);
+    ASSERT_EQ(attr.get_top_k(), 0);
+    EXPECT_ANY_THROW(attr.set_top_k(-1));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestMatmulTopKExecution) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Top-k is only supported on CPU engine");
+    engine eng = get_test_engine();
+
+    const memory::dim M = 128, K = 16, N = 10000, k = 5;
+    memory::desc src_md({M, K}, data_type::f32, tag::ab);
+    memory::desc wei_md({K, N}, data_type::f32, tag::ba);
+    memory::desc bia_md({1, N}, data_type::f32, tag::ab);
+    memory::desc dst_md({M, N}, data_type::f32, tag::ab);
+
+    dnnl::primitive_attr attr;
+    // There are fewer columns than kept values
+    attr.set_top_k(N + 1);
+    EXPECT_ANY_THROW(
+            matmul::primitive_desc(eng, src_md, wei_md, bia_md, dst_md, attr));
+
+    attr.set_top_k(k);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, bia_md, dst_md, attr);
+    const auto values_md = pd.query_md(
+            query::exec_arg_md, DNNL_ARG_ATTR_TOP_K_VALUES);
+    const auto indices_md = pd.query_md(
+            query::exec_arg_md, DNNL_ARG_ATTR_TOP_K_INDICES);
+    ASSERT_EQ(values_md, memory::desc({M, k}, data_type::f32, tag::ab));
+    ASSERT_EQ(indices_md, memory::desc({M, k}, data_type::s32, tag::ab));
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto bia = test::make_memory(bia_md, eng);
+    auto values = test::make_memory(values_md, eng);
+    auto indices = test::make_memory(indices_md, eng);
+    // Small integers keep the products exact and give many equal values.
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < M * K; i++)
+            src_ptr[i] = (float)(i * 3 % 5) - 2.f;
+        auto wei_ptr = map_memory<float>(wei);
+        for (memory::dim i = 0; i < K * N; i++)
+            wei_ptr[i] = (float)(i * 7 % 11) - 5.f;
+        auto bia_ptr = map_memory<float>(bia);
+        for (memory::dim n = 0; n < N; n++)
+            bia_ptr[n] = (float)(n % 3);
+    }
+
+    stream s(eng);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_ATTR_TOP_K_VALUES, values},
+                    {DNNL_ARG_ATTR_TOP_K_INDICES, indices}});
+    s.wait();
+
+    auto src_ptr = map_memory<float>(src);
+    auto wei_ptr = map_memory<float>(wei);
+    auto bia_ptr = map_memory<float>(bia);
+    auto values_ptr = map_memory<float>(values);
+    auto indices_ptr = map_memory<int32_t>(indices);
+    std::vector<float> row(N);
+    std::vector<int32_t> order(N);
+    for (memory::dim m = 0; m < M; m++) {
+        for (memory::dim n = 0; n < N; n++) {
+            float ref = bia_ptr[n];
+            // The weights are transposed
+            for (memory::dim kk = 0; kk < K; kk++)
+                ref += src_ptr[m * K + kk] * wei_ptr[n * K + kk];
+            row[n] = ref;
+            order[n] = (int32_t)n;
+        }
+        std::stable_sort(order.begin(), order.end(),
+                [&](int32_t a, int32_t b) { return row[a] > row[b]; });
+        for (memory::dim i = 0; i < k; i++) {
+            ASSERT_EQ(indices_ptr[m * k + i], order[i]);
+            ASSERT_EQ(values_ptr[m * k + i], row[order[i]]);
+        }
+    }
+}
+
+TEST_F(attr_test_t, TestDstSplit) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(attr.get_dst_split(), 0);
+    memory::desc part_md({2, 4, 8, 16}, data_type::f32, tag::abcd);
+    attr.set_dst_split({part_md, part_md, part_md});
+    ASSERT_EQ(attr.get_dst_split(), 3);
+    attr.set_dst_split({});
+    ASSERT_EQ(attr.get_dst_split(), 0);
+    memory::desc bad_md({8, 16}, data_type::f32, tag::ab);
+    EXPECT_ANY_THROW(attr.set_dst_split({bad_md}));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestMatmulDstSplitExecution) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Destination split is only supported on CPU engine");
+    engine eng = get_test_engine();
+
+    const memory::dim B = 2, S = 40, H = 4, D = 8, K = 24;
+    const memory::dim M = B * S, N = 3 * H * D;
+    memory::desc src_md({M, K}, data_type::f32, tag::ab);
+    memory::desc wei_md({K, N}, data_type::f32, tag::ab);
+    memory::desc bia_md({1, N}, data_type::f32, tag::ab);
+    memory::desc dst_md({M, N}, data_type::f32, tag::ab);
+
+    // Head-major query, transposed key and sequence-major value.
+    const memory::dims part_dims = {B, H, S, D};
+    const std::vector<memory::desc> part_mds
+            = {memory::desc(part_dims, data_type::f32, tag::abcd),
+                    memory::desc(part_dims, data_type::f32, tag::abdc),
+                    memory::desc(part_dims, data_type::f32, tag::acbd)};
+
+    dnnl::primitive_attr attr;
+    // The parts do not take all the columns
+    attr.set_dst_split({part_mds[0], part_mds[1]});
+    EXPECT_ANY_THROW(
+            matmul::primitive_desc(eng, src_md, wei_md, bia_md, dst_md, attr));
+
+    attr.set_dst_split(part_mds);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, bia_md, dst_md, attr);
+    for (int p = 0; p < 3; p++)
+        ASSERT_EQ(pd.query_md(query::exec_arg_md, DNNL_ARG_MULTIPLE_DST + p),
+                part_mds[p]);
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto bia = test::make_memory(bia_md, eng);
+    std::vector<memory> parts;
+    for (const auto &md : part_mds)
+        parts.push_back(test::make_memory(md, eng));
+    // Small integers keep the products exact.
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < M * K; i++)
+            src_ptr[i] = (float)(i * 3 % 5) - 2.f;
+        auto wei_ptr = map_memory<float>(wei);
+        for (memory::dim i = 0; i < K * N; i++)
+            wei_ptr[i] = (float)(i * 7 % 11) - 5.f;
+        auto bia_ptr = map_memory<float>(bia);
+        for (memory::dim n = 0; n < N; n++)
+            bia_ptr[n] = (float)(n % 3);
+    }
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+            {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_BIAS, bia}};
+    for (int p = 0; p < 3; p++)
+        args.insert({DNNL_ARG_MULTIPLE_DST + p, parts[p]});
+    stream s(eng);
+    matmul(pd).execute(s, args);
+    s.wait();
+
+    auto src_ptr = map_memory<float>(src);
+    auto wei_ptr = map_memory<float>(wei);
+    auto bia_ptr = map_memory<float>(bia);
+    for (int p = 0; p < 3; p++) {
+        auto part_ptr = map_memory<float>(parts[p]);
+        const auto strides = part_mds[p].get_strides();
+        for_(memory::dim b = 0; b < B; b++)
+        for_(memory::dim h = 0; h < H; h++)
+        for_(memory::dim ss = 0; ss < S; ss++)
+        for (memory::dim d = 0; d < D; d++) {
+            const memory::dim m = b * S + ss;
+            const memory::dim n = p * H * D + h * D + d;
+            float ref = bia_ptr[n];
+            for (memory::dim kk = 0; kk < K; kk++)
+                ref += src_ptr[m * K + kk] * wei_ptr[kk * N + n];
+            const memory::dim off = b * strides[0] + h * strides[1]
+                    + ss * strides[2] + d * strides[3];
+            ASSERT_EQ(part_ptr[off], ref);
+        }
+    }
+}
+
+TEST_F(attr_test_t, TestWorkspaceDataType) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(attr.get_workspace_data_type(), data_type::undef);
+
+    for (auto dt : {data_type::bf16, data_type::f16, data_type::f8_e5m2,
+                 data_type::f8_e4m3, data_type::undef}) {
+        attr.set_workspace_data_type(dt);
+        ASSERT_EQ(attr.get_workspace_data_type(), dt);
+    }
+
+    // The workspace keeps floating-point values
+    EXPECT_ANY_THROW(attr.set_workspace_data_type(data_type::s8));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestSoftmaxWorkspaceExecution) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Workspace data type is only supported on CPU engines");
+    engine eng = get_test_engine();
+
+    const memory::dim N = 4, C = 19;
+    memory::desc data_md({N, C}, data_type::f32, tag::ab);
+
+    // The workspace is a forward training feature
+    {
+        dnnl::primitive_attr attr;
+        attr.set_workspace_data_type(data_type::bf16);
+        EXPECT_ANY_THROW(softmax_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::softmax_accurate,
+                data_md, data_md, 1, attr));
+    }
+
+    dnnl::primitive_attr attr;
+    attr.set_workspace_data_type(data_type::bf16);
+    auto fwd_pd = softmax_forward::primitive_desc(eng,
+            prop_kind::forward_training, algorithm::softmax_accurate, data_md,
+            data_md, 1, attr);
+    ASSERT_EQ(fwd_pd.workspace_desc().get_data_type(), data_type::bf16);
+    ASSERT_EQ(fwd_pd.workspace_desc().get_dims(), data_md.get_dims());
+    auto bwd_pd = softmax_backward::primitive_desc(eng,
+            algorithm::softmax_accurate, data_md, data_md, data_md, 1, fwd_pd);
+    ASSERT_EQ(bwd_pd.workspace_desc(), fwd_pd.workspace_desc());
+
+    // The reference reads the destination in f32.
+    auto ref_fwd_pd = softmax_forward::primitive_desc(eng,
+            prop_kind::forward_training, algorithm::softmax_accurate, data_md,
+            data_md, 1);
+    auto ref_bwd_pd = softmax_backward::primitive_desc(eng,
+            algorithm::softmax_accurate, data_md, data_md, data_md, 1,
+            ref_fwd_pd);
+
+    auto src = test::make_memory(data_md, eng);
+    auto dst = test::make_memory(data_md, eng);
+    auto ws = test::make_memory(fwd_pd.workspace_desc(), eng);
+    auto diff_dst = test::make_memory(data_md, eng);
+    auto diff_src = test::make_memory(data_md, eng);
+    auto ref_diff_src = test::make_memory(data_md, eng);
+    {
+        auto src_ptr = map_memory<float>(src);
+        auto diff_dst_ptr = map_memory<float>(diff_dst);
+        for (memory::dim i = 0; i < N * C; i++) {
+            src_ptr[i] = 0.5f * (float)(i % 9) - 2.f;
+            diff_dst_ptr[i] = 0.125f * (float)(i % 5) - 0.25f;
+        }
+    }
+
+    stream s(eng);
+    softmax_forward(fwd_pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_WORKSPACE, ws}});
+    softmax_backward(bwd_pd).execute(s,
+            {{DNNL_ARG_WORKSPACE, ws}, {DNNL_ARG_DIFF_DST, diff_dst},
+                    {DNNL_ARG_DIFF_SRC, diff_src}});
+    softmax_backward(ref_bwd_pd)
+            .execute(s,
+                    {{DNNL_ARG_DST, dst}, {DNNL_ARG_DIFF_DST, diff_dst},
+                            {DNNL_ARG_DIFF_SRC, ref_diff_src}});
+    s.wait();
+
+    // The workspace keeps the destination with the precision of bf16.
+    auto diff_src_ptr = map_memory<float>(diff_src);
+    auto ref_diff_src_ptr = map_memory<float>(ref_diff_src);
+    for (memory::dim i = 0; i < N * C; i++)
+        ASSERT_NEAR(diff_src_ptr[i], ref_diff_src_ptr[i], 2e-3f);
+}
+
+TEST_F(attr_test_t, TestSrcUpsampling) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(attr.get_src_upsampling(), 1);
+    attr.set_src_upsampling(2);
+    ASSERT_EQ(attr.get_src_upsampling(), 2);
+    attr.set_src_upsampling(1);
+    ASSERT_EQ(attr.get_src_upsampling(), 1);
+
+    EXPECT_ANY_THROW(attr.set_src_upsampling(0));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestConvolutionSrcUpsampling) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Source upsampling is only supported on CPU engines");
+    engine eng = get_test_engine();
+
+    const memory::dim N = 2, IC = 32, OC = 16, IH = 5, IW = 7, US = 2;
+    const memory::dim UH = IH * US, UW = IW * US;
+    memory::desc src_md({N, IC, IH, IW}, data_type::f32, tag::nhwc);
+    memory::desc up_src_md({N, IC, UH, UW}, data_type::f32, tag::nhwc);
+    memory::desc user_wei_md({OC, IC, 3, 3}, data_type::f32, tag::oihw);
+    memory::desc wei_md({OC, IC, 3, 3}, data_type::f32, tag::any);
+    memory::desc dst_md({N, OC, UH, UW}, data_type::f32, tag::nhwc);
+    const memory::dims strides {1, 1}, padding {1, 1};
+
+    dnnl::primitive_attr attr;
+    attr.set_src_upsampling(US);
+    // The destination is the one of the convolution of the upsampled source
+    EXPECT_ANY_THROW(convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_md, memory::desc({N, OC, IH, IW}, data_type::f32,
+                    tag::nhwc),
+            strides, padding, padding, attr));
+
+    auto pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_md, dst_md, strides, padding, padding, attr);
+    auto ref_pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            up_src_md, wei_md, dst_md, strides, padding, padding);
+
+    auto src = test::make_memory(src_md, eng);
+    auto up_src = test::make_memory(up_src_md, eng);
+    auto user_wei = test::make_memory(user_wei_md, eng);
+    auto wei = test::make_memory(pd.weights_desc(), eng);
+    auto ref_wei = test::make_memory(ref_pd.weights_desc(), eng);
+    auto dst = test::make_memory(dst_md, eng);
+    auto ref_dst = test::make_memory(dst_md, eng);
+    {
+        auto src_ptr = map_memory<float>(src);
+        auto up_src_ptr = map_memory<float>(up_src);
+        auto wei_ptr = map_memory<float>(user_wei);
+        for (memory::dim i = 0; i < N * IH * IW * IC; i++)
+            src_ptr[i] = 0.25f * (float)(i % 11) - 1.f;
+        for_(memory::dim n = 0; n < N; n++)
+        for_(memory::dim h = 0; h < UH; h++)
+        for_(memory::dim w = 0; w < UW; w++)
+        for (memory::dim c = 0; c < IC; c++)
+            up_src_ptr[((n * UH + h) * UW + w) * IC + c]
+                    = src_ptr[((n * IH + h / US) * IW + w / US) * IC + c];
+        for (memory::dim i = 0; i < OC * IC * 3 * 3; i++)
+            wei_ptr[i] = 0.125f * (float)(i % 7) - 0.375f;
+    }
+
+    stream s(eng);
+    reorder(user_wei, wei).execute(s, user_wei, wei);
+    reorder(user_wei, ref_wei).execute(s, user_wei, ref_wei);
+    convolution_forward(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+    convolution_forward(ref_pd).execute(s,
+            {{DNNL_ARG_SRC, up_src}, {DNNL_ARG_WEIGHTS, ref_wei},
+                    {DNNL_ARG_DST, ref_dst}});
+    s.wait();
+
+    auto dst_ptr = map_memory<float>(dst);
+    auto ref_dst_ptr = map_memory<float>(ref_dst);
+    for (memory::dim i = 0; i < N * OC * UH * UW; i++)
+        ASSERT_NEAR(dst_ptr[i], ref_dst_ptr[i], 1e-4f);
+}
+
+TEST_F(attr_test_t, TestDynamicQuantization) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(attr.get_dynamic_quantization(), false);
+    attr.set_dynamic_quantization(true);
+    ASSERT_EQ(attr.get_dynamic_quantization(), true);
+    attr.set_dynamic_quantization(false);
+    ASSERT_EQ(attr.get_dynamic_quantization(), false);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestDynamicQuantizationReorder) {
+    engine eng = get_test_engine();
+    // The GPU engine supports plain destinations only.
+    const bool is_cpu = get_test_engine_kind() == engine::kind::cpu;
+
+    const memory::dim K = 64, N = 40, G = 16;
+    memory::desc src_md({K, N}, data_type::f32, tag::ab);
+
+    dnnl::primitive_attr attr;
+    attr.set_dynamic_quantization(true);
+    // The destination scales are required
+    EXPECT_ANY_THROW(reorder::primitive_desc(eng, src_md, eng,
+            memory::desc({K, N}, data_type::s8, tag::ba), attr));
+
+    auto src = test::make_memory(src_md, eng);
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < K * N; i++)
+            src_ptr[i] = (float)(i * 7 % 23) - 11.f + 0.25f * (float)(i % 4);
+    }
+
+    // A scale per column, or per column and group of G rows.
+    for (bool grouped : {false, true}) {
+        for (auto dst_tag : {tag::ba, is_cpu ? tag::BA16a64b4a : tag::ab}) {
+            if (grouped)
+                attr.set_scales(DNNL_ARG_DST, (1 << 0) | (1 << 1), {G, 1});
+            else
+                attr.set_scales_mask(DNNL_ARG_DST, 1 << 1);
+            memory::desc dst_md({K, N}, data_type::s8, dst_tag);
+            auto pd = reorder::primitive_desc(eng, src_md, eng, dst_md, attr);
+
+            const memory::dim nscales = grouped ? K / G * N : N;
+            memory::desc scales_md({nscales}, data_type::f32, tag::a);
+            auto dst = test::make_memory(dst_md, eng);
+            auto scales = test::make_memory(scales_md, eng);
+            stream s(eng);
+            reorder(pd).execute(s,
+                    {{DNNL_ARG_FROM, src}, {DNNL_ARG_TO, dst},
+                            {DNNL_ARG_ATTR_SCALES | DNNL_ARG_TO, scales}});
+
+            // The values are checked in a plain layout.
+            memory::desc plain_md({K, N}, data_type::s8, tag::ab);
+            auto plain = test::make_memory(plain_md, eng);
+            reorder(dst, plain).execute(s, dst, plain);
+            s.wait();
+
+            auto src_ptr = map_memory<float>(src);
+            auto scales_ptr = map_memory<float>(scales);
+            auto plain_ptr = map_memory<int8_t>(plain);
+            for (memory::dim n = 0; n < N; n++) {
+                for (memory::dim g = 0; g < (grouped ? K / G : 1); g++) {
+                    const memory::dim k0 = g * (grouped ? G : K);
+                    const memory::dim k1 = grouped ? k0 + G : K;
+                    float absmax = 0.f;
+                    for (memory::dim k = k0; k < k1; k++) {
+                        const float v = std::fabs(src_ptr[k * N + n]);
+                        absmax = std::max(absmax, v);
+                    }
+                    const float scale = absmax / 127.f;
+                    ASSERT_FLOAT_EQ(scales_ptr[g * N + n], scale);
+                    for (memory::dim k = k0; k < k1; k++) {
+                        const float ref = src_ptr[k * N + n] / scale;
+                        ASSERT_LE(std::fabs(plain_ptr[k * N + n] - ref), 0.51f);
+                    }
+                }
+            }
+        }
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(
+        attr_test_t, TestDynamicQuantizationPerTensorReorder) {
+    engine eng = get_test_engine();
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Per-tensor dynamic quantization is supported on CPU only");
+
+    const memory::dim M = 48, N = 40;
+    memory::desc src_md({M, N}, data_type::f32, tag::ab);
+    auto src = test::make_memory(src_md, eng);
+    float absmax = 0.f;
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < M * N; i++) {
+            src_ptr[i] = (float)(i * 11 % 29) - 13.f + 0.5f * (float)(i % 3);
+            absmax = std::max(absmax, std::fabs(src_ptr[i]));
+        }
+    }
+
+    dnnl::primitive_attr attr;
+    attr.set_dynamic_quantization(true);
+    attr.set_scales_mask(DNNL_ARG_DST, 0);
+
+    // The largest value of the data type the scale maps the largest absolute
+    // value to, and the relative error of a quantized value.
+    const struct {
+        data_type dt;
+        float qmax;
+        float tol;
+    } cases[] = {{data_type::s8, 127.f, 0.f},
+            {data_type::f8_e4m3, 448.f, 1.f / 16}};
+    for (const auto &c : cases) {
+        memory::desc dst_md({M, N}, c.dt, tag::ba);
+        auto pd = reorder::primitive_desc(eng, src_md, eng, dst_md, attr);
+
+        memory::desc scales_md({1}, data_type::f32, tag::a);
+        auto dst = test::make_memory(dst_md, eng);
+        auto scales = test::make_memory(scales_md, eng);
+        stream s(eng);
+        reorder(pd).execute(s,
+                {{DNNL_ARG_FROM, src}, {DNNL_ARG_TO, dst},
+                        {DNNL_ARG_ATTR_SCALES | DNNL_ARG_TO, scales}});
+
+        memory::desc plain_md({M, N}, data_type::f32, tag::ab);
+        auto plain = test::make_memory(plain_md, eng);
+        reorder(dst, plain).execute(s, dst, plain);
+        s.wait();
+
+        auto src_ptr = map_memory<float>(src);
+        auto scales_ptr = map_memory<float>(scales);
+        auto plain_ptr = map_memory<float>(plain);
+        const float scale = absmax / c.qmax;
+        ASSERT_FLOAT_EQ(scales_ptr[0], scale);
+        for (memory::dim i = 0; i < M * N; i++) {
+            const float ref = src_ptr[i] / scale;
+            ASSERT_LE(std::fabs(plain_ptr[i] - ref),
+                    std::max(0.51f, c.tol * std::fabs(ref)));
+        }
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestDynamicQuantizationInt4Reorder) {
+    engine eng = get_test_engine();
+    // The GPU engine supports plain destinations only.
+    const bool is_cpu = get_test_engine_kind() == engine::kind::cpu;
+
+    const memory::dim K = 128, N = 40, G = 32;
+    memory::desc src_md({K, N}, data_type::f32, tag::ab);
+    auto src = test::make_memory(src_md, eng);
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < K * N; i++)
+            src_ptr[i] = (float)(i * 5 % 19) - 6.f + 0.125f * (float)(i % 8);
+    }
+
+    // Symmetric s4 and asymmetric u4 weights with a scale and a zero point
+    // per column and group of G rows.
+    for (auto dst_dt : {data_type::s4, data_type::u4}) {
+        const bool with_zp = dst_dt == data_type::u4;
+        dnnl::primitive_attr attr;
+        attr.set_dynamic_quantization(true);
+        attr.set_scales(DNNL_ARG_DST, (1 << 0) | (1 << 1), {G, 1});
+        // Unsigned weights need zero points.
+        if (with_zp) {
+            EXPECT_ANY_THROW(reorder::primitive_desc(eng, src_md, eng,
+                    memory::desc({K, N}, dst_dt, tag::ba), attr));
+            attr.set_zero_points(DNNL_ARG_DST, (1 << 0) | (1 << 1), {G, 1});
+        }
+
+        for (auto dst_tag : {tag::ba, is_cpu ? tag::BA16a64b2a : tag::ab}) {
+            memory::desc dst_md({K, N}, dst_dt, dst_tag);
+            auto pd = reorder::primitive_desc(eng, src_md, eng, dst_md, attr);
+
+            memory::desc scales_md({K / G * N}, data_type::f32, tag::a);
+            memory::desc zp_md({K / G * N}, data_type::s32, tag::a);
+            auto dst = test::make_memory(dst_md, eng);
+            auto scales = test::make_memory(scales_md, eng);
+            auto zp = test::make_memory(zp_md, eng);
+            std::unordered_map<int, memory> args {{DNNL_ARG_FROM, src},
+                    {DNNL_ARG_TO, dst},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_TO, scales}};
+            if (with_zp)
+                args.insert({DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_TO, zp});
+            stream s(eng);
+            reorder(pd).execute(s, args);
+
+            // The quantized values are checked in a plain f32 layout.
+            memory::desc plain_md({K, N}, data_type::f32, tag::ab);
+            auto plain = test::make_memory(plain_md, eng);
+            reorder(dst, plain).execute(s, dst, plain);
+            s.wait();
+
+            auto src_ptr = map_memory<float>(src);
+            auto scales_ptr = map_memory<float>(scales);
+            auto zp_ptr = map_memory<int32_t>(zp);
+            auto plain_ptr = map_memory<float>(plain);
+            for_(memory::dim g = 0; g < K / G; g++)
+            for (memory::dim n = 0; n < N; n++) {
+                const float scale = scales_ptr[g * N + n];
+                const float shift = with_zp ? (float)zp_ptr[g * N + n] : 0.f;
+                ASSERT_GT(scale, 0.f);
+                for (memory::dim k = g * G; k < (g + 1) * G; k++) {
+                    const float q = plain_ptr[k * N + n];
+                    const float ref = src_ptr[k * N + n];
+                    ASSERT_LE(std::fabs((q - shift) * scale - ref),
+                            0.51f * scale);
+                }
+            }
+        }
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestDynamicQuantizationMatmul) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Dynamic quantization of matmul is only supported on CPU engine");
+    engine eng = get_test_engine();
+
+    const memory::dim B = 2, M = 24, K = 96, N = 40;
+    memory::desc src_md({B, M, K}, data_type::f32, tag::abc);
+    memory::desc wei_md({B, K, N}, data_type::s8, tag::abc);
+    memory::desc dst_md({B, M, N}, data_type::f32, tag::abc);
+
+    dnnl::primitive_attr attr;
+    attr.set_dynamic_quantization(true);
+    // The source scales are required
+    EXPECT_ANY_THROW(matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr));
+
+    // A scale per row of the source.
+    attr.set_scales_mask(DNNL_ARG_SRC, (1 << 0) | (1 << 1));
+    matmul::primitive_desc pd;
+    try {
+        pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    } catch (const dnnl::error &e) {
+        SKIP_IF(e.status == dnnl_unimplemented,
+                "No implementation with int8 instructions");
+        throw;
+    }
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    memory::desc scales_md({B * M}, data_type::f32, tag::a);
+    auto scales = test::make_memory(scales_md, eng);
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < B * M * K; i++)
+            src_ptr[i] = (float)(i * 7 % 23) - 11.f + 0.25f * (float)(i % 4);
+        auto wei_ptr = map_memory<int8_t>(wei);
+        for (memory::dim i = 0; i < B * K * N; i++)
+            wei_ptr[i] = (int8_t)(i * 5 % 9 - 4);
+    }
+
+    stream s(eng);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, scales}});
+    s.wait();
+
+    auto src_ptr = map_memory<float>(src);
+    auto wei_ptr = map_memory<int8_t>(wei);
+    auto dst_ptr = map_memory<float>(dst);
+    auto scales_ptr = map_memory<float>(scales);
+    for_(memory::dim b = 0; b < B; b++)
+    for (memory::dim m = 0; m < M; m++) {
+        const memory::dim row = (b * M + m) * K;
+        float absmax = 0.f;
+        for (memory::dim k = 0; k < K; k++)
+            absmax = std::max(absmax, std::fabs(src_ptr[row + k]));
+        const float scale = absmax / 127.f;
+        ASSERT_FLOAT_EQ(scales_ptr[b * M + m], scale);
+
+        // The products of the quantized values are exact.
+        for (memory::dim n = 0; n < N; n++) {
+            int32_t acc = 0;
+            for (memory::dim k = 0; k < K; k++) {
+                const float q = std::nearbyint(src_ptr[row + k] / scale);
+                acc += (int32_t)q * wei_ptr[(b * K + k) * N + n];
+            }
+            const float ref = scale * (float)acc;
+            ASSERT_NEAR(dst_ptr[(b * M + m) * N + n], ref,
+                    1e-5f * std::max(1.f, std::fabs(ref)));
+        }
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestMatmulFp8PerRowSrcScales) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Per-row source scales of fp8 matmul are only supported on CPU");
+    engine eng = get_test_engine();
+
+    const memory::dim B = 2, M = 24, K = 64, N = 40;
+    memory::desc src_md({B, M, K}, data_type::f8_e4m3, tag::abc);
+    memory::desc wei_md({B, K, N}, data_type::f8_e4m3, tag::abc);
+    memory::desc dst_md({B, M, N}, data_type::f32, tag::abc);
+
+    // A scale per row of the source.
+    dnnl::primitive_attr attr;
+    attr.set_scales_mask(DNNL_ARG_SRC, (1 << 0) | (1 << 1));
+    matmul::primitive_desc pd;
+    try {
+        pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    } catch (const dnnl::error &e) {
+        SKIP_IF(e.status == dnnl_unimplemented,
+                "No implementation with fp8 support");
+        throw;
+    }
+
+    // Small integers are exact in f8_e4m3, and so are their products
+    // accumulated in f32.
+    memory::desc src_f32_md({B, M, K}, data_type::f32, tag::abc);
+    memory::desc wei_f32_md({B, K, N}, data_type::f32, tag::abc);
+    auto src_f32 = test::make_memory(src_f32_md, eng);
+    auto wei_f32 = test::make_memory(wei_f32_md, eng);
+    auto scales = test::make_memory(
+            memory::desc({B * M}, data_type::f32, tag::a), eng);
+    {
+        auto src_ptr = map_memory<float>(src_f32);
+        for (memory::dim i = 0; i < B * M * K; i++)
+            src_ptr[i] = (float)(i * 7 % 15 - 7);
+        auto wei_ptr = map_memory<float>(wei_f32);
+        for (memory::dim i = 0; i < B * K * N; i++)
+            wei_ptr[i] = (float)(i * 5 % 9 - 4);
+        auto scales_ptr = map_memory<float>(scales);
+        for (memory::dim i = 0; i < B * M; i++)
+            scales_ptr[i] = 0.125f * (float)(i % 5 + 1);
+    }
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    stream s(eng);
+    reorder(src_f32, src).execute(s, src_f32, src);
+    reorder(wei_f32, wei).execute(s, wei_f32, wei);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, scales}});
+    s.wait();
+
+    auto src_ptr = map_memory<float>(src_f32);
+    auto wei_ptr = map_memory<float>(wei_f32);
+    auto dst_ptr = map_memory<float>(dst);
+    auto scales_ptr = map_memory<float>(scales);
+    for_(memory::dim b = 0; b < B; b++)
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim n = 0; n < N; n++) {
+        const memory::dim row = (b * M + m) * K;
+        float acc = 0.f;
+        for (memory::dim k = 0; k < K; k++)
+            acc += src_ptr[row + k] * wei_ptr[(b * K + k) * N + n];
+        ASSERT_FLOAT_EQ(
+                dst_ptr[(b * M + m) * N + n], scales_ptr[b * M + m] * acc);
+    }
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     engine eng = get_test_engine();
 
@@ -158,6 +1150,93 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadModeStream) {
+    engine eng = get_test_engine();
+
+    memory::desc data_md(
+            {16, 64, 7, 7}, memory::data_type::f32, memory::format_tag::nchw);
+
+    auto src = test::make_memory(data_md, eng);
+    fill_data<float>(src.get_desc().get_size() / sizeof(float), src);
+
+    stream s(eng);
+    std::vector<memory> dsts;
+    for (auto m : {scratchpad_mode::library, scratchpad_mode::stream}) {
+        dnnl::primitive_attr attr;
+        attr.set_scratchpad_mode(m);
+        auto softmax_pd = softmax_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::softmax_accurate,
+                data_md, data_md, 1, attr);
+        if (m == scratchpad_mode::stream) {
+            // The scratchpad is neither allocated by the primitive nor
+            // requested from the user.
+            ASSERT_EQ(softmax_pd.scratchpad_desc().get_size(), 0u);
+            ASSERT_EQ(
+                    softmax_pd.query_s64(query::memory_consumption_s64), 0L);
+        }
+
+        auto dst = test::make_memory(softmax_pd.dst_desc(), eng);
+        softmax_forward softmax_p(softmax_pd);
+        // Execute twice to reuse the stream scratchpad.
+        for (int i = 0; i < 2; i++)
+            softmax_p.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        s.wait();
+        dsts.push_back(dst);
+    }
+    compare_data<float>(dsts[0], dsts[1]);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadPlan) {
+    engine eng = get_test_engine();
+
+    dnnl::primitive_attr attr;
+    attr.set_scratchpad_mode(scratchpad_mode::user);
+    std::vector<memory::desc> data_mds;
+    std::vector<primitive> prims;
+    std::vector<size_t> sizes;
+    for (memory::dim c : {64, 128, 32}) {
+        data_mds.emplace_back(memory::dims {16, c, 7, 7},
+                memory::data_type::f32, memory::format_tag::nchw);
+        auto pd = softmax_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::softmax_accurate,
+                data_mds.back(), data_mds.back(), 1, attr);
+        prims.emplace_back(pd);
+        sizes.push_back(pd.scratchpad_desc().get_size());
+    }
+
+    // The first two primitives run on one stream, the last one on another.
+    std::vector<size_t> offsets;
+    const size_t size
+            = primitive::plan_scratchpad(prims, {0, 0, 1}, offsets);
+    ASSERT_EQ(offsets.size(), 3u);
+    ASSERT_EQ(offsets[0], 0u);
+    ASSERT_EQ(offsets[1], 0u);
+    ASSERT_GE(offsets[2], std::max(sizes[0], sizes[1]));
+    ASSERT_GE(size, offsets[2] + sizes[2]);
+    EXPECT_ANY_THROW(primitive::plan_scratchpad(prims, {0, 1}, offsets));
+
+    // The regions of the buffer are passed as raw pointers.
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Shared scratchpad execution is only tested on CPU engine");
+    memory buffer({{(memory::dim)size}, memory::data_type::u8,
+                          memory::format_tag::x},
+            eng);
+    auto *base = static_cast<uint8_t *>(buffer.get_data_handle());
+    stream s(eng);
+    for (size_t i = 0; i < prims.size(); i++) {
+        auto src = test::make_memory(data_mds[i], eng);
+        auto dst = test::make_memory(data_mds[i], eng);
+        fill_data<float>(data_mds[i].get_size() / sizeof(float), src);
+        memory::desc scratchpad_md({(memory::dim)sizes[i]},
+                memory::data_type::u8, memory::format_tag::x);
+        memory scratchpad(scratchpad_md, eng, base + offsets[i]);
+        prims[i].execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_SCRATCHPAD, scratchpad}});
+    }
+    s.wait();
+}
+
 TEST_F(attr_test_t, TestZeroPoints) {
     dnnl::primitive_attr attr;
     const std::vector<int> supported_args = {DNNL_ARG_SRC, DNNL_ARG_DST};
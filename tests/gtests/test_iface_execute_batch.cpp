@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class execute_batch_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        eng = get_test_engine();
+        strm = make_stream(eng);
+    }
+
+    engine eng;
+    stream strm;
+};
+
+TEST_F(execute_batch_test_t, TestSequenceOrder) {
+    const memory::dim n = 64;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+
+    // dst = relu(src) + 1, then dst = dst * 2; the result depends on order.
+    auto relu_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md);
+    auto linear_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_linear, md, md,
+            2.f, 0.f);
+    auto add_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_linear, md, md,
+            1.f, 1.f);
+
+    memory src(md, eng), dst(md, eng);
+    {
+        auto ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < n; i++)
+            ptr[i] = static_cast<float>(i - n / 2);
+    }
+
+    primitive::execute_batch(strm,
+            {{eltwise_forward(relu_pd),
+                     {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}}},
+                    {eltwise_forward(add_pd),
+                            {{DNNL_ARG_SRC, dst}, {DNNL_ARG_DST, dst}}},
+                    {eltwise_forward(linear_pd),
+                            {{DNNL_ARG_SRC, dst}, {DNNL_ARG_DST, dst}}}});
+    strm.wait();
+
+    auto ptr = map_memory<float>(dst);
+    for (memory::dim i = 0; i < n; i++) {
+        const float x = static_cast<float>(i - n / 2);
+        ASSERT_EQ(ptr[i], ((x > 0.f ? x : 0.f) + 1.f) * 2.f);
+    }
+}
+
+TEST_F(execute_batch_test_t, TestInvalidArguments) {
+    memory::desc md({16}, memory::data_type::f32, memory::format_tag::a);
+    auto relu_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md);
+    eltwise_forward relu(relu_pd);
+    memory src(md, eng), dst(md, eng);
+
+    // An empty list is a no-op.
+    ASSERT_NO_THROW(primitive::execute_batch(strm, {}));
+
+    // The second primitive lacks an argument, so nothing is executed.
+    EXPECT_ANY_THROW(primitive::execute_batch(strm,
+            {{relu, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}}},
+                    {relu, {{DNNL_ARG_SRC, src}}}}));
+
+    ASSERT_EQ(dnnl_primitive_execute_batch(strm.get(), 1, nullptr, nullptr,
+                      nullptr),
+            dnnl_invalid_arguments);
+}
+
+} // namespace dnnl
@@ -116,6 +116,121 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestStats) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(4);
+    reset_cache_stats();
+    fill_primitive_cache(4);
+    fill_primitive_cache(4);
+    // The first 4 primitives are hits and the last 2 evict the least recently
+    // used entries.
+    fill_primitive_cache(6);
+
+    auto stats = get_primitive_cache_stats(primitive::kind::eltwise);
+    ASSERT_EQ(stats.hits, 8u);
+    ASSERT_EQ(stats.misses, 6u);
+    ASSERT_EQ(stats.evictions, 2u);
+    ASSERT_EQ(stats.size, 4);
+    ASSERT_GE(stats.creation_time_ms, 0.);
+
+    auto other_stats = get_primitive_cache_stats(primitive::kind::matmul);
+    ASSERT_EQ(other_stats.hits, 0u);
+    ASSERT_EQ(other_stats.misses, 0u);
+    ASSERT_EQ(other_stats.size, 0);
+
+    reset_cache_stats();
+    stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits, 0u);
+    ASSERT_EQ(stats.misses, 0u);
+    ASSERT_EQ(stats.evictions, 0u);
+    ASSERT_EQ(stats.size, 4);
+}
+
+TEST(primitive_cache_test, TestPrewarm) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(8);
+
+    engine eng(get_test_engine_kind(), 0);
+    std::vector<primitive_desc_base> pds;
+    for (int i = 1; i <= 3; i++) {
+        auto md = memory::desc({i, 2, 3, 4}, dt::f32, tag::nchw);
+        pds.emplace_back(eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+                0.f, 0.f));
+    }
+    prewarm_primitive_cache(pds);
+    // The queued primitive descriptors are copies.
+    pds.clear();
+    wait_primitive_cache_prewarm();
+    ASSERT_EQ(get_primitive_cache_size(), 3);
+
+    reset_cache_stats();
+    auto md = memory::desc({2, 2, 3, 4}, dt::f32, tag::nchw);
+    auto relu = eltwise_forward(eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md, 0.f,
+            0.f));
+    auto stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits, 1u);
+    ASSERT_EQ(stats.misses, 0u);
+}
+
+TEST(primitive_cache_test, TestBrgemmKernelSharing) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Brgemm kernels are CPU only.");
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+
+    engine eng(get_test_engine_kind(), 0);
+    auto src_md = memory::desc({64, 64}, dt::f32, tag::ab);
+    auto wei_md = memory::desc({64, 64}, dt::f32, tag::ab);
+    auto dst_md = memory::desc({64, 64}, dt::f32, tag::ab);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    SKIP_IF(std::string(pd.impl_info_str()).find("brg") == std::string::npos,
+            "The implementation is not based on brgemm.");
+    auto mm = matmul(pd);
+
+    // The scratchpad mode misses the primitive cache, while the kernels of
+    // the two primitives are the same.
+    reset_cache_stats();
+    primitive_attr attr;
+    attr.set_scratchpad_mode(scratchpad_mode::user);
+    auto user_scratchpad_pd
+            = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    auto user_scratchpad_mm = matmul(user_scratchpad_pd);
+    ASSERT_EQ(get_primitive_cache_stats().misses, 1u);
+    ASSERT_GT(get_kernel_cache_stats().hits, 0u);
+
+    // The fpmath mode allows fast approximations in the eltwise post-ops, so
+    // the kernels with a different mode are not shared.
+    post_ops ops;
+    ops.append_eltwise(algorithm::eltwise_gelu_erf, 0.f, 0.f);
+    primitive_attr strict_attr;
+    strict_attr.set_post_ops(ops);
+    auto strict_pd
+            = matmul::primitive_desc(eng, src_md, wei_md, dst_md, strict_attr);
+    auto strict_mm = matmul(strict_pd);
+    reset_cache_stats();
+    primitive_attr any_attr = strict_attr;
+    any_attr.set_fpmath_mode(fpmath_mode::any);
+    auto any_pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, any_attr);
+    const std::string any_impl_info = any_pd.impl_info_str();
+    SKIP_IF(any_impl_info.find("brg") == std::string::npos,
+            "The implementation is not based on brgemm.");
+    // On AMX the fpmath mode also enables the bf32 computations, which change
+    // the kernels regardless of the post-ops, so the miss would prove nothing.
+    SKIP_IF(any_impl_info.find("amx") != std::string::npos
+                    || any_impl_info != strict_pd.impl_info_str(),
+            "The fpmath mode changes the implementation.");
+    auto any_mm = matmul(any_pd);
+    ASSERT_GT(get_kernel_cache_stats().misses, 0u);
+}
 #endif
 
 } // namespace dnnl
@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cstring>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -405,4 +408,406 @@ TEST(iface_sparse_test_t, TestSparseMemoryMapUnmap) {
     ASSERT_NO_THROW(mem.unmap_data(mapped_col_indices, 2));
 }
 
+TEST(iface_sparse_test_t, TestGroupedMDSize) {
+    const memory::dim G = 4, M = 10, K = 16;
+    memory::desc md;
+    ASSERT_NO_THROW(md = memory::desc::grouped({M, K}, dt::f32, G, dt::s32));
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::grouped);
+    ASSERT_EQ(md.get_size(0), (size_t)(M * K) * sizeof(float));
+    ASSERT_EQ(md.get_size(1), (size_t)G * sizeof(int32_t));
+
+    // Only 2D tensors are supported.
+    EXPECT_ANY_THROW(memory::desc::grouped({2, M, K}, dt::f32, G, dt::s32));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestGroupedMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu)
+            ? DNNL_GPU_VENDOR != DNNL_VENDOR_INTEL
+            : DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL;
+    if (is_unimplemented) return;
+
+    const memory::dim G = 3, M = 10, K = 24, N = 40;
+    // The second group is empty. On CPU the last two rows belong to no group
+    // and are expected to be zeroed.
+    const bool is_cpu = eng.get_kind() == engine::kind::cpu;
+    std::vector<int32_t> offsets = {4, 4, (int32_t)(is_cpu ? M - 2 : M)};
+    std::vector<float> src(M * K), wei(G * K * N), dst(M * N, -1.f);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = (float)(i % 7) - 3.f;
+    for (size_t i = 0; i < wei.size(); i++)
+        wei[i] = (float)(i % 5) - 2.f;
+
+    const auto src_md = memory::desc::grouped({M, K}, dt::f32, G, dt::s32);
+    const auto dst_md = memory::desc::grouped({M, N}, dt::f32, G, dt::s32);
+    const memory::desc wei_md({G, K, N}, dt::f32, memory::format_tag::abc);
+
+    matmul::primitive_desc pd;
+    ASSERT_NO_THROW(pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+
+    // The buffers are allocated by the library to run on any engine.
+    memory src_mem(src_md, eng), wei_mem(wei_md, eng), dst_mem(dst_md, eng);
+    const auto copy_to = [](memory &mem, int index, const void *data) {
+        void *ptr = mem.map_data<void>(index);
+        std::memcpy(ptr, data, mem.get_desc().get_size(index));
+        mem.unmap_data(ptr, index);
+    };
+    copy_to(src_mem, 0, src.data());
+    copy_to(src_mem, 1, offsets.data());
+    copy_to(wei_mem, 0, wei.data());
+    copy_to(dst_mem, 0, dst.data());
+
+    stream strm(eng);
+    matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                    {DNNL_ARG_DST, dst_mem}});
+    strm.wait();
+
+    std::vector<int32_t> dst_offsets(G, 0);
+    {
+        const float *ptr = dst_mem.map_data<float>(0);
+        std::copy(ptr, ptr + dst.size(), dst.begin());
+        dst_mem.unmap_data((void *)ptr, 0);
+        const int32_t *off_ptr = dst_mem.map_data<int32_t>(1);
+        std::copy(off_ptr, off_ptr + G, dst_offsets.begin());
+        dst_mem.unmap_data((void *)off_ptr, 1);
+    }
+
+    ASSERT_EQ(dst_offsets, offsets);
+    memory::dim m_start = 0;
+    for (memory::dim g = 0; g < G; g++) {
+        for (memory::dim m = m_start; m < offsets[g]; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += src[m * K + k] * wei[(g * K + k) * N + n];
+                ASSERT_EQ(dst[m * N + n], ref) << "m = " << m << " n = " << n;
+            }
+        m_start = offsets[g];
+    }
+    for (memory::dim m = m_start; m < M; m++)
+        for (memory::dim n = 0; n < N; n++)
+            ASSERT_EQ(dst[m * N + n], 0.f) << "m = " << m << " n = " << n;
+}
+
+TEST(iface_sparse_test_t, TestPagedMDSize) {
+    const memory::dim S = 10, D = 16, P = 4, npages = 5;
+    memory::desc md;
+    ASSERT_NO_THROW(md = memory::desc::paged({S, D}, dt::f32, 0, P, npages,
+                            dt::s32));
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::paged);
+    ASSERT_EQ(md.get_size(0), (size_t)(npages * P * D) * sizeof(float));
+    // 3 pages cover 10 rows.
+    ASSERT_EQ(md.get_size(1), (size_t)3 * sizeof(int32_t));
+
+    EXPECT_ANY_THROW(memory::desc::paged({D, S}, dt::f32, 2, P, npages,
+            dt::s32));
+    EXPECT_ANY_THROW(memory::desc::paged({D, S}, dt::f32, 1, 0, npages,
+            dt::s32));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestPagedMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    // Attention with a paged key-value cache of S tokens of size D: the
+    // scores Q * K^T use the keys paged along N and the output scores * V
+    // uses the values paged along K.
+    const memory::dim M = 3, S = 10, D = 24, P = 4, npages = 6;
+    const memory::dim ntable = (S + P - 1) / P;
+    // The pages are stored in the pool in an arbitrary order.
+    std::vector<int32_t> page_table = {4, 1, 3};
+    std::vector<float> pool(npages * P * D);
+    for (size_t i = 0; i < pool.size(); i++)
+        pool[i] = (float)(i % 5) - 2.f;
+    auto cache = [&](memory::dim s, memory::dim d) {
+        return pool[(page_table[s / P] * P + s % P) * D + d];
+    };
+    ASSERT_EQ((memory::dim)page_table.size(), ntable);
+
+    stream strm(eng);
+    for (int paged_dim : {1, 0}) {
+        const memory::dim K = paged_dim == 1 ? D : S;
+        const memory::dim N = paged_dim == 1 ? S : D;
+        std::vector<float> src(M * K), dst(M * N, -1.f);
+        for (size_t i = 0; i < src.size(); i++)
+            src[i] = (float)(i % 7) - 3.f;
+
+        const memory::desc src_md({M, K}, dt::f32, memory::format_tag::ab);
+        const memory::desc dst_md({M, N}, dt::f32, memory::format_tag::ab);
+        const auto wei_md = memory::desc::paged(
+                {K, N}, dt::f32, paged_dim, P, npages, dt::s32);
+
+        matmul::primitive_desc pd;
+        ASSERT_NO_THROW(
+                pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+
+        memory src_mem(src_md, eng, src.data());
+        memory wei_mem(wei_md, eng, {pool.data(), page_table.data()});
+        memory dst_mem(dst_md, eng, dst.data());
+
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                        {DNNL_ARG_DST, dst_mem}});
+        strm.wait();
+
+        for (memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += src[m * K + k]
+                            * (paged_dim == 1 ? cache(n, k) : cache(k, n));
+                ASSERT_EQ(dst[m * N + n], ref)
+                        << "paged_dim = " << paged_dim << " m = " << m
+                        << " n = " << n;
+            }
+    }
+}
+
+TEST(iface_sparse_test_t, TestStructuredMDSize) {
+    const memory::dim K = 16, N = 10;
+    memory::desc md;
+    ASSERT_NO_THROW(md = memory::desc::structured({K, N}, dt::f32, 2, 4));
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::structured);
+    ASSERT_EQ(md.get_size(0), (size_t)(K / 2 * N) * sizeof(float));
+    ASSERT_EQ(md.get_size(1), (size_t)(K / 4 * N) * sizeof(uint8_t));
+
+    memory::desc md2;
+    ASSERT_NO_THROW(md2 = memory::desc::structured({K, N}, dt::f32, 1, 4));
+    ASSERT_NE(md, md2);
+
+    // K is not a multiple of m.
+    EXPECT_ANY_THROW(memory::desc::structured({K + 2, N}, dt::f32, 2, 4));
+    // n must be less than m.
+    EXPECT_ANY_THROW(memory::desc::structured({K, N}, dt::f32, 4, 4));
+    // The bitmask of a group does not fit into u8.
+    EXPECT_ANY_THROW(memory::desc::structured({K, N}, dt::f32, 2, 16));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestStructuredMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    // Weights pruned with 2:4 sparsity: in each group of 4 rows of a column
+    // only 2 rows (or less) are non-zero.
+    const memory::dim M = 3, K = 32, N = 40;
+    std::vector<float> wei(K * N), src(M * K), dst(M * N, -1.f);
+    for (memory::dim k = 0; k < K; k++)
+        for (memory::dim n = 0; n < N; n++) {
+            const memory::dim i = k % 4, shift = (k / 4 + n) % 4;
+            const bool kept = i == shift || i == (shift + 1 + n % 3) % 4;
+            wei[k * N + n] = kept ? (float)((k + n) % 5) - 2.f : 0.f;
+        }
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = (float)(i % 7) - 3.f;
+
+    const memory::desc src_md({M, K}, dt::f32, memory::format_tag::ab);
+    const memory::desc dense_wei_md({K, N}, dt::f32, memory::format_tag::ab);
+    const memory::desc dst_md({M, N}, dt::f32, memory::format_tag::ab);
+    const auto wei_md = memory::desc::structured({K, N}, dt::f32, 2, 4);
+
+    stream strm(eng);
+    memory dense_wei_mem(dense_wei_md, eng, wei.data());
+    memory wei_mem(wei_md, eng);
+    ASSERT_NO_THROW(reorder(dense_wei_mem, wei_mem)
+                            .execute(strm, dense_wei_mem, wei_mem));
+    strm.wait();
+
+    matmul::primitive_desc pd;
+    ASSERT_NO_THROW(pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+
+    memory src_mem(src_md, eng, src.data());
+    memory dst_mem(dst_md, eng, dst.data());
+    matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                    {DNNL_ARG_DST, dst_mem}});
+    strm.wait();
+
+    for (memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float ref = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                ref += src[m * K + k] * wei[k * N + n];
+            ASSERT_EQ(dst[m * N + n], ref) << "m = " << m << " n = " << n;
+        }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestSparseWeightsMatmulZeroK) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    // Without K the result is zero for both the structured weights and the
+    // weights paged along K, which have no pages.
+    const memory::dim M = 3, K = 0, N = 40;
+    const memory::desc src_md({M, K}, dt::f32, memory::format_tag::ab);
+    const memory::desc dst_md({M, N}, dt::f32, memory::format_tag::ab);
+    const std::vector<memory::desc> wei_mds {
+            memory::desc::structured({K, N}, dt::f32, 2, 4),
+            memory::desc::paged({K, N}, dt::f32, 0, 4, 2, dt::s32)};
+
+    stream strm(eng);
+    for (const auto &wei_md : wei_mds) {
+        matmul::primitive_desc pd;
+        ASSERT_NO_THROW(
+                pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+
+        std::vector<float> dst(M * N, -1.f);
+        memory src_mem(src_md, eng);
+        memory wei_mem(wei_md, eng);
+        memory dst_mem(dst_md, eng, dst.data());
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                        {DNNL_ARG_DST, dst_mem}});
+        strm.wait();
+
+        for (memory::dim i = 0; i < M * N; i++)
+            ASSERT_EQ(dst[i], 0.f)
+                    << "encoding = " << (int)wei_md.get_sparse_encoding()
+                    << " i = " << i;
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestSDDMM) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    // Block-sparse attention scores: only the entries of Q * K^T given by the
+    // pattern of dst are computed. The keys are the transposed weights.
+    const memory::dim M = 4, K = 8, N = 6;
+    std::vector<float> q(M * K), k(N * K);
+    for (size_t i = 0; i < q.size(); i++)
+        q[i] = (float)(i % 7) - 3.f;
+    for (size_t i = 0; i < k.size(); i++)
+        k[i] = (float)(i % 5) - 2.f;
+
+    // The pattern of dst, the last row is empty.
+    std::vector<int32_t> rows = {0, 0, 1, 2, 2, 2};
+    std::vector<int32_t> cols = {1, 4, 0, 0, 3, 5};
+    std::vector<int32_t> pointers = {0, 2, 3, 6, 6};
+    const memory::dim nnz = (memory::dim)cols.size();
+
+    const memory::desc src_md({M, K}, dt::f32, memory::format_tag::ab);
+    const memory::desc wei_md({K, N}, dt::f32, memory::format_tag::ba);
+    memory src_mem(src_md, eng, q.data());
+    memory wei_mem(wei_md, eng, k.data());
+
+    stream strm(eng);
+    for (auto encoding :
+            {memory::sparse_encoding::csr, memory::sparse_encoding::coo}) {
+        const bool is_csr = encoding == memory::sparse_encoding::csr;
+        const auto dst_md = is_csr
+                ? memory::desc::csr({M, N}, dt::f32, nnz, dt::s32, dt::s32)
+                : memory::desc::coo({M, N}, dt::f32, nnz, dt::s32);
+
+        matmul::primitive_desc pd;
+        ASSERT_NO_THROW(
+                pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+
+        std::vector<float> values(nnz, -1.f);
+        memory dst_mem = is_csr
+                ? memory(dst_md, eng,
+                        {values.data(), cols.data(), pointers.data()})
+                : memory(dst_md, eng,
+                        {values.data(), rows.data(), cols.data()});
+
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                        {DNNL_ARG_DST, dst_mem}});
+        strm.wait();
+
+        for (memory::dim i = 0; i < nnz; i++) {
+            float ref = 0.f;
+            for (memory::dim kk = 0; kk < K; kk++)
+                ref += q[rows[i] * K + kk] * k[cols[i] * K + kk];
+            ASSERT_EQ(values[i], ref) << "is_csr = " << is_csr << " i = " << i;
+        }
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestSparseEncodingReorder) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    // A tensor with an empty row, encoded with two spare entries.
+    const memory::dim M = 5, N = 7;
+    std::vector<float> dense(M * N, 0.f);
+    memory::dim dense_nnz = 0;
+    for (memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            if (m == 2 || (m * N + n) % 3 != 0) continue;
+            dense[m * N + n] = (float)(m + n + 1);
+            dense_nnz++;
+        }
+    // The spare entries are decoded onto the last element, which is not zero.
+    ASSERT_NE(dense[M * N - 1], 0.f);
+    const memory::dim nnz = dense_nnz + 2;
+
+    const memory::desc dense_md({M, N}, dt::f32, memory::format_tag::ab);
+    memory dense_mem(dense_md, eng, dense.data());
+
+    stream strm(eng);
+    for (auto encoding :
+            {memory::sparse_encoding::csr, memory::sparse_encoding::coo}) {
+        const bool is_csr = encoding == memory::sparse_encoding::csr;
+        const auto sparse_md = is_csr
+                ? memory::desc::csr({M, N}, dt::f32, nnz, dt::s32, dt::s32)
+                : memory::desc::coo({M, N}, dt::f32, nnz, dt::s32);
+
+        std::vector<float> values(nnz, -1.f);
+        std::vector<int32_t> buf_1(nnz, -1), buf_2(is_csr ? M + 1 : nnz, -1);
+        memory sparse_mem(sparse_md, eng,
+                {values.data(), buf_1.data(), buf_2.data()});
+        ASSERT_NO_THROW(reorder(dense_mem, sparse_mem)
+                                .execute(strm, dense_mem, sparse_mem));
+        strm.wait();
+
+        // The spare entries are zeros at the last element.
+        const std::vector<int32_t> &cols = is_csr ? buf_1 : buf_2;
+        for (memory::dim i = 0; i < nnz; i++) {
+            const memory::dim m = is_csr ? 0 : buf_1[i];
+            if (i >= dense_nnz) {
+                ASSERT_EQ(values[i], 0.f);
+                ASSERT_EQ(cols[i], N - 1);
+            } else if (!is_csr) {
+                ASSERT_EQ(values[i], dense[m * N + cols[i]]) << "i = " << i;
+            }
+        }
+        if (is_csr) {
+            ASSERT_EQ(buf_2[0], 0);
+            ASSERT_EQ(buf_2[M], nnz);
+            for (memory::dim m = 0; m < M; m++)
+                for (int32_t i = buf_2[m]; i < buf_2[m + 1]; i++) {
+                    if (i < dense_nnz) {
+                        ASSERT_EQ(values[i], dense[m * N + cols[i]])
+                                << "m = " << m << " i = " << i;
+                    }
+                }
+        }
+
+        std::vector<float> decoded(M * N, -1.f);
+        memory decoded_mem(dense_md, eng, decoded.data());
+        ASSERT_NO_THROW(reorder(sparse_mem, decoded_mem)
+                                .execute(strm, sparse_mem, decoded_mem));
+        strm.wait();
+        for (memory::dim i = 0; i < M * N; i++)
+            ASSERT_EQ(decoded[i], dense[i]) << "is_csr = " << is_csr;
+    }
+}
+
 } // namespace dnnl
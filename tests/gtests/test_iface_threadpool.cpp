@@ -71,4 +71,52 @@ TEST_F(threadpool_test_t, TestMaxConcurrencyConcurrent) {
         ASSERT_EQ(r, dnnl_success);
 }
 
+// Forwards the work to the testing threadpool and requests non-blocking
+// primitive execution.
+struct non_blocking_threadpool_t : public threadpool_interop::threadpool_iface {
+    non_blocking_threadpool_t(threadpool_interop::threadpool_iface *tp)
+        : tp_(tp) {}
+
+    int get_num_threads() const override { return tp_->get_num_threads(); }
+    bool get_in_parallel() const override { return tp_->get_in_parallel(); }
+    void parallel_for(
+            int n, const std::function<void(int, int)> &fn) override {
+        tp_->parallel_for(n, fn);
+    }
+    uint64_t get_flags() const override {
+        return tp_->get_flags() | NON_BLOCKING_EXECUTE;
+    }
+
+private:
+    threadpool_interop::threadpool_iface *tp_;
+};
+
+TEST_F(threadpool_test_t, TestNonBlockingExecute) {
+    engine eng(engine::kind::cpu, 0);
+    non_blocking_threadpool_t tp(testing::get_threadpool());
+    auto strm = threadpool_interop::make_stream(eng, &tp);
+
+    const memory::dim n = 1024;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    memory mem(md, eng);
+    float *ptr = static_cast<float *>(mem.get_data_handle());
+    for (memory::dim i = 0; i < n; i++)
+        ptr[i] = 0.f;
+
+    const int n_execs = 4;
+    {
+        // The enqueued executions keep the primitive alive.
+        auto pd = eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_linear, md,
+                md, 1.f, 1.f);
+        eltwise_forward prim(pd);
+        for (int i = 0; i < n_execs; i++)
+            prim.execute(strm, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+    }
+    strm.wait();
+
+    for (memory::dim i = 0; i < n; i++)
+        ASSERT_EQ(ptr[i], static_cast<float>(n_execs));
+}
+
 } // namespace dnnl
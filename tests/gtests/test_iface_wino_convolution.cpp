@@ -38,6 +38,8 @@ protected:
         bool wino_supported = false;
         bool backward_supported = false;
     } input_f32, input_f16, input_int8;
+    // The x64 CPU implementation handles arbitrary padding.
+    bool x64_cpu_wino_supported = false;
 
     void SetUp() override {
         input_f32.dat_dt = data_type::f32;
@@ -53,6 +55,12 @@ protected:
         const bool is_gpu = get_test_engine_kind() == engine::kind::gpu;
         input_f32.wino_supported = is_gpu;
         input_f16.wino_supported = is_gpu;
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        const bool is_cpu = get_test_engine_kind() == engine::kind::cpu;
+        input_f32.wino_supported
+                |= is_cpu && dnnl::mayiuse(cpu_isa::avx512_core);
+        x64_cpu_wino_supported = input_f32.wino_supported && is_cpu;
+#endif
 #elif DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
 #if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_THREADPOOL
         const bool is_cpu = get_test_engine_kind() == engine::kind::cpu;
@@ -112,7 +120,8 @@ TEST_F(wino_conv_test_t, TestLargePadding) {
         memory::desc dst_md {{1, 32, 9, 9}, input.dat_dt, tag::any};
 
         bool large_pad_is_supported
-                = (get_test_engine_kind() == engine::kind::gpu);
+                = (get_test_engine_kind() == engine::kind::gpu)
+                || x64_cpu_wino_supported;
         if (input.wino_supported && large_pad_is_supported) {
             EXPECT_NO_THROW(convolution_forward::primitive_desc(eng,
                     prop_kind::forward, algorithm::convolution_winograd, src_md,
@@ -143,4 +152,92 @@ TEST_F(wino_conv_test_t, TestUnsupportedKernel) {
     }
 }
 
+TEST_F(wino_conv_test_t, TestConstantWeights) {
+    if (!x64_cpu_wino_supported) return;
+
+    // The transformed weights are cached with constant weights, so the
+    // results must follow the weights memory passed to every execution.
+    const memory::dim N = 1, IC = 16, OC = 32, H = 8, W = 8;
+    const memory::dims src_dims {N, IC, H, W}, wei_dims {OC, IC, 3, 3};
+    const memory::dims dst_dims {N, OC, H, W};
+    // Small integer values keep the transformed data exact in bf16.
+    std::vector<float> src(N * IC * H * W), wei0(OC * IC * 9), wei1(wei0);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 5) - 2.f;
+    for (size_t i = 0; i < wei0.size(); i++) {
+        wei0[i] = static_cast<float>(i % 3) - 1.f;
+        wei1[i] = static_cast<float>(i % 7 == 0) - static_cast<float>(i % 2);
+    }
+
+    auto ref = [&](const std::vector<float> &wei, memory::dim oc,
+                       memory::dim oh, memory::dim ow) {
+        float acc = 0.f;
+        for_(memory::dim ic = 0; ic < IC; ic++)
+        for_(memory::dim kh = 0; kh < 3; kh++)
+        for (memory::dim kw = 0; kw < 3; kw++) {
+            const memory::dim ih = oh + kh - 1, iw = ow + kw - 1;
+            if (ih < 0 || ih >= H || iw < 0 || iw >= W) continue;
+            acc += src[(ic * H + ih) * W + iw]
+                    * wei[((oc * IC + ic) * 3 + kh) * 3 + kw];
+        }
+        return acc;
+    };
+
+    stream strm(eng);
+    for (auto dt : {data_type::f32, data_type::bf16}) {
+        if (unsupported_data_type(dt)) continue;
+        primitive_attr attr;
+        attr.set_constant_weights(true);
+
+        memory::desc src_md {src_dims, dt, tag::nhwc};
+        memory::desc wei_md {wei_dims, dt, tag::oihw};
+        memory::desc dst_md {dst_dims, data_type::f32, tag::nhwc};
+        convolution_forward::primitive_desc pd;
+        try {
+            pd = convolution_forward::primitive_desc(eng,
+                    prop_kind::forward_inference,
+                    algorithm::convolution_winograd, src_md, wei_md, dst_md,
+                    {1, 1}, {1, 1}, {1, 1}, attr);
+        } catch (const dnnl::error &) {
+            // bf16 requires the ISA with the bf16 instructions.
+            continue;
+        }
+        convolution_forward conv(pd);
+
+        auto to_dt = [&](const memory::desc &md, const memory::dims &dims,
+                             tag f32_tag, std::vector<float> &data) {
+            memory f32_mem({dims, data_type::f32, f32_tag}, eng, data.data());
+            memory mem(md, eng);
+            reorder(f32_mem, mem).execute(strm, f32_mem, mem);
+            strm.wait();
+            return mem;
+        };
+        std::vector<float> src_nchw(src);
+        auto src_mem = to_dt(src_md, src_dims, tag::nchw, src_nchw);
+        auto wei0_mem = to_dt(wei_md, wei_dims, tag::oihw, wei0);
+        auto wei1_mem = to_dt(wei_md, wei_dims, tag::oihw, wei1);
+        memory dst_mem(dst_md, eng);
+
+        const std::vector<std::pair<const std::vector<float> *, memory>> runs {
+                {&wei0, wei0_mem}, {&wei1, wei1_mem}, {&wei0, wei0_mem}};
+        for (const auto &run : runs) {
+            const auto *w = run.first;
+            conv.execute(strm,
+                    {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, run.second},
+                            {DNNL_ARG_DST, dst_mem}});
+            strm.wait();
+            auto d = map_memory<float>(dst_mem);
+            for_(memory::dim oh = 0; oh < H; oh++)
+            for_(memory::dim ow = 0; ow < W; ow++)
+            for (memory::dim oc = 0; oc < OC; oc++) {
+                const float r = ref(*w, oc, oh, ow);
+                ASSERT_NEAR(d[(oh * W + ow) * OC + oc], r,
+                        1e-4f * std::max(1.f, std::fabs(r)))
+                        << "dt = " << static_cast<int>(dt) << " oc = " << oc
+                        << " oh = " << oh << " ow = " << ow;
+            }
+        }
+    }
+}
+
 } // namespace dnnl
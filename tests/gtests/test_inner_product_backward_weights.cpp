@@ -540,4 +540,69 @@ INSTANTIATE_TEST_SUITE_P(TestInnerProductBackwardWeights3D,
                         memory::format_tag::oidhw, memory::format_tag::x,
                         memory::format_tag::nc,
                         EXPAND_SIZES_3D(2, 16, 48, 3, 3, 3)}));
+
+// A sum post-op adds the gradients to the values of the diff weights and the
+// diff bias.
+TEST(inner_product_test_float, TestsInnerProductAccumulation) {
+    using tag = memory::format_tag;
+    const test_inner_product_descr_t ipd = {64, 96, 45, 1, 1, 1};
+    const auto dt = memory::data_type::f32;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    auto src_md = create_md({ipd.mb, ipd.ic}, dt, tag::any);
+    auto diff_weights_md = create_md({ipd.oc, ipd.ic}, dt, tag::any);
+    auto diff_bias_md = create_md({ipd.oc}, dt, tag::x);
+    auto diff_dst_md = create_md({ipd.mb, ipd.oc}, dt, tag::nc);
+
+    auto fwd_pd = inner_product_forward::primitive_desc(eng,
+            prop_kind::forward, src_md, diff_weights_md, diff_dst_md);
+
+    post_ops ops;
+    ops.append_sum();
+    primitive_attr attr;
+    attr.set_post_ops(ops);
+    auto pd = inner_product_backward_weights::primitive_desc(eng, src_md,
+            diff_weights_md, diff_bias_md, diff_dst_md, fwd_pd, attr, true);
+    SKIP_IF(!pd, "Accumulation is not supported on this platform.");
+
+    auto src = test::make_memory(pd.src_desc(), eng);
+    auto diff_dst = test::make_memory(pd.diff_dst_desc(), eng);
+    auto diff_weights = test::make_memory(pd.diff_weights_desc(), eng);
+    auto diff_weights_ref = test::make_memory(pd.diff_weights_desc(), eng);
+    auto diff_bias = test::make_memory(pd.diff_bias_desc(), eng);
+    auto diff_bias_ref = test::make_memory(pd.diff_bias_desc(), eng);
+
+    const auto nelems = [](const memory &m) {
+        return m.get_desc().get_size() / sizeof(float);
+    };
+    fill_data<float>(nelems(src), src);
+    fill_data<float>(nelems(diff_dst), diff_dst);
+    fill_data<float>(nelems(diff_weights), diff_weights);
+    fill_data<float>(nelems(diff_bias), diff_bias);
+    check_zero_tail<float>(1, src);
+    check_zero_tail<float>(1, diff_weights);
+
+    // The references are the gradients plus the initial values.
+    compute_ref_inner_product_bwd_weights<float>(
+            2, ipd, src, diff_dst, diff_weights_ref);
+    compute_ref_inner_product_bwd_bias<float>(ipd, diff_dst, diff_bias_ref);
+    for (const auto &p : {std::make_pair(diff_weights, diff_weights_ref),
+                 std::make_pair(diff_bias, diff_bias_ref)}) {
+        auto init = map_memory<float>(p.first);
+        auto ref = map_memory<float>(p.second);
+        for (size_t i = 0; i < nelems(p.first); i++)
+            ref[i] += init[i];
+    }
+
+    inner_product_backward_weights(pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_DIFF_DST, diff_dst},
+                    {DNNL_ARG_DIFF_WEIGHTS, diff_weights},
+                    {DNNL_ARG_DIFF_BIAS, diff_bias}});
+    strm.wait();
+
+    compare_data<float>(diff_weights_ref, diff_weights);
+    compare_data<float>(diff_bias_ref, diff_bias);
+}
 } // namespace dnnl
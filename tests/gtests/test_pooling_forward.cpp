@@ -523,6 +523,24 @@ INSTANTIATE_TEST_SUITE_P(TestPoolingForwardMaxS8, pooling_test_s8,
                         EXPAND_SIZES_2D(16, 64, 32, 32, 16, 16, 3, 3, 2, 2, 0,
                                 0, 2, 2)}));
 
+INSTANTIATE_TEST_SUITE_P(TestPoolingForwardGlobalS8, pooling_test_s8,
+        ::testing::Values(
+                pool_test_params_t {prop_kind::forward_inference,
+                        algorithm::pooling_max, memory::format_tag::nhwc,
+                        memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(1, 96, 56, 56, 1, 1, 56, 56, 0, 0, 0,
+                                0, 1, 1)},
+                pool_test_params_t {prop_kind::forward_inference,
+                        algorithm::pooling_avg_exclude_padding,
+                        memory::format_tag::nhwc, memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(1, 96, 56, 56, 1, 1, 56, 56, 0, 0, 0,
+                                0, 1, 1)},
+                pool_test_params_t {prop_kind::forward_inference,
+                        algorithm::pooling_avg_include_padding,
+                        memory::format_tag::nhwc, memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(
+                                2, 200, 7, 7, 1, 1, 7, 7, 0, 0, 0, 0, 1, 1)}));
+
 INSTANTIATE_TEST_SUITE_P(TestPoolingForwardAvgS8, pooling_test_s8,
         ::testing::Values(
                 pool_test_params_t {prop_kind::forward_inference,
@@ -1142,6 +1160,24 @@ CPU_INSTANTIATE_TEST_SUITE_P(TestPoolingForwardMaxNHWC, pooling_test_float,
                 memory::format_tag::nhwc,
                 EXPAND_SIZES_2D(2, 4, 4, 4, 2, 2, 3, 3, 0, 0, 0, 0, 1, 1)}));
 
+CPU_INSTANTIATE_TEST_SUITE_P(TestPoolingForwardGlobalNHWC, pooling_test_float,
+        ::testing::Values(
+                pool_test_params_float {prop_kind::forward_inference,
+                        algorithm::pooling_max, memory::format_tag::nhwc,
+                        memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(
+                                2, 64, 7, 7, 1, 1, 7, 7, 0, 0, 0, 0, 1, 1)},
+                pool_test_params_float {prop_kind::forward_inference,
+                        algorithm::pooling_avg_exclude_padding,
+                        memory::format_tag::nhwc, memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(
+                                2, 64, 7, 7, 1, 1, 7, 7, 0, 0, 0, 0, 1, 1)},
+                pool_test_params_float {prop_kind::forward_inference,
+                        algorithm::pooling_avg_include_padding,
+                        memory::format_tag::nhwc, memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(
+                                3, 19, 5, 3, 1, 1, 5, 3, 0, 0, 0, 0, 1, 1)}));
+
 CPU_INSTANTIATE_TEST_SUITE_P(TestPoolingForwardMaxBlocked, pooling_test_float,
         ::testing::Values(
                 pool_test_params_float {prop_kind::forward_training,
@@ -2198,4 +2234,70 @@ CPU_INSTANTIATE_TEST_SUITE_P(TestPoolingAsymmDilation, pooling_test_float,
 
 GPU_INST_TEST_CASE(pooling_test_float);
 
+class pooling_adaptive_test_t : public ::testing::Test {};
+
+HANDLE_EXCEPTIONS_FOR_TEST(pooling_adaptive_test_t, TestAdaptivePooling) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Adaptive pooling is only supported on CPU engine");
+    engine eng = get_test_engine();
+    stream strm = make_stream(eng);
+
+    // The windows take 3 or 4 rows and 3 columns, and overlap.
+    const memory::dim N = 2, C = 70, IH = 11, IW = 7, OH = 4, OW = 3;
+    const auto start = [](memory::dim o, memory::dim O, memory::dim I) {
+        return o * I / O;
+    };
+    const auto end = [](memory::dim o, memory::dim O, memory::dim I) {
+        return ((o + 1) * I + O - 1) / O;
+    };
+
+    for_(auto alg : {algorithm::pooling_adaptive_max,
+                 algorithm::pooling_adaptive_avg})
+    for (auto tag : {memory::format_tag::nhwc, memory::format_tag::nchw}) {
+        memory::desc src_md({N, C, IH, IW}, memory::data_type::f32, tag);
+        memory::desc dst_md({N, C, OH, OW}, memory::data_type::f32, tag);
+        auto pd = pooling_forward::primitive_desc(
+                eng, prop_kind::forward_inference, alg, src_md, dst_md);
+        ASSERT_EQ(pd.get_kernel(), memory::dims({4, 3}));
+
+        // Adaptive pooling has no backward propagation.
+        EXPECT_ANY_THROW(pooling_backward::primitive_desc(eng, alg, src_md,
+                dst_md, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {0, 0}, pd));
+
+        auto src = test::make_memory(src_md, eng);
+        auto dst = test::make_memory(dst_md, eng);
+        fill_data<float>(N * C * IH * IW, src, 1., true);
+
+        pooling_forward(pd).execute(
+                strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        auto src_data = map_memory<float>(src);
+        auto dst_data = map_memory<float>(dst);
+        const auto src_str = src_md.get_strides();
+        const auto dst_str = dst_md.get_strides();
+        for_(memory::dim n = 0; n < N; n++)
+        for_(memory::dim c = 0; c < C; c++)
+        for_(memory::dim oh = 0; oh < OH; oh++)
+        for (memory::dim ow = 0; ow < OW; ow++) {
+            const bool is_max = alg == algorithm::pooling_adaptive_max;
+            float ref = is_max ? -std::numeric_limits<float>::infinity() : 0;
+            for_(memory::dim ih = start(oh, OH, IH); ih < end(oh, OH, IH);
+                    ih++)
+            for (memory::dim iw = start(ow, OW, IW); iw < end(ow, OW, IW);
+                    iw++) {
+                const float s = src_data[n * src_str[0] + c * src_str[1]
+                        + ih * src_str[2] + iw * src_str[3]];
+                ref = is_max ? std::max(ref, s) : ref + s;
+            }
+            if (!is_max)
+                ref /= (end(oh, OH, IH) - start(oh, OH, IH))
+                        * (end(ow, OW, IW) - start(ow, OW, IW));
+            const float out = dst_data[n * dst_str[0] + c * dst_str[1]
+                    + oh * dst_str[2] + ow * dst_str[3]];
+            ASSERT_NEAR(out, ref, 1e-6);
+        }
+    }
+}
+
 } // namespace dnnl
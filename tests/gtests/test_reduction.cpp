@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -219,4 +222,101 @@ INST_TEST_CASE(reduction_test_f16)
 INST_TEST_CASE(reduction_test_s8)
 INST_TEST_CASE(reduction_test_u8)
 
+class reduction_arg_test_t : public ::testing::Test {
+protected:
+    // Checks the indices against a sort of every row of `src_dims`, the
+    // innermost dimension of which is reduced to `k` indices.
+    void check(algorithm alg, const memory::dims &src_dims, memory::dim k) {
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        memory::dims dst_dims = src_dims;
+        dst_dims.back() = k;
+        const memory::dim C = src_dims.back();
+        memory::dim rows = 1;
+        for (size_t d = 0; d + 1 < src_dims.size(); d++)
+            rows *= src_dims[d];
+
+        memory::desc src_md(src_dims, memory::data_type::f32, plain(src_dims));
+        memory::desc dst_md(dst_dims, memory::data_type::s32, plain(dst_dims));
+        auto pd = reduction::primitive_desc(eng, alg, src_md, dst_md, 0, 0);
+
+        auto src = test::make_memory(src_md, eng);
+        auto dst = test::make_memory(dst_md, eng);
+        // Values repeat, so that the ties are resolved by the smaller index.
+        std::vector<float> vals(rows * C);
+        for (memory::dim i = 0; i < rows * C; i++)
+            vals[i] = (float)((i * 7919) % 1021) * 0.5f;
+        {
+            auto src_ptr = map_memory<float>(src);
+            for (memory::dim i = 0; i < rows * C; i++)
+                src_ptr[i] = vals[i];
+        }
+
+        reduction(pd).execute(
+                strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        const bool is_min = alg == algorithm::reduction_arg_min;
+        auto dst_ptr = map_memory<int32_t>(dst);
+        for (memory::dim r = 0; r < rows; r++) {
+            const float *row = vals.data() + r * C;
+            std::vector<int32_t> idx(C);
+            for (memory::dim c = 0; c < C; c++)
+                idx[c] = (int32_t)c;
+            std::stable_sort(idx.begin(), idx.end(), [&](int32_t a, int32_t b) {
+                return is_min ? row[a] < row[b] : row[a] > row[b];
+            });
+            for (memory::dim i = 0; i < k; i++)
+                ASSERT_EQ(dst_ptr[r * k + i], idx[i]);
+        }
+    }
+
+    static memory::format_tag plain(const memory::dims &dims) {
+        return dims.size() == 2 ? tag::ab : tag::abc;
+    }
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(reduction_arg_test_t, TestArgMaxMin) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Arg reductions are only supported on CPU engine");
+    for (auto alg : {algorithm::reduction_arg_max,
+                 algorithm::reduction_arg_min}) {
+        check(alg, {2, 3, 17}, 1);
+        check(alg, {4, 1000}, 1);
+        // A single long row is split between threads.
+        check(alg, {1, 100000}, 1);
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(reduction_arg_test_t, TestTopK) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Arg reductions are only supported on CPU engine");
+    check(algorithm::reduction_arg_max, {3, 1, 64}, 5);
+    check(algorithm::reduction_arg_max, {1, 50000}, 40);
+    check(algorithm::reduction_arg_min, {2, 9}, 9);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(reduction_arg_test_t, TestInvalidArguments) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Arg reductions are only supported on CPU engine");
+    using dt = memory::data_type;
+    auto eng = get_test_engine();
+    const auto alg_max = algorithm::reduction_arg_max;
+    memory::desc src_md({2, 16}, dt::f32, tag::ab);
+
+    // Indices are s32
+    memory::desc f32_dst_md({2, 1}, dt::f32, tag::ab);
+    EXPECT_ANY_THROW(reduction::primitive_desc(
+            eng, alg_max, src_md, f32_dst_md, 0, 0));
+    // Top-k is only supported for a single reduced dimension
+    memory::desc top_k_2d_md({1, 4}, dt::s32, tag::ab);
+    EXPECT_ANY_THROW(reduction::primitive_desc(
+            eng, alg_max, src_md, top_k_2d_md, 0, 0));
+    // Top-k is only supported for arg reductions
+    memory::desc top_k_md({2, 4}, dt::f32, tag::ab);
+    EXPECT_ANY_THROW(reduction::primitive_desc(
+            eng, algorithm::reduction_max, src_md, top_k_md, 0, 0));
+}
+
 } // namespace dnnl
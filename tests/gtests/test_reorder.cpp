@@ -411,6 +411,25 @@ GPU_INSTANTIATE_TEST_SUITE_P(weights_1D, reorder_simple_test_t_f32_f32,
                 cfg_f32 {fmt::goiw, fmt::gIOw16i16o, {8, 32, 48, 7}},
                 cfg_f32 {fmt::gIOw16i16o, fmt::goiw, {8, 32, 48, 7}}));
 
+CPU_INSTANTIATE_TEST_SUITE_P(LargeTranspose, reorder_simple_test_t_f32_f32,
+        ::testing::Values(cfg_f32 {fmt::ab, fmt::ba, {1030, 1100}},
+                cfg_f32 {fmt::abc, fmt::acb, {3, 700, 530}},
+                cfg_f32 {fmt::nchw, fmt::nhwc, {2, 300, 40, 50}},
+                cfg_f32 {fmt::nhwc, fmt::nchw, {2, 300, 40, 50}}));
+
+CPU_INSTANTIATE_TEST_SUITE_P(LargeTranspose, reorder_simple_test_t_s8_s8,
+        ::testing::Values(cfg_s8 {fmt::ab, fmt::ba, {1500, 1700}}));
+
+// Reorders which differ only in outer dimensions may share a kernel.
+CPU_INSTANTIATE_TEST_SUITE_P(SharedKernel, reorder_simple_test_t_f32_f32,
+        ::testing::Values(cfg_f32 {fmt::nchw, fmt::nChw16c, {1, 64, 7, 7}},
+                cfg_f32 {fmt::nchw, fmt::nChw16c, {3, 64, 7, 7}},
+                cfg_f32 {fmt::nchw, fmt::nChw16c, {8, 64, 7, 7}},
+                cfg_f32 {fmt::nchw, fmt::nChw16c, {1, 20, 7, 7}},
+                cfg_f32 {fmt::nchw, fmt::nChw16c, {5, 20, 7, 7}},
+                cfg_f32 {fmt::nChw16c, fmt::nhwc, {2, 20, 5, 5}},
+                cfg_f32 {fmt::nChw16c, fmt::nhwc, {6, 20, 5, 5}}));
+
 GPU_INSTANTIATE_TEST_SUITE_P(PaddedWeights, reorder_simple_test_t_f32_f32,
         ::testing::Values(cfg_f32 {fmt::oihw, fmt::IOhw16i16o, {17, 23, 2, 1}},
                 cfg_f32 {fmt::goihw, fmt::gOIhw16o16i, {2, 17, 23, 1, 2}}));
@@ -501,4 +501,107 @@ INSTANTIATE_TEST_SUITE_P(TestResampleForwardBlockedNN, resampling_test_float,
                         memory::format_tag::nCdhw16c,
                         EXPAND_SIZES_3D(
                                 5, 5, 5, 10, 15, 10, 5, 7, 2.f, 0.5f, 0.5f)}));
+
+class resampling_filter_test_t : public ::testing::Test {};
+
+HANDLE_EXCEPTIONS_FOR_TEST(resampling_filter_test_t, TestCubicAndAntialias) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Filter resampling is only supported on CPU engine");
+    engine eng = get_test_engine();
+    stream strm = make_stream(eng);
+
+    // The height is downsampled and the width upsampled.
+    const memory::dim N = 2, C = 35, IH = 13, IW = 9, OH = 5, OW = 20;
+
+    // Returns the source points and weights of a destination point.
+    using taps_t = std::vector<std::pair<memory::dim, float>>;
+    const auto cubic_taps = [](memory::dim o, memory::dim O, memory::dim I) {
+        const auto cubic = [](float t) {
+            const float a = -0.75f;
+            t = std::fabs(t);
+            if (t <= 1.f) return ((a + 2.f) * t - (a + 3.f)) * t * t + 1.f;
+            if (t < 2.f) return ((a * t - 5.f * a) * t + 8.f * a) * t - 4.f * a;
+            return 0.f;
+        };
+        const float x = linear_map(o, O, I);
+        const float x0 = std::floor(x);
+        const float t = x - x0;
+        const float w[4] = {cubic(t + 1.f), cubic(t), cubic(1.f - t),
+                cubic(2.f - t)};
+        taps_t taps;
+        for (int k = 0; k < 4; k++) {
+            const memory::dim i = (memory::dim)x0 - 1 + k;
+            taps.emplace_back(
+                    std::min(std::max(i, memory::dim(0)), I - 1), w[k]);
+        }
+        return taps;
+    };
+    const auto antialias_taps
+            = [](memory::dim o, memory::dim O, memory::dim I) {
+                  const float scale = (float)I / O;
+                  const float support = std::max(scale, 1.f);
+                  const float center = (o + 0.5f) * scale;
+                  const memory::dim lo = std::max(
+                          (memory::dim)(center - support + 0.5f),
+                          memory::dim(0));
+                  const memory::dim hi = std::min(
+                          (memory::dim)(center + support + 0.5f), I);
+                  taps_t taps;
+                  float total = 0.f;
+                  for (memory::dim i = lo; i < hi; i++) {
+                      const float d = (i - center + 0.5f) / support;
+                      taps.emplace_back(i, std::max(0.f, 1.f - std::fabs(d)));
+                      total += taps.back().second;
+                  }
+                  for (auto &tap : taps)
+                      tap.second /= total;
+                  return taps;
+              };
+
+    for_(auto alg : {algorithm::resampling_cubic,
+                 algorithm::resampling_linear_antialias})
+    for (auto tag : {memory::format_tag::nhwc, memory::format_tag::nchw}) {
+        memory::desc src_md({N, C, IH, IW}, memory::data_type::f32, tag);
+        memory::desc dst_md({N, C, OH, OW}, memory::data_type::f32, tag);
+        auto pd = resampling_forward::primitive_desc(
+                eng, prop_kind::forward_inference, alg, src_md, dst_md);
+
+        // The filter algorithms have no backward propagation.
+        EXPECT_ANY_THROW(resampling_backward::primitive_desc(
+                eng, alg, src_md, dst_md, pd));
+
+        auto src = test::make_memory(src_md, eng);
+        auto dst = test::make_memory(dst_md, eng);
+        fill_data<float>(N * C * IH * IW, src, 1., true);
+
+        resampling_forward(pd).execute(
+                strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        const bool is_cubic = alg == algorithm::resampling_cubic;
+        auto src_data = map_memory<float>(src);
+        auto dst_data = map_memory<float>(dst);
+        const auto src_str = src_md.get_strides();
+        const auto dst_str = dst_md.get_strides();
+        for_(memory::dim n = 0; n < N; n++)
+        for_(memory::dim c = 0; c < C; c++)
+        for_(memory::dim oh = 0; oh < OH; oh++)
+        for (memory::dim ow = 0; ow < OW; ow++) {
+            const taps_t h_taps = is_cubic ? cubic_taps(oh, OH, IH)
+                                           : antialias_taps(oh, OH, IH);
+            const taps_t w_taps = is_cubic ? cubic_taps(ow, OW, IW)
+                                           : antialias_taps(ow, OW, IW);
+            float ref = 0.f;
+            for_(const auto &h : h_taps)
+            for (const auto &w : w_taps)
+                ref += h.second * w.second
+                        * src_data[n * src_str[0] + c * src_str[1]
+                                + h.first * src_str[2] + w.first * src_str[3]];
+            const float out = dst_data[n * dst_str[0] + c * dst_str[1]
+                    + oh * dst_str[2] + ow * dst_str[3]];
+            ASSERT_NEAR(out, ref, 1e-5);
+        }
+    }
+}
+
 } // namespace dnnl
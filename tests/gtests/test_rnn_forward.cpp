@@ -912,4 +912,405 @@ CPU_INSTANTIATE_TEST_SUITE_P(TestAUGRUlbr, lbr_augru_forward_test_f32,
                                 fmt::undef},
                         test_rnn_sizes_t {1, 1, 5, 1, 4, 4, 4, 4}}));
 
+// A batch of sequences of different lengths gives the results of every
+// sequence computed on its own, and zero outputs past the end of a sequence.
+TEST(rnn_seq_lengths_test_t, TestLSTM) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Sequence lengths are supported on CPU only.");
+
+    const memory::dim L = 2, T = 5, N = 3, C = 4;
+    const std::vector<int32_t> lengths = {5, 3, 1};
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    auto make_md = [](const memory::dims &dims, tag t) {
+        return memory::desc(dims, dt::f32, t);
+    };
+    auto wei_layer_md = make_md({L, 1, C, 4, C}, tag::ldigo);
+    auto wei_iter_md = make_md({L, 1, C, 4, C}, tag::ldigo);
+    auto bias_md = make_md({L, 1, 4, C}, tag::ldgo);
+    auto states_md = [&](memory::dim n) {
+        return make_md({L, 1, n, C}, tag::ldnc);
+    };
+    auto layer_md = [&](memory::dim t, memory::dim n) {
+        return make_md({t, n, C}, tag::tnc);
+    };
+
+    memory wei_layer(wei_layer_md, eng), wei_iter(wei_iter_md, eng),
+            bias(bias_md, eng);
+    fill_data<float>(wei_layer_md.get_size() / sizeof(float), wei_layer, 0.f,
+            0.3f);
+    fill_data<float>(
+            wei_iter_md.get_size() / sizeof(float), wei_iter, 0.f, 0.3f);
+    fill_data<float>(bias_md.get_size() / sizeof(float), bias, 0.f, 0.3f);
+
+    // The batch with sequence lengths, created through the C API as the
+    // C++ constructors do not take RNN flags.
+    dnnl_primitive_desc_t c_pd;
+    auto c_md = [](const memory::desc &md) { return md.get(); };
+    ASSERT_EQ(dnnl_lstm_forward_primitive_desc_create(&c_pd, eng.get(),
+                      dnnl_forward_inference,
+                      dnnl_unidirectional_left2right, c_md(layer_md(T, N)),
+                      c_md(states_md(N)), c_md(states_md(N)),
+                      c_md(wei_layer_md), c_md(wei_iter_md), nullptr, nullptr,
+                      c_md(bias_md), c_md(layer_md(T, N)), c_md(states_md(N)),
+                      c_md(states_md(N)), dnnl_rnn_flags_seq_lengths, nullptr),
+            dnnl_success);
+    lstm_forward::primitive_desc pd(c_pd);
+    ASSERT_EQ(pd.seq_lengths_desc(),
+            memory::desc({N}, dt::s32, memory::format_tag::a));
+
+    memory src_layer(layer_md(T, N), eng), src_iter(states_md(N), eng),
+            src_iter_c(states_md(N), eng), dst_layer(layer_md(T, N), eng),
+            dst_iter(states_md(N), eng), dst_iter_c(states_md(N), eng),
+            seq_lengths(pd.seq_lengths_desc(), eng);
+    fill_data<float>(T * N * C, src_layer, 0.f, 1.f);
+    fill_data<float>(L * N * C, src_iter, 0.f, 1.f);
+    fill_data<float>(L * N * C, src_iter_c, 0.f, 1.f);
+    {
+        auto ptr = map_memory<int32_t>(seq_lengths);
+        for (memory::dim b = 0; b < N; b++)
+            ptr[b] = lengths[b];
+    }
+
+    lstm_forward(pd).execute(strm,
+            {{DNNL_ARG_SRC_LAYER, src_layer}, {DNNL_ARG_SRC_ITER, src_iter},
+                    {DNNL_ARG_SRC_ITER_C, src_iter_c},
+                    {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                    {DNNL_ARG_WEIGHTS_ITER, wei_iter}, {DNNL_ARG_BIAS, bias},
+                    {DNNL_ARG_DST_LAYER, dst_layer},
+                    {DNNL_ARG_DST_ITER, dst_iter},
+                    {DNNL_ARG_DST_ITER_C, dst_iter_c},
+                    {DNNL_ARG_SEQ_LENGTHS, seq_lengths}});
+    strm.wait();
+
+    auto src_layer_ptr = map_memory<float>(src_layer);
+    auto src_iter_ptr = map_memory<float>(src_iter);
+    auto src_iter_c_ptr = map_memory<float>(src_iter_c);
+    auto dst_layer_ptr = map_memory<float>(dst_layer);
+    auto dst_iter_ptr = map_memory<float>(dst_iter);
+    auto dst_iter_c_ptr = map_memory<float>(dst_iter_c);
+
+    const float eps = 1e-5f;
+    for (memory::dim b = 0; b < N; b++) {
+        // Every sequence on its own, as a batch of one.
+        const memory::dim len = lengths[b];
+        lstm_forward::primitive_desc ref_pd(eng,
+                prop_kind::forward_inference,
+                rnn_direction::unidirectional_left2right, layer_md(len, 1),
+                states_md(1), states_md(1), wei_layer_md, wei_iter_md,
+                bias_md, layer_md(len, 1), states_md(1), states_md(1));
+        memory ref_src_layer(layer_md(len, 1), eng),
+                ref_src_iter(states_md(1), eng),
+                ref_src_iter_c(states_md(1), eng),
+                ref_dst_layer(layer_md(len, 1), eng),
+                ref_dst_iter(states_md(1), eng),
+                ref_dst_iter_c(states_md(1), eng);
+        {
+            auto sl = map_memory<float>(ref_src_layer);
+            auto si = map_memory<float>(ref_src_iter);
+            auto sc = map_memory<float>(ref_src_iter_c);
+            for (memory::dim t = 0; t < len; t++)
+                for (memory::dim c = 0; c < C; c++)
+                    sl[t * C + c] = src_layer_ptr[(t * N + b) * C + c];
+            for (memory::dim l = 0; l < L; l++)
+                for (memory::dim c = 0; c < C; c++) {
+                    si[l * C + c] = src_iter_ptr[(l * N + b) * C + c];
+                    sc[l * C + c] = src_iter_c_ptr[(l * N + b) * C + c];
+                }
+        }
+        lstm_forward(ref_pd).execute(strm,
+                {{DNNL_ARG_SRC_LAYER, ref_src_layer},
+                        {DNNL_ARG_SRC_ITER, ref_src_iter},
+                        {DNNL_ARG_SRC_ITER_C, ref_src_iter_c},
+                        {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                        {DNNL_ARG_WEIGHTS_ITER, wei_iter},
+                        {DNNL_ARG_BIAS, bias},
+                        {DNNL_ARG_DST_LAYER, ref_dst_layer},
+                        {DNNL_ARG_DST_ITER, ref_dst_iter},
+                        {DNNL_ARG_DST_ITER_C, ref_dst_iter_c}});
+        strm.wait();
+
+        auto dl = map_memory<float>(ref_dst_layer);
+        auto di = map_memory<float>(ref_dst_iter);
+        auto dc = map_memory<float>(ref_dst_iter_c);
+        for (memory::dim t = 0; t < T; t++)
+            for (memory::dim c = 0; c < C; c++) {
+                const float ref = t < len ? dl[t * C + c] : 0.f;
+                ASSERT_NEAR(dst_layer_ptr[(t * N + b) * C + c], ref, eps);
+            }
+        for (memory::dim l = 0; l < L; l++)
+            for (memory::dim c = 0; c < C; c++) {
+                ASSERT_NEAR(
+                        dst_iter_ptr[(l * N + b) * C + c], di[l * C + c], eps);
+                ASSERT_NEAR(dst_iter_c_ptr[(l * N + b) * C + c],
+                        dc[l * C + c], eps);
+            }
+    }
+}
+
+// Executing a sequence one step at a time with the states updated in place
+// gives the results of executing it at once.
+class rnn_streaming_test_t : public ::testing::TestWithParam<algorithm> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "In-place states are supported on CPU only.");
+        Test();
+    }
+
+    void Test() {
+        const algorithm alg = GetParam();
+        const bool is_lstm = alg == algorithm::vanilla_lstm;
+        const memory::dim G = is_lstm ? 4 : 3;
+        const memory::dim L = 2, T = 3, N = 2, C = 8;
+        using tag = memory::format_tag;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        auto make_md = [](const memory::dims &dims, tag t) {
+            return memory::desc(dims, memory::data_type::f32, t);
+        };
+        auto wei_md = make_md({L, 1, C, G, C}, tag::ldigo);
+        auto bias_md = make_md({L, 1, G, C}, tag::ldgo);
+        auto states_md = make_md({L, 1, N, C}, tag::ldnc);
+        auto layer_md = [&](memory::dim t) {
+            return make_md({t, N, C}, tag::tnc);
+        };
+
+        auto make_prim = [&](memory::dim t) -> primitive {
+            if (is_lstm)
+                return lstm_forward(lstm_forward::primitive_desc(eng,
+                        prop_kind::forward_inference,
+                        rnn_direction::unidirectional_left2right,
+                        layer_md(t), states_md, states_md, wei_md, wei_md,
+                        bias_md, layer_md(t), states_md, states_md));
+            return gru_forward(gru_forward::primitive_desc(eng,
+                    prop_kind::forward_inference,
+                    rnn_direction::unidirectional_left2right, layer_md(t),
+                    states_md, wei_md, wei_md, bias_md, layer_md(t),
+                    states_md));
+        };
+
+        memory wei_layer(wei_md, eng), wei_iter(wei_md, eng),
+                bias(bias_md, eng);
+        const memory::dim wei_nelems = L * C * G * C;
+        fill_data<float>(wei_nelems, wei_layer, 0.f, 0.3f);
+        fill_data<float>(wei_nelems, wei_iter, 0.f, 0.3f);
+        fill_data<float>(L * G * C, bias, 0.f, 0.3f);
+
+        memory src_layer(layer_md(T), eng), src_iter(states_md, eng),
+                src_iter_c(states_md, eng), dst_layer(layer_md(T), eng),
+                dst_iter(states_md, eng), dst_iter_c(states_md, eng);
+        fill_data<float>(T * N * C, src_layer, 0.f, 1.f);
+        fill_data<float>(L * N * C, src_iter, 0.f, 1.f);
+        fill_data<float>(L * N * C, src_iter_c, 0.f, 1.f);
+
+        auto make_args = [&](const memory &sl, const memory &si,
+                                 const memory &sc, const memory &dl,
+                                 const memory &di, const memory &dc) {
+            std::unordered_map<int, memory> args
+                    = {{DNNL_ARG_SRC_LAYER, sl}, {DNNL_ARG_SRC_ITER, si},
+                            {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                            {DNNL_ARG_WEIGHTS_ITER, wei_iter},
+                            {DNNL_ARG_BIAS, bias}, {DNNL_ARG_DST_LAYER, dl},
+                            {DNNL_ARG_DST_ITER, di}};
+            if (is_lstm) {
+                args.insert({DNNL_ARG_SRC_ITER_C, sc});
+                args.insert({DNNL_ARG_DST_ITER_C, dc});
+            }
+            return args;
+        };
+
+        // The whole sequence at once.
+        make_prim(T).execute(strm,
+                make_args(src_layer, src_iter, src_iter_c, dst_layer,
+                        dst_iter, dst_iter_c));
+
+        // The same sequence one step at a time, with the states in place.
+        memory iter(states_md, eng), iter_c(states_md, eng),
+                step_src(layer_md(1), eng), step_dst(layer_md(1), eng);
+        {
+            auto si = map_memory<float>(src_iter);
+            auto sc = map_memory<float>(src_iter_c);
+            auto i = map_memory<float>(iter);
+            auto c = map_memory<float>(iter_c);
+            for (memory::dim e = 0; e < L * N * C; e++) {
+                i[e] = si[e];
+                c[e] = sc[e];
+            }
+        }
+        auto step = make_prim(1);
+        const float eps = 1e-5f;
+        for (memory::dim t = 0; t < T; t++) {
+            {
+                auto sl = map_memory<float>(src_layer);
+                auto s = map_memory<float>(step_src);
+                for (memory::dim e = 0; e < N * C; e++)
+                    s[e] = sl[t * N * C + e];
+            }
+            step.execute(strm,
+                    make_args(
+                            step_src, iter, iter_c, step_dst, iter, iter_c));
+            strm.wait();
+
+            auto dl = map_memory<float>(dst_layer);
+            auto d = map_memory<float>(step_dst);
+            for (memory::dim e = 0; e < N * C; e++)
+                ASSERT_NEAR(d[e], dl[t * N * C + e], eps);
+        }
+
+        auto di = map_memory<float>(dst_iter);
+        auto dc = map_memory<float>(dst_iter_c);
+        auto i = map_memory<float>(iter);
+        auto c = map_memory<float>(iter_c);
+        for (memory::dim e = 0; e < L * N * C; e++) {
+            ASSERT_NEAR(i[e], di[e], eps);
+            if (is_lstm) { ASSERT_NEAR(c[e], dc[e], eps); }
+        }
+    }
+};
+
+TEST_P(rnn_streaming_test_t, TestsInPlaceStates) {}
+INSTANTIATE_TEST_SUITE_P(TestRnnStreaming, rnn_streaming_test_t,
+        ::testing::Values(algorithm::vanilla_lstm, algorithm::vanilla_gru));
+
+// A projection LSTM with bf16 activations and s8 weights gives the results of
+// the one with the dequantized bf16 weights.
+TEST(rnn_wei_decompression_test_t, TestLSTMP) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Weights decompression is supported on CPU only.");
+
+    const memory::dim T = 3, N = 2, C = 16, P = 8;
+    const float scale = 64.f;
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    memory::desc src_layer_md({T, N, C}, dt::bf16, tag::tnc);
+    memory::desc src_iter_md({1, 1, N, P}, dt::bf16, tag::ldnc);
+    memory::desc iter_c_md({1, 1, N, C}, dt::f32, tag::ldnc);
+    memory::desc bias_md({1, 1, 4, C}, dt::f32, tag::ldgo);
+    memory::desc dst_layer_md({T, N, P}, dt::bf16, tag::tnc);
+    const memory::dims wei_layer_dims = {1, 1, C, 4, C};
+    const memory::dims wei_iter_dims = {1, 1, P, 4, C};
+    const memory::dims wei_proj_dims = {1, 1, C, P};
+
+    primitive_attr attr;
+    attr.set_rnn_weights_qparams(0, {scale});
+    attr.set_rnn_weights_projection_qparams(0, {scale});
+    auto make_pd = [&](dt wei_dt, const primitive_attr &pd_attr) {
+        return lstm_forward::primitive_desc(eng, prop_kind::forward_inference,
+                rnn_direction::unidirectional_left2right, src_layer_md,
+                src_iter_md, iter_c_md,
+                memory::desc(wei_layer_dims, wei_dt, tag::any),
+                memory::desc(wei_iter_dims, wei_dt, tag::any), memory::desc(),
+                memory::desc(wei_proj_dims, wei_dt, tag::any), bias_md,
+                dst_layer_md, src_iter_md, iter_c_md, pd_attr, true);
+    };
+    auto pd = make_pd(dt::s8, attr);
+    SKIP_IF(!pd, "Weights decompression is not supported on this platform.");
+    auto ref_pd = make_pd(dt::bf16, primitive_attr());
+    ASSERT_TRUE(ref_pd);
+
+    // The int8 weights, and the same weights dequantized, which bf16
+    // represents exactly.
+    auto make_weights = [&](const memory::dims &dims, tag t,
+                                const memory::desc &wei_md,
+                                const memory::desc &ref_wei_md, memory &wei,
+                                memory &ref_wei) {
+        memory::desc s8_md(dims, dt::s8, t), f32_md(dims, dt::f32, t);
+        memory s8_mem(s8_md, eng), f32_mem(f32_md, eng);
+        {
+            auto s8_ptr = map_memory<int8_t>(s8_mem);
+            auto f32_ptr = map_memory<float>(f32_mem);
+            const memory::dim nelems = f32_md.get_size() / sizeof(float);
+            for (memory::dim e = 0; e < nelems; e++) {
+                const int8_t v = (int8_t)((e * 37) % 255 - 127);
+                s8_ptr[e] = v;
+                f32_ptr[e] = v / scale;
+            }
+        }
+        wei = memory(wei_md, eng);
+        ref_wei = memory(ref_wei_md, eng);
+        reorder(s8_mem, wei).execute(strm, s8_mem, wei);
+        reorder(f32_mem, ref_wei).execute(strm, f32_mem, ref_wei);
+    };
+    memory wei_layer, wei_iter, wei_proj, ref_wei_layer, ref_wei_iter,
+            ref_wei_proj;
+    make_weights(wei_layer_dims, tag::ldigo, pd.weights_layer_desc(),
+            ref_pd.weights_layer_desc(), wei_layer, ref_wei_layer);
+    make_weights(wei_iter_dims, tag::ldigo, pd.weights_iter_desc(),
+            ref_pd.weights_iter_desc(), wei_iter, ref_wei_iter);
+    make_weights(wei_proj_dims, tag::ldio, pd.weights_projection_desc(),
+            ref_pd.weights_projection_desc(), wei_proj, ref_wei_proj);
+
+    // bf16 activations from f32 data.
+    auto make_bf16 = [&](const memory::desc &md) {
+        memory f32_mem(
+                memory::desc(md.get_dims(), dt::f32, md.get_strides()), eng);
+        memory mem(md, eng);
+        fill_data<float>(md.get_size() / sizeof(uint16_t), f32_mem, 0.f, 1.f);
+        reorder(f32_mem, mem).execute(strm, f32_mem, mem);
+        return mem;
+    };
+    auto src_layer = make_bf16(src_layer_md);
+    auto src_iter = make_bf16(src_iter_md);
+    memory src_iter_c(iter_c_md, eng), bias(bias_md, eng);
+    fill_data<float>(N * C, src_iter_c, 0.f, 1.f);
+    fill_data<float>(4 * C, bias, 0.f, 0.3f);
+
+    auto run = [&](const lstm_forward::primitive_desc &apd, memory &w_layer,
+                       memory &w_iter, memory &w_proj, memory &dst_layer,
+                       memory &dst_iter, memory &dst_iter_c) {
+        dst_layer = memory(dst_layer_md, eng);
+        dst_iter = memory(src_iter_md, eng);
+        dst_iter_c = memory(iter_c_md, eng);
+        lstm_forward(apd).execute(strm,
+                {{DNNL_ARG_SRC_LAYER, src_layer}, {DNNL_ARG_SRC_ITER, src_iter},
+                        {DNNL_ARG_SRC_ITER_C, src_iter_c},
+                        {DNNL_ARG_WEIGHTS_LAYER, w_layer},
+                        {DNNL_ARG_WEIGHTS_ITER, w_iter},
+                        {DNNL_ARG_WEIGHTS_PROJECTION, w_proj},
+                        {DNNL_ARG_BIAS, bias}, {DNNL_ARG_DST_LAYER, dst_layer},
+                        {DNNL_ARG_DST_ITER, dst_iter},
+                        {DNNL_ARG_DST_ITER_C, dst_iter_c}});
+        strm.wait();
+    };
+    memory dst_layer, dst_iter, dst_iter_c, ref_dst_layer, ref_dst_iter,
+            ref_dst_iter_c;
+    run(pd, wei_layer, wei_iter, wei_proj, dst_layer, dst_iter, dst_iter_c);
+    run(ref_pd, ref_wei_layer, ref_wei_iter, ref_wei_proj, ref_dst_layer,
+            ref_dst_iter, ref_dst_iter_c);
+
+    auto to_f32 = [&](memory &mem) {
+        const auto &md = mem.get_desc();
+        memory f32_mem(
+                memory::desc(md.get_dims(), dt::f32, md.get_strides()), eng);
+        reorder(mem, f32_mem).execute(strm, mem, f32_mem);
+        strm.wait();
+        return f32_mem;
+    };
+    auto dl = to_f32(dst_layer), ref_dl = to_f32(ref_dst_layer);
+    auto di = to_f32(dst_iter), ref_di = to_f32(ref_dst_iter);
+    auto dl_ptr = map_memory<float>(dl), ref_dl_ptr = map_memory<float>(ref_dl);
+    auto di_ptr = map_memory<float>(di), ref_di_ptr = map_memory<float>(ref_di);
+    auto dc_ptr = map_memory<float>(dst_iter_c);
+    auto ref_dc_ptr = map_memory<float>(ref_dst_iter_c);
+
+    const float eps = 1e-6f;
+    for (memory::dim e = 0; e < T * N * P; e++)
+        ASSERT_NEAR(dl_ptr[e], ref_dl_ptr[e], eps);
+    for (memory::dim e = 0; e < N * P; e++)
+        ASSERT_NEAR(di_ptr[e], ref_di_ptr[e], eps);
+    for (memory::dim e = 0; e < N * C; e++)
+        ASSERT_NEAR(dc_ptr[e], ref_dc_ptr[e], eps);
+}
+
 } // namespace dnnl
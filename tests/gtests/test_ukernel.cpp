@@ -0,0 +1,331 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+#include "oneapi/dnnl/dnnl_ukernel.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+namespace dnnl {
+
+using namespace ukernel;
+using dim = memory::dim;
+using dt = memory::data_type;
+
+namespace {
+
+// Returns `false` when a ukernel object is not supported on the system.
+template <typename ukernel_t>
+bool try_generate(ukernel_t &ukernel) {
+    try {
+        ukernel.generate();
+    } catch (const error &e) {
+        if (e.status == dnnl_unimplemented) return false;
+        throw;
+    }
+    return true;
+}
+
+// Computes `D[m][n] = sum_i A_i[m][n] * B_i[n]` for the batches of tensors A
+// and B placed at `A_offs[i]` and `B_offs[i]` elements.
+void ref_brdgmm(const std::vector<float> &A, const std::vector<float> &B,
+        const std::vector<dim> &A_offs, const std::vector<dim> &B_offs, dim M,
+        dim N, dim lda, std::vector<float> &D, dim ldd) {
+    for (dim m = 0; m < M; m++) {
+        for (dim n = 0; n < N; n++) {
+            float acc = 0.f;
+            for (size_t i = 0; i < A_offs.size(); i++)
+                acc += A[A_offs[i] + m * lda + n] * B[B_offs[i] + n];
+            D[m * ldd + n] = acc;
+        }
+    }
+}
+
+// Computes a softmax of each of M rows of N elements.
+void ref_softmax(const std::vector<float> &src, dim M, dim N, dim ld_src,
+        std::vector<float> &dst, dim ld_dst) {
+    for (dim m = 0; m < M; m++) {
+        const float *s = &src[m * ld_src];
+        float max = s[0];
+        for (dim n = 1; n < N; n++)
+            max = std::max(max, s[n]);
+        double sum = 0.;
+        for (dim n = 0; n < N; n++)
+            sum += std::exp(s[n] - max);
+        for (dim n = 0; n < N; n++) {
+            const double e = std::exp(s[n] - max);
+            dst[m * ld_dst + n] = static_cast<float>(e / sum);
+        }
+    }
+}
+
+} // namespace
+
+TEST(ukernel_brdgmm_test, TestCorrectness) {
+    const dim M = 5, N = 24, lda = 32, ldc = N, bs = 3;
+    const dim A_sz = M * lda;
+
+    // Small integers keep the sums exact.
+    std::vector<float> A(bs * A_sz), B(bs * N);
+    for (size_t i = 0; i < A.size(); i++)
+        A[i] = static_cast<float>(i % 7) - 3.f;
+    for (size_t i = 0; i < B.size(); i++)
+        B[i] = static_cast<float>(i % 5) - 2.f;
+
+    // Offsets walk the batches in a reversed order to catch a kernel ignoring
+    // them.
+    std::vector<dim> A_offs(bs), B_offs(bs);
+    std::vector<std::pair<dim, dim>> A_B_offsets(bs);
+    for (dim i = 0; i < bs; i++) {
+        A_offs[i] = (bs - 1 - i) * A_sz;
+        B_offs[i] = (bs - 1 - i) * N;
+        A_B_offsets[i] = {A_offs[i] * sizeof(float), B_offs[i] * sizeof(float)};
+    }
+    std::vector<float> ref(M * ldc);
+    ref_brdgmm(A, B, A_offs, B_offs, M, N, lda, ref, ldc);
+
+    for (bool use_strides : {false, true}) {
+        brdgmm brd(M, N, bs, lda, ldc, dt::f32, dt::f32, dt::f32,
+                /* allow_empty = */ true);
+        SKIP_IF(!brd, "BRDGMM ukernel is not supported.");
+        // Strides walk the batches in a natural order.
+        if (use_strides)
+            brd.set_batch_strides(A_sz * sizeof(float), N * sizeof(float));
+        SKIP_IF(!brd.finalize(), "BRDGMM ukernel is not supported.");
+        SKIP_IF(!try_generate(brd), "BRDGMM ukernel is not supported.");
+
+        std::vector<float> C(M * ldc, NAN);
+        if (use_strides) {
+            brd.execute(A.data(), B.data(), C.data());
+        } else {
+            brd.execute(A.data(), B.data(), A_B_offsets, C.data());
+        }
+
+        // The sum is independent of the batch order.
+        for (dim i = 0; i < M * ldc; i++)
+            ASSERT_EQ(C[i], ref[i]) << "strides=" << use_strides << " i=" << i;
+    }
+}
+
+TEST(ukernel_brdgmm_test, TestPostOps) {
+    const dim M = 3, N = 16, lda = N, ldc = N, ldd = 20, bs = 2;
+
+    std::vector<float> A(bs * M * lda), B(bs * N), B_scales(N);
+    for (size_t i = 0; i < A.size(); i++)
+        A[i] = static_cast<float>(i % 9) - 4.f;
+    for (size_t i = 0; i < B.size(); i++)
+        B[i] = static_cast<float>(i % 3) - 1.f;
+    for (dim n = 0; n < N; n++)
+        B_scales[n] = static_cast<float>(n % 4 + 1) / 2.f;
+
+    brdgmm brd(M, N, bs, lda, ldc, dt::f32, dt::f32, dt::f32,
+            /* allow_empty = */ true);
+    SKIP_IF(!brd, "BRDGMM ukernel is not supported.");
+    post_ops ops;
+    ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+    brd.set_post_ops(ldd, dt::f32, ops);
+    brd.set_B_scales(1 << 1);
+    brd.set_batch_strides(M * lda * sizeof(float), N * sizeof(float));
+    SKIP_IF(!brd.finalize(), "BRDGMM ukernel is not supported.");
+    SKIP_IF(!try_generate(brd), "BRDGMM ukernel is not supported.");
+
+    attr_params params;
+    params.set_B_scales(B_scales.data());
+    // Elements between N and `ldd` must stay untouched.
+    std::vector<float> D(M * ldd, -1.f);
+    brd.execute(A.data(), B.data(), D.data(), params);
+
+    std::vector<float> ref(M * ldd, -1.f);
+    ref_brdgmm(A, B, {0, M * lda}, {0, N}, M, N, lda, ref, ldd);
+    for (dim m = 0; m < M; m++) {
+        for (dim n = 0; n < N; n++) {
+            float &r = ref[m * ldd + n];
+            r = std::max(r * B_scales[n], 0.f);
+        }
+    }
+    for (dim i = 0; i < M * ldd; i++)
+        ASSERT_EQ(D[i], ref[i]) << "i=" << i;
+}
+
+TEST(ukernel_transform_test, TestDecompression) {
+    // A single block by N keeps the packed f32 output plain: row `k` of the
+    // weights lands at `k * out_ld`.
+    const dim K = 64, N = 16, ld = 16;
+    const int32_t zp = 3;
+
+    std::vector<int8_t> wei(K * N);
+    for (dim i = 0; i < K * N; i++)
+        wei[i] = static_cast<int8_t>(i % 13 - 6);
+
+    for (dim gK : {dim(1), dim(8), dim(32), K}) {
+        transform pack_B(K, N, pack_type::no_trans, ld, ld, dt::s8, dt::f32,
+                /* allow_empty = */ true);
+        SKIP_IF(!pack_B, "Weights decompression is not supported.");
+        pack_B.set_scales(gK, dt::f32);
+        pack_B.set_zero_points(0);
+        SKIP_IF(!try_generate(pack_B),
+                "Weights decompression is not supported.");
+
+        std::vector<float> scales(K / gK * N);
+        for (size_t i = 0; i < scales.size(); i++)
+            scales[i] = static_cast<float>(i % 7 + 1) / 4.f;
+
+        std::vector<float> packed(K * ld, NAN);
+        pack_B.execute(wei.data(), packed.data(), scales.data(), &zp);
+
+        for (dim k = 0; k < K; k++) {
+            for (dim n = 0; n < N; n++) {
+                const float scale = scales[k / gK * N + n];
+                const float ref = (wei[k * N + n] - zp) * scale;
+                ASSERT_EQ(packed[k * ld + n], ref)
+                        << "gK=" << gK << " k=" << k << " n=" << n;
+            }
+        }
+    }
+}
+
+TEST(ukernel_transform_test, TestDecompressionArguments) {
+    const dim K = 64, N = 16, ld = 16;
+    transform pack_B(K, N, pack_type::no_trans, ld, ld, dt::s8, dt::f32,
+            /* allow_empty = */ true);
+    SKIP_IF(!pack_B, "Weights decompression is not supported.");
+
+    // Groups must divide K.
+    EXPECT_ANY_THROW(pack_B.set_scales(K - 1, dt::f32));
+    // Only a common zero point is supported.
+    EXPECT_ANY_THROW(pack_B.set_zero_points(1 << 1));
+
+    SKIP_IF(!try_generate(pack_B), "Weights decompression is not supported.");
+    // Attributes can't change a generated kernel.
+    EXPECT_ANY_THROW(pack_B.set_scales(K, dt::f32));
+    EXPECT_ANY_THROW(pack_B.set_zero_points(0));
+}
+
+TEST(ukernel_softmax_test, TestCorrectness) {
+    // N is not a multiple of a vector length to cover the tail.
+    const dim M = 3, N = 37, ld_src = 40, ld_dst = 48;
+
+    std::vector<float> src(M * ld_src);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 11) / 2.f - 3.f;
+
+    softmax sm(M, N, ld_src, ld_dst, /* allow_empty = */ true);
+    SKIP_IF(!sm, "Softmax ukernel is not supported.");
+    SKIP_IF(!try_generate(sm), "Softmax ukernel is not supported.");
+
+    // Elements between N and `ld_dst` must stay untouched.
+    std::vector<float> dst(M * ld_dst, -1.f);
+    sm.execute(src.data(), dst.data());
+
+    std::vector<float> ref(M * ld_dst, -1.f);
+    ref_softmax(src, M, N, ld_src, ref, ld_dst);
+    for (dim i = 0; i < M * ld_dst; i++)
+        ASSERT_NEAR(dst[i], ref[i], 1e-6f) << "i=" << i;
+}
+
+TEST(ukernel_softmax_test, TestOnline) {
+    // A row of `n_chunks * N` elements is processed chunk by chunk.
+    const dim M = 2, N = 16, n_chunks = 3, ld = n_chunks * N;
+
+    std::vector<float> src(M * ld);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>((i * 7) % 23) / 4.f - 2.f;
+
+    softmax sm(M, N, ld, ld, /* allow_empty = */ true);
+    SKIP_IF(!sm, "Softmax ukernel is not supported.");
+    sm.set_online(true);
+    SKIP_IF(!try_generate(sm), "Softmax ukernel is not supported.");
+
+    std::vector<float> dst(M * ld);
+    std::vector<float> running_max(M, -FLT_MAX), running_sum(M, 0.f);
+    std::vector<float> correction(M);
+    for (dim c = 0; c < n_chunks; c++) {
+        sm.execute(&src[c * N], &dst[c * N], running_max.data(),
+                running_sum.data(), correction.data());
+        // Rescale the values of the previous chunks to the new maximum.
+        for (dim m = 0; m < M; m++) {
+            for (dim n = 0; n < c * N; n++)
+                dst[m * ld + n] *= correction[m];
+        }
+    }
+    for (dim m = 0; m < M; m++) {
+        for (dim n = 0; n < ld; n++)
+            dst[m * ld + n] /= running_sum[m];
+    }
+
+    std::vector<float> ref(M * ld);
+    ref_softmax(src, M, ld, ld, ref, ld);
+    for (dim i = 0; i < M * ld; i++)
+        ASSERT_NEAR(dst[i], ref[i], 1e-6f) << "i=" << i;
+}
+
+TEST(ukernel_postops_test, TestCorrectness) {
+    const dim M = 4, N = 20, ldc = 24, ldd = 32;
+
+    std::vector<float> C(M * ldc), B_scales(N), bias(N);
+    for (size_t i = 0; i < C.size(); i++)
+        C[i] = static_cast<float>(i % 13) - 6.f;
+    for (dim n = 0; n < N; n++) {
+        B_scales[n] = static_cast<float>(n % 4 + 1) / 2.f;
+        bias[n] = static_cast<float>(n % 5) - 2.f;
+    }
+    const float D_scale = 2.f;
+
+    postops po(M, N, ldc, dt::f32, /* allow_empty = */ true);
+    SKIP_IF(!po, "Post-operations ukernel is not supported.");
+    post_ops ops;
+    ops.append_binary(algorithm::binary_add,
+            memory::desc({1, N}, dt::f32, memory::format_tag::ab));
+    ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+    po.set_post_ops(ldd, dt::f32, ops);
+    po.set_B_scales(1 << 1);
+    po.set_D_scales(0);
+    SKIP_IF(!po.finalize(), "Post-operations ukernel is not supported.");
+    SKIP_IF(!try_generate(po), "Post-operations ukernel is not supported.");
+
+    const void *post_ops_args[] = {bias.data()};
+    attr_params params;
+    params.set_post_ops_args(post_ops_args);
+    params.set_B_scales(B_scales.data());
+    params.set_D_scales(&D_scale);
+
+    // Elements between N and `ldd` must stay untouched.
+    std::vector<float> D(M * ldd, -1.f);
+    po.execute(C.data(), D.data(), params);
+
+    for (dim m = 0; m < M; m++) {
+        for (dim n = 0; n < ldd; n++) {
+            float ref = -1.f;
+            if (n < N) {
+                ref = C[m * ldc + n] * B_scales[n] + bias[n];
+                ref = std::max(ref, 0.f) / D_scale;
+            }
+            ASSERT_EQ(D[m * ldd + n], ref) << "m=" << m << " n=" << n;
+        }
+    }
+}
+
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+// Measures the time the library takes to serve the first API calls of a
+// process, which matters for short-lived processes. Every step is timed on
+// its first call and on a second call, when the library state is set up:
+//   startup-cpp [cpu|gpu]
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+using namespace dnnl;
+
+namespace {
+double time_ms(const std::function<void()> &f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void report(const char *step, const std::function<void()> &f) {
+    const double first = time_ms(f);
+    const double second = time_ms(f);
+    printf("%-24s first: %9.3f ms, second: %9.3f ms\n", step, first, second);
+}
+} // namespace
+
+int main(int argc, char **argv) {
+    engine::kind kind = engine::kind::cpu;
+    if (argc > 1 && strcmp(argv[1], "gpu") == 0) kind = engine::kind::gpu;
+
+    const auto process_start = std::chrono::steady_clock::now();
+    try {
+        report("engine::get_count", [&]() { engine::get_count(kind); });
+        if (engine::get_count(kind) == 0) {
+            printf("no %s engines found\n",
+                    kind == engine::kind::cpu ? "cpu" : "gpu");
+            return 0;
+        }
+
+        engine eng;
+        report("engine", [&]() { eng = engine(kind, 0); });
+        stream strm;
+        report("stream", [&]() { strm = stream(eng); });
+
+        const memory::dims dims = {64, 64};
+        const memory::desc md(
+                dims, memory::data_type::f32, memory::format_tag::ab);
+        matmul::primitive_desc pd;
+        report("primitive_desc", [&]() {
+            pd = matmul::primitive_desc(eng, md, md, md);
+        });
+        matmul prim;
+        report("primitive", [&]() { prim = matmul(pd); });
+
+        memory a(md, eng), b(md, eng), c(md, eng);
+        report("execute", [&]() {
+            prim.execute(strm,
+                    {{DNNL_ARG_SRC, a}, {DNNL_ARG_WEIGHTS, b},
+                            {DNNL_ARG_DST, c}});
+            strm.wait();
+        });
+    } catch (error &e) {
+        printf("error: %s\n", e.what());
+        return 1;
+    }
+    const auto process_end = std::chrono::steady_clock::now();
+    printf("%-24s        %9.3f ms\n", "total",
+            std::chrono::duration<double, std::milli>(
+                    process_end - process_start)
+                    .count());
+    return 0;
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2022 Intel Corporation
+* Copyright 2020-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -174,6 +174,35 @@ public:
 } // namespace testing
 } // namespace dnnl
 
+#elif defined(DNNL_TEST_THREADPOOL_USE_BUILTIN)
+#include "oneapi/dnnl/dnnl_threadpool.hpp"
+
+namespace dnnl {
+namespace testing {
+
+// Forwards to the threadpool shipped with the library.
+class threadpool_t : public dnnl::threadpool_interop::threadpool_iface {
+public:
+    explicit threadpool_t(int num_threads = 0)
+        : tp_(num_threads > 0 ? num_threads : read_num_threads_from_env()) {}
+    int get_num_threads() const override {
+        return tp_.get()->get_num_threads();
+    }
+    bool get_in_parallel() const override {
+        return tp_.get()->get_in_parallel();
+    }
+    uint64_t get_flags() const override { return tp_.get()->get_flags(); }
+    void parallel_for(int n, const std::function<void(int, int)> &fn) override {
+        tp_.get()->parallel_for(n, fn);
+    }
+
+private:
+    dnnl::threadpool_interop::builtin_threadpool tp_;
+};
+
+} // namespace testing
+} // namespace dnnl
+
 #else
 
 #include <atomic>